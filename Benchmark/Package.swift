@@ -0,0 +1,22 @@
+// swift-tools-version: 5.9
+import PackageDescription
+
+let package = Package(
+    name: "kuzu-swift-benchmark",
+    platforms: [
+        .macOS(.v11),
+    ],
+    dependencies: [
+        // Benchmarks are run against the package in this checkout, so that a change or an upgrade of
+        // the engine can be compared with the previous results.
+        .package(name: "kuzu-swift", path: ".."),
+    ],
+    targets: [
+        .executableTarget(
+            name: "kuzu-swift-benchmark",
+            dependencies: [
+                .product(name: "Kuzu", package: "kuzu-swift"),
+            ]
+        ),
+    ]
+)
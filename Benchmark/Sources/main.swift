@@ -0,0 +1,655 @@
+import Foundation
+import Kuzu
+
+// MARK: - Options
+
+struct Options {
+    // Number of Person nodes. The sizes of the other tables are derived from it.
+    var scale = 100_000
+    var iterations = 5
+    var warmupIterations = 1
+    var filter: String?
+    var outputPath: String?
+    var baselinePath: String?
+    // Relative slowdown of the median time over the baseline that is reported as a regression.
+    var threshold = 0.1
+    // Workload recorded through the workload_record_file setting, which is replayed against a copy
+    // of the database instead of running the benchmarks.
+    var replayPath: String?
+    var databasePath: String?
+    // Speedup of the replay over the recorded timing. 0 issues the queries without waiting.
+    var speed = 1.0
+
+    static let usage = """
+        Usage: kuzu-swift-benchmark [--scale N] [--iterations N] [--warmup N] [--filter NAME]
+                                    [--output FILE] [--baseline FILE] [--threshold RATIO]
+               kuzu-swift-benchmark --replay FILE --database PATH [--speed N] [--output FILE]
+        """
+
+    static func parse(_ arguments: [String]) -> Options {
+        var options = Options()
+        var index = 1
+        func nextValue() -> String {
+            index += 1
+            guard index < arguments.count else {
+                fail("Missing value for \(arguments[index - 1])\n\(usage)")
+            }
+            return arguments[index]
+        }
+        func nextInt() -> Int {
+            let value = nextValue()
+            guard let result = Int(value), result > 0 else {
+                fail("Expected a positive integer instead of \(value)")
+            }
+            return result
+        }
+        while index < arguments.count {
+            switch arguments[index] {
+            case "--scale": options.scale = nextInt()
+            case "--iterations": options.iterations = nextInt()
+            case "--warmup": options.warmupIterations = Int(nextValue()) ?? 0
+            case "--filter": options.filter = nextValue()
+            case "--output": options.outputPath = nextValue()
+            case "--baseline": options.baselinePath = nextValue()
+            case "--threshold": options.threshold = Double(nextValue()) ?? options.threshold
+            case "--replay": options.replayPath = nextValue()
+            case "--database": options.databasePath = nextValue()
+            case "--speed":
+                let value = nextValue()
+                guard let speed = Double(value), speed >= 0 else {
+                    fail("Expected a non-negative speed instead of \(value)")
+                }
+                options.speed = speed
+            case "--help":
+                print(usage)
+                exit(0)
+            default: fail("Unknown argument \(arguments[index])\n\(usage)")
+            }
+            index += 1
+        }
+        return options
+    }
+}
+
+func fail(_ message: String) -> Never {
+    log(message)
+    exit(2)
+}
+
+func log(_ message: String) {
+    FileHandle.standardError.write((message + "\n").data(using: .utf8)!)
+}
+
+// MARK: - Dataset
+
+// A linear congruential generator, so that every run benchmarks the same dataset.
+struct RandomGenerator {
+    var state: UInt64
+
+    mutating func next(below bound: Int) -> Int {
+        state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+        return Int((state >> 33) % UInt64(bound))
+    }
+}
+
+let vocabulary = [
+    "graph", "database", "query", "storage", "index", "vector", "node", "edge", "path", "join",
+    "scan", "buffer", "page", "column", "table", "cypher", "swift", "kernel", "thread", "cache",
+    "memory", "disk", "batch", "filter", "aggregate", "order", "limit", "merge", "copy", "parquet",
+]
+
+let embeddingDimension = 8
+
+struct Dataset {
+    let directory: URL
+    let numPersons: Int
+    let numPosts: Int
+    let numItems: Int
+
+    var personCSV: String { directory.appendingPathComponent("person.csv").path }
+    var knowsCSV: String { directory.appendingPathComponent("knows.csv").path }
+    var postCSV: String { directory.appendingPathComponent("post.csv").path }
+    var itemCSV: String { directory.appendingPathComponent("item.csv").path }
+    var personParquet: String { directory.appendingPathComponent("person.parquet").path }
+
+    // The columns of Person are chosen to be stored with different compression: sequential ids,
+    // small integers, floating point values, a handful of distinct strings and unique strings.
+    static func generate(scale: Int, in directory: URL) throws -> Dataset {
+        let dataset = Dataset(
+            directory: directory, numPersons: scale, numPosts: max(scale / 10, 1),
+            numItems: max(scale / 10, 1))
+        var random = RandomGenerator(state: 42)
+        try writeLines(to: dataset.personCSV, count: dataset.numPersons) { i in
+            let age = 18 + random.next(below: 72)
+            let score = Double(random.next(below: 10_000)) / 100
+            return "\(i),person\(i),\(age),\(score),city\(random.next(below: 100))"
+        }
+        let degree = 8
+        try writeLines(to: dataset.knowsCSV, count: dataset.numPersons * degree) { i in
+            let since = 2000 + random.next(below: 25)
+            return "\(i / degree),\(random.next(below: dataset.numPersons)),\(since)"
+        }
+        try writeLines(to: dataset.postCSV, count: dataset.numPosts) { i in
+            let words = (0..<20).map { _ in vocabulary[random.next(below: vocabulary.count)] }
+            return "\(i),\(words.joined(separator: " "))"
+        }
+        try writeLines(to: dataset.itemCSV, count: dataset.numItems) { i in
+            let values = (0..<embeddingDimension).map { _ in
+                String(Double(random.next(below: 1000)) / 1000)
+            }
+            return "\(i)|[\(values.joined(separator: ","))]"
+        }
+        return dataset
+    }
+
+    private static func writeLines(
+        to path: String, count: Int, _ line: (Int) -> String
+    ) throws {
+        FileManager.default.createFile(atPath: path, contents: nil)
+        let file = try FileHandle(forWritingTo: URL(fileURLWithPath: path))
+        defer { try? file.close() }
+        var buffer = ""
+        for i in 0..<count {
+            buffer += line(i)
+            buffer += "\n"
+            if buffer.utf8.count > 1 << 20 {
+                file.write(buffer.data(using: .utf8)!)
+                buffer = ""
+            }
+        }
+        file.write(buffer.data(using: .utf8)!)
+    }
+}
+
+let personSchema = "(id INT64 PRIMARY KEY, name STRING, age INT64, score DOUBLE, city STRING)"
+
+func load(_ dataset: Dataset, into conn: Connection) throws {
+    let queries = [
+        "CREATE NODE TABLE Person\(personSchema);",
+        "CREATE REL TABLE Knows(FROM Person TO Person, since INT64);",
+        "CREATE NODE TABLE Post(id INT64 PRIMARY KEY, content STRING);",
+        "CREATE NODE TABLE Item(id INT64 PRIMARY KEY, embedding FLOAT[\(embeddingDimension)]);",
+        "COPY Person FROM '\(dataset.personCSV)';",
+        "COPY Knows FROM '\(dataset.knowsCSV)';",
+        "COPY Post FROM '\(dataset.postCSV)';",
+        "COPY Item FROM '\(dataset.itemCSV)' (DELIM='|');",
+        "COPY (MATCH (p:Person) RETURN p.id, p.name, p.age, p.score, p.city) "
+            + "TO '\(dataset.personParquet)';",
+        "CALL CREATE_FTS_INDEX('Post', 'post_content', ['content']);",
+        "CALL CREATE_VECTOR_INDEX('Item', 'item_embedding', 'embedding');",
+        "CALL project_graph('KnowsGraph', ['Person'], ['Knows']);",
+    ]
+    for query in queries {
+        _ = try conn.query(query)
+    }
+}
+
+// MARK: - Benchmarks
+
+struct Benchmark {
+    let name: String
+    // Runs before each iteration, outside of the timed section.
+    var reset: ((Connection) throws -> Void)?
+    // Returns the number of rows produced or processed, which is reported with the timings.
+    let run: (Connection) throws -> UInt64
+}
+
+func queryBenchmark(_ name: String, _ query: String) -> Benchmark {
+    return Benchmark(name: name) { conn in
+        try conn.query(query).getRowCount()
+    }
+}
+
+func copyBenchmark(_ name: String, from path: String, rows: Int) -> Benchmark {
+    return Benchmark(
+        name: name,
+        reset: { conn in
+            _ = try conn.query("DROP TABLE IF EXISTS PersonCopy;")
+            _ = try conn.query("CREATE NODE TABLE PersonCopy\(personSchema);")
+        },
+        run: { conn in
+            _ = try conn.query("COPY PersonCopy FROM '\(path)';")
+            return UInt64(rows)
+        })
+}
+
+// Opens a checkpointed copy of the loaded database and looks up one person, which times the
+// deserialization of the catalog and of the storage metadata needed by the query.
+func openBenchmark(_ name: String, databasePath: String) -> Benchmark {
+    return Benchmark(name: name) { _ in
+        let db = try Database(databasePath)
+        let conn = try Connection(db)
+        return try conn.query("MATCH (p:Person) WHERE p.id = 0 RETURN p.name;").getRowCount()
+    }
+}
+
+// Point lookups and short traversals from many start nodes, similar to the short reads of
+// LDBC SNB Interactive.
+func parameterizedBenchmark(
+    _ name: String, _ query: String, numExecutions: Int, numPersons: Int
+) -> Benchmark {
+    return Benchmark(name: name) { conn in
+        let statement = try conn.prepare(query)
+        var random = RandomGenerator(state: 7)
+        var numRows: UInt64 = 0
+        for _ in 0..<numExecutions {
+            let id = Int64(random.next(below: numPersons))
+            #if os(Linux)
+                let parameters: [String: KuzuInt64Wrapper?] = ["id": KuzuInt64Wrapper(value: id)]
+            #else
+                let parameters: [String: Int64?] = ["id": id]
+            #endif
+            numRows += try conn.execute(statement, parameters).getRowCount()
+        }
+        return numRows
+    }
+}
+
+let bridgingQuery = "MATCH (p:Person) RETURN p.id, p.name, p.score;"
+
+func makeBenchmarks(_ dataset: Dataset, openDatabasePath: String) -> [Benchmark] {
+    let queryVector = (0..<embeddingDimension).map { _ in "0.5" }.joined(separator: ",")
+    return [
+        queryBenchmark("scan/int64_sequential", "MATCH (p:Person) RETURN SUM(p.id);"),
+        queryBenchmark("scan/int64_bitpacked", "MATCH (p:Person) RETURN SUM(p.age);"),
+        queryBenchmark("scan/double", "MATCH (p:Person) RETURN SUM(p.score);"),
+        queryBenchmark(
+            "scan/string_dictionary", "MATCH (p:Person) RETURN COUNT(DISTINCT p.city);"),
+        queryBenchmark("scan/string_unique", "MATCH (p:Person) RETURN MAX(p.name);"),
+        queryBenchmark("filter/int64_range", "MATCH (p:Person) WHERE p.age > 60 RETURN COUNT(*);"),
+        queryBenchmark(
+            "join/one_hop",
+            "MATCH (a:Person)-[:Knows]->(b:Person) WHERE b.age < 30 RETURN COUNT(*);"),
+        queryBenchmark(
+            "join/two_hop",
+            "MATCH (a:Person)-[:Knows]->(b:Person)-[:Knows]->(c:Person) WHERE a.city = 'city1' "
+                + "RETURN COUNT(*);"),
+        queryBenchmark(
+            "aggregate/low_cardinality",
+            "MATCH (p:Person) RETURN p.city, COUNT(*), AVG(p.score);"),
+        queryBenchmark(
+            "aggregate/high_cardinality", "MATCH (p:Person) RETURN p.name, COUNT(*);"),
+        queryBenchmark(
+            "order/top_k", "MATCH (p:Person) RETURN p.id ORDER BY p.score DESC LIMIT 10;"),
+        parameterizedBenchmark(
+            "interactive/person_lookup", "MATCH (p:Person) WHERE p.id = $id RETURN p.*;",
+            numExecutions: 1000, numPersons: dataset.numPersons),
+        parameterizedBenchmark(
+            "interactive/friends_of_friends",
+            "MATCH (p:Person)-[:Knows]->(:Person)-[:Knows]->(f:Person) WHERE p.id = $id "
+                + "RETURN f.id, f.name ORDER BY f.score DESC LIMIT 20;",
+            numExecutions: 100, numPersons: dataset.numPersons),
+        openBenchmark("open/point_lookup", databasePath: openDatabasePath),
+        copyBenchmark("copy/csv", from: dataset.personCSV, rows: dataset.numPersons),
+        copyBenchmark("copy/parquet", from: dataset.personParquet, rows: dataset.numPersons),
+        queryBenchmark(
+            "fts/query",
+            "CALL QUERY_FTS_INDEX('Post', 'post_content', 'graph database') RETURN COUNT(*);"),
+        queryBenchmark(
+            "hnsw/query",
+            "CALL QUERY_VECTOR_INDEX('Item', 'item_embedding', "
+                + "CAST([\(queryVector)] AS FLOAT[\(embeddingDimension)]), 10) RETURN node.id;"),
+        queryBenchmark(
+            "gds/page_rank", "CALL page_rank('KnowsGraph') RETURN MAX(rank);"),
+        queryBenchmark(
+            "gds/wcc",
+            "CALL weakly_connected_components('KnowsGraph') RETURN COUNT(DISTINCT group_id);"),
+        Benchmark(name: "bridging/tuples") { conn in
+            let result = try conn.query(bridgingQuery)
+            var numRows: UInt64 = 0
+            while let tuple = try result.getNext() {
+                for column in 0..<UInt64(3) {
+                    _ = try tuple.getValue(column)
+                }
+                numRows += 1
+            }
+            return numRows
+        },
+        Benchmark(name: "bridging/dictionaries") { conn in
+            let result = try conn.query(bridgingQuery)
+            var numRows: UInt64 = 0
+            while let tuple = try result.getNext() {
+                _ = try tuple.getAsDictionary()
+                numRows += 1
+            }
+            return numRows
+        },
+        Benchmark(name: "bridging/batches") { conn in
+            let result = try conn.query(bridgingQuery)
+            var numRows: UInt64 = 0
+            var checksum = 0.0
+            while let batch = try result.nextBatch() {
+                let ids = try batch.getColumn(0).getValues(Int64.self)
+                let names = try batch.getColumn(1)
+                let scores = try batch.getColumn(2).getValues(Double.self)
+                for i in 0..<ids.count {
+                    checksum += Double(ids[i]) + scores[i]
+                    _ = try names.getString(i)
+                }
+                numRows += batch.getRowCount()
+            }
+            _ = checksum
+            return numRows
+        },
+    ]
+}
+
+// MARK: - Measurement
+
+struct BenchmarkResult: Codable {
+    let name: String
+    let rows: UInt64
+    let iterations: Int
+    let minMs: Double
+    let medianMs: Double
+    let meanMs: Double
+    let maxMs: Double
+}
+
+struct Report: Codable {
+    let kuzuVersion: String
+    let storageVersion: UInt64
+    let scale: Int
+    let results: [BenchmarkResult]
+}
+
+func measure(_ benchmark: Benchmark, _ conn: Connection, _ options: Options) throws
+    -> BenchmarkResult
+{
+    var timesMs: [Double] = []
+    var rows: UInt64 = 0
+    for iteration in 0..<(options.warmupIterations + options.iterations) {
+        try benchmark.reset?(conn)
+        let start = DispatchTime.now().uptimeNanoseconds
+        rows = try benchmark.run(conn)
+        let elapsedMs = Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000
+        if iteration >= options.warmupIterations {
+            timesMs.append(elapsedMs)
+        }
+    }
+    timesMs.sort()
+    let middle = timesMs.count / 2
+    let median =
+        timesMs.count % 2 == 1 ? timesMs[middle] : (timesMs[middle - 1] + timesMs[middle]) / 2
+    return BenchmarkResult(
+        name: benchmark.name, rows: rows, iterations: timesMs.count, minMs: timesMs.first!,
+        medianMs: median, meanMs: timesMs.reduce(0, +) / Double(timesMs.count),
+        maxMs: timesMs.last!)
+}
+
+// Returns the names of the benchmarks whose median time regressed over the baseline.
+func findRegressions(_ report: Report, baselinePath: String, threshold: Double) throws -> [String]
+{
+    let decoder = JSONDecoder()
+    decoder.keyDecodingStrategy = .convertFromSnakeCase
+    let baseline = try decoder.decode(
+        Report.self, from: Data(contentsOf: URL(fileURLWithPath: baselinePath)))
+    let baselineResults = Dictionary(
+        baseline.results.map { ($0.name, $0) }, uniquingKeysWith: { first, _ in first })
+    var regressions: [String] = []
+    for result in report.results {
+        guard let baselineResult = baselineResults[result.name], baselineResult.medianMs > 0 else {
+            continue
+        }
+        let ratio = result.medianMs / baselineResult.medianMs
+        if ratio > 1 + threshold {
+            log(
+                String(
+                    format: "Regression in %@: %.3f ms -> %.3f ms (%.0f%% slower)", result.name,
+                    baselineResult.medianMs, result.medianMs, (ratio - 1) * 100))
+            regressions.append(result.name)
+        }
+    }
+    return regressions
+}
+
+// MARK: - Replay
+
+struct RecordedParameter: Codable {
+    let type: String
+    let value: String?
+}
+
+struct RecordedQuery: Codable {
+    let connection: UInt64
+    // Time since the recording started.
+    let startUs: UInt64
+    let durationUs: UInt64
+    let query: String
+    let parameters: [String: RecordedParameter]
+    let success: Bool
+}
+
+struct LatencySummary: Codable {
+    let p50Ms: Double
+    let p90Ms: Double
+    let p99Ms: Double
+    let maxMs: Double
+
+    init(_ latenciesMs: [Double]) {
+        let sorted = latenciesMs.sorted()
+        func percentile(_ p: Double) -> Double {
+            sorted.isEmpty ? 0 : sorted[min(sorted.count - 1, Int(Double(sorted.count) * p))]
+        }
+        p50Ms = percentile(0.5)
+        p90Ms = percentile(0.9)
+        p99Ms = percentile(0.99)
+        maxMs = sorted.last ?? 0
+    }
+}
+
+struct ReplayReport: Codable {
+    let kuzuVersion: String
+    let speed: Double
+    let numConnections: Int
+    let numQueries: Int
+    let numErrors: Int
+    // Queries which failed during the replay but succeeded when they were recorded.
+    let numNewErrors: Int
+    let durationMs: Double
+    let throughputQps: Double
+    let latency: LatencySummary
+    let recordedLatency: LatencySummary
+}
+
+func loadWorkload(_ path: String) throws -> [RecordedQuery] {
+    let decoder = JSONDecoder()
+    decoder.keyDecodingStrategy = .convertFromSnakeCase
+    let contents = try String(contentsOfFile: path, encoding: .utf8)
+    return try contents.split(separator: "\n").map { line in
+        try decoder.decode(RecordedQuery.self, from: Data(line.utf8))
+    }
+}
+
+// Parameters are recorded as the string of their value, which is parsed back according to the
+// recorded type. Nested and temporal values are not supported.
+func replayParameterValue(_ name: String, _ parameter: RecordedParameter) throws -> Any? {
+    guard let value = parameter.value else {
+        return nil
+    }
+    let result: Any?
+    switch parameter.type {
+    case "BOOL": result = KuzuBoolWrapper(value: value == "True")
+    case "INT64", "SERIAL": result = Int64(value).map { KuzuInt64Wrapper(value: $0) }
+    case "INT32": result = Int32(value).map { KuzuInt32Wrapper(value: $0) }
+    case "INT16": result = Int16(value).map { KuzuInt16Wrapper(value: $0) }
+    case "INT8": result = Int8(value).map { KuzuInt8Wrapper(value: $0) }
+    case "UINT64": result = UInt64(value).map { KuzuUInt64Wrapper(value: $0) }
+    case "UINT32": result = UInt32(value).map { KuzuUInt32Wrapper(value: $0) }
+    case "UINT16": result = UInt16(value).map { KuzuUInt16Wrapper(value: $0) }
+    case "UINT8": result = UInt8(value).map { KuzuUInt8Wrapper(value: $0) }
+    case "DOUBLE": result = Double(value).map { KuzuDoubleWrapper(value: $0) }
+    case "FLOAT": result = Float(value).map { KuzuFloatWrapper(value: $0) }
+    case "STRING": result = value
+    default: result = nil
+    }
+    guard let result else {
+        throw KuzuError.valueConversionFailed(
+            "Cannot replay parameter \(name) of type \(parameter.type)")
+    }
+    return result
+}
+
+// The replay writes to a copy of the database, so that the same workload can be replayed again
+// against the same state.
+func copyDatabase(_ path: String, to directory: URL) throws -> String {
+    let copyPath = directory.appendingPathComponent("db").path
+    try FileManager.default.copyItem(atPath: path, toPath: copyPath)
+    if FileManager.default.fileExists(atPath: path + ".wal") {
+        try FileManager.default.copyItem(atPath: path + ".wal", toPath: copyPath + ".wal")
+    }
+    return copyPath
+}
+
+// Re-issues the queries of each recorded connection from a connection of its own, at the recorded
+// offsets from the start divided by the speed, and measures the latency of each query.
+func replay(_ workload: [RecordedQuery], _ db: Database, speed: Double) -> ReplayReport {
+    var queriesPerConnection: [UInt64: [RecordedQuery]] = [:]
+    for query in workload {
+        queriesPerConnection[query.connection, default: []].append(query)
+    }
+    let lock = NSLock()
+    var latenciesMs: [Double] = []
+    var numErrors = 0
+    var numNewErrors = 0
+    let group = DispatchGroup()
+    let replayStart = DispatchTime.now().uptimeNanoseconds
+    for (connectionID, queries) in queriesPerConnection {
+        group.enter()
+        let thread = Thread {
+            defer { group.leave() }
+            guard let conn = try? Connection(db) else {
+                log("Cannot create a connection to replay connection \(connectionID)")
+                lock.lock()
+                numErrors += queries.count
+                lock.unlock()
+                return
+            }
+            var statements: [String: PreparedStatement] = [:]
+            var connectionLatenciesMs: [Double] = []
+            var connectionErrors = 0
+            var connectionNewErrors = 0
+            for query in queries {
+                if speed > 0 {
+                    let target = replayStart + UInt64(Double(query.startUs) * 1000 / speed)
+                    let now = DispatchTime.now().uptimeNanoseconds
+                    if target > now {
+                        usleep(UInt32(min((target - now) / 1000, UInt64(UInt32.max))))
+                    }
+                }
+                let start = DispatchTime.now().uptimeNanoseconds
+                do {
+                    if query.parameters.isEmpty {
+                        _ = try conn.query(query.query)
+                    } else {
+                        if statements[query.query] == nil {
+                            statements[query.query] = try conn.prepare(query.query)
+                        }
+                        var parameters: [String: Any?] = [:]
+                        for (name, parameter) in query.parameters {
+                            parameters[name] = try replayParameterValue(name, parameter)
+                        }
+                        _ = try conn.execute(statements[query.query]!, parameters)
+                    }
+                } catch {
+                    connectionErrors += 1
+                    if query.success {
+                        connectionNewErrors += 1
+                    }
+                }
+                connectionLatenciesMs.append(
+                    Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000)
+            }
+            lock.lock()
+            latenciesMs += connectionLatenciesMs
+            numErrors += connectionErrors
+            numNewErrors += connectionNewErrors
+            lock.unlock()
+        }
+        thread.start()
+    }
+    group.wait()
+    let durationMs = Double(DispatchTime.now().uptimeNanoseconds - replayStart) / 1_000_000
+    return ReplayReport(
+        kuzuVersion: Database.version, speed: speed, numConnections: queriesPerConnection.count,
+        numQueries: workload.count, numErrors: numErrors, numNewErrors: numNewErrors,
+        durationMs: durationMs,
+        throughputQps: durationMs > 0 ? Double(workload.count) / durationMs * 1000 : 0,
+        latency: LatencySummary(latenciesMs),
+        recordedLatency: LatencySummary(workload.map { Double($0.durationUs) / 1000 }))
+}
+
+func writeReport<T: Encodable>(_ report: T, to outputPath: String?) throws {
+    let encoder = JSONEncoder()
+    encoder.keyEncodingStrategy = .convertToSnakeCase
+    encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+    let json = try encoder.encode(report)
+    if let outputPath {
+        try json.write(to: URL(fileURLWithPath: outputPath))
+    } else {
+        print(String(data: json, encoding: .utf8)!)
+    }
+}
+
+// MARK: - Main
+
+let options = Options.parse(CommandLine.arguments)
+let workDirectory = URL(fileURLWithPath: NSTemporaryDirectory())
+    .appendingPathComponent("kuzu_swift_benchmark_" + UUID().uuidString)
+try FileManager.default.createDirectory(at: workDirectory, withIntermediateDirectories: true)
+
+if let replayPath = options.replayPath {
+    guard let databasePath = options.databasePath else {
+        fail("--replay requires --database\n\(Options.usage)")
+    }
+    let workload = try loadWorkload(replayPath)
+    log("Replaying \(workload.count) queries against a copy of \(databasePath)")
+    let report: ReplayReport
+    do {
+        let db = try Database(try copyDatabase(databasePath, to: workDirectory))
+        report = replay(workload, db, speed: options.speed)
+    }
+    try writeReport(report, to: options.outputPath)
+    try? FileManager.default.removeItem(at: workDirectory)
+    exit(0)
+}
+
+log("Generating dataset of scale \(options.scale)")
+let dataset = try Dataset.generate(scale: options.scale, in: workDirectory)
+let db = try Database(workDirectory.appendingPathComponent("db").path)
+let conn = try Connection(db)
+log("Loading dataset")
+try load(dataset, into: conn)
+_ = try conn.query("CHECKPOINT;")
+let openDirectory = workDirectory.appendingPathComponent("open")
+try FileManager.default.createDirectory(at: openDirectory, withIntermediateDirectories: true)
+let openDatabasePath = try copyDatabase(
+    workDirectory.appendingPathComponent("db").path, to: openDirectory)
+
+var results: [BenchmarkResult] = []
+for benchmark in makeBenchmarks(dataset, openDatabasePath: openDatabasePath) {
+    if let filter = options.filter, !benchmark.name.contains(filter) {
+        continue
+    }
+    do {
+        let result = try measure(benchmark, conn, options)
+        log(String(format: "%@: median %.3f ms", benchmark.name, result.medianMs))
+        results.append(result)
+    } catch {
+        fail("Benchmark \(benchmark.name) failed: \(error)")
+    }
+}
+
+let report = Report(
+    kuzuVersion: Database.version, storageVersion: Database.storageVersion, scale: options.scale,
+    results: results)
+try writeReport(report, to: options.outputPath)
+try? FileManager.default.removeItem(at: workDirectory)
+
+if let baselinePath = options.baselinePath {
+    let regressions = try findRegressions(
+        report, baselinePath: baselinePath, threshold: options.threshold)
+    if !regressions.isEmpty {
+        exit(1)
+    }
+}
@@ -31,17 +31,22 @@ let package = Package(
                 "kuzu/build/src/extension/codegen/generated_extension_loader.cpp",
                 "kuzu/extension/algo/src/common/in_mem_gds_utils.cpp",
                 "kuzu/extension/algo/src/common/in_mem_graph.cpp",
+                "kuzu/extension/algo/src/common/sorted_adjacency_graph.cpp",
+                "kuzu/extension/algo/src/function/centrality.cpp",
                 "kuzu/extension/algo/src/function/component_ids.cpp",
                 "kuzu/extension/algo/src/function/config/max_iterations_config.cpp",
                 "kuzu/extension/algo/src/function/k_core_decomposition.cpp",
+                "kuzu/extension/algo/src/function/leiden.cpp",
                 "kuzu/extension/algo/src/function/louvain.cpp",
                 "kuzu/extension/algo/src/function/page_rank.cpp",
                 "kuzu/extension/algo/src/function/spanning_forest.cpp",
                 "kuzu/extension/algo/src/function/strongly_connected_components.cpp",
                 "kuzu/extension/algo/src/function/strongly_connected_components_kosaraju.cpp",
+                "kuzu/extension/algo/src/function/triangle_count.cpp",
                 "kuzu/extension/algo/src/function/weakly_connected_components.cpp",
                 "kuzu/extension/algo/src/main/algo_extension.cpp",
                 "kuzu/extension/fts/src/catalog/fts_index_catalog_entry.cpp",
+                "kuzu/extension/fts/src/function/build_fts_postings.cpp",
                 "kuzu/extension/fts/src/function/create_fts_index.cpp",
                 "kuzu/extension/fts/src/function/drop_fts_index.cpp",
                 "kuzu/extension/fts/src/function/fts_config.cpp",
@@ -52,6 +57,7 @@ let package = Package(
                 "kuzu/extension/fts/src/function/tokenize.cpp",
                 "kuzu/extension/fts/src/index/fts_index.cpp",
                 "kuzu/extension/fts/src/index/fts_internal_table_info.cpp",
+                "kuzu/extension/fts/src/index/fts_posting_lists.cpp",
                 "kuzu/extension/fts/src/index/fts_update_state.cpp",
                 "kuzu/extension/fts/src/main/fts_extension.cpp",
                 "kuzu/extension/fts/src/utils/fts_utils.cpp",
@@ -107,14 +113,19 @@ let package = Package(
                 "kuzu/extension/json/src/reader/buffered_json_reader.cpp",
                 "kuzu/extension/json/src/type/json_type.cpp",
                 "kuzu/extension/json/src/utils/json_utils.cpp",
+                "kuzu/extension/vector/src/catalog/diskann_index_catalog_entry.cpp",
                 "kuzu/extension/vector/src/catalog/hnsw_index_catalog_entry.cpp",
+                "kuzu/extension/vector/src/function/create_diskann_index.cpp",
                 "kuzu/extension/vector/src/function/create_hnsw_index.cpp",
                 "kuzu/extension/vector/src/function/drop_hnsw_index.cpp",
                 "kuzu/extension/vector/src/function/query_hnsw_index.cpp",
+                "kuzu/extension/vector/src/index/diskann_config.cpp",
+                "kuzu/extension/vector/src/index/diskann_index.cpp",
                 "kuzu/extension/vector/src/index/hnsw_config.cpp",
                 "kuzu/extension/vector/src/index/hnsw_graph.cpp",
                 "kuzu/extension/vector/src/index/hnsw_index.cpp",
                 "kuzu/extension/vector/src/index/hnsw_index_utils.cpp",
+                "kuzu/extension/vector/src/index/hnsw_quantization.cpp",
                 "kuzu/extension/vector/src/index/hnsw_rel_batch_insert.cpp",
                 "kuzu/extension/vector/src/main/vector_extension.cpp",
                 "kuzu/src/binder/bind/bind_attach_database.cpp",
@@ -192,6 +203,7 @@ let package = Package(
                 "kuzu/src/c_api/connection.cpp",
                 "kuzu/src/c_api/data_type.cpp",
                 "kuzu/src/c_api/database.cpp",
+                "kuzu/src/c_api/factorized_tuple.cpp",
                 "kuzu/src/c_api/flat_tuple.cpp",
                 "kuzu/src/c_api/helpers.cpp",
                 "kuzu/src/c_api/prepared_statement.cpp",
@@ -218,6 +230,7 @@ let package = Package(
                 "kuzu/src/common/arrow/arrow_null_mask_tree.cpp",
                 "kuzu/src/common/arrow/arrow_row_batch.cpp",
                 "kuzu/src/common/arrow/arrow_type.cpp",
+                "kuzu/src/common/bitset_mask.cpp",
                 "kuzu/src/common/case_insensitive_map.cpp",
                 "kuzu/src/common/checksum.cpp",
                 "kuzu/src/common/constants.cpp",
@@ -237,6 +250,7 @@ let package = Package(
                 "kuzu/src/common/enums/rel_direction.cpp",
                 "kuzu/src/common/enums/rel_multiplicity.cpp",
                 "kuzu/src/common/enums/scan_source_type.cpp",
+                "kuzu/src/common/enums/scheduling_class.cpp",
                 "kuzu/src/common/enums/table_type.cpp",
                 "kuzu/src/common/enums/transaction_action.cpp",
                 "kuzu/src/common/exception/exception.cpp",
@@ -246,6 +260,7 @@ let package = Package(
                 "kuzu/src/common/file_system/file_info.cpp",
                 "kuzu/src/common/file_system/file_system.cpp",
                 "kuzu/src/common/file_system/gzip_file_system.cpp",
+                "kuzu/src/common/file_system/io_uring.cpp",
                 "kuzu/src/common/file_system/local_file_system.cpp",
                 "kuzu/src/common/file_system/virtual_file_system.cpp",
                 "kuzu/src/common/in_mem_overflow_buffer.cpp",
@@ -253,6 +268,7 @@ let package = Package(
                 "kuzu/src/common/md5.cpp",
                 "kuzu/src/common/metric.cpp",
                 "kuzu/src/common/null_mask.cpp",
+                "kuzu/src/common/numa_utils.cpp",
                 "kuzu/src/common/profiler.cpp",
                 "kuzu/src/common/random_engine.cpp",
                 "kuzu/src/common/roaring_mask.cpp",
@@ -262,12 +278,14 @@ let package = Package(
                 "kuzu/src/common/serializer/in_mem_file_writer.cpp",
                 "kuzu/src/common/serializer/serializer.cpp",
                 "kuzu/src/common/sha256.cpp",
+                "kuzu/src/common/sorted_mask.cpp",
                 "kuzu/src/common/string_utils.cpp",
                 "kuzu/src/common/system_message.cpp",
                 "kuzu/src/common/task_system/progress_bar.cpp",
                 "kuzu/src/common/task_system/task.cpp",
                 "kuzu/src/common/task_system/task_scheduler.cpp",
                 "kuzu/src/common/task_system/terminal_progress_bar_display.cpp",
+                "kuzu/src/common/tracer.cpp",
                 "kuzu/src/common/type_utils.cpp",
                 "kuzu/src/common/types/blob.cpp",
                 "kuzu/src/common/types/date_t.cpp",
@@ -293,6 +311,7 @@ let package = Package(
                 "kuzu/src/expression_evaluator/expression_evaluator_utils.cpp",
                 "kuzu/src/expression_evaluator/expression_evaluator_visitor.cpp",
                 "kuzu/src/expression_evaluator/function_evaluator.cpp",
+                "kuzu/src/expression_evaluator/fused_evaluator.cpp",
                 "kuzu/src/expression_evaluator/lambda_evaluator.cpp",
                 "kuzu/src/expression_evaluator/list_slice_info.cpp",
                 "kuzu/src/expression_evaluator/literal_evaluator.cpp",
@@ -400,11 +419,17 @@ let package = Package(
                 "kuzu/src/function/string/levenshtein_function.cpp",
                 "kuzu/src/function/string/regex_full_match_function.cpp",
                 "kuzu/src/function/string/regex_replace_function.cpp",
+                "kuzu/src/function/string/regexp_literal_filter.cpp",
+                "kuzu/src/function/string/regexp_matches_function.cpp",
                 "kuzu/src/function/string/split_part.cpp",
                 "kuzu/src/function/string/string_split_function.cpp",
                 "kuzu/src/function/struct/keys_function.cpp",
                 "kuzu/src/function/struct/struct_extract_function.cpp",
                 "kuzu/src/function/struct/struct_pack_function.cpp",
+                "kuzu/src/function/table/aggregate_view_functions.cpp",
+                "kuzu/src/function/table/analyze.cpp",
+                "kuzu/src/function/table/arrow_stream_scan.cpp",
+                "kuzu/src/function/table/backup.cpp",
                 "kuzu/src/function/table/bind_data.cpp",
                 "kuzu/src/function/table/bind_input.cpp",
                 "kuzu/src/function/table/bm_info.cpp",
@@ -413,12 +438,21 @@ let package = Package(
                 "kuzu/src/function/table/clear_warnings.cpp",
                 "kuzu/src/function/table/current_setting.cpp",
                 "kuzu/src/function/table/db_version.cpp",
+                "kuzu/src/function/table/debug_slab_allocator.cpp",
+                "kuzu/src/function/table/debug_update_versions.cpp",
                 "kuzu/src/function/table/drop_project_graph.cpp",
                 "kuzu/src/function/table/file_info.cpp",
                 "kuzu/src/function/table/free_space_info.cpp",
+                "kuzu/src/function/table/io_stats.cpp",
                 "kuzu/src/function/table/project_cypher_graph.cpp",
                 "kuzu/src/function/table/project_native_graph.cpp",
                 "kuzu/src/function/table/projected_graph_info.cpp",
+                "kuzu/src/function/table/query_attached.cpp",
+                "kuzu/src/function/table/query_plan_cache_info.cpp",
+                "kuzu/src/function/table/query_stats.cpp",
+                "kuzu/src/function/table/replay_wal.cpp",
+                "kuzu/src/function/table/reverse_index_functions.cpp",
+                "kuzu/src/function/table/scheduler_info.cpp",
                 "kuzu/src/function/table/show_attached_databases.cpp",
                 "kuzu/src/function/table/show_connection.cpp",
                 "kuzu/src/function/table/show_functions.cpp",
@@ -429,12 +463,18 @@ let package = Package(
                 "kuzu/src/function/table/show_projected_graphs.cpp",
                 "kuzu/src/function/table/show_sequences.cpp",
                 "kuzu/src/function/table/show_tables.cpp",
+                "kuzu/src/function/table/ship_wal.cpp",
                 "kuzu/src/function/table/show_warnings.cpp",
                 "kuzu/src/function/table/simple_table_function.cpp",
+                "kuzu/src/function/table/slow_queries.cpp",
+                "kuzu/src/function/table/sorted_index_functions.cpp",
                 "kuzu/src/function/table/stats_info.cpp",
                 "kuzu/src/function/table/storage_info.cpp",
+                "kuzu/src/function/table/storage_summary.cpp",
                 "kuzu/src/function/table/table_function.cpp",
                 "kuzu/src/function/table/table_info.cpp",
+                "kuzu/src/function/table/vacuum.cpp",
+                "kuzu/src/function/table/wal_info.cpp",
                 "kuzu/src/function/timestamp/to_epoch_ms.cpp",
                 "kuzu/src/function/union/union_extract_function.cpp",
                 "kuzu/src/function/union/union_tag_function.cpp",
@@ -462,38 +502,51 @@ let package = Package(
                 "kuzu/src/graph/graph.cpp",
                 "kuzu/src/graph/graph_entry.cpp",
                 "kuzu/src/graph/graph_entry_set.cpp",
+                "kuzu/src/graph/graph_snapshot.cpp",
                 "kuzu/src/graph/on_disk_graph.cpp",
                 "kuzu/src/graph/parsed_graph_entry.cpp",
+                "kuzu/src/main/async_query_executor.cpp",
+                "kuzu/src/main/async_query_result.cpp",
                 "kuzu/src/main/attached_database.cpp",
                 "kuzu/src/main/client_context.cpp",
                 "kuzu/src/main/connection.cpp",
+                "kuzu/src/main/connection_pool.cpp",
                 "kuzu/src/main/database.cpp",
                 "kuzu/src/main/database_manager.cpp",
                 "kuzu/src/main/db_config.cpp",
                 "kuzu/src/main/plan_printer.cpp",
                 "kuzu/src/main/prepared_statement.cpp",
                 "kuzu/src/main/prepared_statement_manager.cpp",
+                "kuzu/src/main/query_plan_cache.cpp",
                 "kuzu/src/main/query_result.cpp",
                 "kuzu/src/main/query_result/arrow_query_result.cpp",
                 "kuzu/src/main/query_result/materialized_query_result.cpp",
+                "kuzu/src/main/query_result/streaming_query_result.cpp",
+                "kuzu/src/main/query_result_cache.cpp",
+                "kuzu/src/main/query_stats.cpp",
                 "kuzu/src/main/query_summary.cpp",
                 "kuzu/src/main/settings.cpp",
                 "kuzu/src/main/storage_driver.cpp",
                 "kuzu/src/main/version.cpp",
+                "kuzu/src/main/workload_recorder.cpp",
                 "kuzu/src/optimizer/acc_hash_join_optimizer.cpp",
                 "kuzu/src/optimizer/agg_key_dependency_optimizer.cpp",
                 "kuzu/src/optimizer/cardinality_updater.cpp",
                 "kuzu/src/optimizer/correlated_subquery_unnest_solver.cpp",
+                "kuzu/src/optimizer/eager_aggregation_optimizer.cpp",
                 "kuzu/src/optimizer/factorization_rewriter.cpp",
                 "kuzu/src/optimizer/filter_push_down_optimizer.cpp",
+                "kuzu/src/optimizer/late_materialization_optimizer.cpp",
                 "kuzu/src/optimizer/limit_push_down_optimizer.cpp",
                 "kuzu/src/optimizer/logical_operator_collector.cpp",
                 "kuzu/src/optimizer/logical_operator_visitor.cpp",
                 "kuzu/src/optimizer/optimizer.cpp",
                 "kuzu/src/optimizer/projection_push_down_optimizer.cpp",
+                "kuzu/src/optimizer/rel_degree_optimizer.cpp",
                 "kuzu/src/optimizer/remove_factorization_rewriter.cpp",
                 "kuzu/src/optimizer/remove_unnecessary_join_optimizer.cpp",
                 "kuzu/src/optimizer/schema_populator.cpp",
+                "kuzu/src/optimizer/shared_subplan_optimizer.cpp",
                 "kuzu/src/optimizer/top_k_optimizer.cpp",
                 "kuzu/src/parser/antlr_parser/kuzu_cypher_parser.cpp",
                 "kuzu/src/parser/antlr_parser/parser_error_listener.cpp",
@@ -536,6 +589,7 @@ let package = Package(
                 "kuzu/src/planner/operator/extend/base_logical_extend.cpp",
                 "kuzu/src/planner/operator/extend/logical_extend.cpp",
                 "kuzu/src/planner/operator/extend/logical_recursive_extend.cpp",
+                "kuzu/src/planner/operator/extend/logical_rel_degree.cpp",
                 "kuzu/src/planner/operator/factorization/flatten_resolver.cpp",
                 "kuzu/src/planner/operator/factorization/sink_util.cpp",
                 "kuzu/src/planner/operator/logical_accumulate.cpp",
@@ -570,7 +624,9 @@ let package = Package(
                 "kuzu/src/planner/operator/persistent/logical_set.cpp",
                 "kuzu/src/planner/operator/scan/logical_expressions_scan.cpp",
                 "kuzu/src/planner/operator/scan/logical_index_look_up.cpp",
+                "kuzu/src/planner/operator/scan/logical_lookup_node_table.cpp",
                 "kuzu/src/planner/operator/scan/logical_scan_node_table.cpp",
+                "kuzu/src/planner/operator/scan/logical_shared_scan.cpp",
                 "kuzu/src/planner/operator/schema.cpp",
                 "kuzu/src/planner/operator/simple/logical_simple.cpp",
                 "kuzu/src/planner/operator/sip/logical_semi_masker.cpp",
@@ -637,6 +693,7 @@ let package = Package(
                 "kuzu/src/processor/map/map_intersect.cpp",
                 "kuzu/src/processor/map/map_label_filter.cpp",
                 "kuzu/src/processor/map/map_limit.cpp",
+                "kuzu/src/processor/map/map_lookup_node_table.cpp",
                 "kuzu/src/processor/map/map_merge.cpp",
                 "kuzu/src/processor/map/map_multiplicity_reducer.cpp",
                 "kuzu/src/processor/map/map_noop.cpp",
@@ -644,9 +701,11 @@ let package = Package(
                 "kuzu/src/processor/map/map_path_property_probe.cpp",
                 "kuzu/src/processor/map/map_projection.cpp",
                 "kuzu/src/processor/map/map_recursive_extend.cpp",
+                "kuzu/src/processor/map/map_rel_degree.cpp",
                 "kuzu/src/processor/map/map_scan_node_table.cpp",
                 "kuzu/src/processor/map/map_semi_masker.cpp",
                 "kuzu/src/processor/map/map_set.cpp",
+                "kuzu/src/processor/map/map_shared_scan.cpp",
                 "kuzu/src/processor/map/map_simple.cpp",
                 "kuzu/src/processor/map/map_standalone_call.cpp",
                 "kuzu/src/processor/map/map_table_function_call.cpp",
@@ -674,6 +733,7 @@ let package = Package(
                 "kuzu/src/processor/operator/filtering_operator.cpp",
                 "kuzu/src/processor/operator/flatten.cpp",
                 "kuzu/src/processor/operator/hash_join/hash_join_build.cpp",
+                "kuzu/src/processor/operator/hash_join/hash_join_partitions.cpp",
                 "kuzu/src/processor/operator/hash_join/hash_join_probe.cpp",
                 "kuzu/src/processor/operator/hash_join/join_hash_table.cpp",
                 "kuzu/src/processor/operator/index_lookup.cpp",
@@ -710,6 +770,7 @@ let package = Package(
                 "kuzu/src/processor/operator/persistent/reader/csv/parallel_csv_reader.cpp",
                 "kuzu/src/processor/operator/persistent/reader/csv/serial_csv_reader.cpp",
                 "kuzu/src/processor/operator/persistent/reader/file_error_handler.cpp",
+                "kuzu/src/processor/operator/persistent/reader/hive_partitioning.cpp",
                 "kuzu/src/processor/operator/persistent/reader/npy/npy_reader.cpp",
                 "kuzu/src/processor/operator/persistent/reader/parquet/boolean_column_reader.cpp",
                 "kuzu/src/processor/operator/persistent/reader/parquet/column_reader.cpp",
@@ -739,11 +800,15 @@ let package = Package(
                 "kuzu/src/processor/operator/projection.cpp",
                 "kuzu/src/processor/operator/recursive_extend.cpp",
                 "kuzu/src/processor/operator/result_collector.cpp",
+                "kuzu/src/processor/operator/scan/lookup_node_table.cpp",
                 "kuzu/src/processor/operator/scan/primary_key_scan_node_table.cpp",
+                "kuzu/src/processor/operator/scan/rel_degree.cpp",
                 "kuzu/src/processor/operator/scan/scan_multi_rel_tables.cpp",
                 "kuzu/src/processor/operator/scan/scan_node_table.cpp",
                 "kuzu/src/processor/operator/scan/scan_rel_table.cpp",
+                "kuzu/src/processor/operator/scan/scan_rel_table_reverse.cpp",
                 "kuzu/src/processor/operator/scan/scan_table.cpp",
+                "kuzu/src/processor/operator/scan/sorted_index_scan_node_table.cpp",
                 "kuzu/src/processor/operator/semi_masker.cpp",
                 "kuzu/src/processor/operator/simple/attach_database.cpp",
                 "kuzu/src/processor/operator/simple/detach_database.cpp",
@@ -768,13 +833,18 @@ let package = Package(
                 "kuzu/src/processor/result/factorized_table_pool.cpp",
                 "kuzu/src/processor/result/factorized_table_schema.cpp",
                 "kuzu/src/processor/result/factorized_table_util.cpp",
+                "kuzu/src/processor/result/factorized_tuple.cpp",
                 "kuzu/src/processor/result/flat_tuple.cpp",
                 "kuzu/src/processor/result/pattern_creation_info_table.cpp",
                 "kuzu/src/processor/result/result_set.cpp",
                 "kuzu/src/processor/result/result_set_descriptor.cpp",
+                "kuzu/src/processor/result/result_stream.cpp",
                 "kuzu/src/processor/warning_context.cpp",
                 "kuzu/src/storage/buffer_manager/buffer_manager.cpp",
+                "kuzu/src/storage/buffer_manager/buffer_pool_warm_up.cpp",
                 "kuzu/src/storage/buffer_manager/memory_manager.cpp",
+                "kuzu/src/storage/buffer_manager/query_memory_tracker.cpp",
+                "kuzu/src/storage/buffer_manager/slab_allocator.cpp",
                 "kuzu/src/storage/buffer_manager/spiller.cpp",
                 "kuzu/src/storage/buffer_manager/vm_region.cpp",
                 "kuzu/src/storage/checkpointer.cpp",
@@ -782,15 +852,20 @@ let package = Package(
                 "kuzu/src/storage/compression/bitpacking_utils.cpp",
                 "kuzu/src/storage/compression/compression.cpp",
                 "kuzu/src/storage/compression/float_compression.cpp",
+                "kuzu/src/storage/compression/fsst.cpp",
+                "kuzu/src/storage/database_backup.cpp",
                 "kuzu/src/storage/database_header.cpp",
                 "kuzu/src/storage/disk_array.cpp",
                 "kuzu/src/storage/disk_array_collection.cpp",
                 "kuzu/src/storage/file_db_id_utils.cpp",
                 "kuzu/src/storage/file_handle.cpp",
                 "kuzu/src/storage/free_space_manager.cpp",
+                "kuzu/src/storage/index/aggregate_view.cpp",
                 "kuzu/src/storage/index/hash_index.cpp",
+                "kuzu/src/storage/index/hash_index_bloom_filter.cpp",
                 "kuzu/src/storage/index/in_mem_hash_index.cpp",
                 "kuzu/src/storage/index/index.cpp",
+                "kuzu/src/storage/index/sorted_index.cpp",
                 "kuzu/src/storage/local_storage/local_node_table.cpp",
                 "kuzu/src/storage/local_storage/local_rel_table.cpp",
                 "kuzu/src/storage/local_storage/local_storage.cpp",
@@ -800,9 +875,12 @@ let package = Package(
                 "kuzu/src/storage/predicate/column_predicate.cpp",
                 "kuzu/src/storage/predicate/constant_predicate.cpp",
                 "kuzu/src/storage/predicate/null_predicate.cpp",
+                "kuzu/src/storage/predicate/runtime_filter.cpp",
                 "kuzu/src/storage/shadow_file.cpp",
                 "kuzu/src/storage/shadow_utils.cpp",
+                "kuzu/src/storage/stats/column_histogram.cpp",
                 "kuzu/src/storage/stats/column_stats.cpp",
+                "kuzu/src/storage/stats/degree_stats.cpp",
                 "kuzu/src/storage/stats/hyperloglog.cpp",
                 "kuzu/src/storage/stats/table_stats.cpp",
                 "kuzu/src/storage/storage_manager.cpp",
@@ -829,7 +907,9 @@ let package = Package(
                 "kuzu/src/storage/table/node_table.cpp",
                 "kuzu/src/storage/table/null_column.cpp",
                 "kuzu/src/storage/table/rel_table.cpp",
+                "kuzu/src/storage/table/rel_table_csr_cache.cpp",
                 "kuzu/src/storage/table/rel_table_data.cpp",
+                "kuzu/src/storage/table/rel_table_reverse_index.cpp",
                 "kuzu/src/storage/table/string_chunk_data.cpp",
                 "kuzu/src/storage/table/string_column.cpp",
                 "kuzu/src/storage/table/struct_chunk_data.cpp",
@@ -5,12 +5,14 @@
 //  Copyright © 2023 - 2025 Kùzu Inc.
 //  This code is licensed under MIT license (see LICENSE for details)
 
+import Foundation
 @_implementationOnly import cxx_kuzu
 
 /// Represents a connection to a Kuzu database.
 public final class Connection: @unchecked Sendable {
     internal var cConnection: kuzu_connection
     internal var database: Database
+    private let isPooled: Bool
 
     /// Opens a connection to the specified database.
     /// - Parameter database: The database to connect to
@@ -24,10 +26,33 @@ public final class Connection: @unchecked Sendable {
             )
         }
         self.database = database
+        self.isPooled = false
+    }
+
+    /// Takes a connection from the connection pool of the specified database, or opens a new
+    /// connection if the pool is empty. The connection is returned to the pool when it is
+    /// deinitialized, after being reset to the state of a new connection.
+    /// The size of the pool is set with the `connection_pool_size` option.
+    /// - Parameter database: The database to connect to
+    /// - Throws: KuzuError if connection initialization fails
+    public init(pooledFrom database: Database) throws {
+        cConnection = kuzu_connection()
+        let state = kuzu_connection_acquire(&database.cDatabase, &self.cConnection)
+        if state != KuzuSuccess {
+            throw KuzuError.connectionInitializationFailed(
+                "Connection initialization failed with error code: \(state)"
+            )
+        }
+        self.database = database
+        self.isPooled = true
     }
 
     deinit {
-        kuzu_connection_destroy(&cConnection)
+        if isPooled {
+            kuzu_connection_release(&cConnection)
+        } else {
+            kuzu_connection_destroy(&cConnection)
+        }
     }
 
     /// Executes a query string and returns the result.
@@ -57,6 +82,24 @@ public final class Connection: @unchecked Sendable {
         return queryResult
     }
 
+    /// Executes a query string asynchronously and returns the result.
+    /// The query is executed on the threads of the database, and the calling task is suspended
+    /// instead of blocking its thread until the query finishes. Queries on the same connection are
+    /// still executed one at a time. Cancelling the calling task interrupts the query.
+    /// - Parameter cypher: The Cypher query string to execute
+    /// - Returns: A QueryResult containing the results of the query
+    /// - Throws: KuzuError if query execution fails
+    public func queryAsync(_ cypher: String) async throws -> QueryResult {
+        let asyncQuery = AsyncQuery(self)
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                asyncQuery.submit(cypher, continuation)
+            }
+        } onCancel: {
+            asyncQuery.interrupt()
+        }
+    }
+
     /// Returns a prepared statement for the specified query string.
     /// The prepared statement can be used to execute the query with parameters.
     /// - Parameter cypher: The Cypher query string to prepare
@@ -137,6 +180,129 @@ public final class Connection: @unchecked Sendable {
         return queryResult
     }
 
+    /// Executes a prepared statement once for each of the specified parameter sets.
+    /// All executions run in a single transaction, so inserting many rows commits them once.
+    /// The first failed execution rolls back the transaction. If a transaction is already active,
+    /// the executions run in it and it is not committed.
+    /// - Parameters:
+    ///   - preparedStatement: The prepared statement to execute
+    ///   - parameterSets: The parameter sets, which must all bind the same parameter names
+    /// - Returns: A QueryResult containing the results of the last execution
+    /// - Throws: KuzuError if binding parameters or any execution fails
+    public func executeMany<T>(
+        _ preparedStatement: PreparedStatement,
+        _ parameterSets: [[String: T?]]
+    ) throws -> QueryResult {
+        let names = parameterSets.first.map { Array($0.keys) } ?? []
+        let numSets = parameterSets.count
+        let numValues = names.count * numSets
+        let cValues: UnsafeMutablePointer<UnsafeMutablePointer<kuzu_value>?> =
+            .allocate(capacity: max(numValues, 1))
+        for idx in 0..<numValues {
+            cValues[idx] = nil
+        }
+        defer {
+            for idx in 0..<numValues {
+                kuzu_value_destroy(cValues[idx])
+            }
+            cValues.deallocate()
+        }
+        for (setIdx, parameters) in parameterSets.enumerated() {
+            if parameters.count != names.count {
+                throw KuzuError.queryExecutionFailed(
+                    "All parameter sets must bind the same parameters"
+                )
+            }
+            for (nameIdx, name) in names.enumerated() {
+                guard let value = parameters[name] else {
+                    throw KuzuError.queryExecutionFailed(
+                        "Parameter set \(setIdx) does not bind parameter \(name)"
+                    )
+                }
+                // Values are laid out column by column, as the C API expects.
+                cValues[nameIdx * numSets + setIdx] = try swiftValueToKuzuValue(value)
+            }
+        }
+        var cNames: [UnsafePointer<CChar>?] = names.map { UnsafePointer(strdup($0)) }
+        defer {
+            for cName in cNames {
+                free(UnsafeMutablePointer(mutating: cName))
+            }
+        }
+        var cQueryResult = kuzu_query_result()
+        let state = kuzu_connection_execute_many(
+            &cConnection,
+            &preparedStatement.cPreparedStatement,
+            UInt64(numSets),
+            UInt64(names.count),
+            &cNames,
+            cValues,
+            &cQueryResult
+        )
+        if state != KuzuSuccess && cQueryResult._query_result == nil {
+            throw KuzuError.queryExecutionFailed(
+                "Query execution failed with error code: \(state)"
+            )
+        }
+        if !kuzu_query_result_is_success(&cQueryResult) {
+            let cErrorMesage: UnsafeMutablePointer<CChar>? =
+                kuzu_query_result_get_error_message(&cQueryResult)
+            defer {
+                kuzu_query_result_destroy(&cQueryResult)
+                kuzu_destroy_string(cErrorMesage)
+            }
+            if cErrorMesage == nil {
+                throw KuzuError.queryExecutionFailed(
+                    "Query execution failed with an unknown error."
+                )
+            } else {
+                let errorMessage = String(cString: cErrorMesage!)
+                throw KuzuError.queryExecutionFailed(errorMessage)
+            }
+        }
+        let queryResult = QueryResult(self, cQueryResult)
+        return queryResult
+    }
+
+    /// Copies the record batches of an Arrow C stream into a table, as with COPY FROM.
+    /// The columns of the stream schema are matched to the table properties by position.
+    /// - Parameters:
+    ///   - tableName: The name of the table to copy into
+    ///   - stream: A pointer to an `ArrowArrayStream` of the Arrow C stream interface.
+    ///     The stream is read to its end but not released.
+    /// - Returns: A QueryResult containing the result of the copy
+    /// - Throws: KuzuError if the copy fails
+    public func copyFromArrowStream(
+        _ tableName: String,
+        _ stream: UnsafeMutableRawPointer
+    ) throws -> QueryResult {
+        var cQueryResult = kuzu_query_result()
+        kuzu_connection_copy_from_arrow_stream(
+            &cConnection,
+            tableName,
+            stream.assumingMemoryBound(to: ArrowArrayStream.self),
+            &cQueryResult
+        )
+        if !kuzu_query_result_is_success(&cQueryResult) {
+            let cErrorMesage: UnsafeMutablePointer<CChar>? =
+                kuzu_query_result_get_error_message(&cQueryResult)
+            defer {
+                kuzu_query_result_destroy(&cQueryResult)
+                kuzu_destroy_string(cErrorMesage)
+            }
+            if cErrorMesage == nil {
+                throw KuzuError.queryExecutionFailed(
+                    "Query execution failed with an unknown error."
+                )
+            } else {
+                let errorMessage = String(cString: cErrorMesage!)
+                throw KuzuError.queryExecutionFailed(errorMessage)
+            }
+        }
+        let queryResult = QueryResult(self, cQueryResult)
+        return queryResult
+    }
+
     /// Sets the maximum number of threads that can be used for executing a query in parallel.
     /// - Parameter numThreads: The maximum number of threads to use
     public func setMaxNumThreadForExec(_ numThreads: UInt64) {
@@ -163,4 +329,135 @@ public final class Connection: @unchecked Sendable {
     public func interrupt() {
         kuzu_connection_interrupt(&cConnection)
     }
+
+    /// Returns the progress of the query executing on the connection. It can be called from other
+    /// threads while the query executes, e.g. while awaiting `queryAsync`.
+    /// - Returns: The progress of the executing query
+    /// - Throws: KuzuError if the database is closed
+    public func getQueryProgress() throws -> QueryProgress {
+        var cProgress = kuzu_query_progress()
+        let state = kuzu_connection_get_query_progress(&cConnection, &cProgress)
+        if state != KuzuSuccess {
+            throw KuzuError.queryExecutionFailed("Failed to get the query progress")
+        }
+        return QueryProgress(
+            isRunning: cProgress.is_running,
+            queryID: cProgress.query_id,
+            numPipelines: cProgress.num_pipelines,
+            numPipelinesFinished: cProgress.num_pipelines_finished,
+            pipelineProgress: cProgress.pipeline_progress,
+            progress: cProgress.progress,
+            elapsedTimeMS: cProgress.elapsed_time_ms,
+            estimatedRemainingTimeMS: cProgress.estimated_remaining_time_ms < 0
+                ? nil : cProgress.estimated_remaining_time_ms
+        )
+    }
+}
+
+/// The state of a query executed with `Connection.queryAsync`, shared with the callback that the
+/// C API calls once the result of the query is ready.
+internal final class AsyncQuery: @unchecked Sendable {
+    private let connection: Connection
+    private let lock = NSLock()
+    private var cAsyncQueryResult = kuzu_async_query_result()
+    private var continuation: CheckedContinuation<QueryResult, Error>?
+    private var isSubmitted = false
+    private var isFinished = false
+    private var isInterrupted = false
+
+    init(_ connection: Connection) {
+        self.connection = connection
+    }
+
+    deinit {
+        if isSubmitted {
+            kuzu_async_query_result_destroy(&cAsyncQueryResult)
+        }
+    }
+
+    func submit(_ cypher: String, _ continuation: CheckedContinuation<QueryResult, Error>) {
+        self.continuation = continuation
+        // The callback holds a reference to the query until the result is ready.
+        let userData = Unmanaged.passRetained(self).toOpaque()
+        let state = kuzu_connection_query_async(
+            &connection.cConnection,
+            cypher,
+            { userData in
+                Unmanaged<AsyncQuery>.fromOpaque(userData!).takeRetainedValue().finish()
+            },
+            userData,
+            &cAsyncQueryResult
+        )
+        if state != KuzuSuccess {
+            Unmanaged<AsyncQuery>.fromOpaque(userData).release()
+            continuation.resume(
+                throwing: KuzuError.queryExecutionFailed(
+                    "Query submission failed with error code: \(state)"
+                )
+            )
+            return
+        }
+        lock.lock()
+        isSubmitted = true
+        // The query may have finished, or the task may have been cancelled, before its handle was
+        // returned.
+        let shouldResume = isFinished
+        let shouldInterrupt = isInterrupted && !isFinished
+        lock.unlock()
+        if shouldInterrupt {
+            kuzu_async_query_result_interrupt(&cAsyncQueryResult)
+        }
+        if shouldResume {
+            resume()
+        }
+    }
+
+    func interrupt() {
+        lock.lock()
+        isInterrupted = true
+        let shouldInterrupt = isSubmitted && !isFinished
+        lock.unlock()
+        if shouldInterrupt {
+            kuzu_async_query_result_interrupt(&cAsyncQueryResult)
+        }
+    }
+
+    private func finish() {
+        lock.lock()
+        isFinished = true
+        let shouldResume = isSubmitted
+        lock.unlock()
+        if shouldResume {
+            resume()
+        }
+    }
+
+    private func resume() {
+        guard let continuation = self.continuation else {
+            return
+        }
+        self.continuation = nil
+        var cQueryResult = kuzu_query_result()
+        kuzu_async_query_result_get_query_result(&cAsyncQueryResult, &cQueryResult)
+        if !kuzu_query_result_is_success(&cQueryResult) {
+            let cErrorMesage: UnsafeMutablePointer<CChar>? =
+                kuzu_query_result_get_error_message(&cQueryResult)
+            defer {
+                kuzu_query_result_destroy(&cQueryResult)
+                kuzu_destroy_string(cErrorMesage)
+            }
+            if cErrorMesage == nil {
+                continuation.resume(
+                    throwing: KuzuError.queryExecutionFailed(
+                        "Query execution failed with an unknown error."
+                    )
+                )
+            } else {
+                let errorMessage = String(cString: cErrorMesage!)
+                continuation.resume(throwing: KuzuError.queryExecutionFailed(errorMessage))
+            }
+            return
+        }
+        continuation.resume(returning: QueryResult(connection, cQueryResult))
+    }
 }
@@ -0,0 +1,104 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+import Foundation
+@_implementationOnly import cxx_kuzu
+
+/// A class representing a tuple of a query result which is not expanded into flat tuples.
+/// FactorizedTuple is returned by the `getNextFactorized` method of QueryResult. Its columns are
+/// partitioned into groups: the columns of a group have the same number of rows, and the flat
+/// tuples represented by the tuple are the Cartesian product of the rows of its groups. For
+/// example, a person returned with all of their friends is a single factorized tuple, in which the
+/// person is one group with one row and the friends are another group with one row per friend.
+/// The contents of a FactorizedTuple are overwritten by the next call to `getNextFactorized`.
+public final class FactorizedTuple: @unchecked Sendable {
+    internal var cFactorizedTuple: kuzu_factorized_tuple
+    internal var queryResult: QueryResult
+
+    internal init(
+        _ queryResult: QueryResult,
+        _ cFactorizedTuple: kuzu_factorized_tuple
+    ) {
+        self.cFactorizedTuple = cFactorizedTuple
+        self.queryResult = queryResult
+    }
+
+    deinit {
+        kuzu_factorized_tuple_destroy(&cFactorizedTuple)
+    }
+
+    /// Returns the number of groups of columns in the tuple.
+    public func getGroupCount() -> UInt64 {
+        return kuzu_factorized_tuple_get_num_groups(&cFactorizedTuple)
+    }
+
+    /// Returns the index of the group the column at the given index belongs to.
+    /// - Parameter column: The index of the column.
+    /// - Returns: The index of the group of the column.
+    /// - Throws: `KuzuError.getFactorizedTupleFailed` if the index is out of range.
+    public func getGroupIndex(_ column: UInt64) throws -> UInt64 {
+        var groupIndex: UInt64 = 0
+        let state = kuzu_factorized_tuple_get_group_index(
+            &cFactorizedTuple,
+            column,
+            &groupIndex
+        )
+        if state != KuzuSuccess {
+            throw KuzuError.getFactorizedTupleFailed(
+                "Get group index failed with error code: \(state)"
+            )
+        }
+        return groupIndex
+    }
+
+    /// Returns the number of rows of the group at the given index.
+    /// - Parameter group: The index of the group.
+    /// - Returns: The number of rows of the group.
+    /// - Throws: `KuzuError.getFactorizedTupleFailed` if the index is out of range.
+    public func getRowCount(_ group: UInt64) throws -> UInt64 {
+        var numRows: UInt64 = 0
+        let state = kuzu_factorized_tuple_get_num_rows(&cFactorizedTuple, group, &numRows)
+        if state != KuzuSuccess {
+            throw KuzuError.getFactorizedTupleFailed(
+                "Get row count failed with error code: \(state)"
+            )
+        }
+        return numRows
+    }
+
+    /// Returns the value of the column at the given index in the given row of its group.
+    /// - Parameters:
+    ///   - column: The index of the column.
+    ///   - row: The index of the row in the group of the column.
+    /// - Returns: The value, or nil if the value is null.
+    /// - Throws: `KuzuError.getFactorizedTupleFailed` if an index is out of range.
+    public func getValue(_ column: UInt64, _ row: UInt64) throws -> Any? {
+        var cValue = kuzu_value()
+        let state = kuzu_factorized_tuple_get_value(&cFactorizedTuple, column, row, &cValue)
+        if state != KuzuSuccess {
+            throw KuzuError.getFactorizedTupleFailed(
+                "Get value failed with error code: \(state)"
+            )
+        }
+        defer { kuzu_value_destroy(&cValue) }
+        return try kuzuValueToSwift(&cValue)
+    }
+
+    /// Returns all values of the column at the given index, one for each row of its group.
+    /// - Parameter column: The index of the column.
+    /// - Returns: An array containing the values of the column.
+    /// - Throws: `KuzuError.getFactorizedTupleFailed` if the index is out of range.
+    public func getColumnValues(_ column: UInt64) throws -> [Any?] {
+        let numRows = try getRowCount(try getGroupIndex(column))
+        var result: [Any?] = []
+        result.reserveCapacity(Int(numRows))
+        for row in UInt64(0)..<numRows {
+            result.append(try getValue(column, row))
+        }
+        return result
+    }
+}
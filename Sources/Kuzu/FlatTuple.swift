@@ -42,6 +42,53 @@ public final class FlatTuple: CustomStringConvertible, @unchecked Sendable {
     /// - Returns: The value at the specified index, or nil if the value is null.
     /// - Throws: `KuzuError.getValueFailed` if retrieving the value fails.
     public func getValue(_ index: UInt64) throws -> Any? {
+        return try withValue(index) { try kuzuValueToSwift(&$0) }
+    }
+
+    /// Returns the value at the given index in the FlatTuple as a value of the given type.
+    /// BOOL, integer, floating point, STRING and BLOB values, and lists of BOOL, INT64, INT32,
+    /// FLOAT and DOUBLE values, are read directly as the type, which is much faster than
+    /// `getValue` for large results. Integer values can be read as any integer type which can
+    /// represent them, e.g. `Int.self` for INT32 columns. Values of other types are read as by
+    /// `getValue` and cast.
+    /// - Parameters:
+    ///   - type: The Swift type of the value, e.g. `Int64.self`, `String.self`, `Data.self` or
+    ///     `[Float].self`.
+    ///   - index: The index of the value to retrieve.
+    /// - Returns: The value at the specified index, or nil if the value is null.
+    /// - Throws: `KuzuError.getValueFailed` if retrieving the value fails or the value cannot be
+    ///   read as the type.
+    public func get<T>(_ type: T.Type, at index: UInt64) throws -> T? {
+        return try withValue(index) { try kuzuValueToSwift(&$0, as: type) }
+    }
+
+    /// Returns the list of FLOAT values at the given index in the FlatTuple, e.g. an embedding.
+    /// The elements are copied into the array at once rather than converted one at a time.
+    /// - Parameter index: The index of the value to retrieve.
+    /// - Returns: The values of the list, or nil if the list is null.
+    /// - Throws: `KuzuError.getValueFailed` if the value is not a LIST or ARRAY of FLOAT values, or
+    ///   one of its elements is null.
+    public func getFloatArray(at index: UInt64) throws -> [Float]? {
+        return try get([Float].self, at: index)
+    }
+
+    /// Decodes the FlatTuple as a value of the given `Decodable` type.
+    /// The properties of the type are read from the columns named by their coding keys, e.g. `name`
+    /// for `RETURN a.fName AS name`, with the `get` method and without converting the other
+    /// columns. Types with a single value, e.g. `Int64`, are decoded from a tuple with one column.
+    /// - Parameter type: The type to decode.
+    /// - Returns: The decoded value.
+    /// - Throws: `DecodingError` if a column is missing or null, or cannot be read as the type of
+    ///   its property.
+    public func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        return try T(from: FlatTupleDecoder(self))
+    }
+
+    /// Calls the given closure with the value at the given index, which is owned by the FlatTuple.
+    internal func withValue<R>(
+        _ index: UInt64,
+        _ body: (inout kuzu_value) throws -> R
+    ) throws -> R {
         var cValue = kuzu_value()
         let state = kuzu_flat_tuple_get_value(&cFlatTuple, index, &cValue)
         if state != KuzuSuccess {
@@ -50,7 +97,7 @@ public final class FlatTuple: CustomStringConvertible, @unchecked Sendable {
             )
         }
         defer { kuzu_value_destroy(&cValue) }
-        return try kuzuValueToSwift(&cValue)
+        return try body(&cValue)
     }
 
     /// Returns the values of the FlatTuple as a dictionary.
@@ -60,6 +107,7 @@ public final class FlatTuple: CustomStringConvertible, @unchecked Sendable {
     public func getAsDictionary() throws -> [String: Any?] {
         var result: [String: Any] = [:]
         let keys = queryResult.getColumnNames()
+        result.reserveCapacity(keys.count)
         for i in 0..<keys.count {
             let key = keys[i]
             let value = try getValue(UInt64(i))
@@ -75,6 +123,7 @@ public final class FlatTuple: CustomStringConvertible, @unchecked Sendable {
     public func getAsArray() throws -> [Any?] {
         var result: [Any?] = []
         let count = queryResult.getColumnCount()
+        result.reserveCapacity(Int(count))
         for i in UInt64(0)..<count {
             let value = try getValue(i)
             result.append(value)
@@ -0,0 +1,291 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+import Foundation
+@_implementationOnly import cxx_kuzu
+
+/// A decoder reading a FlatTuple into a `Decodable` type, used by the `decode` method of FlatTuple.
+/// Keyed containers read the columns named by their keys, and single value containers read the
+/// only column of the tuple. Values are read with the `get` method of FlatTuple, so only the
+/// columns which are decoded are converted, without boxing them in `Any`. Nested containers are
+/// not supported, as the values of a tuple are not encoded as containers.
+internal struct FlatTupleDecoder: Decoder {
+    let tuple: FlatTuple
+    let codingPath: [CodingKey] = []
+    let userInfo: [CodingUserInfoKey: Any] = [:]
+
+    init(_ tuple: FlatTuple) {
+        self.tuple = tuple
+    }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) throws -> KeyedDecodingContainer<Key> {
+        return KeyedDecodingContainer(
+            FlatTupleKeyedDecodingContainer<Key>(tuple, tuple.queryResult.getColumnIndices())
+        )
+    }
+
+    func unkeyedContainer() throws -> UnkeyedDecodingContainer {
+        throw DecodingError.typeMismatch(
+            [Any].self,
+            DecodingError.Context(
+                codingPath: codingPath,
+                debugDescription: "A flat tuple cannot be decoded as an unkeyed container"
+            )
+        )
+    }
+
+    func singleValueContainer() throws -> SingleValueDecodingContainer {
+        if tuple.queryResult.getColumnCount() != 1 {
+            throw DecodingError.typeMismatch(
+                Any.self,
+                DecodingError.Context(
+                    codingPath: codingPath,
+                    debugDescription:
+                        "Only a flat tuple with a single column can be decoded as a single value"
+                )
+            )
+        }
+        return FlatTupleSingleValueDecodingContainer(tuple)
+    }
+}
+
+/// Reads the value at the given index of the tuple as the given type.
+/// - Throws: `DecodingError.valueNotFound` if the value is null, and `DecodingError.typeMismatch`
+///   if it cannot be read as the type.
+private func decodeValue<T>(
+    _ tuple: FlatTuple,
+    _ index: UInt64,
+    _ type: T.Type,
+    _ codingPath: [CodingKey]
+) throws -> T {
+    let value: T?
+    do {
+        value = try tuple.get(type, at: index)
+    } catch let error as KuzuError {
+        throw DecodingError.typeMismatch(
+            type,
+            DecodingError.Context(
+                codingPath: codingPath,
+                debugDescription: error.message,
+                underlyingError: error
+            )
+        )
+    }
+    guard let value = value else {
+        throw DecodingError.valueNotFound(
+            type,
+            DecodingError.Context(codingPath: codingPath, debugDescription: "Value is null")
+        )
+    }
+    return value
+}
+
+private func decodeNilValue(_ tuple: FlatTuple, _ index: UInt64) throws -> Bool {
+    return try tuple.withValue(index) { kuzu_value_is_null(&$0) }
+}
+
+private func nestedContainerError(_ codingPath: [CodingKey]) -> DecodingError {
+    return DecodingError.typeMismatch(
+        Any.self,
+        DecodingError.Context(
+            codingPath: codingPath,
+            debugDescription: "Values of a flat tuple cannot be decoded as nested containers"
+        )
+    )
+}
+
+internal struct FlatTupleKeyedDecodingContainer<Key: CodingKey>: KeyedDecodingContainerProtocol {
+    let tuple: FlatTuple
+    let columnIndices: [String: UInt64]
+    let codingPath: [CodingKey] = []
+
+    init(_ tuple: FlatTuple, _ columnIndices: [String: UInt64]) {
+        self.tuple = tuple
+        self.columnIndices = columnIndices
+    }
+
+    var allKeys: [Key] {
+        return tuple.queryResult.getColumnNames().compactMap { Key(stringValue: $0) }
+    }
+
+    func contains(_ key: Key) -> Bool {
+        return columnIndices[key.stringValue] != nil
+    }
+
+    private func getIndex(_ key: Key) throws -> UInt64 {
+        guard let index = columnIndices[key.stringValue] else {
+            throw DecodingError.keyNotFound(
+                key,
+                DecodingError.Context(
+                    codingPath: codingPath,
+                    debugDescription: "No column named \(key.stringValue)"
+                )
+            )
+        }
+        return index
+    }
+
+    private func decodeColumn<T>(_ type: T.Type, _ key: Key) throws -> T {
+        return try decodeValue(tuple, try getIndex(key), type, codingPath + [key])
+    }
+
+    func decodeNil(forKey key: Key) throws -> Bool {
+        return try decodeNilValue(tuple, try getIndex(key))
+    }
+
+    func decode(_ type: Bool.Type, forKey key: Key) throws -> Bool {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: String.Type, forKey key: Key) throws -> String {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Double.Type, forKey key: Key) throws -> Double {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Float.Type, forKey key: Key) throws -> Float {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Int.Type, forKey key: Key) throws -> Int {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Int8.Type, forKey key: Key) throws -> Int8 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Int16.Type, forKey key: Key) throws -> Int16 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Int32.Type, forKey key: Key) throws -> Int32 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: Int64.Type, forKey key: Key) throws -> Int64 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: UInt.Type, forKey key: Key) throws -> UInt {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: UInt8.Type, forKey key: Key) throws -> UInt8 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: UInt16.Type, forKey key: Key) throws -> UInt16 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: UInt32.Type, forKey key: Key) throws -> UInt32 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode(_ type: UInt64.Type, forKey key: Key) throws -> UInt64 {
+        return try decodeColumn(type, key)
+    }
+
+    func decode<T: Decodable>(_ type: T.Type, forKey key: Key) throws -> T {
+        return try decodeColumn(type, key)
+    }
+
+    func nestedContainer<NestedKey: CodingKey>(
+        keyedBy type: NestedKey.Type,
+        forKey key: Key
+    ) throws -> KeyedDecodingContainer<NestedKey> {
+        throw nestedContainerError(codingPath + [key])
+    }
+
+    func nestedUnkeyedContainer(forKey key: Key) throws -> UnkeyedDecodingContainer {
+        throw nestedContainerError(codingPath + [key])
+    }
+
+    func superDecoder() throws -> Decoder {
+        throw nestedContainerError(codingPath)
+    }
+
+    func superDecoder(forKey key: Key) throws -> Decoder {
+        throw nestedContainerError(codingPath + [key])
+    }
+}
+
+internal struct FlatTupleSingleValueDecodingContainer: SingleValueDecodingContainer {
+    let tuple: FlatTuple
+    let codingPath: [CodingKey] = []
+
+    init(_ tuple: FlatTuple) {
+        self.tuple = tuple
+    }
+
+    func decodeNil() -> Bool {
+        return (try? decodeNilValue(tuple, 0)) ?? false
+    }
+
+    func decode(_ type: Bool.Type) throws -> Bool {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: String.Type) throws -> String {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Double.Type) throws -> Double {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Float.Type) throws -> Float {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Int.Type) throws -> Int {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Int8.Type) throws -> Int8 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Int16.Type) throws -> Int16 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Int32.Type) throws -> Int32 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: Int64.Type) throws -> Int64 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: UInt.Type) throws -> UInt {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: UInt8.Type) throws -> UInt8 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: UInt16.Type) throws -> UInt16 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: UInt32.Type) throws -> UInt32 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode(_ type: UInt64.Type) throws -> UInt64 {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+
+    func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        return try decodeValue(tuple, 0, type, codingPath)
+    }
+}
@@ -0,0 +1,29 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+/// The progress of the query executing in a connection, as returned by
+/// `Connection.getQueryProgress()`.
+public struct QueryProgress: Sendable {
+    /// Whether a query is executing in the connection. Other properties are only set if it is.
+    public let isRunning: Bool
+    /// The ID of the executing query.
+    public let queryID: UInt64
+    /// The number of pipelines of the query.
+    public let numPipelines: UInt32
+    /// The number of pipelines of the query which are finished.
+    public let numPipelinesFinished: UInt32
+    /// The fraction of the work of the pipelines being executed which is done, e.g. of the
+    /// morsels of a scan or of the iterations of a graph algorithm.
+    public let pipelineProgress: Double
+    /// The fraction of the query which is done, each pipeline counting for an equal share.
+    public let progress: Double
+    /// The time in milliseconds since the query started executing.
+    public let elapsedTimeMS: Double
+    /// The remaining time in milliseconds, extrapolated from the elapsed time and the progress.
+    /// Nil until there is some progress.
+    public let estimatedRemainingTimeMS: Double?
+}
@@ -17,6 +17,7 @@ public final class QueryResult: CustomStringConvertible, Sequence, @unchecked
     internal var cQueryResult: kuzu_query_result
     internal var connection: Connection
     internal var columnNames: [String]?
+    internal var columnIndices: [String: UInt64]?
 
     /// An iterator type for QueryResult that conforms to IteratorProtocol.
     public struct Iterator: IteratorProtocol {
@@ -85,6 +86,80 @@ public final class QueryResult: CustomStringConvertible, Sequence, @unchecked
         return FlatTuple(self, cFlatTuple)
     }
 
+    /// Returns the next batch of rows in the result set in columnar format.
+    /// Reading the values of a batch through its columns is much faster than iterating over the
+    /// result set tuple by tuple. The tuple iterator and the batches share the same position in the
+    /// result set.
+    /// - Parameter maxRowCount: The maximum number of rows in the batch.
+    /// - Returns: The next batch of rows, or nil if there are no more tuples.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if retrieving the next batch fails.
+    public func nextBatch(maxRowCount: UInt64 = 2048) throws -> QueryResultBatch? {
+        if !self.hasNext() {
+            return nil
+        }
+        var cColumnBatch = kuzu_column_batch()
+        let state = kuzu_query_result_get_next_column_batch(
+            &cQueryResult,
+            maxRowCount,
+            &cColumnBatch
+        )
+        if state != KuzuSuccess {
+            throw KuzuError.getColumnBatchFailed(
+                "Get next batch failed with error code: \(state)"
+            )
+        }
+        return QueryResultBatch(self, cColumnBatch)
+    }
+
+    /// Exports the remaining rows of the result set as an Arrow C stream, whose arrays hold up to
+    /// `chunkSize` rows each. The stream reads from this QueryResult, which must be kept alive and
+    /// not iterated until the stream is released.
+    /// - Parameters:
+    ///   - chunkSize: The maximum number of rows in each array of the stream.
+    ///   - stream: A pointer to an `ArrowArrayStream` of the Arrow C stream interface, which the
+    ///     caller is responsible for releasing.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the stream cannot be exported.
+    public func exportArrowStream(
+        chunkSize: Int64 = 2048,
+        _ stream: UnsafeMutableRawPointer
+    ) throws {
+        let state = kuzu_query_result_get_arrow_stream(
+            &cQueryResult,
+            chunkSize,
+            stream.assumingMemoryBound(to: ArrowArrayStream.self)
+        )
+        if state != KuzuSuccess {
+            throw KuzuError.getColumnBatchFailed(
+                "Export Arrow stream failed with error code: \(state)"
+            )
+        }
+    }
+
+    /// Returns the next tuple in the result set without expanding it into flat tuples.
+    /// The columns of a factorized tuple are partitioned into groups, and the flat tuples it
+    /// represents are the Cartesian product of the rows of its groups. Reading one-to-many results
+    /// this way avoids converting the values of the "one" side once for every row of the "many"
+    /// side. Factorized tuples are read independently of `getNext` and `nextBatch`, and are not
+    /// supported by streaming results.
+    /// - Returns: The next factorized tuple, or nil if there are no more tuples.
+    /// - Throws: `KuzuError.getFactorizedTupleFailed` if retrieving the next tuple fails.
+    public func getNextFactorized() throws -> FactorizedTuple? {
+        if !kuzu_query_result_has_next_factorized_tuple(&cQueryResult) {
+            return nil
+        }
+        var cFactorizedTuple = kuzu_factorized_tuple()
+        let state = kuzu_query_result_get_next_factorized_tuple(
+            &cQueryResult,
+            &cFactorizedTuple
+        )
+        if state != KuzuSuccess {
+            throw KuzuError.getFactorizedTupleFailed(
+                "Get next factorized tuple failed with error code: \(state)"
+            )
+        }
+        return FactorizedTuple(self, cFactorizedTuple)
+    }
+
     /// Returns true if not all query results are consumed when multiple query statements are executed.
     public func hasNextQueryResult() -> Bool {
         return kuzu_query_result_has_next_query_result(&cQueryResult)
@@ -134,6 +209,19 @@ public final class QueryResult: CustomStringConvertible, Sequence, @unchecked
         return columnNames!
     }
 
+    /// Returns the indices of the columns of the QueryResult by their names.
+    internal func getColumnIndices() -> [String: UInt64] {
+        if let columnIndices = self.columnIndices {
+            return columnIndices
+        }
+        var indices: [String: UInt64] = [:]
+        for (i, columnName) in getColumnNames().enumerated() {
+            indices[columnName] = UInt64(i)
+        }
+        columnIndices = indices
+        return indices
+    }
+
     /// Returns the number of columns in the QueryResult.
     public func getColumnCount() -> UInt64 {
         return kuzu_query_result_get_num_columns(&cQueryResult)
@@ -154,6 +242,17 @@ public final class QueryResult: CustomStringConvertible, Sequence, @unchecked
         return kuzu_query_summary_get_compiling_time(&cQuerySummary)
     }
 
+    /// Returns the part of the compiling time spent on planning and optimizing the query in
+    /// milliseconds.
+    public func getPlanningTime() -> Double {
+        var cQuerySummary = kuzu_query_summary()
+        defer {
+            kuzu_query_summary_destroy(&cQuerySummary)
+        }
+        kuzu_query_result_get_query_summary(&cQueryResult, &cQuerySummary)
+        return kuzu_query_summary_get_planning_time(&cQuerySummary)
+    }
+
     /// Returns the execution time of the query in milliseconds.
     public func getExecutionTime() -> Double {
         var cQuerySummary = kuzu_query_summary()
@@ -164,3 +263,9 @@ public final class QueryResult: CustomStringConvertible, Sequence, @unchecked
         return kuzu_query_summary_get_execution_time(&cQuerySummary)
     }
 }
+
+/// Releases an Arrow C stream through its release callback.
+internal func releaseArrowStream(_ stream: UnsafeMutableRawPointer) {
+    let arrowStream = stream.assumingMemoryBound(to: ArrowArrayStream.self)
+    arrowStream.pointee.release?(arrowStream)
+}
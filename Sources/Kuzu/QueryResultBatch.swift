@@ -0,0 +1,216 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+import Foundation
+@_implementationOnly import cxx_kuzu
+
+/// A class representing a batch of rows of a query result in columnar format.
+/// QueryResultBatch is returned by the `nextBatch` method of QueryResult. Reading the values of a
+/// batch through its columns avoids converting each value separately, and is much faster than
+/// iterating over the query result tuple by tuple.
+public final class QueryResultBatch: @unchecked Sendable {
+    internal var cColumnBatch: kuzu_column_batch
+    internal var queryResult: QueryResult
+
+    internal init(
+        _ queryResult: QueryResult,
+        _ cColumnBatch: kuzu_column_batch
+    ) {
+        self.cColumnBatch = cColumnBatch
+        self.queryResult = queryResult
+    }
+
+    deinit {
+        kuzu_column_batch_destroy(&cColumnBatch)
+    }
+
+    /// Returns the number of rows in the batch.
+    public func getRowCount() -> UInt64 {
+        return kuzu_column_batch_get_num_tuples(&cColumnBatch)
+    }
+
+    /// Returns the number of columns in the batch.
+    public func getColumnCount() -> UInt64 {
+        return queryResult.getColumnCount()
+    }
+
+    /// Returns the column at the given index in the batch.
+    /// Only columns of BOOL, integer, floating point, DATE, TIMESTAMP, STRING and BLOB types can be
+    /// read from a batch.
+    /// - Parameter index: The index of the column to retrieve.
+    /// - Returns: The column at the specified index.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the index is out of range or the type of the
+    ///   column is not supported.
+    public func getColumn(_ index: UInt64) throws -> QueryResultColumn {
+        var cColumnBuffer = kuzu_column_buffer()
+        let state = kuzu_column_batch_get_column(&cColumnBatch, index, &cColumnBuffer)
+        if state != KuzuSuccess {
+            throw KuzuError.getColumnBatchFailed(
+                "Get column failed with error code: \(state)"
+            )
+        }
+        return QueryResultColumn(self, cColumnBuffer)
+    }
+}
+
+/// A class representing a column of a QueryResultBatch.
+/// The buffers of a column are owned by its batch, which is kept alive as long as the column.
+/// DATE values are exposed as the number of days since 1970-01-01, and TIMESTAMP values as the
+/// number of units (seconds, milliseconds, microseconds or nanoseconds) since 1970-01-01 00:00:00
+/// UTC, as in Kuzu.
+public final class QueryResultColumn: @unchecked Sendable {
+    internal var batch: QueryResultBatch
+    internal var cColumnBuffer: kuzu_column_buffer
+
+    internal init(
+        _ batch: QueryResultBatch,
+        _ cColumnBuffer: kuzu_column_buffer
+    ) {
+        self.batch = batch
+        self.cColumnBuffer = cColumnBuffer
+    }
+
+    /// The number of values in the column.
+    public var count: Int {
+        return Int(cColumnBuffer.num_values)
+    }
+
+    /// Returns true if the value at the given index is null.
+    public func isNull(_ index: Int) -> Bool {
+        precondition(index >= 0 && index < count, "Index out of range")
+        return !getBit(cColumnBuffer.validity, index)
+    }
+
+    /// Returns the values of the column as a buffer of fixed-size values, without copying them.
+    /// The values at the indices of null values are undefined.
+    /// - Parameter type: The Swift type of the values, which must match the type of the column,
+    ///   e.g. `Int64.self` for INT64 and TIMESTAMP columns, or `Int32.self` for DATE columns.
+    /// - Returns: A buffer pointer to the values, which is only valid as long as the column.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the type doesn't match the type of the column.
+    public func getValues<T>(_ type: T.Type) throws -> UnsafeBufferPointer<T> {
+        guard let expectedType = getSwiftType(),
+            ObjectIdentifier(expectedType) == ObjectIdentifier(T.self)
+        else {
+            throw KuzuError.getColumnBatchFailed(
+                "Column values cannot be read as \(T.self)"
+            )
+        }
+        guard let values = cColumnBuffer.values else {
+            return UnsafeBufferPointer(start: nil, count: 0)
+        }
+        return UnsafeBufferPointer(
+            start: values.assumingMemoryBound(to: T.self),
+            count: count
+        )
+    }
+
+    /// Returns the BOOL value at the given index, or nil if the value is null.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the column is not a BOOL column.
+    public func getBool(_ index: Int) throws -> Bool? {
+        if cColumnBuffer.data_type_id != KUZU_BOOL {
+            throw KuzuError.getColumnBatchFailed("Column values cannot be read as Bool")
+        }
+        if isNull(index) {
+            return nil
+        }
+        return getBit(cColumnBuffer.values?.assumingMemoryBound(to: UInt8.self), index)
+    }
+
+    /// Returns the INT128 value at the given index, or nil if the value is null.
+    /// As when reading a value tuple by tuple, INT128 values are mapped to Decimal.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the column is not an INT128 column.
+    public func getInt128(_ index: Int) throws -> Decimal? {
+        if cColumnBuffer.data_type_id != KUZU_INT128 {
+            throw KuzuError.getColumnBatchFailed("Column values cannot be read as Decimal")
+        }
+        if isNull(index) {
+            return nil
+        }
+        // Each value is the low 64 bits followed by the signed high 64 bits.
+        let words = cColumnBuffer.values!.assumingMemoryBound(to: UInt64.self)
+        let low = words[2 * index]
+        let high = Int64(bitPattern: words[2 * index + 1])
+        return Decimal(high) * (Decimal(UInt64.max) + 1) + Decimal(low)
+    }
+
+    /// Returns the STRING value at the given index, or nil if the value is null.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the column is not a STRING column.
+    public func getString(_ index: Int) throws -> String? {
+        if cColumnBuffer.data_type_id != KUZU_STRING {
+            throw KuzuError.getColumnBatchFailed("Column values cannot be read as String")
+        }
+        guard let bytes = getVariableSizeValue(index) else {
+            return nil
+        }
+        return String(decoding: bytes, as: UTF8.self)
+    }
+
+    /// Returns the bytes of the STRING or BLOB value at the given index, without copying them, or
+    /// nil if the value is null.
+    /// - Returns: A buffer pointer to the bytes, which is only valid as long as the column.
+    /// - Throws: `KuzuError.getColumnBatchFailed` if the column is not a STRING or BLOB column.
+    public func getBytes(_ index: Int) throws -> UnsafeRawBufferPointer? {
+        if cColumnBuffer.data_type_id != KUZU_STRING && cColumnBuffer.data_type_id != KUZU_BLOB {
+            throw KuzuError.getColumnBatchFailed("Column values cannot be read as bytes")
+        }
+        guard let bytes = getVariableSizeValue(index) else {
+            return nil
+        }
+        return UnsafeRawBufferPointer(bytes)
+    }
+
+    private func getVariableSizeValue(_ index: Int) -> UnsafeBufferPointer<UInt8>? {
+        if isNull(index) {
+            return nil
+        }
+        let offsets = cColumnBuffer.offsets!
+        let start = Int(offsets[index])
+        let length = Int(offsets[index + 1]) - start
+        guard let values = cColumnBuffer.values, length > 0 else {
+            return UnsafeBufferPointer(start: nil, count: 0)
+        }
+        return UnsafeBufferPointer(
+            start: values.assumingMemoryBound(to: UInt8.self) + start,
+            count: length
+        )
+    }
+
+    private func getBit(_ bitmap: UnsafePointer<UInt8>?, _ index: Int) -> Bool {
+        guard let bitmap = bitmap else {
+            return true
+        }
+        return bitmap[index >> 3] & (UInt8(1) << UInt8(index & 7)) != 0
+    }
+
+    private func getSwiftType() -> Any.Type? {
+        switch cColumnBuffer.data_type_id {
+        case KUZU_INT64, KUZU_SERIAL, KUZU_TIMESTAMP, KUZU_TIMESTAMP_SEC, KUZU_TIMESTAMP_MS,
+            KUZU_TIMESTAMP_NS, KUZU_TIMESTAMP_TZ:
+            return Int64.self
+        case KUZU_INT32, KUZU_DATE:
+            return Int32.self
+        case KUZU_INT16:
+            return Int16.self
+        case KUZU_INT8:
+            return Int8.self
+        case KUZU_UINT64:
+            return UInt64.self
+        case KUZU_UINT32:
+            return UInt32.self
+        case KUZU_UINT16:
+            return UInt16.self
+        case KUZU_UINT8:
+            return UInt8.self
+        case KUZU_DOUBLE:
+            return Double.self
+        case KUZU_FLOAT:
+            return Float.self
+        default:
+            return nil
+        }
+    }
+}
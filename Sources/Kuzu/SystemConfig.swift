@@ -22,6 +22,10 @@ public final class SystemConfig: @unchecked Sendable {
     /// - maxNumThreads: Number of CPU cores available in the system
     /// - enableCompression: true
     /// - readOnly: false
+    /// - directIO: false
+    /// - enableHugePages: false
+    /// - warmUpBufferPool: false
+    /// - enableTwoQueueEviction: false
     /// - threadQos: QOS_CLASS_DEFAULT (Apple platforms only)
     public init() {
         cSystemConfig = kuzu_default_system_config()
@@ -45,13 +49,21 @@ public final class SystemConfig: @unchecked Sendable {
     ///   - readOnly: A boolean flag to open the database in read-only mode. Default is false.
     ///   - autoCheckpoint: Whether to automatically create checkpoints. Default is true.
     ///   - checkpointThreshold: The threshold for creating checkpoints. If set to UInt64.max, uses default value.
+    ///   - directIO: Whether the database file bypasses the OS page cache, so that pages are not cached both by the buffer pool and the OS. Give the buffer pool most of the memory when enabled. Default is false.
+    ///   - enableHugePages: Whether the memory of the buffer pool is backed by transparent huge pages, which reduces page faults while a large buffer pool warms up. Only supported on Linux. Default is false.
+    ///   - warmUpBufferPool: Whether the pages cached in the buffer pool are recorded at each checkpoint and when the database is closed, and read back in the background when the database is opened again. Default is false.
+    ///   - enableTwoQueueEviction: Whether pages read once by sequential scans are kept in a small probationary queue and evicted before the other pages, so that large scans don't flush the working set out of the buffer pool. Default is false.
     public convenience init(
         bufferPoolSize: UInt64 = 0,
         maxNumThreads: UInt64 = 0,
         enableCompression: Bool = true,
         readOnly: Bool = false,
         autoCheckpoint: Bool = true,
-        checkpointThreshold: UInt64 = UInt64.max
+        checkpointThreshold: UInt64 = UInt64.max,
+        directIO: Bool = false,
+        enableHugePages: Bool = false,
+        warmUpBufferPool: Bool = false,
+        enableTwoQueueEviction: Bool = false
     ) {
         self.init()
         if bufferPoolSize > 0 {
@@ -66,6 +78,10 @@ public final class SystemConfig: @unchecked Sendable {
         if checkpointThreshold > 0 {
             cSystemConfig.checkpoint_threshold = checkpointThreshold
         }
+        cSystemConfig.direct_io = directIO
+        cSystemConfig.enable_huge_pages = enableHugePages
+        cSystemConfig.warm_up_buffer_pool = warmUpBufferPool
+        cSystemConfig.enable_two_queue_eviction = enableTwoQueueEviction
     }
 
     #if !os(Linux)
@@ -79,6 +95,10 @@ public final class SystemConfig: @unchecked Sendable {
         ///   - readOnly: A boolean flag to open the database in read-only mode. Default is false.
         ///   - autoCheckpoint: Whether to automatically create checkpoints. Default is true.
         ///   - checkpointThreshold: The threshold for creating checkpoints. If set to UInt64.max, uses default value.
+        ///   - directIO: Whether the database file bypasses the OS page cache, so that pages are not cached both by the buffer pool and the OS. Give the buffer pool most of the memory when enabled. Default is false.
+        ///   - enableHugePages: Whether the memory of the buffer pool is backed by transparent huge pages. Only supported on Linux. Default is false.
+        ///   - warmUpBufferPool: Whether the pages cached in the buffer pool are read back in the background when the database is opened again. Default is false.
+        ///   - enableTwoQueueEviction: Whether pages read once by sequential scans are evicted before the other pages of the buffer pool. Default is false.
         ///   - threadQoS: The quality of service (QoS) for the worker threads. This is only available on Apple platforms. The default value is QOS_CLASS_DEFAULT.
         public convenience init(
             bufferPoolSize: UInt64 = 0,
@@ -87,6 +107,10 @@ public final class SystemConfig: @unchecked Sendable {
             readOnly: Bool = false,
             autoCheckpoint: Bool = true,
             checkpointThreshold: UInt64 = UInt64.max,
+            directIO: Bool = false,
+            enableHugePages: Bool = false,
+            warmUpBufferPool: Bool = false,
+            enableTwoQueueEviction: Bool = false,
             threadQoS: qos_class_t = QOS_CLASS_DEFAULT
 
         ) {
@@ -96,7 +120,11 @@ public final class SystemConfig: @unchecked Sendable {
                 enableCompression: enableCompression,
                 readOnly: readOnly,
                 autoCheckpoint: autoCheckpoint,
-                checkpointThreshold: checkpointThreshold
+                checkpointThreshold: checkpointThreshold,
+                directIO: directIO,
+                enableHugePages: enableHugePages,
+                warmUpBufferPool: warmUpBufferPool,
+                enableTwoQueueEviction: enableTwoQueueEviction
             )
             self.cSystemConfig.thread_qos = threadQoS.rawValue
         }
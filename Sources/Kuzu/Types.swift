@@ -23,6 +23,10 @@ public enum KuzuError: Error {
     case getNextQueryResultFailed(String)
     /// Failed to get a value with the given error message.
     case getValueFailed(String)
+    /// Failed to get a batch of rows or one of its columns with the given error message.
+    case getColumnBatchFailed(String)
+    /// Failed to get a factorized tuple or one of its values with the given error message.
+    case getFactorizedTupleFailed(String)
     /// The error message.
     /// - Returns: The error message.
     public var message: String {
@@ -34,7 +38,9 @@ public enum KuzuError: Error {
             .valueConversionFailed(let msg),
             .getFlatTupleFailed(let msg),
             .getNextQueryResultFailed(let msg),
-            .getValueFailed(let msg):
+            .getValueFailed(let msg),
+            .getColumnBatchFailed(let msg),
+            .getFactorizedTupleFailed(let msg):
             return msg
         }
     }
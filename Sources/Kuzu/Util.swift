@@ -228,6 +228,71 @@ private func kuzuListToSwiftArray(_ cValue: inout kuzu_value) throws -> [Any?] {
     return result
 }
 
+/// Converts a Kuzu list value to a Swift array, converting each element with the given function.
+/// - Parameters:
+///   - cValue: The Kuzu list value to convert.
+///   - convert: The function converting an element of the list.
+/// - Returns: A Swift array of the converted elements.
+/// - Throws: `KuzuError.valueConversionFailed` if the conversion fails.
+private func kuzuListToSwiftArray<T>(
+    _ cValue: inout kuzu_value,
+    _ convert: (inout kuzu_value) throws -> T
+) throws -> [T] {
+    var numElements: UInt64 = 0
+    let state = kuzu_value_get_list_size(&cValue, &numElements)
+    if state != KuzuSuccess {
+        throw KuzuError.valueConversionFailed(
+            "Failed to get number of elements in list with status: \(state)"
+        )
+    }
+    var result: [T] = []
+    result.reserveCapacity(Int(numElements))
+    var currentValue = kuzu_value()
+    for i in UInt64(0)..<numElements {
+        let state = kuzu_value_get_list_element(&cValue, i, &currentValue)
+        if state != KuzuSuccess {
+            throw KuzuError.valueConversionFailed(
+                "Failed to get list element with status: \(state)"
+            )
+        }
+        defer { kuzu_value_destroy(&currentValue) }
+        result.append(try convert(&currentValue))
+    }
+    return result
+}
+
+/// Converts a Kuzu list value of fixed-size elements to a Swift array, copying all of its elements
+/// at once instead of converting them one at a time.
+/// - Parameters:
+///   - cValue: The Kuzu list value to convert.
+///   - type: The Swift type of the elements.
+///   - typeId: The Kuzu type of the elements, which must match the type of the list.
+/// - Returns: A Swift array of the elements.
+/// - Throws: `KuzuError.getValueFailed` if the type doesn't match or an element is null.
+private func kuzuListToSwiftArray<T>(
+    _ cValue: inout kuzu_value,
+    _ type: T.Type,
+    _ typeId: kuzu_data_type_id
+) throws -> [T] {
+    var numElements: UInt64 = 0
+    let state = kuzu_value_get_list_size(&cValue, &numElements)
+    if state != KuzuSuccess {
+        throw KuzuError.getValueFailed("Value cannot be read as [\(T.self)]")
+    }
+    return try [T](unsafeUninitializedCapacity: Int(numElements)) { buffer, count in
+        let state = kuzu_value_copy_list_values(
+            &cValue,
+            typeId,
+            buffer.baseAddress,
+            numElements
+        )
+        if state != KuzuSuccess {
+            throw KuzuError.getValueFailed("Value cannot be read as [\(T.self)]")
+        }
+        count = Int(numElements)
+    }
+}
+
 /// Converts a Swift dictionary to a Kuzu struct value.
 /// - Parameter dictionary: The Swift dictionary to convert.
 /// - Returns: A Kuzu struct value.
@@ -557,28 +622,12 @@ private func kuzuRecursiveRelValueToSwiftRecursiveRelationship(
     }
     defer { kuzu_value_destroy(&relsValue) }
 
-    let nodesArray = try kuzuListToSwiftArray(&nodesValue)
-    let relsArray = try kuzuListToSwiftArray(&relsValue)
-
-    var nodes: [KuzuNode] = []
-    for node in nodesArray {
-        guard let kuzuNode = node as? KuzuNode else {
-            throw KuzuError.valueConversionFailed(
-                "Failed to convert node to KuzuNode"
-            )
-        }
-        nodes.append(kuzuNode)
-    }
-
-    var relationships: [KuzuRelationship] = []
-    for rel in relsArray {
-        guard let kuzuRel = rel as? KuzuRelationship else {
-            throw KuzuError.valueConversionFailed(
-                "Failed to convert relationship to KuzuRelationship"
-            )
-        }
-        relationships.append(kuzuRel)
-    }
+    // The elements are converted directly instead of going through [Any?] and casting them back.
+    let nodes = try kuzuListToSwiftArray(&nodesValue, kuzuNodeValueToSwiftNode)
+    let relationships = try kuzuListToSwiftArray(
+        &relsValue,
+        kuzuRelValueToSwiftRelationship
+    )
 
     return KuzuRecursiveRelationship(nodes: nodes, relationships: relationships)
 }
@@ -992,3 +1041,132 @@ internal func kuzuValueToSwift(_ cValue: inout kuzu_value) throws -> Any? {
         )
     }
 }
+
+/// Reads a fixed-size Kuzu value with the given C getter, which fails if the type of the value
+/// doesn't match.
+private func getKuzuValue<V>(
+    _ cValue: inout kuzu_value,
+    _ defaultValue: V,
+    _ getter: (UnsafeMutablePointer<kuzu_value>?, UnsafeMutablePointer<V>?) -> kuzu_state
+) throws -> V {
+    var value = defaultValue
+    let state = getter(&cValue, &value)
+    if state != KuzuSuccess {
+        throw KuzuError.getValueFailed("Value cannot be read as \(V.self)")
+    }
+    return value
+}
+
+/// Reads a Kuzu integer value of any integer type as the given integer type.
+/// - Returns: The value, or nil if the value is not an integer or doesn't fit in the type.
+private func kuzuIntegerToSwift<V: FixedWidthInteger>(
+    _ cValue: inout kuzu_value,
+    _ type: V.Type
+) throws -> V? {
+    switch kuzu_value_get_data_type_id(&cValue) {
+    case KUZU_INT64:
+        return V(exactly: try getKuzuValue(&cValue, Int64(), kuzu_value_get_int64))
+    case KUZU_INT32:
+        return V(exactly: try getKuzuValue(&cValue, Int32(), kuzu_value_get_int32))
+    case KUZU_INT16:
+        return V(exactly: try getKuzuValue(&cValue, Int16(), kuzu_value_get_int16))
+    case KUZU_INT8:
+        return V(exactly: try getKuzuValue(&cValue, Int8(), kuzu_value_get_int8))
+    case KUZU_UINT64:
+        return V(exactly: try getKuzuValue(&cValue, UInt64(), kuzu_value_get_uint64))
+    case KUZU_UINT32:
+        return V(exactly: try getKuzuValue(&cValue, UInt32(), kuzu_value_get_uint32))
+    case KUZU_UINT16:
+        return V(exactly: try getKuzuValue(&cValue, UInt16(), kuzu_value_get_uint16))
+    case KUZU_UINT8:
+        return V(exactly: try getKuzuValue(&cValue, UInt8(), kuzu_value_get_uint8))
+    default:
+        return nil
+    }
+}
+
+/// Reads the bytes of a Kuzu STRING or BLOB value in place, without copying them to a C string.
+/// - Returns: The result of converting the bytes, or nil if the value is not of the given type.
+private func kuzuStringDataToSwift<R>(
+    _ cValue: inout kuzu_value,
+    _ typeId: kuzu_data_type_id,
+    _ convert: (UnsafeRawBufferPointer) -> R
+) -> R? {
+    if kuzu_value_get_data_type_id(&cValue) != typeId {
+        return nil
+    }
+    var data: UnsafePointer<CChar>?
+    var length: UInt64 = 0
+    let state = kuzu_value_get_string_data(&cValue, &data, &length)
+    if state != KuzuSuccess {
+        return nil
+    }
+    return convert(UnsafeRawBufferPointer(start: data, count: Int(length)))
+}
+
+/// Converts a Kuzu value to a Swift value of the given type.
+/// BOOL, integer, floating point, STRING and BLOB values, and lists of BOOL, integer and floating
+/// point values, are read directly as the type without being boxed in `Any`. Integer values can be
+/// read as any integer type which can represent them. Other values are converted as by
+/// `kuzuValueToSwift` and cast to the type.
+/// - Parameters:
+///   - cValue: The Kuzu value to convert.
+///   - type: The Swift type to convert the value to.
+/// - Returns: The Swift value, or nil if the value is null.
+/// - Throws: `KuzuError.getValueFailed` if the value cannot be read as the type.
+internal func kuzuValueToSwift<T>(_ cValue: inout kuzu_value, as type: T.Type) throws -> T? {
+    if kuzu_value_is_null(&cValue) {
+        return nil
+    }
+    let value: T?
+    switch ObjectIdentifier(type) {
+    case ObjectIdentifier(Bool.self):
+        value = try getKuzuValue(&cValue, Bool(), kuzu_value_get_bool) as? T
+    case ObjectIdentifier(Int.self):
+        value = try kuzuIntegerToSwift(&cValue, Int.self) as? T
+    case ObjectIdentifier(Int64.self):
+        value = try kuzuIntegerToSwift(&cValue, Int64.self) as? T
+    case ObjectIdentifier(Int32.self):
+        value = try kuzuIntegerToSwift(&cValue, Int32.self) as? T
+    case ObjectIdentifier(Int16.self):
+        value = try kuzuIntegerToSwift(&cValue, Int16.self) as? T
+    case ObjectIdentifier(Int8.self):
+        value = try kuzuIntegerToSwift(&cValue, Int8.self) as? T
+    case ObjectIdentifier(UInt.self):
+        value = try kuzuIntegerToSwift(&cValue, UInt.self) as? T
+    case ObjectIdentifier(UInt64.self):
+        value = try kuzuIntegerToSwift(&cValue, UInt64.self) as? T
+    case ObjectIdentifier(UInt32.self):
+        value = try kuzuIntegerToSwift(&cValue, UInt32.self) as? T
+    case ObjectIdentifier(UInt16.self):
+        value = try kuzuIntegerToSwift(&cValue, UInt16.self) as? T
+    case ObjectIdentifier(UInt8.self):
+        value = try kuzuIntegerToSwift(&cValue, UInt8.self) as? T
+    case ObjectIdentifier(Float.self):
+        value = try getKuzuValue(&cValue, Float(), kuzu_value_get_float) as? T
+    case ObjectIdentifier(Double.self):
+        value = try getKuzuValue(&cValue, Double(), kuzu_value_get_double) as? T
+    case ObjectIdentifier(String.self):
+        value =
+            kuzuStringDataToSwift(&cValue, KUZU_STRING) { String(decoding: $0, as: UTF8.self) }
+            as? T
+    case ObjectIdentifier(Data.self):
+        value = kuzuStringDataToSwift(&cValue, KUZU_BLOB) { Data($0) } as? T
+    case ObjectIdentifier([Bool].self):
+        value = try kuzuListToSwiftArray(&cValue, Bool.self, KUZU_BOOL) as? T
+    case ObjectIdentifier([Int64].self):
+        value = try kuzuListToSwiftArray(&cValue, Int64.self, KUZU_INT64) as? T
+    case ObjectIdentifier([Int32].self):
+        value = try kuzuListToSwiftArray(&cValue, Int32.self, KUZU_INT32) as? T
+    case ObjectIdentifier([Float].self):
+        value = try kuzuListToSwiftArray(&cValue, Float.self, KUZU_FLOAT) as? T
+    case ObjectIdentifier([Double].self):
+        value = try kuzuListToSwiftArray(&cValue, Double.self, KUZU_DOUBLE) as? T
+    default:
+        value = try kuzuValueToSwift(&cValue) as? T
+    }
+    guard let value = value else {
+        throw KuzuError.getValueFailed("Value cannot be read as \(T.self)")
+    }
+    return value
+}
@@ -23,6 +23,17 @@ void InMemParallelComputeTask::run() {
 
 void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
     ExecutionContext* context, std::optional<common::table_id_t> tableId) {
+    runParallelComputeInternal(vc, maxOffset, std::nullopt /* morselSize */, context, tableId);
+}
+
+void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
+    uint64_t morselSize, ExecutionContext* context) {
+    runParallelComputeInternal(vc, maxOffset, morselSize, context, std::nullopt /* tableId */);
+}
+
+void InMemGDSUtils::runParallelComputeInternal(InMemParallelCompute& vc,
+    common::offset_t maxOffset, std::optional<uint64_t> morselSize, ExecutionContext* context,
+    std::optional<common::table_id_t> tableId) {
     auto clientContext = context->clientContext;
     if (clientContext->interrupted()) {
         throw common::InterruptException();
@@ -31,7 +42,11 @@ void InMemGDSUtils::runParallelCompute(InMemParallelCompute& vc, common::offset_
     auto sharedState = std::make_shared<VertexComputeTaskSharedState>(maxThreads);
     const auto task =
         std::make_shared<InMemParallelComputeTask>(maxThreads, vc, sharedState, tableId);
-    sharedState->morselDispatcher.init(maxOffset);
+    if (morselSize.has_value()) {
+        sharedState->morselDispatcher.init(maxOffset, morselSize.value());
+    } else {
+        sharedState->morselDispatcher.init(maxOffset);
+    }
     common::TaskScheduler::Get(*clientContext)
         ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
 }
@@ -0,0 +1,80 @@
+#include "common/sorted_adjacency_graph.h"
+
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace algo_extension {
+
+void SortedAdjacencyGraph::init(graph::Graph* graph, table_id_t tableID) {
+    const auto nbrInfo = graph->getRelInfos(tableID)[0];
+    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
+    // Set randomLookup to false to enable caching during graph materialization.
+    const auto scanState = graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID,
+        nbrInfo.dstTableID, {}, false /*randomLookup*/);
+    ku_vector_t<offset_t> nodeNbrs{mm};
+    nbrs.clear();
+    csrOffsets[0] = 0;
+    for (auto nodeID = 0u; nodeID < getNumNodes(); ++nodeID) {
+        const nodeID_t boundNodeID = {nodeID, tableID};
+        nodeNbrs.clear();
+        auto collectNbrs = [&](auto neighbors, auto, auto i) {
+            if (neighbors[i].offset != nodeID) {
+                nodeNbrs.push_back(neighbors[i].offset);
+            }
+        };
+        for (auto chunk : graph->scanFwd(boundNodeID, *scanState)) {
+            chunk.forEach(collectNbrs);
+        }
+        for (auto chunk : graph->scanBwd(boundNodeID, *scanState)) {
+            chunk.forEach(collectNbrs);
+        }
+        std::sort(nodeNbrs.begin(), nodeNbrs.end());
+        nodeNbrs.resize(std::unique(nodeNbrs.begin(), nodeNbrs.end()) - nodeNbrs.begin());
+        for (auto nbr : nodeNbrs) {
+            nbrs.push_back(nbr);
+        }
+        csrOffsets[nodeID + 1] = nbrs.size();
+    }
+}
+
+SortedAdjacencyGraphBindResult SortedAdjacencyGraphUtils::bind(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& functionName,
+    const std::string& columnName, LogicalType columnType) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException(functionName + " only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException(functionName + " only supports operations on one edge table.");
+    }
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(columnName, std::move(columnType)));
+    return {std::move(graphEntry), std::move(nodeOutput), std::move(columns)};
+}
+
+std::unique_ptr<TableFunction> SortedAdjacencyGraphUtils::getTableFunction(const char* name,
+    table_func_bind_t bindFunc, table_func_t tableFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = std::move(bindFunc);
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -0,0 +1,420 @@
+#include <bit>
+#include <random>
+
+#include "binder/binder.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/sorted_adjacency_graph.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/centrality_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Shortest path based centralities of nodes in the undirected unweighted graph. Both are computed
+// from BFSs from a uniform sample of k source nodes, and scaled by n / k to estimate the sum over
+// all n sources (Brandes and Pich, "Centrality estimation in large networks", 2007). With k = n,
+// the results are exact.
+//   - Betweenness (Brandes, "A faster algorithm for betweenness centrality", 2001): sum over all
+//     pairs of other nodes {s, t} of the fraction of shortest s-t paths that pass through the node.
+//   - Harmonic closeness: sum over all other nodes t of 1 / distance(node, t).
+
+namespace kuzu {
+namespace algo_extension {
+
+struct CentralityOptionalParams final : public OptionalParams {
+    OptionalParam<SampleSize> sampleSize;
+    OptionalParam<SampleSeed> seed;
+
+    explicit CentralityOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    CentralityOptionalParams(OptionalParam<SampleSize> sampleSize, OptionalParam<SampleSeed> seed)
+        : sampleSize{std::move(sampleSize)}, seed{std::move(seed)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        sampleSize.evaluateParam(context);
+        seed.evaluateParam(context);
+    }
+
+    std::unique_ptr<OptionalParams> copy() override {
+        return std::make_unique<CentralityOptionalParams>(sampleSize, seed);
+    }
+};
+
+CentralityOptionalParams::CentralityOptionalParams(const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == SampleSize::NAME) {
+            sampleSize = OptionalParam<SampleSize>(optionalParam);
+        } else if (paramName == SampleSeed::NAME) {
+            seed = OptionalParam<SampleSeed>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct CentralityBindData final : public GDSBindData {
+    CentralityBindData(expression_vector columns, NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<CentralityOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CentralityBindData>(*this);
+    }
+};
+
+// Fills sources with the sorted sample of source nodes.
+static void sampleSources(offset_t numNodes, uint64_t sampleSize, uint64_t seed,
+    ku_vector_t<offset_t>& sources) {
+    sources.resize(numNodes);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        sources[nodeID] = nodeID;
+    }
+    if (sampleSize == 0 || sampleSize >= numNodes) {
+        return;
+    }
+    // Partial Fisher-Yates shuffle.
+    std::mt19937_64 generator{seed};
+    for (auto i = 0u; i < sampleSize; ++i) {
+        std::uniform_int_distribution<offset_t> distribution{i, numNodes - 1};
+        std::swap(sources[i], sources[distribution(generator)]);
+    }
+    sources.resize(sampleSize);
+    // Sources close in offset share more of the rels read by their BFSs.
+    std::sort(sources.begin(), sources.end());
+}
+
+static void addCAS(std::atomic<double>& origin, double valToAdd) {
+    auto expected = origin.load(std::memory_order_relaxed);
+    auto desired = expected + valToAdd;
+    while (!origin.compare_exchange_strong(expected, desired)) {
+        desired = expected + valToAdd;
+    }
+}
+
+// Runs a BFS from each source and accumulates the dependencies of the source on the other nodes
+// into the betweenness of the nodes. Each thread runs the BFSs of different sources.
+class BrandesVC final : public InMemParallelCompute {
+public:
+    BrandesVC(MemoryManager* mm, const SortedAdjacencyGraph& graph,
+        const ku_vector_t<offset_t>& sources, ObjectArray<std::atomic<double>>& betweenness)
+        : mm{mm}, graph{graph}, sources{sources}, betweenness{betweenness}, distances{mm},
+          numShortestPaths{mm}, dependencies{mm}, visitOrder{mm} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        if (distances.empty()) {
+            distances.resize(graph.getNumNodes());
+            std::fill(distances.begin(), distances.end(), UINT64_MAX);
+            numShortestPaths.resize(graph.getNumNodes());
+            dependencies.resize(graph.getNumNodes());
+        }
+        for (auto i = startOffset; i < endOffset; ++i) {
+            runBFS(sources[i]);
+            accumulateDependencies(sources[i]);
+            for (auto nodeID : visitOrder) {
+                distances[nodeID] = UINT64_MAX;
+                numShortestPaths[nodeID] = 0;
+                dependencies[nodeID] = 0;
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<BrandesVC>(mm, graph, sources, betweenness);
+    }
+
+private:
+    void runBFS(offset_t source) {
+        visitOrder.clear();
+        visitOrder.push_back(source);
+        distances[source] = 0;
+        numShortestPaths[source] = 1;
+        for (auto next = 0u; next < visitOrder.size(); ++next) {
+            auto nodeID = visitOrder[next];
+            for (auto nbrID : graph.getNbrs(nodeID)) {
+                if (distances[nbrID] == UINT64_MAX) {
+                    distances[nbrID] = distances[nodeID] + 1;
+                    visitOrder.push_back(nbrID);
+                }
+                if (distances[nbrID] == distances[nodeID] + 1) {
+                    numShortestPaths[nbrID] += numShortestPaths[nodeID];
+                }
+            }
+        }
+    }
+
+    // Visits the nodes in decreasing order of distance from the source.
+    void accumulateDependencies(offset_t source) {
+        for (auto i = visitOrder.size(); i > 0; --i) {
+            auto nodeID = visitOrder[i - 1];
+            for (auto nbrID : graph.getNbrs(nodeID)) {
+                if (distances[nbrID] + 1 == distances[nodeID]) {
+                    dependencies[nbrID] += numShortestPaths[nbrID] / numShortestPaths[nodeID] *
+                                           (1 + dependencies[nodeID]);
+                }
+            }
+            if (nodeID != source && dependencies[nodeID] > 0) {
+                addCAS(betweenness.getUnsafe(nodeID), dependencies[nodeID]);
+            }
+        }
+    }
+
+private:
+    MemoryManager* mm;
+    const SortedAdjacencyGraph& graph;
+    const ku_vector_t<offset_t>& sources;
+    ObjectArray<std::atomic<double>>& betweenness;
+    // Scratch space of the BFS of a single source, reset for the visited nodes after each source.
+    ku_vector_t<uint64_t> distances;
+    ku_vector_t<double> numShortestPaths;
+    ku_vector_t<double> dependencies;
+    ku_vector_t<offset_t> visitOrder;
+};
+
+// Bit-parallel BFS from up to 64 sources at a time, where bit i of the masks of a node is for the
+// i-th source of the batch.
+static constexpr uint64_t NUM_SOURCES_PER_BATCH = 64;
+
+struct BitParallelBFSState {
+    ku_vector_t<uint64_t> visited;
+    ku_vector_t<uint64_t> frontier0;
+    ku_vector_t<uint64_t> frontier1;
+    // Point to frontier0 and frontier1, and are swapped after each level.
+    ku_vector_t<uint64_t>* currFrontier;
+    ku_vector_t<uint64_t>* nextFrontier;
+    uint64_t batchMask = 0;
+
+    BitParallelBFSState(offset_t numNodes, MemoryManager* mm)
+        : visited{mm, numNodes}, frontier0{mm, numNodes}, frontier1{mm, numNodes},
+          currFrontier{&frontier0}, nextFrontier{&frontier1} {}
+    DELETE_BOTH_COPY(BitParallelBFSState);
+
+    void initBatch(std::span<const offset_t> batchSources) {
+        std::fill(visited.begin(), visited.end(), 0);
+        std::fill(currFrontier->begin(), currFrontier->end(), 0);
+        for (auto i = 0u; i < batchSources.size(); ++i) {
+            visited[batchSources[i]] |= 1ull << i;
+            (*currFrontier)[batchSources[i]] |= 1ull << i;
+        }
+        batchMask = batchSources.size() == NUM_SOURCES_PER_BATCH ?
+                        UINT64_MAX :
+                        (1ull << batchSources.size()) - 1;
+    }
+};
+
+// Runs one level of the BFSs of the batch. The graph is undirected, so the sources that reach a
+// node at the level are the sources that the node reaches at that distance, and are added to the
+// harmonic closeness of the node. Each node pulls from its neighbors and is only written by the
+// thread that visits it.
+class HarmonicLevelVC final : public InMemParallelCompute {
+public:
+    HarmonicLevelVC(const SortedAdjacencyGraph& graph, BitParallelBFSState& state, uint64_t level,
+        ku_vector_t<double>& closeness, std::atomic<offset_t>& numActiveNodes)
+        : graph{graph}, state{state}, level{level}, closeness{closeness},
+          numActiveNodes{numActiveNodes} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        offset_t numLocalActiveNodes = 0;
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            auto& nextFrontier = *state.nextFrontier;
+            nextFrontier[nodeID] = 0;
+            const auto unreached = ~state.visited[nodeID] & state.batchMask;
+            if (unreached == 0) {
+                continue;
+            }
+            uint64_t reached = 0;
+            for (auto nbrID : graph.getNbrs(nodeID)) {
+                reached |= (*state.currFrontier)[nbrID];
+            }
+            reached &= unreached;
+            if (reached == 0) {
+                continue;
+            }
+            nextFrontier[nodeID] = reached;
+            state.visited[nodeID] |= reached;
+            closeness[nodeID] += static_cast<double>(std::popcount(reached)) / level;
+            numLocalActiveNodes++;
+        }
+        numActiveNodes.fetch_add(numLocalActiveNodes, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<HarmonicLevelVC>(graph, state, level, closeness, numActiveNodes);
+    }
+
+private:
+    const SortedAdjacencyGraph& graph;
+    BitParallelBFSState& state;
+    uint64_t level;
+    ku_vector_t<double>& closeness;
+    std::atomic<offset_t>& numActiveNodes;
+};
+
+class CentralityResultsVC final : public GDSResultVertexCompute {
+public:
+    CentralityResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const ku_vector_t<double>& scores)
+        : GDSResultVertexCompute{mm, sharedState}, scores{scores} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        scoreVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            scoreVector->setValue<double>(0, scores[i]);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<CentralityResultsVC>(mm, sharedState, scores);
+    }
+
+private:
+    const ku_vector_t<double>& scores;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> scoreVector;
+};
+
+static void computeBetweenness(const SortedAdjacencyGraph& graph,
+    const ku_vector_t<offset_t>& sources, const TableFuncInput& input,
+    ku_vector_t<double>& scores) {
+    const auto numNodes = graph.getNumNodes();
+    auto mm = MemoryManager::Get(*input.context->clientContext);
+    ObjectArray<std::atomic<double>> betweenness(numNodes, mm, true /* initializeToZero */);
+    BrandesVC brandesVC(mm, graph, sources, betweenness);
+    // A single BFS already visits the whole component of the source.
+    InMemGDSUtils::runParallelCompute(brandesVC, sources.size(), 1 /* morselSize */,
+        input.context);
+    // Each pair of nodes is counted from both ends.
+    const auto scale = static_cast<double>(numNodes) / sources.size() / 2;
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        scores[nodeID] = betweenness.getUnsafe(nodeID).load(std::memory_order_relaxed) * scale;
+    }
+}
+
+static void computeHarmonicCloseness(const SortedAdjacencyGraph& graph,
+    const ku_vector_t<offset_t>& sources, const TableFuncInput& input,
+    ku_vector_t<double>& scores) {
+    const auto numNodes = graph.getNumNodes();
+    auto mm = MemoryManager::Get(*input.context->clientContext);
+    auto progressBar = ProgressBar::Get(*input.context->clientContext);
+    BitParallelBFSState state(numNodes, mm);
+    const auto numBatches = (sources.size() + NUM_SOURCES_PER_BATCH - 1) / NUM_SOURCES_PER_BATCH;
+    for (auto batch = 0u; batch < numBatches; ++batch) {
+        auto batchStart = batch * NUM_SOURCES_PER_BATCH;
+        auto batchSize = std::min(NUM_SOURCES_PER_BATCH, sources.size() - batchStart);
+        state.initBatch(std::span{sources.data() + batchStart, batchSize});
+        for (auto level = 1u;; ++level) {
+            std::atomic<offset_t> numActiveNodes{0};
+            HarmonicLevelVC levelVC(graph, state, level, scores, numActiveNodes);
+            InMemGDSUtils::runParallelCompute(levelVC, numNodes, input.context);
+            if (numActiveNodes.load() == 0) {
+                break;
+            }
+            std::swap(state.currFrontier, state.nextFrontier);
+        }
+        progressBar->updateProgress(input.context->queryID,
+            static_cast<double>(batch + 1) / numBatches);
+    }
+    const auto scale = static_cast<double>(numNodes) / sources.size();
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        scores[nodeID] *= scale;
+    }
+}
+
+// Computes the centrality of each node into scores, which are zero-initialized.
+using compute_centrality_func_t = void (*)(const SortedAdjacencyGraph&,
+    const ku_vector_t<offset_t>&, const TableFuncInput&, ku_vector_t<double>&);
+
+template<compute_centrality_func_t COMPUTE_FUNC>
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto numNodes = graph->getMaxOffset(transaction, tableID);
+    auto& config = input.bindData->constPtrCast<CentralityBindData>()
+                       ->optionalParams->constCast<CentralityOptionalParams>();
+
+    SortedAdjacencyGraph adjGraph(numNodes, mm);
+    adjGraph.init(graph, tableID);
+    ku_vector_t<double> scores(mm, numNodes);
+    if (numNodes > 0) {
+        ku_vector_t<offset_t> sources(mm);
+        sampleSources(numNodes, config.sampleSize.getParamVal(), config.seed.getParamVal(),
+            sources);
+        COMPUTE_FUNC(adjGraph, sources, input, scores);
+    }
+    auto resultsVC = CentralityResultsVC(mm, sharedState, scores);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, resultsVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char BETWEENNESS_COLUMN_NAME[] = "betweenness_centrality";
+static constexpr char CLOSENESS_COLUMN_NAME[] = "closeness_centrality";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& functionName,
+    const std::string& columnName) {
+    auto bindResult = SortedAdjacencyGraphUtils::bind(context, input, functionName, columnName,
+        LogicalType::DOUBLE());
+    return std::make_unique<CentralityBindData>(std::move(bindResult.columns),
+        std::move(bindResult.graphEntry), bindResult.nodeOutput,
+        std::make_unique<CentralityOptionalParams>(input->optionalParamsLegacy));
+}
+
+static std::unique_ptr<TableFuncBindData> betweennessBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, "Betweenness centrality", BETWEENNESS_COLUMN_NAME);
+}
+
+static std::unique_ptr<TableFuncBindData> closenessBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, "Closeness centrality", CLOSENESS_COLUMN_NAME);
+}
+
+function_set BetweennessCentralityFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(SortedAdjacencyGraphUtils::getTableFunction(name, betweennessBindFunc,
+        tableFunc<computeBetweenness>));
+    return result;
+}
+
+function_set ClosenessCentralityFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(SortedAdjacencyGraphUtils::getTableFunction(name, closenessBindFunc,
+        tableFunc<computeHarmonicCloseness>));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
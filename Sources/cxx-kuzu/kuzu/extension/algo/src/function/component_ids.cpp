@@ -62,8 +62,7 @@ void ComponentIDsOutputVertexCompute::vertexCompute(offset_t startOffset, offset
         if (skip(i)) {
             continue;
         }
-        auto nodeID = nodeID_t{i, tableID};
-        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        nodeIDVector->setValue<nodeID_t>(0, getOutputNodeID(i, tableID));
         componentIDVector->setValue<uint64_t>(0, componentIDs.getComponentID(i));
         localFT->append(vectors);
     }
@@ -0,0 +1,775 @@
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "common/types/types.h"
+#include "function/algo_function.h"
+#include "function/config/louvain_config.h"
+#include "function/config/max_iterations_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace std;
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Leiden method for community detection: Traag et al., "From Louvain to Leiden: guaranteeing
+// well-connected communities", 2019. Each pass of the method has three steps:
+//   1. Local moving: nodes move to the neighbor community with the highest modularity gain.
+//   2. Refinement: every community is split into refined communities. Starting from singletons,
+//      nodes only merge into refined communities of their own community that they and the refined
+//      community are well connected to, so that communities cannot end up internally disconnected
+//      as they can with Louvain.
+//   3. Aggregation: every refined community becomes a node of the graph of the next pass, whose
+//      initial community is the community of step 1.
+// The modularity gain of moving node n from community c to community d is given as:
+//   gain = (weight_{n,d} - weight_{n,c}) - degree_n * (degree_d - degree_c + degree_n) / 2m
+// where weight_{n,x} is the weight of the edges from n to the other nodes of x, and degree_x is the
+// sum of the weighted degrees of the nodes in x, which is degree_c including n itself.
+
+// The parallel steps follow GVE-Leiden (Sahu, 2023), except that nodes are moved one color class of
+// a distance-1 coloring at a time. Nodes moving concurrently are then never adjacent, so the
+// communities of their neighbors are stable while they move, and moves are applied in place
+// without locks.
+
+namespace kuzu {
+namespace algo_extension {
+
+constexpr double LEIDEN_THRESHOLD = 1e-6;
+constexpr offset_t INVALID_COLOR = numeric_limits<offset_t>::max();
+
+struct LeidenOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<MaxPhases> maxPhases;
+
+    explicit LeidenOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    LeidenOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<MaxPhases> maxPhases)
+        : MaxIterationOptionalParams{maxIterations}, maxPhases{std::move(maxPhases)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        maxPhases.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<LeidenOptionalParams>(maxIterations, maxPhases);
+    }
+};
+
+LeidenOptionalParams::LeidenOptionalParams(const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == MaxPhases::NAME) {
+            maxPhases = function::OptionalParam<MaxPhases>(optionalParam);
+        } else if (paramName == MaxIterations::NAME) {
+            continue;
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct LeidenBindData final : public GDSBindData {
+    LeidenBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<LeidenOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<LeidenBindData>(*this);
+    }
+};
+
+struct LeidenState {
+    // Graph of the current pass, where node i is the i-th refined community of the previous pass.
+    std::unique_ptr<InMemGraph> graph;
+    // Sum of the weights of the edges of each node, including self-loops.
+    ObjectArray<weight_t> nodeDegrees;
+    // Community of each node and sum of the degrees of the nodes of each community.
+    AtomicObjectArray<offset_t> comms;
+    ObjectArray<std::atomic<weight_t>> commDegrees;
+    // Refined community of each node, and sum of the degrees and number of nodes of each refined
+    // community.
+    AtomicObjectArray<offset_t> refinedComms;
+    ObjectArray<std::atomic<weight_t>> refinedCommDegrees;
+    ObjectArray<std::atomic<offset_t>> refinedCommSizes;
+    // Sum of the weights of the edges from each refined community to the rest of its community.
+    ObjectArray<std::atomic<weight_t>> refinedCommExternalWeights;
+    // Sum of the weights of the edges from each node to the other nodes of its community.
+    ObjectArray<weight_t> intraCommWeights;
+    // Color of each node, and the nodes sorted by color, where the nodes of color i are in
+    // [colorOffsets[i], colorOffsets[i+1]).
+    AtomicObjectArray<offset_t> colors;
+    vector<offset_t> nodesByColor;
+    vector<offset_t> colorOffsets;
+    // 2 * sum of edge weights.
+    double totalWeight = 0;
+
+    LeidenState(offset_t numNodes, MemoryManager* mm)
+        : graph{std::make_unique<InMemGraph>(numNodes, mm)}, nodeDegrees{numNodes, mm},
+          comms{numNodes, mm}, commDegrees{numNodes, mm}, refinedComms{numNodes, mm},
+          refinedCommDegrees{numNodes, mm}, refinedCommSizes{numNodes, mm},
+          refinedCommExternalWeights{numNodes, mm}, intraCommWeights{numNodes, mm},
+          colors{numNodes, mm} {}
+    DELETE_BOTH_COPY(LeidenState);
+
+    offset_t getNumNodes() const { return graph->numNodes; }
+
+    double getModularityGain(weight_t weightToDst, weight_t weightToSrc, double degree,
+        double dstDegree, double srcDegree) const {
+        return static_cast<double>(weightToDst) - static_cast<double>(weightToSrc) -
+               degree * (dstDegree - srcDegree + degree) / totalWeight;
+    }
+};
+
+// Sums the weights of the edges from the node to each neighbor community given by getComm,
+// skipping self-loops, which don't change when the node moves.
+template<typename GET_COMM>
+static void sumWeightsToComms(const InMemGraph& graph, offset_t nodeID, GET_COMM getComm,
+    unordered_map<offset_t, weight_t>& weights) {
+    weights.clear();
+    for (auto i = graph.csrOffsets[nodeID]; i < graph.csrOffsets[nodeID + 1]; ++i) {
+        auto& nbr = graph.csrEdges[i];
+        if (nbr.neighbor != nodeID) {
+            weights[getComm(nbr.neighbor)] += nbr.weight;
+        }
+    }
+}
+
+// Puts every node in its own community.
+class LeidenInitPassVC final : public InMemParallelCompute {
+public:
+    explicit LeidenInitPassVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        auto& graph = *state.graph;
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            weight_t degree = 0;
+            for (auto i = graph.csrOffsets[nodeID]; i < graph.csrOffsets[nodeID + 1]; ++i) {
+                degree += graph.csrEdges[i].weight;
+            }
+            state.nodeDegrees.set(nodeID, degree);
+            state.comms.set(nodeID, nodeID, memory_order_relaxed);
+            state.commDegrees.getUnsafe(nodeID).store(degree, memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenInitPassVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Speculative greedy coloring (Gebremedhin and Manne, 2000): the nodes of the worklist take the
+// smallest color not taken by a neighbor in parallel, after which adjacent nodes that took the same
+// color are detected and the larger one of each pair is colored again.
+class LeidenColorNodesVC final : public InMemParallelCompute {
+public:
+    LeidenColorNodesVC(LeidenState& state, const vector<offset_t>& worklist)
+        : state{state}, worklist{worklist} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        auto& graph = *state.graph;
+        for (auto i = startOffset; i < endOffset; ++i) {
+            auto nodeID = worklist[i];
+            // Colors are marked as taken with the (1-based) index of the node in the worklist.
+            for (auto j = graph.csrOffsets[nodeID]; j < graph.csrOffsets[nodeID + 1]; ++j) {
+                auto nbrID = graph.csrEdges[j].neighbor;
+                auto nbrColor =
+                    nbrID == nodeID ? INVALID_COLOR : state.colors.get(nbrID, memory_order_relaxed);
+                if (nbrColor == INVALID_COLOR) {
+                    continue;
+                }
+                if (nbrColor >= takenColors.size()) {
+                    takenColors.resize(nbrColor + 1, 0);
+                }
+                takenColors[nbrColor] = i + 1;
+            }
+            offset_t color = 0;
+            while (color < takenColors.size() && takenColors[color] == i + 1) {
+                color++;
+            }
+            state.colors.set(nodeID, color, memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenColorNodesVC>(state, worklist);
+    }
+
+private:
+    LeidenState& state;
+    const vector<offset_t>& worklist;
+    vector<offset_t> takenColors;
+};
+
+class LeidenDetectColorConflictsVC final : public InMemParallelCompute {
+public:
+    LeidenDetectColorConflictsVC(LeidenState& state, const vector<offset_t>& worklist,
+        vector<uint8_t>& hasConflict)
+        : state{state}, worklist{worklist}, hasConflict{hasConflict} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        auto& graph = *state.graph;
+        for (auto i = startOffset; i < endOffset; ++i) {
+            auto nodeID = worklist[i];
+            auto color = state.colors.get(nodeID, memory_order_relaxed);
+            hasConflict[i] = false;
+            for (auto j = graph.csrOffsets[nodeID]; j < graph.csrOffsets[nodeID + 1]; ++j) {
+                auto nbrID = graph.csrEdges[j].neighbor;
+                if (nbrID < nodeID && state.colors.get(nbrID, memory_order_relaxed) == color) {
+                    hasConflict[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenDetectColorConflictsVC>(state, worklist, hasConflict);
+    }
+
+private:
+    LeidenState& state;
+    const vector<offset_t>& worklist;
+    vector<uint8_t>& hasConflict;
+};
+
+static void colorNodes(LeidenState& state, ExecutionContext* context) {
+    const auto numNodes = state.getNumNodes();
+    vector<offset_t> worklist(numNodes);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        worklist[nodeID] = nodeID;
+        state.colors.set(nodeID, INVALID_COLOR, memory_order_relaxed);
+    }
+    vector<uint8_t> hasConflict;
+    while (!worklist.empty()) {
+        LeidenColorNodesVC colorNodesVC(state, worklist);
+        InMemGDSUtils::runParallelCompute(colorNodesVC, worklist.size(), context);
+        hasConflict.resize(worklist.size());
+        LeidenDetectColorConflictsVC detectConflictsVC(state, worklist, hasConflict);
+        InMemGDSUtils::runParallelCompute(detectConflictsVC, worklist.size(), context);
+        vector<offset_t> nextWorklist;
+        for (auto i = 0u; i < worklist.size(); ++i) {
+            if (hasConflict[i]) {
+                nextWorklist.push_back(worklist[i]);
+            }
+        }
+        worklist = std::move(nextWorklist);
+    }
+    // Bucket the nodes by color.
+    state.colorOffsets.assign(1, 0);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        auto color = state.colors.get(nodeID, memory_order_relaxed);
+        if (color + 2 > state.colorOffsets.size()) {
+            state.colorOffsets.resize(color + 2, 0);
+        }
+        state.colorOffsets[color + 1]++;
+    }
+    for (auto color = 1u; color < state.colorOffsets.size(); ++color) {
+        state.colorOffsets[color] += state.colorOffsets[color - 1];
+    }
+    vector<offset_t> nextPositions(state.colorOffsets.begin(), state.colorOffsets.end() - 1);
+    state.nodesByColor.resize(numNodes);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        auto color = state.colors.get(nodeID, memory_order_relaxed);
+        state.nodesByColor[nextPositions[color]++] = nodeID;
+    }
+}
+
+// Base class of the steps that visit the nodes of a single color.
+class LeidenColorClassVC : public InMemParallelCompute {
+public:
+    LeidenColorClassVC(LeidenState& state, offset_t color, std::atomic<offset_t>& numMoves)
+        : state{state}, color{color}, numMoves{numMoves} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        offset_t numLocalMoves = 0;
+        auto colorStart = state.colorOffsets[color];
+        for (auto i = startOffset; i < endOffset; ++i) {
+            numLocalMoves += moveNode(state.nodesByColor[colorStart + i]);
+        }
+        numMoves.fetch_add(numLocalMoves, memory_order_relaxed);
+    }
+
+    offset_t getNumNodes() const {
+        return state.colorOffsets[color + 1] - state.colorOffsets[color];
+    }
+
+protected:
+    // Returns whether the node moved.
+    virtual bool moveNode(offset_t nodeID) = 0;
+
+protected:
+    LeidenState& state;
+    offset_t color;
+    std::atomic<offset_t>& numMoves;
+    unordered_map<offset_t, weight_t> weightsToComms;
+};
+
+class LeidenLocalMoveVC final : public LeidenColorClassVC {
+public:
+    using LeidenColorClassVC::LeidenColorClassVC;
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenLocalMoveVC>(state, color, numMoves);
+    }
+
+protected:
+    bool moveNode(offset_t nodeID) override {
+        sumWeightsToComms(*state.graph, nodeID,
+            [&](offset_t nbrID) { return state.comms.get(nbrID, memory_order_relaxed); },
+            weightsToComms);
+        if (weightsToComms.empty()) {
+            return false;
+        }
+        const auto currComm = state.comms.get(nodeID, memory_order_relaxed);
+        const auto degree = static_cast<double>(state.nodeDegrees.get(nodeID));
+        const auto weightToCurrComm =
+            weightsToComms.contains(currComm) ? weightsToComms.at(currComm) : 0;
+        const auto currCommDegree =
+            static_cast<double>(state.commDegrees.getUnsafe(currComm).load(memory_order_relaxed));
+        auto bestComm = currComm;
+        double bestGain = LEIDEN_THRESHOLD;
+        for (auto [commID, weight] : weightsToComms) {
+            if (commID == currComm) {
+                continue;
+            }
+            const auto commDegree = static_cast<double>(
+                state.commDegrees.getUnsafe(commID).load(memory_order_relaxed));
+            const auto gain = state.getModularityGain(weight, weightToCurrComm, degree, commDegree,
+                currCommDegree);
+            // Ties are broken by the lower community ID to keep the result deterministic.
+            if (gain > bestGain || (gain == bestGain && commID < bestComm)) {
+                bestGain = gain;
+                bestComm = commID;
+            }
+        }
+        if (bestComm == currComm) {
+            return false;
+        }
+        const auto nodeDegree = state.nodeDegrees.get(nodeID);
+        state.commDegrees.getUnsafe(currComm).fetch_sub(nodeDegree, memory_order_relaxed);
+        state.commDegrees.getUnsafe(bestComm).fetch_add(nodeDegree, memory_order_relaxed);
+        state.comms.set(nodeID, bestComm, memory_order_relaxed);
+        return true;
+    }
+};
+
+// Puts every node in its own refined community.
+class LeidenInitRefinementVC final : public InMemParallelCompute {
+public:
+    explicit LeidenInitRefinementVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        auto& graph = *state.graph;
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            const auto comm = state.comms.get(nodeID, memory_order_relaxed);
+            weight_t intraCommWeight = 0;
+            for (auto i = graph.csrOffsets[nodeID]; i < graph.csrOffsets[nodeID + 1]; ++i) {
+                auto& nbr = graph.csrEdges[i];
+                if (nbr.neighbor != nodeID &&
+                    state.comms.get(nbr.neighbor, memory_order_relaxed) == comm) {
+                    intraCommWeight += nbr.weight;
+                }
+            }
+            state.intraCommWeights.set(nodeID, intraCommWeight);
+            state.refinedComms.set(nodeID, nodeID, memory_order_relaxed);
+            state.refinedCommDegrees.getUnsafe(nodeID).store(state.nodeDegrees.get(nodeID),
+                memory_order_relaxed);
+            state.refinedCommSizes.getUnsafe(nodeID).store(1, memory_order_relaxed);
+            state.refinedCommExternalWeights.getUnsafe(nodeID).store(intraCommWeight,
+                memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenInitRefinementVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Merges singleton refined communities into the neighbor refined community of the same community
+// with the highest modularity gain. A node or refined community x is well connected to its
+// community c if weight_{x,c-x} >= degree_x * (degree_c - degree_x) / 2m.
+class LeidenRefineVC final : public LeidenColorClassVC {
+public:
+    using LeidenColorClassVC::LeidenColorClassVC;
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenRefineVC>(state, color, numMoves);
+    }
+
+protected:
+    bool moveNode(offset_t nodeID) override {
+        // Only nodes that are still singletons move, so refined communities only grow.
+        if (state.refinedComms.get(nodeID, memory_order_relaxed) != nodeID ||
+            state.refinedCommSizes.getUnsafe(nodeID).load(memory_order_relaxed) != 1) {
+            return false;
+        }
+        const auto comm = state.comms.get(nodeID, memory_order_relaxed);
+        const auto degree = static_cast<double>(state.nodeDegrees.get(nodeID));
+        const auto commDegree =
+            static_cast<double>(state.commDegrees.getUnsafe(comm).load(memory_order_relaxed));
+        const auto intraCommWeight = state.intraCommWeights.get(nodeID);
+        if (static_cast<double>(intraCommWeight) <
+            degree * (commDegree - degree) / state.totalWeight) {
+            return false;
+        }
+        sumWeightsToComms(
+            *state.graph, nodeID,
+            [&](offset_t nbrID) {
+                return state.comms.get(nbrID, memory_order_relaxed) == comm ?
+                           state.refinedComms.get(nbrID, memory_order_relaxed) :
+                           INVALID_OFFSET;
+            },
+            weightsToComms);
+        auto bestRefinedComm = nodeID;
+        double bestGain = LEIDEN_THRESHOLD;
+        for (auto [refinedCommID, weight] : weightsToComms) {
+            if (refinedCommID == INVALID_OFFSET) {
+                continue;
+            }
+            const auto refinedCommDegree = static_cast<double>(
+                state.refinedCommDegrees.getUnsafe(refinedCommID).load(memory_order_relaxed));
+            const auto externalWeight = static_cast<double>(
+                state.refinedCommExternalWeights.getUnsafe(refinedCommID)
+                    .load(memory_order_relaxed));
+            if (externalWeight <
+                refinedCommDegree * (commDegree - refinedCommDegree) / state.totalWeight) {
+                continue;
+            }
+            // Leaving a singleton community has no cost besides the degree of the node itself.
+            const auto gain = state.getModularityGain(weight, 0 /* weightToSrc */, degree,
+                refinedCommDegree, degree);
+            if (gain > bestGain || (gain == bestGain && refinedCommID < bestRefinedComm)) {
+                bestGain = gain;
+                bestRefinedComm = refinedCommID;
+            }
+        }
+        if (bestRefinedComm == nodeID) {
+            return false;
+        }
+        const auto nodeDegree = state.nodeDegrees.get(nodeID);
+        const auto weightToBestComm = weightsToComms.at(bestRefinedComm);
+        state.refinedCommDegrees.getUnsafe(nodeID).fetch_sub(nodeDegree, memory_order_relaxed);
+        state.refinedCommSizes.getUnsafe(nodeID).fetch_sub(1, memory_order_relaxed);
+        state.refinedCommDegrees.getUnsafe(bestRefinedComm)
+            .fetch_add(nodeDegree, memory_order_relaxed);
+        state.refinedCommSizes.getUnsafe(bestRefinedComm).fetch_add(1, memory_order_relaxed);
+        // The edges to the refined community become internal, and the other edges of the node to
+        // its community become external.
+        state.refinedCommExternalWeights.getUnsafe(bestRefinedComm)
+            .fetch_add(intraCommWeight - 2 * weightToBestComm, memory_order_relaxed);
+        state.refinedComms.set(nodeID, bestRefinedComm, memory_order_relaxed);
+        return true;
+    }
+};
+
+// Runs the step on each color class in turn until no node moves or the max iterations is reached.
+// Returns the total number of moves.
+template<typename STEP_VC>
+static offset_t runColoredSweeps(LeidenState& state, uint64_t maxIterations,
+    ExecutionContext* context) {
+    offset_t numTotalMoves = 0;
+    for (auto iter = 0u; iter < maxIterations; ++iter) {
+        std::atomic<offset_t> numMoves{0};
+        for (auto color = 0u; color + 1 < state.colorOffsets.size(); ++color) {
+            STEP_VC stepVC(state, color, numMoves);
+            InMemGDSUtils::runParallelCompute(stepVC, stepVC.getNumNodes(), context);
+        }
+        numTotalMoves += numMoves.load();
+        if (numMoves.load() == 0) {
+            break;
+        }
+    }
+    return numTotalMoves;
+}
+
+// Sums the edges of the refined communities to each other. Refined community i of the current pass
+// is node i of the next pass, and its members are in [memberOffsets[i], memberOffsets[i+1]).
+class LeidenAggregateVC final : public InMemParallelCompute {
+public:
+    LeidenAggregateVC(LeidenState& state, const vector<offset_t>& members,
+        const vector<offset_t>& memberOffsets, const vector<offset_t>& nextNodeIDs,
+        ku_vector_t<vector<Neighbor>>& nextNbrs)
+        : state{state}, members{members}, memberOffsets{memberOffsets}, nextNodeIDs{nextNodeIDs},
+          nextNbrs{nextNbrs} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        auto& graph = *state.graph;
+        for (auto nextNodeID = startOffset; nextNodeID < endOffset; ++nextNodeID) {
+            weights.clear();
+            for (auto i = memberOffsets[nextNodeID]; i < memberOffsets[nextNodeID + 1]; ++i) {
+                auto nodeID = members[i];
+                for (auto j = graph.csrOffsets[nodeID]; j < graph.csrOffsets[nodeID + 1]; ++j) {
+                    auto& nbr = graph.csrEdges[j];
+                    weights[nextNodeIDs[nbr.neighbor]] += nbr.weight;
+                }
+            }
+            auto& nbrs = nextNbrs[nextNodeID];
+            nbrs.clear();
+            nbrs.reserve(weights.size());
+            for (auto [nbrID, weight] : weights) {
+                nbrs.emplace_back(nbrID, weight);
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenAggregateVC>(state, members, memberOffsets, nextNodeIDs,
+            nextNbrs);
+    }
+
+private:
+    LeidenState& state;
+    const vector<offset_t>& members;
+    const vector<offset_t>& memberOffsets;
+    const vector<offset_t>& nextNodeIDs;
+    ku_vector_t<vector<Neighbor>>& nextNbrs;
+    unordered_map<offset_t, weight_t> weights;
+};
+
+// Replaces the graph with the graph of the refined communities, where the community of each node
+// is the community of its refined community. `nodeIDs` maps the original nodes to the nodes of the
+// current graph and is updated to the nodes of the new graph. Returns the number of new nodes.
+static offset_t aggregate(LeidenState& state, vector<offset_t>& nodeIDs, MemoryManager* mm,
+    ExecutionContext* context) {
+    const auto numNodes = state.getNumNodes();
+    // Number the refined communities sequentially and group the nodes by refined community.
+    vector<offset_t> nextNodeIDs(numNodes, INVALID_OFFSET);
+    vector<offset_t> memberOffsets(1, 0);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        auto refinedComm = state.refinedComms.get(nodeID, memory_order_relaxed);
+        if (nextNodeIDs[refinedComm] == INVALID_OFFSET) {
+            nextNodeIDs[refinedComm] = memberOffsets.size() - 1;
+            memberOffsets.push_back(0);
+        }
+        memberOffsets[nextNodeIDs[refinedComm] + 1]++;
+    }
+    const auto numNextNodes = memberOffsets.size() - 1;
+    for (auto i = 1u; i < memberOffsets.size(); ++i) {
+        memberOffsets[i] += memberOffsets[i - 1];
+    }
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        nextNodeIDs[nodeID] = nextNodeIDs[state.refinedComms.get(nodeID, memory_order_relaxed)];
+    }
+    vector<offset_t> members(numNodes);
+    vector<offset_t> nextPositions(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        members[nextPositions[nextNodeIDs[nodeID]]++] = nodeID;
+    }
+    ku_vector_t<vector<Neighbor>> nextNbrs(mm, numNextNodes);
+    LeidenAggregateVC aggregateVC(state, members, memberOffsets, nextNodeIDs, nextNbrs);
+    InMemGDSUtils::runParallelCompute(aggregateVC, numNextNodes, context);
+    // Each community is named after its first refined community.
+    vector<offset_t> nextComms(numNextNodes);
+    unordered_map<offset_t, offset_t> commToNextComm;
+    for (auto nextNodeID = 0u; nextNodeID < numNextNodes; ++nextNodeID) {
+        auto comm = state.comms.get(members[memberOffsets[nextNodeID]], memory_order_relaxed);
+        nextComms[nextNodeID] = commToNextComm.emplace(comm, nextNodeID).first->second;
+    }
+    for (auto& nodeID : nodeIDs) {
+        nodeID = nextNodeIDs[nodeID];
+    }
+    auto nextGraph = std::make_unique<InMemGraph>(numNextNodes, mm);
+    for (auto nextNodeID = 0u; nextNodeID < numNextNodes; ++nextNodeID) {
+        nextGraph->initNextNode();
+        for (auto& nbr : nextNbrs[nextNodeID]) {
+            nextGraph->insertNbr(nbr.neighbor, nbr.weight);
+        }
+    }
+    nextGraph->initNextNode();
+    state.graph = std::move(nextGraph);
+    // Node degrees are the same as before, summed over the members.
+    LeidenInitPassVC initPassVC(state);
+    InMemGDSUtils::runParallelCompute(initPassVC, numNextNodes, context);
+    for (auto nextNodeID = 0u; nextNodeID < numNextNodes; ++nextNodeID) {
+        auto comm = nextComms[nextNodeID];
+        state.comms.set(nextNodeID, comm, memory_order_relaxed);
+        if (comm != nextNodeID) {
+            auto degree = state.nodeDegrees.get(nextNodeID);
+            state.commDegrees.getUnsafe(nextNodeID).fetch_sub(degree, memory_order_relaxed);
+            state.commDegrees.getUnsafe(comm).fetch_add(degree, memory_order_relaxed);
+        }
+    }
+    return numNextNodes;
+}
+
+static void initInMemGraph(table_id_t tableID, offset_t numNodes, Graph* graph,
+    InMemGraph& inMemGraph) {
+    const auto nbrInfo = graph->getRelInfos(tableID)[0];
+    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
+    // Set randomLookup to false to enable caching during graph materialization.
+    const auto scanState = graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID,
+        nbrInfo.dstTableID, {}, false /*randomLookup*/);
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        inMemGraph.initNextNode();
+        const nodeID_t boundNodeID = {nodeID, tableID};
+        for (auto chunk : graph->scanFwd(boundNodeID, *scanState)) {
+            chunk.forEach([&](auto neighbors, auto, auto i) {
+                inMemGraph.insertNbr(neighbors[i].offset);
+            });
+        }
+        for (auto chunk : graph->scanBwd(boundNodeID, *scanState)) {
+            chunk.forEach([&](auto neighbors, auto, auto i) {
+                if (neighbors[i].offset != nodeID) {
+                    inMemGraph.insertNbr(neighbors[i].offset);
+                }
+            });
+        }
+    }
+    inMemGraph.initNextNode();
+}
+
+class LeidenWriteResultsVC final : public GDSResultVertexCompute {
+public:
+    LeidenWriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const vector<offset_t>& communities)
+        : GDSResultVertexCompute{mm, sharedState}, communities{communities} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        communityIDVector = createVector(LogicalType::UINT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            communityIDVector->setValue<uint64_t>(0, communities[i]);
+            localFT->append(vectors);
+        }
+    }
+
+    unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LeidenWriteResultsVC>(mm, sharedState, communities);
+    }
+
+private:
+    const vector<offset_t>& communities;
+    unique_ptr<ValueVector> nodeIDVector;
+    unique_ptr<ValueVector> communityIDVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto origNumNodes = graph->getMaxOffset(transaction, tableID);
+    auto& config = input.bindData->constPtrCast<LeidenBindData>()
+                       ->optionalParams->constCast<LeidenOptionalParams>();
+
+    LeidenState state(origNumNodes, mm);
+    initInMemGraph(tableID, origNumNodes, graph, *state.graph);
+    LeidenInitPassVC initPassVC(state);
+    InMemGDSUtils::runParallelCompute(initPassVC, origNumNodes, input.context);
+    for (auto nodeID = 0u; nodeID < origNumNodes; ++nodeID) {
+        state.totalWeight += static_cast<double>(state.nodeDegrees.get(nodeID));
+    }
+    // Node of the current graph that each original node is aggregated into.
+    vector<offset_t> nodeIDs(origNumNodes);
+    for (auto nodeID = 0u; nodeID < origNumNodes; ++nodeID) {
+        nodeIDs[nodeID] = nodeID;
+    }
+
+    auto progressBar = ProgressBar::Get(*clientContext);
+    const auto maxPhases = config.maxPhases.getParamVal();
+    for (auto phase = 0u; phase < maxPhases && state.totalWeight > 0; ++phase) {
+        colorNodes(state, input.context);
+        auto numMoves = runColoredSweeps<LeidenLocalMoveVC>(state,
+            config.maxIterations.getParamVal(), input.context);
+        if (numMoves == 0 && phase > 0) {
+            // The communities of the previous phase are already locally optimal.
+            break;
+        }
+        LeidenInitRefinementVC initRefinementVC(state);
+        InMemGDSUtils::runParallelCompute(initRefinementVC, state.getNumNodes(), input.context);
+        // A single sweep merges every singleton at most once.
+        runColoredSweeps<LeidenRefineVC>(state, 1 /* maxIterations */, input.context);
+        const auto numNodes = state.getNumNodes();
+        if (aggregate(state, nodeIDs, mm, input.context) == numNodes) {
+            // No refined community has more than one node, so aggregation changes nothing.
+            break;
+        }
+        progressBar->updateProgress(input.context->queryID,
+            static_cast<double>(phase + 1) / maxPhases);
+    }
+
+    // Number the communities sequentially in the order of their first original node.
+    vector<offset_t> communities(origNumNodes);
+    unordered_map<offset_t, offset_t> commIDs;
+    for (auto nodeID = 0u; nodeID < origNumNodes; ++nodeID) {
+        auto comm = state.comms.get(nodeIDs[nodeID], memory_order_relaxed);
+        communities[nodeID] = commIDs.emplace(comm, commIDs.size()).first->second;
+    }
+    const auto writeResultsVC = make_unique<LeidenWriteResultsVC>(mm, sharedState, communities);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *writeResultsVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char LEIDEN_ID_COLUMN_NAME[] = "leiden_id";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one edge table.");
+    }
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
+    columns.push_back(input->binder->createVariable(LEIDEN_ID_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<LeidenBindData>(std::move(columns), std::move(graphEntry), nodeOutput,
+        std::make_unique<LeidenOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set LeidenFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -3,12 +3,14 @@
 #include "common/string_utils.h"
 #include "common/task_system/progress_bar.h"
 #include "function/algo_function.h"
+#include "function/config/incremental_config.h"
 #include "function/config/max_iterations_config.h"
 #include "function/config/page_rank_config.h"
 #include "function/degrees.h"
 #include "function/gds/gds_utils.h"
 #include "function/gds/gds_vertex_compute.h"
 #include "function/table/bind_input.h"
+#include "graph/graph_result_cache.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -26,26 +28,29 @@ struct PageRankOptionalParams final : public MaxIterationOptionalParams {
     OptionalParam<DampingFactor> dampingFactor;
     OptionalParam<Tolerance> tolerance;
     OptionalParam<NormalizeInitial> normalize;
+    OptionalParam<Incremental> incremental;
 
     explicit PageRankOptionalParams(const expression_vector& optionalParams);
 
     // For copy only
     PageRankOptionalParams(OptionalParam<MaxIterations> maxIterations,
         OptionalParam<DampingFactor> dampingFactor, OptionalParam<Tolerance> tolerance,
-        OptionalParam<NormalizeInitial> normalize)
+        OptionalParam<NormalizeInitial> normalize, OptionalParam<Incremental> incremental)
         : MaxIterationOptionalParams{maxIterations}, dampingFactor{std::move(dampingFactor)},
-          tolerance{std::move(tolerance)}, normalize{std::move(normalize)} {}
+          tolerance{std::move(tolerance)}, normalize{std::move(normalize)},
+          incremental{std::move(incremental)} {}
 
     void evaluateParams(main::ClientContext* context) override {
         MaxIterationOptionalParams::evaluateParams(context);
         dampingFactor.evaluateParam(context);
         tolerance.evaluateParam(context);
         normalize.evaluateParam(context);
+        incremental.evaluateParam(context);
     }
 
     std::unique_ptr<function::OptionalParams> copy() override {
         return std::make_unique<PageRankOptionalParams>(maxIterations, dampingFactor, tolerance,
-            normalize);
+            normalize, incremental);
     }
 };
 
@@ -61,6 +66,8 @@ PageRankOptionalParams::PageRankOptionalParams(const expression_vector& optional
             tolerance = function::OptionalParam<Tolerance>(optionalParam);
         } else if (paramName == NormalizeInitial::NAME) {
             normalize = function::OptionalParam<NormalizeInitial>(optionalParam);
+        } else if (paramName == Incremental::NAME) {
+            incremental = function::OptionalParam<Incremental>(optionalParam);
         } else {
             throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
         }
@@ -247,8 +254,7 @@ public:
             if (skip(i)) {
                 continue;
             }
-            auto nodeID = nodeID_t{i, tableID};
-            nodeIDVector->setValue<nodeID_t>(0, nodeID);
+            nodeIDVector->setValue<nodeID_t>(0, getOutputNodeID(i, tableID));
             rankVector->setValue<double>(0, pNext.getValue(i));
             localFT->append(vectors);
         }
@@ -264,19 +270,61 @@ private:
     std::unique_ptr<ValueVector> rankVector;
 };
 
+// Any ranks converge to the same result, so an incremental call starts from the ranks of the
+// previous one, which are close to the result if the graph changed little since.
+struct PageRankCachedResult final : CachedGraphResult {
+    double dampingFactor;
+    bool normalizeInitial;
+    table_id_map_t<std::vector<double>> ranks;
+
+    PageRankCachedResult(transaction_t snapshotTS, double dampingFactor, bool normalizeInitial)
+        : CachedGraphResult{snapshotTS}, dampingFactor{dampingFactor},
+          normalizeInitial{normalizeInitial} {}
+
+    bool canSeed(const PageRankOptionalParams& config,
+        const table_id_map_t<offset_t>& maxOffsetMap) const {
+        if (dampingFactor != config.dampingFactor.getParamVal() ||
+            normalizeInitial != config.normalize.getParamVal()) {
+            return false;
+        }
+        return std::all_of(maxOffsetMap.begin(), maxOffsetMap.end(), [&](const auto& entry) {
+            return ranks.contains(entry.first) && ranks.at(entry.first).size() == entry.second;
+        });
+    }
+};
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto clientContext = input.context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
     auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
     auto graph = sharedState->graph.get();
-    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
-    auto numNodes = graph->getNumNodes(transaction);
     auto pageRankBindData = input.bindData->constPtrCast<PageRankBindData>();
     auto& config = pageRankBindData->optionalParams->constCast<PageRankOptionalParams>();
+    // Cached ranks are kept by original node offsets.
+    auto resultCache = config.incremental.getParamVal() ? graph->getGraphEntry()->resultCache :
+                                                          nullptr;
+    if (resultCache == nullptr) {
+        graph->relabelNodes();
+    }
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    auto numNodes = graph->getNumNodes(transaction);
     auto initialValue = config.normalize.getParamVal() ? (double)1 / numNodes : (double)1;
     auto mm = MemoryManager::Get(*clientContext);
     auto p1 = PValues(maxOffsetMap, mm, initialValue);
     auto p2 = PValues(maxOffsetMap, mm, 0);
+    if (resultCache != nullptr) {
+        auto cachedResult = resultCache->getResult(PageRankFunction::name);
+        if (cachedResult != nullptr &&
+            cachedResult->constPtrCast<PageRankCachedResult>()->canSeed(config, maxOffsetMap)) {
+            for (auto& [tableID, ranks] :
+                cachedResult->constPtrCast<PageRankCachedResult>()->ranks) {
+                p1.pinTable(tableID);
+                for (auto i = 0u; i < ranks.size(); i++) {
+                    p1.setValue(i, ranks[i]);
+                }
+            }
+        }
+    }
     PValues* pCurrent = &p1;
     PValues* pNext = &p2;
     auto currentIter = 1u;
@@ -316,6 +364,19 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, progress);
         currentIter++;
     }
+    if (resultCache != nullptr) {
+        auto result = std::make_shared<PageRankCachedResult>(transaction->getStartTS(),
+            config.dampingFactor.getParamVal(), config.normalize.getParamVal());
+        for (auto& [tableID, maxOffset] : maxOffsetMap) {
+            auto& ranks = result->ranks[tableID];
+            ranks.resize(maxOffset);
+            pCurrent->pinTable(tableID);
+            for (auto i = 0u; i < maxOffset; i++) {
+                ranks[i] = pCurrent->getValue(i);
+            }
+        }
+        resultCache->setResult(PageRankFunction::name, std::move(result));
+    }
     auto outputVC = std::make_unique<PageRankResultVertexCompute>(mm, sharedState, *pCurrent);
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *outputVC);
     sharedState->factorizedTablePool.mergeLocalTables();
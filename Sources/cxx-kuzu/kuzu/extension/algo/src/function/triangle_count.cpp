@@ -0,0 +1,309 @@
+#include "common/in_mem_gds_utils.h"
+#include "common/sorted_adjacency_graph.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Triangle counting (Schank and Wagner, "Finding, counting and listing all triangles in large
+// graphs", 2005). Each undirected edge is oriented from the lower ranked to the higher ranked node,
+// where nodes are ranked by (degree, offset). Every triangle {u, v, w} with rank(u) < rank(v) <
+// rank(w) is then found exactly once, as w in the intersection of the out-neighbors of u and v,
+// and the out-degree of every node is at most O(sqrt(m)), which bounds the cost of high degree
+// nodes.
+
+namespace kuzu {
+namespace algo_extension {
+
+static bool isLowerRanked(const SortedAdjacencyGraph& graph, offset_t nodeID, offset_t otherID) {
+    auto degree = graph.getDegree(nodeID);
+    auto otherDegree = graph.getDegree(otherID);
+    return degree < otherDegree || (degree == otherDegree && nodeID < otherID);
+}
+
+// Counts the out-degree of each node of the oriented graph.
+class CountOutNbrsVC final : public InMemParallelCompute {
+public:
+    CountOutNbrsVC(const SortedAdjacencyGraph& graph, SortedAdjacencyGraph& orientedGraph)
+        : graph{graph}, orientedGraph{orientedGraph} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            offset_t numOutNbrs = 0;
+            for (auto nbrID : graph.getNbrs(nodeID)) {
+                numOutNbrs += isLowerRanked(graph, nodeID, nbrID);
+            }
+            orientedGraph.csrOffsets[nodeID + 1] = numOutNbrs;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountOutNbrsVC>(graph, orientedGraph);
+    }
+
+private:
+    const SortedAdjacencyGraph& graph;
+    SortedAdjacencyGraph& orientedGraph;
+};
+
+// Fills the out-neighbors of each node, which stay sorted by offset.
+class FillOutNbrsVC final : public InMemParallelCompute {
+public:
+    FillOutNbrsVC(const SortedAdjacencyGraph& graph, SortedAdjacencyGraph& orientedGraph)
+        : graph{graph}, orientedGraph{orientedGraph} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            auto pos = orientedGraph.csrOffsets[nodeID];
+            for (auto nbrID : graph.getNbrs(nodeID)) {
+                if (isLowerRanked(graph, nodeID, nbrID)) {
+                    orientedGraph.nbrs[pos++] = nbrID;
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<FillOutNbrsVC>(graph, orientedGraph);
+    }
+
+private:
+    const SortedAdjacencyGraph& graph;
+    SortedAdjacencyGraph& orientedGraph;
+};
+
+static void orientGraph(const SortedAdjacencyGraph& graph, SortedAdjacencyGraph& orientedGraph,
+    ExecutionContext* context) {
+    const auto numNodes = graph.getNumNodes();
+    CountOutNbrsVC countOutNbrsVC(graph, orientedGraph);
+    InMemGDSUtils::runParallelCompute(countOutNbrsVC, numNodes, context);
+    orientedGraph.csrOffsets[0] = 0;
+    for (auto nodeID = 0u; nodeID < numNodes; ++nodeID) {
+        orientedGraph.csrOffsets[nodeID + 1] += orientedGraph.csrOffsets[nodeID];
+    }
+    orientedGraph.nbrs.resize(orientedGraph.csrOffsets[numNodes]);
+    FillOutNbrsVC fillOutNbrsVC(graph, orientedGraph);
+    InMemGDSUtils::runParallelCompute(fillOutNbrsVC, numNodes, context);
+}
+
+// Merging is linear in the sum of the list sizes, so when one list is much shorter, each of its
+// values is searched in the longer list with galloping (exponential) search instead.
+static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+
+static const offset_t* gallop(const offset_t* begin, const offset_t* end, offset_t value) {
+    uint64_t step = 1;
+    while (begin + step < end && begin[step] < value) {
+        begin += step;
+        step *= 2;
+    }
+    return std::lower_bound(begin, begin + std::min<uint64_t>(step + 1, end - begin), value);
+}
+
+// Calls func(value) for each value in both sorted lists.
+template<typename FUNC>
+static void intersect(std::span<const offset_t> left, std::span<const offset_t> right,
+    FUNC func) {
+    if (left.size() > right.size()) {
+        std::swap(left, right);
+    }
+    if (left.empty()) {
+        return;
+    }
+    auto rightIt = right.data();
+    const auto rightEnd = right.data() + right.size();
+    if (left.size() * GALLOPING_SIZE_RATIO < right.size()) {
+        for (auto value : left) {
+            rightIt = gallop(rightIt, rightEnd, value);
+            if (rightIt == rightEnd) {
+                return;
+            }
+            if (*rightIt == value) {
+                func(value);
+            }
+        }
+        return;
+    }
+    auto leftIt = left.data();
+    const auto leftEnd = left.data() + left.size();
+    while (leftIt != leftEnd && rightIt != rightEnd) {
+        if (*leftIt < *rightIt) {
+            leftIt++;
+        } else if (*rightIt < *leftIt) {
+            rightIt++;
+        } else {
+            func(*leftIt);
+            leftIt++;
+            rightIt++;
+        }
+    }
+}
+
+// Adds each triangle found from the node to the triangle counts of its three nodes.
+class CountTrianglesVC final : public InMemParallelCompute {
+public:
+    CountTrianglesVC(const SortedAdjacencyGraph& orientedGraph,
+        AtomicObjectArray<uint64_t>& triangleCounts)
+        : orientedGraph{orientedGraph}, triangleCounts{triangleCounts} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeID = startOffset; nodeID < endOffset; ++nodeID) {
+            auto outNbrs = orientedGraph.getNbrs(nodeID);
+            uint64_t numNodeTriangles = 0;
+            for (auto nbrID : outNbrs) {
+                uint64_t numEdgeTriangles = 0;
+                intersect(outNbrs, orientedGraph.getNbrs(nbrID), [&](offset_t thirdID) {
+                    triangleCounts.fetchAdd(thirdID, 1, std::memory_order_relaxed);
+                    numEdgeTriangles++;
+                });
+                if (numEdgeTriangles > 0) {
+                    triangleCounts.fetchAdd(nbrID, numEdgeTriangles, std::memory_order_relaxed);
+                    numNodeTriangles += numEdgeTriangles;
+                }
+            }
+            if (numNodeTriangles > 0) {
+                triangleCounts.fetchAdd(nodeID, numNodeTriangles, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountTrianglesVC>(orientedGraph, triangleCounts);
+    }
+
+private:
+    const SortedAdjacencyGraph& orientedGraph;
+    AtomicObjectArray<uint64_t>& triangleCounts;
+};
+
+class TriangleResultsVC final : public GDSResultVertexCompute {
+public:
+    TriangleResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const SortedAdjacencyGraph& graph, AtomicObjectArray<uint64_t>& triangleCounts,
+        bool outputCoefficient)
+        : GDSResultVertexCompute{mm, sharedState}, graph{graph}, triangleCounts{triangleCounts},
+          outputCoefficient{outputCoefficient} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        valueVector =
+            createVector(outputCoefficient ? LogicalType::DOUBLE() : LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            auto numTriangles = triangleCounts.get(i, std::memory_order_relaxed);
+            if (outputCoefficient) {
+                // Fraction of the pairs of neighbors that are connected.
+                auto degree = static_cast<double>(graph.getDegree(i));
+                valueVector->setValue<double>(0,
+                    degree < 2 ? 0 : 2.0 * numTriangles / (degree * (degree - 1)));
+            } else {
+                valueVector->setValue<int64_t>(0, numTriangles);
+            }
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleResultsVC>(mm, sharedState, graph, triangleCounts,
+            outputCoefficient);
+    }
+
+private:
+    const SortedAdjacencyGraph& graph;
+    AtomicObjectArray<uint64_t>& triangleCounts;
+    bool outputCoefficient;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+};
+
+static offset_t runTriangleCount(const TableFuncInput& input, bool outputCoefficient) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto numNodes = graph->getMaxOffset(transaction, tableID);
+
+    SortedAdjacencyGraph adjGraph(numNodes, mm);
+    adjGraph.init(graph, tableID);
+    auto progressBar = ProgressBar::Get(*clientContext);
+    progressBar->updateProgress(input.context->queryID, 0.5);
+    SortedAdjacencyGraph orientedGraph(numNodes, mm);
+    orientGraph(adjGraph, orientedGraph, input.context);
+    AtomicObjectArray<uint64_t> triangleCounts(numNodes, mm, true /* initializeToZero */);
+    CountTrianglesVC countTrianglesVC(orientedGraph, triangleCounts);
+    InMemGDSUtils::runParallelCompute(countTrianglesVC, numNodes, input.context);
+    progressBar->updateProgress(input.context->queryID, 1);
+
+    auto resultsVC =
+        TriangleResultsVC(mm, sharedState, adjGraph, triangleCounts, outputCoefficient);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, resultsVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static offset_t triangleCountTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    return runTriangleCount(input, false /* outputCoefficient */);
+}
+
+static offset_t localClusteringCoefficientTableFunc(const TableFuncInput& input,
+    TableFuncOutput&) {
+    return runTriangleCount(input, true /* outputCoefficient */);
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME[] = "local_clustering_coefficient";
+
+static std::unique_ptr<TableFuncBindData> triangleCountBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto bindResult = SortedAdjacencyGraphUtils::bind(context, input, "Triangle count",
+        TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64());
+    return std::make_unique<GDSBindData>(std::move(bindResult.columns),
+        std::move(bindResult.graphEntry), expression_vector{bindResult.nodeOutput});
+}
+
+static std::unique_ptr<TableFuncBindData> localClusteringCoefficientBindFunc(
+    main::ClientContext* context, const TableFuncBindInput* input) {
+    auto bindResult = SortedAdjacencyGraphUtils::bind(context, input,
+        "Local clustering coefficient", LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME,
+        LogicalType::DOUBLE());
+    return std::make_unique<GDSBindData>(std::move(bindResult.columns),
+        std::move(bindResult.graphEntry), expression_vector{bindResult.nodeOutput});
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(SortedAdjacencyGraphUtils::getTableFunction(name, triangleCountBindFunc,
+        triangleCountTableFunc));
+    return result;
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(SortedAdjacencyGraphUtils::getTableFunction(name,
+        localClusteringCoefficientBindFunc, localClusteringCoefficientTableFunc));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -1,10 +1,15 @@
 #include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "function/algo_function.h"
 #include "function/component_ids.h"
 #include "function/config/connected_components_config.h"
+#include "function/config/incremental_config.h"
 #include "function/config/max_iterations_config.h"
 #include "function/gds/gds_utils.h"
 #include "function/table/bind_input.h"
+#include "graph/graph_result_cache.h"
+#include "graph/graph_snapshot.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -18,6 +23,74 @@ using namespace kuzu::function;
 namespace kuzu {
 namespace algo_extension {
 
+struct WCCOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<Incremental> incremental;
+
+    explicit WCCOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    WCCOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<Incremental> incremental)
+        : MaxIterationOptionalParams{std::move(maxIterations)},
+          incremental{std::move(incremental)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        incremental.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<WCCOptionalParams>(maxIterations, incremental);
+    }
+};
+
+WCCOptionalParams::WCCOptionalParams(const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == MaxIterations::NAME) {
+            continue;
+        } else if (paramName == Incremental::NAME) {
+            incremental = function::OptionalParam<Incremental>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+// Adding rels only merges components, so the component IDs of the previous incremental call are
+// brought up to date by propagating from the nodes touched since. Removing rels can split
+// components, which needs a computation from scratch.
+struct WCCCachedResult final : CachedGraphResult {
+    table_id_map_t<std::vector<offset_t>> componentIDs;
+
+    explicit WCCCachedResult(transaction_t snapshotTS) : CachedGraphResult{snapshotTS} {}
+};
+
+// Returns whether the cached result can be updated to the current snapshot. If so, delta is set to
+// the changes to propagate from, or to nullptr if the result was computed on the current snapshot.
+static bool canUpdate(const WCCCachedResult& result, const NativeGraphEntry& graphEntry,
+    const transaction::Transaction* transaction, const table_id_map_t<offset_t>& maxOffsetMap,
+    const GraphSnapshotDelta*& delta) {
+    delta = nullptr;
+    auto& snapshot = graphEntry.snapshot;
+    if (snapshot == nullptr || !snapshot->canBeReadBy(transaction)) {
+        return false;
+    }
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        if (!result.componentIDs.contains(tableID) ||
+            result.componentIDs.at(tableID).size() != maxOffset) {
+            return false;
+        }
+    }
+    if (result.snapshotTS == snapshot->getSnapshotTS()) {
+        return true;
+    }
+    delta = snapshot->getDelta();
+    return delta != nullptr && delta->previousSnapshotTS == result.snapshotTS &&
+           !delta->hasRemovedRels;
+}
+
 class WCCAuxiliaryState : public GDSAuxiliaryState {
 public:
     explicit WCCAuxiliaryState(ComponentIDsPair& componentIDsPair)
@@ -63,16 +136,57 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto clientContext = input.context->clientContext;
     auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
     auto graph = sharedState->graph.get();
-    auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto nextFrontier =
-        DenseFrontier::getVisitedFrontier(input.context, graph, sharedState->getGraphNodeMaskMap());
-    auto frontierPair =
-        std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
-    frontierPair->setActiveNodesForNextIter();
-    auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext));
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto& config = input.bindData->optionalParams->constCast<WCCOptionalParams>();
+    // Cached component IDs are kept by original node offsets, and assume the graph is not masked.
+    auto resultCache = config.incremental.getParamVal() &&
+                               sharedState->getGraphNodeMaskMap() == nullptr ?
+                           graph->getGraphEntry()->resultCache :
+                           nullptr;
+    if (resultCache == nullptr) {
+        // Component IDs are then the smallest relabeled offset in the component instead.
+        graph->relabelNodes();
+    }
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
     auto offsetManager = OffsetManager(maxOffsetMap);
     auto mm = MemoryManager::Get(*clientContext);
     auto componentIDs = ComponentIDs::getSequenceComponentIDs(maxOffsetMap, offsetManager, mm);
+    auto cachedResult = resultCache != nullptr ? resultCache->getResult(
+                                                     WeaklyConnectedComponentsFunction::name) :
+                                                 nullptr;
+    const GraphSnapshotDelta* delta = nullptr;
+    auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+    std::unique_ptr<DenseFrontier> nextFrontier;
+    auto hasActiveNodes = true;
+    if (cachedResult != nullptr &&
+        canUpdate(*cachedResult->constPtrCast<WCCCachedResult>(), *graph->getGraphEntry(),
+            transaction, maxOffsetMap, delta)) {
+        for (auto& [tableID, tableComponentIDs] :
+            cachedResult->constPtrCast<WCCCachedResult>()->componentIDs) {
+            componentIDs.pinTableID(tableID);
+            for (auto i = 0u; i < tableComponentIDs.size(); i++) {
+                componentIDs.setComponentID(i, tableComponentIDs[i]);
+            }
+        }
+        nextFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+        hasActiveNodes = delta != nullptr && delta->getNumTouchedNodes() > 0;
+        if (hasActiveNodes) {
+            for (auto& [tableID, offsets] : delta->touchedNodes) {
+                nextFrontier->pinTableID(tableID);
+                for (auto offset : offsets) {
+                    nextFrontier->addNode(offset, FRONTIER_INITIAL_VISITED);
+                }
+            }
+        }
+    } else {
+        nextFrontier = DenseFrontier::getVisitedFrontier(input.context, graph,
+            sharedState->getGraphNodeMaskMap());
+    }
+    auto frontierPair =
+        std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
+    if (hasActiveNodes) {
+        frontierPair->setActiveNodesForNextIter();
+    }
     auto componentIDsPair = ComponentIDsPair(componentIDs);
     auto auxiliaryState = std::make_unique<WCCAuxiliaryState>(componentIDsPair);
     auto edgeCompute = std::make_unique<WCCEdgeCompute>(componentIDsPair);
@@ -80,10 +194,22 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         std::make_unique<ComponentIDsOutputVertexCompute>(mm, sharedState, componentIDs);
     auto computeState =
         GDSComputeState(std::move(frontierPair), std::move(edgeCompute), std::move(auxiliaryState));
-    auto maxIterations = input.bindData->optionalParams->constCast<MaxIterationOptionalParams>()
-                             .maxIterations.getParamVal();
     GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, ExtendDirection::BOTH,
-        maxIterations);
+        config.maxIterations.getParamVal());
+    // Component IDs cut off by the max iterations are not final and can't be updated from.
+    auto converged = !computeState.frontierPair->continueNextIter(UINT16_MAX);
+    if (resultCache != nullptr && converged) {
+        auto result = std::make_shared<WCCCachedResult>(transaction->getStartTS());
+        for (auto& [tableID, maxOffset] : maxOffsetMap) {
+            auto& tableComponentIDs = result->componentIDs[tableID];
+            tableComponentIDs.resize(maxOffset);
+            componentIDs.pinTableID(tableID);
+            for (auto i = 0u; i < maxOffset; i++) {
+                tableComponentIDs[i] = componentIDs.getComponentID(i);
+            }
+        }
+        resultCache->setResult(WeaklyConnectedComponentsFunction::name, std::move(result));
+    }
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *vertexCompute);
     sharedState->factorizedTablePool.mergeLocalTables();
     return 0;
@@ -100,7 +226,7 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     auto bindData = std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
         expression_vector{nodeOutput});
     bindData->optionalParams =
-        std::make_unique<MaxIterationOptionalParams>(input->optionalParamsLegacy);
+        std::make_unique<WCCOptionalParams>(input->optionalParamsLegacy);
     return bindData;
 }
 
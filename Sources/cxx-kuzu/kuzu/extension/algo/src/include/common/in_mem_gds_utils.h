@@ -63,6 +63,14 @@ public:
     static void runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
         processor::ExecutionContext* context,
         std::optional<common::table_id_t> tableId = std::nullopt);
+    // Runs the compute in morsels of the given size instead of the default frontier morsel size.
+    static void runParallelCompute(InMemParallelCompute& vc, common::offset_t maxOffset,
+        uint64_t morselSize, processor::ExecutionContext* context);
+
+private:
+    static void runParallelComputeInternal(InMemParallelCompute& vc, common::offset_t maxOffset,
+        std::optional<uint64_t> morselSize, processor::ExecutionContext* context,
+        std::optional<common::table_id_t> tableId);
 };
 
 } // namespace algo_extension
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <span>
+
+#include "common/copy_constructors.h"
+#include "common/types/types.h"
+#include "function/gds/gds.h"
+#include "function/gds/gds_object_manager.h"
+#include "function/table/table_function.h"
+#include "graph/graph.h"
+
+namespace kuzu {
+namespace algo_extension {
+
+// CSR representation of an unweighted undirected graph without self-loops and parallel edges, where
+// the neighbors of each node are sorted by offset.
+struct SortedAdjacencyGraph {
+    function::ku_vector_t<common::offset_t> csrOffsets;
+    function::ku_vector_t<common::offset_t> nbrs;
+
+    SortedAdjacencyGraph(const common::offset_t numNodes, storage::MemoryManager* mm)
+        : csrOffsets{mm, numNodes + 1}, nbrs{mm}, mm{mm} {}
+    DELETE_BOTH_COPY(SortedAdjacencyGraph);
+
+    // Loads the rels of the table in both directions, where the rel table connects the node table
+    // to itself.
+    void init(graph::Graph* graph, common::table_id_t tableID);
+
+    common::offset_t getNumNodes() const { return csrOffsets.size() - 1; }
+    common::offset_t getDegree(common::offset_t nodeID) const {
+        return csrOffsets[nodeID + 1] - csrOffsets[nodeID];
+    }
+    std::span<const common::offset_t> getNbrs(common::offset_t nodeID) const {
+        return std::span{nbrs.begin() + csrOffsets[nodeID], getDegree(nodeID)};
+    }
+
+private:
+    storage::MemoryManager* mm;
+};
+
+// Bound graph and output columns (the internal ID of the node and one value) of a function that
+// runs on the sorted adjacency graph of one node table and one rel table.
+struct SortedAdjacencyGraphBindResult {
+    graph::NativeGraphEntry graphEntry;
+    std::shared_ptr<binder::Expression> nodeOutput;
+    binder::expression_vector columns;
+};
+
+struct SortedAdjacencyGraphUtils {
+    static SortedAdjacencyGraphBindResult bind(main::ClientContext* context,
+        const function::TableFuncBindInput* input, const std::string& functionName,
+        const std::string& columnName, common::LogicalType columnType);
+
+    static std::unique_ptr<function::TableFunction> getTableFunction(const char* name,
+        function::table_func_bind_t bindFunc, function::table_func_t tableFunc);
+};
+
+} // namespace algo_extension
+} // namespace kuzu
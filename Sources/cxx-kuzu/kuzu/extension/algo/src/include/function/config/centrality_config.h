@@ -0,0 +1,31 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace algo_extension {
+
+// The number of source nodes sampled to approximate the centrality. If 0 or at least the number of
+// nodes, all nodes are sources and the centrality is exact.
+struct SampleSize {
+    static constexpr const char* NAME = "samplesize";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+
+    static void validate(int64_t sampleSize) {
+        if (sampleSize < 0) {
+            throw common::BinderException{"samplesize must be a non-negative integer."};
+        }
+    }
+};
+
+// The seed of the random sampling of source nodes.
+struct SampleSeed {
+    static constexpr const char* NAME = "seed";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+};
+
+} // namespace algo_extension
+} // namespace kuzu
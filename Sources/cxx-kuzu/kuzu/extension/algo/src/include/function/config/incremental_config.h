@@ -0,0 +1,17 @@
+#pragma once
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace algo_extension {
+
+// If true, the algorithm starts from the result of its previous incremental call on the projected
+// graph where possible, and keeps its result for the next call.
+struct Incremental {
+    static constexpr const char* NAME = "incremental";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+} // namespace algo_extension
+} // namespace kuzu
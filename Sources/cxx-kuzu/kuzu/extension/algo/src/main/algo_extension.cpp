@@ -21,6 +21,11 @@ void AlgoExtension::load(main::ClientContext* context) {
     ExtensionUtils::addTableFunc<KCoreDecompositionFunction>(db);
     ExtensionUtils::addTableFuncAlias<KCoreDecompositionAliasFunction>(db);
     ExtensionUtils::addTableFunc<LouvainFunction>(db);
+    ExtensionUtils::addTableFunc<LeidenFunction>(db);
+    ExtensionUtils::addTableFunc<TriangleCountFunction>(db);
+    ExtensionUtils::addTableFunc<LocalClusteringCoefficientFunction>(db);
+    ExtensionUtils::addTableFunc<BetweennessCentralityFunction>(db);
+    ExtensionUtils::addTableFunc<ClosenessCentralityFunction>(db);
     ExtensionUtils::addTableFunc<SpanningForest>(db);
     ExtensionUtils::addTableFuncAlias<SpanningForestAliasFunction>(db);
 }
@@ -1,5 +1,9 @@
 #include "function/delta_scan.h"
 
+#include "common/exception/runtime.h"
+#include "common/string_utils.h"
+#include "function/duckdb_scan.h"
+
 namespace kuzu {
 namespace delta_extension {
 
@@ -9,21 +13,20 @@ using namespace common;
 static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     const TableFuncBindInput* input) {
     auto scanInput = input->extraInput->constPtrCast<ExtraScanTableFuncBindInput>();
-    auto connector = std::make_shared<DeltaConnector>();
-    connector->connect("" /* inMemDB */, "" /* defaultCatalogName */, "" /* defaultSchemaName */,
-        context);
+    auto connector = duckdb_extension::DuckDBConnector::getSharedConnector<DeltaConnector>(context);
     std::string query =
         stringFormat("SELECT * FROM DELTA_SCAN('{}')", input->getLiteralVal<std::string>(0));
-    auto result = connector->executeQuery(query + " LIMIT 1");
+    // Binding reads the log of the table but none of its data files.
+    auto result = connector->prepareQuery(query);
     std::vector<LogicalType> returnTypes;
     std::vector<std::string> returnColumnNames = scanInput->expectedColumnNames;
-    for (auto type : result->types) {
+    for (auto& type : result->GetTypes()) {
         returnTypes.push_back(
             duckdb_extension::DuckDBTypeConverter::convertDuckDBType(type.ToString()));
     }
 
     if (scanInput->expectedColumnNames.empty()) {
-        for (auto name : result->names) {
+        for (auto& name : result->GetNames()) {
             returnColumnNames.push_back(name);
         }
     }
@@ -31,32 +34,54 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     returnColumnNames =
         TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
     auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
-    return std::make_unique<DeltaScanBindData>(std::move(query), connector,
-        duckdb_extension::DuckDBResultConverter{returnTypes}, columns, context);
+    std::vector<std::string> columnNamesInDuckDB = result->GetNames();
+    return std::make_unique<DeltaScanBindData>(std::move(query), std::move(columnNamesInDuckDB),
+        connector, duckdb_extension::DuckDBResultConverter{returnTypes}, columns, context);
+}
+
+std::string DeltaScanBindData::getQueryWithPushDowns() const {
+    auto columnSkips = getColumnSkips();
+    std::string columnsToSelect;
+    for (auto i = 0u; i < columnNamesInDuckDB.size(); i++) {
+        if (columnSkips[i]) {
+            continue;
+        }
+        auto columnName = columnNamesInDuckDB[i];
+        StringUtils::replaceAll(columnName, "\"", "\"\"");
+        columnsToSelect += columnsToSelect.empty() ? "" : ",";
+        columnsToSelect += "\"" + columnName + "\"";
+    }
+    if (columnsToSelect.empty()) {
+        // The number of rows is still needed.
+        columnsToSelect = "1";
+    }
+    return stringFormat("SELECT {} FROM ({})", columnsToSelect, query) +
+           duckdb_extension::getPushedDownPredicates(*this, columnNamesInDuckDB);
 }
 
 std::unique_ptr<TableFuncSharedState> initDeltaScanSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto deltaScanBindData = input.bindData->constPtrCast<DeltaScanBindData>();
-    auto queryResult = deltaScanBindData->connector->executeQuery(deltaScanBindData->query);
-    return std::make_unique<duckdb_extension::DuckDBScanSharedState>(std::move(queryResult));
+    // The connector is shared by concurrent queries, which would be serialized on one connection.
+    auto connection = deltaScanBindData->connector->createConnection();
+    auto queryResult = connection->Query(deltaScanBindData->getQueryWithPushDowns());
+    if (queryResult->HasError()) {
+        throw RuntimeException(
+            stringFormat("Failed to execute query due to error: {}", queryResult->GetError()));
+    }
+    return std::make_unique<duckdb_extension::DuckDBScanSharedState>(
+        queryResult->TakeCollection());
 }
 
 offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     auto sharedState = input.sharedState->ptrCast<duckdb_extension::DuckDBScanSharedState>();
     auto deltaScanBindData = input.bindData->constPtrCast<DeltaScanBindData>();
-    std::unique_ptr<duckdb::DataChunk> result;
-    try {
-        // Duckdb queryResult.fetch() is not thread safe, we have to acquire a lock there.
-        std::lock_guard lock{sharedState->mtx};
-        result = sharedState->queryResult->Fetch();
-    } catch (std::exception& e) {
-        return 0;
-    }
+    auto result = sharedState->fetch();
     if (result == nullptr) {
         return 0;
     }
-    deltaScanBindData->converter.convertDuckDBResultToVector(*result, output.dataChunk);
+    deltaScanBindData->converter.convertDuckDBResultToVector(*result, output.dataChunk,
+        deltaScanBindData->getColumnSkips());
     return output.dataChunk.state->getSelVector().getSelSize();
 }
 
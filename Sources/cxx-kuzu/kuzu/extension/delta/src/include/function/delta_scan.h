@@ -17,18 +17,24 @@ struct DeltaScanFunction {
 };
 
 struct DeltaScanBindData final : function::ScanFileBindData {
+    // Query scanning all columns of the table.
     std::string query;
+    std::vector<std::string> columnNamesInDuckDB;
     std::shared_ptr<duckdb_extension::DuckDBConnector> connector;
     duckdb_extension::DuckDBResultConverter converter;
 
-    DeltaScanBindData(std::string query,
+    DeltaScanBindData(std::string query, std::vector<std::string> columnNamesInDuckDB,
         std::shared_ptr<duckdb_extension::DuckDBConnector> connector,
         duckdb_extension::DuckDBResultConverter converter, binder::expression_vector columns,
         main::ClientContext* context)
         : function::ScanFileBindData{std::move(columns), 0 /* numRows */, common::FileScanInfo{},
               context},
-          query{std::move(query)}, connector{std::move(connector)},
-          converter{std::move(converter)} {}
+          query{std::move(query)}, columnNamesInDuckDB{std::move(columnNamesInDuckDB)},
+          connector{std::move(connector)}, converter{std::move(converter)} {}
+
+    // Selects only the columns in use and filters by the pushed down predicates, so that DuckDB
+    // can skip the files and row groups that are not needed.
+    std::string getQueryWithPushDowns() const;
 
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<DeltaScanBindData>(*this);
@@ -32,6 +32,8 @@ DuckDBCatalog::DuckDBCatalog(std::string dbPath, std::string catalogName,
 }
 
 void DuckDBCatalog::init() {
+    // Cached rows may be stale once the tables of the attached database are reloaded.
+    connector.clearResultCache();
     auto query = common::stringFormat(
         "select table_name from information_schema.tables where table_catalog = '{}' and "
         "table_schema = '{}' order by table_name;",
@@ -1,5 +1,8 @@
 #include "connector/duckdb_connector.h"
 
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+
 namespace kuzu {
 namespace duckdb_extension {
 
@@ -13,5 +16,40 @@ std::unique_ptr<duckdb::MaterializedQueryResult> DuckDBConnector::executeQuery(
     return result;
 }
 
+std::shared_ptr<duckdb::ColumnDataCollection> DuckDBConnector::executeCachedQuery(
+    const std::string& query, duckdb::Connection* queryConnection,
+    main::ClientContext& context) const {
+    KU_ASSERT(instance != nullptr && connection != nullptr);
+    auto ttl = context.getCurrentSetting(DuckDBResultCacheConfig::RESULT_CACHE_TTL_OPTION)
+                   .getValue<int64_t>();
+    if (ttl > 0) {
+        if (auto rows = resultCache.lookup(query, std::chrono::seconds(ttl))) {
+            return rows;
+        }
+    }
+    auto result = (queryConnection == nullptr ? connection.get() : queryConnection)->Query(query);
+    if (result->HasError()) {
+        throw common::RuntimeException(
+            common::stringFormat("Failed to execute query due to error: {}", result->GetError()));
+    }
+    std::shared_ptr<duckdb::ColumnDataCollection> rows = result->TakeCollection();
+    if (ttl > 0) {
+        auto capacity =
+            context.getCurrentSetting(DuckDBResultCacheConfig::RESULT_CACHE_SIZE_OPTION)
+                .getValue<int64_t>();
+        resultCache.insert(query, rows, std::max<int64_t>(capacity, 0));
+    }
+    return rows;
+}
+
+std::unique_ptr<duckdb::PreparedStatement> DuckDBConnector::prepareQuery(std::string query) const {
+    KU_ASSERT(instance != nullptr && connection != nullptr);
+    auto preparedStatement = connection->Prepare(query);
+    if (preparedStatement->HasError()) {
+        throw common::Exception{preparedStatement->GetError()};
+    }
+    return preparedStatement;
+}
+
 } // namespace duckdb_extension
 } // namespace kuzu
@@ -0,0 +1,65 @@
+#include "connector/duckdb_result_cache.h"
+
+#include "common/types/types.h"
+#include "common/types/value/value.h"
+#include "main/database.h"
+
+namespace kuzu {
+namespace duckdb_extension {
+
+void DuckDBResultCacheConfig::registerExtensionOptions(main::Database& db) {
+    db.addExtensionOption(RESULT_CACHE_TTL_OPTION, common::LogicalTypeID::INT64,
+        common::Value{DEFAULT_RESULT_CACHE_TTL});
+    db.addExtensionOption(RESULT_CACHE_SIZE_OPTION, common::LogicalTypeID::INT64,
+        common::Value{DEFAULT_RESULT_CACHE_SIZE});
+}
+
+std::shared_ptr<duckdb::ColumnDataCollection> DuckDBResultCache::lookup(const std::string& query,
+    std::chrono::seconds ttl) {
+    std::unique_lock lck{mtx};
+    auto it = entryMap.find(query);
+    if (it == entryMap.end()) {
+        return nullptr;
+    }
+    if (std::chrono::steady_clock::now() - it->second->insertTime > ttl) {
+        erase(it->second);
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->rows;
+}
+
+void DuckDBResultCache::insert(const std::string& query,
+    std::shared_ptr<duckdb::ColumnDataCollection> rows, uint64_t capacity) {
+    auto rowsSize = rows->SizeInBytes() + query.size();
+    if (rowsSize > capacity) {
+        // Caching the rows would evict everything else.
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (auto it = entryMap.find(query); it != entryMap.end()) {
+        erase(it->second);
+    }
+    while (size + rowsSize > capacity && !entries.empty()) {
+        erase(std::prev(entries.end()));
+    }
+    entries.push_front(Entry{query, std::move(rows), std::chrono::steady_clock::now(), rowsSize});
+    entryMap.emplace(query, entries.begin());
+    size += rowsSize;
+}
+
+void DuckDBResultCache::clear() {
+    std::unique_lock lck{mtx};
+    entries.clear();
+    entryMap.clear();
+    size = 0;
+}
+
+void DuckDBResultCache::erase(std::list<Entry>::iterator it) {
+    size -= it->size;
+    entryMap.erase(it->query);
+    entries.erase(it);
+}
+
+} // namespace duckdb_extension
+} // namespace kuzu
@@ -8,15 +8,25 @@ namespace duckdb_extension {
 
 using namespace common;
 
+// Copies the validity mask of a flat duckdb vector as a whole. DuckDB sets the bits of valid values
+// while kuzu sets the bits of nulls, so the bits are inverted.
+static void convertDuckDBValidityToNullMask(duckdb::Vector& duckDBVector, ValueVector& result,
+    uint64_t numValuesToCopy) {
+    auto& validityMask = duckdb::FlatVector::Validity(duckDBVector);
+    if (validityMask.AllValid()) {
+        result.setAllNonNull();
+        return;
+    }
+    result.setNullFromBits(validityMask.GetData(), 0 /* srcOffset */, 0 /* dstOffset */,
+        numValuesToCopy, true /* invert */);
+}
+
 template<typename T>
 void convertDuckDBVectorToVector(duckdb::Vector& duckDBVector, ValueVector& result,
     uint64_t numValuesToCopy) {
     auto duckDBData = (T*)duckDBVector.GetData();
-    auto validityMasks = duckdb::FlatVector::Validity(duckDBVector);
     memcpy(result.getData(), duckDBData, numValuesToCopy * result.getNumBytesPerValue());
-    for (auto i = 0u; i < numValuesToCopy; i++) {
-        result.setNull(i, !validityMasks.RowIsValid(i));
-    }
+    convertDuckDBValidityToNullMask(duckDBVector, result, numValuesToCopy);
 }
 
 template<>
@@ -30,11 +40,10 @@ template<>
 void convertDuckDBVectorToVector<ku_string_t>(duckdb::Vector& duckDBVector, ValueVector& result,
     uint64_t numValuesToCopy) {
     auto strs = reinterpret_cast<duckdb::string_t*>(duckDBVector.GetData());
-    auto validityMasks = duckdb::FlatVector::Validity(duckDBVector);
+    convertDuckDBValidityToNullMask(duckDBVector, result, numValuesToCopy);
     for (auto i = 0u; i < numValuesToCopy; i++) {
-        result.setNull(i, !validityMasks.RowIsValid(i));
         if (!result.isNull(i)) {
-            result.setValue(i, strs[i].GetString());
+            StringVector::addString(&result, i, strs[i].GetData(), strs[i].GetSize());
         }
     }
 }
@@ -49,14 +58,14 @@ template<>
 void convertDuckDBVectorToVector<list_entry_t>(duckdb::Vector& duckDBVector, ValueVector& result,
     uint64_t numValuesToCopy) {
     auto numValuesInDataVec = 0u;
-    auto validityMasks = duckdb::FlatVector::Validity(duckDBVector);
+    convertDuckDBValidityToNullMask(duckDBVector, result, numValuesToCopy);
     switch (duckDBVector.GetType().id()) {
     case duckdb::LogicalTypeId::ARRAY: {
         auto numValuesPerList = duckdb::ArrayType::GetSize(duckDBVector.GetType());
         numValuesInDataVec = numValuesPerList * numValuesToCopy;
+        auto listEntries = reinterpret_cast<list_entry_t*>(result.getData());
         for (auto i = 0u; i < numValuesToCopy; i++) {
-            result.setNull(i, !validityMasks.RowIsValid(i));
-            result.setValue(i, list_entry_t{numValuesPerList * i, (list_size_t)numValuesPerList});
+            listEntries[i] = list_entry_t{numValuesPerList * i, (list_size_t)numValuesPerList};
         }
     } break;
     case duckdb::LogicalTypeId::MAP:
@@ -65,7 +74,6 @@ void convertDuckDBVectorToVector<list_entry_t>(duckdb::Vector& duckDBVector, Val
             numValuesToCopy * result.getNumBytesPerValue());
         auto listEntries = reinterpret_cast<duckdb::list_entry_t*>(duckDBVector.GetData());
         for (auto i = 0u; i < numValuesToCopy; i++) {
-            result.setNull(i, !validityMasks.RowIsValid(i));
             if (!result.isNull(i)) {
                 numValuesInDataVec += listEntries[i].length;
             }
@@ -92,11 +100,11 @@ void convertDuckDBVectorToVector<struct_entry_t>(duckdb::Vector& duckDBVector, V
         // Special handling for union datatype, since duckdb stores tagId as INT8
         idx++;
         auto duckDBData = (uint8_t*)duckdbChildrenVectors[0]->GetData();
-        auto validityMasks = duckdb::FlatVector::Validity(duckDBVector);
+        auto tagVector = UnionVector::getTagVector(&result);
         for (auto i = 0u; i < numValuesToCopy; i++) {
-            UnionVector::getTagVector(&result)->setValue(i, (uint16_t)duckDBData[i]);
-            result.setNull(i, !validityMasks.RowIsValid(i));
+            tagVector->setValue(i, (uint16_t)duckDBData[i]);
         }
+        convertDuckDBValidityToNullMask(duckDBVector, result, numValuesToCopy);
     }
     for (; idx < duckdbChildrenVectors.size(); idx++) {
         duckdb_conversion_func_t conversionFunc;
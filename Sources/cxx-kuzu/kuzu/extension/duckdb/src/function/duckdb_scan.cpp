@@ -1,5 +1,8 @@
 #include "function/duckdb_scan.h"
 
+#include <algorithm>
+#include <cctype>
+
 #include "binder/binder.h"
 #include "common/exception/runtime.h"
 #include "connector/duckdb_connector.h"
@@ -30,9 +33,71 @@ std::string DuckDBScanBindData::getColumnsToSelect() const {
     return columnNames;
 }
 
-DuckDBScanSharedState::DuckDBScanSharedState(
-    std::shared_ptr<duckdb::MaterializedQueryResult> queryResult)
-    : function::TableFuncSharedState{queryResult->RowCount()}, queryResult{std::move(queryResult)} {
+static bool isPlainIdentifier(const std::string& name) {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    return std::all_of(name.begin(), name.end(),
+        [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; });
+}
+
+std::string getPushedDownPredicates(const TableFuncBindData& bindData,
+    const std::vector<std::string>& columnNamesInSource) {
+    std::string predicatesString = "";
+    auto& columnPredicates = bindData.getColumnPredicates();
+    for (auto i = 0u; i < columnPredicates.size(); i++) {
+        auto columnName = bindData.columns[i]->toString();
+        if (columnPredicates[i].isEmpty() || i >= columnNamesInSource.size() ||
+            columnName != columnNamesInSource[i] || !isPlainIdentifier(columnName)) {
+            continue;
+        }
+        if (predicatesString.empty()) {
+            predicatesString = " WHERE " + columnPredicates[i].toString();
+        } else {
+            predicatesString += stringFormat(" AND {}", columnPredicates[i].toString());
+        }
+    }
+    return predicatesString;
+}
+
+void DuckDBRowReader::init(std::shared_ptr<duckdb::ColumnDataCollection> rowsToRead) {
+    rows = std::move(rowsToRead);
+    rows->InitializeScan(scanState);
+}
+
+std::unique_ptr<duckdb::DataChunk> DuckDBRowReader::fetch() {
+    KU_ASSERT(rows != nullptr);
+    auto chunk = std::make_unique<duckdb::DataChunk>();
+    rows->InitializeScanChunk(*chunk);
+    if (!rows->Scan(scanState, *chunk)) {
+        return nullptr;
+    }
+    return chunk;
+}
+
+DuckDBScanSharedState::DuckDBScanSharedState(std::shared_ptr<duckdb::ColumnDataCollection> rows)
+    : SimpleTableFuncSharedState{rows->Count()}, minPartitionValue{0} {
+    reader.init(std::move(rows));
+}
+
+DuckDBScanSharedState::DuckDBScanSharedState(std::string partitionQuery,
+    std::string partitionColumn, int64_t minPartitionValue, row_idx_t numPartitionValues)
+    : SimpleTableFuncSharedState{numPartitionValues, PARTITION_MORSEL_SIZE},
+      partitionQuery{std::move(partitionQuery)}, partitionColumn{std::move(partitionColumn)},
+      minPartitionValue{minPartitionValue} {}
+
+std::string DuckDBScanSharedState::getMorselQuery(const TableFuncMorsel& morsel) const {
+    // The offsets are added as unsigned integers, since the range of the column might not fit in
+    // a signed one.
+    auto min = static_cast<uint64_t>(minPartitionValue);
+    auto start = static_cast<int64_t>(min + morsel.startOffset);
+    auto end = static_cast<int64_t>(min + morsel.endOffset);
+    if (morsel.endOffset == numRows) {
+        // The end of the last morsel would overflow if the column holds the largest value.
+        return partitionQuery + stringFormat("{} >= {}", partitionColumn, start);
+    }
+    return partitionQuery +
+           stringFormat("{} >= {} AND {} < {}", partitionColumn, start, partitionColumn, end);
 }
 
 struct DuckDBScanFunction {
@@ -51,46 +116,94 @@ struct DuckDBScanFunction {
         const TableFuncInitLocalStateInput& input);
 };
 
+// Returns the shared state of a scan split into ranges of the partition column, or nullptr if the
+// table doesn't have the column, e.g. if it is a view.
+static std::unique_ptr<DuckDBScanSharedState> initPartitionedSharedState(
+    const DuckDBScanBindData& bindData, const std::string& predicates,
+    main::ClientContext& context) {
+    auto partitionColumn = bindData.connector.getPartitionColumn();
+    if (partitionColumn.empty()) {
+        return nullptr;
+    }
+    std::shared_ptr<duckdb::ColumnDataCollection> result;
+    try {
+        result = bindData.connector.executeCachedQuery(
+            stringFormat(bindData.query,
+                stringFormat("CAST(min({}) AS BIGINT), CAST(max({}) AS BIGINT)", partitionColumn,
+                    partitionColumn)),
+            nullptr /* queryConnection */, context);
+    } catch (Exception&) {
+        return nullptr;
+    }
+    auto partitionQuery = stringFormat(bindData.query, bindData.getColumnsToSelect()) +
+                          (predicates.empty() ? " WHERE " : predicates + " AND ");
+    auto minValue = result->GetValue(0, 0);
+    auto maxValue = result->GetValue(1, 0);
+    if (minValue.IsNull() || maxValue.IsNull()) {
+        // The table is empty.
+        return std::make_unique<DuckDBScanSharedState>(std::move(partitionQuery),
+            std::move(partitionColumn), 0, 0);
+    }
+    auto min = minValue.GetValue<int64_t>();
+    auto max = maxValue.GetValue<int64_t>();
+    auto numValues = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+    if (numValues == 0) {
+        // The column spans the whole range of BIGINT.
+        numValues = UINT64_MAX;
+    }
+    return std::make_unique<DuckDBScanSharedState>(std::move(partitionQuery),
+        std::move(partitionColumn), min, numValues);
+}
+
 std::unique_ptr<TableFuncSharedState> DuckDBScanFunction::initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto scanBindData = input.bindData->constPtrCast<DuckDBScanBindData>();
-    auto columnNames = scanBindData->getColumnsToSelect();
-    std::string predicatesString = "";
-    for (auto& predicates : scanBindData->getColumnPredicates()) {
-        if (predicates.isEmpty()) {
-            continue;
-        }
-        if (predicatesString.empty()) {
-            predicatesString = " WHERE " + predicates.toString();
-        } else {
-            predicatesString += stringFormat(" AND {}", predicates.toString());
-        }
+    auto& context = *input.context->clientContext;
+    auto predicates = getPushedDownPredicates(*scanBindData, scanBindData->columnNamesInDuckDB);
+    if (auto sharedState = initPartitionedSharedState(*scanBindData, predicates, context)) {
+        return sharedState;
     }
-    auto finalQuery = stringFormat(scanBindData->query, columnNames) + predicatesString;
-    auto result = scanBindData->connector.executeQuery(finalQuery);
-    if (result->HasError()) {
-        throw RuntimeException(
-            stringFormat("Failed to execute query due to error: {}", result->GetError()));
-    }
-    return std::make_unique<DuckDBScanSharedState>(std::move(result));
+    auto columnNames = scanBindData->getColumnsToSelect();
+    auto finalQuery = stringFormat(scanBindData->query, columnNames) + predicates;
+    return std::make_unique<DuckDBScanSharedState>(scanBindData->connector.executeCachedQuery(
+        finalQuery, nullptr /* queryConnection */, context));
 }
 
 std::unique_ptr<TableFuncLocalState> DuckDBScanFunction::initLocalState(
     const TableFuncInitLocalStateInput&) {
-    return std::make_unique<TableFuncLocalState>();
+    return std::make_unique<DuckDBScanLocalState>();
+}
+
+static std::unique_ptr<duckdb::DataChunk> fetchPartitioned(DuckDBScanSharedState& sharedState,
+    DuckDBScanLocalState& localState, const DuckDBConnector& connector,
+    main::ClientContext& context) {
+    while (true) {
+        if (localState.reader.isInitialized()) {
+            if (auto result = localState.reader.fetch()) {
+                return result;
+            }
+            localState.reader.reset();
+        }
+        auto morsel = sharedState.getMorsel();
+        if (!morsel.hasMoreToOutput()) {
+            return nullptr;
+        }
+        if (localState.connection == nullptr) {
+            localState.connection = connector.createConnection();
+        }
+        localState.reader.init(connector.executeCachedQuery(sharedState.getMorselQuery(morsel),
+            localState.connection.get(), context));
+    }
 }
 
 offset_t DuckDBScanFunction::tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     auto duckdbScanSharedState = input.sharedState->ptrCast<DuckDBScanSharedState>();
     auto duckdbScanBindData = input.bindData->constPtrCast<DuckDBScanBindData>();
-    std::unique_ptr<duckdb::DataChunk> result;
-    try {
-        // Duckdb queryResult.fetch() is not thread safe, we have to acquire a lock there.
-        std::lock_guard<std::mutex> lock{duckdbScanSharedState->mtx};
-        result = duckdbScanSharedState->queryResult->Fetch();
-    } catch (std::exception& e) {
-        return 0;
-    }
+    auto result = duckdbScanSharedState->isPartitioned() ?
+                      fetchPartitioned(*duckdbScanSharedState,
+                          *input.localState->ptrCast<DuckDBScanLocalState>(),
+                          duckdbScanBindData->connector, *input.context->clientContext) :
+                      duckdbScanSharedState->fetch();
     if (result == nullptr) {
         return 0;
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 // Supress warnings from duckdb.hpp
@@ -7,6 +9,7 @@
 #include "duckdb.hpp"
 #pragma GCC diagnostic pop
 
+#include "connector/duckdb_result_cache.h"
 #include "connector/duckdb_secret_manager.h"
 #include "function/duckdb_scan.h"
 #include "s3fs_config.h"
@@ -39,15 +42,61 @@ public:
 
     std::unique_ptr<duckdb::MaterializedQueryResult> executeQuery(std::string query) const;
 
+    // Returns the rows of the query, which runs on the given connection or, if it is nullptr, on
+    // the connection of the connector. Rows are reused from the result cache if it is enabled.
+    std::shared_ptr<duckdb::ColumnDataCollection> executeCachedQuery(const std::string& query,
+        duckdb::Connection* queryConnection, main::ClientContext& context) const;
+
+    void clearResultCache() const { resultCache.clear(); }
+
+    // Binds the query without executing it, which is enough to get the names and types of its
+    // columns.
+    std::unique_ptr<duckdb::PreparedStatement> prepareQuery(std::string query) const;
+
+    // Returns a new connection to the attached database, through which a worker can run queries
+    // concurrently with the other connections.
+    std::unique_ptr<duckdb::Connection> createConnection() const {
+        return std::make_unique<duckdb::Connection>(*instance);
+    }
+
+    // Returns the integer column by which table scans are split into ranges that are read in
+    // parallel, or an empty string if table scans are read by a single query.
+    virtual std::string getPartitionColumn() const { return "rowid"; }
+
     void initRemoteFSSecrets(main::ClientContext* context) const {
         for (auto& fsConfig : httpfs_extension::S3FileSystemConfig::getAvailableConfigs()) {
             executeQuery(DuckDBSecretManager::getRemoteS3FSSecret(context, fsConfig));
         }
     }
 
+    // Returns a connector of type T that isn't attached to a database, such as the connectors of
+    // the lakehouse scan functions. The connector is reused by later queries as long as the remote
+    // file system credentials don't change, so that the DuckDB instance and its extensions are set
+    // up once instead of for every query.
+    template<typename T>
+    static std::shared_ptr<DuckDBConnector> getSharedConnector(main::ClientContext* context) {
+        std::string secrets;
+        for (auto& fsConfig : httpfs_extension::S3FileSystemConfig::getAvailableConfigs()) {
+            secrets += DuckDBSecretManager::getRemoteS3FSSecret(context, fsConfig);
+        }
+        static std::mutex mtx;
+        static std::string cachedSecrets;
+        static std::shared_ptr<DuckDBConnector> cachedConnector;
+        std::unique_lock lck{mtx};
+        if (cachedConnector == nullptr || cachedSecrets != secrets) {
+            auto connector = std::make_shared<T>();
+            connector->connect("" /* inMemDB */, "" /* defaultCatalogName */,
+                "" /* defaultSchemaName */, context);
+            cachedSecrets = std::move(secrets);
+            cachedConnector = std::move(connector);
+        }
+        return cachedConnector;
+    }
+
 protected:
     std::unique_ptr<duckdb::DuckDB> instance;
     std::unique_ptr<duckdb::Connection> connection;
+    mutable DuckDBResultCache resultCache;
 };
 
 } // namespace duckdb_extension
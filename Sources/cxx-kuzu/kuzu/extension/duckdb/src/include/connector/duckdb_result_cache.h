@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+// Supress warnings from duckdb.hpp
+#undef ARROW_FLAG_DICTIONARY_ORDERED
+#include "duckdb.hpp"
+#pragma GCC diagnostic pop
+
+namespace kuzu {
+namespace main {
+class Database;
+}
+
+namespace duckdb_extension {
+
+struct DuckDBResultCacheConfig {
+    // Number of seconds for which the rows returned by a query on an attached database are reused
+    // by later scans. Setting it to 0 disables the cache.
+    static constexpr const char* RESULT_CACHE_TTL_OPTION = "attached_db_result_cache_ttl";
+    static constexpr int64_t DEFAULT_RESULT_CACHE_TTL = 0;
+    // Size in bytes of the cached rows of each attached database.
+    static constexpr const char* RESULT_CACHE_SIZE_OPTION = "attached_db_result_cache_size";
+    static constexpr int64_t DEFAULT_RESULT_CACHE_SIZE = 256 * 1024 * 1024; // 256MB
+
+    static void registerExtensionOptions(main::Database& db);
+};
+
+// Caches the rows returned by the queries sent to an attached database, keyed by the query, so that
+// repeated scans of an unchanged remote table, e.g. by dashboards joining it with the graph, don't
+// fetch its rows again. Rows expire once they are older than the TTL of the lookup, and the least
+// recently used rows are evicted once the cache is full. The cache is cleared by
+// clear_attached_db_cache().
+class DuckDBResultCache {
+public:
+    DuckDBResultCache() : size{0} {}
+
+    // Returns nullptr if the query is not cached or its rows are older than the TTL.
+    std::shared_ptr<duckdb::ColumnDataCollection> lookup(const std::string& query,
+        std::chrono::seconds ttl);
+    void insert(const std::string& query, std::shared_ptr<duckdb::ColumnDataCollection> rows,
+        uint64_t capacity);
+    void clear();
+
+private:
+    struct Entry {
+        std::string query;
+        std::shared_ptr<duckdb::ColumnDataCollection> rows;
+        std::chrono::steady_clock::time_point insertTime;
+        uint64_t size;
+    };
+
+    void erase(std::list<Entry>::iterator it);
+
+private:
+    std::mutex mtx;
+    uint64_t size;
+    // Ordered from most to least recently used.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entryMap;
+};
+
+} // namespace duckdb_extension
+} // namespace kuzu
@@ -5,6 +5,7 @@
 #include "connector/duckdb_result_converter.h"
 #include "function/table/bind_data.h"
 #include "function/table/scan_file_function.h"
+#include "function/table/simple_table_function.h"
 
 namespace kuzu {
 namespace duckdb_extension {
@@ -65,13 +66,64 @@ struct DuckDBScanBindData : function::TableFuncBindData {
     }
 };
 
-struct DuckDBScanSharedState final : function::TableFuncSharedState {
-    explicit DuckDBScanSharedState(std::shared_ptr<duckdb::MaterializedQueryResult> queryResult);
+// Reads the rows returned by a query chunk by chunk.
+class DuckDBRowReader {
+public:
+    void init(std::shared_ptr<duckdb::ColumnDataCollection> rowsToRead);
+    bool isInitialized() const { return rows != nullptr; }
+    void reset() { rows.reset(); }
+
+    // Returns nullptr once all rows are read.
+    std::unique_ptr<duckdb::DataChunk> fetch();
 
-    std::shared_ptr<duckdb::MaterializedQueryResult> queryResult;
+private:
+    // Shared with the result cache, which isn't changed by scans.
+    std::shared_ptr<duckdb::ColumnDataCollection> rows;
+    duckdb::ColumnDataScanState scanState;
+};
+
+// A scan either reads the result of a single query, or is split into morsels which are ranges of
+// the partition column of the connector, each read by a worker with its own connection.
+struct DuckDBScanSharedState final : function::SimpleTableFuncSharedState {
+    explicit DuckDBScanSharedState(std::shared_ptr<duckdb::ColumnDataCollection> rows);
+    DuckDBScanSharedState(std::string partitionQuery, std::string partitionColumn,
+        int64_t minPartitionValue, common::row_idx_t numPartitionValues);
+
+    bool isPartitioned() const { return !reader.isInitialized(); }
+    // Returns the next chunk of the rows of a scan which is not partitioned, or nullptr once all
+    // rows are read.
+    std::unique_ptr<duckdb::DataChunk> fetch() {
+        std::lock_guard lck{mtx};
+        return reader.fetch();
+    }
+    // Returns the query reading the morsel.
+    std::string getMorselQuery(const function::TableFuncMorsel& morsel) const;
+
+    // Rows are split into morsels of the size of a DuckDB row group.
+    static constexpr common::offset_t PARTITION_MORSEL_SIZE = 122880;
+
+    DuckDBRowReader reader;
+    // The query of a morsel without the range of the partition column, ending with a WHERE or AND.
+    std::string partitionQuery;
+    std::string partitionColumn;
+    // Morsels are ranges of offsets from the smallest value of the partition column.
+    int64_t minPartitionValue;
+};
+
+struct DuckDBScanLocalState final : function::TableFuncLocalState {
+    std::unique_ptr<duckdb::Connection> connection;
+    // Reads the rows of the current morsel.
+    DuckDBRowReader reader;
 };
 
 function::TableFunction getScanFunction(std::shared_ptr<DuckDBTableScanInfo> scanInfo);
 
+// Renders the predicates pushed down to the columns of a scan as a SQL WHERE clause, or returns an
+// empty string. Predicates are rendered with the kuzu column names, so a column is skipped unless
+// its name is a plain identifier equal to its name in the source. Kuzu still evaluates all
+// predicates after the scan.
+std::string getPushedDownPredicates(const function::TableFuncBindData& bindData,
+    const std::vector<std::string>& columnNamesInSource);
+
 } // namespace duckdb_extension
 } // namespace kuzu
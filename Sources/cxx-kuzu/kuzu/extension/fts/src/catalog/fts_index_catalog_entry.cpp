@@ -59,11 +59,17 @@ std::string FTSIndexAuxInfo::toCypher(const catalog::IndexCatalogEntry& indexEnt
             common::stringFormat("'{}'{}", tableCatalogEntry->getProperty(propertyIDs[i]).getName(),
                 i == propertyIDs.size() - 1 ? "" : ", ");
     }
+    // Whether positions are recorded is given by the schema of the appears_in table.
+    auto appearsInEntry = catalog->getTableCatalogEntry(transaction,
+        FTSUtils::getAppearsInTableName(indexEntry.getTableID(), indexEntry.getIndexName()));
+    auto positionsStr = appearsInEntry->containsProperty(Positions::NAME) ?
+                            common::stringFormat(", {} := true", Positions::NAME) :
+                            std::string{};
 
     cypher += common::stringFormat("CALL CREATE_FTS_INDEX('{}', '{}', [{}], stemmer := '{}', "
-                                   "stopWords := '{}');",
+                                   "stopWords := '{}'{});",
         tableName, indexEntry.getIndexName(), std::move(propertyStr), config.stemmer,
-        getStopWordsName(indexToCypherInfo.exportFileInfo));
+        getStopWordsName(indexToCypherInfo.exportFileInfo), std::move(positionsStr));
     return cypher;
 }
 
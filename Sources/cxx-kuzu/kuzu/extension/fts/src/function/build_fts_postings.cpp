@@ -0,0 +1,410 @@
+#include "function/build_fts_postings.h"
+
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/types/value/nested.h"
+#include "cppjieba/Jieba.hpp"
+#include "function/fts_bind_data.h"
+#include "function/fts_config.h"
+#include "function/fts_index_utils.h"
+#include "function/gds/gds_utils.h"
+#include "function/hash/hash_functions.h"
+#include "function/table/bind_input.h"
+#include "graph/graph_entry.h"
+#include "graph/on_disk_graph.h"
+#include "index/fts_posting_lists.h"
+#include "processor/execution_context.h"
+#include "re2.h"
+#include "utils/fts_utils.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+struct BuildFTSPostingsBindData final : FTSBindData {
+    std::vector<std::string> propertyNames;
+    CreateFTSConfig createFTSConfig;
+
+    BuildFTSPostingsBindData(std::string tableName, table_id_t tableID, std::string indexName,
+        binder::expression_vector columns, std::vector<std::string> propertyNames,
+        CreateFTSConfig createFTSConfig)
+        : FTSBindData{std::move(tableName), tableID, std::move(indexName), std::move(columns)},
+          propertyNames{std::move(propertyNames)}, createFTSConfig{std::move(createFTSConfig)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BuildFTSPostingsBindData>(*this);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto nodeTableEntry = FTSIndexUtils::bindNodeTable(*context,
+        input->getLiteralVal<std::string>(0), indexName, FTSIndexUtils::IndexOperation::CREATE);
+    auto propertiesValue = input->getValue(2);
+    std::vector<std::string> propertyNames;
+    for (auto i = 0u; i < propertiesValue.getChildrenSize(); i++) {
+        propertyNames.push_back(NestedVal::getChildVal(&propertiesValue, i)->toString());
+    }
+    auto createFTSConfig =
+        CreateFTSConfig{*context, nodeTableEntry->getTableID(), indexName, input->optionalParams};
+    std::vector<std::string> columnNames{"term", "docID", "tf"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::INT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    if (createFTSConfig.positions) {
+        columnNames.push_back("positions");
+        columnTypes.push_back(LogicalType::BLOB());
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<BuildFTSPostingsBindData>(nodeTableEntry->getName(),
+        nodeTableEntry->getTableID(), indexName, std::move(columns), std::move(propertyNames),
+        std::move(createFTSConfig));
+}
+
+struct Posting {
+    offset_t docOffset;
+    uint64_t tf;
+    // Encoded by PositionsCodec, empty if positions are not recorded.
+    std::string positions;
+};
+
+using term_postings_t = std::unordered_map<std::string, std::vector<Posting>>;
+
+// The postings of the terms whose hash falls into the partition. Each worker collects the postings
+// of the docs it tokenizes into its own partitions, which are merged after all docs are tokenized.
+struct PostingsPartition {
+    std::vector<term_postings_t> localPostings;
+    std::vector<std::pair<std::string, std::vector<Posting>>> postings;
+
+    void merge();
+};
+
+void PostingsPartition::merge() {
+    if (localPostings.empty()) {
+        return;
+    }
+    auto mergedPostings = std::move(localPostings[0]);
+    for (auto i = 1u; i < localPostings.size(); i++) {
+        for (auto& [term, termPostings] : localPostings[i]) {
+            auto& mergedTermPostings = mergedPostings[term];
+            mergedTermPostings.insert(mergedTermPostings.end(), termPostings.begin(),
+                termPostings.end());
+        }
+    }
+    localPostings.clear();
+    postings.reserve(mergedPostings.size());
+    for (auto& [term, termPostings] : mergedPostings) {
+        // Workers tokenize disjoint ranges of docs, so a term has at most one posting per doc.
+        std::sort(termPostings.begin(), termPostings.end(),
+            [](const Posting& a, const Posting& b) { return a.docOffset < b.docOffset; });
+        postings.emplace_back(term, std::move(termPostings));
+    }
+}
+
+struct BuildFTSPostingsSharedState final : TableFuncSharedState {
+    static constexpr idx_t NUM_PARTITIONS = 256;
+
+    std::vector<PostingsPartition> partitions;
+    bool isBuilt = false;
+    // Position of the next posting to output.
+    idx_t partitionIdx = 0;
+    idx_t termIdx = 0;
+    idx_t postingIdx = 0;
+
+    BuildFTSPostingsSharedState() : partitions(NUM_PARTITIONS) {}
+
+    void addLocalPostings(std::vector<term_postings_t> localPartitions) {
+        std::lock_guard lck{mtx};
+        for (auto i = 0u; i < NUM_PARTITIONS; i++) {
+            if (!localPartitions[i].empty()) {
+                partitions[i].localPostings.push_back(std::move(localPartitions[i]));
+            }
+        }
+    }
+
+    offset_t writePostings(DataChunk& dataChunk, bool writePositions);
+};
+
+offset_t BuildFTSPostingsSharedState::writePostings(DataChunk& dataChunk, bool writePositions) {
+    auto& termVector = dataChunk.getValueVectorMutable(0);
+    auto& docIDVector = dataChunk.getValueVectorMutable(1);
+    auto& tfVector = dataChunk.getValueVectorMutable(2);
+    auto positionsVector = writePositions ? &dataChunk.getValueVectorMutable(3) : nullptr;
+    offset_t numPostings = 0;
+    while (numPostings < DEFAULT_VECTOR_CAPACITY && partitionIdx < NUM_PARTITIONS) {
+        auto& partitionPostings = partitions[partitionIdx].postings;
+        if (termIdx == partitionPostings.size()) {
+            // Release the partition once all of its postings are output.
+            partitionPostings = {};
+            partitionIdx++;
+            termIdx = 0;
+            continue;
+        }
+        auto& [term, termPostings] = partitionPostings[termIdx];
+        for (; postingIdx < termPostings.size() && numPostings < DEFAULT_VECTOR_CAPACITY;
+             postingIdx++) {
+            termVector.setValue(numPostings, term);
+            docIDVector.setValue<int64_t>(numPostings, termPostings[postingIdx].docOffset);
+            tfVector.setValue<uint64_t>(numPostings, termPostings[postingIdx].tf);
+            if (positionsVector != nullptr) {
+                auto& positions = termPostings[postingIdx].positions;
+                BlobVector::addBlob(positionsVector, numPostings, positions.data(),
+                    positions.size());
+            }
+            numPostings++;
+        }
+        if (postingIdx == termPostings.size()) {
+            termIdx++;
+            postingIdx = 0;
+        }
+    }
+    return numPostings;
+}
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(
+    const TableFuncInitSharedStateInput& /*input*/) {
+    return std::make_unique<BuildFTSPostingsSharedState>();
+}
+
+// Tokenizer state shared by all workers. RE2 and jieba are safe to use concurrently.
+struct DocTokenizerSharedState {
+    std::unique_ptr<RE2> ignorePattern;
+    std::string stemmer;
+    const std::unordered_set<std::string>* stopWords;
+    std::shared_ptr<cppjieba::Jieba> jieba;
+    bool recordPositions = false;
+};
+
+// Mirrors the tokenize macro and the STEM function used to tokenize queries: the content is
+// normalized, split into tokens, stop words are removed and the remaining tokens are stemmed. The
+// positions of the terms are recorded the same way as in FTSIndex::insert.
+class TokenizeVertexCompute final : public VertexCompute {
+public:
+    TokenizeVertexCompute(BuildFTSPostingsSharedState& sharedState,
+        const DocTokenizerSharedState& tokenizerState, uint64_t numProperties)
+        : sharedState{sharedState}, tokenizerState{tokenizerState}, numProperties{numProperties},
+          localPartitions(BuildFTSPostingsSharedState::NUM_PARTITIONS) {
+        if (tokenizerState.stemmer != "none") {
+            termStemmer = TermStemmer::create(tokenizerState.stemmer);
+        }
+    }
+
+    ~TokenizeVertexCompute() override {
+        sharedState.addLocalPostings(std::move(localPartitions));
+    }
+
+    void vertexCompute(const graph::VertexScanState::Chunk& chunk) override;
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TokenizeVertexCompute>(sharedState, tokenizerState,
+            numProperties);
+    }
+
+private:
+    // Returns the number of tokens of the content.
+    uint32_t tokenize(std::string& content, uint32_t startPosition);
+
+private:
+    BuildFTSPostingsSharedState& sharedState;
+    const DocTokenizerSharedState& tokenizerState;
+    uint64_t numProperties;
+    // Each worker has its own copy of the vertex compute, and so its own stemmer.
+    std::unique_ptr<TermStemmer> termStemmer;
+    std::vector<term_postings_t> localPartitions;
+    // Frequencies of the terms in the doc being tokenized.
+    std::unordered_map<std::string, uint64_t> docTFs;
+    std::unordered_map<std::string, std::vector<uint32_t>> docPositions;
+    std::vector<std::string> tokens;
+};
+
+void TokenizeVertexCompute::vertexCompute(const graph::VertexScanState::Chunk& chunk) {
+    auto nodeIDs = chunk.getNodeIDs();
+    for (auto i = 0u; i < nodeIDs.size(); i++) {
+        docTFs.clear();
+        docPositions.clear();
+        uint32_t contentStartPosition = 0;
+        for (auto propertyIdx = 0u; propertyIdx < numProperties; propertyIdx++) {
+            if (chunk.isNull(propertyIdx, i)) {
+                continue;
+            }
+            auto content = chunk.getProperties<ku_string_t>(propertyIdx)[i].getAsString();
+            // Leave a gap between properties so that phrases don't span them.
+            contentStartPosition += tokenize(content, contentStartPosition) + 1;
+        }
+        for (auto& [term, tf] : docTFs) {
+            hash_t hash = 0;
+            function::Hash::operation(term, hash);
+            auto& partition = localPartitions[hash % BuildFTSPostingsSharedState::NUM_PARTITIONS];
+            Posting posting{nodeIDs[i].offset, tf, ""};
+            if (tokenizerState.recordPositions) {
+                PositionsCodec::encode(docPositions.at(term), posting.positions);
+            }
+            partition[term].push_back(std::move(posting));
+        }
+    }
+}
+
+uint32_t TokenizeVertexCompute::tokenize(std::string& content, uint32_t startPosition) {
+    FTSUtils::normalizeQuery(content, *tokenizerState.ignorePattern);
+    tokens.clear();
+    if (tokenizerState.jieba != nullptr) {
+        tokenizerState.jieba->CutForSearch(content, tokens);
+    } else {
+        FTSUtils::splitTerms(content, tokens);
+    }
+    for (auto i = 0u; i < tokens.size(); i++) {
+        auto& token = tokens[i];
+        if (token.empty() || tokenizerState.stopWords->contains(token)) {
+            continue;
+        }
+        auto& term = termStemmer == nullptr ? token : termStemmer->stem(token);
+        docTFs[term]++;
+        if (tokenizerState.recordPositions) {
+            docPositions[term].push_back(startPosition + i);
+        }
+    }
+    return tokens.size();
+}
+
+class StopWordsVertexCompute final : public VertexCompute {
+public:
+    StopWordsVertexCompute(std::mutex& mtx, std::unordered_set<std::string>& stopWords)
+        : mtx{mtx}, stopWords{stopWords} {}
+
+    void vertexCompute(const graph::VertexScanState::Chunk& chunk) override {
+        auto words = chunk.getProperties<ku_string_t>(0);
+        std::lock_guard lck{mtx};
+        for (auto i = 0u; i < chunk.size(); i++) {
+            stopWords.insert(words[i].getAsString());
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<StopWordsVertexCompute>(mtx, stopWords);
+    }
+
+private:
+    std::mutex& mtx;
+    std::unordered_set<std::string>& stopWords;
+};
+
+static std::unordered_set<std::string> scanStopWords(processor::ExecutionContext* context,
+    const std::string& stopWordsTableName) {
+    auto clientContext = context->clientContext;
+    auto stopWordsTableEntry = catalog::Catalog::Get(*clientContext)
+                                   ->getTableCatalogEntry(
+                                       transaction::Transaction::Get(*clientContext),
+                                       stopWordsTableName);
+    graph::OnDiskGraph graph(clientContext,
+        graph::NativeGraphEntry{{stopWordsTableEntry}, {} /* relTableEntries */});
+    std::mutex mtx;
+    std::unordered_set<std::string> stopWords;
+    StopWordsVertexCompute vc{mtx, stopWords};
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, &graph, vc, stopWordsTableEntry,
+        std::vector<std::string>{"sw"});
+    return stopWords;
+}
+
+static void tokenizeDocs(processor::ExecutionContext* context,
+    const BuildFTSPostingsBindData& bindData, const DocTokenizerSharedState& tokenizerState,
+    BuildFTSPostingsSharedState& sharedState) {
+    auto clientContext = context->clientContext;
+    auto tableEntry = catalog::Catalog::Get(*clientContext)
+                          ->getTableCatalogEntry(transaction::Transaction::Get(*clientContext),
+                              bindData.tableID);
+    graph::OnDiskGraph graph(clientContext,
+        graph::NativeGraphEntry{{tableEntry}, {} /* relTableEntries */});
+    TokenizeVertexCompute vc{sharedState, tokenizerState, bindData.propertyNames.size()};
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, &graph, vc, tableEntry,
+        bindData.propertyNames);
+}
+
+class MergePostingsTask final : public Task {
+public:
+    MergePostingsTask(uint64_t maxNumThreads, BuildFTSPostingsSharedState& sharedState)
+        : Task{maxNumThreads}, sharedState{sharedState}, nextPartitionIdx{0} {}
+
+    void run() override {
+        while (true) {
+            auto partitionIdx = nextPartitionIdx.fetch_add(1);
+            if (partitionIdx >= BuildFTSPostingsSharedState::NUM_PARTITIONS) {
+                return;
+            }
+            sharedState.partitions[partitionIdx].merge();
+        }
+    }
+
+private:
+    BuildFTSPostingsSharedState& sharedState;
+    std::atomic<idx_t> nextPartitionIdx;
+};
+
+// Docs are tokenized by morsel-driven workers, each collecting its postings into partitions by
+// term hash. The partitions are then merged in parallel, so no two workers ever touch the
+// postings of the same term.
+static void buildPostings(const TableFuncInput& input, BuildFTSPostingsSharedState& sharedState) {
+    auto& bindData = *input.bindData->constPtrCast<BuildFTSPostingsBindData>();
+    auto clientContext = input.context->clientContext;
+    auto& config = bindData.createFTSConfig;
+    DocTokenizerSharedState tokenizerState;
+    tokenizerState.ignorePattern = std::make_unique<RE2>(config.ignorePattern);
+    tokenizerState.stemmer = config.stemmer;
+    tokenizerState.recordPositions = config.positions;
+    std::unordered_set<std::string> stopWords;
+    if (config.stopWordsTableInfo.source == StopWordsSource::DEFAULT) {
+        tokenizerState.stopWords = &StopWords::getDefaultStopWords();
+    } else {
+        stopWords = scanStopWords(input.context, config.stopWordsTableInfo.tableName);
+        tokenizerState.stopWords = &stopWords;
+    }
+    if (config.tokenizerInfo.tokenizer == "jieba") {
+        tokenizerState.jieba = FTSUtils::getJieba(config.tokenizerInfo.jiebaDictDir);
+    }
+    tokenizeDocs(input.context, bindData, tokenizerState, sharedState);
+    auto task = std::make_shared<MergePostingsTask>(clientContext->getMaxNumThreadForExec(),
+        sharedState);
+    TaskScheduler::Get(*clientContext)
+        ->scheduleTaskAndWaitOrError(task, input.context, true /* launchNewWorkerThread */);
+    sharedState.isBuilt = true;
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<BuildFTSPostingsSharedState>();
+    if (!sharedState->isBuilt) {
+        buildPostings(input, *sharedState);
+    }
+    return sharedState->writePostings(output.dataChunk,
+        input.bindData->constPtrCast<BuildFTSPostingsBindData>()->createFTSConfig.positions);
+}
+
+static std::vector<LogicalType> inferInputTypes(const binder::expression_vector& /*params*/) {
+    std::vector<LogicalType> inputTypes;
+    inputTypes.push_back(LogicalType::STRING());
+    inputTypes.push_back(LogicalType::STRING());
+    inputTypes.push_back(LogicalType::LIST(LogicalType::STRING()));
+    return inputTypes;
+}
+
+function_set InternalBuildFTSPostingsFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::LIST});
+    func->tableFunc = tableFunc;
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    // Parallelism is handled internally, rows are output by a single thread.
+    func->canParallelFunc = [] { return false; };
+    func->inferInputTypes = inferInputTypes;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
@@ -171,29 +171,41 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
     // one.
     query += createStopWordsTable(context, ftsBindData->createFTSConfig.stopWordsTableInfo);
 
-    // Create the terms_in_doc table which servers as a temporary table to store the
-    // relationship between terms and docs.
-    auto appearsInfoTableName = FTSUtils::getAppearsInfoTableName(tableID, indexName);
-    query += stringFormat("CREATE NODE TABLE `{}` (ID SERIAL, term string, docID INT64, primary "
-                          "key(ID));",
-        appearsInfoTableName);
     auto tableName = ftsBindData->tableName;
     auto tableEntry = catalog::Catalog::Get(context)->getTableCatalogEntry(
         transaction::Transaction::Get(context), tableName);
-    for (auto& property : ftsBindData->propertyIDs) {
-        auto propertyName = tableEntry->getProperty(property).getName();
-        query += stringFormat("COPY `{}` FROM "
-                              "(MATCH (b:`{}`) "
-                              "WITH `{}`(b.{}) AS tk, OFFSET(ID(b)) AS id "
-                              "UNWIND tk AS t "
-                              "WITH t AS t1, id AS id1 "
-                              "WHERE t1 is NOT NULL AND SIZE(t1) > 0 AND "
-                              "NOT EXISTS {MATCH (s:`{}` {sw: t1})} "
-                              "RETURN STEM(t1, '{}'), id1);",
-            appearsInfoTableName, tableName, FTSUtils::getTokenizeMacroName(tableID, indexName),
-            propertyName, ftsBindData->createFTSConfig.stopWordsTableInfo.tableName,
-            ftsBindData->createFTSConfig.stemmer);
+    std::string properties = "[";
+    for (auto i = 0u; i < ftsBindData->propertyIDs.size(); i++) {
+        properties +=
+            stringFormat("'{}'", tableEntry->getProperty(ftsBindData->propertyIDs[i]).getName());
+        if (i != ftsBindData->propertyIDs.size() - 1) {
+            properties += ", ";
+        }
     }
+    properties += "]";
+
+    // Create the terms_in_doc table which servers as a temporary table to store the frequency of
+    // each term in each doc. The docs are tokenized in parallel by _BUILD_FTS_POSTINGS.
+    auto& createFTSConfig = ftsBindData->createFTSConfig;
+    // The positions of a term in a doc are stored as a blob of delta encoded positions.
+    std::string positionsDefinition = createFTSConfig.positions ? ", positions BLOB" : "";
+    auto appearsInfoTableName = FTSUtils::getAppearsInfoTableName(tableID, indexName);
+    query += stringFormat("CREATE NODE TABLE `{}` (ID SERIAL, term string, docID INT64, tf "
+                          "UINT64{}, primary key(ID));",
+        appearsInfoTableName, positionsDefinition);
+    std::string buildParams;
+    buildParams += stringFormat("stemmer := '{}', ", createFTSConfig.stemmer);
+    buildParams += stringFormat("stopWords := '{}', ",
+        formatStrInCypher(createFTSConfig.stopWordsTableInfo.stopWords));
+    buildParams += stringFormat("ignore_pattern := '{}', ",
+        formatStrInCypher(createFTSConfig.ignorePattern));
+    buildParams += stringFormat("tokenizer := '{}', ", createFTSConfig.tokenizerInfo.tokenizer);
+    buildParams +=
+        stringFormat("positions := {}, ", createFTSConfig.positions ? "true" : "false");
+    buildParams += stringFormat("jieba_dict_dir := '{}'",
+        formatStrInCypher(createFTSConfig.tokenizerInfo.jiebaDictDir));
+    query += stringFormat("COPY `{}` FROM (CALL _BUILD_FTS_POSTINGS('{}', '{}', {}, {}) RETURN *);",
+        appearsInfoTableName, tableName, indexName, properties, buildParams);
 
     auto docsTableName = FTSUtils::getDocsTableName(tableID, indexName);
     // Create the docs table which records the number of words in each document.
@@ -201,39 +213,33 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
         docsTableName);
     query += stringFormat("COPY `{}` FROM "
                           "(MATCH (t:`{}`) "
-                          "RETURN t.docID, CAST(count(t) AS UINT64)); ",
+                          "RETURN t.docID, CAST(sum(t.tf) AS UINT64)); ",
         docsTableName, appearsInfoTableName);
 
     auto termsTableName = FTSUtils::getTermsTableName(tableID, indexName);
-    // Create the dic table which records all distinct terms and their document frequency.
-    query += stringFormat("CREATE NODE TABLE `{}` (term STRING, df UINT64, PRIMARY KEY(term));",
+    // Create the dic table which records all distinct terms, their document frequency and the max
+    // frequency of the term in a document, which bounds the score of the term in top-k queries.
+    query += stringFormat(
+        "CREATE NODE TABLE `{}` (term STRING, df UINT64, maxtf UINT64, PRIMARY KEY(term));",
         termsTableName);
     query += stringFormat("COPY `{}` FROM "
                           "(MATCH (t:`{}`) "
-                          "RETURN t.term, CAST(count(distinct t.docID) AS UINT64));",
+                          "RETURN t.term, CAST(count(*) AS UINT64), CAST(max(t.tf) AS UINT64));",
         termsTableName, appearsInfoTableName);
 
     auto appearsInTableName = FTSUtils::getAppearsInTableName(tableID, indexName);
     // Finally, create a terms table that records the documents in which the terms appear, along
-    // with the frequency of each term.
-    query += stringFormat("CREATE REL TABLE `{}` (FROM `{}` TO `{}`, tf UINT64);",
-        appearsInTableName, termsTableName, docsTableName);
+    // with the frequency of each term, and its positions if they are recorded.
+    query += stringFormat("CREATE REL TABLE `{}` (FROM `{}` TO `{}`, tf UINT64{});",
+        appearsInTableName, termsTableName, docsTableName, positionsDefinition);
     query += stringFormat("COPY `{}` FROM ("
                           "MATCH (b:`{}`) "
-                          "RETURN b.term, b.docID, CAST(count(*) as UINT64));",
-        appearsInTableName, appearsInfoTableName);
+                          "RETURN b.term, b.docID, b.tf{});",
+        appearsInTableName, appearsInfoTableName,
+        createFTSConfig.positions ? ", b.positions" : "");
 
     // Drop the intermediate terms_in_doc table.
     query += stringFormat("DROP TABLE `{}`;", appearsInfoTableName);
-    std::string properties = "[";
-    for (auto i = 0u; i < ftsBindData->propertyIDs.size(); i++) {
-        properties +=
-            stringFormat("'{}'", tableEntry->getProperty(ftsBindData->propertyIDs[i]).getName());
-        if (i != ftsBindData->propertyIDs.size() - 1) {
-            properties += ", ";
-        }
-    }
-    properties += "]";
     std::string params;
     params += stringFormat("stemmer := '{}', ", ftsBindData->createFTSConfig.stemmer);
     params += stringFormat("stopWords := '{}'",
@@ -315,10 +321,12 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         nodeTable->getNumTotalRows(transaction::Transaction::Get(*context.clientContext)));
     auto onDiskIndex = std::make_unique<FTSIndex>(std::move(indexInfo), std::move(storageInfo),
         std::move(ftsConfig), context.clientContext);
+    storage::PageAllocator* postingListsPageAllocator = nullptr;
     if (!context.clientContext->isInMemory()) {
         // We currently can't support FSM reclaiming when rolling back checkpoint
         // so we don't use the optimistic allocator here
         auto& pageAllocator = *storageManager->getDataFH()->getPageManager();
+        postingListsPageAllocator = &pageAllocator;
         // Checkpoint internal tables.
         onDiskIndex->getInternalTableInfo().docTable->checkpoint(context.clientContext,
             docTableEntry, pageAllocator);
@@ -332,6 +340,8 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         onDiskIndex->getInternalTableInfo().appearsInfoTable->checkpoint(context.clientContext,
             appearsInTableEntry, pageAllocator);
     }
+    onDiskIndex->buildPostingLists(context.clientContext,
+        transaction::Transaction::Get(*context.clientContext), postingListsPageAllocator);
     nodeTable->addIndex(std::move(onDiskIndex));
     transaction->setForceCheckpoint();
     return 0;
@@ -157,6 +157,9 @@ CreateFTSConfig::CreateFTSConfig(main::ClientContext& context, common::table_id_
             value.validateType(common::LogicalTypeID::STRING);
             tokenizerInfo.jiebaDictDir =
                 common::StringUtils::getLower(value.getValue<std::string>());
+        } else if (Positions::NAME == lowerCaseName) {
+            value.validateType(Positions::TYPE);
+            positions = value.getValue<bool>();
         } else {
             throw common::BinderException{"Unrecognized optional parameter: " + name};
         }
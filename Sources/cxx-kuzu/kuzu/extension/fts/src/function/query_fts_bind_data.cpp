@@ -29,6 +29,10 @@ QueryFTSOptionalParams::QueryFTSOptionalParams(const binder::expression_vector&
             conjunctive = function::OptionalParam<Conjunctive>(optionalParam);
         } else if (paramName == TopK::NAME) {
             topK = function::OptionalParam<TopK>(optionalParam);
+        } else if (paramName == Phrase::NAME) {
+            phrase = function::OptionalParam<Phrase>(optionalParam);
+        } else if (paramName == Slop::NAME) {
+            slop = function::OptionalParam<Slop>(optionalParam);
         } else {
             throw common::BinderException{"Unknown optional parameter: " + paramName};
         }
@@ -40,9 +44,12 @@ void QueryFTSOptionalParams::evaluateParams(main::ClientContext* context) {
     b.evaluateParam(context);
     conjunctive.evaluateParam(context);
     topK.evaluateParam(context);
+    phrase.evaluateParam(context);
+    slop.evaluateParam(context);
 }
 
-std::vector<std::string> QueryFTSBindData::getQueryTerms(main::ClientContext& context) const {
+std::vector<std::string> QueryFTSBindData::getQueryTerms(main::ClientContext& context,
+    std::vector<uint32_t>* positions) const {
     auto queryInStr =
         ExpressionUtil::evaluateLiteral<std::string>(&context, query, LogicalType::STRING());
     auto config = entry.getAuxInfo().cast<FTSIndexAuxInfo>().config;
@@ -55,10 +62,14 @@ std::vector<std::string> QueryFTSBindData::getQueryTerms(main::ClientContext& co
                                config.stopWordsTableName)
                            ->getTableID())
             ->ptrCast<NodeTable>();
+    auto& qFTSOptionalParams = optionalParams->constCast<QueryFTSOptionalParams>();
+    // Stop words are removed from phrases the same way as from the docs, so that the positions of
+    // the remaining terms line up with the positions recorded in the index.
+    auto isConjunctive =
+        qFTSOptionalParams.conjunctive.getParamVal() || qFTSOptionalParams.phrase.getParamVal();
     return FTSUtils::stemTerms(terms, entry.getAuxInfo().cast<FTSIndexAuxInfo>().config,
         MemoryManager::Get(context), stopWordsTable, transaction::Transaction::Get(context),
-        optionalParams->constCast<QueryFTSOptionalParams>().conjunctive.getParamVal(),
-        true /* isQuery */);
+        isConjunctive, true /* isQuery */, positions);
 }
 
 } // namespace fts_extension
@@ -1,13 +1,16 @@
 #include "function/query_fts_index.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/query/reading_clause/bound_table_function_call.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/fts_index_catalog_entry.h"
 #include "common/exception/binder.h"
+#include "common/exception/runtime.h"
 #include "common/types/internal_id_util.h"
 #include "function/fts_index_utils.h"
 #include "function/gds/gds_utils.h"
@@ -127,18 +130,39 @@ struct ScoreInfo {
     void addEdge(uint64_t df, uint64_t tf) { scoreData.emplace_back(df, tf); }
 };
 
+struct QueryTermInfo {
+    // Indicates that the index does not record the max term frequency of its terms.
+    static constexpr uint64_t UNKNOWN_MAX_TF = UINT64_MAX;
+
+    uint64_t df;
+    uint64_t maxTF;
+    // Whether the postings of the term can be read from the posting lists of the index.
+    bool inPostingLists = false;
+};
+
+using query_term_infos_t = std::unordered_map<offset_t, QueryTermInfo>;
+
+static double getIDF(idx_t numDocs, uint64_t df) {
+    return log10((numDocs - df + 0.5) / (df + 0.5) + 1);
+}
+
+// BM25 score of a term occurring tf times in a doc of length len.
+static double getTermScore(double idf, uint64_t tf, uint64_t len, double avgDocLen, double k,
+    double b) {
+    return idf * ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+}
+
 struct QFTSEdgeCompute final : EdgeCompute {
     node_id_map_t<ScoreInfo>& scores;
-    const std::unordered_map<offset_t, uint64_t>& dfs;
+    const query_term_infos_t& termInfos;
 
-    QFTSEdgeCompute(node_id_map_t<ScoreInfo>& scores,
-        const std::unordered_map<offset_t, uint64_t>& dfs)
-        : scores{scores}, dfs{dfs} {}
+    QFTSEdgeCompute(node_id_map_t<ScoreInfo>& scores, const query_term_infos_t& termInfos)
+        : scores{scores}, termInfos{termInfos} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& resultChunk,
         bool) override {
-        KU_ASSERT(dfs.contains(boundNodeID.offset));
-        auto df = dfs.at(boundNodeID.offset);
+        KU_ASSERT(termInfos.contains(boundNodeID.offset));
+        auto df = termInfos.at(boundNodeID.offset).df;
         std::vector<nodeID_t> activeNodes;
         resultChunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
             auto docNodeID = neighbors[i];
@@ -153,7 +177,7 @@ struct QFTSEdgeCompute final : EdgeCompute {
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<QFTSEdgeCompute>(scores, dfs);
+        return std::make_unique<QFTSEdgeCompute>(scores, termInfos);
     }
 };
 
@@ -205,10 +229,7 @@ void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNo
     for (auto& scoreData : scoreInfo.scoreData) {
         auto numDocs = bindData.numDocs;
         auto avgDocLen = bindData.avgDocLen;
-        auto df = scoreData.df;
-        auto tf = scoreData.tf;
-        score += log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
-                 ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+        score += getTermScore(getIDF(numDocs, scoreData.df), scoreData.tf, len, avgDocLen, k, b);
     }
     sharedState.addDocScore(scoreFtInsertState.vectors, scoreFT, {(uint64_t)docsID, score});
 }
@@ -245,69 +266,86 @@ private:
 using VCQueryTerm = std::variant<std::string, std::unique_ptr<RE2>>;
 class MatchTermsVertexCompute final : public VertexCompute {
 public:
-    explicit MatchTermsVertexCompute(std::unordered_map<offset_t, uint64_t>& resDfs,
-        std::vector<VCQueryTerm>& queryTerms)
-        : resDfs{resDfs}, queryTerms{queryTerms} {}
+    MatchTermsVertexCompute(query_term_infos_t& resTermInfos, std::vector<VCQueryTerm>& queryTerms,
+        bool hasMaxTF)
+        : resTermInfos{resTermInfos}, queryTerms{queryTerms}, hasMaxTF{hasMaxTF} {}
     void vertexCompute(const graph::VertexScanState::Chunk& chunk) override {
         auto terms = chunk.getProperties<ku_string_t>(0);
         auto dfs = chunk.getProperties<uint64_t>(1);
+        auto maxTFs = hasMaxTF ? chunk.getProperties<uint64_t>(2) : std::span<const uint64_t>{};
         auto nodeIds = chunk.getNodeIDs();
+        auto getTermInfo = [&](auto i) {
+            return QueryTermInfo{dfs[i], hasMaxTF ? maxTFs[i] : QueryTermInfo::UNKNOWN_MAX_TF};
+        };
         for (auto& queryTerm : queryTerms) {
             // queryTerm.index() is 0 for string, 1 for unique_ptr<RE2>
             if (queryTerm.index() == 0) {
                 std::string& queryString = std::get<0>(queryTerm);
                 for (auto i = 0u; i < chunk.size(); ++i) {
                     if (queryString == terms[i].getAsString()) {
-                        resDfs[nodeIds[i].offset] = dfs[i];
+                        resTermInfos[nodeIds[i].offset] = getTermInfo(i);
                     }
                 }
             } else {
                 RE2& regex = *std::get<1>(queryTerm);
                 for (auto i = 0u; i < chunk.size(); ++i) {
                     if (RE2::FullMatch(terms[i].getAsString(), regex)) {
-                        resDfs[nodeIds[i].offset] = dfs[i];
+                        resTermInfos[nodeIds[i].offset] = getTermInfo(i);
                     }
                 }
             }
         }
     }
     std::unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<MatchTermsVertexCompute>(resDfs, queryTerms);
+        return std::make_unique<MatchTermsVertexCompute>(resTermInfos, queryTerms, hasMaxTF);
     }
 
 private:
-    std::unordered_map<offset_t, uint64_t>& resDfs;
+    query_term_infos_t& resTermInfos;
     std::vector<VCQueryTerm>& queryTerms;
+    bool hasMaxTF;
 };
 
 static constexpr char SCORE_PROP_NAME[] = "score";
 static constexpr char DOC_FREQUENCY_PROP_NAME[] = "df";
 static constexpr char TERM_FREQUENCY_PROP_NAME[] = "tf";
+static constexpr char POSITIONS_PROP_NAME[] = "positions";
+static constexpr char MAX_TERM_FREQUENCY_PROP_NAME[] = "maxtf";
 static constexpr char DOC_LEN_PROP_NAME[] = "len";
 static constexpr char DOC_ID_PROP_NAME[] = "docID";
 
-static std::unordered_map<offset_t, uint64_t> getDFs(main::ClientContext& context,
+// If termOffsets is given, the offsets of the query terms are appended to it, or INVALID_OFFSET for
+// the terms which are not in the index. The query terms must not contain wildcards in that case.
+static query_term_infos_t getQueryTermInfos(main::ClientContext& context,
     processor::ExecutionContext* executionContext, graph::Graph* graph,
-    catalog::TableCatalogEntry* termsEntry, std::vector<std::string>& queryTerms) {
+    catalog::TableCatalogEntry* termsEntry, std::vector<std::string>& queryTerms,
+    std::vector<offset_t>* termOffsets = nullptr) {
     auto storageManager = StorageManager::Get(context);
     auto tableID = termsEntry->getTableID();
     auto& termsNodeTable = storageManager->getTable(tableID)->cast<NodeTable>();
     auto tx = transaction::Transaction::Get(context);
-    auto dfColumnID = termsEntry->getColumnID(DOC_FREQUENCY_PROP_NAME);
+    auto hasMaxTF = termsEntry->containsProperty(MAX_TERM_FREQUENCY_PROP_NAME);
     std::vector<LogicalType> vectorTypes;
     vectorTypes.push_back(LogicalType::INTERNAL_ID());
     vectorTypes.push_back(LogicalType::UINT64());
+    vectorTypes.push_back(LogicalType::UINT64());
     auto dataChunk = Table::constructDataChunk(MemoryManager::Get(context), std::move(vectorTypes));
     dataChunk.state->getSelVectorUnsafe().setSelSize(1);
     auto nodeIDVector = &dataChunk.getValueVectorMutable(0);
     auto dfVector = &dataChunk.getValueVectorMutable(1);
+    auto maxTFVector = &dataChunk.getValueVectorMutable(2);
     auto termsVector = ValueVector(LogicalType::STRING(), MemoryManager::Get(context));
     termsVector.state = dataChunk.state;
-    auto nodeTableScanState =
-        NodeTableScanState(nodeIDVector, std::vector{dfVector}, dataChunk.state);
+    std::vector<ValueVector*> outVectors{dfVector};
+    std::vector<column_id_t> columnIDs{termsEntry->getColumnID(DOC_FREQUENCY_PROP_NAME)};
+    if (hasMaxTF) {
+        outVectors.push_back(maxTFVector);
+        columnIDs.push_back(termsEntry->getColumnID(MAX_TERM_FREQUENCY_PROP_NAME));
+    }
+    auto nodeTableScanState = NodeTableScanState(nodeIDVector, outVectors, dataChunk.state);
     nodeTableScanState.setToTable(transaction::Transaction::Get(context), &termsNodeTable,
-        {dfColumnID}, {});
-    std::unordered_map<offset_t, uint64_t> dfs;
+        columnIDs, {});
+    query_term_infos_t termInfos;
     std::vector<VCQueryTerm> vcQueryTerms;
     vcQueryTerms.reserve(queryTerms.size());
     bool hasWildcardQueryTerm = false;
@@ -324,24 +362,37 @@ static std::unordered_map<offset_t, uint64_t> getDFs(main::ClientContext& contex
         }
     }
     if (hasWildcardQueryTerm) {
-        auto matchVc = MatchTermsVertexCompute{dfs, vcQueryTerms};
+        auto matchVc = MatchTermsVertexCompute{termInfos, vcQueryTerms, hasMaxTF};
+        std::vector<std::string> properties{"term", DOC_FREQUENCY_PROP_NAME};
+        if (hasMaxTF) {
+            properties.push_back(MAX_TERM_FREQUENCY_PROP_NAME);
+        }
         GDSUtils::runVertexCompute(executionContext, GDSDensityState::DENSE, graph, matchVc,
-            termsEntry, std::vector<std::string>{"term", DOC_FREQUENCY_PROP_NAME});
+            termsEntry, properties);
     } else {
         for (auto& queryTerm : queryTerms) {
             termsVector.setValue(0, queryTerm);
             offset_t offset = 0;
             if (!termsNodeTable.lookupPK(tx, &termsVector, 0 /* vectorPos */, offset)) {
+                if (termOffsets != nullptr) {
+                    termOffsets->push_back(INVALID_OFFSET);
+                }
                 continue;
             }
+            if (termOffsets != nullptr) {
+                termOffsets->push_back(offset);
+            }
             auto nodeID = nodeID_t{offset, tableID};
             nodeIDVector->setValue(0, nodeID);
             termsNodeTable.initScanState(tx, nodeTableScanState, tableID, offset);
             [[maybe_unused]] auto res = termsNodeTable.lookup(tx, nodeTableScanState);
-            dfs.emplace(offset, dfVector->getValue<uint64_t>(0));
+            termInfos.emplace(offset,
+                QueryTermInfo{dfVector->getValue<uint64_t>(0),
+                    hasMaxTF ? maxTFVector->getValue<uint64_t>(0) : QueryTermInfo::UNKNOWN_MAX_TF});
         }
     }
-    return dfs;
+    KU_ASSERT(termOffsets == nullptr || !hasWildcardQueryTerm);
+    return termInfos;
 }
 
 static uint64_t getNumUniqueTerms(const std::vector<std::string>& terms) {
@@ -361,13 +412,395 @@ static uint64_t getSparseFrontierSize(uint64_t numRows) {
 }
 
 static void initFrontier(FrontierPair& frontierPair, table_id_t termsTableID,
-    const std::unordered_map<offset_t, uint64_t>& dfs) {
+    const query_term_infos_t& termInfos) {
     frontierPair.pinNextFrontier(termsTableID);
-    for (auto& [offset, _] : dfs) {
+    for (auto& [offset, _] : termInfos) {
         frontierPair.addNodeToNextFrontier(offset);
     }
 }
 
+// Highest score the term can contribute to a doc. The score of a term grows with its frequency and
+// decreases with the length of the doc, which is at least the frequency of the term.
+static double getMaxImpact(double idf, uint64_t maxTF, double avgDocLen, double k, double b) {
+    if (maxTF == QueryTermInfo::UNKNOWN_MAX_TF) {
+        // Limit of the score as the frequency grows.
+        return idf * (k + 1) / (1 + k * b / avgDocLen);
+    }
+    return getTermScore(idf, maxTF, maxTF, avgDocLen, k, b);
+}
+
+// Evaluates disjunctive top-k queries term-at-a-time with MaxScore pruning. Terms are processed in
+// decreasing order of their max impact. Once the k-th best score so far is at least the sum of the
+// max impacts of the remaining terms, a doc which none of the processed terms appear in can't make
+// it into the top-k anymore, so the remaining terms only add to the scores of current candidates,
+// and candidates which can't reach the k-th best score even with all remaining terms are dropped.
+// If it is cheaper, the remaining candidates are then scored by scanning their terms instead of
+// the postings of the remaining terms. Postings are read from the compressed posting lists for the
+// terms they are up to date for, and from the appears_in table otherwise.
+class MaxScoreTopKEvaluator {
+    struct Term {
+        offset_t offset;
+        double idf;
+        double maxImpact;
+        uint64_t df;
+        bool inPostingLists;
+    };
+
+    struct Candidate {
+        double score;
+        uint64_t len;
+        int64_t docID;
+    };
+
+public:
+    MaxScoreTopKEvaluator(graph::Graph* graph, const FTSPostingLists* postingLists,
+        const QueryFTSBindData& bindData, const query_term_infos_t& termInfos, uint64_t topK);
+
+    void evaluate(MemoryManager* mm, QFTSSharedState& sharedState);
+
+private:
+    double getScore(const Term& term, uint64_t tf, uint64_t len) const {
+        return getTermScore(term.idf, tf, len, bindData.avgDocLen, k, b);
+    }
+    bool canAdmitNewDocs(idx_t termIdx) const {
+        return candidates.size() < topK || threshold < remainingMaxImpacts[termIdx];
+    }
+    void pruneCandidates(idx_t termIdx);
+    void scanPostings(idx_t termIdx, bool admitNewDocs);
+    void probeCandidates(idx_t termIdx);
+    void updateThreshold();
+
+private:
+    graph::Graph* graph;
+    const FTSPostingLists* postingLists;
+    const QueryFTSBindData& bindData;
+    uint64_t topK;
+    double k;
+    double b;
+    table_id_t termsTableID;
+    table_id_t docsTableID;
+    std::vector<Term> terms;
+    // remainingMaxImpacts[i] and remainingDFs[i] are the sums over the terms from i onwards.
+    std::vector<double> remainingMaxImpacts;
+    std::vector<uint64_t> remainingDFs;
+    std::unordered_map<offset_t, idx_t> termIdxes;
+    std::unordered_map<offset_t, Candidate> candidates;
+    // The k-th best score of the candidates, once there are at least k of them.
+    double threshold;
+    bool canProbe;
+    std::unique_ptr<graph::NbrScanState> nbrScanState;
+    std::unique_ptr<graph::VertexScanState> vertexScanState;
+};
+
+MaxScoreTopKEvaluator::MaxScoreTopKEvaluator(graph::Graph* graph,
+    const FTSPostingLists* postingLists, const QueryFTSBindData& bindData,
+    const query_term_infos_t& termInfos, uint64_t topK)
+    : graph{graph}, postingLists{postingLists}, bindData{bindData}, topK{topK}, threshold{0} {
+    auto& optionalParams = bindData.optionalParams->constCast<QueryFTSOptionalParams>();
+    k = optionalParams.k.getParamVal();
+    b = optionalParams.b.getParamVal();
+    auto graphEntry = graph->getGraphEntry();
+    termsTableID = graphEntry->nodeInfos[0].entry->getTableID();
+    auto docsEntry = graphEntry->nodeInfos[1].entry;
+    docsTableID = docsEntry->getTableID();
+    for (auto& [offset, termInfo] : termInfos) {
+        auto idf = getIDF(bindData.numDocs, termInfo.df);
+        terms.push_back(Term{offset, idf,
+            getMaxImpact(idf, termInfo.maxTF, bindData.avgDocLen, k, b), termInfo.df,
+            termInfo.inPostingLists});
+    }
+    std::sort(terms.begin(), terms.end(),
+        [](const Term& left, const Term& right) { return left.maxImpact > right.maxImpact; });
+    remainingMaxImpacts.resize(terms.size() + 1, 0);
+    remainingDFs.resize(terms.size() + 1, 0);
+    for (auto i = terms.size(); i > 0; i--) {
+        remainingMaxImpacts[i - 1] = remainingMaxImpacts[i] + terms[i - 1].maxImpact;
+        remainingDFs[i - 1] = remainingDFs[i] + terms[i - 1].df;
+        termIdxes.emplace(terms[i - 1].offset, i - 1);
+    }
+    auto relEntry = graphEntry->relInfos[0].entry;
+    auto& relGroupEntry = relEntry->constCast<catalog::RelGroupCatalogEntry>();
+    auto directions = relGroupEntry.getRelDataDirections();
+    canProbe = std::find(directions.begin(), directions.end(), RelDataDirection::BWD) !=
+               directions.end();
+    nbrScanState = graph->prepareRelScan(*relEntry, relGroupEntry.getSingleRelEntryInfo().oid,
+        docsTableID, {TERM_FREQUENCY_PROP_NAME});
+    vertexScanState = graph->prepareVertexScan(docsEntry, {DOC_LEN_PROP_NAME, DOC_ID_PROP_NAME});
+}
+
+void MaxScoreTopKEvaluator::evaluate(MemoryManager* mm, QFTSSharedState& sharedState) {
+    for (auto i = 0u; i < terms.size(); i++) {
+        auto admitNewDocs = canAdmitNewDocs(i);
+        if (!admitNewDocs) {
+            pruneCandidates(i);
+            // Probing a candidate scans all terms of its doc.
+            if (canProbe && candidates.size() * bindData.avgDocLen < remainingDFs[i]) {
+                probeCandidates(i);
+                break;
+            }
+        }
+        scanPostings(i, admitNewDocs);
+        updateThreshold();
+    }
+    auto localFT = sharedState.factorizedTablePool.claimLocalTable(mm);
+    ScoreFTInsertState insertState;
+    for (auto& [_, candidate] : candidates) {
+        sharedState.addDocScore(insertState.vectors, *localFT,
+            {(offset_t)candidate.docID, candidate.score});
+    }
+    sharedState.factorizedTablePool.returnLocalTable(localFT);
+}
+
+void MaxScoreTopKEvaluator::pruneCandidates(idx_t termIdx) {
+    auto remainingMaxImpact = remainingMaxImpacts[termIdx];
+    std::erase_if(candidates, [&](const auto& entry) {
+        return entry.second.score + remainingMaxImpact < threshold;
+    });
+}
+
+void MaxScoreTopKEvaluator::scanPostings(idx_t termIdx, bool admitNewDocs) {
+    auto& term = terms[termIdx];
+    std::vector<std::pair<offset_t, uint64_t>> newDocs;
+    auto processPosting = [&](offset_t docOffset, uint64_t tf) {
+        auto it = candidates.find(docOffset);
+        if (it != candidates.end()) {
+            it->second.score += getScore(term, tf, it->second.len);
+        } else if (admitNewDocs) {
+            newDocs.emplace_back(docOffset, tf);
+        }
+    };
+    if (term.inPostingLists) {
+        // Postings are already in offset order.
+        postingLists->forEachPosting(term.offset, processPosting);
+    } else {
+        for (auto chunk : graph->scanFwd(nodeID_t{term.offset, termsTableID}, *nbrScanState)) {
+            chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                processPosting(neighbors[i].offset,
+                    propertyVectors[0]->template getValue<uint64_t>(i));
+            });
+        }
+        // Look up the length of new docs in offset order.
+        std::sort(newDocs.begin(), newDocs.end());
+    }
+    for (auto& [docOffset, tf] : newDocs) {
+        for (auto chunk : graph->scanVertices(docOffset, docOffset + 1, *vertexScanState)) {
+            auto len = chunk.getProperties<uint64_t>(0)[0];
+            auto docID = chunk.getProperties<int64_t>(1)[0];
+            candidates.emplace(docOffset, Candidate{getScore(term, tf, len), len, docID});
+        }
+    }
+}
+
+void MaxScoreTopKEvaluator::probeCandidates(idx_t termIdx) {
+    for (auto& [docOffset, candidate] : candidates) {
+        for (auto chunk : graph->scanBwd(nodeID_t{docOffset, docsTableID}, *nbrScanState)) {
+            chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                auto it = termIdxes.find(neighbors[i].offset);
+                if (it == termIdxes.end() || it->second < termIdx) {
+                    return;
+                }
+                auto tf = propertyVectors[0]->template getValue<uint64_t>(i);
+                candidate.score += getScore(terms[it->second], tf, candidate.len);
+            });
+        }
+    }
+}
+
+void MaxScoreTopKEvaluator::updateThreshold() {
+    if (candidates.size() < topK) {
+        return;
+    }
+    std::vector<double> scores;
+    scores.reserve(candidates.size());
+    for (auto& [_, candidate] : candidates) {
+        scores.push_back(candidate.score);
+    }
+    std::nth_element(scores.begin(), scores.begin() + (topK - 1), scores.end(),
+        std::greater<double>());
+    threshold = scores[topK - 1];
+}
+
+// Evaluates phrase queries by intersecting the positions of the query terms in the docs which
+// contain all of them, without reading the content of the docs. The terms of the phrase must occur
+// in the order of the query, with the distance between consecutive terms being their distance in
+// the query plus at most slop extra positions. Terms are scanned in increasing order of their df,
+// so only the docs containing the rarest term are kept as candidates.
+class PhraseEvaluator {
+    struct PhraseTerm {
+        offset_t offset;
+        uint32_t queryPosition;
+    };
+
+    struct Candidate {
+        // The positions of each distinct term of the phrase in the doc.
+        std::vector<std::vector<uint32_t>> positions;
+        std::vector<uint64_t> tfs;
+    };
+
+public:
+    PhraseEvaluator(graph::Graph* graph, const query_term_infos_t& termInfos,
+        const std::vector<offset_t>& termOffsets, const std::vector<uint32_t>& queryPositions,
+        uint64_t slop);
+
+    // Adds the scores of the terms of the phrase to the docs matching the phrase.
+    void evaluate(node_id_map_t<ScoreInfo>& scores);
+
+private:
+    void scanTerm(idx_t termIdx, bool admitNewDocs);
+    bool matches(const Candidate& candidate) const;
+
+private:
+    graph::Graph* graph;
+    const query_term_infos_t& termInfos;
+    uint64_t slop;
+    table_id_t termsTableID;
+    table_id_t docsTableID;
+    std::vector<PhraseTerm> phraseTerms;
+    // The distinct terms of the phrase and the index of each term of the phrase in them.
+    std::vector<offset_t> distinctTerms;
+    std::vector<idx_t> distinctTermIdxes;
+    std::unordered_map<offset_t, Candidate> candidates;
+    std::unique_ptr<graph::NbrScanState> nbrScanState;
+};
+
+PhraseEvaluator::PhraseEvaluator(graph::Graph* graph, const query_term_infos_t& termInfos,
+    const std::vector<offset_t>& termOffsets, const std::vector<uint32_t>& queryPositions,
+    uint64_t slop)
+    : graph{graph}, termInfos{termInfos}, slop{slop} {
+    KU_ASSERT(termOffsets.size() == queryPositions.size());
+    auto graphEntry = graph->getGraphEntry();
+    termsTableID = graphEntry->nodeInfos[0].entry->getTableID();
+    docsTableID = graphEntry->nodeInfos[1].entry->getTableID();
+    std::unordered_map<offset_t, idx_t> termIdxes;
+    for (auto i = 0u; i < termOffsets.size(); i++) {
+        phraseTerms.push_back(PhraseTerm{termOffsets[i], queryPositions[i]});
+        if (!termIdxes.contains(termOffsets[i])) {
+            termIdxes.emplace(termOffsets[i], distinctTerms.size());
+            distinctTerms.push_back(termOffsets[i]);
+        }
+        distinctTermIdxes.push_back(termIdxes.at(termOffsets[i]));
+    }
+    auto relEntry = graphEntry->relInfos[0].entry;
+    auto& relGroupEntry = relEntry->constCast<catalog::RelGroupCatalogEntry>();
+    nbrScanState = graph->prepareRelScan(*relEntry, relGroupEntry.getSingleRelEntryInfo().oid,
+        docsTableID, {TERM_FREQUENCY_PROP_NAME, POSITIONS_PROP_NAME});
+}
+
+void PhraseEvaluator::evaluate(node_id_map_t<ScoreInfo>& scores) {
+    std::vector<idx_t> scanOrder(distinctTerms.size());
+    for (auto i = 0u; i < scanOrder.size(); i++) {
+        scanOrder[i] = i;
+    }
+    std::sort(scanOrder.begin(), scanOrder.end(), [&](idx_t left, idx_t right) {
+        return termInfos.at(distinctTerms[left]).df < termInfos.at(distinctTerms[right]).df;
+    });
+    for (auto i = 0u; i < scanOrder.size(); i++) {
+        scanTerm(scanOrder[i], i == 0 /* admitNewDocs */);
+        if (candidates.empty()) {
+            return;
+        }
+    }
+    for (auto& [docOffset, candidate] : candidates) {
+        if (!matches(candidate)) {
+            continue;
+        }
+        auto& scoreInfo = scores[nodeID_t{docOffset, docsTableID}];
+        for (auto i = 0u; i < distinctTerms.size(); i++) {
+            scoreInfo.addEdge(termInfos.at(distinctTerms[i]).df, candidate.tfs[i]);
+        }
+    }
+}
+
+void PhraseEvaluator::scanTerm(idx_t termIdx, bool admitNewDocs) {
+    std::unordered_set<offset_t> docsWithTerm;
+    for (auto chunk : graph->scanFwd(nodeID_t{distinctTerms[termIdx], termsTableID},
+             *nbrScanState)) {
+        chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+            auto docOffset = neighbors[i].offset;
+            auto it = candidates.find(docOffset);
+            if (it == candidates.end()) {
+                if (!admitNewDocs) {
+                    return;
+                }
+                it = candidates.emplace(docOffset, Candidate{}).first;
+                it->second.positions.resize(distinctTerms.size());
+                it->second.tfs.resize(distinctTerms.size(), 0);
+            }
+            it->second.tfs[termIdx] = propertyVectors[0]->template getValue<uint64_t>(i);
+            auto positions = propertyVectors[1]->template getValue<ku_string_t>(i);
+            PositionsCodec::decode(std::span{positions.getData(), positions.len},
+                it->second.positions[termIdx]);
+            docsWithTerm.insert(docOffset);
+        });
+    }
+    std::erase_if(candidates,
+        [&](const auto& entry) { return !docsWithTerm.contains(entry.first); });
+}
+
+bool PhraseEvaluator::matches(const Candidate& candidate) const {
+    // The positions at which the phrase can be matched up to the current term.
+    std::vector<uint32_t> reachable = candidate.positions[distinctTermIdxes[0]];
+    std::vector<uint32_t> nextReachable;
+    for (auto i = 1u; i < phraseTerms.size(); i++) {
+        auto minDistance = phraseTerms[i].queryPosition - phraseTerms[i - 1].queryPosition;
+        auto maxDistance = minDistance + slop;
+        nextReachable.clear();
+        // Both lists are sorted, so the reachable positions are merged with the positions of the
+        // term.
+        auto reachableIdx = 0u;
+        for (auto position : candidate.positions[distinctTermIdxes[i]]) {
+            while (reachableIdx < reachable.size() &&
+                   reachable[reachableIdx] + maxDistance < position) {
+                reachableIdx++;
+            }
+            if (reachableIdx < reachable.size() &&
+                reachable[reachableIdx] + minDistance <= position) {
+                nextReachable.push_back(position);
+            }
+        }
+        if (nextReachable.empty()) {
+            return false;
+        }
+        std::swap(reachable, nextReachable);
+    }
+    return !reachable.empty();
+}
+
+static FTSIndex& getFTSIndex(main::ClientContext& context,
+    const catalog::IndexCatalogEntry& indexEntry) {
+    auto nodeTable =
+        StorageManager::Get(context)->getTable(indexEntry.getTableID())->ptrCast<NodeTable>();
+    auto index = nodeTable->getIndex(indexEntry.getIndexName());
+    KU_ASSERT(index.has_value());
+    return index.value()->cast<FTSIndex>();
+}
+
+// Marks the query terms whose postings can be read from the posting lists. The lists of the terms
+// modified since they were built are out of date.
+static void setInPostingLists(FTSIndex& index, const FTSPostingLists* postingLists,
+    query_term_infos_t& termInfos) {
+    if (postingLists == nullptr) {
+        return;
+    }
+    for (auto& [termOffset, termInfo] : termInfos) {
+        termInfo.inPostingLists = !index.isTermModified(termOffset);
+    }
+}
+
+// Accumulates the postings of the query terms from the compressed posting lists.
+static void scanPostingLists(const FTSPostingLists& postingLists,
+    const query_term_infos_t& termInfos, table_id_t docsTableID,
+    node_id_map_t<ScoreInfo>& scores) {
+    for (auto& [termOffset, termInfo] : termInfos) {
+        if (!termInfo.inPostingLists) {
+            continue;
+        }
+        postingLists.forEachPosting(termOffset, [&](offset_t docOffset, uint64_t tf) {
+            scores[nodeID_t{docOffset, docsTableID}].addEdge(termInfo.df, tf);
+        });
+    }
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto& clientContext = *input.context->clientContext;
     auto transaction = transaction::Transaction::Get(clientContext);
@@ -380,37 +813,84 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         sharedState->ptrCast<QFTSTopKSharedState>()->setTopK(qFTSOptionalParams.topK.getParamVal());
     }
     auto termsEntry = graphEntry->nodeInfos[0].entry;
-    auto queryTerms = qFTSBindData.getQueryTerms(clientContext);
-    auto dfs = getDFs(clientContext, input.context, graph, termsEntry, queryTerms);
+    auto isPhrase = qFTSOptionalParams.phrase.getParamVal();
+    auto& ftsIndex = getFTSIndex(clientContext, qFTSBindData.entry);
+    if (isPhrase && !ftsIndex.getInternalTableInfo().hasPositionsColumn()) {
+        throw RuntimeException{stringFormat(
+            "Phrase queries require the index {} to be created with {} := true.",
+            qFTSBindData.entry.getIndexName(), Positions::NAME)};
+    }
+    std::vector<uint32_t> queryPositions;
+    auto queryTerms =
+        qFTSBindData.getQueryTerms(clientContext, isPhrase ? &queryPositions : nullptr);
+    std::vector<offset_t> termOffsets;
+    if (isPhrase) {
+        for (auto& queryTerm : queryTerms) {
+            if (FTSUtils::hasWildcardPattern(queryTerm)) {
+                throw RuntimeException{"Phrase queries can't contain wildcards."};
+            }
+        }
+    }
+    auto termInfos = getQueryTermInfos(clientContext, input.context, graph, termsEntry, queryTerms,
+        isPhrase ? &termOffsets : nullptr);
+    auto mm = MemoryManager::Get(clientContext);
+    auto postingLists = ftsIndex.getPostingLists();
+    setInPostingLists(ftsIndex, postingLists, termInfos);
     // Do edge compute to extend terms -> docs and save the term frequency and document frequency
     // for each term-doc pair. The reason why we store the term frequency and document frequency
     // is that: we need the `len` property from the docs table which is only available during the
     // vertex compute.
-    auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto nextFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(std::move(currentFrontier),
-        std::move(nextFrontier));
-    auto termsTableID = termsEntry->getTableID();
-    initFrontier(*frontierPair, termsTableID, dfs);
-    auto storageManager = StorageManager::Get(clientContext);
-    frontierPair->setActiveNodesForNextIter();
-
     node_id_map_t<ScoreInfo> scores;
-    auto edgeCompute = std::make_unique<QFTSEdgeCompute>(scores, dfs);
-    auto auxiliaryState = std::make_unique<EmptyGDSAuxiliaryState>();
-    auto compState =
-        GDSComputeState(std::move(frontierPair), std::move(edgeCompute), std::move(auxiliaryState));
-    GDSUtils::runFTSEdgeCompute(input.context, compState, graph, ExtendDirection::FWD,
-        {TERM_FREQUENCY_PROP_NAME});
+    auto storageManager = StorageManager::Get(clientContext);
+    auto docsEntry = graphEntry->nodeInfos[1].entry;
+    if (isPhrase) {
+        // A doc can only match the phrase if all terms of the phrase are in the index.
+        if (!queryTerms.empty() &&
+            std::find(termOffsets.begin(), termOffsets.end(), INVALID_OFFSET) ==
+                termOffsets.end()) {
+            auto evaluator = PhraseEvaluator{graph, termInfos, termOffsets, queryPositions,
+                qFTSOptionalParams.slop.getParamVal()};
+            evaluator.evaluate(scores);
+        }
+    } else if (qFTSOptionalParams.topK.isSet() && !qFTSOptionalParams.conjunctive.getParamVal()) {
+        auto evaluator = MaxScoreTopKEvaluator{graph, postingLists, qFTSBindData, termInfos,
+            qFTSOptionalParams.topK.getParamVal()};
+        evaluator.evaluate(mm, *sharedState);
+        sharedState->finalizeResult();
+        return 0;
+    } else if (postingLists != nullptr) {
+        scanPostingLists(*postingLists, termInfos, docsEntry->getTableID(), scores);
+    }
+    // The postings of the other terms are scanned from the appears_in table.
+    query_term_infos_t termInfosToScan;
+    for (auto& [termOffset, termInfo] : termInfos) {
+        if (!isPhrase && !termInfo.inPostingLists) {
+            termInfosToScan.emplace(termOffset, termInfo);
+        }
+    }
+    if (!termInfosToScan.empty()) {
+        auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+        auto nextFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+        auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(
+            std::move(currentFrontier), std::move(nextFrontier));
+        auto termsTableID = termsEntry->getTableID();
+        initFrontier(*frontierPair, termsTableID, termInfosToScan);
+        frontierPair->setActiveNodesForNextIter();
+
+        auto edgeCompute = std::make_unique<QFTSEdgeCompute>(scores, termInfosToScan);
+        auto auxiliaryState = std::make_unique<EmptyGDSAuxiliaryState>();
+        auto compState = GDSComputeState(std::move(frontierPair), std::move(edgeCompute),
+            std::move(auxiliaryState));
+        GDSUtils::runFTSEdgeCompute(input.context, compState, graph, ExtendDirection::FWD,
+            {TERM_FREQUENCY_PROP_NAME});
+    }
 
     // Do vertex compute to calculate the score for doc with the length property.
-    auto mm = MemoryManager::Get(clientContext);
     auto numUniqueTerms = getNumUniqueTerms(queryTerms);
     auto writer =
         std::make_unique<QFTSOutputWriter>(scores, mm, qFTSBindData, numUniqueTerms, *sharedState);
     auto vc = std::make_unique<QFTSVertexCompute>(mm, sharedState, std::move(writer));
     auto vertexPropertiesToScan = std::vector<std::string>{DOC_LEN_PROP_NAME, DOC_ID_PROP_NAME};
-    auto docsEntry = graphEntry->nodeInfos[1].entry;
     auto numDocs = storageManager->getTable(docsEntry->getTableID())->getNumTotalRows(transaction);
     if (scores.size() < getSparseFrontierSize(numDocs)) {
         auto vertexScanState = graph->prepareVertexScan(docsEntry, vertexPropertiesToScan);
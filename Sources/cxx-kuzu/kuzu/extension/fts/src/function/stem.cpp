@@ -10,6 +10,7 @@
 #include "expression_evaluator/expression_evaluator_utils.h"
 #include "function/scalar_function.h"
 #include "libstemmer.h"
+#include "utils/fts_utils.h"
 
 namespace kuzu {
 namespace fts_extension {
@@ -40,20 +41,15 @@ void Stem::operation(common::ku_string_t& word, common::ku_string_t& stemmer,
         return;
     }
 
-    struct sb_stemmer* sbStemmer =
-        sb_stemmer_new(reinterpret_cast<const char*>(stemmer.getData()), "UTF_8");
-    if (sbStemmer == nullptr) {
+    auto termStemmer = TermStemmer::getThreadLocal(stemmer.getAsString());
+    if (termStemmer == nullptr) {
         throw common::RuntimeException(
             common::stringFormat("Unrecognized stemmer '{}'. Supported stemmers are: ['{}'], or "
                                  "use 'none' for no stemming.",
                 stemmer.getAsString(), getStemmerList()));
     }
-
-    auto stemData =
-        sb_stemmer_stem(sbStemmer, reinterpret_cast<const sb_symbol*>(word.getData()), word.len);
-    common::StringVector::addString(&resultVector, result, reinterpret_cast<const char*>(stemData),
-        sb_stemmer_length(sbStemmer));
-    sb_stemmer_delete(sbStemmer);
+    auto& stem = termStemmer->stem(reinterpret_cast<const char*>(word.getData()), word.len);
+    common::StringVector::addString(&resultVector, result, stem.data(), stem.length());
 }
 
 struct StemStaticStemmer {
@@ -70,8 +66,9 @@ struct StemWithoutStemmer {
         void* dataPtr);
 };
 
+// Stems are computed by the stemmer of the evaluating thread, since snowball stemmers can't be used
+// concurrently.
 struct StemBindData final : public FunctionBindData {
-    sb_stemmer* sbStemmer = nullptr;
     std::string stemmer;
 
     StemBindData(common::logical_type_vec_t paramTypes, const std::string& stemmer)
@@ -79,8 +76,7 @@ struct StemBindData final : public FunctionBindData {
         if (stemmer == "none") {
             return;
         }
-        sbStemmer = sb_stemmer_new(stemmer.c_str(), "UTF_8");
-        if (sbStemmer == nullptr) {
+        if (TermStemmer::getThreadLocal(stemmer) == nullptr) {
             throw common::RuntimeException(common::stringFormat(
                 "Unrecognized stemmer '{}'. Supported stemmers are: ['{}'], or "
                 "use 'none' for no stemming.",
@@ -88,8 +84,6 @@ struct StemBindData final : public FunctionBindData {
         }
     }
 
-    ~StemBindData() override { sb_stemmer_delete(sbStemmer); }
-
     std::unique_ptr<FunctionBindData> copy() const override {
         return std::make_unique<StemBindData>(copyVector(paramTypes), stemmer);
     }
@@ -99,11 +93,10 @@ void StemStaticStemmer::operation(common::ku_string_t& word, common::ku_string_t
     common::ku_string_t& result, common::ValueVector& /*leftValueVector*/,
     common::ValueVector& /*rightValueVector*/, common::ValueVector& resultVector, void* dataPtr) {
     auto stemBindData = reinterpret_cast<StemBindData*>(dataPtr);
-    KU_ASSERT(stemBindData->sbStemmer != nullptr);
-    auto stemData = sb_stemmer_stem(stemBindData->sbStemmer,
-        reinterpret_cast<const sb_symbol*>(word.getData()), word.len);
-    common::StringVector::addString(&resultVector, result, reinterpret_cast<const char*>(stemData),
-        sb_stemmer_length(stemBindData->sbStemmer));
+    auto termStemmer = TermStemmer::getThreadLocal(stemBindData->stemmer);
+    KU_ASSERT(termStemmer != nullptr);
+    auto& stem = termStemmer->stem(reinterpret_cast<const char*>(word.getData()), word.len);
+    common::StringVector::addString(&resultVector, result, stem.data(), stem.length());
 }
 
 void StemWithoutStemmer::operation(common::ku_string_t& word, common::ku_string_t& /*stemmer*/,
@@ -10,6 +10,7 @@
 #include "expression_evaluator/expression_evaluator_utils.h"
 #include "function/scalar_function.h"
 #include "re2.h"
+#include "utils/fts_utils.h"
 
 namespace kuzu {
 namespace fts_extension {
@@ -73,12 +74,8 @@ static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& inp
         std::string dictDir = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(
             input.arguments[2], input.context)
                                   .getValue<std::string>();
-        std::string dict = dictDir + "/jieba.dict.utf8";
-        std::string hmm = dictDir + "/hmm_model.utf8";
-        std::string user = dictDir + "/user.dict.utf8"; // Contains custom AI/ML terms
-        std::string idf = dictDir + "/idf.utf8";
-        std::string stop = dictDir + "/stop_words.utf8";
-        auto jieba = std::make_unique<cppjieba::Jieba>(dict, hmm, user, idf, stop);
+        // The dictionaries are loaded once and shared by the queries tokenizing with them.
+        auto jieba = FTSUtils::getJieba(dictDir);
         input.definition->ptrCast<ScalarFunction>()->execFunc =
             ScalarFunction::TernaryRegexExecFunction<ku_string_t, ku_string_t, ku_string_t,
                 list_entry_t, JiebaTokenizer>;
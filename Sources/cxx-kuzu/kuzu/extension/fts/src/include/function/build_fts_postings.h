@@ -0,0 +1,15 @@
+#pragma once
+
+#include "function/function.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+struct InternalBuildFTSPostingsFunction {
+    static constexpr const char* name = "_BUILD_FTS_POSTINGS";
+
+    static function::function_set getFunctionSet();
+};
+
+} // namespace fts_extension
+} // namespace kuzu
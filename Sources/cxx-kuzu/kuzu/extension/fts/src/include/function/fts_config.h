@@ -62,6 +62,13 @@ struct Tokenizer {
     static void validate(const std::string& tokenizer);
 };
 
+// Whether the index records the positions of the terms in the docs, which phrase queries need.
+struct Positions {
+    static constexpr const char* NAME = "positions";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
 struct TokenizerInfo {
     std::string tokenizer = Tokenizer::DEFAULT_VALUE;
     std::string jiebaDictDir =
@@ -78,6 +85,7 @@ struct CreateFTSConfig {
     std::string ignorePattern = IgnorePattern::DEFAULT_VALUE;
     std::string ignorePatternQuery = IgnorePattern::DEFAULT_VALUE_QUERY;
     TokenizerInfo tokenizerInfo;
+    bool positions = Positions::DEFAULT_VALUE;
 
     CreateFTSConfig() = default;
     CreateFTSConfig(main::ClientContext& context, common::table_id_t tableID,
@@ -138,5 +146,21 @@ struct TopK {
     static void validate(uint64_t value);
 };
 
+// Only matches the docs containing the query terms in the order and at the relative positions
+// they have in the query.
+struct Phrase {
+    static constexpr const char* NAME = "phrase";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+// Number of extra positions allowed between consecutive terms of a phrase, which turns the phrase
+// into an ordered proximity (NEAR) query.
+struct Slop {
+    static constexpr const char* NAME = "slop";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::UINT64;
+    static constexpr uint64_t DEFAULT_VALUE = 0;
+};
+
 } // namespace fts_extension
 } // namespace kuzu
@@ -13,19 +13,23 @@ struct QueryFTSOptionalParams : public function::OptionalParams {
     function::OptionalParam<B> b;
     function::OptionalParam<Conjunctive> conjunctive;
     function::OptionalParam<TopK> topK;
+    function::OptionalParam<Phrase> phrase;
+    function::OptionalParam<Slop> slop;
 
     explicit QueryFTSOptionalParams(const binder::expression_vector& optionalParams);
 
     // For copy only.
     QueryFTSOptionalParams(function::OptionalParam<K> k, function::OptionalParam<B> b,
-        function::OptionalParam<Conjunctive> conjunctive, function::OptionalParam<TopK> topK)
+        function::OptionalParam<Conjunctive> conjunctive, function::OptionalParam<TopK> topK,
+        function::OptionalParam<Phrase> phrase, function::OptionalParam<Slop> slop)
         : k{std::move(k)}, b{std::move(b)}, conjunctive{std::move(conjunctive)},
-          topK{std::move(topK)} {}
+          topK{std::move(topK)}, phrase{std::move(phrase)}, slop{std::move(slop)} {}
 
     void evaluateParams(main::ClientContext* context) override;
 
     std::unique_ptr<function::OptionalParams> copy() override {
-        return std::make_unique<QueryFTSOptionalParams>(k, b, conjunctive, topK);
+        return std::make_unique<QueryFTSOptionalParams>(k, b, conjunctive, topK, phrase,
+            slop);
     }
 };
 
@@ -54,7 +58,9 @@ struct QueryFTSBindData final : public function::GDSBindData {
         : GDSBindData{other}, query{other.query}, entry{other.entry},
           outputTableID{other.outputTableID}, numDocs{other.numDocs}, avgDocLen{other.avgDocLen} {}
 
-    std::vector<std::string> getQueryTerms(main::ClientContext& context) const;
+    // If positions is given, the positions of the terms in the query are appended to it.
+    std::vector<std::string> getQueryTerms(main::ClientContext& context,
+        std::vector<uint32_t>* positions = nullptr) const;
 
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<QueryFTSBindData>(*this);
@@ -1,10 +1,18 @@
 #pragma once
 
+#include <mutex>
+
 #include "function/fts_config.h"
 #include "index/fts_internal_table_info.h"
+#include "index/fts_posting_lists.h"
 #include "storage/index/index.h"
+#include "storage/page_range.h"
 
 namespace kuzu {
+namespace regex {
+class RE2;
+}
+
 namespace fts_extension {
 
 struct FTSInsertState;
@@ -15,10 +23,16 @@ struct FTSStorageInfo final : storage::IndexStorageInfo {
     common::idx_t numDocs = 0;
     double avgDocLen = 0;
     common::offset_t numCheckpointedNodes;
+    // Pages of the data file holding the directory of the posting lists, see FTSPostingLists.
+    // Empty if the posting lists haven't been persisted.
+    storage::PageRange postingListsPageRange;
+    uint64_t postingListsNumBytes = 0;
 
     FTSStorageInfo(common::idx_t numDocs, double avgDocLen, common::offset_t numCheckpointedNodes)
         : numDocs{numDocs}, avgDocLen{avgDocLen}, numCheckpointedNodes{numCheckpointedNodes} {}
 
+    bool hasPostingLists() const { return postingListsNumBytes > 0; }
+
     std::shared_ptr<common::BufferWriter> serialize() const override;
 
     static std::unique_ptr<IndexStorageInfo> deserialize(
@@ -29,6 +43,7 @@ class FTSIndex final : public storage::Index {
 public:
     FTSIndex(storage::IndexInfo indexInfo, std::unique_ptr<storage::IndexStorageInfo> storageInfo,
         FTSConfig ftsConfig, main::ClientContext* context);
+    ~FTSIndex() override;
 
     static std::unique_ptr<Index> load(main::ClientContext* context,
         storage::StorageManager* storageManager, storage::IndexInfo indexInfo,
@@ -63,6 +78,18 @@ public:
     }
     FTSInternalTableInfo& getInternalTableInfo() { return internalTableInfo; }
 
+    // Returns the posting lists, or nullptr if they haven't been built. The lists of modified terms
+    // are out of date, see isTermModified().
+    const FTSPostingLists* getPostingLists();
+    // Returns true if the postings of the term have changed since the posting lists were built, in
+    // which case they must be scanned from the appears_in table.
+    bool isTermModified(common::offset_t termOffset);
+    // Builds the posting lists from the appears_in table, or only writes the changes to the lists
+    // of the modified terms if there are lists already. They are persisted in pages allocated from
+    // pageAllocator, or only kept in memory if pageAllocator is null.
+    void buildPostingLists(main::ClientContext* context, transaction::Transaction* transaction,
+        storage::PageAllocator* pageAllocator);
+
 private:
     common::nodeID_t insertToDocTable(transaction::Transaction* transaction,
         FTSInsertState& ftsInsertState, common::nodeID_t insertedNodeID, uint64_t docLen) const;
@@ -86,9 +113,22 @@ private:
     void deleteFromAppearsInTable(transaction::Transaction* transaction,
         FTSDeleteState& ftsDeleteState, common::nodeID_t docID) const;
 
+    void addModifiedTerms(const std::unordered_map<std::string, TermInfo>& tfCollection);
+
 private:
     FTSInternalTableInfo internalTableInfo;
     FTSConfig config;
+    // Compiled once rather than for each inserted or deleted doc.
+    std::unique_ptr<regex::RE2> ignorePattern;
+    storage::FileHandle* dataFH;
+    // The directory of the lists is loaded from the data file on first use, and the lists are read
+    // through the buffer manager.
+    std::unique_ptr<FTSPostingLists> postingLists;
+    // The delta over the posting lists: terms whose postings were changed by writes since the lists
+    // were built. Writes only go to the internal tables, and the modified terms are merged into the
+    // lists at the next checkpoint. Terms of rolled back writes stay in the delta until then.
+    std::unordered_set<common::offset_t> modifiedTerms;
+    std::mutex postingListsMtx;
 };
 
 } // namespace fts_extension
@@ -13,9 +13,17 @@ struct FTSInternalTableInfo {
     storage::NodeTable* termsTable;
     storage::RelTable* appearsInfoTable;
     common::column_id_t dfColumnID;
+    // INVALID_COLUMN_ID for indexes created before the max term frequency was recorded.
+    common::column_id_t maxTFColumnID;
+    common::column_id_t tfColumnID;
+    // INVALID_COLUMN_ID for indexes created without positions.
+    common::column_id_t positionsColumnID;
 
     FTSInternalTableInfo(main::ClientContext* context, common::table_id_t tableID,
         const std::string& indexName, const std::string& stopWordsTableName);
+
+    bool hasMaxTFColumn() const { return maxTFColumnID != common::INVALID_COLUMN_ID; }
+    bool hasPositionsColumn() const { return positionsColumnID != common::INVALID_COLUMN_ID; }
 };
 
 } // namespace fts_extension
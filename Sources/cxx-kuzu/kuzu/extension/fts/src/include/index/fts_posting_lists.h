@@ -0,0 +1,189 @@
+#pragma once
+
+#include <span>
+#include <unordered_set>
+
+#include "storage/page_range.h"
+#include "storage/table/rel_table.h"
+
+namespace kuzu {
+namespace storage {
+class FileHandle;
+class PageAllocator;
+} // namespace storage
+
+namespace fts_extension {
+
+// Patched frame-of-reference (PFOR) encoding of blocks of values. The values of a block are bit
+// packed with a width that fits most of them, and the high bits of the values exceeding the width
+// are stored separately as exceptions, so that a few large values don't widen the whole block.
+struct PFORCodec {
+    static constexpr uint64_t MAX_BLOCK_SIZE = 128;
+
+    static void encode(std::span<const uint64_t> values, std::vector<uint8_t>& out);
+    // Returns the position right after the encoded block.
+    static const uint8_t* decode(const uint8_t* in, uint64_t numValues, uint64_t* out);
+};
+
+// Encodes the increasing positions of a term in a doc as the deltas between consecutive
+// positions, each written as a varint of 7 bits per byte.
+struct PositionsCodec {
+    static void encode(std::span<const uint32_t> positions, std::string& out);
+    // Appends the decoded positions to out.
+    static void decode(std::span<const uint8_t> in, std::vector<uint32_t>& out);
+};
+
+// Compressed postings of all terms of an FTS index. The postings of a term are sorted by doc
+// offset and split into blocks of PFORCodec::MAX_BLOCK_SIZE postings. A block holds the PFOR
+// encoded deltas between consecutive doc offsets, followed by the PFOR encoded term frequencies.
+// The lists are a read-optimized copy of the appears_in table, built when the index is created.
+// Once persisted, the lists live in segments, which are page ranges of the data file read through
+// the buffer manager, and only the directory locating the list of each term is kept in memory.
+// At checkpoints, only the changes to the lists of the modified terms are written: the postings of
+// a term which were added, removed or changed since its base list was encoded form its delta list,
+// which overrides the base list. The base list of a term is only re-encoded once its delta list
+// outgrows a fraction of it, so a doc containing common terms doesn't rewrite their long lists.
+// Changed lists are written to a new segment, and the other lists are not rewritten unless their
+// segment has become mostly dead space.
+class FTSPostingLists {
+    static constexpr uint32_t IN_MEMORY_SEGMENT_IDX = UINT32_MAX;
+    // Base lists are re-encoded once their delta lists hold more than 1/DELTA_MERGE_RATIO as many
+    // postings as they do.
+    static constexpr uint64_t DELTA_MERGE_RATIO = 4;
+
+    struct ListLocation {
+        // Index of the segment holding the list, or IN_MEMORY_SEGMENT_IDX if the list hasn't been
+        // persisted yet and is in memoryData.
+        uint32_t segmentIdx = IN_MEMORY_SEGMENT_IDX;
+        uint64_t offset = 0;
+        uint64_t numBytes = 0;
+        uint64_t numPostings = 0;
+    };
+
+    struct ListInfo {
+        ListLocation base;
+        // Postings replacing those of the base list with the same doc offsets. Postings with a
+        // term frequency of 0 remove their doc from the list.
+        ListLocation delta;
+    };
+
+    struct Segment {
+        storage::PageRange pageRange;
+        // Number of bytes of the segment holding lists which are still in use.
+        uint64_t numLiveBytes = 0;
+    };
+
+    // Decodes the postings of an encoded list one at a time.
+    class ListReader {
+    public:
+        // Term frequencies are stored minus minTF, which is 1 for base lists and 0 for delta lists.
+        ListReader(const uint8_t* in, uint64_t numPostings, uint64_t minTF)
+            : in{in}, numPostingsLeft{numPostings}, minTF{minTF} {}
+
+        // Returns false once all postings have been read.
+        bool next(common::offset_t& docOffset, uint64_t& tf) {
+            if (posInBlock == blockSize) {
+                if (numPostingsLeft == 0) {
+                    return false;
+                }
+                blockSize = std::min(numPostingsLeft, PFORCodec::MAX_BLOCK_SIZE);
+                in = PFORCodec::decode(in, blockSize, docOffsetDeltas);
+                in = PFORCodec::decode(in, blockSize, tfs);
+                numPostingsLeft -= blockSize;
+                posInBlock = 0;
+            }
+            prevDocOffset += docOffsetDeltas[posInBlock];
+            docOffset = prevDocOffset;
+            tf = tfs[posInBlock++] + minTF;
+            return true;
+        }
+
+    private:
+        const uint8_t* in;
+        uint64_t numPostingsLeft;
+        uint64_t minTF;
+        uint64_t blockSize = 0;
+        uint64_t posInBlock = 0;
+        common::offset_t prevDocOffset = 0;
+        uint64_t docOffsetDeltas[PFORCodec::MAX_BLOCK_SIZE];
+        uint64_t tfs[PFORCodec::MAX_BLOCK_SIZE];
+    };
+
+public:
+    explicit FTSPostingLists(storage::FileHandle* dataFH) : dataFH{dataFH} {}
+
+    // Builds the lists of all terms from the appears_in table.
+    static std::unique_ptr<FTSPostingLists> build(transaction::Transaction* transaction,
+        storage::MemoryManager* mm, storage::FileHandle* dataFH,
+        storage::RelTable& appearsInTable, common::column_id_t tfColumnID,
+        common::offset_t numTerms);
+
+    // Brings the lists of the given terms up to date with the appears_in table by encoding their
+    // delta lists, or their base lists if the deltas have grown too large. The new lists are kept
+    // in memory until they are persisted.
+    void updateLists(transaction::Transaction* transaction, storage::MemoryManager* mm,
+        storage::RelTable& appearsInTable, common::column_id_t tfColumnID,
+        common::offset_t numTerms, const std::unordered_set<common::offset_t>& terms);
+
+    // Writes the lists kept in memory to a new segment. The live lists of segments which are
+    // mostly dead space are moved to the new segment as well, and these segments are freed.
+    void persist(storage::PageAllocator& pageAllocator);
+
+    // Calls func(docOffset, tf) for each posting of the term in increasing order of doc offsets.
+    template<typename FUNC>
+    void forEachPosting(common::offset_t termOffset, FUNC func) const {
+        if (termOffset >= lists.size()) {
+            return;
+        }
+        auto& listInfo = lists[termOffset];
+        std::vector<uint8_t> baseBuffer, deltaBuffer;
+        ListReader base{readList(listInfo.base, baseBuffer), listInfo.base.numPostings,
+            1 /* minTF */};
+        ListReader delta{readList(listInfo.delta, deltaBuffer), listInfo.delta.numPostings,
+            0 /* minTF */};
+        common::offset_t baseDocOffset = 0, deltaDocOffset = 0;
+        uint64_t baseTF = 0, deltaTF = 0;
+        auto hasBase = base.next(baseDocOffset, baseTF);
+        auto hasDelta = delta.next(deltaDocOffset, deltaTF);
+        while (hasBase || hasDelta) {
+            if (!hasDelta || (hasBase && baseDocOffset < deltaDocOffset)) {
+                func(baseDocOffset, baseTF);
+                hasBase = base.next(baseDocOffset, baseTF);
+                continue;
+            }
+            if (hasBase && baseDocOffset == deltaDocOffset) {
+                hasBase = base.next(baseDocOffset, baseTF);
+            }
+            if (deltaTF > 0) {
+                func(deltaDocOffset, deltaTF);
+            }
+            hasDelta = delta.next(deltaDocOffset, deltaTF);
+        }
+    }
+
+    // Serializes the directory of the persisted lists, which is written to pages of the data file.
+    std::vector<uint8_t> serializeDirectory() const;
+    static std::unique_ptr<FTSPostingLists> deserializeDirectory(storage::FileHandle* dataFH,
+        std::span<const uint8_t> buffer);
+
+private:
+    // Returns the start of the encoded list. Lists of segments are read into buffer.
+    const uint8_t* readList(const ListLocation& location, std::vector<uint8_t>& buffer) const;
+
+    // Encodes the postings, sorted by doc offset, into memoryData and points location to them.
+    void setList(ListLocation& location,
+        std::span<const std::pair<common::offset_t, uint64_t>> postings, uint64_t minTF);
+
+    static void encodeList(std::span<const std::pair<common::offset_t, uint64_t>> postings,
+        uint64_t minTF, std::vector<uint8_t>& out);
+
+private:
+    storage::FileHandle* dataFH;
+    std::vector<ListInfo> lists;
+    std::vector<Segment> segments;
+    // Lists which haven't been persisted yet.
+    std::vector<uint8_t> memoryData;
+};
+
+} // namespace fts_extension
+} // namespace kuzu
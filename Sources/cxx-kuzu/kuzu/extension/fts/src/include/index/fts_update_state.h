@@ -16,6 +16,8 @@ struct FTSUpdateVectors {
     common::ValueVector int64PKVector;
     common::ValueVector stringPKVector;
     common::ValueVector uint64PropVector;
+    common::ValueVector maxTFVector;
+    common::ValueVector positionsVector;
 
     explicit FTSUpdateVectors(storage::MemoryManager* mm);
 };
@@ -23,6 +25,8 @@ struct FTSUpdateVectors {
 struct TermsTableState {
     storage::NodeTableScanState termsTableScanState;
     storage::NodeTableUpdateState termsTableUpdateState;
+    // Null if the terms table has no max term frequency column.
+    std::unique_ptr<storage::NodeTableUpdateState> maxTFUpdateState;
 
     TermsTableState(const transaction::Transaction* transaction, FTSUpdateVectors& updateVectors,
         FTSInternalTableInfo& tableInfo);
@@ -4,6 +4,12 @@
 #include "function/fts_config.h"
 #include "main/client_context.h"
 
+struct sb_stemmer;
+
+namespace cppjieba {
+class Jieba;
+}
+
 namespace kuzu {
 namespace storage {
 class NodeTable;
@@ -11,15 +17,53 @@ class NodeTable;
 
 namespace fts_extension {
 
+// Stems terms with a snowball stemmer, memoizing the stems of the terms seen so far since the
+// terms of docs and queries repeat a lot. A stemmer must only be used by one thread at a time.
+class TermStemmer {
+public:
+    ~TermStemmer();
+
+    // Returns nullptr if the stemmer is unrecognized.
+    static std::unique_ptr<TermStemmer> create(const std::string& stemmer);
+    // Returns the stemmer of the calling thread, which is created on first use and reused by the
+    // later calls on the thread. Returns nullptr if the stemmer is unrecognized.
+    static TermStemmer* getThreadLocal(const std::string& stemmer);
+
+    // The returned stem is valid until the next call.
+    const std::string& stem(const char* term, uint64_t length);
+    const std::string& stem(const std::string& term) { return stem(term.data(), term.length()); }
+
+private:
+    explicit TermStemmer(sb_stemmer* sbStemmer) : sbStemmer{sbStemmer} {}
+
+private:
+    // The memoized stems are dropped once there are this many of them.
+    static constexpr uint64_t MAX_NUM_CACHED_STEMS = 64 * 1024;
+
+    sb_stemmer* sbStemmer;
+    std::unordered_map<std::string, std::string> stems;
+};
+
 struct FTSUtils {
 
+    // Replaces the matches of the ignore pattern with spaces and lowercases the query.
     static void normalizeQuery(std::string& query, const regex::RE2& ignorePattern);
 
+    // Appends the non-empty space-separated terms of the string to the terms.
+    static void splitTerms(const std::string& str, std::vector<std::string>& terms);
+
+    // Returns the jieba tokenizer of the dictionary directory. Loading the dictionaries is
+    // expensive, so tokenizers are shared by the callers with the same directory. Jieba is safe to
+    // use concurrently.
+    static std::shared_ptr<cppjieba::Jieba> getJieba(const std::string& dictDir);
+
     static bool hasWildcardPattern(const std::string& term);
 
+    // If positions is given, the positions in terms of the returned terms are appended to it.
     static std::vector<std::string> stemTerms(std::vector<std::string> terms,
         const FTSConfig& config, storage::MemoryManager* mm, storage::NodeTable* stopwordsTable,
-        transaction::Transaction* tx, bool isConjunctive, bool isQuery);
+        transaction::Transaction* tx, bool isConjunctive, bool isQuery,
+        std::vector<uint32_t>* positions = nullptr);
 
     static std::string getDefaultStopWordsTableName() {
         return common::stringFormat("default_english_stopwords");
@@ -4,6 +4,9 @@
 #include "catalog/fts_index_catalog_entry.h"
 #include "index/fts_update_state.h"
 #include "re2.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/storage_manager.h"
 #include "utils/fts_utils.h"
 
 namespace kuzu {
@@ -17,7 +20,10 @@ FTSIndex::FTSIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storag
     FTSConfig config, main::ClientContext* context)
     : Index{indexInfo, std::move(storageInfo)},
       internalTableInfo{context, indexInfo.tableID, indexInfo.name, config.stopWordsTableName},
-      config{std::move(config)} {}
+      config{std::move(config)}, ignorePattern{std::make_unique<RE2>(this->config.ignorePattern)},
+      dataFH{StorageManager::Get(*context)->getDataFH()} {}
+
+FTSIndex::~FTSIndex() = default;
 
 std::unique_ptr<Index> FTSIndex::load(main::ClientContext* context, StorageManager*,
     IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
@@ -35,6 +41,8 @@ std::unique_ptr<Index> FTSIndex::load(main::ClientContext* context, StorageManag
 struct TermInfo {
     offset_t offset;
     uint64_t tf;
+    // Positions of the term in the doc, only recorded if the index has positions.
+    std::vector<uint32_t> positions;
 };
 
 std::shared_ptr<BufferWriter> FTSStorageInfo::serialize() const {
@@ -43,6 +51,9 @@ std::shared_ptr<BufferWriter> FTSStorageInfo::serialize() const {
     serializer.write<idx_t>(numDocs);
     serializer.write<double>(avgDocLen);
     serializer.write<offset_t>(numCheckpointedNodes);
+    serializer.write<page_idx_t>(postingListsPageRange.startPageIdx);
+    serializer.write<page_idx_t>(postingListsPageRange.numPages);
+    serializer.write<uint64_t>(postingListsNumBytes);
     return bufferWriter;
 }
 
@@ -55,7 +66,14 @@ std::unique_ptr<IndexStorageInfo> FTSStorageInfo::deserialize(
     deSer.deserializeValue<idx_t>(numDocs);
     deSer.deserializeValue<double>(avgDocLen);
     deSer.deserializeValue<offset_t>(numCheckpointedNodes);
-    return std::make_unique<FTSStorageInfo>(numDocs, avgDocLen, numCheckpointedNodes);
+    auto storageInfo = std::make_unique<FTSStorageInfo>(numDocs, avgDocLen, numCheckpointedNodes);
+    // Indexes created before posting lists were persisted end here.
+    if (!deSer.finished()) {
+        deSer.deserializeValue<page_idx_t>(storageInfo->postingListsPageRange.startPageIdx);
+        deSer.deserializeValue<page_idx_t>(storageInfo->postingListsPageRange.numPages);
+        deSer.deserializeValue<uint64_t>(storageInfo->postingListsNumBytes);
+    }
+    return storageInfo;
 }
 
 std::unique_ptr<Index::InsertState> FTSIndex::initInsertState(main::ClientContext* context,
@@ -63,29 +81,41 @@ std::unique_ptr<Index::InsertState> FTSIndex::initInsertState(main::ClientContex
     return std::make_unique<FTSInsertState>(context, internalTableInfo);
 }
 
+// The position of a term is the position of its token among the tokens of the doc, counting the
+// removed stop words. The same positions are recorded by _BUILD_FTS_POSTINGS.
 static std::vector<std::string> getTerms(Transaction* transaction, FTSConfig& config,
-    NodeTable* stopWordsTable, const std::vector<ValueVector*>& indexVectors, sel_t pos,
-    MemoryManager* mm) {
+    const RE2& ignorePattern, NodeTable* stopWordsTable,
+    const std::vector<ValueVector*>& indexVectors, sel_t pos, MemoryManager* mm,
+    std::vector<uint32_t>* positions) {
     std::string content;
     std::vector<std::string> terms;
-    RE2 regexPattern{config.ignorePattern};
+    std::vector<uint32_t> positionsInContent;
+    uint32_t contentStartPosition = 0;
     for (auto indexVector : indexVectors) {
         if (indexVector->isNull(pos)) {
             continue;
         }
         content = indexVector->getValue<ku_string_t>(pos).getAsString();
-        FTSUtils::normalizeQuery(content, regexPattern);
+        FTSUtils::normalizeQuery(content, ignorePattern);
         auto termsInContent = FTSUtils::tokenizeString(content, config);
+        auto numTokens = termsInContent.size();
+        positionsInContent.clear();
         termsInContent = FTSUtils::stemTerms(termsInContent, config, mm, stopWordsTable,
-            transaction, true /* isConjunctive */, false /* isQuery */);
+            transaction, true /* isConjunctive */, false /* isQuery */,
+            positions == nullptr ? nullptr : &positionsInContent);
         // TODO(Ziyi): StringUtils::split() has a bug which doesn't ignore empty parts even
         // ignoreEmptyStringParts is set to true.
-        for (auto& term : termsInContent) {
-            if (term.empty()) {
+        for (auto i = 0u; i < termsInContent.size(); i++) {
+            if (termsInContent[i].empty()) {
                 continue;
             }
-            terms.push_back(term);
+            terms.push_back(termsInContent[i]);
+            if (positions != nullptr) {
+                positions->push_back(contentStartPosition + positionsInContent[i]);
+            }
         }
+        // Leave a gap between properties so that phrases don't span them.
+        contentStartPosition += numTokens + 1;
     }
     return terms;
 }
@@ -94,15 +124,23 @@ struct DocInfo {
     std::unordered_map<std::string, TermInfo> termInfos;
     uint64_t docLen;
 
-    DocInfo(Transaction* transaction, FTSConfig& config, NodeTable* stopWordsTable,
-        const std::vector<ValueVector*>& indexVectors, sel_t pos, MemoryManager* mm);
+    DocInfo(Transaction* transaction, FTSConfig& config, const RE2& ignorePattern,
+        NodeTable* stopWordsTable, const std::vector<ValueVector*>& indexVectors, sel_t pos,
+        MemoryManager* mm, bool recordPositions);
 };
 
-DocInfo::DocInfo(Transaction* transaction, FTSConfig& config, NodeTable* stopWordsTable,
-    const std::vector<ValueVector*>& indexVectors, sel_t pos, MemoryManager* mm) {
-    auto terms = getTerms(transaction, config, stopWordsTable, indexVectors, pos, mm);
-    for (auto& term : terms) {
-        termInfos[term].tf++;
+DocInfo::DocInfo(Transaction* transaction, FTSConfig& config, const RE2& ignorePattern,
+    NodeTable* stopWordsTable, const std::vector<ValueVector*>& indexVectors, sel_t pos,
+    MemoryManager* mm, bool recordPositions) {
+    std::vector<uint32_t> positions;
+    auto terms = getTerms(transaction, config, ignorePattern, stopWordsTable, indexVectors, pos,
+        mm, recordPositions ? &positions : nullptr);
+    for (auto i = 0u; i < terms.size(); i++) {
+        auto& termInfo = termInfos[terms[i]];
+        termInfo.tf++;
+        if (recordPositions) {
+            termInfo.positions.push_back(positions[i]);
+        }
     }
     docLen = terms.size();
 }
@@ -113,8 +151,9 @@ void FTSIndex::insert(Transaction* transaction, const ValueVector& nodeIDVector,
     auto& ftsInsertState = insertState.cast<FTSInsertState>();
     for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
         auto pos = nodeIDVector.state->getSelVector()[i];
-        DocInfo docInfo{transaction, config, internalTableInfo.stopWordsTable, indexVectors, pos,
-            ftsInsertState.updateVectors.mm};
+        DocInfo docInfo{transaction, config, *ignorePattern, internalTableInfo.stopWordsTable,
+            indexVectors, pos, ftsInsertState.updateVectors.mm,
+            internalTableInfo.hasPositionsColumn()};
         if (docInfo.termInfos.size() == 0) {
             break;
         }
@@ -122,6 +161,7 @@ void FTSIndex::insert(Transaction* transaction, const ValueVector& nodeIDVector,
             nodeIDVector.getValue<nodeID_t>(pos), docInfo.docLen);
         totalInsertedDocLen += docInfo.docLen;
         insertToTermsTable(transaction, docInfo.termInfos, ftsInsertState);
+        addModifiedTerms(docInfo.termInfos);
         insertToAppearsInTable(transaction, docInfo.termInfos, ftsInsertState, insertedDocID,
             internalTableInfo.termsTable->getTableID());
     }
@@ -180,14 +220,16 @@ void FTSIndex::delete_(Transaction* transaction, const ValueVector& nodeIDVector
         internalTableInfo.table->initScanState(transaction,
             *ftsDeleteState.indexTableState.scanState, deletedNodeID.tableID, deletedNodeID.offset);
         internalTableInfo.table->lookup(transaction, *ftsDeleteState.indexTableState.scanState);
-        DocInfo docInfo{transaction, config, internalTableInfo.stopWordsTable,
-            ftsDeleteState.indexTableState.indexVectors, 0, ftsDeleteState.updateVectors.mm};
+        DocInfo docInfo{transaction, config, *ignorePattern, internalTableInfo.stopWordsTable,
+            ftsDeleteState.indexTableState.indexVectors, 0, ftsDeleteState.updateVectors.mm,
+            false /* recordPositions */};
         if (docInfo.termInfos.size() == 0) {
             continue;
         }
         auto deletedDocID =
             deleteFromDocTable(transaction, ftsDeleteState, deletedNodeID, totalDocLen);
         deleteFromTermsTable(transaction, docInfo.termInfos, ftsDeleteState);
+        addModifiedTerms(docInfo.termInfos);
         deleteFromAppearsInTable(transaction, ftsDeleteState, deletedDocID);
     }
     auto numDeletedDocs = nodeIDVector.state->getSelSize();
@@ -240,6 +282,77 @@ void FTSIndex::checkpoint(main::ClientContext* context, storage::PageAllocator&
     auto appearsInTableEntry =
         catalog->getTableCatalogEntry(&DUMMY_CHECKPOINT_TRANSACTION, appearsInTableName);
     internalTableInfo.appearsInfoTable->checkpoint(context, appearsInTableEntry, pageAllocator);
+    bool hasModifiedTerms = false;
+    {
+        std::lock_guard lck{postingListsMtx};
+        hasModifiedTerms = !modifiedTerms.empty();
+    }
+    if (hasModifiedTerms || !storageInfo->constCast<FTSStorageInfo>().hasPostingLists()) {
+        buildPostingLists(context, &DUMMY_CHECKPOINT_TRANSACTION, &pageAllocator);
+    }
+}
+
+const FTSPostingLists* FTSIndex::getPostingLists() {
+    std::lock_guard lck{postingListsMtx};
+    auto& ftsStorageInfo = storageInfo->constCast<FTSStorageInfo>();
+    if (postingLists == nullptr && ftsStorageInfo.hasPostingLists()) {
+        std::vector<uint8_t> buffer(ftsStorageInfo.postingListsNumBytes);
+        auto pageSize = dataFH->getPageSize();
+        for (uint64_t pos = 0; pos < buffer.size(); pos += pageSize) {
+            dataFH->optimisticReadPage(
+                ftsStorageInfo.postingListsPageRange.startPageIdx + pos / pageSize,
+                [&](const uint8_t* frame) {
+                    memcpy(buffer.data() + pos, frame, std::min(pageSize, buffer.size() - pos));
+                });
+        }
+        postingLists = FTSPostingLists::deserializeDirectory(dataFH, buffer);
+    }
+    return postingLists.get();
+}
+
+bool FTSIndex::isTermModified(offset_t termOffset) {
+    std::lock_guard lck{postingListsMtx};
+    return modifiedTerms.contains(termOffset);
+}
+
+void FTSIndex::addModifiedTerms(const std::unordered_map<std::string, TermInfo>& tfCollection) {
+    std::lock_guard lck{postingListsMtx};
+    for (auto& [_, termInfo] : tfCollection) {
+        modifiedTerms.insert(termInfo.offset);
+    }
+}
+
+void FTSIndex::buildPostingLists(main::ClientContext* context, Transaction* transaction,
+    PageAllocator* pageAllocator) {
+    // No writes run concurrently with building the lists, which happens either within the
+    // transaction creating the index or at checkpoint.
+    getPostingLists();
+    auto mm = MemoryManager::Get(*context);
+    auto numTerms = internalTableInfo.termsTable->getNumTotalRows(transaction);
+    std::lock_guard lck{postingListsMtx};
+    if (postingLists == nullptr) {
+        postingLists = FTSPostingLists::build(transaction, mm, dataFH,
+            *internalTableInfo.appearsInfoTable, internalTableInfo.tfColumnID, numTerms);
+    } else {
+        postingLists->updateLists(transaction, mm, *internalTableInfo.appearsInfoTable,
+            internalTableInfo.tfColumnID, numTerms, modifiedTerms);
+    }
+    modifiedTerms.clear();
+    if (pageAllocator == nullptr) {
+        return;
+    }
+    postingLists->persist(*pageAllocator);
+    auto& ftsStorageInfo = storageInfo->cast<FTSStorageInfo>();
+    if (ftsStorageInfo.hasPostingLists()) {
+        pageAllocator->freePageRange(ftsStorageInfo.postingListsPageRange);
+    }
+    auto buffer = postingLists->serializeDirectory();
+    auto pageSize = dataFH->getPageSize();
+    auto numPages = (buffer.size() + pageSize - 1) / pageSize;
+    auto pageRange = pageAllocator->allocatePageRange(numPages);
+    dataFH->writePagesToFile(buffer.data(), buffer.size(), pageRange.startPageIdx);
+    ftsStorageInfo.postingListsPageRange = pageRange;
+    ftsStorageInfo.postingListsNumBytes = buffer.size();
 }
 
 nodeID_t FTSIndex::insertToDocTable(Transaction* transaction, FTSInsertState& insertState,
@@ -273,9 +386,16 @@ void FTSIndex::insertToTermsTable(Transaction* transaction,
             termsTable->lookup(transaction, ftsInsertState.termsTableState.termsTableScanState);
             dfVector.setValue(0, dfVector.getValue<uint64_t>(0) + 1);
             termsTable->update(transaction, ftsInsertState.termsTableState.termsTableUpdateState);
+            auto& maxTFUpdateState = ftsInsertState.termsTableState.maxTFUpdateState;
+            if (maxTFUpdateState != nullptr &&
+                termInfo.tf > ftsInsertState.updateVectors.maxTFVector.getValue<uint64_t>(0)) {
+                ftsInsertState.updateVectors.maxTFVector.setValue(0, termInfo.tf);
+                termsTable->update(transaction, *maxTFUpdateState);
+            }
             termInfo.offset = termNodeID.offset;
         } else {
             dfVector.setValue(0, 1);
+            ftsInsertState.updateVectors.maxTFVector.setValue(0, termInfo.tf);
             termsTable->insert(transaction, ftsInsertState.termsTableInsertState);
             termInfo.offset = termIDVector.getValue<nodeID_t>(0).offset;
         }
@@ -290,6 +410,12 @@ void FTSIndex::insertToAppearsInTable(Transaction* transaction,
         ftsInsertState.updateVectors.srcIDVector.setValue(0,
             nodeID_t{termInfo.offset, termsTableID});
         ftsInsertState.updateVectors.uint64PropVector.setValue(0, termInfo.tf);
+        if (internalTableInfo.hasPositionsColumn()) {
+            std::string positions;
+            PositionsCodec::encode(termInfo.positions, positions);
+            BlobVector::addBlob(&ftsInsertState.updateVectors.positionsVector, 0, positions.data(),
+                positions.size());
+        }
         internalTableInfo.appearsInfoTable->insert(transaction,
             ftsInsertState.appearsInTableInsertState);
     }
@@ -331,6 +457,7 @@ void FTSIndex::deleteFromTermsTable(Transaction* transaction,
         if (df == 1) {
             termsTable->delete_(transaction, ftsInsertState.termsTableDeleteState);
         } else {
+            // The max term frequency is left as is, as it remains an upper bound.
             dfVector.setValue(0, df - 1);
             termsTable->update(transaction, ftsInsertState.termsTableState.termsTableUpdateState);
         }
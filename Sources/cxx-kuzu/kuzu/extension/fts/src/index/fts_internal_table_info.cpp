@@ -27,13 +27,21 @@ FTSInternalTableInfo::FTSInternalTableInfo(main::ClientContext* context, common:
         storageManager
             ->getTable(catalog->getTableCatalogEntry(transaction, termsTableName)->getTableID())
             ->ptrCast<storage::NodeTable>();
+    auto appearsInGroupEntry = catalog->getTableCatalogEntry(transaction, appearsInTableName);
     auto appearsInTableEntry =
-        catalog->getTableCatalogEntry(transaction, appearsInTableName)
-            ->constPtrCast<catalog::RelGroupCatalogEntry>()
-            ->getRelEntryInfo(termsTable->getTableID(), docTable->getTableID());
+        appearsInGroupEntry->constPtrCast<catalog::RelGroupCatalogEntry>()->getRelEntryInfo(
+            termsTable->getTableID(), docTable->getTableID());
     appearsInfoTable =
         storageManager->getTable(appearsInTableEntry->oid)->ptrCast<storage::RelTable>();
-    dfColumnID = catalog->getTableCatalogEntry(transaction, termsTableName)->getColumnID("df");
+    tfColumnID = appearsInGroupEntry->getColumnID("tf");
+    positionsColumnID = appearsInGroupEntry->containsProperty("positions") ?
+                            appearsInGroupEntry->getColumnID("positions") :
+                            common::INVALID_COLUMN_ID;
+    auto termsTableEntry = catalog->getTableCatalogEntry(transaction, termsTableName);
+    dfColumnID = termsTableEntry->getColumnID("df");
+    maxTFColumnID = termsTableEntry->containsProperty("maxtf") ?
+                        termsTableEntry->getColumnID("maxtf") :
+                        common::INVALID_COLUMN_ID;
 }
 
 } // namespace fts_extension
@@ -0,0 +1,432 @@
+#include "index/fts_posting_lists.h"
+
+#include <bit>
+#include <numeric>
+
+#include "fastpfor/bitpackinghelpers.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/table/csr_node_group.h"
+
+namespace kuzu {
+namespace fts_extension {
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+static uint8_t getBitWidth(uint64_t value) {
+    return value == 0 ? 0 : 64 - std::countl_zero(value);
+}
+
+static constexpr uint64_t PACKING_CHUNK_SIZE = 32;
+
+static uint64_t getNumPackedBytes(uint64_t numValues, uint8_t bitWidth) {
+    auto numChunks = (numValues + PACKING_CHUNK_SIZE - 1) / PACKING_CHUNK_SIZE;
+    return numChunks * PACKING_CHUNK_SIZE * bitWidth / 8;
+}
+
+// Appends the bitWidth bits of the values starting at bit shift, bitpacked with fastpfor in chunks
+// of PACKING_CHUNK_SIZE values. The last chunk is padded with zeros.
+static void packBits(std::span<const uint64_t> values, uint8_t shift, uint8_t bitWidth,
+    std::vector<uint8_t>& out) {
+    auto startPos = out.size();
+    out.resize(startPos + getNumPackedBytes(values.size(), bitWidth), 0);
+    if (bitWidth == 0) {
+        return;
+    }
+    // Only the last value of a chunk isn't masked by fastpack.
+    auto mask = bitWidth == 64 ? UINT64_MAX : (uint64_t{1} << bitWidth) - 1;
+    uint64_t chunk[PACKING_CHUNK_SIZE];
+    for (auto chunkStart = 0u; chunkStart < values.size(); chunkStart += PACKING_CHUNK_SIZE) {
+        auto numValuesInChunk =
+            std::min<uint64_t>(values.size() - chunkStart, PACKING_CHUNK_SIZE);
+        for (auto i = 0u; i < PACKING_CHUNK_SIZE; i++) {
+            chunk[i] = i < numValuesInChunk ? (values[chunkStart + i] >> shift) & mask : 0;
+        }
+        FastPForLib::fastpack(chunk,
+            reinterpret_cast<uint32_t*>(out.data() + startPos + chunkStart * bitWidth / 8),
+            bitWidth);
+    }
+}
+
+// out must have room for numValues rounded up to a multiple of PACKING_CHUNK_SIZE.
+static const uint8_t* unpackBits(const uint8_t* in, uint64_t numValues, uint8_t bitWidth,
+    uint64_t* out) {
+    for (auto chunkStart = 0u; chunkStart < numValues; chunkStart += PACKING_CHUNK_SIZE) {
+        FastPForLib::fastunpack(reinterpret_cast<const uint32_t*>(in + chunkStart * bitWidth / 8),
+            out + chunkStart, bitWidth);
+    }
+    return in + getNumPackedBytes(numValues, bitWidth);
+}
+
+// A block starts with the bit width of the packed values and the number of exceptions. Exceptions
+// are stored after the packed values as their positions in the block, followed by their high bits
+// packed with the width of the widest exception.
+void PFORCodec::encode(std::span<const uint64_t> values, std::vector<uint8_t>& out) {
+    KU_ASSERT(values.size() <= MAX_BLOCK_SIZE);
+    std::array<uint64_t, 65> numValuesPerWidth{};
+    uint8_t maxWidth = 0;
+    for (auto value : values) {
+        auto width = getBitWidth(value);
+        numValuesPerWidth[width]++;
+        maxWidth = std::max(maxWidth, width);
+    }
+    // Pick the width that minimizes the size of the block.
+    uint8_t bitWidth = maxWidth;
+    uint64_t minNumBits = values.size() * maxWidth;
+    uint64_t numExceptions = 0;
+    for (int width = maxWidth - 1; width >= 0; width--) {
+        numExceptions += numValuesPerWidth[width + 1];
+        auto numBits = values.size() * width + 8 + numExceptions * (8 + maxWidth - width);
+        if (numBits < minNumBits) {
+            minNumBits = numBits;
+            bitWidth = width;
+        }
+    }
+    std::vector<uint8_t> exceptionPositions;
+    std::vector<uint64_t> exceptions;
+    for (auto i = 0u; i < values.size(); i++) {
+        if (getBitWidth(values[i]) > bitWidth) {
+            exceptionPositions.push_back(i);
+            exceptions.push_back(values[i]);
+        }
+    }
+    out.push_back(bitWidth);
+    out.push_back(exceptionPositions.size());
+    if (!exceptions.empty()) {
+        out.push_back(maxWidth - bitWidth);
+    }
+    // The low bits of exceptions are packed with the other values.
+    packBits(values, 0 /* shift */, bitWidth, out);
+    if (!exceptions.empty()) {
+        out.insert(out.end(), exceptionPositions.begin(), exceptionPositions.end());
+        packBits(exceptions, bitWidth, maxWidth - bitWidth, out);
+    }
+}
+
+const uint8_t* PFORCodec::decode(const uint8_t* in, uint64_t numValues, uint64_t* out) {
+    KU_ASSERT(numValues <= MAX_BLOCK_SIZE);
+    auto bitWidth = in[0];
+    auto numExceptions = in[1];
+    in += 2;
+    uint8_t exceptionWidth = 0;
+    if (numExceptions > 0) {
+        exceptionWidth = *in++;
+    }
+    in = unpackBits(in, numValues, bitWidth, out);
+    if (numExceptions > 0) {
+        auto exceptionPositions = in;
+        in += numExceptions;
+        uint64_t exceptions[MAX_BLOCK_SIZE];
+        in = unpackBits(in, numExceptions, exceptionWidth, exceptions);
+        for (auto i = 0u; i < numExceptions; i++) {
+            out[exceptionPositions[i]] |= exceptions[i] << bitWidth;
+        }
+    }
+    return in;
+}
+
+void PositionsCodec::encode(std::span<const uint32_t> positions, std::string& out) {
+    uint32_t prevPosition = 0;
+    for (auto position : positions) {
+        KU_ASSERT(position >= prevPosition);
+        auto delta = position - prevPosition;
+        while (delta >= 0x80) {
+            out.push_back(static_cast<char>((delta & 0x7f) | 0x80));
+            delta >>= 7;
+        }
+        out.push_back(static_cast<char>(delta));
+        prevPosition = position;
+    }
+}
+
+void PositionsCodec::decode(std::span<const uint8_t> in, std::vector<uint32_t>& out) {
+    uint32_t position = 0;
+    uint32_t delta = 0;
+    uint8_t shift = 0;
+    for (auto byte : in) {
+        delta |= static_cast<uint32_t>(byte & 0x7f) << shift;
+        if (byte & 0x80) {
+            shift += 7;
+            continue;
+        }
+        position += delta;
+        out.push_back(position);
+        delta = 0;
+        shift = 0;
+    }
+}
+
+// Calls func(termOffset, postings) with the postings of each given term sorted by doc offset. The
+// postings are scanned from the forward direction of the appears_in table, in which rels are
+// stored in insertion order.
+static void scanPostings(transaction::Transaction* transaction, MemoryManager* mm,
+    RelTable& appearsInTable, column_id_t tfColumnID, std::span<const offset_t> termOffsets,
+    const std::function<void(offset_t, std::span<const std::pair<offset_t, uint64_t>>)>& func) {
+    ValueVector termIDVector{LogicalType::INTERNAL_ID(), mm,
+        DataChunkState::getSingleValueDataChunkState()};
+    auto outState = std::make_shared<DataChunkState>();
+    ValueVector docIDVector{LogicalType::INTERNAL_ID(), mm, outState};
+    ValueVector tfVector{LogicalType::UINT64(), mm, outState};
+    RelTableScanState scanState{*mm, &termIDVector, {&docIDVector, &tfVector}, outState};
+    scanState.setToTable(transaction, &appearsInTable, {NBR_ID_COLUMN_ID, tfColumnID}, {},
+        RelDataDirection::FWD);
+    std::vector<std::pair<offset_t, uint64_t>> postings;
+    for (auto termOffset : termOffsets) {
+        termIDVector.setValue(0, nodeID_t{termOffset, appearsInTable.getFromNodeTableID()});
+        appearsInTable.initScanState(transaction, scanState);
+        postings.clear();
+        while (appearsInTable.scan(transaction, scanState)) {
+            auto& selVector = outState->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                auto pos = selVector[i];
+                postings.emplace_back(docIDVector.getValue<nodeID_t>(pos).offset,
+                    tfVector.getValue<uint64_t>(pos));
+            }
+        }
+        std::sort(postings.begin(), postings.end());
+        func(termOffset, postings);
+    }
+}
+
+// Terms of rolled back inserts may be past the end of the terms table, and are skipped.
+static std::span<const offset_t> getExistingTerms(std::span<const offset_t> termOffsets,
+    offset_t numTerms) {
+    return termOffsets.subspan(0,
+        std::lower_bound(termOffsets.begin(), termOffsets.end(), numTerms) - termOffsets.begin());
+}
+
+std::unique_ptr<FTSPostingLists> FTSPostingLists::build(transaction::Transaction* transaction,
+    MemoryManager* mm, FileHandle* dataFH, RelTable& appearsInTable, column_id_t tfColumnID,
+    offset_t numTerms) {
+    auto postingLists = std::make_unique<FTSPostingLists>(dataFH);
+    postingLists->lists.resize(numTerms);
+    std::vector<offset_t> termOffsets(numTerms);
+    std::iota(termOffsets.begin(), termOffsets.end(), 0);
+    scanPostings(transaction, mm, appearsInTable, tfColumnID, termOffsets,
+        [&](offset_t termOffset, std::span<const std::pair<offset_t, uint64_t>> postings) {
+            postingLists->setList(postingLists->lists[termOffset].base, postings, 1 /* minTF */);
+        });
+    return postingLists;
+}
+
+void FTSPostingLists::updateLists(transaction::Transaction* transaction, MemoryManager* mm,
+    RelTable& appearsInTable, column_id_t tfColumnID, offset_t numTerms,
+    const std::unordered_set<offset_t>& terms) {
+    lists.resize(std::max<uint64_t>(lists.size(), numTerms));
+    std::vector<offset_t> termOffsets{terms.begin(), terms.end()};
+    std::sort(termOffsets.begin(), termOffsets.end());
+    std::vector<uint8_t> buffer;
+    std::vector<std::pair<offset_t, uint64_t>> delta;
+    scanPostings(transaction, mm, appearsInTable, tfColumnID,
+        getExistingTerms(termOffsets, numTerms),
+        [&](offset_t termOffset, std::span<const std::pair<offset_t, uint64_t>> postings) {
+            auto& listInfo = lists[termOffset];
+            // The delta is taken against the base list, so it replaces the previous delta list.
+            delta.clear();
+            ListReader base{readList(listInfo.base, buffer), listInfo.base.numPostings,
+                1 /* minTF */};
+            offset_t baseDocOffset = 0;
+            uint64_t baseTF = 0;
+            auto hasBase = base.next(baseDocOffset, baseTF);
+            for (auto& [docOffset, tf] : postings) {
+                while (hasBase && baseDocOffset < docOffset) {
+                    delta.emplace_back(baseDocOffset, 0);
+                    hasBase = base.next(baseDocOffset, baseTF);
+                }
+                if (hasBase && baseDocOffset == docOffset) {
+                    if (baseTF != tf) {
+                        delta.emplace_back(docOffset, tf);
+                    }
+                    hasBase = base.next(baseDocOffset, baseTF);
+                } else {
+                    delta.emplace_back(docOffset, tf);
+                }
+            }
+            while (hasBase) {
+                delta.emplace_back(baseDocOffset, 0);
+                hasBase = base.next(baseDocOffset, baseTF);
+            }
+            if (delta.size() * DELTA_MERGE_RATIO > listInfo.base.numPostings) {
+                setList(listInfo.base, postings, 1 /* minTF */);
+                delta.clear();
+            }
+            setList(listInfo.delta, delta, 0 /* minTF */);
+        });
+}
+
+void FTSPostingLists::setList(ListLocation& location,
+    std::span<const std::pair<offset_t, uint64_t>> postings, uint64_t minTF) {
+    if (location.segmentIdx != IN_MEMORY_SEGMENT_IDX) {
+        segments[location.segmentIdx].numLiveBytes -= location.numBytes;
+    }
+    location.segmentIdx = IN_MEMORY_SEGMENT_IDX;
+    location.offset = memoryData.size();
+    location.numPostings = postings.size();
+    encodeList(postings, minTF, memoryData);
+    location.numBytes = memoryData.size() - location.offset;
+}
+
+void FTSPostingLists::persist(PageAllocator& pageAllocator) {
+    KU_ASSERT(dataFH != nullptr);
+    auto pageSize = dataFH->getPageSize();
+    // Segments whose live lists take less than half of their pages are compacted.
+    std::vector<bool> segmentsToCompact(segments.size());
+    for (auto i = 0u; i < segments.size(); i++) {
+        segmentsToCompact[i] =
+            segments[i].numLiveBytes * 2 < uint64_t{segments[i].pageRange.numPages} * pageSize;
+    }
+    std::vector<uint8_t> buffer;
+    for (auto& listInfo : lists) {
+        for (auto location : {&listInfo.base, &listInfo.delta}) {
+            if (location->segmentIdx == IN_MEMORY_SEGMENT_IDX ||
+                !segmentsToCompact[location->segmentIdx]) {
+                continue;
+            }
+            auto list = readList(*location, buffer);
+            location->segmentIdx = IN_MEMORY_SEGMENT_IDX;
+            location->offset = memoryData.size();
+            memoryData.insert(memoryData.end(), list, list + location->numBytes);
+        }
+    }
+    std::vector<uint32_t> newSegmentIdxs(segments.size(), IN_MEMORY_SEGMENT_IDX);
+    std::vector<Segment> newSegments;
+    for (auto i = 0u; i < segments.size(); i++) {
+        if (segmentsToCompact[i]) {
+            pageAllocator.freePageRange(segments[i].pageRange);
+        } else {
+            newSegmentIdxs[i] = newSegments.size();
+            newSegments.push_back(segments[i]);
+        }
+    }
+    if (!memoryData.empty()) {
+        Segment segment;
+        segment.pageRange = pageAllocator.allocatePageRange((memoryData.size() + pageSize - 1) /
+                                                            pageSize);
+        segment.numLiveBytes = memoryData.size();
+        dataFH->writePagesToFile(memoryData.data(), memoryData.size(),
+            segment.pageRange.startPageIdx);
+        newSegments.push_back(segment);
+    }
+    for (auto& listInfo : lists) {
+        for (auto location : {&listInfo.base, &listInfo.delta}) {
+            if (location->segmentIdx == IN_MEMORY_SEGMENT_IDX) {
+                location->segmentIdx = location->numBytes == 0 ? IN_MEMORY_SEGMENT_IDX :
+                                                                 newSegments.size() - 1;
+            } else {
+                location->segmentIdx = newSegmentIdxs[location->segmentIdx];
+            }
+        }
+    }
+    segments = std::move(newSegments);
+    memoryData.clear();
+    memoryData.shrink_to_fit();
+}
+
+const uint8_t* FTSPostingLists::readList(const ListLocation& location,
+    std::vector<uint8_t>& buffer) const {
+    if (location.segmentIdx == IN_MEMORY_SEGMENT_IDX) {
+        return memoryData.data() + location.offset;
+    }
+    // Lists may span pages, so they are copied out of the pinned pages.
+    buffer.resize(location.numBytes);
+    auto pageSize = dataFH->getPageSize();
+    auto& pageRange = segments[location.segmentIdx].pageRange;
+    uint64_t numBytesRead = 0;
+    while (numBytesRead < location.numBytes) {
+        auto offsetInSegment = location.offset + numBytesRead;
+        auto pageIdx = pageRange.startPageIdx + offsetInSegment / pageSize;
+        auto offsetInPage = offsetInSegment % pageSize;
+        auto numBytesToRead = std::min(pageSize - offsetInPage, location.numBytes - numBytesRead);
+        dataFH->optimisticReadPage(pageIdx, [&](const uint8_t* frame) {
+            memcpy(buffer.data() + numBytesRead, frame + offsetInPage, numBytesToRead);
+        });
+        numBytesRead += numBytesToRead;
+    }
+    return buffer.data();
+}
+
+void FTSPostingLists::encodeList(std::span<const std::pair<offset_t, uint64_t>> postings,
+    uint64_t minTF, std::vector<uint8_t>& out) {
+    uint64_t docOffsetDeltas[PFORCodec::MAX_BLOCK_SIZE];
+    uint64_t tfs[PFORCodec::MAX_BLOCK_SIZE];
+    offset_t prevDocOffset = 0;
+    for (auto blockStart = 0u; blockStart < postings.size();
+         blockStart += PFORCodec::MAX_BLOCK_SIZE) {
+        auto blockSize = std::min<uint64_t>(postings.size() - blockStart,
+            PFORCodec::MAX_BLOCK_SIZE);
+        for (auto i = 0u; i < blockSize; i++) {
+            auto& [docOffset, tf] = postings[blockStart + i];
+            KU_ASSERT(tf >= minTF);
+            docOffsetDeltas[i] = docOffset - prevDocOffset;
+            tfs[i] = tf - minTF;
+            prevDocOffset = docOffset;
+        }
+        PFORCodec::encode(std::span{docOffsetDeltas, blockSize}, out);
+        PFORCodec::encode(std::span{tfs, blockSize}, out);
+    }
+}
+
+template<typename T>
+static void appendValue(std::vector<uint8_t>& buffer, T value) {
+    auto pos = buffer.size();
+    buffer.resize(pos + sizeof(T));
+    memcpy(buffer.data() + pos, &value, sizeof(T));
+}
+
+template<typename T>
+static T readValue(std::span<const uint8_t> buffer, uint64_t& pos) {
+    KU_ASSERT(pos + sizeof(T) <= buffer.size());
+    T value;
+    memcpy(&value, buffer.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+// The directory holds the number of terms followed by the locations and numbers of postings of the
+// base and delta lists of each term, and the number of segments followed by their page ranges and live bytes.
+std::vector<uint8_t> FTSPostingLists::serializeDirectory() const {
+    KU_ASSERT(memoryData.empty());
+    std::vector<uint8_t> buffer;
+    appendValue<uint64_t>(buffer, lists.size());
+    for (auto& listInfo : lists) {
+        for (auto location : {&listInfo.base, &listInfo.delta}) {
+            appendValue<uint32_t>(buffer, location->segmentIdx);
+            appendValue<uint64_t>(buffer, location->offset);
+            appendValue<uint64_t>(buffer, location->numBytes);
+            appendValue<uint64_t>(buffer, location->numPostings);
+        }
+    }
+    appendValue<uint64_t>(buffer, segments.size());
+    for (auto& segment : segments) {
+        appendValue<page_idx_t>(buffer, segment.pageRange.startPageIdx);
+        appendValue<page_idx_t>(buffer, segment.pageRange.numPages);
+        appendValue<uint64_t>(buffer, segment.numLiveBytes);
+    }
+    return buffer;
+}
+
+std::unique_ptr<FTSPostingLists> FTSPostingLists::deserializeDirectory(FileHandle* dataFH,
+    std::span<const uint8_t> buffer) {
+    auto postingLists = std::make_unique<FTSPostingLists>(dataFH);
+    uint64_t pos = 0;
+    postingLists->lists.resize(readValue<uint64_t>(buffer, pos));
+    for (auto& listInfo : postingLists->lists) {
+        for (auto location : {&listInfo.base, &listInfo.delta}) {
+            location->segmentIdx = readValue<uint32_t>(buffer, pos);
+            location->offset = readValue<uint64_t>(buffer, pos);
+            location->numBytes = readValue<uint64_t>(buffer, pos);
+            location->numPostings = readValue<uint64_t>(buffer, pos);
+        }
+    }
+    postingLists->segments.resize(readValue<uint64_t>(buffer, pos));
+    for (auto& segment : postingLists->segments) {
+        segment.pageRange.startPageIdx = readValue<page_idx_t>(buffer, pos);
+        segment.pageRange.numPages = readValue<page_idx_t>(buffer, pos);
+        segment.numLiveBytes = readValue<uint64_t>(buffer, pos);
+    }
+    return postingLists;
+}
+
+} // namespace fts_extension
+} // namespace kuzu
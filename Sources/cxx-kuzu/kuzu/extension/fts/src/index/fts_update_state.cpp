@@ -16,16 +16,60 @@ FTSUpdateVectors::FTSUpdateVectors(MemoryManager* mm)
       dstIDVector{LogicalType::INTERNAL_ID(), mm, dataChunkState},
       int64PKVector{LogicalType::INT64(), mm, dataChunkState},
       stringPKVector{LogicalType::STRING(), mm, dataChunkState},
-      uint64PropVector{LogicalType::UINT64(), mm, dataChunkState} {}
+      uint64PropVector{LogicalType::UINT64(), mm, dataChunkState},
+      maxTFVector{LogicalType::UINT64(), mm, dataChunkState},
+      positionsVector{LogicalType::BLOB(), mm, dataChunkState} {}
+
+static std::vector<ValueVector*> getTermsTableScanVectors(FTSUpdateVectors& updateVectors,
+    const FTSInternalTableInfo& tableInfo) {
+    std::vector<ValueVector*> vectors{&updateVectors.uint64PropVector};
+    if (tableInfo.hasMaxTFColumn()) {
+        vectors.push_back(&updateVectors.maxTFVector);
+    }
+    return vectors;
+}
+
+static std::vector<column_id_t> getTermsTableScanColumnIDs(const FTSInternalTableInfo& tableInfo) {
+    std::vector<column_id_t> columnIDs{tableInfo.dfColumnID};
+    if (tableInfo.hasMaxTFColumn()) {
+        columnIDs.push_back(tableInfo.maxTFColumnID);
+    }
+    return columnIDs;
+}
+
+static std::vector<ValueVector*> getTermsTableInsertVectors(FTSUpdateVectors& updateVectors,
+    const FTSInternalTableInfo& tableInfo) {
+    std::vector<ValueVector*> vectors{&updateVectors.stringPKVector,
+        &updateVectors.uint64PropVector};
+    if (tableInfo.hasMaxTFColumn()) {
+        vectors.push_back(&updateVectors.maxTFVector);
+    }
+    return vectors;
+}
+
+static std::vector<ValueVector*> getAppearsInTableInsertVectors(FTSUpdateVectors& updateVectors,
+    const FTSInternalTableInfo& tableInfo) {
+    std::vector<ValueVector*> vectors{&updateVectors.idVector, &updateVectors.uint64PropVector};
+    if (tableInfo.hasPositionsColumn()) {
+        vectors.push_back(&updateVectors.positionsVector);
+    }
+    return vectors;
+}
 
 TermsTableState::TermsTableState(const Transaction* transaction, FTSUpdateVectors& updateVectors,
     FTSInternalTableInfo& tableInfo)
-    : termsTableScanState{&updateVectors.idVector, std::vector{&updateVectors.uint64PropVector},
-          updateVectors.dataChunkState},
+    : termsTableScanState{&updateVectors.idVector,
+          getTermsTableScanVectors(updateVectors, tableInfo), updateVectors.dataChunkState},
       termsTableUpdateState{tableInfo.dfColumnID, updateVectors.idVector,
           updateVectors.uint64PropVector} {
-    termsTableScanState.setToTable(transaction, tableInfo.termsTable, {tableInfo.dfColumnID}, {});
+    termsTableScanState.setToTable(transaction, tableInfo.termsTable,
+        getTermsTableScanColumnIDs(tableInfo), {});
     termsTableUpdateState.logToWAL = false;
+    if (tableInfo.hasMaxTFColumn()) {
+        maxTFUpdateState = std::make_unique<NodeTableUpdateState>(tableInfo.maxTFColumnID,
+            updateVectors.idVector, updateVectors.maxTFVector);
+        maxTFUpdateState->logToWAL = false;
+    }
 }
 
 FTSInsertState::FTSInsertState(main::ClientContext* context, FTSInternalTableInfo& tableInfo)
@@ -34,10 +78,9 @@ FTSInsertState::FTSInsertState(main::ClientContext* context, FTSInternalTableInf
           std::vector<ValueVector*>{&updateVectors.int64PKVector, &updateVectors.uint64PropVector}},
       termsTableState{transaction::Transaction::Get(*context), updateVectors, tableInfo},
       termsTableInsertState{updateVectors.idVector, updateVectors.stringPKVector,
-          std::vector<ValueVector*>{&updateVectors.stringPKVector,
-              &updateVectors.uint64PropVector}},
+          getTermsTableInsertVectors(updateVectors, tableInfo)},
       appearsInTableInsertState{updateVectors.srcIDVector, updateVectors.dstIDVector,
-          {&updateVectors.idVector, &updateVectors.uint64PropVector}} {
+          getAppearsInTableInsertVectors(updateVectors, tableInfo)} {
     tableInfo.docTable->initInsertState(context, docTableInsertState);
     tableInfo.termsTable->initInsertState(context, termsTableInsertState);
     tableInfo.appearsInfoTable->initInsertState(context, appearsInTableInsertState);
@@ -2,6 +2,7 @@
 
 #include "catalog/catalog.h"
 #include "catalog/fts_index_catalog_entry.h"
+#include "function/build_fts_postings.h"
 #include "function/create_fts_index.h"
 #include "function/drop_fts_index.h"
 #include "function/query_fts_index.h"
@@ -40,6 +41,7 @@ void FtsExtension::load(main::ClientContext* context) {
     ExtensionUtils::addTableFunc<QueryFTSFunction>(db);
     ExtensionUtils::addStandaloneTableFunc<CreateFTSFunction>(db);
     ExtensionUtils::addInternalStandaloneTableFunc<InternalCreateFTSFunction>(db);
+    ExtensionUtils::addInternalTableFunc<InternalBuildFTSPostingsFunction>(db);
     ExtensionUtils::addStandaloneTableFunc<DropFTSFunction>(db);
     ExtensionUtils::addInternalStandaloneTableFunc<InternalDropFTSFunction>(db);
     ExtensionUtils::registerIndexType(db, FTSIndex::getIndexType());
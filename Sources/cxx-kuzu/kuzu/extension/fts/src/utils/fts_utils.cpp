@@ -1,5 +1,8 @@
 #include "utils/fts_utils.h"
 
+#include <cstring>
+#include <mutex>
+
 #include "common/string_utils.h"
 #include "cppjieba/Jieba.hpp"
 #include "function/stem.h"
@@ -16,10 +19,105 @@ using namespace kuzu::storage;
 using namespace kuzu::transaction;
 using namespace kuzu::catalog;
 
+TermStemmer::~TermStemmer() {
+    sb_stemmer_delete(sbStemmer);
+}
+
+std::unique_ptr<TermStemmer> TermStemmer::create(const std::string& stemmer) {
+    auto sbStemmer = sb_stemmer_new(stemmer.c_str(), "UTF_8");
+    if (sbStemmer == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<TermStemmer>(new TermStemmer(sbStemmer));
+}
+
+TermStemmer* TermStemmer::getThreadLocal(const std::string& stemmer) {
+    thread_local std::unordered_map<std::string, std::unique_ptr<TermStemmer>> stemmers;
+    auto it = stemmers.find(stemmer);
+    if (it == stemmers.end()) {
+        auto termStemmer = create(stemmer);
+        if (termStemmer == nullptr) {
+            return nullptr;
+        }
+        it = stemmers.emplace(stemmer, std::move(termStemmer)).first;
+    }
+    return it->second.get();
+}
+
+const std::string& TermStemmer::stem(const char* term, uint64_t length) {
+    std::string key{term, length};
+    if (auto it = stems.find(key); it != stems.end()) {
+        return it->second;
+    }
+    if (stems.size() >= MAX_NUM_CACHED_STEMS) {
+        stems.clear();
+    }
+    auto stemData = sb_stemmer_stem(sbStemmer, reinterpret_cast<const sb_symbol*>(term), length);
+    return stems
+        .emplace(std::move(key), std::string(reinterpret_cast<const char*>(stemData),
+                                     sb_stemmer_length(sbStemmer)))
+        .first->second;
+}
+
+// Lowercases the string in place if it is ASCII, which is much cheaper than the case conversion of
+// UTF-8 strings. The string is checked eight bytes at a time, and the compiler vectorizes the
+// branchless lowercasing. Returns false, leaving the string unchanged, if it isn't ASCII.
+static bool toLowerASCII(std::string& str) {
+    static constexpr uint64_t NON_ASCII_MASK = 0x8080808080808080;
+    const auto data = str.data();
+    const auto length = str.length();
+    uint64_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, data + i, sizeof(uint64_t));
+        if (word & NON_ASCII_MASK) {
+            return false;
+        }
+    }
+    for (; i < length; i++) {
+        if (data[i] & 0x80) {
+            return false;
+        }
+    }
+    for (i = 0; i < length; i++) {
+        data[i] = static_cast<char>(data[i] + ((data[i] >= 'A' && data[i] <= 'Z') ? 'a' - 'A' : 0));
+    }
+    return true;
+}
+
 void FTSUtils::normalizeQuery(std::string& query, const RE2& ignorePattern) {
     std::string replacePattern = " ";
     RE2::GlobalReplace(&query, ignorePattern, replacePattern);
-    StringUtils::toLower(query);
+    if (!toLowerASCII(query)) {
+        StringUtils::toLower(query);
+    }
+}
+
+void FTSUtils::splitTerms(const std::string& str, std::vector<std::string>& terms) {
+    uint64_t start = 0;
+    while (start < str.length()) {
+        auto end = str.find(' ', start);
+        if (end == std::string::npos) {
+            end = str.length();
+        }
+        if (end > start) {
+            terms.emplace_back(str.data() + start, end - start);
+        }
+        start = end + 1;
+    }
+}
+
+std::shared_ptr<cppjieba::Jieba> FTSUtils::getJieba(const std::string& dictDir) {
+    static std::mutex mtx;
+    static std::unordered_map<std::string, std::shared_ptr<cppjieba::Jieba>> jiebas;
+    std::unique_lock lck{mtx};
+    auto& jieba = jiebas[dictDir];
+    if (jieba == nullptr) {
+        jieba = std::make_shared<cppjieba::Jieba>(dictDir + "/jieba.dict.utf8",
+            dictDir + "/hmm_model.utf8", dictDir + "/user.dict.utf8", dictDir + "/idf.utf8",
+            dictDir + "/stop_words.utf8");
+    }
+    return jieba;
 }
 
 struct StopWordsChecker {
@@ -60,41 +158,46 @@ bool FTSUtils::hasWildcardPattern(const std::string& term) {
 
 std::vector<std::string> FTSUtils::stemTerms(std::vector<std::string> terms,
     const FTSConfig& config, MemoryManager* mm, NodeTable* stopwordsTable, Transaction* tx,
-    bool isConjunctive, bool isQuery) {
+    bool isConjunctive, bool isQuery, std::vector<uint32_t>* positions) {
     if (config.stemmer == "none") {
+        if (positions != nullptr) {
+            for (auto i = 0u; i < terms.size(); i++) {
+                positions->push_back(i);
+            }
+        }
         return terms;
     }
-    StemFunction::validateStemmer(config.stemmer);
-    auto sbStemmer = sb_stemmer_new(reinterpret_cast<const char*>(config.stemmer.c_str()), "UTF_8");
+    auto termStemmer = TermStemmer::getThreadLocal(config.stemmer);
+    if (termStemmer == nullptr) {
+        // Throws the error listing the supported stemmers.
+        StemFunction::validateStemmer(config.stemmer);
+    }
     std::vector<std::string> result;
     StopWordsChecker checker{mm, stopwordsTable, tx,
         config.stopWordsSource == StopWords::DEFAULT_VALUE};
-    for (auto& term : terms) {
+    for (auto i = 0u; i < terms.size(); i++) {
+        auto& term = terms[i];
         if (isConjunctive && checker.isStopWord(term)) {
             continue;
         }
+        if (positions != nullptr) {
+            positions->push_back(i);
+        }
         if (isQuery && hasWildcardPattern(term)) {
             result.push_back(term);
             continue;
         }
-        auto stemData = sb_stemmer_stem(sbStemmer, reinterpret_cast<const sb_symbol*>(term.c_str()),
-            term.length());
-        result.push_back(std::string(reinterpret_cast<const char*>(stemData)));
+        result.push_back(termStemmer->stem(term));
     }
-    sb_stemmer_delete(sbStemmer);
     return result;
 }
 
 std::vector<std::string> FTSUtils::tokenizeString(std::string& str, const FTSConfig& config) {
-    FTSUtils::normalizeQuery(str, config.tokenizer);
     std::vector<std::string> terms;
     if (config.tokenizer == "jieba") {
-        cppjieba::Jieba jieba(config.jiebaDictDir + "/jieba.dict.utf8",
-            config.jiebaDictDir + "/hmm_model.utf8", config.jiebaDictDir + "/user.dict.utf8",
-            config.jiebaDictDir + "/idf.utf8", config.jiebaDictDir + "/stop_words.utf8");
-        jieba.CutForSearch(str, terms);
+        getJieba(config.jiebaDictDir)->CutForSearch(str, terms);
     } else {
-        terms = StringUtils::split(str, " ", true /* ignoreEmptyStringParts */);
+        splitTerms(str, terms);
     }
     return terms;
 }
@@ -0,0 +1,59 @@
+#include "http_block_cache.h"
+
+namespace kuzu {
+namespace httpfs_extension {
+
+void HTTPBlockCache::setCapacity(uint64_t newCapacity) {
+    std::unique_lock<std::mutex> lck{mtx};
+    capacity = newCapacity;
+    evictIfNeeded();
+}
+
+std::shared_ptr<const HTTPBlock> HTTPBlockCache::get(const std::string& fileKey,
+    uint64_t blockIdx) {
+    std::unique_lock<std::mutex> lck{mtx};
+    auto it = blocks.find(getBlockKey(fileKey, blockIdx));
+    if (it == blocks.end()) {
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, it->second);
+    return it->second->second;
+}
+
+void HTTPBlockCache::put(const std::string& fileKey, uint64_t blockIdx,
+    std::shared_ptr<const HTTPBlock> block) {
+    std::unique_lock<std::mutex> lck{mtx};
+    if (block->getSize() > capacity) {
+        return;
+    }
+    auto blockKey = getBlockKey(fileKey, blockIdx);
+    auto it = blocks.find(blockKey);
+    if (it != blocks.end()) {
+        // Another reader has fetched the same block concurrently.
+        lruList.splice(lruList.begin(), lruList, it->second);
+        return;
+    }
+    size += block->getSize();
+    lruList.emplace_front(blockKey, std::move(block));
+    blocks.emplace(std::move(blockKey), lruList.begin());
+    evictIfNeeded();
+}
+
+void HTTPBlockCache::clear() {
+    std::unique_lock<std::mutex> lck{mtx};
+    blocks.clear();
+    lruList.clear();
+    size = 0;
+}
+
+void HTTPBlockCache::evictIfNeeded() {
+    while (size > capacity && !lruList.empty()) {
+        auto& [blockKey, block] = lruList.back();
+        size -= block->getSize();
+        blocks.erase(blockKey);
+        lruList.pop_back();
+    }
+}
+
+} // namespace httpfs_extension
+} // namespace kuzu
@@ -0,0 +1,68 @@
+#include "http_client_pool.h"
+
+#include "httpfs.h"
+
+namespace kuzu {
+namespace httpfs_extension {
+
+std::unique_ptr<httplib::Client> HTTPClientPool::acquire(const std::string& host) {
+    std::vector<IdleClient> evictedClients;
+    {
+        std::unique_lock<std::mutex> lck{mtx};
+        evictIdleClientsNoLock(std::chrono::steady_clock::now(), evictedClients);
+        auto it = idleClients.find(host);
+        if (it != idleClients.end()) {
+            auto client = std::move(it->second.back().client);
+            it->second.pop_back();
+            if (it->second.empty()) {
+                idleClients.erase(it);
+            }
+            numClientsReused++;
+            return client;
+        }
+    }
+    numClientsCreated++;
+    return HTTPFileSystem::getClient(host);
+}
+
+void HTTPClientPool::release(const std::string& host, std::unique_ptr<httplib::Client> client,
+    uint64_t maxNumIdleClients) {
+    // A client without an open connection saves no handshake, and one whose request failed may be
+    // left in a broken state.
+    if (client == nullptr || !client->is_valid() || !client->is_socket_open()) {
+        return;
+    }
+    std::vector<IdleClient> evictedClients;
+    std::unique_lock<std::mutex> lck{mtx};
+    auto now = std::chrono::steady_clock::now();
+    evictIdleClientsNoLock(now, evictedClients);
+    if (maxNumIdleClients == 0) {
+        return;
+    }
+    auto& clients = idleClients[host];
+    if (clients.size() < maxNumIdleClients) {
+        clients.push_back(IdleClient{std::move(client), now});
+    }
+}
+
+void HTTPClientPool::evictIdleClientsNoLock(std::chrono::steady_clock::time_point now,
+    std::vector<IdleClient>& evictedClients) {
+    for (auto it = idleClients.begin(); it != idleClients.end();) {
+        auto& clients = it->second;
+        auto numEvicted = 0u;
+        while (numEvicted < clients.size() &&
+               now - clients[numEvicted].releaseTime > MAX_IDLE_TIME) {
+            evictedClients.push_back(std::move(clients[numEvicted]));
+            numEvicted++;
+        }
+        clients.erase(clients.begin(), clients.begin() + numEvicted);
+        if (clients.empty()) {
+            it = idleClients.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace httpfs_extension
+} // namespace kuzu
@@ -10,6 +10,14 @@ HTTPConfig::HTTPConfig(main::ClientContext* context) {
     KU_ASSERT(context != nullptr);
     cacheFile =
         context->getCurrentSetting(HTTPCacheFileConfig::HTTP_CACHE_FILE_OPTION).getValue<bool>();
+    auto blockCacheSizeVal =
+        context->getCurrentSetting(HTTPBlockCacheSizeConfig::HTTP_BLOCK_CACHE_SIZE_OPTION)
+            .getValue<int64_t>();
+    blockCacheSize = blockCacheSizeVal < 0 ? 0 : blockCacheSizeVal;
+    auto connectionPoolSizeVal =
+        context->getCurrentSetting(HTTPConnectionPoolSizeConfig::HTTP_CONNECTION_POOL_SIZE_OPTION)
+            .getValue<int64_t>();
+    connectionPoolSize = connectionPoolSizeVal < 0 ? 0 : connectionPoolSizeVal;
 }
 
 void HTTPConfigEnvProvider::setOptionValue(main::ClientContext* context) {
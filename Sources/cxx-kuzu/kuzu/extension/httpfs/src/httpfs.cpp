@@ -3,6 +3,7 @@
 #include "common/cast.h"
 #include "common/exception/io.h"
 #include "common/exception/not_implemented.h"
+#include "common/task_system/task.h"
 #include "transaction/transaction.h"
 
 namespace kuzu {
@@ -21,7 +22,8 @@ HTTPFileInfo::HTTPFileInfo(std::string path, FileSystem* fileSystem, int flags,
     main::ClientContext* context)
     : FileInfo{std::move(path), fileSystem}, flags{flags}, length{0}, availableBuffer{0},
       bufferIdx{0}, fileOffset{0}, bufferStartPos{0}, bufferEndPos{0}, httpConfig{context},
-      cachedFileInfo{nullptr} {}
+      cachedFileInfo{nullptr}, memoryManager{storage::MemoryManager::Get(*context)},
+      taskScheduler{TaskScheduler::Get(*context)} {}
 
 void HTTPFileInfo::initMetadata() {
     auto hfs = fileSystem->ptrCast<HTTPFileSystem>();
@@ -40,8 +42,8 @@ void HTTPFileInfo::initMetadata() {
             return;
         } else if ((flags & FileFlags::READ_ONLY) && res->code != 404) {
             // HEAD request fail, use Range request for another try (read only one byte).
-            auto rangeRequest =
-                hfs->getRangeRequest(this, this->path, {}, 0, nullptr /* buffer */, 2);
+            auto rangeRequest = hfs->getRangeRequest(this, this->path, {}, 0,
+                nullptr /* buffer */, 2, httpClient);
             if (rangeRequest->code != 206) {
                 // LCOV_EXCL_START
                 throw IOException(stringFormat("Unable to connect to URL \"{}\": {} ({})",
@@ -106,6 +108,23 @@ void HTTPFileInfo::initMetadata() {
             // LCOV_EXCL_STOP
         }
     }
+
+    if ((flags & FileFlags::READ_ONLY) && httpConfig.blockCacheSize > 0) {
+        hfs->blockCache->setCapacity(httpConfig.blockCacheSize);
+        initBlockCacheKey(*res);
+    }
+}
+
+void HTTPFileInfo::initBlockCacheKey(HTTPResponse& response) {
+    // Without a version of the file, a modification on the server couldn't be told apart from the
+    // cached blocks, so such files are not cached.
+    if (response.headers.contains("ETag") && !response.headers["ETag"].empty()) {
+        blockCacheKey = stringFormat("{}\n{}", path, response.headers["ETag"]);
+    } else if (response.headers.contains("Last-Modified") &&
+               !response.headers["Last-Modified"].empty()) {
+        blockCacheKey =
+            stringFormat("{}\n{}\n{}", path, length, response.headers["Last-Modified"]);
+    }
 }
 
 void HTTPFileInfo::initialize(main::ClientContext* context) {
@@ -118,9 +137,25 @@ void HTTPFileInfo::initialize(main::ClientContext* context) {
     initMetadata();
 }
 
+HTTPFileInfo::~HTTPFileInfo() {
+    auto& clientPool = fileSystem->constPtrCast<HTTPFileSystem>()->getClientPool();
+    clientPool.release(clientHost, std::move(httpClient), httpConfig.connectionPoolSize);
+    for (auto& client : rangeClients) {
+        clientPool.release(clientHost, std::move(client), httpConfig.connectionPoolSize);
+    }
+}
+
+std::string HTTPFileInfo::getClientHost() const {
+    return HTTPFileSystem::parseUrl(path).first;
+}
+
+std::unique_ptr<httplib::Client> HTTPFileInfo::createClient() const {
+    return fileSystem->constPtrCast<HTTPFileSystem>()->getClientPool().acquire(clientHost);
+}
+
 void HTTPFileInfo::initializeClient() {
-    auto [host, hostPath] = HTTPFileSystem::parseUrl(path);
-    httpClient = HTTPFileSystem::getClient(host.c_str());
+    clientHost = getClientHost();
+    httpClient = createClient();
 }
 
 std::unique_ptr<common::FileInfo> HTTPFileSystem::openFile(const std::string& path,
@@ -177,6 +212,11 @@ void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint
         httpFileInfo.fileOffset = position + numBytes;
         return;
     }
+    if (!httpFileInfo.blockCacheKey.empty() && numBytes > 0 &&
+        numBytes <= httpFileInfo.httpConfig.blockCacheSize / 2) {
+        readFromBlockCache(httpFileInfo, buffer, numBytes, position);
+        return;
+    }
     if (position >= httpFileInfo.bufferStartPos && position < httpFileInfo.bufferEndPos) {
         httpFileInfo.fileOffset = position;
         httpFileInfo.bufferIdx = position - httpFileInfo.bufferStartPos;
@@ -210,14 +250,15 @@ void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint
             // Bypass buffer if we read more than buffer size.
             if (numBytesToRead > newBufferAvailableSize) {
                 getRangeRequest(&httpFileInfo, httpFileInfo.path, {}, position + bufferOffset,
-                    (char*)buffer + bufferOffset, numBytesToRead);
+                    (char*)buffer + bufferOffset, numBytesToRead, httpFileInfo.httpClient);
                 httpFileInfo.availableBuffer = 0;
                 httpFileInfo.bufferIdx = 0;
                 httpFileInfo.fileOffset += numBytesToRead;
                 break;
             } else {
                 getRangeRequest(&httpFileInfo, httpFileInfo.path, {}, httpFileInfo.fileOffset,
-                    (char*)httpFileInfo.readBuffer.get(), newBufferAvailableSize);
+                    (char*)httpFileInfo.readBuffer.get(), newBufferAvailableSize,
+                    httpFileInfo.httpClient);
                 httpFileInfo.availableBuffer = newBufferAvailableSize;
                 httpFileInfo.bufferIdx = 0;
                 httpFileInfo.bufferStartPos = httpFileInfo.fileOffset;
@@ -227,6 +268,155 @@ void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint
     }
 }
 
+void HTTPFileSystem::readFromBlockCache(HTTPFileInfo& fileInfo, void* buffer, uint64_t numBytes,
+    uint64_t position) const {
+    constexpr auto blockSize = HTTPBlockCache::BLOCK_SIZE;
+    auto startBlockIdx = position / blockSize;
+    auto endBlockIdx = (position + numBytes - 1) / blockSize;
+    std::vector<std::shared_ptr<const HTTPBlock>> blocks;
+    std::vector<std::pair<uint64_t, uint64_t>> missingBlockRanges;
+    auto addBlock = [&](uint64_t blockIdx) {
+        auto block = blockCache->get(fileInfo.blockCacheKey, blockIdx);
+        if (block == nullptr) {
+            if (!missingBlockRanges.empty() && missingBlockRanges.back().second == blockIdx &&
+                blockIdx - missingBlockRanges.back().first < MAX_NUM_BLOCKS_PER_REQUEST) {
+                missingBlockRanges.back().second++;
+            } else {
+                missingBlockRanges.emplace_back(blockIdx, blockIdx + 1);
+            }
+        }
+        blocks.push_back(std::move(block));
+    };
+    for (auto blockIdx = startBlockIdx; blockIdx <= endBlockIdx; blockIdx++) {
+        addBlock(blockIdx);
+    }
+    if (!missingBlockRanges.empty() && position == fileInfo.fileOffset) {
+        auto lastBlockIdx = (fileInfo.length - 1) / blockSize;
+        auto readAheadEndBlockIdx = std::min(endBlockIdx + READ_AHEAD_NUM_BLOCKS, lastBlockIdx);
+        for (auto blockIdx = endBlockIdx + 1; blockIdx <= readAheadEndBlockIdx; blockIdx++) {
+            addBlock(blockIdx);
+        }
+    }
+    fetchBlocks(fileInfo, missingBlockRanges, startBlockIdx, blocks);
+    uint64_t bufferOffset = 0;
+    for (auto blockIdx = startBlockIdx; bufferOffset < numBytes; blockIdx++) {
+        auto& block = blocks[blockIdx - startBlockIdx];
+        auto offsetInBlock = position + bufferOffset - blockIdx * blockSize;
+        auto numBytesToCopy = std::min(numBytes - bufferOffset, block->getSize() - offsetInBlock);
+        memcpy((uint8_t*)buffer + bufferOffset, block->getData() + offsetInBlock, numBytesToCopy);
+        bufferOffset += numBytesToCopy;
+    }
+    fileInfo.fileOffset = position + numBytes;
+}
+
+namespace {
+
+// The ranges of blocks missed by a read. The reading thread fetches ranges until none is left,
+// while the background tasks it schedules help on idle workers. The reading thread doesn't wait
+// for the tasks to be picked up, so a read never waits for workers that are busy, e.g. with the
+// query issuing the read, and the tasks find no range left once the read has returned.
+struct BlockRangeFetch {
+    // Fetches the range with the client of the given index.
+    std::function<void(uint64_t rangeIdx, uint64_t clientIdx)> fetchRange;
+    uint64_t numRanges;
+    std::atomic<uint64_t> nextRangeIdx;
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numRangesFetched;
+    std::exception_ptr error;
+
+    BlockRangeFetch(std::function<void(uint64_t, uint64_t)> fetchRange, uint64_t numRanges)
+        : fetchRange{std::move(fetchRange)}, numRanges{numRanges}, nextRangeIdx{0},
+          numRangesFetched{0} {}
+
+    void fetchRanges(uint64_t clientIdx) {
+        while (true) {
+            auto rangeIdx = nextRangeIdx.fetch_add(1);
+            if (rangeIdx >= numRanges) {
+                return;
+            }
+            std::exception_ptr rangeError;
+            try {
+                fetchRange(rangeIdx, clientIdx);
+            } catch (...) {
+                rangeError = std::current_exception();
+            }
+            std::unique_lock lck{mtx};
+            if (error == nullptr) {
+                error = rangeError;
+            }
+            numRangesFetched++;
+            cv.notify_all();
+        }
+    }
+
+    void waitForRanges() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return numRangesFetched == numRanges; });
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+class BlockRangeFetchTask final : public Task {
+public:
+    BlockRangeFetchTask(std::shared_ptr<BlockRangeFetch> fetch, uint64_t clientIdx)
+        : Task{1 /* maxNumThreads */}, fetch{std::move(fetch)}, clientIdx{clientIdx} {}
+
+    // Errors are rethrown by the reading thread.
+    void run() override { fetch->fetchRanges(clientIdx); }
+
+    std::string getName() const override { return "HTTP_BLOCK_RANGE_FETCH"; }
+
+private:
+    std::shared_ptr<BlockRangeFetch> fetch;
+    uint64_t clientIdx;
+};
+
+} // namespace
+
+void HTTPFileSystem::fetchBlocks(HTTPFileInfo& fileInfo,
+    const std::vector<std::pair<uint64_t, uint64_t>>& blockRanges, uint64_t startBlockIdx,
+    std::vector<std::shared_ptr<const HTTPBlock>>& blocks) const {
+    if (blockRanges.empty()) {
+        return;
+    }
+    constexpr auto blockSize = HTTPBlockCache::BLOCK_SIZE;
+    auto fetchBlockRange = [&](uint64_t rangeIdx, uint64_t clientIdx) {
+        // Client 0 is the client of the file, the others are used by the background tasks.
+        auto& client = clientIdx == 0 ? fileInfo.httpClient : fileInfo.rangeClients[clientIdx - 1];
+        auto [rangeStartBlockIdx, rangeEndBlockIdx] = blockRanges[rangeIdx];
+        auto rangeOffset = rangeStartBlockIdx * blockSize;
+        auto rangeLen = std::min(rangeEndBlockIdx * blockSize, fileInfo.length) - rangeOffset;
+        auto rangeBuffer = fileInfo.memoryManager->allocateBuffer(false /* initializeToZero */,
+            rangeLen);
+        getRangeRequest(&fileInfo, fileInfo.path, {}, rangeOffset, (char*)rangeBuffer->getData(),
+            rangeLen, client);
+        for (auto blockIdx = rangeStartBlockIdx; blockIdx < rangeEndBlockIdx; blockIdx++) {
+            auto offsetInRange = (blockIdx - rangeStartBlockIdx) * blockSize;
+            auto block = std::make_shared<HTTPBlock>(*fileInfo.memoryManager,
+                std::min(blockSize, rangeLen - offsetInRange));
+            memcpy(block->getData(), rangeBuffer->getData() + offsetInRange, block->getSize());
+            blockCache->put(fileInfo.blockCacheKey, blockIdx, block);
+            blocks[blockIdx - startBlockIdx] = std::move(block);
+        }
+    };
+    auto fetch = std::make_shared<BlockRangeFetch>(fetchBlockRange, blockRanges.size());
+#ifndef __SINGLE_THREADED__
+    auto numTasks = std::min<uint64_t>(MAX_NUM_PARALLEL_REQUESTS, blockRanges.size()) - 1;
+    while (fileInfo.rangeClients.size() < numTasks) {
+        fileInfo.rangeClients.push_back(fileInfo.createClient());
+    }
+    for (auto clientIdx = 1u; clientIdx <= numTasks; clientIdx++) {
+        fileInfo.taskScheduler->scheduleBackgroundTask(
+            std::make_shared<BlockRangeFetchTask>(fetch, clientIdx));
+    }
+#endif
+    fetch->fetchRanges(0 /* clientIdx */);
+    fetch->waitForRanges();
+}
+
 int64_t HTTPFileSystem::readFile(common::FileInfo& fileInfo, void* buf, size_t numBytes) const {
     auto& httpFileInfo = fileInfo.constCast<HTTPFileInfo>();
     if (httpFileInfo.cachedFileInfo != nullptr) {
@@ -384,10 +574,9 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::headRequest(FileInfo* fileInfo,
     return runRequestWithRetry(request, url, "HEAD", retry);
 }
 
-std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo,
+std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* /*fileInfo*/,
     const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-    uint64_t bufferLen) const {
-    auto httpFileInfo = ku_dynamic_cast<HTTPFileInfo*>(fileInfo);
+    uint64_t bufferLen, std::unique_ptr<httplib::Client>& client) const {
     auto parsedURL = parseUrl(url);
     auto host = parsedURL.first;
     auto hostPath = parsedURL.second;
@@ -399,8 +588,7 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo
     uint64_t bufferOffset = 0;
 
     std::function<httplib::Result(void)> request([&]() {
-        return httpFileInfo->httpClient->Get(
-            hostPath.c_str(), *headers,
+        return client->Get(hostPath.c_str(), *headers,
             [&](const httplib::Response& response) {
                 if (response.status >= 400) {
                     // LCOV_EXCL_START
@@ -443,7 +631,7 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo
                 return true;
             });
     });
-    std::function<void(void)> retryFunc([&]() { httpFileInfo->httpClient = getClient(host); });
+    std::function<void(void)> retryFunc([&]() { client = getClient(host); });
     return runRequestWithRetry(request, url, "GET Range", retryFunc);
 }
 
@@ -483,19 +671,18 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::postRequest(common::FileInfo* file
     return runRequestWithRetry(request, url, "POST");
 }
 
-std::unique_ptr<HTTPResponse> HTTPFileSystem::putRequest(common::FileInfo* fileInfo,
+std::unique_ptr<HTTPResponse> HTTPFileSystem::putRequest(common::FileInfo* /*fileInfo*/,
     const std::string& url, HeaderMap headerMap, const uint8_t* inputBuffer,
-    uint64_t inputBufferLen, std::string /*params*/) const {
-    auto httpFileInfo = ku_dynamic_cast<HTTPFileInfo*>(fileInfo);
-    auto hostPath = parseUrl(url).second;
+    uint64_t inputBufferLen, std::unique_ptr<httplib::Client>& client,
+    std::string /*params*/) const {
+    auto [host, hostPath] = parseUrl(url);
     auto headers = getHTTPHeaders(headerMap);
     std::function<httplib::Result(void)> request([&]() {
-        auto client = httpFileInfo->httpClient.get();
         return client->Put(hostPath.c_str(), *headers, reinterpret_cast<const char*>(inputBuffer),
             inputBufferLen, "application/octet-stream");
     });
-
-    return runRequestWithRetry(request, url, "PUT");
+    std::function<void(void)> retryFunc([&]() { client = getClient(host); });
+    return runRequestWithRetry(request, url, "PUT", retryFunc);
 }
 
 void HTTPFileSystem::initCachedFileManager(main::ClientContext* context) {
@@ -22,12 +22,19 @@ static void registerExtensionOptions(main::Database* db) {
         common::Value{static_cast<int64_t>(50)});
     db->addExtensionOption(HTTPCacheFileConfig::HTTP_CACHE_FILE_OPTION, common::LogicalTypeID::BOOL,
         common::Value{HTTPCacheFileConfig::DEFAULT_CACHE_FILE});
+    db->addExtensionOption(HTTPBlockCacheSizeConfig::HTTP_BLOCK_CACHE_SIZE_OPTION,
+        common::LogicalTypeID::INT64,
+        common::Value{HTTPBlockCacheSizeConfig::DEFAULT_BLOCK_CACHE_SIZE});
+    db->addExtensionOption(HTTPConnectionPoolSizeConfig::HTTP_CONNECTION_POOL_SIZE_OPTION,
+        common::LogicalTypeID::INT64,
+        common::Value{HTTPConnectionPoolSizeConfig::DEFAULT_CONNECTION_POOL_SIZE});
 }
 
 static void registerFileSystem(main::Database* db) {
-    db->registerFileSystem(std::make_unique<HTTPFileSystem>());
+    auto clientPool = std::make_shared<HTTPClientPool>();
+    db->registerFileSystem(std::make_unique<HTTPFileSystem>(clientPool));
     for (auto& fsConfig : S3FileSystemConfig::getAvailableConfigs()) {
-        db->registerFileSystem(std::make_unique<S3FileSystem>(fsConfig));
+        db->registerFileSystem(std::make_unique<S3FileSystem>(fsConfig, clientPool));
     }
 }
 
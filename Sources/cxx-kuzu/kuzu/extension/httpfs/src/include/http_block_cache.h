@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace httpfs_extension {
+
+// A block of a remote file. Its memory is allocated from the memory manager, so that it counts
+// towards the buffer pool size, but it isn't charged to the query that happened to read it first.
+struct HTTPBlock {
+    std::unique_ptr<storage::MemoryBuffer> buffer;
+
+    HTTPBlock(storage::MemoryManager& memoryManager, uint64_t size)
+        : buffer{memoryManager.allocateBufferUntracked(false /* initializeToZero */, size)} {}
+
+    uint8_t* getData() const { return buffer->getData(); }
+    uint64_t getSize() const { return buffer->getBuffer().size(); }
+};
+
+// A size-bounded LRU cache of fixed-size blocks of remote files, shared by all readers of a file
+// system. Blocks are keyed by the URL and the version of the file (its ETag or Last-Modified
+// header), so that the blocks of a file modified on the server are never served. Blocks are
+// handed out as shared pointers, so evicting a block doesn't invalidate it for a concurrent reader.
+class HTTPBlockCache {
+public:
+    static constexpr uint64_t BLOCK_SIZE = 2 * 1024 * 1024; // 2MB
+
+    explicit HTTPBlockCache() : capacity{0}, size{0} {}
+
+    void setCapacity(uint64_t newCapacity);
+    uint64_t getCapacity() const { return capacity; }
+
+    std::shared_ptr<const HTTPBlock> get(const std::string& fileKey, uint64_t blockIdx);
+    void put(const std::string& fileKey, uint64_t blockIdx, std::shared_ptr<const HTTPBlock> block);
+    // Drops all blocks, which are freed once no reader holds them anymore.
+    void clear();
+
+private:
+    static std::string getBlockKey(const std::string& fileKey, uint64_t blockIdx) {
+        return fileKey + "#" + std::to_string(blockIdx);
+    }
+    void evictIfNeeded();
+
+private:
+    using lru_list_t = std::list<std::pair<std::string, std::shared_ptr<const HTTPBlock>>>;
+
+    std::mutex mtx;
+    uint64_t capacity;
+    uint64_t size;
+    // Most recently used blocks are at the front.
+    lru_list_t lruList;
+    std::unordered_map<std::string, lru_list_t::iterator> blocks;
+};
+
+} // namespace httpfs_extension
+} // namespace kuzu
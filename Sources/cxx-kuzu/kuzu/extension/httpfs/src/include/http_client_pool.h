@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "httplib.h"
+
+namespace kuzu {
+namespace httpfs_extension {
+
+// Idle HTTP clients of each host, shared by all HTTP and S3 file systems of a database. Files on
+// the same host reuse the kept-alive connections of the clients released by previously closed
+// files, instead of paying a TCP and TLS handshake on every open. Clients idle for longer than
+// MAX_IDLE_TIME are evicted, together with the hosts left without idle clients, since servers
+// close idle kept-alive connections anyway.
+class HTTPClientPool {
+public:
+    static constexpr std::chrono::seconds MAX_IDLE_TIME{30};
+
+    HTTPClientPool() : numClientsCreated{0}, numClientsReused{0} {}
+
+    std::unique_ptr<httplib::Client> acquire(const std::string& host);
+    // Returns the client to the pool, unless maxNumIdleClients clients of the host are idle or the
+    // client has no open connection, e.g. because its last request failed.
+    void release(const std::string& host, std::unique_ptr<httplib::Client> client,
+        uint64_t maxNumIdleClients);
+
+    uint64_t getNumClientsCreated() const { return numClientsCreated.load(); }
+    uint64_t getNumClientsReused() const { return numClientsReused.load(); }
+
+private:
+    struct IdleClient {
+        std::unique_ptr<httplib::Client> client;
+        std::chrono::steady_clock::time_point releaseTime;
+    };
+
+    // Moves the clients idle for longer than MAX_IDLE_TIME to evictedClients, so that their
+    // connections are closed outside of the lock.
+    void evictIdleClientsNoLock(std::chrono::steady_clock::time_point now,
+        std::vector<IdleClient>& evictedClients);
+
+private:
+    std::mutex mtx;
+    // The clients of each host, from the least recently released one.
+    std::unordered_map<std::string, std::vector<IdleClient>> idleClients;
+    std::atomic<uint64_t> numClientsCreated;
+    std::atomic<uint64_t> numClientsReused;
+};
+
+} // namespace httpfs_extension
+} // namespace kuzu
@@ -9,6 +9,8 @@ struct HTTPConfig {
     explicit HTTPConfig(main::ClientContext* context);
 
     bool cacheFile;
+    uint64_t blockCacheSize;
+    uint64_t connectionPoolSize;
 };
 
 struct HTTPCacheFileConfig {
@@ -17,6 +19,20 @@ struct HTTPCacheFileConfig {
     static constexpr bool DEFAULT_CACHE_FILE = false;
 };
 
+// Size in bytes of the in-memory cache of blocks read from remote files, which is shared by all
+// connections. Setting it to 0 disables the cache.
+struct HTTPBlockCacheSizeConfig {
+    static constexpr const char* HTTP_BLOCK_CACHE_SIZE_OPTION = "http_block_cache_size";
+    static constexpr int64_t DEFAULT_BLOCK_CACHE_SIZE = 256 * 1024 * 1024; // 256MB
+};
+
+// Maximum number of idle clients kept for each host, whose connections are reused by the files
+// opened later on the host.
+struct HTTPConnectionPoolSizeConfig {
+    static constexpr const char* HTTP_CONNECTION_POOL_SIZE_OPTION = "http_connection_pool_size";
+    static constexpr int64_t DEFAULT_CONNECTION_POOL_SIZE = 16;
+};
+
 struct HTTPConfigEnvProvider {
     static void setOptionValue(main::ClientContext* context);
 };
@@ -2,6 +2,9 @@
 
 #include "cached_file_manager.h"
 #include "common/file_system/local_file_system.h"
+#include "common/task_system/task_scheduler.h"
+#include "http_block_cache.h"
+#include "http_client_pool.h"
 #include "http_config.h"
 #include "httplib.h"
 #include "main/client_context.h"
@@ -38,14 +41,26 @@ struct HTTPFileInfo : public common::FileInfo {
     HTTPFileInfo(std::string path, common::FileSystem* fileSystem, int flags,
         main::ClientContext* context);
 
+    // Returns the clients of the file to the client pool of the file system.
+    ~HTTPFileInfo() override;
+
     virtual void initialize(main::ClientContext* context);
 
-    virtual void initializeClient();
+    // The protocol, host and port that the clients of the file connect to.
+    virtual std::string getClientHost() const;
+
+    // Takes an idle client of the host from the client pool, or creates one.
+    std::unique_ptr<httplib::Client> createClient() const;
+
+    void initializeClient();
 
     void initMetadata();
 
     // We keep a http client stored for connection reuse with keep-alive headers.
     std::unique_ptr<httplib::Client> httpClient;
+    std::string clientHost;
+    // Additional clients for the range requests issued in parallel on block cache misses.
+    std::vector<std::unique_ptr<httplib::Client>> rangeClients;
 
     int flags;
     uint64_t length;
@@ -58,12 +73,24 @@ struct HTTPFileInfo : public common::FileInfo {
     constexpr static uint64_t READ_BUFFER_LEN = 1000000;
     HTTPConfig httpConfig;
     std::unique_ptr<common::FileInfo> cachedFileInfo;
+    // Key of the file in the block cache, consisting of the URL and the version of the file. Empty
+    // if the file is not read through the block cache.
+    std::string blockCacheKey;
+    // Allocate the blocks of the block cache and fetch the ranges of blocks missed by a read.
+    storage::MemoryManager* memoryManager;
+    common::TaskScheduler* taskScheduler;
+
+private:
+    void initBlockCacheKey(HTTPResponse& response);
 };
 
 class HTTPFileSystem : public common::FileSystem {
     friend struct HTTPFileInfo;
 
 public:
+    explicit HTTPFileSystem(std::shared_ptr<HTTPClientPool> clientPool)
+        : clientPool{std::move(clientPool)} {}
+
     std::unique_ptr<common::FileInfo> openFile(const std::string& path, common::FileOpenFlags flags,
         main::ClientContext* context = nullptr) override;
 
@@ -84,8 +111,12 @@ public:
 
     CachedFileManager& getCachedFileManager() { return *cachedFileManager; }
 
+    HTTPClientPool& getClientPool() const { return *clientPool; }
+
     void cleanUP(main::ClientContext* context) override;
 
+    void releaseMemory() override { blockCache->clear(); }
+
 protected:
     void readFromFile(common::FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const override;
@@ -103,24 +134,47 @@ protected:
     virtual std::unique_ptr<HTTPResponse> headRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap) const;
 
+    // Issues the range request through the given client, which is reset on retries.
     virtual std::unique_ptr<HTTPResponse> getRangeRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-        uint64_t bufferLen) const;
+        uint64_t bufferLen, std::unique_ptr<httplib::Client>& client) const;
 
     virtual std::unique_ptr<HTTPResponse> postRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, std::unique_ptr<uint8_t[]>& outputBuffer,
         uint64_t& outputBufferLen, const uint8_t* inputBuffer, uint64_t inputBufferLen,
         std::string params = "") const;
 
+    // Issues the put request through the given client, which is reset on retries.
     virtual std::unique_ptr<HTTPResponse> putRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, const uint8_t* inputBuffer,
-        uint64_t inputBufferLen, std::string params = "") const;
+        uint64_t inputBufferLen, std::unique_ptr<httplib::Client>& client,
+        std::string params = "") const;
 
     void initCachedFileManager(main::ClientContext* context);
 
 private:
+    // Reads through the block cache. Missing blocks are fetched with one range request per run of
+    // consecutive blocks, and the runs are requested in parallel by the reading thread and by
+    // background tasks of the task scheduler. A read that resumes where the previous read of the
+    // file ended and misses the cache also fetches the following blocks.
+    void readFromBlockCache(HTTPFileInfo& fileInfo, void* buffer, uint64_t numBytes,
+        uint64_t position) const;
+    // Fetches the given [start, end) ranges of blocks into the cache and into blocks, which holds
+    // the blocks from startBlockIdx on.
+    void fetchBlocks(HTTPFileInfo& fileInfo,
+        const std::vector<std::pair<uint64_t, uint64_t>>& blockRanges, uint64_t startBlockIdx,
+        std::vector<std::shared_ptr<const HTTPBlock>>& blocks) const;
+
+private:
+    static constexpr uint64_t READ_AHEAD_NUM_BLOCKS = 2;
+    static constexpr uint64_t MAX_NUM_BLOCKS_PER_REQUEST = 4;
+    static constexpr uint64_t MAX_NUM_PARALLEL_REQUESTS = 4;
+
     std::unique_ptr<CachedFileManager> cachedFileManager;
     std::mutex cachedFileManagerMtx;
+    std::unique_ptr<HTTPBlockCache> blockCache = std::make_unique<HTTPBlockCache>();
+    // Shared with the other HTTP and S3 file systems of the database.
+    std::shared_ptr<HTTPClientPool> clientPool;
 };
 
 } // namespace httpfs_extension
@@ -37,7 +37,7 @@ struct S3FileInfo final : public HTTPFileInfo {
 
     void initialize(main::ClientContext* context) override;
 
-    void initializeClient() override;
+    std::string getClientHost() const override;
 
     std::shared_ptr<S3WriteBuffer> getBuffer(uint16_t writeBufferIdx);
 
@@ -94,7 +94,7 @@ private:
     static constexpr char uploadIDCloseTag[] = "</UploadId>";
 
 public:
-    explicit S3FileSystem(S3FileSystemConfig fsConfig);
+    S3FileSystem(S3FileSystemConfig fsConfig, std::shared_ptr<HTTPClientPool> clientPool);
 
     std::unique_ptr<common::FileInfo> openFile(const std::string& path, common::FileOpenFlags flags,
         main::ClientContext* context = nullptr) override;
@@ -130,7 +130,7 @@ protected:
 
     std::unique_ptr<HTTPResponse> getRangeRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-        uint64_t bufferLen) const override;
+        uint64_t bufferLen, std::unique_ptr<httplib::Client>& client) const override;
 
     std::unique_ptr<HTTPResponse> postRequest(common::FileInfo* fileInfo, const std::string& url,
         HeaderMap headerMap, std::unique_ptr<uint8_t[]>& outputBuffer, uint64_t& outputBufferLen,
@@ -138,7 +138,7 @@ protected:
 
     std::unique_ptr<HTTPResponse> putRequest(common::FileInfo* fileInfo, const std::string& url,
         HeaderMap headerMap, const uint8_t* inputBuffer, uint64_t inputBufferLen,
-        std::string httpParams = "") const override;
+        std::unique_ptr<httplib::Client>& client, std::string httpParams = "") const override;
 
 private:
     static std::string getPayloadHash(const uint8_t* buffer, uint64_t bufferLen);
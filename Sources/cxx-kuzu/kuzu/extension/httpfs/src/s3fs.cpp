@@ -47,10 +47,10 @@ void S3FileInfo::initialize(main::ClientContext* context) {
     }
 }
 
-void S3FileInfo::initializeClient() {
-    auto parsedURL = fileSystem->constPtrCast<S3FileSystem>()->parseS3URL(path, authParams);
-    auto protoHostPort = parsedURL.httpProto + parsedURL.host;
-    httpClient = HTTPFileSystem::getClient(protoHostPort);
+std::string S3FileInfo::getClientHost() const {
+    auto params = authParams;
+    auto parsedURL = fileSystem->constPtrCast<S3FileSystem>()->parseS3URL(path, params);
+    return parsedURL.httpProto + parsedURL.host;
 }
 
 std::shared_ptr<S3WriteBuffer> S3FileInfo::getBuffer(uint16_t writeBufferIdx) {
@@ -90,7 +90,8 @@ S3UploadParams getS3UploadParams(main::ClientContext* context) {
     return uploadParams;
 }
 
-S3FileSystem::S3FileSystem(S3FileSystemConfig fsConfig) : fsConfig(std::move(fsConfig)) {}
+S3FileSystem::S3FileSystem(S3FileSystemConfig fsConfig, std::shared_ptr<HTTPClientPool> clientPool)
+    : HTTPFileSystem{std::move(clientPool)}, fsConfig(std::move(fsConfig)) {}
 
 std::unique_ptr<common::FileInfo> S3FileSystem::openFile(const std::string& path,
     FileOpenFlags flags, main::ClientContext* context) {
@@ -586,13 +587,13 @@ std::unique_ptr<HTTPResponse> S3FileSystem::headRequest(common::FileInfo* fileIn
 
 std::unique_ptr<HTTPResponse> S3FileSystem::getRangeRequest(common::FileInfo* fileInfo,
     const std::string& url, HeaderMap /*headerMap*/, uint64_t fileOffset, char* buffer,
-    uint64_t bufferLen) const {
+    uint64_t bufferLen, std::unique_ptr<httplib::Client>& client) const {
     auto& authParams = fileInfo->ptrCast<S3FileInfo>()->authParams;
     auto parsedS3URL = parseS3URL(url, authParams);
     auto s3HTTPUrl = parsedS3URL.getHTTPURL();
     auto headers = createS3Header(parsedS3URL.path, "", parsedS3URL.host, "s3", "GET", authParams);
     return HTTPFileSystem::getRangeRequest(fileInfo, s3HTTPUrl, headers, fileOffset, buffer,
-        bufferLen);
+        bufferLen, client);
 }
 
 std::unique_ptr<HTTPResponse> S3FileSystem::postRequest(common::FileInfo* fileInfo,
@@ -611,14 +612,16 @@ std::unique_ptr<HTTPResponse> S3FileSystem::postRequest(common::FileInfo* fileIn
 
 std::unique_ptr<HTTPResponse> S3FileSystem::putRequest(common::FileInfo* fileInfo,
     const std::string& url, kuzu::httpfs_extension::HeaderMap /*headerMap*/,
-    const uint8_t* inputBuffer, uint64_t inputBufferLen, std::string httpParams) const {
+    const uint8_t* inputBuffer, uint64_t inputBufferLen, std::unique_ptr<httplib::Client>& client,
+    std::string httpParams) const {
     auto& authParams = fileInfo->ptrCast<S3FileInfo>()->authParams;
     auto parsedS3URL = parseS3URL(url, authParams);
     auto httpURL = parsedS3URL.getHTTPURL(httpParams);
     auto payloadHash = getPayloadHash(inputBuffer, inputBufferLen);
     auto headers = createS3Header(parsedS3URL.path, httpParams, parsedS3URL.host, "s3", "PUT",
         authParams, payloadHash, "application/octet-stream");
-    return HTTPFileSystem::putRequest(fileInfo, httpURL, headers, inputBuffer, inputBufferLen);
+    return HTTPFileSystem::putRequest(fileInfo, httpURL, headers, inputBuffer, inputBufferLen,
+        client);
 }
 
 std::string S3FileSystem::getPayloadHash(const uint8_t* buffer, uint64_t bufferLen) {
@@ -665,19 +668,24 @@ void S3FileSystem::uploadBuffer(S3FileInfo* fileInfo,
     std::string queryParam =
         "partNumber=" + std::to_string(bufferToUpload->partID + 1) + "&" +
         "uploadId=" + StringUtils::encodeURL(fileInfo->multipartUploadID, true);
-    std::unique_ptr<HTTPResponse> res;
-    case_insensitive_map_t<std::string>::iterator etagIter;
+    // Each part is uploaded on its own connection, since a client serializes its requests.
+    auto client = fileInfo->createClient();
     try {
-        res = s3FileSystem->putRequest(fileInfo, fileInfo->path, {} /* headerMap */,
-            bufferToUpload->getData(), bufferToUpload->numBytesWritten, queryParam);
+        auto res = s3FileSystem->putRequest(fileInfo, fileInfo->path, {} /* headerMap */,
+            bufferToUpload->getData(), bufferToUpload->numBytesWritten, client, queryParam);
         if (res->code != 200) {
             throw IOException(stringFormat("Unable to connect to URL {} {} (HTTP code {})",
                 res->url, res->error, std::to_string(res->code)));
         }
-        etagIter = res->headers.find("ETag");
+        auto etagIter = res->headers.find("ETag");
         if (etagIter == res->headers.end()) {
             throw IOException("Unexpected response when uploading part to S3");
         }
+        {
+            std::unique_lock<std::mutex> lck(fileInfo->partEtagsLock);
+            fileInfo->partEtags.emplace(bufferToUpload->partID, etagIter->second);
+        }
+        fileInfo->numPartsUploaded++;
     } catch (IOException& ex) {
         // Ensure only one thread sets the exception
         bool hasException = false;
@@ -685,19 +693,11 @@ void S3FileSystem::uploadBuffer(S3FileInfo* fileInfo,
         if (exchanged) {
             fileInfo->uploadException = std::current_exception();
         }
-        {
-            std::unique_lock<std::mutex> lck(fileInfo->uploadsInProgressLock);
-            fileInfo->uploadsInProgress--;
-        }
-        fileInfo->uploadsInProgressCV.notify_one();
-
-        return;
-    }
-    {
-        std::unique_lock<std::mutex> lck(fileInfo->partEtagsLock);
-        fileInfo->partEtags.emplace(bufferToUpload->partID, etagIter->second);
     }
-    fileInfo->numPartsUploaded++;
+    s3FileSystem->getClientPool().release(fileInfo->clientHost, std::move(client),
+        fileInfo->httpConfig.connectionPoolSize);
+    // The buffer is released on failures as well, so that writers waiting for a free buffer are
+    // not blocked forever.
     bufferToUpload.reset();
     {
         std::unique_lock<std::mutex> lck(s3FileSystem->bufferInfoLock);
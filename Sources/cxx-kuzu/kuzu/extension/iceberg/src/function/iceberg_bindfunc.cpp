@@ -39,14 +39,14 @@ static std::string generateQueryOptions(const TableFuncBindInput* input,
 
 std::unique_ptr<TableFuncBindData> bindFuncHelper(main::ClientContext* context,
     const TableFuncBindInput* input, const std::string& functionName) {
-    auto connector = std::make_shared<IcebergConnector>();
-    connector->connect("" /* inMemDB */, "" /* defaultCatalogName */, "" /* defaultSchemaName */,
-        context);
+    auto connector =
+        duckdb_extension::DuckDBConnector::getSharedConnector<IcebergConnector>(context);
 
     std::string query_options = generateQueryOptions(input, functionName);
     std::string query = stringFormat("SELECT * FROM {}('{}'{})", functionName,
         input->getLiteralVal<std::string>(0), query_options);
-    auto result = connector->executeQuery(query + " LIMIT 1");
+    // Binding reads the metadata of the table but none of its data files.
+    auto result = connector->prepareQuery(query);
 
     std::vector<LogicalType> returnTypes;
     std::vector<std::string> returnColumnNames;
@@ -55,17 +55,17 @@ std::unique_ptr<TableFuncBindData> bindFuncHelper(main::ClientContext* context,
         auto scanInput = ku_dynamic_cast<ExtraScanTableFuncBindInput*>(input->extraInput.get());
         returnColumnNames = scanInput->expectedColumnNames;
         if (scanInput->expectedColumnNames.empty()) {
-            for (auto name : result->names) {
+            for (auto& name : result->GetNames()) {
                 returnColumnNames.push_back(name);
             }
         }
     }
-    for (auto type : result->types) {
+    for (auto& type : result->GetTypes()) {
         returnTypes.push_back(
             duckdb_extension::DuckDBTypeConverter::convertDuckDBType(type.ToString()));
     }
     if (functionName != "ICEBERG_SCAN") {
-        for (auto name : result->names) {
+        for (auto& name : result->GetNames()) {
             returnColumnNames.push_back(name);
         }
     }
@@ -73,7 +73,9 @@ std::unique_ptr<TableFuncBindData> bindFuncHelper(main::ClientContext* context,
     returnColumnNames =
         TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
     auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
-    return std::make_unique<delta_extension::DeltaScanBindData>(std::move(query), connector,
+    std::vector<std::string> columnNamesInDuckDB = result->GetNames();
+    return std::make_unique<delta_extension::DeltaScanBindData>(std::move(query),
+        std::move(columnNamesInDuckDB), connector,
         duckdb_extension::DuckDBResultConverter{returnTypes}, columns, context);
 }
 
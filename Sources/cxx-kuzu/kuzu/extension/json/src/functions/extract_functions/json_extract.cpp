@@ -1,3 +1,5 @@
+#include <optional>
+
 #include "common/exception/binder.h"
 #include "function/scalar_function.h"
 #include "json_extract_functions.h"
@@ -19,6 +21,12 @@ static void jsonExtractSinglePath(
     const auto& param2 = *parameters[1];
     const auto& param1SelVector = *parameterSelVectors[0];
     const auto& param2SelVector = *parameterSelVectors[1];
+    // A constant path is split into its keys once.
+    std::optional<JsonPath> constantPath;
+    if (param2.state->isFlat() && param2.dataType.getLogicalTypeID() == LogicalTypeID::STRING &&
+        !param2.isNull(param2SelVector[0])) {
+        constantPath.emplace(param2.getValue<ku_string_t>(param2SelVector[0]).getAsString());
+    }
     for (auto selectedPos = 0u; selectedPos < resultSelVector->getSelSize(); ++selectedPos) {
         auto resultPos = (*resultSelVector)[selectedPos];
         auto param1Pos = param1SelVector[param1.state->isFlat() ? 0 : selectedPos];
@@ -26,14 +34,16 @@ static void jsonExtractSinglePath(
         auto isNull = param1.isNull(param1Pos) || param2.isNull(param2Pos);
         result.setNull(resultPos, isNull);
         if (!isNull) {
-            auto param1Str = param1.getValue<ku_string_t>(param1Pos).getAsString();
+            auto doc = readCachedJson(param1.getValue<ku_string_t>(param1Pos));
             std::string output;
-            if (param2.dataType.getLogicalTypeID() == LogicalTypeID::STRING) {
-                auto param2Str = param2.getAsValue(param2Pos)->toString();
-                output = jsonExtractToString(stringToJson(param1Str), param2Str);
+            if (constantPath.has_value()) {
+                output = jsonExtractToString(*doc, *constantPath);
+            } else if (param2.dataType.getLogicalTypeID() == LogicalTypeID::STRING) {
+                auto param2Str = param2.getValue<ku_string_t>(param2Pos).getAsString();
+                output = jsonExtractToString(*doc, param2Str);
             } else if (param2.dataType.getLogicalTypeID() == LogicalTypeID::INT64) {
                 auto param2Int = param2.getValue<int64_t>(param2Pos);
-                output = jsonExtractToString(stringToJson(param1Str), param2Int);
+                output = jsonExtractToString(*doc, param2Int);
             } else {
                 KU_UNREACHABLE;
             }
@@ -68,7 +78,7 @@ static void jsonExtractMultiPath(
         auto isNull = param1.isNull(param1Pos) || param2.isNull(param2Pos);
         result.setNull(resultPos, isNull);
         if (!isNull) {
-            auto param1Str = param1.getValue<ku_string_t>(param1Pos).getAsString();
+            auto doc = readCachedJson(param1.getValue<ku_string_t>(param1Pos));
             auto param2List = param2.getValue<list_entry_t>(param2Pos);
             auto resultList = ListVector::addList(&result, param2List.size);
             result.setValue<list_entry_t>(resultPos, resultList);
@@ -77,7 +87,7 @@ static void jsonExtractMultiPath(
                     param2DataVector->getValue<ku_string_t>(param2List.offset + i).getAsString();
                 resultDataVector->setNull(resultList.offset + i, false);
                 StringVector::addString(resultDataVector, resultList.offset + i,
-                    jsonExtractToString(stringToJson(param1Str), curPath));
+                    jsonExtractToString(*doc, curPath));
             }
         }
     }
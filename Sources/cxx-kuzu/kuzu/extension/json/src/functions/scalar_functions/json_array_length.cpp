@@ -19,8 +19,7 @@ static void jsonArrayLength(const std::vector<std::shared_ptr<common::ValueVecto
         result.setNull(resultPos, isNull);
         if (!isNull) {
             result.setValue<uint32_t>(resultPos,
-                jsonArraySize(
-                    stringToJson(parameters[0]->getValue<ku_string_t>(inputPos).getAsString())));
+                jsonArraySize(*readCachedJson(parameters[0]->getValue<ku_string_t>(inputPos))));
         }
     }
 }
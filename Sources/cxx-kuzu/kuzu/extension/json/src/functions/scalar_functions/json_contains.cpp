@@ -130,14 +130,12 @@ static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& pa
         auto isNull = param1.isNull(param1Pos) || param2.isNull(param2Pos);
         result.setNull(resultPos, isNull);
         if (!isNull) {
-            auto haystackStr = param1.getValue<ku_string_t>(param1Pos).getAsString();
-            auto needleStr = param2.getValue<ku_string_t>(param2Pos).getAsString();
-            auto haystackDoc = JsonWrapper{JSONCommon::readDocument(haystackStr,
-                JSONCommon::READ_FLAG, nullptr /* yyjsonAlc */)};
-            auto needleDoc = JsonWrapper{JSONCommon::readDocument(needleStr, JSONCommon::READ_FLAG,
-                nullptr /* yyjsonAlc */)};
+            auto haystackDoc =
+                readCachedJson(param1.getValue<ku_string_t>(param1Pos), JSONCommon::READ_FLAG);
+            auto needleDoc =
+                readCachedJson(param2.getValue<ku_string_t>(param2Pos), JSONCommon::READ_FLAG);
             result.setValue<bool>(resultPos,
-                jsonContains(haystackDoc.ptr->root, needleDoc.ptr->root));
+                jsonContains(haystackDoc->ptr->root, needleDoc->ptr->root));
         }
     }
 }
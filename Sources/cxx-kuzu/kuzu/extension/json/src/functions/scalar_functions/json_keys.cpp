@@ -25,13 +25,12 @@ static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& pa
         auto isNull = param.isNull(paramPos);
         result.setNull(resultPos, isNull);
         if (!isNull) {
-            auto paramStr = param.getValue<ku_string_t>(paramPos).getAsString();
-            auto doc = JsonWrapper{
-                JSONCommon::readDocument(paramStr, JSONCommon::READ_FLAG, nullptr /* jsonAlc */)};
-            auto numKeys = yyjson_obj_size(yyjson_doc_get_root(doc.ptr));
+            auto doc =
+                readCachedJson(param.getValue<ku_string_t>(paramPos), JSONCommon::READ_FLAG);
+            auto numKeys = yyjson_obj_size(yyjson_doc_get_root(doc->ptr));
             auto resultList = ListVector::addList(&result, numKeys);
             result.setValue<list_entry_t>(resultPos, resultList);
-            yyjson_obj_foreach(yyjson_doc_get_root(doc.ptr), idx, max, key, childVal) {
+            yyjson_obj_foreach(yyjson_doc_get_root(doc->ptr), idx, max, key, childVal) {
                 StringVector::addString(resultDataVector, resultList.offset + idx,
                     std::string(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key)));
             }
@@ -20,8 +20,7 @@ static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& pa
         auto isNull = parameters[0]->isNull(paramPos);
         result.setNull(resultPos, isNull);
         if (!isNull) {
-            auto paramStr = param.getValue<ku_string_t>(paramPos).getAsString();
-            auto schema = jsonSchema(stringToJson(paramStr));
+            auto schema = jsonSchema(*readCachedJson(param.getValue<ku_string_t>(paramPos)));
             result.setNull(resultPos, false /* isNull */);
             StringVector::addString(&result, resultPos, schema.toString());
         }
@@ -28,6 +28,7 @@ using namespace kuzu::function;
 using namespace kuzu::common;
 
 struct JsonScanBindData;
+class JsonColumnInfo;
 
 struct JSONWarningSourceData {
     JSONWarningSourceData() = default;
@@ -133,7 +134,15 @@ struct JSONScanSharedState : public TableFuncSharedState {
 };
 
 struct JSONScanLocalState : public TableFuncLocalState {
+    // Parsed records. A record read by the projection-aware scan has no document, and the values
+    // of its projected fields are in projectedFields instead.
     yyjson_doc* docs[DEFAULT_VECTOR_CAPACITY];
+    std::vector<std::pair<column_id_t, yyjson_val*>> projectedFields[DEFAULT_VECTOR_CAPACITY];
+    // Set if only some of the columns are projected, in which case the top level fields of the
+    // records are scanned without building their documents, and only the values of the projected
+    // fields are parsed.
+    const JsonColumnInfo* columnInfo = nullptr;
+    std::vector<bool> columnSkips;
     BufferedJsonReader* currentReader = nullptr;
     JsonScanBufferHandle* currentBufferHandle = nullptr;
     bool isLast = false;
@@ -172,6 +181,11 @@ struct JSONScanLocalState : public TableFuncLocalState {
     std::optional<uint64_t> parseJson(uint8_t* jsonStart, uint64_t jsonSize, uint64_t remaining,
         idx_t numLinesInJson,
         const std::optional<std::vector<ValueVector*>>& warningDataVectors = {});
+    // Scans the top level fields of a JSON object, and parses the values of the projected fields
+    // into projectedFields. Returns the number of bytes of the object, or std::nullopt if the
+    // record can't be scanned this way, e.g. because it is malformed or has escaped keys, in which
+    // case it is parsed as a whole instead.
+    std::optional<uint64_t> parseProjectedFields(uint8_t* jsonStart, uint64_t jsonSize);
 
     bool reconstructFirstObject();
 
@@ -365,16 +379,23 @@ void JSONScanLocalState::handleParseError(yyjson_read_err& err, bool completedPa
 std::optional<uint64_t> JSONScanLocalState::parseJson(uint8_t* jsonStart, uint64_t size,
     uint64_t remaining, idx_t numLinesInJson,
     const std::optional<std::vector<ValueVector*>>& warningDataVectors) {
+    std::optional<uint64_t> numProjectedBytesRead;
+    if (columnInfo != nullptr) {
+        numProjectedBytesRead = parseProjectedFields(jsonStart, size);
+    }
     yyjson_doc* doc = nullptr;
     yyjson_read_err err;
-    doc = JSONCommon::readDocumentUnsafe(jsonStart, remaining, JSONCommon::READ_INSITU_FLAG,
-        allocator.getYYJsonAlc(), &err);
-    if (err.code != YYJSON_READ_SUCCESS) {
-        handleParseError(err, false);
-        return std::nullopt;
+    if (!numProjectedBytesRead.has_value()) {
+        doc = JSONCommon::readDocumentUnsafe(jsonStart, remaining, JSONCommon::READ_INSITU_FLAG,
+            allocator.getYYJsonAlc(), &err);
+        if (err.code != YYJSON_READ_SUCCESS) {
+            handleParseError(err, false);
+            return std::nullopt;
+        }
     }
 
-    idx_t numBytesRead = yyjson_doc_get_read_size(doc);
+    idx_t numBytesRead = numProjectedBytesRead.has_value() ? *numProjectedBytesRead :
+                                                             yyjson_doc_get_read_size(doc);
     if (warningDataVectors && !warningDataVectors->empty()) {
         const auto recordStartOffset = getFileOffset();
         const auto recordEndOffset = getFileOffset() + numBytesRead;
@@ -404,6 +425,10 @@ std::optional<uint64_t> JSONScanLocalState::parseJson(uint8_t* jsonStart, uint64
         }
     }
 
+    if (numProjectedBytesRead.has_value()) {
+        docs[numValuesToOutput] = nullptr;
+        return 1;
+    }
     if (!doc) {
         docs[numValuesToOutput] = nullptr;
         return 0;
@@ -716,6 +741,7 @@ public:
     DELETE_COPY_DEFAULT_MOVE(JsonColumnInfo);
 
     uint64_t getFieldIdx(yyjson_val* fieldName) const;
+    uint64_t getFieldIdx(std::string_view fieldName) const;
 
 private:
     // Note: JSON keys are case-sensitive.
@@ -732,7 +758,10 @@ JsonColumnInfo::JsonColumnInfo(std::vector<std::string> columnNames) {
 }
 
 uint64_t JsonColumnInfo::getFieldIdx(yyjson_val* key) const {
-    auto fieldName = std::string_view(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key));
+    return getFieldIdx(std::string_view(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key)));
+}
+
+uint64_t JsonColumnInfo::getFieldIdx(std::string_view fieldName) const {
     // For a small number of keys, probing a vector is faster than lookups in an unordered_map
     if (colNames.size() < 24) {
         auto iter = std::find(colNames.begin(), colNames.end(), fieldName);
@@ -754,6 +783,199 @@ uint64_t JsonColumnInfo::getFieldIdx(yyjson_val* key) const {
     return UINT64_MAX;
 }
 
+static void skipSpaces(const uint8_t*& ptr, const uint8_t* end) {
+    while (ptr != end && StringUtils::isSpace(*ptr)) {
+        ptr++;
+    }
+}
+
+// Returns the end of the string starting after its opening quote, or nullptr if it is not closed.
+static const uint8_t* skipString(const uint8_t* ptr, const uint8_t* end) {
+    while (ptr != end) {
+        switch (*ptr++) {
+        case '"':
+            return ptr;
+        case '\\':
+            if (ptr != end) {
+                ptr++; // Skip the escaped char
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return nullptr;
+}
+
+static const uint8_t* skipDigits(const uint8_t* ptr, const uint8_t* end) {
+    while (ptr != end && *ptr >= '0' && *ptr <= '9') {
+        ptr++;
+    }
+    return ptr;
+}
+
+// Checks a scalar other than a string the way yyjson reads it with JSONCommon::READ_FLAG: a
+// literal, a number, or inf and nan in any case.
+static bool isValidScalar(const uint8_t* ptr, const uint8_t* end) {
+    auto literal = std::string_view(reinterpret_cast<const char*>(ptr), end - ptr);
+    if (literal == "true" || literal == "false" || literal == "null") {
+        return true;
+    }
+    if (*ptr == '-') {
+        ptr++;
+        literal.remove_prefix(1);
+    }
+    if (StringUtils::caseInsensitiveEquals(literal, "nan") ||
+        StringUtils::caseInsensitiveEquals(literal, "inf") ||
+        StringUtils::caseInsensitiveEquals(literal, "infinity")) {
+        return true;
+    }
+    auto intEnd = skipDigits(ptr, end);
+    if (intEnd == ptr || (*ptr == '0' && intEnd - ptr > 1)) {
+        return false;
+    }
+    ptr = intEnd;
+    if (ptr != end && *ptr == '.') {
+        auto fracStart = ++ptr;
+        ptr = skipDigits(ptr, end);
+        if (ptr == fracStart) {
+            return false;
+        }
+    }
+    if (ptr != end && (*ptr == 'e' || *ptr == 'E')) {
+        ptr++;
+        if (ptr != end && (*ptr == '+' || *ptr == '-')) {
+            ptr++;
+        }
+        auto expStart = ptr;
+        ptr = skipDigits(ptr, end);
+        if (ptr == expStart) {
+            return false;
+        }
+    }
+    return ptr == end;
+}
+
+// Returns the end of the JSON value starting at ptr without parsing it, or nullptr if it is
+// malformed. Values of fields that are not projected are only checked here, so scalars are
+// validated as well as the nesting of containers.
+static const uint8_t* skipValue(const uint8_t* ptr, const uint8_t* end) {
+    uint64_t parents = 0;
+    while (ptr != end) {
+        switch (*ptr) {
+        case '{':
+        case '[':
+            parents++;
+            ptr++;
+            break;
+        case '}':
+        case ']':
+            if (parents == 0) {
+                return nullptr;
+            }
+            parents--;
+            ptr++;
+            break;
+        case '"':
+            ptr = skipString(ptr + 1, end);
+            if (ptr == nullptr) {
+                return nullptr;
+            }
+            break;
+        default: {
+            auto scalarStart = ptr;
+            while (ptr != end && *ptr != ',' && *ptr != ':' && *ptr != '}' && *ptr != ']' &&
+                   !StringUtils::isSpace(*ptr)) {
+                ptr++;
+            }
+            if (ptr == scalarStart) {
+                if (parents == 0) {
+                    return nullptr;
+                }
+                ptr++; // Either a separator or a space within the parent.
+            } else if (!isValidScalar(scalarStart, ptr)) {
+                return nullptr;
+            } else if (parents == 0) {
+                return ptr;
+            }
+        } break;
+        }
+        if (parents == 0) {
+            return ptr;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<uint64_t> JSONScanLocalState::parseProjectedFields(uint8_t* jsonStart,
+    uint64_t jsonSize) {
+    auto& fields = projectedFields[numValuesToOutput];
+    fields.clear();
+    const uint8_t* ptr = jsonStart;
+    const uint8_t* end = jsonStart + jsonSize;
+    skipSpaces(ptr, end);
+    if (ptr == end || *ptr != '{') {
+        return std::nullopt;
+    }
+    ptr++;
+    while (true) {
+        skipSpaces(ptr, end);
+        if (ptr == end) {
+            return std::nullopt;
+        }
+        if (*ptr == '}') {
+            break;
+        }
+        if (*ptr != '"') {
+            return std::nullopt;
+        }
+        auto keyStart = ++ptr;
+        while (ptr != end && *ptr != '"' && *ptr != '\\') {
+            ptr++;
+        }
+        if (ptr == end || *ptr == '\\') {
+            // Escaped keys have to be unescaped before they can be matched to columns.
+            return std::nullopt;
+        }
+        auto key = std::string_view(reinterpret_cast<const char*>(keyStart), ptr - keyStart);
+        ptr++;
+        skipSpaces(ptr, end);
+        if (ptr == end || *ptr != ':') {
+            return std::nullopt;
+        }
+        ptr++;
+        skipSpaces(ptr, end);
+        auto valueStart = ptr;
+        ptr = skipValue(ptr, end);
+        if (ptr == nullptr) {
+            return std::nullopt;
+        }
+        auto columnIdx = columnInfo->getFieldIdx(key);
+        if (columnIdx != UINT64_MAX && !columnSkips[columnIdx]) {
+            // The value isn't parsed in-situ, so that the record is left intact in case it has
+            // to be parsed as a whole.
+            yyjson_read_err err;
+            auto doc = JSONCommon::readDocumentUnsafe(const_cast<uint8_t*>(valueStart),
+                ptr - valueStart, JSONCommon::READ_FLAG, allocator.getYYJsonAlc(), &err);
+            if (err.code != YYJSON_READ_SUCCESS) {
+                return std::nullopt;
+            }
+            fields.emplace_back(columnIdx, doc->root);
+        }
+        skipSpaces(ptr, end);
+        if (ptr == end) {
+            return std::nullopt;
+        }
+        if (*ptr == ',') {
+            ptr++;
+        } else if (*ptr != '}') {
+            return std::nullopt;
+        }
+    }
+    ptr++;
+    return ptr - jsonStart;
+}
+
 struct JsonScanBindData : public ScanFileBindData {
     std::shared_ptr<JsonColumnInfo> columnInfo;
     JsonScanFormat format;
@@ -910,7 +1132,13 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
     yyjson_doc** docs = localState->docs;
     yyjson_val *key = nullptr, *ele = nullptr;
     for (auto i = 0u; i < count; i++) {
-        KU_ASSERT(nullptr != docs[i]);
+        if (docs[i] == nullptr) {
+            KU_ASSERT(localState->columnInfo != nullptr);
+            for (auto& [columnIdx, val] : localState->projectedFields[i]) {
+                readJsonToValueVector(val, *output.dataChunk.valueVectors[columnIdx], i);
+            }
+            continue;
+        }
         auto objIter = yyjson_obj_iter_with(docs[i]->root);
         while ((key = yyjson_obj_iter_next(&objIter))) {
             ele = yyjson_obj_iter_get_val(key);
@@ -939,6 +1167,13 @@ static std::unique_ptr<TableFuncLocalState> initLocalState(
     auto sharedState = input.sharedState.ptrCast<JSONScanSharedState>();
     auto& mm = *storage::MemoryManager::Get(*input.clientContext);
     auto localState = std::make_unique<JSONScanLocalState>(mm, *sharedState, jsonBindData->context);
+    auto columnSkips = jsonBindData->getColumnSkips();
+    auto numColumns = jsonBindData->getNumColumns() - jsonBindData->numWarningDataColumns;
+    if (std::any_of(columnSkips.begin(), columnSkips.begin() + numColumns,
+            [](bool skip) { return skip; })) {
+        localState->columnInfo = jsonBindData->columnInfo.get();
+        localState->columnSkips = std::move(columnSkips);
+    }
     return localState;
 }
 
@@ -71,8 +71,33 @@ JsonWrapper stringToJsonNoError(const std::string& str);
 
 JsonWrapper mergeJson(const JsonWrapper& A, const JsonWrapper& B);
 
+// Returns the document parsed from the string. Each thread caches the documents it parsed from
+// the last vectors, so that the JSON functions of an expression which read the same values, e.g.
+// several json_extract calls on one property, parse each of them once.
+std::shared_ptr<const JsonWrapper> readCachedJson(const common::ku_string_t& str,
+    yyjson_read_flag flag = 0);
+
+// A path such as `$.a.b.0` or `a/b/0`, split into its keys once so that it can be looked up in many
+// documents.
+class JsonPath {
+public:
+    explicit JsonPath(const std::string& path);
+
+    // Returns nullptr if the value doesn't have the path.
+    yyjson_val* lookup(yyjson_val* val) const;
+
+private:
+    struct Key {
+        std::string name;
+        // The index of the key in an array, or -1 if the key is not an integer.
+        int32_t idx;
+    };
+    std::vector<Key> keys;
+};
+
 std::string jsonExtractToString(const JsonWrapper& wrapper, uint64_t pos);
 std::string jsonExtractToString(const JsonWrapper& wrapper, std::string path);
+std::string jsonExtractToString(const JsonWrapper& wrapper, const JsonPath& path);
 
 uint32_t jsonArraySize(const JsonWrapper& wrapper);
 
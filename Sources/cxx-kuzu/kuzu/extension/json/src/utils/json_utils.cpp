@@ -3,6 +3,7 @@
 #include <cstdlib>
 
 #include "common/exception/not_implemented.h"
+#include "common/json_common.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "function/cast/functions/cast_decimal.h"
@@ -618,33 +619,77 @@ std::string jsonExtractToString(const JsonWrapper& wrapper, uint64_t pos) {
     return jsonToString(yyjson_arr_get(yyjson_doc_get_root(wrapper.ptr), pos));
 }
 
-std::string jsonExtractToString(const JsonWrapper& wrapper, std::string path) {
-    std::vector<std::string> actualPath;
+std::shared_ptr<const JsonWrapper> readCachedJson(const ku_string_t& str,
+    yyjson_read_flag flag) {
+    // The documents are dropped once the strings they were parsed from take more than this.
+    static constexpr uint64_t MAX_CACHED_BYTES = 4 * 1024 * 1024; // 4MB
+    thread_local std::unordered_map<std::string, std::shared_ptr<const JsonWrapper>> cache;
+    thread_local uint64_t numCachedBytes = 0;
+    auto strView = str.getAsStringView();
+    // The flag is part of the key since it changes which strings are valid documents.
+    std::string key;
+    key.reserve(strView.size() + sizeof(flag));
+    key.append(strView);
+    key.append(reinterpret_cast<const char*>(&flag), sizeof(flag));
+    if (auto it = cache.find(key); it != cache.end()) {
+        return it->second;
+    }
+    auto doc = std::make_shared<const JsonWrapper>(JSONCommon::readDocument(
+        (uint8_t*)strView.data(), strView.size(), flag, nullptr /* alc */));
+    if (numCachedBytes + key.size() > MAX_CACHED_BYTES) {
+        cache.clear();
+        numCachedBytes = 0;
+    }
+    numCachedBytes += key.size();
+    cache.emplace(std::move(key), doc);
+    return doc;
+}
+
+JsonPath::JsonPath(const std::string& path) {
     for (auto i = 0u, prvDelim = 0u; i <= path.size(); i++) {
         if (i == path.size() || path[i] == '/' || path[i] == '.') {
-            actualPath.push_back(path.substr(prvDelim, i - prvDelim));
+            auto name = path.substr(prvDelim, i - prvDelim);
+            auto isRoot = prvDelim == 0 && name == "$";
             prvDelim = i + 1;
+            if (isRoot) {
+                continue;
+            }
+            int32_t idx = -1;
+            if (!function::trySimpleIntegerCast(name.c_str(), name.length(), idx)) {
+                idx = -1;
+            }
+            keys.push_back(Key{std::move(name), idx});
         }
     }
-    yyjson_val* ptr = yyjson_doc_get_root(wrapper.ptr);
-    for (const auto& item : actualPath) {
-        if (&item == &actualPath.front() && item == "$") {
-            continue;
-        }
-        if (yyjson_get_type(ptr) == YYJSON_TYPE_OBJ) {
-            ptr = yyjson_obj_get(ptr, item.c_str());
+}
+
+yyjson_val* JsonPath::lookup(yyjson_val* val) const {
+    for (const auto& key : keys) {
+        if (yyjson_get_type(val) == YYJSON_TYPE_OBJ) {
+            val = yyjson_obj_getn(val, key.name.c_str(), key.name.size());
         } else {
-            int32_t idx = -1;
-            if (!function::trySimpleIntegerCast(item.c_str(), item.length(), idx)) {
-                return "";
+            if (key.idx < 0) {
+                return nullptr;
             }
-            ptr = yyjson_arr_get(ptr, idx);
+            val = yyjson_arr_get(val, key.idx);
         }
-        if (ptr == nullptr) {
-            return "";
+        if (val == nullptr) {
+            return nullptr;
         }
     }
-    return jsonToString(ptr);
+    return val;
+}
+
+std::string jsonExtractToString(const JsonWrapper& wrapper, std::string path) {
+    return jsonExtractToString(wrapper, JsonPath{path});
+}
+
+std::string jsonExtractToString(const JsonWrapper& wrapper, const JsonPath& path) {
+    auto val = path.lookup(yyjson_doc_get_root(wrapper.ptr));
+    if (val == nullptr) {
+        return "";
+    }
+    return jsonToString(val);
 }
 
 uint32_t jsonArraySize(const JsonWrapper& wrapper) {
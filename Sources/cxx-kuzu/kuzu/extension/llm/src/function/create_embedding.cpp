@@ -1,8 +1,16 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
 #include "binder/expression/expression_util.h"
 #include "common/exception/binder.h"
 #include "common/exception/connection.h"
 #include "common/string_utils.h"
 #include "function/built_in_function_utils.h"
+#include "function/embedding_cache.h"
 #include "function/llm_functions.h"
 #include "function/scalar_function.h"
 #include "httplib.h"
@@ -50,58 +58,243 @@ public:
     };
 };
 
+// Keeps the HTTP clients of a provider alive across calls so that their connections are reused.
+// Clients are not thread-safe, so each concurrent request takes one out of the pool. The pool also
+// rate limits the requests: once the server throttles a request, all requests wait for the time
+// it asked for.
+class EmbeddingClientPool {
+public:
+    explicit EmbeddingClientPool(std::string host) : host{std::move(host)} {}
+
+    std::unique_ptr<httplib::Client> acquire() {
+        std::unique_lock lck{mtx};
+        if (!idleClients.empty()) {
+            auto client = std::move(idleClients.back());
+            idleClients.pop_back();
+            return client;
+        }
+        lck.unlock();
+        auto client = std::make_unique<httplib::Client>(host);
+        client->set_keep_alive(true);
+        client->set_connection_timeout(30);
+        client->set_read_timeout(30);
+        client->set_write_timeout(30);
+        return client;
+    }
+
+    void release(std::unique_ptr<httplib::Client> client) {
+        std::unique_lock lck{mtx};
+        idleClients.push_back(std::move(client));
+    }
+
+    void throttle(std::chrono::milliseconds delay) {
+        std::unique_lock lck{mtx};
+        resumeTime = std::max(resumeTime, std::chrono::steady_clock::now() + delay);
+    }
+
+    void waitIfThrottled() {
+        std::unique_lock lck{mtx};
+        auto time = resumeTime;
+        lck.unlock();
+        std::this_thread::sleep_until(time);
+    }
+
+private:
+    std::mutex mtx;
+    std::string host;
+    std::vector<std::unique_ptr<httplib::Client>> idleClients;
+    std::chrono::steady_clock::time_point resumeTime;
+};
+
 struct CreateEmbeddingBindData : public FunctionBindData {
     std::shared_ptr<EmbeddingProvider> provider;
     std::string model;
+    std::shared_ptr<EmbeddingClientPool> clientPool;
+    // nullptr if the cache is disabled.
+    std::shared_ptr<EmbeddingCache> cache;
+    // Identifies the provider, its configuration and the model in the cache keys.
+    std::string cacheKeyPrefix;
 
     CreateEmbeddingBindData(std::vector<common::LogicalType> paramTypes,
         common::LogicalType resultType, std::shared_ptr<EmbeddingProvider> provider,
-        std::string model)
+        std::string model, std::shared_ptr<EmbeddingClientPool> clientPool,
+        std::shared_ptr<EmbeddingCache> cache, std::string cacheKeyPrefix)
         : FunctionBindData{std::move(paramTypes), std::move(resultType)},
-          provider{std::move(provider)}, model{std::move(model)} {}
+          provider{std::move(provider)}, model{std::move(model)},
+          clientPool{std::move(clientPool)}, cache{std::move(cache)},
+          cacheKeyPrefix{std::move(cacheKeyPrefix)} {}
 
     std::unique_ptr<FunctionBindData> copy() const override {
         return std::make_unique<CreateEmbeddingBindData>(common::LogicalType::copy(paramTypes),
-            resultType.copy(), provider, model);
+            resultType.copy(), provider, model, clientPool, cache, cacheKeyPrefix);
     }
 };
 
-static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& parameters,
-    const std::vector<common::SelectionVector*>& /*parameterSelVectors*/,
-    common::ValueVector& result, common::SelectionVector* resultSelVector, void* dataPtr) {
-    auto& bindData = ((FunctionBindData*)(dataPtr))->cast<CreateEmbeddingBindData>();
-    auto& provider = bindData.provider;
-    auto model = bindData.model;
-    httplib::Client client(provider->getClient());
-    client.set_connection_timeout(30);
-    client.set_read_timeout(30);
-    client.set_write_timeout(30);
-    std::string path = provider->getPath(model);
+// Requests of a call that are in flight at the same time.
+static constexpr uint64_t MAX_NUM_CONCURRENT_REQUESTS = 8;
+static constexpr uint64_t MAX_NUM_ATTEMPTS = 5;
+static constexpr std::chrono::milliseconds INITIAL_RETRY_DELAY{500};
 
-    result.resetAuxiliaryBuffer();
-    for (auto selectedPos = 0u; selectedPos < resultSelVector->getSelSize(); ++selectedPos) {
-        auto text = parameters[0]->getValue<ku_string_t>(selectedPos).getAsString();
-        nlohmann::json payload = provider->getPayload(model, text);
-        httplib::Headers headers = provider->getHeaders(model, payload);
-        auto res = client.Post(path, headers, payload.dump(), "application/json");
+static bool isRetryable(const httplib::Result& res) {
+    // Connection failures, throttling and server errors are usually transient.
+    return !res || res->status == 429 || res->status >= 500;
+}
+
+static std::chrono::milliseconds getRetryDelay(const httplib::Result& res, uint64_t attempt) {
+    // Retry-After may also be an HTTP date, which falls back to exponential backoff.
+    if (res && res->has_header("Retry-After")) {
+        auto value = res->get_header_value("Retry-After");
+        if (!value.empty() && std::all_of(value.begin(), value.end(), ::isdigit)) {
+            return std::chrono::seconds{std::stoll(value)};
+        }
+    }
+    return INITIAL_RETRY_DELAY * (1 << attempt);
+}
+
+static std::vector<std::vector<float>> embedBatch(const CreateEmbeddingBindData& bindData,
+    httplib::Client& client, const std::vector<std::string>& texts) {
+    auto& provider = bindData.provider;
+    const auto path = provider->getBatchPath(bindData.model);
+    const auto payload = provider->getBatchPayload(bindData.model, texts);
+    const auto body = payload.dump();
+    for (auto attempt = 0u;; attempt++) {
+        bindData.clientPool->waitIfThrottled();
+        // Headers are signed with the current time by some providers, so they are created again
+        // for each attempt.
+        auto headers = provider->getHeaders(bindData.model, payload);
+        auto res = client.Post(path, headers, body, "application/json");
+        if (res && res->status == 200) {
+            auto embeddings = provider->parseBatchResponse(res);
+            if (embeddings.size() != texts.size()) {
+                throw ConnectionException("Request failed: Expected " +
+                                          std::to_string(texts.size()) + " embeddings but got " +
+                                          std::to_string(embeddings.size()) + "\n" +
+                                          std::string(EmbeddingProvider::referenceKuzuDocs));
+            }
+            return embeddings;
+        }
+        if (isRetryable(res) && attempt + 1 < MAX_NUM_ATTEMPTS) {
+            auto delay = getRetryDelay(res, attempt);
+            if (res && res->status == 429) {
+                bindData.clientPool->throttle(delay);
+            } else {
+                std::this_thread::sleep_for(delay);
+            }
+            continue;
+        }
         if (!res) {
             throw ConnectionException("Request failed: Could not connect to server <" +
                                       provider->getClient() + "> \n" +
                                       std::string(EmbeddingProvider::referenceKuzuDocs));
-        } else if (res->status != 200) {
-            throw ConnectionException("Request failed with status " + std::to_string(res->status) +
-                                      "\n Body: " + res->body + "\n" +
-                                      std::string(EmbeddingProvider::referenceKuzuDocs));
         }
-        auto embeddingVec = provider->parseResponse(res);
+        throw ConnectionException("Request failed with status " + std::to_string(res->status) +
+                                  "\n Body: " + res->body + "\n" +
+                                  std::string(EmbeddingProvider::referenceKuzuDocs));
+    }
+}
+
+static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& parameters,
+    const std::vector<common::SelectionVector*>& parameterSelVectors,
+    common::ValueVector& result, common::SelectionVector* resultSelVector, void* dataPtr) {
+    auto& bindData = ((FunctionBindData*)(dataPtr))->cast<CreateEmbeddingBindData>();
+    result.resetAuxiliaryBuffer();
+    // Texts are grouped into batches, which are sent concurrently.
+    std::vector<sel_t> positions;
+    std::vector<std::string> texts;
+    for (auto selectedPos = 0u; selectedPos < resultSelVector->getSelSize(); ++selectedPos) {
         auto pos = (*resultSelVector)[selectedPos];
-        auto resultEntry = ListVector::addList(&result, embeddingVec.size());
-        result.setValue(pos, resultEntry);
-        auto resultDataVector = ListVector::getDataVector(&result);
-        auto resultPos = resultEntry.offset;
-        for (auto i = 0u; i < embeddingVec.size(); i++) {
-            resultDataVector->copyFromValue(resultPos++, Value(embeddingVec[i]));
+        auto textPos = parameters[0]->state->isFlat() ? (*parameterSelVectors[0])[0] : pos;
+        if (parameters[0]->isNull(textPos)) {
+            result.setNull(pos, true /* isNull */);
+            continue;
+        }
+        positions.push_back(pos);
+        texts.push_back(parameters[0]->getValue<ku_string_t>(textPos).getAsString());
+    }
+    std::vector<std::vector<float>> embeddings(texts.size());
+    // Indices of the texts whose embeddings are not cached.
+    std::vector<uint64_t> textsToEmbed;
+    std::vector<std::string> cacheKeys;
+    for (auto i = 0u; i < texts.size(); i++) {
+        if (bindData.cache == nullptr) {
+            textsToEmbed.push_back(i);
+            continue;
         }
+        auto key = EmbeddingCache::getKey(bindData.cacheKeyPrefix, texts[i]);
+        if (!bindData.cache->lookup(key, embeddings[i])) {
+            textsToEmbed.push_back(i);
+            cacheKeys.push_back(std::move(key));
+        }
+    }
+    const auto batchSize =
+        std::max<uint64_t>(bindData.provider->getMaxBatchSize(bindData.model), 1);
+    const auto numBatches = (textsToEmbed.size() + batchSize - 1) / batchSize;
+    std::atomic<uint64_t> nextBatchIdx = 0;
+    std::atomic<bool> failed = false;
+    auto embedBatches = [&]() {
+        auto client = bindData.clientPool->acquire();
+        for (auto batchIdx = nextBatchIdx++; batchIdx < numBatches && !failed;
+             batchIdx = nextBatchIdx++) {
+            auto start = batchIdx * batchSize;
+            auto end = std::min<uint64_t>(start + batchSize, textsToEmbed.size());
+            std::vector<std::string> batchTexts;
+            for (auto i = start; i < end; i++) {
+                batchTexts.push_back(texts[textsToEmbed[i]]);
+            }
+            auto batchEmbeddings = embedBatch(bindData, *client, batchTexts);
+            for (auto i = start; i < end; i++) {
+                embeddings[textsToEmbed[i]] = std::move(batchEmbeddings[i - start]);
+            }
+        }
+        bindData.clientPool->release(std::move(client));
+    };
+    const auto numThreads = std::min<uint64_t>(MAX_NUM_CONCURRENT_REQUESTS, numBatches);
+    // The calling thread sends requests as well.
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            try {
+                embedBatches();
+            } catch (...) {
+                errors[i] = std::current_exception();
+                failed = true;
+            }
+        });
+    }
+    if (numThreads > 0) {
+        try {
+            embedBatches();
+        } catch (...) {
+            errors[0] = std::current_exception();
+            failed = true;
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    if (bindData.cache != nullptr && !textsToEmbed.empty()) {
+        std::vector<std::vector<float>> newEmbeddings;
+        for (auto i : textsToEmbed) {
+            newEmbeddings.push_back(embeddings[i]);
+        }
+        bindData.cache->insert(cacheKeys, newEmbeddings);
+    }
+    // Embeddings are copied straight into the data vector of the result.
+    for (auto i = 0u; i < positions.size(); i++) {
+        auto& embedding = embeddings[i];
+        auto resultEntry = ListVector::addList(&result, embedding.size());
+        result.setNull(positions[i], false /* isNull */);
+        result.setValue(positions[i], resultEntry);
+        auto resultDataVector = ListVector::getDataVector(&result);
+        memcpy(resultDataVector->getData() + resultEntry.offset * sizeof(float), embedding.data(),
+            embedding.size() * sizeof(float));
+        resultDataVector->setNullRange(resultEntry.offset, embedding.size(), false /* value */);
     }
 }
 
@@ -171,9 +364,14 @@ static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& inp
                 ExpressionUtil::getDataTypes(input.arguments), supportedInputs)) +
             '\n' + EmbeddingProvider::referenceKuzuDocs));
     }
+    auto clientPool = std::make_shared<EmbeddingClientPool>(provider->getClient());
+    auto cacheKeyPrefix = providerName + '\n' + modelName + '\n' +
+                          (numConfig.has_value() ? std::to_string(numConfig.value()) : "") +
+                          '\n' + stringConfig.value_or("") + '\n';
     return std::make_unique<CreateEmbeddingBindData>(ExpressionUtil::getDataTypes(input.arguments),
         LogicalType::LIST(LogicalType(LogicalTypeID::FLOAT)), std::move(provider),
-        std::move(modelName));
+        std::move(modelName), std::move(clientPool), EmbeddingCache::get(*clientContext),
+        std::move(cacheKeyPrefix));
 }
 
 function_set CreateEmbedding::getFunctionSet() {
@@ -0,0 +1,202 @@
+#include "function/embedding_cache.h"
+
+#include <cstring>
+
+#include "common/exception/io.h"
+#include "common/sha256.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace llm_extension {
+
+// Each entry of the cache file is the key, followed by the number of floats of the embedding and
+// the floats. A partially written entry at the end of the file is dropped when the file is loaded.
+static constexpr uint64_t KEY_SIZE = SHA256::SHA256_HASH_LENGTH_TEXT;
+// Small files are not worth rewriting.
+static constexpr uint64_t MIN_FILE_SIZE_TO_COMPACT = 1 << 20; // 1MB
+
+std::shared_ptr<EmbeddingCache> EmbeddingCache::get(main::ClientContext& context) {
+    const auto capacity =
+        context.getCurrentSetting(EmbeddingCacheSizeConfig::EMBEDDING_CACHE_SIZE_OPTION)
+            .getValue<int64_t>();
+    if (capacity <= 0) {
+        return nullptr;
+    }
+    const auto path =
+        context.isInMemory() ? std::string{} : context.getDatabasePath() + FILE_SUFFIX;
+    // Read-only databases load the cache file without writing to it, so they get their own cache.
+    const auto persistent = !path.empty() && !context.getDBConfig()->readOnly;
+    static std::mutex cachesMtx;
+    static std::unordered_map<std::string, std::shared_ptr<EmbeddingCache>> caches;
+    std::unique_lock lck{cachesMtx};
+    auto& cache = caches[(persistent ? "rw:" : "ro:") + path];
+    if (cache == nullptr) {
+        cache = std::shared_ptr<EmbeddingCache>(new EmbeddingCache(path, persistent, capacity));
+    } else {
+        cache->setCapacity(capacity);
+    }
+    return cache;
+}
+
+std::string EmbeddingCache::getKey(const std::string& prefix, const std::string& text) {
+    SHA256 hasher;
+    hasher.addString(prefix);
+    hasher.addString(text);
+    std::string key(KEY_SIZE, '\0');
+    hasher.finishSHA256(key.data());
+    return key;
+}
+
+EmbeddingCache::EmbeddingCache(std::string path, bool persistent, uint64_t capacity)
+    : path{std::move(path)}, fileSystem{""}, fileSize{0}, capacity{capacity}, size{0} {
+    if (this->path.empty()) {
+        return;
+    }
+    try {
+        if (persistent) {
+            fileInfo = fileSystem.openFile(this->path,
+                FileOpenFlags(FileFlags::READ_ONLY | FileFlags::WRITE |
+                                  FileFlags::CREATE_IF_NOT_EXISTS,
+                    FileLockType::WRITE_LOCK));
+        } else if (fileSystem.fileOrPathExists(this->path)) {
+            fileInfo = fileSystem.openFile(this->path, FileOpenFlags(FileFlags::READ_ONLY));
+        }
+        load();
+        if (persistent) {
+            if (fileSize < fileInfo->getFileSize()) {
+                fileInfo->truncate(fileSize);
+            }
+            compactFileIfNeeded();
+        }
+    } catch (const IOException&) {
+        // The file is locked by another process or can't be read, so the cache stays in memory.
+        entries.clear();
+        entryMap.clear();
+        size = 0;
+    }
+    if (!persistent) {
+        fileInfo.reset();
+    }
+}
+
+bool EmbeddingCache::lookup(const std::string& key, std::vector<float>& embedding) {
+    std::unique_lock lck{mtx};
+    auto it = entryMap.find(key);
+    if (it == entryMap.end()) {
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    embedding = it->second->embedding;
+    return true;
+}
+
+void EmbeddingCache::insert(const std::vector<std::string>& keys,
+    const std::vector<std::vector<float>>& embeddings) {
+    KU_ASSERT(keys.size() == embeddings.size());
+    std::unique_lock lck{mtx};
+    std::vector<uint8_t> buffer;
+    for (auto i = 0u; i < keys.size(); i++) {
+        if (entryMap.contains(keys[i])) {
+            continue;
+        }
+        Entry entry{keys[i], embeddings[i]};
+        if (fileInfo != nullptr) {
+            serialize(entry, buffer);
+        }
+        insertNoLock(std::move(entry));
+    }
+    evictIfNeeded();
+    if (fileInfo == nullptr || buffer.empty()) {
+        return;
+    }
+    fileInfo->writeFile(buffer.data(), buffer.size(), fileSize);
+    fileSize += buffer.size();
+    compactFileIfNeeded();
+}
+
+void EmbeddingCache::serialize(const Entry& entry, std::vector<uint8_t>& buffer) {
+    const auto offset = buffer.size();
+    const auto numValues = static_cast<uint32_t>(entry.embedding.size());
+    buffer.resize(offset + getSize(entry));
+    memcpy(buffer.data() + offset, entry.key.data(), KEY_SIZE);
+    memcpy(buffer.data() + offset + KEY_SIZE, &numValues, sizeof(numValues));
+    memcpy(buffer.data() + offset + KEY_SIZE + sizeof(numValues), entry.embedding.data(),
+        numValues * sizeof(float));
+}
+
+void EmbeddingCache::setCapacity(uint64_t newCapacity) {
+    std::unique_lock lck{mtx};
+    capacity = newCapacity;
+    evictIfNeeded();
+}
+
+void EmbeddingCache::load() {
+    if (fileInfo == nullptr) {
+        return;
+    }
+    const auto numBytes = fileInfo->getFileSize();
+    std::vector<uint8_t> buffer(numBytes);
+    if (numBytes > 0) {
+        fileInfo->readFromFile(buffer.data(), numBytes, 0);
+    }
+    // Entries are appended as they are inserted, so the later ones are the most recently used.
+    uint64_t offset = 0;
+    while (offset + KEY_SIZE + sizeof(uint32_t) <= numBytes) {
+        uint32_t numValues = 0;
+        memcpy(&numValues, buffer.data() + offset + KEY_SIZE, sizeof(numValues));
+        const auto entrySize = KEY_SIZE + sizeof(uint32_t) + numValues * sizeof(float);
+        if (offset + entrySize > numBytes) {
+            break;
+        }
+        Entry entry{std::string(reinterpret_cast<const char*>(buffer.data() + offset), KEY_SIZE),
+            std::vector<float>(numValues)};
+        memcpy(entry.embedding.data(), buffer.data() + offset + KEY_SIZE + sizeof(uint32_t),
+            numValues * sizeof(float));
+        if (auto it = entryMap.find(entry.key); it != entryMap.end()) {
+            size -= getSize(*it->second);
+            entries.erase(it->second);
+            entryMap.erase(it);
+        }
+        insertNoLock(std::move(entry));
+        evictIfNeeded();
+        offset += entrySize;
+    }
+    fileSize = offset;
+}
+
+void EmbeddingCache::insertNoLock(Entry entry) {
+    size += getSize(entry);
+    entries.push_front(std::move(entry));
+    entryMap.emplace(entries.front().key, entries.begin());
+}
+
+void EmbeddingCache::evictIfNeeded() {
+    while (size > capacity && !entries.empty()) {
+        size -= getSize(entries.back());
+        entryMap.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+void EmbeddingCache::compactFileIfNeeded() {
+    // The file keeps the evicted and partially written entries until it is rewritten.
+    if (fileInfo == nullptr || fileSize < MIN_FILE_SIZE_TO_COMPACT || fileSize <= 2 * size) {
+        return;
+    }
+    std::vector<uint8_t> buffer;
+    buffer.reserve(size);
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        serialize(*it, buffer);
+    }
+    fileInfo->truncate(0);
+    if (!buffer.empty()) {
+        fileInfo->writeFile(buffer.data(), buffer.size(), 0);
+    }
+    fileSize = buffer.size();
+}
+
+} // namespace llm_extension
+} // namespace kuzu
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/file_system/local_file_system.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace llm_extension {
+
+// Size in bytes of the cache of embeddings returned by providers. Setting it to 0 disables the
+// cache.
+struct EmbeddingCacheSizeConfig {
+    static constexpr const char* EMBEDDING_CACHE_SIZE_OPTION = "llm_embedding_cache_size";
+    static constexpr int64_t DEFAULT_EMBEDDING_CACHE_SIZE = 256 * 1024 * 1024; // 256MB
+};
+
+// Caches the embeddings returned by providers, keyed by a SHA-256 hash of the provider, its
+// configuration, the model and the text, so that embedding an unchanged text again doesn't call the
+// provider. Least recently used embeddings are evicted once the cache is full.
+//
+// The cache of an on-disk database is kept in a file next to the database, to which new embeddings
+// are appended, and which is rewritten when it holds many evicted embeddings. The cache is shared
+// by the databases of the process with the same path. Read-only databases, in-memory databases,
+// and databases whose cache file is locked by another process keep the cache in memory only.
+class EmbeddingCache {
+public:
+    static constexpr const char* FILE_SUFFIX = ".embedding_cache";
+
+    // Returns nullptr if the cache is disabled.
+    static std::shared_ptr<EmbeddingCache> get(main::ClientContext& context);
+
+    static std::string getKey(const std::string& prefix, const std::string& text);
+
+    bool lookup(const std::string& key, std::vector<float>& embedding);
+    void insert(const std::vector<std::string>& keys,
+        const std::vector<std::vector<float>>& embeddings);
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<float> embedding;
+    };
+
+    EmbeddingCache(std::string path, bool persistent, uint64_t capacity);
+
+    static uint64_t getSize(const Entry& entry) {
+        return entry.key.size() + sizeof(uint32_t) + entry.embedding.size() * sizeof(float);
+    }
+    static void serialize(const Entry& entry, std::vector<uint8_t>& buffer);
+
+    void setCapacity(uint64_t newCapacity);
+    void load();
+    void insertNoLock(Entry entry);
+    void evictIfNeeded();
+    void compactFileIfNeeded();
+
+private:
+    std::mutex mtx;
+    std::string path;
+    common::LocalFileSystem fileSystem;
+    // nullptr if the cache is not persisted.
+    std::unique_ptr<common::FileInfo> fileInfo;
+    uint64_t fileSize;
+    uint64_t capacity;
+    uint64_t size;
+    // Ordered from most to least recently used.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entryMap;
+};
+
+} // namespace llm_extension
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/assert.h"
 #include "httplib.h"
 #include "json.hpp"
 
@@ -19,6 +20,19 @@ public:
         const nlohmann::json& payload) const = 0;
     virtual nlohmann::json getPayload(const std::string& model, const std::string& text) const = 0;
     virtual std::vector<float> parseResponse(const httplib::Result& res) const = 0;
+    // Providers with a batch endpoint embed up to getMaxBatchSize() texts per request. The
+    // defaults embed a single text per request with the methods above.
+    virtual uint64_t getMaxBatchSize(const std::string& /*model*/) const { return 1; }
+    virtual std::string getBatchPath(const std::string& model) const { return getPath(model); }
+    virtual nlohmann::json getBatchPayload(const std::string& model,
+        const std::vector<std::string>& texts) const {
+        KU_ASSERT(texts.size() == 1);
+        return getPayload(model, texts[0]);
+    }
+    // Returns the embeddings of the texts of the batch in order.
+    virtual std::vector<std::vector<float>> parseBatchResponse(const httplib::Result& res) const {
+        return {parseResponse(res)};
+    }
     virtual void configure(const std::optional<uint64_t>& dimensions,
         const std::optional<std::string>& regionOrEndpoint) = 0;
 };
@@ -1,5 +1,6 @@
 #include "main/llm_extension.h"
 
+#include "function/embedding_cache.h"
 #include "function/llm_functions.h"
 #include "main/client_context.h"
 
@@ -18,6 +19,9 @@ void LlmExtension::load(main::ClientContext* context) {
     auto& db = *context->getDatabase();
 
     extension::ExtensionUtils::addScalarFunc<CreateEmbedding>(db);
+    db.addExtensionOption(EmbeddingCacheSizeConfig::EMBEDDING_CACHE_SIZE_OPTION,
+        common::LogicalTypeID::INT64,
+        common::Value{EmbeddingCacheSizeConfig::DEFAULT_EMBEDDING_CACHE_SIZE});
 }
 
 } // namespace llm_extension
@@ -17,14 +17,18 @@ std::string GoogleGeminiEmbedding::getClient() const {
     return "https://generativelanguage.googleapis.com";
 }
 
-std::string GoogleGeminiEmbedding::getPath(const std::string& model) const {
+static std::string getAPIKey() {
     static const std::string envVar = "GOOGLE_GEMINI_API_KEY";
     auto env_key = main::ClientContext::getEnvVariable(envVar);
     if (env_key.empty()) {
         throw(RuntimeException("Could not read environment variable: " + envVar + "\n" +
-                               std::string(referenceKuzuDocs)));
+                               std::string(EmbeddingProvider::referenceKuzuDocs)));
     }
-    return "/v1beta/models/" + model + ":embedContent?key=" + env_key;
+    return env_key;
+}
+
+std::string GoogleGeminiEmbedding::getPath(const std::string& model) const {
+    return "/v1beta/models/" + model + ":embedContent?key=" + getAPIKey();
 }
 
 httplib::Headers GoogleGeminiEmbedding::getHeaders(const std::string& /*model*/,
@@ -42,6 +46,32 @@ std::vector<float> GoogleGeminiEmbedding::parseResponse(const httplib::Result& r
     return nlohmann::json::parse(res->body)["embedding"]["values"].get<std::vector<float>>();
 }
 
+uint64_t GoogleGeminiEmbedding::getMaxBatchSize(const std::string& /*model*/) const {
+    return 100;
+}
+
+std::string GoogleGeminiEmbedding::getBatchPath(const std::string& model) const {
+    return "/v1beta/models/" + model + ":batchEmbedContents?key=" + getAPIKey();
+}
+
+nlohmann::json GoogleGeminiEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    auto requests = nlohmann::json::array();
+    for (auto& text : texts) {
+        requests.push_back(getPayload(model, text));
+    }
+    return nlohmann::json{{"requests", std::move(requests)}};
+}
+
+std::vector<std::vector<float>> GoogleGeminiEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    std::vector<std::vector<float>> embeddings;
+    for (auto& embedding : nlohmann::json::parse(res->body)["embeddings"]) {
+        embeddings.push_back(embedding["values"].get<std::vector<float>>());
+    }
+    return embeddings;
+}
+
 void GoogleGeminiEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (dimensions.has_value() || region.has_value()) {
@@ -40,19 +40,42 @@ httplib::Headers GoogleVertexEmbedding::getHeaders(const std::string& /*model*/,
         {"Authorization", "Bearer " + env_key}};
 }
 
-nlohmann::json GoogleVertexEmbedding::getPayload(const std::string& /*model*/,
+nlohmann::json GoogleVertexEmbedding::getPayload(const std::string& model,
     const std::string& text) const {
-    nlohmann::json payload{
-        {"instances", {{{"content", text}, {"task_type", "RETRIEVAL_DOCUMENT"}}}}};
+    return getBatchPayload(model, {text});
+}
+
+std::vector<float> GoogleVertexEmbedding::parseResponse(const httplib::Result& res) const {
+    return nlohmann::json::parse(res->body)["predictions"][0]["embeddings"]["values"]
+        .get<std::vector<float>>();
+}
+
+// Gemini embedding models only accept a single instance per request. Text embedding models accept
+// up to 250, but also limit the total number of tokens of a request, so batches are kept smaller.
+uint64_t GoogleVertexEmbedding::getMaxBatchSize(const std::string& model) const {
+    return model.starts_with("gemini-") ? 1 : 32;
+}
+
+nlohmann::json GoogleVertexEmbedding::getBatchPayload(const std::string& /*model*/,
+    const std::vector<std::string>& texts) const {
+    auto instances = nlohmann::json::array();
+    for (auto& text : texts) {
+        instances.push_back({{"content", text}, {"task_type", "RETRIEVAL_DOCUMENT"}});
+    }
+    nlohmann::json payload{{"instances", std::move(instances)}};
     if (dimensions.has_value()) {
         payload["parameters"] = {{"outputDimensionality", dimensions.value()}};
     }
     return payload;
 }
 
-std::vector<float> GoogleVertexEmbedding::parseResponse(const httplib::Result& res) const {
-    return nlohmann::json::parse(res->body)["predictions"][0]["embeddings"]["values"]
-        .get<std::vector<float>>();
+std::vector<std::vector<float>> GoogleVertexEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    std::vector<std::vector<float>> embeddings;
+    for (auto& prediction : nlohmann::json::parse(res->body)["predictions"]) {
+        embeddings.push_back(prediction["embeddings"]["values"].get<std::vector<float>>());
+    }
+    return embeddings;
 }
 
 void GoogleVertexEmbedding::configure(const std::optional<uint64_t>& dimensions,
@@ -34,6 +34,27 @@ std::vector<float> OllamaEmbedding::parseResponse(const httplib::Result& res) co
     return nlohmann::json::parse(res->body)["embedding"].get<std::vector<float>>();
 }
 
+// Batches go through /api/embed, which replaced /api/embeddings in Ollama 0.3 and takes a list of
+// inputs.
+uint64_t OllamaEmbedding::getMaxBatchSize(const std::string& /*model*/) const {
+    return 64;
+}
+
+std::string OllamaEmbedding::getBatchPath(const std::string& /*model*/) const {
+    return "/api/embed";
+}
+
+nlohmann::json OllamaEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    return nlohmann::json{{"model", model}, {"input", texts}};
+}
+
+std::vector<std::vector<float>> OllamaEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    return nlohmann::json::parse(res->body)["embeddings"]
+        .get<std::vector<std::vector<float>>>();
+}
+
 void OllamaEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& endpoint) {
     static const std::string envVarOllamaUrl = "OLLAMA_URL";
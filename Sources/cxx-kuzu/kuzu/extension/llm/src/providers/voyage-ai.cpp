@@ -46,6 +46,36 @@ std::vector<float> VoyageAIEmbedding::parseResponse(const httplib::Result& res)
     return nlohmann::json::parse(res->body)["data"][0]["embedding"].get<std::vector<float>>();
 }
 
+// The API accepts up to 1000 inputs per request, but also limits the total number of tokens of a
+// request, so batches are kept smaller.
+uint64_t VoyageAIEmbedding::getMaxBatchSize(const std::string& /*model*/) const {
+    return 128;
+}
+
+nlohmann::json VoyageAIEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    nlohmann::json payload{{"model", model}, {"input", texts}};
+    if (dimensions.has_value()) {
+        payload["output_dimension"] = dimensions.value();
+    }
+    return payload;
+}
+
+std::vector<std::vector<float>> VoyageAIEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    auto data = nlohmann::json::parse(res->body)["data"];
+    std::vector<std::vector<float>> embeddings(data.size());
+    // Each embedding comes with the index of its input.
+    for (auto& item : data) {
+        auto index = item["index"].get<uint64_t>();
+        if (index >= embeddings.size()) {
+            throw RuntimeException("Invalid embedding index in response: " + std::to_string(index));
+        }
+        embeddings[index] = item["embedding"].get<std::vector<float>>();
+    }
+    return embeddings;
+}
+
 void VoyageAIEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (region.has_value()) {
@@ -1,5 +1,8 @@
 #include "function/neo4j_migrate.h"
 
+#include <atomic>
+#include <thread>
+
 #include "binder/ddl/property_definition.h"
 #include "binder/expression/literal_expression.h"
 #include "common/enums/table_type.h"
@@ -11,6 +14,7 @@
 #include "function/table/table_function.h"
 #include "httplib.h"
 #include "json.hpp"
+#include "main/client_context.h"
 
 namespace kuzu {
 namespace neo4j_extension {
@@ -19,16 +23,24 @@ using namespace kuzu::common;
 using namespace kuzu::main;
 using namespace kuzu::function;
 
+struct Neo4jConnectionInfo {
+    std::string url;
+    std::string userName;
+    std::string password;
+};
+
 struct Neo4jMigrateBindData final : TableFuncBindData {
     std::shared_ptr<httplib::Client> client;
+    Neo4jConnectionInfo connectionInfo;
     std::vector<std::string> nodesToImport;
     std::vector<std::string> relsToImport;
 
     Neo4jMigrateBindData(std::shared_ptr<httplib::Client> client,
-        std::vector<std::string> nodesToImport, std::vector<std::string> relsToImport)
+        Neo4jConnectionInfo connectionInfo, std::vector<std::string> nodesToImport,
+        std::vector<std::string> relsToImport)
         : TableFuncBindData{binder::expression_vector{}, 0 /* maxOffset */},
-          client{std::move(client)}, nodesToImport{std::move(nodesToImport)},
-          relsToImport{std::move(relsToImport)} {}
+          client{std::move(client)}, connectionInfo{std::move(connectionInfo)},
+          nodesToImport{std::move(nodesToImport)}, relsToImport{std::move(relsToImport)} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<Neo4jMigrateBindData>(*this);
@@ -139,46 +151,99 @@ static std::vector<std::string> getNodeOrRels(httplib::Client& cli, common::Tabl
     return labels;
 }
 
-static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* /*context*/,
-    const TableFuncBindInput* input) {
-    auto url = input->getLiteralVal<std::string>(0);
-    auto userName = input->getLiteralVal<std::string>(1);
-    auto password = input->getLiteralVal<std::string>(2);
-    auto cli = std::make_shared<httplib::Client>(url);
-    cli->set_basic_auth(userName, password);
+static std::shared_ptr<httplib::Client> createClient(const Neo4jConnectionInfo& info) {
+    auto cli = std::make_shared<httplib::Client>(info.url);
+    cli->set_basic_auth(info.userName, info.password);
     cli->set_connection_timeout(std::chrono::seconds(1000));
     cli->set_read_timeout(std::chrono::seconds(1000));
+    return cli;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* /*context*/,
+    const TableFuncBindInput* input) {
+    Neo4jConnectionInfo connectionInfo{input->getLiteralVal<std::string>(0),
+        input->getLiteralVal<std::string>(1), input->getLiteralVal<std::string>(2)};
+    auto cli = createClient(connectionInfo);
     validateConnectionString(*cli);
     auto nodes = getNodeOrRels(*cli, TableType::NODE, input->getParam(3));
     auto rels = getNodeOrRels(*cli, TableType::REL, input->getParam(4));
-    return std::make_unique<Neo4jMigrateBindData>(std::move(cli), std::move(nodes),
-        std::move(rels));
+    return std::make_unique<Neo4jMigrateBindData>(std::move(cli), std::move(connectionInfo),
+        std::move(nodes), std::move(rels));
 }
 
-void exportNeo4jNodeToCSV(std::string nodeName, httplib::Client& cli) {
-    auto query = common::stringFormat("MATCH (p:{}) "
-                                      "with collect(p) as n "
-                                      "CALL apoc.export.csv.data(n, [], \\\"/tmp/{}.csv\\\", null) "
-                                      "YIELD file, source, format, nodes, relationships, "
-                                      "properties, time, rows, batchSize, batches, done, data "
-                                      "RETURN file, source, format, nodes, relationships, "
-                                      "properties, time, rows, batchSize, batches, done, data",
-        nodeName, nodeName);
-    executeNeo4jQuery(cli, query);
+// Splits the export of the nodes or rels matched by a pattern into ranges of Neo4j ids, so that
+// the ranges are exported concurrently and Neo4j doesn't have to collect a whole label in memory.
+// Each range is exported by streaming the rows returned by `returnClause` to its own CSV file.
+class Neo4jExporter {
+public:
+    explicit Neo4jExporter(httplib::Client& cli) : cli{cli} {}
+
+    // Returns the files the matched nodes or rels are exported to as a list literal, or an empty
+    // string if nothing is matched.
+    std::string addExport(const std::string& pattern, const std::string& variable,
+        const std::string& returnClause, const std::string& fileName);
+
+    // Runs the exports with the given number of concurrent connections.
+    void run(const Neo4jConnectionInfo& connectionInfo, uint64_t concurrency);
+
+private:
+    httplib::Client& cli;
+    std::vector<std::string> queries;
+};
+
+std::string Neo4jExporter::addExport(const std::string& pattern, const std::string& variable,
+    const std::string& returnClause, const std::string& fileName) {
+    auto range = executeNeo4jQuery(cli,
+        stringFormat("MATCH {} RETURN min(id({})), max(id({}))", pattern, variable, variable));
+    if (range.empty() || range[0]["row"][0].is_null()) {
+        return "";
+    }
+    auto minID = range[0]["row"][0].get<int64_t>();
+    auto maxID = range[0]["row"][1].get<int64_t>();
+    std::string files;
+    for (auto startID = minID, i = (int64_t)0; startID <= maxID;
+         startID += Neo4jMigrateConfig::NUM_IDS_PER_FILE, i++) {
+        auto file = stringFormat("/tmp/{}_{}.csv", fileName, i);
+        auto exportedQuery = stringFormat("MATCH {} WHERE id({}) >= {} AND id({}) < {} RETURN {}",
+            pattern, variable, startID, variable, startID + Neo4jMigrateConfig::NUM_IDS_PER_FILE,
+            returnClause);
+        queries.push_back(stringFormat("CALL apoc.export.csv.query('{}', \\\"{}\\\", null) "
+                                       "YIELD file, rows RETURN file, rows",
+            exportedQuery, file));
+        files += stringFormat("{}'{}'", files.empty() ? "" : ",", file);
+    }
+    return "[" + files + "]";
 }
 
-void exportNeo4jRelToCSV(std::string relName, std::pair<std::string, std::string> nodePairs,
-    httplib::Client& cli) {
-    auto query =
-        common::stringFormat("MATCH (:{})-[e:{}]->(:{}) "
-                             "with collect(e) as rels "
-                             "CALL apoc.export.csv.data([], rels, \\\"/tmp/{}_{}_{}.csv\\\", null) "
-                             "YIELD file, source, format, nodes, relationships, "
-                             "properties, time, rows, batchSize, batches, done, data "
-                             "RETURN file, source, format, nodes, relationships, "
-                             "properties, time, rows, batchSize, batches, done, data",
-            nodePairs.first, relName, nodePairs.second, nodePairs.first, relName, nodePairs.second);
-    executeNeo4jQuery(cli, query);
+void Neo4jExporter::run(const Neo4jConnectionInfo& connectionInfo, uint64_t concurrency) {
+    auto numThreads = std::max<uint64_t>(1, std::min<uint64_t>(concurrency, queries.size()));
+    std::atomic<uint64_t> nextQuery{0};
+    std::vector<std::exception_ptr> errors(numThreads);
+    auto exportQueries = [&](uint64_t threadIdx) {
+        try {
+            auto threadCli = createClient(connectionInfo);
+            for (auto i = nextQuery++; i < queries.size(); i = nextQuery++) {
+                executeNeo4jQuery(*threadCli, queries[i]);
+            }
+        } catch (...) {
+            errors[threadIdx] = std::current_exception();
+            // Stops the other threads from starting more exports.
+            nextQuery = queries.size();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < numThreads; i++) {
+        threads.emplace_back(exportQueries, i);
+    }
+    exportQueries(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
 }
 
 LogicalType convertFromNeo4jTypeStr(const std::string& neo4jTypeStr) {
@@ -217,7 +282,7 @@ static LogicalType inferKuzuType(nlohmann::json types) {
 }
 
 std::pair<std::string, std::string> getCreateNodeTableQuery(httplib::Client& cli,
-    const std::string& nodeName, std::vector<std::string>& outputTables) {
+    Neo4jExporter& exporter, const std::string& nodeName, std::vector<std::string>& outputTables) {
     auto neo4jQuery = common::stringFormat(
         "call db.schema.nodeTypeProperties() yield nodeType, propertyName,propertyTypes where "
         "nodeType = ':`{}`' return propertyName,propertyTypes",
@@ -238,26 +303,33 @@ std::pair<std::string, std::string> getCreateNodeTableQuery(httplib::Client& cli
 
         propertyDefinitions.emplace_back(property, kuType.copy());
     }
-    // According to neo4j doc: https://neo4j.com/docs/apoc/current/export/csv/:
-    // Labels exported are ordered alphabetically. So we have to reorder the properties in the DDL.
     std::sort(propertyDefinitions.begin(), propertyDefinitions.end(),
         [](const binder::ColumnDefinition& left, const binder::ColumnDefinition& right) {
             return left.name < right.name;
         });
     std::string ddlProperties = "";
+    std::string loadFromHeaders = "";
     std::string propertiesToCopy = "";
+    std::string propertiesToExport = "";
     for (auto& propertyDefinition : propertyDefinitions) {
-        ddlProperties += propertyDefinition.name;
-        ddlProperties += (" " + propertyDefinition.type.toString() + ",");
+        auto property = propertyDefinition.name + " " + propertyDefinition.type.toString();
+        ddlProperties += property + ",";
+        loadFromHeaders += ", " + property;
         propertiesToCopy += ", " + propertyDefinition.name;
+        propertiesToExport +=
+            stringFormat(", p.`{}` AS `{}`", propertyDefinition.name, propertyDefinition.name);
+    }
+    auto ddl = common::stringFormat("CREATE NODE TABLE `{}` (`_id_` int64, {} PRIMARY KEY(_id_));",
+        nodeName, ddlProperties);
+    auto files = exporter.addExport(stringFormat("(p:`{}`)", nodeName), "p",
+        "id(p) AS _id" + propertiesToExport, nodeName);
+    if (files.empty()) {
+        return {std::move(ddl), ""};
     }
-    return {common::stringFormat("CREATE NODE TABLE `{}` (`_id_` int64, {} PRIMARY KEY(_id_));",
-                nodeName, ddlProperties),
-        common::stringFormat(
-            "COPY `{}` FROM (LOAD WITH HEADERS(_id STRING, _labels STRING, {} _start STRING, "
-            "_end STRING, _type STRING) FROM '/tmp/{}.csv'(sample_size "
-            "= 0, header=true) RETURN _id{});",
-            nodeName, ddlProperties, nodeName, propertiesToCopy)};
+    return {std::move(ddl),
+        common::stringFormat("COPY `{}` FROM (LOAD WITH HEADERS(_id INT64{}) FROM {}(sample_size "
+                             "= 0, header=true) RETURN _id{});",
+            nodeName, loadFromHeaders, files, propertiesToCopy)};
 }
 
 std::vector<std::string> getRelProperties(httplib::Client& cli, std::string srcLabel,
@@ -279,8 +351,9 @@ std::vector<std::string> getRelProperties(httplib::Client& cli, std::string srcL
     return relProperties;
 }
 
-std::string getCreateRelTableQuery(httplib::Client& cli, const std::string& relName,
-    const std::vector<std::string>& nodeLabelsToImport, std::vector<std::string>& outputTables) {
+std::string getCreateRelTableQuery(httplib::Client& cli, Neo4jExporter& exporter,
+    const std::string& relName, const std::vector<std::string>& nodeLabelsToImport,
+    std::vector<std::string>& outputTables) {
     auto neo4jQuery = common::stringFormat(
         "call db.schema.relTypeProperties() yield relType, propertyName,propertyTypes where "
         "relType = ':`{}`' and propertyName is not null and  propertyTypes is not null return "
@@ -338,15 +411,17 @@ std::string getCreateRelTableQuery(httplib::Client& cli, const std::string& relN
         }
         nodePairs.emplace_back(srcLabel, dstLabel);
         nodePairsString += common::stringFormat("FROM {} TO {},", srcLabel, dstLabel);
-        exportNeo4jRelToCSV(relName, {srcLabel, dstLabel}, cli);
         auto relProperties = getRelProperties(cli, srcLabel, dstLabel, relName);
 
         std::string propertiesToCopy = "";
         std::string loadFromHeaders = "";
+        std::string propertiesToExport = "";
         for (auto i = 0u; i < relProperties.size(); i++) {
             propertiesToCopy += relProperties[i];
             loadFromHeaders += common::stringFormat(", {} {}", relProperties[i],
                 propertyTypes.at(relProperties[i]));
+            propertiesToExport +=
+                stringFormat(", e.`{}` AS `{}`", relProperties[i], relProperties[i]);
             if (i != relProperties.size() - 1) {
                 propertiesToCopy += ",";
             }
@@ -355,12 +430,18 @@ std::string getCreateRelTableQuery(httplib::Client& cli, const std::string& relN
                 originalTypes.at(relProperties[i]));
             outputTables.emplace_back(std::move(newRel));
         }
+        auto files = exporter.addExport(
+            stringFormat("(a:`{}`)-[e:`{}`]->(b:`{}`)", srcLabel, relName, dstLabel), "e",
+            "id(a) AS _start, id(b) AS _end" + propertiesToExport,
+            stringFormat("{}_{}_{}", srcLabel, relName, dstLabel));
+        if (files.empty()) {
+            continue;
+        }
         copyQuery +=
-            common::stringFormat("COPY `{}`({}) FROM (LOAD WITH HEADERS(_id STRING, _labels "
-                                 "STRING, _start INT64, _end INT64, _type STRING{}) FROM "
-                                 "'/tmp/{}_{}_{}.csv'(sample_size=0, header=true) "
+            common::stringFormat("COPY `{}`({}) FROM (LOAD WITH HEADERS(_start INT64, _end "
+                                 "INT64{}) FROM {}(sample_size=0, header=true) "
                                  "RETURN `_start`, `_end`{} {}) (from = \"{}\", to = \"{}\");",
-                relName, propertiesToCopy, loadFromHeaders, srcLabel, relName, dstLabel,
+                relName, propertiesToCopy, loadFromHeaders, files,
                 propertiesToCopy.empty() ? "" : ", ", propertiesToCopy, srcLabel, dstLabel);
     }
     if (nodePairsString.empty()) {
@@ -372,21 +453,28 @@ std::string getCreateRelTableQuery(httplib::Client& cli, const std::string& relN
            copyQuery;
 }
 
-std::string migrateQuery(ClientContext& /*context*/, const TableFuncBindData& bindData) {
+std::string migrateQuery(ClientContext& context, const TableFuncBindData& bindData) {
     std::string result;
     std::vector<std::string> outputTables;
     auto neo4jMigrateBindData = bindData.constPtrCast<Neo4jMigrateBindData>();
+    auto& cli = *neo4jMigrateBindData->client;
+    Neo4jExporter exporter{cli};
     for (auto node : neo4jMigrateBindData->nodesToImport) {
-        exportNeo4jNodeToCSV(node, *neo4jMigrateBindData->client);
-        auto [ddl, copyQuery] =
-            getCreateNodeTableQuery(*neo4jMigrateBindData->client, node, outputTables);
+        auto [ddl, copyQuery] = getCreateNodeTableQuery(cli, exporter, node, outputTables);
         result += ddl;
         result += copyQuery;
     }
     for (auto rel : neo4jMigrateBindData->relsToImport) {
-        result += getCreateRelTableQuery(*neo4jMigrateBindData->client, rel,
-            neo4jMigrateBindData->nodesToImport, outputTables);
+        result += getCreateRelTableQuery(cli, exporter, rel, neo4jMigrateBindData->nodesToImport,
+            outputTables);
+    }
+    auto concurrency =
+        context.getCurrentSetting(Neo4jMigrateConfig::CONCURRENCY_OPTION).getValue<int64_t>();
+    if (concurrency <= 0) {
+        throw common::RuntimeException{common::stringFormat("{} must be positive.",
+            Neo4jMigrateConfig::CONCURRENCY_OPTION)};
     }
+    exporter.run(neo4jMigrateBindData->connectionInfo, concurrency);
     std::string outputQuery;
     outputQuery.append("UNWIND [");
     for (auto i = 0u; i < outputTables.size(); i++) {
@@ -5,6 +5,14 @@
 namespace kuzu {
 namespace neo4j_extension {
 
+struct Neo4jMigrateConfig {
+    // Number of exports run concurrently against the Neo4j server.
+    static constexpr const char* CONCURRENCY_OPTION = "neo4j_migrate_concurrency";
+    static constexpr int64_t DEFAULT_CONCURRENCY = 4;
+    // Nodes and rels are exported to one file per range of this many Neo4j ids.
+    static constexpr int64_t NUM_IDS_PER_FILE = 1000000;
+};
+
 struct Neo4jMigrateFunction {
     static constexpr const char* name = "NEO4J_MIGRATE";
 
@@ -11,6 +11,8 @@ using namespace extension;
 void Neo4jExtension::load(main::ClientContext* context) {
     auto& db = *context->getDatabase();
     ExtensionUtils::addStandaloneTableFunc<Neo4jMigrateFunction>(db);
+    db.addExtensionOption(Neo4jMigrateConfig::CONCURRENCY_OPTION, common::LogicalTypeID::INT64,
+        common::Value{Neo4jMigrateConfig::DEFAULT_CONCURRENCY});
 }
 
 } // namespace neo4j_extension
@@ -65,21 +65,14 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const ClientContext* context,
 std::unique_ptr<TableFuncSharedState> initSharedState(const TableFuncInitSharedStateInput& input) {
     auto scanBindData = input.bindData->constPtrCast<DuckDBScanBindData>();
     auto finalQuery = stringFormat(scanBindData->query, scanBindData->getColumnsToSelect());
-    auto result = scanBindData->connector.executeQuery(finalQuery);
-    return std::make_unique<DuckDBScanSharedState>(std::move(result));
+    return std::make_unique<DuckDBScanSharedState>(scanBindData->connector.executeCachedQuery(
+        finalQuery, nullptr /* queryConnection */, *input.context->clientContext));
 }
 
 offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     auto sharedState = input.sharedState->ptrCast<DuckDBScanSharedState>();
     auto bindData = input.bindData->constPtrCast<DuckDBScanBindData>();
-    std::unique_ptr<duckdb::DataChunk> result;
-    try {
-        // Duckdb queryResult.fetch() is not thread safe, we have to acquire a lock there.
-        std::lock_guard<std::mutex> lock{sharedState->mtx};
-        result = sharedState->queryResult->Fetch();
-    } catch (std::exception& e) {
-        return 0;
-    }
+    auto result = sharedState->fetch();
     if (result == nullptr) {
         return 0;
     }
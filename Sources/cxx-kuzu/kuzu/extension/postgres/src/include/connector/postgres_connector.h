@@ -9,6 +9,10 @@ class PostgresConnector : public duckdb_extension::DuckDBConnector {
 public:
     void connect(const std::string& dbPath, const std::string& catalogName,
         const std::string& schemaName, main::ClientContext* context) override;
+
+    // The postgres scanner of DuckDB already splits a table scan into ctid ranges which it reads
+    // over several connections in parallel.
+    std::string getPartitionColumn() const override { return ""; }
 };
 
 } // namespace postgres_extension
@@ -43,6 +43,7 @@ PostgresStorageExtension::PostgresStorageExtension(main::Database& database)
     : StorageExtension{attachPostgres} {
     extension::ExtensionUtils::addStandaloneTableFunc<duckdb_extension::ClearCacheFunction>(
         database);
+    duckdb_extension::DuckDBResultCacheConfig::registerExtensionOptions(database);
 }
 
 bool PostgresStorageExtension::canHandleDB(std::string dbType_) const {
@@ -37,6 +37,7 @@ SqliteStorageExtension::SqliteStorageExtension(main::Database& database)
     : StorageExtension{attachSqlite} {
     extension::ExtensionUtils::addStandaloneTableFunc<duckdb_extension::ClearCacheFunction>(
         database);
+    duckdb_extension::DuckDBResultCacheConfig::registerExtensionOptions(database);
 }
 
 bool SqliteStorageExtension::canHandleDB(std::string dbType_) const {
@@ -29,6 +29,7 @@ UnityCatalogStorageExtension::UnityCatalogStorageExtension(main::Database& datab
     : StorageExtension{attachUnityCatalog} {
     extension::ExtensionUtils::addStandaloneTableFunc<duckdb_extension::ClearCacheFunction>(
         database);
+    duckdb_extension::DuckDBResultCacheConfig::registerExtensionOptions(database);
 }
 
 bool UnityCatalogStorageExtension::canHandleDB(std::string dbType_) const {
@@ -38,10 +38,15 @@ std::string HNSWIndexAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
     auto tableName = tableEntry->getName();
     auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
     auto metricName = HNSWIndexConfig::metricToString(config.metric);
+    std::string quantizationParam;
+    if (config.quantization != QuantizationType::NONE) {
+        quantizationParam = common::stringFormat(", quantization := '{}'",
+            HNSWIndexConfig::quantizationToString(config.quantization));
+    }
     cypher += common::stringFormat("CALL CREATE_VECTOR_INDEX('{}', '{}', '{}', mu := {}, ml := {}, "
-                                   "pu := {}, metric := '{}', alpha := {}, efc := {});",
+                                   "pu := {}, metric := '{}', alpha := {}, efc := {}{});",
         tableName, indexEntry.getIndexName(), propertyName, config.mu, config.ml, config.pu,
-        metricName, config.alpha, config.efc);
+        metricName, config.alpha, config.efc, quantizationParam);
     return cypher;
 }
 
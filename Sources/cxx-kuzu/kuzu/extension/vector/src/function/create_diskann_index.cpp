@@ -0,0 +1,135 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/diskann_index_functions.h"
+#include "function/table/simple_table_function.h"
+#include "index/diskann_index.h"
+#include "index/hnsw_index_utils.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace vector_extension {
+
+static std::unique_ptr<TableFuncBindData> createDiskANNBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto indexName = input->getLiteralVal<std::string>(1);
+    const auto columnName = input->getLiteralVal<std::string>(2);
+    auto config = DiskANNIndexConfig{input->optionalParams};
+    if (context->isInMemory()) {
+        throw BinderException{"DiskANN indexes cannot be created in in-memory databases."};
+    }
+    const auto nodeTableEntry = HNSWIndexUtils::bindNodeTable(*context, tableName);
+    if (HNSWIndexUtils::validateIndexExistence(*context, nodeTableEntry, indexName,
+            HNSWIndexUtils::IndexOperation::CREATE, config.conflictAction)) {
+        return std::make_unique<CreateDiskANNIndexBindData>(context, indexName, nullptr, 0, 0,
+            std::move(config),
+            true); // Placeholders for nodeTableEntry, propertyID, numNodes - WILL NOT BE ACCESSED
+    }
+    HNSWIndexUtils::validateColumnType(*nodeTableEntry, columnName);
+    auto& table = storage::StorageManager::Get(*context)
+                            ->getTable(nodeTableEntry->getTableID())
+                            ->cast<storage::NodeTable>();
+    auto propertyID = nodeTableEntry->getPropertyID(columnName);
+    auto transaction = transaction::Transaction::Get(*context);
+    auto numNodes = table.getNumTotalRows(transaction);
+    return std::make_unique<CreateDiskANNIndexBindData>(context, indexName, nodeTableEntry,
+        propertyID, numNodes, std::move(config));
+}
+
+static offset_t createDiskANNTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<CreateDiskANNIndexBindData>();
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    const auto tableID = bindData->tableEntry->getTableID();
+    const auto columnID = bindData->tableEntry->getColumnID(bindData->propertyID);
+    auto& nodeTable = storage::StorageManager::Get(*clientContext)
+                          ->getTable(tableID)
+                          ->cast<storage::NodeTable>();
+    DiskANNIndexBuilder builder{clientContext, nodeTable, columnID, bindData->numNodes,
+        bindData->config.copy()};
+    auto storageInfo = builder.build(*transaction->getLocalStorage()->addOptimisticAllocator());
+    auto auxInfo = std::make_unique<DiskANNIndexAuxInfo>(bindData->config.copy());
+    auto indexEntry =
+        std::make_unique<catalog::IndexCatalogEntry>(DiskANNIndexCatalogEntry::TYPE_NAME, tableID,
+            bindData->indexName, std::vector{bindData->propertyID}, std::move(auxInfo));
+    catalog::Catalog::Get(*clientContext)->createIndex(transaction, std::move(indexEntry));
+    const auto diskANNIndexType = OnDiskDiskANNIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData->indexName, diskANNIndexType.typeName, tableID,
+        {columnID}, {PhysicalTypeID::ARRAY},
+        diskANNIndexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        diskANNIndexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    nodeTable.addIndex(std::make_unique<OnDiskDiskANNIndex>(clientContext, std::move(indexInfo),
+        std::move(storageInfo), bindData->config.copy()));
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set InternalCreateDiskANNIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes = {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING};
+    auto func = std::make_unique<TableFunction>(name, inputTypes);
+    func->bindFunc = createDiskANNBindFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->tableFunc = createDiskANNTableFunc;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    HNSWIndexUtils::validateAutoTransaction(*context, CreateDiskANNIndexFunction::name);
+    return createDiskANNBindFunc(context, input);
+}
+
+static std::string rewriteCreateDiskANNQuery(main::ClientContext& context,
+    const TableFuncBindData& bindData) {
+    context.setUseInternalCatalogEntry(true /* useInternalCatalogEntry */);
+    const auto diskANNBindData = bindData.constPtrCast<CreateDiskANNIndexBindData>();
+    if (diskANNBindData->skipAfterBind) {
+        return "";
+    }
+    const auto& config = diskANNBindData->config;
+    auto indexName = diskANNBindData->indexName;
+    auto tableName = diskANNBindData->tableEntry->getName();
+    auto columnName =
+        diskANNBindData->tableEntry->getProperty(diskANNBindData->propertyID).getName();
+    std::string params;
+    params += stringFormat("degree := {}, ", config.degree);
+    params += stringFormat("l_build := {}, ", config.buildListSize);
+    params += stringFormat("metric := '{}', ", HNSWIndexConfig::metricToString(config.metric));
+    params += stringFormat("alpha := {}", config.alpha);
+    std::string query = "BEGIN TRANSACTION;";
+    query += stringFormat("CALL _CREATE_DISKANN_INDEX('{}', '{}', '{}', {});", tableName,
+        indexName, columnName, params);
+    query += stringFormat("RETURN 'Index {} has been created.' as result;", indexName);
+    query += "COMMIT;";
+    return query;
+}
+
+function_set CreateDiskANNIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes = {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING};
+    auto func = std::make_unique<TableFunction>(name, inputTypes);
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->tableFunc = TableFunction::emptyTableFunc;
+    func->rewriteFunc = rewriteCreateDiskANNQuery;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -354,6 +354,10 @@ static std::string rewriteCreateHNSWQuery(main::ClientContext& context,
     params += stringFormat("pu := {}, ", config.pu);
     params +=
         stringFormat("cache_embeddings := {}", config.cacheEmbeddingsColumn ? "true" : "false");
+    if (config.quantization != QuantizationType::NONE) {
+        params += stringFormat(", quantization := '{}'",
+            HNSWIndexConfig::quantizationToString(config.quantization));
+    }
     auto columnName = hnswBindData->tableEntry->getProperty(hnswBindData->propertyID).getName();
     if (config.cacheEmbeddingsColumn) {
         query +=
@@ -1,11 +1,13 @@
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "function/hnsw_index_functions.h"
 #include "function/table/bind_data.h"
 #include "index/hnsw_index_utils.h"
 #include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
 
@@ -48,8 +50,13 @@ static common::offset_t internalTableFunc(const TableFuncInput& input, TableFunc
     auto tableID = bindData->tableEntry->getTableID();
     auto transaction = transaction::Transaction::Get(context);
     catalog::Catalog::Get(context)->dropIndex(transaction, tableID, bindData->indexName);
-    storage::StorageManager::Get(context)->getTable(tableID)->cast<storage::NodeTable>().dropIndex(
-        bindData->indexName);
+    auto& nodeTable =
+        storage::StorageManager::Get(context)->getTable(tableID)->cast<storage::NodeTable>();
+    // Pages owned by the index (DiskANN) are released once the transaction commits.
+    nodeTable.getIndex(bindData->indexName)
+        .value()
+        ->reclaimStorage(*transaction->getLocalStorage()->addOptimisticAllocator());
+    nodeTable.dropIndex(bindData->indexName);
     return 0;
 }
 
@@ -69,10 +76,16 @@ static std::string dropHNSWIndexTables(main::ClientContext& context,
     auto nodeTableID = dropHNSWIndexBindData->tableEntry->getTableID();
     query += common::stringFormat("CALL _DROP_HNSW_INDEX('{}', '{}');",
         dropHNSWIndexBindData->tableEntry->getName(), dropHNSWIndexBindData->indexName);
-    query += common::stringFormat("DROP TABLE {};",
-        HNSWIndexUtils::getUpperGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
-    query += common::stringFormat("DROP TABLE {};",
-        HNSWIndexUtils::getLowerGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+    const auto indexEntry =
+        catalog::Catalog::Get(context)->getIndex(transaction::Transaction::Get(context),
+            nodeTableID, dropHNSWIndexBindData->indexName);
+    // DiskANN indexes have no graph tables to drop.
+    if (indexEntry->getIndexType() != DiskANNIndexCatalogEntry::TYPE_NAME) {
+        query += common::stringFormat("DROP TABLE {};",
+            HNSWIndexUtils::getUpperGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+        query += common::stringFormat("DROP TABLE {};",
+            HNSWIndexUtils::getLowerGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+    }
     if (requireNewTransaction) {
         query += "COMMIT;";
     }
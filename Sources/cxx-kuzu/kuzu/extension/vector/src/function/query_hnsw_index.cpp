@@ -3,14 +3,17 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/query/reading_clause/bound_table_function_call.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
 #include "catalog/hnsw_index_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "common/mask.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "expression_evaluator/expression_evaluator_utils.h"
 #include "function/hnsw_index_functions.h"
 #include "function/table/bind_data.h"
 #include "graph/graph_entry_set.h"
+#include "index/diskann_index.h"
 #include "index/hnsw_index.h"
 #include "index/hnsw_index_utils.h"
 #include "main/client_context.h"
@@ -50,6 +53,24 @@ static std::vector<LogicalType> inferInputTypes(const expression_vector& params)
     return inputTypes;
 }
 
+static std::vector<LogicalType> inferBatchInputTypes(const expression_vector& params) {
+    const auto inputQueryExpression = params[2];
+    std::vector<LogicalType> inputTypes;
+    inputTypes.push_back(LogicalType::STRING());
+    inputTypes.push_back(LogicalType::STRING());
+    if (inputQueryExpression->expressionType == ExpressionType::LITERAL &&
+        inputQueryExpression->constCast<LiteralExpression>().getValue().getChildrenSize() > 0) {
+        const auto val = inputQueryExpression->constCast<LiteralExpression>().getValue();
+        const auto dimension = NestedVal::getChildVal(&val, 0)->getChildrenSize();
+        inputTypes.push_back(
+            LogicalType::LIST(LogicalType::ARRAY(LogicalType::FLOAT(), dimension)));
+    } else {
+        inputTypes.push_back(LogicalType::ANY());
+    }
+    inputTypes.push_back(LogicalType::INT64());
+    return inputTypes;
+}
+
 static void validateK(int64_t val) {
     if (val <= 0) {
         throw BinderException{"The value of k must be greater than 0."};
@@ -66,11 +87,12 @@ std::unique_ptr<TableFuncBindData> QueryHNSWIndexBindData::copy() const {
     bindData->kExpression = kExpression;
     bindData->outputNode = outputNode;
     bindData->filterStatement = filterStatement;
+    bindData->filterNodesExpression = filterNodesExpression;
     return bindData;
 }
 
-static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
-    const TableFuncBindInput* input) {
+static std::unique_ptr<TableFuncBindData> bindQueryHNSWIndex(main::ClientContext* context,
+    const TableFuncBindInput* input, bool isBatch) {
     auto catalog = Catalog::Get(*context);
     auto transaction = transaction::Transaction::Get(*context);
     context->setUseInternalCatalogEntry(true /* useInternalCatalogEntry */);
@@ -139,12 +161,21 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     // Bind columns
     auto columnNames = std::vector<std::string>{QueryVectorIndexFunction::nnColumnName,
         QueryVectorIndexFunction::distanceColumnName};
+    if (isBatch) {
+        columnNames.insert(columnNames.begin(), QueryVectorIndexBatchFunction::queryIdxColumnName);
+    }
     columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
-    auto outputNode = input->binder->createQueryNode(columnNames[0], {nodeTableEntry});
+    const auto firstResultColumnIdx = isBatch ? 1 : 0;
+    auto outputNode =
+        input->binder->createQueryNode(columnNames[firstResultColumnIdx], {nodeTableEntry});
     input->binder->addToScope(outputNode->toString(), outputNode);
     expression_vector columns;
+    if (isBatch) {
+        columns.push_back(input->binder->createVariable(columnNames[0], LogicalType::INT64()));
+    }
     columns.push_back(outputNode->getInternalID());
-    columns.push_back(input->binder->createVariable(columnNames[1], LogicalType::DOUBLE()));
+    columns.push_back(input->binder->createVariable(columnNames[firstResultColumnIdx + 1],
+        LogicalType::DOUBLE()));
     // Fill bind data
     auto bindData = std::make_unique<QueryHNSWIndexBindData>(columns);
     bindData->nodeTableEntry = nodeTableEntry;
@@ -160,10 +191,29 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     bindData->outputNode = outputNode;
     bindData->config = QueryHNSWConfig{input->optionalParams};
     bindData->filterStatement = std::move(boundStatement);
+    for (auto& param : input->optionalParamsLegacy) {
+        if (StringUtils::getLower(param->getAlias()) == FilterNodes::NAME) {
+            bindData->filterNodesExpression = param;
+        }
+    }
+    if (bindData->filterNodesExpression != nullptr && bindData->filterStatement != nullptr) {
+        throw BinderException(stringFormat("{} cannot be used when searching a projected graph.",
+            FilterNodes::NAME));
+    }
     context->setUseInternalCatalogEntry(false /* useInternalCatalogEntry */);
     return bindData;
 }
 
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindQueryHNSWIndex(context, input, false /* isBatch */);
+}
+
+static std::unique_ptr<TableFuncBindData> bindBatchFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindQueryHNSWIndex(context, input, true /* isBatch */);
+}
+
 template<VectorElementType T>
 static std::vector<T> convertQueryVector(const Value& value) {
     std::vector<T> queryVector;
@@ -187,28 +237,27 @@ static Value evaluateParamExpr(std::shared_ptr<Expression> paramExpression,
     return evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(kExpr, context);
 }
 
-template<typename T>
-static std::vector<T> getQueryVector(main::ClientContext* context,
-    std::shared_ptr<Expression> queryExpression, const LogicalType& indexType, uint64_t dimension) {
-    auto value = evaluateParamExpr(queryExpression, context,
-        LogicalType::ARRAY(indexType.copy(), dimension));
-    KU_ASSERT(NestedVal::getChildVal(&value, 0)->getDataType() == indexType);
-    return convertQueryVector<T>(value);
-}
-
 static const LogicalType& getIndexColumnType(const NodeTableCatalogEntry& nodeEntry,
     const IndexCatalogEntry& indexEntry) {
     const auto columnName = indexEntry.getPropertyIDs()[0];
     return nodeEntry.getProperty(columnName).getType();
 }
 
+static storage::Index& getOnDiskIndex(main::ClientContext* context,
+    const QueryHNSWIndexBindData& bindData) {
+    const auto nodeTable = storage::StorageManager::Get(*context)
+                               ->getTable(bindData.nodeTableEntry->getTableID())
+                               ->ptrCast<storage::NodeTable>();
+    auto indexOpt = nodeTable->getIndex(bindData.indexEntry->getIndexName());
+    KU_ASSERT(indexOpt.has_value());
+    return *indexOpt.value();
+}
+
 // This struct wraps a vector of embedding data
 // It exists so that we can match the interface for on-disk HNSW search
 template<typename T>
 struct HNSWQueryVector : GetEmbeddingsScanState {
-    HNSWQueryVector(main::ClientContext* context, std::shared_ptr<Expression> queryExpression,
-        const LogicalType& indexType, uint64_t dimension)
-        : data(getQueryVector<T>(context, std::move(queryExpression), indexType, dimension)) {}
+    explicit HNSWQueryVector(std::vector<T> data) : data(std::move(data)) {}
 
     void* getEmbeddingPtr([[maybe_unused]] const EmbeddingHandle& handle) override {
         KU_ASSERT(!handle.isNull());
@@ -222,32 +271,45 @@ struct HNSWQueryVector : GetEmbeddingsScanState {
     std::vector<T> data;
 };
 
+template<typename INDEX>
+static std::vector<NodeWithDistance> searchIndex(main::ClientContext* context, const INDEX& index,
+    const Value& queryValue, HNSWSearchState& searchState) {
+    std::vector<NodeWithDistance> result;
+    TypeUtils::visit(
+        index.getElementType(),
+        [&]<VectorElementType T>(T) {
+            auto queryVector = HNSWQueryVector<T>(convertQueryVector<T>(queryValue));
+            auto queryVectorHandle = EmbeddingHandle{0, &queryVector};
+            result = index.search(transaction::Transaction::Get(*context), queryVectorHandle,
+                searchState);
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    return result;
+}
+
+static std::vector<NodeWithDistance> searchIndex(main::ClientContext* context,
+    storage::Index& index, const Value& queryValue, HNSWSearchState& searchState) {
+    if (index.getIndexInfo().indexType == OnDiskDiskANNIndex::getIndexType().typeName) {
+        return searchIndex(context, index.cast<OnDiskDiskANNIndex>(), queryValue,
+            searchState);
+    }
+    return searchIndex(context, index.cast<OnDiskHNSWIndex>(), queryValue, searchState);
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     const auto localState = input.localState->ptrCast<QueryHNSWLocalState>();
     const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
     // As `k` can be larger than the default vector capacity, we run the actual search in the first
     // call, and output the rest of the query result in chunks in the following calls.
     if (!localState->hasResultToOutput()) {
-        const auto nodeTable = storage::StorageManager::Get(*input.context->clientContext)
-                                   ->getTable(bindData->nodeTableEntry->getTableID())
-                                   ->ptrCast<storage::NodeTable>();
-        auto indexOpt = nodeTable->getIndex(bindData->indexEntry->getIndexName());
-        KU_ASSERT(indexOpt.has_value());
-        auto& index = indexOpt.value()->cast<OnDiskHNSWIndex>();
-        const auto dimension = ArrayType::getNumElements(
-            getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry));
-        auto indexType = index.getElementType();
-        TypeUtils::visit(
-            indexType,
-            [&]<VectorElementType T>(T) {
-                auto queryVector = HNSWQueryVector<T>(input.context->clientContext,
-                    bindData->queryExpression, index.getElementType(), dimension);
-                auto queryVectorHandle = EmbeddingHandle{0, &queryVector};
-                localState->result =
-                    index.search(transaction::Transaction::Get(*input.context->clientContext),
-                        queryVectorHandle, localState->searchState);
-            },
-            [&](auto) { KU_UNREACHABLE; });
+        const auto context = input.context->clientContext;
+        auto& index = getOnDiskIndex(context, *bindData);
+        const auto& columnType =
+            getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry);
+        const auto queryValue = evaluateParamExpr(bindData->queryExpression, context, columnType);
+        KU_ASSERT(NestedVal::getChildVal(&queryValue, 0)->getDataType() ==
+                  ArrayType::getChildType(columnType));
+        localState->result = searchIndex(context, index, queryValue, localState->searchState);
     }
     KU_ASSERT(localState->result.has_value());
     if (localState->numRowsOutput >= localState->result->size()) {
@@ -267,6 +329,33 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
     return numToOutput;
 }
 
+// Masks the nodes given with the filter_nodes option. Nodes of other tables cannot be in the index,
+// so they are ignored.
+static void addFilterNodesMask(main::ClientContext* context,
+    const QueryHNSWIndexBindData& bindData, offset_t numNodes, TableFuncSharedState& sharedState) {
+    if (bindData.filterNodesExpression == nullptr) {
+        return;
+    }
+    const auto nodeIDs = evaluateParamExpr(bindData.filterNodesExpression, context,
+        LogicalType::LIST(LogicalType::INTERNAL_ID()));
+    if (nodeIDs.isNull()) {
+        throw BinderException{"The list of filter nodes must not be null."};
+    }
+    const auto tableID = bindData.nodeTableEntry->getTableID();
+    auto mask = SemiMaskUtil::createMask(numNodes);
+    for (auto i = 0u; i < nodeIDs.getChildrenSize(); i++) {
+        const auto nodeID = NestedVal::getChildVal(&nodeIDs, i);
+        if (nodeID->isNull()) {
+            continue;
+        }
+        const auto id = nodeID->getValue<internalID_t>();
+        if (id.tableID == tableID) {
+            mask->mask(id.offset);
+        }
+    }
+    sharedState.semiMasks.addMask(tableID, std::move(mask));
+}
+
 static std::unique_ptr<TableFuncSharedState> initQueryHNSWSharedState(
     const TableFuncInitSharedStateInput& input) {
     const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
@@ -275,40 +364,131 @@ static std::unique_ptr<TableFuncSharedState> initQueryHNSWSharedState(
                          ->getTable(bindData->nodeTableEntry->getTableID())
                          ->ptrCast<storage::NodeTable>();
     auto numNodes = nodeTable->getStats(transaction::Transaction::Get(*context)).getTableCard();
-    return std::make_unique<QueryHNSWIndexSharedState>(nodeTable, numNodes);
+    auto sharedState = std::make_unique<QueryHNSWIndexSharedState>(nodeTable, numNodes);
+    addFilterNodesMask(context, *bindData, numNodes, *sharedState);
+    return sharedState;
 }
 
-std::unique_ptr<TableFuncLocalState> initQueryHNSWLocalState(
-    const TableFuncInitLocalStateInput& input) {
+static HNSWSearchState initSearchState(const TableFuncInitLocalStateInput& input,
+    storage::NodeTable& nodeTable, offset_t numNodes) {
     const auto hnswBindData = input.bindData.constPtrCast<QueryHNSWIndexBindData>();
-    const auto hnswSharedState = input.sharedState.ptrCast<QueryHNSWIndexSharedState>();
     auto context = input.clientContext;
     auto val = evaluateParamExpr(hnswBindData->kExpression, context, LogicalType::INT64());
     auto k = ExpressionUtil::getExpressionVal<int64_t>(*hnswBindData->kExpression, val,
         LogicalType::INT64(), validateK);
-    auto upperRelTableName = HNSWIndexUtils::getUpperGraphTableName(
-        hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
-    auto lowerRelTableName = HNSWIndexUtils::getLowerGraphTableName(
-        hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
-    auto catalog = Catalog::Get(*context);
-    auto upperRelTableEntry =
-        catalog
-            ->getTableCatalogEntry(transaction::Transaction::Get(*context), upperRelTableName, true)
-            ->ptrCast<RelGroupCatalogEntry>();
-    auto lowerRelTableEntry =
-        catalog
-            ->getTableCatalogEntry(transaction::Transaction::Get(*context), lowerRelTableName, true)
-            ->ptrCast<RelGroupCatalogEntry>();
+    RelGroupCatalogEntry* upperRelTableEntry = nullptr;
+    RelGroupCatalogEntry* lowerRelTableEntry = nullptr;
+    // DiskANN indexes have no graph tables.
+    if (hnswBindData->indexEntry->getIndexType() != DiskANNIndexCatalogEntry::TYPE_NAME) {
+        auto upperRelTableName = HNSWIndexUtils::getUpperGraphTableName(
+            hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
+        auto lowerRelTableName = HNSWIndexUtils::getLowerGraphTableName(
+            hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
+        auto catalog = Catalog::Get(*context);
+        upperRelTableEntry = catalog
+                                 ->getTableCatalogEntry(transaction::Transaction::Get(*context),
+                                     upperRelTableName, true)
+                                 ->ptrCast<RelGroupCatalogEntry>();
+        lowerRelTableEntry = catalog
+                                 ->getTableCatalogEntry(transaction::Transaction::Get(*context),
+                                     lowerRelTableName, true)
+                                 ->ptrCast<RelGroupCatalogEntry>();
+    }
     HNSWSearchState searchState{context, hnswBindData->nodeTableEntry, upperRelTableEntry,
-        lowerRelTableEntry, *hnswSharedState->nodeTable, hnswBindData->indexColumnID,
-        hnswSharedState->numNodes, static_cast<uint64_t>(k), hnswBindData->config};
+        lowerRelTableEntry, nodeTable, hnswBindData->indexColumnID, numNodes,
+        static_cast<uint64_t>(k), hnswBindData->config};
     const auto tableID = hnswBindData->nodeTableEntry->getTableID();
-    auto& semiMasks = hnswSharedState->semiMasks;
+    auto& semiMasks = input.sharedState.semiMasks;
+    // Local states of parallel functions are initialized concurrently.
+    std::lock_guard lck{input.sharedState.mtx};
     if (semiMasks.containsTableID(tableID)) {
         semiMasks.pin(tableID);
         searchState.semiMask = semiMasks.getPinnedMask();
     }
-    return std::make_unique<QueryHNSWLocalState>(std::move(searchState));
+    return searchState;
+}
+
+std::unique_ptr<TableFuncLocalState> initQueryHNSWLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    const auto hnswSharedState = input.sharedState.ptrCast<QueryHNSWIndexSharedState>();
+    return std::make_unique<QueryHNSWLocalState>(
+        initSearchState(input, *hnswSharedState->nodeTable, hnswSharedState->numNodes));
+}
+
+static offset_t batchTableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+    const auto localState = input.localState->ptrCast<QueryHNSWBatchLocalState>();
+    const auto sharedState = input.sharedState->ptrCast<QueryHNSWIndexBatchSharedState>();
+    const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
+    const auto context = input.context->clientContext;
+    // Each morsel is a single query, whose results are output in chunks before taking the next one.
+    while (!localState->hasResultToOutput()) {
+        const auto morsel = sharedState->getMorsel();
+        if (!morsel.hasMoreToOutput()) {
+            return 0;
+        }
+        localState->queryIdx = morsel.startOffset;
+        localState->numRowsOutput = 0;
+        const auto queryValue = NestedVal::getChildVal(&sharedState->queries, morsel.startOffset);
+        localState->result = searchIndex(context, getOnDiskIndex(context, *bindData), *queryValue,
+            localState->searchState);
+    }
+    const auto numToOutput =
+        std::min(localState->result.size() - localState->numRowsOutput, DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < numToOutput; i++) {
+        const auto& [nodeOffset, distance] = localState->result[i + localState->numRowsOutput];
+        output.dataChunk.getValueVectorMutable(0).setValue<int64_t>(i, localState->queryIdx);
+        output.dataChunk.getValueVectorMutable(1).setValue<internalID_t>(i,
+            internalID_t{nodeOffset, bindData->nodeTableEntry->getTableID()});
+        output.dataChunk.getValueVectorMutable(2).setValue<double>(i, distance);
+    }
+    localState->numRowsOutput += numToOutput;
+    output.dataChunk.state->getSelVectorUnsafe().setToUnfiltered(numToOutput);
+    return numToOutput;
+}
+
+static std::unique_ptr<TableFuncSharedState> initQueryHNSWBatchSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
+    auto context = input.context->clientContext;
+    auto nodeTable = storage::StorageManager::Get(*context)
+                         ->getTable(bindData->nodeTableEntry->getTableID())
+                         ->ptrCast<storage::NodeTable>();
+    auto numNodes = nodeTable->getStats(transaction::Transaction::Get(*context)).getTableCard();
+    const auto& columnType = getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry);
+    auto queries = evaluateParamExpr(bindData->queryExpression, context,
+        LogicalType::LIST(columnType.copy()));
+    if (queries.isNull()) {
+        throw BinderException{"The list of query vectors must not be null."};
+    }
+    auto sharedState =
+        std::make_unique<QueryHNSWIndexBatchSharedState>(nodeTable, numNodes, std::move(queries));
+    addFilterNodesMask(context, *bindData, numNodes, *sharedState);
+    return sharedState;
+}
+
+static std::unique_ptr<TableFuncLocalState> initQueryHNSWBatchLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    const auto hnswBindData = input.bindData.constPtrCast<QueryHNSWIndexBindData>();
+    const auto hnswSharedState = input.sharedState.ptrCast<QueryHNSWIndexBatchSharedState>();
+    auto searchState =
+        initSearchState(input, *hnswSharedState->nodeTable, hnswSharedState->numNodes);
+    // Queries of a batch are similar more often than not, so their traversals visit many of the
+    // same nodes.
+    const auto& columnType =
+        getIndexColumnType(*hnswBindData->nodeTableEntry, *hnswBindData->indexEntry);
+    const auto embeddingSize =
+        ArrayType::getNumElements(columnType) *
+        PhysicalTypeUtils::getFixedTypeSize(ArrayType::getChildType(columnType).getPhysicalType());
+    searchState.embeddingCache = std::make_unique<EmbeddingCache>(embeddingSize);
+    return std::make_unique<QueryHNSWBatchLocalState>(std::move(searchState));
+}
+
+static double batchProgressFunc(TableFuncSharedState* sharedState) {
+    const auto batchSharedState = sharedState->ptrCast<QueryHNSWIndexBatchSharedState>();
+    if (batchSharedState->numRows == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(batchSharedState->curRowIdx) / batchSharedState->numRows;
 }
 
 static void getLogicalPlan(Planner* planner, const BoundReadingClause& readingClause,
@@ -392,5 +572,22 @@ function_set QueryVectorIndexFunction::getFunctionSet() {
     return functionSet;
 }
 
+function_set QueryVectorIndexBatchFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::LIST,
+        LogicalTypeID::INT64};
+    auto tableFunction = std::make_unique<TableFunction>(name, inputTypes);
+    tableFunction->tableFunc = batchTableFunc;
+    tableFunction->bindFunc = bindBatchFunc;
+    tableFunction->initSharedStateFunc = initQueryHNSWBatchSharedState;
+    tableFunction->initLocalStateFunc = initQueryHNSWBatchLocalState;
+    tableFunction->progressFunc = batchProgressFunc;
+    tableFunction->getLogicalPlanFunc = getLogicalPlan;
+    tableFunction->getPhysicalPlanFunc = getPhysicalPlan;
+    tableFunction->inferInputTypes = inferBatchInputTypes;
+    functionSet.push_back(std::move(tableFunction));
+    return functionSet;
+}
+
 } // namespace vector_extension
 } // namespace kuzu
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "function/table/bind_data.h"
+#include "function/table/table_function.h"
+#include "index/diskann_config.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct CreateDiskANNIndexBindData final : function::TableFuncBindData {
+    main::ClientContext* context;
+    std::string indexName;
+    catalog::TableCatalogEntry* tableEntry;
+    common::property_id_t propertyID;
+    common::offset_t numNodes;
+    DiskANNIndexConfig config;
+    bool skipAfterBind;
+
+    CreateDiskANNIndexBindData(main::ClientContext* context, std::string indexName,
+        catalog::TableCatalogEntry* tableEntry, common::property_id_t propertyID,
+        common::offset_t numNodes, DiskANNIndexConfig config, bool skipAfterBind = false)
+        : TableFuncBindData{0}, context{context}, indexName{std::move(indexName)},
+          tableEntry{tableEntry}, propertyID{propertyID}, numNodes{numNodes},
+          config{std::move(config)}, skipAfterBind{skipAfterBind} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateDiskANNIndexBindData>(context, indexName, tableEntry,
+            propertyID, numNodes, config.copy(), skipAfterBind);
+    }
+};
+
+// Builds the graph of a DiskANN index and writes it out to the index file.
+struct InternalCreateDiskANNIndexFunction final {
+    static constexpr const char* name = "_CREATE_DISKANN_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+struct CreateDiskANNIndexFunction final {
+    static constexpr const char* name = "CREATE_DISKANN_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+} // namespace vector_extension
+} // namespace kuzu
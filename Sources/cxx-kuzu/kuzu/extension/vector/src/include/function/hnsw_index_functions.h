@@ -2,6 +2,7 @@
 
 #include "binder/bound_statement.h"
 #include "binder/expression/node_expression.h"
+#include "common/types/value/value.h"
 #include "function/table/bind_data.h"
 #include "function/table/simple_table_function.h"
 #include "function/table/table_function.h"
@@ -78,6 +79,8 @@ struct QueryHNSWIndexBindData final : function::TableFuncBindData {
     QueryHNSWConfig config;
 
     std::shared_ptr<binder::BoundStatement> filterStatement;
+    // List of internal IDs given with the filter_nodes option.
+    std::shared_ptr<binder::Expression> filterNodesExpression;
 
     explicit QueryHNSWIndexBindData(binder::expression_vector columns)
         : TableFuncBindData({std::move(columns), 1 /* maxOffset */}) {}
@@ -104,6 +107,31 @@ struct QueryHNSWLocalState final : function::TableFuncLocalState {
     bool hasResultToOutput() const { return result.has_value(); }
 };
 
+struct QueryHNSWIndexBatchSharedState final : function::SimpleTableFuncSharedState {
+    storage::NodeTable* nodeTable;
+    common::offset_t numNodes;
+    // The evaluated list of query vectors. Each morsel is the index of a single query.
+    common::Value queries;
+
+    QueryHNSWIndexBatchSharedState(storage::NodeTable* nodeTable, common::offset_t numNodes,
+        common::Value queries)
+        : SimpleTableFuncSharedState{queries.getChildrenSize(), 1 /* maxMorselSize */},
+          nodeTable{nodeTable}, numNodes{numNodes}, queries{std::move(queries)} {}
+};
+
+struct QueryHNSWBatchLocalState final : function::TableFuncLocalState {
+    common::offset_t queryIdx;
+    std::vector<NodeWithDistance> result;
+    HNSWSearchState searchState;
+    uint64_t numRowsOutput;
+
+    explicit QueryHNSWBatchLocalState(HNSWSearchState searchState)
+        : queryIdx{common::INVALID_OFFSET}, searchState{std::move(searchState)},
+          numRowsOutput{0} {}
+
+    bool hasResultToOutput() const { return numRowsOutput < result.size(); }
+};
+
 struct InternalCreateHNSWIndexFunction final {
     static constexpr const char* name = "_CREATE_HNSW_INDEX";
 
@@ -143,5 +171,14 @@ struct QueryVectorIndexFunction final {
     static function::function_set getFunctionSet();
 };
 
+// Runs the searches of a list of query vectors in parallel.
+struct QueryVectorIndexBatchFunction final {
+    static constexpr const char* name = "QUERY_VECTOR_INDEX_BATCH";
+
+    static constexpr const char* queryIdxColumnName = "query_idx";
+
+    static function::function_set getFunctionSet();
+};
+
 } // namespace vector_extension
 } // namespace kuzu
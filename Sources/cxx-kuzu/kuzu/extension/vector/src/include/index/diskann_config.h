@@ -0,0 +1,50 @@
+#pragma once
+
+#include "index/hnsw_config.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// Max degree of the nodes in the graph (R in the Vamana paper).
+struct Degree {
+    static constexpr const char* NAME = "degree";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 64;
+
+    static void validate(int64_t value);
+};
+
+// Size of the candidate list of the searches run while building the graph (L in the Vamana paper).
+struct BuildListSize {
+    static constexpr const char* NAME = "l_build";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 100;
+
+    static void validate(int64_t value);
+};
+
+struct DiskANNIndexConfig {
+    int64_t degree = Degree::DEFAULT_VALUE;
+    int64_t buildListSize = BuildListSize::DEFAULT_VALUE;
+    MetricType metric = Metric::DEFAULT_VALUE;
+    double alpha = Alpha::DEFAULT_VALUE;
+    common::ConflictAction conflictAction = SkipIfExists::DEFAULT_VALUE;
+
+    DiskANNIndexConfig() = default;
+
+    explicit DiskANNIndexConfig(const function::optional_params_t& optionalParams);
+
+    EXPLICIT_COPY_DEFAULT_MOVE(DiskANNIndexConfig);
+
+    void serialize(common::Serializer& ser) const;
+
+    static DiskANNIndexConfig deserialize(common::Deserializer& deSer);
+
+private:
+    DiskANNIndexConfig(const DiskANNIndexConfig& other)
+        : degree{other.degree}, buildListSize{other.buildListSize}, metric{other.metric},
+          alpha{other.alpha}, conflictAction{other.conflictAction} {}
+};
+
+} // namespace vector_extension
+} // namespace kuzu
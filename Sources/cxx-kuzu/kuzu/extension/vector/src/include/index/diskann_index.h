@@ -0,0 +1,238 @@
+#pragma once
+
+#include "storage/file_handle.h"
+#include "index/diskann_config.h"
+#include "index/hnsw_index.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+struct DiskANNStorageInfo final : storage::IndexStorageInfo {
+    // Nodes with a smaller offset are covered by the index. Nodes inserted afterwards are scanned at
+    // query time.
+    common::offset_t numIndexedNodes;
+    common::offset_t entryPoint;
+    // Pages of the data file holding the index.
+    storage::PageRange pageRange;
+
+    DiskANNStorageInfo() : numIndexedNodes{0}, entryPoint{common::INVALID_OFFSET} {}
+    DiskANNStorageInfo(common::offset_t numIndexedNodes, common::offset_t entryPoint,
+        storage::PageRange pageRange)
+        : numIndexedNodes{numIndexedNodes}, entryPoint{entryPoint}, pageRange{pageRange} {}
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+
+    static std::unique_ptr<IndexStorageInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+};
+
+struct DiskANNFileHeader {
+    static constexpr uint64_t MAGIC = 0x4e4e414b5349444b; // "KDISKANN"
+    static constexpr uint64_t VERSION = 1;
+
+    uint64_t magic;
+    uint64_t version;
+    uint64_t numNodes;
+    uint64_t dimension;
+    uint64_t elementSize;
+    uint64_t degree;
+    uint64_t entryPoint;
+};
+
+// The index is stored in a range of pages of the data file, so that it is allocated, checkpointed
+// and backed up with the rest of the database. It consists of three regions, each starting at a
+// sector boundary:
+//  - The header, followed by the per-dimension value ranges of the scalar quantizer.
+//  - The quantized codes of all indexed nodes, which are loaded into memory to navigate the graph.
+//  - The records of the indexed nodes. A record holds the number of neighbors, a fixed number of
+//    neighbor slots and the full-precision vector, so that a single read of the sectors of the
+//    record gives both the neighbors to expand and the vector to re-rank on. Records are packed
+//    into sectors without spanning a sector boundary, unless a record is larger than a sector, in
+//    which case each record starts its own run of sectors.
+struct DiskANNFileLayout {
+    static constexpr uint64_t SECTOR_SIZE = common::KUZU_PAGE_SIZE;
+    // Number of neighbors of the records of nodes without a vector, e.g. deleted nodes.
+    static constexpr uint32_t NO_VECTOR = UINT32_MAX;
+
+    common::offset_t numNodes;
+    common::length_t dimension;
+    uint64_t elementSize;
+    uint64_t degree;
+
+    DiskANNFileLayout(common::offset_t numNodes, common::length_t dimension, uint64_t elementSize,
+        uint64_t degree)
+        : numNodes{numNodes}, dimension{dimension}, elementSize{elementSize}, degree{degree} {}
+
+    static uint64_t alignToSector(uint64_t numBytes) {
+        return (numBytes + SECTOR_SIZE - 1) / SECTOR_SIZE * SECTOR_SIZE;
+    }
+
+    static uint64_t alignTo8(uint64_t numBytes) { return (numBytes + 7) / 8 * 8; }
+
+    uint64_t getVectorSize() const { return dimension * elementSize; }
+    // Vectors are 8-byte aligned within records, as double vectors are read in place.
+    uint64_t getVectorOffsetInRecord() const {
+        return alignTo8(sizeof(uint32_t) * (1 + degree));
+    }
+    uint64_t getRecordSize() const {
+        return alignTo8(getVectorOffsetInRecord() + getVectorSize());
+    }
+    uint64_t getNumRecordsPerSector() const {
+        return std::max<uint64_t>(SECTOR_SIZE / getRecordSize(), 1);
+    }
+    // Number of bytes read to get a single record.
+    uint64_t getRecordReadSize() const { return alignToSector(getRecordSize()); }
+
+    uint64_t getHeaderSize() const {
+        return alignToSector(sizeof(DiskANNFileHeader) + 2 * dimension * sizeof(float));
+    }
+    uint64_t getCodesOffset() const { return getHeaderSize(); }
+    uint64_t getRecordsOffset() const {
+        return getCodesOffset() + alignToSector(numNodes * dimension);
+    }
+    // Offset in the file of the first sector of the record.
+    uint64_t getRecordReadOffset(common::offset_t offset) const {
+        return getRecordsOffset() + offset / getNumRecordsPerSector() * getRecordReadSize();
+    }
+    // Position of the record within the bytes read for it.
+    uint64_t getOffsetInRecordRead(common::offset_t offset) const {
+        return offset % getNumRecordsPerSector() * getRecordSize();
+    }
+    uint64_t getFileSize() const {
+        const auto numReads =
+            (numNodes + getNumRecordsPerSector() - 1) / getNumRecordsPerSector();
+        return getRecordsOffset() + numReads * getRecordReadSize();
+    }
+    common::page_idx_t getNumPages() const { return getFileSize() / SECTOR_SIZE; }
+};
+
+// Builds a Vamana graph over the embeddings of a node table in memory and writes it out as a
+// DiskANN index to pages of the data file.
+class DiskANNIndexBuilder {
+public:
+    DiskANNIndexBuilder(main::ClientContext* context, storage::NodeTable& nodeTable,
+        common::column_id_t columnID, common::offset_t numNodes, DiskANNIndexConfig config);
+
+    // Returns the storage info of the index. Its pages are allocated from pageAllocator, which
+    // frees them if the transaction building the index rolls back.
+    std::unique_ptr<DiskANNStorageInfo> build(storage::PageAllocator& pageAllocator);
+
+private:
+    void loadVectors(storage::NodeTable& nodeTable, common::column_id_t columnID);
+    common::offset_t computeMedoid() const;
+    void initRandomGraph();
+    // Returns the nodes expanded by a search for the vector of the node, i.e. the candidates of its
+    // neighbors.
+    std::vector<common::offset_t> greedySearch(common::offset_t offset,
+        common::offset_t entryPoint);
+    // Keeps at most degree candidates of which none is closer from an already kept neighbor than
+    // from the node by a factor alpha (RobustPrune in the Vamana paper).
+    void robustPrune(common::offset_t offset, std::vector<common::offset_t> candidates,
+        double alpha);
+    void insertBackEdges(common::offset_t offset, double alpha);
+    void writePages(storage::FileHandle& dataFH, common::page_idx_t startPageIdx,
+        common::offset_t entryPoint) const;
+
+    const void* getVector(common::offset_t offset) const {
+        return vectors.data() + offset * layout.getVectorSize();
+    }
+    double computeDistance(common::offset_t left, common::offset_t right) const {
+        return metricFunc(getVector(left), getVector(right), layout.dimension);
+    }
+
+private:
+    main::ClientContext* context;
+    DiskANNIndexConfig config;
+    common::ArrayTypeInfo typeInfo;
+    metric_func_t metricFunc;
+    DiskANNFileLayout layout;
+    ScalarQuantizer quantizer;
+    std::vector<uint8_t> vectors;
+    std::vector<bool> hasVector;
+    std::vector<std::vector<uint32_t>> nbrs;
+    // Epoch based visited marks, so that searches don't need to clear them.
+    std::vector<uint32_t> visitedEpochs;
+    uint32_t epoch;
+    common::RandomEngine randomEngine;
+};
+
+class OnDiskDiskANNIndex final : public storage::Index {
+public:
+    OnDiskDiskANNIndex(main::ClientContext* context, storage::IndexInfo indexInfo,
+        std::unique_ptr<storage::IndexStorageInfo> storageInfo, DiskANNIndexConfig config);
+
+    // Beam search over the graph in the index pages. Candidates are navigated on their in-memory
+    // quantized codes, and expanded beamWidth at a time with a single batch of reads, which also
+    // gives the full-precision vectors the results are ranked on.
+    std::vector<NodeWithDistance> search(transaction::Transaction* transaction,
+        const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
+
+    common::LogicalType getElementType() const { return typeInfo.getChildType().copy(); }
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        storage::StorageManager* storageManager, storage::IndexInfo indexInfo,
+        std::span<uint8_t> storageInfoBuffer);
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext*,
+        storage::visible_func) override {
+        // Inserted nodes are beyond numIndexedNodes and scanned at query time.
+        return std::make_unique<InsertState>();
+    }
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext* context,
+        common::column_id_t columnID, storage::visible_func isVisible) override;
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction* /*transaction*/,
+        storage::MemoryManager* /*mm*/, storage::visible_func /*isVisible*/) override {
+        return std::make_unique<DeleteState>();
+    }
+    void delete_(transaction::Transaction* /*transaction*/,
+        const common::ValueVector& /*nodeIDVector*/, DeleteState& /*deleteState*/) override {
+        // DO NOTHING.
+        // Deleted nodes stay in the graph to be navigated through, and are filtered out of results.
+    }
+
+    void reclaimStorage(storage::PageAllocator& pageAllocator) const override;
+
+    static storage::IndexType getIndexType() {
+        static const storage::IndexType DISKANN_INDEX_TYPE{"DISKANN",
+            storage::IndexConstraintType::SECONDARY_NON_UNIQUE,
+            storage::IndexDefinitionType::EXTENSION, load};
+        return DISKANN_INDEX_TYPE;
+    }
+
+private:
+    struct NodeRecord {
+        std::span<const uint32_t> nbrs;
+        const void* vector;
+
+        bool hasVector() const { return vector != nullptr; }
+    };
+
+    // Reads the records of the nodes with a single batch of reads into buffer.
+    std::vector<NodeRecord> readRecords(std::span<const common::offset_t> offsets,
+        std::vector<uint8_t>& buffer) const;
+    std::vector<NodeWithDistance> beamSearch(const EmbeddingHandle& queryVector,
+        HNSWSearchState& searchState) const;
+    // Exact search over the masked indexed nodes, reading their records in batches.
+    std::vector<NodeWithDistance> bruteForceSearch(const EmbeddingHandle& queryVector,
+        HNSWSearchState& searchState) const;
+    void searchFromUnIndexed(transaction::Transaction* transaction,
+        const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
+        std::vector<NodeWithDistance>& result) const;
+    bool shouldBruteForce(const HNSWSearchState& searchState) const;
+
+private:
+    DiskANNIndexConfig config;
+    common::ArrayTypeInfo typeInfo;
+    metric_func_t metricFunc;
+    storage::NodeTable& nodeTable;
+    DiskANNFileLayout layout;
+    common::FileInfo* fileInfo;
+    // Offset of the index pages in the data file.
+    uint64_t startOffset;
+    ScalarQuantizer quantizer;
+    std::vector<uint8_t> codes;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
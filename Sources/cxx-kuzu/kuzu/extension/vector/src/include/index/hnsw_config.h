@@ -11,6 +11,8 @@ namespace vector_extension {
 
 enum class MetricType : uint8_t { Cosine = 0, L2 = 1, L2_SQUARE = 2, DotProduct = 3 };
 
+enum class QuantizationType : uint8_t { NONE = 0, SQ8 = 1 };
+
 // We use this ratio to calculate the max degree of the upper/lower graph based on the user provided
 // max degree value for the upper/lower graph, respectively.
 static constexpr double DEFAULT_DEGREE_THRESHOLD_RATIO = 1.25;
@@ -80,6 +82,15 @@ struct CacheEmbeddings {
     static constexpr bool DEFAULT_VALUE = true;
 };
 
+// Quantization of the embeddings kept inside the index to score candidates during queries.
+struct Quantization {
+    static constexpr const char* NAME = "quantization";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr QuantizationType DEFAULT_VALUE = QuantizationType::NONE;
+
+    static void validate(const std::string& quantization);
+};
+
 struct SkipIfExists {
     static constexpr const char* NAME = "skip_if_exists";
     static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
@@ -110,6 +121,39 @@ struct DirectedSearchUpSelThreshold {
     static void validate(double value);
 };
 
+// Masks with a selectivity below this threshold are searched by scanning all masked nodes instead
+// of traversing the graph. Brute-force search returns exact results, so it is disabled by default
+// to keep the results of existing HNSW queries unchanged.
+struct BruteForceSearchUpSelThreshold {
+    static constexpr const char* NAME = "brute_force_search_up_sel";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 0;
+
+    static void validate(double value);
+};
+
+// List of internal IDs of the nodes to search within, e.g. the result of a preceding match or of a
+// full-text search. It is bound as an expression, so it can also be given as a parameter.
+struct FilterNodes {
+    static constexpr const char* NAME = "filter_nodes";
+};
+
+// Whether candidates scored on quantized embeddings are re-ranked on full-precision embeddings.
+struct Rerank {
+    static constexpr const char* NAME = "rerank";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = true;
+};
+
+// Number of nodes of a DiskANN index whose records are read with a single batch of reads.
+struct BeamWidth {
+    static constexpr const char* NAME = "beam_width";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 4;
+
+    static void validate(int64_t value);
+};
+
 struct HNSWIndexConfig {
     int64_t mu = Mu::DEFAULT_VALUE;
     int64_t ml = Ml::DEFAULT_VALUE;
@@ -118,6 +162,7 @@ struct HNSWIndexConfig {
     double alpha = Alpha::DEFAULT_VALUE;
     int64_t efc = Efc::DEFAULT_VALUE;
     bool cacheEmbeddingsColumn = CacheEmbeddings::DEFAULT_VALUE;
+    QuantizationType quantization = Quantization::DEFAULT_VALUE;
     common::ConflictAction conflictAction = SkipIfExists::DEFAULT_VALUE;
 
     HNSWIndexConfig() = default;
@@ -131,14 +176,16 @@ struct HNSWIndexConfig {
     static HNSWIndexConfig deserialize(common::Deserializer& deSer);
 
     static std::string metricToString(MetricType metric);
+    static std::string quantizationToString(QuantizationType quantization);
+    static MetricType getMetricType(const std::string& metricName);
 
 private:
     HNSWIndexConfig(const HNSWIndexConfig& other)
         : mu{other.mu}, ml{other.ml}, pu{other.pu}, metric{other.metric}, alpha{other.alpha},
           efc{other.efc}, cacheEmbeddingsColumn(other.cacheEmbeddingsColumn),
-          conflictAction(other.conflictAction) {}
+          quantization(other.quantization), conflictAction(other.conflictAction) {}
 
-    static MetricType getMetricType(const std::string& metricName);
+    static QuantizationType getQuantizationType(const std::string& quantizationName);
 };
 
 struct DropHNSWConfig {
@@ -153,6 +200,9 @@ struct QueryHNSWConfig {
     int64_t efs = Efs::DEFAULT_VALUE;
     double blindSearchUpSelThreshold = BlindSearchUpSelThreshold::DEFAULT_VALUE;
     double directedSearchUpSelThreshold = DirectedSearchUpSelThreshold::DEFAULT_VALUE;
+    double bruteForceSearchUpSelThreshold = BruteForceSearchUpSelThreshold::DEFAULT_VALUE;
+    bool rerank = Rerank::DEFAULT_VALUE;
+    int64_t beamWidth = BeamWidth::DEFAULT_VALUE;
 
     QueryHNSWConfig() = default;
 
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <atomic>
+#include <optional>
 #include <queue>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "common/random_engine.h"
 #include "graph/on_disk_graph.h"
 #include "index/hnsw_config.h"
 #include "index/hnsw_graph.h"
 #include "index/hnsw_index_utils.h"
+#include "index/hnsw_quantization.h"
 #include "storage/index/index.h"
 
 namespace kuzu {
@@ -57,6 +63,28 @@ struct VisitedState {
     bool contains(common::offset_t offset) const { return visited[offset]; }
 };
 
+// Caches full-precision embeddings fetched from the node table, so that searches running one after
+// another (e.g. the queries of a batch handled by the same thread) share the fetches of the nodes
+// their traversals have in common. The cache is cleared once it is full.
+class EmbeddingCache {
+public:
+    static constexpr uint64_t MAX_MEMORY_USAGE = 16 * 1024 * 1024;
+
+    explicit EmbeddingCache(uint64_t embeddingSize);
+
+    // Returns the embedding of the node, or nullptr if the node is deleted or its embedding is
+    // null. The pointer is valid until the next call.
+    const void* getEmbedding(common::offset_t offset, const HNSWIndexEmbeddings& embeddings,
+        GetEmbeddingsScanState& scanState);
+
+private:
+    uint64_t embeddingSize;
+    uint64_t capacity;
+    // Positions of the cached embeddings in data, or INVALID_OFFSET for null embeddings.
+    std::unordered_map<common::offset_t, common::offset_t> positions;
+    std::vector<uint8_t> data;
+};
+
 struct HNSWStorageInfo final : storage::IndexStorageInfo {
     common::table_id_t upperRelTableID;
     common::table_id_t lowerRelTableID;
@@ -249,6 +277,15 @@ enum class SearchType : uint8_t {
     DIRECTED_TWO_HOP = 1,
     ONE_HOP_FILTERED = 2,
     UNFILTERED = 3,
+    // Scans all masked nodes instead of traversing the graph.
+    BRUTE_FORCE = 4,
+};
+
+// State of a query on an index with quantized embeddings, which scores candidates on their codes.
+struct QuantizedSearchState {
+    const transaction::Transaction* transaction;
+    const QuantizedEmbeddings* embeddings;
+    ScalarQuantizer::PreparedQuery query;
 };
 
 struct HNSWSearchState {
@@ -267,6 +304,10 @@ struct HNSWSearchState {
     SearchType searchType;
     std::unique_ptr<graph::NbrScanState> nbrScanState;
     std::unique_ptr<graph::NbrScanState> secondHopNbrScanState;
+    // Only set while a query is scoring candidates on quantized embeddings.
+    std::optional<QuantizedSearchState> quantizedSearch;
+    // Only set if fetched embeddings should be kept across searches.
+    std::unique_ptr<EmbeddingCache> embeddingCache;
 
     HNSWSearchState(main::ClientContext* context, catalog::TableCatalogEntry* nodeTableEntry,
         catalog::TableCatalogEntry* upperRelTableEntry,
@@ -278,6 +319,11 @@ struct HNSWSearchState {
         return !hasMask() || semiMask->isMasked(offset);
     }
     bool hasMask() const { return semiMask != nullptr; }
+    // The number of results kept by the layer search, which is larger than k if the results are
+    // re-ranked afterwards.
+    uint64_t getNumResultsToKeep() const {
+        return quantizedSearch.has_value() && config.rerank ? ef : k;
+    }
 };
 
 class OnDiskHNSWIndex final : public HNSWIndex {
@@ -291,9 +337,6 @@ public:
         std::unique_ptr<storage::RelTableInsertState> relInsertState;
         // State for detaching delete.
         std::unique_ptr<storage::RelTableDeleteState> relDeleteState;
-        // Nodes to shrink at the end of insertions.
-        std::unordered_set<common::offset_t> upperNodesToShrink;
-        std::unordered_set<common::offset_t> lowerNodesToShrink;
 
         HNSWInsertState(main::ClientContext* context, catalog::TableCatalogEntry* nodeTableEntry,
             catalog::TableCatalogEntry* upperRelTableEntry,
@@ -315,6 +358,8 @@ public:
     bool needCommitInsert() const override { return true; }
     void commitInsert(transaction::Transaction*, const common::ValueVector&,
         const std::vector<common::ValueVector*>&, InsertState&) override;
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
 
     static storage::IndexType getIndexType() {
         static const storage::IndexType HNSW_INDEX_TYPE{"HNSW",
@@ -325,13 +370,35 @@ public:
 
     void finalize(main::ClientContext*) override;
     void checkpoint(main::ClientContext* context, storage::PageAllocator& pageAllocator) override;
+    bool needsMaintenance() const override { return shouldConsolidateDeletes(); }
+    void runMaintenance(main::ClientContext* context) override;
+    void commitMaintenance() override;
+    void rollbackMaintenance() override;
 
 private:
+    // Returns the distance between the query and the node, or nullopt if the node is deleted or
+    // its embedding is null.
+    std::optional<double> computeDistance(const EmbeddingHandle& queryVector,
+        common::offset_t offset, HNSWSearchState& searchState) const;
+    void processNbrNode(const EmbeddingHandle& queryVector, common::offset_t nbrOffset,
+        uint64_t ef, HNSWSearchState& searchState, min_node_priority_queue_t& candidates,
+        max_node_priority_queue_t& results) const;
+    // Quantized embeddings are built by the first query, as they are not persisted. Other queries
+    // score candidates on full-precision embeddings until the codes are ready.
+    void initQuantizedEmbeddings(transaction::Transaction* transaction) const;
+    void buildQuantizedEmbeddings(transaction::Transaction* transaction) const;
+    void setQuantizedCode(common::offset_t offset, const EmbeddingHandle& vector);
+    void rerank(const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
+        std::vector<NodeWithDistance>& result) const;
+
     common::offset_t searchNNInUpperLayer(const EmbeddingHandle& queryVector,
         HNSWSearchState& searchState) const;
     std::vector<NodeWithDistance> searchKNNInLayer(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, common::offset_t entryNode,
         HNSWSearchState& searchState, bool isUpperLayer) const;
+    // Exact search over the masked nodes, which covers both checkpointed and uncheckpointed nodes.
+    std::vector<NodeWithDistance> bruteForceSearch(transaction::Transaction* transaction,
+        const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
     std::vector<NodeWithDistance> searchFromCheckpointed(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
     void searchFromUnCheckpointed(transaction::Transaction* transaction,
@@ -358,6 +425,23 @@ private:
         const std::vector<NodeWithDistance>& nbrs, bool isUpperLayer, HNSWInsertState& insertState);
     void shrinkForNode(transaction::Transaction* transaction, common::offset_t offset,
         bool isUpperLayer, common::length_t maxDegree, HNSWInsertState& insertState);
+    // Replaces the rels of the node with the pruned candidates.
+    void replaceNbrs(transaction::Transaction* transaction, common::offset_t offset,
+        const EmbeddingHandle& vector, const common::offset_vec_t& candidates, bool isUpperLayer,
+        common::length_t maxDegree, HNSWInsertState& insertState);
+    void shrinkPendingNodes(transaction::Transaction* transaction, HNSWInsertState& insertState);
+    bool shouldConsolidateDeletes() const;
+    // Removes the nodes of deletedNodesToConsolidate that are deleted from both layers: the rels to
+    // each deleted node are replaced by its neighbors, and its own rels are deleted (FreshVamana
+    // delete consolidation).
+    void consolidateDeletes(transaction::Transaction* transaction, HNSWInsertState& insertState);
+    void consolidateDeletesInLayer(transaction::Transaction* transaction,
+        const std::unordered_set<common::offset_t>& deletedNodes, bool isUpperLayer,
+        HNSWInsertState& insertState);
+    std::unique_ptr<graph::NbrScanState> prepareNbrScan(const HNSWSearchState& searchState,
+        bool isUpperLayer) const;
+    common::offset_vec_t getNbrOffsets(common::offset_t offset, const HNSWSearchState& searchState,
+        bool isUpperLayer, graph::NbrScanState& nbrScanState) const;
 
     void processSecondHopCandidates(const EmbeddingHandle& queryVector,
         HNSWSearchState& searchState, int64_t& numVisitedNbrs,
@@ -386,15 +470,45 @@ private:
 
     static SearchType getFilteredSearchType(transaction::Transaction* transaction,
         const HNSWSearchState& searchState);
+    // Nodes with fewer rels are shrunk in batches, nodes with more right away.
+    static int64_t getDegreeThresholdToForceShrink(int64_t degree);
 
 private:
     static constexpr uint64_t FILTERED_SEARCH_INITIAL_CANDIDATES = 10;
     static constexpr uint64_t INSERTION_BATCH_MERGE_THRESHOLD = 2000;
+    static constexpr int64_t DEFERRED_SHRINK_DEGREE_RATIO = 2;
+    // Deleted nodes are consolidated once they make up this fraction of the indexed nodes.
+    static constexpr double DELETE_CONSOLIDATION_THRESHOLD_RATIO = 0.05;
+    // The number of embeddings sampled to determine the value ranges of the quantizer.
+    static constexpr uint64_t QUANTIZER_SAMPLE_SIZE = 10000;
 
     storage::MemoryManager* mm;
     storage::NodeTable& nodeTable;
     storage::RelTable* upperRelTable;
     storage::RelTable* lowerRelTable;
+    // Nodes with more rels than the max degree, shrunk in batches. Like deletedNodesToConsolidate,
+    // only accessed by write transactions, which are serialized.
+    std::unordered_set<common::offset_t> upperNodesToShrink;
+    std::unordered_set<common::offset_t> lowerNodesToShrink;
+    // Deleted nodes which still have rels in the layers. They are consolidated by the maintenance
+    // transaction before checkpoints, and only removed from the set once it commits.
+    std::unordered_set<common::offset_t> deletedNodesToConsolidate;
+    // The state of an uncommitted maintenance transaction: the nodes it consolidates, and the entry
+    // points to restore if it rolls back.
+    struct PendingConsolidation {
+        std::unordered_set<common::offset_t> nodes;
+        common::offset_t upperEntryPoint;
+        common::offset_t lowerEntryPoint;
+    };
+    std::optional<PendingConsolidation> pendingConsolidation;
+    // Guards quantizedEmbeddings: queries hold it shared, and writing codes holds it exclusively for
+    // one batch of nodes at a time.
+    mutable std::shared_mutex quantizedEmbeddingsMtx;
+    mutable std::unique_ptr<QuantizedEmbeddings> quantizedEmbeddings;
+    // Set by the query building the codes. Codes of inserted nodes are written meanwhile, but
+    // queries only use the codes once they are ready.
+    mutable std::atomic<bool> buildingQuantizedEmbeddings{false};
+    mutable std::atomic<bool> quantizedEmbeddingsReady{false};
 };
 
 } // namespace vector_extension
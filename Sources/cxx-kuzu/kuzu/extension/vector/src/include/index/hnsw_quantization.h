@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vector>
+
+#include "common/assert.h"
+#include "common/types/types.h"
+#include "index/hnsw_config.h"
+#include "storage/buffer_manager/mm_allocator.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// Int8 scalar quantizer: each dimension is mapped linearly from its [min, max] range onto the codes
+// 0 to 255. Distances are asymmetric, i.e. computed between a full-precision query and the decoded
+// codes, so only the indexed vectors lose precision.
+class ScalarQuantizer {
+public:
+    // Queries with the terms that do not depend on the scored vector precomputed.
+    struct PreparedQuery {
+        // Per-dimension query terms, see prepareQuery() for their meaning under each metric.
+        std::vector<float> terms;
+        // Dot product of the query with the per-dimension minimums.
+        double constant = 0;
+        double squaredNorm = 0;
+    };
+
+    ScalarQuantizer(common::length_t dimension, common::LogicalTypeID elementTypeID,
+        MetricType metric);
+
+    common::length_t getDimension() const { return dimension; }
+
+    // Widens the per-dimension ranges to cover the given vector. Must be called on a sample of the
+    // indexed vectors before finalizeRanges(); values outside of the ranges are clamped on encoding.
+    void updateRanges(const void* vector);
+    void finalizeRanges();
+    // Restores the ranges of a quantizer, as obtained through getMins() and getMaxs().
+    void setRanges(std::vector<float> mins_, std::vector<float> maxs_);
+    const std::vector<float>& getMins() const { return mins; }
+    const std::vector<float>& getMaxs() const { return maxs; }
+
+    // Writes getDimension() codes of the given vector to codes.
+    void encode(const void* vector, uint8_t* codes) const;
+
+    PreparedQuery prepareQuery(const void* query) const;
+    // Returns the same distance as the metric function of the index for the decoded codes.
+    double computeDistance(const PreparedQuery& query, const uint8_t* codes) const;
+
+private:
+    template<typename Func>
+    void visitVector(const void* vector, Func func) const;
+
+private:
+    common::length_t dimension;
+    common::LogicalTypeID elementTypeID;
+    MetricType metric;
+    std::vector<float> mins;
+    std::vector<float> maxs;
+    // Width of the range of each dimension covered by one code.
+    std::vector<float> scales;
+};
+
+// Quantized codes of the embeddings of an index, kept in memory allocated from the memory manager.
+// Codes only serve as a cache for the full-precision embeddings: nodes without a code are scored on
+// their full-precision embedding.
+class QuantizedEmbeddings {
+public:
+    QuantizedEmbeddings(storage::MemoryManager* mm, ScalarQuantizer quantizer)
+        : quantizer{std::move(quantizer)}, codes{storage::MmAllocator<uint8_t>{mm}},
+          codeValid{storage::MmAllocator<uint8_t>{mm}} {}
+
+    const ScalarQuantizer& getQuantizer() const { return quantizer; }
+
+    bool hasCode(common::offset_t offset) const {
+        return offset < codeValid.size() && codeValid[offset];
+    }
+    const uint8_t* getCode(common::offset_t offset) const {
+        KU_ASSERT(hasCode(offset));
+        return codes.data() + offset * quantizer.getDimension();
+    }
+
+    void reserve(common::offset_t numNodes) {
+        codes.reserve(numNodes * quantizer.getDimension());
+        codeValid.reserve(numNodes);
+    }
+    void setCode(common::offset_t offset, const void* vector);
+    void clearCode(common::offset_t offset) {
+        if (offset < codeValid.size()) {
+            codeValid[offset] = false;
+        }
+    }
+
+private:
+    ScalarQuantizer quantizer;
+    std::vector<uint8_t, storage::MmAllocator<uint8_t>> codes;
+    std::vector<uint8_t, storage::MmAllocator<uint8_t>> codeValid;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
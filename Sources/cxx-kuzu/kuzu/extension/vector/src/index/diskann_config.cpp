@@ -0,0 +1,89 @@
+#include "index/diskann_config.h"
+
+#include "common/exception/binder.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/string_utils.h"
+#include "function/diskann_index_functions.h"
+
+namespace kuzu {
+namespace vector_extension {
+
+// The maximum allowed degree, which keeps the record of a node within a few sectors.
+static constexpr int64_t MAX_DISKANN_DEGREE = 512;
+
+void Degree::validate(int64_t value) {
+    if (value < 1 || value > MAX_DISKANN_DEGREE) {
+        throw common::BinderException{common::stringFormat(
+            "Degree must be a positive integer between 1 and {}.", MAX_DISKANN_DEGREE)};
+    }
+}
+
+void BuildListSize::validate(int64_t value) {
+    if (value < 1) {
+        throw common::BinderException{"L_build must be a positive integer."};
+    }
+}
+
+DiskANNIndexConfig::DiskANNIndexConfig(const function::optional_params_t& optionalParams) {
+    for (auto& [name, value] : optionalParams) {
+        auto lowerCaseName = common::StringUtils::getLower(name);
+        if (Degree::NAME == lowerCaseName) {
+            value.validateType(Degree::TYPE);
+            degree = value.getValue<int64_t>();
+            Degree::validate(degree);
+        } else if (BuildListSize::NAME == lowerCaseName) {
+            value.validateType(BuildListSize::TYPE);
+            buildListSize = value.getValue<int64_t>();
+            BuildListSize::validate(buildListSize);
+        } else if (Metric::NAME == lowerCaseName) {
+            value.validateType(Metric::TYPE);
+            auto funcName = value.getValue<std::string>();
+            Metric::validate(funcName);
+            metric = HNSWIndexConfig::getMetricType(funcName);
+        } else if (Alpha::NAME == lowerCaseName) {
+            value.validateType(Alpha::TYPE);
+            alpha = value.getValue<double>();
+            Alpha::validate(alpha);
+        } else if (SkipIfExists::NAME == lowerCaseName) {
+            value.validateType(SkipIfExists::TYPE);
+            conflictAction = value.getValue<bool>() ?
+                                 common::ConflictAction::ON_CONFLICT_DO_NOTHING :
+                                 common::ConflictAction::ON_CONFLICT_THROW;
+        } else {
+            throw common::BinderException{
+                common::stringFormat("Unrecognized optional parameter {} in {}.", name,
+                    CreateDiskANNIndexFunction::name)};
+        }
+    }
+}
+
+void DiskANNIndexConfig::serialize(common::Serializer& ser) const {
+    ser.writeDebuggingInfo("degree");
+    ser.serializeValue(degree);
+    ser.writeDebuggingInfo("buildListSize");
+    ser.serializeValue(buildListSize);
+    ser.writeDebuggingInfo("metric");
+    ser.serializeValue<uint8_t>(static_cast<uint8_t>(metric));
+    ser.writeDebuggingInfo("alpha");
+    ser.serializeValue(alpha);
+}
+
+DiskANNIndexConfig DiskANNIndexConfig::deserialize(common::Deserializer& deSer) {
+    auto config = DiskANNIndexConfig{};
+    std::string debuggingInfo;
+    deSer.validateDebuggingInfo(debuggingInfo, "degree");
+    deSer.deserializeValue(config.degree);
+    deSer.validateDebuggingInfo(debuggingInfo, "buildListSize");
+    deSer.deserializeValue(config.buildListSize);
+    deSer.validateDebuggingInfo(debuggingInfo, "metric");
+    uint8_t metric = 0;
+    deSer.deserializeValue(metric);
+    config.metric = static_cast<MetricType>(metric);
+    deSer.validateDebuggingInfo(debuggingInfo, "alpha");
+    deSer.deserializeValue(config.alpha);
+    return config;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
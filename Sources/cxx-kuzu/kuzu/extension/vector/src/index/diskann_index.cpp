@@ -0,0 +1,646 @@
+#include "index/diskann_index.h"
+
+#include <cstring>
+#include <numeric>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+
+using namespace kuzu::storage;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace vector_extension {
+
+// The number of bytes of records written at once while building the index.
+static constexpr uint64_t WRITE_CHUNK_SIZE = 256 * DiskANNFileLayout::SECTOR_SIZE;
+// The number of records read with a single batch of reads during brute force searches.
+static constexpr uint64_t BRUTE_FORCE_READ_BATCH_SIZE = 64;
+
+static common::ArrayTypeInfo getArrayTypeInfo(NodeTable& table, common::column_id_t columnID) {
+    const auto& columnType = table.getColumn(columnID).getDataType();
+    KU_ASSERT(columnType.getLogicalTypeID() == common::LogicalTypeID::ARRAY);
+    const auto typeInfo = columnType.getExtraTypeInfo()->constPtrCast<common::ArrayTypeInfo>();
+    return common::ArrayTypeInfo{typeInfo->getChildType().copy(), typeInfo->getNumElements()};
+}
+
+static uint64_t getElementSize(const common::ArrayTypeInfo& typeInfo) {
+    return common::PhysicalTypeUtils::getFixedTypeSize(typeInfo.getChildType().getPhysicalType());
+}
+
+static NodeTable& getNodeTable(const main::ClientContext& context, common::table_id_t tableID) {
+    return StorageManager::Get(context)->getTable(tableID)->cast<NodeTable>();
+}
+
+namespace {
+
+struct SearchCandidate {
+    common::offset_t offset;
+    double distance;
+    bool expanded;
+};
+
+} // namespace
+
+// Inserts the candidate into the list, which is sorted by distance and holds at most listSize
+// candidates.
+static void insertCandidate(std::vector<SearchCandidate>& candidates, SearchCandidate candidate,
+    uint64_t listSize) {
+    if (candidates.size() >= listSize && candidate.distance >= candidates.back().distance) {
+        return;
+    }
+    const auto pos = std::ranges::upper_bound(candidates, candidate.distance, std::less{},
+        &SearchCandidate::distance);
+    candidates.insert(pos, candidate);
+    if (candidates.size() > listSize) {
+        candidates.pop_back();
+    }
+}
+
+static void addResult(max_node_priority_queue_t& results, common::offset_t offset, double distance,
+    uint64_t numResults) {
+    if (results.size() < numResults || distance < results.top().distance) {
+        if (results.size() == numResults) {
+            results.pop();
+        }
+        results.push({offset, distance});
+    }
+}
+
+std::shared_ptr<common::BufferWriter> DiskANNStorageInfo::serialize() const {
+    auto bufferWriter = std::make_shared<common::BufferWriter>();
+    auto serializer = common::Serializer(bufferWriter);
+    serializer.write<common::offset_t>(numIndexedNodes);
+    serializer.write<common::offset_t>(entryPoint);
+    serializer.write<common::page_idx_t>(pageRange.startPageIdx);
+    serializer.write<common::page_idx_t>(pageRange.numPages);
+    return bufferWriter;
+}
+
+std::unique_ptr<IndexStorageInfo> DiskANNStorageInfo::deserialize(
+    std::unique_ptr<common::BufferReader> reader) {
+    common::offset_t numIndexedNodes = 0;
+    common::offset_t entryPoint = common::INVALID_OFFSET;
+    PageRange pageRange;
+    common::Deserializer deSer{std::move(reader)};
+    deSer.deserializeValue<common::offset_t>(numIndexedNodes);
+    deSer.deserializeValue<common::offset_t>(entryPoint);
+    deSer.deserializeValue<common::page_idx_t>(pageRange.startPageIdx);
+    deSer.deserializeValue<common::page_idx_t>(pageRange.numPages);
+    return std::make_unique<DiskANNStorageInfo>(numIndexedNodes, entryPoint, pageRange);
+}
+
+DiskANNIndexBuilder::DiskANNIndexBuilder(main::ClientContext* context, NodeTable& nodeTable,
+    common::column_id_t columnID, common::offset_t numNodes, DiskANNIndexConfig config)
+    : context{context}, config{std::move(config)}, typeInfo{getArrayTypeInfo(nodeTable, columnID)},
+      metricFunc{HNSWIndexUtils::getMetricsFunction(this->config.metric, typeInfo.getChildType())},
+      layout{numNodes, typeInfo.getNumElements(), getElementSize(typeInfo),
+          static_cast<uint64_t>(this->config.degree)},
+      quantizer{typeInfo.getNumElements(), typeInfo.getChildType().getLogicalTypeID(),
+          this->config.metric},
+      epoch{0} {
+    if (numNodes >= DiskANNFileLayout::NO_VECTOR) {
+        throw common::RuntimeException{common::stringFormat(
+            "DiskANN indexes support at most {} nodes.", DiskANNFileLayout::NO_VECTOR - 1)};
+    }
+    loadVectors(nodeTable, columnID);
+}
+
+void DiskANNIndexBuilder::loadVectors(NodeTable& nodeTable, common::column_id_t columnID) {
+    OnDiskEmbeddings embeddings{Transaction::Get(*context), MemoryManager::Get(*context),
+        getArrayTypeInfo(nodeTable, columnID), nodeTable, columnID};
+    auto scanState = embeddings.constructScanState();
+    const auto vectorSize = layout.getVectorSize();
+    vectors.resize(layout.numNodes * vectorSize);
+    hasVector.resize(layout.numNodes, false);
+    std::vector<common::offset_t> offsets;
+    for (auto startOffset = 0u; startOffset < layout.numNodes;
+         startOffset += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto endOffset =
+            std::min<common::offset_t>(startOffset + common::DEFAULT_VECTOR_CAPACITY,
+                layout.numNodes);
+        offsets.resize(endOffset - startOffset);
+        std::iota(offsets.begin(), offsets.end(), startOffset);
+        const auto batch = embeddings.getEmbeddings(offsets, *scanState);
+        KU_ASSERT(batch.size() <= offsets.size());
+        for (auto i = 0u; i < batch.size(); i++) {
+            if (batch[i].isNull()) {
+                continue; // Skip null or deleted values.
+            }
+            memcpy(vectors.data() + offsets[i] * vectorSize, batch[i].getPtr(), vectorSize);
+            hasVector[offsets[i]] = true;
+            quantizer.updateRanges(batch[i].getPtr());
+        }
+    }
+    quantizer.finalizeRanges();
+}
+
+// The entry point is the node closest to the centroid of all vectors.
+common::offset_t DiskANNIndexBuilder::computeMedoid() const {
+    auto medoid = common::INVALID_OFFSET;
+    common::TypeUtils::visit(
+        typeInfo.getChildType(),
+        [&]<VectorElementType T>(T) {
+            std::vector<double> centroid(layout.dimension, 0);
+            uint64_t numVectors = 0;
+            for (auto offset = 0u; offset < layout.numNodes; offset++) {
+                if (!hasVector[offset]) {
+                    continue;
+                }
+                const auto* values = static_cast<const T*>(getVector(offset));
+                for (auto i = 0u; i < layout.dimension; i++) {
+                    centroid[i] += values[i];
+                }
+                numVectors++;
+            }
+            if (numVectors == 0) {
+                return;
+            }
+            for (auto& value : centroid) {
+                value /= numVectors;
+            }
+            auto minDistance = std::numeric_limits<double>::max();
+            for (auto offset = 0u; offset < layout.numNodes; offset++) {
+                if (!hasVector[offset]) {
+                    continue;
+                }
+                const auto* values = static_cast<const T*>(getVector(offset));
+                double distance = 0;
+                for (auto i = 0u; i < layout.dimension; i++) {
+                    const auto diff = values[i] - centroid[i];
+                    distance += diff * diff;
+                }
+                if (distance < minDistance) {
+                    minDistance = distance;
+                    medoid = offset;
+                }
+            }
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    return medoid;
+}
+
+void DiskANNIndexBuilder::initRandomGraph() {
+    std::vector<common::offset_t> nodes;
+    for (auto offset = 0u; offset < layout.numNodes; offset++) {
+        if (hasVector[offset]) {
+            nodes.push_back(offset);
+        }
+    }
+    KU_ASSERT(!nodes.empty());
+    const auto numInitialNbrs = std::min<uint64_t>(layout.degree, nodes.size() - 1);
+    nbrs.resize(layout.numNodes);
+    for (const auto offset : nodes) {
+        auto& nodeNbrs = nbrs[offset];
+        nodeNbrs.reserve(layout.degree);
+        while (nodeNbrs.size() < numInitialNbrs) {
+            const auto nbr = nodes[randomEngine.nextRandomInteger(nodes.size())];
+            if (nbr != offset && std::ranges::find(nodeNbrs, nbr) == nodeNbrs.end()) {
+                nodeNbrs.push_back(nbr);
+            }
+        }
+    }
+    visitedEpochs.resize(layout.numNodes, 0);
+}
+
+std::vector<common::offset_t> DiskANNIndexBuilder::greedySearch(common::offset_t offset,
+    common::offset_t entryPoint) {
+    if (++epoch == 0) {
+        std::ranges::fill(visitedEpochs, 0);
+        epoch = 1;
+    }
+    const auto listSize = static_cast<uint64_t>(config.buildListSize);
+    std::vector<SearchCandidate> candidates;
+    candidates.push_back({entryPoint, computeDistance(offset, entryPoint), false});
+    visitedEpochs[entryPoint] = epoch;
+    std::vector<common::offset_t> expandedNodes;
+    while (true) {
+        auto candidate = std::ranges::find(candidates, false, &SearchCandidate::expanded);
+        if (candidate == candidates.end()) {
+            break;
+        }
+        candidate->expanded = true;
+        const auto node = candidate->offset;
+        expandedNodes.push_back(node);
+        for (const auto nbr : nbrs[node]) {
+            if (visitedEpochs[nbr] == epoch) {
+                continue;
+            }
+            visitedEpochs[nbr] = epoch;
+            insertCandidate(candidates, {nbr, computeDistance(offset, nbr), false}, listSize);
+        }
+    }
+    return expandedNodes;
+}
+
+void DiskANNIndexBuilder::robustPrune(common::offset_t offset,
+    std::vector<common::offset_t> candidates, double alpha) {
+    auto& nodeNbrs = nbrs[offset];
+    candidates.insert(candidates.end(), nodeNbrs.begin(), nodeNbrs.end());
+    std::vector<NodeWithDistance> pool;
+    pool.reserve(candidates.size());
+    for (const auto candidate : candidates) {
+        if (candidate != offset && hasVector[candidate]) {
+            pool.emplace_back(candidate, computeDistance(offset, candidate));
+        }
+    }
+    std::ranges::sort(pool, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance || (l.distance == r.distance && l.nodeOffset < r.nodeOffset);
+    });
+    const auto duplicates = std::ranges::unique(pool, {}, &NodeWithDistance::nodeOffset);
+    pool.erase(duplicates.begin(), duplicates.end());
+    nodeNbrs.clear();
+    std::vector<bool> pruned(pool.size(), false);
+    for (auto i = 0u; i < pool.size() && nodeNbrs.size() < layout.degree; i++) {
+        if (pruned[i]) {
+            continue;
+        }
+        nodeNbrs.push_back(pool[i].nodeOffset);
+        for (auto j = i + 1; j < pool.size(); j++) {
+            if (!pruned[j] &&
+                alpha * computeDistance(pool[i].nodeOffset, pool[j].nodeOffset) <=
+                    pool[j].distance) {
+                pruned[j] = true;
+            }
+        }
+    }
+}
+
+void DiskANNIndexBuilder::insertBackEdges(common::offset_t offset, double alpha) {
+    const auto nodeNbrs = nbrs[offset];
+    for (const auto nbr : nodeNbrs) {
+        auto& nbrNbrs = nbrs[nbr];
+        if (std::ranges::find(nbrNbrs, offset) != nbrNbrs.end()) {
+            continue;
+        }
+        if (nbrNbrs.size() < layout.degree) {
+            nbrNbrs.push_back(offset);
+        } else {
+            robustPrune(nbr, {offset}, alpha);
+        }
+    }
+}
+
+std::unique_ptr<DiskANNStorageInfo> DiskANNIndexBuilder::build(PageAllocator& pageAllocator) {
+    const auto entryPoint = computeMedoid();
+    if (entryPoint != common::INVALID_OFFSET) {
+        initRandomGraph();
+        std::vector<common::offset_t> order;
+        for (auto offset = 0u; offset < layout.numNodes; offset++) {
+            if (hasVector[offset]) {
+                order.push_back(offset);
+            }
+        }
+        for (auto i = order.size(); i > 1; i--) {
+            std::swap(order[i - 1], order[randomEngine.nextRandomInteger(i)]);
+        }
+        // The first pass only keeps short edges, the second one adds the long range edges that
+        // keep the number of hops of searches low.
+        for (const auto alpha : {1.0, config.alpha}) {
+            for (const auto offset : order) {
+                auto candidates = greedySearch(offset, entryPoint);
+                robustPrune(offset, std::move(candidates), alpha);
+                insertBackEdges(offset, alpha);
+            }
+        }
+    }
+    const auto pageRange = pageAllocator.allocatePageRange(layout.getNumPages());
+    writePages(*pageAllocator.getDataFH(), pageRange.startPageIdx, entryPoint);
+    return std::make_unique<DiskANNStorageInfo>(layout.numNodes, entryPoint, pageRange);
+}
+
+void DiskANNIndexBuilder::writePages(FileHandle& dataFH, common::page_idx_t startPageIdx,
+    common::offset_t entryPoint) const {
+    const auto pagesOffset = startPageIdx * DiskANNFileLayout::SECTOR_SIZE;
+    auto* fileInfo = dataFH.getFileInfo();
+    const auto dimension = layout.dimension;
+    // Header.
+    std::vector<uint8_t> buffer(layout.getHeaderSize(), 0);
+    const DiskANNFileHeader header{DiskANNFileHeader::MAGIC, DiskANNFileHeader::VERSION,
+        layout.numNodes, dimension, layout.elementSize, layout.degree, entryPoint};
+    memcpy(buffer.data(), &header, sizeof(DiskANNFileHeader));
+    auto* ranges = buffer.data() + sizeof(DiskANNFileHeader);
+    memcpy(ranges, quantizer.getMins().data(), dimension * sizeof(float));
+    memcpy(ranges + dimension * sizeof(float), quantizer.getMaxs().data(),
+        dimension * sizeof(float));
+    fileInfo->writeFile(buffer.data(), buffer.size(), pagesOffset);
+    // Quantized codes.
+    const auto numNodesPerCodesChunk = std::max<uint64_t>(WRITE_CHUNK_SIZE / dimension, 1);
+    for (auto startOffset = 0u; startOffset < layout.numNodes;
+         startOffset += numNodesPerCodesChunk) {
+        const auto endOffset =
+            std::min<common::offset_t>(startOffset + numNodesPerCodesChunk, layout.numNodes);
+        buffer.assign((endOffset - startOffset) * dimension, 0);
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            if (hasVector[offset]) {
+                quantizer.encode(getVector(offset),
+                    buffer.data() + (offset - startOffset) * dimension);
+            }
+        }
+        fileInfo->writeFile(buffer.data(), buffer.size(),
+            pagesOffset + layout.getCodesOffset() + startOffset * dimension);
+    }
+    // Records.
+    const auto readSize = layout.getRecordReadSize();
+    const auto numNodesPerRecordsChunk =
+        std::max<uint64_t>(WRITE_CHUNK_SIZE / readSize, 1) * layout.getNumRecordsPerSector();
+    for (auto startOffset = 0u; startOffset < layout.numNodes;
+         startOffset += numNodesPerRecordsChunk) {
+        const auto endOffset =
+            std::min<common::offset_t>(startOffset + numNodesPerRecordsChunk, layout.numNodes);
+        const auto chunkStart = layout.getRecordReadOffset(startOffset);
+        buffer.assign(layout.getRecordReadOffset(endOffset - 1) + readSize - chunkStart, 0);
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            auto* record = buffer.data() + layout.getRecordReadOffset(offset) - chunkStart +
+                           layout.getOffsetInRecordRead(offset);
+            const uint32_t numNbrs =
+                hasVector[offset] ? nbrs[offset].size() : DiskANNFileLayout::NO_VECTOR;
+            memcpy(record, &numNbrs, sizeof(uint32_t));
+            if (!hasVector[offset]) {
+                continue;
+            }
+            memcpy(record + sizeof(uint32_t), nbrs[offset].data(),
+                nbrs[offset].size() * sizeof(uint32_t));
+            memcpy(record + layout.getVectorOffsetInRecord(), getVector(offset),
+                layout.getVectorSize());
+        }
+        fileInfo->writeFile(buffer.data(), buffer.size(), pagesOffset + chunkStart);
+    }
+}
+
+OnDiskDiskANNIndex::OnDiskDiskANNIndex(main::ClientContext* context, IndexInfo indexInfo,
+    std::unique_ptr<IndexStorageInfo> storageInfo, DiskANNIndexConfig config)
+    : Index{std::move(indexInfo), std::move(storageInfo)}, config{std::move(config)},
+      typeInfo{getArrayTypeInfo(getNodeTable(*context, this->indexInfo.tableID),
+          this->indexInfo.columnIDs[0])},
+      metricFunc{HNSWIndexUtils::getMetricsFunction(this->config.metric, typeInfo.getChildType())},
+      nodeTable{getNodeTable(*context, this->indexInfo.tableID)},
+      layout{this->storageInfo->constCast<DiskANNStorageInfo>().numIndexedNodes,
+          typeInfo.getNumElements(), getElementSize(typeInfo),
+          static_cast<uint64_t>(this->config.degree)},
+      fileInfo{StorageManager::Get(*context)->getDataFH()->getFileInfo()},
+      startOffset{this->storageInfo->constCast<DiskANNStorageInfo>().pageRange.startPageIdx *
+                  DiskANNFileLayout::SECTOR_SIZE},
+      quantizer{typeInfo.getNumElements(), typeInfo.getChildType().getLogicalTypeID(),
+          this->config.metric} {
+    const auto& pageRange = this->storageInfo->constCast<DiskANNStorageInfo>().pageRange;
+    if (pageRange.numPages < layout.getNumPages()) {
+        // LCOV_EXCL_START
+        throw common::RuntimeException{
+            common::stringFormat("DiskANN index {} is truncated.", this->indexInfo.name)};
+        // LCOV_EXCL_STOP
+    }
+    const auto dimension = layout.dimension;
+    std::vector<uint8_t> buffer(layout.getHeaderSize());
+    fileInfo->readFromFile(buffer.data(), buffer.size(), startOffset);
+    DiskANNFileHeader header{};
+    memcpy(&header, buffer.data(), sizeof(DiskANNFileHeader));
+    if (header.magic != DiskANNFileHeader::MAGIC || header.version != DiskANNFileHeader::VERSION ||
+        header.numNodes != layout.numNodes || header.dimension != dimension ||
+        header.elementSize != layout.elementSize || header.degree != layout.degree ||
+        header.entryPoint != this->storageInfo->constCast<DiskANNStorageInfo>().entryPoint) {
+        // LCOV_EXCL_START
+        throw common::RuntimeException{common::stringFormat(
+            "DiskANN index {} does not match its pages in the data file.", this->indexInfo.name)};
+        // LCOV_EXCL_STOP
+    }
+    std::vector<float> mins(dimension);
+    std::vector<float> maxs(dimension);
+    const auto* ranges = buffer.data() + sizeof(DiskANNFileHeader);
+    memcpy(mins.data(), ranges, dimension * sizeof(float));
+    memcpy(maxs.data(), ranges + dimension * sizeof(float), dimension * sizeof(float));
+    quantizer.setRanges(std::move(mins), std::move(maxs));
+    codes.resize(layout.numNodes * dimension);
+    if (!codes.empty()) {
+        fileInfo->readFromFile(codes.data(), codes.size(), startOffset + layout.getCodesOffset());
+    }
+}
+
+std::unique_ptr<Index> OnDiskDiskANNIndex::load(main::ClientContext* context, StorageManager*,
+    IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+    auto reader =
+        std::make_unique<common::BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size());
+    auto storageInfo = DiskANNStorageInfo::deserialize(std::move(reader));
+    const auto catalog = catalog::Catalog::Get(*context);
+    const auto transaction = Transaction::Get(*context);
+    const auto indexEntry = catalog->getIndex(transaction, indexInfo.tableID, indexInfo.name);
+    const auto auxInfo = indexEntry->getAuxInfo().cast<DiskANNIndexAuxInfo>();
+    return std::make_unique<OnDiskDiskANNIndex>(context, std::move(indexInfo),
+        std::move(storageInfo), auxInfo.config.copy());
+}
+
+std::unique_ptr<Index::UpdateState> OnDiskDiskANNIndex::initUpdateState(
+    main::ClientContext* context, common::column_id_t columnID, visible_func) {
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        Transaction::Get(*context), indexInfo.tableID);
+    std::string propertyName;
+    for (const auto& property : tableEntry->getProperties()) {
+        if (tableEntry->getColumnID(property.getName()) == columnID) {
+            propertyName = property.getName();
+        }
+    }
+    throw common::RuntimeException{
+        common::stringFormat("Cannot set property {} in table {} because it is used in one or more "
+                             "indexes. Try delete and then insert.",
+            propertyName, tableEntry->getName())};
+}
+
+void OnDiskDiskANNIndex::reclaimStorage(PageAllocator& pageAllocator) const {
+    pageAllocator.freePageRange(storageInfo->constCast<DiskANNStorageInfo>().pageRange);
+}
+
+std::vector<NodeWithDistance> OnDiskDiskANNIndex::search(Transaction* transaction,
+    const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
+    const auto indexedResult = shouldBruteForce(searchState) ?
+                                   bruteForceSearch(queryVector, searchState) :
+                                   beamSearch(queryVector, searchState);
+    // The index pages are never updated, so deleted nodes are only filtered out here.
+    std::vector<NodeWithDistance> result;
+    result.reserve(searchState.k);
+    for (const auto& node : indexedResult) {
+        if (result.size() == searchState.k) {
+            break;
+        }
+        if (nodeTable.isVisible(transaction, node.nodeOffset)) {
+            result.push_back(node);
+        }
+    }
+    searchFromUnIndexed(transaction, queryVector, searchState, result);
+    if (result.size() > searchState.k) {
+        result.resize(searchState.k);
+    }
+    return result;
+}
+
+bool OnDiskDiskANNIndex::shouldBruteForce(const HNSWSearchState& searchState) const {
+    if (!searchState.hasMask()) {
+        return false;
+    }
+    if (layout.numNodes == 0) {
+        return true;
+    }
+    const auto numMaskedNodes = searchState.semiMask->getNumMaskedNodes();
+    const auto selectivity = 1.0 * numMaskedNodes / layout.numNodes;
+    return numMaskedNodes <= searchState.ef ||
+           selectivity < searchState.config.bruteForceSearchUpSelThreshold;
+}
+
+std::vector<OnDiskDiskANNIndex::NodeRecord> OnDiskDiskANNIndex::readRecords(
+    std::span<const common::offset_t> offsets, std::vector<uint8_t>& buffer) const {
+    const auto readSize = layout.getRecordReadSize();
+    buffer.resize(offsets.size() * readSize);
+    std::vector<common::FileReadRequest> requests;
+    requests.reserve(offsets.size());
+    for (auto i = 0u; i < offsets.size(); i++) {
+        KU_ASSERT(offsets[i] < layout.numNodes);
+        requests.push_back({buffer.data() + i * readSize, readSize,
+            startOffset + layout.getRecordReadOffset(offsets[i])});
+    }
+    fileInfo->readFiles(requests);
+    std::vector<NodeRecord> records;
+    records.reserve(offsets.size());
+    for (auto i = 0u; i < offsets.size(); i++) {
+        const auto* record =
+            buffer.data() + i * readSize + layout.getOffsetInRecordRead(offsets[i]);
+        uint32_t numNbrs = 0;
+        memcpy(&numNbrs, record, sizeof(uint32_t));
+        if (numNbrs == DiskANNFileLayout::NO_VECTOR) {
+            records.push_back({{}, nullptr});
+            continue;
+        }
+        KU_ASSERT(numNbrs <= layout.degree);
+        records.push_back(
+            {std::span{reinterpret_cast<const uint32_t*>(record + sizeof(uint32_t)), numNbrs},
+                record + layout.getVectorOffsetInRecord()});
+    }
+    return records;
+}
+
+std::vector<NodeWithDistance> OnDiskDiskANNIndex::beamSearch(const EmbeddingHandle& queryVector,
+    HNSWSearchState& searchState) const {
+    const auto entryPoint = storageInfo->constCast<DiskANNStorageInfo>().entryPoint;
+    if (entryPoint == common::INVALID_OFFSET) {
+        return {};
+    }
+    if (searchState.visited.size < layout.numNodes) {
+        searchState.visited = VisitedState{layout.numNodes};
+    } else {
+        searchState.visited.reset();
+    }
+    const auto listSize = searchState.ef;
+    const auto dimension = layout.dimension;
+    const auto preparedQuery = quantizer.prepareQuery(queryVector.getPtr());
+    auto getApproximateDistance = [&](common::offset_t offset) {
+        return quantizer.computeDistance(preparedQuery, codes.data() + offset * dimension);
+    };
+    std::vector<SearchCandidate> candidates;
+    candidates.push_back({entryPoint, getApproximateDistance(entryPoint), false});
+    searchState.visited.add(entryPoint);
+    max_node_priority_queue_t results;
+    std::vector<common::offset_t> beam;
+    std::vector<uint8_t> buffer;
+    while (true) {
+        beam.clear();
+        for (auto& candidate : candidates) {
+            if (beam.size() == static_cast<uint64_t>(searchState.config.beamWidth)) {
+                break;
+            }
+            if (!candidate.expanded) {
+                candidate.expanded = true;
+                beam.push_back(candidate.offset);
+            }
+        }
+        if (beam.empty()) {
+            break;
+        }
+        const auto records = readRecords(beam, buffer);
+        for (auto i = 0u; i < beam.size(); i++) {
+            const auto& record = records[i];
+            if (!record.hasVector()) {
+                continue;
+            }
+            if (searchState.isMasked(beam[i])) {
+                addResult(results, beam[i],
+                    metricFunc(queryVector.getPtr(), record.vector, dimension), listSize);
+            }
+            for (const auto nbr : record.nbrs) {
+                if (searchState.visited.contains(nbr)) {
+                    continue;
+                }
+                searchState.visited.add(nbr);
+                insertCandidate(candidates, {nbr, getApproximateDistance(nbr), false}, listSize);
+            }
+        }
+    }
+    return HNSWIndex::popTopK(results, listSize);
+}
+
+std::vector<NodeWithDistance> OnDiskDiskANNIndex::bruteForceSearch(
+    const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
+    KU_ASSERT(searchState.hasMask());
+    const auto numMaskedNodes = searchState.semiMask->getNumMaskedNodes();
+    auto offsets = searchState.semiMask->collectMaskedNodes(numMaskedNodes);
+    std::erase_if(offsets, [&](common::offset_t offset) { return offset >= layout.numNodes; });
+    // Keep more than k results, as some of them may be deleted.
+    const auto numResults = searchState.ef;
+    max_node_priority_queue_t results;
+    std::vector<uint8_t> buffer;
+    for (auto startIdx = 0u; startIdx < offsets.size(); startIdx += BRUTE_FORCE_READ_BATCH_SIZE) {
+        const auto endIdx =
+            std::min<uint64_t>(startIdx + BRUTE_FORCE_READ_BATCH_SIZE, offsets.size());
+        const auto batch = std::span{offsets}.subspan(startIdx, endIdx - startIdx);
+        const auto records = readRecords(batch, buffer);
+        for (auto i = 0u; i < batch.size(); i++) {
+            if (records[i].hasVector()) {
+                addResult(results, batch[i],
+                    metricFunc(queryVector.getPtr(), records[i].vector, layout.dimension),
+                    numResults);
+            }
+        }
+    }
+    return HNSWIndex::popTopK(results, numResults);
+}
+
+void OnDiskDiskANNIndex::searchFromUnIndexed(Transaction* transaction,
+    const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
+    std::vector<NodeWithDistance>& result) const {
+    const auto numTotalRows = nodeTable.getNumTotalRows(transaction);
+    if (numTotalRows <= layout.numNodes) {
+        return;
+    }
+    std::vector<common::offset_t> offsets;
+    for (auto offset = layout.numNodes; offset < numTotalRows; offset++) {
+        if (searchState.isMasked(offset)) {
+            offsets.push_back(offset);
+        }
+    }
+    for (auto startIdx = 0u; startIdx < offsets.size();
+         startIdx += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto endIdx =
+            std::min<uint64_t>(startIdx + common::DEFAULT_VECTOR_CAPACITY, offsets.size());
+        const auto batch = std::span{offsets}.subspan(startIdx, endIdx - startIdx);
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(batch, searchState.embeddingScanState);
+        KU_ASSERT(vectors.size() <= batch.size());
+        for (auto i = 0u; i < vectors.size(); i++) {
+            if (vectors[i].isNull()) {
+                continue; // Skip null or deleted values.
+            }
+            result.emplace_back(batch[i],
+                metricFunc(queryVector.getPtr(), vectors[i].getPtr(), layout.dimension));
+        }
+    }
+    std::ranges::sort(result, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance;
+    });
+}
+
+} // namespace vector_extension
+} // namespace kuzu
@@ -13,6 +13,8 @@ namespace vector_extension {
 // The maximum allowed degree to be defined by users.
 static constexpr int64_t MAX_DEGREE =
     static_cast<int64_t>(std::numeric_limits<int16_t>::max() / DEFAULT_DEGREE_THRESHOLD_RATIO);
+// The maximum number of reads submitted at once by a DiskANN query.
+static constexpr int64_t MAX_BEAM_WIDTH = 64;
 
 void Mu::validate(int64_t value) {
     if (value < 1 || value > MAX_DEGREE) {
@@ -48,6 +50,13 @@ void Metric::validate(const std::string& metric) {
     }
 }
 
+void Quantization::validate(const std::string& quantization) {
+    const auto lowerCaseQuantization = common::StringUtils::getLower(quantization);
+    if (lowerCaseQuantization != "none" && lowerCaseQuantization != "sq8") {
+        throw common::BinderException{"Quantization must be one of NONE or SQ8."};
+    }
+}
+
 void Efc::validate(int64_t value) {
     if (value < 1) {
         throw common::BinderException{"Efc must be a positive integer."};
@@ -80,6 +89,20 @@ void DirectedSearchUpSelThreshold::validate(double value) {
     }
 }
 
+void BruteForceSearchUpSelThreshold::validate(double value) {
+    if (value < 0 || value > 1) {
+        throw common::BinderException{
+            "Brute force search upper selectivity threshold must be a double between 0 and 1."};
+    }
+}
+
+void BeamWidth::validate(int64_t value) {
+    if (value < 1 || value > MAX_BEAM_WIDTH) {
+        throw common::BinderException{common::stringFormat(
+            "Beam width must be a positive integer between 1 and {}.", MAX_BEAM_WIDTH)};
+    }
+}
+
 HNSWIndexConfig::HNSWIndexConfig(const function::optional_params_t& optionalParams) {
     for (auto& [name, value] : optionalParams) {
         auto lowerCaseName = common::StringUtils::getLower(name);
@@ -111,6 +134,11 @@ HNSWIndexConfig::HNSWIndexConfig(const function::optional_params_t& optionalPara
         } else if (CacheEmbeddings::NAME == lowerCaseName) {
             value.validateType(CacheEmbeddings::TYPE);
             cacheEmbeddingsColumn = value.getValue<bool>();
+        } else if (Quantization::NAME == lowerCaseName) {
+            value.validateType(Quantization::TYPE);
+            auto quantizationName = value.getValue<std::string>();
+            Quantization::validate(quantizationName);
+            quantization = getQuantizationType(quantizationName);
         } else if (SkipIfExists::NAME == lowerCaseName) {
             value.validateType(SkipIfExists::TYPE);
             conflictAction = value.getValue<bool>() ?
@@ -145,6 +173,21 @@ std::string HNSWIndexConfig::metricToString(MetricType metric) {
     }
 }
 
+std::string HNSWIndexConfig::quantizationToString(QuantizationType quantization) {
+    switch (quantization) {
+    case QuantizationType::NONE: {
+        return "none";
+    }
+    case QuantizationType::SQ8: {
+        return "sq8";
+    }
+    default: {
+        throw common::RuntimeException(common::stringFormat("Unknown quantization type {}.",
+            static_cast<int64_t>(quantization)));
+    }
+    }
+}
+
 void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.writeDebuggingInfo("degreeInUpperLayer");
     ser.serializeValue(mu);
@@ -156,6 +199,8 @@ void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.serializeValue(alpha);
     ser.writeDebuggingInfo("efc");
     ser.serializeValue(efc);
+    ser.writeDebuggingInfo("quantization");
+    ser.serializeValue<uint8_t>(static_cast<uint8_t>(quantization));
 }
 
 HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
@@ -173,6 +218,13 @@ HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
     deSer.deserializeValue(config.alpha);
     deSer.validateDebuggingInfo(debuggingInfo, "efc");
     deSer.deserializeValue(config.efc);
+    // Indexes created before quantization was supported end here.
+    if (!deSer.finished()) {
+        deSer.validateDebuggingInfo(debuggingInfo, "quantization");
+        uint8_t quantization = 0;
+        deSer.deserializeValue(quantization);
+        config.quantization = static_cast<QuantizationType>(quantization);
+    }
     return config;
 }
 
@@ -193,6 +245,17 @@ MetricType HNSWIndexConfig::getMetricType(const std::string& metricName) {
     KU_UNREACHABLE;
 }
 
+QuantizationType HNSWIndexConfig::getQuantizationType(const std::string& quantizationName) {
+    const auto lowerQuantizationName = common::StringUtils::getLower(quantizationName);
+    if (lowerQuantizationName == "none") {
+        return QuantizationType::NONE;
+    }
+    if (lowerQuantizationName == "sq8") {
+        return QuantizationType::SQ8;
+    }
+    KU_UNREACHABLE;
+}
+
 DropHNSWConfig::DropHNSWConfig(const function::optional_params_t& optionalParams) {
     for (auto& [name, value] : optionalParams) {
         auto lowerCaseName = common::StringUtils::getLower(name);
@@ -223,6 +286,19 @@ QueryHNSWConfig::QueryHNSWConfig(const function::optional_params_t& optionalPara
             value.validateType(DirectedSearchUpSelThreshold::TYPE);
             directedSearchUpSelThreshold = value.getValue<double>();
             DirectedSearchUpSelThreshold::validate(directedSearchUpSelThreshold);
+        } else if (BruteForceSearchUpSelThreshold::NAME == lowerCaseName) {
+            value.validateType(BruteForceSearchUpSelThreshold::TYPE);
+            bruteForceSearchUpSelThreshold = value.getValue<double>();
+            BruteForceSearchUpSelThreshold::validate(bruteForceSearchUpSelThreshold);
+        } else if (FilterNodes::NAME == lowerCaseName) {
+            // Bound with the query function, see bindQueryHNSWIndex().
+        } else if (Rerank::NAME == lowerCaseName) {
+            value.validateType(Rerank::TYPE);
+            rerank = value.getValue<bool>();
+        } else if (BeamWidth::NAME == lowerCaseName) {
+            value.validateType(BeamWidth::TYPE);
+            beamWidth = value.getValue<int64_t>();
+            BeamWidth::validate(beamWidth);
         } else {
             throw common::BinderException{common::stringFormat(
                 "Unrecognized optional parameter {} in {}.", name, QueryVectorIndexFunction::name)};
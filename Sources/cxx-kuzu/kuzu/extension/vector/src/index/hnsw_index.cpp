@@ -116,6 +116,17 @@ static void processEntryNodeInKNNSearch(const EmbeddingHandle& queryVector,
     visited.add(entryNode);
 }
 
+static void pushNbrNodeInKNNSearch(common::offset_t nbrOffset, double dist, uint64_t ef,
+    min_node_priority_queue_t& candidates, max_node_priority_queue_t& result) {
+    if (result.size() < ef || dist < result.top().distance) {
+        if (result.size() >= ef) {
+            result.pop();
+        }
+        result.push({nbrOffset, dist});
+        candidates.push({nbrOffset, dist});
+    }
+}
+
 static void processNbrNodeInKNNSearch(const EmbeddingHandle& queryVector,
     const EmbeddingHandle& nbrVector, common::offset_t nbrOffset, uint64_t ef,
     VisitedState& visited, const metric_func_t& metricFunc, uint64_t dimension,
@@ -125,13 +136,7 @@ static void processNbrNodeInKNNSearch(const EmbeddingHandle& queryVector,
         return;
     }
     auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(), dimension);
-    if (result.size() < ef || dist < result.top().distance) {
-        if (result.size() >= ef) {
-            result.pop();
-        }
-        result.push({nbrOffset, dist});
-        candidates.push({nbrOffset, dist});
-    }
+    pushNbrNodeInKNNSearch(nbrOffset, dist, ef, candidates, result);
 }
 
 std::vector<NodeWithDistance> InMemHNSWLayer::searchKNN(const EmbeddingHandle& queryVector,
@@ -377,6 +382,34 @@ void InMemHNSWIndex::finalizeNodeGroup(common::node_group_idx_t nodeGroupIdx) {
         *scanState);
 }
 
+EmbeddingCache::EmbeddingCache(uint64_t embeddingSize)
+    : embeddingSize{embeddingSize},
+      capacity{std::max<uint64_t>(1, MAX_MEMORY_USAGE / embeddingSize)} {
+    // Reserved up front so that returned pointers are not invalidated by reallocations.
+    data.reserve(capacity * embeddingSize);
+}
+
+const void* EmbeddingCache::getEmbedding(common::offset_t offset,
+    const HNSWIndexEmbeddings& embeddings, GetEmbeddingsScanState& scanState) {
+    if (const auto it = positions.find(offset); it != positions.end()) {
+        return it->second == common::INVALID_OFFSET ? nullptr : data.data() + it->second;
+    }
+    if (positions.size() >= capacity) {
+        positions.clear();
+        data.clear();
+    }
+    const auto embedding = embeddings.getEmbedding(offset, scanState);
+    if (embedding.isNull()) {
+        positions.emplace(offset, common::INVALID_OFFSET);
+        return nullptr;
+    }
+    const auto position = data.size();
+    const auto* ptr = static_cast<const uint8_t*>(embedding.getPtr());
+    data.insert(data.end(), ptr, ptr + embeddingSize);
+    positions.emplace(offset, position);
+    return data.data() + position;
+}
+
 std::shared_ptr<common::BufferWriter> HNSWStorageInfo::serialize() const {
     auto bufferWriter = std::make_shared<common::BufferWriter>();
     auto serializer = common::Serializer(bufferWriter);
@@ -418,6 +451,10 @@ HNSWSearchState::HNSWSearchState(main::ClientContext* context,
       lowerRelTableEntry{lowerRelTableEntry}, searchType{SearchType::UNFILTERED},
       nbrScanState{nullptr}, secondHopNbrScanState{nullptr} {
     ef = std::max(k, static_cast<uint64_t>(config.efs));
+    if (upperRelTableEntry == nullptr || lowerRelTableEntry == nullptr) {
+        // DiskANN indexes keep their graph in the index file.
+        return;
+    }
     graph::NativeGraphEntry lowerGraphEntry{{nodeTableEntry}, {lowerRelTableEntry}};
     lowerGraph = std::make_unique<graph::OnDiskGraph>(context, std::move(lowerGraphEntry));
     graph::NativeGraphEntry upperGraphEntry{{nodeTableEntry}, {upperRelTableEntry}};
@@ -482,12 +519,207 @@ std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context, Stora
 
 std::vector<NodeWithDistance> OnDiskHNSWIndex::search(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
+    if (getFilteredSearchType(transaction, searchState) == SearchType::BRUTE_FORCE) {
+        return bruteForceSearch(transaction, queryVector, searchState);
+    }
+    std::shared_lock lck{quantizedEmbeddingsMtx, std::defer_lock};
+    if (config.quantization != QuantizationType::NONE) {
+        initQuantizedEmbeddings(transaction);
+    }
+    if (quantizedEmbeddingsReady.load(std::memory_order_acquire)) {
+        lck.lock();
+        searchState.quantizedSearch = QuantizedSearchState{transaction, quantizedEmbeddings.get(),
+            quantizedEmbeddings->getQuantizer().prepareQuery(queryVector.getPtr())};
+    }
     auto result = searchFromCheckpointed(transaction, queryVector, searchState);
+    if (searchState.quantizedSearch.has_value() && searchState.config.rerank) {
+        rerank(queryVector, searchState, result);
+    }
+    searchState.quantizedSearch.reset();
     searchFromUnCheckpointed(transaction, queryVector, searchState, result);
     result.resize(searchState.k);
     return result;
 }
 
+void OnDiskHNSWIndex::initQuantizedEmbeddings(Transaction* transaction) const {
+    bool building = false;
+    if (quantizedEmbeddingsReady.load(std::memory_order_acquire) ||
+        !buildingQuantizedEmbeddings.compare_exchange_strong(building, true)) {
+        return;
+    }
+    try {
+        buildQuantizedEmbeddings(transaction);
+    } catch (...) {
+        // A later query builds the codes again.
+        {
+            std::unique_lock lck{quantizedEmbeddingsMtx};
+            quantizedEmbeddings.reset();
+        }
+        buildingQuantizedEmbeddings.store(false);
+        throw;
+    }
+    quantizedEmbeddingsReady.store(true, std::memory_order_release);
+}
+
+void OnDiskHNSWIndex::buildQuantizedEmbeddings(Transaction* transaction) const {
+    const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    const auto numNodes = hnswStorageInfo.numCheckpointedNodes;
+    OnDiskEmbeddings embeddings{transaction, mm,
+        common::ArrayTypeInfo{typeInfo.getChildType().copy(), typeInfo.getNumElements()},
+        nodeTable, indexInfo.columnIDs[0]};
+    const auto scanState = embeddings.constructScanState();
+    ScalarQuantizer quantizer{embeddings.getDimension(),
+        typeInfo.getChildType().getLogicalTypeID(), config.metric};
+    const auto sampleStride = std::max<common::offset_t>(1, numNodes / QUANTIZER_SAMPLE_SIZE);
+    for (common::offset_t offset = 0; offset < numNodes; offset += sampleStride) {
+        const auto vector = embeddings.getEmbedding(offset, *scanState);
+        if (!vector.isNull()) {
+            quantizer.updateRanges(vector.getPtr());
+        }
+    }
+    quantizer.finalizeRanges();
+    {
+        // From here on, commits write the codes of the nodes they insert.
+        std::unique_lock lck{quantizedEmbeddingsMtx};
+        quantizedEmbeddings = std::make_unique<QuantizedEmbeddings>(mm, std::move(quantizer));
+        quantizedEmbeddings->reserve(numNodes);
+    }
+    std::vector<common::offset_t> offsets;
+    for (common::offset_t startOffset = 0; startOffset < numNodes;
+         startOffset += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto endOffset =
+            std::min<common::offset_t>(startOffset + common::DEFAULT_VECTOR_CAPACITY, numNodes);
+        offsets.clear();
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            offsets.push_back(offset);
+        }
+        const auto vectors = embeddings.getEmbeddings(offsets, *scanState);
+        std::unique_lock lck{quantizedEmbeddingsMtx};
+        for (auto i = 0u; i < vectors.size(); i++) {
+            if (!vectors[i].isNull()) {
+                quantizedEmbeddings->setCode(offsets[i], vectors[i].getPtr());
+            }
+        }
+    }
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
+void OnDiskHNSWIndex::setQuantizedCode(common::offset_t offset, const EmbeddingHandle& vector) {
+    std::unique_lock lck{quantizedEmbeddingsMtx};
+    if (!quantizedEmbeddings) {
+        // Codes of all nodes are written when the quantized embeddings are built.
+        return;
+    }
+    if (vector.isNull()) {
+        quantizedEmbeddings->clearCode(offset);
+    } else {
+        quantizedEmbeddings->setCode(offset, vector.getPtr());
+    }
+}
+
+std::optional<double> OnDiskHNSWIndex::computeDistance(const EmbeddingHandle& queryVector,
+    common::offset_t offset, HNSWSearchState& searchState) const {
+    if (searchState.quantizedSearch.has_value()) {
+        const auto& quantizedSearch = *searchState.quantizedSearch;
+        if (!nodeTable.isVisibleNoLock(quantizedSearch.transaction, offset)) {
+            return std::nullopt;
+        }
+        if (quantizedSearch.embeddings->hasCode(offset)) {
+            return quantizedSearch.embeddings->getQuantizer().computeDistance(
+                quantizedSearch.query, quantizedSearch.embeddings->getCode(offset));
+        }
+    }
+    if (searchState.embeddingCache) {
+        const auto vector = searchState.embeddingCache->getEmbedding(offset,
+            *searchState.embeddings, searchState.embeddingScanState);
+        if (vector == nullptr) {
+            return std::nullopt;
+        }
+        return metricFunc(queryVector.getPtr(), vector, searchState.embeddings->getDimension());
+    }
+    const auto vector =
+        searchState.embeddings->getEmbedding(offset, searchState.embeddingScanState);
+    if (vector.isNull()) {
+        return std::nullopt;
+    }
+    return metricFunc(queryVector.getPtr(), vector.getPtr(),
+        searchState.embeddings->getDimension());
+}
+
+void OnDiskHNSWIndex::processNbrNode(const EmbeddingHandle& queryVector,
+    common::offset_t nbrOffset, uint64_t ef, HNSWSearchState& searchState,
+    min_node_priority_queue_t& candidates, max_node_priority_queue_t& results) const {
+    searchState.visited.add(nbrOffset);
+    const auto dist = computeDistance(queryVector, nbrOffset, searchState);
+    if (dist.has_value()) {
+        pushNbrNodeInKNNSearch(nbrOffset, *dist, ef, candidates, results);
+    }
+}
+
+void OnDiskHNSWIndex::rerank(const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
+    std::vector<NodeWithDistance>& result) const {
+    std::vector<common::offset_t> offsets;
+    for (auto startIdx = 0u; startIdx < result.size();
+         startIdx += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto endIdx =
+            std::min<uint64_t>(startIdx + common::DEFAULT_VECTOR_CAPACITY, result.size());
+        offsets.clear();
+        for (auto i = startIdx; i < endIdx; i++) {
+            offsets.push_back(result[i].nodeOffset);
+        }
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(offsets, searchState.embeddingScanState);
+        KU_ASSERT(vectors.size() <= offsets.size());
+        for (auto i = startIdx; i < endIdx; i++) {
+            // Nodes deleted at the end of the batch are not returned.
+            const auto idx = i - startIdx;
+            result[i].distance = idx >= vectors.size() || vectors[idx].isNull() ?
+                                     std::numeric_limits<double_t>::max() :
+                                     metricFunc(queryVector.getPtr(), vectors[idx].getPtr(),
+                                         searchState.embeddings->getDimension());
+        }
+    }
+    std::ranges::sort(result, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance;
+    });
+    if (result.size() > searchState.k) {
+        result.resize(searchState.k);
+    }
+}
+
+std::vector<NodeWithDistance> OnDiskHNSWIndex::bruteForceSearch(Transaction* transaction,
+    const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
+    KU_ASSERT(searchState.hasMask());
+    const auto numTotalRows = nodeTable.getNumTotalRows(transaction);
+    const auto numMaskedNodes = searchState.semiMask->getNumMaskedNodes();
+    auto offsets = searchState.semiMask->collectMaskedNodes(numMaskedNodes);
+    std::erase_if(offsets, [&](common::offset_t offset) { return offset >= numTotalRows; });
+    max_node_priority_queue_t results;
+    for (auto startIdx = 0u; startIdx < offsets.size();
+         startIdx += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto endIdx =
+            std::min<uint64_t>(startIdx + common::DEFAULT_VECTOR_CAPACITY, offsets.size());
+        const auto batch = std::span{offsets}.subspan(startIdx, endIdx - startIdx);
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(batch, searchState.embeddingScanState);
+        KU_ASSERT(vectors.size() <= batch.size());
+        for (auto i = 0u; i < vectors.size(); i++) {
+            if (vectors[i].isNull()) {
+                continue; // Skip null or deleted values.
+            }
+            const auto dist = metricFunc(queryVector.getPtr(), vectors[i].getPtr(),
+                searchState.embeddings->getDimension());
+            if (results.size() < searchState.k || dist < results.top().distance) {
+                if (results.size() == searchState.k) {
+                    results.pop();
+                }
+                results.push({batch[i], dist});
+            }
+        }
+    }
+    return popTopK(results, searchState.k);
+}
+
 std::vector<NodeWithDistance> OnDiskHNSWIndex::searchFromCheckpointed(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
     auto entryPoint = searchNNInUpperLayer(queryVector, searchState);
@@ -515,6 +747,9 @@ void OnDiskHNSWIndex::searchFromUnCheckpointed(Transaction* transaction,
     result.reserve(numUnCheckpointedTuples + result.size());
     // TODO(Guodong): Perhaps should switch to scan instead of lookup here.
     for (auto offset = hnswStorageInfo.numCheckpointedNodes; offset < numTotalRows; offset++) {
+        if (!searchState.isMasked(offset)) {
+            continue;
+        }
         const auto vector =
             searchState.embeddings->getEmbedding(offset, searchState.embeddingScanState);
         if (vector.isNull()) {
@@ -594,19 +829,42 @@ void OnDiskHNSWIndex::commitInsert(Transaction* transaction,
         const auto offset = nodeIDVector.readNodeOffset(pos);
         auto valuePos = dataVectors[0]->state->getSelVector()[i];
         if (dataVectors[0]->isNull(valuePos)) {
+            if (config.quantization != QuantizationType::NONE) {
+                setQuantizedCode(offset, EmbeddingHandle::createNullHandle());
+            }
             continue; // Skip null or deleted values.
         }
         EmbeddingHandle handle{dataVectors[0]->getValue<common::list_entry_t>(valuePos).offset,
             commitInsertScanState.get()};
         insertInternal(transaction, offset, handle, hnswInsertState);
+        if (config.quantization != QuantizationType::NONE) {
+            setQuantizedCode(offset, handle);
+        }
         storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes = offset + 1;
     }
+    if (upperNodesToShrink.size() + lowerNodesToShrink.size() >= INSERTION_BATCH_MERGE_THRESHOLD) {
+        shrinkPendingNodes(transaction, hnswInsertState);
+    }
+}
+
+void OnDiskHNSWIndex::delete_(Transaction* transaction, const common::ValueVector& nodeIDVector,
+    DeleteState&) {
+    KU_ASSERT(nodeIDVector.state->getSelVector().getSelSize() == 1);
+    const auto pos = nodeIDVector.state->getSelVector()[0];
+    const auto offset = nodeIDVector.readNodeOffset(pos);
+    if (offset >= storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes) {
+        // The node is not in the layers yet.
+        return;
+    }
+    // Consolidation is left to the maintenance transaction run before the next checkpoint.
+    deletedNodesToConsolidate.insert(offset);
 }
 
 void OnDiskHNSWIndex::finalize(main::ClientContext* context) {
     auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
     const auto numTotalRows = nodeTable.getNumTotalRows(&DUMMY_CHECKPOINT_TRANSACTION);
-    if (numTotalRows == hnswStorageInfo.numCheckpointedNodes) {
+    if (numTotalRows == hnswStorageInfo.numCheckpointedNodes && upperNodesToShrink.empty() &&
+        lowerNodesToShrink.empty()) {
         return;
     }
     auto transaction = Transaction::Get(*context);
@@ -620,17 +878,15 @@ void OnDiskHNSWIndex::finalize(main::ClientContext* context) {
     // TODO(Guodong): Perhaps should switch to scan instead of lookup here.
     for (auto offset = hnswStorageInfo.numCheckpointedNodes; offset < numTotalRows; offset++) {
         const auto vector = insertState->searchState.embeddings->getEmbedding(offset, *scanState);
+        if (config.quantization != QuantizationType::NONE) {
+            setQuantizedCode(offset, vector);
+        }
         if (vector.isNull()) {
             continue;
         }
         insertInternal(transaction, offset, vector, *insertState);
     }
-    for (const auto offset : insertState->upperNodesToShrink) {
-        shrinkForNode(transaction, offset, true, config.mu, *insertState);
-    }
-    for (const auto offset : insertState->lowerNodesToShrink) {
-        shrinkForNode(transaction, offset, false, config.ml, *insertState);
-    }
+    shrinkPendingNodes(transaction, *insertState);
     hnswStorageInfo.numCheckpointedNodes = numTotalRows;
 }
 
@@ -642,6 +898,35 @@ void OnDiskHNSWIndex::checkpoint(main::ClientContext* context,
     lowerRelTable->checkpoint(context, lowerRelTableEntry, pageAllocator);
 }
 
+void OnDiskHNSWIndex::runMaintenance(main::ClientContext* context) {
+    const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    // Consolidation changes the entry points in place when it deletes the rels of one.
+    pendingConsolidation = PendingConsolidation{deletedNodesToConsolidate,
+        hnswStorageInfo.upperEntryPoint, hnswStorageInfo.lowerEntryPoint};
+    const auto insertState = initInsertState(context, {} /* visible_func */);
+    consolidateDeletes(Transaction::Get(*context), insertState->cast<HNSWInsertState>());
+}
+
+void OnDiskHNSWIndex::commitMaintenance() {
+    if (!pendingConsolidation) {
+        return;
+    }
+    for (const auto offset : pendingConsolidation->nodes) {
+        deletedNodesToConsolidate.erase(offset);
+    }
+    pendingConsolidation.reset();
+}
+
+void OnDiskHNSWIndex::rollbackMaintenance() {
+    if (!pendingConsolidation) {
+        return;
+    }
+    auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    hnswStorageInfo.upperEntryPoint = pendingConsolidation->upperEntryPoint;
+    hnswStorageInfo.lowerEntryPoint = pendingConsolidation->lowerEntryPoint;
+    pendingConsolidation.reset();
+}
+
 void OnDiskHNSWIndex::insertInternal(Transaction* transaction, common::offset_t offset,
     const EmbeddingHandle& vector, HNSWInsertState& insertState) {
     // Search fow lower layer entry point.
@@ -664,14 +949,7 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
         return common::INVALID_OFFSET;
     }
     double lastMinDist = std::numeric_limits<float>::max();
-    const auto& embeddings = searchState.embeddings;
-    const auto currNodeVector =
-        embeddings->getEmbedding(currentNodeOffset, searchState.embeddingScanState);
-    double minDist = 0.0;
-    if (!currNodeVector.isNull()) {
-        minDist =
-            metricFunc(queryVector.getPtr(), currNodeVector.getPtr(), embeddings->getDimension());
-    }
+    double minDist = computeDistance(queryVector, currentNodeOffset, searchState).value_or(0.0);
     const auto scanState = searchState.upperGraph->prepareRelScan(*searchState.upperRelTableEntry,
         hnswStorageInfo.upperRelTableID, indexInfo.tableID, {} /* relProperties */);
     while (minDist < lastMinDist) {
@@ -681,15 +959,10 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
         for (const auto neighborChunk : neighborItr) {
             neighborChunk.forEach([&](auto neighbors, auto, auto i) {
                 auto neighbor = neighbors[i];
-                const auto nbrVector =
-                    embeddings->getEmbedding(neighbor.offset, searchState.embeddingScanState);
-                if (!nbrVector.isNull()) {
-                    const auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
-                        embeddings->getDimension());
-                    if (dist < minDist) {
-                        minDist = dist;
-                        currentNodeOffset = neighbor.offset;
-                    }
+                const auto dist = computeDistance(queryVector, neighbor.offset, searchState);
+                if (dist.has_value() && *dist < minDist) {
+                    minDist = *dist;
+                    currentNodeOffset = neighbor.offset;
                 }
             });
         }
@@ -723,14 +996,11 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* tra
     max_node_priority_queue_t results;
     initLayerSearchState(transaction, searchState, isUpperLayer);
 
-    const auto entryVector =
-        searchState.embeddings->getEmbedding(entryNode, searchState.embeddingScanState);
-    if (!entryVector.isNull()) {
-        auto dist = metricFunc(queryVector.getPtr(), entryVector.getPtr(),
-            searchState.embeddings->getDimension());
-        candidates.push({entryNode, dist});
+    const auto entryDist = computeDistance(queryVector, entryNode, searchState);
+    if (entryDist.has_value()) {
+        candidates.push({entryNode, *entryDist});
         if (searchState.isMasked(entryNode)) {
-            results.push({entryNode, dist});
+            results.push({entryNode, *entryDist});
         }
     } else {
         // This is to make sure in case the entry node is deleted, we can still continue the search.
@@ -766,7 +1036,7 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* tra
         }
         }
     }
-    return popTopK(results, searchState.k);
+    return popTopK(results, searchState.getNumResultsToKeep());
 }
 
 SearchType OnDiskHNSWIndex::getFilteredSearchType(Transaction* transaction,
@@ -774,8 +1044,15 @@ SearchType OnDiskHNSWIndex::getFilteredSearchType(Transaction* transaction,
     if (!searchState.hasMask()) {
         return SearchType::UNFILTERED;
     }
-    const auto selectivity = 1.0 * searchState.semiMask->getNumMaskedNodes() /
-                             searchState.lowerGraph->getNumNodes(transaction);
+    const auto numMaskedNodes = searchState.semiMask->getNumMaskedNodes();
+    const auto selectivity =
+        1.0 * numMaskedNodes / searchState.lowerGraph->getNumNodes(transaction);
+    const auto bruteForceThreshold = searchState.config.bruteForceSearchUpSelThreshold;
+    // A graph search would visit about ef nodes anyway.
+    if (bruteForceThreshold > 0 &&
+        (numMaskedNodes <= searchState.ef || selectivity < bruteForceThreshold)) {
+        return SearchType::BRUTE_FORCE;
+    }
     if (selectivity < searchState.config.blindSearchUpSelThreshold) {
         return SearchType::BLIND_TWO_HOP;
     }
@@ -798,15 +1075,12 @@ void OnDiskHNSWIndex::initSearchCandidates(const EmbeddingHandle& queryVector,
                 continue;
             }
             searchState.visited.add(candidate);
-            const auto candidateVector =
-                searchState.embeddings->getEmbedding(candidate, searchState.embeddingScanState);
-            if (candidateVector.isNull()) {
+            const auto candidateDist = computeDistance(queryVector, candidate, searchState);
+            if (!candidateDist.has_value()) {
                 continue;
             }
-            auto candidateDist = metricFunc(queryVector.getPtr(), candidateVector.getPtr(),
-                searchState.embeddings->getDimension());
-            candidates.push({candidate, candidateDist});
-            results.push({candidate, candidateDist});
+            candidates.push({candidate, *candidateDist});
+            results.push({candidate, *candidateDist});
         }
     } break;
     default: {
@@ -822,11 +1096,8 @@ void OnDiskHNSWIndex::oneHopSearch(const EmbeddingHandle& queryVector,
         neighborChunk.forEach([&](auto neighbors, auto, auto i) {
             const auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                const auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
-                processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
-                    searchState.visited, metricFunc, searchState.embeddings->getDimension(),
-                    candidates, results);
+                processNbrNode(queryVector, nbr.offset, searchState.ef, searchState, candidates,
+                    results);
             }
         });
     }
@@ -852,11 +1123,9 @@ min_node_priority_queue_t OnDiskHNSWIndex::collectFirstHopNbrsDirected(
             const auto neighbor = neighbors[i];
             auto nbrOffset = neighbor.offset;
             if (!searchState.visited.contains(nbrOffset)) {
-                const auto nbrVector =
-                    searchState.embeddings->getEmbedding(nbrOffset, searchState.embeddingScanState);
-                if (!nbrVector.isNull()) {
-                    auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
-                        searchState.embeddings->getDimension());
+                const auto nbrDist = computeDistance(queryVector, nbrOffset, searchState);
+                if (nbrDist.has_value()) {
+                    const auto dist = *nbrDist;
                     candidatesForSecHop.push({nbrOffset, dist});
                     if (searchState.isMasked(nbrOffset)) {
                         if (results.size() < searchState.ef || dist < results.top().distance) {
@@ -899,10 +1168,7 @@ common::offset_vec_t OnDiskHNSWIndex::collectFirstHopNbrsBlind(const EmbeddingHa
                 secondHopCandidates.push_back(nbr.offset);
                 if (searchState.isMasked(nbr.offset)) {
                     numVisitedNbrs++;
-                    auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                        searchState.embeddingScanState);
-                    processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
-                        searchState.visited, metricFunc, searchState.embeddings->getDimension(),
+                    processNbrNode(queryVector, nbr.offset, searchState.ef, searchState,
                         candidates, results);
                 }
             }
@@ -962,34 +1228,37 @@ void OnDiskHNSWIndex::createRels(Transaction* transaction, common::offset_t offs
     const auto itr = graph->scanFwd(common::nodeID_t{offset, indexInfo.tableID}, *scanState);
     const auto numRels = itr.count();
     if (numRels > static_cast<uint64_t>(maxDegree)) {
-        if (numRels >= static_cast<uint64_t>(HNSWIndex::getDegreeThresholdToShrink(maxDegree))) {
+        if (numRels >= static_cast<uint64_t>(getDegreeThresholdToForceShrink(maxDegree))) {
             // If the number of existing rels exceeds the threshold, we need to shrink the rels
             // right away.
             shrinkForNode(transaction, offset, isUpperLayer, maxDegree, insertState);
-            isUpperLayer ? insertState.upperNodesToShrink.erase(offset) :
-                           insertState.lowerNodesToShrink.erase(offset);
+            isUpperLayer ? upperNodesToShrink.erase(offset) : lowerNodesToShrink.erase(offset);
         } else {
-            isUpperLayer ? insertState.upperNodesToShrink.insert(offset) :
-                           insertState.lowerNodesToShrink.insert(offset);
+            isUpperLayer ? upperNodesToShrink.insert(offset) : lowerNodesToShrink.insert(offset);
         }
     }
 }
 
-void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t offset,
-    bool isUpperLayer, common::length_t maxDegree, HNSWInsertState& insertState) {
-    const auto& embeddings = *insertState.searchState.embeddings;
-    auto& embeddingScanState = insertState.searchState.embeddingScanState;
-    const auto vector = embeddings.getEmbedding(offset, embeddingScanState);
-    KU_ASSERT(!vector.isNull());
-    const auto& searchState = insertState.searchState;
+int64_t OnDiskHNSWIndex::getDegreeThresholdToForceShrink(int64_t degree) {
+    return std::max(getDegreeThresholdToShrink(degree), degree * DEFERRED_SHRINK_DEGREE_RATIO);
+}
+
+std::unique_ptr<graph::NbrScanState> OnDiskHNSWIndex::prepareNbrScan(
+    const HNSWSearchState& searchState, bool isUpperLayer) const {
     const auto& graph = isUpperLayer ? searchState.upperGraph : searchState.lowerGraph;
     const auto relTableID = isUpperLayer ? storageInfo->cast<HNSWStorageInfo>().upperRelTableID :
                                            storageInfo->cast<HNSWStorageInfo>().lowerRelTableID;
     const auto relTableEntry =
         isUpperLayer ? searchState.upperRelTableEntry : searchState.lowerRelTableEntry;
-    const auto scanState = graph->prepareRelScan(*relTableEntry, relTableID, indexInfo.tableID, {});
-    auto itr = graph->scanFwd(common::nodeID_t{offset, indexInfo.tableID}, *scanState);
-    std::vector<common::offset_t> nbrOffsets;
+    return graph->prepareRelScan(*relTableEntry, relTableID, indexInfo.tableID, {});
+}
+
+common::offset_vec_t OnDiskHNSWIndex::getNbrOffsets(common::offset_t offset,
+    const HNSWSearchState& searchState, bool isUpperLayer,
+    graph::NbrScanState& nbrScanState) const {
+    const auto& graph = isUpperLayer ? searchState.upperGraph : searchState.lowerGraph;
+    auto itr = graph->scanFwd(common::nodeID_t{offset, indexInfo.tableID}, nbrScanState);
+    common::offset_vec_t nbrOffsets;
     for (const auto& neighborChunk : itr) {
         neighborChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) -> bool {
             auto nbr = neighbors[i];
@@ -1000,21 +1269,43 @@ void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t o
             return true;
         });
     }
+    return nbrOffsets;
+}
 
+void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t offset,
+    bool isUpperLayer, common::length_t maxDegree, HNSWInsertState& insertState) {
+    const auto vector = insertState.searchState.embeddings->getEmbedding(offset,
+        insertState.searchState.embeddingScanState);
+    if (vector.isNull()) {
+        // The node has been deleted since it was queued for shrinking.
+        return;
+    }
+    const auto nbrScanState = prepareNbrScan(insertState.searchState, isUpperLayer);
+    const auto nbrOffsets =
+        getNbrOffsets(offset, insertState.searchState, isUpperLayer, *nbrScanState);
+    replaceNbrs(transaction, offset, vector, nbrOffsets, isUpperLayer, maxDegree, insertState);
+}
+
+void OnDiskHNSWIndex::replaceNbrs(Transaction* transaction, common::offset_t offset,
+    const EmbeddingHandle& vector, const common::offset_vec_t& candidates, bool isUpperLayer,
+    common::length_t maxDegree, HNSWInsertState& insertState) {
+    const auto& embeddings = *insertState.searchState.embeddings;
+    auto& embeddingScanState = insertState.searchState.embeddingScanState;
     std::vector<NodeWithDistanceAndEmbedding> nbrs;
-    nbrs.reserve(nbrOffsets.size());
+    nbrs.reserve(candidates.size());
     {
-        auto nbrVectors = embeddings.getEmbeddings(nbrOffsets, embeddingScanState);
-        for (size_t i = 0; i < nbrOffsets.size(); i++) {
+        auto nbrVectors = embeddings.getEmbeddings(candidates, embeddingScanState);
+        // Deleted nodes at the end of the candidates are not returned.
+        KU_ASSERT(nbrVectors.size() <= candidates.size());
+        for (size_t i = 0; i < nbrVectors.size(); i++) {
             if (nbrVectors[i].isNull()) {
                 continue;
             }
             auto dist =
                 metricFunc(vector.getPtr(), nbrVectors[i].getPtr(), embeddings.getDimension());
-            nbrs.emplace_back(nbrOffsets[i], dist, std::move(nbrVectors[i]));
+            nbrs.emplace_back(candidates[i], dist, std::move(nbrVectors[i]));
         }
     }
-
     std::ranges::sort(nbrs,
         [](const auto& n1, const auto& n2) { return n1.getDist() < n2.getDist(); });
     // First, delete all existing rels for the node.
@@ -1051,6 +1342,108 @@ void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t o
     }
 }
 
+void OnDiskHNSWIndex::shrinkPendingNodes(Transaction* transaction, HNSWInsertState& insertState) {
+    const auto shrinkNodes = [&](std::unordered_set<common::offset_t>& nodesToShrink,
+                                 bool isUpperLayer, common::length_t maxDegree) {
+        // Sorted so that consecutive shrinks read nearby rels and embeddings.
+        std::vector<common::offset_t> offsets{nodesToShrink.begin(), nodesToShrink.end()};
+        std::ranges::sort(offsets);
+        for (const auto offset : offsets) {
+            shrinkForNode(transaction, offset, isUpperLayer, maxDegree, insertState);
+        }
+        nodesToShrink.clear();
+    };
+    shrinkNodes(upperNodesToShrink, true /* isUpperLayer */, config.mu);
+    shrinkNodes(lowerNodesToShrink, false /* isUpperLayer */, config.ml);
+}
+
+bool OnDiskHNSWIndex::shouldConsolidateDeletes() const {
+    if (deletedNodesToConsolidate.empty()) {
+        return false;
+    }
+    const auto numNodes = storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+    return deletedNodesToConsolidate.size() >= numNodes * DELETE_CONSOLIDATION_THRESHOLD_RATIO;
+}
+
+void OnDiskHNSWIndex::consolidateDeletes(Transaction* transaction, HNSWInsertState& insertState) {
+    auto& searchState = insertState.searchState;
+    // Deletions of rolled back transactions were queued too.
+    std::unordered_set<common::offset_t> deletedNodes;
+    for (const auto offset : deletedNodesToConsolidate) {
+        if (searchState.embeddings->getEmbedding(offset, searchState.embeddingScanState)
+                .isNull()) {
+            deletedNodes.insert(offset);
+        }
+    }
+    if (deletedNodes.empty()) {
+        return;
+    }
+    consolidateDeletesInLayer(transaction, deletedNodes, true /* isUpperLayer */, insertState);
+    consolidateDeletesInLayer(transaction, deletedNodes, false /* isUpperLayer */, insertState);
+}
+
+void OnDiskHNSWIndex::consolidateDeletesInLayer(Transaction* transaction,
+    const std::unordered_set<common::offset_t>& deletedNodes, bool isUpperLayer,
+    HNSWInsertState& insertState) {
+    auto& searchState = insertState.searchState;
+    auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    const auto maxDegree = isUpperLayer ? config.mu : config.ml;
+    const auto nbrScanState = prepareNbrScan(searchState, isUpperLayer);
+    std::unordered_map<common::offset_t, common::offset_vec_t> nbrsOfDeletedNodes;
+    for (const auto offset : deletedNodes) {
+        nbrsOfDeletedNodes.emplace(offset,
+            getNbrOffsets(offset, searchState, isUpperLayer, *nbrScanState));
+    }
+    // Rels are only stored forward, so all nodes are scanned to find the rels to deleted nodes.
+    auto newEntryPoint = common::INVALID_OFFSET;
+    for (common::offset_t offset = 0; offset < hnswStorageInfo.numCheckpointedNodes; offset++) {
+        if (deletedNodes.contains(offset)) {
+            continue;
+        }
+        const auto nbrOffsets = getNbrOffsets(offset, searchState, isUpperLayer, *nbrScanState);
+        if (nbrOffsets.empty()) {
+            continue;
+        }
+        if (newEntryPoint == common::INVALID_OFFSET) {
+            newEntryPoint = offset;
+        }
+        if (std::ranges::none_of(nbrOffsets,
+                [&](common::offset_t nbr) { return deletedNodes.contains(nbr); })) {
+            continue;
+        }
+        // The rels to deleted nodes are replaced by the rels of the deleted nodes.
+        std::unordered_set<common::offset_t> candidates;
+        for (const auto nbr : nbrOffsets) {
+            if (!deletedNodes.contains(nbr)) {
+                candidates.insert(nbr);
+                continue;
+            }
+            for (const auto nbrOfNbr : nbrsOfDeletedNodes.at(nbr)) {
+                if (nbrOfNbr != offset && !deletedNodes.contains(nbrOfNbr)) {
+                    candidates.insert(nbrOfNbr);
+                }
+            }
+        }
+        const auto vector =
+            searchState.embeddings->getEmbedding(offset, searchState.embeddingScanState);
+        KU_ASSERT(!vector.isNull());
+        replaceNbrs(transaction, offset, vector, {candidates.begin(), candidates.end()},
+            isUpperLayer, maxDegree, insertState);
+    }
+    auto& relTable = isUpperLayer ? *upperRelTable : *lowerRelTable;
+    insertState.relDeleteState->detachDeleteDirection = common::RelDataDirection::FWD;
+    for (const auto offset : deletedNodes) {
+        insertState.relDeleteState->srcNodeIDVector.setValue(0,
+            common::nodeID_t{offset, indexInfo.tableID});
+        relTable.detachDelete(transaction, insertState.relDeleteState.get());
+    }
+    auto& entryPoint =
+        isUpperLayer ? hnswStorageInfo.upperEntryPoint : hnswStorageInfo.lowerEntryPoint;
+    if (deletedNodes.contains(entryPoint)) {
+        entryPoint = newEntryPoint;
+    }
+}
+
 void OnDiskHNSWIndex::processSecondHopCandidates(const EmbeddingHandle& queryVector,
     HNSWSearchState& searchState, int64_t& numVisitedNbrs, min_node_priority_queue_t& candidates,
     max_node_priority_queue_t& results,
@@ -1096,11 +1489,7 @@ bool OnDiskHNSWIndex::searchOverSecondHopNbrs(const EmbeddingHandle& queryVector
         secondHopNbrChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) -> bool {
             auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
-                processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, ef,
-                    searchState.visited, metricFunc, searchState.embeddings->getDimension(),
-                    candidates, results);
+                processNbrNode(queryVector, nbr.offset, ef, searchState, candidates, results);
                 numVisitedNbrs++;
                 if (numVisitedNbrs >= config.ml) {
                     return false;
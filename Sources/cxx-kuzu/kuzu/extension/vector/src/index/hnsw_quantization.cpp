@@ -0,0 +1,173 @@
+#include "index/hnsw_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace kuzu {
+namespace vector_extension {
+
+static constexpr float MAX_CODE = std::numeric_limits<uint8_t>::max();
+// Sums are accumulated in this many independent lanes so that the loops can be vectorized without
+// reassociating floating point additions.
+static constexpr common::length_t NUM_LANES = 16;
+
+template<typename Func>
+static double sumOverDimensions(common::length_t dimension, Func func) {
+    float lanes[NUM_LANES] = {};
+    common::length_t i = 0;
+    for (; i + NUM_LANES <= dimension; i += NUM_LANES) {
+        for (auto lane = 0u; lane < NUM_LANES; lane++) {
+            lanes[lane] += func(i + lane);
+        }
+    }
+    double sum = 0;
+    for (auto lane = 0u; lane < NUM_LANES; lane++) {
+        sum += lanes[lane];
+    }
+    for (; i < dimension; i++) {
+        sum += func(i);
+    }
+    return sum;
+}
+
+ScalarQuantizer::ScalarQuantizer(common::length_t dimension, common::LogicalTypeID elementTypeID,
+    MetricType metric)
+    : dimension{dimension}, elementTypeID{elementTypeID}, metric{metric},
+      mins(dimension, std::numeric_limits<float>::max()),
+      maxs(dimension, std::numeric_limits<float>::lowest()), scales(dimension, 0) {}
+
+template<typename Func>
+void ScalarQuantizer::visitVector(const void* vector, Func func) const {
+    switch (elementTypeID) {
+    case common::LogicalTypeID::FLOAT: {
+        func(static_cast<const float*>(vector));
+    } break;
+    case common::LogicalTypeID::DOUBLE: {
+        func(static_cast<const double*>(vector));
+    } break;
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+void ScalarQuantizer::updateRanges(const void* vector) {
+    visitVector(vector, [&]<typename T>(const T* values) {
+        for (auto i = 0u; i < dimension; i++) {
+            mins[i] = std::min(mins[i], static_cast<float>(values[i]));
+            maxs[i] = std::max(maxs[i], static_cast<float>(values[i]));
+        }
+    });
+}
+
+void ScalarQuantizer::finalizeRanges() {
+    for (auto i = 0u; i < dimension; i++) {
+        if (mins[i] > maxs[i]) {
+            // No vector was sampled.
+            mins[i] = maxs[i] = 0;
+        }
+        scales[i] = (maxs[i] - mins[i]) / MAX_CODE;
+    }
+}
+
+void ScalarQuantizer::setRanges(std::vector<float> mins_, std::vector<float> maxs_) {
+    KU_ASSERT(mins_.size() == dimension && maxs_.size() == dimension);
+    mins = std::move(mins_);
+    maxs = std::move(maxs_);
+    finalizeRanges();
+}
+
+void ScalarQuantizer::encode(const void* vector, uint8_t* codes) const {
+    visitVector(vector, [&]<typename T>(const T* values) {
+        for (auto i = 0u; i < dimension; i++) {
+            if (scales[i] == 0) {
+                codes[i] = 0;
+                continue;
+            }
+            const auto code = std::round((static_cast<float>(values[i]) - mins[i]) / scales[i]);
+            codes[i] = static_cast<uint8_t>(std::clamp(code, 0.0f, MAX_CODE));
+        }
+    });
+}
+
+// With x = min + scale * code being the decoded value of each dimension, the terms are:
+//  - L2 and L2 square: query - min, as query - x = (query - min) - scale * code.
+//  - Dot product and cosine: query * scale, as query . x = query . min + (query * scale) . code.
+ScalarQuantizer::PreparedQuery ScalarQuantizer::prepareQuery(const void* query) const {
+    PreparedQuery preparedQuery;
+    preparedQuery.terms.resize(dimension);
+    visitVector(query, [&]<typename T>(const T* values) {
+        for (auto i = 0u; i < dimension; i++) {
+            const auto value = static_cast<float>(values[i]);
+            switch (metric) {
+            case MetricType::L2:
+            case MetricType::L2_SQUARE: {
+                preparedQuery.terms[i] = value - mins[i];
+            } break;
+            case MetricType::DotProduct:
+            case MetricType::Cosine: {
+                preparedQuery.terms[i] = value * scales[i];
+                preparedQuery.constant += static_cast<double>(value) * mins[i];
+                preparedQuery.squaredNorm += static_cast<double>(value) * value;
+            } break;
+            default: {
+                KU_UNREACHABLE;
+            }
+            }
+        }
+    });
+    return preparedQuery;
+}
+
+double ScalarQuantizer::computeDistance(const PreparedQuery& query, const uint8_t* codes) const {
+    const auto* terms = query.terms.data();
+    const auto* mins_ = mins.data();
+    const auto* scales_ = scales.data();
+    auto dotProductTerm = [&](common::length_t i) { return terms[i] * codes[i]; };
+    switch (metric) {
+    case MetricType::L2:
+    case MetricType::L2_SQUARE: {
+        const auto distance = sumOverDimensions(dimension, [&](common::length_t i) {
+            const auto diff = terms[i] - scales_[i] * codes[i];
+            return diff * diff;
+        });
+        return metric == MetricType::L2 ? std::sqrt(distance) : distance;
+    }
+    case MetricType::DotProduct: {
+        return query.constant + sumOverDimensions(dimension, dotProductTerm);
+    }
+    case MetricType::Cosine: {
+        const auto dotProduct = query.constant + sumOverDimensions(dimension, dotProductTerm);
+        const auto squaredNorm = sumOverDimensions(dimension, [&](common::length_t i) {
+            const auto value = mins_[i] + scales_[i] * codes[i];
+            return value * value;
+        });
+        // Matches the edge cases of the full-precision cosine distance.
+        if (query.squaredNorm == 0 && squaredNorm == 0) {
+            return 0;
+        }
+        if (dotProduct == 0) {
+            return 1;
+        }
+        return std::max(0.0, 1 - dotProduct / std::sqrt(query.squaredNorm * squaredNorm));
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+void QuantizedEmbeddings::setCode(common::offset_t offset, const void* vector) {
+    const auto dimension = quantizer.getDimension();
+    if (offset >= codeValid.size()) {
+        const auto numNodes = std::max<common::offset_t>(offset + 1, codeValid.size() * 2);
+        codes.resize(numNodes * dimension);
+        codeValid.resize(numNodes, 0);
+    }
+    quantizer.encode(vector, codes.data() + offset * dimension);
+    codeValid[offset] = true;
+}
+
+} // namespace vector_extension
+} // namespace kuzu
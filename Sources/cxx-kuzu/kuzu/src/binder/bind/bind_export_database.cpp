@@ -111,6 +111,12 @@ static std::vector<ExportedTableData> getExportInfo(const Catalog& catalog,
         tableData.tableName = entry->getName();
         tableData.fileName =
             entry->getName() + "." + StringUtils::getLower(fileTypeInfo.fileTypeStr);
+        // Indexes may share a table, e.g. the stop words of FTS indexes. Tables are exported
+        // concurrently, so each file must be written only once.
+        if (std::any_of(exportData.begin(), exportData.end(),
+                [&](const auto& data) { return data.fileName == tableData.fileName; })) {
+            continue;
+        }
         auto query = getExportNodeTableDataQuery(*entry);
         bindExportTableData(tableData, query, context, binder);
         exportData.push_back(std::move(tableData));
@@ -262,7 +262,7 @@ BoundProjectionBody Binder::bindProjectionBody(const parser::ProjectionBody& pro
     return boundProjectionBody;
 }
 
-static bool isOrderByKeyTypeSupported(const LogicalType& dataType) {
+bool Binder::isOrderByKeyTypeSupported(const LogicalType& dataType) {
     switch (dataType.getLogicalTypeID()) {
     case LogicalTypeID::NODE:
     case LogicalTypeID::REL:
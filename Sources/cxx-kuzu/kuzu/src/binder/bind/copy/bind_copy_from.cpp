@@ -161,13 +161,61 @@ std::unique_ptr<BoundStatement> Binder::bindCopyNodeFrom(const Statement& statem
     std::vector<LogicalType> expectedColumnTypes;
     bindExpectedNodeColumns(nodeTableEntry, copyStatement.getCopyColumnInfo(), expectedColumnNames,
         expectedColumnTypes);
+    options_t scanSourceOptions;
+    options_t clusterByOption;
+    for (auto& [name, value] : copyStatement.getParsingOptions()) {
+        if (StringUtils::caseInsensitiveEquals(name, CopyConstants::CLUSTER_BY_OPTION_NAME)) {
+            clusterByOption.emplace(name, value->copy());
+        } else {
+            scanSourceOptions.emplace(name, value->copy());
+        }
+    }
     auto boundCopyFromInfo =
         bindCopyNodeFromInfo(nodeTableEntry.getName(), nodeTableEntry.getProperties(),
-            copyStatement.getSource(), copyStatement.getParsingOptions(), expectedColumnNames,
-            expectedColumnTypes, copyStatement.byColumn());
+            copyStatement.getSource(), scanSourceOptions, expectedColumnNames, expectedColumnTypes,
+            copyStatement.byColumn());
+    if (!clusterByOption.empty()) {
+        if (copyStatement.byColumn()) {
+            throw BinderException(
+                stringFormat("{} is not supported when copying by column.",
+                    CopyConstants::CLUSTER_BY_OPTION_NAME));
+        }
+        boundCopyFromInfo.extraInfo = std::make_unique<ExtraBoundCopyNodeInfo>(
+            bindClusterKeys(nodeTableEntry, boundCopyFromInfo, clusterByOption));
+    }
     return std::make_unique<BoundCopyFrom>(std::move(boundCopyFromInfo));
 }
 
+expression_vector Binder::bindClusterKeys(const NodeTableCatalogEntry& nodeTableEntry,
+    const BoundCopyFromInfo& copyFromInfo, const options_t& clusterByOption) {
+    auto value = bindParsingOptions(clusterByOption).begin()->second;
+    if (value.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        throw BinderException(stringFormat("{} expects a string of comma separated properties.",
+            CopyConstants::CLUSTER_BY_OPTION_NAME));
+    }
+    // The column expressions are in the same order as the properties of the table.
+    const auto& properties = nodeTableEntry.getProperties();
+    expression_vector clusterKeys;
+    for (auto& name : StringUtils::split(value.getValue<std::string>(), ",")) {
+        const auto propertyName = StringUtils::ltrim(StringUtils::rtrim(name));
+        auto it = std::find_if(properties.begin(), properties.end(), [&](const auto& property) {
+            return StringUtils::caseInsensitiveEquals(property.getName(), propertyName);
+        });
+        if (it == properties.end()) {
+            throw BinderException(stringFormat("Cannot cluster table {} by {}, which is not one of "
+                                               "its properties.",
+                nodeTableEntry.getName(), propertyName));
+        }
+        auto& key = copyFromInfo.columnExprs[it - properties.begin()];
+        if (!isOrderByKeyTypeSupported(key->dataType)) {
+            throw BinderException(stringFormat("Cannot cluster table {} by {} of type {}.",
+                nodeTableEntry.getName(), propertyName, key->dataType.toString()));
+        }
+        clusterKeys.push_back(key);
+    }
+    return clusterKeys;
+}
+
 static options_t getScanSourceOptions(const CopyFrom& copyFrom) {
     options_t options;
     static case_insensitve_set_t copyFromPairsOptions = {CopyConstants::FROM_OPTION_NAME,
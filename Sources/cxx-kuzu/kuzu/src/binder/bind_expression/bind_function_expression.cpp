@@ -77,6 +77,9 @@ std::shared_ptr<Expression> ExpressionBinder::bindScalarFunctionExpression(
         entry->ptrCast<FunctionCatalogEntry>())
                         ->ptrCast<ScalarFunction>()
                         ->copy();
+    if (!function->isDeterministic) {
+        hasNondeterministicFunction_ = true;
+    }
     if (children.size() == 2 && children[1]->expressionType == ExpressionType::LAMBDA) {
         if (!function->isListLambda) {
             throw BinderException(stringFormat("{} does not support lambda input.", functionName));
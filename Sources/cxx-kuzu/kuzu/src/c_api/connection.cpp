@@ -34,6 +34,36 @@ void kuzu_connection_destroy(kuzu_connection* connection) {
     }
 }
 
+kuzu_state kuzu_connection_acquire(kuzu_database* database, kuzu_connection* out_connection) {
+    if (database == nullptr || database->_database == nullptr) {
+        out_connection->_connection = nullptr;
+        return KuzuError;
+    }
+    try {
+        out_connection->_connection =
+            static_cast<Database*>(database->_database)->acquireConnection().release();
+    } catch (Exception& e) {
+        out_connection->_connection = nullptr;
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
+void kuzu_connection_release(kuzu_connection* connection) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return;
+    }
+    auto cppConnection =
+        std::unique_ptr<Connection>(static_cast<Connection*>(connection->_connection));
+    connection->_connection = nullptr;
+    try {
+        auto database = cppConnection->getClientContext()->getDatabase();
+        database->releaseConnection(std::move(cppConnection));
+    } catch (Exception& e) {
+        // The connection is freed if it can't be returned to the pool.
+    }
+}
+
 kuzu_state kuzu_connection_set_max_num_thread_for_exec(kuzu_connection* connection,
     uint64_t num_threads) {
     if (connection == nullptr || connection->_connection == nullptr) {
@@ -82,6 +112,28 @@ kuzu_state kuzu_connection_query(kuzu_connection* connection, const char* query,
     }
 }
 
+kuzu_state kuzu_connection_query_async(kuzu_connection* connection, const char* query,
+    kuzu_async_query_callback callback, void* user_data,
+    kuzu_async_query_result* out_async_query_result) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return KuzuError;
+    }
+    try {
+        std::function<void()> onDone;
+        if (callback != nullptr) {
+            onDone = [callback, user_data]() { callback(user_data); };
+        }
+        auto async_query_result = static_cast<Connection*>(connection->_connection)
+                                      ->queryAsync(query, std::move(onDone));
+        out_async_query_result->_async_query_result =
+            new std::shared_ptr<AsyncQueryResult>(std::move(async_query_result));
+        return KuzuSuccess;
+    } catch (Exception& e) {
+        out_async_query_result->_async_query_result = nullptr;
+        return KuzuError;
+    }
+}
+
 kuzu_state kuzu_connection_prepare(kuzu_connection* connection, const char* query,
     kuzu_prepared_statement* out_prepared_statement) {
     if (connection == nullptr || connection->_connection == nullptr) {
@@ -140,10 +192,106 @@ kuzu_state kuzu_connection_execute(kuzu_connection* connection,
         return KuzuError;
     }
 }
+
+kuzu_state kuzu_connection_execute_many(kuzu_connection* connection,
+    kuzu_prepared_statement* prepared_statement, uint64_t num_parameter_sets,
+    uint64_t num_parameters, const char** parameter_names, kuzu_value** parameter_values,
+    kuzu_query_result* out_query_result) {
+    if (connection == nullptr || connection->_connection == nullptr ||
+        prepared_statement == nullptr || prepared_statement->_prepared_statement == nullptr ||
+        prepared_statement->_bound_values == nullptr ||
+        (num_parameters > 0 && (parameter_names == nullptr || parameter_values == nullptr))) {
+        return KuzuError;
+    }
+    try {
+        auto prepared_statement_ptr =
+            static_cast<PreparedStatement*>(prepared_statement->_prepared_statement);
+        auto bound_values = static_cast<std::unordered_map<std::string, std::unique_ptr<Value>>*>(
+            prepared_statement->_bound_values);
+
+        std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>> param_sets(
+            num_parameter_sets);
+        for (auto j = 0u; j < num_parameter_sets; j++) {
+            auto& param_set = param_sets[j];
+            for (auto& [name, value] : *bound_values) {
+                param_set.emplace(name, value->copy());
+            }
+            for (auto i = 0u; i < num_parameters; i++) {
+                auto value = parameter_values[i * num_parameter_sets + j];
+                if (parameter_names[i] == nullptr || value == nullptr ||
+                    value->_value == nullptr) {
+                    return KuzuError;
+                }
+                param_set.insert_or_assign(parameter_names[i],
+                    static_cast<Value*>(value->_value)->copy());
+            }
+        }
+
+        auto query_result = static_cast<Connection*>(connection->_connection)
+                                ->executeMany(prepared_statement_ptr, param_sets)
+                                .release();
+        if (query_result == nullptr) {
+            return KuzuError;
+        }
+        out_query_result->_query_result = query_result;
+        out_query_result->_is_owned_by_cpp = false;
+        if (!query_result->isSuccess()) {
+            return KuzuError;
+        }
+        return KuzuSuccess;
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+}
+
+kuzu_state kuzu_connection_copy_from_arrow_stream(kuzu_connection* connection,
+    const char* table_name, ArrowArrayStream* stream, kuzu_query_result* out_query_result) {
+    if (connection == nullptr || connection->_connection == nullptr || stream == nullptr) {
+        return KuzuError;
+    }
+    try {
+        auto query_result = static_cast<Connection*>(connection->_connection)
+                                ->copyFromArrowStream(table_name, stream)
+                                .release();
+        if (query_result == nullptr) {
+            return KuzuError;
+        }
+        out_query_result->_query_result = query_result;
+        out_query_result->_is_owned_by_cpp = false;
+        if (!query_result->isSuccess()) {
+            return KuzuError;
+        }
+        return KuzuSuccess;
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+}
+
 void kuzu_connection_interrupt(kuzu_connection* connection) {
     static_cast<Connection*>(connection->_connection)->interrupt();
 }
 
+kuzu_state kuzu_connection_get_query_progress(kuzu_connection* connection,
+    kuzu_query_progress* out_progress) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return KuzuError;
+    }
+    try {
+        auto progress = static_cast<Connection*>(connection->_connection)->getQueryProgress();
+        out_progress->is_running = progress.isRunning;
+        out_progress->query_id = progress.queryID;
+        out_progress->num_pipelines = progress.numPipelines;
+        out_progress->num_pipelines_finished = progress.numPipelinesFinished;
+        out_progress->pipeline_progress = progress.pipelineProgress;
+        out_progress->progress = progress.progress;
+        out_progress->elapsed_time_ms = progress.elapsedTimeMS;
+        out_progress->estimated_remaining_time_ms = progress.estimatedRemainingTimeMS;
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
 kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection, uint64_t timeout_in_ms) {
     if (connection == nullptr || connection->_connection == nullptr) {
         return KuzuError;
@@ -155,3 +303,47 @@ kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection, uint64
     }
     return KuzuSuccess;
 }
+
+static AsyncQueryResult* getAsyncQueryResult(kuzu_async_query_result* async_query_result) {
+    return static_cast<std::shared_ptr<AsyncQueryResult>*>(
+        async_query_result->_async_query_result)
+        ->get();
+}
+
+void kuzu_async_query_result_destroy(kuzu_async_query_result* async_query_result) {
+    if (async_query_result == nullptr) {
+        return;
+    }
+    delete static_cast<std::shared_ptr<AsyncQueryResult>*>(
+        async_query_result->_async_query_result);
+    async_query_result->_async_query_result = nullptr;
+}
+
+bool kuzu_async_query_result_is_done(kuzu_async_query_result* async_query_result) {
+    return getAsyncQueryResult(async_query_result)->isDone();
+}
+
+void kuzu_async_query_result_wait(kuzu_async_query_result* async_query_result) {
+    getAsyncQueryResult(async_query_result)->wait();
+}
+
+kuzu_state kuzu_async_query_result_get_query_result(kuzu_async_query_result* async_query_result,
+    kuzu_query_result* out_query_result) {
+    if (async_query_result == nullptr || async_query_result->_async_query_result == nullptr) {
+        return KuzuError;
+    }
+    auto query_result = getAsyncQueryResult(async_query_result)->getResult().release();
+    if (query_result == nullptr) {
+        return KuzuError;
+    }
+    out_query_result->_query_result = query_result;
+    out_query_result->_is_owned_by_cpp = false;
+    if (!query_result->isSuccess()) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
+void kuzu_async_query_result_interrupt(kuzu_async_query_result* async_query_result) {
+    getAsyncQueryResult(async_query_result)->interrupt();
+}
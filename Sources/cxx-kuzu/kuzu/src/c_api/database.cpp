@@ -1,6 +1,8 @@
 #include "c_api/kuzu.h"
 #include "common/exception/exception.h"
 #include "main/kuzu.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 using namespace kuzu::main;
 using namespace kuzu::common;
 
@@ -11,6 +13,10 @@ kuzu_state kuzu_database_init(const char* database_path, kuzu_system_config conf
         auto systemConfig = SystemConfig(config.buffer_pool_size, config.max_num_threads,
             config.enable_compression, config.read_only, config.max_db_size, config.auto_checkpoint,
             config.checkpoint_threshold);
+        systemConfig.directIO = config.direct_io;
+        systemConfig.enableHugePages = config.enable_huge_pages;
+        systemConfig.warmUpBufferPool = config.warm_up_buffer_pool;
+        systemConfig.enableTwoQueueEviction = config.enable_two_queue_eviction;
 
 #if defined(__APPLE__)
         systemConfig.threadQos = config.thread_qos;
@@ -32,6 +38,33 @@ void kuzu_database_destroy(kuzu_database* database) {
     }
 }
 
+kuzu_state kuzu_database_get_io_stats(kuzu_database* database, kuzu_io_stats* out_io_stats) {
+    if (database == nullptr || database->_database == nullptr) {
+        return KuzuError;
+    }
+    auto bufferManager =
+        static_cast<Database*>(database->_database)->getMemoryManager()->getBufferManager();
+    kuzu::storage::FileIOStatsSnapshot stats;
+    for (auto& fileStats : bufferManager->getIOStats()) {
+        stats.merge(fileStats);
+    }
+    using kuzu::storage::FileIOCounter;
+    out_io_stats->num_pins = stats.get(FileIOCounter::PINS);
+    out_io_stats->num_hits = stats.get(FileIOCounter::HITS);
+    out_io_stats->num_misses = stats.get(FileIOCounter::MISSES);
+    out_io_stats->num_optimistic_read_retries = stats.get(FileIOCounter::OPTIMISTIC_READ_RETRIES);
+    out_io_stats->num_evictions = stats.get(FileIOCounter::EVICTIONS);
+    out_io_stats->num_second_chances = stats.get(FileIOCounter::SECOND_CHANCES);
+    out_io_stats->bytes_read = stats.get(FileIOCounter::BYTES_READ);
+    out_io_stats->bytes_written = stats.get(FileIOCounter::BYTES_WRITTEN);
+    static_assert(sizeof(out_io_stats->read_latency_histogram) / sizeof(uint64_t) ==
+                  kuzu::storage::FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS);
+    for (auto i = 0u; i < kuzu::storage::FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS; i++) {
+        out_io_stats->read_latency_histogram[i] = stats.readLatencyHistogram[i];
+    }
+    return KuzuSuccess;
+}
+
 kuzu_system_config kuzu_default_system_config() {
     SystemConfig config = SystemConfig();
     auto cSystemConfig = kuzu_system_config();
@@ -42,6 +75,10 @@ kuzu_system_config kuzu_default_system_config() {
     cSystemConfig.max_db_size = config.maxDBSize;
     cSystemConfig.auto_checkpoint = config.autoCheckpoint;
     cSystemConfig.checkpoint_threshold = config.checkpointThreshold;
+    cSystemConfig.direct_io = config.directIO;
+    cSystemConfig.enable_huge_pages = config.enableHugePages;
+    cSystemConfig.warm_up_buffer_pool = config.warmUpBufferPool;
+    cSystemConfig.enable_two_queue_eviction = config.enableTwoQueueEviction;
 #if defined(__APPLE__)
     cSystemConfig.thread_qos = config.threadQos;
 #endif
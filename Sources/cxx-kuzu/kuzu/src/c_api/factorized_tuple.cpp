@@ -0,0 +1,57 @@
+#include "processor/result/factorized_tuple.h"
+
+#include "c_api/kuzu.h"
+#include "common/exception/exception.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+void kuzu_factorized_tuple_destroy(kuzu_factorized_tuple* factorized_tuple) {
+    if (factorized_tuple == nullptr) {
+        return;
+    }
+    if (factorized_tuple->_factorized_tuple != nullptr && !factorized_tuple->_is_owned_by_cpp) {
+        delete static_cast<FactorizedTuple*>(factorized_tuple->_factorized_tuple);
+    }
+}
+
+uint64_t kuzu_factorized_tuple_get_num_groups(kuzu_factorized_tuple* factorized_tuple) {
+    return static_cast<FactorizedTuple*>(factorized_tuple->_factorized_tuple)->getNumGroups();
+}
+
+kuzu_state kuzu_factorized_tuple_get_group_index(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t column_index, uint64_t* out_group_index) {
+    auto factorized_tuple_ptr = static_cast<FactorizedTuple*>(factorized_tuple->_factorized_tuple);
+    try {
+        *out_group_index = factorized_tuple_ptr->getGroupIdx(column_index);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
+kuzu_state kuzu_factorized_tuple_get_num_rows(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t group_index, uint64_t* out_num_rows) {
+    auto factorized_tuple_ptr = static_cast<FactorizedTuple*>(factorized_tuple->_factorized_tuple);
+    try {
+        *out_num_rows = factorized_tuple_ptr->getNumRows(group_index);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
+kuzu_state kuzu_factorized_tuple_get_value(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t column_index, uint64_t row_index, kuzu_value* out_value) {
+    auto factorized_tuple_ptr = static_cast<FactorizedTuple*>(factorized_tuple->_factorized_tuple);
+    Value* _value = nullptr;
+    try {
+        _value = factorized_tuple_ptr->getValue(column_index, row_index);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    out_value->_value = _value;
+    // The value is owned by the factorized tuple, so it is not deleted if it is destroyed in C.
+    out_value->_is_owned_by_cpp = true;
+    return KuzuSuccess;
+}
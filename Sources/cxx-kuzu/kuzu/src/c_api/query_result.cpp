@@ -1,12 +1,116 @@
 #include "main/query_result.h"
 
+#include <cerrno>
+
 #include "c_api/helpers.h"
 #include "c_api/kuzu.h"
+#include "main/query_result/materialized_query_result.h"
 
 using namespace kuzu::main;
 using namespace kuzu::common;
 using namespace kuzu::processor;
 
+namespace {
+
+// A batch of tuples converted to the Arrow columnar format, whose buffers are exposed as
+// kuzu_column_buffers.
+struct ColumnBatch {
+    ArrowArray array;
+    std::vector<LogicalTypeID> columnTypeIDs;
+
+    ColumnBatch(ArrowArray array, std::vector<LogicalTypeID> columnTypeIDs)
+        : array{array}, columnTypeIDs{std::move(columnTypeIDs)} {}
+    DELETE_COPY_AND_MOVE(ColumnBatch);
+    ~ColumnBatch() {
+        if (array.release != nullptr) {
+            array.release(&array);
+        }
+    }
+};
+
+// The private data of an Arrow stream exported from a query result.
+struct QueryResultArrowStream {
+    QueryResult* queryResult;
+    int64_t chunkSize;
+    std::string lastError;
+
+    QueryResultArrowStream(QueryResult* queryResult, int64_t chunkSize)
+        : queryResult{queryResult}, chunkSize{chunkSize} {}
+
+    static QueryResultArrowStream* get(ArrowArrayStream* stream) {
+        return static_cast<QueryResultArrowStream*>(stream->private_data);
+    }
+
+    static int getSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+        auto arrowStream = get(stream);
+        try {
+            *out = *arrowStream->queryResult->getArrowSchema();
+            return 0;
+        } catch (Exception& e) {
+            arrowStream->lastError = e.what();
+            return EIO;
+        }
+    }
+
+    static int getNext(ArrowArrayStream* stream, ArrowArray* out) {
+        auto arrowStream = get(stream);
+        try {
+            if (!arrowStream->queryResult->hasNextArrowChunk()) {
+                // A released array marks the end of the stream.
+                out->release = nullptr;
+                return 0;
+            }
+            *out = *arrowStream->queryResult->getNextArrowChunk(arrowStream->chunkSize);
+            return 0;
+        } catch (Exception& e) {
+            arrowStream->lastError = e.what();
+            return EIO;
+        }
+    }
+
+    static const char* getLastError(ArrowArrayStream* stream) {
+        auto arrowStream = get(stream);
+        return arrowStream->lastError.empty() ? nullptr : arrowStream->lastError.c_str();
+    }
+
+    static void release(ArrowArrayStream* stream) {
+        delete get(stream);
+        stream->private_data = nullptr;
+        stream->release = nullptr;
+    }
+};
+
+bool canReadFromColumnBatch(LogicalTypeID typeID) {
+    switch (typeID) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::STRING:
+    case LogicalTypeID::BLOB:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 void kuzu_query_result_destroy(kuzu_query_result* query_result) {
     if (query_result == nullptr) {
         return;
@@ -105,6 +209,31 @@ kuzu_state kuzu_query_result_get_next(kuzu_query_result* query_result,
     }
 }
 
+bool kuzu_query_result_has_next_factorized_tuple(kuzu_query_result* query_result) {
+    auto queryResult = static_cast<QueryResult*>(query_result->_query_result);
+    if (queryResult->getType() != QueryResultType::FTABLE) {
+        return false;
+    }
+    return queryResult->cast<MaterializedQueryResult>().hasNextFactorizedTuple();
+}
+
+kuzu_state kuzu_query_result_get_next_factorized_tuple(kuzu_query_result* query_result,
+    kuzu_factorized_tuple* out_factorized_tuple) {
+    auto queryResult = static_cast<QueryResult*>(query_result->_query_result);
+    if (queryResult->getType() != QueryResultType::FTABLE) {
+        return KuzuError;
+    }
+    try {
+        auto factorizedTuple =
+            queryResult->cast<MaterializedQueryResult>().getNextFactorizedTuple();
+        out_factorized_tuple->_factorized_tuple = factorizedTuple.get();
+        out_factorized_tuple->_is_owned_by_cpp = true;
+        return KuzuSuccess;
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+}
+
 char* kuzu_query_result_to_string(kuzu_query_result* query_result) {
     std::string result_string = static_cast<QueryResult*>(query_result->_query_result)->toString();
     return convertToOwnedCString(result_string);
@@ -134,3 +263,79 @@ kuzu_state kuzu_query_result_get_next_arrow_chunk(kuzu_query_result* query_resul
         return KuzuError;
     }
 }
+
+kuzu_state kuzu_query_result_get_arrow_stream(kuzu_query_result* query_result,
+    int64_t chunk_size, ArrowArrayStream* out_stream) {
+    if (chunk_size <= 0) {
+        return KuzuError;
+    }
+    auto queryResult = static_cast<QueryResult*>(query_result->_query_result);
+    if (!queryResult->isSuccess()) {
+        return KuzuError;
+    }
+    out_stream->get_schema = QueryResultArrowStream::getSchema;
+    out_stream->get_next = QueryResultArrowStream::getNext;
+    out_stream->get_last_error = QueryResultArrowStream::getLastError;
+    out_stream->release = QueryResultArrowStream::release;
+    out_stream->private_data = new QueryResultArrowStream(queryResult, chunk_size);
+    return KuzuSuccess;
+}
+
+kuzu_state kuzu_query_result_get_next_column_batch(kuzu_query_result* query_result,
+    uint64_t max_num_tuples, kuzu_column_batch* out_column_batch) {
+    if (max_num_tuples == 0 || max_num_tuples > INT64_MAX) {
+        return KuzuError;
+    }
+    try {
+        auto queryResult = static_cast<QueryResult*>(query_result->_query_result);
+        std::vector<LogicalTypeID> columnTypeIDs;
+        for (auto& type : queryResult->getColumnDataTypes()) {
+            columnTypeIDs.push_back(type.getLogicalTypeID());
+        }
+        auto array = queryResult->getNextArrowChunk(static_cast<int64_t>(max_num_tuples));
+        out_column_batch->_column_batch = new ColumnBatch(*array, std::move(columnTypeIDs));
+        return KuzuSuccess;
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+}
+
+void kuzu_column_batch_destroy(kuzu_column_batch* column_batch) {
+    if (column_batch == nullptr) {
+        return;
+    }
+    delete static_cast<ColumnBatch*>(column_batch->_column_batch);
+    column_batch->_column_batch = nullptr;
+}
+
+uint64_t kuzu_column_batch_get_num_tuples(kuzu_column_batch* column_batch) {
+    return static_cast<ColumnBatch*>(column_batch->_column_batch)->array.length;
+}
+
+kuzu_state kuzu_column_batch_get_column(kuzu_column_batch* column_batch, uint64_t index,
+    kuzu_column_buffer* out_column_buffer) {
+    auto batch = static_cast<ColumnBatch*>(column_batch->_column_batch);
+    if (index >= batch->columnTypeIDs.size() || index >= (uint64_t)batch->array.n_children) {
+        return KuzuError;
+    }
+    auto typeID = batch->columnTypeIDs[index];
+    if (!canReadFromColumnBatch(typeID)) {
+        return KuzuError;
+    }
+    auto child = batch->array.children[index];
+    out_column_buffer->data_type_id = static_cast<kuzu_data_type_id>(typeID);
+    out_column_buffer->num_values = child->length;
+    out_column_buffer->validity = static_cast<const uint8_t*>(child->buffers[0]);
+    if (typeID == LogicalTypeID::STRING || typeID == LogicalTypeID::BLOB) {
+        // The offsets of an empty batch are never written.
+        static constexpr uint32_t emptyOffsets[] = {0};
+        out_column_buffer->offsets = child->length == 0 ?
+                                         emptyOffsets :
+                                         static_cast<const uint32_t*>(child->buffers[1]);
+        out_column_buffer->values = child->buffers[2];
+    } else {
+        out_column_buffer->offsets = nullptr;
+        out_column_buffer->values = child->buffers[1];
+    }
+    return KuzuSuccess;
+}
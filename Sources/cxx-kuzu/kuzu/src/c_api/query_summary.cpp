@@ -18,6 +18,10 @@ double kuzu_query_summary_get_compiling_time(kuzu_query_summary* query_summary)
     return static_cast<QuerySummary*>(query_summary->_query_summary)->getCompilingTime();
 }
 
+double kuzu_query_summary_get_planning_time(kuzu_query_summary* query_summary) {
+    return static_cast<QuerySummary*>(query_summary->_query_summary)->getPlanningTime();
+}
+
 double kuzu_query_summary_get_execution_time(kuzu_query_summary* query_summary) {
     return static_cast<QuerySummary*>(query_summary->_query_summary)->getExecutionTime();
 }
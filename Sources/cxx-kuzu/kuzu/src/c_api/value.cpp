@@ -284,8 +284,8 @@ void kuzu_value_destroy(kuzu_value* value) {
 }
 
 kuzu_state kuzu_value_get_list_size(kuzu_value* value, uint64_t* out_result) {
-    if (static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID() !=
-        LogicalTypeID::LIST) {
+    auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
+    if (logical_type_id != LogicalTypeID::LIST && logical_type_id != LogicalTypeID::ARRAY) {
         return KuzuError;
     }
     *out_result = NestedVal::getChildrenSize(static_cast<Value*>(value->_value));
@@ -312,6 +312,80 @@ kuzu_state kuzu_value_get_list_element(kuzu_value* value, uint64_t index, kuzu_v
     return KuzuSuccess;
 }
 
+template<typename T>
+static bool copyListValues(const Value* listValue, void* out_values) {
+    auto values = static_cast<T*>(out_values);
+    for (auto i = 0u; i < listValue->getChildrenSize(); i++) {
+        auto child = NestedVal::getChildVal(listValue, i);
+        if (child->isNull()) {
+            return false;
+        }
+        values[i] = child->getValue<T>();
+    }
+    return true;
+}
+
+kuzu_state kuzu_value_copy_list_values(kuzu_value* value, kuzu_data_type_id child_type_id,
+    void* out_values, uint64_t num_values) {
+    auto listValue = static_cast<Value*>(value->_value);
+    auto& dataType = listValue->getDataType();
+    const LogicalType* childType = nullptr;
+    switch (dataType.getLogicalTypeID()) {
+    case LogicalTypeID::LIST: {
+        childType = &ListType::getChildType(dataType);
+    } break;
+    case LogicalTypeID::ARRAY: {
+        childType = &ArrayType::getChildType(dataType);
+    } break;
+    default:
+        return KuzuError;
+    }
+    if (static_cast<uint8_t>(childType->getLogicalTypeID()) !=
+            static_cast<uint8_t>(child_type_id) ||
+        listValue->getChildrenSize() != num_values) {
+        return KuzuError;
+    }
+    bool copied = false;
+    switch (childType->getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        copied = copyListValues<bool>(listValue, out_values);
+    } break;
+    case LogicalTypeID::INT64: {
+        copied = copyListValues<int64_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::INT32: {
+        copied = copyListValues<int32_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::INT16: {
+        copied = copyListValues<int16_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::INT8: {
+        copied = copyListValues<int8_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::UINT64: {
+        copied = copyListValues<uint64_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::UINT32: {
+        copied = copyListValues<uint32_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::UINT16: {
+        copied = copyListValues<uint16_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::UINT8: {
+        copied = copyListValues<uint8_t>(listValue, out_values);
+    } break;
+    case LogicalTypeID::FLOAT: {
+        copied = copyListValues<float>(listValue, out_values);
+    } break;
+    case LogicalTypeID::DOUBLE: {
+        copied = copyListValues<double>(listValue, out_values);
+    } break;
+    default:
+        return KuzuError;
+    }
+    return copied ? KuzuSuccess : KuzuError;
+}
+
 kuzu_state kuzu_value_get_struct_num_fields(kuzu_value* value, uint64_t* out_result) {
     auto physical_type_id = static_cast<Value*>(value->_value)->getDataType().getPhysicalType();
     if (physical_type_id != PhysicalTypeID::STRUCT) {
@@ -409,6 +483,12 @@ void kuzu_value_get_data_type(kuzu_value* value, kuzu_logical_type* out_data_typ
         new LogicalType(static_cast<Value*>(value->_value)->getDataType().copy());
 }
 
+kuzu_data_type_id kuzu_value_get_data_type_id(kuzu_value* value) {
+    auto data_type_id_u8 = static_cast<uint8_t>(
+        static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID());
+    return static_cast<kuzu_data_type_id>(data_type_id_u8);
+}
+
 kuzu_state kuzu_value_get_bool(kuzu_value* value, bool* out_result) {
     auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
     if (logical_type_id != LogicalTypeID::BOOL) {
@@ -746,6 +826,18 @@ kuzu_state kuzu_value_get_blob(kuzu_value* value, uint8_t** out_result) {
     return KuzuSuccess;
 }
 
+kuzu_state kuzu_value_get_string_data(kuzu_value* value, const char** out_data,
+    uint64_t* out_length) {
+    auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
+    if (logical_type_id != LogicalTypeID::STRING && logical_type_id != LogicalTypeID::BLOB) {
+        return KuzuError;
+    }
+    auto& str = static_cast<Value*>(value->_value)->getValueReference<std::string>();
+    *out_data = str.data();
+    *out_length = str.size();
+    return KuzuSuccess;
+}
+
 kuzu_state kuzu_value_get_uuid(kuzu_value* value, char** out_result) {
     auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
     if (logical_type_id != LogicalTypeID::UUID) {
@@ -91,17 +91,14 @@ TableCatalogEntry* Catalog::getTableCatalogEntry(const Transaction* transaction,
 
 TableCatalogEntry* Catalog::getTableCatalogEntry(const Transaction* transaction,
     const std::string& tableName, bool useInternal) const {
-    CatalogEntry* result = nullptr;
-    if (!tables->containsEntry(transaction, tableName)) {
-        if (!useInternal) {
-            throw CatalogException(stringFormat("{} does not exist in catalog.", tableName));
-        } else {
-            result = internalTables->getEntry(transaction, tableName);
-        }
-    } else {
-        result = tables->getEntry(transaction, tableName);
+    // A single lookup per catalog set, since binding labels looks up every table they name.
+    auto result = tables->getEntryIfExists(transaction, tableName);
+    if (result == nullptr && useInternal) {
+        result = internalTables->getEntryIfExists(transaction, tableName);
+    }
+    if (result == nullptr) {
+        throw CatalogException(stringFormat("{} does not exist in catalog.", tableName));
     }
-    // LCOV_EXCL_STOP
     return result->ptrCast<TableCatalogEntry>();
 }
 
@@ -109,19 +106,14 @@ template<TableCatalogEntryType T>
 std::vector<T*> Catalog::getTableEntries(const Transaction* transaction, bool useInternal,
     CatalogEntryType entryType) const {
     std::vector<T*> result;
-    for (auto& [_, entry] : tables->getEntries(transaction)) {
-        if (entry->getType() != entryType) {
-            continue;
-        }
-        result.push_back(entry->template ptrCast<T>());
-    }
-    if (useInternal) {
-        for (auto& [_, entry] : internalTables->getEntries(transaction)) {
-            if (entry->getType() != entryType) {
-                continue;
-            }
+    const auto collectEntry = [&](CatalogEntry* entry) {
+        if (entry->getType() == entryType) {
             result.push_back(entry->template ptrCast<T>());
         }
+    };
+    tables->iterateEntries(transaction, collectEntry);
+    if (useInternal) {
+        internalTables->iterateEntries(transaction, collectEntry);
     }
     return result;
 }
@@ -141,13 +133,12 @@ std::vector<RelGroupCatalogEntry*> Catalog::getRelGroupEntries(const Transaction
 std::vector<TableCatalogEntry*> Catalog::getTableEntries(const Transaction* transaction,
     bool useInternal) const {
     std::vector<TableCatalogEntry*> result;
-    for (auto& [_, entry] : tables->getEntries(transaction)) {
+    const auto collectEntry = [&](CatalogEntry* entry) {
         result.push_back(entry->ptrCast<TableCatalogEntry>());
-    }
+    };
+    tables->iterateEntries(transaction, collectEntry);
     if (useInternal) {
-        for (auto& [_, entry] : internalTables->getEntries(transaction)) {
-            result.push_back(entry->ptrCast<TableCatalogEntry>());
-        }
+        internalTables->iterateEntries(transaction, collectEntry);
     }
     return result;
 }
@@ -1,5 +1,7 @@
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 
+#include <optional>
+
 #include "binder/ddl/bound_create_sequence_info.h"
 #include "common/exception/catalog.h"
 #include "common/exception/overflow.h"
@@ -66,6 +68,34 @@ void SequenceCatalogEntry::nextValNoLock() {
     sequenceData.usageCount++;
 }
 
+// Values are computed with unsigned arithmetic, which can't overflow between minValue and maxValue.
+int64_t SequenceCatalogEntry::reserveKValNoLock(uint64_t count) {
+    KU_ASSERT(!sequenceData.cycle);
+    const auto currVal = static_cast<uint64_t>(sequenceData.currVal);
+    const auto increment = static_cast<uint64_t>(sequenceData.increment);
+    // The first call of nextval returns the start value.
+    const auto numIncrements = sequenceData.usageCount == 0 ? count - 1 : count;
+    uint64_t maxNumIncrements = 0;
+    if (sequenceData.increment > 0) {
+        maxNumIncrements = (static_cast<uint64_t>(sequenceData.maxValue) - currVal) / increment;
+    } else {
+        maxNumIncrements = (currVal - static_cast<uint64_t>(sequenceData.minValue)) / -increment;
+    }
+    if (numIncrements > maxNumIncrements) {
+        if (sequenceData.increment < 0) {
+            throw CatalogException("nextval: reached minimum value of sequence \"" + name + "\" " +
+                                   std::to_string(sequenceData.minValue));
+        }
+        throw CatalogException("nextval: reached maximum value of sequence \"" + name + "\" " +
+                               std::to_string(sequenceData.maxValue));
+    }
+    const auto first =
+        static_cast<int64_t>(sequenceData.usageCount == 0 ? currVal : currVal + increment);
+    sequenceData.currVal = static_cast<int64_t>(currVal + numIncrements * increment);
+    sequenceData.usageCount += count;
+    return first;
+}
+
 // referenced from DuckDB
 void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const uint64_t& count) {
     KU_ASSERT(count > 0);
@@ -73,23 +103,44 @@ void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const
     {
         std::lock_guard lck(mtx);
         rollbackData = SequenceRollbackData{sequenceData.usageCount, sequenceData.currVal};
-        for (auto i = 0ul; i < count; i++) {
-            nextValNoLock();
+        if (sequenceData.cycle) {
+            for (auto i = 0ul; i < count; i++) {
+                nextValNoLock();
+            }
+        } else {
+            reserveKValNoLock(count);
         }
     }
     transaction->pushSequenceChange(this, count, rollbackData);
 }
 
+// Without CYCLE, the values are reserved as one range under the lock and written to the result
+// vector after it is released.
 void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const uint64_t& count,
     ValueVector& resultVector) {
     KU_ASSERT(count > 0);
     SequenceRollbackData rollbackData{};
+    std::optional<int64_t> first;
+    uint64_t increment = 0;
     {
         std::lock_guard lck(mtx);
         rollbackData = SequenceRollbackData{sequenceData.usageCount, sequenceData.currVal};
+        increment = static_cast<uint64_t>(sequenceData.increment);
+        if (sequenceData.cycle) {
+            for (auto i = 0ul; i < count; i++) {
+                nextValNoLock();
+                resultVector.setValue(i, sequenceData.currVal);
+            }
+        } else {
+            first = reserveKValNoLock(count);
+        }
+    }
+    if (first.has_value()) {
+        auto values = reinterpret_cast<int64_t*>(resultVector.getData());
+        auto value = static_cast<uint64_t>(*first);
         for (auto i = 0ul; i < count; i++) {
-            nextValNoLock();
-            resultVector.setValue(i, sequenceData.currVal);
+            values[i] = static_cast<int64_t>(value);
+            value += increment;
         }
     }
     transaction->pushSequenceChange(this, count, rollbackData);
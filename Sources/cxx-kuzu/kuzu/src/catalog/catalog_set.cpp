@@ -9,6 +9,7 @@
 #include "common/exception/catalog.h"
 #include "common/serializer/deserializer.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::common;
@@ -51,6 +52,17 @@ CatalogEntry* CatalogSet::getEntry(const Transaction* transaction, const std::st
     return getEntryNoLock(transaction, name);
 }
 
+CatalogEntry* CatalogSet::getEntryIfExists(const Transaction* transaction,
+    const std::string& name) {
+    std::shared_lock lck{mtx};
+    const auto it = entries.find(name);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    const auto entry = traverseVersionChainsForTransactionNoLock(transaction, it->second.get());
+    return entry->isDeleted() ? nullptr : entry;
+}
+
 CatalogEntry* CatalogSet::getEntryNoLock(const Transaction* transaction,
     const std::string& name) const {
     // LCOV_EXCL_START
@@ -104,14 +116,38 @@ CatalogEntry* CatalogSet::createEntryNoLock(const Transaction* transaction,
 
 void CatalogSet::emplaceNoLock(std::unique_ptr<CatalogEntry> entry) {
     if (entries.contains(entry->getName())) {
+        removeFromOIDIndexNoLock(*entries.at(entry->getName()));
         entry->setPrev(std::move(entries.at(entry->getName())));
         entries.erase(entry->getName());
     }
+    addToOIDIndexNoLock(*entry);
     entries.emplace(entry->getName(), std::move(entry));
 }
 
 void CatalogSet::eraseNoLock(const std::string& name) {
-    entries.erase(name);
+    const auto it = entries.find(name);
+    if (it == entries.end()) {
+        return;
+    }
+    removeFromOIDIndexNoLock(*it->second);
+    entries.erase(it);
+}
+
+void CatalogSet::addToOIDIndexNoLock(const CatalogEntry& entry) {
+    namesOfOID[entry.getOID()].push_back(entry.getName());
+}
+
+void CatalogSet::removeFromOIDIndexNoLock(const CatalogEntry& entry) {
+    const auto it = namesOfOID.find(entry.getOID());
+    if (it == namesOfOID.end()) {
+        return;
+    }
+    std::erase_if(it->second, [&](const auto& name) {
+        return StringUtils::caseInsensitiveEquals(name, entry.getName());
+    });
+    if (it->second.empty()) {
+        namesOfOID.erase(it);
+    }
 }
 
 std::unique_ptr<CatalogEntry> CatalogSet::createDummyEntryNoLock(std::string name, oid_t oid) {
@@ -220,14 +256,27 @@ CatalogEntrySet CatalogSet::getEntries(const Transaction* transaction) {
     return result;
 }
 
-CatalogEntry* CatalogSet::getEntryOfOID(const Transaction* transaction, oid_t oid) {
+void CatalogSet::iterateEntries(const Transaction* transaction,
+    const std::function<void(CatalogEntry*)>& func) {
     std::shared_lock lck{mtx};
     for (auto& [_, entry] : entries) {
-        if (entry->getOID() != oid) {
+        auto currentEntry = traverseVersionChainsForTransactionNoLock(transaction, entry.get());
+        if (currentEntry->isDeleted()) {
             continue;
         }
+        func(currentEntry);
+    }
+}
+
+CatalogEntry* CatalogSet::getEntryOfOID(const Transaction* transaction, oid_t oid) {
+    std::shared_lock lck{mtx};
+    const auto it = namesOfOID.find(oid);
+    if (it == namesOfOID.end()) {
+        return nullptr;
+    }
+    for (auto& name : it->second) {
         const auto currentEntry =
-            traverseVersionChainsForTransactionNoLock(transaction, entry.get());
+            traverseVersionChainsForTransactionNoLock(transaction, entries.at(name).get());
         if (currentEntry->isDeleted()) {
             continue;
         }
@@ -6,6 +6,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
 #include "processor/result/flat_tuple.h"
 #include "storage/storage_utils.h"
 
@@ -1018,5 +1019,156 @@ void ArrowRowBatch::append(const processor::FlatTuple& tuple) {
     numTuples++;
 }
 
+void ArrowRowBatch::append(const std::vector<ValueVector*>& valueVectors,
+    const std::vector<std::vector<sel_t>>& positions, uint64_t numTuplesToAppend) {
+    KU_ASSERT(valueVectors.size() == vectors.size() && positions.size() == vectors.size());
+    for (auto i = 0u; i < vectors.size(); i++) {
+        KU_ASSERT(positions[i].size() >= numTuplesToAppend);
+        appendVector(vectors[i].get(), *valueVectors[i],
+            std::span{positions[i].data(), numTuplesToAppend}, fallbackExtensionTypes);
+    }
+    numTuples += numTuplesToAppend;
+}
+
+static void copyNulls(ArrowVector* arrowVector, const ValueVector& vector,
+    std::span<const sel_t> positions) {
+    if (vector.hasNoNullsGuarantee()) {
+        return;
+    }
+    for (auto i = 0u; i < positions.size(); i++) {
+        if (vector.isNull(positions[i])) {
+            setBitToZero(arrowVector->validity.data(), arrowVector->numValues + i);
+            arrowVector->numNulls++;
+        }
+    }
+}
+
+static bool isContiguous(std::span<const sel_t> positions) {
+    for (auto i = 1u; i < positions.size(); i++) {
+        if (positions[i] != positions[0] + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+static void copyFixedWidthValues(ArrowVector* arrowVector, const ValueVector& vector,
+    std::span<const sel_t> positions) {
+    auto dstValues = reinterpret_cast<T*>(arrowVector->data.data()) + arrowVector->numValues;
+    auto srcValues = reinterpret_cast<const T*>(vector.getData());
+    if (isContiguous(positions)) {
+        memcpy(dstValues, srcValues + positions.front(), positions.size() * sizeof(T));
+    } else {
+        for (auto i = 0u; i < positions.size(); i++) {
+            dstValues[i] = srcValues[positions[i]];
+        }
+    }
+    copyNulls(arrowVector, vector, positions);
+}
+
+static void copyBools(ArrowVector* arrowVector, const ValueVector& vector,
+    std::span<const sel_t> positions) {
+    for (auto i = 0u; i < positions.size(); i++) {
+        if (vector.getValue<bool>(positions[i])) {
+            setBitToOne(arrowVector->data.data(), arrowVector->numValues + i);
+        } else {
+            setBitToZero(arrowVector->data.data(), arrowVector->numValues + i);
+        }
+    }
+    copyNulls(arrowVector, vector, positions);
+}
+
+// The offsets of all strings are computed first, so that the overflow buffer is resized once.
+static void copyStrings(ArrowVector* arrowVector, const ValueVector& vector,
+    std::span<const sel_t> positions) {
+    auto offsets = reinterpret_cast<uint32_t*>(arrowVector->data.data()) + arrowVector->numValues;
+    if (arrowVector->numValues == 0) {
+        offsets[0] = 0;
+    }
+    for (auto i = 0u; i < positions.size(); i++) {
+        const auto length =
+            vector.isNull(positions[i]) ? 0 : vector.getValue<ku_string_t>(positions[i]).len;
+        offsets[i + 1] = offsets[i] + length;
+    }
+    arrowVector->overflow.resize(offsets[positions.size()] + 1);
+    for (auto i = 0u; i < positions.size(); i++) {
+        const auto& str = vector.getValue<ku_string_t>(positions[i]);
+        if (offsets[i + 1] > offsets[i]) {
+            memcpy(arrowVector->overflow.data() + offsets[i], str.getData(), str.len);
+        }
+    }
+    copyNulls(arrowVector, vector, positions);
+}
+
+void ArrowRowBatch::appendVector(ArrowVector* arrowVector, ValueVector& vector,
+    std::span<const sel_t> positions, bool fallbackExtensionTypes) {
+    if (positions.empty()) {
+        return;
+    }
+    switch (vector.dataType.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        copyBools(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::INT128: {
+        copyFixedWidthValues<int128_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_SEC: {
+        copyFixedWidthValues<int64_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::INT32: {
+        copyFixedWidthValues<int32_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::INT16: {
+        copyFixedWidthValues<int16_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::INT8: {
+        copyFixedWidthValues<int8_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::UINT64: {
+        copyFixedWidthValues<uint64_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::UINT32: {
+        copyFixedWidthValues<uint32_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::UINT16: {
+        copyFixedWidthValues<uint16_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::UINT8: {
+        copyFixedWidthValues<uint8_t>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::DOUBLE: {
+        copyFixedWidthValues<double>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::FLOAT: {
+        copyFixedWidthValues<float>(arrowVector, vector, positions);
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        copyStrings(arrowVector, vector, positions);
+    } break;
+    default: {
+        auto value = Value::createNullValue(vector.dataType);
+        for (auto pos : positions) {
+            value.setNull(vector.isNull(pos));
+            if (!value.isNull()) {
+                value.copyFromColLayout(vector.getData() + pos * vector.getNumBytesPerValue(),
+                    &vector);
+            }
+            appendValue(arrowVector, value, fallbackExtensionTypes);
+        }
+        return;
+    }
+    }
+    arrowVector->numValues += positions.size();
+}
+
 } // namespace common
 } // namespace kuzu
@@ -0,0 +1,63 @@
+#include "common/bitset_mask.h"
+
+#include <bit>
+
+namespace kuzu {
+namespace common {
+
+void BitsetSemiMask::mask(offset_t nodeOffset) {
+    KU_ASSERT(nodeOffset < getMaxOffset());
+    auto& word = words[nodeOffset / 64];
+    const auto bit = uint64_t{1} << (nodeOffset % 64);
+    numMaskedNodes += (word & bit) == 0;
+    word |= bit;
+}
+
+void BitsetSemiMask::maskRange(offset_t startNodeOffset, offset_t endNodeOffset) {
+    KU_ASSERT(endNodeOffset <= getMaxOffset());
+    for (auto offset = startNodeOffset; offset < endNodeOffset;) {
+        auto& word = words[offset / 64];
+        const auto startBit = offset % 64;
+        const auto numBits = std::min<offset_t>(64 - startBit, endNodeOffset - offset);
+        const auto bits = (numBits == 64 ? ~uint64_t{0} : (uint64_t{1} << numBits) - 1)
+                          << startBit;
+        numMaskedNodes += std::popcount(bits & ~word);
+        word |= bits;
+        offset += numBits;
+    }
+}
+
+offset_vec_t BitsetSemiMask::collectMaskedNodes(uint64_t size) const {
+    offset_vec_t result;
+    result.reserve(std::min(size, numMaskedNodes));
+    collect(0, getMaxOffset(), size, result);
+    return result;
+}
+
+offset_vec_t BitsetSemiMask::range(uint32_t start, uint32_t end) {
+    offset_vec_t result;
+    collect(start, std::min<offset_t>(end, getMaxOffset()), UINT64_MAX, result);
+    return result;
+}
+
+void BitsetSemiMask::collect(offset_t start, offset_t end, uint64_t size,
+    offset_vec_t& result) const {
+    for (auto wordIdx = start / 64; wordIdx * 64 < end && result.size() < size; wordIdx++) {
+        auto word = words[wordIdx];
+        const auto wordStart = wordIdx * 64;
+        if (wordStart < start) {
+            word &= ~uint64_t{0} << (start - wordStart);
+        }
+        if (end - wordStart < 64) {
+            word &= (uint64_t{1} << (end - wordStart)) - 1;
+        }
+        // Only the set bits are visited, so sparse words cost a single comparison.
+        while (word != 0 && result.size() < size) {
+            result.push_back(wordStart + std::countr_zero(word));
+            word &= word - 1;
+        }
+    }
+}
+
+} // namespace common
+} // namespace kuzu
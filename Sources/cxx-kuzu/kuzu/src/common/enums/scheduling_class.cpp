@@ -0,0 +1,41 @@
+#include "common/enums/scheduling_class.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+SchedulingClass SchedulingClassUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "INTERACTIVE") {
+        return SchedulingClass::INTERACTIVE;
+    }
+    if (normalizedStr == "BATCH") {
+        return SchedulingClass::BATCH;
+    }
+    if (normalizedStr == "BACKGROUND") {
+        return SchedulingClass::BACKGROUND;
+    }
+    throw BinderException(stringFormat("Cannot parse {} as a scheduling class. Supported inputs are "
+                                       "[INTERACTIVE, BATCH, BACKGROUND]",
+        str));
+}
+
+std::string SchedulingClassUtils::toString(SchedulingClass schedulingClass) {
+    switch (schedulingClass) {
+    case SchedulingClass::INTERACTIVE:
+        return "INTERACTIVE";
+    case SchedulingClass::BATCH:
+        return "BATCH";
+    case SchedulingClass::BACKGROUND:
+        return "BACKGROUND";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
@@ -19,6 +19,22 @@ void FileInfo::readFromFile(void* buffer, uint64_t numBytes, uint64_t position)
     fileSystem->readFromFile(*this, buffer, numBytes, position);
 }
 
+void FileInfo::readFiles(std::span<const FileReadRequest> requests) {
+    fileSystem->readFiles(*this, requests);
+}
+
+void FileInfo::prefetch(uint64_t position, uint64_t numBytes) {
+    fileSystem->prefetch(*this, position, numBytes);
+}
+
+const uint8_t* FileInfo::mapReadOnly(uint64_t numBytes) {
+    return fileSystem->mapReadOnly(*this, numBytes);
+}
+
+void FileInfo::unmap(const uint8_t* data, uint64_t numBytes) {
+    fileSystem->unmap(data, numBytes);
+}
+
 int64_t FileInfo::readFile(void* buf, size_t nbyte) {
     return fileSystem->readFile(*this, buf, nbyte);
 }
@@ -27,6 +43,10 @@ void FileInfo::writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offs
     fileSystem->writeFile(*this, buffer, numBytes, offset);
 }
 
+void FileInfo::writeFiles(std::span<const FileWriteRequest> requests) {
+    fileSystem->writeFiles(*this, requests);
+}
+
 void FileInfo::syncFile() const {
     fileSystem->syncFile(*this);
 }
@@ -0,0 +1,215 @@
+#include "common/file_system/io_uring.h"
+
+#include "common/assert.h"
+#include "common/exception/io.h"
+#include "common/string_format.h"
+#include "common/system_message.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define KUZU_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#else
+#define KUZU_HAS_IO_URING 0
+#endif
+
+namespace kuzu {
+namespace common {
+
+IOUring::~IOUring() {
+#if KUZU_HAS_IO_URING
+    if (sqes != nullptr) {
+        munmap(sqes, sqesSize);
+    }
+    if (cqRing != nullptr && cqRing != sqRing) {
+        munmap(cqRing, cqRingSize);
+    }
+    if (sqRing != nullptr) {
+        munmap(sqRing, sqRingSize);
+    }
+    if (ringFd != -1) {
+        close(ringFd);
+    }
+#endif
+}
+
+IOUring* IOUring::get() {
+    // A failed setup is remembered so that we don't retry it on every batch.
+    static thread_local bool initialized = false;
+    static thread_local std::unique_ptr<IOUring> ring;
+    if (ring != nullptr && ring->needsReset) {
+        ring.reset();
+        initialized = false;
+    }
+    if (!initialized) {
+        initialized = true;
+        auto newRing = std::unique_ptr<IOUring>(new IOUring());
+        if (newRing->init()) {
+            ring = std::move(newRing);
+        }
+    }
+    return ring.get();
+}
+
+#if KUZU_HAS_IO_URING
+template<typename T>
+static T* ringPtr(void* ring, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+}
+
+bool IOUring::init() {
+    io_uring_params params{};
+    ringFd = static_cast<int>(syscall(__NR_io_uring_setup, NUM_ENTRIES, &params));
+    if (ringFd < 0) {
+        ringFd = -1;
+        return false;
+    }
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMmap) {
+        sqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+    sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+        IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED) {
+        sqRing = nullptr;
+        return false;
+    }
+    if (singleMmap) {
+        cqRing = sqRing;
+    } else {
+        cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED) {
+            cqRing = nullptr;
+            return false;
+        }
+    }
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+        IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        sqes = nullptr;
+        return false;
+    }
+    sqTail = ringPtr<uint32_t>(sqRing, params.sq_off.tail);
+    sqMask = *ringPtr<uint32_t>(sqRing, params.sq_off.ring_mask);
+    sqArray = ringPtr<uint32_t>(sqRing, params.sq_off.array);
+    cqHead = ringPtr<uint32_t>(cqRing, params.cq_off.head);
+    cqTail = ringPtr<uint32_t>(cqRing, params.cq_off.tail);
+    cqMask = *ringPtr<uint32_t>(cqRing, params.cq_off.ring_mask);
+    cqes = ringPtr<void>(cqRing, params.cq_off.cqes);
+    return true;
+}
+
+template<typename REQUEST>
+void IOUring::submitAndWait(int fd, uint8_t opcode, std::span<const REQUEST> requests,
+    std::span<int64_t> results) {
+    KU_ASSERT(requests.size() <= NUM_ENTRIES && results.size() >= requests.size());
+    const auto numRequests = static_cast<uint32_t>(requests.size());
+    // This thread is the only producer, so the tail can be read without synchronization.
+    auto tail = *sqTail;
+    for (auto i = 0u; i < numRequests; i++) {
+        const auto idx = tail & sqMask;
+        auto& sqe = static_cast<io_uring_sqe*>(sqes)[idx];
+        memset(&sqe, 0, sizeof(io_uring_sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(requests[i].buffer);
+        sqe.len = static_cast<uint32_t>(requests[i].numBytes);
+        sqe.off = requests[i].offset;
+        sqe.user_data = i;
+        sqArray[idx] = idx;
+        tail++;
+    }
+    __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+
+    uint32_t numSubmitted = 0;
+    uint32_t numCompleted = 0;
+    while (numCompleted < numRequests) {
+        auto ret = syscall(__NR_io_uring_enter, ringFd, numRequests - numSubmitted,
+            numRequests - numCompleted, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (ret < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                continue;
+            }
+            // LCOV_EXCL_START
+            auto errorMessage = posixErrMessage();
+            // The entries that weren't submitted would be submitted with the next batch of this
+            // thread, so they are taken back. A failed enter doesn't consume any entry.
+            __atomic_store_n(sqTail, tail - (numRequests - numSubmitted), __ATOMIC_RELEASE);
+            waitForSubmitted(numSubmitted, numCompleted, results);
+            throw IOException(stringFormat("Failed to submit requests through io_uring. Error: {}",
+                errorMessage));
+            // LCOV_EXCL_STOP
+        }
+        numSubmitted += static_cast<uint32_t>(ret);
+        numCompleted += reapCompletions(results);
+    }
+}
+
+uint32_t IOUring::reapCompletions(std::span<int64_t> results) {
+    auto head = *cqHead;
+    const auto completionTail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+    uint32_t numCompleted = 0;
+    while (head != completionTail) {
+        auto& cqe = static_cast<io_uring_cqe*>(cqes)[head & cqMask];
+        results[cqe.user_data] = cqe.res;
+        head++;
+        numCompleted++;
+    }
+    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    return numCompleted;
+}
+
+// LCOV_EXCL_START
+void IOUring::waitForSubmitted(uint32_t numSubmitted, uint32_t numCompleted,
+    std::span<int64_t> results) {
+    // Submitted requests still reference the buffers of the caller, and their completions would be
+    // reaped as the results of the next batch, so they are waited for before throwing.
+    while (numCompleted < numSubmitted) {
+        auto ret = syscall(__NR_io_uring_enter, ringFd, 0, numSubmitted - numCompleted,
+            IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            // The ring can't be drained, so get() replaces it. Closing it cancels the requests.
+            needsReset = true;
+            return;
+        }
+        numCompleted += reapCompletions(results);
+    }
+}
+// LCOV_EXCL_STOP
+
+void IOUring::write(int fd, std::span<const FileWriteRequest> requests,
+    std::span<int64_t> results) {
+    submitAndWait(fd, IORING_OP_WRITE, requests, results);
+}
+
+void IOUring::read(int fd, std::span<const FileReadRequest> requests, std::span<int64_t> results) {
+    submitAndWait(fd, IORING_OP_READ, requests, results);
+}
+#else
+bool IOUring::init() {
+    return false;
+}
+
+void IOUring::write(int /*fd*/, std::span<const FileWriteRequest> /*requests*/,
+    std::span<int64_t> /*results*/) {
+    KU_UNREACHABLE;
+}
+
+void IOUring::read(int /*fd*/, std::span<const FileReadRequest> /*requests*/,
+    std::span<int64_t> /*results*/) {
+    KU_UNREACHABLE;
+}
+#endif
+
+} // namespace common
+} // namespace kuzu
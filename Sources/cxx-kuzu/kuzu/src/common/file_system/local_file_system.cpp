@@ -2,6 +2,7 @@
 
 #include "common/assert.h"
 #include "common/exception/io.h"
+#include "common/file_system/io_uring.h"
 #include "common/string_format.h"
 #include "common/string_utils.h"
 #include "common/system_message.h"
@@ -16,11 +17,13 @@
 #include <windows.h>
 #else
 #include "sys/stat.h"
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
 #include <fcntl.h>
 
+#include <array>
 #include <cstring>
 
 #include "storage/storage_utils.h"
@@ -37,9 +40,43 @@ LocalFileInfo::~LocalFileInfo() {
     if (fd != -1) {
         close(fd);
     }
+    if (directFd != -1) {
+        close(directFd);
+    }
 #endif
 }
 
+#if !defined(_WIN32)
+// O_DIRECT requires buffers, sizes and offsets aligned to the logical block size of the device,
+// which is at most the page size in practice.
+static constexpr uint64_t DIRECT_IO_ALIGNMENT = 4096;
+
+static bool isAlignedForDirectIO(const void* buffer, uint64_t numBytes, uint64_t offset) {
+    return reinterpret_cast<uintptr_t>(buffer) % DIRECT_IO_ALIGNMENT == 0 &&
+           numBytes % DIRECT_IO_ALIGNMENT == 0 && offset % DIRECT_IO_ALIGNMENT == 0;
+}
+
+static int getFdForIO(const LocalFileInfo& fileInfo, const void* buffer, uint64_t numBytes,
+    uint64_t offset) {
+    return fileInfo.directFd != -1 && isAlignedForDirectIO(buffer, numBytes, offset) ?
+               fileInfo.directFd :
+               fileInfo.fd;
+}
+
+template<typename REQUEST>
+static int getFdForIO(const LocalFileInfo& fileInfo, std::span<const REQUEST> requests) {
+    if (fileInfo.directFd == -1) {
+        return fileInfo.fd;
+    }
+    for (auto& request : requests) {
+        if (!isAlignedForDirectIO(request.buffer, request.numBytes, request.offset)) {
+            return fileInfo.fd;
+        }
+    }
+    return fileInfo.directFd;
+}
+#endif
+
 static void validateFileFlags(uint8_t flags) {
     const bool isRead = flags & FileFlags::READ_ONLY;
     const bool isWrite = flags & FileFlags::WRITE;
@@ -146,7 +183,20 @@ std::unique_ptr<FileInfo> LocalFileSystem::openFile(const std::string& path, Fil
                 "See the docs: https://docs.kuzudb.com/concurrency for more information.");
         }
     }
-    return std::make_unique<LocalFileInfo>(fullPath, fd, this);
+    int directFd = -1;
+    if (fileFlags & FileFlags::DIRECT_IO) {
+#if defined(__APPLE__)
+        // Darwin has no O_DIRECT, but F_NOCACHE keeps all reads and writes of the file, aligned or
+        // not, out of the unified buffer cache.
+        fcntl(fd, F_NOCACHE, 1);
+#elif defined(O_DIRECT)
+        // O_DIRECT only allows aligned I/O, so it gets its own descriptor, and unaligned reads and
+        // writes go through the buffered one. File systems without direct I/O support (such as
+        // tmpfs) fail to open it and keep using buffered I/O only.
+        directFd = open(fullPath.c_str(), (openFlags & ~(O_CREAT | O_TRUNC)) | O_DIRECT);
+#endif
+    }
+    return std::make_unique<LocalFileInfo>(fullPath, fd, this, directFd);
 #endif
 }
 
@@ -377,7 +427,12 @@ void LocalFileSystem::readFromFile(FileInfo& fileInfo, void* buffer, uint64_t nu
             fileInfo.path, (intptr_t)localFileInfo->handle, numBytesRead, numBytes, position));
     }
 #else
-    auto numBytesRead = pread(localFileInfo->fd, buffer, numBytes, position);
+    const auto fd = getFdForIO(*localFileInfo, buffer, numBytes, position);
+    auto numBytesRead = pread(fd, buffer, numBytes, position);
+    if (numBytesRead == -1 && fd != localFileInfo->fd && errno == EINVAL) {
+        // The device requires a larger alignment than the one checked for.
+        numBytesRead = pread(localFileInfo->fd, buffer, numBytes, position);
+    }
     if (static_cast<uint64_t>(numBytesRead) != numBytes &&
         localFileInfo->getFileSize() != position + numBytesRead) {
         // LCOV_EXCL_START
@@ -389,6 +444,88 @@ void LocalFileSystem::readFromFile(FileInfo& fileInfo, void* buffer, uint64_t nu
 #endif
 }
 
+void LocalFileSystem::readFiles(FileInfo& fileInfo,
+    std::span<const FileReadRequest> requests) const {
+#if defined(_WIN32)
+    FileSystem::readFiles(fileInfo, requests);
+#else
+    auto* ring = requests.size() > 1 ? IOUring::get() : nullptr;
+    if (ring == nullptr) {
+        FileSystem::readFiles(fileInfo, requests);
+        return;
+    }
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    std::array<int64_t, IOUring::NUM_ENTRIES> results{};
+    while (!requests.empty()) {
+        const auto batch = requests.first(std::min<size_t>(requests.size(), IOUring::NUM_ENTRIES));
+        ring->read(getFdForIO(*localFileInfo, batch), batch, results);
+        for (auto i = 0u; i < batch.size(); i++) {
+            const auto& request = batch[i];
+            const auto numBytesRead = std::max<int64_t>(results[i], 0);
+            // As for writes, short or failed reads are completed with a regular read. This also
+            // covers reads that stop at the end of the file, which readFromFile accepts.
+            if (static_cast<uint64_t>(numBytesRead) < request.numBytes) {
+                readFromFile(fileInfo, request.buffer + numBytesRead,
+                    request.numBytes - numBytesRead, request.offset + numBytesRead);
+            }
+        }
+        requests = requests.subspan(batch.size());
+    }
+#endif
+}
+
+void LocalFileSystem::prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const {
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    // Prefetching is only a hint, so failures are ignored.
+#if defined(__APPLE__)
+    radvisory advisory{};
+    advisory.ra_offset = static_cast<off_t>(position);
+    advisory.ra_count = static_cast<int>(std::min<uint64_t>(numBytes, INT32_MAX));
+    fcntl(localFileInfo->fd, F_RDADVISE, &advisory);
+#elif defined(POSIX_FADV_WILLNEED)
+    // Reads with O_DIRECT don't go through the page cache, so there is nothing to prefetch into.
+    if (localFileInfo->directFd != -1) {
+        return;
+    }
+    posix_fadvise(localFileInfo->fd, static_cast<off_t>(position), static_cast<off_t>(numBytes),
+        POSIX_FADV_WILLNEED);
+#else
+    KU_UNUSED(localFileInfo);
+    KU_UNUSED(position);
+    KU_UNUSED(numBytes);
+#endif
+}
+
+const uint8_t* LocalFileSystem::mapReadOnly(FileInfo& fileInfo, uint64_t numBytes) const {
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    if (numBytes == 0) {
+        return nullptr;
+    }
+#if defined(_WIN32)
+    auto mapping = CreateFileMappingA((HANDLE)localFileInfo->handle, nullptr, PAGE_READONLY, 0, 0,
+        nullptr);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    // The view keeps the mapping alive after its handle is closed.
+    auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, numBytes);
+    CloseHandle(mapping);
+    return static_cast<const uint8_t*>(data);
+#else
+    auto data = mmap(nullptr, numBytes, PROT_READ, MAP_SHARED, localFileInfo->fd, 0);
+    return data == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(data);
+#endif
+}
+
+void LocalFileSystem::unmap(const uint8_t* data, uint64_t numBytes) const {
+#if defined(_WIN32)
+    KU_UNUSED(numBytes);
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<uint8_t*>(data), numBytes);
+#endif
+}
+
 int64_t LocalFileSystem::readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
 #if defined(_WIN32)
@@ -403,6 +540,9 @@ int64_t LocalFileSystem::readFile(FileInfo& fileInfo, void* buf, size_t nbyte) c
 void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
     uint64_t offset) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+#if !defined(_WIN32)
+    auto fd = getFdForIO(*localFileInfo, buffer, numBytes, offset);
+#endif
     uint64_t remainingNumBytesToWrite = numBytes;
     uint64_t bufferOffset = 0;
     // Split large writes to 1GB at a time
@@ -425,8 +565,12 @@ void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint6
                     numBytesWritten, error, std::system_category().message(error)));
         }
 #else
-        auto numBytesWritten =
-            pwrite(localFileInfo->fd, buffer + bufferOffset, numBytesToWrite, offset);
+        auto numBytesWritten = pwrite(fd, buffer + bufferOffset, numBytesToWrite, offset);
+        if (numBytesWritten == -1 && fd != localFileInfo->fd && errno == EINVAL) {
+            // The device requires a larger alignment than the one checked for.
+            fd = localFileInfo->fd;
+            continue;
+        }
         if (numBytesWritten != static_cast<int64_t>(numBytesToWrite)) {
             // LCOV_EXCL_START
             throw IOException(
@@ -443,6 +587,36 @@ void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint6
     }
 }
 
+void LocalFileSystem::writeFiles(FileInfo& fileInfo,
+    std::span<const FileWriteRequest> requests) const {
+#if defined(_WIN32)
+    FileSystem::writeFiles(fileInfo, requests);
+#else
+    auto* ring = requests.size() > 1 ? IOUring::get() : nullptr;
+    if (ring == nullptr) {
+        FileSystem::writeFiles(fileInfo, requests);
+        return;
+    }
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    std::array<int64_t, IOUring::NUM_ENTRIES> results{};
+    while (!requests.empty()) {
+        const auto batch = requests.first(std::min<size_t>(requests.size(), IOUring::NUM_ENTRIES));
+        ring->write(getFdForIO(*localFileInfo, batch), batch, results);
+        for (auto i = 0u; i < batch.size(); i++) {
+            const auto& request = batch[i];
+            const auto numBytesWritten = std::max<int64_t>(results[i], 0);
+            // Short or failed writes (including kernels without IORING_OP_WRITE) are completed
+            // with a regular write, which reports the error if there is one.
+            if (static_cast<uint64_t>(numBytesWritten) < request.numBytes) {
+                writeFile(fileInfo, request.buffer + numBytesWritten,
+                    request.numBytes - numBytesWritten, request.offset + numBytesWritten);
+            }
+        }
+        requests = requests.subspan(batch.size());
+    }
+#endif
+}
+
 void LocalFileSystem::syncFile(const FileInfo& fileInfo) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
 #if defined(_WIN32)
@@ -102,6 +102,13 @@ void VirtualFileSystem::cleanUP(main::ClientContext* context) {
     defaultFS->cleanUP(context);
 }
 
+void VirtualFileSystem::releaseMemory() {
+    for (auto& subSystem : subSystems) {
+        subSystem->releaseMemory();
+    }
+    defaultFS->releaseMemory();
+}
+
 bool VirtualFileSystem::handleFileViaFunction(const std::string& path) const {
     return findFileSystem(path)->handleFileViaFunction(path);
 }
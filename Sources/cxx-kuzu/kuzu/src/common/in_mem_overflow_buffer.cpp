@@ -25,6 +25,7 @@ uint8_t* BufferBlock::data() const {
 uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
     if (requireNewBlock(size)) {
         if (!blocks.empty() && currentBlock()->currentOffset == 0) {
+            freeBlocks.push_back(std::move(blocks.back()));
             blocks.pop_back();
         }
         allocateNewBlock(size);
@@ -35,12 +36,12 @@ uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
 }
 
 void InMemOverflowBuffer::resetBuffer() {
-    if (!blocks.empty()) {
-        // Last block is usually the largest
-        auto lastBlock = std::move(blocks.back());
-        blocks.clear();
-        lastBlock->resetCurrentOffset();
-        blocks.push_back(std::move(lastBlock));
+    // Blocks which were not reused since the last reset are released, so that the buffer only keeps
+    // as much memory as the allocations between two resets need.
+    freeBlocks = std::move(blocks);
+    blocks.clear();
+    for (auto& block : freeBlocks) {
+        block->resetCurrentOffset();
     }
 }
 
@@ -48,10 +49,40 @@ void InMemOverflowBuffer::preventDestruction() {
     for (auto& block : blocks) {
         block->block->preventDestruction();
     }
+    for (auto& block : freeBlocks) {
+        block->block->preventDestruction();
+    }
+}
+
+uint64_t InMemOverflowBuffer::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->size();
+    }
+    for (auto& block : freeBlocks) {
+        memoryUsage += block->size();
+    }
+    return memoryUsage;
+}
+
+std::unique_ptr<BufferBlock> InMemOverflowBuffer::getFreeBlock(uint64_t size) {
+    // Blocks grow in size, so the last free block is usually the largest.
+    for (auto it = freeBlocks.rbegin(); it != freeBlocks.rend(); ++it) {
+        if ((*it)->size() >= size) {
+            auto block = std::move(*it);
+            freeBlocks.erase(std::next(it).base());
+            return block;
+        }
+    }
+    return nullptr;
 }
 
 void InMemOverflowBuffer::allocateNewBlock(uint64_t size) {
-    std::unique_ptr<BufferBlock> newBlock;
+    auto newBlock = getFreeBlock(size);
+    if (newBlock) {
+        blocks.push_back(std::move(newBlock));
+        return;
+    }
     if (blocks.empty()) {
         newBlock = make_unique<BufferBlock>(
             memoryManager->allocateBuffer(false /* do not initialize to zero */, size));
@@ -6,6 +6,10 @@ namespace kuzu {
 namespace common {
 
 std::unique_ptr<SemiMask> SemiMaskUtil::createMask(offset_t maxOffset) {
+    return std::make_unique<AdaptiveSemiMask>(maxOffset, createRoaringMask(maxOffset));
+}
+
+std::unique_ptr<SemiMask> SemiMaskUtil::createRoaringMask(offset_t maxOffset) {
     if (maxOffset > std::numeric_limits<uint32_t>::max()) {
         return std::make_unique<Roaring64BitmapSemiMask>(maxOffset);
     }
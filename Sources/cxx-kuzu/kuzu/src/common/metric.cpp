@@ -3,7 +3,9 @@
 namespace kuzu {
 namespace common {
 
-TimeMetric::TimeMetric(bool enable) : Metric(enable) {
+TimeMetric::TimeMetric(bool enable, uint64_t samplingInterval)
+    : Metric(enable), samplingInterval{samplingInterval}, numStarts{0}, numTimedStarts{0} {
+    KU_ASSERT(samplingInterval > 0);
     accumulatedTime = 0;
     isStarted = false;
     timer = Timer();
@@ -13,6 +15,10 @@ void TimeMetric::start() {
     if (!enabled) {
         return;
     }
+    if (numStarts++ % samplingInterval != 0) {
+        return;
+    }
+    numTimedStarts++;
     isStarted = true;
     timer.start();
 }
@@ -22,6 +28,10 @@ void TimeMetric::stop() {
         return;
     }
     if (!isStarted) {
+        if (samplingInterval > 1) {
+            // This start()/stop() pair is not sampled.
+            return;
+        }
         throw Exception("Timer metric has not started.");
     }
     timer.stop();
@@ -30,7 +40,10 @@ void TimeMetric::stop() {
 }
 
 double TimeMetric::getElapsedTimeMS() const {
-    return accumulatedTime / 1000;
+    if (numTimedStarts == 0) {
+        return 0;
+    }
+    return accumulatedTime * numStarts / numTimedStarts / 1000;
 }
 
 NumericMetric::NumericMetric(bool enable) : Metric(enable) {
@@ -0,0 +1,149 @@
+#include "common/numa_utils.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#endif
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace common {
+
+namespace {
+
+struct NumaTopology {
+    // CPUs of each NUMA node. There is always at least one node.
+    std::vector<std::vector<uint32_t>> nodeCPUs;
+    // NUMA node of each CPU.
+    std::vector<uint32_t> cpuNodes;
+
+    NumaTopology();
+};
+
+#if defined(__linux__)
+// Parses a cpulist such as "0-15,32-47".
+static std::vector<uint32_t> parseCPUList(const std::string& cpuList) {
+    std::vector<uint32_t> cpus;
+    size_t pos = 0;
+    while (pos < cpuList.size()) {
+        auto end = cpuList.find(',', pos);
+        if (end == std::string::npos) {
+            end = cpuList.size();
+        }
+        auto range = cpuList.substr(pos, end - pos);
+        pos = end + 1;
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        auto dash = range.find('-');
+        try {
+            auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+            auto last = dash == std::string::npos ?
+                            first :
+                            static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+            for (auto cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        } catch (std::exception&) {
+            return {};
+        }
+    }
+    return cpus;
+}
+#endif
+
+NumaTopology::NumaTopology() {
+#if defined(__linux__)
+    std::error_code errorCode;
+    uint32_t node = 0;
+    while (true) {
+        auto nodePath = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+        if (!std::filesystem::exists(nodePath, errorCode)) {
+            break;
+        }
+        std::ifstream file{nodePath};
+        std::string cpuList;
+        std::getline(file, cpuList);
+        nodeCPUs.push_back(parseCPUList(cpuList));
+        node++;
+    }
+    for (auto i = 0u; i < nodeCPUs.size(); i++) {
+        for (auto cpu : nodeCPUs[i]) {
+            if (cpu >= cpuNodes.size()) {
+                cpuNodes.resize(cpu + 1, 0);
+            }
+            cpuNodes[cpu] = i;
+        }
+    }
+#endif
+    if (nodeCPUs.empty()) {
+        nodeCPUs.emplace_back();
+    }
+}
+
+const NumaTopology& getTopology() {
+    static const NumaTopology topology;
+    return topology;
+}
+
+} // namespace
+
+uint32_t NumaUtils::getNumNodes() {
+    return getTopology().nodeCPUs.size();
+}
+
+const std::vector<uint32_t>& NumaUtils::getCPUsOfNode(uint32_t node) {
+    KU_ASSERT(node < getNumNodes());
+    return getTopology().nodeCPUs[node];
+}
+
+uint32_t NumaUtils::getCurrentNode() {
+#if defined(__linux__)
+    auto& topology = getTopology();
+    if (topology.nodeCPUs.size() > 1) {
+        auto cpu = sched_getcpu();
+        if (cpu >= 0 && static_cast<uint32_t>(cpu) < topology.cpuNodes.size()) {
+            return topology.cpuNodes[cpu];
+        }
+    }
+#endif
+    return 0;
+}
+
+bool NumaUtils::pinCurrentThreadToNode(uint32_t node) {
+#if defined(__linux__)
+    auto& cpus = getCPUsOfNode(node);
+    if (cpus.empty()) {
+        return false;
+    }
+    // Only the CPUs the thread is allowed to run on (e.g. restricted by taskset or a cgroup) are
+    // kept, so that pinning never widens the affinity of the process.
+    cpu_set_t allowedCPUSet;
+    CPU_ZERO(&allowedCPUSet);
+    if (sched_getaffinity(0, sizeof(allowedCPUSet), &allowedCPUSet) != 0) {
+        return false;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowedCPUSet)) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    if (CPU_COUNT(&cpuSet) == 0) {
+        return false;
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    KU_UNUSED(node);
+    return false;
+#endif
+}
+
+} // namespace common
+} // namespace kuzu
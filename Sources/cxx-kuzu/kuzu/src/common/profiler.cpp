@@ -4,14 +4,15 @@ namespace kuzu {
 namespace common {
 
 TimeMetric* Profiler::registerTimeMetric(const std::string& key) {
-    auto timeMetric = std::make_unique<TimeMetric>(enabled);
+    auto timeMetric =
+        std::make_unique<TimeMetric>(true /* enable */, enabled ? 1 : TIME_SAMPLING_INTERVAL);
     auto metricPtr = timeMetric.get();
     addMetric(key, std::move(timeMetric));
     return metricPtr;
 }
 
 NumericMetric* Profiler::registerNumericMetric(const std::string& key) {
-    auto numericMetric = std::make_unique<NumericMetric>(enabled);
+    auto numericMetric = std::make_unique<NumericMetric>(true /* enable */);
     auto metricPtr = numericMetric.get();
     addMetric(key, std::move(numericMetric));
     return metricPtr;
@@ -39,6 +40,39 @@ uint64_t Profiler::sumAllNumericMetricsWithKey(const std::string& key) {
     return sum;
 }
 
+std::vector<uint64_t> Profiler::getAllNumericMetricsWithKey(const std::string& key) {
+    std::vector<uint64_t> result;
+    if (!metrics.contains(key)) {
+        return result;
+    }
+    for (auto& metric : metrics.at(key)) {
+        result.push_back(((NumericMetric*)metric.get())->accumulatedValue);
+    }
+    return result;
+}
+
+std::vector<uint64_t> Profiler::getAllNumStartsWithKey(const std::string& key) {
+    std::vector<uint64_t> result;
+    if (!metrics.contains(key)) {
+        return result;
+    }
+    for (auto& metric : metrics.at(key)) {
+        result.push_back(((TimeMetric*)metric.get())->numStarts);
+    }
+    return result;
+}
+
+double Profiler::getElapsedTimeMS() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime)
+        .count();
+}
+
+void Profiler::recordPipelineTask(uint64_t sinkID, double startMS, double endMS) {
+    std::lock_guard<std::mutex> lck(mtx);
+    auto [it, _] = threadIndices.emplace(std::this_thread::get_id(), threadIndices.size());
+    pipelineTasks.push_back(PipelineTaskSpan{sinkID, it->second, startMS, endMS});
+}
+
 void Profiler::addMetric(const std::string& key, std::unique_ptr<Metric> metric) {
     std::lock_guard<std::mutex> lck(mtx);
     if (!metrics.contains(key)) {
@@ -1,8 +1,7 @@
 #include "common/serializer/in_mem_file_writer.h"
 
 #include "storage/file_handle.h"
-#include "storage/shadow_file.h"
-#include "storage/shadow_utils.h"
+#include "storage/page_allocator.h"
 
 namespace kuzu {
 namespace common {
@@ -29,38 +28,30 @@ void InMemFileWriter::write(const uint8_t* data, uint64_t size) {
     }
 }
 
-storage::PageRange InMemFileWriter::flush(storage::PageAllocator& pageAllocator,
-    storage::ShadowFile& shadowFile) const {
+storage::PageRange InMemFileWriter::flush(storage::PageAllocator& pageAllocator) const {
     auto numPagesToFlush = getNumPagesToFlush();
     auto pageRange = pageAllocator.allocatePageRange(numPagesToFlush);
-    flush(pageRange, pageAllocator.getDataFH(), shadowFile);
+    flush(pageRange, pageAllocator.getDataFH());
     return pageRange;
 }
 
-void InMemFileWriter::flush(storage::PageRange allocatedPageRange, storage::FileHandle* fileHandle,
-    storage::ShadowFile& shadowFile) const {
+void InMemFileWriter::flush(storage::PageRange allocatedPageRange,
+    storage::FileHandle* fileHandle) const {
     auto numPagesToWrite = getNumPagesToFlush();
     KU_ASSERT(allocatedPageRange.numPages >= numPagesToWrite);
-    auto numPagesBeforeAllocate = allocatedPageRange.startPageIdx;
     for (auto i = 0u; i < numPagesToWrite; i++) {
-        auto pageIdx = allocatedPageRange.startPageIdx + i;
-        auto insertingNewPage = pageIdx >= numPagesBeforeAllocate;
-        auto shadowPageAndFrame = storage::ShadowUtils::createShadowVersionIfNecessaryAndPinPage(
-            pageIdx, insertingNewPage, *fileHandle, shadowFile);
-        memcpy(shadowPageAndFrame.frame, pages[i]->getData(), KUZU_PAGE_SIZE);
-        shadowFile.getShadowingFH().unpinPage(shadowPageAndFrame.shadowPage);
+        fileHandle->writePageToFile(pages[i]->getData(), allocatedPageRange.startPageIdx + i);
     }
 
     // Write zeroes to any extra pages
     // This ensures that the size of the data file matches the size expected from allocations
     // even if we reload the database immediately after this
-    for (auto i = numPagesToWrite; i < allocatedPageRange.numPages; i++) {
-        auto pageIdx = allocatedPageRange.startPageIdx + i;
-        auto insertingNewPage = pageIdx >= numPagesBeforeAllocate;
-        auto shadowPageAndFrame = storage::ShadowUtils::createShadowVersionIfNecessaryAndPinPage(
-            pageIdx, insertingNewPage, *fileHandle, shadowFile);
-        memset(shadowPageAndFrame.frame, 0u, KUZU_PAGE_SIZE);
-        shadowFile.getShadowingFH().unpinPage(shadowPageAndFrame.shadowPage);
+    if (numPagesToWrite < allocatedPageRange.numPages) {
+        const auto zeroPage = std::make_unique<uint8_t[]>(KUZU_PAGE_SIZE);
+        memset(zeroPage.get(), 0u, KUZU_PAGE_SIZE);
+        for (auto i = numPagesToWrite; i < allocatedPageRange.numPages; i++) {
+            fileHandle->writePageToFile(zeroPage.get(), allocatedPageRange.startPageIdx + i);
+        }
     }
 }
 
@@ -71,6 +62,19 @@ void InMemFileWriter::flush(Writer& writer) const {
     }
 }
 
+void InMemFileWriter::copyTo(uint64_t offset, uint64_t size, uint8_t* data) const {
+    KU_ASSERT(offset + size <= getSize());
+    while (size > 0) {
+        const auto pageIdx = offset / KUZU_PAGE_SIZE;
+        const auto offsetInPage = offset % KUZU_PAGE_SIZE;
+        const auto toCopy = std::min(size, KUZU_PAGE_SIZE - offsetInPage);
+        memcpy(data, pages[pageIdx]->getData() + offsetInPage, toCopy);
+        data += toCopy;
+        offset += toCopy;
+        size -= toCopy;
+    }
+}
+
 bool InMemFileWriter::needNewBuffer(uint64_t size) const {
     return pages.empty() || pageOffset + size > KUZU_PAGE_SIZE;
 }
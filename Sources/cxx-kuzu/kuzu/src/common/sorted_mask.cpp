@@ -0,0 +1,20 @@
+#include "common/sorted_mask.h"
+
+namespace kuzu {
+namespace common {
+
+void SortedSemiMask::mask(offset_t nodeOffset) {
+    auto it = std::lower_bound(offsets.begin(), offsets.end(), nodeOffset);
+    if (it == offsets.end() || *it != nodeOffset) {
+        offsets.insert(it, nodeOffset);
+    }
+}
+
+void SortedSemiMask::maskRange(offset_t startNodeOffset, offset_t endNodeOffset) {
+    for (auto offset = startNodeOffset; offset < endNodeOffset; offset++) {
+        mask(offset);
+    }
+}
+
+} // namespace common
+} // namespace kuzu
@@ -1,5 +1,8 @@
 #include "common/task_system/progress_bar.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "common/task_system/terminal_progress_bar_display.h"
 #include "main/client_context.h"
 
@@ -10,6 +13,9 @@ ProgressBar::ProgressBar(bool enableProgressBar) {
     display = DefaultProgressBarDisplay();
     numPipelines = 0;
     numPipelinesFinished = 0;
+    pipelineProgress = 0;
+    isRunning = false;
+    runningQueryID = INVALID_QUERY_ID;
     trackProgress = enableProgressBar;
 }
 
@@ -22,10 +28,14 @@ void ProgressBar::setDisplay(std::shared_ptr<ProgressBarDisplay> progressBarDips
 }
 
 void ProgressBar::startProgress(uint64_t queryID) {
+    std::lock_guard<std::mutex> lock(progressBarLock);
+    startTime = std::chrono::steady_clock::now();
+    runningQueryID = queryID;
+    pipelineProgress = 0;
+    isRunning = true;
     if (!trackProgress) {
         return;
     }
-    std::lock_guard<std::mutex> lock(progressBarLock);
     updateDisplay(queryID, 0.0);
 }
 
@@ -35,31 +45,67 @@ void ProgressBar::endProgress(uint64_t queryID) {
 }
 
 void ProgressBar::addPipeline() {
+    numPipelines++;
     if (!trackProgress) {
         return;
     }
-    numPipelines++;
     display->setNumPipelines(numPipelines);
 }
 
 void ProgressBar::finishPipeline(uint64_t queryID) {
+    // Pipelines of independent branches may finish concurrently.
+    std::lock_guard<std::mutex> lock(progressBarLock);
+    numPipelinesFinished++;
+    pipelineProgress = 0;
     if (!trackProgress) {
         return;
     }
-    numPipelinesFinished++;
-    updateProgress(queryID, 0.0);
+    updateDisplay(queryID, 0.0);
 }
 
 void ProgressBar::updateProgress(uint64_t queryID, double curPipelineProgress) {
+    auto storedProgress = pipelineProgress.load(std::memory_order_relaxed);
+    if (std::abs(curPipelineProgress - storedProgress) >= PROGRESS_RESOLUTION) {
+        pipelineProgress.store(curPipelineProgress, std::memory_order_relaxed);
+    }
     if (!trackProgress) {
         return;
     }
     updateDisplay(queryID, curPipelineProgress);
 }
 
+QueryProgress ProgressBar::getQueryProgress() {
+    std::lock_guard<std::mutex> lock(progressBarLock);
+    QueryProgress result;
+    // Progress reported without a query ID (e.g. of WAL replay) does not belong to any query of
+    // the connection.
+    result.isRunning = isRunning && runningQueryID != INVALID_QUERY_ID;
+    if (!result.isRunning) {
+        return result;
+    }
+    result.queryID = runningQueryID;
+    result.numPipelines = numPipelines;
+    result.numPipelinesFinished = std::min(numPipelinesFinished.load(), result.numPipelines);
+    result.pipelineProgress = std::clamp(pipelineProgress.load(), 0.0, 1.0);
+    if (result.numPipelines > 0) {
+        result.progress = std::min(
+            (result.numPipelinesFinished + result.pipelineProgress) / result.numPipelines, 1.0);
+    }
+    result.elapsedTimeMS =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime)
+            .count();
+    if (result.progress > 0) {
+        result.estimatedRemainingTimeMS =
+            result.elapsedTimeMS * (1 - result.progress) / result.progress;
+    }
+    return result;
+}
+
 void ProgressBar::resetProgressBar(uint64_t queryID) {
     numPipelines = 0;
     numPipelinesFinished = 0;
+    pipelineProgress = 0;
+    isRunning = false;
     display->finishProgress(queryID);
 }
 
@@ -23,8 +23,17 @@ void Task::deRegisterThreadAndFinalizeTask() {
         }
     }
     if (isCompletedNoLock()) {
+        const auto signal = completionSignal;
         lck.unlock();
         cv.notify_all();
+        if (signal != nullptr) {
+            // Taking the lock orders the notification after the waiting thread has checked the
+            // tasks and started waiting.
+            {
+                lock_t signalLck{signal->mtx};
+            }
+            signal->cv.notify_all();
+        }
     }
 }
 
@@ -1,5 +1,10 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+
+#include "common/exception/interrupt.h"
+#include "common/numa_utils.h"
+#include "common/tracer.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "processor/processor.h"
@@ -15,22 +20,41 @@ namespace common {
 
 #ifndef __SINGLE_THREADED__
 
+// Identifies the scheduler and worker queue owned by the current thread, if it is a worker thread.
+static thread_local const TaskScheduler* currentScheduler = nullptr;
+static thread_local uint64_t currentWorkerIdx = UINT64_MAX;
+
 #if defined(__APPLE__)
 TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos)
 #else
 TaskScheduler::TaskScheduler(uint64_t numWorkerThreads)
 #endif
-    : stopWorkerThreads{false}, nextScheduledTaskID{0} {
+    : stopWorkerThreads{false}, pushEpoch{0}, nextScheduledTaskID{0}, nextQueueIdx{0} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
+    auto numQueues = std::max<uint64_t>(numWorkerThreads, 1);
+    // INTERACTIVE tasks can use every worker. BATCH tasks leave a quarter of the workers free for
+    // interactive work and BACKGROUND tasks use at most a quarter of the workers.
+    classQuotas[static_cast<uint8_t>(SchedulingClass::INTERACTIVE)] = numQueues;
+    classQuotas[static_cast<uint8_t>(SchedulingClass::BATCH)] =
+        std::max<uint64_t>(numQueues - numQueues / 4, 1);
+    classQuotas[static_cast<uint8_t>(SchedulingClass::BACKGROUND)] =
+        std::max<uint64_t>(numQueues / 4, 1);
+    for (auto classIdx = 0u; classIdx < SchedulingClassUtils::NUM_SCHEDULING_CLASSES; ++classIdx) {
+        numActiveWorkersPerClass[classIdx] = 0;
+        maxNumActiveWorkersPerClass[classIdx] = 0;
+    }
+    for (auto i = 0u; i < numQueues; ++i) {
+        workerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
     for (auto n = 0u; n < numWorkerThreads; ++n) {
-        workerThreads.emplace_back([&] { runWorkerThread(); });
+        workerThreads.emplace_back([this, n] { runWorkerThread(n); });
     }
 }
 
 TaskScheduler::~TaskScheduler() {
-    lock_t lck{taskSchedulerMtx};
+    lock_t lck{sleepMtx};
     stopWorkerThreads = true;
     lck.unlock();
     cv.notify_all();
@@ -41,12 +65,27 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
+    if (task->isGroup()) {
+        scheduleGroupAndWaitOrError(*task, context);
+        return;
+    }
     for (auto& dependency : task->children) {
         scheduleTaskAndWaitOrError(dependency, context);
         if (dependency->terminate()) {
             return;
         }
     }
+    // Tasks too small to be worth handing over to the workers run on this thread. Not under a
+    // timeout though, since the timeout is enforced by this thread while it waits for the task.
+    if (task->isInlineTask() && !launchNewWorkerThread &&
+        !context->clientContext->hasTimeout()) {
+        task->registerThread();
+        runTask(task.get());
+        if (task->hasException()) {
+            std::rethrow_exception(task->getExceptionPtr());
+        }
+        return;
+    }
     std::thread newWorkerThread;
     if (launchNewWorkerThread) {
         // Note that newWorkerThread is not executing yet. However, we still call
@@ -57,8 +96,10 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         task->registerThread();
         newWorkerThread = std::thread(runTask, task.get());
     }
-    auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
+    auto scheduledTask = pushTaskIntoQueue(task,
+        task->getSchedulingClass().value_or(
+            context->clientContext->getClientConfig()->schedulingClass));
+    notifyWorkers();
     std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
     while (true) {
         taskLck.lock();
@@ -67,7 +108,7 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         if (task->isCompletedNoLock()) {
             // Note: we do not remove completed tasks from the queue in this function. They will be
             // removed by the worker threads when they traverse down the queue for a task to work on
-            // (see getTaskAndRegister()).
+            // (see getTaskAndRegisterFromQueue()).
             taskLck.unlock();
             break;
         }
@@ -93,12 +134,181 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         newWorkerThread.join();
     }
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
+        removeErroringTask(*scheduledTask);
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+namespace {
+
+// Walks the dependencies of a child of a group in the order scheduleTaskAndWaitOrError schedules
+// them: the dependencies of a task one after another, and then the task itself. Groups nested in
+// the child are walked one child after another.
+class GroupBranch {
+public:
+    explicit GroupBranch(std::shared_ptr<Task> task) { stack.push_back({std::move(task), 0}); }
+
+    // Returns the task to run next, or nullptr once the branch is done.
+    std::shared_ptr<Task> getNextTask() {
+        while (!stack.empty()) {
+            auto& [task, nextChildIdx] = stack.back();
+            if (nextChildIdx == task->children.size()) {
+                return task;
+            }
+            stack.push_back({task->children[nextChildIdx], 0});
+        }
+        return nullptr;
+    }
+    // Called once the task returned by getNextTask() has completed successfully.
+    void completeTask() {
+        auto completed = stack.back().task;
+        stack.pop_back();
+        while (!stack.empty()) {
+            stack.back().nextChildIdx++;
+            if (!completed->terminate()) {
+                break;
+            }
+            // As in scheduleTaskAndWaitOrError, a terminating dependency skips the task it is a
+            // dependency of.
+            completed = stack.back().task;
+            stack.pop_back();
+        }
+    }
+    void stop() { stack.clear(); }
+
+    std::shared_ptr<ScheduledTask> scheduledTask;
+
+private:
+    struct Frame {
+        std::shared_ptr<Task> task;
+        uint64_t nextChildIdx;
+    };
+    std::vector<Frame> stack;
+};
+
+} // namespace
+
+void TaskScheduler::scheduleGroupAndWaitOrError(const Task& group,
+    processor::ExecutionContext* context) {
+    // The children advance concurrently: this thread pushes the next task of a child as soon as
+    // the previous one completes, and the worker threads execute them.
+    auto clientContext = context->clientContext;
+    const auto schedulingClass = clientContext->getClientConfig()->schedulingClass;
+    const auto signal = std::make_shared<TaskCompletionSignal>();
+    std::vector<GroupBranch> branches;
+    for (auto& child : group.children) {
+        branches.emplace_back(child);
+    }
+    std::exception_ptr exceptionPtr = nullptr;
+    bool isInterrupt = false;
+    auto recordException = [&](const std::exception_ptr& childExceptionPtr) {
+        // An error in one child interrupts the others. Report the error rather than the
+        // interrupts it caused.
+        bool childIsInterrupt = false;
+        try {
+            std::rethrow_exception(childExceptionPtr);
+        } catch (InterruptException&) {
+            childIsInterrupt = true;
+        } catch (...) {} // NOLINT
+        if (exceptionPtr == nullptr || (isInterrupt && !childIsInterrupt)) {
+            exceptionPtr = childExceptionPtr;
+            isInterrupt = childIsInterrupt;
+        }
+    };
+    lock_t signalLck{signal->mtx};
+    while (true) {
+        // Completions are only waited for after a pass that changed nothing, under the lock held
+        // since its start, so that no completion is missed.
+        bool madeProgress = false;
+        bool hasRunningTask = false;
+        for (auto& branch : branches) {
+            while (true) {
+                if (branch.scheduledTask != nullptr) {
+                    auto& task = *branch.scheduledTask->task;
+                    lock_t taskLck{task.taskMtx};
+                    if (!task.isCompletedNoLock()) {
+                        hasRunningTask = true;
+                        break;
+                    }
+                    const auto taskExceptionPtr = task.exceptionsPtr;
+                    taskLck.unlock();
+                    madeProgress = true;
+                    if (taskExceptionPtr != nullptr) {
+                        removeErroringTask(*branch.scheduledTask);
+                        recordException(taskExceptionPtr);
+                        branch.scheduledTask = nullptr;
+                        branch.stop();
+                        break;
+                    }
+                    branch.scheduledTask = nullptr;
+                    branch.completeTask();
+                }
+                if (exceptionPtr != nullptr) {
+                    branch.stop();
+                    break;
+                }
+                auto task = branch.getNextTask();
+                if (task == nullptr) {
+                    break;
+                }
+                madeProgress = true;
+                if (task->isGroup()) {
+                    branch.completeTask();
+                    continue;
+                }
+                if (task->isInlineTask() && !clientContext->hasTimeout()) {
+                    signalLck.unlock();
+                    task->registerThread();
+                    runTask(task.get());
+                    signalLck.lock();
+                    if (task->hasException()) {
+                        recordException(task->getExceptionPtr());
+                        branch.stop();
+                        break;
+                    }
+                    branch.completeTask();
+                    continue;
+                }
+                task->completionSignal = signal;
+                branch.scheduledTask = pushTaskIntoQueue(task,
+                    task->getSchedulingClass().value_or(schedulingClass));
+                notifyWorkers();
+            }
+        }
+        if (!hasRunningTask && !madeProgress) {
+            break;
+        }
+        if (madeProgress) {
+            continue;
+        }
+        if (clientContext->hasTimeout()) {
+            const auto timeout = clientContext->getTimeoutRemainingInMS();
+            if (timeout == 0) {
+                clientContext->interrupt();
+                signal->cv.wait(signalLck);
+            } else {
+                signal->cv.wait_for(signalLck, std::chrono::milliseconds(timeout));
+            }
+        } else {
+            if (exceptionPtr != nullptr) {
+                // Interrupt the tasks of the other children, so they stop early.
+                clientContext->interrupt();
+            }
+            signal->cv.wait(signalLck);
+        }
+    }
+    if (exceptionPtr != nullptr) {
+        std::rethrow_exception(exceptionPtr);
+    }
+}
+
+void TaskScheduler::scheduleBackgroundTask(const std::shared_ptr<Task>& task) {
+    // The task is removed from the queue by the workers once it completes.
+    pushTaskIntoQueue(task, SchedulingClass::BACKGROUND);
+    notifyWorkers();
+}
+
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
 #if defined(__APPLE__)
     qos_class_t qosClass = (qos_class_t)threadQos;
     if (qosClass != QOS_CLASS_DEFAULT && qosClass != QOS_CLASS_UNSPECIFIED) {
@@ -106,41 +316,196 @@ void TaskScheduler::runWorkerThread() {
         KU_UNUSED(pthreadQosStatus);
     }
 #endif
-    std::unique_lock<std::mutex> lck{taskSchedulerMtx, std::defer_lock};
+    // Spread workers round-robin over NUMA nodes and keep each on its node, so that the memory a
+    // worker first touches (buffer pool frames, hash tables) is allocated on the node it runs on.
+    if (const auto numNUMANodes = NumaUtils::getNumNodes(); numNUMANodes > 1) {
+        NumaUtils::pinCurrentThreadToNode(workerIdx % numNUMANodes);
+    }
+    currentScheduler = this;
+    currentWorkerIdx = workerIdx;
     std::exception_ptr exceptionPtr = nullptr;
-    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
-    while (true) {
-        // Warning: Threads acquire a global lock (using taskSchedulerMutex) right before
-        // deregistering themselves from a task (and they immediately register themselves for
-        // another task without releasing the lock). This acquire-right-before-deregistering ensures
-        // that all writes that were done by threads in Task_j happen before a Task_{j+1} which
-        // depends on Task_j can start. That's because before Task_{j+1} can start, each thread T_i
-        // working on Task_j will need to deregister itself using the global lock. Therefore, by the
-        // time any thread gets to start on Task_{j+1}, all writes made to Task_j by T_i will become
-        // globally visible because T_i grabbed the global lock before deregistering (and without
-        // T_i deregistering Task_{j+1} cannot start).
-        lck.lock();
-        if (scheduledTask != nullptr) {
-            if (exceptionPtr != nullptr) {
-                scheduledTask->task->setException(exceptionPtr);
-                exceptionPtr = nullptr;
+    while (!stopWorkerThreads) {
+        // Read the epoch before looking for work. If a task is pushed after we failed to find one,
+        // the epoch will have changed and we will not go to sleep.
+        auto observedEpoch = pushEpoch.load(std::memory_order_acquire);
+        auto scheduledTask = getTaskAndRegister(workerIdx);
+        if (scheduledTask == nullptr) {
+            auto wakeUp = [&] {
+                return stopWorkerThreads ||
+                       pushEpoch.load(std::memory_order_acquire) != observedEpoch;
+            };
+            // While tasks are queued, idle workers also wake up periodically so that they notice
+            // tasks that were skipped because of class quotas and have aged since.
+            const auto waitForAging = hasQueuedTasks();
+            lock_t lck{sleepMtx};
+            if (waitForAging) {
+                cv.wait_for(lck, std::chrono::milliseconds(AGING_THRESHOLD_MS), wakeUp);
+            } else {
+                cv.wait(lck, wakeUp);
             }
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            scheduledTask = nullptr;
-        }
-        cv.wait(lck, [&] {
-            scheduledTask = getTaskAndRegister();
-            return scheduledTask != nullptr || stopWorkerThreads;
-        });
-        lck.unlock();
-        if (stopWorkerThreads) {
-            return;
+            continue;
         }
+        // The worker was counted against the quota of the task's class when it registered.
         try {
             scheduledTask->task->run();
         } catch (std::exception& e) {
             exceptionPtr = std::current_exception();
         }
+        releaseQuota(scheduledTask->schedulingClass);
+        // Warning: Threads deregister themselves from a task under the task's lock. A task
+        // Task_{j+1} that depends on Task_j is only pushed by the scheduling thread after it has
+        // observed, under the same lock, that every thread working on Task_j has deregistered.
+        // This ensures that all writes done by threads in Task_j happen before Task_{j+1} can
+        // start, without requiring a global scheduler lock.
+        if (exceptionPtr != nullptr) {
+            scheduledTask->task->setException(exceptionPtr);
+            exceptionPtr = nullptr;
+        }
+        scheduledTask->task->deRegisterThreadAndFinalizeTask();
+    }
+}
+
+uint64_t TaskScheduler::getQueueIdxForCurrentThread() {
+    // Fast path: a worker that schedules work keeps it in its own queue so it can pick it up again
+    // without touching the queues of other workers.
+    if (currentScheduler == this) {
+        return currentWorkerIdx;
+    }
+    return nextQueueIdx.fetch_add(1, std::memory_order_relaxed) % workerQueues.size();
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+    SchedulingClass schedulingClass) {
+    auto queueIdx = getQueueIdxForCurrentThread();
+    auto scheduledTask = std::make_shared<ScheduledTask>(task,
+        nextScheduledTaskID.fetch_add(1, std::memory_order_relaxed), queueIdx, schedulingClass);
+    auto& queue = *workerQueues[queueIdx];
+    lock_t lck{queue.mtx};
+    queue.tasks.push_back(scheduledTask);
+    return scheduledTask;
+}
+
+void TaskScheduler::notifyWorkers() {
+    {
+        lock_t lck{sleepMtx};
+        pushEpoch.fetch_add(1, std::memory_order_release);
+    }
+    cv.notify_all();
+}
+
+bool TaskScheduler::tryAcquireQuota(SchedulingClass schedulingClass) {
+    const auto classIdx = static_cast<uint8_t>(schedulingClass);
+    auto& numActiveWorkers = numActiveWorkersPerClass[classIdx];
+    auto numActive = numActiveWorkers.load(std::memory_order_relaxed);
+    do {
+        if (numActive >= classQuotas[classIdx]) {
+            return false;
+        }
+    } while (!numActiveWorkers.compare_exchange_weak(numActive, numActive + 1,
+        std::memory_order_relaxed));
+    auto& maxNumActiveWorkers = maxNumActiveWorkersPerClass[classIdx];
+    auto maxNumActive = maxNumActiveWorkers.load(std::memory_order_relaxed);
+    while (maxNumActive < numActive + 1 &&
+           !maxNumActiveWorkers.compare_exchange_weak(maxNumActive, numActive + 1,
+               std::memory_order_relaxed)) {}
+    return true;
+}
+
+void TaskScheduler::releaseQuota(SchedulingClass schedulingClass) {
+    numActiveWorkersPerClass[static_cast<uint8_t>(schedulingClass)].fetch_sub(1,
+        std::memory_order_relaxed);
+}
+
+SchedulingClassStats TaskScheduler::getSchedulingClassStats(
+    SchedulingClass schedulingClass) const {
+    const auto classIdx = static_cast<uint8_t>(schedulingClass);
+    SchedulingClassStats stats;
+    stats.workerQuota = classQuotas[classIdx];
+    stats.numActiveWorkers = numActiveWorkersPerClass[classIdx].load(std::memory_order_relaxed);
+    stats.maxNumActiveWorkers =
+        maxNumActiveWorkersPerClass[classIdx].load(std::memory_order_relaxed);
+    return stats;
+}
+
+SchedulingClass TaskScheduler::getEffectiveSchedulingClass(const ScheduledTask& scheduledTask,
+    std::chrono::steady_clock::time_point now) {
+    // Once a worker has picked up a task, the task is no longer waiting, so the other workers
+    // join it with the priority of its own class.
+    if (scheduledTask.isStarted) {
+        return scheduledTask.schedulingClass;
+    }
+    auto waitTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - scheduledTask.enqueueTime);
+    const auto numAgingSteps =
+        std::min<uint64_t>(static_cast<uint64_t>(waitTime.count()) / AGING_THRESHOLD_MS,
+            MAX_AGING_STEPS);
+    const auto classIdx = static_cast<uint64_t>(scheduledTask.schedulingClass);
+    return static_cast<SchedulingClass>(classIdx - std::min(classIdx, numAgingSteps));
+}
+
+bool TaskScheduler::hasQueuedTasks() const {
+    return std::ranges::any_of(workerQueues, [](const auto& queue) {
+        lock_t lck{queue->mtx};
+        return !queue->tasks.empty();
+    });
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx) {
+    const auto numQueues = workerQueues.size();
+    const auto now = std::chrono::steady_clock::now();
+    for (auto classIdx = 0u; classIdx < SchedulingClassUtils::NUM_SCHEDULING_CLASSES; ++classIdx) {
+        auto schedulingClass = static_cast<SchedulingClass>(classIdx);
+        for (auto i = 0u; i < numQueues; ++i) {
+            auto scheduledTask = getTaskAndRegisterFromQueue(
+                *workerQueues[(workerIdx + i) % numQueues], schedulingClass, now);
+            if (scheduledTask != nullptr) {
+                return scheduledTask;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegisterFromQueue(WorkerQueue& queue,
+    SchedulingClass schedulingClass, std::chrono::steady_clock::time_point now) {
+    lock_t lck{queue.mtx};
+    auto it = queue.tasks.begin();
+    while (it != queue.tasks.end()) {
+        auto task = (*it)->task;
+        if (getEffectiveSchedulingClass(**it, now) != schedulingClass ||
+            !tryAcquireQuota((*it)->schedulingClass)) {
+            ++it;
+            continue;
+        }
+        if (!task->registerThread()) {
+            releaseQuota((*it)->schedulingClass);
+            // If we cannot register for a thread it is because of three possibilities:
+            // (i) maximum number of threads have registered for task and the task is completed
+            // without an exception; or (ii) same as (i) but the task has not yet successfully
+            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
+            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
+            // manually removed.
+            if (task->isCompletedSuccessfully()) { // option (i)
+                it = queue.tasks.erase(it);
+            } else { // option (ii) or (iii): keep the task in the queue.
+                ++it;
+            }
+        } else {
+            (*it)->isStarted = true;
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::removeErroringTask(const ScheduledTask& scheduledTask) {
+    auto& queue = *workerQueues[scheduledTask.queueIdx];
+    lock_t lck{queue.mtx};
+    for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it) {
+        if (scheduledTask.ID == (*it)->ID) {
+            queue.tasks.erase(it);
+            return;
+        }
     }
 }
 #else
@@ -159,6 +524,10 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
             return;
         }
     }
+    // The children of a group are executed one after another without threads.
+    if (task->isGroup()) {
+        return;
+    }
     task->registerThread();
     // runTask deregisters, so we don't need to deregister explicitly here
     runTask(task.get());
@@ -167,7 +536,6 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
-#endif
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{taskSchedulerMtx};
@@ -211,8 +579,13 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
         }
     }
 }
+#endif
 
 void TaskScheduler::runTask(Task* task) {
+    std::optional<TraceScope> traceScope;
+    if (Tracer::Get().isEnabled()) [[unlikely]] {
+        traceScope.emplace("task", task->getName());
+    }
     try {
         task->run();
         task->deRegisterThreadAndFinalizeTask();
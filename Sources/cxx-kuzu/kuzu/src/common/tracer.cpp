@@ -0,0 +1,96 @@
+#include "common/tracer.h"
+
+#include "common/file_system/virtual_file_system.h"
+#include "json.hpp"
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace common {
+
+static uint64_t getThreadIdx() {
+    static std::atomic<uint64_t> nextThreadIdx{0};
+    thread_local const uint64_t threadIdx = nextThreadIdx.fetch_add(1, std::memory_order_relaxed);
+    return threadIdx;
+}
+
+Tracer& Tracer::Get() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::start(const std::string& path, main::ClientContext* context) {
+    std::unique_lock lck{mtx};
+    stopNoLock();
+    auto vfs = VirtualFileSystem::GetUnsafe(*context);
+    fileInfo = vfs->openFile(path,
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS), context);
+    filePath = path;
+    fileSystem = vfs;
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::stop() {
+    std::unique_lock lck{mtx};
+    stopNoLock();
+}
+
+void Tracer::stop(const VirtualFileSystem* fileSystem_) {
+    std::unique_lock lck{mtx};
+    if (fileSystem == fileSystem_) {
+        stopNoLock();
+    }
+}
+
+void Tracer::stopNoLock() {
+    if (fileInfo == nullptr) {
+        return;
+    }
+    enabled.store(false, std::memory_order_relaxed);
+    auto traceEvents = nlohmann::json::array();
+    for (auto& event : events) {
+        traceEvents.push_back({{"name", std::move(event.name)}, {"cat", event.category},
+            {"ph", "X"}, {"pid", 0}, {"tid", event.threadIdx}, {"ts", event.startInMicros},
+            {"dur", event.durationInMicros}});
+    }
+    auto json = nlohmann::json();
+    json["traceEvents"] = std::move(traceEvents);
+    json["displayTimeUnit"] = "ms";
+    json["otherData"] = {{"numDroppedEvents", numDroppedEvents}};
+    const auto trace = json.dump();
+    fileInfo->writeFile(reinterpret_cast<const uint8_t*>(trace.data()), trace.size(), 0);
+    fileInfo.reset();
+    fileSystem = nullptr;
+    filePath.clear();
+    events.clear();
+    numDroppedEvents = 0;
+}
+
+std::string Tracer::getFilePath() {
+    std::unique_lock lck{mtx};
+    return filePath;
+}
+
+uint64_t Tracer::getTimeInMicros() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime)
+        .count();
+}
+
+void Tracer::addEvent(const char* category, std::string name, uint64_t startInMicros) {
+    const auto endInMicros = getTimeInMicros();
+    const auto threadIdx = getThreadIdx();
+    std::unique_lock lck{mtx};
+    // Tracing may have stopped since the scope started.
+    if (!isEnabled()) {
+        return;
+    }
+    if (events.size() >= MAX_NUM_EVENTS) {
+        numDroppedEvents++;
+        return;
+    }
+    events.push_back(TraceEvent{category, std::move(name), threadIdx, startInMicros,
+        endInMicros - startInMicros});
+}
+
+} // namespace common
+} // namespace kuzu
@@ -10,7 +10,8 @@ void ExpressionEvaluatorVisitor::visitSwitch(ExpressionEvaluator* evaluator) {
     case EvaluatorType::CASE_ELSE: {
         visitCase(evaluator);
     } break;
-    case EvaluatorType::FUNCTION: {
+    case EvaluatorType::FUNCTION:
+    case EvaluatorType::FUSED: {
         visitFunction(evaluator);
     } break;
     case EvaluatorType::LAMBDA_PARAM: {
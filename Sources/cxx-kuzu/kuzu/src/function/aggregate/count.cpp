@@ -17,6 +17,13 @@ void CountFunction::updateAll(uint8_t* state_, ValueVector* input, uint64_t mult
     state->count += multiplicity * input->countNonNull();
 }
 
+void CountFunction::updateGroups(uint8_t** entries, uint32_t stateOffset, ValueVector* input,
+    uint64_t multiplicity, InMemOverflowBuffer* /*overflowBuffer*/) {
+    input->forEachNonNull([&](auto pos) {
+        reinterpret_cast<CountState*>(entries[pos] + stateOffset)->count += multiplicity;
+    });
+}
+
 void CountFunction::paramRewriteFunc(expression_vector& arguments) {
     KU_ASSERT(arguments.size() == 1);
     if (ExpressionUtil::isNodePattern(*arguments[0])) {
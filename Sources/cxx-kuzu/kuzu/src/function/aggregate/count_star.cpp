@@ -31,5 +31,25 @@ function_set CountStarFunction::getFunctionSet() {
     return result;
 }
 
+void CountStarFromCountsFunction::updateAll(uint8_t* state_, ValueVector* input,
+    uint64_t multiplicity, InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<CountState*>(state_);
+    input->forEachNonNull(
+        [&](auto pos) { state->count += input->getValue<int64_t>(pos) * multiplicity; });
+}
+
+void CountStarFromCountsFunction::updatePos(uint8_t* state_, ValueVector* input,
+    uint64_t multiplicity, uint32_t pos, InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<CountState*>(state_);
+    state->count += input->getValue<int64_t>(pos) * multiplicity;
+}
+
+AggregateFunction CountStarFromCountsFunction::getFunction() {
+    auto function = AggregateFunction(name, std::vector<LogicalTypeID>{LogicalTypeID::INT64},
+        LogicalTypeID::INT64, initialize, updateAll, updatePos, combine, finalize, false);
+    function.needToHandleNulls = true;
+    return function;
+}
+
 } // namespace function
 } // namespace kuzu
@@ -18,8 +18,10 @@ struct Rand {
 
 function_set RandFunction::getFunctionSet() {
     function_set result;
-    result.push_back(std::make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
-        LogicalTypeID::DOUBLE, ScalarFunction::NullaryAuxilaryExecFunction<double, Rand>));
+    auto function = std::make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
+        LogicalTypeID::DOUBLE, ScalarFunction::NullaryAuxilaryExecFunction<double, Rand>);
+    function->isDeterministic = false;
+    result.push_back(std::move(function));
     return result;
 }
 
@@ -17,9 +17,12 @@ struct SetSeed {
 
 function_set SetSeedFunction::getFunctionSet() {
     function_set result;
-    result.push_back(
+    auto function =
         std::make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{LogicalTypeID::DOUBLE},
-            LogicalTypeID::INT32, ScalarFunction::UnarySetSeedFunction<double, int, SetSeed>));
+            LogicalTypeID::INT32, ScalarFunction::UnarySetSeedFunction<double, int, SetSeed>);
+    // Seeding the random engine of the client is a side effect.
+    function->isDeterministic = false;
+    result.push_back(std::move(function));
     return result;
 }
 
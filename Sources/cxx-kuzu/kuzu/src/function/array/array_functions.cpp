@@ -126,10 +126,62 @@ static LogicalType validateArrayFunctionParameters(const LogicalType& leftType,
             functionName));
 }
 
+// Computes the operation between a flat array, e.g. the query vector of a similarity search, and
+// a batch of arrays. The flat array is resolved once and the batch is read directly from the
+// child data of its vector instead of going through the binary executor row by row.
+template<typename OPERATION, typename RESULT>
+static void executeAgainstFlatArray(const std::vector<std::shared_ptr<ValueVector>>& params,
+    const std::vector<SelectionVector*>& paramSelVectors, ValueVector& result,
+    SelectionVector* resultSelVector, void* dataPtr) {
+    KU_ASSERT(params.size() == 2);
+    const auto leftFlat = params[0]->state->isFlat();
+    if (leftFlat == params[1]->state->isFlat()) {
+        ScalarFunction::BinaryExecListStructFunction<list_entry_t, list_entry_t, RESULT,
+            OPERATION>(params, paramSelVectors, result, resultSelVector, dataPtr);
+        return;
+    }
+    const auto flatIdx = leftFlat ? 0 : 1;
+    auto& flatVector = *params[flatIdx];
+    auto& batchVector = *params[1 - flatIdx];
+    auto& batchSelVector = *paramSelVectors[1 - flatIdx];
+    result.resetAuxiliaryBuffer();
+    const auto flatPos = (*paramSelVectors[flatIdx])[0];
+    if (flatVector.isNull(flatPos)) {
+        result.setAllNull();
+        return;
+    }
+    const auto flatEntry = flatVector.getValue<list_entry_t>(flatPos);
+    const auto flatValues =
+        reinterpret_cast<const RESULT*>(ListVector::getListValues(&flatVector, flatEntry));
+    const auto batchValues =
+        reinterpret_cast<const RESULT*>(ListVector::getDataVector(&batchVector)->getData());
+    const auto batchEntries = reinterpret_cast<const list_entry_t*>(batchVector.getData());
+    auto resultValues = reinterpret_cast<RESULT*>(result.getData());
+    const auto noNullsGuaranteed = batchVector.hasNoNullsGuarantee();
+    if (noNullsGuaranteed) {
+        result.setAllNonNull();
+    }
+    for (auto i = 0u; i < batchSelVector.getSelSize(); i++) {
+        const auto pos = batchSelVector[i];
+        const auto resultPos = (*resultSelVector)[i];
+        if (!noNullsGuaranteed) {
+            result.setNull(resultPos, batchVector.isNull(pos));
+            if (result.isNull(resultPos)) {
+                continue;
+            }
+        }
+        const auto& entry = batchEntries[pos];
+        KU_ASSERT(entry.size == flatEntry.size);
+        const auto batchElements = batchValues + entry.offset;
+        resultValues[resultPos] =
+            leftFlat ? OPERATION::compute(flatValues, batchElements, entry.size) :
+                       OPERATION::compute(batchElements, flatValues, entry.size);
+    }
+}
+
 template<typename OPERATION, typename RESULT>
 static scalar_func_exec_t getBinaryArrayExecFuncSwitchResultType() {
-    auto execFunc =
-        ScalarFunction::BinaryExecListStructFunction<list_entry_t, list_entry_t, RESULT, OPERATION>;
+    auto execFunc = executeAgainstFlatArray<OPERATION, RESULT>;
     return execFunc;
 }
 
@@ -225,12 +225,21 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(FreeSpaceInfoFunction), TABLE_FUNCTION(ShowWarningsFunction),
         TABLE_FUNCTION(TableInfoFunction), TABLE_FUNCTION(ShowConnectionFunction),
         TABLE_FUNCTION(StatsInfoFunction), TABLE_FUNCTION(StorageInfoFunction),
+        TABLE_FUNCTION(StorageSummaryFunction),
         TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(ShowSequencesFunction),
         TABLE_FUNCTION(ShowFunctionsFunction), TABLE_FUNCTION(BMInfoFunction),
         TABLE_FUNCTION(FileInfoFunction), TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
-        TABLE_FUNCTION(ShowMacrosFunction),
+        TABLE_FUNCTION(ShowMacrosFunction), TABLE_FUNCTION(QueryPlanCacheInfoFunction),
+        TABLE_FUNCTION(QueryStatsFunction), TABLE_FUNCTION(IOStatsFunction),
+        TABLE_FUNCTION(SchedulerInfoFunction),
+        TABLE_FUNCTION(WALInfoFunction), TABLE_FUNCTION(SlowQueriesFunction),
+        TABLE_FUNCTION(AggregateViewFunction), TABLE_FUNCTION(QueryAttachedFunction),
+        TABLE_FUNCTION(ReverseIndexInfoFunction),
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+        TABLE_FUNCTION(DebugSlabAllocatorFunction), TABLE_FUNCTION(DebugUpdateVersionsFunction),
+#endif
 
         // Standalone Table functions
         STANDALONE_TABLE_FUNCTION(LocalCacheArrayColumnFunction),
@@ -238,6 +247,16 @@ FunctionCollection* FunctionCollection::getFunctions() {
         STANDALONE_TABLE_FUNCTION(ProjectGraphNativeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphCypherFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectedGraphFunction),
+        STANDALONE_TABLE_FUNCTION(AnalyzeFunction),
+        STANDALONE_TABLE_FUNCTION(CreateSortedIndexFunction),
+        STANDALONE_TABLE_FUNCTION(DropSortedIndexFunction),
+        STANDALONE_TABLE_FUNCTION(CreateAggregateViewFunction),
+        STANDALONE_TABLE_FUNCTION(DropAggregateViewFunction),
+        STANDALONE_TABLE_FUNCTION(CreateReverseIndexFunction),
+        STANDALONE_TABLE_FUNCTION(DropReverseIndexFunction),
+        STANDALONE_TABLE_FUNCTION(VacuumFunction),
+        STANDALONE_TABLE_FUNCTION(BackupFunction), STANDALONE_TABLE_FUNCTION(ShipWALFunction),
+        STANDALONE_TABLE_FUNCTION(ReplayWALFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -271,6 +271,30 @@ public:
         return activeNodes;
     }
 
+    bool canPull() const override { return true; }
+
+    // Same as pushing, nodes visited in this iteration still need the multiplicities of their
+    // other neighbors in the current frontier.
+    bool needPull(offset_t offset) override {
+        auto nbrVal = frontierPair->getNextFrontierValue(offset);
+        return nbrVal == FRONTIER_UNVISITED || nbrVal == frontierPair->getCurrentIter();
+    }
+
+    bool pullEdgeCompute(nodeID_t nbrNodeID, NbrScanState::Chunk& resultChunk, bool) override {
+        auto isActive = false;
+        resultChunk.forEach([&](auto neighbors, auto, auto i) {
+            auto boundOffset = neighbors[i].offset;
+            if (!frontierPair->isActiveOnCurrentFrontier(boundOffset)) {
+                return;
+            }
+            // Only the thread pulling into nbrNodeID updates its multiplicity.
+            multiplicitiesPair->increaseNextMultiplicity(nbrNodeID.offset,
+                multiplicitiesPair->getCurrentMultiplicity(boundOffset));
+            isActive = true;
+        });
+        return isActive;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<ASPDestinationsEdgeCompute>(frontierPair, multiplicitiesPair);
     }
@@ -21,6 +21,13 @@ void FrontierMorselDispatcher::init(offset_t _maxOffset) {
     morselSize = std::max(MIN_FRONTIER_MORSEL_SIZE, idealMorselSize);
 }
 
+void FrontierMorselDispatcher::init(offset_t _maxOffset, uint64_t _morselSize) {
+    KU_ASSERT(_morselSize > 0);
+    maxOffset = _maxOffset;
+    nextOffset.store(0u);
+    morselSize = _morselSize;
+}
+
 bool FrontierMorselDispatcher::getNextRangeMorsel(FrontierMorsel& frontierMorsel) {
     auto beginOffset = nextOffset.fetch_add(morselSize, std::memory_order_acq_rel);
     if (beginOffset >= maxOffset) {
@@ -6,9 +6,12 @@
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/exception/binder.h"
+#include "common/exception/runtime.h"
 #include "function/table/bind_input.h"
 #include "graph/graph_entry_set.h"
+#include "graph/graph_snapshot.h"
 #include "graph/on_disk_graph.h"
+#include "main/client_context.h"
 #include "parser/parser.h"
 #include "planner/operator/logical_table_function_call.h"
 #include "planner/operator/sip/logical_semi_masker.h"
@@ -70,7 +73,43 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context, const std::
     if (entry->type != GraphEntryType::NATIVE) {
         throw BinderException("AA");
     }
-    return bindGraphEntry(context, entry->cast<ParsedNativeGraphEntry>());
+    auto& nativeEntry = entry->cast<ParsedNativeGraphEntry>();
+    auto result = bindGraphEntry(context, nativeEntry);
+    result.resultCache = nativeEntry.resultCache;
+    if (nativeEntry.materialize) {
+        materializeGraph(context, name, nativeEntry, result);
+        result.snapshot = nativeEntry.snapshot;
+    }
+    return result;
+}
+
+void GDSFunction::materializeGraph(ClientContext& context, const std::string& graphName,
+    ParsedNativeGraphEntry& parsedGraphEntry, const NativeGraphEntry& entry) {
+    KU_ASSERT(parsedGraphEntry.materialize);
+    auto transaction = transaction::Transaction::Get(context);
+    if (parsedGraphEntry.snapshot != nullptr &&
+        parsedGraphEntry.snapshot->canBeReadBy(transaction)) {
+        return;
+    }
+    // The stale snapshot is diffed against the new one to find the nodes touched since, and
+    // released before the new one is checked against the memory limit.
+    auto snapshot = GraphSnapshot::build(context, entry, parsedGraphEntry.relabel,
+        parsedGraphEntry.snapshot.get());
+    parsedGraphEntry.snapshot = nullptr;
+    if (snapshot == nullptr) {
+        return;
+    }
+    // Falling back to the tables would rebuild the snapshot on every call, so fail instead.
+    const auto memoryUsage =
+        GraphEntrySet::Get(context)->getSnapshotMemoryUsage() + snapshot->getMemoryUsage();
+    const auto memoryLimit = context.getClientConfig()->projectedGraphMemoryLimit;
+    if (memoryUsage > memoryLimit) {
+        throw RuntimeException(
+            stringFormat("Cannot materialize projected graph {}: its snapshot takes {} bytes, which "
+                         "exceeds projected_graph_memory_limit ({} bytes).",
+                graphName, snapshot->getMemoryUsage(), memoryLimit));
+    }
+    parsedGraphEntry.snapshot = std::move(snapshot);
 }
 
 static NativeGraphEntryTableInfo bindNodeEntry(ClientContext& context, const std::string& tableName,
@@ -175,8 +175,17 @@ std::unique_ptr<DenseFrontier> DenseFrontier::getVisitedFrontier(ExecutionContex
         frontier->pinTableID(tableID);
         if (maskMap->containsTableID(tableID)) {
             auto mask = maskMap->getOffsetMask(tableID);
-            for (auto i = 0u; i < numNodes; ++i) {
-                if (!mask->isMasked(i)) {
+            // Masked offsets are collected a vector at a time rather than looked up one by one.
+            for (offset_t start = 0; start < numNodes; start += DEFAULT_VECTOR_CAPACITY) {
+                const auto end = std::min<offset_t>(start + DEFAULT_VECTOR_CAPACITY, numNodes);
+                auto nextMasked = start;
+                for (auto maskedOffset : mask->range(start, end)) {
+                    for (auto i = nextMasked; i < maskedOffset; ++i) {
+                        frontier->curData[i].store(FRONTIER_UNVISITED);
+                    }
+                    nextMasked = maskedOffset + 1;
+                }
+                for (auto i = nextMasked; i < end; ++i) {
                     frontier->curData[i].store(FRONTIER_UNVISITED);
                 }
             }
@@ -215,6 +224,7 @@ void FrontierPair::beginNewIteration() {
     std::unique_lock<std::mutex> lck{mtx};
     curIter++;
     hasActiveNodesForNextIter_.store(false);
+    numActiveNodesInCurrentIter = numActiveNodesForNextIter.exchange(0);
     beginNewIterationInternalNoLock();
 }
 
@@ -310,6 +320,34 @@ offset_t SPFrontierPair::getNumActiveNodesInCurrentFrontier(NodeOffsetMaskMap& m
     return result;
 }
 
+std::vector<nodeID_t> SPFrontierPair::getNextFrontierNodes() {
+    std::vector<nodeID_t> result;
+    switch (state) {
+    case GDSDensityState::SPARSE: {
+        for (auto& [tableID, map] : sparseFrontier->sparseObjects.getData()) {
+            for (auto [offset, iter] : map) {
+                if (iter == curIter) {
+                    result.push_back({offset, tableID});
+                }
+            }
+        }
+    } break;
+    case GDSDensityState::DENSE: {
+        for (auto& [tableID, maxNumNodes] : denseFrontier->nodeMaxOffsetMap) {
+            denseFrontier->pinTableID(tableID);
+            for (auto offset = 0u; offset < maxNumNodes; ++offset) {
+                if (denseFrontier->getIteration(offset) == curIter) {
+                    result.push_back({offset, tableID});
+                }
+            }
+        }
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return result;
+}
+
 std::unordered_set<offset_t> SPFrontierPair::getActiveNodesOnCurrentFrontier() {
     KU_ASSERT(state == GDSDensityState::SPARSE);
     std::unordered_set<offset_t> result;
@@ -388,6 +426,129 @@ void DenseSparseDynamicFrontierPair::switchToDense(ExecutionContext* context, Gr
     }
 }
 
+void DeltaSteppingNextFrontier::addNode(nodeID_t nodeID, iteration_t) {
+    std::unique_lock<std::mutex> lck{mtx};
+    nodes[nodeID.tableID].push_back(nodeID.offset);
+    numNodes++;
+}
+
+void DeltaSteppingNextFrontier::addNode(offset_t offset, iteration_t) {
+    KU_ASSERT(curTableID != INVALID_TABLE_ID);
+    std::unique_lock<std::mutex> lck{mtx};
+    nodes[curTableID].push_back(offset);
+    numNodes++;
+}
+
+void DeltaSteppingNextFrontier::addNodes(const std::vector<nodeID_t>& nodeIDs, iteration_t) {
+    if (nodeIDs.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lck{mtx};
+    for (auto& nodeID : nodeIDs) {
+        nodes[nodeID.tableID].push_back(nodeID.offset);
+    }
+    numNodes += nodeIDs.size();
+}
+
+DeltaSteppingFrontierPair::DeltaSteppingFrontierPair(
+    table_id_map_t<offset_t> nodeMaxOffsetMap, std::unique_ptr<NodeCostReader> costReader)
+    : nodeMaxOffsetMap{std::move(nodeMaxOffsetMap)}, costReader{std::move(costReader)} {
+    bucketingFrontier = std::make_unique<DeltaSteppingNextFrontier>();
+    sparseFrontier = std::make_unique<SparseFrontier>(this->nodeMaxOffsetMap);
+    currentFrontier = sparseFrontier.get();
+    nextFrontier = bucketingFrontier.get();
+}
+
+void DeltaSteppingFrontierPair::beginNewIterationInternalNoLock() {
+    // Delta-stepping may take more iterations than iteration_t can count. Nodes are marked active
+    // with the previous iteration, so skip 0 when wrapping around. A node left active from
+    // iterations ago is at worst extended again with its current cost.
+    if (curIter == 0) {
+        curIter = 1;
+    }
+    if (!isDeltaTuned && curIter > 1) {
+        tuneDelta();
+    }
+    bucketNextFrontierNodes();
+    activateLowestBucket();
+    if (!buckets.empty()) {
+        setActiveNodesForNextIter();
+    }
+}
+
+// The first iteration extends the source, so the costs of the nodes it reaches are the weights of
+// the edges of the source. With delta as their mean weight, a bucket spans about one hop, which
+// keeps enough nodes in a bucket to extend while few of them are extended again.
+void DeltaSteppingFrontierPair::tuneDelta() {
+    isDeltaTuned = true;
+    double sumCosts = 0;
+    uint64_t numCosts = 0;
+    for (auto& [tableID, offsets] : bucketingFrontier->nodes) {
+        costReader->pinTableID(tableID);
+        for (auto offset : offsets) {
+            sumCosts += costReader->getCost(offset);
+            numCosts++;
+        }
+    }
+    if (numCosts > 0 && sumCosts > 0) {
+        delta = sumCosts / numCosts;
+    }
+}
+
+uint64_t DeltaSteppingFrontierPair::getBucketIdx(double cost) const {
+    KU_ASSERT(cost != std::numeric_limits<double>::max());
+    static constexpr double MAX_BUCKET_IDX = static_cast<double>(UINT32_MAX);
+    return static_cast<uint64_t>(std::min(cost / delta, MAX_BUCKET_IDX));
+}
+
+void DeltaSteppingFrontierPair::bucketNextFrontierNodes() {
+    for (auto& [tableID, offsets] : bucketingFrontier->nodes) {
+        costReader->pinTableID(tableID);
+        for (auto offset : offsets) {
+            buckets[getBucketIdx(costReader->getCost(offset))][tableID].push_back(offset);
+        }
+        offsets.clear();
+    }
+    bucketingFrontier->numNodes = 0;
+}
+
+void DeltaSteppingFrontierPair::activateLowestBucket() {
+    sparseFrontier = std::make_unique<SparseFrontier>(nodeMaxOffsetMap);
+    currentFrontier = sparseFrontier.get();
+    iteration_t activeIter = curIter - 1;
+    while (!buckets.empty()) {
+        auto bucket = buckets.extract(buckets.begin());
+        auto numActiveNodes = 0u;
+        for (auto& [tableID, offsets] : bucket.mapped()) {
+            costReader->pinTableID(tableID);
+            currentFrontier->pinTableID(tableID);
+            for (auto offset : offsets) {
+                // Skip nodes improved into a lower bucket since, and nodes added twice.
+                if (getBucketIdx(costReader->getCost(offset)) != bucket.key() ||
+                    currentFrontier->getIteration(offset) == activeIter) {
+                    continue;
+                }
+                currentFrontier->addNode(offset, activeIter);
+                numActiveNodes++;
+            }
+        }
+        if (numActiveNodes > 0) {
+            break;
+        }
+    }
+}
+
+std::unordered_set<offset_t> DeltaSteppingFrontierPair::getActiveNodesOnCurrentFrontier() {
+    std::unordered_set<offset_t> result;
+    for (auto& [offset, iter] : *sparseFrontier->curData) {
+        if (iter != curIter - 1) {
+            continue;
+        }
+        result.insert(offset);
+    }
+    return result;
+}
+
 DenseFrontierPair::DenseFrontierPair(std::unique_ptr<DenseFrontier> curDenseFrontier,
     std::unique_ptr<DenseFrontier> nextDenseFrontier)
     : curDenseFrontier{std::move(curDenseFrontier)},
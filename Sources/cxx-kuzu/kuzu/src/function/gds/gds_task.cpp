@@ -4,6 +4,7 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "function/gds/frontier_morsel.h"
 #include "graph/graph.h"
+#include "processor/processor_task.h"
 
 using namespace kuzu::common;
 
@@ -39,6 +40,7 @@ oid_t FrontierTaskInfo::getRelTableID() const {
 }
 
 void FrontierTask::run() {
+    auto memoryScope = processor::ProcessorTask::trackMemory(pipelineMemoryScope);
     FrontierMorsel morsel;
     auto numActiveNodes = 0u;
     auto graph = info.graph;
@@ -81,6 +83,7 @@ void FrontierTask::run() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
@@ -117,11 +120,60 @@ void FrontierTask::runSparse() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
 
+void FrontierPullTask::run() {
+    auto memoryScope = processor::ProcessorTask::trackMemory(pipelineMemoryScope);
+    FrontierMorsel morsel;
+    auto numActiveNodes = 0u;
+    auto graph = info.graph;
+    // The scanned neighbors are candidates of being in the current frontier, so they are in the
+    // bound table.
+    auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
+        info.getBoundTableID(), info.propertiesToScan);
+    auto ec = info.edgeCompute.copy();
+    auto nbrTableID = info.getNbrTableID();
+    // Nbr nodes out of the graph are filtered by the scan when pushing, so skip them here.
+    auto nodeMaskMap = graph->getNodeOffsetMaskMap();
+    SemiMask* nbrNodeMask = nullptr;
+    if (nodeMaskMap != nullptr && nodeMaskMap->containsTableID(nbrTableID)) {
+        nbrNodeMask = nodeMaskMap->getOffsetMask(nbrTableID);
+    }
+    auto fwdEdge = info.direction == ExtendDirection::FWD;
+    auto& frontierPair = sharedState->frontierPair;
+    while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+        for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
+            if (!ec->needPull(offset) ||
+                (nbrNodeMask != nullptr && !nbrNodeMask->isMasked(offset))) {
+                continue;
+            }
+            nodeID_t nodeID = {offset, nbrTableID};
+            auto isActive = false;
+            auto edges =
+                fwdEdge ? graph->scanBwd(nodeID, *scanState) : graph->scanFwd(nodeID, *scanState);
+            for (auto chunk : edges) {
+                if (ec->pullEdgeCompute(nodeID, chunk, fwdEdge) && !isActive) {
+                    isActive = true;
+                    frontierPair.addNodeToNextFrontier(offset);
+                    numActiveNodes++;
+                }
+                if (!ec->needPull(offset)) {
+                    break;
+                }
+            }
+        }
+    }
+    if (numActiveNodes) {
+        frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
+        frontierPair.setActiveNodesForNextIter();
+    }
+}
+
 void VertexComputeTask::run() {
+    auto memoryScope = processor::ProcessorTask::trackMemory(pipelineMemoryScope);
     FrontierMorsel morsel;
     auto graph = info.graph;
     auto localVc = info.vc.copy();
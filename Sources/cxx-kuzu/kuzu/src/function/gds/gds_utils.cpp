@@ -1,8 +1,11 @@
 #include "function/gds/gds_utils.h"
 
+#include <algorithm>
+
 #include "binder/expression/property_expression.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/interrupt.h"
+#include "common/task_system/progress_bar.h"
 #include "common/task_system/task_scheduler.h"
 #include "function/gds/gds_task.h"
 #include "graph/graph.h"
@@ -34,15 +37,38 @@ static std::shared_ptr<FrontierTask> getFrontierTask(const main::ClientContext*
     return std::make_shared<FrontierTask>(numThreads, info, sharedState);
 }
 
+static std::shared_ptr<FrontierPullTask> getFrontierPullTask(const main::ClientContext* context,
+    const GraphRelInfo& relInfo, Graph* graph, ExtendDirection extendDirection,
+    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan) {
+    auto info = FrontierTaskInfo(relInfo.srcTableID, relInfo.dstTableID, relInfo.relGroupEntry,
+        graph, extendDirection, *computeState.edgeCompute, std::move(propertiesToScan));
+    computeState.beginFrontierCompute(info.getBoundTableID(), info.getNbrTableID());
+    auto numThreads = context->getMaxNumThreadForExec();
+    auto sharedState =
+        std::make_shared<FrontierTaskSharedState>(numThreads, *computeState.frontierPair);
+    auto maxOffset =
+        graph->getMaxOffset(transaction::Transaction::Get(*context), info.getNbrTableID());
+    sharedState->morselDispatcher.init(maxOffset);
+    return std::make_shared<FrontierPullTask>(numThreads, info, sharedState);
+}
+
 static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo& relInfo,
     Graph* graph, ExtendDirection extendDirection, const GDSComputeState& computeState,
-    std::vector<std::string> propertiesToScan) {
+    std::vector<std::string> propertiesToScan, bool pull) {
     auto clientContext = context->clientContext;
-    auto task = getFrontierTask(clientContext, relInfo, graph, extendDirection, computeState,
-        std::move(propertiesToScan));
-    if (computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
-        task->runSparse();
-        return;
+    std::shared_ptr<Task> task;
+    if (pull) {
+        KU_ASSERT(computeState.frontierPair->getState() == GDSDensityState::DENSE);
+        task = getFrontierPullTask(clientContext, relInfo, graph, extendDirection, computeState,
+            std::move(propertiesToScan));
+    } else {
+        auto pushTask = getFrontierTask(clientContext, relInfo, graph, extendDirection,
+            computeState, std::move(propertiesToScan));
+        if (computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
+            pushTask->runSparse();
+            return;
+        }
+        task = std::move(pushTask);
     }
 
     // GDSUtils::runFrontiersUntilConvergence is called from a GDSCall operator, which is
@@ -59,7 +85,7 @@ static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo&
 
 static void runOneIteration(ExecutionContext* context, Graph* graph,
     ExtendDirection extendDirection, const GDSComputeState& compState,
-    const std::vector<std::string>& propertiesToScan) {
+    const std::vector<std::string>& propertiesToScan, bool pull) {
     for (auto info : graph->getGraphEntry()->nodeInfos) {
         for (const auto& relInfo : graph->getRelInfos(info.entry->getTableID())) {
             if (context->clientContext->interrupted()) {
@@ -68,17 +94,17 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
             switch (extendDirection) {
             case ExtendDirection::FWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             case ExtendDirection::BWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             case ExtendDirection::BOTH: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             default:
                 KU_UNREACHABLE;
@@ -87,20 +113,57 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
     }
 }
 
+// Iterations done are reported as the progress of the pipeline running the algorithm. Algorithms
+// which converge early finish before reaching the maximum number of iterations.
+static void updateIterationProgress(const ExecutionContext* context,
+    const FrontierPair& frontierPair, uint64_t maxIteration) {
+    const auto numIterations = std::min<uint64_t>(maxIteration, UINT16_MAX);
+    if (numIterations == 0) {
+        return;
+    }
+    ProgressBar::Get(*context->clientContext)
+        ->updateProgress(context->queryID,
+            static_cast<double>(frontierPair.getCurrentIter()) / numIterations);
+}
+
 void GDSUtils::runAlgorithmEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration) {
     auto frontierPair = compState.frontierPair.get();
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
-        runOneIteration(context, graph, extendDirection, compState, {});
+        runOneIteration(context, graph, extendDirection, compState, {}, false /* pull */);
+        updateIterationProgress(context, *frontierPair, maxIteration);
     }
 }
 
 void GDSUtils::runFTSEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection,
+    const std::vector<std::string>& propertiesToScan) {
+    runEdgeComputeIteration(context, compState, graph, extendDirection, propertiesToScan);
+}
+
+void GDSUtils::runEdgeComputeIteration(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection,
     const std::vector<std::string>& propertiesToScan) {
     compState.frontierPair->beginNewIteration();
-    runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+    runOneIteration(context, graph, extendDirection, compState, propertiesToScan,
+        false /* pull */);
+}
+
+// Direction-optimizing traversal (Beamer et al.). Pushing checks the edges of the current
+// frontier, while pulling checks the edges of the unvisited nodes but can stop at the first edge
+// from the current frontier. So we pull once the frontier grows large compared to the unvisited
+// nodes, and push again once it shrinks. Edge counts of the original heuristic are estimated with
+// node counts.
+static constexpr uint64_t PULL_FRONTIER_SIZE_FACTOR = 14;
+static constexpr uint64_t PUSH_FRONTIER_SIZE_FACTOR = 24;
+
+static bool shouldPull(bool isPulling, offset_t numFrontierNodes, offset_t numUnvisitedNodes,
+    offset_t numNodes) {
+    if (!isPulling) {
+        return numFrontierNodes * PULL_FRONTIER_SIZE_FACTOR > numUnvisitedNodes;
+    }
+    return numFrontierNodes * PUSH_FRONTIER_SIZE_FACTOR >= numNodes;
 }
 
 void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
@@ -108,12 +171,28 @@ void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSCompute
     NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
     auto frontierPair = compState.frontierPair.get();
     compState.edgeCompute->resetSingleThreadState();
+    auto canPull = compState.edgeCompute->canPull();
+    offset_t numNodes = 0;
+    if (canPull) {
+        numNodes = graph->getNumNodes(transaction::Transaction::Get(*context->clientContext));
+    }
+    offset_t numVisitedNodes = 0;
+    auto pull = false;
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
             break;
         }
-        runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+        if (canPull) {
+            // Pulling scans all nodes of the nbr tables, so it's only done on dense frontiers.
+            auto numFrontierNodes = frontierPair->getNumActiveNodesInCurrentIter();
+            numVisitedNodes += numFrontierNodes;
+            auto numUnvisitedNodes = numNodes > numVisitedNodes ? numNodes - numVisitedNodes : 0;
+            pull = frontierPair->getState() == GDSDensityState::DENSE &&
+                   shouldPull(pull, numFrontierNodes, numUnvisitedNodes, numNodes);
+        }
+        runOneIteration(context, graph, extendDirection, compState, propertiesToScan, pull);
+        updateIterationProgress(context, *frontierPair, maxIteration);
         if (frontierPair->needSwitchToDense(
                 context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
             compState.switchToDense(context, graph);
@@ -121,6 +200,63 @@ void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSCompute
     }
 }
 
+static ExtendDirection getReverseDirection(ExtendDirection extendDirection) {
+    switch (extendDirection) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    case ExtendDirection::BOTH:
+        return ExtendDirection::BOTH;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+nodeID_t GDSUtils::runBidirectionalSPEdgeCompute(ExecutionContext* context,
+    GDSComputeState& fwdState, GDSComputeState& bwdState, Graph* graph,
+    ExtendDirection extendDirection, uint64_t maxIteration,
+    const std::vector<std::string>& propertiesToScan) {
+    auto fwdPair = fwdState.frontierPair->ptrCast<SPFrontierPair>();
+    auto bwdPair = bwdState.frontierPair->ptrCast<SPFrontierPair>();
+    auto threshold = context->clientContext->getClientConfig()->sparseFrontierThreshold;
+    // The iterations of both searches add up to the length of the path found.
+    while (fwdPair->getCurrentIter() + bwdPair->getCurrentIter() < maxIteration) {
+        auto extendFwd =
+            fwdPair->getNumActiveNodesForNextIter() <= bwdPair->getNumActiveNodesForNextIter();
+        auto& state = extendFwd ? fwdState : bwdState;
+        auto pair = extendFwd ? fwdPair : bwdPair;
+        auto otherFrontier = extendFwd ? bwdPair->getFrontier() : fwdPair->getFrontier();
+        if (!pair->continueNextIter(maxIteration)) {
+            // One search visited all nodes it can reach without meeting the other.
+            break;
+        }
+        pair->beginNewIteration();
+        runOneIteration(context, graph,
+            extendFwd ? extendDirection : getReverseDirection(extendDirection), state,
+            propertiesToScan, false /* pull */);
+        if (pair->needSwitchToDense(threshold)) {
+            state.switchToDense(context, graph);
+        }
+        // The searches meet on the nodes visited in this iteration. Among them, the one with the
+        // shortest distance to the other end is on a shortest path.
+        auto meetNodeID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+        auto minOtherIter = FRONTIER_UNVISITED;
+        for (auto& nodeID : pair->getNextFrontierNodes()) {
+            otherFrontier->pinTableID(nodeID.tableID);
+            auto otherIter = otherFrontier->getIteration(nodeID.offset);
+            if (otherIter < minOtherIter) {
+                minOtherIter = otherIter;
+                meetNodeID = nodeID;
+            }
+        }
+        if (meetNodeID.offset != INVALID_OFFSET) {
+            return meetNodeID;
+        }
+    }
+    return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+}
+
 static void runVertexComputeInternal(const TableCatalogEntry* currentEntry,
     GDSDensityState densityState, const Graph* graph, std::shared_ptr<VertexComputeTask> task,
     ExecutionContext* context) {
@@ -1,5 +1,9 @@
 #include "function/gds/rec_joins.h"
 
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
 namespace kuzu {
 namespace function {
 
@@ -31,5 +35,23 @@ PathsOutputWriterInfo RJBindData::getPathWriterInfo() const {
     return info;
 }
 
+std::unique_ptr<FrontierPair> RJAlgorithm::getWeightedSPFrontierPair(
+    processor::ExecutionContext* context, const RJBindData& bindData, graph::Graph* graph,
+    std::unique_ptr<NodeCostReader> costReader) {
+    // A simple path has fewer hops than there are nodes, so a bound on hops of at least the number
+    // of nodes minus one never cuts off a shortest path. Any lower bound, including the default of
+    // the max depth, is kept by iterating Bellman-Ford style frontiers one hop at a time.
+    auto numNodes = graph->getNumNodes(transaction::Transaction::Get(*context->clientContext));
+    if (static_cast<uint64_t>(bindData.upperBound) + 1 < numNodes) {
+        auto curDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
+        auto nextDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
+        return std::make_unique<DenseSparseDynamicFrontierPair>(std::move(curDenseFrontier),
+            std::move(nextDenseFrontier));
+    }
+    return std::make_unique<DeltaSteppingFrontierPair>(
+        graph->getMaxOffsetMap(transaction::Transaction::Get(*context->clientContext)),
+        std::move(costReader));
+}
+
 } // namespace function
 } // namespace kuzu
@@ -1,7 +1,11 @@
+#include <bit>
+
 #include "binder/expression/node_expression.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
 #include "function/gds/rec_joins.h"
 #include "processor/execution_context.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -75,11 +79,224 @@ public:
         return activeNodes;
     }
 
+    bool canPull() const override { return true; }
+
+    bool needPull(offset_t offset) override {
+        return frontierPair->getNextFrontierValue(offset) == FRONTIER_UNVISITED;
+    }
+
+    // A single neighbor in the current frontier is enough to put nbrNodeID in the next frontier.
+    bool pullEdgeCompute(nodeID_t, NbrScanState::Chunk& resultChunk, bool) override {
+        auto isActive = false;
+        resultChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) {
+            isActive = frontierPair->isActiveOnCurrentFrontier(neighbors[i].offset);
+            return !isActive;
+        });
+        return isActive;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPDestinationsEdgeCompute>(frontierPair);
     }
 };
 
+using lane_mask_t = uint64_t;
+
+// Masks of the sources of a multi-source BFS for each node, where bit i is for the i-th source. A
+// node has the mask of the sources that reached it at any level, and the masks of the sources that
+// reached it at the current and the next level, which alternate by the parity of the level.
+class MultiSourceBFSMasks : public GDSAuxiliaryState {
+public:
+    MultiSourceBFSMasks(const table_id_map_t<offset_t>& maxOffsetMap, storage::MemoryManager* mm,
+        FrontierPair& frontierPair)
+        : frontierPair{frontierPair} {
+        for (auto& [tableID, maxOffset] : maxOffsetMap) {
+            for (auto masks : {&seenMasks, &levelMasks[0], &levelMasks[1]}) {
+                masks->allocate(tableID, maxOffset, mm);
+                auto data = masks->getData(tableID);
+                for (auto i = 0u; i < maxOffset; ++i) {
+                    data[i].store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    void initSource(nodeID_t sourceNodeID, uint64_t sourceIdx) {
+        auto mask = lane_mask_t{1} << sourceIdx;
+        seenMasks.getData(sourceNodeID.tableID)[sourceNodeID.offset].fetch_or(mask);
+        levelMasks[0].getData(sourceNodeID.tableID)[sourceNodeID.offset].fetch_or(mask);
+    }
+
+    // Sources are extended from the nodes of the current level of the iteration in fromTableID.
+    void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
+        auto iter = frontierPair.getCurrentIter();
+        curLevelMasks = levelMasks[(iter - 1) % 2].getData(fromTableID);
+        nextLevelMasks = levelMasks[iter % 2].getData(toTableID);
+        nextSeenMasks = seenMasks.getData(toTableID);
+    }
+
+    void switchToDense(ExecutionContext*, Graph*) override {}
+
+    lane_mask_t getCurLevelMask(offset_t offset) const {
+        return curLevelMasks[offset].load(std::memory_order_relaxed);
+    }
+    lane_mask_t getSeenMask(offset_t offset) const {
+        return nextSeenMasks[offset].load(std::memory_order_relaxed);
+    }
+    void addToNextLevelMask(offset_t offset, lane_mask_t mask) {
+        nextLevelMasks[offset].fetch_or(mask, std::memory_order_relaxed);
+    }
+
+    // Called between levels, when current and next level masks are pinned on the same table.
+    void clearCurLevelMask(offset_t offset) {
+        curLevelMasks[offset].store(0, std::memory_order_relaxed);
+    }
+    // Removes the sources that reached the node at earlier levels from its next level mask, and
+    // returns the sources that reached the node for the first time.
+    lane_mask_t settleNextLevelMask(offset_t offset) {
+        auto mask = nextLevelMasks[offset].load(std::memory_order_relaxed) &
+                    ~nextSeenMasks[offset].load(std::memory_order_relaxed);
+        nextLevelMasks[offset].store(mask, std::memory_order_relaxed);
+        nextSeenMasks[offset].fetch_or(mask, std::memory_order_relaxed);
+        return mask;
+    }
+
+private:
+    FrontierPair& frontierPair;
+    GDSDenseObjectManager<std::atomic<lane_mask_t>> seenMasks;
+    GDSDenseObjectManager<std::atomic<lane_mask_t>> levelMasks[2];
+    std::atomic<lane_mask_t>* curLevelMasks = nullptr;
+    std::atomic<lane_mask_t>* nextLevelMasks = nullptr;
+    std::atomic<lane_mask_t>* nextSeenMasks = nullptr;
+};
+
+// Passes the sources of the current level of the bound node to neighbors they haven't reached.
+// Seen masks are only updated between levels, so a neighbor may get a source twice in the same
+// level, which is filtered when settling the level.
+class MultiSourceBFSEdgeCompute : public EdgeCompute {
+public:
+    explicit MultiSourceBFSEdgeCompute(MultiSourceBFSMasks& masks) : masks{masks} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, NbrScanState::Chunk& resultChunk,
+        bool) override {
+        std::vector<nodeID_t> activeNodes;
+        auto mask = masks.getCurLevelMask(boundNodeID.offset);
+        if (mask == 0) {
+            return activeNodes;
+        }
+        resultChunk.forEach([&](auto neighbors, auto, auto i) {
+            auto nbrNode = neighbors[i];
+            auto newMask = mask & ~masks.getSeenMask(nbrNode.offset);
+            if (newMask != 0) {
+                masks.addToNextLevelMask(nbrNode.offset, newMask);
+                activeNodes.push_back(nbrNode);
+            }
+        });
+        return activeNodes;
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<MultiSourceBFSEdgeCompute>(masks);
+    }
+
+private:
+    MultiSourceBFSMasks& masks;
+};
+
+// Settles the level extended in the last iteration, and writes the destinations reached by each
+// source for the first time.
+class MultiSourceBFSLevelVertexCompute : public VertexCompute {
+public:
+    MultiSourceBFSLevelVertexCompute(storage::MemoryManager* mm,
+        RecursiveExtendSharedState* sharedState, FrontierPair& frontierPair,
+        MultiSourceBFSMasks& masks, const std::vector<nodeID_t>& sources,
+        table_id_set_t nbrTableIDSet)
+        : mm{mm}, sharedState{sharedState}, frontierPair{frontierPair}, masks{masks},
+          sources{sources}, nbrTableIDSet{std::move(nbrTableIDSet)} {
+        localFT = sharedState->factorizedTablePool.claimLocalTable(mm);
+        srcNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        dstNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        lengthVector = createVector(LogicalType::UINT16());
+    }
+    ~MultiSourceBFSLevelVertexCompute() override {
+        sharedState->factorizedTablePool.returnLocalTable(localFT);
+    }
+
+    bool beginOnTable(table_id_t tableID) override {
+        frontierPair.pinCurrentFrontier(tableID);
+        frontierPair.pinNextFrontier(tableID);
+        masks.beginFrontierCompute(tableID, tableID);
+        outputNodeMask = nullptr;
+        auto outputNodeMaskMap = sharedState->getOutputNodeMaskMap();
+        if (outputNodeMaskMap != nullptr && outputNodeMaskMap->containsTableID(tableID)) {
+            outputNodeMask = outputNodeMaskMap->getOffsetMask(tableID);
+        }
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto iter = frontierPair.getCurrentIter();
+        // Nbr node table IDs might be different from graph node table IDs. See
+        // RecursiveExtend::executeInternal.
+        auto writeTable = nbrTableIDSet.contains(tableID);
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            if (frontierPair.isActiveOnCurrentFrontier(offset)) {
+                masks.clearCurLevelMask(offset);
+            }
+            if (frontierPair.getNextFrontierValue(offset) != iter) {
+                continue;
+            }
+            auto newMask = masks.settleNextLevelMask(offset);
+            if (!writeTable || newMask == 0 ||
+                (outputNodeMask != nullptr && outputNodeMask->isEnabled() &&
+                    !outputNodeMask->isMasked(offset))) {
+                continue;
+            }
+            dstNodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, tableID});
+            lengthVector->setValue<uint16_t>(0, iter);
+            while (newMask != 0) {
+                if (sharedState->exceedLimit()) {
+                    return;
+                }
+                auto sourceIdx = std::countr_zero(newMask);
+                newMask &= newMask - 1;
+                srcNodeIDVector->setValue<nodeID_t>(0, sources[sourceIdx]);
+                localFT->append(vectors);
+                if (sharedState->counter != nullptr) {
+                    sharedState->counter->increase(1);
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<MultiSourceBFSLevelVertexCompute>(mm, sharedState, frontierPair,
+            masks, sources, nbrTableIDSet);
+    }
+
+private:
+    std::unique_ptr<ValueVector> createVector(const LogicalType& type) {
+        auto vector = std::make_unique<ValueVector>(type.copy(), mm);
+        vector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(vector.get());
+        return vector;
+    }
+
+private:
+    storage::MemoryManager* mm;
+    RecursiveExtendSharedState* sharedState;
+    FrontierPair& frontierPair;
+    MultiSourceBFSMasks& masks;
+    const std::vector<nodeID_t>& sources;
+    table_id_set_t nbrTableIDSet;
+    SemiMask* outputNodeMask = nullptr;
+    FactorizedTable* localFT;
+    std::vector<ValueVector*> vectors;
+    std::unique_ptr<ValueVector> srcNodeIDVector;
+    std::unique_ptr<ValueVector> dstNodeIDVector;
+    std::unique_ptr<ValueVector> lengthVector;
+};
+
 // Single shortest path algorithm. Only destinations are tracked (reachability query).
 // If there are multiple path to a destination. Only one of the path is tracked.
 class SingleSPDestinationsAlgorithm : public RJAlgorithm {
@@ -98,6 +315,59 @@ public:
         return std::make_unique<SingleSPDestinationsAlgorithm>(*this);
     }
 
+    bool canSearchBidirectionally() const override { return true; }
+
+    bool canRunMultiSourceBFS() const override { return true; }
+
+    // Frontiers stay dense, since the frontier of many sources quickly covers most of the graph.
+    void runMultiSourceBFS(ExecutionContext* context, const RJBindData& bindData,
+        RecursiveExtendSharedState* sharedState,
+        const std::vector<nodeID_t>& sources) override {
+        KU_ASSERT(sources.size() <= MULTI_SOURCE_BFS_MAX_NUM_SOURCES);
+        auto graph = sharedState->graph.get();
+        auto mm = storage::MemoryManager::Get(*context->clientContext);
+        auto transaction = transaction::Transaction::Get(*context->clientContext);
+        auto frontierPair =
+            std::make_shared<DenseFrontierPair>(DenseFrontier::getUnvisitedFrontier(context, graph),
+                DenseFrontier::getUnvisitedFrontier(context, graph));
+        auto masks = std::make_unique<MultiSourceBFSMasks>(graph->getMaxOffsetMap(transaction), mm,
+            *frontierPair);
+        for (auto i = 0u; i < sources.size(); ++i) {
+            frontierPair->pinNextFrontier(sources[i].tableID);
+            frontierPair->addNodeToNextFrontier(sources[i]);
+            masks->initSource(sources[i], i);
+        }
+        frontierPair->setActiveNodesForNextIter();
+        auto& masksRef = *masks;
+        auto edgeCompute = std::make_unique<MultiSourceBFSEdgeCompute>(masksRef);
+        auto computeState =
+            GDSComputeState(frontierPair, std::move(edgeCompute), std::move(masks));
+        auto levelVertexCompute = MultiSourceBFSLevelVertexCompute(mm, sharedState, *frontierPair,
+            masksRef, sources, bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+        while (frontierPair->continueNextIter(bindData.upperBound)) {
+            GDSUtils::runEdgeComputeIteration(context, computeState, graph,
+                bindData.extendDirection, {} /* propertiesToScan */);
+            GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph,
+                levelVertexCompute);
+            if (sharedState->exceedLimit()) {
+                break;
+            }
+        }
+    }
+
+    // The frontiers keep the distances to the source and to the destination.
+    void joinBidirectionalSearch(GDSComputeState& fwdState, GDSComputeState& bwdState,
+        nodeID_t meetNodeID, nodeID_t dstNodeID) override {
+        auto fwdFrontier = fwdState.frontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+        auto bwdFrontier = bwdState.frontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+        fwdFrontier->pinTableID(meetNodeID.tableID);
+        bwdFrontier->pinTableID(meetNodeID.tableID);
+        auto length = fwdFrontier->getIteration(meetNodeID.offset) +
+                      bwdFrontier->getIteration(meetNodeID.offset);
+        fwdFrontier->pinTableID(dstNodeID.tableID);
+        fwdFrontier->addNode(dstNodeID, length);
+    }
+
 private:
     std::unique_ptr<GDSComputeState> getComputeState(ExecutionContext* context, const RJBindData&,
         RecursiveExtendSharedState* sharedState) override {
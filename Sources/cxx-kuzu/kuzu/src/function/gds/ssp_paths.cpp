@@ -71,6 +71,34 @@ public:
         return std::make_unique<SingleSPPathsAlgorithm>(*this);
     }
 
+    bool canSearchBidirectionally() const override { return true; }
+
+    // Parents of the backward BFS graph point towards the destination. Follow them from the
+    // meeting node and add each step as a parent in the forward BFS graph. A node that already has
+    // a forward parent is at the same distance to the source through it, so it is kept.
+    void joinBidirectionalSearch(GDSComputeState& fwdState, GDSComputeState& bwdState,
+        nodeID_t meetNodeID, nodeID_t) override {
+        auto fwdFrontier = fwdState.frontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+        auto fwdGraph = fwdState.auxiliaryState->ptrCast<PathAuxiliaryState>()
+                            ->getBFSGraphManager()
+                            ->getCurrentGraph();
+        auto bwdGraph = bwdState.auxiliaryState->ptrCast<PathAuxiliaryState>()
+                            ->getBFSGraphManager()
+                            ->getCurrentGraph();
+        fwdFrontier->pinTableID(meetNodeID.tableID);
+        auto iter = fwdFrontier->getIteration(meetNodeID.offset);
+        auto block = fwdGraph->addNewBlock();
+        auto nodeID = meetNodeID;
+        for (auto parent = bwdGraph->getParentListHead(nodeID); parent != nullptr;
+             parent = bwdGraph->getParentListHead(nodeID)) {
+            auto nextNodeID = parent->getNodeID();
+            fwdGraph->pinTableID(nextNodeID.tableID);
+            fwdGraph->addSingleParent(++iter, nodeID, parent->getEdgeID(), nextNodeID,
+                !parent->isFwdEdge(), block);
+            nodeID = nextNodeID;
+        }
+    }
+
 private:
     std::unique_ptr<GDSComputeState> getComputeState(ExecutionContext* context, const RJBindData&,
         RecursiveExtendSharedState* sharedState) override {
@@ -180,6 +180,20 @@ private:
     Costs* nextCosts = nullptr;
 };
 
+class CostsPairReader : public NodeCostReader {
+public:
+    explicit CostsPairReader(CostsPair* costsPair) : costsPair{costsPair} {}
+
+    void pinTableID(table_id_t tableID) override { costsPair->pinCurTableID(tableID); }
+
+    double getCost(offset_t offset) override {
+        return costsPair->getCurrentCosts()->getCost(offset);
+    }
+
+private:
+    CostsPair* costsPair;
+};
+
 template<typename T>
 class WSPDestinationsEdgeCompute : public EdgeCompute {
 public:
@@ -302,13 +316,11 @@ private:
         const RJBindData& bindData, RecursiveExtendSharedState* sharedState) override {
         auto clientContext = context->clientContext;
         auto graph = sharedState->graph.get();
-        auto curDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
-        auto nextDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
-        auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(
-            std::move(curDenseFrontier), std::move(nextDenseFrontier));
         auto costsPair = std::make_unique<CostsPair>(
             graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)));
         auto costPairPtr = costsPair.get();
+        auto frontierPair = getWeightedSPFrontierPair(context, bindData, graph,
+            std::make_unique<CostsPairReader>(costPairPtr));
         auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair));
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPDestinationsFunction::name,
@@ -117,13 +117,11 @@ private:
         const RJBindData& bindData, RecursiveExtendSharedState* sharedState) override {
         auto clientContext = context->clientContext;
         auto graph = sharedState->graph.get();
-        auto curDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
-        auto nextDenseFrontier = DenseFrontier::getUninitializedFrontier(context, graph);
-        auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(
-            std::move(curDenseFrontier), std::move(nextDenseFrontier));
         auto bfsGraph = std::make_unique<BFSGraphManager>(
             sharedState->graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)),
             MemoryManager::Get(*clientContext));
+        auto frontierPair = getWeightedSPFrontierPair(context, bindData, graph,
+            std::make_unique<BFSGraphCostReader>(bfsGraph.get()));
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
@@ -1,6 +1,7 @@
 #include "binder/expression/expression_util.h"
 #include "expression_evaluator/expression_evaluator_utils.h"
 #include "function/string/functions/base_regexp_function.h"
+#include "function/string/functions/regexp_literal_filter.h"
 #include "function/string/vector_string_functions.h"
 #include "re2.h"
 
@@ -11,10 +12,11 @@ using namespace common;
 
 struct RegexFullMatchBindData : public FunctionBindData {
     regex::RE2 pattern;
+    RegexpLiteralFilter literalFilter;
 
     explicit RegexFullMatchBindData(common::logical_type_vec_t paramTypes, std::string patternInStr)
         : FunctionBindData{std::move(paramTypes), common::LogicalType::BOOL()},
-          pattern{patternInStr} {}
+          pattern{patternInStr}, literalFilter{RegexpLiteralFilter::get(patternInStr)} {}
 
     std::unique_ptr<FunctionBindData> copy() const override {
         return std::make_unique<RegexFullMatchBindData>(copyVector(paramTypes), pattern.pattern());
@@ -34,7 +36,16 @@ struct RegexpFullMatchStaticPattern : BaseRegexpOperation {
         common::ValueVector& /*rightValueVector*/, common::ValueVector& /*resultValueVector*/,
         void* dataPtr) {
         auto regexFullMatchBindData = reinterpret_cast<RegexFullMatchBindData*>(dataPtr);
-        result = RE2::FullMatch(left.getAsString(), regexFullMatchBindData->pattern);
+        auto& literalFilter = regexFullMatchBindData->literalFilter;
+        if (literalFilter.isExact) {
+            result = literalFilter.equals(left);
+        } else if (!literalFilter.mayMatch(left)) {
+            result = false;
+        } else {
+            result = RE2::FullMatch(
+                regex::StringPiece(reinterpret_cast<const char*>(left.getData()), left.len),
+                regexFullMatchBindData->pattern);
+        }
     }
 };
 
@@ -0,0 +1,162 @@
+#include "function/string/functions/regexp_literal_filter.h"
+
+#include <cctype>
+#include <cstring>
+
+#include "function/string/functions/find_function.h"
+
+namespace kuzu {
+namespace function {
+
+// Returns the position after the closing bracket of the character class starting at pos.
+static size_t skipCharacterClass(const std::string& pattern, size_t pos) {
+    pos++;
+    if (pos < pattern.size() && pattern[pos] == '^') {
+        pos++;
+    }
+    // A closing bracket right after the opening one is part of the class.
+    if (pos < pattern.size() && pattern[pos] == ']') {
+        pos++;
+    }
+    while (pos < pattern.size() && pattern[pos] != ']') {
+        pos += pattern[pos] == '\\' ? 2 : 1;
+    }
+    return pos + 1;
+}
+
+// Returns the position after the parenthesis closing the group starting at pos.
+static size_t skipGroup(const std::string& pattern, size_t pos) {
+    auto depth = 0u;
+    while (pos < pattern.size()) {
+        switch (pattern[pos]) {
+        case '\\':
+            pos += 2;
+            continue;
+        case '[':
+            pos = skipCharacterClass(pattern, pos);
+            continue;
+        case '(':
+            depth++;
+            break;
+        case ')':
+            if (--depth == 0) {
+                return pos + 1;
+            }
+            break;
+        default:
+            break;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+// Removes the last UTF-8 character of the literal.
+static void popCharacter(std::string& literal) {
+    while (!literal.empty() && (static_cast<uint8_t>(literal.back()) & 0xC0) == 0x80) {
+        literal.pop_back();
+    }
+    if (!literal.empty()) {
+        literal.pop_back();
+    }
+}
+
+// The longest run of characters which every match contains in order. The scan is conservative:
+// any construct it does not understand ends the current run, and alternations or flags give up.
+RegexpLiteralFilter RegexpLiteralFilter::get(const std::string& pattern) {
+    RegexpLiteralFilter result;
+    std::string current;
+    auto isExact = true;
+    auto endRun = [&]() {
+        if (current.size() > result.literal.size()) {
+            result.literal = current;
+        }
+        current.clear();
+        isExact = false;
+    };
+    auto pos = 0u;
+    while (pos < pattern.size()) {
+        auto c = pattern[pos];
+        switch (c) {
+        case '|':
+        case ')':
+            return RegexpLiteralFilter{};
+        case '(': {
+            // Flags such as (?i) change how the rest of the pattern matches.
+            if (pos + 1 < pattern.size() && pattern[pos + 1] == '?') {
+                return RegexpLiteralFilter{};
+            }
+            endRun();
+            pos = skipGroup(pattern, pos);
+        } break;
+        case '[': {
+            endRun();
+            pos = skipCharacterClass(pattern, pos);
+        } break;
+        case '*':
+        case '?':
+        case '{':
+        case '+': {
+            // The repeated character is optional unless the quantifier is '+'. A bounded
+            // repetition may have a minimum of zero too.
+            if (c != '+') {
+                popCharacter(current);
+            }
+            endRun();
+            if (c == '{') {
+                while (pos < pattern.size() && pattern[pos] != '}') {
+                    pos++;
+                }
+            }
+            pos++;
+        } break;
+        case '.':
+        case '^':
+        case '$': {
+            endRun();
+            pos++;
+        } break;
+        case '\\': {
+            if (pos + 1 >= pattern.size()) {
+                return RegexpLiteralFilter{};
+            }
+            auto escaped = pattern[pos + 1];
+            if (!std::isalnum(static_cast<unsigned char>(escaped))) {
+                current += escaped;
+            } else if (std::strchr("dDwWsSbBAz", escaped) != nullptr) {
+                endRun();
+            } else {
+                // Escapes such as \x41 or \Q...\E spell characters differently from the pattern.
+                return RegexpLiteralFilter{};
+            }
+            pos += 2;
+        } break;
+        default: {
+            current += c;
+            pos++;
+        }
+        }
+    }
+    auto isPatternLiteral = isExact;
+    endRun();
+    result.isExact = isPatternLiteral;
+    return result;
+}
+
+bool RegexpLiteralFilter::mayMatch(const common::ku_string_t& str) const {
+    if (literal.empty()) {
+        return true;
+    }
+    if (literal.size() > str.len) {
+        return false;
+    }
+    return Find::find(str.getData(), str.len, reinterpret_cast<const uint8_t*>(literal.data()),
+               literal.size()) >= 0;
+}
+
+bool RegexpLiteralFilter::equals(const common::ku_string_t& str) const {
+    return str.len == literal.size() && memcmp(str.getData(), literal.data(), str.len) == 0;
+}
+
+} // namespace function
+} // namespace kuzu
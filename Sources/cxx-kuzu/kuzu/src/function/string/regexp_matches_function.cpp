@@ -0,0 +1,83 @@
+#include "binder/expression/expression_util.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
+#include "function/string/functions/base_regexp_function.h"
+#include "function/string/functions/regexp_literal_filter.h"
+#include "function/string/vector_string_functions.h"
+#include "re2.h"
+
+namespace kuzu {
+namespace function {
+
+using namespace common;
+
+struct RegexpMatchesBindData : public FunctionBindData {
+    regex::RE2 pattern;
+    RegexpLiteralFilter literalFilter;
+
+    explicit RegexpMatchesBindData(common::logical_type_vec_t paramTypes, std::string patternInStr)
+        : FunctionBindData{std::move(paramTypes), common::LogicalType::BOOL()},
+          pattern{patternInStr}, literalFilter{RegexpLiteralFilter::get(patternInStr)} {}
+
+    std::unique_ptr<FunctionBindData> copy() const override {
+        return std::make_unique<RegexpMatchesBindData>(copyVector(paramTypes), pattern.pattern());
+    }
+};
+
+struct RegexpMatches : BaseRegexpOperation {
+    static void operation(common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
+        result = RE2::PartialMatch(left.getAsString(), parseCypherPattern(right.getAsString()));
+    }
+};
+
+struct RegexpMatchesStaticPattern : BaseRegexpOperation {
+    static void operation(common::ku_string_t& left, common::ku_string_t& /*right*/,
+        uint8_t& result, common::ValueVector& /*leftValueVector*/,
+        common::ValueVector& /*rightValueVector*/, common::ValueVector& /*resultValueVector*/,
+        void* dataPtr) {
+        auto regexpMatchesBindData = reinterpret_cast<RegexpMatchesBindData*>(dataPtr);
+        auto& literalFilter = regexpMatchesBindData->literalFilter;
+        if (!literalFilter.mayMatch(left)) {
+            result = false;
+        } else if (literalFilter.isExact) {
+            result = true;
+        } else {
+            result = RE2::PartialMatch(
+                regex::StringPiece(reinterpret_cast<const char*>(left.getData()), left.len),
+                regexpMatchesBindData->pattern);
+        }
+    }
+};
+
+static std::unique_ptr<FunctionBindData> regexpMatchesBindFunc(const ScalarBindFuncInput& input) {
+    if (input.arguments[1]->expressionType == ExpressionType::LITERAL) {
+        auto value = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(
+            input.arguments[1], input.context);
+        input.definition->ptrCast<ScalarFunction>()->execFunc =
+            ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t,
+                RegexpMatchesStaticPattern>;
+        input.definition->ptrCast<ScalarFunction>()->selectFunc =
+            ScalarFunction::BinarySelectWithBindData<ku_string_t, ku_string_t,
+                RegexpMatchesStaticPattern>;
+        auto patternInStr = value.getValue<std::string>();
+        return std::make_unique<RegexpMatchesBindData>(
+            binder::ExpressionUtil::getDataTypes(input.arguments),
+            BaseRegexpOperation::parseCypherPattern(patternInStr));
+    } else {
+        return FunctionBindData::getSimpleBindData(input.arguments, LogicalType::BOOL());
+    }
+}
+
+function_set RegexpMatchesFunction::getFunctionSet() {
+    function_set functionSet;
+    auto scalarFunc = make_unique<ScalarFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
+        LogicalTypeID::BOOL,
+        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
+        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpMatches>);
+    scalarFunc->bindFunc = regexpMatchesBindFunc;
+    functionSet.emplace_back(std::move(scalarFunc));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
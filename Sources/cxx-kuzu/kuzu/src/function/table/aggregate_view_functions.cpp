@@ -0,0 +1,275 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/index/aggregate_view.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+static constexpr const char* COUNT_ALL_PROPERTY_NAME = "*";
+
+struct AggregateViewBindData final : TableFuncBindData {
+    catalog::NodeTableCatalogEntry* tableEntry;
+    std::string viewName;
+    std::vector<property_id_t> propertyIDs;
+    storage::AggregateViewFunc func;
+
+    AggregateViewBindData(catalog::NodeTableCatalogEntry* tableEntry, std::string viewName,
+        std::vector<property_id_t> propertyIDs, storage::AggregateViewFunc func)
+        : TableFuncBindData{0}, tableEntry{tableEntry}, viewName{std::move(viewName)},
+          propertyIDs{std::move(propertyIDs)}, func{func} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AggregateViewBindData>(tableEntry, viewName, propertyIDs, func);
+    }
+};
+
+static catalog::NodeTableCatalogEntry* bindNodeTable(const main::ClientContext& context,
+    const std::string& tableName) {
+    binder::Binder::validateTableExistence(context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(context)->getTableCatalogEntry(
+        transaction::Transaction::Get(context), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    return tableEntry->ptrCast<catalog::NodeTableCatalogEntry>();
+}
+
+static void validateAutoTransaction(const main::ClientContext& context,
+    const std::string& funcName) {
+    if (!transaction::TransactionContext::Get(context)->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", funcName)};
+    }
+}
+
+static catalog::IndexCatalogEntry* bindView(const main::ClientContext& context,
+    const catalog::NodeTableCatalogEntry& tableEntry, const std::string& viewName) {
+    auto catalog = catalog::Catalog::Get(context);
+    auto transaction = transaction::Transaction::Get(context);
+    const auto tableID = tableEntry.getTableID();
+    if (!catalog->containsIndex(transaction, tableID, viewName) ||
+        catalog->getIndex(transaction, tableID, viewName)->getIndexType() !=
+            storage::AggregateView::TYPE_NAME) {
+        throw BinderException{stringFormat("Table {} doesn't have an aggregate view with name {}.",
+            tableEntry.getName(), viewName)};
+    }
+    return catalog->getIndex(transaction, tableID, viewName);
+}
+
+static std::unique_ptr<TableFuncBindData> createBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, CreateAggregateViewFunction::name);
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto viewName = input->getLiteralVal<std::string>(1);
+    const auto groupPropertyName = input->getLiteralVal<std::string>(2);
+    const auto func = storage::AggregateViewFuncUtils::fromString(
+        input->getLiteralVal<std::string>(3));
+    const auto valuePropertyName = input->getLiteralVal<std::string>(4);
+    const auto tableEntry = bindNodeTable(*context, tableName);
+    binder::Binder::validateColumnExistence(tableEntry, groupPropertyName);
+    const auto& groupType = tableEntry->getProperty(groupPropertyName).getType();
+    if (!storage::AggregateView::isSupportedGroupType(groupType)) {
+        throw BinderException{stringFormat(
+            "Cannot group an aggregate view by property {} of type {}.", groupPropertyName,
+            groupType.toString())};
+    }
+    std::vector propertyIDs{tableEntry->getPropertyID(groupPropertyName)};
+    if (valuePropertyName == COUNT_ALL_PROPERTY_NAME) {
+        if (func != storage::AggregateViewFunc::COUNT) {
+            throw BinderException{
+                stringFormat("{} of an aggregate view requires a property.",
+                    storage::AggregateViewFuncUtils::toString(func))};
+        }
+    } else {
+        binder::Binder::validateColumnExistence(tableEntry, valuePropertyName);
+        const auto& valueType = tableEntry->getProperty(valuePropertyName).getType();
+        if (func != storage::AggregateViewFunc::COUNT &&
+            !storage::AggregateView::isSupportedValueType(valueType)) {
+            throw BinderException{stringFormat(
+                "Cannot aggregate property {} of type {} in an aggregate view. Only integer and "
+                "floating point properties are supported by SUM, MIN and MAX.",
+                valuePropertyName, valueType.toString())};
+        }
+        propertyIDs.push_back(tableEntry->getPropertyID(valuePropertyName));
+    }
+    if (catalog::Catalog::Get(*context)->containsIndex(transaction::Transaction::Get(*context),
+            tableEntry->getTableID(), viewName)) {
+        throw BinderException{
+            stringFormat("Index {} already exists in table {}.", viewName, tableName)};
+    }
+    return std::make_unique<AggregateViewBindData>(tableEntry, viewName, std::move(propertyIDs),
+        func);
+}
+
+static offset_t createTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<AggregateViewBindData>();
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = bindData->tableEntry->getTableID();
+    auto& nodeTable =
+        storage::StorageManager::Get(*context)->getTable(tableID)->cast<storage::NodeTable>();
+    auto indexEntry = std::make_unique<catalog::IndexCatalogEntry>(
+        storage::AggregateView::TYPE_NAME, tableID, bindData->viewName, bindData->propertyIDs,
+        std::make_unique<storage::AggregateViewAuxInfo>(bindData->func));
+    catalog::Catalog::Get(*context)->createIndex(transaction, std::move(indexEntry));
+    std::vector<column_id_t> columnIDs;
+    std::vector<PhysicalTypeID> keyDataTypes;
+    for (const auto propertyID : bindData->propertyIDs) {
+        const auto columnID = bindData->tableEntry->getColumnID(propertyID);
+        columnIDs.push_back(columnID);
+        keyDataTypes.push_back(nodeTable.getColumn(columnID).getDataType().getPhysicalType());
+    }
+    const auto indexType = storage::AggregateView::getIndexType();
+    storage::IndexInfo indexInfo{bindData->viewName, indexType.typeName, tableID,
+        std::move(columnIDs), std::move(keyDataTypes),
+        indexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        indexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    nodeTable.addIndex(std::make_unique<storage::AggregateView>(std::move(indexInfo),
+        std::make_unique<storage::AggregateViewStorageInfo>(bindData->func), nodeTable));
+    // The view is added to the table outside of the WAL, so it is persisted by checkpointing.
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set CreateAggregateViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = createBindFunc;
+    func->tableFunc = createTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> dropBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, DropAggregateViewFunction::name);
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto viewName = input->getLiteralVal<std::string>(1);
+    const auto tableEntry = bindNodeTable(*context, tableName);
+    const auto indexEntry = bindView(*context, *tableEntry, viewName);
+    auto func = storage::AggregateViewFunc::COUNT;
+    if (indexEntry->isLoaded()) {
+        func = indexEntry->getAuxInfo().cast<storage::AggregateViewAuxInfo>().func;
+    }
+    return std::make_unique<AggregateViewBindData>(tableEntry, viewName,
+        indexEntry->getPropertyIDs(), func);
+}
+
+static offset_t dropTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<AggregateViewBindData>();
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = bindData->tableEntry->getTableID();
+    catalog::Catalog::Get(*context)->dropIndex(transaction, tableID, bindData->viewName);
+    storage::StorageManager::Get(*context)->getTable(tableID)->cast<storage::NodeTable>().dropIndex(
+        bindData->viewName);
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set DropAggregateViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = dropBindFunc;
+    func->tableFunc = dropTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+struct ReadAggregateViewBindData final : TableFuncBindData {
+    std::vector<storage::AggregateView::Group> groups;
+    storage::AggregateViewFunc func;
+    bool hasValueColumn;
+
+    ReadAggregateViewBindData(std::vector<storage::AggregateView::Group> groups,
+        storage::AggregateViewFunc func, bool hasValueColumn, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), groups.size()}, groups{std::move(groups)},
+          func{func}, hasValueColumn{hasValueColumn} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ReadAggregateViewBindData>(*this);
+    }
+};
+
+static offset_t readTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto bindData = input.bindData->constPtrCast<ReadAggregateViewBindData>();
+    auto& keyVector = output.getValueVectorMutable(0);
+    auto& resultVector = output.getValueVectorMutable(1);
+    const auto numTuplesToOutput = morsel.getMorselSize();
+    for (auto i = 0u; i < numTuplesToOutput; i++) {
+        auto& group = bindData->groups[morsel.startOffset + i];
+        keyVector.copyFromValue(i, group.key);
+        storage::AggregateView::writeResult(group, bindData->func, bindData->hasValueColumn,
+            resultVector, i);
+    }
+    return numTuplesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> readBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto viewName = input->getLiteralVal<std::string>(1);
+    const auto tableEntry = bindNodeTable(*context, tableName);
+    const auto indexEntry = bindView(*context, *tableEntry, viewName);
+    const auto index = storage::StorageManager::Get(*context)
+                           ->getTable(tableEntry->getTableID())
+                           ->cast<storage::NodeTable>()
+                           .getIndex(viewName);
+    KU_ASSERT(index.has_value());
+    auto& view = index.value()->cast<storage::AggregateView>();
+    const auto propertyIDs = indexEntry->getPropertyIDs();
+    const auto& groupProperty = tableEntry->getProperty(propertyIDs[0]);
+    const auto valueType = view.hasValueColumn() ?
+                               &tableEntry->getProperty(propertyIDs[1]).getType() :
+                               nullptr;
+    std::vector<std::string> columnNames{groupProperty.getName(),
+        StringUtils::getLower(storage::AggregateViewFuncUtils::toString(view.getFunc()))};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(groupProperty.getType().copy());
+    columnTypes.push_back(storage::AggregateView::getResultType(view.getFunc(), valueType));
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<ReadAggregateViewBindData>(view.getGroups(context), view.getFunc(),
+        view.hasValueColumn(), std::move(columns));
+}
+
+function_set AggregateViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    function->tableFunc = SimpleTableFunc::getTableFunc(readTableFunc);
+    function->bindFunc = readBindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,230 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/types/timestamp_t.h"
+#include "function/hash/hash_functions.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/stats/column_histogram.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+// Number of rows sampled from a table, regardless of its size.
+static constexpr uint64_t SAMPLE_SIZE = 30000;
+
+struct AnalyzeBindData final : TableFuncBindData {
+    catalog::TableCatalogEntry* tableEntry;
+
+    explicit AnalyzeBindData(catalog::TableCatalogEntry* tableEntry)
+        : TableFuncBindData{0}, tableEntry{tableEntry} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(tableEntry);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), tableName);
+    if (tableEntry->getType() != catalog::CatalogEntryType::NODE_TABLE_ENTRY &&
+        tableEntry->getType() != catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        throw BinderException(
+            stringFormat("Cannot analyze {}. Only node and rel tables can be analyzed.",
+                tableEntry->getName()));
+    }
+    return std::make_unique<AnalyzeBindData>(tableEntry);
+}
+
+// Rows are sampled by the hash of their offsets, so that analyzing unchanged data gives the same
+// histograms.
+static bool isSampled(offset_t offset, double sampleRate) {
+    return static_cast<double>(murmurhash64(offset) >> 11) * 0x1.0p-53 < sampleRate;
+}
+
+static double getSampleRate(uint64_t numRows) {
+    return numRows <= SAMPLE_SIZE ? 1.0 : static_cast<double>(SAMPLE_SIZE) / numRows;
+}
+
+static void analyzeNodeTable(main::ClientContext* context,
+    const catalog::TableCatalogEntry& tableEntry) {
+    auto transaction = transaction::Transaction::Get(*context);
+    auto& table = storage::StorageManager::Get(*context)
+                      ->getTable(tableEntry.getTableID())
+                      ->cast<storage::NodeTable>();
+    const auto statsAtScanStart = table.getCommittedStats();
+    // The stats are rebuilt from all scanned rows, and the histograms from a sample of them.
+    std::vector<LogicalType> columnTypes;
+    for (auto i = 0u; i < table.getNumColumns(); i++) {
+        columnTypes.push_back(table.getColumn(i).getDataType().copy());
+    }
+    storage::TableStats refreshedStats{columnTypes};
+    std::vector<property_id_t> propertyIDs;
+    std::vector<column_id_t> columnIDs;
+    // Positions in columnIDs of the columns to build histograms for.
+    std::vector<idx_t> histogramColumnIdxs;
+    for (auto& property : tableEntry.getProperties()) {
+        auto propertyID = tableEntry.getPropertyID(property.getName());
+        const auto isHistogramSupported = storage::ColumnHistogram::isSupported(property.getType());
+        if (isHistogramSupported || !LogicalTypeUtils::isNested(property.getType())) {
+            if (isHistogramSupported) {
+                histogramColumnIdxs.push_back(columnIDs.size());
+                propertyIDs.push_back(propertyID);
+            }
+            columnIDs.push_back(tableEntry.getColumnID(propertyID));
+        }
+    }
+    DataChunk dataChunk{static_cast<uint32_t>(columnIDs.size() + 1),
+        std::make_shared<DataChunkState>()};
+    dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+    std::vector<ValueVector*> outputVectors;
+    for (auto i = 0u; i < columnIDs.size(); i++) {
+        dataChunk.insert(i + 1,
+            std::make_shared<ValueVector>(table.getColumn(columnIDs[i]).getDataType().copy()));
+        outputVectors.push_back(&dataChunk.getValueVectorMutable(i + 1));
+    }
+    storage::NodeTableScanState scanState{&dataChunk.getValueVectorMutable(0), outputVectors,
+        dataChunk.state};
+    scanState.source = storage::TableScanSource::COMMITTED;
+    scanState.setToTable(transaction, &table, columnIDs, {});
+    const auto numRows = table.getNumTotalRows(transaction);
+    const auto sampleRate = getSampleRate(numRows);
+    std::vector<std::vector<storage::histogram_key_t>> samples(histogramColumnIdxs.size());
+    cardinality_t numSampledRows = 0;
+    for (auto i = 0u; i < table.getNumCommittedNodeGroups(); i++) {
+        scanState.nodeGroupIdx = i;
+        table.initScanState(transaction, scanState);
+        while (table.scan(transaction, scanState)) {
+            if (outputVectors.empty()) {
+                refreshedStats.incrementCardinality(
+                    scanState.outState->getSelVector().getSelSize());
+            } else {
+                refreshedStats.update(columnIDs, outputVectors);
+            }
+            if (histogramColumnIdxs.empty()) {
+                continue;
+            }
+            scanState.outState->getSelVector().forEach([&](auto pos) {
+                const auto offset = scanState.nodeIDVector->getValue<nodeID_t>(pos).offset;
+                if (!isSampled(offset, sampleRate)) {
+                    return;
+                }
+                numSampledRows++;
+                for (auto j = 0u; j < histogramColumnIdxs.size(); j++) {
+                    auto key = storage::ColumnHistogram::getKey(
+                        *outputVectors[histogramColumnIdxs[j]], pos);
+                    if (key.has_value()) {
+                        samples[j].push_back(std::move(*key));
+                    }
+                }
+            });
+        }
+    }
+    auto histograms = std::make_shared<storage::TableHistograms>();
+    histograms->numRowsAnalyzed = numRows;
+    for (auto j = 0u; j < histogramColumnIdxs.size(); j++) {
+        histograms->columnHistograms.emplace(propertyIDs[j],
+            storage::ColumnHistogram::build(std::move(samples[j]), numSampledRows,
+                refreshedStats.getNumDistinctValues(columnIDs[histogramColumnIdxs[j]])));
+    }
+    table.setHistograms(std::move(histograms));
+    table.refreshStats(std::move(refreshedStats), statsAtScanStart,
+        Timestamp::getCurrentTimestamp().value);
+}
+
+static std::shared_ptr<const storage::DegreeStats> computeDegreeStats(
+    main::ClientContext* context, storage::RelTable& table, RelDataDirection direction) {
+    auto transaction = transaction::Transaction::Get(*context);
+    auto memoryManager = storage::MemoryManager::Get(*context);
+    const auto boundTableID = direction == RelDataDirection::FWD ? table.getFromNodeTableID() :
+                                                                   table.getToNodeTableID();
+    auto boundTable = storage::StorageManager::Get(*context)->getTable(boundTableID);
+    const auto numBoundNodes = boundTable->getNumTotalRows(transaction);
+    const auto sampleRate = getSampleRate(numBoundNodes);
+    ValueVector boundNodeIDVector(LogicalType::INTERNAL_ID(), memoryManager,
+        DataChunkState::getSingleValueDataChunkState());
+    auto outState = std::make_shared<DataChunkState>();
+    ValueVector nbrNodeIDVector(LogicalType::INTERNAL_ID(), memoryManager, outState);
+    storage::RelTableScanState scanState(*memoryManager, &boundNodeIDVector, {&nbrNodeIDVector},
+        outState);
+    scanState.setToTable(transaction, &table, {storage::NBR_ID_COLUMN_ID}, {}, direction);
+    uint64_t numSampledNodes = 0;
+    double sumDegrees = 0, sumSquaredDegrees = 0;
+    auto degreeStats = std::make_shared<storage::DegreeStats>();
+    for (auto offset = 0u; offset < numBoundNodes; offset++) {
+        if (!isSampled(offset, sampleRate)) {
+            continue;
+        }
+        boundNodeIDVector.setValue<nodeID_t>(0, nodeID_t{offset, boundTableID});
+        outState->getSelVectorUnsafe().setSelSize(0);
+        table.initScanState(transaction, scanState);
+        cardinality_t degree = 0;
+        while (table.scan(transaction, scanState)) {
+            degree += outState->getSelVector().getSelSize();
+        }
+        numSampledNodes++;
+        sumDegrees += degree;
+        sumSquaredDegrees += static_cast<double>(degree) * degree;
+        degreeStats->maxDegree = std::max(degreeStats->maxDegree, degree);
+    }
+    if (numSampledNodes > 0 && sumDegrees > 0) {
+        degreeStats->avgDegree = sumDegrees / numSampledNodes;
+        degreeStats->skew = sumSquaredDegrees * numSampledNodes / (sumDegrees * sumDegrees);
+    }
+    return degreeStats;
+}
+
+static void analyzeRelTables(main::ClientContext* context,
+    const catalog::RelGroupCatalogEntry& relGroupEntry) {
+    auto storageManager = storage::StorageManager::Get(*context);
+    for (auto& relEntryInfo : relGroupEntry.getRelEntryInfos()) {
+        auto& table = storageManager->getTable(relEntryInfo.oid)->cast<storage::RelTable>();
+        for (auto direction : table.getStorageDirections()) {
+            table.setDegreeStats(direction, computeDegreeStats(context, table, direction));
+        }
+    }
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    auto context = input.context->clientContext;
+    if (bindData->tableEntry->getType() == catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        analyzeRelTables(context, bindData->tableEntry->constCast<catalog::RelGroupCatalogEntry>());
+    } else {
+        analyzeNodeTable(context, *bindData->tableEntry);
+    }
+    // The plans cached by clients were optimized with the old statistics.
+    catalog::Catalog::Get(*context)->invalidateCachedPlans();
+    return 0;
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,118 @@
+#include "function/table/arrow_stream_scan.h"
+
+#include "binder/binder.h"
+#include "common/arrow/arrow_converter.h"
+#include "common/arrow/arrow_nullmask_tree.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "function/table/bind_input.h"
+#include "processor/operator/persistent/reader/reader_bind_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+static std::string getLastError(ArrowArrayStream* stream) {
+    auto error = stream->get_last_error == nullptr ? nullptr : stream->get_last_error(stream);
+    return error == nullptr ? "unknown error" : error;
+}
+
+ArrowStreamMorsel ArrowStreamScanSharedState::getMorsel() {
+    std::unique_lock lck{mtx};
+    while (!finished) {
+        if (currentBatch != nullptr &&
+            currentBatchOffset < static_cast<uint64_t>(currentBatch->length)) {
+            auto numRows = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY,
+                currentBatch->length - currentBatchOffset);
+            auto morsel = ArrowStreamMorsel{currentBatch, currentBatchOffset, numRows};
+            currentBatchOffset += numRows;
+            return morsel;
+        }
+        auto batch = std::make_shared<ArrowArrayWrapper>();
+        if (stream->get_next(stream, batch.get()) != 0) {
+            throw RuntimeException{
+                stringFormat("Failed to read from Arrow stream: {}.", getLastError(stream))};
+        }
+        if (batch->release == nullptr) {
+            finished = true;
+            break;
+        }
+        currentBatch = std::move(batch);
+        currentBatchOffset = 0;
+    }
+    currentBatch = nullptr;
+    return ArrowStreamMorsel{};
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+    auto bindData = input.bindData->constPtrCast<ArrowStreamScanBindData>();
+    auto sharedState = input.sharedState->ptrCast<ArrowStreamScanSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (morsel.numRows == 0) {
+        return 0;
+    }
+    auto schema = bindData->schema.get();
+    auto batch = morsel.batch.get();
+    for (auto i = 0u; i < output.dataChunk.getNumValueVectors(); i++) {
+        auto childSchema = schema->children[i];
+        auto childArray = batch->children[i];
+        auto srcOffset = batch->offset + childArray->offset + morsel.offset;
+        ArrowNullMaskTree mask(childSchema, childArray, srcOffset, morsel.numRows);
+        ArrowConverter::fromArrowArray(childSchema, childArray,
+            output.dataChunk.getValueVectorMutable(i), &mask, srcOffset, 0 /* dstOffset */,
+            morsel.numRows);
+    }
+    return morsel.numRows;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext*,
+    const TableFuncBindInput* input) {
+    auto scanInput = input->extraInput->constPtrCast<ExtraScanTableFuncBindInput>();
+    if (!scanInput->fileScanInfo.options.empty()) {
+        throw BinderException{"Copy from an Arrow stream cannot have options."};
+    }
+    auto stream = reinterpret_cast<ArrowArrayStream*>(input->getLiteralVal<uint8_t*>(0));
+    auto schema = std::make_shared<ArrowSchemaWrapper>();
+    if (stream->get_schema(stream, schema.get()) != 0) {
+        throw BinderException{
+            stringFormat("Failed to get the schema of Arrow stream: {}.", getLastError(stream))};
+    }
+    if (std::string_view(schema->format) != "+s") {
+        throw BinderException{"The schema of an Arrow stream to scan must be a struct."};
+    }
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    for (auto i = 0; i < schema->n_children; i++) {
+        auto child = schema->children[i];
+        columnNames.emplace_back(child->name);
+        columnTypes.push_back(ArrowConverter::fromArrowSchema(child));
+    }
+    if (!scanInput->expectedColumnNames.empty()) {
+        processor::ReaderBindUtils::validateNumColumns(scanInput->expectedColumnNames.size(),
+            columnNames.size());
+        columnNames = scanInput->expectedColumnNames;
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<ArrowStreamScanBindData>(std::move(columns), stream,
+        std::move(schema));
+}
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    auto bindData = input.bindData->constPtrCast<ArrowStreamScanBindData>();
+    return std::make_unique<ArrowStreamScanSharedState>(bindData->stream);
+}
+
+TableFunction ArrowStreamScanFunction::getFunction() {
+    auto function = TableFunction(name, std::vector{LogicalTypeID::POINTER});
+    function.tableFunc = tableFunc;
+    function.bindFunc = bindFunc;
+    function.initSharedStateFunc = initSharedState;
+    function.initLocalStateFunc = TableFunction::initEmptyLocalState;
+    return function;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,74 @@
+#include "common/exception/binder.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/database_backup.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+static constexpr const char* MAX_BYTES_PER_SECOND_OPTION = "max_bytes_per_second";
+
+struct BackupBindData final : TableFuncBindData {
+    std::string destinationPath;
+    uint64_t maxBytesPerSecond;
+
+    BackupBindData(std::string destinationPath, uint64_t maxBytesPerSecond)
+        : TableFuncBindData{0}, destinationPath{std::move(destinationPath)},
+          maxBytesPerSecond{maxBytesPerSecond} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BackupBindData>(destinationPath, maxBytesPerSecond);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto destinationPath = VirtualFileSystem::GetUnsafe(*context)->expandPath(context,
+        input->getLiteralVal<std::string>(0));
+    uint64_t maxBytesPerSecond = 0;
+    for (auto& [name, value] : input->optionalParams) {
+        if (StringUtils::caseInsensitiveEquals(name, MAX_BYTES_PER_SECOND_OPTION)) {
+            value.validateType(LogicalTypeID::INT64);
+            const auto maxBytes = value.getValue<int64_t>();
+            if (maxBytes < 0) {
+                throw BinderException{
+                    stringFormat("{} must not be negative.", MAX_BYTES_PER_SECOND_OPTION)};
+            }
+            maxBytesPerSecond = maxBytes;
+        } else {
+            throw BinderException{"Unknown optional parameter: " + name};
+        }
+    }
+    return std::make_unique<BackupBindData>(destinationPath, maxBytesPerSecond);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<BackupBindData>();
+    storage::DatabaseBackup::backup(*input.context->clientContext, bindData->destinationPath,
+        bindData->maxBytesPerSecond);
+    return 0;
+}
+
+function_set BackupFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = true;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
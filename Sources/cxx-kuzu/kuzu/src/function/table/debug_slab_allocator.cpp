@@ -0,0 +1,102 @@
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+#include <cstring>
+#include <thread>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/mm_allocator.h"
+#include "storage/buffer_manager/slab_allocator.h"
+
+namespace kuzu {
+namespace function {
+
+struct DebugSlabAllocatorBindData final : TableFuncBindData {
+    int64_t numBlocks;
+
+    DebugSlabAllocatorBindData(int64_t numBlocks, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, numBlocks{numBlocks} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DebugSlabAllocatorBindData>(numBlocks, columns);
+    }
+};
+
+// Allocates numBlocks blocks of every size class of the slab allocator on this thread and frees
+// them on another one. Each block is tagged with its index, so a block handed out twice is found.
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 4);
+    auto bindData = input.bindData->constPtrCast<DebugSlabAllocatorBindData>();
+    auto mm = storage::MemoryManager::Get(*input.context->clientContext);
+    auto bm = mm->getBufferManager();
+    auto allocator = storage::MmAllocator<uint8_t>(mm);
+    auto memUsageBefore = bm->getUsedMemory();
+    std::vector<std::pair<uint8_t*, uint64_t>> blocks;
+    for (auto size = storage::SlabAllocator::MIN_BLOCK_SIZE;
+         size <= storage::SlabAllocator::MAX_BLOCK_SIZE; size *= 2) {
+        for (auto i = 0; i < bindData->numBlocks; i++) {
+            auto block = allocator.allocate(size);
+            std::memset(block, 0xFF, size);
+            uint64_t blockIdx = blocks.size();
+            std::memcpy(block, &blockIdx, sizeof(blockIdx));
+            blocks.emplace_back(block, size);
+        }
+    }
+    auto memUsageAllocated = bm->getUsedMemory();
+    uint64_t numCorruptedBlocks = 0;
+    for (auto i = 0u; i < blocks.size(); i++) {
+        uint64_t blockIdx = 0;
+        std::memcpy(&blockIdx, blocks[i].first, sizeof(blockIdx));
+        numCorruptedBlocks += blockIdx != i;
+    }
+    std::thread freeingThread([&]() {
+        for (auto& [block, size] : blocks) {
+            allocator.deallocate(block, size);
+        }
+    });
+    freeingThread.join();
+    auto memUsageFreed = bm->getUsedMemory();
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, memUsageBefore);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, memUsageAllocated);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, memUsageFreed);
+    output.getValueVectorMutable(3).setValue<uint64_t>(0, numCorruptedBlocks);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* /*context*/,
+    const TableFuncBindInput* input) {
+    auto numBlocks = input->getLiteralVal<int64_t>(0);
+    if (numBlocks <= 0) {
+        throw common::BinderException{"The number of blocks must be positive."};
+    }
+    std::vector<common::LogicalType> returnTypes;
+    for (auto i = 0u; i < 4; i++) {
+        returnTypes.emplace_back(common::LogicalType::UINT64());
+    }
+    auto returnColumnNames = std::vector<std::string>{"mem_usage_before", "mem_usage_allocated",
+        "mem_usage_freed", "num_corrupted_blocks"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<DebugSlabAllocatorBindData>(numBlocks, columns);
+}
+
+function_set DebugSlabAllocatorFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name,
+        std::vector<common::LogicalTypeID>{common::LogicalTypeID::INT64});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
+#endif
@@ -0,0 +1,113 @@
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+
+namespace kuzu {
+namespace function {
+
+struct UpdateVersionsInfo {
+    common::node_group_idx_t nodeGroupIdx;
+    std::string columnName;
+    common::idx_t vectorIdx;
+    uint64_t numVersions;
+};
+
+struct DebugUpdateVersionsBindData final : TableFuncBindData {
+    std::vector<UpdateVersionsInfo> infos;
+
+    DebugUpdateVersionsBindData(std::vector<UpdateVersionsInfo> infos,
+        binder::expression_vector columns, common::offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, infos{std::move(infos)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DebugUpdateVersionsBindData>(infos, columns, numRows);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& morsel,
+    const TableFuncInput& input, common::DataChunk& output) {
+    const auto& infos = input.bindData->constPtrCast<DebugUpdateVersionsBindData>()->infos;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& info = infos[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue<int64_t>(i, info.nodeGroupIdx);
+        output.getValueVectorMutable(1).setValue(i, info.columnName);
+        output.getValueVectorMutable(2).setValue<int64_t>(i, info.vectorIdx);
+        output.getValueVectorMutable(3).setValue<int64_t>(i, info.numVersions);
+    }
+    return numRowsToOutput;
+}
+
+// Only vectors with at least one version are listed.
+static std::vector<UpdateVersionsInfo> collectUpdateVersions(const storage::NodeTable& table) {
+    std::vector<UpdateVersionsInfo> infos;
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < table.getNumNodeGroups(); nodeGroupIdx++) {
+        auto nodeGroup = table.getNodeGroup(nodeGroupIdx);
+        for (auto chunkIdx = 0u; chunkIdx < nodeGroup->getNumChunkedGroups(); chunkIdx++) {
+            auto chunkedGroup = nodeGroup->getChunkedNodeGroup(chunkIdx);
+            for (auto columnID = 0u; columnID < chunkedGroup->getNumColumns(); columnID++) {
+                const auto& updateInfo = chunkedGroup->getColumnChunk(columnID).getUpdateInfo();
+                for (auto vectorIdx = 0u; vectorIdx < updateInfo.getNumVectors(); vectorIdx++) {
+                    const auto numVersions = updateInfo.getNumVersions(vectorIdx);
+                    if (numVersions > 0) {
+                        infos.push_back({nodeGroupIdx, table.getColumn(columnID).getName(),
+                            vectorIdx, numVersions});
+                    }
+                }
+            }
+        }
+    }
+    return infos;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto catalog = catalog::Catalog::Get(*context);
+    auto transaction = transaction::Transaction::Get(*context);
+    if (!catalog->containsTable(transaction, tableName)) {
+        throw common::BinderException{"Table " + tableName + " does not exist!"};
+    }
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableName);
+    if (tableEntry->getTableType() != common::TableType::NODE) {
+        throw common::BinderException{tableName + " is not a node table."};
+    }
+    auto& table = storage::StorageManager::Get(*context)
+                      ->getTable(tableEntry->getTableID())
+                      ->cast<storage::NodeTable>();
+    auto infos = collectUpdateVersions(table);
+    std::vector<std::string> columnNames{"node_group_id", "column_name", "vector_idx",
+        "num_versions"};
+    std::vector<common::LogicalType> columnTypes;
+    columnTypes.push_back(common::LogicalType::INT64());
+    columnTypes.push_back(common::LogicalType::STRING());
+    columnTypes.push_back(common::LogicalType::INT64());
+    columnTypes.push_back(common::LogicalType::INT64());
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = infos.size();
+    return std::make_unique<DebugUpdateVersionsBindData>(std::move(infos), columns, numRows);
+}
+
+function_set DebugUpdateVersionsFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name,
+        std::vector<common::LogicalTypeID>{common::LogicalTypeID::STRING});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
+#endif
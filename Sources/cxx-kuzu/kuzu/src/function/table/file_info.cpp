@@ -2,6 +2,7 @@
 #include "function/table/bind_data.h"
 #include "function/table/simple_table_function.h"
 #include "main/client_context.h"
+#include "storage/page_manager.h"
 #include "storage/storage_manager.h"
 
 namespace kuzu {
@@ -9,33 +10,38 @@ namespace function {
 
 struct FileInfoBindData final : TableFuncBindData {
     uint64_t numPages;
+    uint64_t numFreePages;
 
-    FileInfoBindData(uint64_t numPages, binder::expression_vector columns)
-        : TableFuncBindData{std::move(columns), 1}, numPages(numPages) {}
+    FileInfoBindData(uint64_t numPages, uint64_t numFreePages, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, numPages(numPages),
+          numFreePages(numFreePages) {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<FileInfoBindData>(numPages, columns);
+        return std::make_unique<FileInfoBindData>(numPages, numFreePages, columns);
     }
 };
 
 static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
     const TableFuncInput& input, common::DataChunk& output) {
-    KU_ASSERT(output.getNumValueVectors() == 1);
+    KU_ASSERT(output.getNumValueVectors() == 2);
     auto fileInfoBindData = input.bindData->constPtrCast<FileInfoBindData>();
     output.getValueVectorMutable(0).setValue<uint64_t>(0, fileInfoBindData->numPages);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, fileInfoBindData->numFreePages);
     return 1;
 }
 
 static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
     const TableFuncBindInput* input) {
     auto numPages = storage::StorageManager::Get(*context)->getDataFH()->getNumPages();
+    auto numFreePages = storage::PageManager::Get(*context)->getNumFreePages();
     std::vector<common::LogicalType> returnTypes;
     returnTypes.emplace_back(common::LogicalType::UINT64());
-    auto returnColumnNames = std::vector<std::string>{"num_pages"};
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames = std::vector<std::string>{"num_pages", "num_free_pages"};
     returnColumnNames =
         TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
     auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
-    return std::make_unique<FileInfoBindData>(numPages, columns);
+    return std::make_unique<FileInfoBindData>(numPages, numFreePages, columns);
 }
 
 function_set FileInfoFunction::getFunctionSet() {
@@ -0,0 +1,82 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+static constexpr FileIOCounter COUNTERS[] = {FileIOCounter::PINS, FileIOCounter::HITS,
+    FileIOCounter::MISSES, FileIOCounter::OPTIMISTIC_READ_RETRIES, FileIOCounter::EVICTIONS,
+    FileIOCounter::SECOND_CHANCES, FileIOCounter::BYTES_READ, FileIOCounter::BYTES_WRITTEN};
+
+struct IOStatsBindData final : TableFuncBindData {
+    std::vector<FileIOStatsSnapshot> stats;
+
+    IOStatsBindData(std::vector<FileIOStatsSnapshot> stats, binder::expression_vector columns,
+        offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, stats{std::move(stats)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<IOStatsBindData>(stats, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& stats = input.bindData->constPtrCast<IOStatsBindData>()->stats;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    auto& histogramVector = output.getValueVectorMutable(std::size(COUNTERS) + 1);
+    auto histogramDataVector = ListVector::getDataVector(&histogramVector);
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& fileStats = stats[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, fileStats.filePath);
+        for (auto j = 0u; j < std::size(COUNTERS); j++) {
+            output.getValueVectorMutable(j + 1).setValue(i, fileStats.get(COUNTERS[j]));
+        }
+        auto listEntry =
+            ListVector::addList(&histogramVector, FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS);
+        for (auto j = 0u; j < FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS; j++) {
+            histogramDataVector->setValue(listEntry.offset + j, fileStats.readLatencyHistogram[j]);
+        }
+        histogramVector.setValue(i, listEntry);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"file_path", "num_pins", "num_hits", "num_misses",
+        "num_optimistic_read_retries", "num_evictions", "num_second_chances", "bytes_read",
+        "bytes_written", "read_latency_histogram"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    for (auto i = 0u; i < std::size(COUNTERS); i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    columnTypes.push_back(LogicalType::LIST(LogicalType::UINT64()));
+    auto stats = MemoryManager::Get(*context)->getBufferManager()->getIOStats();
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = stats.size();
+    return std::make_unique<IOStatsBindData>(std::move(stats), columns, numRows);
+}
+
+function_set IOStatsFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/gds/gds.h"
 #include "function/table/bind_data.h"
@@ -20,25 +23,39 @@ struct ProjectGraphNativeBindData final : TableFuncBindData {
     std::string graphName;
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    bool materialize;
+    bool relabel;
 
     ProjectGraphNativeBindData(std::string graphName,
         std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool materialize, bool relabel)
         : TableFuncBindData{0}, graphName{std::move(graphName)}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, materialize{materialize}, relabel{relabel} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+            materialize, relabel);
     }
 };
 
+// Keeps an in-memory snapshot of the adjacency of the rel tables across graph algorithm calls.
+static constexpr char MATERIALIZE_OPTION[] = "materialize";
+// Numbers the nodes of the snapshot in decreasing order of degree for the algorithms that support
+// it (page rank and weakly connected components), so that the state of hub nodes is packed.
+static constexpr char RELABEL_OPTION[] = "relabel";
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     const auto bindData = ku_dynamic_cast<ProjectGraphNativeBindData*>(input.bindData);
     auto graphEntrySet = GraphEntrySet::Get(*input.context->clientContext);
     graphEntrySet->validateGraphNotExist(bindData->graphName);
-    auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos);
-    // bind graph entry to check if input is valid or not. Ignore bind result.
-    GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos,
+        bindData->materialize, bindData->relabel);
+    // bind graph entry to check if input is valid or not.
+    auto boundEntry = GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    if (entry->materialize) {
+        GDSFunction::materializeGraph(*input.context->clientContext, bindData->graphName, *entry,
+            boundEntry);
+    }
     graphEntrySet->addGraph(bindData->graphName, std::move(entry));
     return 0;
 }
@@ -78,7 +95,32 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
     auto graphName = input->getLiteralVal<std::string>(0);
     auto nodeInfos = extractGraphEntryTableInfos(input->getValue(1));
     auto relInfos = extractGraphEntryTableInfos(input->getValue(2));
-    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+    auto materialize = false;
+    auto relabel = false;
+    for (auto& [name, value] : input->optionalParams) {
+        if (StringUtils::caseInsensitiveEquals(name, MATERIALIZE_OPTION)) {
+            value.validateType(LogicalTypeID::BOOL);
+            materialize = value.getValue<bool>();
+        } else if (StringUtils::caseInsensitiveEquals(name, RELABEL_OPTION)) {
+            value.validateType(LogicalTypeID::BOOL);
+            relabel = value.getValue<bool>();
+        } else {
+            throw BinderException{"Unknown optional parameter: " + name};
+        }
+    }
+    if (relabel) {
+        if (!materialize) {
+            throw BinderException{"Relabeling a projected graph requires materialize := true."};
+        }
+        // Relabeled algorithms read all rels from the snapshot, which has the rel predicates
+        // applied, and don't mask nodes.
+        if (std::any_of(nodeInfos.begin(), nodeInfos.end(),
+                [](const auto& info) { return !info.predicate.empty(); })) {
+            throw BinderException{"Cannot relabel a projected graph with node predicates."};
+        }
+    }
+    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+        materialize, relabel);
 }
 
 function_set ProjectGraphNativeFunction::getFunctionSet() {
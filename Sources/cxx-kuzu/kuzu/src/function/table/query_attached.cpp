@@ -0,0 +1,158 @@
+#include <thread>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "main/attached_database.h"
+#include "main/client_context.h"
+#include "main/connection.h"
+#include "main/database_manager.h"
+#include "main/query_result.h"
+#include "processor/result/flat_tuple.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+// The results of the query on each database. The connections outlive their results.
+struct AttachedQueryResults {
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::vector<std::unique_ptr<QueryResult>> results;
+    // Result being read, as the output is produced by a single thread.
+    idx_t resultIdx = 0;
+};
+
+struct QueryAttachedBindData final : TableFuncBindData {
+    std::shared_ptr<AttachedQueryResults> results;
+
+    QueryAttachedBindData(std::shared_ptr<AttachedQueryResults> results,
+        binder::expression_vector columns, offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, results{std::move(results)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryAttachedBindData>(*this);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    auto& attachedResults = *input.bindData->constPtrCast<QueryAttachedBindData>()->results;
+    const auto numTuplesToOutput = morsel.getMorselSize();
+    for (auto i = 0u; i < numTuplesToOutput; i++) {
+        while (!attachedResults.results[attachedResults.resultIdx]->hasNext()) {
+            attachedResults.resultIdx++;
+        }
+        auto tuple = attachedResults.results[attachedResults.resultIdx]->getNext();
+        for (auto j = 0u; j < output.getNumValueVectors(); j++) {
+            output.getValueVectorMutable(j).copyFromValue(i, *tuple->getValue(j));
+        }
+    }
+    return numTuplesToOutput;
+}
+
+static AttachedKuzuDatabase* bindAttachedDatabase(const ClientContext& context,
+    const std::string& name) {
+    auto attachedDatabase = DatabaseManager::Get(context)->getAttachedDatabase(name);
+    if (attachedDatabase->getDBType() != ATTACHED_KUZU_DB_TYPE) {
+        throw BinderException{stringFormat(
+            "Cannot run a query on database {} of type {}. Only attached Kuzu databases are "
+            "supported.",
+            name, attachedDatabase->getDBType())};
+    }
+    return dynamic_cast<AttachedKuzuDatabase*>(attachedDatabase);
+}
+
+static std::unique_ptr<QueryResult> runQuery(Connection& connection, const std::string& query) {
+    try {
+        return connection.query(query);
+    } catch (std::exception& e) {
+        return QueryResult::getQueryResultWithError(e.what());
+    }
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> dbNames;
+    for (auto& dbName : StringUtils::split(input->getLiteralVal<std::string>(0), ",")) {
+        auto trimmedName = StringUtils::ltrim(StringUtils::rtrim(dbName));
+        if (!trimmedName.empty()) {
+            dbNames.push_back(std::move(trimmedName));
+        }
+    }
+    if (dbNames.empty()) {
+        throw BinderException{
+            stringFormat("{} requires at least one database.", QueryAttachedFunction::name)};
+    }
+    const auto query = input->getLiteralVal<std::string>(1);
+    auto attachedResults = std::make_shared<AttachedQueryResults>();
+    for (auto& dbName : dbNames) {
+        auto attachedDatabase = bindAttachedDatabase(*context, dbName);
+        auto connection = std::make_unique<Connection>(context->getDatabase());
+        connection->getClientContext()->setDefaultDatabase(attachedDatabase);
+        attachedResults->connections.push_back(std::move(connection));
+    }
+    // Each database runs the query from its own connection, so that the queries are scheduled as
+    // separate tasks and run in parallel. The last one runs on this thread.
+    attachedResults->results.resize(dbNames.size());
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i + 1 < dbNames.size(); i++) {
+        threads.emplace_back([&, i]() {
+            attachedResults->results[i] = runQuery(*attachedResults->connections[i], query);
+        });
+    }
+    attachedResults->results.back() = runQuery(*attachedResults->connections.back(), query);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    offset_t numTuples = 0;
+    for (auto i = 0u; i < dbNames.size(); i++) {
+        auto& result = *attachedResults->results[i];
+        if (!result.isSuccess()) {
+            throw RuntimeException{stringFormat("Query on database {} failed: {}", dbNames[i],
+                result.getErrorMessage())};
+        }
+        if (result.hasNextQueryResult()) {
+            throw BinderException{stringFormat("{} only supports a single statement.",
+                QueryAttachedFunction::name)};
+        }
+        if (i == 0) {
+            columnNames = result.getColumnNames();
+            columnTypes = result.getColumnDataTypes();
+        } else if (result.getColumnNames() != columnNames ||
+                   result.getColumnDataTypes() != columnTypes) {
+            throw BinderException{stringFormat(
+                "Query returns different columns on databases {} and {}.", dbNames[0],
+                dbNames[i])};
+        }
+        numTuples += result.getNumTuples();
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<QueryAttachedBindData>(std::move(attachedResults),
+        std::move(columns), numTuples);
+}
+
+function_set QueryAttachedFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    function->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
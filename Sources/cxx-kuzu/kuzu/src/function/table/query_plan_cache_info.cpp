@@ -0,0 +1,67 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace function {
+
+struct QueryPlanCacheInfoBindData final : TableFuncBindData {
+    uint64_t numPlans;
+    uint64_t numHits;
+    uint64_t numMisses;
+    uint64_t numReoptimizedExecutions;
+
+    QueryPlanCacheInfoBindData(uint64_t numPlans, uint64_t numHits, uint64_t numMisses,
+        uint64_t numReoptimizedExecutions, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, numPlans{numPlans}, numHits{numHits},
+          numMisses{numMisses}, numReoptimizedExecutions{numReoptimizedExecutions} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryPlanCacheInfoBindData>(numPlans, numHits, numMisses,
+            numReoptimizedExecutions, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 4);
+    auto bindData = input.bindData->constPtrCast<QueryPlanCacheInfoBindData>();
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, bindData->numPlans);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, bindData->numHits);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, bindData->numMisses);
+    output.getValueVectorMutable(3).setValue<uint64_t>(0, bindData->numReoptimizedExecutions);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto& planCache = context->getQueryPlanCache();
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    returnTypes.emplace_back(common::LogicalType::UINT64());
+    auto returnColumnNames = std::vector<std::string>{"num_plans", "num_hits", "num_misses",
+        "num_reoptimized_executions"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<QueryPlanCacheInfoBindData>(planCache.getNumPlans(),
+        planCache.getNumHits(), planCache.getNumMisses(), context->getNumReoptimizedExecutions(),
+        columns);
+}
+
+function_set QueryPlanCacheInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,90 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/query_stats.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+// One row per operator of each recent query.
+struct QueryStatsRow {
+    uint64_t queryID;
+    std::string query;
+    double queryTimeMS;
+    uint64_t queryPeakMemory;
+    main::OperatorStats operatorStats;
+};
+
+struct QueryStatsBindData final : TableFuncBindData {
+    std::vector<QueryStatsRow> rows;
+
+    QueryStatsBindData(std::vector<QueryStatsRow> rows, binder::expression_vector columns,
+        offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, rows{std::move(rows)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryStatsBindData>(rows, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& rows = input.bindData->constPtrCast<QueryStatsBindData>()->rows;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& row = rows[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, row.queryID);
+        output.getValueVectorMutable(1).setValue(i, row.query);
+        output.getValueVectorMutable(2).setValue(i, row.queryTimeMS);
+        output.getValueVectorMutable(3).setValue(i, row.operatorStats.name);
+        output.getValueVectorMutable(4).setValue(i, row.operatorStats.numOutputTuples);
+        output.getValueVectorMutable(5).setValue(i, row.operatorStats.executionTimeMS);
+        output.getValueVectorMutable(6).setValue(i, row.queryPeakMemory);
+        output.getValueVectorMutable(7).setValue(i, row.operatorStats.peakMemory);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"query_id", "query", "query_time_ms", "operator",
+        "num_output_tuples", "operator_time_ms", "query_peak_memory", "operator_peak_memory"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    std::vector<QueryStatsRow> rows;
+    for (auto& query : context->getDatabase()->getQueryStatsLog()->getQueries()) {
+        for (auto& operatorStats : query.operators) {
+            rows.push_back({query.queryID, query.query, query.executionTimeMS, query.peakMemory,
+                operatorStats});
+        }
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = rows.size();
+    return std::make_unique<QueryStatsBindData>(std::move(rows), columns, numRows);
+}
+
+function_set QueryStatsFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
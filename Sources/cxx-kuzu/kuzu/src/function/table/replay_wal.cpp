@@ -0,0 +1,53 @@
+#include "common/file_system/virtual_file_system.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct ReplayWALBindData final : TableFuncBindData {
+    std::string shippedWALPath;
+
+    explicit ReplayWALBindData(std::string shippedWALPath)
+        : TableFuncBindData{0}, shippedWALPath{std::move(shippedWALPath)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ReplayWALBindData>(shippedWALPath);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return std::make_unique<ReplayWALBindData>(VirtualFileSystem::GetUnsafe(*context)->expandPath(
+        context, input->getLiteralVal<std::string>(0)));
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<ReplayWALBindData>();
+    auto clientContext = input.context->clientContext;
+    storage::StorageManager::Get(*clientContext)
+        ->replayShippedWAL(*clientContext, bindData->shippedWALPath);
+    return 0;
+}
+
+function_set ReplayWALFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = true;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,205 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct ReverseIndexBindData final : TableFuncBindData {
+    catalog::RelGroupCatalogEntry* relGroupEntry;
+
+    explicit ReverseIndexBindData(catalog::RelGroupCatalogEntry* relGroupEntry)
+        : TableFuncBindData{0}, relGroupEntry{relGroupEntry} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ReverseIndexBindData>(relGroupEntry);
+    }
+};
+
+static catalog::RelGroupCatalogEntry* bindRelGroup(const main::ClientContext& context,
+    const std::string& tableName) {
+    binder::Binder::validateTableExistence(context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(context)->getTableCatalogEntry(
+        transaction::Transaction::Get(context), tableName);
+    if (tableEntry->getType() != catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        throw BinderException{stringFormat(
+            "Cannot find a reverse index for {}. Only rel tables have reverse indexes.",
+            tableName)};
+    }
+    auto& relGroupEntry = tableEntry->cast<catalog::RelGroupCatalogEntry>();
+    if (relGroupEntry.getStorageDirection() != ExtendDirection::FWD) {
+        throw BinderException{stringFormat(
+            "Rel table {} is not stored with storage direction 'fwd', so it doesn't need a reverse "
+            "index.",
+            tableName)};
+    }
+    return &relGroupEntry;
+}
+
+static std::vector<storage::RelTable*> getRelTables(const main::ClientContext& context,
+    const catalog::RelGroupCatalogEntry& relGroupEntry) {
+    const auto storageManager = storage::StorageManager::Get(context);
+    std::vector<storage::RelTable*> tables;
+    for (auto& relEntryInfo : relGroupEntry.getRelEntryInfos()) {
+        tables.push_back(&storageManager->getTable(relEntryInfo.oid)->cast<storage::RelTable>());
+    }
+    return tables;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return std::make_unique<ReverseIndexBindData>(
+        bindRelGroup(*context, input->getLiteralVal<std::string>(0)));
+}
+
+static offset_t createTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<ReverseIndexBindData>();
+    for (const auto table : getRelTables(*context, *bindData->relGroupEntry)) {
+        table->enableReverseIndex();
+        storage::RelTableReverseIndex::scheduleBuild(*context, *table);
+    }
+    return 0;
+}
+
+function_set CreateReverseIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = createTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static offset_t dropTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<ReverseIndexBindData>();
+    for (const auto table : getRelTables(*context, *bindData->relGroupEntry)) {
+        table->dropReverseIndex();
+    }
+    // Cached plans may extend the rel tables backward through the index.
+    catalog::Catalog::Get(*context)->invalidateCachedPlans();
+    return 0;
+}
+
+function_set DropReverseIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = dropTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+struct ReverseIndexInfo {
+    std::string fromTableName;
+    std::string toTableName;
+    std::string state;
+    uint64_t numRels = 0;
+    uint64_t numInsertedRels = 0;
+    uint64_t memoryUsage = 0;
+};
+
+struct ReverseIndexInfoBindData final : TableFuncBindData {
+    std::vector<ReverseIndexInfo> infos;
+
+    ReverseIndexInfoBindData(std::vector<ReverseIndexInfo> infos,
+        binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), infos.size()}, infos{std::move(infos)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ReverseIndexInfoBindData>(*this);
+    }
+};
+
+static offset_t infoTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& infos = input.bindData->constPtrCast<ReverseIndexInfoBindData>()->infos;
+    const auto numTuplesToOutput = morsel.getMorselSize();
+    for (auto i = 0u; i < numTuplesToOutput; i++) {
+        const auto& info = infos[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, info.fromTableName);
+        output.getValueVectorMutable(1).setValue(i, info.toTableName);
+        output.getValueVectorMutable(2).setValue(i, info.state);
+        output.getValueVectorMutable(3).setValue<int64_t>(i, info.numRels);
+        output.getValueVectorMutable(4).setValue<int64_t>(i, info.numInsertedRels);
+        output.getValueVectorMutable(5).setValue<int64_t>(i, info.memoryUsage);
+    }
+    return numTuplesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> infoBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto relGroupEntry = bindRelGroup(*context, input->getLiteralVal<std::string>(0));
+    const auto catalog = catalog::Catalog::Get(*context);
+    const auto transaction = transaction::Transaction::Get(*context);
+    std::vector<ReverseIndexInfo> infos;
+    for (const auto table : getRelTables(*context, *relGroupEntry)) {
+        ReverseIndexInfo info;
+        info.fromTableName =
+            catalog->getTableCatalogEntry(transaction, table->getFromNodeTableID())->getName();
+        info.toTableName =
+            catalog->getTableCatalogEntry(transaction, table->getToNodeTableID())->getName();
+        const auto index = table->getReverseIndex();
+        if (!table->isReverseIndexEnabled()) {
+            info.state = "DISABLED";
+        } else if (index != nullptr) {
+            info.state = "READY";
+            info.numRels = index->getNumRels();
+            info.numInsertedRels = index->getNumInsertedRels();
+            info.memoryUsage = index->getMemoryUsage();
+        } else if (table->isBuildingReverseIndex()) {
+            info.state = "BUILDING";
+        } else {
+            // The index was dropped by a change to the table, and is built again by the next
+            // query that can read it.
+            info.state = "PENDING";
+        }
+        infos.push_back(std::move(info));
+    }
+    std::vector<std::string> columnNames{"from", "to", "state", "num_rels", "num_inserted_rels",
+        "memory_usage"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::INT64());
+    columnTypes.push_back(LogicalType::INT64());
+    columnTypes.push_back(LogicalType::INT64());
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<ReverseIndexInfoBindData>(std::move(infos), std::move(columns));
+}
+
+function_set ReverseIndexInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    function->tableFunc = SimpleTableFunc::getTableFunc(infoTableFunc);
+    function->bindFunc = infoBindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,72 @@
+#include "binder/binder.h"
+#include "common/task_system/task_scheduler.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct SchedulerInfoBindData final : TableFuncBindData {
+    std::vector<SchedulingClassStats> stats;
+
+    SchedulerInfoBindData(std::vector<SchedulingClassStats> stats,
+        binder::expression_vector columns, offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, stats{std::move(stats)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SchedulerInfoBindData>(stats, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& stats = input.bindData->constPtrCast<SchedulerInfoBindData>()->stats;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto classIdx = morsel.startOffset + i;
+        const auto& classStats = stats[classIdx];
+        output.getValueVectorMutable(0).setValue(i,
+            SchedulingClassUtils::toString(static_cast<SchedulingClass>(classIdx)));
+        output.getValueVectorMutable(1).setValue<uint64_t>(i, classStats.workerQuota);
+        output.getValueVectorMutable(2).setValue<uint64_t>(i, classStats.numActiveWorkers);
+        output.getValueVectorMutable(3).setValue<uint64_t>(i, classStats.maxNumActiveWorkers);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"scheduling_class", "worker_quota", "num_active_workers",
+        "max_num_active_workers"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    for (auto i = 0u; i < 3; i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    std::vector<SchedulingClassStats> stats;
+    auto scheduler = TaskScheduler::Get(*context);
+    for (auto classIdx = 0u; classIdx < SchedulingClassUtils::NUM_SCHEDULING_CLASSES; classIdx++) {
+        stats.push_back(scheduler->getSchedulingClassStats(static_cast<SchedulingClass>(classIdx)));
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = stats.size();
+    return std::make_unique<SchedulerInfoBindData>(std::move(stats), columns, numRows);
+}
+
+function_set SchedulerInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
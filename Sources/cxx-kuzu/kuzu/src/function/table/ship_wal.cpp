@@ -0,0 +1,51 @@
+#include "common/file_system/virtual_file_system.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/database_backup.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct ShipWALBindData final : TableFuncBindData {
+    std::string destinationPath;
+
+    explicit ShipWALBindData(std::string destinationPath)
+        : TableFuncBindData{0}, destinationPath{std::move(destinationPath)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ShipWALBindData>(destinationPath);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return std::make_unique<ShipWALBindData>(VirtualFileSystem::GetUnsafe(*context)->expandPath(
+        context, input->getLiteralVal<std::string>(0)));
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<ShipWALBindData>();
+    storage::DatabaseBackup::shipWAL(*input.context->clientContext, bindData->destinationPath);
+    return 0;
+}
+
+function_set ShipWALFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = true;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -13,9 +13,11 @@ namespace function {
 struct ProjectedGraphData {
     std::string name;
     std::string type;
+    // Memory used by the materialized snapshot of the graph.
+    uint64_t memoryUsage;
 
-    ProjectedGraphData(std::string name, std::string type)
-        : name{std::move(name)}, type{std::move(type)} {}
+    ProjectedGraphData(std::string name, std::string type, uint64_t memoryUsage)
+        : name{std::move(name)}, type{std::move(type)}, memoryUsage{memoryUsage} {}
 };
 
 struct ShowProjectedGraphBindData : public TableFuncBindData {
@@ -40,6 +42,7 @@ static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFunc
         auto graphData = projectedGraphData[morsel.startOffset + i];
         output.getValueVectorMutable(0).setValue(i, graphData.name);
         output.getValueVectorMutable(1).setValue(i, graphData.type);
+        output.getValueVectorMutable(2).setValue(i, graphData.memoryUsage);
     }
     return numTablesToOutput;
 }
@@ -52,12 +55,19 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const ClientContext* context,
     returnTypes.emplace_back(LogicalType::STRING());
     returnColumnNames.emplace_back("type");
     returnTypes.emplace_back(LogicalType::STRING());
+    returnColumnNames.emplace_back("memory_usage");
+    returnTypes.emplace_back(LogicalType::UINT64());
     returnColumnNames =
         TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
     auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
     std::vector<ProjectedGraphData> projectedGraphData;
     for (auto& [name, entry] : graph::GraphEntrySet::Get(*context)->getNameToEntryMap()) {
-        projectedGraphData.emplace_back(name, graph::GraphEntryTypeUtils::toString(entry->type));
+        uint64_t memoryUsage = 0;
+        if (entry->type == graph::GraphEntryType::NATIVE) {
+            memoryUsage = entry->cast<graph::ParsedNativeGraphEntry>().getSnapshotMemoryUsage();
+        }
+        projectedGraphData.emplace_back(name, graph::GraphEntryTypeUtils::toString(entry->type),
+            memoryUsage);
     }
     return std::make_unique<ShowProjectedGraphBindData>(std::move(projectedGraphData),
         std::move(columns));
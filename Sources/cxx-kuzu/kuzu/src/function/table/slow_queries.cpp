@@ -0,0 +1,84 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/query_stats.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+static constexpr FileIOCounter COUNTERS[] = {FileIOCounter::PINS, FileIOCounter::HITS,
+    FileIOCounter::MISSES, FileIOCounter::BYTES_READ, FileIOCounter::BYTES_WRITTEN};
+
+struct SlowQueriesBindData final : TableFuncBindData {
+    std::vector<main::SlowQuery> queries;
+
+    SlowQueriesBindData(std::vector<main::SlowQuery> queries, binder::expression_vector columns,
+        offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, queries{std::move(queries)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SlowQueriesBindData>(queries, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& queries = input.bindData->constPtrCast<SlowQueriesBindData>()->queries;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& query = queries[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, query.queryID);
+        output.getValueVectorMutable(1).setValue(i, query.query);
+        output.getValueVectorMutable(2).setValue(i, query.parameters);
+        output.getValueVectorMutable(3).setValue(i, query.compilingTimeMS);
+        output.getValueVectorMutable(4).setValue(i, query.executionTimeMS);
+        output.getValueVectorMutable(5).setValue(i, query.peakMemory);
+        for (auto j = 0u; j < std::size(COUNTERS); j++) {
+            output.getValueVectorMutable(6 + j).setValue(i, query.ioStats.get(COUNTERS[j]));
+        }
+        output.getValueVectorMutable(6 + std::size(COUNTERS)).setValue(i, query.plan);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"query_id", "query", "parameters", "compiling_time_ms",
+        "execution_time_ms", "peak_memory", "num_pins", "num_hits", "num_misses", "bytes_read",
+        "bytes_written", "plan"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    columnTypes.push_back(LogicalType::UINT64());
+    for (auto i = 0u; i < std::size(COUNTERS); i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    columnTypes.push_back(LogicalType::STRING());
+    auto queries = context->getDatabase()->getSlowQueryLog()->getQueries();
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = queries.size();
+    return std::make_unique<SlowQueriesBindData>(std::move(queries), columns, numRows);
+}
+
+function_set SlowQueriesFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,167 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/index/sorted_index.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct SortedIndexBindData final : TableFuncBindData {
+    catalog::NodeTableCatalogEntry* tableEntry;
+    std::string indexName;
+    property_id_t propertyID;
+
+    SortedIndexBindData(catalog::NodeTableCatalogEntry* tableEntry, std::string indexName,
+        property_id_t propertyID)
+        : TableFuncBindData{0}, tableEntry{tableEntry}, indexName{std::move(indexName)},
+          propertyID{propertyID} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SortedIndexBindData>(tableEntry, indexName, propertyID);
+    }
+};
+
+static catalog::NodeTableCatalogEntry* bindNodeTable(const main::ClientContext& context,
+    const std::string& tableName) {
+    binder::Binder::validateTableExistence(context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(context)->getTableCatalogEntry(
+        transaction::Transaction::Get(context), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    return tableEntry->ptrCast<catalog::NodeTableCatalogEntry>();
+}
+
+static void validateAutoTransaction(const main::ClientContext& context,
+    const std::string& funcName) {
+    if (!transaction::TransactionContext::Get(context)->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", funcName)};
+    }
+}
+
+static std::unique_ptr<TableFuncBindData> createBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, CreateSortedIndexFunction::name);
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto indexName = input->getLiteralVal<std::string>(1);
+    const auto propertyName = input->getLiteralVal<std::string>(2);
+    const auto tableEntry = bindNodeTable(*context, tableName);
+    binder::Binder::validateColumnExistence(tableEntry, propertyName);
+    const auto& type = tableEntry->getProperty(propertyName).getType();
+    if (!storage::SortedIndex::isSupported(type)) {
+        throw BinderException{stringFormat(
+            "Cannot create a sorted index on property {} of type {}. Only numeric, date, "
+            "timestamp and string properties can be indexed.",
+            propertyName, type.toString())};
+    }
+    if (catalog::Catalog::Get(*context)->containsIndex(transaction::Transaction::Get(*context),
+            tableEntry->getTableID(), indexName)) {
+        throw BinderException{
+            stringFormat("Index {} already exists in table {}.", indexName, tableName)};
+    }
+    return std::make_unique<SortedIndexBindData>(tableEntry, indexName,
+        tableEntry->getPropertyID(propertyName));
+}
+
+static offset_t createTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<SortedIndexBindData>();
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = bindData->tableEntry->getTableID();
+    const auto columnID = bindData->tableEntry->getColumnID(bindData->propertyID);
+    auto& nodeTable =
+        storage::StorageManager::Get(*context)->getTable(tableID)->cast<storage::NodeTable>();
+    auto indexEntry = std::make_unique<catalog::IndexCatalogEntry>(
+        storage::SortedIndex::TYPE_NAME, tableID, bindData->indexName,
+        std::vector{bindData->propertyID}, std::make_unique<storage::SortedIndexAuxInfo>());
+    catalog::Catalog::Get(*context)->createIndex(transaction, std::move(indexEntry));
+    const auto indexType = storage::SortedIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData->indexName, indexType.typeName, tableID, {columnID},
+        {nodeTable.getColumn(columnID).getDataType().getPhysicalType()},
+        indexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        indexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    auto index = std::make_unique<storage::SortedIndex>(std::move(indexInfo),
+        std::make_unique<storage::IndexStorageInfo>(), nodeTable);
+    index->build(transaction, storage::MemoryManager::Get(*context));
+    nodeTable.addIndex(std::move(index));
+    // The index is added to the table outside of the WAL, so it is persisted by checkpointing.
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set CreateSortedIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = createBindFunc;
+    func->tableFunc = createTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> dropBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, DropSortedIndexFunction::name);
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto indexName = input->getLiteralVal<std::string>(1);
+    const auto tableEntry = bindNodeTable(*context, tableName);
+    auto catalog = catalog::Catalog::Get(*context);
+    auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = tableEntry->getTableID();
+    if (!catalog->containsIndex(transaction, tableID, indexName) ||
+        catalog->getIndex(transaction, tableID, indexName)->getIndexType() !=
+            storage::SortedIndex::TYPE_NAME) {
+        throw BinderException{
+            stringFormat("Table {} doesn't have a sorted index with name {}.", tableName,
+                indexName)};
+    }
+    const auto indexEntry = catalog->getIndex(transaction, tableID, indexName);
+    return std::make_unique<SortedIndexBindData>(tableEntry, indexName,
+        indexEntry->getPropertyIDs()[0]);
+}
+
+static offset_t dropTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto context = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<SortedIndexBindData>();
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = bindData->tableEntry->getTableID();
+    catalog::Catalog::Get(*context)->dropIndex(transaction, tableID, bindData->indexName);
+    storage::StorageManager::Get(*context)->getTable(tableID)->cast<storage::NodeTable>().dropIndex(
+        bindData->indexName);
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set DropSortedIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = dropBindFunc;
+    func->tableFunc = dropTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -15,6 +15,9 @@ using namespace kuzu::main;
 namespace kuzu {
 namespace function {
 
+// cardinality, changes_since_refresh and last_refreshed come before the distinct counts.
+static constexpr idx_t NUM_TABLE_COLUMNS = 3;
+
 struct StatsInfoBindData final : TableFuncBindData {
     TableCatalogEntry* tableEntry;
     storage::Table* table;
@@ -39,8 +42,17 @@ static offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/, const Table
         const auto& nodeTable = table->cast<storage::NodeTable>();
         const auto stats = nodeTable.getStats(transaction::Transaction::Get(*bindData->context));
         output.getValueVectorMutable(0).setValue<cardinality_t>(0, stats.getTableCard());
+        output.getValueVectorMutable(1).setValue<int64_t>(0, stats.getNumChangesSinceRefresh());
+        auto& lastRefreshedVector = output.getValueVectorMutable(2);
+        if (stats.getLastRefreshTime() == 0) {
+            lastRefreshedVector.setNull(0, true);
+        } else {
+            lastRefreshedVector.setNull(0, false);
+            lastRefreshedVector.setValue(0, timestamp_t{stats.getLastRefreshTime()});
+        }
         for (auto i = 0u; i < nodeTable.getNumColumns(); ++i) {
-            output.getValueVectorMutable(i + 1).setValue(0, stats.getNumDistinctValues(i));
+            output.getValueVectorMutable(i + NUM_TABLE_COLUMNS)
+                .setValue(0, stats.getNumDistinctValues(i));
         }
     } break;
     default: {
@@ -64,9 +76,14 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const ClientContext* context,
             "Stats from a non-node table " + tableName + " is not supported yet!"};
     }
 
-    std::vector<std::string> columnNames = {"cardinality"};
+    // Rows deleted or updated since the stats were last refreshed by CALL analyze(), which the
+    // distinct counts may still include.
+    std::vector<std::string> columnNames = {"cardinality", "changes_since_refresh",
+        "last_refreshed"};
     std::vector<LogicalType> columnTypes;
     columnTypes.push_back(LogicalType::INT64());
+    columnTypes.push_back(LogicalType::INT64());
+    columnTypes.push_back(LogicalType::TIMESTAMP());
     for (auto& propDef : tableEntry->getProperties()) {
         columnNames.push_back(propDef.getName() + "_distinct_count");
         columnTypes.push_back(LogicalType::INT64());
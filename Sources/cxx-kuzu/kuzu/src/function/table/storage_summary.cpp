@@ -0,0 +1,348 @@
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/system_config.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/page_manager.h"
+#include "storage/storage_manager.h"
+#include "storage/table/list_chunk_data.h"
+#include "storage/table/list_column.h"
+#include "storage/table/node_table.h"
+#include "storage/table/rel_table.h"
+#include "storage/table/string_chunk_data.h"
+#include "storage/table/string_column.h"
+#include "storage/table/struct_chunk_data.h"
+#include "storage/table/struct_column.h"
+
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+// Chunks of one column stored with one compression type. Sub-columns (null, string dictionary,
+// list offsets and data, struct fields) get their own entries.
+struct StorageSummaryEntry {
+    std::string columnName;
+    std::string dataType;
+    CompressionType compression = CompressionType::UNCOMPRESSED;
+    uint64_t numChunks = 0;
+    uint64_t numValues = 0;
+    uint64_t numPages = 0;
+    uint64_t uncompressedBytes = 0;
+};
+
+struct FileSpaceSummary {
+    uint64_t numPages = 0;
+    uint64_t numFreePages = 0;
+    uint64_t numFreeRanges = 0;
+    uint64_t largestFreeRange = 0;
+};
+
+struct StorageSummaryBindData final : TableFuncBindData {
+    std::vector<StorageSummaryEntry> entries;
+    // Number of chunks of each column over all of its compression types.
+    std::unordered_map<std::string, uint64_t> numChunksPerColumn;
+    FileSpaceSummary fileSpace;
+
+    StorageSummaryBindData(std::vector<StorageSummaryEntry> entries,
+        std::unordered_map<std::string, uint64_t> numChunksPerColumn, FileSpaceSummary fileSpace,
+        binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), entries.size()}, entries{std::move(entries)},
+          numChunksPerColumn{std::move(numChunksPerColumn)}, fileSpace{fileSpace} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<StorageSummaryBindData>(entries, numChunksPerColumn, fileSpace,
+            columns);
+    }
+};
+
+static std::string compressionTypeToString(CompressionType compression) {
+    switch (compression) {
+    case CompressionType::UNCOMPRESSED:
+        return "UNCOMPRESSED";
+    case CompressionType::INTEGER_BITPACKING:
+        return "INTEGER_BITPACKING";
+    case CompressionType::BOOLEAN_BITPACKING:
+        return "BOOLEAN_BITPACKING";
+    case CompressionType::CONSTANT:
+        return "CONSTANT";
+    case CompressionType::ALP:
+        return "ALP";
+    case CompressionType::DELTA_BITPACKING:
+        return "DELTA_BITPACKING";
+    case CompressionType::FSST:
+        return "FSST";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+// Size the values of the chunk would take on disk without compression. Nested and string chunks
+// only hold offsets into their sub-columns, which are accounted for separately.
+static uint64_t getUncompressedBytes(const ColumnChunkData& chunkData, uint64_t numValues) {
+    switch (chunkData.getDataType().getPhysicalType()) {
+    case PhysicalTypeID::BOOL:
+        return (numValues + 7) / 8;
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::ARRAY:
+    case PhysicalTypeID::STRUCT:
+        return 0;
+    default:
+        return numValues * chunkData.getNumBytesPerValue();
+    }
+}
+
+class StorageSummaryCollector {
+public:
+    void collectNodeGroup(const std::vector<const Column*>& columns, NodeGroup* nodeGroup) {
+        for (auto chunkIdx = 0ul; chunkIdx < nodeGroup->getNumChunkedGroups(); chunkIdx++) {
+            collectChunkedGroup(columns, nodeGroup->getChunkedNodeGroup(chunkIdx));
+        }
+        if (nodeGroup->getFormat() == NodeGroupDataFormat::CSR) {
+            auto& csrNodeGroup = nodeGroup->cast<CSRNodeGroup>();
+            if (auto persistentChunk = csrNodeGroup.getPersistentChunkedGroup()) {
+                collectChunkedGroup(columns, persistentChunk);
+            }
+        }
+    }
+
+    std::vector<StorageSummaryEntry> entries;
+    std::unordered_map<std::string, uint64_t> numChunksPerColumn;
+
+private:
+    void collectChunkedGroup(const std::vector<const Column*>& columns,
+        ChunkedNodeGroup* chunkedGroup) {
+        auto numColumns = chunkedGroup->getNumColumns();
+        for (auto i = 0u; i < numColumns; i++) {
+            for (auto* segment : chunkedGroup->getColumnChunk(i).getSegments()) {
+                collectChunkData(*columns[i], *segment);
+            }
+        }
+        if (chunkedGroup->getFormat() == NodeGroupDataFormat::CSR) {
+            auto& csrHeader = chunkedGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
+            for (auto* segment : csrHeader.offset->getSegments()) {
+                collectChunkData(*columns[numColumns], *segment, true /* ignoreNull */);
+            }
+            for (auto* segment : csrHeader.length->getSegments()) {
+                collectChunkData(*columns[numColumns + 1], *segment, true /* ignoreNull */);
+            }
+        }
+    }
+
+    void collectChunkData(const Column& column, const ColumnChunkData& chunkData,
+        bool ignoreNull = false) {
+        auto metadata = chunkData.getResidencyState() == ResidencyState::IN_MEMORY ?
+                            chunkData.getMetadataToFlush() :
+                            chunkData.getMetadata();
+        auto& columnType = chunkData.getDataType();
+        auto columnName = std::string{column.getName()};
+        auto& entry = getEntry(columnName, columnType, metadata.compMeta.compression);
+        entry.numChunks++;
+        entry.numValues += metadata.numValues;
+        entry.numPages += metadata.getNumPages();
+        entry.uncompressedBytes += getUncompressedBytes(chunkData, metadata.numValues);
+        numChunksPerColumn[columnName]++;
+        if (columnType.getPhysicalType() == PhysicalTypeID::INTERNAL_ID) {
+            ignoreNull = true;
+        }
+        if (!ignoreNull && chunkData.hasNullData()) {
+            collectChunkData(*column.getNullColumn(), *chunkData.getNullData());
+        }
+        switch (columnType.getPhysicalType()) {
+        case PhysicalTypeID::STRUCT: {
+            auto& structChunk = chunkData.cast<StructChunkData>();
+            const auto& structColumn = ku_dynamic_cast<const StructColumn&>(column);
+            for (auto i = 0u; i < structChunk.getNumChildren(); i++) {
+                collectChunkData(*structColumn.getChild(i), structChunk.getChild(i));
+            }
+        } break;
+        case PhysicalTypeID::STRING: {
+            auto& stringChunk = chunkData.cast<StringChunkData>();
+            auto& dictionaryChunk = stringChunk.getDictionaryChunk();
+            const auto& stringColumn = ku_dynamic_cast<const StringColumn&>(column);
+            collectChunkData(*stringColumn.getIndexColumn(), *stringChunk.getIndexColumnChunk());
+            collectChunkData(*stringColumn.getDictionary().getDataColumn(),
+                *dictionaryChunk.getStringDataChunk());
+            collectChunkData(*stringColumn.getDictionary().getOffsetColumn(),
+                *dictionaryChunk.getOffsetChunk());
+        } break;
+        case PhysicalTypeID::ARRAY:
+        case PhysicalTypeID::LIST: {
+            auto& listChunk = chunkData.cast<ListChunkData>();
+            const auto& listColumn = ku_dynamic_cast<const ListColumn&>(column);
+            collectChunkData(*listColumn.getOffsetColumn(), *listChunk.getOffsetColumnChunk());
+            collectChunkData(*listColumn.getSizeColumn(), *listChunk.getSizeColumnChunk());
+            collectChunkData(*listColumn.getDataColumn(), *listChunk.getDataColumnChunk());
+        } break;
+        default: {
+            // DO NOTHING.
+        }
+        }
+    }
+
+    StorageSummaryEntry& getEntry(const std::string& columnName, const LogicalType& dataType,
+        CompressionType compression) {
+        auto key = std::make_pair(columnName, compression);
+        auto it = entryIdxes.find(key);
+        if (it != entryIdxes.end()) {
+            return entries[it->second];
+        }
+        entryIdxes.emplace(key, entries.size());
+        StorageSummaryEntry entry;
+        entry.columnName = columnName;
+        entry.dataType = dataType.toString();
+        entry.compression = compression;
+        entries.push_back(std::move(entry));
+        return entries.back();
+    }
+
+private:
+    std::map<std::pair<std::string, CompressionType>, idx_t> entryIdxes;
+};
+
+static void collectTable(const ClientContext& context, const TableCatalogEntry& tableEntry,
+    StorageSummaryCollector& collector) {
+    auto storageManager = StorageManager::Get(context);
+    switch (tableEntry.getTableType()) {
+    case TableType::NODE: {
+        auto& nodeTable = storageManager->getTable(tableEntry.getTableID())->cast<NodeTable>();
+        std::vector<const Column*> columns;
+        for (auto columnID = 0u; columnID < nodeTable.getNumColumns(); columnID++) {
+            columns.push_back(&nodeTable.getColumn(columnID));
+        }
+        for (auto i = 0ul; i < nodeTable.getNumNodeGroups(); i++) {
+            collector.collectNodeGroup(columns, nodeTable.getNodeGroup(i));
+        }
+    } break;
+    case TableType::REL: {
+        auto& relGroupEntry = tableEntry.constCast<RelGroupCatalogEntry>();
+        for (auto& innerEntryInfo : relGroupEntry.getRelEntryInfos()) {
+            auto& relTable = storageManager->getTable(innerEntryInfo.oid)->cast<RelTable>();
+            for (auto direction : relTable.getStorageDirections()) {
+                auto directedRelTableData = relTable.getDirectedTableData(direction);
+                std::vector<const Column*> columns;
+                for (auto columnID = 0u; columnID < relTable.getNumColumns(); columnID++) {
+                    columns.push_back(directedRelTableData->getColumn(columnID));
+                }
+                columns.push_back(directedRelTableData->getCSROffsetColumn());
+                columns.push_back(directedRelTableData->getCSRLengthColumn());
+                for (auto i = 0ul; i < directedRelTableData->getNumNodeGroups(); i++) {
+                    collector.collectNodeGroup(columns, directedRelTableData->getNodeGroup(i));
+                }
+            }
+        }
+    } break;
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+static FileSpaceSummary getFileSpaceSummary(const ClientContext& context) {
+    FileSpaceSummary summary;
+    if (auto dataFH = StorageManager::Get(context)->getDataFH()) {
+        summary.numPages = dataFH->getNumPages();
+    }
+    auto pageManager = PageManager::Get(context);
+    auto freeEntries = pageManager->getFreeEntries(0, pageManager->getNumFreeEntries());
+    summary.numFreeRanges = freeEntries.size();
+    for (auto& freeEntry : freeEntries) {
+        summary.numFreePages += freeEntry.numPages;
+        summary.largestFreeRange =
+            std::max<uint64_t>(summary.largestFreeRange, freeEntry.numPages);
+    }
+    return summary;
+}
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto bindData = input.bindData->constPtrCast<StorageSummaryBindData>();
+    const auto& fileSpace = bindData->fileSpace;
+    // Free pages outside of the largest free range, which only fit smaller allocations.
+    const auto fragmentation =
+        fileSpace.numFreePages == 0 ?
+            0.0 :
+            1.0 - static_cast<double>(fileSpace.largestFreeRange) / fileSpace.numFreePages;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& entry = bindData->entries[morsel.startOffset + i];
+        const auto numBytes = entry.numPages * KUZU_PAGE_SIZE;
+        const auto numColumnChunks = bindData->numChunksPerColumn.at(entry.columnName);
+        output.getValueVectorMutable(0).setValue(i, entry.columnName);
+        output.getValueVectorMutable(1).setValue(i, entry.dataType);
+        output.getValueVectorMutable(2).setValue(i, compressionTypeToString(entry.compression));
+        output.getValueVectorMutable(3).setValue<uint64_t>(i, entry.numChunks);
+        output.getValueVectorMutable(4).setValue(i,
+            static_cast<double>(entry.numChunks) / numColumnChunks);
+        output.getValueVectorMutable(5).setValue<uint64_t>(i, entry.numValues);
+        output.getValueVectorMutable(6).setValue<uint64_t>(i, entry.numPages);
+        output.getValueVectorMutable(7).setValue<uint64_t>(i, numBytes);
+        output.getValueVectorMutable(8).setValue<uint64_t>(i, entry.uncompressedBytes);
+        // Constant chunks take no page, so their ratio is left undefined.
+        auto& ratioVector = output.getValueVectorMutable(9);
+        ratioVector.setNull(i, numBytes == 0);
+        if (numBytes != 0) {
+            ratioVector.setValue(i, static_cast<double>(entry.uncompressedBytes) / numBytes);
+        }
+        output.getValueVectorMutable(10).setValue<uint64_t>(i, fileSpace.numPages);
+        output.getValueVectorMutable(11).setValue<uint64_t>(i, fileSpace.numFreePages);
+        output.getValueVectorMutable(12).setValue<uint64_t>(i, fileSpace.numFreeRanges);
+        output.getValueVectorMutable(13).setValue<uint64_t>(i, fileSpace.largestFreeRange);
+        output.getValueVectorMutable(14).setValue(i, fragmentation);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames = {"column_name", "data_type", "compression",
+        "num_chunks", "chunk_fraction", "num_values", "num_pages", "num_bytes",
+        "uncompressed_bytes", "compression_ratio", "file_num_pages", "file_num_free_pages",
+        "file_num_free_ranges", "file_largest_free_range", "free_space_fragmentation"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    for (auto i = 0u; i < 4; i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    columnTypes.push_back(LogicalType::DOUBLE());
+    for (auto i = 0u; i < 4; i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    columnTypes.push_back(LogicalType::DOUBLE());
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto catalog = Catalog::Get(*context);
+    auto transaction = transaction::Transaction::Get(*context);
+    if (!catalog->containsTable(transaction, tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    StorageSummaryCollector collector;
+    collectTable(*context, *catalog->getTableCatalogEntry(transaction, tableName), collector);
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<StorageSummaryBindData>(std::move(collector.entries),
+        std::move(collector.numChunksPerColumn), getFileSpaceSummary(*context), columns);
+}
+
+function_set StorageSummaryFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
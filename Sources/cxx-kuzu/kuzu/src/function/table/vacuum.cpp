@@ -0,0 +1,88 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct VacuumBindData final : TableFuncBindData {
+    catalog::TableCatalogEntry* tableEntry;
+
+    explicit VacuumBindData(catalog::TableCatalogEntry* tableEntry)
+        : TableFuncBindData{0}, tableEntry{tableEntry} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<VacuumBindData>(tableEntry);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!transaction::TransactionContext::Get(*context)->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", VacuumFunction::name)};
+    }
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), tableName);
+    if (tableEntry->getType() != catalog::CatalogEntryType::NODE_TABLE_ENTRY &&
+        tableEntry->getType() != catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        throw BinderException(
+            stringFormat("Cannot vacuum {}. Only node and rel tables can be vacuumed.",
+                tableEntry->getName()));
+    }
+    return std::make_unique<VacuumBindData>(tableEntry);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<VacuumBindData>();
+    auto context = input.context->clientContext;
+    auto storageManager = storage::StorageManager::Get(*context);
+    if (bindData->tableEntry->getType() == catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        // Deleted rels are dropped from the CSR regions they are in whenever the regions are
+        // checkpointed, so rel tables only need to be checkpointed.
+        for (auto& relEntryInfo :
+            bindData->tableEntry->constCast<catalog::RelGroupCatalogEntry>().getRelEntryInfos()) {
+            storageManager->getTable(relEntryInfo.oid)->setHasChanges();
+        }
+    } else {
+        storageManager->getTable(bindData->tableEntry->getTableID())
+            ->cast<storage::NodeTable>()
+            .compactOnNextCheckpoint();
+    }
+    // The table is compacted by the checkpoint at the end of the transaction, which returns the
+    // pages it frees to the free space manager.
+    transaction::Transaction::Get(*context)->setForceCheckpoint();
+    return 0;
+}
+
+function_set VacuumFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,44 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/wal/wal.h"
+
+namespace kuzu {
+namespace function {
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    const auto* wal = storage::WAL::Get(*input.context->clientContext);
+    const auto pos = output.getValueVectorMutable(0).state->getSelVector()[0];
+    output.getValueVectorMutable(0).setValue<uint64_t>(pos, wal->getNumCommits());
+    output.getValueVectorMutable(1).setValue<uint64_t>(pos, wal->getNumSyncs());
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> returnColumnNames{"num_commits", "num_syncs"};
+    std::vector<common::LogicalType> returnTypes;
+    returnTypes.push_back(common::LogicalType::UINT64());
+    returnTypes.push_back(common::LogicalType::UINT64());
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<TableFuncBindData>(std::move(columns), 1 /* one row result */);
+}
+
+function_set WALInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
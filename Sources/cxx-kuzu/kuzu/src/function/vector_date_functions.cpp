@@ -106,16 +106,20 @@ function_set MonthNameFunction::getFunctionSet() {
 
 function_set CurrentDateFunction::getFunctionSet() {
     function_set result;
-    result.push_back(make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
-        LogicalTypeID::DATE, ScalarFunction::NullaryAuxilaryExecFunction<date_t, CurrentDate>));
+    auto function = make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
+        LogicalTypeID::DATE, ScalarFunction::NullaryAuxilaryExecFunction<date_t, CurrentDate>);
+    function->isDeterministic = false;
+    result.push_back(std::move(function));
     return result;
 }
 
 function_set CurrentTimestampFunction::getFunctionSet() {
     function_set result;
-    result.push_back(
+    auto function =
         make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{}, LogicalTypeID::TIMESTAMP,
-            ScalarFunction::NullaryAuxilaryExecFunction<timestamp_tz_t, CurrentTimestamp>));
+            ScalarFunction::NullaryAuxilaryExecFunction<timestamp_tz_t, CurrentTimestamp>);
+    function->isDeterministic = false;
+    result.push_back(std::move(function));
     return result;
 }
 
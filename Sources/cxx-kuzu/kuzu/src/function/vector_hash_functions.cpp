@@ -18,11 +18,43 @@ static void executeOnValue(const ValueVector& operand, sel_t operandPos, ValueVe
         result.getValue<RESULT_TYPE>(resultPos));
 }
 
+// Fixed-size keys whose values can be read even at null positions.
+template<typename T>
+static constexpr bool isFixedSizeKey =
+    (std::integral<T> && !std::is_same_v<T, bool>) || std::floating_point<T> ||
+    std::is_same_v<T, int128_t> || std::is_same_v<T, internalID_t>;
+
+// Hashes contiguous fixed-size keys in a loop without branches, which compilers can vectorize.
+// Null positions are hashed as well and overwritten afterwards.
+template<typename OPERAND_TYPE, typename RESULT_TYPE>
+static void executeOnContiguousValues(const ValueVector& operand, uint64_t numValues,
+    RESULT_TYPE* resultValues) {
+    auto operandValues = reinterpret_cast<const OPERAND_TYPE*>(operand.getData());
+    for (auto i = 0u; i < numValues; i++) {
+        Hash::operation(operandValues[i], resultValues[i]);
+    }
+    if (operand.hasNoNullsGuarantee()) {
+        return;
+    }
+    for (auto i = 0u; i < numValues; i++) {
+        if (operand.isNull(i)) {
+            resultValues[i] = NULL_HASH;
+        }
+    }
+}
+
 template<typename OPERAND_TYPE, typename RESULT_TYPE>
 void UnaryHashFunctionExecutor::execute(const ValueVector& operand,
     const SelectionView& operandSelectVec, ValueVector& result,
     const SelectionView& resultSelectVec) {
     auto resultValues = (RESULT_TYPE*)result.getData();
+    if constexpr (isFixedSizeKey<OPERAND_TYPE>) {
+        if (operandSelectVec.isUnfiltered() && resultSelectVec.isUnfiltered()) {
+            executeOnContiguousValues<OPERAND_TYPE, RESULT_TYPE>(operand,
+                operandSelectVec.getSelSize(), resultValues);
+            return;
+        }
+    }
     if (operand.hasNoNullsGuarantee()) {
         if (operandSelectVec.isUnfiltered()) {
             for (auto i = 0u; i < operandSelectVec.getSelSize(); i++) {
@@ -93,7 +125,15 @@ void BinaryHashFunctionExecutor::execute(const common::ValueVector& left,
     const SelectionView& resultSelVec) {
     validateSelState(leftSelVec, rightSelVec, resultSelVec);
     result.resetAuxiliaryBuffer();
-    if (leftSelVec.getSelSize() != 1 && rightSelVec.getSelSize() != 1) {
+    if (leftSelVec.getSelSize() != 1 && rightSelVec.getSelSize() != 1 &&
+        leftSelVec.isUnfiltered() && rightSelVec.isUnfiltered() && resultSelVec.isUnfiltered()) {
+        auto leftValues = reinterpret_cast<const LEFT_TYPE*>(left.getData());
+        auto rightValues = reinterpret_cast<const RIGHT_TYPE*>(right.getData());
+        auto resultValues = reinterpret_cast<RESULT_TYPE*>(result.getData());
+        for (auto i = 0u; i < leftSelVec.getSelSize(); i++) {
+            FUNC::operation(leftValues[i], rightValues[i], resultValues[i]);
+        }
+    } else if (leftSelVec.getSelSize() != 1 && rightSelVec.getSelSize() != 1) {
         for (auto i = 0u; i < leftSelVec.getSelSize(); i++) {
             auto leftPos = leftSelVec[i];
             auto rightPos = rightSelVec[i];
@@ -7,7 +7,6 @@
 #include "function/string/functions/lpad_function.h"
 #include "function/string/functions/regexp_extract_all_function.h"
 #include "function/string/functions/regexp_extract_function.h"
-#include "function/string/functions/regexp_matches_function.h"
 #include "function/string/functions/regexp_split_to_array_function.h"
 #include "function/string/functions/repeat_function.h"
 #include "function/string/functions/right_function.h"
@@ -236,16 +235,6 @@ function_set SubStrFunction::getFunctionSet() {
     return functionSet;
 }
 
-function_set RegexpMatchesFunction::getFunctionSet() {
-    function_set functionSet;
-    functionSet.emplace_back(make_unique<ScalarFunction>(name,
-        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
-        LogicalTypeID::BOOL,
-        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
-        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpMatches>));
-    return functionSet;
-}
-
 function_set RegexpExtractFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
@@ -10,9 +10,11 @@ namespace function {
 
 function_set GenRandomUUIDFunction::getFunctionSet() {
     function_set definitions;
-    definitions.push_back(
+    auto function =
         make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{}, LogicalTypeID::UUID,
-            ScalarFunction::NullaryAuxilaryExecFunction<ku_uuid_t, GenRandomUUID>));
+            ScalarFunction::NullaryAuxilaryExecFunction<ku_uuid_t, GenRandomUUID>);
+    function->isDeterministic = false;
+    definitions.push_back(std::move(function));
     return definitions;
 }
 
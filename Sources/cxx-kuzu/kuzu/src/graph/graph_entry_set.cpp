@@ -21,6 +21,16 @@ void GraphEntrySet::validateGraphExist(const std::string& name) const {
     }
 }
 
+uint64_t GraphEntrySet::getSnapshotMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& [_, entry] : nameToEntry) {
+        if (entry->type == GraphEntryType::NATIVE) {
+            memoryUsage += entry->cast<ParsedNativeGraphEntry>().getSnapshotMemoryUsage();
+        }
+    }
+    return memoryUsage;
+}
+
 GraphEntrySet* GraphEntrySet::Get(const main::ClientContext& context) {
     return context.graphEntrySet.get();
 }
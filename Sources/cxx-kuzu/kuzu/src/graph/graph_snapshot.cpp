@@ -0,0 +1,218 @@
+#include "graph/graph_snapshot.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "graph/graph_entry.h"
+#include "graph/on_disk_graph.h"
+#include "storage/storage_manager.h"
+#include "storage/table/rel_table.h"
+#include "storage/table/rel_table_csr_cache.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace graph {
+
+static table_id_t getBoundTableID(const RelTable& table, RelDataDirection direction) {
+    return direction == RelDataDirection::FWD ? table.getFromNodeTableID() :
+                                                table.getToNodeTableID();
+}
+
+uint64_t GraphSnapshotDelta::getNumTouchedNodes() const {
+    uint64_t numTouchedNodes = 0;
+    for (auto& [tableID, offsets] : touchedNodes) {
+        numTouchedNodes += offsets.size();
+    }
+    return numTouchedNodes;
+}
+
+static bool hasPredicate(const std::vector<NativeGraphEntryTableInfo>& infos) {
+    return std::any_of(infos.begin(), infos.end(),
+        [](const auto& info) { return info.predicate != nullptr; });
+}
+
+std::unique_ptr<GraphSnapshot> GraphSnapshot::build(main::ClientContext& context,
+    const NativeGraphEntry& entry, bool relabel, const GraphSnapshot* previous) {
+    auto transaction = transaction::Transaction::Get(context);
+    if (!transaction->isReadOnly()) {
+        return nullptr;
+    }
+    auto storageManager = StorageManager::Get(context);
+    auto memoryManager = MemoryManager::Get(context);
+    auto snapshot = std::unique_ptr<GraphSnapshot>(new GraphSnapshot(transaction->getStartTS()));
+    for (auto& nodeInfo : entry.nodeInfos) {
+        auto tableID = nodeInfo.entry->getTableID();
+        snapshot->numNodes[tableID] =
+            storageManager->getTable(tableID)->getNumTotalRows(transaction);
+    }
+    // Rels with predicates are read through a graph without a snapshot, which evaluates the
+    // predicates while scanning the tables.
+    std::unique_ptr<OnDiskGraph> filteringGraph;
+    if (hasPredicate(entry.relInfos)) {
+        auto filteringEntry = entry.copy();
+        filteringEntry.snapshot = nullptr;
+        filteringGraph = std::make_unique<OnDiskGraph>(&context, std::move(filteringEntry));
+    }
+    for (auto& relInfo : entry.relInfos) {
+        auto& relGroupEntry = relInfo.entry->constCast<RelGroupCatalogEntry>();
+        for (auto& relEntryInfo : relGroupEntry.getRelEntryInfos()) {
+            auto table = storageManager->getTable(relEntryInfo.oid)->ptrCast<RelTable>();
+            auto nbrScanState = relInfo.predicate == nullptr ?
+                                    nullptr :
+                                    filteringGraph->prepareRelScan(*relInfo.entry,
+                                        relEntryInfo.oid, INVALID_TABLE_ID, {} /* relProperties */);
+            auto& caches = snapshot->csrCaches[relEntryInfo.oid];
+            for (auto direction : relGroupEntry.getRelDataDirections()) {
+                auto boundTableID = getBoundTableID(*table, direction);
+                auto numBoundNodes =
+                    storageManager->getTable(boundTableID)->getNumTotalRows(transaction);
+                std::shared_ptr<const RelTableCSRCache> cache;
+                if (nbrScanState == nullptr) {
+                    cache = RelTableCSRCache::build(transaction, *table, direction, *memoryManager,
+                        numBoundNodes);
+                } else {
+                    auto nbrTableID = RelDirectionUtils::getNbrTableID(direction,
+                        table->getFromNodeTableID(), table->getToNodeTableID());
+                    cache = RelTableCSRCache::build(transaction->getStartTS(), nbrTableID,
+                        *memoryManager, numBoundNodes, [&](offset_t boundOffset, std::vector<offset_t>& nbrs) {
+                            const auto boundNodeID = nodeID_t{boundOffset, boundTableID};
+                            auto& graph = *filteringGraph;
+                            auto iterator = direction == RelDataDirection::FWD ?
+                                                graph.scanFwd(boundNodeID, *nbrScanState) :
+                                                graph.scanBwd(boundNodeID, *nbrScanState);
+                            for (auto nbrNodeID : iterator.collectNbrNodes()) {
+                                nbrs.push_back(nbrNodeID.offset);
+                            }
+                        });
+                }
+                snapshot->memoryUsage += cache->getMemoryUsage();
+                caches[RelDirectionUtils::relDirectionToKeyIdx(direction)] = std::move(cache);
+            }
+        }
+    }
+    // Changes of the node properties that node predicates read are not materialized. Changes of
+    // rel properties that rel predicates read are, as rels that are added to or removed from the
+    // filtered adjacency.
+    if (previous != nullptr && previous->numNodes == snapshot->numNodes &&
+        !hasPredicate(entry.nodeInfos)) {
+        snapshot->computeDelta(context, *previous);
+    }
+    if (relabel) {
+        snapshot->relabel(context);
+    }
+    return snapshot;
+}
+
+void GraphSnapshot::computeDelta(main::ClientContext& context, const GraphSnapshot& previous) {
+    auto storageManager = StorageManager::Get(context);
+    delta = std::make_unique<GraphSnapshotDelta>();
+    delta->previousSnapshotTS = previous.snapshotTS;
+    std::vector<offset_t> addedNbrs, removedNbrs;
+    for (auto& [relTableID, caches] : csrCaches) {
+        auto table = storageManager->getTable(relTableID)->ptrCast<RelTable>();
+        for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+            auto& cache = caches[RelDirectionUtils::relDirectionToKeyIdx(direction)];
+            auto previousCache = previous.getCSRCache(relTableID, direction);
+            if (cache == nullptr || previousCache == nullptr) {
+                continue;
+            }
+            auto boundTableID = getBoundTableID(*table, direction);
+            auto nbrTableID = RelDirectionUtils::getNbrTableID(direction,
+                table->getFromNodeTableID(), table->getToNodeTableID());
+            auto& touchedBoundNodes = delta->touchedNodes[boundTableID];
+            auto& touchedNbrs = delta->touchedNodes[nbrTableID];
+            for (auto offset = 0u; offset < numNodes.at(boundTableID); offset++) {
+                addedNbrs.clear();
+                removedNbrs.clear();
+                cache->diffNbrs(*previousCache, offset, addedNbrs, removedNbrs);
+                if (addedNbrs.empty() && removedNbrs.empty()) {
+                    continue;
+                }
+                delta->hasRemovedRels |= !removedNbrs.empty();
+                touchedBoundNodes.push_back(offset);
+                touchedNbrs.insert(touchedNbrs.end(), addedNbrs.begin(), addedNbrs.end());
+                touchedNbrs.insert(touchedNbrs.end(), removedNbrs.begin(), removedNbrs.end());
+            }
+        }
+    }
+    for (auto& [tableID, offsets] : delta->touchedNodes) {
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        offsets.shrink_to_fit();
+        memoryUsage += offsets.capacity() * sizeof(offset_t);
+    }
+}
+
+void GraphSnapshot::relabel(main::ClientContext& context) {
+    auto storageManager = StorageManager::Get(context);
+    // The degree of a node sums its neighbours over all materialized directions of all rel tables.
+    table_id_map_t<std::vector<uint64_t>> degrees;
+    for (auto& [tableID, numTableNodes] : numNodes) {
+        degrees[tableID].resize(numTableNodes, 0);
+    }
+    for (auto& [relTableID, caches] : csrCaches) {
+        auto table = storageManager->getTable(relTableID)->ptrCast<RelTable>();
+        for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+            auto& cache = caches[RelDirectionUtils::relDirectionToKeyIdx(direction)];
+            if (cache == nullptr) {
+                continue;
+            }
+            auto& boundDegrees = degrees.at(getBoundTableID(*table, direction));
+            for (auto offset = 0u; offset < boundDegrees.size(); offset++) {
+                boundDegrees[offset] += cache->getNumNbrs(offset);
+            }
+        }
+    }
+    table_id_map_t<std::vector<offset_t>> oldToNewOffsets;
+    for (auto& [tableID, tableDegrees] : degrees) {
+        auto& newToOld = newToOldOffsets[tableID];
+        newToOld.resize(tableDegrees.size());
+        std::iota(newToOld.begin(), newToOld.end(), 0);
+        std::stable_sort(newToOld.begin(), newToOld.end(),
+            [&](offset_t a, offset_t b) { return tableDegrees[a] > tableDegrees[b]; });
+        auto& oldToNew = oldToNewOffsets[tableID];
+        oldToNew.resize(newToOld.size());
+        for (auto i = 0u; i < newToOld.size(); i++) {
+            oldToNew[newToOld[i]] = i;
+        }
+        memoryUsage += newToOld.capacity() * sizeof(offset_t);
+    }
+    for (auto& [relTableID, caches] : csrCaches) {
+        auto table = storageManager->getTable(relTableID)->ptrCast<RelTable>();
+        auto& relabeledCaches = relabeledCSRCaches[relTableID];
+        for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+            auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+            if (caches[idx] == nullptr) {
+                continue;
+            }
+            auto nbrTableID = RelDirectionUtils::getNbrTableID(direction,
+                table->getFromNodeTableID(), table->getToNodeTableID());
+            std::shared_ptr<const RelTableCSRCache> cache = RelTableCSRCache::relabel(*caches[idx],
+                newToOldOffsets.at(getBoundTableID(*table, direction)),
+                oldToNewOffsets.at(nbrTableID));
+            memoryUsage += cache->getMemoryUsage();
+            relabeledCaches[idx] = std::move(cache);
+        }
+    }
+}
+
+bool GraphSnapshot::canBeReadBy(const transaction::Transaction* transaction) const {
+    return transaction->isReadOnly() && transaction->getStartTS() == snapshotTS;
+}
+
+std::shared_ptr<const RelTableCSRCache> GraphSnapshot::getCSRCache(oid_t relTableID,
+    RelDataDirection direction, bool relabeled) const {
+    auto& caches = relabeled ? relabeledCSRCaches : csrCaches;
+    if (!caches.contains(relTableID)) {
+        return nullptr;
+    }
+    return caches.at(relTableID)[RelDirectionUtils::relDirectionToKeyIdx(direction)];
+}
+
+} // namespace graph
+} // namespace kuzu
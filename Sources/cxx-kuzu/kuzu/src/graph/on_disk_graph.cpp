@@ -8,14 +8,18 @@
 #include "common/cast.h"
 #include "common/data_chunk/data_chunk_state.h"
 #include "common/enums/rel_direction.h"
+#include "common/string_utils.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "expression_evaluator/expression_evaluator.h"
 #include "graph/graph.h"
+#include "graph/graph_snapshot.h"
+#include "main/client_context.h"
 #include "planner/operator/schema.h"
 #include "processor/expression_mapper.h"
 #include "storage/local_storage/local_rel_table.h"
 #include "storage/local_storage/local_storage.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/table/node_table.h"
@@ -49,6 +53,37 @@ static std::vector<column_id_t> getColumnIDs(const expression_vector& propertyEx
     return columnIDs;
 }
 
+// Converts the conjuncts of the rel predicate into column predicates on the predicate properties,
+// aligned with the column IDs above, so that the scan skips node groups by zone maps and filters
+// rows on encoded data before edges reach the predicate evaluator.
+static std::vector<ColumnPredicateSet> getColumnPredicateSets(const ClientContext& context,
+    std::shared_ptr<Expression> predicate, const expression_vector& propertyExprs,
+    uint64_t numPropertyColumns) {
+    if (predicate == nullptr || !context.getClientConfig()->enableZoneMap) {
+        return {};
+    }
+    auto conjuncts = predicate->splitOnAND();
+    std::vector<ColumnPredicateSet> predicateSets;
+    // Nbr ID column and property columns are not filtered.
+    predicateSets.resize(1 + numPropertyColumns);
+    auto hasPredicate = false;
+    for (const auto& expr : propertyExprs) {
+        auto predicateSet = ColumnPredicateSet();
+        for (const auto& conjunct : conjuncts) {
+            auto columnPredicate = ColumnPredicateUtil::tryConvert(*expr, *conjunct);
+            if (columnPredicate != nullptr) {
+                predicateSet.addPredicate(std::move(columnPredicate));
+            }
+        }
+        hasPredicate |= !predicateSet.isEmpty();
+        predicateSets.push_back(std::move(predicateSet));
+    }
+    if (!hasPredicate) {
+        return {};
+    }
+    return predicateSets;
+}
+
 static expression_vector getProperties(std::shared_ptr<Expression> expr) {
     if (expr == nullptr) {
         return expression_vector{};
@@ -74,6 +109,20 @@ static ResultSet getResultSet(Schema* schema, MemoryManager* mm) {
     return ResultSet(&descriptor, mm);
 }
 
+static bool isCSRCacheEnabled(const ClientContext& context, const std::string& relTableName) {
+    const auto& relTableNames = context.getClientConfig()->csrCacheRelTables;
+    if (relTableNames.empty()) {
+        return false;
+    }
+    for (auto& name : StringUtils::splitComma(relTableNames)) {
+        if (StringUtils::caseInsensitiveEquals(StringUtils::ltrim(StringUtils::rtrim(name)),
+                relTableName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static std::unique_ptr<ValueVector> getValueVector(const LogicalType& type, MemoryManager* mm,
     std::shared_ptr<DataChunkState> state) {
     auto vector = std::make_unique<ValueVector>(type.copy(), mm);
@@ -118,6 +167,8 @@ OnDiskGraphNbrScanState::OnDiskGraphNbrScanState(ClientContext* context,
     auto table = StorageManager::Get(*context)->getTable(relTableID)->ptrCast<RelTable>();
     for (auto dataDirection : entry.constCast<RelGroupCatalogEntry>().getRelDataDirections()) {
         auto columnIDs = getColumnIDs(predicateProps, entry, relPropertyColumnIDs);
+        auto columnPredicateSets = getColumnPredicateSets(*context, predicate, predicateProps,
+            relPropertyColumnIDs.size());
         std::vector outVectors{dstNodeIDVector.get()};
         for (auto i = 0u; i < propertyVectors.getNumValueVectors(); i++) {
             outVectors.push_back(&propertyVectors.getValueVectorMutable(i));
@@ -128,10 +179,23 @@ OnDiskGraphNbrScanState::OnDiskGraphNbrScanState(ClientContext* context,
         }
         auto scanState = std::make_unique<RelTableScanState>(*MemoryManager::Get(*context),
             srcNodeIDVector.get(), outVectors, dstNodeIDVector->state, randomLookup);
-        scanState->setToTable(transaction::Transaction::Get(*context), table, columnIDs, {},
-            dataDirection);
+        scanState->setToTable(transaction::Transaction::Get(*context), table, columnIDs,
+            std::move(columnPredicateSets), dataDirection);
         directedIterators.emplace_back(context, table, std::move(scanState));
     }
+    csrCaches.resize(directedIterators.size());
+    if (relProperties.empty() && predicate == nullptr &&
+        isCSRCacheEnabled(*context, entry.getName())) {
+        auto transaction = transaction::Transaction::Get(*context);
+        for (auto i = 0u; i < directedIterators.size(); i++) {
+            auto direction = directedIterators[i].getDirection();
+            auto boundTableID = direction == RelDataDirection::FWD ? table->getFromNodeTableID() :
+                                                                     table->getToNodeTableID();
+            auto numBoundNodes =
+                StorageManager::Get(*context)->getTable(boundTableID)->getNumTotalRows(transaction);
+            csrCaches[i] = table->getOrBuildCSRCache(*context, direction, numBoundNodes);
+        }
+    }
 }
 
 OnDiskGraph::OnDiskGraph(ClientContext* context, NativeGraphEntry entry)
@@ -182,6 +246,17 @@ offset_t OnDiskGraph::getNumNodes(transaction::Transaction* transaction) const {
     return numNodes;
 }
 
+bool OnDiskGraph::relabelNodes() {
+    auto transaction = transaction::Transaction::Get(*context);
+    relabeled = nodeOffsetMaskMap == nullptr && graphEntry.snapshot != nullptr &&
+                graphEntry.snapshot->isRelabeled() && graphEntry.snapshot->canBeReadBy(transaction);
+    return relabeled;
+}
+
+offset_t OnDiskGraph::getOriginalOffset(table_id_t tableID, offset_t offset) const {
+    return relabeled ? graphEntry.snapshot->getOriginalOffset(tableID, offset) : offset;
+}
+
 std::vector<GraphRelInfo> OnDiskGraph::getRelInfos(table_id_t srcTableID) {
     std::vector<GraphRelInfo> result;
     for (auto& info : relInfos) {
@@ -198,8 +273,23 @@ std::unique_ptr<NbrScanState> OnDiskGraph::prepareRelScan(const TableCatalogEntr
     oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties,
     bool randomLookup) {
     auto& info = graphEntry.getRelInfo(entry.getTableID());
+    auto transaction = transaction::Transaction::Get(*context);
+    // All rels of relabeled graphs are materialized, including the ones with predicates.
+    KU_ASSERT(!relabeled || relProperties.empty());
+    auto readFromSnapshot = relProperties.empty() && graphEntry.snapshot != nullptr &&
+                            graphEntry.snapshot->canBeReadBy(transaction);
     auto state = std::make_unique<OnDiskGraphNbrScanState>(context, entry, relTableID,
         info.predicate, relProperties, randomLookup);
+    if (readFromSnapshot) {
+        for (auto i = 0u; i < state->directedIterators.size(); i++) {
+            auto cache = graphEntry.snapshot->getCSRCache(relTableID,
+                state->directedIterators[i].getDirection(), relabeled);
+            KU_ASSERT(!relabeled || cache != nullptr);
+            if (cache != nullptr) {
+                state->csrCaches[i] = std::move(cache);
+            }
+        }
+    }
     if (nodeOffsetMaskMap != nullptr && nodeOffsetMaskMap->containsTableID(nbrTableID)) {
         state->nbrNodeMask = nodeOffsetMaskMap->getOffsetMask(nbrTableID);
     }
@@ -231,9 +321,24 @@ Graph::VertexIterator OnDiskGraph::scanVertices(offset_t beginOffset, offset_t e
 
 std::unique_ptr<VertexScanState> OnDiskGraph::prepareVertexScan(TableCatalogEntry* tableEntry,
     const std::vector<std::string>& propertiesToScan) {
+    KU_ASSERT(!relabeled || propertiesToScan.empty());
     return std::make_unique<OnDiskGraphVertexScanState>(*context, tableEntry, propertiesToScan);
 }
 
+static bool selectMaskedNbrs(SemiMask& nbrNodeMask, const ValueVector& nbrNodeIDVector,
+    SelectionVector& selVector) {
+    auto selectedSize = 0u;
+    auto buffer = selVector.getMutableBuffer();
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        auto pos = selVector[i];
+        buffer[selectedSize] = pos;
+        auto nbrNodeID = nbrNodeIDVector.getValue<nodeID_t>(pos);
+        selectedSize += nbrNodeMask.isMasked(nbrNodeID.offset);
+    }
+    selVector.setToFiltered(selectedSize);
+    return selectedSize > 0;
+}
+
 bool OnDiskGraphNbrScanState::InnerIterator::next(evaluator::ExpressionEvaluator* predicate,
     SemiMask* nbrNodeMask_) {
     bool hasAtLeastOneSelectedValue = false;
@@ -250,16 +355,8 @@ bool OnDiskGraphNbrScanState::InnerIterator::next(evaluator::ExpressionEvaluator
                     !tableScanState->outState->isFlat());
         }
         if (nbrNodeMask_ != nullptr) {
-            auto selectedSize = 0u;
-            auto buffer = tableScanState->outState->getSelVectorUnsafe().getMutableBuffer();
-            for (auto i = 0u; i < tableScanState->outState->getSelSize(); ++i) {
-                auto pos = tableScanState->outState->getSelVector()[i];
-                buffer[selectedSize] = pos;
-                auto nbrNodeID = tableScanState->outputVectors[0]->getValue<nodeID_t>(pos);
-                selectedSize += nbrNodeMask_->isMasked(nbrNodeID.offset);
-            }
-            tableScanState->outState->getSelVectorUnsafe().setToFiltered(selectedSize);
-            hasAtLeastOneSelectedValue = selectedSize > 0;
+            hasAtLeastOneSelectedValue = selectMaskedNbrs(*nbrNodeMask_, dstVector(),
+                tableScanState->outState->getSelVectorUnsafe());
         }
     } while (!hasAtLeastOneSelectedValue);
     return true;
@@ -277,11 +374,27 @@ void OnDiskGraphNbrScanState::startScan(RelDataDirection direction) {
     auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
     KU_ASSERT(idx < directedIterators.size() && directedIterators[idx].getDirection() == direction);
     currentIter = &directedIterators[idx];
+    currentCSRCache = csrCaches[idx].get();
+    if (currentCSRCache != nullptr) {
+        csrCursor = currentCSRCache->getNbrs(srcNodeIDVector->getValue<nodeID_t>(0).offset);
+        return;
+    }
     currentIter->initScan();
 }
 
 bool OnDiskGraphNbrScanState::next() {
     KU_ASSERT(currentIter != nullptr);
+    if (currentCSRCache != nullptr) {
+        auto& selVector = dstNodeIDVector->state->getSelVectorUnsafe();
+        while (csrCursor.hasMore()) {
+            selVector.setToUnfiltered(csrCursor.next(*dstNodeIDVector));
+            if (nbrNodeMask == nullptr || selectMaskedNbrs(*nbrNodeMask, *dstNodeIDVector,
+                                              selVector)) {
+                return true;
+            }
+        }
+        return false;
+    }
     if (currentIter->next(relPredicateEvaluator.get(), nbrNodeMask)) {
         return true;
     }
@@ -1,5 +1,7 @@
 #include "graph/parsed_graph_entry.h"
 
+#include "graph/graph_snapshot.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -16,5 +18,9 @@ std::string GraphEntryTypeUtils::toString(GraphEntryType type) {
     }
 }
 
+uint64_t ParsedNativeGraphEntry::getSnapshotMemoryUsage() const {
+    return snapshot == nullptr ? 0 : snapshot->getMemoryUsage();
+}
+
 } // namespace graph
 } // namespace kuzu
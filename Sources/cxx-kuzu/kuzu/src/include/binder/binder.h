@@ -134,6 +134,8 @@ public:
     std::unique_ptr<BoundStatement> bindCopyFromClause(const parser::Statement& statement);
     std::unique_ptr<BoundStatement> bindCopyNodeFrom(const parser::Statement& statement,
         catalog::NodeTableCatalogEntry& nodeEntry);
+    expression_vector bindClusterKeys(const catalog::NodeTableCatalogEntry& nodeTableEntry,
+        const BoundCopyFromInfo& copyFromInfo, const parser::options_t& clusterByOption);
     std::unique_ptr<BoundStatement> bindCopyRelFrom(const parser::Statement& statement,
         catalog::RelGroupCatalogEntry& relGroupEntry, const std::string& fromTableName,
         const std::string& toTableName);
@@ -255,6 +257,7 @@ public:
 
     expression_vector bindOrderByExpressions(
         const std::vector<std::unique_ptr<parser::ParsedExpression>>& parsedExprs);
+    static bool isOrderByKeyTypeSupported(const common::LogicalType& dataType);
     std::shared_ptr<Expression> bindSkipLimitExpression(const parser::ParsedExpression& expression);
 
     /*** bind graph pattern ***/
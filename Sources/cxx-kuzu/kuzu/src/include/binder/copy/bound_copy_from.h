@@ -62,6 +62,18 @@ private:
     }
 };
 
+struct ExtraBoundCopyNodeInfo final : ExtraBoundCopyFromInfo {
+    // Expressions by which the copied nodes are sorted before they are inserted.
+    expression_vector clusterKeys;
+
+    explicit ExtraBoundCopyNodeInfo(expression_vector clusterKeys)
+        : clusterKeys{std::move(clusterKeys)} {}
+
+    std::unique_ptr<ExtraBoundCopyFromInfo> copy() const override {
+        return std::make_unique<ExtraBoundCopyNodeInfo>(clusterKeys);
+    }
+};
+
 struct ExtraBoundCopyRelInfo final : ExtraBoundCopyFromInfo {
     std::string fromTableName;
     std::string toTableName;
@@ -141,6 +141,9 @@ public:
 
     std::string getUniqueName(const std::string& name) const;
 
+    // Whether a function which isn't deterministic (see Function::isDeterministic) is bound.
+    bool hasNondeterministicFunction() const { return hasNondeterministicFunction_; }
+
     const ExpressionBinderConfig& getConfig() { return config; }
 
 private:
@@ -149,6 +152,7 @@ private:
     std::unordered_set<std::string> unknownParameters;
     std::unordered_map<std::string, std::shared_ptr<common::Value>> knownParameters;
     ExpressionBinderConfig config;
+    bool hasNondeterministicFunction_ = false;
 };
 
 } // namespace binder
@@ -96,6 +96,28 @@ struct ArrowArray {
 
 #endif // ARROW_C_DATA_INTERFACE
 
+// The Arrow C stream interface.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    // Callback to get the stream type
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    // Callback to get the next array, which is released (release == NULL) at the end of stream
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    // Callback to get a description of the last error
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
@@ -132,6 +154,17 @@ typedef struct {
     // The threshold of the WAL file size in bytes. When the size of the
     // WAL file exceeds this threshold, the database will checkpoint if auto_checkpoint is true.
     uint64_t checkpoint_threshold;
+    // If true, the data file bypasses the OS page cache (O_DIRECT on Linux, F_NOCACHE on Apple
+    // platforms), so that pages are not cached twice by the buffer pool and the OS.
+    bool direct_io;
+    // If true, the memory of the buffer pool is backed by transparent huge pages (Linux only).
+    bool enable_huge_pages;
+    // If true, the pages cached in the buffer pool are recorded at each checkpoint and when the
+    // database is closed, and are read back in the background when the database is reopened.
+    bool warm_up_buffer_pool;
+    // If true, pages read once by sequential scans are kept in a small probationary queue and
+    // evicted before the other pages of the buffer pool, unless they are read again.
+    bool enable_two_queue_eviction;
 
 #if defined(__APPLE__)
     // The thread quality of service (QoS) for the worker threads.
@@ -147,6 +180,48 @@ typedef struct {
     void* _database;
 } kuzu_database;
 
+/**
+ * @brief kuzu_io_stats holds the buffer manager and I/O counters of a database, summed over all of
+ * its files, since the database was opened. See CALL IO_STATS() for the counters of each file.
+ */
+typedef struct {
+    // Calls to pin a page, including those made by optimistic reads of evicted pages.
+    uint64_t num_pins;
+    // Page accesses served from pages already cached in the buffer pool.
+    uint64_t num_hits;
+    // Page accesses which had to cache the page in the buffer pool.
+    uint64_t num_misses;
+    // Optimistic reads repeated because the page changed while it was being read.
+    uint64_t num_optimistic_read_retries;
+    uint64_t num_evictions;
+    // Pages marked instead of being evicted because they were read since they were queued.
+    uint64_t num_second_chances;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    // Bucket i holds the page reads which took less than 2^i microseconds. The last bucket holds
+    // all slower reads.
+    uint64_t read_latency_histogram[20];
+} kuzu_io_stats;
+
+/**
+ * @brief kuzu_query_progress holds the progress of the query executing in a connection.
+ */
+typedef struct {
+    // Whether a query is executing in the connection. Other fields are only set if it is.
+    bool is_running;
+    uint64_t query_id;
+    uint32_t num_pipelines;
+    uint32_t num_pipelines_finished;
+    // Fraction of the work of the pipelines being executed which is done, e.g. of the morsels of a
+    // scan or of the iterations of a graph algorithm.
+    double pipeline_progress;
+    // Fraction of the query which is done, each pipeline counting for an equal share.
+    double progress;
+    double elapsed_time_ms;
+    // Extrapolated from the elapsed time and the progress. Negative until there is some progress.
+    double estimated_remaining_time_ms;
+} kuzu_query_progress;
+
 /**
  * @brief kuzu_connection is used to interact with a Database instance. Each connection is
  * thread-safe. Multiple connections can connect to the same Database instance in a multi-threaded
@@ -173,6 +248,20 @@ typedef struct {
     bool _is_owned_by_cpp;
 } kuzu_query_result;
 
+/**
+ * @brief kuzu_async_query_result is the handle of a query submitted with
+ * kuzu_connection_query_async(), which can be waited or polled for the result of the query.
+ */
+typedef struct {
+    void* _async_query_result;
+} kuzu_async_query_result;
+
+/**
+ * @brief The callback of kuzu_connection_query_async(), called with the user data passed to it
+ * once the result of the query is ready.
+ */
+typedef void (*kuzu_async_query_callback)(void* user_data);
+
 /**
  * @brief kuzu_flat_tuple stores a vector of values.
  */
@@ -181,6 +270,16 @@ typedef struct {
     bool _is_owned_by_cpp;
 } kuzu_flat_tuple;
 
+/**
+ * @brief kuzu_factorized_tuple stores a tuple of a query result without expanding it into flat
+ * tuples. Its columns are partitioned into groups, the columns of a group have the same number of
+ * rows, and the flat tuples it represents are the Cartesian product of the rows of its groups.
+ */
+typedef struct {
+    void* _factorized_tuple;
+    bool _is_owned_by_cpp;
+} kuzu_factorized_tuple;
+
 /**
  * @brief kuzu_logical_type is the kuzu internal representation of data types.
  */
@@ -324,6 +423,34 @@ typedef enum {
     KUZU_UUID = 59
 } kuzu_data_type_id;
 
+/**
+ * @brief kuzu_column_batch stores a batch of tuples of a query result in columnar format.
+ */
+typedef struct {
+    void* _column_batch;
+} kuzu_column_batch;
+
+/**
+ * @brief kuzu_column_buffer exposes the values of a column of a kuzu_column_batch. Its buffers
+ * follow the Arrow columnar format and are owned by the batch, so they are only valid until the
+ * batch is destroyed.
+ */
+typedef struct {
+    // The data type of the column.
+    kuzu_data_type_id data_type_id;
+    // The number of values in the column.
+    uint64_t num_values;
+    // The validity bitmap of the column. Bit i (in LSB order) is set if value i is not null.
+    const uint8_t* validity;
+    // The values of the column. Fixed-size values are stored contiguously, except for BOOL values
+    // which are packed as a bitmap in LSB order. For STRING and BLOB columns, this points to the
+    // concatenated bytes of all values.
+    const void* values;
+    // For STRING and BLOB columns, the num_values + 1 offsets of the values into the bytes pointed
+    // to by values. Null for other columns.
+    const uint32_t* offsets;
+} kuzu_column_buffer;
+
 /**
  * @brief enum class for kuzu function return state.
  */
@@ -348,6 +475,14 @@ KUZU_C_API kuzu_state kuzu_database_init(const char* database_path,
 KUZU_C_API void kuzu_database_destroy(kuzu_database* database);
 
 KUZU_C_API kuzu_system_config kuzu_default_system_config();
+/**
+ * @brief Returns the buffer manager and I/O counters of the database.
+ * @param database The database instance to return the counters of.
+ * @param[out] out_io_stats The output parameter that will hold the counters.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_database_get_io_stats(kuzu_database* database,
+    kuzu_io_stats* out_io_stats);
 
 // Connection
 /**
@@ -364,6 +499,23 @@ KUZU_C_API kuzu_state kuzu_connection_init(kuzu_database* database,
  * @param connection The connection instance to destroy.
  */
 KUZU_C_API void kuzu_connection_destroy(kuzu_connection* connection);
+/**
+ * @brief Takes an idle connection from the connection pool of the database, or creates a
+ * connection if the pool is empty. Caller is responsible for calling kuzu_connection_release() to
+ * return the connection to the pool, or kuzu_connection_destroy() to free it.
+ * @param database The database instance to connect to.
+ * @param[out] out_connection The output parameter that will hold the connection instance.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_acquire(kuzu_database* database,
+    kuzu_connection* out_connection);
+/**
+ * @brief Returns the connection to the connection pool of its database. The connection is reset to
+ * the state of a new connection and reused, unless the pool is full, in which case it is freed.
+ * The connection instance must not be used afterwards.
+ * @param connection The connection instance to release.
+ */
+KUZU_C_API void kuzu_connection_release(kuzu_connection* connection);
 /**
  * @brief Sets the maximum number of threads to use for executing queries.
  * @param connection The connection instance to set max number of threads for execution.
@@ -391,6 +543,22 @@ KUZU_C_API kuzu_state kuzu_connection_get_max_num_thread_for_exec(kuzu_connectio
  */
 KUZU_C_API kuzu_state kuzu_connection_query(kuzu_connection* connection, const char* query,
     kuzu_query_result* out_query_result);
+/**
+ * @brief Submits the given query to be executed on the threads of the database, without blocking
+ * the calling thread. The connection must not be destroyed before the query has finished.
+ * @param connection The connection instance to execute the query.
+ * @param query The query to execute.
+ * @param callback The callback to call once the result of the query is ready, or null. It is
+ * called on the thread that executed the query, and must not block.
+ * @param user_data The user data to pass to the callback.
+ * @param[out] out_async_query_result The output parameter that will hold the handle of the query.
+ * The caller is responsible for destroying it with kuzu_async_query_result_destroy(), which can be
+ * done before the query has finished.
+ * @return The state indicating the success or failure of submitting the query.
+ */
+KUZU_C_API kuzu_state kuzu_connection_query_async(kuzu_connection* connection, const char* query,
+    kuzu_async_query_callback callback, void* user_data,
+    kuzu_async_query_result* out_async_query_result);
 /**
  * @brief Prepares the given query and returns the prepared statement.
  * @param connection The connection instance to prepare the query.
@@ -409,11 +577,48 @@ KUZU_C_API kuzu_state kuzu_connection_prepare(kuzu_connection* connection, const
  */
 KUZU_C_API kuzu_state kuzu_connection_execute(kuzu_connection* connection,
     kuzu_prepared_statement* prepared_statement, kuzu_query_result* out_query_result);
+/**
+ * @brief Executes the prepared_statement once for each of num_parameter_sets parameter sets, in a
+ * single transaction. The parameters bound to the prepared statement are shared by all executions.
+ * @param connection The connection instance to execute the prepared_statement.
+ * @param prepared_statement The prepared statement to execute.
+ * @param num_parameter_sets The number of parameter sets, i.e. of executions.
+ * @param num_parameters The number of parameters that vary between executions.
+ * @param parameter_names The names of the num_parameters varying parameters.
+ * @param parameter_values The values of the varying parameters, column by column: the value of
+ * parameter i in parameter set j is parameter_values[i * num_parameter_sets + j].
+ * @param[out] out_query_result The output parameter that will hold the result of the last
+ * execution, or of the first failed one.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_execute_many(kuzu_connection* connection,
+    kuzu_prepared_statement* prepared_statement, uint64_t num_parameter_sets,
+    uint64_t num_parameters, const char** parameter_names, kuzu_value** parameter_values,
+    kuzu_query_result* out_query_result);
+/**
+ * @brief Copies the record batches of an Arrow C stream into a table, as with COPY FROM.
+ * @param connection The connection instance to copy with.
+ * @param table_name The name of the table to copy into.
+ * @param stream The stream to copy from. It is read to its end but not released.
+ * @param[out] out_query_result The output parameter that will hold the result of the copy.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_copy_from_arrow_stream(kuzu_connection* connection,
+    const char* table_name, struct ArrowArrayStream* stream, kuzu_query_result* out_query_result);
 /**
  * @brief Interrupts the current query execution in the connection.
  * @param connection The connection instance to interrupt.
  */
 KUZU_C_API void kuzu_connection_interrupt(kuzu_connection* connection);
+/**
+ * @brief Returns the progress of the query executing in the connection. It can be called from
+ * other threads while the query executes, e.g. to show its progress.
+ * @param connection The connection instance to get the progress of.
+ * @param[out] out_progress The output parameter that will hold the progress.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_get_query_progress(kuzu_connection* connection,
+    kuzu_query_progress* out_progress);
 /**
  * @brief Sets query timeout value in milliseconds for the connection.
  * @param connection The connection instance to set query timeout value.
@@ -423,6 +628,39 @@ KUZU_C_API void kuzu_connection_interrupt(kuzu_connection* connection);
 KUZU_C_API kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection,
     uint64_t timeout_in_ms);
 
+// AsyncQueryResult
+/**
+ * @brief Destroys the given async query result instance. The query keeps running if it hasn't
+ * finished yet.
+ * @param async_query_result The async query result instance to destroy.
+ */
+KUZU_C_API void kuzu_async_query_result_destroy(kuzu_async_query_result* async_query_result);
+/**
+ * @brief Returns true if the query has finished, so that its result can be taken without blocking.
+ * @param async_query_result The async query result instance to check.
+ */
+KUZU_C_API bool kuzu_async_query_result_is_done(kuzu_async_query_result* async_query_result);
+/**
+ * @brief Blocks until the query has finished.
+ * @param async_query_result The async query result instance to wait for.
+ */
+KUZU_C_API void kuzu_async_query_result_wait(kuzu_async_query_result* async_query_result);
+/**
+ * @brief Waits for the query to finish and returns its result. The result can only be taken once.
+ * @param async_query_result The async query result instance to take the result of.
+ * @param[out] out_query_result The output parameter that will hold the result of the query.
+ * @return The state indicating the success or failure of the query, as with
+ * kuzu_connection_query().
+ */
+KUZU_C_API kuzu_state kuzu_async_query_result_get_query_result(
+    kuzu_async_query_result* async_query_result, kuzu_query_result* out_query_result);
+/**
+ * @brief Interrupts the query. A query that hasn't started yet fails without being executed, and a
+ * running query is interrupted as with kuzu_connection_interrupt().
+ * @param async_query_result The async query result instance to interrupt.
+ */
+KUZU_C_API void kuzu_async_query_result_interrupt(kuzu_async_query_result* async_query_result);
+
 // PreparedStatement
 /**
  * @brief Destroys the prepared statement instance and frees the allocated memory.
@@ -695,6 +933,24 @@ KUZU_C_API bool kuzu_query_result_has_next(kuzu_query_result* query_result);
  */
 KUZU_C_API kuzu_state kuzu_query_result_get_next(kuzu_query_result* query_result,
     kuzu_flat_tuple* out_flat_tuple);
+/**
+ * @brief Returns true if we have not consumed all factorized tuples in the query result, false
+ * otherwise. Always returns false for streaming query results.
+ * @param query_result The query result instance to check.
+ */
+KUZU_C_API bool kuzu_query_result_has_next_factorized_tuple(kuzu_query_result* query_result);
+/**
+ * @brief Returns the next tuple of the query result without expanding it into flat tuples, which
+ * avoids materializing the Cartesian product of one-to-many results. Factorized tuples are read
+ * independently of kuzu_query_result_get_next(). Note that to reduce resource allocation, all
+ * calls reuse the same FactorizedTuple object, whose contents are overwritten by the next call.
+ * @param query_result The query result instance to return.
+ * @param[out] out_factorized_tuple The output parameter that will hold the next factorized tuple.
+ * @return The state indicating the success or failure of the operation. Fails for streaming query
+ * results.
+ */
+KUZU_C_API kuzu_state kuzu_query_result_get_next_factorized_tuple(kuzu_query_result* query_result,
+    kuzu_factorized_tuple* out_factorized_tuple);
 /**
  * @brief Returns true if we have not consumed all query results, false otherwise. Use this function
  * for loop results of multiple query statements
@@ -749,6 +1005,57 @@ KUZU_C_API kuzu_state kuzu_query_result_get_arrow_schema(kuzu_query_result* quer
 KUZU_C_API kuzu_state kuzu_query_result_get_next_arrow_chunk(kuzu_query_result* query_result,
     int64_t chunk_size, struct ArrowArray* out_arrow_array);
 
+/**
+ * @brief Exports the remaining tuples of the query result as an Arrow stream, whose arrays hold up
+ * to chunk_size tuples each. The stream reads from the query result, so the query result must not
+ * be destroyed or iterated before the stream is released.
+ * @param query_result The query result instance to export.
+ * @param chunk_size The maximum number of tuples in each array of the stream.
+ * @param[out] out_stream The output parameter that will hold the Arrow stream.
+ * @return The state indicating the success or failure of the operation.
+ *
+ * It is the caller's responsibility to call the release function of the stream.
+ */
+KUZU_C_API kuzu_state kuzu_query_result_get_arrow_stream(kuzu_query_result* query_result,
+    int64_t chunk_size, struct ArrowArrayStream* out_stream);
+
+/**
+ * @brief Returns the next batch of tuples of the query result in columnar format. Reading a batch
+ * avoids converting each value of the query result separately, and is much faster than reading the
+ * tuples one by one with kuzu_query_result_get_next(). The caller is responsible for destroying
+ * the returned batch with kuzu_column_batch_destroy().
+ * @param query_result The query result instance to return.
+ * @param max_num_tuples The maximum number of tuples to return in the batch.
+ * @param[out] out_column_batch The output parameter that will hold the next batch of tuples.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_query_result_get_next_column_batch(kuzu_query_result* query_result,
+    uint64_t max_num_tuples, kuzu_column_batch* out_column_batch);
+
+// ColumnBatch
+/**
+ * @brief Destroys the given column batch instance, and the buffers of its columns.
+ * @param column_batch The column batch instance to destroy.
+ */
+KUZU_C_API void kuzu_column_batch_destroy(kuzu_column_batch* column_batch);
+/**
+ * @brief Returns the number of tuples in the column batch.
+ * @param column_batch The column batch instance to return.
+ */
+KUZU_C_API uint64_t kuzu_column_batch_get_num_tuples(kuzu_column_batch* column_batch);
+/**
+ * @brief Returns the buffers of the column at the given index of the column batch. Only columns of
+ * BOOL, integer, floating point, DATE, TIMESTAMP, STRING and BLOB types can be read from a batch;
+ * the values of other columns have to be read with kuzu_query_result_get_next().
+ * @param column_batch The column batch instance to return.
+ * @param index The index of the column to return.
+ * @param[out] out_column_buffer The output parameter that will hold the buffers of the column.
+ * @return The state indicating the success or failure of the operation. Fails if the index is out
+ * of range or the type of the column is not supported.
+ */
+KUZU_C_API kuzu_state kuzu_column_batch_get_column(kuzu_column_batch* column_batch, uint64_t index,
+    kuzu_column_buffer* out_column_buffer);
+
 // FlatTuple
 /**
  * @brief Destroys the given flat tuple instance.
@@ -771,6 +1078,46 @@ KUZU_C_API kuzu_state kuzu_flat_tuple_get_value(kuzu_flat_tuple* flat_tuple, uin
  */
 KUZU_C_API char* kuzu_flat_tuple_to_string(kuzu_flat_tuple* flat_tuple);
 
+// FactorizedTuple
+/**
+ * @brief Destroys the given factorized tuple instance.
+ * @param factorized_tuple The factorized tuple instance to destroy.
+ */
+KUZU_C_API void kuzu_factorized_tuple_destroy(kuzu_factorized_tuple* factorized_tuple);
+/**
+ * @brief Returns the number of groups of columns of the factorized tuple.
+ * @param factorized_tuple The factorized tuple instance to return.
+ */
+KUZU_C_API uint64_t kuzu_factorized_tuple_get_num_groups(kuzu_factorized_tuple* factorized_tuple);
+/**
+ * @brief Returns the index of the group the column at the given index belongs to.
+ * @param factorized_tuple The factorized tuple instance to return.
+ * @param column_index The index of the column.
+ * @param[out] out_group_index The output parameter that will hold the index of the group.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_factorized_tuple_get_group_index(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t column_index, uint64_t* out_group_index);
+/**
+ * @brief Returns the number of rows of the group at the given index.
+ * @param factorized_tuple The factorized tuple instance to return.
+ * @param group_index The index of the group.
+ * @param[out] out_num_rows The output parameter that will hold the number of rows of the group.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_factorized_tuple_get_num_rows(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t group_index, uint64_t* out_num_rows);
+/**
+ * @brief Returns the value of the column at the given index in the given row of its group.
+ * @param factorized_tuple The factorized tuple instance to return.
+ * @param column_index The index of the column.
+ * @param row_index The index of the row in the group of the column.
+ * @param[out] out_value The output parameter that will hold the value.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_factorized_tuple_get_value(kuzu_factorized_tuple* factorized_tuple,
+    uint64_t column_index, uint64_t row_index, kuzu_value* out_value);
+
 // DataType
 // TODO(Chang): Refactor the datatype constructor to follow the cpp way of creating dataTypes.
 /**
@@ -1029,10 +1376,10 @@ KUZU_C_API void kuzu_value_copy(kuzu_value* value, kuzu_value* other);
  */
 KUZU_C_API void kuzu_value_destroy(kuzu_value* value);
 /**
- * @brief Returns the number of elements per list of the given value. The value must be of type
+ * @brief Returns the number of elements of the given value. The value must be of type LIST or
  * ARRAY.
- * @param value The ARRAY value to get list size.
- * @param[out] out_result The output parameter that will hold the number of elements per list.
+ * @param value The LIST or ARRAY value to get list size.
+ * @param[out] out_result The output parameter that will hold the number of elements.
  * @return The state indicating the success or failure of the operation.
  */
 KUZU_C_API kuzu_state kuzu_value_get_list_size(kuzu_value* value, uint64_t* out_result);
@@ -1045,6 +1392,19 @@ KUZU_C_API kuzu_state kuzu_value_get_list_size(kuzu_value* value, uint64_t* out_
  */
 KUZU_C_API kuzu_state kuzu_value_get_list_element(kuzu_value* value, uint64_t index,
     kuzu_value* out_value);
+/**
+ * @brief Copies the elements of the given value into a buffer in a single call, instead of
+ * returning them one at a time. The value must be of type LIST or ARRAY, and its elements must be
+ * of type BOOL, an integer type, FLOAT or DOUBLE, and not null.
+ * @param value The LIST or ARRAY value to copy the elements of.
+ * @param child_type_id The type of the elements, which must match the type of the list.
+ * @param[out] out_values The buffer the elements are copied to, with room for num_values elements
+ * of the C type of child_type_id.
+ * @param num_values The number of elements of the value.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_value_copy_list_values(kuzu_value* value,
+    kuzu_data_type_id child_type_id, void* out_values, uint64_t num_values);
 /**
  * @brief Returns the number of fields of the given struct value. The value must be of type STRUCT.
  * @param value The STRUCT value to get number of fields.
@@ -1124,6 +1484,12 @@ KUZU_C_API kuzu_state kuzu_value_get_recursive_rel_rel_list(kuzu_value* value,
  * @param[out] out_type The output parameter that will hold the internal type of the value.
  */
 KUZU_C_API void kuzu_value_get_data_type(kuzu_value* value, kuzu_logical_type* out_type);
+/**
+ * @brief Returns the type id of the given value, without copying its type.
+ * @param value The value to return the type id of.
+ * @return The type id of the value.
+ */
+KUZU_C_API kuzu_data_type_id kuzu_value_get_data_type_id(kuzu_value* value);
 /**
  * @brief Returns the boolean value of the given value. The value must be of type BOOL.
  * @param value The value to return.
@@ -1306,6 +1672,17 @@ KUZU_C_API kuzu_state kuzu_value_get_string(kuzu_value* value, char** out_result
  * @return The state indicating the success or failure of the operation.
  */
 KUZU_C_API kuzu_state kuzu_value_get_blob(kuzu_value* value, uint8_t** out_result);
+/**
+ * @brief Returns the bytes of the given value without copying them. The bytes are not
+ * null-terminated, and are only valid as long as the value. The value must be of type STRING or
+ * BLOB.
+ * @param value The value to return.
+ * @param[out] out_data The output parameter that will hold the pointer to the bytes.
+ * @param[out] out_length The output parameter that will hold the number of bytes.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_value_get_string_data(kuzu_value* value, const char** out_data,
+    uint64_t* out_length);
 /**
  * @brief Returns the uuid value of the given value.
  * to a string. The value must be of type UUID.
@@ -1454,6 +1831,12 @@ KUZU_C_API void kuzu_query_summary_destroy(kuzu_query_summary* query_summary);
  * @param query_summary The query summary to get compilation time.
  */
 KUZU_C_API double kuzu_query_summary_get_compiling_time(kuzu_query_summary* query_summary);
+/**
+ * @brief Returns the part of the compilation time of the given query summary spent on planning and
+ * optimizing the query in milliseconds.
+ * @param query_summary The query summary to get planning time.
+ */
+KUZU_C_API double kuzu_query_summary_get_planning_time(kuzu_query_summary* query_summary);
 /**
  * @brief Returns the execution time of the given query summary in milliseconds.
  * @param query_summary The query summary to get execution time.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_set.h"
@@ -198,8 +200,16 @@ public:
     std::vector<std::string> getMacroNames(const transaction::Transaction* transaction) const;
     void dropMacro(transaction::Transaction* transaction, std::string& name);
 
-    void incrementVersion() { version++; }
+    void incrementVersion() {
+        version++;
+        changeEpoch++;
+    }
     uint64_t getVersion() const { return version; }
+    // Unlike the version, which is reset by checkpoints, the change epoch only grows, so that it
+    // identifies a state of the catalog for the plans cached by clients.
+    uint64_t getChangeEpoch() const { return changeEpoch; }
+    // Makes clients plan their queries again, e.g. when an index the planner uses becomes ready.
+    void invalidateCachedPlans() { changeEpoch++; }
     bool changedSinceLastCheckpoint() const { return version != 0; }
     void resetVersion() { version = 0; }
 
@@ -244,6 +254,7 @@ private:
     // incremented whenever a change is made to the catalog
     // reset to 0 at the end of each checkpoint
     uint64_t version;
+    std::atomic<uint64_t> changeEpoch = 0;
 };
 
 } // namespace catalog
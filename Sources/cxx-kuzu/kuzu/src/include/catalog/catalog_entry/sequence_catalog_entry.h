@@ -85,6 +85,9 @@ public:
 
 private:
     void nextValNoLock();
+    // Reserves the next count values of a sequence without CYCLE, and returns the first of them.
+    // The values are first + i * increment.
+    int64_t reserveKValNoLock(uint64_t count);
 
 private:
     std::mutex mtx;
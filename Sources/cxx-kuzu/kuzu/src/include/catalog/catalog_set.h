@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <mutex>
 #include <shared_mutex>
 
@@ -30,6 +31,9 @@ public:
     explicit CatalogSet(bool isInternal);
     bool containsEntry(const transaction::Transaction* transaction, const std::string& name);
     CatalogEntry* getEntry(const transaction::Transaction* transaction, const std::string& name);
+    // Returns nullptr if there is no entry of the name visible to the transaction.
+    CatalogEntry* getEntryIfExists(const transaction::Transaction* transaction,
+        const std::string& name);
     common::oid_t createEntry(transaction::Transaction* transaction,
         std::unique_ptr<CatalogEntry> entry);
     void dropEntry(transaction::Transaction* transaction, const std::string& name,
@@ -39,6 +43,9 @@ public:
         const binder::BoundAlterInfo& alterInfo);
 
     CatalogEntrySet getEntries(const transaction::Transaction* transaction);
+    // Calls func on the entries visible to the transaction, without collecting them into a map.
+    void iterateEntries(const transaction::Transaction* transaction,
+        const std::function<void(CatalogEntry*)>& func);
     CatalogEntry* getEntryOfOID(const transaction::Transaction* transaction, common::oid_t oid);
 
     void serialize(common::Serializer serializer) const;
@@ -68,6 +75,8 @@ private:
 
     void emplaceNoLock(std::unique_ptr<CatalogEntry> entry);
     void eraseNoLock(const std::string& name);
+    void addToOIDIndexNoLock(const CatalogEntry& entry);
+    void removeFromOIDIndexNoLock(const CatalogEntry& entry);
 
     static std::unique_ptr<CatalogEntry> createDummyEntryNoLock(std::string name,
         common::oid_t oid);
@@ -86,6 +95,9 @@ private:
     std::shared_mutex mtx;
     common::oid_t nextOID = 0;
     common::case_insensitive_map_t<std::unique_ptr<CatalogEntry>> entries;
+    // The names of the entries whose version chains start with an entry of each OID. A renamed
+    // table has the same OID under its old and its new name.
+    std::unordered_map<common::oid_t, std::vector<std::string>> namesOfOID;
 };
 
 } // namespace catalog
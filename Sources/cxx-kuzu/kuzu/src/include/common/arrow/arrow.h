@@ -51,6 +51,28 @@ struct ArrowArray {
 
 #endif // ARROW_C_DATA_INTERFACE
 
+// The Arrow C stream interface.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    // Callback to get the stream type
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    // Callback to get the next array, which is released (release == NULL) at the end of stream
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    // Callback to get a description of the last error
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
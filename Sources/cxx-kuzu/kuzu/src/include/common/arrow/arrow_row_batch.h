@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <vector>
 
 #include "common/arrow/arrow.h"
@@ -16,6 +17,7 @@ class FlatTuple;
 
 namespace common {
 class Value;
+class ValueVector;
 
 // An Arrow Vector(i.e., Array) is defined by a few pieces of metadata and data:
 //  1) a logical data type;
@@ -53,11 +55,18 @@ public:
         bool fallbackExtensionTypes);
 
     void append(const processor::FlatTuple& tuple);
+    // Appends numTuples tuples, whose values in column i are at positions[i] of vectors[i].
+    // Fixed-width values and strings are copied from the vectors a column at a time, other values
+    // go through Value objects.
+    void append(const std::vector<ValueVector*>& vectors,
+        const std::vector<std::vector<sel_t>>& positions, uint64_t numTuples);
     std::int64_t size() const { return numTuples; }
     ArrowArray toArray(const std::vector<LogicalType>& types);
 
 private:
     static void appendValue(ArrowVector* vector, const Value& value, bool fallbackExtensionTypes);
+    static void appendVector(ArrowVector* arrowVector, ValueVector& vector,
+        std::span<const sel_t> positions, bool fallbackExtensionTypes);
 
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type,
         bool fallbackExtensionTypes);
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "common/mask.h"
+
+namespace kuzu {
+namespace common {
+
+// Semi mask covering a large part of its table. Lookups are a single bit test and the offsets in a
+// range are collected a word of 64 offsets at a time.
+class BitsetSemiMask final : public SemiMask {
+public:
+    explicit BitsetSemiMask(offset_t maxOffset)
+        : SemiMask(maxOffset), words((maxOffset + 63) / 64, 0), numMaskedNodes{0} {}
+
+    void mask(offset_t nodeOffset) override;
+    void maskRange(offset_t startNodeOffset, offset_t endNodeOffset) override;
+
+    bool isMasked(offset_t startNodeOffset) override {
+        return startNodeOffset < getMaxOffset() &&
+               (words[startNodeOffset / 64] >> (startNodeOffset % 64) & 1);
+    }
+
+    uint64_t getNumMaskedNodes() const override { return numMaskedNodes; }
+
+    offset_vec_t collectMaskedNodes(uint64_t size) const override;
+
+    // include&exclude
+    offset_vec_t range(uint32_t start, uint32_t end) override;
+
+private:
+    void collect(offset_t start, offset_t end, uint64_t size, offset_vec_t& result) const;
+
+private:
+    std::vector<uint64_t> words;
+    uint64_t numMaskedNodes;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -19,6 +19,9 @@ constexpr double DEFAULT_HT_LOAD_FACTOR = 1.5;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS = 5000000;
+// An auto checkpoint is deferred while other transactions are active, until the WAL grows beyond
+// this multiple of the checkpoint threshold.
+constexpr uint64_t MAX_DEFERRED_CHECKPOINT_THRESHOLD_FACTOR = 4;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -68,6 +71,7 @@ struct StorageConstants {
     static constexpr char WAL_FILE_SUFFIX[] = "wal";
     static constexpr char SHADOWING_SUFFIX[] = "shadow";
     static constexpr char TEMP_FILE_SUFFIX[] = "tmp";
+    static constexpr char HOT_PAGES_FILE_SUFFIX[] = "hot_pages";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -104,6 +108,9 @@ struct CopyConstants {
 
     static constexpr const char* FROM_OPTION_NAME = "FROM";
     static constexpr const char* TO_OPTION_NAME = "TO";
+    // Comma separated properties by which to sort the nodes copied into a node table, so that the
+    // node groups are clustered by them and zone maps skip more of them in range scans.
+    static constexpr const char* CLUSTER_BY_OPTION_NAME = "CLUSTER_BY";
 
     static constexpr const char* BOOL_CSV_PARSING_OPTIONS[] = {"HEADER", "PARALLEL",
         "LIST_UNBRACED", "AUTODETECT", "AUTO_DETECT", CopyConstants::IGNORE_ERRORS_OPTION_NAME};
@@ -162,6 +169,17 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Properties that filters on a node scan do not need are looked up after the filters, for the
+    // nodes passing them, if at most this fraction of the nodes is expected to pass. Otherwise,
+    // scanning them sequentially is cheaper than looking them up one by one.
+    static constexpr double LATE_MATERIALIZATION_SELECTIVITY = 0.05;
+    // Filters on a property with a sorted index look up the matching nodes in the index if at most
+    // this fraction of the nodes is expected to pass them.
+    static constexpr double SORTED_INDEX_SCAN_SELECTIVITY = 0.05;
+    // String properties of the build side of a hash join are looked up after the join instead of
+    // being stored in the hash table if the join is expected to output at most this many tuples
+    // per build tuple.
+    static constexpr double HASH_JOIN_LATE_MATERIALIZATION_SELECTIVITY = 0.5;
 };
 
 struct OrderByConstants {
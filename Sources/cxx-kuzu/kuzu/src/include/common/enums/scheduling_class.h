@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+// Scheduling classes are ordered by priority: workers pick up INTERACTIVE tasks before BATCH tasks
+// and BATCH tasks before BACKGROUND tasks.
+enum class SchedulingClass : uint8_t {
+    INTERACTIVE = 0,
+    BATCH = 1,
+    BACKGROUND = 2,
+};
+
+struct SchedulingClassUtils {
+    static constexpr uint8_t NUM_SCHEDULING_CLASSES = 3;
+
+    static SchedulingClass fromString(const std::string& str);
+    static std::string toString(SchedulingClass schedulingClass);
+};
+
+} // namespace common
+} // namespace kuzu
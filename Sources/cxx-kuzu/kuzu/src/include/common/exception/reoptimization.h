@@ -0,0 +1,27 @@
+#pragma once
+
+#include "common/api.h"
+#include "common/types/types.h"
+#include "exception.h"
+
+namespace kuzu {
+namespace common {
+
+// Thrown by a pipeline breaker whose input turned out to be much larger than the planner estimated.
+// The query is re-planned with the observed cardinality of the subgraph and executed again.
+class KUZU_API ReoptimizationException : public Exception {
+public:
+    ReoptimizationException(std::string subgraphKey, cardinality_t observedCardinality)
+        : Exception("Query re-optimization is required."), subgraphKey{std::move(subgraphKey)},
+          observedCardinality{observedCardinality} {}
+
+    const std::string& getSubgraphKey() const { return subgraphKey; }
+    cardinality_t getObservedCardinality() const { return observedCardinality; }
+
+private:
+    std::string subgraphKey;
+    cardinality_t observedCardinality;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -11,5 +11,13 @@ public:
     explicit TransactionManagerException(const std::string& msg) : Exception(msg){};
 };
 
+// Thrown once a commit failed to be made durable. The transaction is gone by then, and must not be
+// rolled back.
+class KUZU_API DatabaseInvalidatedException : public TransactionManagerException {
+public:
+    explicit DatabaseInvalidatedException(const std::string& msg)
+        : TransactionManagerException(msg){};
+};
+
 } // namespace common
 } // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 #include "common/api.h"
@@ -12,6 +13,20 @@ namespace common {
 
 class FileSystem;
 
+// A single write of a batch submitted through FileInfo::writeFiles.
+struct FileWriteRequest {
+    const uint8_t* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+};
+
+// A single read of a batch submitted through FileInfo::readFiles.
+struct FileReadRequest {
+    uint8_t* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+};
+
 struct KUZU_API FileInfo {
     FileInfo(std::string path, FileSystem* fileSystem)
         : path{std::move(path)}, fileSystem{fileSystem} {}
@@ -22,10 +37,23 @@ struct KUZU_API FileInfo {
 
     void readFromFile(void* buffer, uint64_t numBytes, uint64_t position);
 
+    // Performs all reads of the batch, which may be served concurrently.
+    void readFiles(std::span<const FileReadRequest> requests);
+
+    void prefetch(uint64_t position, uint64_t numBytes);
+
+    // Maps the first numBytes of the file into memory for reading, or returns nullptr if the file
+    // can't be mapped. The file must not be written to while it is mapped.
+    const uint8_t* mapReadOnly(uint64_t numBytes);
+    void unmap(const uint8_t* data, uint64_t numBytes);
+
     int64_t readFile(void* buf, size_t nbyte);
 
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
 
+    // Performs all writes of the batch; the order in which they reach the file is unspecified.
+    void writeFiles(std::span<const FileWriteRequest> requests);
+
     void syncFile() const;
 
     int64_t seek(uint64_t offset, int whence);
@@ -28,6 +28,9 @@ struct FileFlags {
     static constexpr uint8_t CREATE_AND_TRUNCATE_IF_EXISTS = 1 << 4;
     // Temporary file that is not persisted to disk.
     static constexpr uint8_t TEMPORARY = 1 << 5;
+    // Bypass the OS page cache for the file where the platform supports it. Only reads and writes
+    // of whole aligned pages bypass it on Linux, the rest are buffered.
+    static constexpr uint8_t DIRECT_IO = 1 << 6;
 #ifdef _WIN32
     // Only used in windows to open files in binary mode.
     static constexpr uint8_t BINARY = 1 << 5;
@@ -108,15 +111,39 @@ public:
 
     virtual void cleanUP(main::ClientContext* /*context*/) {}
 
+    // Frees the memory that the file system allocated from the memory manager of the database,
+    // which is destroyed before the file systems.
+    virtual void releaseMemory() {}
+
 protected:
     virtual void readFromFile(FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const = 0;
 
+    // Reads a batch of independent ranges. File systems that can submit several reads at once
+    // should override this; the default implementation reads the ranges one by one.
+    virtual void readFiles(FileInfo& fileInfo, std::span<const FileReadRequest> requests) const;
+
+    // Hints that the given byte range will be read soon. File systems that can start reading the
+    // range asynchronously should do so; the default implementation does nothing.
+    virtual void prefetch(FileInfo& /*fileInfo*/, uint64_t /*position*/,
+        uint64_t /*numBytes*/) const {}
+
+    // File systems whose files can be memory mapped should override these; by default files are
+    // never mapped.
+    virtual const uint8_t* mapReadOnly(FileInfo& /*fileInfo*/, uint64_t /*numBytes*/) const {
+        return nullptr;
+    }
+    virtual void unmap(const uint8_t* /*data*/, uint64_t /*numBytes*/) const { KU_UNREACHABLE; }
+
     virtual int64_t readFile(FileInfo& fileInfo, void* buf, size_t numBytes) const = 0;
 
     virtual void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const;
 
+    // Writes a batch of independent ranges. File systems that can submit several writes at once
+    // should override this; the default implementation writes the ranges one by one.
+    virtual void writeFiles(FileInfo& fileInfo, std::span<const FileWriteRequest> requests) const;
+
     virtual int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const = 0;
 
     virtual void reset(FileInfo& fileInfo);
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "file_info.h"
+
+namespace kuzu {
+namespace common {
+
+// A minimal io_uring submission/completion ring used by the local file system to submit batches of
+// reads and writes with a single system call. io_uring is only available on Linux (5.6+ for
+// IORING_OP_READ and IORING_OP_WRITE);
+// on other platforms, or when the kernel refuses to set up a ring (e.g. when io_uring is disabled
+// by seccomp in containers), get() returns nullptr and callers fall back to pread and pwrite.
+class IOUring {
+public:
+    static constexpr uint32_t NUM_ENTRIES = 64;
+
+    ~IOUring();
+
+    // Returns the ring of the calling thread, creating it on first use. Rings are not thread safe,
+    // so each thread owns its own.
+    static IOUring* get();
+
+    // Submits the writes to the file descriptor and waits until all of them complete. Stores in
+    // results[i] the number of bytes written by requests[i], or a negative errno on failure.
+    // requests.size() must not exceed NUM_ENTRIES.
+    void write(int fd, std::span<const FileWriteRequest> requests, std::span<int64_t> results);
+    // Same as write(), with results[i] being the number of bytes read by requests[i].
+    void read(int fd, std::span<const FileReadRequest> requests, std::span<int64_t> results);
+
+private:
+    IOUring() = default;
+
+    bool init();
+
+    template<typename REQUEST>
+    void submitAndWait(int fd, uint8_t opcode, std::span<const REQUEST> requests,
+        std::span<int64_t> results);
+    // Stores the results of the available completions and returns their number.
+    uint32_t reapCompletions(std::span<int64_t> results);
+    // Waits for the submitted requests of a failed batch, so that the ring is empty for the next
+    // batch of the thread.
+    void waitForSubmitted(uint32_t numSubmitted, uint32_t numCompleted,
+        std::span<int64_t> results);
+
+private:
+    // Set when the ring couldn't be drained after a failed batch.
+    bool needsReset = false;
+    int ringFd = -1;
+    void* sqRing = nullptr;
+    uint64_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    uint64_t cqRingSize = 0;
+    void* sqes = nullptr;
+    uint64_t sqesSize = 0;
+    uint32_t* sqTail = nullptr;
+    uint32_t sqMask = 0;
+    uint32_t* sqArray = nullptr;
+    uint32_t* cqHead = nullptr;
+    uint32_t* cqTail = nullptr;
+    uint32_t cqMask = 0;
+    void* cqes = nullptr;
+};
+
+} // namespace common
+} // namespace kuzu
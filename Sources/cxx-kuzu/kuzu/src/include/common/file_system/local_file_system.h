@@ -12,8 +12,8 @@ struct LocalFileInfo final : FileInfo {
     LocalFileInfo(std::string path, const void* handle, FileSystem* fileSystem)
         : FileInfo{std::move(path), fileSystem}, handle{handle} {}
 #else
-    LocalFileInfo(std::string path, const int fd, FileSystem* fileSystem)
-        : FileInfo{std::move(path), fileSystem}, fd{fd} {}
+    LocalFileInfo(std::string path, const int fd, FileSystem* fileSystem, const int directFd = -1)
+        : FileInfo{std::move(path), fileSystem}, fd{fd}, directFd{directFd} {}
 #endif
 
     ~LocalFileInfo() override;
@@ -22,6 +22,9 @@ struct LocalFileInfo final : FileInfo {
     const void* handle;
 #else
     const int fd;
+    // A second descriptor of the file opened with O_DIRECT, or -1. It is used for aligned reads and
+    // writes only.
+    const int directFd;
 #endif
 };
 
@@ -58,11 +61,20 @@ protected:
     void readFromFile(FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const override;
 
+    void readFiles(FileInfo& fileInfo, std::span<const FileReadRequest> requests) const override;
+
+    void prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const override;
+
+    const uint8_t* mapReadOnly(FileInfo& fileInfo, uint64_t numBytes) const override;
+    void unmap(const uint8_t* data, uint64_t numBytes) const override;
+
     int64_t readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const override;
 
     void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const override;
 
+    void writeFiles(FileInfo& fileInfo, std::span<const FileWriteRequest> requests) const override;
+
     int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const override;
 
     void truncate(FileInfo& fileInfo, uint64_t size) const override;
@@ -49,6 +49,8 @@ public:
 
     void cleanUP(main::ClientContext* context) override;
 
+    void releaseMemory() override;
+
     bool handleFileViaFunction(const std::string& path) const override;
 
     function::TableFunction getHandleFunction(const std::string& path) const override;
@@ -49,15 +49,19 @@ public:
         other.blocks.clear();
     }
 
-    // Releases all memory accumulated for string overflows so far and re-initializes its state to
-    // an empty buffer. If there is a large string that used point to any of these overflow buffers
-    // they will error.
+    // Discards all string overflows so far and re-initializes its state to an empty buffer. If there
+    // is a large string that used point to any of these overflow buffers they will error. The
+    // blocks are kept for the allocations until the next reset, after which the ones not reused
+    // are released.
     void resetBuffer();
 
     // Manually set the underlying memory buffer to evicted to avoid double free
     void preventDestruction();
 
     storage::MemoryManager* getMemoryManager() { return memoryManager; }
+    // Number of bytes of the blocks held by the buffer, including the ones released by the last
+    // reset.
+    uint64_t getMemoryUsage() const;
 
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
@@ -67,10 +71,14 @@ private:
 
     void allocateNewBlock(uint64_t size);
 
+    std::unique_ptr<BufferBlock> getFreeBlock(uint64_t size);
+
     BufferBlock* currentBlock() { return blocks.back().get(); }
 
 private:
     std::vector<std::unique_ptr<BufferBlock>> blocks;
+    // Blocks released by the last reset, which are reused before allocating new ones.
+    std::vector<std::unique_ptr<BufferBlock>> freeBlocks;
     storage::MemoryManager* memoryManager;
 };
 
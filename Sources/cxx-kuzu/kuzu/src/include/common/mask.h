@@ -34,8 +34,40 @@ private:
     bool enabled;
 };
 
+// Semi mask whose representation can be replaced after the mask is handed out. Semi maskers fill
+// roaring bitmaps per thread and, once they are merged, set the representation which fits the
+// number of masked nodes.
+class AdaptiveSemiMask final : public SemiMask {
+public:
+    AdaptiveSemiMask(offset_t maxOffset, std::shared_ptr<SemiMask> impl)
+        : SemiMask(maxOffset), impl{std::move(impl)} {}
+
+    void mask(offset_t nodeOffset) override { impl->mask(nodeOffset); }
+    void maskRange(offset_t startNodeOffset, offset_t endNodeOffset) override {
+        impl->maskRange(startNodeOffset, endNodeOffset);
+    }
+
+    bool isMasked(offset_t startNodeOffset) override { return impl->isMasked(startNodeOffset); }
+
+    // include&exclude
+    offset_vec_t range(uint32_t start, uint32_t end) override { return impl->range(start, end); }
+
+    uint64_t getNumMaskedNodes() const override { return impl->getNumMaskedNodes(); }
+
+    offset_vec_t collectMaskedNodes(uint64_t size) const override {
+        return impl->collectMaskedNodes(size);
+    }
+
+    void setImpl(std::shared_ptr<SemiMask> newImpl) { impl = std::move(newImpl); }
+
+private:
+    std::shared_ptr<SemiMask> impl;
+};
+
 struct SemiMaskUtil {
     KUZU_API static std::unique_ptr<SemiMask> createMask(offset_t maxOffset);
+    // Masks of the width of maxOffset which are only filled and merged by semi maskers.
+    static std::unique_ptr<SemiMask> createRoaringMask(offset_t maxOffset);
 };
 
 class NodeOffsetMaskMap {
@@ -22,7 +22,9 @@ public:
 class TimeMetric : public Metric {
 
 public:
-    explicit TimeMetric(bool enable);
+    // Only one in samplingInterval start()/stop() pairs is timed, and the elapsed time is
+    // extrapolated from the timed ones.
+    explicit TimeMetric(bool enable, uint64_t samplingInterval = 1);
 
     void start();
     void stop();
@@ -33,6 +35,9 @@ public:
     double accumulatedTime;
     bool isStarted;
     Timer timer;
+    uint64_t samplingInterval;
+    uint64_t numStarts;
+    uint64_t numTimedStarts;
 };
 
 class NumericMetric : public Metric {
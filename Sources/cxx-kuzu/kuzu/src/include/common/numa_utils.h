@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+
+// Detects the NUMA topology of the machine. NUMA nodes are only detected on Linux (through
+// /sys/devices/system/node); on every other platform the machine is treated as a single node, in
+// which case all functions below are no-ops.
+struct NumaUtils {
+    static constexpr uint32_t INVALID_NUMA_NODE = UINT32_MAX;
+
+    static uint32_t getNumNodes();
+    // Returns the CPUs belonging to the given NUMA node.
+    static const std::vector<uint32_t>& getCPUsOfNode(uint32_t node);
+    // Returns the NUMA node of the CPU the calling thread currently runs on.
+    static uint32_t getCurrentNode();
+    // Restricts the calling thread to the CPUs of the given NUMA node that it is allowed to run on.
+    // Returns false on failure, or if it is not allowed to run on any of them.
+    static bool pinCurrentThreadToNode(uint32_t node);
+};
+
+} // namespace common
+} // namespace kuzu
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -10,9 +12,23 @@
 namespace kuzu {
 namespace common {
 
+// Time span (relative to the start of the query) during which a thread executed a task of the
+// pipeline ending with the given sink.
+struct PipelineTaskSpan {
+    uint64_t sinkID;
+    uint64_t threadIdx;
+    double startMS;
+    double endMS;
+};
+
+// Metrics are registered per operator and per thread, so they are only updated by a single thread
+// and need no synchronization. They are collected for every query to keep statistics about recent
+// queries; outside of PROFILE, execution time is only sampled to keep the overhead low.
 class Profiler {
 
 public:
+    static constexpr uint64_t TIME_SAMPLING_INTERVAL = 16;
+
     TimeMetric* registerTimeMetric(const std::string& key);
 
     NumericMetric* registerNumericMetric(const std::string& key);
@@ -21,6 +37,16 @@ public:
 
     uint64_t sumAllNumericMetricsWithKey(const std::string& key);
 
+    // Values of the metrics with the given key, one per thread which registered it.
+    std::vector<uint64_t> getAllNumericMetricsWithKey(const std::string& key);
+    // Numbers of times the time metrics with the given key were started, one per thread.
+    std::vector<uint64_t> getAllNumStartsWithKey(const std::string& key);
+
+    // Time (milliseconds) elapsed since the profiler was created with the query.
+    double getElapsedTimeMS() const;
+
+    void recordPipelineTask(uint64_t sinkID, double startMS, double endMS);
+
 private:
     void addMetric(const std::string& key, std::unique_ptr<Metric> metric);
 
@@ -28,6 +54,13 @@ public:
     std::mutex mtx;
     bool enabled = false;
     std::unordered_map<std::string, std::vector<std::unique_ptr<Metric>>> metrics;
+    // Only recorded when the profiler is enabled.
+    std::vector<PipelineTaskSpan> pipelineTasks;
+
+private:
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    // Threads are numbered in the order in which they first execute a task of the query.
+    std::unordered_map<std::thread::id, uint64_t> threadIndices;
 };
 
 } // namespace common
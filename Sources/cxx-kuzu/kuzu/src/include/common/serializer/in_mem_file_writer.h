@@ -7,7 +7,6 @@
 
 namespace kuzu::storage {
 struct PageRange;
-class ShadowFile;
 class PageAllocator;
 } // namespace kuzu::storage
 
@@ -26,15 +25,18 @@ public:
         return pages[pageIdx]->getBuffer();
     }
 
-    storage::PageRange flush(storage::PageAllocator& pageAllocator,
-        storage::ShadowFile& shadowFile) const;
-    void flush(storage::PageRange allocatedPages, storage::FileHandle* fileHandle,
-        storage::ShadowFile& shadowFile) const;
+    // The pages are written directly to the file instead of through the shadow file: a newly
+    // allocated page range is not referenced by the last checkpoint, so the new pages only become
+    // reachable once the new database header is applied.
+    storage::PageRange flush(storage::PageAllocator& pageAllocator) const;
+    void flush(storage::PageRange allocatedPages, storage::FileHandle* fileHandle) const;
 
     page_idx_t getNumPagesToFlush() const { return pages.size(); }
 
     static uint64_t getPageSize();
     void flush(Writer& writer) const;
+    // Copies size bytes starting at the given offset of the written data.
+    void copyTo(uint64_t offset, uint64_t size, uint8_t* data) const;
 
     uint64_t getSize() const override {
         uint64_t size = pages.size() > 1 ? KUZU_PAGE_SIZE * (pages.size() - 1) : 0;
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+
+#include "common/mask.h"
+
+namespace kuzu {
+namespace common {
+
+// Semi mask with few masked nodes, kept as a sorted list of their offsets. Masking a node is linear
+// in the number of masked nodes, so the list is meant to be filled once.
+class SortedSemiMask final : public SemiMask {
+public:
+    explicit SortedSemiMask(offset_t maxOffset) : SemiMask(maxOffset) {}
+    SortedSemiMask(offset_t maxOffset, offset_vec_t offsets)
+        : SemiMask(maxOffset), offsets{std::move(offsets)} {
+        KU_ASSERT(std::is_sorted(this->offsets.begin(), this->offsets.end()));
+    }
+
+    void mask(offset_t nodeOffset) override;
+    void maskRange(offset_t startNodeOffset, offset_t endNodeOffset) override;
+
+    bool isMasked(offset_t startNodeOffset) override {
+        return std::binary_search(offsets.begin(), offsets.end(), startNodeOffset);
+    }
+
+    uint64_t getNumMaskedNodes() const override { return offsets.size(); }
+
+    offset_vec_t collectMaskedNodes(uint64_t size) const override {
+        return offset_vec_t{offsets.begin(), offsets.begin() + std::min(size, offsets.size())};
+    }
+
+    // include&exclude
+    offset_vec_t range(uint32_t start, uint32_t end) override {
+        return offset_vec_t{std::lower_bound(offsets.begin(), offsets.end(), start),
+            std::lower_bound(offsets.begin(), offsets.end(), end)};
+    }
+
+private:
+    offset_vec_t offsets;
+};
+
+} // namespace common
+} // namespace kuzu
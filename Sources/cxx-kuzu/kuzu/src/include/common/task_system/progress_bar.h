@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -14,6 +16,22 @@ namespace common {
 
 typedef std::unique_ptr<ProgressBarDisplay> (*progress_bar_display_create_func_t)();
 
+// Progress of the query executing in a client context, which can be polled from other threads.
+struct QueryProgress {
+    bool isRunning = false;
+    uint64_t queryID = 0;
+    uint32_t numPipelines = 0;
+    uint32_t numPipelinesFinished = 0;
+    // Fraction of the work of the pipelines being executed which is done, e.g. of the morsels of a
+    // scan or of the iterations of a graph algorithm.
+    double pipelineProgress = 0;
+    // Fraction of the query which is done, each pipeline counting for an equal share.
+    double progress = 0;
+    double elapsedTimeMS = 0;
+    // Extrapolated from the elapsed time and the progress. Negative until there is some progress.
+    double estimatedRemainingTimeMS = -1;
+};
+
 /**
  * @brief Progress bar for tracking the progress of a pipeline. Prints the progress of each query
  * pipeline and the overall progress.
@@ -42,6 +60,9 @@ public:
 
     bool getProgressBarPrinting() const { return trackProgress; }
 
+    // Pipelines and progress are tracked whether the progress bar is printed or not.
+    KUZU_API QueryProgress getQueryProgress();
+
     KUZU_API static ProgressBar* Get(const main::ClientContext& context);
 
 private:
@@ -50,8 +71,16 @@ private:
     void updateDisplay(uint64_t queryID, double curPipelineProgress);
 
 private:
-    uint32_t numPipelines;
-    uint32_t numPipelinesFinished;
+    // Changes smaller than this are not stored, so that threads reporting the progress of the same
+    // pipeline rarely write to the shared value.
+    static constexpr double PROGRESS_RESOLUTION = 0.001;
+
+    std::atomic<uint32_t> numPipelines;
+    std::atomic<uint32_t> numPipelinesFinished;
+    std::atomic<double> pipelineProgress;
+    std::atomic<bool> isRunning;
+    std::atomic<uint64_t> runningQueryID;
+    std::chrono::steady_clock::time_point startTime;
     std::mutex progressBarLock;
     bool trackProgress;
     std::shared_ptr<ProgressBarDisplay> display;
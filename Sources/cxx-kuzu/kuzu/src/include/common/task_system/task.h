@@ -1,16 +1,28 @@
 #pragma once
 
+#include <algorithm>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "common/api.h"
+#include "common/enums/scheduling_class.h"
 
 namespace kuzu {
 namespace common {
 
 using lock_t = std::unique_lock<std::mutex>;
 
+// Notified when any of the tasks sharing it completes, so that one thread can wait for several
+// tasks at once (see TaskScheduler::scheduleGroupAndWaitOrError).
+struct TaskCompletionSignal {
+    std::mutex mtx;
+    std::condition_variable cv;
+};
+
 /**
  * Task represents a task that can be executed by multiple threads in the TaskScheduler. Task is a
  * virtual class. Users of TaskScheduler need to extend the Task class and implement at
@@ -29,7 +41,7 @@ class KUZU_API Task {
 public:
     explicit Task(uint64_t maxNumThreads)
         : parent{nullptr}, maxNumThreads{maxNumThreads}, numThreadsFinished{0},
-          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX} {}
+          numThreadsRegistered{0}, runInline{false}, exceptionsPtr{nullptr}, ID{UINT64_MAX} {}
 
     virtual ~Task() = default;
     virtual void run() = 0;
@@ -41,6 +53,12 @@ public:
     virtual void finalize() {}
     // If task should terminate all subsequent tasks.
     virtual bool terminate() { return false; }
+    // Whether the task only groups its children, which are independent of each other.
+    virtual bool isGroup() const { return false; }
+    // Name of the events recorded for the task when tracing.
+    virtual std::string getName() const { return "TASK"; }
+    // Scheduling class of the task, if it does not run with the class of the client scheduling it.
+    virtual std::optional<SchedulingClass> getSchedulingClass() const { return std::nullopt; }
 
     void addChildTask(std::unique_ptr<Task> child) {
         child->parent = this;
@@ -57,6 +75,15 @@ public:
     }
 
     void setSingleThreadedTask() { maxNumThreads = 1; }
+    void limitMaxNumThreads(uint64_t numThreads) {
+        maxNumThreads = std::min(maxNumThreads, numThreads);
+    }
+    // The task is run by the thread scheduling it instead of a worker thread.
+    void setInlineTask() {
+        setSingleThreadedTask();
+        runInline = true;
+    }
+    bool isInlineTask() const { return runInline; }
 
     bool registerThread();
 
@@ -99,8 +126,32 @@ protected:
     std::mutex taskMtx;
     std::condition_variable cv;
     uint64_t maxNumThreads, numThreadsFinished, numThreadsRegistered;
+    bool runInline;
     std::exception_ptr exceptionsPtr;
     uint64_t ID;
+    std::shared_ptr<TaskCompletionSignal> completionSignal;
+};
+
+/**
+ * TaskGroup groups dependencies of a task that do not depend on each other, e.g. the pipelines of
+ * the branches of a union. The TaskScheduler executes the tasks of a group concurrently, so that
+ * tasks which cannot use every worker thread on their own share the workers. A TaskGroup has no
+ * work of its own and is completed once all of its children are.
+ */
+class KUZU_API TaskGroup final : public Task {
+public:
+    TaskGroup() : Task{1 /* maxNumThreads */} {}
+
+    void run() override {}
+    bool terminate() override {
+        for (auto& child : children) {
+            if (child->terminate()) {
+                return true;
+            }
+        }
+        return false;
+    }
+    bool isGroup() const override { return true; }
 };
 
 } // namespace common
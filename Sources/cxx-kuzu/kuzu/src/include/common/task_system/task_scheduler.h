@@ -1,11 +1,15 @@
 #pragma once
+#include <array>
 #include <deque>
 
 #ifndef __SINGLE_THREADED__
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 #endif
 
+#include "common/enums/scheduling_class.h"
 #include "common/task_system/task.h"
 #include "processor/execution_context.h"
 
@@ -13,9 +17,26 @@ namespace kuzu {
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID, uint64_t queueIdx = 0,
+        SchedulingClass schedulingClass = SchedulingClass::INTERACTIVE)
+        : task{std::move(task)}, ID{ID}, queueIdx{queueIdx}, schedulingClass{schedulingClass},
+          enqueueTime{std::chrono::steady_clock::now()} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    // Index of the worker queue the task was pushed into.
+    uint64_t queueIdx;
+    SchedulingClass schedulingClass;
+    std::chrono::steady_clock::time_point enqueueTime;
+    // Whether a worker has registered to the task. Only accessed under the lock of its queue.
+    bool isStarted = false;
+};
+
+struct SchedulingClassStats {
+    // The maximum number of workers that may work on tasks of the class at the same time.
+    uint64_t workerQuota = 0;
+    uint64_t numActiveWorkers = 0;
+    // The largest number of workers that worked on tasks of the class at the same time.
+    uint64_t maxNumActiveWorkers = 0;
 };
 
 /**
@@ -38,6 +59,24 @@ struct ScheduledTask {
  * this does not guarantee that the tasks will be completed in FIFO order: a long running task
  * that is not accepting more registration can stay in the queue for an unlimited time until
  * completion.
+ *
+ * In the multi-threaded version each worker owns a local queue protected by its own mutex, so
+ * concurrent queries do not contend on a single scheduler lock. Tasks scheduled from a worker
+ * thread go into that worker's own queue; tasks scheduled from any other thread are distributed
+ * round-robin across the worker queues. A worker first looks for a task in its own queue and, if
+ * it finds none it can register to, steals work by registering itself to a task in the queues of
+ * the other workers. The FIFO guarantee above therefore holds per worker queue. Idle workers sleep
+ * on a condition variable that is only touched when tasks are pushed or when workers go idle.
+ *
+ * Tasks are also tagged with the scheduling class of the client that scheduled them (see the
+ * scheduling_class setting). Workers pick up INTERACTIVE tasks before BATCH tasks and BATCH tasks
+ * before BACKGROUND tasks, and each class except INTERACTIVE has a quota on the number of workers
+ * that may work on its tasks at the same time, so long-running batch work cannot occupy every
+ * worker. Tasks may also carry their own class, e.g. checkpoints run as BACKGROUND. To avoid
+ * starvation, a task that no worker has started yet is picked up as if it belonged to the next
+ * class up for every AGING_THRESHOLD_MS it has waited, by at most MAX_AGING_STEPS classes, so that
+ * aged background work does not compete with interactive queries. Aging only changes the order in
+ * which tasks are picked up: a task is always counted against the quota of its own class.
  */
 #ifndef __SINGLE_THREADED__
 class KUZU_API TaskScheduler {
@@ -50,33 +89,78 @@ public:
     ~TaskScheduler();
 
     // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
-    // whether or not the given task or one of its dependencies errors, when this function
-    // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
+    // not concurrently, except for the children of a TaskGroup), and throws an exception if any
+    // of the tasks errors. Regardless of whether or not the given task or one of its dependencies
+    // errors, when this function returns, no task related to the given task will be in the task
+    // queue. Further no worker thread will be working on the given task. Inline tasks are run by
+    // the calling thread.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
+    // Schedules the task with the BACKGROUND scheduling class and returns without waiting for it.
+    // Nobody rethrows the exceptions of such tasks, so they must handle their errors themselves.
+    void scheduleBackgroundTask(const std::shared_ptr<Task>& task);
+
+    SchedulingClassStats getSchedulingClassStats(SchedulingClass schedulingClass) const;
 
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
-    // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
+    static constexpr uint64_t AGING_THRESHOLD_MS = 200;
+    static constexpr uint64_t MAX_AGING_STEPS = 1;
 
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    // Schedules the children of the group concurrently and waits for all of them to finish.
+    void scheduleGroupAndWaitOrError(const Task& group, processor::ExecutionContext* context);
 
-    void removeErroringTask(uint64_t scheduledTaskID);
+    struct WorkerQueue {
+        mutable std::mutex mtx;
+        std::deque<std::shared_ptr<ScheduledTask>> tasks;
+    };
 
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Functions to launch worker threads and for the worker threads to use to grab task from queue.
+    void runWorkerThread(uint64_t workerIdx);
+
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        SchedulingClass schedulingClass);
+
+    void removeErroringTask(const ScheduledTask& scheduledTask);
+
+    // Looks for tasks class by class in priority order. For each class, tries the worker's own
+    // queue first and then steals from the queues of other workers.
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx);
+    std::shared_ptr<ScheduledTask> getTaskAndRegisterFromQueue(WorkerQueue& queue,
+        SchedulingClass schedulingClass, std::chrono::steady_clock::time_point now);
+    static SchedulingClass getEffectiveSchedulingClass(const ScheduledTask& scheduledTask,
+        std::chrono::steady_clock::time_point now);
+    // Counts a worker against the quota of the class, unless the quota is used up.
+    bool tryAcquireQuota(SchedulingClass schedulingClass);
+    void releaseQuota(SchedulingClass schedulingClass);
+    // Whether any worker queue holds a task, e.g. one skipped because of class quotas.
+    bool hasQueuedTasks() const;
+    // Returns the queue a task scheduled from the calling thread should be pushed into.
+    uint64_t getQueueIdxForCurrentThread();
+    void notifyWorkers();
     static void runTask(Task* task);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
-    bool stopWorkerThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> workerQueues;
+    std::atomic<bool> stopWorkerThreads;
     std::vector<std::thread> workerThreads;
-    std::mutex taskSchedulerMtx;
+    // Protects sleeping and waking up idle workers. It is never held while running tasks or while
+    // looking for tasks in the worker queues.
+    std::mutex sleepMtx;
     std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    // Incremented every time a task is pushed, so idle workers can detect that they missed a push
+    // between looking for work and going to sleep.
+    std::atomic<uint64_t> pushEpoch;
+    std::atomic<uint64_t> nextScheduledTaskID;
+    std::atomic<uint64_t> nextQueueIdx;
+    // Maximum and current number of workers working on tasks of each scheduling class, and the
+    // largest number that did at the same time.
+    std::array<uint64_t, SchedulingClassUtils::NUM_SCHEDULING_CLASSES> classQuotas;
+    std::array<std::atomic<uint64_t>, SchedulingClassUtils::NUM_SCHEDULING_CLASSES>
+        numActiveWorkersPerClass;
+    std::array<std::atomic<uint64_t>, SchedulingClassUtils::NUM_SCHEDULING_CLASSES>
+        maxNumActiveWorkersPerClass;
 #if defined(__APPLE__)
     uint32_t threadQos; // Thread quality of service for worker threads.
 #endif
@@ -91,6 +175,9 @@ public:
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    // Tasks are run by the threads that schedule them, so no class has workers.
+    SchedulingClassStats getSchedulingClassStats(SchedulingClass) const { return {}; }
+
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/api.h"
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+namespace common {
+class FileInfo;
+class VirtualFileSystem;
+
+struct TraceEvent {
+    const char* category;
+    std::string name;
+    uint64_t threadIdx;
+    uint64_t startInMicros;
+    uint64_t durationInMicros;
+};
+
+// Records spans of the execution (tasks, morsels, buffer manager misses, checkpoint phases) as
+// events, which are written to a file in the Chrome trace format when tracing stops. The format can
+// be opened by chrome://tracing and Perfetto. The tracer is shared by the whole process because the
+// task scheduler and the buffer manager record events without a client context.
+class KUZU_API Tracer {
+public:
+    static constexpr uint64_t MAX_NUM_EVENTS = 1 << 20;
+
+    static Tracer& Get();
+
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    // Stops the current trace, if any, and starts recording the events to write to the given file.
+    void start(const std::string& path, main::ClientContext* context);
+    // Writes the recorded events to the trace file.
+    void stop();
+    // Stops tracing if the trace file was opened through the given file system, which is about to
+    // be destroyed.
+    void stop(const VirtualFileSystem* fileSystem);
+
+    std::string getFilePath();
+
+    uint64_t getTimeInMicros() const;
+
+    void addEvent(const char* category, std::string name, uint64_t startInMicros);
+
+private:
+    void stopNoLock();
+
+private:
+    std::atomic<bool> enabled{false};
+    std::mutex mtx;
+    std::string filePath;
+    std::unique_ptr<FileInfo> fileInfo;
+    const VirtualFileSystem* fileSystem = nullptr;
+    std::vector<TraceEvent> events;
+    // Events which were not recorded because the trace already holds MAX_NUM_EVENTS events.
+    uint64_t numDroppedEvents = 0;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+};
+
+// Records an event spanning the lifetime of the scope. Scopes are only meant to be constructed
+// when tracing is enabled, since building the name can be expensive on hot paths.
+class TraceScope {
+public:
+    TraceScope(const char* category, std::string name)
+        : category{category}, name{std::move(name)},
+          startInMicros{Tracer::Get().getTimeInMicros()} {}
+    DELETE_COPY_AND_MOVE(TraceScope);
+    ~TraceScope() { Tracer::Get().addEvent(category, std::move(name), startInMicros); }
+
+private:
+    const char* category;
+    std::string name;
+    uint64_t startInMicros;
+};
+
+} // namespace common
+} // namespace kuzu
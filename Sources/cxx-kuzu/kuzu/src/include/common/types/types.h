@@ -65,6 +65,7 @@ constexpr oid_t INVALID_OID = UINT64_MAX;
 
 using transaction_t = uint64_t;
 constexpr transaction_t INVALID_TRANSACTION = UINT64_MAX;
+constexpr uint64_t INVALID_QUERY_ID = UINT64_MAX;
 using executor_id_t = uint64_t;
 using executor_info = std::unordered_map<executor_id_t, uint64_t>;
 
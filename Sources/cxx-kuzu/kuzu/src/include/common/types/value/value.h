@@ -681,7 +681,8 @@ KUZU_API inline nodeID_t& Value::getValueReference() {
  */
 template<>
 KUZU_API inline std::string& Value::getValueReference() {
-    KU_ASSERT(dataType.getLogicalTypeID() == LogicalTypeID::STRING);
+    KU_ASSERT(dataType.getLogicalTypeID() == LogicalTypeID::STRING ||
+              dataType.getLogicalTypeID() == LogicalTypeID::BLOB);
     return strVal;
 }
 
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "common/types/value/value.h"
+#include "expression_evaluator.h"
+
+namespace kuzu {
+namespace evaluator {
+
+enum class FusedOperator : uint8_t {
+    ADD = 0,
+    SUBTRACT = 1,
+    MULTIPLY = 2,
+    EQUALS = 3,
+    NOT_EQUALS = 4,
+    GREATER_THAN = 5,
+    GREATER_THAN_EQUALS = 6,
+    LESS_THAN = 7,
+    LESS_THAN_EQUALS = 8,
+};
+
+// An operation between the result of the previous step (or the input for the first step) and a
+// constant.
+struct FusedStep {
+    FusedOperator op;
+    common::Value constant;
+    // Whether the constant is the left operand, e.g. in 10 - a.x.
+    bool isConstantLeft;
+
+    bool isComparison() const { return op >= FusedOperator::EQUALS; }
+};
+
+// Evaluates a chain of arithmetic operations between a numeric input and constants, optionally
+// followed by a comparison with a constant, e.g. a.x * 2 + 1 > 10. The whole chain is computed in
+// one pass over the input, without materializing a vector per operation. Constants are kept as
+// native values, so that a comparison between a column and a literal or parameter does not go
+// through a flat literal vector either.
+class FusedExpressionEvaluator : public ExpressionEvaluator {
+    static constexpr EvaluatorType type_ = EvaluatorType::FUSED;
+
+public:
+    FusedExpressionEvaluator(std::shared_ptr<binder::Expression> expression,
+        std::unique_ptr<ExpressionEvaluator> inputEvaluator, std::vector<FusedStep> steps);
+
+    static bool isSupportedType(const common::LogicalType& type);
+
+    void evaluate() override;
+
+    bool selectInternal(common::SelectionVector& selVector) override;
+
+    std::unique_ptr<ExpressionEvaluator> copy() override {
+        return std::make_unique<FusedExpressionEvaluator>(expression, children[0]->copy(), steps);
+    }
+
+protected:
+    void resolveResultVector(const processor::ResultSet& resultSet,
+        storage::MemoryManager* memoryManager) override;
+
+private:
+    template<typename T>
+    void evaluate(const T* constants);
+    template<typename T>
+    bool select(const T* constants, common::SelectionVector& selVector);
+
+    template<typename T>
+    T computeArithmetic(T value, const T* constants) const;
+    template<typename T>
+    bool compare(T value, const T* constants) const;
+
+private:
+    std::vector<FusedStep> steps;
+    uint32_t numArithmeticSteps;
+    common::PhysicalTypeID inputType;
+    // Native values of the constants of all steps, as an array of the input type.
+    std::vector<uint8_t> constants;
+};
+
+} // namespace evaluator
+} // namespace kuzu
@@ -115,6 +115,12 @@ struct KUZU_API ExtensionUtils {
         addFunc<T>(database, T::name, catalog::CatalogEntryType::TABLE_FUNCTION_ENTRY);
     }
 
+    template<typename T>
+    static void addInternalTableFunc(main::Database& database) {
+        addFunc<T>(database, T::name, catalog::CatalogEntryType::TABLE_FUNCTION_ENTRY,
+            true /* isInternal */);
+    }
+
     template<typename T>
     static void addTableFuncAlias(main::Database& database) {
         addFunc<typename T::alias>(database, T::name,
@@ -17,6 +17,9 @@ struct CountFunction : public BaseCountFunction {
         reinterpret_cast<CountState*>(state_)->count += multiplicity;
     }
 
+    static void updateGroups(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        uint64_t multiplicity, common::InMemOverflowBuffer* overflowBuffer);
+
     static void paramRewriteFunc(binder::expression_vector& arguments);
 
     static function_set getFunctionSet();
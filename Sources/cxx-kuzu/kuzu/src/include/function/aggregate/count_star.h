@@ -17,5 +17,19 @@ struct CountStarFunction : public BaseCountFunction {
     static function_set getFunctionSet();
 };
 
+// Adds up counts computed below the aggregation, e.g. degrees of nodes, to replace COUNT(*). Unlike
+// SUM, the result is 0 rather than NULL if there is no count to add up.
+struct CountStarFromCountsFunction : public BaseCountFunction {
+    static constexpr const char* name = "COUNT_STAR_FROM_COUNTS";
+
+    static void updateAll(uint8_t* state_, common::ValueVector* input, uint64_t multiplicity,
+        common::InMemOverflowBuffer* /*overflowBuffer*/);
+
+    static void updatePos(uint8_t* state_, common::ValueVector* input, uint64_t multiplicity,
+        uint32_t pos, common::InMemOverflowBuffer* /*overflowBuffer*/);
+
+    static AggregateFunction getFunction();
+};
+
 } // namespace function
 } // namespace kuzu
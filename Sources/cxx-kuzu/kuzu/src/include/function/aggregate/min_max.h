@@ -36,6 +36,15 @@ struct MinMaxFunction {
         updateSingleValue<OP>(reinterpret_cast<MinMaxState*>(state_), input, pos, overflowBuffer);
     }
 
+    template<class OP>
+    static void updateGroups(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        uint64_t /*multiplicity*/, common::InMemOverflowBuffer* overflowBuffer) {
+        input->forEachNonNull([&](auto pos) {
+            updateSingleValue<OP>(reinterpret_cast<MinMaxState*>(entries[pos] + stateOffset), input,
+                pos, overflowBuffer);
+        });
+    }
+
     template<class OP>
     static void updateSingleValue(MinMaxState* state, common::ValueVector* input, uint32_t pos,
         common::InMemOverflowBuffer* overflowBuffer) {
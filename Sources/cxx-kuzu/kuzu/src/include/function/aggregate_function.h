@@ -30,6 +30,10 @@ using aggr_update_all_function_t = std::function<void(uint8_t* state, common::Va
     uint64_t multiplicity, common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_update_pos_function_t = std::function<void(uint8_t* state, common::ValueVector* input,
     uint64_t multiplicity, uint32_t pos, common::InMemOverflowBuffer* overflowBuffer)>;
+// Updates, for each non-null position pos of the input, the state at entries[pos] + stateOffset.
+// Unlike updatePos, a whole batch of groups is updated with a single indirect call.
+using aggr_update_groups_function_t = std::function<void(uint8_t** entries, uint32_t stateOffset,
+    common::ValueVector* input, uint64_t multiplicity, common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_combine_function_t = std::function<void(uint8_t* state, uint8_t* otherState,
     common::InMemOverflowBuffer* overflowBuffer)>;
 using aggr_finalize_function_t = std::function<void(uint8_t* state)>;
@@ -40,6 +44,8 @@ struct AggregateFunction final : public ScalarOrAggregateFunction {
     aggr_initialize_function_t initializeFunc;
     aggr_update_all_function_t updateAllFunc;
     aggr_update_pos_function_t updatePosFunc;
+    // Optional. Set by functions with a kernel instantiated for their input type.
+    aggr_update_groups_function_t updateGroupsFunc;
     aggr_combine_function_t combineFunc;
     aggr_finalize_function_t finalizeFunc;
     std::unique_ptr<AggregateState> initialNullAggregateState;
@@ -83,6 +89,13 @@ struct AggregateFunction final : public ScalarOrAggregateFunction {
         return updatePosFunc(state, input, multiplicity, pos, overflowBuffer);
     }
 
+    bool hasUpdateGroupsFunc() const { return updateGroupsFunc != nullptr; }
+
+    void updateGroupsState(uint8_t** entries, uint32_t stateOffset, common::ValueVector* input,
+        uint64_t multiplicity, common::InMemOverflowBuffer* overflowBuffer) const {
+        return updateGroupsFunc(entries, stateOffset, input, multiplicity, overflowBuffer);
+    }
+
     void combineState(uint8_t* state, uint8_t* otherState,
         common::InMemOverflowBuffer* overflowBuffer) const {
         return combineFunc(state, otherState, overflowBuffer);
@@ -101,10 +114,14 @@ struct AggregateFunctionUtils {
     static std::unique_ptr<AggregateFunction> getAggFunc(std::string name,
         common::LogicalTypeID inputType, common::LogicalTypeID resultType, bool isDistinct,
         param_rewrite_function_t paramRewriteFunc = nullptr) {
-        return std::make_unique<AggregateFunction>(std::move(name),
+        auto function = std::make_unique<AggregateFunction>(std::move(name),
             std::vector<common::LogicalTypeID>{inputType}, resultType, T::initialize, T::updateAll,
             T::updatePos, T::combine, T::finalize, isDistinct, nullptr /* bindFunc */,
             paramRewriteFunc);
+        if constexpr (requires { T::updateGroups; }) {
+            function->updateGroupsFunc = T::updateGroups;
+        }
+        return function;
     }
 
     template<template<typename, typename> class FunctionType>
@@ -17,6 +17,11 @@ struct ArrayDistance {
         ArraySquaredDistance::operation(left, right, result, leftVector, rightVector, resultVector);
         result = std::sqrt(result);
     }
+
+    template<std::floating_point T>
+    static inline T compute(const T* leftElements, const T* rightElements, uint64_t size) {
+        return std::sqrt(ArraySquaredDistance::compute(leftElements, rightElements, size));
+    }
 };
 
 } // namespace function
@@ -14,14 +14,19 @@ struct ArraySquaredDistance {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
         KU_ASSERT(left.size == right.size);
+        result = compute(leftElements, rightElements, left.size);
+    }
+
+    template<std::floating_point T>
+    static inline T compute(const T* leftElements, const T* rightElements, uint64_t size) {
         simsimd_distance_t tmpResult = 0.0;
         static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
         if constexpr (std::is_same_v<T, float>) {
-            simsimd_l2sq_f32(leftElements, rightElements, left.size, &tmpResult);
+            simsimd_l2sq_f32(leftElements, rightElements, size, &tmpResult);
         } else {
-            simsimd_l2sq_f64(leftElements, rightElements, left.size, &tmpResult);
+            simsimd_l2sq_f64(leftElements, rightElements, size, &tmpResult);
         }
-        result = tmpResult;
+        return tmpResult;
     }
 };
 
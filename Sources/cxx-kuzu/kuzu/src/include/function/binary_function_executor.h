@@ -1,5 +1,7 @@
 #pragma once
 
+#include <type_traits>
+
 #include "common/vector/value_vector.h"
 
 namespace kuzu {
@@ -195,6 +197,32 @@ struct BinaryFunctionExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Comparisons of fixed size values can be computed on null positions, whose values are
+    // arbitrary, and masked out afterwards. This avoids a branch per value, which is mispredicted
+    // most of the time when about half of the values are null or selected.
+    template<class LEFT_TYPE, class RIGHT_TYPE, typename SELECT_WRAPPER>
+    static constexpr bool canSelectWithoutBranch() {
+        return std::is_same_v<SELECT_WRAPPER, BinaryComparisonSelectWrapper> &&
+               isFixedSizeComparable<LEFT_TYPE>() && isFixedSizeComparable<RIGHT_TYPE>();
+    }
+
+    template<class T>
+    static constexpr bool isFixedSizeComparable() {
+        return std::is_arithmetic_v<T> || std::is_same_v<T, common::internalID_t>;
+    }
+
+    template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
+    static void selectOnValueMasked(common::ValueVector& left, common::ValueVector& right,
+        uint64_t lPos, uint64_t rPos, uint64_t resPos, bool isNull, uint64_t& numSelectedValues,
+        std::span<common::sel_t> selectedPositionsBuffer, void* dataPtr) {
+        uint8_t resultValue = 0;
+        SELECT_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+            ((LEFT_TYPE*)left.getData())[lPos], ((RIGHT_TYPE*)right.getData())[rPos], resultValue,
+            &left, &right, dataPtr);
+        selectedPositionsBuffer[numSelectedValues] = resPos;
+        numSelectedValues += (resultValue == true) & !isNull;
+    }
+
     template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
     static uint64_t selectBothFlat(common::ValueVector& left, common::ValueVector& right,
         void* dataPtr) {
@@ -223,6 +251,11 @@ struct BinaryFunctionExecutor {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, lPos, i, i,
                     numSelectedValues, selectedPositionsBuffer, dataPtr);
             });
+        } else if constexpr (canSelectWithoutBranch<LEFT_TYPE, RIGHT_TYPE, SELECT_WRAPPER>()) {
+            rightSelVector.forEach([&](auto i) {
+                selectOnValueMasked<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, lPos,
+                    i, i, right.isNull(i), numSelectedValues, selectedPositionsBuffer, dataPtr);
+            });
         } else {
             rightSelVector.forEach([&](auto i) {
                 if (!right.isNull(i)) {
@@ -249,6 +282,11 @@ struct BinaryFunctionExecutor {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i, rPos, i,
                     numSelectedValues, selectedPositionsBuffer, dataPtr);
             });
+        } else if constexpr (canSelectWithoutBranch<LEFT_TYPE, RIGHT_TYPE, SELECT_WRAPPER>()) {
+            leftSelVector.forEach([&](auto i) {
+                selectOnValueMasked<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i,
+                    rPos, i, left.isNull(i), numSelectedValues, selectedPositionsBuffer, dataPtr);
+            });
         } else {
             leftSelVector.forEach([&](auto i) {
                 if (!left.isNull(i)) {
@@ -273,6 +311,12 @@ struct BinaryFunctionExecutor {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i, i, i,
                     numSelectedValues, selectedPositionsBuffer, dataPtr);
             });
+        } else if constexpr (canSelectWithoutBranch<LEFT_TYPE, RIGHT_TYPE, SELECT_WRAPPER>()) {
+            leftSelVector.forEach([&](auto i) {
+                selectOnValueMasked<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i, i,
+                    i, left.isNull(i) | right.isNull(i), numSelectedValues,
+                    selectedPositionsBuffer, dataPtr);
+            });
         } else {
             leftSelVector.forEach([&](auto i) {
                 auto isNull = left.isNull(i) || right.isNull(i);
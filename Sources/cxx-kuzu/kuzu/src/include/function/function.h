@@ -62,6 +62,9 @@ struct KUZU_API Function {
     std::string name;
     std::vector<common::LogicalTypeID> parameterTypeIDs;
     bool isReadOnly = true;
+    // Whether the function returns the same result whenever it is evaluated on the same input
+    // without side effects, e.g. RAND() and CURRENT_DATE() don't.
+    bool isDeterministic = true;
 
     Function() : isReadOnly{true} {};
     Function(std::string name, std::vector<common::LogicalTypeID> parameterTypeIDs)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "function/gds/bfs_graph.h"
+#include "function/gds/gds_frontier.h"
 #include "gds_auxilary_state.h"
 
 namespace kuzu {
@@ -25,6 +26,25 @@ private:
     std::unique_ptr<BFSGraphManager> bfsGraphManager;
 };
 
+// Reads the costs of the parents of nodes in the current BFS graph.
+class BFSGraphCostReader : public NodeCostReader {
+public:
+    explicit BFSGraphCostReader(BFSGraphManager* bfsGraphManager)
+        : bfsGraphManager{bfsGraphManager} {}
+
+    void pinTableID(common::table_id_t tableID) override {
+        bfsGraphManager->getCurrentGraph()->pinTableID(tableID);
+    }
+
+    double getCost(common::offset_t offset) override {
+        auto parent = bfsGraphManager->getCurrentGraph()->getParentListHead(offset);
+        return parent == nullptr ? std::numeric_limits<double>::max() : parent->getCost();
+    }
+
+private:
+    BFSGraphManager* bfsGraphManager;
+};
+
 class WSPPathsAuxiliaryState : public GDSAuxiliaryState {
 public:
     explicit WSPPathsAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager)
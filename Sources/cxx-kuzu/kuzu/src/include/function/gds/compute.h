@@ -24,6 +24,21 @@ public:
     virtual std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
         graph::NbrScanState::Chunk& results, bool fwdEdge) = 0;
 
+    // Whether the edge compute can also be done pull-style (bottom-up), see pullEdgeCompute.
+    virtual bool canPull() const { return false; }
+
+    // Returns true if the node at the given offset, which is in the table of the next frontier,
+    // may still be put in the next frontier, so that its edges need to be pulled.
+    virtual bool needPull(common::offset_t) { return false; }
+
+    // Pull-style counterpart of edgeCompute. nbrNodeID is a node for which needPull returns true,
+    // and the results are its edges scanned in the opposite direction, i.e., the neighbors are
+    // candidates of being in the current frontier. Returns true if nbrNodeID should be put in the
+    // next frontier. Same as edgeCompute, **do not** call setActive.
+    virtual bool pullEdgeCompute(common::nodeID_t, graph::NbrScanState::Chunk&, bool) {
+        return false;
+    }
+
     virtual void resetSingleThreadState() {}
 
     virtual bool terminate(common::NodeOffsetMaskMap&) { return false; }
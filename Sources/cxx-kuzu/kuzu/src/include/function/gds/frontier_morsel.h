@@ -35,6 +35,8 @@ public:
     explicit FrontierMorselDispatcher(uint64_t maxThreads);
 
     void init(common::offset_t _maxOffset);
+    // Dispatches morsels of the given size, for computes where each offset is expensive.
+    void init(common::offset_t _maxOffset, uint64_t _morselSize);
 
     bool getNextRangeMorsel(FrontierMorsel& frontierMorsel);
 
@@ -78,6 +78,10 @@ public:
         const std::string& name);
     static graph::NativeGraphEntry bindGraphEntry(main::ClientContext& context,
         const graph::ParsedNativeGraphEntry& parsedGraphEntry);
+    // Rebuilds the snapshot of a materialized graph if the current transaction cannot read it.
+    // Throws if the snapshot exceeds the memory limit of projected graphs.
+    static void materializeGraph(main::ClientContext& context, const std::string& graphName,
+        graph::ParsedNativeGraphEntry& parsedGraphEntry, const graph::NativeGraphEntry& entry);
     static std::shared_ptr<binder::Expression> bindRelOutput(const TableFuncBindInput& bindInput,
         const std::vector<catalog::TableCatalogEntry*>& relEntries,
         std::shared_ptr<binder::NodeExpression> srcNode,
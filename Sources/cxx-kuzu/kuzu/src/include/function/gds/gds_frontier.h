@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <map>
 #include <mutex>
 
 #include "compute.h"
@@ -45,6 +46,7 @@ class KUZU_API SparseFrontier : public Frontier {
     friend class SparseFrontierReference;
     friend class SPFrontierPair;
     friend class DenseSparseDynamicFrontierPair;
+    friend class DeltaSteppingFrontierPair;
 
 public:
     explicit SparseFrontier(const common::table_id_map_t<common::offset_t>& nodeMaxOffsetMap)
@@ -163,7 +165,10 @@ private:
 
 class KUZU_API FrontierPair {
 public:
-    FrontierPair() { hasActiveNodesForNextIter_.store(false); }
+    FrontierPair() {
+        hasActiveNodesForNextIter_.store(false);
+        numActiveNodesForNextIter.store(0);
+    }
     virtual ~FrontierPair() = default;
 
     void resetCurrentIter() { curIter = 0; }
@@ -171,7 +176,18 @@ public:
 
     void setActiveNodesForNextIter() { hasActiveNodesForNextIter_.store(true); }
 
-    bool continueNextIter(uint16_t maxIter) {
+    // Number of nodes put in the next frontier by frontier tasks. A node put by several threads
+    // concurrently may be counted more than once, so this is only an estimate, e.g., for picking
+    // the direction of the next iteration.
+    void addNumActiveNodesForNextIter(common::offset_t numNodes) {
+        numActiveNodesForNextIter.fetch_add(numNodes, std::memory_order_relaxed);
+    }
+    common::offset_t getNumActiveNodesInCurrentIter() const { return numActiveNodesInCurrentIter; }
+    common::offset_t getNumActiveNodesForNextIter() const {
+        return numActiveNodesForNextIter.load(std::memory_order_relaxed);
+    }
+
+    virtual bool continueNextIter(uint16_t maxIter) {
         return hasActiveNodesForNextIter_.load(std::memory_order_relaxed) &&
                getCurrentIter() < maxIter;
     }
@@ -210,6 +226,8 @@ protected:
     // curIter is the iteration number of the algorithm and starts from 0.
     iteration_t curIter = 0;
     std::atomic<bool> hasActiveNodesForNextIter_;
+    std::atomic<common::offset_t> numActiveNodesForNextIter;
+    common::offset_t numActiveNodesInCurrentIter = 0;
     Frontier* currentFrontier = nullptr;
     Frontier* nextFrontier = nullptr;
 };
@@ -229,6 +247,8 @@ public:
 
     // Get number of active nodes in current frontier. Used for shortest path early termination.
     common::offset_t getNumActiveNodesInCurrentFrontier(common::NodeOffsetMaskMap& mask);
+    // Get nodes put in the next frontier in the current iteration. Used for bidirectional search.
+    std::vector<common::nodeID_t> getNextFrontierNodes();
 
     std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override;
 
@@ -272,6 +292,82 @@ private:
     std::unique_ptr<SparseFrontier> nextSparseFrontier = nullptr;
 };
 
+// Reads the tentative costs of nodes of weighted shortest paths. Nodes that are not reached have
+// the max double cost.
+class NodeCostReader {
+public:
+    virtual ~NodeCostReader() = default;
+
+    virtual void pinTableID(common::table_id_t tableID) = 0;
+    virtual double getCost(common::offset_t offset) = 0;
+};
+
+// Next frontier of delta-stepping. Nodes put in the frontier are only collected, and are bucketed
+// by DeltaSteppingFrontierPair at the beginning of the next iteration.
+class DeltaSteppingNextFrontier : public Frontier {
+    friend class DeltaSteppingFrontierPair;
+
+public:
+    void pinTableID(common::table_id_t tableID) override { curTableID = tableID; }
+
+    void addNode(common::nodeID_t nodeID, iteration_t iter) override;
+    void addNode(common::offset_t offset, iteration_t iter) override;
+    void addNodes(const std::vector<common::nodeID_t>& nodeIDs, iteration_t iter) override;
+
+    iteration_t getIteration(common::offset_t) const override { KU_UNREACHABLE; }
+
+    uint64_t size() const { return numNodes; }
+
+private:
+    std::mutex mtx;
+    common::table_id_t curTableID = common::INVALID_TABLE_ID;
+    common::table_id_map_t<std::vector<common::offset_t>> nodes;
+    uint64_t numNodes = 0;
+};
+
+// Frontier pair of delta-stepping (Meyer and Sanders) for weighted shortest paths. Reached nodes
+// are kept in buckets of costs of width delta, and each iteration only extends the nodes of the
+// lowest non-empty bucket. Nodes improved into the current bucket are extended again in the next
+// iteration until the bucket is settled, while nodes of higher buckets wait for their costs to
+// settle, instead of being extended with every intermediate cost as Bellman-Ford frontiers do.
+// A node can be in several buckets. Only the entry in the bucket of its current cost is extended.
+// The current frontier stays sparse, since a bucket already lists the nodes it extends and a dense
+// frontier would scan every node for each bucket.
+class KUZU_API DeltaSteppingFrontierPair : public FrontierPair {
+public:
+    DeltaSteppingFrontierPair(common::table_id_map_t<common::offset_t> nodeMaxOffsetMap,
+        std::unique_ptr<NodeCostReader> costReader);
+
+    // Delta-stepping extends nodes in the order of their costs instead of their number of hops, so
+    // iterations don't bound the length of paths.
+    bool continueNextIter(uint16_t) override {
+        return hasActiveNodesForNextIter_.load(std::memory_order_relaxed);
+    }
+
+    void beginNewIterationInternalNoLock() override;
+
+    std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override;
+
+    GDSDensityState getState() const override { return GDSDensityState::SPARSE; }
+    bool needSwitchToDense(uint64_t) const override { return false; }
+    void switchToDense(processor::ExecutionContext*, graph::Graph*) override { KU_UNREACHABLE; }
+
+private:
+    void tuneDelta();
+    uint64_t getBucketIdx(double cost) const;
+    void bucketNextFrontierNodes();
+    void activateLowestBucket();
+
+private:
+    common::table_id_map_t<common::offset_t> nodeMaxOffsetMap;
+    std::unique_ptr<NodeCostReader> costReader;
+    bool isDeltaTuned = false;
+    double delta = std::numeric_limits<double>::max();
+    std::map<uint64_t, common::table_id_map_t<std::vector<common::offset_t>>> buckets;
+    std::unique_ptr<DeltaSteppingNextFrontier> bucketingFrontier;
+    std::unique_ptr<SparseFrontier> sparseFrontier;
+};
+
 // Frontier pair implementation that only uses dense frontier. This is mostly used in
 // algorithms like wcc, scc where algorithms touch all nodes in the graph.
 class KUZU_API DenseFrontierPair : public FrontierPair {
@@ -173,6 +173,9 @@ public:
 
     std::size_t size() const { return vec.size(); }
 
+    T* data() { return vec.data(); }
+    const T* data() const { return vec.data(); }
+
     T& operator[](std::size_t index) { return vec[index]; }
     const T& operator[](std::size_t index) const { return vec[index]; }
 
@@ -7,6 +7,7 @@
 #include "frontier_morsel.h"
 #include "function/gds/gds_frontier.h"
 #include "graph/graph.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 
 namespace kuzu {
 namespace function {
@@ -59,6 +60,30 @@ public:
 private:
     FrontierTaskInfo info;
     std::shared_ptr<FrontierTaskSharedState> sharedState;
+    // Scope of the GDS pipeline creating the task, see ProcessorTask::trackMemory.
+    const storage::MemoryTrackerScope* pipelineMemoryScope =
+        storage::MemoryTrackerScope::getCurrent();
+};
+
+// Pull-style (bottom-up) counterpart of FrontierTask. Instead of extending the nodes in the
+// current frontier, each node of the nbr table that may still be put in the next frontier scans
+// its edges in the opposite direction and looks for neighbors in the current frontier. The scan
+// of a node stops as soon as the edge compute no longer needs to pull, so when the current
+// frontier is large, far fewer edges are scanned. Morsels are over the nbr table.
+class FrontierPullTask : public common::Task {
+public:
+    FrontierPullTask(uint64_t maxNumThreads, const FrontierTaskInfo& info,
+        std::shared_ptr<FrontierTaskSharedState> sharedState)
+        : Task{maxNumThreads}, info{info}, sharedState{std::move(sharedState)} {}
+
+    void run() override;
+
+private:
+    FrontierTaskInfo info;
+    std::shared_ptr<FrontierTaskSharedState> sharedState;
+    // Scope of the GDS pipeline creating the task, see ProcessorTask::trackMemory.
+    const storage::MemoryTrackerScope* pipelineMemoryScope =
+        storage::MemoryTrackerScope::getCurrent();
 };
 
 struct VertexComputeTaskSharedState {
@@ -100,6 +125,9 @@ public:
 private:
     VertexComputeTaskInfo info;
     std::shared_ptr<VertexComputeTaskSharedState> sharedState;
+    // Scope of the GDS pipeline creating the task, see ProcessorTask::trackMemory.
+    const storage::MemoryTrackerScope* pipelineMemoryScope =
+        storage::MemoryTrackerScope::getCurrent();
 };
 
 } // namespace function
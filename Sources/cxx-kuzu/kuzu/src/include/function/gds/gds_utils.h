@@ -17,11 +17,24 @@ public:
     static void runFTSEdgeCompute(processor::ExecutionContext* context, GDSComputeState& compState,
         graph::Graph* graph, common::ExtendDirection extendDirection,
         const std::vector<std::string>& propertiesToScan);
+    // Run a single push iteration of edge compute, for algorithms that work on the frontiers
+    // between iterations.
+    static void runEdgeComputeIteration(processor::ExecutionContext* context,
+        GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
+        const std::vector<std::string>& propertiesToScan);
     // Run edge compute for recursive join.
     static void runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
         const std::vector<std::string>& propertiesToScan);
+    // Run bidirectional BFS for single pair shortest paths. The forward and backward states are
+    // initialized with the source and the destination, and the search with the smaller frontier
+    // is extended until it visits a node visited by the other. Returns the meeting node on a
+    // shortest path, or an invalid node ID if there is no path within maxIteration hops.
+    static common::nodeID_t runBidirectionalSPEdgeCompute(processor::ExecutionContext* context,
+        GDSComputeState& fwdState, GDSComputeState& bwdState, graph::Graph* graph,
+        common::ExtendDirection extendDirection, uint64_t maxIteration,
+        const std::vector<std::string>& propertiesToScan);
 
     // Run vertex compute without property scan
     static void runVertexCompute(processor::ExecutionContext* context, GDSDensityState densityState,
@@ -50,6 +50,11 @@ protected:
         return vector;
     }
 
+    // Maps the offset back if the algorithm runs on relabeled nodes (see Graph::relabelNodes).
+    common::nodeID_t getOutputNodeID(common::offset_t offset, common::table_id_t tableID) const {
+        return {sharedState->graph->getOriginalOffset(tableID, offset), tableID};
+    }
+
 protected:
     GDSFuncSharedState* sharedState;
     storage::MemoryManager* mm;
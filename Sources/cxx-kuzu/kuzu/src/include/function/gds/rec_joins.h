@@ -54,7 +54,37 @@ public:
         const RJBindData& bindData, GDSComputeState& computeState, common::nodeID_t sourceNodeID,
         processor::RecursiveExtendSharedState* sharedState) = 0;
 
+    // Single pair shortest path algorithms can search from both ends, see
+    // GDSUtils::runBidirectionalSPEdgeCompute. The backward state is a compute state of the same
+    // algorithm, initialized with the destination.
+    virtual bool canSearchBidirectionally() const { return false; }
+    // Extends the forward state to the destination with the path of the backward state from the
+    // meeting node, so that the output writer of the forward state writes the destination.
+    virtual void joinBidirectionalSearch(GDSComputeState&, GDSComputeState&, common::nodeID_t,
+        common::nodeID_t) {
+        KU_UNREACHABLE;
+    }
+
+    // Reachability algorithms can run the BFSs of many sources at once (multi-source BFS, Then et
+    // al.), where the sources that reached a node are kept as a bit mask, so that each level of all
+    // BFSs is extended with a single scan of the edges of the frontier.
+    static constexpr uint64_t MULTI_SOURCE_BFS_MAX_NUM_SOURCES = 64;
+    virtual bool canRunMultiSourceBFS() const { return false; }
+    // Runs the BFSs of at most MULTI_SOURCE_BFS_MAX_NUM_SOURCES sources and writes their results.
+    virtual void runMultiSourceBFS(processor::ExecutionContext*, const RJBindData&,
+        processor::RecursiveExtendSharedState*, const std::vector<common::nodeID_t>&) {
+        KU_UNREACHABLE;
+    }
+
     virtual std::unique_ptr<RJAlgorithm> copy() const = 0;
+
+protected:
+    // Weighted shortest paths use delta-stepping frontiers only if the upper bound on hops can't cut
+    // off any path, since delta-stepping doesn't count hops. Otherwise the bound is kept by
+    // iterating DenseSparseDynamicFrontierPair.
+    static std::unique_ptr<FrontierPair> getWeightedSPFrontierPair(
+        processor::ExecutionContext* context, const RJBindData& bindData, graph::Graph* graph,
+        std::unique_ptr<NodeCostReader> costReader);
 };
 
 } // namespace function
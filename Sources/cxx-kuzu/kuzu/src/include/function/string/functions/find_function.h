@@ -19,6 +19,11 @@ struct Find {
         result = Find::find(left.getData(), left.len, right.getData(), right.len) + 1;
     }
 
+    // Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
+    // contain needle, it returns -1.
+    static int64_t find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
+        uint32_t needleLen);
+
 private:
     template<class UNSIGNED>
     static int64_t unalignedNeedleSizeFind(const uint8_t* haystack, uint32_t haystackLen,
@@ -30,11 +35,6 @@ private:
 
     static int64_t genericFind(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
         uint32_t needLen, uint32_t firstMatchCharOffset);
-
-    // Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
-    // contain needle, it returns -1.
-    static int64_t find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
-        uint32_t needleLen);
 };
 
 } // namespace function
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+#include "common/types/ku_string.h"
+
+namespace kuzu {
+namespace function {
+
+// A literal that every string matched by a regex contains. Strings without the literal are
+// rejected by a substring search instead of running the regex.
+struct RegexpLiteralFilter {
+    std::string literal;
+    // Whether the regex matches exactly the strings containing the literal, i.e. the regex is the
+    // literal itself.
+    bool isExact = false;
+
+    // The pattern must already be in RE2 syntax, see BaseRegexpOperation::parseCypherPattern.
+    static RegexpLiteralFilter get(const std::string& pattern);
+
+    bool mayMatch(const common::ku_string_t& str) const;
+    bool equals(const common::ku_string_t& str) const;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "common/arrow/arrow.h"
+#include "function/table/bind_data.h"
+#include "function/table/table_function.h"
+
+namespace kuzu {
+namespace function {
+
+struct ArrowStreamScanBindData final : TableFuncBindData {
+    ArrowArrayStream* stream;
+    std::shared_ptr<ArrowSchemaWrapper> schema;
+
+    ArrowStreamScanBindData(binder::expression_vector columns, ArrowArrayStream* stream,
+        std::shared_ptr<ArrowSchemaWrapper> schema)
+        : TableFuncBindData{std::move(columns)}, stream{stream}, schema{std::move(schema)} {}
+    ArrowStreamScanBindData(const ArrowStreamScanBindData& other)
+        : TableFuncBindData{other}, stream{other.stream}, schema{other.schema} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ArrowStreamScanBindData>(*this);
+    }
+};
+
+// A morsel of an Arrow record batch. The batch is shared by all morsels cut from it, and is
+// released once the last of them has been scanned.
+struct ArrowStreamMorsel {
+    std::shared_ptr<ArrowArrayWrapper> batch;
+    uint64_t offset = 0;
+    uint64_t numRows = 0;
+};
+
+struct ArrowStreamScanSharedState final : TableFuncSharedState {
+    ArrowArrayStream* stream;
+    std::shared_ptr<ArrowArrayWrapper> currentBatch;
+    uint64_t currentBatchOffset = 0;
+    bool finished = false;
+
+    explicit ArrowStreamScanSharedState(ArrowArrayStream* stream) : stream{stream} {}
+
+    ArrowStreamMorsel getMorsel();
+};
+
+// Scans the record batches of an Arrow C stream. Each morsel is converted directly from the Arrow
+// buffers of its batch into the output vectors, with fixed-width columns copied in bulk. The
+// function can only be bound through the scan replacement registered by
+// Connection::copyFromArrowStream.
+struct ArrowStreamScanFunction {
+    static constexpr const char* name = "READ_ARROW_STREAM";
+
+    static TableFunction getFunction();
+};
+
+} // namespace function
+} // namespace kuzu
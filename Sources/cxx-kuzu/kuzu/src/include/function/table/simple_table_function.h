@@ -110,6 +110,12 @@ struct StorageInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct StorageSummaryFunction final {
+    static constexpr const char* name = "STORAGE_SUMMARY";
+
+    static function_set getFunctionSet();
+};
+
 struct StatsInfoFunction final {
     static constexpr const char* name = "STATS_INFO";
 
@@ -128,6 +134,62 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct IOStatsFunction final {
+    static constexpr const char* name = "IO_STATS";
+
+    static function_set getFunctionSet();
+};
+
+struct SchedulerInfoFunction final {
+    static constexpr const char* name = "SCHEDULER_INFO";
+
+    static function_set getFunctionSet();
+};
+
+// Number of commits appended to the WAL and of syncs making them durable since the database was
+// opened. Commits sharing a sync (group commit) make the latter smaller.
+struct WALInfoFunction final {
+    static constexpr const char* name = "WAL_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryPlanCacheInfoFunction final {
+    static constexpr const char* name = "QUERY_PLAN_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryStatsFunction final {
+    static constexpr const char* name = "QUERY_STATS";
+
+    static function_set getFunctionSet();
+};
+
+struct SlowQueriesFunction final {
+    static constexpr const char* name = "SLOW_QUERIES";
+
+    static function_set getFunctionSet();
+};
+
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+// Allocates blocks of every size class of the slab allocator and frees them on another thread.
+// Only used to test the allocator.
+struct DebugSlabAllocatorFunction final {
+    static constexpr const char* name = "DEBUG_SLAB_ALLOCATOR";
+
+    static function_set getFunctionSet();
+};
+
+// Lengths of the version chains of the updated vectors of a node table. Only used to test how
+// versions are vacuumed.
+struct DebugUpdateVersionsFunction final {
+    static constexpr const char* name = "DEBUG_UPDATE_VERSIONS";
+
+    static function_set getFunctionSet();
+};
+#endif
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
@@ -140,6 +202,15 @@ struct ShowAttachedDatabasesFunction final {
     static function_set getFunctionSet();
 };
 
+// Runs a read query on each of the given attached Kuzu databases in parallel, and returns the union
+// of the results, e.g. of the partial aggregates or the top k rows of shards, for the calling
+// query to merge. The databases are given as a comma-separated list of names.
+struct QueryAttachedFunction final {
+    static constexpr const char* name = "QUERY_ATTACHED";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowFunctionsFunction final {
     static constexpr const char* name = "SHOW_FUNCTIONS";
 
@@ -158,6 +229,20 @@ struct ShowOfficialExtensionsFunction final {
     static function_set getFunctionSet();
 };
 
+// Returns the groups of an aggregate view with their aggregated values.
+struct AggregateViewFunction final {
+    static constexpr const char* name = "AGGREGATE_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+// Returns the state, size and memory usage of the reverse index of each table of a rel group.
+struct ReverseIndexInfoFunction final {
+    static constexpr const char* name = "REVERSE_INDEX_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowIndexesFunction final {
     static constexpr const char* name = "SHOW_INDEXES";
 
@@ -29,5 +29,88 @@ struct DropProjectedGraphFunction {
     static function_set getFunctionSet();
 };
 
+// Samples a node table to build the histograms the planner uses to estimate filter selectivity, or
+// a rel table to collect the degree stats it uses to cost intersections.
+struct AnalyzeFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
+// Builds a sorted index on a node table property, which the planner uses for selective range and
+// equality filters on the property.
+struct CreateSortedIndexFunction {
+    static constexpr const char* name = "CREATE_SORTED_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropSortedIndexFunction {
+    static constexpr const char* name = "DROP_SORTED_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+// Defines an aggregate view on a node table, which keeps the result of grouping its nodes by a
+// property and aggregating another one with COUNT, SUM, MIN or MAX. COUNT takes '*' as the
+// property to count the nodes of each group.
+struct CreateAggregateViewFunction {
+    static constexpr const char* name = "CREATE_AGGREGATE_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct DropAggregateViewFunction {
+    static constexpr const char* name = "DROP_AGGREGATE_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+// Keeps an in-memory reverse index of a rel table stored with storage direction 'fwd', so that
+// the table can be traversed backward. The index is built in the background, and used by the
+// queries planned once it is ready.
+struct CreateReverseIndexFunction {
+    static constexpr const char* name = "CREATE_REVERSE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropReverseIndexFunction {
+    static constexpr const char* name = "DROP_REVERSE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+// Rewrites the node groups of a node table which have many deleted rows, and checkpoints the
+// deletions of a rel table out of its CSR regions. The freed pages are returned to the free space
+// manager by the checkpoint at the end of the call.
+struct VacuumFunction {
+    static constexpr const char* name = "VACUUM";
+
+    static function_set getFunctionSet();
+};
+
+// Copies the database to another path while it stays open. See storage::DatabaseBackup.
+struct BackupFunction {
+    static constexpr const char* name = "BACKUP";
+
+    static function_set getFunctionSet();
+};
+
+// Ships the WAL to a path, from which the copies of the database backed up since its last
+// checkpoint replay it. See storage::DatabaseBackup::shipWAL.
+struct ShipWALFunction {
+    static constexpr const char* name = "SHIP_WAL";
+
+    static function_set getFunctionSet();
+};
+
+// Replays the new commits of a shipped WAL. See storage::StorageManager::replayShippedWAL.
+struct ReplayWALFunction {
+    static constexpr const char* name = "REPLAY_WAL";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -10,6 +10,9 @@
 #include <span>
 
 namespace kuzu {
+namespace common {
+class NodeOffsetMaskMap;
+} // namespace common
 namespace catalog {
 class TableCatalogEntry;
 } // namespace catalog
@@ -94,6 +97,9 @@ public:
             return std::span(reinterpret_cast<const T*>(propertyVectors[propertyIndex]->getData()),
                 nodeIDs.size());
         }
+        bool isNull(size_t propertyIndex, size_t idx) const {
+            return propertyVectors[propertyIndex]->isNull(idx);
+        }
 
     private:
         KUZU_API Chunk(std::span<const common::nodeID_t> nodeIDs,
@@ -195,6 +201,18 @@ public:
     // Get num nodes for all node tables.
     virtual common::offset_t getNumNodes(transaction::Transaction* transaction) const = 0;
 
+    // Get the mask of nodes that are in the graph, or nullptr if all nodes are.
+    virtual common::NodeOffsetMaskMap* getNodeOffsetMaskMap() const = 0;
+
+    // Switches the graph to the degree-ordered relabeling of its nodes if the graph has one (see
+    // GraphSnapshot), and returns whether it did. Node offsets of later scans are relabeled, so
+    // callers must keep node state by offset only, not scan properties, and map offsets back with
+    // getOriginalOffset on output.
+    virtual bool relabelNodes() { return false; }
+    virtual common::offset_t getOriginalOffset(common::table_id_t, common::offset_t offset) const {
+        return offset;
+    }
+
     // Get all possible (srcTable, dstTable, relTable)s.
     virtual std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) = 0;
 
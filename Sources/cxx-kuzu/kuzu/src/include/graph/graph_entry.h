@@ -6,6 +6,8 @@
 
 namespace kuzu {
 namespace graph {
+class GraphResultCache;
+class GraphSnapshot;
 
 struct NativeGraphEntryTableInfo {
     catalog::TableCatalogEntry* entry;
@@ -25,6 +27,10 @@ struct NativeGraphEntryTableInfo {
 struct KUZU_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // Materialized adjacency of the rel tables, set if the graph is projected with materialize.
+    std::shared_ptr<const GraphSnapshot> snapshot;
+    // Results of incremental graph algorithm calls, shared by all bindings of a projected graph.
+    std::shared_ptr<GraphResultCache> resultCache;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -43,7 +49,8 @@ struct KUZU_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos}, snapshot{other.snapshot},
+          resultCache{other.resultCache} {}
 };
 
 } // namespace graph
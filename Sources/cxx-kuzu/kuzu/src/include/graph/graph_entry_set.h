@@ -27,6 +27,9 @@ public:
     }
     void dropGraph(const std::string& name) { nameToEntry.erase(name); }
 
+    // Total memory used by the materialized snapshots of all native graphs.
+    uint64_t getSnapshotMemoryUsage() const;
+
     const std::unordered_map<std::string, std::unique_ptr<ParsedGraphEntry>>&
     getNameToEntryMap() const {
         return nameToEntry;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/cast.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace graph {
+
+// Result of a graph algorithm kept by a projected graph, so that the next incremental call of the
+// algorithm on the graph starts from it instead of from scratch.
+struct CachedGraphResult {
+    // Start timestamp of the transaction which computed the result.
+    common::transaction_t snapshotTS;
+
+    explicit CachedGraphResult(common::transaction_t snapshotTS) : snapshotTS{snapshotTS} {}
+    virtual ~CachedGraphResult() = default;
+
+    template<class TARGET>
+    const TARGET* constPtrCast() const {
+        return common::ku_dynamic_cast<const TARGET*>(this);
+    }
+};
+
+// Results of the graph algorithms run on a projected graph, keyed by algorithm name.
+class GraphResultCache {
+public:
+    std::shared_ptr<const CachedGraphResult> getResult(const std::string& name) const {
+        std::unique_lock lck{mtx};
+        return results.contains(name) ? results.at(name) : nullptr;
+    }
+
+    void setResult(const std::string& name, std::shared_ptr<const CachedGraphResult> result) {
+        std::unique_lock lck{mtx};
+        results[name] = std::move(result);
+    }
+
+private:
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, std::shared_ptr<const CachedGraphResult>> results;
+};
+
+} // namespace graph
+} // namespace kuzu
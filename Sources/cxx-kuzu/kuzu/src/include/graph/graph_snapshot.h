@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/enums/rel_direction.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+namespace transaction {
+class Transaction;
+} // namespace transaction
+namespace storage {
+class RelTableCSRCache;
+} // namespace storage
+namespace graph {
+struct NativeGraphEntry;
+
+// Changes of the adjacency between a snapshot and the snapshot it replaced.
+struct GraphSnapshotDelta {
+    common::transaction_t previousSnapshotTS;
+    // Bound nodes whose neighbours changed and the neighbours added or removed, sorted.
+    common::table_id_map_t<std::vector<common::offset_t>> touchedNodes;
+    bool hasRemovedRels = false;
+
+    uint64_t getNumTouchedNodes() const;
+};
+
+// In-memory CSR snapshot of the rel tables of a projected graph, materialized by PROJECT_GRAPH so
+// that the graph algorithms run on the graph one after another don't re-scan the rel tables.
+// Same as RelTableCSRCache, only neighbour node IDs are kept, so scans that need rel properties
+// read from the tables instead. The rels of rel tables with predicates are filtered when the
+// snapshot is built, so the predicates are evaluated once per snapshot rather than on every scan.
+// A snapshot is only read by read-only transactions which started at the timestamp it was built
+// at, so it is rebuilt on the first use after the database changes.
+// A snapshot can also keep a relabeled copy of the caches, where the nodes of each table are
+// numbered in decreasing order of degree. Algorithms that only touch node state by offset run on
+// the relabeled copy to keep the state of high degree nodes close together, and map the offsets
+// back to the original ones on output (see Graph::relabelNodes).
+class GraphSnapshot {
+public:
+    // Returns nullptr if the transaction cannot build a snapshot. If the snapshot replaces a
+    // previous one, the changes since are kept as its delta.
+    static std::unique_ptr<GraphSnapshot> build(main::ClientContext& context,
+        const NativeGraphEntry& entry, bool relabel = false,
+        const GraphSnapshot* previous = nullptr);
+
+    common::transaction_t getSnapshotTS() const { return snapshotTS; }
+    bool canBeReadBy(const transaction::Transaction* transaction) const;
+
+    // Returns nullptr if the changes since the previous snapshot are unknown, which is the case if
+    // there was no previous snapshot, the graph has predicates, or nodes were added.
+    const GraphSnapshotDelta* getDelta() const { return delta.get(); }
+
+    // Returns nullptr if the given direction of the rel table is not materialized.
+    std::shared_ptr<const storage::RelTableCSRCache> getCSRCache(common::oid_t relTableID,
+        common::RelDataDirection direction, bool relabeled = false) const;
+
+    bool isRelabeled() const { return !newToOldOffsets.empty(); }
+    common::offset_t getOriginalOffset(common::table_id_t tableID,
+        common::offset_t relabeledOffset) const {
+        return newToOldOffsets.at(tableID)[relabeledOffset];
+    }
+
+    uint64_t getMemoryUsage() const { return memoryUsage; }
+
+private:
+    explicit GraphSnapshot(common::transaction_t snapshotTS) : snapshotTS{snapshotTS} {}
+
+    void relabel(main::ClientContext& context);
+    void computeDelta(main::ClientContext& context, const GraphSnapshot& previous);
+
+private:
+    common::transaction_t snapshotTS;
+    uint64_t memoryUsage = 0;
+    common::table_id_map_t<common::offset_t> numNodes;
+    std::unordered_map<common::oid_t,
+        std::array<std::shared_ptr<const storage::RelTableCSRCache>, 2>>
+        csrCaches;
+    std::unordered_map<common::oid_t,
+        std::array<std::shared_ptr<const storage::RelTableCSRCache>, 2>>
+        relabeledCSRCaches;
+    common::table_id_map_t<std::vector<common::offset_t>> newToOldOffsets;
+    std::unique_ptr<GraphSnapshotDelta> delta;
+};
+
+} // namespace graph
+} // namespace kuzu
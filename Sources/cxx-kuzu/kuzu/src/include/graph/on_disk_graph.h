@@ -14,6 +14,7 @@
 #include "processor/operator/filtering_operator.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
+#include "storage/table/rel_table_csr_cache.h"
 
 namespace kuzu {
 namespace storage {
@@ -87,6 +88,12 @@ private:
 
     std::vector<InnerIterator> directedIterators;
     InnerIterator* currentIter = nullptr;
+
+    // Set for the directions read from the in-memory adjacency of the rel table instead. Only
+    // used if neither rel properties nor a rel predicate need to be scanned.
+    std::vector<std::shared_ptr<const storage::RelTableCSRCache>> csrCaches;
+    const storage::RelTableCSRCache* currentCSRCache = nullptr;
+    storage::RelTableCSRCache::Cursor csrCursor;
 };
 
 class OnDiskGraphVertexScanState final : public VertexScanState {
@@ -124,6 +131,7 @@ public:
     NativeGraphEntry* getGraphEntry() override { return &graphEntry; }
 
     void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) { nodeOffsetMaskMap = maskMap; }
+    common::NodeOffsetMaskMap* getNodeOffsetMaskMap() const override { return nodeOffsetMaskMap; }
 
     std::vector<common::table_id_t> getNodeTableIDs() const override {
         return graphEntry.getNodeTableIDs();
@@ -137,6 +145,10 @@ public:
 
     common::offset_t getNumNodes(transaction::Transaction* transaction) const override;
 
+    bool relabelNodes() override;
+    common::offset_t getOriginalOffset(common::table_id_t tableID,
+        common::offset_t offset) const override;
+
     std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override;
 
     std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
@@ -155,6 +167,7 @@ private:
     main::ClientContext* context;
     NativeGraphEntry graphEntry;
     common::NodeOffsetMaskMap* nodeOffsetMaskMap = nullptr;
+    bool relabeled = false;
     common::table_id_map_t<storage::NodeTable*> nodeIDToNodeTable;
     std::vector<GraphRelInfo> relInfos;
 };
@@ -1,13 +1,16 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "common/cast.h"
+#include "graph/graph_result_cache.h"
 
 namespace kuzu {
 namespace graph {
+class GraphSnapshot;
 
 enum class GraphEntryType : uint8_t {
     NATIVE = 0,
@@ -41,11 +44,22 @@ struct ParsedNativeGraphTableInfo {
 struct KUZU_API ParsedNativeGraphEntry : ParsedGraphEntry {
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    // Whether the adjacency of the rel tables is kept in memory across graph algorithm calls.
+    bool materialize;
+    // Whether the snapshot also keeps a degree-ordered relabeling of the nodes.
+    bool relabel;
+    // Latest materialized snapshot, rebuilt by the first call that cannot read it.
+    std::shared_ptr<const GraphSnapshot> snapshot;
+    // Results kept by incremental graph algorithm calls.
+    std::shared_ptr<GraphResultCache> resultCache = std::make_shared<GraphResultCache>();
 
     ParsedNativeGraphEntry(std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool materialize = false,
+        bool relabel = false)
         : ParsedGraphEntry{GraphEntryType::NATIVE}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, materialize{materialize}, relabel{relabel} {}
+
+    uint64_t getSnapshotMemoryUsage() const;
 };
 
 struct KUZU_API ParsedCypherGraphEntry : ParsedGraphEntry {
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#ifndef __SINGLE_THREADED__
+#include <condition_variable>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#endif
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace main {
+
+/**
+ * AsyncQueryExecutor runs the queries submitted through Connection::queryAsync on a small, fixed
+ * set of threads owned by the database, so that the callers of queryAsync don't have to block a
+ * thread per in-flight query. The threads are only started when the first query is submitted.
+ * Queries are started in FIFO order, except that the queries of a connection run one at a time, as
+ * with Connection::query: a query is skipped while an earlier query of its connection runs, so
+ * that it doesn't hold a thread waiting for the connection while queries of other connections
+ * wait for a thread. The destructor waits for all submitted queries to finish.
+ */
+class AsyncQueryExecutor {
+public:
+    explicit AsyncQueryExecutor(uint64_t numThreads);
+    DELETE_COPY_AND_MOVE(AsyncQueryExecutor);
+    ~AsyncQueryExecutor();
+
+    // Jobs with the same key, e.g. the queries of a connection, are run one after another. Jobs
+    // without a key (nullptr) are run as soon as a thread is free.
+    void submit(const void* key, std::function<void()> job);
+
+private:
+#ifndef __SINGLE_THREADED__
+    struct Job {
+        const void* key;
+        std::function<void()> run;
+    };
+
+    void runWorkerThread();
+    bool isKeyRunningNoLock(const void* key) const {
+        return key != nullptr && runningKeys.contains(key);
+    }
+
+    uint64_t numThreads;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Job> jobs;
+    // Keys of the jobs being run.
+    std::unordered_set<const void*> runningKeys;
+    std::vector<std::thread> threads;
+    bool stopped;
+#endif
+};
+
+} // namespace main
+} // namespace kuzu
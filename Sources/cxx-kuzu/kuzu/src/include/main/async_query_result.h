@@ -0,0 +1,65 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "common/api.h"
+#include "main/query_result.h"
+
+namespace kuzu {
+namespace main {
+
+class Connection;
+
+/**
+ * @brief AsyncQueryResult is the handle of a query submitted through Connection::queryAsync. The
+ * query result can be waited for, or polled for with isDone().
+ */
+class AsyncQueryResult {
+    friend class Connection;
+
+public:
+    AsyncQueryResult(Connection* connection, uint64_t queryID)
+        : connection{connection}, queryID{queryID} {}
+
+    /**
+     * @return whether the query has finished, so that getResult() doesn't block.
+     */
+    KUZU_API bool isDone();
+    /**
+     * @brief Blocks until the query has finished.
+     */
+    KUZU_API void wait();
+    /**
+     * @brief Blocks until the query has finished and returns its result. The result can only be
+     * taken once; later calls return nullptr.
+     */
+    KUZU_API std::unique_ptr<QueryResult> getResult();
+    /**
+     * @brief Interrupts the query. A query that hasn't started yet fails without being run, and a
+     * running query is interrupted as with Connection::interrupt(). Once the query has finished,
+     * this has no effect, in particular not on later queries of the connection.
+     */
+    KUZU_API void interrupt();
+
+private:
+    // Returns false if the query has been interrupted before it starts.
+    bool start();
+    void finish(std::unique_ptr<QueryResult> queryResult);
+
+private:
+    Connection* connection;
+    // The ID the query is executed with, so that interrupting it can't interrupt another query.
+    uint64_t queryID;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool started = false;
+    bool interrupted = false;
+    bool done = false;
+    std::unique_ptr<QueryResult> result;
+};
+
+} // namespace main
+} // namespace kuzu
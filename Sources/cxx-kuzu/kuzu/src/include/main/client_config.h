@@ -4,6 +4,7 @@
 #include <string>
 
 #include "common/enums/path_semantic.h"
+#include "common/enums/scheduling_class.h"
 
 namespace kuzu {
 namespace main {
@@ -23,6 +24,27 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr common::SchedulingClass SCHEDULING_CLASS =
+        common::SchedulingClass::INTERACTIVE;
+    static constexpr uint64_t PROJECTED_GRAPH_MEMORY_LIMIT = 1ull << 30; // 1GB
+    // 0 means the memory of copies is only limited by the buffer pool.
+    static constexpr uint64_t COPY_MEMORY_BUDGET = 0;
+    // 0 means the memory of a query is only limited by the buffer pool.
+    static constexpr uint64_t QUERY_MEMORY_LIMIT = 0;
+    static constexpr uint64_t QUERY_PLAN_CACHE_SIZE = 128;
+    // 0 means query results are fully materialized before they are returned.
+    static constexpr uint64_t STREAMING_RESULT_BUFFER = 0;
+    static constexpr uint64_t ADAPTIVE_REOPTIMIZATION_THRESHOLD = 100;
+    // Far above the number of plans enumerated for query graphs of the sizes we plan exactly.
+    static constexpr uint64_t JOIN_ORDER_PLANNING_BUDGET = 1000000;
+    // 0 means join orders are never planned greedily up front.
+    static constexpr uint64_t JOIN_ORDER_GREEDY_THRESHOLD = 0;
+    static constexpr bool PROFILE_IN_JSON = false;
+    // 0 means no query is logged as slow.
+    static constexpr uint64_t SLOW_QUERY_THRESHOLD_IN_MS = 0;
+    // 0 means every pipeline may use all threads.
+    static constexpr uint64_t PIPELINE_TUPLES_PER_THREAD = 8192;
+    static constexpr uint64_t QUERY_STATS_MAX_QUERY_LENGTH = 256;
 };
 
 struct ClientConfig {
@@ -57,6 +79,44 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // Scheduling class of the tasks submitted by this client.
+    common::SchedulingClass schedulingClass = ClientConfigDefault::SCHEDULING_CLASS;
+    // Comma separated names of the rel tables whose adjacency is cached in memory for traversals.
+    std::string csrCacheRelTables;
+    // Memory limit (bytes) of the materialized snapshots of projected graphs.
+    uint64_t projectedGraphMemoryLimit = ClientConfigDefault::PROJECTED_GRAPH_MEMORY_LIMIT;
+    // Memory (bytes) that the partitioned data of a rel table copy can hold before it is spilled.
+    uint64_t copyMemoryBudget = ClientConfigDefault::COPY_MEMORY_BUDGET;
+    // Memory (bytes) that the buffers allocated while executing a query can hold before the query
+    // fails. 0 disables the limit.
+    uint64_t queryMemoryLimit = ClientConfigDefault::QUERY_MEMORY_LIMIT;
+    // Maximum number of query plans cached for queries repeated through query(). 0 disables the
+    // cache.
+    uint64_t queryPlanCacheSize = ClientConfigDefault::QUERY_PLAN_CACHE_SIZE;
+    // Number of tuples that the result of a read-only query can buffer ahead of the client when
+    // the result is streamed while the query is executed. 0 disables streaming.
+    uint64_t streamingResultBuffer = ClientConfigDefault::STREAMING_RESULT_BUFFER;
+    // A read-only query is re-planned once with the observed sizes when a hash join build side
+    // produces this many times more tuples than estimated. 0 disables re-optimization.
+    uint64_t adaptiveReoptimizationThreshold =
+        ClientConfigDefault::ADAPTIVE_REOPTIMIZATION_THRESHOLD;
+    // Number of plans that join order enumeration of a query graph may consider before the
+    // remaining joins are ordered greedily. 0 disables the limit.
+    uint64_t joinOrderPlanningBudget = ClientConfigDefault::JOIN_ORDER_PLANNING_BUDGET;
+    // Query graphs with at least this many nodes are joined in a greedy order instead of being
+    // enumerated. 0 disables greedy ordering.
+    uint64_t joinOrderGreedyThreshold = ClientConfigDefault::JOIN_ORDER_GREEDY_THRESHOLD;
+    // If PROFILE outputs the profiled plan and the pipeline timelines as JSON instead of text.
+    bool profileInJson = ClientConfigDefault::PROFILE_IN_JSON;
+    // Queries whose compiling and execution take at least this long (milliseconds) are logged
+    // with their profiled plan. 0 disables the log.
+    uint64_t slowQueryThresholdInMS = ClientConfigDefault::SLOW_QUERY_THRESHOLD_IN_MS;
+    // A pipeline scanning a node table uses one thread per this many tuples estimated to flow
+    // through it, and runs on the thread of the query if a single thread suffices. 0 disables it.
+    uint64_t pipelineTuplesPerThread = ClientConfigDefault::PIPELINE_TUPLES_PER_THREAD;
+    // Maximum length (bytes) of the text of the queries kept by QUERY_STATS. Longer queries are
+    // truncated. 0 keeps no query text.
+    uint64_t queryStatsMaxQueryLength = ClientConfigDefault::QUERY_STATS_MAX_QUERY_LENGTH;
 };
 
 } // namespace main
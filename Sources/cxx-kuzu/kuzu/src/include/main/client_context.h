@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 #include "common/arrow/arrow_result_config.h"
 #include "common/timer.h"
@@ -11,6 +12,7 @@
 #include "function/table/scan_replacement.h"
 #include "main/client_config.h"
 #include "main/prepared_statement_manager.h"
+#include "main/query_plan_cache.h"
 #include "main/query_result.h"
 #include "prepared_statement.h"
 
@@ -19,6 +21,7 @@ namespace common {
 class RandomEngine;
 class TaskScheduler;
 class ProgressBar;
+class Profiler;
 class VirtualFileSystem;
 } // namespace common
 
@@ -39,7 +42,10 @@ class StorageManager;
 }
 
 namespace processor {
+struct ExecutionContext;
 class ImportDB;
+class PhysicalPlan;
+class ResultStream;
 class WarningContext;
 } // namespace processor
 
@@ -60,7 +66,13 @@ class EmbeddedShell;
 struct ActiveQuery {
     explicit ActiveQuery();
     std::atomic<bool> interrupted;
+    // ID of the query being executed, and of the last query interrupted by its ID. Query IDs are
+    // never reused, so interrupting a query that has already finished doesn't affect later ones.
+    std::atomic<uint64_t> queryID;
+    std::atomic<uint64_t> interruptedQueryID;
     common::Timer timer;
+    // The text of the query being executed, if it was run through ClientContext::query.
+    std::string query;
 
     void reset();
 };
@@ -95,7 +107,13 @@ public:
 
     // Timer and timeout
     void interrupt() { activeQuery.interrupted = true; }
-    bool interrupted() const { return activeQuery.interrupted; }
+    // Interrupts the query with the given ID, if it is being executed or starts later.
+    void interruptQuery(uint64_t queryID) { activeQuery.interruptedQueryID = queryID; }
+    bool interrupted() const {
+        return activeQuery.interrupted ||
+               (activeQuery.queryID != common::INVALID_QUERY_ID &&
+                   activeQuery.queryID == activeQuery.interruptedQueryID);
+    }
     bool hasTimeout() const { return clientConfig.timeoutInMS != 0; }
     void setQueryTimeOut(uint64_t timeoutInMS);
     uint64_t getQueryTimeOut() const;
@@ -103,6 +121,11 @@ public:
     uint64_t getTimeoutRemainingInMS() const;
     void resetActiveQuery() { activeQuery.reset(); }
 
+    // Resets the context to the state of a new context, so that its connection can be reused by
+    // the connection pool of the database: the active transaction is rolled back, and the
+    // settings, prepared statements, cached plans, projected graphs and warnings are dropped.
+    void resetForReuse();
+
     // Parallelism
     void setMaxNumThreadForExec(uint64_t numThreads);
     uint64_t getMaxNumThreadForExec() const;
@@ -122,11 +145,21 @@ public:
     // Getters.
     std::string getDatabasePath() const;
     Database* getDatabase() const;
+    // Identifies the context among all contexts created by the process.
+    uint64_t getClientID() const { return clientID; }
+    const std::string& getActiveQueryString() const { return activeQuery.query; }
     AttachedKuzuDatabase* getAttachedDatabase() const;
 
     const CachedPreparedStatementManager& getCachedPreparedStatementManager() const {
         return cachedPreparedStatementManager;
     }
+    QueryPlanCache& getQueryPlanCache() { return queryPlanCache; }
+    const QueryPlanCache& getQueryPlanCache() const { return queryPlanCache; }
+    // Cardinalities of query subgraphs observed by the execution of the query that is re-planned.
+    const std::unordered_map<std::string, common::cardinality_t>& getObservedCardinalities() const {
+        return observedCardinalities;
+    }
+    uint64_t getNumReoptimizedExecutions() const { return numReoptimizedExecutions; }
 
     bool isInMemory() const;
 
@@ -163,6 +196,11 @@ public:
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> inputParams,
         std::optional<uint64_t> queryID = std::nullopt);
+    // Executes the prepared statement once per parameter set, in a single transaction. Returns the
+    // result of the last execution, or of the first failed one.
+    std::unique_ptr<QueryResult> executeMany(PreparedStatement* preparedStatement,
+        const std::vector<std::unordered_map<std::string, std::unique_ptr<common::Value>>>&
+            paramSets);
 
     struct TransactionHelper {
         enum class TransactionCommitAction : uint8_t {
@@ -186,6 +224,8 @@ public:
     };
 
 private:
+    void initClientConfig();
+
     void validateTransaction(bool readOnly, bool requireTransaction) const;
 
     std::vector<std::shared_ptr<parser::Statement>> parseQuery(std::string_view query);
@@ -209,11 +249,50 @@ private:
         return executeWithParams(preparedStatement, std::move(params), args...);
     }
 
+    std::unique_ptr<QueryResult> executeWithParamsNoLock(PreparedStatement* preparedStatement,
+        const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams,
+        std::optional<uint64_t> queryID, bool canStreamResult);
+
+    // The plan that the statements belong to is only given if the result of the statement can be
+    // streamed, as the thread executing a streamed query keeps the plan alive.
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         CachedPreparedStatement* cachedPreparedStatement,
-        std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+        std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {},
+        std::shared_ptr<CachedQueryPlan> plan = nullptr);
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    bool canUseQueryPlanCache() const;
+    std::unique_ptr<QueryResult> executeCachedPlanNoLock(std::shared_ptr<CachedQueryPlan> plan,
+        double lookupTime, std::optional<uint64_t> queryID, QueryConfig config,
+        const std::string* resultCacheKey);
+    // Results of auto-committed queries can be served by the query result cache of the database.
+    bool canUseQueryResultCache(QueryConfig config) const;
+    // Returns nullptr if the result of the query is not cached or is stale.
+    std::unique_ptr<QueryResult> getCachedQueryResultNoLock(const std::string& key);
+    // Executes the statement of the plan without streaming its result, which is added to the
+    // query result cache unless a transaction committed while the statement was executed.
+    std::unique_ptr<QueryResult> executeAndCacheResultNoLock(const std::string& key,
+        CachedQueryPlan& plan, std::optional<uint64_t> queryID, QueryConfig config);
+
+    bool canStreamResult(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement, QueryConfig config) const;
+    // Only read-only queries can be restarted with a new plan, as the work done by the abandoned
+    // plan is not undone.
+    bool canReoptimize(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement) const;
+    // Executes the plan, and executes it once more with a plan re-optimized for the observed
+    // cardinalities if the execution finds the estimated ones far off.
+    std::unique_ptr<QueryResult> executeAdaptivelyNoLock(PreparedStatement* preparedStatement,
+        CachedPreparedStatement* cachedStatement, processor::PhysicalPlan* physicalPlan,
+        processor::ExecutionContext* executionContext, QueryConfig config);
+    // Executes the plan on the streaming thread, within the transaction of the context, which is
+    // committed by the thread once the query has finished if it is an auto transaction.
+    std::unique_ptr<QueryResult> startStreamingNoLock(std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::shared_ptr<CachedQueryPlan> plan);
+    // Stops the query whose result is being streamed, if any, and waits for it to finish.
+    void closeActiveStreamNoLock();
 
     bool canExecuteWriteQuery() const;
 
@@ -221,12 +300,19 @@ private:
         const std::exception& e) const;
 
     std::mutex mtx;
+    uint64_t clientID;
     // Client side configurable settings.
     ClientConfig clientConfig;
     // Current query.
     ActiveQuery activeQuery;
     // Cache prepare statement.
     CachedPreparedStatementManager cachedPreparedStatementManager;
+    // Cache plans of queries.
+    QueryPlanCache queryPlanCache;
+    // Feedback of the execution of the current query to the planner.
+    std::unordered_map<std::string, common::cardinality_t> observedCardinalities;
+    // The number of executions that were re-planned with the cardinalities they observed.
+    uint64_t numReoptimizedExecutions = 0;
     // Transaction context.
     std::unique_ptr<transaction::TransactionContext> transactionContext;
     // Replace external object as pointer Value;
@@ -247,6 +333,9 @@ private:
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
     // Whether the query can access internal tables/sequences or not.
     bool useInternalCatalogEntry_ = false;
+    // Stream of the last streamed query result, and the thread executing the query.
+    std::shared_ptr<processor::ResultStream> activeStream;
+    std::thread streamingThread;
     // Whether the transaction should be rolled back on destruction. If the parent database is
     // closed, the rollback should be prevented or it will SEGFAULT.
     bool preventTransactionRollbackOnDestruction = false;
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <unordered_set>
+
+#include "async_query_result.h"
 #include "client_context.h"
+#include "common/arrow/arrow.h"
+#include "common/task_system/progress_bar.h"
 #include "database.h"
 #include "function/udf_function.h"
 
@@ -18,6 +23,7 @@ class Connection {
     friend class benchmark::Benchmark;
     friend class ConnectionExecuteAsyncWorker;
     friend class ConnectionQueryAsyncWorker;
+    friend class AsyncQueryResult;
 
 public:
     /**
@@ -47,6 +53,17 @@ public:
      */
     KUZU_API std::unique_ptr<QueryResult> query(std::string_view query);
 
+    /**
+     * @brief Submits a query to be executed on the threads of the database, without blocking the
+     * calling thread.
+     * @param query The query to execute.
+     * @param onDone Called on the thread that executed the query once its result is ready.
+     * @return the handle to wait or poll for the query result. The connection must outlive the
+     * query.
+     */
+    KUZU_API std::shared_ptr<AsyncQueryResult> queryAsync(std::string_view query,
+        std::function<void()> onDone = nullptr);
+
     KUZU_API std::unique_ptr<QueryResult> queryAsArrow(std::string_view query, int64_t chunkSize);
 
     /**
@@ -90,11 +107,37 @@ public:
      */
     KUZU_API std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> inputParams);
+    /**
+     * @brief Executes the given prepared statement once for each parameter set. All executions run
+     * in a single transaction, which is committed once they all succeed unless a transaction was
+     * already active. The first failed execution rolls back the transaction.
+     * @param preparedStatement The prepared statement to execute.
+     * @param paramSets The parameter sets, each mapping parameter names to values.
+     * @return the result of the last execution, or of the first failed one.
+     */
+    KUZU_API std::unique_ptr<QueryResult> executeMany(PreparedStatement* preparedStatement,
+        const std::vector<std::unordered_map<std::string, std::unique_ptr<common::Value>>>&
+            paramSets);
+    /**
+     * @brief Copies the record batches of an Arrow C stream into a table, as with COPY FROM. The
+     * columns of the stream schema are matched to the table properties by position.
+     * @param tableName The name of the table to copy into.
+     * @param stream The stream to copy from. It is read to its end but not released.
+     * @return the result of the copy.
+     */
+    KUZU_API std::unique_ptr<QueryResult> copyFromArrowStream(std::string_view tableName,
+        ArrowArrayStream* stream);
     /**
      * @brief interrupts all queries currently executing within this connection.
      */
     KUZU_API void interrupt();
 
+    /**
+     * @brief returns the progress of the query currently executing within this connection. It can
+     * be polled from other threads while the query executes.
+     */
+    KUZU_API common::QueryProgress getQueryProgress();
+
     /**
      * @brief sets the query timeout value of the current connection. A value of zero (the default)
      * disables the timeout.
@@ -155,6 +198,9 @@ private:
     Database* database;
     std::unique_ptr<ClientContext> clientContext;
     std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager;
+    // Arrow streams being copied from, which the scan replacement of this connection can bind.
+    std::mutex arrowStreamsMtx;
+    std::unordered_set<function::scan_replace_handle_t> arrowStreams;
 };
 
 } // namespace main
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace main {
+
+class Connection;
+class Database;
+
+/**
+ * ConnectionPool keeps the connections released to a database, so that acquiring a connection
+ * reuses an idle one instead of creating a connection and its client context for each request.
+ * A released connection is reset to the state of a new connection before it is reused. At most
+ * connection_pool_size idle connections are kept; the connections released beyond that are
+ * destroyed.
+ */
+class ConnectionPool {
+public:
+    explicit ConnectionPool(Database* database);
+    DELETE_COPY_AND_MOVE(ConnectionPool);
+    ~ConnectionPool();
+
+    std::unique_ptr<Connection> acquire();
+    void release(std::unique_ptr<Connection> connection);
+
+    uint64_t getNumIdleConnections();
+
+private:
+    std::mutex mtx;
+    Database* database;
+    std::vector<std::unique_ptr<Connection>> idleConnections;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -32,6 +32,13 @@ class StorageExtension;
 
 namespace main {
 class DatabaseManager;
+class AsyncQueryExecutor;
+class Connection;
+class ConnectionPool;
+class QueryStatsLog;
+class SlowQueryLog;
+class WorkloadRecorder;
+class QueryResultCache;
 /**
  * @brief Stores runtime configuration for creating or opening a Database
  */
@@ -62,12 +69,25 @@ struct KUZU_API SystemConfig {
      * the error occured.
      * @param enableChecksums If true, the database will use checksums to detect corruption in the
      * WAL file.
+     * @param directIO If true, the data file bypasses the OS page cache (O_DIRECT on Linux,
+     * F_NOCACHE on Apple platforms), so that pages are not cached twice by the buffer pool and the
+     * OS. The buffer pool should then be given most of the memory. Ignored on Windows.
+     * @param enableHugePages If true, the memory of the buffer pool is backed by transparent huge
+     * pages, which reduces page faults and TLB misses when a large buffer pool is warming up. Only
+     * supported on Linux, and ignored when transparent huge pages are disabled.
+     * @param warmUpBufferPool If true, the pages cached in the buffer pool are recorded at each
+     * checkpoint and when the database is closed, and are read back in the background when the
+     * database is opened again, so that the first queries don't have to fetch them one by one.
+     * @param enableTwoQueueEviction If true, pages read once by sequential scans are cached in a
+     * small probationary queue and evicted before the other pages, unless they are read again, so
+     * that large scans don't flush the working set out of the buffer pool.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
         bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
         bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */,
         bool forceCheckpointOnClose = true, bool throwOnWalReplayFailure = true,
-        bool enableChecksums = true
+        bool enableChecksums = true, bool directIO = false, bool enableHugePages = false,
+        bool warmUpBufferPool = false, bool enableTwoQueueEviction = false
 #if defined(__APPLE__)
         ,
         uint32_t threadQos = QOS_CLASS_DEFAULT
@@ -84,6 +104,10 @@ struct KUZU_API SystemConfig {
     bool forceCheckpointOnClose;
     bool throwOnWalReplayFailure;
     bool enableChecksums;
+    bool directIO;
+    bool enableHugePages;
+    bool warmUpBufferPool;
+    bool enableTwoQueueEviction;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
@@ -161,6 +185,31 @@ public:
 
     common::VirtualFileSystem* getVFS() { return vfs.get(); }
 
+    AsyncQueryExecutor* getAsyncQueryExecutor();
+
+    QueryStatsLog* getQueryStatsLog() { return queryStatsLog.get(); }
+
+    SlowQueryLog* getSlowQueryLog() { return slowQueryLog.get(); }
+
+    WorkloadRecorder* getWorkloadRecorder() { return workloadRecorder.get(); }
+
+    QueryResultCache* getQueryResultCache() { return queryResultCache.get(); }
+
+    /**
+     * @brief Returns an idle connection from the connection pool of the database, or creates a
+     * connection if the pool is empty. The connection should be returned with releaseConnection()
+     * once the caller is done with it.
+     * @return A connection in the state of a newly created connection.
+     */
+    KUZU_API std::unique_ptr<Connection> acquireConnection();
+    /**
+     * @brief Returns a connection to the connection pool of the database. The connection is reset
+     * (its active transaction is rolled back and its settings and prepared statements dropped)
+     * and kept for reuse, unless the pool already holds connection_pool_size idle connections.
+     * @param connection The connection to return, which must be connected to this database.
+     */
+    KUZU_API void releaseConnection(std::unique_ptr<Connection> connection);
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -198,6 +247,15 @@ private:
     std::vector<std::unique_ptr<extension::BinderExtension>> binderExtensions;
     std::vector<std::unique_ptr<extension::PlannerExtension>> plannerExtensions;
     std::vector<std::unique_ptr<extension::MapperExtension>> mapperExtensions;
+    // Created when the first query is submitted through Connection::queryAsync.
+    std::mutex asyncQueryExecutorMtx;
+    std::unique_ptr<AsyncQueryExecutor> asyncQueryExecutor;
+    std::unique_ptr<ConnectionPool> connectionPool;
+    std::unique_ptr<QueryStatsLog> queryStatsLog;
+    std::unique_ptr<SlowQueryLog> slowQueryLog;
+    std::unique_ptr<WorkloadRecorder> workloadRecorder;
+    // Destroyed before the memory manager, which holds the tables of the cached results.
+    std::unique_ptr<QueryResultCache> queryResultCache;
 };
 
 } // namespace main
@@ -54,6 +54,8 @@ struct ExtensionOption final : Option {
 };
 
 struct DBConfig {
+    static constexpr uint64_t DEFAULT_CONNECTION_POOL_SIZE = 8;
+
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
@@ -62,10 +64,18 @@ struct DBConfig {
     bool enableMultiWrites;
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
+    uint64_t walGroupCommitDelayInMicros;
     bool forceCheckpointOnClose;
     bool throwOnWalReplayFailure;
     bool enableChecksums;
     bool enableSpillingToDisk;
+    bool enablePKBloomFilter;
+    uint64_t connectionPoolSize;
+    bool directIO;
+    bool enableHugePages;
+    bool warmUpBufferPool;
+    bool enableTwoQueueEviction;
+    uint64_t queryResultCacheSize;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
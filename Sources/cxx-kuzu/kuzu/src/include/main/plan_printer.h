@@ -102,6 +102,12 @@ struct PlanPrinter {
         common::Profiler* profiler);
     static std::ostringstream printPlanToOstream(const processor::PhysicalPlan* physicalPlan,
         common::Profiler* profiler);
+    // Plan with the profiled attributes of each operator (including per thread counts) and the
+    // timelines of the tasks of every pipeline.
+    static nlohmann::json printProfileToJson(const processor::PhysicalPlan* physicalPlan,
+        common::Profiler* profiler);
+    static std::ostringstream printPipelinesToOstream(const processor::PhysicalPlan* physicalPlan,
+        common::Profiler* profiler);
     static std::string getOperatorName(const processor::PhysicalOperator* physicalOperator);
     static std::string getOperatorParams(const processor::PhysicalOperator* physicalOperator);
 
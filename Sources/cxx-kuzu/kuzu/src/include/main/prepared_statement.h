@@ -28,9 +28,16 @@ namespace main {
 // Prepared statement cached in client context and NEVER serialized to client side.
 struct CachedPreparedStatement {
     bool useInternalCatalogEntry = false;
+    // Whether the statement calls no function that isn't deterministic.
+    bool isDeterministic = true;
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // The text of the statement, if it was prepared through ClientContext::prepareWithParams.
+    std::string query;
+    // The cardinalities observed by the executions that re-planned the statement, which the
+    // planner keeps using for the subgraphs it estimated wrong.
+    std::unordered_map<std::string, common::cardinality_t> observedCardinalities;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
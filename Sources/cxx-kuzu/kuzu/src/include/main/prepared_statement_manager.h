@@ -20,6 +20,9 @@ public:
 
     CachedPreparedStatement* getCachedStatement(const std::string& name) const;
 
+    // Names keep increasing, so that statements prepared before clearing can't be executed.
+    void clear();
+
 private:
     std::mutex mtx;
     uint32_t currentIdx = 0;
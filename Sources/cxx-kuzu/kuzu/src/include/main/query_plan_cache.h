@@ -0,0 +1,67 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace main {
+
+class PreparedStatement;
+struct CachedPreparedStatement;
+
+struct CachedQueryPlan {
+    std::unique_ptr<PreparedStatement> preparedStatement;
+    std::unique_ptr<CachedPreparedStatement> cachedStatement;
+    // The catalog that the query was bound against, and its change epoch at that time.
+    const catalog::Catalog* catalog;
+    uint64_t catalogChangeEpoch;
+
+    CachedQueryPlan(std::unique_ptr<PreparedStatement> preparedStatement,
+        std::unique_ptr<CachedPreparedStatement> cachedStatement, const catalog::Catalog* catalog,
+        uint64_t catalogChangeEpoch);
+    ~CachedQueryPlan();
+};
+
+// The plans of the queries run through ClientContext::query, keyed by the query text, so that
+// repeating a query skips parsing, binding, planning and optimization. A plan is dropped once the
+// catalog has changed since it was bound.
+class QueryPlanCache {
+public:
+    QueryPlanCache();
+    ~QueryPlanCache();
+
+    // Returns nullptr if the query is not cached or was bound against an older catalog.
+    std::shared_ptr<CachedQueryPlan> getPlan(const std::string& query,
+        const catalog::Catalog* catalog, uint64_t catalogChangeEpoch);
+    // Adds the plan, evicting the least recently used plans beyond capacity.
+    void addPlan(const std::string& query, std::shared_ptr<CachedQueryPlan> plan,
+        uint64_t capacity);
+    void clear();
+
+    uint64_t getNumPlans() const { return plans.size(); }
+    uint64_t getNumHits() const { return numHits; }
+    uint64_t getNumMisses() const { return numMisses; }
+
+    // Only read-only queries whose logical plans are not modified when they are mapped to
+    // physical plans can be cached, so that the plan can be mapped again on every execution.
+    static bool canCache(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement);
+
+private:
+    using lru_list_t = std::list<std::pair<std::string, std::shared_ptr<CachedQueryPlan>>>;
+
+    // Most recently used plans are at the front.
+    lru_list_t lruList;
+    std::unordered_map<std::string, lru_list_t::iterator> plans;
+    uint64_t numHits;
+    uint64_t numMisses;
+};
+
+} // namespace main
+} // namespace kuzu
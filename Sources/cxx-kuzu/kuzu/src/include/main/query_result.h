@@ -17,6 +17,7 @@ namespace main {
 enum class QueryResultType {
     FTABLE = 0,
     ARROW = 1,
+    STREAMING = 2,
 };
 
 /**
@@ -171,9 +172,10 @@ protected:
 
     QueryResultType type;
 
-    bool success = true;
+    // Mutable, as a streaming result only learns whether its query has succeeded while it's read.
+    mutable bool success = true;
 
-    std::string errMsg;
+    mutable std::string errMsg;
 
     std::vector<std::string> columnNames;
 
@@ -3,9 +3,14 @@
 #include "main/query_result.h"
 
 namespace kuzu {
+namespace common {
+class ArrowRowBatch;
+} // namespace common
+
 namespace processor {
 class FactorizedTable;
 class FactorizedTableIterator;
+class FactorizedTuple;
 } // namespace processor
 
 namespace main {
@@ -35,11 +40,28 @@ public:
 
     std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
 
+    /**
+     * @return whether there are more factorized tuples to read.
+     */
+    KUZU_API bool hasNextFactorizedTuple() const;
+    /**
+     * @return next tuple of the query result without expanding it into flat tuples. Factorized
+     * tuples are read independently of getNext(), and resetIterator() resets both. Note that all
+     * calls reuse the same FactorizedTuple object, whose contents are overwritten by the next call.
+     */
+    KUZU_API std::shared_ptr<processor::FactorizedTuple> getNextFactorizedTuple();
+
     const processor::FactorizedTable& getFactorizedTable() const { return *table; }
+    std::shared_ptr<processor::FactorizedTable> shareFactorizedTable() const { return table; }
+
+private:
+    void fillArrowRowBatchFromFlatTable(common::ArrowRowBatch& rowBatch, int64_t chunkSize);
 
 private:
     std::shared_ptr<processor::FactorizedTable> table;
     std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    std::shared_ptr<processor::FactorizedTuple> factorizedTuple;
+    uint64_t nextFactorizedTupleIdx = 0;
 };
 
 } // namespace main
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <deque>
+
+#include "main/query_result.h"
+
+namespace kuzu {
+namespace processor {
+class FactorizedTable;
+class FactorizedTableIterator;
+class ResultStream;
+} // namespace processor
+
+namespace main {
+
+/**
+ * StreamingQueryResult reads the tuples of a query while the query is still being executed, from
+ * the chunks pushed by its result collector into a ResultStream (see the streaming_result_buffer
+ * setting). The result can only be iterated once. Getting the number of tuples reads the rest of
+ * the result ahead into memory. If the query fails after its result has been returned, hasNext()
+ * returns false and the error is reported by isSuccess() and getErrorMessage(). Destroying the
+ * result before reading all tuples stops the query.
+ */
+class StreamingQueryResult : public QueryResult {
+    static constexpr QueryResultType type_ = QueryResultType::STREAMING;
+
+public:
+    explicit StreamingQueryResult(std::shared_ptr<processor::ResultStream> stream);
+    ~StreamingQueryResult() override;
+
+    uint64_t getNumTuples() const override;
+
+    bool hasNext() const override;
+
+    std::shared_ptr<processor::FlatTuple> getNext() override;
+
+    void resetIterator() override;
+
+    std::string toString() const override;
+
+    bool hasNextArrowChunk() override;
+
+    std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
+
+private:
+    // Pops chunks from the stream until one has tuples left to read. Returns false at the end of
+    // the stream, or if the query has failed.
+    bool fetchChunk() const;
+    std::unique_ptr<processor::FactorizedTable> popChunk() const;
+
+private:
+    std::shared_ptr<processor::ResultStream> stream;
+    // The chunk being read.
+    mutable std::unique_ptr<processor::FactorizedTable> table;
+    mutable std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    // Chunks popped from the stream by getNumTuples() before they are read.
+    mutable std::deque<std::unique_ptr<processor::FactorizedTable>> readAheadTables;
+    mutable uint64_t numPoppedTuples = 0;
+    mutable bool endOfStream = false;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace common {
+class Value;
+} // namespace common
+
+namespace processor {
+class FactorizedTable;
+} // namespace processor
+
+namespace main {
+
+class PreparedStatement;
+struct CachedPreparedStatement;
+struct ClientConfig;
+
+struct CachedQueryResult {
+    std::shared_ptr<processor::FactorizedTable> table;
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    // The catalog that the query was bound against, and its change epoch at that time.
+    const catalog::Catalog* catalog;
+    uint64_t catalogChangeEpoch;
+    // Timestamp of the last commit that the query saw.
+    common::transaction_t dataVersion;
+    uint64_t memoryUsage;
+
+    CachedQueryResult(std::shared_ptr<processor::FactorizedTable> table,
+        std::vector<std::string> columnNames, std::vector<common::LogicalType> columnTypes,
+        const catalog::Catalog* catalog, uint64_t catalogChangeEpoch,
+        common::transaction_t dataVersion);
+    ~CachedQueryResult();
+};
+
+// The results of the read-only queries run by any connection to the database, keyed by the query
+// text and the values of its parameters, so that repeating a query skips its execution. A result
+// is dropped once a transaction has committed since the query was executed, or the catalog has
+// changed since it was bound. The tables of the results are held in memory of the buffer manager,
+// and the least recently used results are evicted beyond the capacity, which is in bytes.
+class QueryResultCache {
+public:
+    QueryResultCache();
+    ~QueryResultCache();
+
+    // Returns nullptr if the query is not cached or its result is stale.
+    std::shared_ptr<CachedQueryResult> getResult(const std::string& key,
+        const catalog::Catalog* catalog, uint64_t catalogChangeEpoch,
+        common::transaction_t dataVersion);
+    // Adds the result, evicting the least recently used results beyond capacity. A result larger
+    // than the capacity is not added.
+    void addResult(const std::string& key, std::shared_ptr<CachedQueryResult> result,
+        uint64_t capacity);
+    // Evicts the least recently used results beyond capacity.
+    void evict(uint64_t capacity);
+    void clear();
+
+    uint64_t getNumResults() const;
+    uint64_t getMemoryUsage() const;
+    uint64_t getNumHits() const;
+    uint64_t getNumMisses() const;
+
+    // Only the results of read-only queries which return the same result on the same data can be
+    // cached, i.e. queries calling neither non-deterministic functions nor table functions, which
+    // may read files or the state of the client.
+    static bool canCache(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement);
+    // The key includes the settings of the client which change the results of queries.
+    static std::string getKey(const std::string& query, const ClientConfig& clientConfig,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters);
+
+private:
+    using lru_list_t = std::list<std::pair<std::string, std::shared_ptr<CachedQueryResult>>>;
+
+    void removeNoLock(lru_list_t::iterator it);
+    void evictNoLock(uint64_t capacity);
+
+private:
+    mutable std::mutex mtx;
+    // Most recently used results are at the front.
+    lru_list_t lruList;
+    std::unordered_map<std::string, lru_list_t::iterator> results;
+    uint64_t memoryUsage;
+    uint64_t numHits;
+    uint64_t numMisses;
+};
+
+} // namespace main
+} // namespace kuzu
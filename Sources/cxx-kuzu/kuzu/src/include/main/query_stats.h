@@ -0,0 +1,79 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage/buffer_manager/file_io_stats.h"
+
+namespace kuzu {
+namespace main {
+
+struct OperatorStats {
+    std::string name;
+    uint64_t numOutputTuples;
+    // Excluding the time of the child operator.
+    double executionTimeMS;
+    // Peak memory (bytes) of the buffers allocated by the pipeline of the operator. Only sinks of
+    // pipelines allocate memory.
+    uint64_t peakMemory;
+};
+
+struct QueryStats {
+    uint64_t queryID;
+    std::string query;
+    double executionTimeMS;
+    uint64_t peakMemory;
+    // The operators of the physical plan, in pre-order.
+    std::vector<OperatorStats> operators;
+};
+
+// The statistics of the most recently executed queries of a database, shown by
+// CALL QUERY_STATS(). Queries are only added once, when they finish, so the lock is not contended.
+class QueryStatsLog {
+public:
+    static constexpr uint64_t CAPACITY = 64;
+
+    void addQuery(QueryStats stats);
+    // Oldest queries first.
+    std::vector<QueryStats> getQueries() const;
+
+private:
+    mutable std::mutex mtx;
+    std::deque<QueryStats> queries;
+};
+
+struct SlowQuery {
+    uint64_t queryID;
+    std::string query;
+    // Names and types of the parameters. Their values are not kept as they may hold user data.
+    std::string parameters;
+    double compilingTimeMS;
+    double executionTimeMS;
+    uint64_t peakMemory;
+    // Accesses of the buffer manager to all files while the query ran, including those made by
+    // concurrent queries.
+    storage::FileIOStatsSnapshot ioStats;
+    // The physical plan with the time spent in and the tuples output by each operator, as printed
+    // by PROFILE.
+    std::string plan;
+};
+
+// The most recent queries of a database whose compiling and execution took longer than
+// slow_query_threshold_ms, shown by CALL SLOW_QUERIES().
+class SlowQueryLog {
+public:
+    static constexpr uint64_t CAPACITY = 64;
+
+    void addQuery(SlowQuery query);
+    // Oldest queries first.
+    std::vector<SlowQuery> getQueries() const;
+
+private:
+    mutable std::mutex mtx;
+    std::deque<SlowQuery> queries;
+};
+
+} // namespace main
+} // namespace kuzu
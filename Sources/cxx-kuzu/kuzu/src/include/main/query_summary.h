@@ -16,6 +16,8 @@ namespace main {
  */
 struct PreparedSummary { // NOLINT(*-pro-type-member-init)
     double compilingTime = 0;
+    // Part of the compiling time spent on planning and optimizing the query.
+    double planningTime = 0;
     common::StatementType statementType;
 };
 
@@ -32,6 +34,11 @@ public:
      * @return query compiling time in milliseconds.
      */
     KUZU_API double getCompilingTime() const;
+    /**
+     * @return time spent on planning and optimizing the query in milliseconds, which is part of
+     * the compiling time.
+     */
+    KUZU_API double getPlanningTime() const;
     /**
      * @return query execution time in milliseconds.
      */
@@ -110,6 +110,25 @@ struct CheckpointThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+// Maximum time, in microseconds, a committing transaction waits for others to join its WAL sync.
+struct WALGroupCommitDelaySetting {
+    static constexpr auto name = "wal_group_commit_delay";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+// Makes the WAL syncs of commits fail, to test how the database handles them. Only available
+// with runtime checks enabled.
+struct DebugFailWALSyncSetting {
+    static constexpr auto name = "debug_fail_wal_sync";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+#endif
+
 struct AutoCheckpointSetting {
     static constexpr auto name = "auto_checkpoint";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -145,5 +164,166 @@ struct EnableInternalCatalogSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct EvictionPolicySetting {
+    static constexpr auto name = "eviction_policy";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct SchedulingClassSetting {
+    static constexpr auto name = "scheduling_class";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct CSRCacheRelTablesSetting {
+    static constexpr auto name = "csr_cache_rel_tables";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ProjectedGraphMemoryLimitSetting {
+    static constexpr auto name = "projected_graph_memory_limit";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct CopyMemoryBudgetSetting {
+    static constexpr auto name = "copy_memory_budget";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Memory (bytes) that a query can allocate for its intermediate results. 0 disables the limit.
+struct QueryMemoryLimitSetting {
+    static constexpr auto name = "query_memory_limit";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct QueryPlanCacheSizeSetting {
+    static constexpr auto name = "query_plan_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Number of tuples buffered ahead of the client when streaming query results. 0 disables streaming.
+struct StreamingResultBufferSetting {
+    static constexpr auto name = "streaming_result_buffer";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Ratio of observed to estimated build side tuples that makes a query be re-planned. 0 disables
+// re-optimization.
+struct AdaptiveReoptimizationThresholdSetting {
+    static constexpr auto name = "adaptive_reoptimization_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Number of enumerated plans after which the joins of a query graph are ordered greedily. 0
+// disables the limit.
+struct JoinOrderPlanningBudgetSetting {
+    static constexpr auto name = "join_order_planning_budget";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Number of query graph nodes from which joins are ordered greedily. 0 disables greedy ordering.
+struct JoinOrderGreedyThresholdSetting {
+    static constexpr auto name = "join_order_greedy_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Format of the output of PROFILE, either TEXT or JSON.
+struct ProfileFormatSetting {
+    static constexpr auto name = "profile_format";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// File to which a Chrome trace of the execution is written when tracing stops. Tracing is enabled
+// while the setting is not empty.
+struct TraceFileSetting {
+    static constexpr auto name = "trace_file";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Queries taking at least this long (milliseconds) are shown by CALL SLOW_QUERIES(). 0 disables it.
+struct SlowQueryThresholdSetting {
+    static constexpr auto name = "slow_query_threshold_ms";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Maximum length of the query text of the queries shown by CALL QUERY_STATS(). 0 keeps no text.
+struct QueryStatsMaxQueryLengthSetting {
+    static constexpr auto name = "query_stats_max_query_length";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// File to which the queries of all connections of the database are appended, with their parameters
+// and timing, so that the workload can be replayed. Recording is enabled while the setting is not
+// empty.
+struct WorkloadRecordFileSetting {
+    static constexpr auto name = "workload_record_file";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Maximum number of idle connections the connection pool of the database keeps for reuse.
+struct ConnectionPoolSizeSetting {
+    static constexpr auto name = "connection_pool_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Maintain bloom filters over primary key indexes at checkpoint, to skip lookups of missing keys.
+struct PKBloomFilterSetting {
+    static constexpr auto name = "pk_bloom_filter";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Number of tuples that a pipeline scanning a node table is estimated to produce per thread that it
+// uses. Pipelines estimated to need a single thread run on the thread of the query. 0 disables it.
+struct PipelineTuplesPerThreadSetting {
+    static constexpr auto name = "pipeline_tuples_per_thread";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+// Number of bytes of the results of read-only queries that the database keeps, so that repeated
+// queries skip their execution until the next commit. 0 disables the cache.
+struct QueryResultCacheSizeSetting {
+    static constexpr auto name = "query_result_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 } // namespace main
 } // namespace kuzu
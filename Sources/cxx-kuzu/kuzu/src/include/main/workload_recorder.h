@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace kuzu {
+namespace common {
+class FileInfo;
+class Value;
+} // namespace common
+
+namespace main {
+class ClientContext;
+
+// Records the queries run through the connections of a database, so that the workload can be
+// replayed against a copy of the database with the same concurrency and timing. Each query is
+// appended to the workload file as a line of JSON once it returns:
+//   {"connection": 1, "start_us": 0, "duration_us": 120, "query": "...",
+//    "parameters": {"id": {"type": "INT64", "value": "42"}}, "success": true}
+// Unlike the slow query log, parameter values are recorded, since the replay needs them.
+class WorkloadRecorder {
+public:
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    // Stops the current recording, if any, and starts appending queries to the given file.
+    void start(const std::string& path, ClientContext* context);
+    void stop();
+
+    std::string getFilePath();
+
+    // Time since the recording started.
+    uint64_t getTimeInMicros() const;
+
+    void recordQuery(const ClientContext& context, const std::string& query,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameters,
+        uint64_t startInMicros, bool success);
+
+private:
+    void stopNoLock();
+
+private:
+    std::atomic<bool> enabled{false};
+    std::mutex mtx;
+    std::string filePath;
+    std::unique_ptr<common::FileInfo> fileInfo;
+    uint64_t fileOffset = 0;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+};
+
+} // namespace main
+} // namespace kuzu
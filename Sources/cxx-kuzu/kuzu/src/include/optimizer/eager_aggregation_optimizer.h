@@ -0,0 +1,31 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer pre-aggregates the larger side of an inner hash join below an aggregation whose
+// keys all come from the other side. E.g. for
+//   MATCH (u:User)-[:PURCHASED]->(p:Product) RETURN p.category, COUNT(*)
+// the purchases are counted per product before being joined with the products, and the counts
+// are summed per category after the join, so that the join outputs one tuple per product instead
+// of one per purchase.
+// Only COUNT(*) is rewritten (into the sum of the partial counts). Other aggregates must not be
+// affected by the duplication of their input, i.e. MIN, MAX or DISTINCT aggregates on the other
+// side.
+// The rewrite is skipped if the join keys are unique on the larger side, e.g. if it scans the
+// nodes it is joined on, since there is nothing to pre-aggregate then.
+class EagerAggregationOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitAggregate(planner::LogicalOperator* op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
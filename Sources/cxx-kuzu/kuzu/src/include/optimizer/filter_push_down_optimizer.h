@@ -6,6 +6,9 @@ namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace planner {
+class LogicalScanNodeTable;
+}
 namespace optimizer {
 
 struct PredicateSet {
@@ -56,9 +59,16 @@ private:
     std::shared_ptr<planner::LogicalOperator> visitCrossProductReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
 
-    // Push FILTER into SCAN_NODE_TABLE, and turn index lookup into INDEX_SCAN.
+    // Push FILTER into SCAN_NODE_TABLE, and turn index lookup into INDEX_SCAN. Properties which a
+    // selective FILTER does not need are looked up above it instead of being scanned.
     std::shared_ptr<planner::LogicalOperator> visitScanNodeTableReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
+    // Turns the scan into a lookup in a sorted index if comparisons of an indexed property with
+    // constants are selective enough. The comparisons are kept, since the index gives candidates.
+    void tryRewriteSortedIndexScan(planner::LogicalScanNodeTable& scan);
+    // Removes from the scan and returns the properties to look up after the remaining predicates.
+    binder::expression_vector popLateMaterializedProperties(
+        planner::LogicalScanNodeTable& scan);
     // Push Filter into EXTEND.
     std::shared_ptr<planner::LogicalOperator> visitExtendReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
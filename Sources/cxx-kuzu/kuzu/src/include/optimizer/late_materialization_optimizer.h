@@ -0,0 +1,29 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer stops hash joins from materializing string properties of their build side when
+// most build tuples are not expected to match. E.g. for
+//   MATCH (a:Doc)-[:CITES]->(b:Doc) WHERE a.year = 2020 RETURN b.text
+// planned with b on the build side, b.text is no longer scanned and copied into the hash table.
+// It is looked up by node ID for the joined tuples instead. Only builds which scan a single node
+// table below filters are rewritten, and only for properties that the build side and the join
+// conditions do not use.
+class LateMaterializationOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+    std::shared_ptr<planner::LogicalOperator> visitHashJoinReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
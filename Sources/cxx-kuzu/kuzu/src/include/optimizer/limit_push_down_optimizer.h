@@ -13,6 +13,8 @@ public:
 
 private:
     void visitOperator(planner::LogicalOperator* op);
+    // Stops the node table scan at the bottom of a pipeline from prefetching pages.
+    static void disablePrefetch(planner::LogicalOperator* op);
 
 private:
     common::offset_t skipNumber;
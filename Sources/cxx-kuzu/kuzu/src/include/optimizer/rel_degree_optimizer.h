@@ -0,0 +1,28 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer answers COUNT(*) over an extend whose neighbours are not used from the degrees of
+// the bound nodes. E.g. for
+//   MATCH (a:User)-[:FOLLOWS]->(b:User) RETURN a.name, COUNT(*)
+// the extend is replaced by a REL_DEGREE operator which reads the number of rels of each user
+// from CSR list lengths, and COUNT(*) adds up the degrees instead of counting the neighbours.
+// Only extends of a single rel table in a single direction, without properties or predicates,
+// are rewritten. Other aggregates must not be affected by the removal of the duplicates of their
+// input, i.e. MIN, MAX or DISTINCT aggregates on the bound side.
+class RelDegreeOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitAggregate(planner::LogicalOperator* op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <optional>
+#include <unordered_set>
+
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace planner {
+class CardinalityEstimator;
+} // namespace planner
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace optimizer {
+
+/* Different parts of a query may plan the same pattern independently.
+ * E.g. MATCH (a:person)-[:knows]->(b:person) RETURN b.ID
+ *      UNION ALL
+ *      MATCH (a:person)-[:knows]->(b:person) RETURN a.ID
+ * scans and extends knows twice. This optimizer finds identical sub-plans of scans, extends,
+ * filters and inner hash joins, materializes each of them once through a shared accumulate and
+ * replaces every occurrence with a scan of the materialized result.
+ * Materializing flattens the result of the sub-plan, so it is only shared if computing it once and
+ * scanning the flat result from every occurrence is estimated to be cheaper than computing it for
+ * each occurrence. Sub-plans below a LIMIT are never shared, because the occurrence would then
+ * compute its whole result instead of stopping after the limit.
+ */
+class SharedSubplanOptimizer {
+    struct Subplan {
+        std::shared_ptr<planner::LogicalOperator> op;
+        planner::LogicalOperator* parent;
+        uint32_t childIdx;
+        std::string signature;
+        uint64_t numOperators;
+        bool hasJoin;
+        // Estimated number of tuples produced by all operators of the sub-plan.
+        double cost;
+    };
+
+public:
+    SharedSubplanOptimizer(const planner::CardinalityEstimator& cardinalityEstimator,
+        const transaction::Transaction* transaction)
+        : cardinalityEstimator{cardinalityEstimator}, transaction{transaction} {}
+
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void collectSemiMaskTargets(const planner::LogicalOperator* op);
+    // Returns the index of the sub-plan rooted at the child in subplans if it can be shared.
+    std::optional<uint64_t> visitChild(planner::LogicalOperator* parent, uint32_t childIdx,
+        bool belowLimit);
+
+    // Operators that can be part of a shared sub-plan are described by a signature, which is
+    // equal for two operators computing the same result from their children.
+    std::optional<std::string> getSignature(const planner::LogicalOperator& op) const;
+
+    static bool isCheaperToShare(const std::vector<const Subplan*>& occurrences);
+    void share(const std::vector<const Subplan*>& occurrences);
+    void collectReplacedOps(const planner::LogicalOperator* op);
+
+private:
+    const planner::CardinalityEstimator& cardinalityEstimator;
+    const transaction::Transaction* transaction;
+    std::unordered_set<const planner::LogicalOperator*> semiMaskTargets;
+    std::vector<Subplan> subplans;
+    // Operators that have been replaced by a shared scan, including the ones below them.
+    std::unordered_set<const planner::LogicalOperator*> replacedOps;
+};
+
+} // namespace optimizer
+} // namespace kuzu
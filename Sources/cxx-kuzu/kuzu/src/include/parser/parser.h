@@ -18,6 +18,10 @@ class Parser {
 public:
     KUZU_API static std::vector<std::shared_ptr<Statement>> parseQuery(std::string_view query,
         std::vector<extension::TransformerExtension*> transformerExtensions = {});
+
+    // Parses a few common query shapes once per process, so that the prediction DFA shared by all
+    // parsers is populated before the first user query is parsed.
+    static void warmUp();
 };
 
 } // namespace parser
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <optional>
+
 #include "binder/query/query_graph.h"
 #include "planner/operator/logical_plan.h"
+#include "storage/stats/column_histogram.h"
 #include "storage/stats/table_stats.h"
 
 namespace kuzu {
@@ -24,6 +27,7 @@ public:
 
     void init(const binder::QueryGraph& queryGraph);
     KUZU_API void init(const binder::NodeExpression& node);
+    void init(const binder::Expression& nodeID, const std::vector<common::table_id_t>& tableIDs);
 
     void rectifyCardinality(const binder::Expression& nodeID, cardinality_t card);
 
@@ -43,6 +47,12 @@ public:
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
     cardinality_t multiply(double extensionRate, cardinality_t card) const;
+    // Expected number of rels of a bound node that is reached through a join, i.e. the expected
+    // length of the adjacency lists of the rel that an intersect reads. Degree skew collected by
+    // CALL analyze() makes it larger than the average degree. Returns std::nullopt if a table of
+    // the rel has not been analyzed.
+    std::optional<double> getJoinedNodeDegree(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
 
 private:
     cardinality_t getNodeIDDom(const std::string& nodeIDName) const;
@@ -50,11 +60,15 @@ private:
         const std::vector<common::table_id_t>& tableIDs) const;
     cardinality_t getNumRels(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
+    std::optional<double> getHistogramSelectivity(const binder::Expression& predicate) const;
 
 private:
     main::ClientContext* context;
     // TODO(Guodong): Extend this to cover rel tables.
     std::unordered_map<common::table_id_t, storage::TableStats> nodeTableStats;
+    // Only for the tables that have been analyzed.
+    std::unordered_map<common::table_id_t, std::shared_ptr<const storage::TableHistograms>>
+        nodeTableHistograms;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
     std::unordered_map<std::string, cardinality_t> nodeIDName2dom;
 };
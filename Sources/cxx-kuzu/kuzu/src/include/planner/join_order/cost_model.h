@@ -16,8 +16,10 @@ public:
         const LogicalPlan& probe, const LogicalPlan& build);
     static uint64_t computeMarkJoinCost(const binder::expression_vector& joinNodeIDs,
         const LogicalPlan& probe, const LogicalPlan& build);
+    // buildDegrees[i] is the expected length of the adjacency lists read from the i-th build side.
+    // It is empty if the degrees are unknown, i.e. the rel tables have not been analyzed.
     static uint64_t computeIntersectCost(const LogicalPlan& probePlan,
-        const std::vector<LogicalPlan>& buildPlans);
+        const std::vector<LogicalPlan>& buildPlans, const std::vector<double>& buildDegrees);
 };
 
 } // namespace planner
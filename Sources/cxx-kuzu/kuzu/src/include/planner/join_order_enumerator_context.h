@@ -11,8 +11,8 @@ class JoinOrderEnumeratorContext {
 
 public:
     JoinOrderEnumeratorContext()
-        : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+        : currentLevel{0}, maxLevel{0}, numPlans{0}, subPlansTable{std::make_unique<SubPlansTable>()},
+          queryGraph{nullptr}, observedCardinalities{nullptr} {}
     DELETE_COPY_DEFAULT_MOVE(JoinOrderEnumeratorContext);
 
     void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates);
@@ -25,9 +25,13 @@ public:
     const std::vector<LogicalPlan>& getPlans(const binder::SubqueryGraph& subqueryGraph) const {
         return subPlansTable->getSubgraphPlans(subqueryGraph);
     }
-    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan) {
-        subPlansTable->addPlan(subqueryGraph, std::move(plan));
-    }
+    // The estimated cardinality of the plan is replaced by the observed one, if the subgraph was
+    // observed by an earlier execution of the query.
+    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
+
+    // Names the subgraph by its variables, such that it can be recognized when the same query is
+    // planned again.
+    static std::string getSubgraphKey(const binder::SubqueryGraph& subqueryGraph);
 
     binder::SubqueryGraph getEmptySubqueryGraph() const {
         return binder::SubqueryGraph(*queryGraph);
@@ -43,9 +47,13 @@ private:
 
     uint32_t currentLevel;
     uint32_t maxLevel;
+    // Number of plans enumerated for the current query graph, which bounds the planning effort
+    // independently of the machine load.
+    uint64_t numPlans;
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     const binder::QueryGraph* queryGraph;
+    const std::unordered_map<std::string, common::cardinality_t>* observedCardinalities;
 };
 
 } // namespace planner
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "binder/expression/rel_expression.h"
+#include "common/enums/extend_direction.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalRelDegree replaces an extend whose neighbours are only counted. It computes the number of
+// rels of each bound node from CSR list lengths and drops bound nodes without any rel, so that an
+// aggregate above sums up degrees instead of counting neighbours.
+class LogicalRelDegree final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::REL_DEGREE;
+
+public:
+    LogicalRelDegree(std::shared_ptr<binder::NodeExpression> boundNode,
+        std::shared_ptr<binder::NodeExpression> nbrNode, std::shared_ptr<binder::RelExpression> rel,
+        common::ExtendDirection direction, std::shared_ptr<binder::Expression> degree,
+        std::shared_ptr<LogicalOperator> child, common::cardinality_t cardinality = 0)
+        : LogicalOperator{type_, std::move(child)}, boundNode{std::move(boundNode)},
+          nbrNode{std::move(nbrNode)}, rel{std::move(rel)}, direction{direction},
+          degree{std::move(degree)} {
+        this->cardinality = cardinality;
+    }
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override { return rel->toString(); }
+
+    std::shared_ptr<binder::NodeExpression> getBoundNode() const { return boundNode; }
+    std::shared_ptr<binder::NodeExpression> getNbrNode() const { return nbrNode; }
+    std::shared_ptr<binder::RelExpression> getRel() const { return rel; }
+    common::ExtendDirection getDirection() const { return direction; }
+    std::shared_ptr<binder::Expression> getDegree() const { return degree; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalRelDegree>(boundNode, nbrNode, rel, direction, degree,
+            children[0]->copy(), cardinality);
+    }
+
+private:
+    std::shared_ptr<binder::NodeExpression> boundNode;
+    std::shared_ptr<binder::NodeExpression> nbrNode;
+    std::shared_ptr<binder::RelExpression> rel;
+    common::ExtendDirection direction;
+    std::shared_ptr<binder::Expression> degree;
+};
+
+} // namespace planner
+} // namespace kuzu
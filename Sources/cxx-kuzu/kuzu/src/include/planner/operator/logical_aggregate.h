@@ -58,6 +58,9 @@ public:
         return result;
     }
     binder::expression_vector getAggregates() const { return aggregates; }
+    void setAggregates(binder::expression_vector expressions) {
+        aggregates = std::move(expressions);
+    }
 
     std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalAggregate>(keys, dependentKeys, aggregates, children[0]->copy(),
@@ -1,12 +1,25 @@
 #pragma once
 
+#include <optional>
+
 #include "common/enums/accumulate_type.h"
+#include "common/enums/expression_type.h"
 #include "planner/operator/logical_operator.h"
 #include "planner/operator/sip/side_way_info_passing.h"
 
 namespace kuzu {
 namespace planner {
 
+// Inequality between an expression of the probe side and one of the build side, e.g. a.x < b.y.
+// The cross product only scans the build tuples which can satisfy it for some probe tuple of a
+// batch. The predicate itself is still evaluated by a filter above the cross product.
+struct CrossProductInequality {
+    std::shared_ptr<binder::Expression> probeKey;
+    std::shared_ptr<binder::Expression> buildKey;
+    // Comparison of the probe key against the build key.
+    common::ExpressionType comparisonType;
+};
+
 class LogicalCrossProduct final : public LogicalOperator {
     static constexpr LogicalOperatorType type_ = LogicalOperatorType::CROSS_PRODUCT;
 
@@ -31,10 +44,14 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    void setInequality(CrossProductInequality value) { inequality = std::move(value); }
+    const std::optional<CrossProductInequality>& getInequality() const { return inequality; }
+
     std::unique_ptr<LogicalOperator> copy() override {
         auto op = make_unique<LogicalCrossProduct>(accumulateType, mark, children[0]->copy(),
             children[1]->copy(), cardinality);
         op->sipInfo = sipInfo;
+        op->inequality = inequality;
         return op;
     }
 
@@ -42,6 +59,7 @@ private:
     common::AccumulateType accumulateType;
     std::shared_ptr<binder::Expression> mark;
     SIPInfo sipInfo;
+    std::optional<CrossProductInequality> inequality;
 };
 
 } // namespace planner
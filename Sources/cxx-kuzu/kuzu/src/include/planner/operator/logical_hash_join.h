@@ -45,6 +45,17 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Set for the joins of the join order, so that a much larger build side than estimated can be
+    // fed back to the planner (see JoinOrderEnumeratorContext::getSubgraphKey).
+    void setBuildSubgraph(std::string key, common::cardinality_t estimatedCardinality) {
+        buildSubgraphKey = std::move(key);
+        estimatedBuildCardinality = estimatedCardinality;
+    }
+    const std::string& getBuildSubgraphKey() const { return buildSubgraphKey; }
+    common::cardinality_t getEstimatedBuildCardinality() const {
+        return estimatedBuildCardinality;
+    }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -63,6 +74,8 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    std::string buildSubgraphKey;
+    common::cardinality_t estimatedBuildCardinality = 0;
 };
 
 } // namespace planner
@@ -42,6 +42,7 @@ enum class LogicalOperatorType : uint8_t {
     INTERSECT,
     INSERT,
     LIMIT,
+    LOOKUP_NODE_TABLE,
     MERGE,
     MULTIPLICITY_REDUCER,
     NODE_LABEL_FILTER,
@@ -51,9 +52,11 @@ enum class LogicalOperatorType : uint8_t {
     PATH_PROPERTY_PROBE,
     PROJECTION,
     RECURSIVE_EXTEND,
+    REL_DEGREE,
     SCAN_NODE_TABLE,
     SEMI_MASKER,
     SET_PROPERTY,
+    SHARED_SCAN,
     STANDALONE_CALL,
     TABLE_FUNCTION_CALL,
     TRANSACTION,
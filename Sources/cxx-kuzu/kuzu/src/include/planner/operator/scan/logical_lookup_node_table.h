@@ -0,0 +1,45 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalLookupNodeTable reads properties of the nodes in its input by random access. It is placed
+// above a selective filter so that properties which the filter does not need are only read for the
+// nodes passing it, instead of being scanned for every node.
+class LogicalLookupNodeTable final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::LOOKUP_NODE_TABLE;
+
+public:
+    LogicalLookupNodeTable(std::shared_ptr<binder::Expression> nodeID,
+        std::vector<common::table_id_t> nodeTableIDs, binder::expression_vector properties,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, nodeID{std::move(nodeID)},
+          nodeTableIDs{std::move(nodeTableIDs)}, properties{std::move(properties)} {}
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override {
+        return nodeID->toString() + " " + binder::ExpressionUtil::toString(properties);
+    }
+
+    std::shared_ptr<binder::Expression> getNodeID() const { return nodeID; }
+    std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
+    binder::expression_vector getProperties() const { return properties; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalLookupNodeTable>(nodeID, nodeTableIDs, properties,
+            children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> nodeID;
+    std::vector<common::table_id_t> nodeTableIDs;
+    binder::expression_vector properties;
+};
+
+} // namespace planner
+} // namespace kuzu
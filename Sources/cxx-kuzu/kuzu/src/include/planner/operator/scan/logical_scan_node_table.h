@@ -10,6 +10,7 @@ namespace planner {
 enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     PRIMARY_KEY_SCAN = 1,
+    SORTED_INDEX_SCAN = 2,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -32,6 +33,23 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+// Bounds of a lookup in a sorted index. Bounds are inclusive and may be null if their end of the
+// range is open.
+struct SortedIndexScanInfo final : ExtraScanNodeTableInfo {
+    std::string indexName;
+    std::shared_ptr<binder::Expression> lowerBound;
+    std::shared_ptr<binder::Expression> upperBound;
+
+    SortedIndexScanInfo(std::string indexName, std::shared_ptr<binder::Expression> lowerBound,
+        std::shared_ptr<binder::Expression> upperBound)
+        : indexName{std::move(indexName)}, lowerBound{std::move(lowerBound)},
+          upperBound{std::move(upperBound)} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<SortedIndexScanInfo>(indexName, lowerBound, upperBound);
+    }
+};
+
 struct LogicalScanNodeTablePrintInfo final : OPPrintInfo {
     std::shared_ptr<binder::Expression> nodeID;
     binder::expression_vector properties;
@@ -81,6 +99,9 @@ public:
     void addProperty(std::shared_ptr<binder::Expression> expr) {
         properties.push_back(std::move(expr));
     }
+    void setProperties(binder::expression_vector expressions) {
+        properties = std::move(expressions);
+    }
     void setPropertyPredicates(std::vector<storage::ColumnPredicateSet> predicates) {
         propertyPredicates = std::move(predicates);
     }
@@ -88,6 +109,10 @@ public:
         return propertyPredicates;
     }
 
+    // Scans that are likely to stop early, e.g. below a LIMIT, don't read pages ahead.
+    bool getPrefetchPages() const { return prefetchPages; }
+    void setPrefetchPages(bool prefetchPages_) { prefetchPages = prefetchPages_; }
+
     void setExtraInfo(std::unique_ptr<ExtraScanNodeTableInfo> info) { extraInfo = std::move(info); }
 
     ExtraScanNodeTableInfo* getExtraInfo() const { return extraInfo.get(); }
@@ -104,6 +129,7 @@ private:
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
     std::vector<storage::ColumnPredicateSet> propertyPredicates;
+    bool prefetchPages = true;
     std::unique_ptr<ExtraScanNodeTableInfo> extraInfo;
 };
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "planner/operator/logical_accumulate.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalSharedScan replaces one of several identical sub-plans. The sub-plan is materialized once
+// by a shared accumulate and every LogicalSharedScan reads its result. Only the first consumer
+// keeps the accumulate as a child, so that optimizers still visit it once.
+class LogicalSharedScan final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::SHARED_SCAN;
+
+public:
+    // Expressions are scanned from the materialized columns of the aligned materializedExpressions.
+    LogicalSharedScan(binder::expression_vector expressions,
+        binder::expression_vector materializedExpressions,
+        std::shared_ptr<LogicalAccumulate> accumulate, bool ownsAccumulate)
+        : LogicalOperator{type_}, expressions{std::move(expressions)},
+          materializedExpressions{std::move(materializedExpressions)},
+          accumulate{std::move(accumulate)} {
+        if (ownsAccumulate) {
+            children.push_back(this->accumulate);
+        }
+        cardinality = this->accumulate->getCardinality();
+    }
+
+    void computeFactorizedSchema() override { computeSchema(); }
+    void computeFlatSchema() override { computeSchema(); }
+
+    std::string getExpressionsForPrinting() const override {
+        return binder::ExpressionUtil::toString(expressions);
+    }
+
+    binder::expression_vector getExpressions() const { return expressions; }
+    binder::expression_vector getMaterializedExpressions() const {
+        return materializedExpressions;
+    }
+    LogicalAccumulate* getAccumulate() const { return accumulate.get(); }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalSharedScan>(expressions, materializedExpressions,
+            accumulate, getNumChildren() > 0);
+    }
+
+private:
+    void computeSchema();
+
+private:
+    binder::expression_vector expressions;
+    binder::expression_vector materializedExpressions;
+    std::shared_ptr<LogicalAccumulate> accumulate;
+};
+
+} // namespace planner
+} // namespace kuzu
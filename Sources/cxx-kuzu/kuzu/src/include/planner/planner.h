@@ -163,6 +163,10 @@ public:
     void planNodeScan(uint32_t nodePos);
     void planNodeIDScan(uint32_t nodePos);
     void planRelScan(uint32_t relPos);
+    // The directions a rel can be extended in. These are its storage directions, plus BWD for a
+    // rel table stored forward only whose reverse index is ready.
+    std::vector<common::ExtendDirection> getExtendDirections(
+        const binder::RelExpression& rel) const;
     void appendExtend(std::shared_ptr<binder::NodeExpression> boundNode,
         std::shared_ptr<binder::NodeExpression> nbrNode, std::shared_ptr<binder::RelExpression> rel,
         common::ExtendDirection direction, const binder::expression_vector& properties,
@@ -172,6 +176,8 @@ public:
     void planLevel(uint32_t level);
     void planLevelExactly(uint32_t level);
     void planLevelApproximately(uint32_t level);
+    // Plan the levels above the given one by extending a single subgraph per step.
+    void planLevelsGreedily(uint32_t level);
 
     // Plan worst case optimal join
     void planWCOJoin(uint32_t leftLevel, uint32_t rightLevel);
@@ -269,8 +275,10 @@ public:
     void appendMarkJoin(const std::vector<binder::expression_pair>& joinConditions,
         const std::shared_ptr<binder::Expression>& mark, LogicalPlan& probePlan,
         LogicalPlan& buildPlan, LogicalPlan& resultPlan);
+    // The i-th build plan scans rels[i] from the node of boundNodeIDs[i].
     void appendIntersect(const std::shared_ptr<binder::Expression>& intersectNodeID,
-        binder::expression_vector& boundNodeIDs, LogicalPlan& probePlan,
+        binder::expression_vector& boundNodeIDs,
+        const std::vector<std::shared_ptr<binder::RelExpression>>& rels, LogicalPlan& probePlan,
         std::vector<LogicalPlan>& buildPlans);
 
     void appendCrossProduct(const LogicalPlan& probePlan, const LogicalPlan& buildPlan,
@@ -1,17 +1,35 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include "common/profiler.h"
 
 namespace kuzu {
+namespace common {
+class Value;
+}
 namespace main {
 class ClientContext;
 }
+namespace storage {
+class QueryMemoryTracker;
+}
 namespace processor {
 
 struct KUZU_API ExecutionContext {
     uint64_t queryID;
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Whether pipeline breakers may stop the query to have it re-planned with the cardinalities
+    // they observed (see ReoptimizationException).
+    bool canReoptimize = false;
+    // Accounts for the memory allocated by the tasks of the query. Not tracked if null.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
+    // Reported along with the query if it is slow.
+    double compilingTimeMS = 0;
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameters = nullptr;
 
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext,
         uint64_t queryID)
@@ -38,6 +38,10 @@ private:
     std::unique_ptr<evaluator::ExpressionEvaluator> getFunctionEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
+    // Returns nullptr if the expression is not a chain of operations that can be fused.
+    std::unique_ptr<evaluator::ExpressionEvaluator> getFusedEvaluator(
+        std::shared_ptr<binder::Expression> expression) const;
+
     std::unique_ptr<evaluator::ExpressionEvaluator> getNodeEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
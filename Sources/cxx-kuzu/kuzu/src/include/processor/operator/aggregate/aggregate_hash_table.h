@@ -12,14 +12,12 @@
 #include "processor/result/base_hash_table.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/factorized_table_schema.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 namespace kuzu {
 namespace common {
 class InMemOverflowBuffer;
 }
-namespace storage {
-class MemoryManager;
-}
 namespace processor {
 
 class HashSlot {
@@ -29,6 +27,7 @@ class HashSlot {
     static constexpr size_t POINTER_BITS = 57;
 
 public:
+    HashSlot() = default;
     HashSlot(common::hash_t hash, const uint8_t* entry)
         : entry(reinterpret_cast<uint64_t>(entry) |
                 (hash & common::NULL_HIGH_MASKS[FINGERPRINT_BITS])) {}
@@ -44,7 +43,7 @@ public:
     }
 
 private:
-    uint64_t entry;
+    uint64_t entry = 0;
 };
 
 enum class HashTableType : uint8_t { AGGREGATE_HASH_TABLE = 0, MARK_HASH_TABLE = 1 };
@@ -64,6 +63,10 @@ enum class HashTableType : uint8_t { AGGREGATE_HASH_TABLE = 0, MARK_HASH_TABLE =
  * Linear probing. When collision happens, we find the next hash slot whose entry is a
  * nullptr.
  *
+ * 4. Direct lookup
+ * With a single internal ID key, entries of the groups of one node table can also be looked up
+ * by node offset, without probing. Entries found that way still have a hash slot.
+ *
  */
 class AggregateHashTable;
 using update_agg_function_t = std::function<void(AggregateHashTable*,
@@ -102,6 +105,8 @@ public:
     void resizeHashTableIfNecessary(uint32_t maxNumDistinctHashKeys);
 
     AggregateHashTable createEmptyCopy() const { return AggregateHashTable(*this); }
+    // Hands over the entries once the table is no longer probed, leaving the table unusable.
+    std::unique_ptr<FactorizedTable> releaseFactorizedTable() { return std::move(factorizedTable); }
 
     DEFAULT_BOTH_MOVE(AggregateHashTable);
     AggregateHashTable* getDistinctHashTable(uint64_t aggregateFunctionIdx) const {
@@ -148,6 +153,22 @@ protected:
 
     void findHashSlots(const FactorizedTable& data, uint64_t startOffset, uint64_t numTuples);
 
+    void enableDirectLookup();
+    // Returns false, without changing the hash table, if some key cannot be looked up by offset.
+    bool findEntriesByOffsets(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& dependentKeyVectors);
+    void registerEntriesByOffsets(const common::ValueVector& keyVector);
+    bool canLookupByOffset(common::internalID_t nodeID) const {
+        return nodeID.tableID == directLookupTableID &&
+               nodeID.offset < MAX_NUM_DIRECT_LOOKUP_OFFSETS;
+    }
+    // Grows the direct lookup array so that it holds at least numOffsets entries.
+    void reserveDirectLookupOffsets(common::offset_t numOffsets);
+    uint8_t*& getEntryOfOffset(common::offset_t offset) const {
+        KU_ASSERT(offset < numDirectLookupOffsets);
+        return reinterpret_cast<uint8_t**>(offsetToEntry->getData())[offset];
+    }
+
 protected:
     void initializeFT(const std::vector<function::AggregateFunction>& aggregateFunctions,
         FactorizedTableSchema&& tableSchema);
@@ -191,7 +212,7 @@ protected:
 
     //! find an uninitialized hash slot for given hash and fill hash slot with block id and
     //! offset
-    void fillHashSlot(common::hash_t hash, uint8_t* groupByKeysAndAggregateStateBuffer);
+    HashSlot* fillHashSlot(common::hash_t hash, uint8_t* groupByKeysAndAggregateStateBuffer);
 
     inline HashSlot* getHashSlot(uint64_t slotIdx) {
         KU_ASSERT(slotIdx < maxNumHashSlots);
@@ -270,6 +291,20 @@ protected:
     std::unique_ptr<uint64_t[]> noMatchIdxes;
     std::unique_ptr<uint64_t[]> entryIdxesToInitialize;
     std::unique_ptr<HashSlot*[]> hashSlotsToUpdateAggState;
+    // Entries of hashSlotsToUpdateAggState, for aggregate functions which update groups in batch.
+    std::unique_ptr<uint8_t*[]> entriesToUpdateAggState;
+    // Slots of the entries found by direct lookup, pointed to by hashSlotsToUpdateAggState.
+    std::unique_ptr<HashSlot[]> directLookupSlots;
+
+    // Bounds the memory of the direct lookup to 8MB per hash table.
+    static constexpr common::offset_t MAX_NUM_DIRECT_LOOKUP_OFFSETS = 1 << 20;
+    bool directLookupEnabled = false;
+    // Set by the first key looked up. Keys of other tables go through the hash slots.
+    common::table_id_t directLookupTableID = common::INVALID_TABLE_ID;
+    // Entry of each node offset, allocated through the memory manager.
+    std::unique_ptr<storage::MemoryBuffer> offsetToEntry;
+    common::offset_t numDirectLookupOffsets = 0;
+    std::vector<common::offset_t> directLookupOffsets;
 
     std::vector<common::LogicalType> payloadTypes;
     std::vector<function::AggregateFunction> aggregateFunctions;
@@ -323,7 +358,9 @@ public:
         : AggregateHashTable(memoryManager, std::move(keyTypes), std::move(payloadTypes),
               aggregateFunctions, distinctAggKeyTypes,
               common::DEFAULT_VECTOR_CAPACITY /*minimum size*/, tableSchema.copy()),
-          tableSchema{std::move(tableSchema)}, partitioningData{partitioningData} {}
+          tableSchema{std::move(tableSchema)}, partitioningData{partitioningData} {
+        enableDirectLookup();
+    }
 
     uint64_t append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& dependentKeyVectors,
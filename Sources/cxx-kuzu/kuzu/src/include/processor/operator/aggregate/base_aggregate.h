@@ -13,6 +13,9 @@ namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace storage {
+class Spiller;
+}
 namespace processor {
 class AggregateHashTable;
 
@@ -54,16 +57,33 @@ protected:
 
     void finalizeAggregateHashTable(const AggregateHashTable& localHashTable);
 
+    // Shared by the queues of all partitions. Once the full blocks queued in memory reach the
+    // memory budget, further full blocks are written to the spill file and only read back one at a
+    // time when their partition is merged.
+    struct QueueSpillState {
+        storage::Spiller& spiller;
+        uint64_t memoryBudget;
+        std::atomic<uint64_t> numBytesInMemory;
+
+        QueueSpillState(storage::Spiller& spiller, uint64_t memoryBudget)
+            : spiller{spiller}, memoryBudget{memoryBudget}, numBytesInMemory{0} {}
+    };
+
     class HashTableQueue {
     public:
         HashTableQueue(storage::MemoryManager* memoryManager, FactorizedTableSchema tableSchema);
 
         std::unique_ptr<HashTableQueue> copy() const {
-            return std::make_unique<HashTableQueue>(headBlock.load()->table.getMemoryManager(),
+            auto queue = std::make_unique<HashTableQueue>(
+                headBlock.load()->table.getMemoryManager(),
                 headBlock.load()->table.getTableSchema()->copy());
+            queue->spillState = spillState;
+            return queue;
         }
         ~HashTableQueue();
 
+        void enableSpilling(QueueSpillState* state) { spillState = state; }
+
         void appendTuple(std::span<uint8_t> tuple);
 
         void mergeInto(AggregateHashTable& hashTable);
@@ -71,7 +91,7 @@ protected:
         bool empty() const {
             auto headBlock = this->headBlock.load();
             return (headBlock == nullptr || headBlock->numTuplesReserved == 0) &&
-                   queuedTuples.approxSize() == 0;
+                   queuedTuples.approxSize() == 0 && spilledBlockPositions.empty();
         }
 
         struct TupleBlock {
@@ -100,6 +120,17 @@ protected:
         // numTuplesWritten)
         std::atomic<TupleBlock*> headBlock;
         uint64_t numTuplesPerBlock;
+
+    private:
+        void queueFullBlock(TupleBlock* block);
+        uint64_t getNumBytesPerBlock(const TupleBlock& block) const {
+            return block.table.getTableSchema()->getNumBytesPerTuple() * numTuplesPerBlock;
+        }
+
+    private:
+        QueueSpillState* spillState = nullptr;
+        std::mutex spillMtx;
+        std::vector<uint64_t> spilledBlockPositions;
     };
 
 protected:
@@ -111,6 +142,7 @@ protected:
     common::MPSCQueue<std::unique_ptr<common::InMemOverflowBuffer>> overflow;
     uint8_t shiftForPartitioning;
     bool readyForFinalization;
+    std::unique_ptr<QueueSpillState> queueSpillState;
 };
 
 class BaseAggregate : public Sink {
@@ -69,6 +69,10 @@ public:
         overflow.push(std::make_unique<common::InMemOverflowBuffer>(std::move(overflowBuffer)));
     }
 
+    // Allows the tuples queued for the global partitions to be spilled once they exceed the memory
+    // budget.
+    void enableSpilling(storage::Spiller& spiller, uint64_t memoryBudget);
+
     void finalizePartitions();
 
     std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
@@ -76,6 +80,9 @@ public:
     void scan(std::span<uint8_t*> entries, std::vector<common::ValueVector*>& keyVectors,
         common::offset_t startOffset, common::offset_t numRowsToScan,
         std::vector<uint32_t>& columnIndices);
+    // Called once the entries of a range returned by getNextRangeToRead are no longer used. The
+    // groups of a partition are freed as soon as all of them have been scanned.
+    void releaseScannedRange(common::offset_t startOffset, uint64_t numRowsScanned);
 
     uint64_t getNumTuples() const;
 
@@ -85,7 +92,7 @@ public:
     uint64_t getLimitNumber() const { return limitNumber; }
 
     const FactorizedTableSchema* getTableSchema() const {
-        return globalPartitions[0].hashTable->getTableSchema();
+        return emptyHashTable->getTableSchema();
     }
 
     const HashAggregateInfo& getAggregateInfo() const { return aggInfo; }
@@ -93,11 +100,18 @@ public:
     void assertFinalized() const;
 
 protected:
-    std::tuple<const FactorizedTable*, common::offset_t> getPartitionForOffset(
+    // Returns the index of the partition holding the group at the offset, and the offset of the
+    // first group of the partition.
+    std::tuple<common::idx_t, common::offset_t> getPartitionForOffset(
         common::offset_t offset) const;
 
     struct Partition {
+        // Only exists while the partition is being finalized.
         std::unique_ptr<AggregateHashTable> hashTable;
+        // The finalized groups of the partition, freed once all of them have been scanned.
+        std::unique_ptr<FactorizedTable> groups;
+        uint64_t numGroups = 0;
+        std::atomic<uint64_t> numGroupsScanned = 0;
         std::mutex mtx;
         std::unique_ptr<HashTableQueue> queue;
         // The tables storing the distinct values for distinct aggregate functions all get merged in
@@ -110,6 +124,9 @@ public:
     HashAggregateInfo aggInfo;
     uint64_t limitNumber;
     storage::MemoryManager* memoryManager;
+    // The hash tables of the partitions are created as copies of this table when they're
+    // finalized.
+    std::unique_ptr<AggregateHashTable> emptyHashTable;
     std::vector<Partition> globalPartitions;
 };
 
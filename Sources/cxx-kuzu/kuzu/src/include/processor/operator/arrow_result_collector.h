@@ -4,7 +4,6 @@
 
 #include "common/arrow/arrow.h"
 #include "processor/operator/sink.h"
-#include "processor/result/flat_tuple.h"
 
 namespace kuzu {
 namespace processor {
@@ -25,12 +24,13 @@ struct ArrowResultCollectorLocalState {
     std::vector<std::reference_wrapper<common::sel_t>> vectorsSelPos;
     std::vector<common::DataChunk*> chunks;
     std::vector<common::sel_t> chunkCursors;
-    std::unique_ptr<FlatTuple> tuple;
+    // Positions in each vector of the tuples of the row batch being filled.
+    std::vector<std::vector<common::sel_t>> positions;
 
     // Advance cursor.
     bool advance();
-    // Scan from vector to tuple based on cursor.
-    void fillTuple();
+    // Record the positions of the tuple at the cursor.
+    void fillPositions(uint64_t tupleIdx);
 
     void resetCursor();
 };
@@ -1,38 +1,90 @@
 #pragma once
 
+#include <mutex>
+
+#include "common/enums/expression_type.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/factorized_table.h"
 
 namespace kuzu {
 namespace processor {
 
+// Build tuples sorted by the key of an inequality between a probe and a build key, so that the
+// build tuples which can satisfy it for a batch of probe tuples form a range. Keys are compared as
+// doubles; since the conversion preserves order, the ranges are inclusive and may contain tuples
+// which fail the inequality, which the filter above the cross product removes.
+class CrossProductSortedBuild {
+public:
+    CrossProductSortedBuild(ft_col_idx_t keyColIdx, common::PhysicalTypeID keyType,
+        common::ExpressionType comparisonType)
+        : keyColIdx{keyColIdx}, keyType{keyType}, comparisonType{comparisonType},
+          initialized{false}, canSkipTuples{true} {}
+
+    // Sorts the tuples of the table on first call. Thread safe.
+    void init(const FactorizedTable& table);
+
+    // Range of sorted tuples which can satisfy the inequality for the selected probe keys.
+    std::pair<uint64_t, uint64_t> getRange(const common::ValueVector& probeKeyVector) const;
+
+    uint8_t** getTuples() { return tuples.data(); }
+
+private:
+    std::mutex mtx;
+    ft_col_idx_t keyColIdx;
+    common::PhysicalTypeID keyType;
+    // Comparison of the probe key against the build key.
+    common::ExpressionType comparisonType;
+    bool initialized;
+    // Tuples are not skipped if a build key is NaN. Otherwise tuples with null keys are dropped.
+    bool canSkipTuples;
+    std::vector<double> keys;
+    std::vector<uint8_t*> tuples;
+};
+
 struct CrossProductLocalState {
     std::shared_ptr<FactorizedTable> table;
     uint64_t maxMorselSize;
     uint64_t startIdx = 0u;
-
-    CrossProductLocalState(std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize)
-        : table{std::move(table)}, maxMorselSize{maxMorselSize}, startIdx{0} {}
+    uint64_t endIdx = 0u;
+    // Shared by the copies of the operator for all threads.
+    std::shared_ptr<CrossProductSortedBuild> sortedBuild;
+
+    CrossProductLocalState(std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize,
+        std::shared_ptr<CrossProductSortedBuild> sortedBuild = nullptr)
+        : table{std::move(table)}, maxMorselSize{maxMorselSize}, startIdx{0}, endIdx{0},
+          sortedBuild{std::move(sortedBuild)} {}
     EXPLICIT_COPY_DEFAULT_MOVE(CrossProductLocalState);
 
-    void init() { startIdx = table->getNumTuples(); }
+    void init() {
+        startIdx = 0;
+        endIdx = 0;
+        if (sortedBuild != nullptr) {
+            sortedBuild->init(*table);
+        }
+    }
 
 private:
     CrossProductLocalState(const CrossProductLocalState& other)
-        : table{other.table}, maxMorselSize{other.maxMorselSize}, startIdx{other.startIdx} {}
+        : table{other.table}, maxMorselSize{other.maxMorselSize}, startIdx{other.startIdx},
+          endIdx{other.endIdx}, sortedBuild{other.sortedBuild} {}
 };
 
 struct CrossProductInfo {
     std::vector<DataPos> outVecPos;
     std::vector<ft_col_idx_t> colIndicesToScan;
+    // Position of the probe key of the inequality used to skip build tuples, if any.
+    DataPos probeKeyPos;
 
-    CrossProductInfo(std::vector<DataPos> outVecPos, std::vector<ft_col_idx_t> colIndicesToScan)
-        : outVecPos{std::move(outVecPos)}, colIndicesToScan{std::move(colIndicesToScan)} {}
+    CrossProductInfo(std::vector<DataPos> outVecPos, std::vector<ft_col_idx_t> colIndicesToScan,
+        DataPos probeKeyPos = DataPos::getInvalidPos())
+        : outVecPos{std::move(outVecPos)}, colIndicesToScan{std::move(colIndicesToScan)},
+          probeKeyPos{probeKeyPos} {}
     EXPLICIT_COPY_DEFAULT_MOVE(CrossProductInfo);
 
 private:
     CrossProductInfo(const CrossProductInfo& other)
-        : outVecPos{other.outVecPos}, colIndicesToScan{other.colIndicesToScan} {}
+        : outVecPos{other.outVecPos}, colIndicesToScan{other.colIndicesToScan},
+          probeKeyPos{other.probeKeyPos} {}
 };
 
 class CrossProduct final : public PhysicalOperator {
@@ -58,6 +110,7 @@ private:
     CrossProductInfo info;
     CrossProductLocalState localState;
     std::vector<common::ValueVector*> vectorsToScan;
+    common::ValueVector* probeKeyVector = nullptr;
 };
 
 } // namespace processor
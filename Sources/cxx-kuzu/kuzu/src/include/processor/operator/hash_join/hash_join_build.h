@@ -3,11 +3,13 @@
 #include <mutex>
 
 #include "binder/expression/expression.h"
+#include "hash_join_partitions.h"
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/result_set.h"
+#include "storage/predicate/runtime_filter.h"
 
 namespace kuzu {
 namespace processor {
@@ -38,18 +40,56 @@ class HashJoinBuild;
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+// If spilling is enabled and the merged tuples exceed the memory budget, the tuples are moved into
+// HashJoinPartitions, which spill to disk, and hashTable only keeps the overflow data of the
+// tuples. hashTable is still used to match and look up the tuples of the partitions.
 class HashJoinSharedState {
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
         : hashTable{std::move(hashTable)} {};
 
+    void enableSpilling(storage::MemoryManager& memoryManager, storage::Spiller& spiller,
+        uint64_t memoryBudget, common::logical_type_vec_t keyTypes);
+    bool isSpillingEnabled() const { return spillInfo != nullptr; }
+
     void mergeLocalHashTable(JoinHashTable& localHashTable);
+    // Builds the hash slots. Large tables, and the partitions of a partitioned build side, are
+    // built in parallel on the worker threads.
+    void finalize(ExecutionContext* context);
 
     JoinHashTable* getHashTable() { return hashTable.get(); }
+    // Number of tuples merged from all build threads.
+    uint64_t getNumBuildTuples() const { return numBuildTuples; }
+    // Returns nullptr unless the build side has been partitioned.
+    HashJoinPartitions* getPartitions() { return partitions.get(); }
+
+    // The build threads insert their keys into the filter, which is passed sideways to the scan
+    // producing the probe key. Only set for inner joins on a single key.
+    void setRuntimeFilter(std::shared_ptr<storage::JoinKeyFilter> filter) {
+        runtimeFilter = std::move(filter);
+    }
+    storage::JoinKeyFilter* getRuntimeFilter() const { return runtimeFilter.get(); }
+
+private:
+    static constexpr uint64_t MIN_NUM_TUPLES_FOR_PARALLEL_FINALIZE = 1 << 18;
+    static constexpr uint64_t NUM_TUPLE_BLOCKS_PER_FINALIZE_MORSEL = 8;
+
+    struct SpillInfo {
+        storage::MemoryManager& memoryManager;
+        storage::Spiller& spiller;
+        uint64_t memoryBudget;
+        common::logical_type_vec_t keyTypes;
+    };
 
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+private:
+    std::unique_ptr<SpillInfo> spillInfo;
+    std::unique_ptr<HashJoinPartitions> partitions;
+    std::shared_ptr<storage::JoinKeyFilter> runtimeFilter;
+    uint64_t numBuildTuples = 0;
 };
 
 struct HashJoinBuildInfo {
@@ -57,6 +97,10 @@ struct HashJoinBuildInfo {
     std::vector<common::FStateType> fStateTypes;
     std::vector<DataPos> payloadsPos;
     FactorizedTableSchema tableSchema;
+    // Identifies the query subgraph produced by the build side, if the join is part of the join
+    // order chosen by the planner, along with its estimated cardinality.
+    std::string subgraphKey;
+    common::cardinality_t estimatedNumTuples = 0;
 
     HashJoinBuildInfo(std::vector<DataPos> keysPos, std::vector<common::FStateType> fStateTypes,
         std::vector<DataPos> payloadsPos, FactorizedTableSchema tableSchema)
@@ -69,7 +113,8 @@ struct HashJoinBuildInfo {
 private:
     HashJoinBuildInfo(const HashJoinBuildInfo& other)
         : keysPos{other.keysPos}, fStateTypes{other.fStateTypes}, payloadsPos{other.payloadsPos},
-          tableSchema{other.tableSchema.copy()} {}
+          tableSchema{other.tableSchema.copy()}, subgraphKey{other.subgraphKey},
+          estimatedNumTuples{other.estimatedNumTuples} {}
 };
 
 class HashJoinBuild : public Sink {
@@ -101,8 +146,18 @@ protected:
 
 private:
     void setKeyState(common::DataChunkState* state);
+    std::unique_ptr<JoinHashTable> createLocalHashTable(ExecutionContext* context) const;
+    // Throws if the build side is so much larger than estimated that the query should be
+    // re-planned.
+    void checkCardinalityEstimate(const ExecutionContext* context) const;
 
 protected:
+    // Small build sides are cheap whatever the join order, so they never cause a re-optimization.
+    static constexpr uint64_t MIN_NUM_TUPLES_FOR_REOPTIMIZATION = 1 << 14;
+    // When spilling is enabled, the local table is merged into the shared state whenever it
+    // reaches this many tuple blocks so that the build side never holds its whole input in memory.
+    static constexpr uint64_t NUM_TUPLE_BLOCKS_PER_MERGE = 32;
+
     std::shared_ptr<HashJoinSharedState> sharedState;
     HashJoinBuildInfo info;
 
@@ -110,6 +165,7 @@ protected:
     // State of unFlat key(s). If all keys are flat, it points to any flat key state.
     common::DataChunkState* keyState = nullptr;
     std::vector<common::ValueVector*> payloadVectors;
+    std::vector<common::LogicalType> keyTypes;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
 };
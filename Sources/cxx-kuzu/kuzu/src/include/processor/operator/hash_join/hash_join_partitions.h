@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+
+#include "processor/operator/hash_join/join_hash_table.h"
+
+namespace kuzu {
+namespace storage {
+class Spiller;
+} // namespace storage
+namespace processor {
+
+// Build side of a hash join which is allowed to grow beyond its memory budget (hybrid hash join).
+// Tuples are split into partitions by the high bits of their hash. Once the tuples held in memory
+// exceed the budget, the largest partitions are spilled to the spill file and only loaded back
+// (and their hash slots rebuilt) when probed. Loaded partitions are evicted again whenever another
+// partition needs to be loaded and the budget would be exceeded. Only the flat tuple blocks are
+// spilled; overflow data (long strings, lists and unflat columns) stays in memory.
+//
+// Partitions are appended to and finalized by the build side under the lock of the
+// HashJoinSharedState, and pinned/unpinned concurrently by the probe side.
+class HashJoinPartitions {
+    struct SpilledTupleBlock {
+        uint64_t filePosition;
+        uint32_t numTuples;
+        uint64_t freeSize;
+    };
+
+    struct Partition {
+        std::unique_ptr<JoinHashTable> hashTable;
+        std::vector<SpilledTupleBlock> spilledBlocks;
+        // Whether the tuples and hash slots of the partition are in memory and can be probed.
+        // Only meaningful after finalize.
+        bool resident = true;
+        bool loading = false;
+        uint32_t numPins = 0;
+
+        explicit Partition(std::unique_ptr<JoinHashTable> hashTable)
+            : hashTable{std::move(hashTable)} {}
+
+        bool isSpilled() const { return !spilledBlocks.empty(); }
+        uint64_t getNumTuples() const;
+    };
+
+public:
+    static constexpr uint64_t NUM_PARTITIONS = 16;
+    static constexpr uint64_t PARTITION_SHIFT = 60;
+    static_assert(NUM_PARTITIONS == (uint64_t)1 << (sizeof(common::hash_t) * 8 - PARTITION_SHIFT));
+
+    HashJoinPartitions(storage::MemoryManager& memoryManager, storage::Spiller& spiller,
+        uint64_t memoryBudget, common::logical_type_vec_t keyTypes,
+        FactorizedTableSchema tableSchema);
+
+    static common::idx_t getPartitionIdx(common::hash_t hash) { return hash >> PARTITION_SHIFT; }
+
+    // Moves the tuples of the given table into the partitions and spills partitions until the
+    // tuples kept in memory fit in the memory budget. See JoinHashTable::partitionTuples for
+    // overflowTable.
+    void append(JoinHashTable& hashTable, JoinHashTable& overflowTable);
+    // Partitions which were spilled while building are written to disk entirely and built when
+    // they are first pinned. Returns the hash tables of the partitions kept in memory, whose hash
+    // slots must be built (independently of each other) before probing.
+    std::vector<JoinHashTable*> finalize();
+
+    // Returns the partition with the given index if it is in memory and pins it so that it won't
+    // be evicted, or nullptr otherwise.
+    JoinHashTable* tryPin(common::idx_t partitionIdx);
+    // Pins the partition with the given index, loading it from disk if necessary.
+    JoinHashTable* pin(common::idx_t partitionIdx);
+    void unpin(common::idx_t partitionIdx);
+
+    uint64_t getNumSpilledPartitions() const;
+
+private:
+    std::unique_ptr<JoinHashTable> createHashTable() const;
+    uint64_t getMemoryUsageNoLock() const;
+    void spillNoLock(Partition& partition);
+    std::unique_ptr<JoinHashTable> load(const Partition& partition) const;
+    // Frees partitions which are not pinned and can be reloaded until the given number of bytes
+    // fit in the memory budget (or there is nothing left to evict).
+    void evictNoLock(uint64_t numBytesNeeded);
+
+private:
+    storage::MemoryManager& memoryManager;
+    storage::Spiller& spiller;
+    uint64_t memoryBudget;
+    common::logical_type_vec_t keyTypes;
+    FactorizedTableSchema tableSchema;
+    std::vector<Partition> partitions;
+
+    mutable std::mutex mtx;
+    std::condition_variable loadCV;
+};
+
+} // namespace processor
+} // namespace kuzu
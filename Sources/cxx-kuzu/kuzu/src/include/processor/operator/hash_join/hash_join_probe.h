@@ -35,6 +35,8 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
+        probeSideTableSchema = other.probeSideTableSchema.copy();
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +45,10 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Vectors produced by the probe side, which are buffered in a table of the given schema while
+    // the build side partition of their key is spilled. Only set if spilling is enabled.
+    std::vector<DataPos> probeSideDataPos;
+    FactorizedTableSchema probeSideTableSchema;
 };
 
 struct HashJoinProbePrintInfo final : OPPrintInfo {
@@ -91,6 +97,21 @@ private:
     bool getMatchedTuplesForFlatKey(ExecutionContext* context);
     // We can probe a batch of input tuples if we know they have at most one match.
     bool getMatchedTuplesForUnFlatKey(ExecutionContext* context);
+    // When the build side is partitioned, the probe side is partitioned as well (grace hash join).
+    // Keys whose partition is in memory are probed right away. Probe tuples whose key is in a
+    // spilled partition are buffered by partition and probed once the probe input is exhausted,
+    // one partition at a time. So each spilled partition is loaded once per probe thread rather
+    // than once per probe chunk. Sets the keys of the next input and their probed tuples.
+    bool getNextPartitionedProbeInput(ExecutionContext* context);
+    // Probes the keys of the current input whose partition is in memory and buffers the others.
+    // Returns false if no key is left to probe.
+    bool probeResidentPartitions();
+    void bufferProbeTuple(common::idx_t partitionIdx);
+    bool probeNextBufferedTuple();
+
+    JoinHashTable* pinPartition(common::idx_t partitionIdx);
+    JoinHashTable* tryPinPartition(common::idx_t partitionIdx);
+    void unpinPartitions();
 
     uint64_t getInnerJoinResult() {
         return flatProbe ? getInnerJoinResultForFlatKey() : getInnerJoinResultForUnFlatKey();
@@ -117,6 +138,27 @@ private:
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
     common::SelectionVector hashSelVec;
+
+    struct ResidentProbeKey {
+        common::sel_t pos;
+        uint8_t* probedTuple;
+    };
+    struct SpilledProbeKey {
+        common::sel_t pos;
+        common::idx_t partitionIdx;
+    };
+    storage::MemoryManager* memoryManager = nullptr;
+    // Partitions pinned for the current input. They are unpinned before fetching the next input.
+    std::array<JoinHashTable*, HashJoinPartitions::NUM_PARTITIONS> pinnedPartitions{};
+    std::vector<ResidentProbeKey> residentKeys;
+    std::vector<SpilledProbeKey> spilledKeys;
+    std::vector<common::ValueVector*> probeSideVectors;
+    // Probe tuples buffered by the build side partition of their keys.
+    std::array<std::unique_ptr<FactorizedTable>, HashJoinPartitions::NUM_PARTITIONS>
+        bufferedProbeTuples;
+    bool probeInputExhausted = false;
+    common::idx_t bufferedPartitionIdx = common::INVALID_IDX;
+    ft_tuple_idx_t nextBufferedTupleIdx = 0;
 };
 
 } // namespace processor
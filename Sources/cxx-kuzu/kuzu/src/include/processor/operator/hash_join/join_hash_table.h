@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "processor/result/base_hash_table.h"
 #include "processor/result/factorized_table.h"
 
@@ -23,9 +25,25 @@ public:
     uint64_t appendVectorWithSorting(common::ValueVector* keyVector,
         std::vector<common::ValueVector*> payloadVectors);
 
+    static constexpr uint64_t NUM_SLOT_PARTITIONS = 64;
+    using slot_partitioned_tuples_t = std::array<std::vector<uint8_t*>, NUM_SLOT_PARTITIONS>;
+
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Parallel alternative to buildHashSlots for large tables. The hash slots are split into
+    // NUM_SLOT_PARTITIONS ranges. First, the tuples of disjoint ranges of tuple blocks are split by
+    // the range of the slot they are inserted into, then the slots of each range are built
+    // independently of the other ranges. Both steps can run concurrently on different inputs.
+    void partitionTuplesBySlot(uint64_t startBlockIdx, uint64_t endBlockIdx,
+        slot_partitioned_tuples_t& partitionedTuples);
+    void buildHashSlots(uint64_t slotPartitionIdx,
+        std::span<const slot_partitioned_tuples_t> partitionedTuples);
 
+    // Computes the hashes of the probe keys into hashVector. Returns false if all keys are null.
+    // The tmpHashResultVector may be null if there is only one keyVector
+    bool computeProbeHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector& hashVector, common::SelectionVector& hashSelVec,
+        common::ValueVector* tmpHashResultVector);
     // The tmpHashResultVector may be null if there is only one keyVector
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector* tmpHashResultVector,
@@ -43,20 +61,61 @@ public:
         factorizedTable->lookup(vectors, colIdxesToScan, tuplesToRead, startPos, numTuplesToRead);
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
+
+    // Used by hash join partitioning. The flat tuples of this table are moved into the partition
+    // given by partitionFunc, while the overflow data they point to (strings, lists and unflat
+    // columns) is moved into overflowTable, which must outlive the partitions.
+    void partitionTuples(const std::function<JoinHashTable&(common::hash_t)>& partitionFunc,
+        JoinHashTable& overflowTable);
+    // Releases the flat tuple blocks (e.g. to spill them), leaving the table empty.
+    std::vector<std::unique_ptr<DataBlock>> releaseTupleBlocks();
+    void appendTupleBlock(std::unique_ptr<DataBlock> block);
+    uint64_t getNumTupleBlocks() const {
+        return factorizedTable->flatTupleBlockCollection->getBlocks().size();
+    }
+
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
+    // Returns the head of the chain of tuples which may have the given hash, or nullptr if the tag
+    // of the slot rules out any such tuple.
     uint8_t* getTupleForHash(common::hash_t hash) {
         auto slotIdx = getSlotIdxForHash(hash);
         KU_ASSERT(slotIdx < maxNumHashSlots);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
+        if (!(*getSlotTag(slotIdx) & getTagForHash(hash))) {
+            return nullptr;
+        }
+        return *getHashSlot(slotIdx);
     }
 
 private:
+    // Every hash slot has a tag summarizing the hashes of the tuples chained from it: each tuple
+    // sets the bit picked by a few high bits (the salt) of its hash. Tags are kept in a directory
+    // apart from the slots, which is four times denser, so that probing keys without a match
+    // mostly only touches the directory and neither the slots nor the tuples.
+    using slot_tag_t = uint16_t;
+    static constexpr uint64_t TAG_SALT_SHIFT = 48;
+
+    static slot_tag_t getTagForHash(common::hash_t hash) {
+        return (slot_tag_t)1 << ((hash >> TAG_SALT_SHIFT) % (sizeof(slot_tag_t) * 8));
+    }
+    slot_tag_t* getSlotTag(uint64_t slotIdx) const {
+        return (slot_tag_t*)hashSlotTagsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
+               (slotIdx & slotIdxInBlockMask);
+    }
+    uint8_t** getHashSlot(uint64_t slotIdx) const {
+        return (uint8_t**)hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
+               (slotIdx & slotIdxInBlockMask);
+    }
+
     uint8_t** findHashSlot(const uint8_t* tuple) const;
     // This function returns the pointer that previously stored in the same slot.
     uint8_t* insertEntry(uint8_t* tuple) const;
+    void insertTuple(uint8_t* tuple) const;
+    uint64_t getSlotPartitionIdx(uint64_t slotIdx) const {
+        KU_ASSERT(maxNumHashSlots >= NUM_SLOT_PARTITIONS);
+        return slotIdx / (maxNumHashSlots / NUM_SLOT_PARTITIONS);
+    }
 
     // Join hash table assumes all keys to be flat.
     void computeVectorHashes(std::vector<common::ValueVector*> keyVectors);
@@ -67,6 +126,8 @@ private:
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
     uint64_t prevPtrColOffset;
+    // Same number of slots per block as hashSlotsBlocks.
+    std::vector<std::unique_ptr<DataBlock>> hashSlotTagsBlocks;
 };
 
 } // namespace processor
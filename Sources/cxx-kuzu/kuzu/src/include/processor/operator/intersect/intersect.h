@@ -28,6 +28,7 @@ private:
 
 class Intersect : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::INTERSECT;
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 16;
 
 public:
     Intersect(const DataPos& outputDataPos, std::vector<IntersectDataInfo> intersectDataInfos,
@@ -54,7 +55,9 @@ public:
 private:
     // For each build side, probe its HT and return a vector of matched flat tuples.
     void probeHTs();
-    // Left is always the one with less num of values.
+    // Left is always the one with less num of values. When right has at least GALLOPING_SIZE_RATIO
+    // times as many values, each left value is searched for in right by galloping instead of
+    // merging both lists.
     static void twoWayIntersect(common::nodeID_t* leftNodeIDs, common::SelectionVector& lSelVector,
         common::nodeID_t* rightNodeIDs, common::SelectionVector& rSelVector);
     void intersectLists(const std::vector<common::overflow_value_t>& listsToIntersect);
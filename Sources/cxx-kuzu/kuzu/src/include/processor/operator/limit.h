@@ -27,24 +27,28 @@ class Limit final : public PhysicalOperator {
 
 public:
     Limit(uint64_t limitNumber, std::shared_ptr<std::atomic_uint64_t> counter,
-        uint32_t dataChunkToSelectPos, std::unordered_set<uint32_t> dataChunksPosInScope,
-        std::unique_ptr<PhysicalOperator> child, uint32_t id,
-        std::unique_ptr<OPPrintInfo> printInfo)
+        std::shared_ptr<std::atomic_bool> limitReached, uint32_t dataChunkToSelectPos,
+        std::unordered_set<uint32_t> dataChunksPosInScope, std::unique_ptr<PhysicalOperator> child,
+        uint32_t id, std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           limitNumber{limitNumber}, counter{std::move(counter)},
-          dataChunkToSelectPos{dataChunkToSelectPos},
+          limitReached{std::move(limitReached)}, dataChunkToSelectPos{dataChunkToSelectPos},
           dataChunksPosInScope(std::move(dataChunksPosInScope)) {}
 
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return make_unique<Limit>(limitNumber, counter, dataChunkToSelectPos, dataChunksPosInScope,
-            children[0]->copy(), id, printInfo->copy());
+        return make_unique<Limit>(limitNumber, counter, limitReached, dataChunkToSelectPos,
+            dataChunksPosInScope, children[0]->copy(), id, printInfo->copy());
     }
 
 private:
     uint64_t limitNumber;
     std::shared_ptr<std::atomic_uint64_t> counter;
+    // Set once the limit is reached by any thread, which stops the sources of all threads.
+    std::shared_ptr<std::atomic_bool> limitReached;
     uint32_t dataChunkToSelectPos;
     std::unordered_set<uint32_t> dataChunksPosInScope;
 };
@@ -6,6 +6,9 @@
 #include "processor/operator/order_by/order_by_key_encoder.h"
 
 namespace kuzu {
+namespace storage {
+class Spiller;
+}
 namespace processor {
 
 struct KeyBlockMergeMorsel;
@@ -35,9 +38,14 @@ public:
     // This constructor is used to convert a dataBlock to a MergedKeyBlocks.
     MergedKeyBlocks(uint32_t numBytesPerTuple, std::shared_ptr<DataBlock> keyBlock);
 
+    // This constructor is used for key blocks which have been written to the spill file.
+    MergedKeyBlocks(uint32_t numBytesPerTuple, uint64_t numTuples,
+        std::vector<uint64_t> spilledBlockPositions, storage::MemoryManager* memoryManager,
+        storage::Spiller* spiller);
+
     inline uint8_t* getTuple(uint64_t tupleIdx) const {
         KU_ASSERT(tupleIdx < numTuples);
-        return keyBlocks[tupleIdx / numTuplesPerBlock]->getData() +
+        return getKeyBlock(tupleIdx / numTuplesPerBlock).getData() +
                numBytesPerTuple * (tupleIdx % numTuplesPerBlock);
     }
 
@@ -47,20 +55,44 @@ public:
 
     inline uint32_t getNumTuplesPerBlock() const { return numTuplesPerBlock; }
 
-    inline uint8_t* getKeyBlockBuffer(uint32_t idx) const {
-        KU_ASSERT(idx < keyBlocks.size());
-        return keyBlocks[idx]->getData();
-    }
+    inline uint8_t* getKeyBlockBuffer(uint32_t idx) const { return getKeyBlock(idx).getData(); }
 
     uint8_t* getBlockEndTuplePtr(uint32_t blockIdx, uint64_t endTupleIdx,
         uint32_t endTupleBlockIdx) const;
 
+    // Writes the key blocks to the spill file and frees them. Spilled key blocks are loaded back
+    // one at a time when they are accessed, and should be released by the caller once it has moved
+    // past them, so spilled key blocks can only be read sequentially by a single thread.
+    void spill(storage::Spiller& spiller, storage::MemoryManager& memoryManager);
+    bool isSpilled() const { return spiller != nullptr; }
+    // Frees the given key block if it can be loaded back from the spill file.
+    void releaseKeyBlock(uint32_t idx) const {
+        if (isSpilled()) {
+            keyBlocks[idx].reset();
+        }
+    }
+    uint64_t getNumKeyBlocks() const { return keyBlocks.size(); }
+
+private:
+    inline DataBlock& getKeyBlock(uint32_t idx) const {
+        KU_ASSERT(idx < keyBlocks.size());
+        if (keyBlocks[idx] == nullptr) {
+            loadKeyBlock(idx);
+        }
+        return *keyBlocks[idx];
+    }
+    void loadKeyBlock(uint32_t idx) const;
+
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
     uint64_t numTuples;
-    std::vector<std::shared_ptr<DataBlock>> keyBlocks;
+    // Entries of spilled key blocks are null unless the key block is loaded.
+    mutable std::vector<std::shared_ptr<DataBlock>> keyBlocks;
     uint32_t endTupleOffset;
+    storage::MemoryManager* memoryManager = nullptr;
+    storage::Spiller* spiller = nullptr;
+    std::vector<uint64_t> spilledBlockPositions;
 };
 
 struct BlockPtrInfo {
@@ -95,6 +127,12 @@ public:
 
     void mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) const;
 
+    // K-way merges the sorted runs into a single run which is written to the spill file block
+    // by block. Used instead of mergeKeyBlocks once the key blocks don't fit in memory.
+    std::shared_ptr<MergedKeyBlocks> mergeRunsToDisk(
+        const std::vector<std::shared_ptr<MergedKeyBlocks>>& runs,
+        storage::MemoryManager& memoryManager, storage::Spiller& spiller) const;
+
     inline bool compareTuplePtr(uint8_t* leftTuplePtr, uint8_t* rightTuplePtr) const {
         return hasStringCol ? compareTuplePtrWithStringCol(leftTuplePtr, rightTuplePtr) :
                               memcmp(leftTuplePtr, rightTuplePtr, numBytesToCompare) > 0;
@@ -136,9 +174,12 @@ public:
     }
 
 private:
-    uint64_t findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const;
+    // Returns the number of tuples of the left key block among the first numMergedTuples tuples of
+    // the merged result, by binary searching the split point on that diagonal of the merge path.
+    uint64_t findLeftSplitIdx(uint64_t numMergedTuples) const;
 
 public:
+    // Number of merged tuples per morsel, regardless of how they are split between both sides.
     static const uint32_t batch_size = 10000;
 
     std::shared_ptr<MergedKeyBlocks> leftKeyBlock;
@@ -172,17 +213,31 @@ struct KeyBlockMergeMorsel {
 // acquire a lock before calling these functions.
 class KeyBlockMergeTaskDispatcher {
 public:
+    // Maximum number of runs k-way merged at once by an external merge. Each run being merged
+    // keeps one key block in memory.
+    static constexpr uint64_t MAX_NUM_RUNS_PER_EXTERNAL_MERGE = 64;
+
     inline bool isDoneMerge() {
         std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
         // Returns true if there are no more merge task to do or the sortedKeyBlocks is empty
         // (meaning that the resultSet is empty).
-        return sortedKeyBlocks->size() <= 1 && activeKeyBlockMergeTasks.empty();
+        return sortedKeyBlocks->size() <= 1 && activeKeyBlockMergeTasks.empty() &&
+               numActiveExternalMerges == 0;
     }
 
     std::unique_ptr<KeyBlockMergeMorsel> getMorsel();
 
     void doneMorsel(std::unique_ptr<KeyBlockMergeMorsel> morsel);
 
+    // Once some of the sorted key blocks have been spilled, they are merged by k-way merges
+    // writing to the spill file (see KeyBlockMerger::mergeRunsToDisk) instead of morsels.
+    void enableExternalMerge(storage::Spiller& spiller_) { spiller = &spiller_; }
+    storage::Spiller* getExternalMergeSpiller() const { return spiller; }
+    // Returns the runs for the caller to merge, or an empty vector if there is nothing to
+    // merge at this time.
+    std::vector<std::shared_ptr<MergedKeyBlocks>> getRunsToMerge();
+    void doneMergingRuns(std::shared_ptr<MergedKeyBlocks> mergedRun);
+
     // This function is used to initialize the columns of keyBlockMergeTaskDispatcher based on
     // sharedFactorizedTablesAndSortedKeyBlocks.
     void init(storage::MemoryManager* memoryManager,
@@ -197,6 +252,8 @@ private:
     std::queue<std::shared_ptr<MergedKeyBlocks>>* sortedKeyBlocks = nullptr;
     std::vector<std::shared_ptr<KeyBlockMergeTask>> activeKeyBlockMergeTasks;
     std::unique_ptr<KeyBlockMerger> keyBlockMerger;
+    storage::Spiller* spiller = nullptr;
+    uint64_t numActiveExternalMerges = 0;
 };
 
 } // namespace processor
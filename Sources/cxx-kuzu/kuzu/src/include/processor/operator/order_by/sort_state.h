@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <queue>
 
 #include "processor/operator/order_by/radix_sort.h"
@@ -24,6 +25,15 @@ public:
 
     void init(const OrderByDataInfo& orderByDataInfo);
 
+    // Once the sorted key blocks held in memory exceed the memory budget, further sorted key
+    // blocks are spilled and merged externally. The payload tables are always kept in memory.
+    void enableSpilling(storage::Spiller& spiller, storage::MemoryManager& memoryManager,
+        uint64_t memoryBudget);
+    // Returns the spiller if any sorted key block has been spilled.
+    storage::Spiller* getSpillerIfSpilled() const {
+        return spillInfo != nullptr && spillInfo->hasSpilled ? &spillInfo->spiller : nullptr;
+    }
+
     std::pair<uint64_t, FactorizedTable*> getLocalPayloadTable(
         storage::MemoryManager& memoryManager, const FactorizedTableSchema& payloadTableSchema);
 
@@ -38,12 +48,26 @@ public:
     }
 
 private:
+    struct SpillInfo {
+        storage::Spiller& spiller;
+        storage::MemoryManager& memoryManager;
+        uint64_t memoryBudget;
+        std::atomic<uint64_t> numBytesInMemory;
+        std::atomic<bool> hasSpilled;
+
+        SpillInfo(storage::Spiller& spiller, storage::MemoryManager& memoryManager,
+            uint64_t memoryBudget)
+            : spiller{spiller}, memoryManager{memoryManager}, memoryBudget{memoryBudget},
+              numBytesInMemory{0}, hasSpilled{false} {}
+    };
+
     std::mutex mtx;
     std::vector<std::unique_ptr<FactorizedTable>> payloadTables;
     uint8_t nextTableIdx;
     std::unique_ptr<std::queue<std::shared_ptr<MergedKeyBlocks>>> sortedKeyBlocks;
     uint32_t numBytesPerTuple;
     std::vector<StrKeyColInfo> strKeyColsInfo;
+    std::unique_ptr<SpillInfo> spillInfo;
 };
 
 class SortLocalState {
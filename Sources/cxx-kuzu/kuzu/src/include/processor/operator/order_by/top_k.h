@@ -5,6 +5,7 @@
 #include "binder/expression/expression.h"
 #include "processor/operator/sink.h"
 #include "sort_state.h"
+#include "storage/predicate/runtime_filter.h"
 
 namespace kuzu {
 namespace processor {
@@ -71,7 +72,8 @@ public:
         sortState = std::make_unique<TopKSortState>();
     }
 
-    void init(storage::MemoryManager* memoryManager, uint64_t skipNumber, uint64_t limitNumber);
+    void init(storage::MemoryManager* memoryManager, uint64_t skipNumber, uint64_t limitNumber,
+        std::shared_ptr<storage::TopKFilter> filter);
 
     void append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors);
@@ -118,6 +120,8 @@ public:
     std::vector<vector_select_comparison_func> compareFuncs;
     std::vector<vector_select_comparison_func> equalsFuncs;
     bool hasBoundaryValue;
+    // Published with the first key of the boundary value whenever it is set. May be null.
+    std::shared_ptr<storage::TopKFilter> filter;
 
 private:
     // Holds the ownership of all temp vectors.
@@ -133,7 +137,8 @@ private:
 class TopKLocalState {
 public:
     void init(const OrderByDataInfo& orderByDataInfo, storage::MemoryManager* memoryManager,
-        ResultSet& resultSet, uint64_t skipNumber, uint64_t limitNumber);
+        ResultSet& resultSet, uint64_t skipNumber, uint64_t limitNumber,
+        std::shared_ptr<storage::TopKFilter> filter);
 
     void append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors);
@@ -149,9 +154,12 @@ public:
     void init(const OrderByDataInfo& orderByDataInfo, storage::MemoryManager* memoryManager,
         uint64_t skipNumber, uint64_t limitNumber) {
         buffer = std::make_unique<TopKBuffer>(orderByDataInfo);
-        buffer->init(memoryManager, skipNumber, limitNumber);
+        buffer->init(memoryManager, skipNumber, limitNumber, filter);
     }
 
+    void setFilter(std::shared_ptr<storage::TopKFilter> filter_) { filter = std::move(filter_); }
+    const std::shared_ptr<storage::TopKFilter>& getFilter() const { return filter; }
+
     void mergeLocalState(TopKLocalState* localState) {
         std::unique_lock lck{mtx};
         buffer->merge(localState->buffer.get());
@@ -164,6 +172,8 @@ public:
 
 private:
     std::mutex mtx;
+    // Filter on the first key pushed into the scan producing it, if any.
+    std::shared_ptr<storage::TopKFilter> filter;
 };
 
 class TopK final : public Sink {
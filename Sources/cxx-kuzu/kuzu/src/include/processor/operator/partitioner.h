@@ -74,6 +74,8 @@ struct CopyPartitionerSharedState : public PartitionerSharedState {
 
 struct PartitionerLocalState {
     std::vector<std::unique_ptr<PartitioningBuffer>> partitioningBuffers;
+    // See ClientConfig::copyMemoryBudget.
+    uint64_t memoryBudget = 0;
 
     PartitioningBuffer* getPartitioningBuffer(common::partition_idx_t partitioningIdx) const {
         KU_ASSERT(partitioningIdx < partitioningBuffers.size());
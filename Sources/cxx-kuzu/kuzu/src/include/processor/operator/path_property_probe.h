@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/enums/extend_direction.h"
+#include "common/types/internal_id_util.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/physical_operator.h"
 
@@ -21,11 +22,15 @@ struct PathPropertyProbeLocalState {
     std::unique_ptr<common::hash_t[]> hashes;
     std::unique_ptr<uint8_t*[]> probedTuples;
     std::unique_ptr<uint8_t*[]> matchedTuples;
+    // Position of the first occurrence of each ID in the batch being probed.
+    common::internal_id_map_t<common::sel_t> firstPosOfIDs;
+    std::unique_ptr<common::sel_t[]> firstPositions;
 
     PathPropertyProbeLocalState() {
         hashes = std::make_unique<common::hash_t[]>(common::DEFAULT_VECTOR_CAPACITY);
         probedTuples = std::make_unique<uint8_t*[]>(common::DEFAULT_VECTOR_CAPACITY);
         matchedTuples = std::make_unique<uint8_t*[]>(common::DEFAULT_VECTOR_CAPACITY);
+        firstPositions = std::make_unique<common::sel_t[]>(common::DEFAULT_VECTOR_CAPACITY);
     }
 };
 
@@ -92,7 +97,7 @@ public:
 private:
     void probe(JoinHashTable* hashTable, uint64_t sizeProbed, uint64_t sizeToProbe,
         common::ValueVector* idVector, const std::vector<common::ValueVector*>& propertyVectors,
-        const std::vector<ft_col_idx_t>& colIndicesToScan) const;
+        const std::vector<ft_col_idx_t>& colIndicesToScan);
 
 private:
     PathPropertyProbeInfo info;
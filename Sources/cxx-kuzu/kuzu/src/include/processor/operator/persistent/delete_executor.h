@@ -36,6 +36,8 @@ struct NodeTableDeleteInfo {
     DataPos pkPos;
 
     common::ValueVector* pkVector;
+    // Reused across tuples, so that index delete states are only initialized once per executor.
+    std::unique_ptr<storage::NodeTableDeleteState> deleteState;
 
     NodeTableDeleteInfo(storage::NodeTable* table,
         std::unordered_set<storage::RelTable*> fwdRelTables,
@@ -44,7 +46,7 @@ struct NodeTableDeleteInfo {
           bwdRelTables{std::move(bwdRelTables)}, pkPos{pkPos}, pkVector{nullptr} {};
     EXPLICIT_COPY_DEFAULT_MOVE(NodeTableDeleteInfo);
 
-    void init(const ResultSet& resultSet);
+    void init(const ResultSet& resultSet, common::ValueVector& nodeIDVector);
 
     void deleteFromRelTable(transaction::Transaction* transaction,
         common::ValueVector* nodeIDVector) const;
@@ -165,6 +167,7 @@ public:
 
 protected:
     RelDeleteInfo info;
+    std::unique_ptr<storage::RelTableDeleteState> deleteState;
 };
 
 class EmptyRelDeleteExecutor final : public RelDeleteExecutor {
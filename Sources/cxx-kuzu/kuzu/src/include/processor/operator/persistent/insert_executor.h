@@ -42,6 +42,9 @@ struct NodeTableInsertInfo {
 
     common::ValueVector* pkVector;
     std::vector<common::ValueVector*> columnDataVectors;
+    // Initialized by the first insertion and reused by later ones, so that index insert states
+    // are only initialized once per executor.
+    std::unique_ptr<storage::NodeTableInsertState> insertState;
 
     NodeTableInsertInfo(storage::NodeTable* table,
         evaluator::evaluator_vector_t columnDataEvaluators)
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 
@@ -82,6 +84,31 @@ public:
 
     static common::idx_t getFileIdxFunc(const CopyFromFileError& error);
 
+    // Returns the position of the first of the given characters in buffer[position, bufferSize),
+    // or bufferSize if there is none. On little-endian targets the buffer is tested eight bytes at
+    // a time, which lets the parsing loops skip over the bodies of values in a few instructions
+    // instead of stepping through every byte of them.
+    template<typename... Chars>
+    static uint64_t findNextOf(const char* buffer, uint64_t position, uint64_t bufferSize,
+        Chars... chars) {
+        if constexpr (std::endian::native == std::endian::little) {
+            for (; position + sizeof(uint64_t) <= bufferSize; position += sizeof(uint64_t)) {
+                uint64_t word = 0;
+                memcpy(&word, buffer + position, sizeof(word));
+                const auto matches = (matchBytes(word, broadcastByte(chars)) | ...);
+                if (matches != 0) {
+                    return position + std::countr_zero(matches) / 8;
+                }
+            }
+        }
+        for (; position < bufferSize; position++) {
+            if (((buffer[position] == chars) || ...)) {
+                return position;
+            }
+        }
+        return bufferSize;
+    }
+
 protected:
     template<typename Driver>
     bool addValue(Driver&, uint64_t rowNum, common::column_id_t columnIdx, std::string_view strVal,
@@ -116,6 +143,17 @@ protected:
 protected:
     virtual bool handleQuotedNewline() = 0;
 
+    static constexpr uint64_t broadcastByte(char c) {
+        return 0x0101010101010101ULL * static_cast<uint8_t>(c);
+    }
+    // Sets the high bit of each byte of the word that is equal to the corresponding byte of the
+    // pattern. Bits above the lowest match may be set spuriously, so only the lowest one is
+    // reliable.
+    static constexpr uint64_t matchBytes(uint64_t word, uint64_t pattern) {
+        const auto x = word ^ pattern;
+        return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+    }
+
     void skipCurrentLine();
 
     void resetNumRowsInCurrentBlock();
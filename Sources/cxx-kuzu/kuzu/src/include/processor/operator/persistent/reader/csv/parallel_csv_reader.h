@@ -1,5 +1,7 @@
 #pragma once
 
+#include <condition_variable>
+
 #include "base_csv_reader.h"
 #include "common/types/types.h"
 #include "function/function.h"
@@ -11,14 +13,57 @@
 namespace kuzu {
 namespace processor {
 
+// State of the CSV parser at a byte of the file, as far as it decides where rows start. Values
+// can contain quoted newlines, so whether a newline ends a row depends on the bytes before it.
+enum class CSVQuoteState : uint8_t {
+    VALUE_START = 0,
+    UNQUOTED = 1,
+    QUOTED = 2,
+    // After an escape character in a quoted value.
+    ESCAPED = 3,
+    // After the closing quote of a quoted value.
+    UNQUOTED_AFTER_QUOTE = 4,
+    // Skipping the rest of a malformed line.
+    SKIP_LINE = 5,
+};
+
+// The states at the end of a block of the file, for each of the states at its start.
+using csv_quote_transition_t = std::array<CSVQuoteState, 6>;
+
+// The parser states at the start of the blocks of a file. The transition of each block is computed
+// by the thread that parses the block, and the start state of a block is known once the
+// transitions of all the blocks before it are. Only the blocks that are being parsed are tracked.
+class CSVBlockStartStates {
+public:
+    CSVBlockStartStates() : nextBlockIdx{0}, nextBlockStartState{CSVQuoteState::VALUE_START} {}
+
+    void setTransition(common::block_idx_t blockIdx, const csv_quote_transition_t& transition);
+    // Stops the threads waiting for start states, e.g. because a thread failed before setting the
+    // transition of its block.
+    void abort();
+    // Waits for the transitions of the blocks before the given one. Can be called once per block.
+    // Throws if the query is interrupted or the states are aborted while waiting.
+    CSVQuoteState getStartState(common::block_idx_t blockIdx, const main::ClientContext& context);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool aborted = false;
+    // The first block whose transition hasn't been applied yet, and its start state.
+    common::block_idx_t nextBlockIdx;
+    CSVQuoteState nextBlockStartState;
+    std::unordered_map<common::block_idx_t, csv_quote_transition_t> transitions;
+    std::unordered_map<common::block_idx_t, CSVQuoteState> startStates;
+};
+
 //! ParallelCSVReader is a class that reads values from a stream in parallel.
 class ParallelCSVReader final : public BaseCSVReader {
     friend class ParallelParsingDriver;
 
 public:
     ParallelCSVReader(const std::string& filePath, common::idx_t fileIdx, common::CSVOption option,
-        CSVColumnInfo columnInfo, main::ClientContext* context,
-        LocalFileErrorHandler* errorHandler);
+        CSVColumnInfo columnInfo, main::ClientContext* context, LocalFileErrorHandler* errorHandler,
+        CSVBlockStartStates* blockStartStates);
 
     bool hasMoreToRead() const;
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
@@ -31,7 +76,15 @@ protected:
 
 private:
     bool finishedBlock() const;
-    void seekToBlockStart();
+    // Reads the buffer from the start of the current block. It is read once, both to compute the
+    // transition of the block and to parse it.
+    void readBlockStart();
+    void seekToBlockStart(CSVQuoteState startState);
+    CSVQuoteState getNextState(CSVQuoteState state, char c);
+    csv_quote_transition_t computeBlockTransition();
+
+private:
+    CSVBlockStartStates* blockStartStates;
 };
 
 struct ParallelCSVLocalState final : public function::TableFuncLocalState {
@@ -45,6 +98,7 @@ struct ParallelCSVScanSharedState final : public function::ScanFileWithProgressS
     CSVColumnInfo columnInfo;
     std::atomic<uint64_t> numBlocksReadByFiles = 0;
     std::vector<SharedFileErrorHandler> errorHandlers;
+    std::vector<std::unique_ptr<CSVBlockStartStates>> blockStartStates;
     populate_func_t populateErrorFunc;
 
     ParallelCSVScanSharedState(common::FileScanInfo fileScanInfo, uint64_t numRows,
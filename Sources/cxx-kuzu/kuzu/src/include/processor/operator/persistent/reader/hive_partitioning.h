@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace kuzu {
+namespace processor {
+
+// Partition columns encoded in the directories of file paths by hive-style layouts, e.g.
+// `/date=2026-01-01/region=eu/part-0.parquet` has the partition columns `date` and `region`.
+// Keys and values are URL-encoded by the writers of such layouts, and a null value is written as
+// the default partition name.
+struct HivePartitioning {
+    static constexpr const char* OPTION_NAME = "HIVE_PARTITIONING";
+    static constexpr const char* DEFAULT_PARTITION_NAME = "__HIVE_DEFAULT_PARTITION__";
+
+    struct Partition {
+        std::string key;
+        // Null for the default partition.
+        std::optional<std::string> value;
+    };
+
+    // Returns the partitions of the directories of the path, from the outermost one. Both '/' and
+    // '\' separate directories.
+    static std::vector<Partition> getPartitions(const std::string& filePath);
+    // Returns the partition keys of the files, which must be the same for all of them.
+    static std::vector<std::string> getPartitionKeys(const std::vector<std::string>& filePaths);
+    static std::vector<std::optional<std::string>> getPartitionValues(const std::string& filePath);
+};
+
+} // namespace processor
+} // namespace kuzu
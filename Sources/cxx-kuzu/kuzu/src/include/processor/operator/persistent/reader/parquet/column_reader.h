@@ -54,7 +54,11 @@ public:
     static std::unique_ptr<ColumnReader> createReader(ParquetReader& reader,
         common::LogicalType type, const kuzu_parquet::format::SchemaElement& schema,
         uint64_t fileIdx, uint64_t maxDefine, uint64_t maxRepeat);
-    void prepareRead(parquet_filter_t& filter);
+    // Prepares the next page. Data pages of which none of the rows to read at resultOffset are
+    // selected by the filter are skipped without decompressing them, and the number of rows they
+    // hold is returned.
+    uint64_t prepareRead(parquet_filter_t& filter, uint64_t resultOffset, uint64_t numValuesToRead,
+        uint8_t* defineOut, common::ValueVector* resultOut);
     void allocateBlock(uint64_t size);
     void allocateCompressed(uint64_t size);
     void decompressInternal(kuzu_parquet::format::CompressionCodec::type codec, const uint8_t* src,
@@ -9,6 +9,7 @@
 #include "parquet_types.h"
 #include "protocol/TCompactProtocol.h"
 #include "resizable_buffer.h"
+#include "storage/predicate/column_predicate.h"
 
 namespace kuzu {
 namespace processor {
@@ -32,6 +33,10 @@ struct ParquetReaderScanState {
     ResizeableBuffer defineBuf;
     ResizeableBuffer repeatBuf;
 
+    // Predicates pushed down to the scan. Columns with predicates are read first, and the other
+    // columns are only decoded for the rows that can pass them.
+    const std::vector<storage::ColumnPredicateSet>* columnPredicates = nullptr;
+
     // TODO(Ziyi): We currently only support reading from local file system, thus the prefetch
     // mode is disabled by default. Add this back when we support remote file system.
     bool prefetchMode = false;
@@ -49,6 +54,10 @@ public:
     bool scanInternal(ParquetReaderScanState& state, common::DataChunk& result);
     void scan(ParquetReaderScanState& state, common::DataChunk& result);
     uint64_t getNumRowsGroups() { return metadata->row_groups.size(); }
+    // Whether none of the rows of the row group can pass the predicates on the columns, judging
+    // from the statistics of its column chunks, so that the row group doesn't need to be read.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<storage::ColumnPredicateSet>& columnPredicates) const;
 
     uint32_t getNumColumns() const { return columnNames.size(); }
     std::string getColumnName(uint32_t idx) const { return columnNames[idx]; }
@@ -71,6 +80,7 @@ private:
     }
     static common::LogicalType deriveLogicalType(const kuzu_parquet::format::SchemaElement& s_ele);
     void initMetadata();
+    void initColumnChunkIdxs();
     std::unique_ptr<ColumnReader> createReader();
     std::unique_ptr<ColumnReader> createReaderRecursive(uint64_t depth, uint64_t maxDefine,
         uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx);
@@ -80,6 +90,7 @@ private:
     uint64_t getGroupSpan(ParquetReaderScanState& state);
     uint64_t getGroupCompressedSize(ParquetReaderScanState& state);
     uint64_t getGroupOffset(ParquetReaderScanState& state);
+    bool hasColumnPredicate(const ParquetReaderScanState& state, uint32_t colIdx) const;
 
 private:
     std::string filePath;
@@ -88,25 +99,36 @@ private:
     std::vector<common::LogicalType> columnTypes;
 
     std::unique_ptr<kuzu_parquet::format::FileMetaData> metadata;
+    // Index of the column chunk of each top level column within a row group, or INVALID_IDX if
+    // the column is nested and has no single column chunk.
+    std::vector<common::idx_t> columnChunkIdxs;
+    std::vector<common::idx_t> columnSchemaIdxs;
     main::ClientContext* context;
 };
 
 struct ParquetScanSharedState final : function::ScanFileWithProgressSharedState {
     explicit ParquetScanSharedState(common::FileScanInfo fileScanInfo, uint64_t numRows,
-        main::ClientContext* context, std::vector<bool> columnSkips);
+        main::ClientContext* context, std::vector<bool> columnSkips,
+        std::vector<storage::ColumnPredicateSet> columnPredicates,
+        std::vector<std::vector<std::optional<std::string>>> partitionValues);
 
     std::vector<std::unique_ptr<ParquetReader>> readers;
     std::vector<bool> columnSkips;
+    // Predicates pushed down to the scan, which are used to skip row groups.
+    std::vector<storage::ColumnPredicateSet> columnPredicates;
+    // Values of the hive partition columns of each file, which follow the columns of the files.
+    std::vector<std::vector<std::optional<std::string>>> partitionValues;
     uint64_t totalRowsGroups;
     std::atomic<uint64_t> numBlocksReadByFiles;
 };
 
 struct ParquetScanLocalState final : function::TableFuncLocalState {
-    ParquetScanLocalState() : reader(nullptr) {
+    ParquetScanLocalState() : reader(nullptr), fileIdx(0) {
         state = std::make_unique<ParquetReaderScanState>();
     }
 
     ParquetReader* reader;
+    common::idx_t fileIdx;
     std::unique_ptr<ParquetReaderScanState> state;
 };
 
@@ -36,10 +36,15 @@ struct NodeTableSetInfo {
     storage::NodeTable* table;
     common::column_id_t columnID;
 
+    // Reused across tuples, so that index update states are only initialized once per executor.
+    std::unique_ptr<storage::NodeTableUpdateState> updateState;
+
     NodeTableSetInfo(storage::NodeTable* table, common::column_id_t columnID)
         : table{table}, columnID{columnID} {}
     EXPLICIT_COPY_DEFAULT_MOVE(NodeTableSetInfo);
 
+    void init(const NodeSetInfo& info, main::ClientContext* context);
+
 private:
     NodeTableSetInfo(const NodeTableSetInfo& other)
         : table{other.table}, columnID{other.columnID} {}
@@ -70,6 +75,8 @@ public:
     SingleLabelNodeSetExecutor(const SingleLabelNodeSetExecutor& other)
         : NodeSetExecutor{other}, tableInfo(other.tableInfo.copy()) {}
 
+    void init(ResultSet* resultSet, ExecutionContext* context) override;
+
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<NodeSetExecutor> copy() const override {
@@ -87,6 +94,8 @@ public:
     MultiLabelNodeSetExecutor(const MultiLabelNodeSetExecutor& other)
         : NodeSetExecutor{other}, tableInfos{copyUnorderedMap(other.tableInfos)} {}
 
+    void init(ResultSet* resultSet, ExecutionContext* context) override;
+
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<NodeSetExecutor> copy() const override {
@@ -129,10 +138,14 @@ struct RelTableSetInfo {
     storage::RelTable* table;
     common::column_id_t columnID;
 
+    std::unique_ptr<storage::RelTableUpdateState> updateState;
+
     RelTableSetInfo(storage::RelTable* table, common::column_id_t columnID)
         : table{table}, columnID{columnID} {}
     EXPLICIT_COPY_DEFAULT_MOVE(RelTableSetInfo);
 
+    void init(const RelSetInfo& info);
+
 private:
     RelTableSetInfo(const RelTableSetInfo& other) : table{other.table}, columnID{other.columnID} {}
 };
@@ -143,7 +156,7 @@ public:
     RelSetExecutor(const RelSetExecutor& other) : info{other.info.copy()} {}
     virtual ~RelSetExecutor() = default;
 
-    void init(ResultSet* resultSet, ExecutionContext* context);
+    virtual void init(ResultSet* resultSet, ExecutionContext* context);
 
     void setRelID(common::nodeID_t relID) const;
 
@@ -162,6 +175,8 @@ public:
     SingleLabelRelSetExecutor(const SingleLabelRelSetExecutor& other)
         : RelSetExecutor{other}, tableInfo{other.tableInfo.copy()} {}
 
+    void init(ResultSet* resultSet, ExecutionContext* context) override;
+
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<RelSetExecutor> copy() const override {
@@ -179,6 +194,8 @@ public:
     MultiLabelRelSetExecutor(const MultiLabelRelSetExecutor& other)
         : RelSetExecutor{other}, tableInfos{copyUnorderedMap(other.tableInfos)} {}
 
+    void init(ResultSet* resultSet, ExecutionContext* context) override;
+
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<RelSetExecutor> copy() const override {
@@ -36,6 +36,7 @@ public:
         uint64_t count) override;
     void beginWrite(ColumnWriterState& state) override;
     void write(ColumnWriterState& state, common::ValueVector* vector, uint64_t count) override;
+    void finalizePages(ColumnWriterState& state) override;
     void finalizeWrite(ColumnWriterState& state) override;
 
 protected:
@@ -83,6 +83,10 @@ public:
         common::ValueVector* vector, uint64_t count) = 0;
     virtual void beginWrite(ColumnWriterState& state) = 0;
     virtual void write(ColumnWriterState& state, common::ValueVector* vector, uint64_t count) = 0;
+    // Flushes the last page and compresses the dictionary page, if any. This doesn't write to the
+    // file, so the row groups of different threads can be finalized concurrently.
+    virtual void finalizePages(ColumnWriterState& state) = 0;
+    // Writes the pages to the file. Called under the lock of the parquet writer.
     virtual void finalizeWrite(ColumnWriterState& state) = 0;
     inline uint64_t getVectorPos(common::ValueVector* vector, uint64_t idx) {
         return (vector->state == nullptr || !vector->state->isFlat()) ? idx : 0;
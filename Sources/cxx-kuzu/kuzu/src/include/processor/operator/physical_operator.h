@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <optional>
+
 #include "planner/operator/operator_print_info.h"
 #include "processor/result/result_set.h"
 
@@ -47,6 +50,7 @@ enum class PhysicalOperatorType : uint8_t {
     INSTALL_EXTENSION,
     LIMIT,
     LOAD_EXTENSION,
+    LOOKUP_NODE_TABLE,
     MERGE,
     MULTIPLICITY_REDUCER,
     PARTITIONER,
@@ -55,12 +59,14 @@ enum class PhysicalOperatorType : uint8_t {
     PROJECTION,
     PROFILE,
     RECURSIVE_EXTEND,
+    REL_DEGREE,
     RESULT_COLLECTOR,
     SCAN_NODE_TABLE,
     SCAN_REL_TABLE,
     SEMI_MASKER,
     SET_PROPERTY,
     SKIP,
+    SORTED_INDEX_SCAN_NODE_TABLE,
     STANDALONE_CALL,
     TABLE_FUNCTION_CALL,
     TOP_K,
@@ -131,12 +137,31 @@ public:
 
     virtual void finalize(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
+    // Time spent in this operator, excluding its child, over all threads.
+    double getExecutionTime(common::Profiler& profiler) const;
+    uint64_t getNumOutputTuples(common::Profiler& profiler) const;
+    std::vector<uint64_t> getNumOutputTuplesPerThread(common::Profiler& profiler) const;
+    // Number of calls to getNextTuple, i.e. of batches of tuples pulled from this operator.
+    std::vector<uint64_t> getNumBatchesPerThread(common::Profiler& profiler) const;
+
+    // Number of output tuples estimated by the planner for the logical operator this operator is
+    // mapped from. Copies made for other threads do not keep it.
+    void setEstimatedCardinality(common::cardinality_t cardinality) {
+        estimatedCardinality = cardinality;
+    }
+    std::optional<common::cardinality_t> getEstimatedCardinality() const {
+        return estimatedCardinality;
+    }
 
     const OPPrintInfo* getPrintInfo() const { return printInfo.get(); }
 
+    // Makes a source return no more tuples once the signal is set, e.g. when the output of its
+    // pipeline is no longer needed.
+    void setStopSignal(const std::atomic_bool* signal) { stopSignal = signal; }
+
     virtual std::unique_ptr<PhysicalOperator> copy() = 0;
 
     virtual double getProgress(ExecutionContext* context) const;
@@ -161,9 +186,6 @@ protected:
 
     void registerProfilingMetrics(common::Profiler* profiler);
 
-    double getExecutionTime(common::Profiler& profiler) const;
-    uint64_t getNumOutputTuples(common::Profiler& profiler) const;
-
     virtual void finalizeInternal(ExecutionContext* /*context*/) {}
 
 protected:
@@ -174,6 +196,8 @@ protected:
     physical_op_vector_t children;
     ResultSet* resultSet;
     std::unique_ptr<OPPrintInfo> printInfo;
+    std::optional<common::cardinality_t> estimatedCardinality;
+    const std::atomic_bool* stopSignal = nullptr;
 };
 
 } // namespace processor
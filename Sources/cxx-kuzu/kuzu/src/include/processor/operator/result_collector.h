@@ -6,6 +6,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_stream.h"
 
 namespace kuzu {
 namespace processor {
@@ -22,9 +23,14 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // Streams the result to the client in chunks, instead of collecting it into the table.
+    void setStream(std::shared_ptr<ResultStream> stream_) { stream = std::move(stream_); }
+    ResultStream* getStream() const { return stream.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<ResultStream> stream;
 };
 
 struct ResultCollectorInfo {
@@ -83,6 +89,15 @@ public:
 
     std::unique_ptr<main::QueryResult> getQueryResult() const override;
 
+    ResultCollectorSharedState* getSharedState() const { return sharedState.get(); }
+
+    // Whether the result can be streamed, which requires the table to be neither read back nor
+    // completed in finalize.
+    bool canStreamResult() const {
+        return info.accumulateType == common::AccumulateType::REGULAR &&
+               !info.payloadPositions.empty();
+    }
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<ResultCollector>(info.copy(), sharedState, children[0]->copy(), id,
             printInfo->copy());
@@ -91,6 +106,8 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
+    void executeStreamingInternal(ExecutionContext* context, ResultStream& stream);
+
     void initNecessaryLocalState(ResultSet* resultSet, ExecutionContext* context);
 
 private:
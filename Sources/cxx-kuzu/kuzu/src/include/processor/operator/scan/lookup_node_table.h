@@ -0,0 +1,36 @@
+#pragma once
+
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Reads properties of the nodes selected in the input node ID vector by looking up their rows, so
+// that nodes filtered out below are never read. Lookups of consecutive nodes in the same node
+// group share the initialization of the scan state.
+class LookupNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::LOOKUP_NODE_TABLE;
+
+public:
+    LookupNodeTable(ScanOpInfo opInfo, ScanNodeTableInfo tableInfo,
+        std::unique_ptr<PhysicalOperator> child, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(opInfo), std::move(child), id, std::move(printInfo)},
+          tableInfo{std::move(tableInfo)}, scanState{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<LookupNodeTable>(opInfo.copy(), tableInfo.copy(),
+            children[0]->copy(), id, printInfo->copy());
+    }
+
+private:
+    ScanNodeTableInfo tableInfo;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/physical_operator.h"
+#include "storage/table/rel_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct RelDegreeInfo {
+    storage::RelTable* table;
+    common::RelDataDirection direction;
+    DataPos boundNodeIDPos;
+    DataPos degreePos;
+
+    RelDegreeInfo(storage::RelTable* table, common::RelDataDirection direction,
+        const DataPos& boundNodeIDPos, const DataPos& degreePos)
+        : table{table}, direction{direction}, boundNodeIDPos{boundNodeIDPos},
+          degreePos{degreePos} {}
+};
+
+// Writes the number of rels of each bound node in the direction, which are counted from CSR list
+// lengths, and filters out bound nodes without any rel.
+class RelDegree final : public PhysicalOperator, public SelVectorOverWriter {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::REL_DEGREE;
+
+public:
+    RelDegree(RelDegreeInfo info, std::unique_ptr<PhysicalOperator> child, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)}, info{info},
+          boundNodeIDVector{nullptr}, degreeVector{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<RelDegree>(info, children[0]->copy(), id, printInfo->copy());
+    }
+
+private:
+    RelDegreeInfo info;
+    common::ValueVector* boundNodeIDVector;
+    common::ValueVector* degreeVector;
+    storage::RelTableDegreeState degreeState;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -14,28 +14,56 @@ struct ScanNodeTableProgressSharedState {
     ScanNodeTableProgressSharedState() : numGroupsScanned{0}, numGroups{0} {};
 };
 
+// Rows [startRow, endRow) of the node group to scan. Node groups are scanned whole unless they are
+// split into ranges of vectors.
+struct ScanNodeTableMorsel {
+    bool isRange = false;
+    common::row_idx_t startRow = 0;
+    common::row_idx_t endRow = 0;
+};
+
 class ScanNodeTableSharedState {
 public:
+    // Number of rows of the ranges the last committed node groups are split into.
+    static constexpr common::row_idx_t RANGE_MORSEL_NUM_ROWS = 4 * common::DEFAULT_VECTOR_CAPACITY;
+
     explicit ScanNodeTableSharedState(std::unique_ptr<common::SemiMask> semiMask)
-        : table{nullptr}, currentCommittedGroupIdx{common::INVALID_NODE_GROUP_IDX},
-          currentUnCommittedGroupIdx{common::INVALID_NODE_GROUP_IDX}, numCommittedNodeGroups{0},
-          numUnCommittedNodeGroups{0}, semiMask{std::move(semiMask)} {};
+        : table{nullptr}, currentUnCommittedGroupIdx{common::INVALID_NODE_GROUP_IDX},
+          numCommittedNodeGroups{0}, numUnCommittedNodeGroups{0}, numDispatchedCommittedGroups{0},
+          numThreads{1}, splitGroupIdx{common::INVALID_NODE_GROUP_IDX}, nextRowInSplitGroup{0},
+          numRowsInSplitGroup{0}, semiMask{std::move(semiMask)} {};
 
     void initialize(const transaction::Transaction* transaction, storage::NodeTable* table,
-        ScanNodeTableProgressSharedState& progressSharedState);
+        uint64_t numThreads, ScanNodeTableProgressSharedState& progressSharedState);
 
-    void nextMorsel(storage::NodeTableScanState& scanState,
+    void nextMorsel(storage::NodeTableScanState& scanState, ScanNodeTableMorsel& morsel,
         ScanNodeTableProgressSharedState& progressSharedState);
 
     common::SemiMask* getSemiMask() const { return semiMask.get(); }
 
+private:
+    common::node_group_idx_t getNextCommittedGroupIdx();
+
 private:
     std::mutex mtx;
     storage::NodeTable* table;
-    common::node_group_idx_t currentCommittedGroupIdx;
+    // Committed node groups are dispatched by NUMA node: node group i belongs to NUMA node
+    // i % numNUMANodes, and threads first take the groups of the node they run on, so that the
+    // pages of a node group are faulted into the same node's memory by every scan. Once a node runs
+    // out of groups, its threads take the groups of other nodes. On machines with a single NUMA
+    // node this is a plain sequential dispatch.
+    std::vector<common::node_group_idx_t> nextCommittedGroupIdxPerNUMANode;
     common::node_group_idx_t currentUnCommittedGroupIdx;
     common::node_group_idx_t numCommittedNodeGroups;
     common::node_group_idx_t numUnCommittedNodeGroups;
+    // Once fewer committed node groups are left than there are threads, the threads which take the
+    // last groups would keep scanning while the others are idle. Such groups are split into ranges
+    // which are handed out one at a time, so all threads share the tail of the scan.
+    common::node_group_idx_t numDispatchedCommittedGroups;
+    uint64_t numThreads;
+    common::node_group_idx_t splitGroupIdx;
+    common::row_idx_t nextRowInSplitGroup;
+    common::row_idx_t numRowsInSplitGroup;
     std::unique_ptr<common::SemiMask> semiMask;
 };
 
@@ -83,7 +111,8 @@ public:
         std::unique_ptr<OPPrintInfo> printInfo,
         std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState)
         : ScanTable{type_, std::move(opInfo), id, std::move(printInfo)}, currentTableIdx{0},
-          scanState{nullptr}, tableInfos{std::move(tableInfos)},
+          scanState{nullptr}, nextRowInMorsel{0}, numMorsels{nullptr}, numRangeMorsels{nullptr},
+          prefetchPages{true}, tableInfos{std::move(tableInfos)},
           sharedStates{std::move(sharedStates)},
           progressSharedState{std::move(progressSharedState)} {
         KU_ASSERT(this->tableInfos.size() == this->sharedStates.size());
@@ -91,6 +120,14 @@ public:
 
     common::table_id_map_t<common::SemiMask*> getSemiMasks() const;
 
+    // Adds the runtime filter to the scan of the output vector at the given position. Returns
+    // false if the scan does not output that vector.
+    bool addRuntimeFilter(const DataPos& pos, const std::string& columnName,
+        const std::shared_ptr<storage::RuntimeFilter>& filter);
+
+    // Only full sequential scans read pages ahead (see LogicalScanNodeTable::getPrefetchPages).
+    void setPrefetchPages(bool prefetchPages_) { prefetchPages = prefetchPages_; }
+
     bool isSource() const override { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
@@ -103,20 +140,37 @@ public:
     }
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos), sharedStates,
-            id, printInfo->copy(), progressSharedState);
+        auto result = std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos),
+            sharedStates, id, printInfo->copy(), progressSharedState);
+        result->setPrefetchPages(prefetchPages);
+        return result;
     }
 
     double getProgress(ExecutionContext* context) const override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 private:
     void initGlobalStateInternal(ExecutionContext* context) override;
 
     void initCurrentTable(ExecutionContext* context);
 
+    bool scanMorsel(transaction::Transaction* transaction);
+
+    std::string getNumMorselsMetricKey() const { return "numMorsels-" + std::to_string(id); }
+    std::string getNumRangeMorselsMetricKey() const {
+        return "numRangeMorsels-" + std::to_string(id);
+    }
+
 private:
     common::idx_t currentTableIdx;
     std::unique_ptr<storage::NodeTableScanState> scanState;
+    ScanNodeTableMorsel morsel;
+    common::row_idx_t nextRowInMorsel;
+    common::NumericMetric* numMorsels;
+    common::NumericMetric* numRangeMorsels;
+    bool prefetchPages;
     std::vector<ScanNodeTableInfo> tableInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
     std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState;
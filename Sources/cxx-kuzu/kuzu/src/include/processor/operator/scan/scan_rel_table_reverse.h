@@ -0,0 +1,58 @@
+#pragma once
+
+#include "processor/operator/scan/scan_table.h"
+#include "storage/table/rel_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct ScanRelTableReverseSharedState {
+    std::shared_ptr<const storage::RelTableReverseIndex> index;
+};
+
+// Extends from the destination nodes of a rel table stored in the forward direction only, through
+// its reverse index. The output vectors are the neighbour node ID followed by rel IDs. Queries
+// which cannot read the installed index, e.g. because it was dropped since they were planned, or
+// because they run in a write transaction, build a private one from the table.
+class ScanRelTableReverse final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::SCAN_REL_TABLE;
+
+public:
+    ScanRelTableReverse(ScanOpInfo info, storage::RelTable* table,
+        std::shared_ptr<ScanRelTableReverseSharedState> sharedState,
+        std::unique_ptr<PhysicalOperator> child, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(info), std::move(child), id, std::move(printInfo)},
+          table{table}, sharedState{std::move(sharedState)}, boundNodeIDVector{nullptr},
+          currBoundNodeIdx{0}, nextRelIdx{0} {}
+
+    void initGlobalStateInternal(ExecutionContext* context) override;
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<ScanRelTableReverse>(opInfo.copy(), table, sharedState,
+            children[0]->copy(), id, printInfo->copy());
+    }
+
+private:
+    void initBoundNode(common::transaction_t startTS);
+    bool scanRels();
+
+private:
+    storage::RelTable* table;
+    std::shared_ptr<ScanRelTableReverseSharedState> sharedState;
+    common::ValueVector* boundNodeIDVector;
+    // The selection vector of the bound node IDs read from the child, which is flattened to each
+    // of them in turn.
+    common::SelectionVector cachedBoundNodeSelVector;
+    common::sel_t currBoundNodeIdx;
+    std::span<const storage::RelTableReverseIndex::Rel> rels;
+    std::vector<storage::RelTableReverseIndex::Rel> insertedRels;
+    uint64_t nextRelIdx;
+};
+
+} // namespace processor
+} // namespace kuzu
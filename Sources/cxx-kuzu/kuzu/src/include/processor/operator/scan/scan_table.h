@@ -2,6 +2,7 @@
 
 #include "binder/expression/expression.h"
 #include "processor/operator/physical_operator.h"
+#include "storage/predicate/runtime_filter.h"
 #include "storage/table/table.h"
 
 namespace kuzu {
@@ -70,11 +71,21 @@ struct ScanTableInfo {
 
     void castColumns();
 
+    // Adds a filter passed sideways from a hash join or a top-k on the column at the given index.
+    // It is checked against the zone maps of the column and on the scanned values.
+    void addRuntimeFilter(common::idx_t columnIdx, const std::string& columnName,
+        std::shared_ptr<storage::RuntimeFilter> filter);
+    // Narrows selVector down to the tuples passing the runtime filters. Must be called after
+    // castColumns.
+    void applyRuntimeFilters(const std::vector<common::ValueVector*>& outVectors,
+        common::SelectionVector& selVector) const;
+
 protected:
     ScanTableInfo(const ScanTableInfo& other)
         : table{other.table}, columnIDs{other.columnIDs},
           columnPredicates{copyVector(other.columnPredicates)},
-          columnCasters{copyVector(other.columnCasters)}, hasColumnCaster{other.hasColumnCaster} {}
+          columnCasters{copyVector(other.columnCasters)}, hasColumnCaster{other.hasColumnCaster},
+          runtimeFilters{other.runtimeFilters} {}
 
     void initScanStateVectors(storage::TableScanState& scanState,
         const std::vector<common::ValueVector*>& outVectors, storage::MemoryManager* memoryManager);
@@ -86,6 +97,8 @@ protected:
     // Column cast handler for multi table scan of the same column name but different type
     std::vector<ColumnCaster> columnCasters;
     bool hasColumnCaster = false;
+    // Runtime filters and the index of the column they apply to
+    std::vector<std::pair<common::idx_t, std::shared_ptr<storage::RuntimeFilter>>> runtimeFilters;
 };
 
 class ScanTable : public PhysicalOperator {
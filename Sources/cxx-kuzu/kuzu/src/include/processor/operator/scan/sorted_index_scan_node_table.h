@@ -0,0 +1,86 @@
+#pragma once
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace storage {
+class SortedIndex;
+}
+namespace processor {
+
+struct SortedIndexScanPrintInfo final : OPPrintInfo {
+    std::string tableName;
+    std::string alias;
+    std::string indexName;
+    std::string bounds;
+    binder::expression_vector properties;
+
+    SortedIndexScanPrintInfo(std::string tableName, std::string alias, std::string indexName,
+        std::string bounds, binder::expression_vector properties)
+        : tableName{std::move(tableName)}, alias{std::move(alias)},
+          indexName{std::move(indexName)}, bounds{std::move(bounds)},
+          properties{std::move(properties)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<SortedIndexScanPrintInfo>(new SortedIndexScanPrintInfo(*this));
+    }
+
+private:
+    SortedIndexScanPrintInfo(const SortedIndexScanPrintInfo& other)
+        : OPPrintInfo{other}, tableName{other.tableName}, alias{other.alias},
+          indexName{other.indexName}, bounds{other.bounds}, properties{other.properties} {}
+};
+
+// Reads the nodes of a table whose indexed property may be within the bounds, by looking them up
+// in a sorted index, along with the nodes inserted by the transaction, which are not indexed yet.
+// The bounds are evaluated once. Nodes are output in batches and their properties are looked up,
+// and the filters the bounds come from are applied above, since the index gives candidates.
+class SortedIndexScanNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ =
+        PhysicalOperatorType::SORTED_INDEX_SCAN_NODE_TABLE;
+
+public:
+    SortedIndexScanNodeTable(ScanOpInfo opInfo, ScanNodeTableInfo tableInfo,
+        storage::SortedIndex* index,
+        std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator,
+        std::unique_ptr<evaluator::ExpressionEvaluator> upperBoundEvaluator, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(opInfo), id, std::move(printInfo)},
+          tableInfo{std::move(tableInfo)}, index{index},
+          lowerBoundEvaluator{std::move(lowerBoundEvaluator)},
+          upperBoundEvaluator{std::move(upperBoundEvaluator)}, scanState{nullptr},
+          lookedUp{false}, cursor{0} {}
+
+    bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    bool isParallel() const override { return false; }
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<SortedIndexScanNodeTable>(opInfo.copy(), tableInfo.copy(), index,
+            lowerBoundEvaluator ? lowerBoundEvaluator->copy() : nullptr,
+            upperBoundEvaluator ? upperBoundEvaluator->copy() : nullptr, id, printInfo->copy());
+    }
+
+private:
+    void lookUpOffsets(transaction::Transaction* transaction);
+
+private:
+    ScanNodeTableInfo tableInfo;
+    storage::SortedIndex* index;
+    std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator;
+    std::unique_ptr<evaluator::ExpressionEvaluator> upperBoundEvaluator;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+    bool lookedUp;
+    std::vector<common::offset_t> offsets;
+    common::idx_t cursor;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "expression_evaluator/expression_evaluator.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/result_set.h"
@@ -27,6 +30,17 @@ private:
     }
 };
 
+// A list which does not depend on any input tuple, e.g. a parameter, is evaluated once and its
+// elements are handed out to all threads in morsels of a vector.
+struct UnwindSharedState {
+    std::mutex mtx;
+    std::shared_ptr<common::ValueVector> listVector;
+    common::list_entry_t listEntry;
+    std::atomic<uint64_t> nextIdx;
+
+    UnwindSharedState() : listEntry{0, 0}, nextIdx{0} {}
+};
+
 class Unwind : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::UNWIND;
 
@@ -38,26 +52,49 @@ public:
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           outDataPos{outDataPos}, idPos(idPos), expressionEvaluator{std::move(expressionEvaluator)},
           startIndex{0u} {}
+    // Source unwinding a list which does not depend on any input tuple.
+    Unwind(DataPos outDataPos, DataPos idPos,
+        std::unique_ptr<evaluator::ExpressionEvaluator> expressionEvaluator,
+        std::shared_ptr<UnwindSharedState> sharedState, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, id, std::move(printInfo)}, outDataPos{outDataPos}, idPos(idPos),
+          expressionEvaluator{std::move(expressionEvaluator)}, sharedState{std::move(sharedState)},
+          startIndex{0u} {}
+
+    bool isSource() const override { return sharedState != nullptr; }
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
+    double getProgress(ExecutionContext* context) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
+        if (sharedState != nullptr) {
+            return make_unique<Unwind>(outDataPos, idPos, expressionEvaluator->copy(),
+                sharedState, id, printInfo->copy());
+        }
         return make_unique<Unwind>(outDataPos, idPos, expressionEvaluator->copy(),
             children[0]->copy(), id, printInfo->copy());
     }
 
 private:
+    void initGlobalStateInternal(ExecutionContext* context) override;
+
     bool hasMoreToRead() const;
     void copyTuplesToOutVector(uint64_t startPos, uint64_t endPos) const;
 
+    bool getNextTuplesFromSharedList();
+
     DataPos outDataPos;
     DataPos idPos;
 
     std::unique_ptr<evaluator::ExpressionEvaluator> expressionEvaluator;
+    std::shared_ptr<UnwindSharedState> sharedState;
     std::shared_ptr<common::ValueVector> outValueVector;
     common::ValueVector* idVector = nullptr;
+    // Vector holding the list being unwound.
+    common::ValueVector* listVector = nullptr;
     uint32_t startIndex;
     common::list_entry_t listEntry;
 };
@@ -49,6 +49,7 @@ class RelSetExecutor;
 class NodeDeleteExecutor;
 class RelDeleteExecutor;
 struct NodeTableDeleteInfo;
+class ScanNodeTable;
 struct NodeTableSetInfo;
 struct RelTableSetInfo;
 struct BatchInsertSharedState;
@@ -129,6 +130,8 @@ public:
     std::unique_ptr<PhysicalOperator> mapIntersect(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapInsert(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapLimit(const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapLookupNodeTable(
+        const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapMerge(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapMultiplicityReducer(
         const planner::LogicalOperator* logicalOperator);
@@ -144,6 +147,7 @@ public:
         const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapRecursiveExtend(
         const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapRelDegree(const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapScanNodeTable(
         const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapSemiMasker(
@@ -154,6 +158,8 @@ public:
         const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapSetRelProperty(
         const planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapSharedScan(
+        const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapStandaloneCall(
         const planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapTableFunctionCall(
@@ -227,6 +233,11 @@ public:
         DataPos pkPos) const;
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
+    // Returns the scan whose output tuples reach the given operator, in the same pipeline, through
+    // operators that only filter them, project them or join them with other tuples on their probe
+    // side, so that tuples which cannot contribute to the result can be dropped right at the scan
+    // by a runtime filter on one of the scanned columns.
+    static ScanNodeTable* getRuntimeFilterScan(PhysicalOperator* op);
 
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
@@ -251,6 +262,12 @@ public:
 private:
     std::unordered_map<const planner::LogicalOperator*, PhysicalOperator*> logicalOpToPhysicalOpMap;
     physical_op_id physicalOperatorID;
+    // Tables materialized once for the shared scans of each shared accumulate, and the result
+    // collectors filling them. The collectors are attached to the root so that they are executed
+    // before any of their scans.
+    std::unordered_map<const planner::LogicalOperator*, std::shared_ptr<FactorizedTable>>
+        sharedTables;
+    physical_op_vector_t sharedTableCollectors;
     std::vector<extension::MapperExtension*> mapperExtensions;
 };
 
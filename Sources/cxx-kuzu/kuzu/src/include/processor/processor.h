@@ -6,6 +6,9 @@ namespace kuzu {
 namespace main {
 class QueryResult;
 }
+namespace storage {
+struct FileIOStatsSnapshot;
+}
 namespace processor {
 class FactorizedTable;
 class PhysicalPlan;
@@ -29,6 +32,19 @@ private:
 
     void initTask(common::Task* task);
 
+    static bool canExecuteChildrenConcurrently(const PhysicalOperator& op,
+        const ExecutionContext& context);
+    static bool isExportDatabaseSink(const PhysicalOperator& op, const ExecutionContext& context);
+    void decomposeExportDatabaseIntoTask(PhysicalOperator* op, common::Task* task,
+        ExecutionContext* context);
+
+    // Adds the rows and time of each operator of a finished query to the query stats log.
+    static void recordQueryStats(PhysicalPlan& physicalPlan, ExecutionContext& context,
+        std::string query, double executionTimeMS);
+    // Adds the query to the slow query log with its profiled plan.
+    static void recordSlowQuery(PhysicalPlan& physicalPlan, ExecutionContext& context,
+        std::string query, double executionTimeMS, storage::FileIOStatsSnapshot ioStats);
+
 private:
     std::unique_ptr<common::TaskScheduler> taskScheduler;
 };
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <optional>
+
 #include "common/task_system/task.h"
 #include "processor/operator/sink.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 
 namespace kuzu {
 namespace processor {
@@ -18,6 +21,18 @@ public:
 
     bool terminate() override;
 
+    std::string getName() const override;
+
+    // Buffers allocated by the pipeline are charged to its sink, which owns the shared state (e.g.
+    // the hash table or the factorized table) they are allocated for.
+    static std::optional<storage::MemoryTrackerScope> trackMemory(const Sink& sink,
+        const ExecutionContext& context);
+    // Tasks that a pipeline runs on other worker threads, e.g. the frontier tasks of a GDS
+    // algorithm, charge their buffers to the same query and sink as the scope of the pipeline
+    // thread that created them. That thread waits for the tasks, so the scope outlives them.
+    static std::optional<storage::MemoryTrackerScope> trackMemory(
+        const storage::MemoryTrackerScope* pipelineScope);
+
 private:
     bool sharedStateInitialized;
     Sink* sink;
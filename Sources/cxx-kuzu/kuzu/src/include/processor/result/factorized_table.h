@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 #include "common/in_mem_overflow_buffer.h"
 #include "common/types/value/value.h"
@@ -72,6 +73,8 @@ public:
     DataBlock* getLastBlock() { return blocks.back().get(); }
 
     void merge(DataBlockCollection& other);
+    uint64_t getMemoryUsage() const;
+    std::vector<std::unique_ptr<DataBlock>> releaseBlocks() { return std::exchange(blocks, {}); }
     void preventDestruction() const {
         for (auto& block : blocks) {
             block->preventDestruction();
@@ -141,6 +144,8 @@ public:
     uint64_t getNumTuples() const { return numTuples; }
     uint64_t getTotalNumFlatTuples() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
+    // Number of bytes of the blocks held by the table.
+    uint64_t getMemoryUsage() const;
 
     const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
         return flatTupleBlockCollection->getBlocks();
@@ -277,6 +282,16 @@ public:
 
     void getNext(FlatTuple& tuple);
 
+    // The two functions below are only valid for tables without unflat columns, where each tuple
+    // holds a single flat tuple.
+    ft_tuple_idx_t getNextTupleIdx() const {
+        return nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+    }
+    void setNextTupleIdx(ft_tuple_idx_t tupleIdx) {
+        nextTupleIdx = tupleIdx;
+        nextFlatTupleIdx = numFlatTuples;
+    }
+
     void resetState();
 
 private:
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/api.h"
+#include "common/types/value/value.h"
+#include "processor/result/factorized_table_schema.h"
+
+namespace kuzu {
+namespace processor {
+
+class FactorizedTable;
+
+/**
+ * @brief Stores a tuple of a query result without expanding it into flat tuples. The columns of
+ * the tuple are partitioned into groups, and the columns of a group have the same number of
+ * values. The flat tuples represented by the tuple are the Cartesian product of the rows of its
+ * groups, e.g. a node with many neighbors is returned once together with the list of its
+ * neighbors instead of once for each neighbor.
+ */
+class FactorizedTuple {
+public:
+    explicit FactorizedTuple(const std::vector<common::LogicalType>& types);
+
+    DELETE_COPY_AND_MOVE(FactorizedTuple);
+
+    /**
+     * @return number of columns in the FactorizedTuple.
+     */
+    KUZU_API common::idx_t getNumColumns() const;
+    /**
+     * @return number of groups of columns in the FactorizedTuple.
+     */
+    KUZU_API common::idx_t getNumGroups() const;
+    /**
+     * @param colIdx The index of the column.
+     * @return the index of the group the column belongs to.
+     */
+    KUZU_API common::idx_t getGroupIdx(common::idx_t colIdx) const;
+    /**
+     * @param groupIdx The index of the group.
+     * @return number of rows of the group, i.e. number of values of each of its columns.
+     */
+    KUZU_API uint64_t getNumRows(common::idx_t groupIdx) const;
+    /**
+     * @return number of flat tuples represented by the FactorizedTuple.
+     */
+    KUZU_API uint64_t getNumFlatTuples() const;
+    /**
+     * @brief Get a pointer to a value of a column.
+     * @param colIdx The index of the column.
+     * @param rowIdx The index of the row of the value in the group of the column.
+     * @return A pointer to the Value.
+     */
+    KUZU_API common::Value* getValue(common::idx_t colIdx, common::idx_t rowIdx);
+
+    // Reads the tuple at tupleIdx of the table, whose columns must have the types of the tuple.
+    void read(const FactorizedTable& table, ft_tuple_idx_t tupleIdx);
+
+private:
+    std::vector<common::LogicalType> types;
+    std::vector<common::idx_t> groupIdxes;
+    std::vector<uint64_t> numRowsPerGroup;
+    // The values of each column. The vectors are only grown, so that their values are reused for
+    // the next tuples.
+    std::vector<std::vector<common::Value>> values;
+};
+
+} // namespace processor
+} // namespace kuzu
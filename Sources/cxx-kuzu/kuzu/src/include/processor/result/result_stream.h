@@ -0,0 +1,60 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+/**
+ * ResultStream is a bounded queue of result chunks between the result collector of a query, which
+ * pushes chunks while the query is executed, and the query result, which pops chunks as the client
+ * reads tuples. Pushing blocks while the number of buffered tuples is at least the capacity of the
+ * stream, so that a query whose client doesn't keep up is paused instead of materializing its
+ * whole result. Cancelling a stream that hasn't finished fails the pushes of the query, which stops
+ * its execution, and the chunks that haven't been read can no longer be popped.
+ */
+class ResultStream {
+public:
+    explicit ResultStream(uint64_t capacity)
+        : capacity{capacity}, numBufferedTuples{0}, finished{false}, cancelled{false} {}
+
+    // Blocks while the stream is full. Throws an InterruptException if the stream is cancelled.
+    void push(std::unique_ptr<FactorizedTable> table);
+    // Marks the end of the stream, with the error message of the query if it failed.
+    void finish(std::string errorMessage = "");
+    void cancel();
+    // Called when the stream is cancelled before it has finished, e.g. to interrupt the query
+    // without waiting for its next push.
+    void setCancelCallback(std::function<void()> callback) { cancelCallback = std::move(callback); }
+
+    // Blocks until a chunk is available, and returns nullptr at the end of the stream. Throws a
+    // RuntimeException if the query has failed or the stream has been cancelled.
+    std::unique_ptr<FactorizedTable> pop();
+    // Blocks until the first chunk is available or the stream has finished. Returns the error
+    // message of the query if it failed before pushing any chunk.
+    std::string waitForFirstChunk();
+
+    // Drops the buffered chunks. Their memory isn't freed if the database has been closed.
+    void clear(bool preventDestruction);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t capacity;
+    uint64_t numBufferedTuples;
+    std::deque<std::unique_ptr<FactorizedTable>> tables;
+    bool finished;
+    bool cancelled;
+    std::string errorMessage;
+    std::function<void()> cancelCallback;
+};
+
+} // namespace processor
+} // namespace kuzu
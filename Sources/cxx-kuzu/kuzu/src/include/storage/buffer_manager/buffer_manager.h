@@ -9,14 +9,17 @@
 #include "common/types/types.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/page_state.h"
+#include "storage/enums/eviction_policy.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/file_handle.h"
+#include "storage/page_range.h"
 
 namespace kuzu {
 namespace main {
 struct DBConfig;
 };
 namespace common {
+class TaskScheduler;
 class VirtualFileSystem;
 };
 namespace testing {
@@ -25,6 +28,7 @@ class BufferManagerTest;
 class CopyTestHelper;
 }; // namespace testing
 namespace storage {
+class BufferPoolWarmUp;
 class ChunkedNodeGroup;
 class Spiller;
 
@@ -68,6 +72,9 @@ public:
           data{std::make_unique<std::atomic<EvictionCandidate>[]>(this->capacity)} {}
 
     bool insert(uint32_t fileIndex, common::page_idx_t pageIndex);
+    bool insert(const EvictionCandidate& candidate) {
+        return insert(candidate.fileIdx, candidate.pageIdx);
+    }
 
     // Produces the next non-empty candidate to be tried for eviction.
     // Note that it is still possible (though unlikely) for another thread to evict this candidate,
@@ -81,6 +88,18 @@ public:
     uint64_t getEvictionCursor() const { return evictionCursor; }
     uint64_t getCapacity() const { return capacity; }
 
+    // Calls func on each candidate in the queue. Candidates inserted or removed concurrently may or
+    // may not be visited.
+    template<typename FUNC>
+    void forEachCandidate(FUNC&& func) const {
+        for (auto i = 0u; i < capacity; i++) {
+            auto candidate = data[i].load(std::memory_order_relaxed);
+            if (!(candidate == EMPTY)) {
+                func(candidate);
+            }
+        }
+    }
+
 private:
     std::atomic<uint64_t> insertCursor;
     std::atomic<uint64_t> evictionCursor;
@@ -137,6 +156,12 @@ private:
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
  * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
  * comments above `claimAFrame()` for more details.
+ * Under EvictionPolicy::TWO_QUEUE, pages pinned with PageReadPolicy::READ_PAGE_ONCE are kept in a
+ * separate probationary queue, which is drained before the main queue. Reading a cached page again
+ * with another read policy sets its referenced bit (see PageState), and a probationary page whose
+ * referenced bit is set during eviction is moved to the main queue instead of being evicted.
+ * The policy is chosen when the database is opened (SystemConfig::enableTwoQueueEviction), and
+ * SECOND_CHANCE is the default.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -189,12 +214,18 @@ class BufferManager {
     friend class testing::BufferManagerTest;
     friend class testing::CopyTestHelper;
 
+    friend class BufferPoolWarmUp;
     friend class FileHandle;
     friend class MemoryManager;
 
+    // The probationary queue holds up to 1/PROBATION_QUEUE_CAPACITY_RATIO of the buffer pool pages.
+    static constexpr uint64_t PROBATION_QUEUE_CAPACITY_RATIO = 4;
+
 public:
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
+        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly,
+        bool enableHugePages = false,
+        EvictionPolicy evictionPolicy = EvictionPolicy::SECOND_CHANCE);
     virtual ~BufferManager();
 
     // Currently, these functions are specifically used only for WAL files.
@@ -210,8 +241,17 @@ public:
         return fileHandles.back().get();
     }
 
+    // Hints that the given pages of the file will be read soon. Pages that are not cached in frames
+    // are grouped into contiguous runs and handed to the file system, which reads them ahead
+    // asynchronously where supported, so that the following pins are served without blocking on
+    // disk reads one page at a time. This never blocks on I/O and never changes page states, except
+    // for files opened with direct I/O, whose runs are read into frames right away.
+    void prefetch(FileHandle& fileHandle, const PageRange& pageRange);
+
     uint64_t getMemoryLimit() const { return bufferPoolSize; }
     uint64_t getUsedMemory() const { return usedMemory; }
+    // Returns the I/O counters of each file handle, in the order the handles were created.
+    std::vector<FileIOStatsSnapshot> getIOStats() const;
 
     void getSpillerOrSkip(std::function<void(Spiller&)> func) {
         if (spiller) {
@@ -220,6 +260,22 @@ public:
     }
 
     void resetSpiller(std::string spillPath);
+    // Spills full partitioner groups to disk until the memory they hold is within the budget,
+    // regardless of whether the buffer pool is under pressure.
+    void spillUnusedChunks(uint64_t memoryBudget);
+
+    EvictionPolicy getEvictionPolicy() const { return evictionPolicy; }
+
+    // Records the pages of the file that are cached in frames in a manifest at the given path.
+    // Pages read again since they were last unpinned come first, then the other pages of the main
+    // eviction queue, then the pages of the probationary queue.
+    void saveHotPageManifest(FileHandle& fileHandle, const std::string& path);
+    // Starts reading the pages recorded in the manifest at the given path back into frames with
+    // background tasks, if the manifest exists. See BufferPoolWarmUp.
+    void startWarmUp(FileHandle& fileHandle, const std::string& path,
+        common::TaskScheduler& taskScheduler);
+    // Must be called before the task scheduler given to startWarmUp is destroyed.
+    void stopWarmUp();
 
     // This function only works when run in a single-threaded context
     // Iterates through the eviction queue and removes any elements that have already been evicted
@@ -235,7 +291,8 @@ private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
@@ -259,8 +316,20 @@ private:
 
     bool claimAFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    // Reads the evicted pages in the range into frames with a single batch of reads. Used instead
+    // of OS prefetching for files opened with direct I/O.
+    void readAhead(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t endPageIdx, PageReadPolicy pageReadPolicy);
+    // Reads the pages of the range that fit in the free memory of the buffer pool with readAhead.
+    // Returns false if not all of them fit.
+    bool warmUpPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t endPageIdx, PageReadPolicy pageReadPolicy);
     // Return number of bytes freed.
-    uint64_t tryEvictPage(std::atomic<EvictionCandidate>& candidate);
+    uint64_t tryEvictPage(EvictionQueue& queue, std::atomic<EvictionCandidate>& candidate);
+    // Moves a probationary candidate that was read again to the main eviction queue.
+    void tryPromoteProbationaryPage(std::atomic<EvictionCandidate>& candidate);
+    bool insertEvictionCandidate(FileHandle& fileHandle, common::page_idx_t pageIdx,
+        PageReadPolicy pageReadPolicy);
 
     void cachePageIntoFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
@@ -278,10 +347,24 @@ private:
     }
 
     uint64_t evictPages();
+    uint64_t evictPagesFromQueue(EvictionQueue& queue);
+    uint64_t evictProbationaryPages();
+
+    // Inserts into the partition of the current NUMA node, or into another one if it is full.
+    bool insertIntoEvictionQueues(const EvictionCandidate& candidate);
 
 private:
     std::atomic<uint64_t> bufferPoolSize;
-    EvictionQueue evictionQueue;
+    // The main eviction queue is partitioned by NUMA node. Pages are queued in the partition of the
+    // node that cached them (whose memory the frame was first touched from), and evicting threads
+    // drain their own node's partition before the others', so that frames tend to be reused on the
+    // node that allocated them. Each partition holds an equal share of the pages of the buffer pool,
+    // and together they can hold all of them. There is a single partition on machines with one NUMA
+    // node.
+    std::vector<std::unique_ptr<EvictionQueue>> evictionQueues;
+    // Holds pages pinned with PageReadPolicy::READ_PAGE_ONCE under EvictionPolicy::TWO_QUEUE.
+    EvictionQueue probationQueue;
+    const EvictionPolicy evictionPolicy;
     // Total memory used
     std::atomic<uint64_t> usedMemory;
     // Amount of memory used, which cannot be evicted
@@ -292,6 +375,7 @@ private:
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    std::shared_ptr<BufferPoolWarmUp> warmUp;
 };
 
 } // namespace storage
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "storage/enums/page_read_policy.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace common {
+class TaskScheduler;
+class VirtualFileSystem;
+} // namespace common
+
+namespace storage {
+class BufferManager;
+class FileHandle;
+
+// The pages of a file that were cached in the buffer pool, saved so that the buffer pool can be
+// warmed up with them the next time the database is opened. Pages are grouped into runs of
+// consecutive pages. The runs of the most recently used pages come first, and the runs of each
+// tier are ordered by page index, so that they are read back with large sequential reads.
+struct HotPageManifest {
+    static constexpr uint64_t MAGIC = 0x7365676170746f68; // "hotpages"
+
+    std::vector<PageRange> runs;
+    // The first numMainRuns runs hold pages of the main eviction queue. The pages of the other runs
+    // were in the probationary queue, and are cached with PageReadPolicy::READ_PAGE_ONCE again.
+    uint64_t numMainRuns = 0;
+
+    std::vector<uint8_t> serialize() const;
+    // Returns nullopt if the buffer doesn't hold a complete manifest.
+    static std::optional<HotPageManifest> deserialize(std::span<const uint8_t> buffer);
+
+    // The manifest is only a hint, so failing to save or load it is not an error.
+    void save(common::VirtualFileSystem& vfs, const std::string& path) const;
+    static std::optional<HotPageManifest> load(common::VirtualFileSystem& vfs,
+        const std::string& path);
+};
+
+// Reads the pages of a manifest into frames in the background. The pages are read a chunk at a
+// time by BACKGROUND tasks, each of which schedules the next one before it finishes, so that the
+// workers pick up the tasks of queries between chunks. Warming up stops when the buffer pool is
+// full, since evicting pages to make room for guessed ones would defeat its purpose.
+class BufferPoolWarmUp : public std::enable_shared_from_this<BufferPoolWarmUp> {
+public:
+    static constexpr common::page_idx_t CHUNK_NUM_PAGES = 256;
+
+    BufferPoolWarmUp(BufferManager& bufferManager, FileHandle& fileHandle,
+        common::TaskScheduler& taskScheduler, HotPageManifest manifest)
+        : bufferManager{bufferManager}, fileHandle{fileHandle}, taskScheduler{taskScheduler},
+          manifest{std::move(manifest)} {}
+
+    void start();
+    // Reads the next chunk of pages, and schedules the following one.
+    void readNextChunk();
+    // Waits for the chunk being read, if any, and prevents further chunks from being read.
+    void stop();
+
+private:
+    void scheduleNextChunkNoLock();
+
+private:
+    BufferManager& bufferManager;
+    FileHandle& fileHandle;
+    common::TaskScheduler& taskScheduler;
+    HotPageManifest manifest;
+    uint64_t nextRunIdx = 0;
+    common::page_idx_t nextPageInRun = 0;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopped = false;
+    bool reading = false;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace storage {
+
+enum class FileIOCounter : uint8_t {
+    // Calls to pin, including those made by optimistic reads of evicted pages.
+    PINS = 0,
+    // Accesses (pins or optimistic reads) served from a page already cached in a frame.
+    HITS = 1,
+    // Accesses which had to claim a frame for the page.
+    MISSES = 2,
+    // Optimistic reads repeated because the page changed while it was being read.
+    OPTIMISTIC_READ_RETRIES = 3,
+    EVICTIONS = 4,
+    // Pages read since they were queued, which are marked instead of being evicted.
+    SECOND_CHANCES = 5,
+    BYTES_READ = 6,
+    BYTES_WRITTEN = 7,
+};
+
+struct FileIOStatsSnapshot {
+    static constexpr uint64_t NUM_COUNTERS = 8;
+    // Bucket i holds the reads which took less than 2^i microseconds (and at least 2^(i-1)). The
+    // last bucket holds all slower reads.
+    static constexpr uint64_t NUM_READ_LATENCY_BUCKETS = 20;
+
+    std::string filePath;
+    std::array<uint64_t, NUM_COUNTERS> counters{};
+    std::array<uint64_t, NUM_READ_LATENCY_BUCKETS> readLatencyHistogram{};
+
+    uint64_t get(FileIOCounter counter) const { return counters[static_cast<uint8_t>(counter)]; }
+
+    void merge(const FileIOStatsSnapshot& other) {
+        for (auto i = 0u; i < NUM_COUNTERS; i++) {
+            counters[i] += other.counters[i];
+        }
+        for (auto i = 0u; i < NUM_READ_LATENCY_BUCKETS; i++) {
+            readLatencyHistogram[i] += other.readLatencyHistogram[i];
+        }
+    }
+
+    // Leaves the counts since the given earlier snapshot of the same counters.
+    void subtract(const FileIOStatsSnapshot& earlier) {
+        for (auto i = 0u; i < NUM_COUNTERS; i++) {
+            counters[i] -= earlier.counters[i];
+        }
+        for (auto i = 0u; i < NUM_READ_LATENCY_BUCKETS; i++) {
+            readLatencyHistogram[i] -= earlier.readLatencyHistogram[i];
+        }
+    }
+};
+
+// Counters of the accesses of the buffer manager to a file. Counters are sharded by thread so that
+// hits on the same file from several threads do not contend on a single cache line, and are only
+// summed up when a snapshot is taken.
+class FileIOStats {
+    static constexpr uint64_t NUM_SHARDS = 16;
+
+public:
+    void add(FileIOCounter counter, uint64_t value = 1) {
+        getShard().counters[static_cast<uint8_t>(counter)].fetch_add(value,
+            std::memory_order_relaxed);
+    }
+
+    void recordReadLatency(uint64_t latencyInMicros) {
+        const auto bucketIdx = std::min<uint64_t>(std::bit_width(latencyInMicros),
+            FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS - 1);
+        getShard().readLatencyHistogram[bucketIdx].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    FileIOStatsSnapshot snapshot() const {
+        FileIOStatsSnapshot result;
+        for (auto& shard : shards) {
+            for (auto i = 0u; i < FileIOStatsSnapshot::NUM_COUNTERS; i++) {
+                result.counters[i] += shard.counters[i].load(std::memory_order_relaxed);
+            }
+            for (auto i = 0u; i < FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS; i++) {
+                result.readLatencyHistogram[i] +=
+                    shard.readLatencyHistogram[i].load(std::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, FileIOStatsSnapshot::NUM_COUNTERS> counters{};
+        std::array<std::atomic<uint64_t>, FileIOStatsSnapshot::NUM_READ_LATENCY_BUCKETS>
+            readLatencyHistogram{};
+    };
+
+    Shard& getShard() {
+        static std::atomic<uint64_t> nextShardIdx{0};
+        thread_local const uint64_t shardIdx =
+            nextShardIdx.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+        return shards[shardIdx];
+    }
+
+private:
+    std::array<Shard, NUM_SHARDS> shards;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -19,14 +19,18 @@ class VirtualFileSystem;
 namespace storage {
 
 class MemoryManager;
+class QueryMemoryTracker;
+struct OperatorMemoryUsage;
 class FileHandle;
 class BufferManager;
 class ChunkedNodeGroup;
+class SlabAllocator;
 template<class T>
 class MmAllocator;
 
 class MemoryBuffer {
     friend class Spiller;
+    friend class MemoryManager;
 
 public:
     KUZU_API MemoryBuffer(MemoryManager* mm, common::page_idx_t blockIdx, uint8_t* buffer,
@@ -52,12 +56,17 @@ private:
     // Must only be called once before loading from disk
     SpillResult setSpilledToDisk(uint64_t filePosition);
 
+    void releaseFromTracker();
+
 private:
     std::span<uint8_t> buffer;
     uint64_t filePosition = UINT64_MAX;
     MemoryManager* mm;
     common::page_idx_t pageIdx;
     bool evicted;
+    // The query the buffer is charged to, if it was allocated by a task of a query.
+    std::shared_ptr<QueryMemoryTracker> tracker;
+    OperatorMemoryUsage* operatorUsage = nullptr;
 };
 
 /*
@@ -74,19 +83,25 @@ private:
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ *
+ * Containers allocate through MmAllocator instead, whose small blocks come from a SlabAllocator.
  */
 class KUZU_API MemoryManager {
     friend class MemoryBuffer;
+    friend class SlabAllocator;
     template<class T>
     friend class MmAllocator;
 
 public:
     MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs);
 
-    ~MemoryManager() = default;
+    ~MemoryManager();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
         uint64_t size = common::TEMP_PAGE_SIZE);
+    // Allocates memory that is not charged to the query of the calling thread, e.g. for caches
+    // shared by the queries of the database. Such memory must be freed before the database closes.
+    std::unique_ptr<MemoryBuffer> allocateBufferUntracked(bool initializeToZero, uint64_t size);
     common::page_offset_t getPageSize() const { return pageSize; }
 
     BufferManager* getBufferManager() const { return bm; }
@@ -97,6 +112,13 @@ private:
     void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     void updateUsedMemoryForFreedBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     std::span<uint8_t> mallocBuffer(bool initializeToZero, uint64_t size);
+    // Allocates and frees the memory of MmAllocator.
+    uint8_t* allocate(uint64_t size);
+    void deallocate(uint8_t* buffer, uint64_t size);
+    // Reserves memory from the buffer manager for allocations outside of the buffer pool's frames,
+    // and releases it.
+    void reserveUnmanagedMemory(uint64_t size);
+    void releaseUnmanagedMemory(uint64_t size);
 
 private:
     FileHandle* fh;
@@ -104,6 +126,7 @@ private:
     common::page_offset_t pageSize;
     std::stack<common::page_idx_t> freePages;
     std::mutex allocatorLock;
+    std::unique_ptr<SlabAllocator> slabAllocator;
 };
 
 } // namespace storage
@@ -7,6 +7,9 @@ namespace storage {
 
 template<class T>
 class MmAllocator {
+    template<class U, class V>
+    friend bool operator==(const MmAllocator<U>& a, const MmAllocator<V>& b);
+
 public:
     using value_type = T;
 
@@ -21,8 +24,7 @@ public:
         KU_ASSERT_UNCONDITIONAL(size > 0);
         KU_ASSERT_UNCONDITIONAL(size <= std::numeric_limits<std::size_t>::max() / sizeof(T));
 
-        auto buffer = mm->mallocBuffer(false, size * sizeof(T));
-        auto p = reinterpret_cast<T*>(buffer.data());
+        auto p = reinterpret_cast<T*>(mm->allocate(size * sizeof(T)));
 
         // Ensure proper alignment
         KU_ASSERT_UNCONDITIONAL(reinterpret_cast<std::uintptr_t>(p) % alignof(T) == 0);
@@ -35,10 +37,7 @@ public:
         KU_ASSERT_UNCONDITIONAL(p != nullptr);
         KU_ASSERT_UNCONDITIONAL(size > 0);
 
-        const auto buffer = std::span(reinterpret_cast<uint8_t*>(p), size * sizeof(T));
-        if (buffer.data() != nullptr) {
-            mm->freeBlock(common::INVALID_PAGE_IDX, buffer);
-        }
+        mm->deallocate(reinterpret_cast<uint8_t*>(p), size * sizeof(T));
     }
 
 private:
@@ -16,8 +16,12 @@ namespace storage {
 // Keeps the state information of a page in a file.
 class PageState {
     static constexpr uint64_t DIRTY_MASK = 0x0080000000000000;
+    // Set when a cached page is read again with a policy other than READ_PAGE_ONCE. Used by
+    // EvictionPolicy::TWO_QUEUE to tell probationary pages that were re-referenced.
+    static constexpr uint64_t REFERENCED_MASK = 0x0040000000000000;
+    static constexpr uint64_t FLAGS_MASK = DIRTY_MASK | REFERENCED_MASK;
     static constexpr uint64_t STATE_MASK = 0xFF00000000000000;
-    static constexpr uint64_t VERSION_MASK = 0x00FFFFFFFFFFFFFF;
+    static constexpr uint64_t VERSION_MASK = 0x003FFFFFFFFFFFFF;
     static constexpr uint64_t NUM_BITS_TO_SHIFT_FOR_STATE = 56;
 
 public:
@@ -34,10 +38,12 @@ public:
     }
     static uint64_t getVersion(uint64_t stateAndVersion) { return stateAndVersion & VERSION_MASK; }
     static uint64_t updateStateWithSameVersion(uint64_t oldStateAndVersion, uint64_t newState) {
-        return ((oldStateAndVersion << 8) >> 8) | (newState << NUM_BITS_TO_SHIFT_FOR_STATE);
+        return (oldStateAndVersion & ~STATE_MASK) | (newState << NUM_BITS_TO_SHIFT_FOR_STATE);
     }
     static uint64_t updateStateAndIncrementVersion(uint64_t oldStateAndVersion, uint64_t newState) {
-        return (((oldStateAndVersion << 8) >> 8) + 1) | (newState << NUM_BITS_TO_SHIFT_FOR_STATE);
+        // The version wraps around within its own bits so it never carries into the flags.
+        return (oldStateAndVersion & FLAGS_MASK) | ((oldStateAndVersion + 1) & VERSION_MASK) |
+               (newState << NUM_BITS_TO_SHIFT_FOR_STATE);
     }
     void spinLock(uint64_t oldStateAndVersion) {
         while (true) {
@@ -83,6 +89,24 @@ public:
     // Should not be used if other threads are modifying the page state
     void clearDirtyWithoutLock() { stateAndVersion &= ~DIRTY_MASK; }
     bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+
+    static bool isReferenced(uint64_t stateAndVersion) {
+        return stateAndVersion & REFERENCED_MASK;
+    }
+    void setReferenced() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= REFERENCED_MASK;
+    }
+    void clearReferenced() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion &= ~REFERENCED_MASK;
+    }
+    // Sets the referenced bit of an unlocked page, unless its state or version has changed.
+    bool trySetReferenced(uint64_t oldStateAndVersion) {
+        KU_ASSERT(getState(oldStateAndVersion) == UNLOCKED);
+        return stateAndVersion.compare_exchange_strong(oldStateAndVersion,
+            oldStateAndVersion | REFERENCED_MASK);
+    }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     void resetToEvicted() {
@@ -104,8 +128,8 @@ public:
 #endif
 
 private:
-    // Highest 1 bit is dirty bit, and the rest are page state and version bits.
-    // In the rest bits, the lowest 1 byte is state, and the rest are version.
+    // Highest 1 byte is the page state, the next bit is the dirty bit, the one after it is the
+    // referenced bit, and the lowest 54 bits are the page version.
     std::atomic<uint64_t> stateAndVersion;
 #if BM_MALLOC
     std::unique_ptr<uint8_t[]> page;
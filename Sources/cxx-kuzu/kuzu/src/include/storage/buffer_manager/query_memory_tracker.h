@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace storage {
+
+struct OperatorMemoryUsage {
+    std::atomic<uint64_t> usedMemory{0};
+    std::atomic<uint64_t> peakMemory{0};
+};
+
+// Accounts for the memory buffers allocated by the tasks of a query, in total and per sink operator
+// of the pipeline that allocated them (e.g. the hash table of a join build, the factorized table of
+// an aggregate or the blocks of an order by), and enforces the memory limit of the query.
+// Buffers keep the tracker alive, so memory that outlives the query, e.g. its result, is still
+// released from the tracker it was charged to.
+class QueryMemoryTracker {
+public:
+    // A limit of 0 means the memory of the query is only limited by the buffer pool.
+    explicit QueryMemoryTracker(uint64_t memoryLimit) : memoryLimit{memoryLimit} {}
+
+    // Throws if the query would exceed its memory limit, unless the limit is not enforced, e.g. for
+    // buffers that are loaded back after being spilled.
+    void allocate(uint64_t size, OperatorMemoryUsage* operatorUsage, bool enforceLimit = true);
+    void free(uint64_t size, OperatorMemoryUsage* operatorUsage);
+
+    OperatorMemoryUsage* getOperatorUsage(uint32_t operatorID);
+
+    uint64_t getUsedMemory() const { return usedMemory.load(std::memory_order_relaxed); }
+    uint64_t getPeakMemory() const { return peakMemory.load(std::memory_order_relaxed); }
+    // Returns 0 for operators which did not allocate buffers.
+    uint64_t getOperatorPeakMemory(uint32_t operatorID) const;
+
+private:
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> usedMemory{0};
+    std::atomic<uint64_t> peakMemory{0};
+    mutable std::mutex mtx;
+    std::map<uint32_t, std::unique_ptr<OperatorMemoryUsage>> operatorUsages;
+};
+
+// Attributes the buffers allocated by the current thread to an operator of a query for as long as
+// the scope is alive.
+class MemoryTrackerScope {
+public:
+    MemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker, uint32_t operatorID);
+    MemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker,
+        OperatorMemoryUsage* operatorUsage);
+    DELETE_COPY_AND_MOVE(MemoryTrackerScope);
+    ~MemoryTrackerScope();
+
+    // Returns nullptr if the current thread is not running a task of a tracked query.
+    static const MemoryTrackerScope* getCurrent();
+
+    const std::shared_ptr<QueryMemoryTracker>& getTracker() const { return tracker; }
+    OperatorMemoryUsage* getOperatorUsage() const { return operatorUsage; }
+
+private:
+    std::shared_ptr<QueryMemoryTracker> tracker;
+    OperatorMemoryUsage* operatorUsage;
+    const MemoryTrackerScope* previous;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace storage {
+
+class MemoryManager;
+
+// Allocates the small blocks of containers using MmAllocator from slabs, each of which holds blocks
+// of one size class. Memory is reserved from the buffer manager a slab at a time instead of a block
+// at a time, so that allocating small blocks doesn't contend on its memory counters. Slabs are kept
+// by shards, each thread allocating from its own shard. A block can be freed by any thread: slabs
+// are aligned to their size, so the slab of a block is found from its address. A slab whose blocks
+// are all freed is released, except for one per shard and size class, which is kept to avoid
+// reserving memory again for the next allocation of its size class.
+class SlabAllocator {
+public:
+    static constexpr uint64_t SLAB_SIZE = 64 * 1024;
+    static constexpr uint64_t MIN_BLOCK_SIZE = 16;
+    static constexpr uint64_t MAX_BLOCK_SIZE = 2048;
+    static constexpr uint64_t NUM_SIZE_CLASSES = 8;
+    static constexpr uint64_t NUM_SHARDS = 16;
+
+    explicit SlabAllocator(MemoryManager& mm) : mm{mm} {}
+    DELETE_COPY_AND_MOVE(SlabAllocator);
+    ~SlabAllocator();
+
+    static bool isSmall(uint64_t size) { return size <= MAX_BLOCK_SIZE; }
+
+    uint8_t* allocate(uint64_t size);
+    void free(uint8_t* block, uint64_t size);
+
+private:
+    struct Shard;
+
+    // Stored at the start of the slab, before its blocks.
+    struct Slab {
+        Shard* shard;
+        uint64_t sizeClassIdx;
+        // Blocks before numCarvedBlocks have been handed out at least once; the freed ones are
+        // linked through their first bytes.
+        uint8_t* freeBlocks = nullptr;
+        uint64_t numCarvedBlocks = 0;
+        uint64_t numLiveBlocks = 0;
+        // Links of the list of the slabs of the shard which have free blocks.
+        Slab* prev = nullptr;
+        Slab* next = nullptr;
+
+        Slab(Shard* shard, uint64_t sizeClassIdx) : shard{shard}, sizeClassIdx{sizeClassIdx} {}
+    };
+    static constexpr uint64_t SLAB_HEADER_SIZE = 64;
+    static_assert(sizeof(Slab) <= SLAB_HEADER_SIZE);
+
+    struct alignas(64) Shard {
+        std::mutex mtx;
+        std::array<Slab*, NUM_SIZE_CLASSES> slabsWithFreeBlocks{};
+        std::array<Slab*, NUM_SIZE_CLASSES> emptySlabs{};
+    };
+
+    static uint64_t getSizeClassIdx(uint64_t size);
+    static uint64_t getBlockSize(uint64_t sizeClassIdx) { return MIN_BLOCK_SIZE << sizeClassIdx; }
+    static uint64_t getNumBlocksPerSlab(uint64_t sizeClassIdx) {
+        return (SLAB_SIZE - SLAB_HEADER_SIZE) / getBlockSize(sizeClassIdx);
+    }
+
+    Shard& getShard();
+    Slab* allocateSlab(Shard& shard, uint64_t sizeClassIdx);
+    void releaseSlab(Slab* slab);
+
+    static void pushSlab(Slab*& head, Slab* slab);
+    static void removeSlab(Slab*& head, Slab* slab);
+
+private:
+    MemoryManager& mm;
+    std::array<Shard, NUM_SHARDS> shards;
+};
+
+} // namespace storage
+} // namespace kuzu
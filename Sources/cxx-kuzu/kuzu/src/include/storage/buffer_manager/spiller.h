@@ -21,10 +21,16 @@ public:
     void clearUnusedChunk(InMemChunkedNodeGroup* nodeGroup);
     SpillResult spillToDisk(ColumnChunkData& chunk) const;
     void loadFromDisk(ColumnChunkData& chunk) const;
+    // Appends the buffer to the end of the spill file and returns its position in the file. The
+    // caller owns the buffer and is responsible for freeing its memory.
+    uint64_t spillToDisk(std::span<const uint8_t> buffer) const;
+    void loadFromDisk(std::span<uint8_t> buffer, uint64_t filePosition) const;
     // reclaims memory from the next full partitioner group in the set
     // and returns the amount of memory reclaimed
     // If the set is empty, returns zero
     SpillResult claimNextGroup();
+    // Estimated memory of the full partitioner groups that can be spilled.
+    uint64_t getUnusedChunksMemory() const { return unusedChunksMemory; }
     // Must only be used once all chunks have been loaded from disk.
     void clearFile();
     ~Spiller();
@@ -38,6 +44,7 @@ private:
     BufferManager& bufferManager;
     common::VirtualFileSystem* vfs;
     std::unordered_set<InMemChunkedNodeGroup*> fullPartitionerGroups;
+    std::atomic<uint64_t> unusedChunksMemory;
     std::atomic<FileHandle*> dataFH;
     std::mutex partitionerGroupsMtx;
     mutable std::mutex fileCreationMutex;
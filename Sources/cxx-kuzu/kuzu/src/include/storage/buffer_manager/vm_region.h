@@ -17,7 +17,10 @@ class VMRegion {
     friend class BufferManager;
 
 public:
-    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize);
+    // If useHugePages is true, the region is aligned to huge pages and backed by transparent huge
+    // pages where the OS supports them (Linux only), so that frames are faulted in 2MB at a time.
+    VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+        bool useHugePages = false);
     ~VMRegion();
 
     common::frame_group_idx_t addNewFrameGroup();
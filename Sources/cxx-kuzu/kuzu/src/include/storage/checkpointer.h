@@ -38,6 +38,9 @@ public:
 
     static bool canAutoCheckpoint(const main::ClientContext& clientContext,
         const transaction::Transaction& transaction);
+    // Returns true if the WAL has grown so much that an auto checkpoint can no longer be deferred
+    // until the system is idle.
+    static bool mustAutoCheckpoint(const main::ClientContext& clientContext);
 
 protected:
     virtual bool checkpointStorage();
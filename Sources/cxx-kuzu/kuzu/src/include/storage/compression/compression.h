@@ -11,6 +11,7 @@
 #include "common/null_mask.h"
 #include "common/numeric_utils.h"
 #include "common/types/types.h"
+#include "storage/compression/fsst.h"
 #include <span>
 
 namespace kuzu {
@@ -118,6 +119,10 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    DELTA_BITPACKING = 5,
+    // Dictionary string data; values are stored as bytes, but must be decoded with the symbol
+    // table in the FSSTMetadata
+    FSST = 6,
 };
 
 struct ExtraMetadata {
@@ -141,6 +146,35 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+// used only for delta compressing integers
+struct DeltaMetadata : ExtraMetadata {
+    DeltaMetadata() : minDelta(0), bitWidth(0) {}
+    DeltaMetadata(uint64_t minDelta, uint8_t bitWidth) : minDelta(minDelta), bitWidth(bitWidth) {}
+
+    // Smallest difference between consecutive values (two's complement, truncated to the width of
+    // the type), which is subtracted from every difference before bitpacking it.
+    uint64_t minDelta;
+    uint8_t bitWidth;
+
+    void serialize(common::Serializer& serializer) const;
+    static DeltaMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
+// used only for the string data of dictionaries
+struct FSSTMetadata : ExtraMetadata {
+    FSSTMetadata() = default;
+    explicit FSSTMetadata(FSSTSymbolTable symbolTable) : symbolTable(std::move(symbolTable)) {}
+
+    FSSTSymbolTable symbolTable;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -193,6 +227,12 @@ struct KUZU_API CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    inline const DeltaMetadata* deltaMetadata() const {
+        return common::ku_dynamic_cast<const DeltaMetadata*>(getExtraMetadata());
+    }
+    inline const FSSTMetadata* fsstMetadata() const {
+        return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+    }
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
@@ -389,6 +429,13 @@ public:
         uint64_t dstOffset, uint64_t numValues,
         const struct CompressionMetadata& metadata) const final;
 
+    // Sets dstBuffer[dstOffset + i] to whether the i-th packed value is in [packedMin, packedMax].
+    // The values are compared as they are packed, i.e. relative to the frame of reference offset,
+    // which is not added back.
+    void selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const BitpackInfo<T>& info, T packedMin,
+        T packedMax) const;
+
     static bool canUpdateInPlace(std::span<const T> value, const CompressionMetadata& metadata,
         const std::optional<common::NullMask>& nullMask = std::nullopt,
         uint64_t nullMaskOffset = 0);
@@ -420,6 +467,58 @@ protected:
         const BitpackInfo<T>& header) const;
 };
 
+template<typename T>
+concept DeltaBitpackingType = IntegerBitpackingType<T> && (sizeof(T) <= sizeof(uint64_t));
+
+// Delta encoding for monotone or nearly sorted integers, such as CSR offsets and sorted internal
+// IDs. Values are stored in blocks of CHUNK_SIZE values: each block starts with its first value,
+// followed by the differences between consecutive values minus the smallest difference in the
+// chunk, bitpacked with fastpfor. A block is self-contained, so decompression starting at any
+// offset only needs to decode the block containing it.
+// Updates are never done in place since they change the following differences.
+template<DeltaBitpackingType T>
+class DeltaBitpacking : public CompressionAlg {
+    using U = common::numeric_utils::MakeUnSignedT<T>;
+
+public:
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+public:
+    DeltaBitpacking() = default;
+    DeltaBitpacking(const DeltaBitpacking&) = default;
+
+    // Computes the smallest delta and the bitwidth needed to store the deltas of the given values
+    static DeltaMetadata getDeltaInfo(std::span<const T> values);
+
+    static uint64_t getNumBytesPerBlock(uint8_t bitWidth) {
+        return sizeof(U) + CHUNK_SIZE * bitWidth / 8;
+    }
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+        return dataSize / getNumBytesPerBlock(metadata.deltaMetadata()->bitWidth) * CHUNK_SIZE;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override {
+        return CompressionType::DELTA_BITPACKING;
+    }
+
+private:
+    // Decodes one block into CHUNK_SIZE values.
+    void decompressBlock(const uint8_t* block, U* dst, const DeltaMetadata& metadata) const;
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Symbol table for FSST (Fast Static Symbol Table) string compression.
+// Up to 255 frequently occurring byte sequences of 1 to 8 bytes are replaced by one byte codes;
+// bytes not covered by any symbol are written as the escape code followed by the byte itself.
+// Each string is encoded independently, so strings can be decoded individually, and equal strings
+// always have equal encodings.
+class FSSTSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr uint32_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint32_t MAX_SYMBOL_LENGTH = 8;
+
+    FSSTSymbolTable() = default;
+
+    // Builds a symbol table for the given sample of strings.
+    static FSSTSymbolTable build(std::span<const std::string_view> sample);
+
+    // Appends the encoding of value to result.
+    void encode(std::string_view value, std::vector<uint8_t>& result) const;
+
+    uint64_t getDecodedLength(const uint8_t* data, uint64_t length) const;
+    // Decodes [data, data + length) into result, which must have space for getDecodedLength bytes,
+    // and returns the decoded length.
+    uint64_t decode(const uint8_t* data, uint64_t length, uint8_t* result) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTSymbolTable deserialize(common::Deserializer& deserializer);
+
+private:
+    struct Symbol {
+        uint64_t value;
+        uint8_t length;
+
+        std::string_view get() const {
+            return std::string_view(reinterpret_cast<const char*>(&value), length);
+        }
+    };
+
+    void addSymbol(std::string_view symbol);
+    // Returns the code of the longest symbol data starts with, or ESCAPE_CODE if there is none.
+    uint8_t findLongestSymbol(const uint8_t* data, uint64_t length) const;
+
+private:
+    std::vector<Symbol> symbols;
+    // Codes of the symbols starting with each byte, longest first.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace storage {
+
+struct BackupStats {
+    uint64_t numPagesCopied = 0;
+    uint64_t numFreePagesSkipped = 0;
+    uint64_t numWALBytesCopied = 0;
+};
+
+// Copies a database while it stays open for reads and writes. The database file is copied as of
+// its last checkpoint, which is not rewritten until the copy is done since checkpoints are pinned
+// meanwhile, and the WAL is copied up to the last commit before the copy started. Opening the copy
+// replays the WAL, so the copy has the contents of the database at the start of the backup. Pages
+// that the free space manager holds are skipped, so they are left as holes in the copy.
+class DatabaseBackup {
+public:
+    // The copy is written to the destination path, and its WAL next to it. Copying is throttled to
+    // the given number of bytes per second, unless it is 0.
+    static BackupStats backup(main::ClientContext& context, const std::string& destinationPath,
+        uint64_t maxBytesPerSecond);
+    // Ships the WAL to the destination path up to the last commit, so that the copies backed up
+    // since the last checkpoint can be kept up to date with it (see
+    // StorageManager::replayShippedWAL). The WAL only grows until the next checkpoint, so only the
+    // part appended since the last time it was shipped to the destination is copied; a WAL of an
+    // earlier checkpoint at the destination is overwritten. Returns the number of bytes copied.
+    static uint64_t shipWAL(main::ClientContext& context, const std::string& destinationPath);
+
+private:
+    // Number of pages read and written at a time.
+    static constexpr common::page_idx_t COPY_BATCH_NUM_PAGES = 64;
+    // Number of bytes at the start of the WAL, which include its header, compared to tell whether
+    // the WAL at the destination is a prefix of this one.
+    static constexpr uint64_t WAL_PREFIX_SIZE = 4096;
+};
+
+} // namespace storage
+} // namespace kuzu
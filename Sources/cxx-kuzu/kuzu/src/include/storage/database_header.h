@@ -16,6 +16,10 @@ struct DatabaseHeader {
     // An ID that is unique between kuzu databases
     // Used to ensure that files such as the WAL match the current database
     common::ku_uuid_t databaseID{0};
+    // An ID that is regenerated by every checkpoint. It is also written to the header of the WAL,
+    // so that a WAL shipped from another copy of the database can be checked to continue from the
+    // same checkpoint as this one.
+    common::ku_uuid_t checkpointID{0};
 
     void updateCatalogPageRange(PageManager& pageManager, PageRange newPageRange);
     void freeMetadataPageRange(PageManager& pageManager) const;
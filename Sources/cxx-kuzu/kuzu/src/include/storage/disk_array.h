@@ -113,6 +113,11 @@ public:
         transaction::TransactionType trxType = transaction::TransactionType::READ_ONLY);
 
     void get(uint64_t idx, const transaction::Transaction* transaction, std::span<std::byte> val);
+    // Reads the elements at the given indices, which must be in ascending order, one after another
+    // into vals. Elements which are on the same page are read with a single read of the page, and
+    // the pages are prefetched before any of them is read.
+    void get(std::span<const uint64_t> idxs, const transaction::Transaction* transaction,
+        std::span<std::byte> vals);
 
     // Note: This function is to be used only by the WRITE trx.
     void update(const transaction::Transaction* transaction, uint64_t idx,
@@ -282,6 +287,14 @@ public:
         return val;
     }
 
+    // The indices must be in ascending order.
+    inline void get(std::span<const uint64_t> idxs, const transaction::Transaction* transaction,
+        std::span<U> vals) {
+        KU_ASSERT(idxs.size() == vals.size());
+        diskArray.get(idxs, transaction,
+            std::span(reinterpret_cast<std::byte*>(vals.data()), vals.size() * sizeof(U)));
+    }
+
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(PageAllocator& pageAllocator,
         const transaction::Transaction* transaction, uint64_t newNumElements) {
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// SECOND_CHANCE keeps every cached page in a single eviction queue and gives recently read pages a
+// second chance before evicting them. TWO_QUEUE additionally keeps pages pinned with
+// PageReadPolicy::READ_PAGE_ONCE in a small probationary queue. Those pages are evicted first and
+// without a second chance, unless they are read again, in which case they are promoted to the main
+// queue. This prevents large scans from flushing hot pages out of the buffer pool (2Q).
+enum class EvictionPolicy : uint8_t { SECOND_CHANCE = 0, TWO_QUEUE = 1 };
+
+} // namespace storage
+} // namespace kuzu
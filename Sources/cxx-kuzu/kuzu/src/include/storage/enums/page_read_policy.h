@@ -5,7 +5,9 @@
 namespace kuzu {
 namespace storage {
 
-enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
+// READ_PAGE_ONCE reads the page like READ_PAGE, but hints that the page is unlikely to be read
+// again soon, e.g. because it is read by a sequential scan. See EvictionPolicy::TWO_QUEUE.
+enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1, READ_PAGE_ONCE = 2 };
 
 } // namespace storage
 } // namespace kuzu
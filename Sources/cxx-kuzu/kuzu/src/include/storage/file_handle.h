@@ -13,10 +13,12 @@
 #include "common/copy_constructors.h"
 #include "common/file_system/file_info.h"
 #include "common/types/types.h"
+#include "storage/buffer_manager/file_io_stats.h"
 #include "storage/buffer_manager/page_state.h"
 #include "storage/buffer_manager/vm_region.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/page_manager.h"
+#include "storage/page_range.h"
 
 namespace kuzu {
 namespace main {
@@ -48,6 +50,12 @@ public:
     // createIfNotExistsMask only applies to existing db files; tmp i-memory files are not created
     constexpr static uint8_t createIfNotExistsMask{0b0000'0100}; // represents 3rd LSB
     constexpr static uint8_t isReadOnlyMask{0b0000'1000};        // represents 4th LSB
+    // Only applies to read-only files, which are then memory mapped if possible and read from the
+    // mapping instead of through the buffer manager.
+    constexpr static uint8_t mapReadOnlyMask{0b0001'0000}; // represents 5th LSB
+    // The file is opened with direct I/O, and the buffer manager reads ahead into its own frames
+    // since the OS no longer does.
+    constexpr static uint8_t directIOMask{0b0010'0000}; // represents 6th LSB
     constexpr static uint8_t isLockRequiredMask{0b1000'0000};    // represents 8th LSB
 
     // READ_ONLY subsumes DEFAULT_PAGED, PERSISTENT, and NO_CREATE.
@@ -61,12 +69,16 @@ public:
         common::VirtualFileSystem* vfs, main::ClientContext* context);
     // File handles are registered with the buffer manager and must not be moved or copied
     DELETE_COPY_AND_MOVE(FileHandle);
+    ~FileHandle();
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageReadPolicy readPolicy = PageReadPolicy::READ_PAGE);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
+    // Hints that the given pages will be read soon. See BufferManager::prefetch.
+    void prefetchPages(const PageRange& pageRange);
 
     // This function assumes the page is already LOCKED.
     void setLockedPageDirty(common::page_idx_t pageIdx) {
@@ -87,11 +99,7 @@ public:
     void removePageFromFrameIfNecessary(common::page_idx_t pageIdx);
     void flushAllDirtyPagesInFrames();
 
-    void readPageFromDisk(uint8_t* frame, common::page_idx_t pageIdx) const {
-        KU_ASSERT(!isInMemoryMode());
-        KU_ASSERT(pageIdx < numPages);
-        fileInfo->readFromFile(frame, getPageSize(), pageIdx * getPageSize());
-    }
+    void readPageFromDisk(uint8_t* frame, common::page_idx_t pageIdx) const;
     void writePageToFile(const uint8_t* buffer, common::page_idx_t pageIdx) {
         KU_ASSERT(pageIdx < numPages);
         writePagesToFile(buffer, getPageSize(), pageIdx);
@@ -99,10 +107,15 @@ public:
     void writePagesToFile(const uint8_t* buffer, uint64_t size, common::page_idx_t startPageIdx);
 
     bool isInMemoryMode() const { return !isLargePaged() && isNewTmpFile(); }
+    // Pages of memory mapped files are read from the mapping, and are never pinned in frames.
+    bool isMemoryMapped() const { return mappedData != nullptr; }
 
     common::page_idx_t getNumPages() const { return numPages; }
     common::FileInfo* getFileInfo() const { return fileInfo.get(); }
-    void resetFileInfo() { fileInfo.reset(); }
+    void resetFileInfo() {
+        unmapFile();
+        fileInfo.reset();
+    }
 
     uint64_t getPageSize() const {
         return isLargePaged() ? common::TEMP_PAGE_SIZE : common::KUZU_PAGE_SIZE;
@@ -110,17 +123,27 @@ public:
 
     PageManager* getPageManager() { return pageManager.get(); }
 
+    FileIOStats& getIOStats() const { return ioStats; }
+
 private:
     bool isLargePaged() const { return fhFlags & isLargePagedMask; }
     bool isNewTmpFile() const { return fhFlags & isNewInMemoryTmpFileMask; }
     bool isReadOnlyFile() const { return fhFlags & isReadOnlyMask; }
     bool createFileIfNotExists() const { return fhFlags & createIfNotExistsMask; }
     bool isLockRequired() const { return fhFlags & isLockRequiredMask; }
+    bool shouldMapReadOnly() const { return fhFlags & mapReadOnlyMask; }
+    bool isDirectIO() const { return fhFlags & directIOMask; }
 
     common::page_idx_t addNewPageWithoutLock();
     void constructPersistentFileHandle(const std::string& path, common::VirtualFileSystem* vfs,
         main::ClientContext* context);
     void constructTmpFileHandle(const std::string& path);
+    void unmapFile();
+    uint8_t* getMappedPage(common::page_idx_t pageIdx) const {
+        KU_ASSERT(pageIdx < numPages);
+        // The pages are mapped read-only, so writing to them is never allowed.
+        return const_cast<uint8_t*>(mappedData) + pageIdx * getPageSize();
+    }
     common::frame_idx_t getFrameIdx(common::page_idx_t pageIdx) {
         KU_ASSERT(pageIdx < pageCapacity);
         return (frameGroupIdxes[pageIdx >> common::StorageConstants::PAGE_GROUP_SIZE_LOG2]
@@ -166,6 +189,9 @@ private:
     common::ConcurrentVector<common::page_group_idx_t> frameGroupIdxes;
 
     std::unique_ptr<PageManager> pageManager;
+    mutable FileIOStats ioStats;
+    const uint8_t* mappedData = nullptr;
+    uint64_t mappedSize = 0;
 };
 
 } // namespace storage
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "common/types/value/value.h"
+#include "storage/index/index.h"
+
+namespace kuzu {
+namespace common {
+struct BufferReader;
+} // namespace common
+
+namespace storage {
+class NodeTable;
+
+enum class AggregateViewFunc : uint8_t {
+    COUNT = 0,
+    SUM = 1,
+    MIN = 2,
+    MAX = 3,
+};
+
+struct AggregateViewFuncUtils {
+    static std::string toString(AggregateViewFunc func);
+    // Throws if the name is not COUNT, SUM, MIN or MAX.
+    static AggregateViewFunc fromString(const std::string& name);
+};
+
+struct AggregateViewAuxInfo final : catalog::IndexAuxInfo {
+    AggregateViewFunc func;
+
+    explicit AggregateViewAuxInfo(AggregateViewFunc func) : func{func} {}
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+    static std::unique_ptr<AggregateViewAuxInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+
+    std::unique_ptr<IndexAuxInfo> copy() override {
+        return std::make_unique<AggregateViewAuxInfo>(func);
+    }
+
+    std::string toCypher(const catalog::IndexCatalogEntry& indexEntry,
+        const catalog::ToCypherInfo& info) const override;
+};
+
+struct AggregateViewStorageInfo final : IndexStorageInfo {
+    AggregateViewFunc func;
+
+    explicit AggregateViewStorageInfo(AggregateViewFunc func) : func{func} {}
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+};
+
+// The result of `MATCH (n:T) RETURN n.group, FUNC(n.value)` for a node table, kept in memory so
+// that polling the aggregate looks the groups up instead of scanning and aggregating the table.
+// COUNT counts the nodes of a group when there is no value property, and the non-null values
+// otherwise. SUM, MIN and MAX take integer or floating point values, and give INT64 or DOUBLE.
+//
+// The groups are computed by the first read-only transaction reading the view, and kept as long as
+// they can be maintained: committed inserts are applied to the groups as deltas, while updates of
+// the properties of the view and deletions of committed nodes, as well as COPY, drop the groups
+// until a reader computes them again. Transactions which started before the last change applied
+// to the groups, and write transactions, compute the aggregate from the table instead.
+class AggregateView final : public Index {
+public:
+    static constexpr const char* TYPE_NAME = "AGGREGATE_VIEW";
+
+    struct Group {
+        common::Value key;
+        // Nodes in the group, and those with a non-null value.
+        uint64_t numNodes = 0;
+        uint64_t numValues = 0;
+        int64_t intValue = 0;
+        double doubleValue = 0;
+
+        explicit Group(common::Value key) : key{std::move(key)} {}
+    };
+
+    AggregateView(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+        NodeTable& nodeTable);
+
+    static bool isSupportedGroupType(const common::LogicalType& dataType);
+    static bool isSupportedValueType(const common::LogicalType& dataType);
+    static common::LogicalType getResultType(AggregateViewFunc func,
+        const common::LogicalType* valueType);
+
+    AggregateViewFunc getFunc() const { return func; }
+    bool hasValueColumn() const { return indexInfo.columnIDs.size() == 2; }
+
+    // Returns the groups of the nodes visible to the transaction.
+    std::vector<Group> getGroups(main::ClientContext* context);
+    static void writeResult(const Group& group, AggregateViewFunc func, bool hasValueColumn,
+        common::ValueVector& vector, uint32_t pos);
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext*, visible_func) override {
+        // Inserted nodes are added to the groups once they are committed.
+        return std::make_unique<InsertState>();
+    }
+    bool needCommitInsert() const override { return true; }
+    void commitInsert(transaction::Transaction* transaction,
+        const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors, InsertState& insertState) override;
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext*, common::column_id_t,
+        visible_func) override {
+        return std::make_unique<UpdateState>();
+    }
+    void update(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        common::ValueVector& propertyVector, UpdateState& updateState) override;
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction*, MemoryManager*,
+        visible_func) override {
+        return std::make_unique<DeleteState>();
+    }
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
+    // Drops the groups, since COPY appends to the committed nodes directly.
+    void finalize(main::ClientContext* context) override;
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
+
+    static IndexType getIndexType() {
+        static const IndexType AGGREGATE_VIEW_TYPE{TYPE_NAME,
+            IndexConstraintType::SECONDARY_NON_UNIQUE, IndexDefinitionType::BUILTIN, load};
+        return AGGREGATE_VIEW_TYPE;
+    }
+
+private:
+    struct KeyHash {
+        size_t operator()(const common::Value& key) const { return key.computeHash(); }
+    };
+    using group_map_t = std::unordered_map<common::Value, Group, KeyHash>;
+
+    group_map_t computeGroups(transaction::Transaction* transaction,
+        MemoryManager* memoryManager) const;
+    void addNode(group_map_t& groups, const common::ValueVector& groupVector,
+        const common::ValueVector* valueVector, uint32_t pos) const;
+    void invalidateNoLock();
+
+private:
+    std::mutex mtx;
+    NodeTable& nodeTable;
+    AggregateViewFunc func;
+    bool valid;
+    group_map_t groups;
+    // Commit timestamp of the last change applied to the groups.
+    common::transaction_t version;
+    // Advanced by every change to the table which the groups may not reflect, so that groups
+    // computed from a snapshot are only kept if nothing changed while they were computed.
+    uint64_t epoch;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 #include <string_view>
 #include <type_traits>
 
@@ -15,9 +16,11 @@
 #include "index.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/disk_array_collection.h"
+#include "storage/index/hash_index_bloom_filter.h"
 #include "storage/index/hash_index_utils.h"
 #include "storage/index/in_mem_hash_index.h"
 #include "storage/local_storage/local_hash_index.h"
+#include "storage/page_range.h"
 
 namespace kuzu {
 namespace common {
@@ -47,6 +50,12 @@ public:
     virtual void reclaimStorage(PageAllocator& pageAllocator) = 0;
     virtual bool tryLock() = 0;
     virtual std::unique_lock<std::shared_mutex> adoptLock() = 0;
+
+    // Builds, resizes or drops the bloom filter of the persistent index after a checkpoint.
+    // Returns true if the filter was replaced or dropped.
+    virtual bool checkpointBloomFilter(bool enabled) = 0;
+    virtual const HashIndexBloomFilter* getBloomFilter() const = 0;
+    virtual void setBloomFilter(std::unique_ptr<HashIndexBloomFilter> filter) = 0;
 };
 
 // HashIndex is the entrance to handle all updates and lookups into the index after building from
@@ -110,6 +119,26 @@ public:
         KU_ASSERT(localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST);
         return lookupInPersistentIndex(transaction, key, result, isVisible);
     }
+    // Looks up a batch of keys the same way, setting results[i] to the offset of keys[i], or to
+    // INVALID_OFFSET if it isn't found.
+    void lookupBatchInternal(const transaction::Transaction* transaction,
+        std::span<const Key> keys, std::span<common::offset_t> results,
+        const visible_func& isVisible) {
+        KU_ASSERT(keys.size() == results.size());
+        std::vector<uint32_t> persistentKeyIdxs;
+        for (auto i = 0u; i < keys.size(); i++) {
+            auto localLookupState = localStorage->lookup(keys[i], results[i], isVisible);
+            if (localLookupState == HashIndexLocalLookupState::KEY_FOUND) {
+                continue;
+            }
+            results[i] = common::INVALID_OFFSET;
+            if (localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST) {
+                persistentKeyIdxs.push_back(i);
+            }
+        }
+        lookupBatchInPersistentIndex(transaction, keys, std::move(persistentKeyIdxs), results,
+            isVisible);
+    }
 
     // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
     // in the persistent storage and directly delete keys in the local storage.
@@ -175,6 +204,12 @@ public:
     void rollbackCheckpoint() override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
 
+    bool checkpointBloomFilter(bool enabled) override;
+    const HashIndexBloomFilter* getBloomFilter() const override { return bloomFilter.get(); }
+    void setBloomFilter(std::unique_ptr<HashIndexBloomFilter> filter) override {
+        bloomFilter = std::move(filter);
+    }
+
 private:
     bool lookupInPersistentIndex(const transaction::Transaction* transaction, Key key,
         common::offset_t& result, visible_func isVisible) {
@@ -186,6 +221,10 @@ private:
             return false;
         }
         auto hashValue = HashIndexUtils::hash(key);
+        // Most lookups of keys which don't exist (e.g. when merging new keys) end here
+        if (bloomFilter && !bloomFilter->mayContain(hashValue)) {
+            return false;
+        }
         auto fingerprint = HashIndexUtils::getFingerprintForHash(hashValue);
         auto iter = getSlotIterator(HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
             transaction);
@@ -196,9 +235,20 @@ private:
                 result = iter.slot.entries[entryPos].value;
                 return true;
             }
+            if (iter.slotInfo.slotType == SlotType::PRIMARY &&
+                !iter.slot.mayHaveOverflowFingerprint(fingerprint)) {
+                return false;
+            }
         } while (nextChainedSlot(transaction, iter));
         return false;
     }
+    // Instead of walking the slot chain of each key in turn, the keys are sorted by the slot they
+    // are in, each slot is read once for all of its keys, and the slots on the same page are read
+    // together. Keys which continue into overflow slots are then looked up the same way, one level
+    // of the chains at a time.
+    void lookupBatchInPersistentIndex(const transaction::Transaction* transaction,
+        std::span<const Key> keys, std::vector<uint32_t> keyIdxs,
+        std::span<common::offset_t> results, const visible_func& isVisible);
     void deleteFromPersistentIndex(const transaction::Transaction* transaction, Key key,
         visible_func isVisible);
 
@@ -297,6 +347,8 @@ private:
     std::vector<std::pair<SlotInfo, OnDiskSlotType>> getChainedSlots(
         const transaction::Transaction* transaction, slot_id_t pSlotId);
 
+    void rebuildBloomFilter(const transaction::Transaction* transaction);
+
 private:
     ShadowFile* shadowFile;
     uint64_t headerPageIdx;
@@ -307,6 +359,8 @@ private:
     const HashIndexHeader& indexHeaderForReadTrx;
     HashIndexHeader& indexHeaderForWriteTrx;
     MemoryManager& memoryManager;
+    // Covers every key in the persistent index; keys are added as they are merged on checkpoint.
+    std::unique_ptr<HashIndexBloomFilter> bloomFilter;
 };
 
 template<>
@@ -320,6 +374,9 @@ bool HashIndex<common::ku_string_t>::equals(const transaction::Transaction* tran
 struct PrimaryKeyIndexStorageInfo final : IndexStorageInfo {
     common::page_idx_t firstHeaderPage;
     common::page_idx_t overflowHeaderPage;
+    // Written after the other fields, and only read if present, so that indexes stored without
+    // bloom filters can still be read.
+    PageRange bloomFilterPages;
 
     PrimaryKeyIndexStorageInfo()
         : firstHeaderPage{common::INVALID_PAGE_IDX}, overflowHeaderPage{common::INVALID_PAGE_IDX} {}
@@ -334,6 +391,8 @@ struct PrimaryKeyIndexStorageInfo final : IndexStorageInfo {
         auto serializer = common::Serializer(bufferWriter);
         serializer.write<common::page_idx_t>(firstHeaderPage);
         serializer.write<common::page_idx_t>(overflowHeaderPage);
+        serializer.write<common::page_idx_t>(bloomFilterPages.startPageIdx);
+        serializer.write<common::page_idx_t>(bloomFilterPages.numPages);
         return bufferWriter;
     }
 
@@ -388,6 +447,12 @@ public:
 
     bool lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result, visible_func isVisible);
+    // Looks up the keys at the given positions of the vector, setting results[i] to the offset of
+    // the key at positions[i], or to INVALID_OFFSET if it isn't found. Keys are grouped by the hash
+    // index they belong to and each group is looked up as a batch.
+    void lookup(const transaction::Transaction* trx, const common::ValueVector& keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results,
+        const visible_func& isVisible);
 
     std::unique_ptr<Index::InsertState> initInsertState(main::ClientContext*,
         visible_func isVisible) override {
@@ -473,7 +538,7 @@ public:
         KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
         return indexInfo.keyDataTypes[0];
     }
-    void reclaimStorage(PageAllocator& pageAllocator) const;
+    void reclaimStorage(PageAllocator& pageAllocator) const override;
 
     static KUZU_API std::unique_ptr<Index> load(main::ClientContext* context,
         StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
@@ -486,6 +551,9 @@ public:
 
 private:
     void writeHeaders(PageAllocator& pageAllocator) const;
+    void checkpointBloomFilters(main::ClientContext* context, PageAllocator& pageAllocator,
+        bool indexChanged);
+    void readBloomFilters(PageAllocator& pageAllocator);
 
     void initOverflowAndSubIndices(bool inMemMode, MemoryManager& mm, PageAllocator& pageAllocator,
         PrimaryKeyIndexStorageInfo& storageInfo);
@@ -502,6 +570,9 @@ private:
     ShadowFile& shadowFile;
     // Stores both primary and overflow slots
     std::unique_ptr<DiskArrayCollection> hashIndexDiskArrays;
+    bool inMemMode;
+    // Bloom filter pages of the last successful checkpoint, restored if a checkpoint is rolled back
+    PageRange bloomFilterPagesForReadTrx;
 };
 
 } // namespace storage
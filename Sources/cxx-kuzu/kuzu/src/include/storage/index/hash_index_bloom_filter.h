@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Bloom filter over the hashes of the keys stored in the persistent part of a hash index, used to
+// answer lookups of keys which are not in the index without reading any slots.
+// The filter is blocked: all bits of a key are set in one 64-bit word, so a lookup touches a single
+// word. Keys are only ever added; deleted keys stay in the filter, which only causes false
+// positives.
+class HashIndexBloomFilter {
+public:
+    static constexpr uint64_t BITS_PER_KEY = 10;
+    static constexpr uint64_t NUM_BITS_PER_HASH = 5;
+    static constexpr uint64_t MIN_CAPACITY = 64;
+
+    // Sized to keep the false positive rate low for up to capacity keys.
+    explicit HashIndexBloomFilter(uint64_t capacity);
+
+    uint64_t getCapacity() const { return capacity; }
+    uint64_t getMemoryUsage() const { return words.size() * sizeof(uint64_t); }
+
+    void insert(common::hash_t hash) {
+        const auto mixed = mix(hash);
+        words[mixed & (words.size() - 1)] |= getMask(mixed);
+    }
+    bool mayContain(common::hash_t hash) const {
+        const auto mixed = mix(hash);
+        const auto mask = getMask(mixed);
+        return (words[mixed & (words.size() - 1)] & mask) == mask;
+    }
+
+    void serialize(common::Serializer& serializer) const;
+    static std::unique_ptr<HashIndexBloomFilter> deserialize(common::Deserializer& deserializer);
+
+private:
+    HashIndexBloomFilter(uint64_t capacity, std::vector<uint64_t> words)
+        : capacity{capacity}, words{std::move(words)} {}
+
+    // Each hash index only holds keys with the same highest hash bits (they select the hash index),
+    // and slots are selected with the lowest bits, so the bits are remixed before use.
+    static uint64_t mix(common::hash_t hash) {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+    // The word is selected with the lowest bits and the bits in the word with the highest bits.
+    static uint64_t getMask(uint64_t mixedHash) {
+        uint64_t mask = 0;
+        for (auto i = 1u; i <= NUM_BITS_PER_HASH; i++) {
+            mask |= uint64_t{1} << ((mixedHash >> (64 - 6 * i)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    uint64_t capacity;
+    // The number of words is always a power of two.
+    std::vector<uint64_t> words;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -79,9 +79,62 @@ static constexpr uint8_t getSlotCapacity() {
 
 template<typename T>
 struct Slot {
+    static constexpr entry_pos_t CAPACITY = getSlotCapacity<T>();
+    // The fingerprints past the capacity of the slot are not used by entries. In the primary slots
+    // of the persistent index, they hold a marker followed by a mask of the fingerprints of the
+    // entries in the overflow slots of the chain, so that most lookups of keys which are not in the
+    // primary slot don't read the overflow slots. The marker is 0 in slots written before the mask
+    // was added, or whose chain was started before, in which case the chain is always searched.
+    static constexpr bool HAS_OVERFLOW_FINGERPRINTS =
+        SlotHeader::FINGERPRINT_CAPACITY - CAPACITY >= 1 + sizeof(uint32_t);
+    static constexpr uint8_t OVERFLOW_FINGERPRINTS_MARKER = 1;
+
     Slot() : header{}, entries{} {}
+
+    bool hasOverflowFingerprints() const {
+        if constexpr (HAS_OVERFLOW_FINGERPRINTS) {
+            return header.fingerprints[CAPACITY] == OVERFLOW_FINGERPRINTS_MARKER;
+        } else {
+            return false;
+        }
+    }
+    // Starts tracking the fingerprints of the overflow slots. Only valid while the chain of the
+    // slot has no entry.
+    void initOverflowFingerprints() {
+        if constexpr (HAS_OVERFLOW_FINGERPRINTS) {
+            header.fingerprints[CAPACITY] = OVERFLOW_FINGERPRINTS_MARKER;
+            setOverflowFingerprintMask(0);
+        }
+    }
+    // Records an entry added to an overflow slot of the chain.
+    void addOverflowFingerprint(uint8_t fingerprint) {
+        if (hasOverflowFingerprints()) {
+            setOverflowFingerprintMask(
+                getOverflowFingerprintMask() | getOverflowFingerprintBit(fingerprint));
+        }
+    }
+    // Whether an entry with the fingerprint may be in an overflow slot of the chain. Entries
+    // removed from the chain are not removed from the mask.
+    bool mayHaveOverflowFingerprint(uint8_t fingerprint) const {
+        return !hasOverflowFingerprints() ||
+               (getOverflowFingerprintMask() & getOverflowFingerprintBit(fingerprint)) != 0;
+    }
+
     SlotHeader header;
-    std::array<SlotEntry<T>, getSlotCapacity<T>()> entries;
+    std::array<SlotEntry<T>, CAPACITY> entries;
+
+private:
+    static uint32_t getOverflowFingerprintBit(uint8_t fingerprint) {
+        return (uint32_t)1 << (fingerprint % (sizeof(uint32_t) * 8));
+    }
+    uint32_t getOverflowFingerprintMask() const {
+        uint32_t mask = 0;
+        memcpy(&mask, &header.fingerprints[CAPACITY + 1], sizeof(mask));
+        return mask;
+    }
+    void setOverflowFingerprintMask(uint32_t mask) {
+        memcpy(&header.fingerprints[CAPACITY + 1], &mask, sizeof(mask));
+    }
 };
 
 } // namespace storage
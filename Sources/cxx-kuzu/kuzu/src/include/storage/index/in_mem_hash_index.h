@@ -97,9 +97,21 @@ public:
     // I.e. if a key fails to insert, its index will be the return value
     size_t append(IndexBuffer<OwnedType>& buffer, uint64_t bufferOffset, visible_func isVisible) {
         reserve(indexHeader.numEntries + buffer.size() - bufferOffset);
+        // The keys are hashed before any of them is inserted, so that the primary slot of each key
+        // can be prefetched a few keys ahead of its insertion. The slots are at random positions,
+        // and this overlaps their cache misses instead of stalling on each of them in turn. The
+        // primary slots don't move, since the index was reserved above.
         common::hash_t hashes[INDEX_BUFFER_SIZE];
         for (size_t i = bufferOffset; i < buffer.size(); i++) {
             hashes[i] = HashIndexUtils::hash(buffer[i].first);
+            if (i < bufferOffset + SLOT_PREFETCH_DISTANCE) {
+                prefetchPrimarySlot(hashes[i]);
+            }
+        }
+        for (size_t i = bufferOffset; i < buffer.size(); i++) {
+            if (i + SLOT_PREFETCH_DISTANCE < buffer.size()) {
+                prefetchPrimarySlot(hashes[i + SLOT_PREFETCH_DISTANCE]);
+            }
             auto& [key, value] = buffer[i];
             if (!appendInternal(std::move(key), value, hashes[i], isVisible)) {
                 return i - bufferOffset;
@@ -213,6 +225,16 @@ public:
     }
 
 private:
+    static constexpr size_t SLOT_PREFETCH_DISTANCE = 16;
+
+    void prefetchPrimarySlot(common::hash_t hash) const {
+        auto slotId = HashIndexUtils::getPrimarySlotIdForHash(indexHeader, hash);
+        [[maybe_unused]] auto slot = getSlot(SlotInfo{slotId, SlotType::PRIMARY});
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(slot);
+#endif
+    }
+
     // Assumes that space has already been allocated for the entry
     bool appendInternal(OwnedType&& key, common::offset_t value, common::hash_t hash,
         visible_func isVisible) {
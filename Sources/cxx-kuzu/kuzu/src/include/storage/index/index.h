@@ -163,6 +163,23 @@ public:
     virtual void finalize(main::ClientContext*) {
         // DO NOTHING.
     }
+    // Deferred upkeep, e.g. removing deleted entries, is run before checkpoints in a write
+    // transaction of its own. State kept outside of tables is only made final once the transaction
+    // commits, and is restored if it rolls back.
+    virtual bool needsMaintenance() const { return false; }
+    virtual void runMaintenance(main::ClientContext*) {
+        // DO NOTHING.
+    }
+    virtual void commitMaintenance() {
+        // DO NOTHING.
+    }
+    virtual void rollbackMaintenance() {
+        // DO NOTHING.
+    }
+    // Frees the pages of the data file owned by the index, when the index or its table is dropped.
+    virtual void reclaimStorage(PageAllocator&) const {
+        // DO NOTHING.
+    }
 
     std::span<uint8_t> getStorageBuffer() const {
         KU_ASSERT(!loaded);
@@ -219,6 +236,13 @@ public:
             index->finalize(context);
         }
     }
+    // The pages of indexes that were never loaded are unknown and stay allocated.
+    void reclaimStorage(PageAllocator& pageAllocator) const {
+        if (loaded) {
+            KU_ASSERT(index);
+            index->reclaimStorage(pageAllocator);
+        }
+    }
 
     Index* getIndex() const {
         KU_ASSERT(index);
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <set>
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "storage/index/index.h"
+#include "storage/stats/column_histogram.h"
+
+namespace kuzu {
+namespace storage {
+class NodeTable;
+
+struct SortedIndexAuxInfo final : catalog::IndexAuxInfo {
+    std::unique_ptr<IndexAuxInfo> copy() override { return std::make_unique<SortedIndexAuxInfo>(); }
+
+    std::string toCypher(const catalog::IndexCatalogEntry& indexEntry,
+        const catalog::ToCypherInfo& info) const override;
+};
+
+// A secondary index which keeps the nodes of a table sorted by a property, so that selective range
+// and equality predicates on the property look up the matching nodes instead of scanning the whole
+// table. Keys are normalized the same way as histogram keys: numeric values (including dates and
+// timestamps) as doubles and strings as bytes. NaN values are not indexed.
+//
+// The index is held in memory. It is built from the column when it is created or loaded, and then
+// kept up to date by the inserts, updates and COPYs of the table. Entries are never removed when a
+// node is deleted or updated, since older snapshots may still need them, so lookups give
+// candidates which the caller filters on the predicate again. Stale entries are dropped by
+// rebuilding the index when the table is checkpointed.
+class SortedIndex final : public Index {
+public:
+    static constexpr const char* TYPE_NAME = "SORTED";
+
+    SortedIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+        NodeTable& nodeTable);
+
+    static bool isSupported(const common::LogicalType& dataType) {
+        return ColumnHistogram::isSupported(dataType);
+    }
+
+    // Builds the index from the committed values of the column.
+    void build(transaction::Transaction* transaction, MemoryManager* memoryManager);
+
+    // Returns in ascending order the committed nodes visible to the transaction which may have a
+    // key within the bounds. Bounds are inclusive, and a missing bound leaves its end of the range
+    // open. Comparisons with NaN are false, so NaN bounds match nothing.
+    std::vector<common::offset_t> lookup(const transaction::Transaction* transaction,
+        const std::optional<histogram_key_t>& lower, const std::optional<histogram_key_t>& upper);
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext*, visible_func) override {
+        // Inserted nodes are indexed once they are committed and have their final offsets.
+        return std::make_unique<InsertState>();
+    }
+    bool needCommitInsert() const override { return true; }
+    void commitInsert(transaction::Transaction* transaction,
+        const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors, InsertState& insertState) override;
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext*, common::column_id_t,
+        visible_func) override {
+        return std::make_unique<UpdateState>();
+    }
+    void update(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        common::ValueVector& propertyVector, UpdateState& updateState) override;
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction*, MemoryManager*,
+        visible_func) override {
+        return std::make_unique<DeleteState>();
+    }
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
+    void checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) override;
+    // Indexes the nodes appended by COPY.
+    void finalize(main::ClientContext* context) override;
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
+
+    static IndexType getIndexType() {
+        static const IndexType SORTED_INDEX_TYPE{TYPE_NAME,
+            IndexConstraintType::SECONDARY_NON_UNIQUE, IndexDefinitionType::BUILTIN, load};
+        return SORTED_INDEX_TYPE;
+    }
+
+private:
+    using entry_t = std::pair<histogram_key_t, common::offset_t>;
+
+    void scanColumn(transaction::Transaction* transaction, MemoryManager* memoryManager,
+        std::vector<entry_t>& result) const;
+    void addEntry(const common::ValueVector& keyVector, uint32_t pos, common::offset_t offset);
+    void mergePendingEntries();
+    void mergePendingEntriesIfNeeded();
+
+private:
+    // Pending entries are merged into the sorted entries once there are this many of them, or an
+    // eighth of the number of sorted entries if that is larger.
+    static constexpr uint64_t MIN_NUM_PENDING_ENTRIES_TO_MERGE = 4096;
+
+    std::mutex mtx;
+    NodeTable& nodeTable;
+    // Sorted by key and then offset.
+    std::vector<entry_t> entries;
+    // Entries added since the last merge, kept apart so that writes don't shift the sorted entries.
+    std::set<entry_t> pendingEntries;
+    // Entries left behind by updates and deletions.
+    uint64_t numStaleEntries;
+};
+
+} // namespace storage
+} // namespace kuzu
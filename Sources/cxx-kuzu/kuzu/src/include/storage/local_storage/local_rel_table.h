@@ -45,6 +45,8 @@ public:
 
     bool checkIfNodeHasRels(common::ValueVector* srcNodeIDVector,
         common::RelDataDirection direction) const;
+    common::row_idx_t getNumRels(common::offset_t nodeOffset,
+        common::RelDataDirection direction) const;
 
     common::TableType getTableType() const override { return common::TableType::REL; }
 
@@ -9,7 +9,8 @@ class PageManager;
 
 /**
  * Manages any optimistically allocated pages (e.g. during COPY) so that they can be freed if a
- * rollback occurs.
+ * rollback occurs. Pages freed through it are only released once the transaction commits, so that
+ * a rollback leaves them in use.
  * This class is designed to be thread-local so accesses are not guaranteed to be thread-safe.
  */
 class OptimisticAllocator : public PageAllocator {
@@ -26,6 +27,7 @@ public:
 private:
     PageManager& pageManager;
     std::vector<PageRange> optimisticallyAllocatedPages;
+    std::vector<PageRange> pagesToFreeOnCommit;
 };
 } // namespace storage
 } // namespace kuzu
@@ -45,6 +45,11 @@ public:
         common::row_idx_t endOffset) const {
         return freeSpaceManager->getEntries(startOffset, endOffset);
     }
+    // Pages freed since the last checkpoint are not counted until they can be reused.
+    common::page_idx_t getNumFreePages() const;
+    // Returns the free entries ordered by page index. Unlike getFreeEntries(), it can be called
+    // while other threads allocate pages.
+    std::vector<PageRange> getSortedFreeEntries();
 
     void clearEvictedBMEntriesIfNeeded(BufferManager* bufferManager);
 
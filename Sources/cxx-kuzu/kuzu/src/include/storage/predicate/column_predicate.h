@@ -3,12 +3,22 @@
 #include "binder/expression/expression.h"
 #include "common/cast.h"
 #include "common/enums/zone_map_check_result.h"
+#include "common/types/int128_t.h"
 
 namespace kuzu {
 namespace storage {
 
 struct MergedColumnChunkStats;
 
+// The integers in [min, max], which is empty if min > max.
+struct IntegerRange {
+    common::int128_t min;
+    common::int128_t max;
+
+    bool isEmpty() const { return min > max; }
+    bool contains(common::int128_t value) const { return min <= value && value <= max; }
+};
+
 class ColumnPredicate;
 class KUZU_API ColumnPredicateSet {
 public:
@@ -23,6 +33,19 @@ public:
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const;
 
+    // Whether some of the predicates can be evaluated directly on string values, e.g. once per
+    // entry of a string dictionary instead of once per row.
+    bool canEvaluateStrings() const;
+    // Evaluates the predicates which can be evaluated on strings and ignores the others.
+    bool evaluateStrings(std::string_view value) const;
+
+    // Whether some of the predicates can be evaluated as ranges of integers of the given type, e.g.
+    // on bitpacked values without decompressing them.
+    bool canEvaluateIntegers(const common::LogicalType& type) const;
+    // Narrows the range down to the integers of the given type which satisfy the predicates that
+    // can be evaluated as ranges, and ignores the others.
+    void narrowIntegerRange(const common::LogicalType& type, IntegerRange& range) const;
+
     std::string toString() const;
 
 private:
@@ -42,6 +65,12 @@ public:
 
     virtual common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const = 0;
 
+    virtual bool canEvaluateString() const { return false; }
+    virtual bool evaluateString(std::string_view /*value*/) const { return true; }
+
+    virtual bool canEvaluateIntegers(const common::LogicalType& /*type*/) const { return false; }
+    virtual void narrowIntegerRange(IntegerRange& /*range*/) const {}
+
     virtual std::string toString();
 
     virtual std::unique_ptr<ColumnPredicate> copy() const = 0;
@@ -15,6 +15,12 @@ public:
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
 
+    bool canEvaluateString() const override;
+    bool evaluateString(std::string_view value) const override;
+
+    bool canEvaluateIntegers(const common::LogicalType& type) const override;
+    void narrowIntegerRange(IntegerRange& range) const override;
+
     std::string toString() override;
 
     std::unique_ptr<ColumnPredicate> copy() const override {
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+
+#include "column_predicate.h"
+#include "common/types/types.h"
+#include "storage/table/column_chunk_stats.h"
+
+namespace kuzu {
+namespace common {
+class SelectionVector;
+class ValueVector;
+} // namespace common
+namespace storage {
+
+// Filter computed while the query runs and passed to the scan producing the filtered column. The
+// scan checks it against the zone maps of the chunks it is about to scan, and against the values
+// it outputs. It must be safe to check concurrently with its producer updating it.
+class RuntimeFilter {
+public:
+    virtual ~RuntimeFilter() = default;
+
+    static bool isSupported(const common::LogicalType& keyType);
+
+    virtual common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const = 0;
+    // Narrows selVector down to the positions of keyVector which may pass the filter.
+    virtual void select(const common::ValueVector& keyVector,
+        common::SelectionVector& selVector) const = 0;
+
+    virtual std::string toString(const std::string& columnName) const = 0;
+};
+
+// Filter on a join key passed sideways from the build side of a hash join to the scan producing the
+// probe key. While the build side is materialized, it collects the range of the build keys, used to
+// skip node groups through their zone maps, and a blocked Bloom filter of their hashes, used to drop
+// scanned tuples which cannot find a match before they reach the join. Null keys never match, so
+// they are dropped as well.
+// Keys are inserted concurrently by the build threads. The filter is only read once finalized,
+// which happens before any probe-side scan starts. Until then, it lets every tuple through.
+class JoinKeyFilter final : public RuntimeFilter {
+    // A block is a single word; every key sets NUM_BITS_PER_KEY bits of the word picked by its
+    // hash.
+    static constexpr uint64_t NUM_BLOCKS = 1 << 14;
+    static constexpr uint64_t NUM_BITS_PER_KEY = 3;
+    // Beyond this many keys the false positive rate of the Bloom filter gets too high to be worth
+    // checking, so only the key range is used.
+    static constexpr uint64_t MAX_NUM_KEYS_FOR_BLOOM_FILTER = NUM_BLOCKS * 8;
+
+public:
+    explicit JoinKeyFilter(common::PhysicalTypeID keyType);
+
+    void insert(const common::ValueVector& keyVector);
+    void finalize();
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+    void select(const common::ValueVector& keyVector,
+        common::SelectionVector& selVector) const override;
+
+    std::string toString(const std::string& columnName) const override;
+
+private:
+    template<typename T>
+    void insertInternal(const common::ValueVector& keyVector);
+    template<typename T>
+    void selectInternal(const common::ValueVector& keyVector,
+        common::SelectionVector& selVector) const;
+    template<typename T>
+    bool mayContain(T key) const;
+
+    static uint64_t getBlockIdx(common::hash_t hash) { return hash & (NUM_BLOCKS - 1); }
+    static uint64_t getBlockMask(common::hash_t hash);
+
+private:
+    common::PhysicalTypeID keyType;
+    std::unique_ptr<std::atomic<uint64_t>[]> blocks;
+    std::atomic<uint64_t> numKeys;
+    std::mutex mtx;
+    ColumnChunkStats keyRange;
+    bool useBloomFilter;
+    bool finalized;
+};
+
+// Filter on the first key of a top-k passed from the TopK sink to the scan producing the key. Once
+// a TopK buffer holds k tuples, the key of its last one is a threshold: tuples whose key sorts
+// strictly after it cannot make it into the result, whatever the other keys are. The threshold
+// starts unset, letting every tuple through, and only gets tighter as the buffers fill up. Null
+// keys are always let through since their position depends on the order.
+class TopKFilter final : public RuntimeFilter {
+public:
+    TopKFilter(common::PhysicalTypeID keyType, bool isAscOrder)
+        : keyType{keyType}, isAscOrder{isAscOrder}, hasThreshold{false}, threshold{} {}
+
+    // Tightens the threshold to the value at pos of vector, unless it is already tighter.
+    void update(const common::ValueVector& vector, common::sel_t pos);
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+    void select(const common::ValueVector& keyVector,
+        common::SelectionVector& selVector) const override;
+
+    std::string toString(const std::string& columnName) const override;
+
+private:
+    std::optional<StorageValue> getThreshold() const;
+    // Whether a key sorts strictly after the threshold.
+    bool isBeyond(const StorageValue& key, const StorageValue& currentThreshold) const {
+        return isAscOrder ? key.gt(currentThreshold, keyType) : currentThreshold.gt(key, keyType);
+    }
+    template<typename T>
+    void selectInternal(const common::ValueVector& keyVector, common::SelectionVector& selVector,
+        T currentThreshold) const;
+
+private:
+    common::PhysicalTypeID keyType;
+    bool isAscOrder;
+    std::atomic<bool> hasThreshold;
+    mutable std::mutex mtx;
+    StorageValue threshold;
+};
+
+class ColumnRuntimeFilterPredicate : public ColumnPredicate {
+public:
+    ColumnRuntimeFilterPredicate(std::string columnName, std::shared_ptr<RuntimeFilter> filter)
+        : ColumnPredicate{std::move(columnName), common::ExpressionType::EQUALS},
+          filter{std::move(filter)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override {
+        return filter->checkZoneMap(stats);
+    }
+
+    std::string toString() override { return filter->toString(columnName); }
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnRuntimeFilterPredicate>(columnName, filter);
+    }
+
+private:
+    std::shared_ptr<RuntimeFilter> filter;
+};
+
+} // namespace storage
+} // namespace kuzu
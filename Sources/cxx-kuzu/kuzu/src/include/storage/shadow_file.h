@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "common/types/uuid.h"
 #include "storage/file_handle.h"
 
@@ -21,15 +23,16 @@ struct ShadowFileHeader {
 static_assert(std::is_trivially_copyable_v<ShadowFileHeader>);
 
 class BufferManager;
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Shadow pages are created and looked up concurrently by node groups checkpointed in parallel.
+// Applying, flushing and clearing shadow pages are only done by a single thread.
 class ShadowFile {
 public:
     ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath);
 
     // TODO(Guodong): Remove originalFile param.
     bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
+        std::unique_lock lck{mtx};
+        return hasShadowPageNoLock(originalFile, originalPage);
     }
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
@@ -37,7 +40,10 @@ public:
     common::page_idx_t getOrCreateShadowPage(common::file_idx_t originalFile,
         common::page_idx_t originalPage);
 
-    FileHandle& getShadowingFH() const { return *shadowingFH; }
+    FileHandle& getShadowingFH() const {
+        std::unique_lock lck{mtx};
+        return *shadowingFH;
+    }
 
     void applyShadowPages(main::ClientContext& context) const;
 
@@ -52,6 +58,11 @@ public:
     static void replayShadowPageRecords(main::ClientContext& context);
 
 private:
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
     FileHandle* getOrCreateShadowingFH();
 
 private:
@@ -66,6 +77,8 @@ private:
         std::unordered_map<common::page_idx_t, common::page_idx_t>>
         shadowPagesMap;
     std::vector<ShadowPageRecord> shadowPageRecords;
+    // Protects shadowingFH, shadowPagesMap and shadowPageRecords.
+    mutable std::mutex mtx;
 };
 
 } // namespace storage
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Value;
+class ValueVector;
+} // namespace common
+
+namespace storage {
+
+// Numeric values (including dates and timestamps) are compared as doubles, and strings as bytes.
+using histogram_key_t = std::variant<double, std::string>;
+
+/**
+ * ColumnHistogram summarizes the distribution of the values of a column from a sample of its rows:
+ * the most common values with their frequencies, and an equi-depth histogram over the other
+ * values. It is built by CALL analyze() and used to estimate the selectivity of filters on skewed
+ * columns, where assuming uniformly distributed distinct values is off by orders of magnitude.
+ */
+class ColumnHistogram {
+public:
+    static constexpr uint64_t MAX_NUM_MOST_COMMON_VALUES = 16;
+    static constexpr uint64_t NUM_BUCKETS = 64;
+
+    static bool isSupported(const common::LogicalType& dataType);
+    static std::optional<histogram_key_t> getKey(const common::ValueVector& vector, uint32_t pos);
+    static std::optional<histogram_key_t> getKey(const common::Value& value);
+
+    // The sample holds the non-null sampled values. numSampledRows also counts the sampled nulls,
+    // and numDistinctValues is the estimated number of distinct values of the whole column.
+    static ColumnHistogram build(std::vector<histogram_key_t> sample,
+        common::cardinality_t numSampledRows, common::cardinality_t numDistinctValues);
+
+    // Fraction of the rows equal to the key.
+    double getEqualSelectivity(const histogram_key_t& key) const;
+    // Fraction of the rows between the bounds. A missing bound leaves its end of the range open.
+    double getRangeSelectivity(const std::optional<histogram_key_t>& lower, bool lowerInclusive,
+        const std::optional<histogram_key_t>& upper, bool upperInclusive) const;
+
+private:
+    // Fraction of the values in the histogram that are below the key.
+    double getHistogramFractionBelow(const histogram_key_t& key) const;
+
+private:
+    // Sorted by key.
+    std::vector<std::pair<histogram_key_t, double>> mostCommonValues;
+    // Fraction of the rows that are neither null nor one of the most common values.
+    double histogramFraction = 0;
+    // Bounds of the equi-depth buckets, each of which holds an equal share of histogramFraction.
+    std::vector<histogram_key_t> bucketBounds;
+    common::cardinality_t numHistogramDistinctValues = 0;
+};
+
+struct TableHistograms {
+    common::cardinality_t numRowsAnalyzed = 0;
+    std::unordered_map<common::property_id_t, ColumnHistogram> columnHistograms;
+
+    const ColumnHistogram* getColumnHistogram(common::property_id_t propertyID) const {
+        auto it = columnHistograms.find(propertyID);
+        return it == columnHistograms.end() ? nullptr : &it->second;
+    }
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+/**
+ * DegreeStats summarizes the number of rels of the bound nodes of one direction of a rel table,
+ * from a sample of the bound nodes. It is collected by CALL analyze() and used to cost worst-case
+ * optimal joins, whose cost depends on the lengths of the adjacency lists they intersect.
+ */
+struct DegreeStats {
+    double avgDegree = 0;
+    // Maximum degree among the sampled bound nodes.
+    common::cardinality_t maxDegree = 0;
+    // E[degree^2] / E[degree]^2, which is 1 if all bound nodes have the same degree. A bound node
+    // reached through a join is picked with a probability proportional to its degree, so its
+    // expected degree is avgDegree * skew rather than avgDegree.
+    double skew = 1;
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStats deserialize(common::Deserializer& deserializer);
+};
+
+} // namespace storage
+} // namespace kuzu
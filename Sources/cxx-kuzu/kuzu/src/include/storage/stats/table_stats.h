@@ -17,6 +17,23 @@ public:
 
     void incrementCardinality(common::cardinality_t increment) { cardinality += increment; }
 
+    // Deleted values can't be removed from the HyperLogLog sketches, so deletions and updates are
+    // counted until the stats are refreshed from a scan of the table.
+    void recordDeletions(common::cardinality_t numRows) {
+        cardinality -= std::min(numRows, cardinality);
+        numChangesSinceRefresh += numRows;
+    }
+    void recordUpdates(common::row_idx_t numRows) { numChangesSinceRefresh += numRows; }
+    // Replaces the stats with the given ones, which were computed from a scan of the table that
+    // started when the stats were statsAtScanStart. The changes committed since then were missed
+    // by the scan, so the cardinality keeps them and they still count as changes.
+    void refresh(TableStats refreshed, const TableStats& statsAtScanStart,
+        int64_t refreshTime);
+
+    common::row_idx_t getNumChangesSinceRefresh() const { return numChangesSinceRefresh; }
+    // Microseconds since the epoch, or 0 if the stats were never refreshed.
+    int64_t getLastRefreshTime() const { return lastRefreshTime; }
+
     void merge(const TableStats& other) {
         std::vector<common::column_id_t> columnIDs;
         for (auto i = 0u; i < columnStats.size(); i++) {
@@ -39,7 +56,8 @@ public:
 
     common::cardinality_t getNumDistinctValues(common::column_id_t columnID) const {
         KU_ASSERT(columnID < columnStats.size());
-        return columnStats[columnID].getNumDistinctValues();
+        // The sketches still count the values of deleted rows.
+        return std::min(columnStats[columnID].getNumDistinctValues(), cardinality);
     }
 
     void update(const std::vector<common::ValueVector*>& vectors,
@@ -63,6 +81,8 @@ private:
     // Note: cardinality is the estimated number of rows in the table. It is not always up-to-date.
     common::cardinality_t cardinality;
     std::vector<ColumnStats> columnStats;
+    common::row_idx_t numChangesSinceRefresh = 0;
+    int64_t lastRefreshTime = 0;
 };
 
 } // namespace storage
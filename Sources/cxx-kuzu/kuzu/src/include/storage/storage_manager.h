@@ -36,11 +36,18 @@ public:
 
     static void recover(main::ClientContext& clientContext, bool throwOnWalReplayFailure,
         bool enableChecksums);
+    // Keeps a read-only database up to date with the database it was backed up from, by replaying
+    // the commits of the WAL shipped from it that came after those replayed so far. The WAL
+    // recovered when the database was opened is a prefix of the shipped one.
+    void replayShippedWAL(main::ClientContext& context, const std::string& shippedWALPath);
 
     void createTable(catalog::TableCatalogEntry* entry);
     void addRelTable(catalog::RelGroupCatalogEntry* entry,
         const catalog::RelTableCatalogInfo& info);
 
+    // Runs the deferred maintenance of the loaded indexes in a write transaction of its own. It is
+    // left to a later checkpoint if another write transaction is active.
+    void runIndexMaintenance(main::ClientContext& context);
     bool checkpoint(main::ClientContext* context, PageAllocator& pageAllocator);
     void finalizeCheckpoint();
     void rollbackCheckpoint(const catalog::Catalog& catalog);
@@ -97,6 +104,10 @@ private:
     bool enableCompression;
     bool inMemory;
     std::vector<IndexType> registeredIndexTypes;
+    // Offset of the shipped WAL up to which its commits are replayed, protected by
+    // shippedWALMtx.
+    std::mutex shippedWALMtx;
+    uint64_t shippedWALReplayedOffset = 0;
 };
 
 } // namespace storage
@@ -75,6 +75,10 @@ public:
     static std::string getTmpFilePath(const std::string& path) {
         return common::stringFormat("{}.{}", path, common::StorageConstants::TEMP_FILE_SUFFIX);
     }
+    static std::string getHotPagesFilePath(const std::string& path) {
+        return common::stringFormat("{}.{}", path,
+            common::StorageConstants::HOT_PAGES_FILE_SUFFIX);
+    }
 
     static std::string expandPath(const main::ClientContext* context, const std::string& path);
 
@@ -62,6 +62,7 @@ public:
     common::row_idx_t getNumRows() const { return numRows; }
     common::row_idx_t getCapacity() const { return capacity; }
     void setNumRows(common::offset_t numRows_);
+    uint64_t getEstimatedMemoryUsage() const;
 
     ColumnChunkData& getColumnChunk(const common::column_id_t columnID) {
         KU_ASSERT(columnID < chunks.size());
@@ -186,6 +187,9 @@ public:
     void scan(const transaction::Transaction* transaction, const TableScanState& scanState,
         const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
         common::length_t numRowsToScan) const;
+    // Whether the zone maps rule out all rows in the range for the scan's column predicates.
+    bool canSkipScan(const TableScanState& scanState, common::offset_t rowIdxInGroup,
+        common::length_t numRowsToScan) const;
 
     template<ResidencyState SCAN_RESIDENCY_STATE>
     void scanCommitted(transaction::Transaction* transaction, TableScanState& scanState,
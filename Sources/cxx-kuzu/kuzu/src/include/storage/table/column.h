@@ -5,6 +5,9 @@
 #include "storage/table/column_reader_writer.h"
 
 namespace kuzu {
+namespace common {
+class SelectionVector;
+} // namespace common
 namespace storage {
 class MemoryManager;
 
@@ -14,6 +17,7 @@ class RelTableData;
 struct ColumnCheckpointState;
 class PageAllocator;
 struct ChunkState;
+class ColumnPredicateSet;
 
 class ColumnChunk;
 class Column {
@@ -33,6 +37,10 @@ public:
 
     void populateExtraChunkState(SegmentState& state) const;
 
+    // Hints the buffer manager to read ahead the pages of the segment, including the pages of its
+    // null and children segments.
+    void prefetch(const SegmentState& state) const;
+
     static std::unique_ptr<ColumnChunkData> flushChunkData(const ColumnChunkData& chunkData,
         PageAllocator& pageAllocator);
     static std::unique_ptr<ColumnChunkData> flushNonNestedChunkData(
@@ -61,6 +69,13 @@ public:
     // Appends to the end of the columnChunk
     virtual void scanSegment(const SegmentState& state, ColumnChunkData* columnChunk,
         common::offset_t offsetInSegment, common::offset_t numValue) const;
+    // Narrows selVector, whose positions are relative to offsetInChunk, down to the rows of
+    // [offsetInChunk, offsetInChunk + length) which satisfy predicates. Rows may be kept when the
+    // predicates can't be evaluated more cheaply than on the scanned vectors. The default evaluates
+    // comparisons of integers with constants on constant and bitpacked segments.
+    virtual void select(const ChunkState& state, common::offset_t offsetInChunk,
+        common::length_t length, const ColumnPredicateSet& predicates,
+        common::SelectionVector& selVector) const;
     // Scan to raw data (does not scan any nested data and should only be used on primitive columns)
     void scanSegment(const SegmentState& state, common::offset_t startOffsetInSegment,
         common::offset_t length, uint8_t* result);
@@ -123,8 +138,11 @@ protected:
         const uint8_t* data, const common::NullMask* nullChunkData, common::offset_t srcOffset = 0,
         common::offset_t numValues = 1) const;
 
-    void updateStatistics(ColumnChunkMetadata& metadata, common::offset_t maxIndex,
-        const std::optional<StorageValue>& min, const std::optional<StorageValue>& max) const;
+    // Also invalidates the vector zone maps of the rows from startIndex to maxIndex, which were
+    // written in place.
+    void updateStatistics(ColumnChunkMetadata& metadata, common::offset_t startIndex,
+        common::offset_t maxIndex, const std::optional<StorageValue>& min,
+        const std::optional<StorageValue>& max) const;
 
 protected:
     bool isEndOffsetOutOfPagesCapacity(const ColumnChunkMetadata& metadata,
@@ -15,6 +15,7 @@ namespace storage {
 class PageAllocator;
 class MemoryManager;
 class Column;
+class ColumnPredicateSet;
 
 struct ChunkCheckpointState {
     std::unique_ptr<ColumnChunkData> chunkData;
@@ -146,6 +147,10 @@ public:
     void lookup(const transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t rowInChunk, common::ValueVector& output,
         common::sel_t posInOutputVector) const;
+    // See Column::select. Rows are only filtered for committed chunks without updates.
+    void select(const ChunkState& state, const ColumnPredicateSet& predicates,
+        common::SelectionVector& selVector, common::offset_t offsetInChunk,
+        common::length_t length) const;
     void update(const transaction::Transaction* transaction, common::offset_t offsetInChunk,
         const common::ValueVector& values);
 
@@ -206,8 +211,12 @@ public:
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
     void resetUpdateInfo() { updateInfo.reset(); }
+    const UpdateInfo& getUpdateInfo() const { return updateInfo; }
 
     MergedColumnChunkStats getMergedColumnChunkStats() const;
+    // Stats of the vectors overlapping the given rows, if all of their segments have zone maps.
+    std::optional<MergedColumnChunkStats> getMergedVectorStats(common::offset_t startRow,
+        common::length_t numRows) const;
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
 
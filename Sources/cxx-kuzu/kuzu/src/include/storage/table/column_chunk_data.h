@@ -13,6 +13,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
+#include "storage/enums/page_read_policy.h"
 #include "storage/enums/residency_state.h"
 #include "storage/table/column_chunk_metadata.h"
 #include "storage/table/column_chunk_stats.h"
@@ -43,6 +44,8 @@ struct SegmentState {
     const Column* column;
     ColumnChunkMetadata metadata;
     uint64_t numValuesPerPage = UINT64_MAX;
+    // Read policy used when scanning pages of the segment that are not cached.
+    PageReadPolicy readPolicy = PageReadPolicy::READ_PAGE;
     std::unique_ptr<SegmentState> nullState;
 
     // Used for struct/list/string columns.
@@ -63,6 +66,17 @@ struct SegmentState {
         nullState = std::make_unique<SegmentState>(false /*hasNull*/);
     }
 
+    // Sets the read policy of the segment and of its null and children segments.
+    void setReadPolicy(PageReadPolicy policy) {
+        readPolicy = policy;
+        if (nullState) {
+            nullState->setReadPolicy(policy);
+        }
+        for (auto& childState : childrenStates) {
+            childState.setReadPolicy(policy);
+        }
+    }
+
     SegmentState& getChildState(common::idx_t childIdx) {
         KU_ASSERT(childIdx < childrenStates.size());
         return childrenStates[childIdx];
@@ -162,6 +176,8 @@ public:
 
     // Note that the startPageIdx is not known, so it will always be common::INVALID_PAGE_IDX
     virtual ColumnChunkMetadata getMetadataToFlush() const;
+    // Computes the zone maps of the vectors of an in-memory chunk to store in its metadata.
+    virtual std::vector<VectorZoneMap> computeVectorZoneMaps() const;
 
     virtual void append(common::ValueVector* vector, const common::SelectionView& selView);
     virtual void append(const ColumnChunkData* other, common::offset_t startPosInOtherChunk,
@@ -268,6 +284,10 @@ public:
     SpillResult spillToDisk();
 
     MergedColumnChunkStats getMergedColumnChunkStats() const;
+    // Merges the zone maps of the vectors overlapping the given rows of an on-disk chunk. Returns
+    // nullopt if some of the zone maps are missing or invalid.
+    std::optional<MergedColumnChunkStats> getMergedVectorStats(common::offset_t startRow,
+        common::length_t numRows) const;
 
     void updateStats(const common::ValueVector* vector, const common::SelectionView& selVector);
 
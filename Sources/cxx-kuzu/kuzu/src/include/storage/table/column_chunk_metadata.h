@@ -5,10 +5,32 @@
 #include "storage/page_range.h"
 
 namespace kuzu::storage {
+// Zone map of one vector (common::DEFAULT_VECTOR_CAPACITY rows) of a column chunk, which lets scans
+// skip the vectors whose values cannot satisfy their predicates instead of only whole chunks.
+// Numeric values are summarized by their minimum and maximum, and strings by the minimum and
+// maximum of their prefixes (see StringPrefix). Min and max are unset if all values are null.
+struct VectorZoneMap {
+    // Marks zone maps whose rows were updated in place since they were computed.
+    static constexpr uint32_t INVALID_NUM_VALUES = UINT32_MAX;
+
+    StorageValue min;
+    StorageValue max;
+    uint32_t numValues;
+    uint32_t numNulls;
+
+    bool isValid() const { return numValues != INVALID_NUM_VALUES; }
+    void invalidate() { numValues = INVALID_NUM_VALUES; }
+
+    void serialize(common::Serializer& serializer) const;
+    static VectorZoneMap deserialize(common::Deserializer& deserializer);
+};
+
 struct ColumnChunkMetadata {
     PageRange pageRange;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    // Empty if the chunk fits in a single vector, or if its type has no zone maps.
+    std::vector<VectorZoneMap> vectorZoneMaps;
 
     common::page_idx_t getStartPageIdx() const { return pageRange.startPageIdx; }
     common::page_idx_t getNumPages() const { return pageRange.numPages; }
@@ -18,6 +40,9 @@ struct ColumnChunkMetadata {
     // exceptions
     common::page_idx_t getNumDataPages(common::PhysicalTypeID dataType) const;
 
+    // Invalidates the zone maps of the vectors overlapping the given rows.
+    void invalidateVectorZoneMaps(common::offset_t startRow, common::offset_t endRow);
+
     void serialize(common::Serializer& serializer) const;
     static ColumnChunkMetadata deserialize(common::Deserializer& deserializer);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "storage/compression/compression.h"
 namespace common {
 class ValueVector;
@@ -21,6 +23,23 @@ struct KUZU_API ColumnChunkStats {
     void reset();
 };
 
+// Strings are summarized in zone maps by their first bytes, read as a big-endian integer and padded
+// with zeros. The prefix of a string is never smaller than the prefix of a smaller string, so a
+// string whose prefix is outside of the range of prefixes of some strings can't be equal to any of
+// them, and is smaller or larger than all of them.
+struct StringPrefix {
+    static uint64_t get(std::string_view str) {
+        uint64_t prefix = 0;
+        for (auto i = 0u; i < sizeof(uint64_t); i++) {
+            prefix <<= 8;
+            if (i < str.size()) {
+                prefix |= static_cast<uint8_t>(str[i]);
+            }
+        }
+        return prefix;
+    }
+};
+
 struct MergedColumnChunkStats {
     MergedColumnChunkStats(ColumnChunkStats stats, bool guaranteedNoNulls, bool guaranteedAllNulls)
         : stats(stats), guaranteedNoNulls(guaranteedNoNulls),
@@ -29,6 +48,9 @@ struct MergedColumnChunkStats {
     ColumnChunkStats stats;
     bool guaranteedNoNulls;
     bool guaranteedAllNulls;
+    // Range of the StringPrefixes of the values of string chunks. Only vector zone maps have them.
+    std::optional<uint64_t> minStringPrefix;
+    std::optional<uint64_t> maxStringPrefix;
 
     void merge(const MergedColumnChunkStats& o, common::PhysicalTypeID dataType);
 };
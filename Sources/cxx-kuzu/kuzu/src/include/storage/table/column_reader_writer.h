@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/compression/float_compression.h"
+#include "storage/enums/page_read_policy.h"
 
 namespace kuzu {
 namespace transaction {
@@ -72,8 +73,8 @@ public:
         const uint8_t* data, const common::NullMask* nullChunkData, common::offset_t srcOffset,
         common::offset_t numValues, const write_values_func_t& writeFunc) = 0;
 
-    void readFromPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readFunc) const;
+    void readFromPage(common::page_idx_t pageIdx, const std::function<void(uint8_t*)>& readFunc,
+        PageReadPolicy readPolicy = PageReadPolicy::READ_PAGE) const;
 
     void updatePageWithCursor(PageCursor cursor,
         const std::function<void(uint8_t*, common::offset_t)>& writeOp) const;
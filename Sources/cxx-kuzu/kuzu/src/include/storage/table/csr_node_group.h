@@ -157,6 +157,11 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
         Column* csrOffsetCol, Column* csrLengthCol)
         : NodeGroupCheckpointState{std::move(columnIDs), std::move(columns), pageAllocator, mm},
           csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
+
+    std::unique_ptr<NodeGroupCheckpointState> copy() const override {
+        return std::make_unique<CSRNodeGroupCheckpointState>(columnIDs, columns, pageAllocator, mm,
+            csrOffsetColumn, csrLengthColumn);
+    }
 };
 
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
@@ -205,6 +210,12 @@ public:
     bool delete_(const transaction::Transaction* transaction, CSRNodeGroupScanSource source,
         common::row_idx_t rowIdxInGroup);
 
+    // Sets degrees[i] to the number of rels of bound node i in the node group which are visible to
+    // the transaction, without scanning any rel column. Persistent lists are counted from their CSR
+    // lengths and are only checked row by row if the persistent data has version info.
+    void countRels(const transaction::Transaction* transaction, const Column* csrOffsetColumn,
+        const Column* csrLengthColumn, std::vector<common::length_t>& degrees) const;
+
     void addColumn(TableAddColumnState& addColumnState, PageAllocator* pageAllocator,
         ColumnStats* newColumnStats) override;
 
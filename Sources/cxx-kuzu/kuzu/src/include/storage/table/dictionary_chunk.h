@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+
+#include "storage/compression/fsst.h"
 #include "storage/enums/residency_state.h"
 #include "storage/table/column_chunk_data.h"
 
@@ -48,6 +51,18 @@ public:
     static std::unique_ptr<DictionaryChunk> deserialize(MemoryManager& memoryManager,
         common::Deserializer& deSer);
 
+    struct FSSTEncodedData {
+        std::unique_ptr<ColumnChunkData> stringDataChunk;
+        std::unique_ptr<ColumnChunkData> offsetChunk;
+        FSSTSymbolTable symbolTable;
+    };
+    // Returns the string data and offsets of the dictionary encoded with FSST, or std::nullopt if
+    // compression is disabled or the encoding would not save enough space.
+    std::optional<FSSTEncodedData> encodeWithFSST() const;
+    // Marks a flushed string data chunk as holding data encoded with the given symbol table.
+    static void setFSSTMetadata(ColumnChunkData& stringDataChunk,
+        const FSSTSymbolTable& symbolTable);
+
     void flush(PageAllocator& pageAllocator);
 
 private:
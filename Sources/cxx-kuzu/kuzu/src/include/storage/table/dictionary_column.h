@@ -32,6 +32,10 @@ public:
     Column* getOffsetColumn() const { return offsetColumn.get(); }
 
 private:
+    void scanFSSTEncoded(const SegmentState& state, DictionaryChunk& dictChunk) const;
+    // Scans the FSST encoded string data in [startOffset, startOffset + length) into buffer.
+    void scanEncodedValue(const SegmentState& dataState, uint64_t startOffset, uint64_t length,
+        std::vector<uint8_t>& buffer) const;
     void scanOffsets(const SegmentState& state, DictionaryChunk::string_offset_t* offsets,
         uint64_t index, uint64_t numValues, uint64_t dataSize) const;
     void scanValue(const SegmentState& dataState, uint64_t startOffset, uint64_t endOffset,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 
 #include "column.h"
 #include "common/types/types.h"
@@ -23,6 +24,10 @@
 // reads and writes, during updates, we rewrite the whole list column chunk in ascending order
 // when the offsets are not sorted in ascending order and the size of data column chunk is larger
 // than half of its capacity.
+// ARRAY values all have the same size, so as long as a segment has no nulls and hasn't been updated
+// since it was written, its arrays are stored one after another in row order. In that case, which
+// is found from the segment metadata, scans and lookups compute where the data of a row starts from
+// its position and skip reading the offset and size columns.
 
 namespace kuzu {
 namespace storage {
@@ -87,6 +92,11 @@ private:
         common::ValueVector* offsetVector, const ListOffsetSizeInfo& listOffsetInfoInStorage,
         common::offset_t offsetInResult) const;
 
+    std::optional<common::list_size_t> getFixedArraySize(const SegmentState& state) const;
+    void scanFixedSizeArrays(const SegmentState& state, common::offset_t startOffsetInSegment,
+        common::row_idx_t numValuesToScan, common::ValueVector* resultVector,
+        common::offset_t offsetInResult, common::list_size_t arraySize) const;
+
     common::offset_t readOffset(const SegmentState& state,
         common::offset_t offsetInNodeGroup) const;
     common::list_size_t readSize(const SegmentState& state,
@@ -48,13 +48,22 @@ struct NodeGroupCheckpointState {
     std::vector<Column*> columns;
     PageAllocator& pageAllocator;
     MemoryManager* mm;
+    // Set by VACUUM to rewrite node groups with many deleted rows.
+    bool compact;
 
     NodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
-        std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm)
+        std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
+        bool compact = false)
         : columnIDs{std::move(columnIDs)}, columns{std::move(columns)},
-          pageAllocator{pageAllocator}, mm{mm} {}
+          pageAllocator{pageAllocator}, mm{mm}, compact{compact} {}
     virtual ~NodeGroupCheckpointState() = default;
 
+    // Node groups checkpointed in parallel each use their own copy of the state.
+    virtual std::unique_ptr<NodeGroupCheckpointState> copy() const {
+        return std::make_unique<NodeGroupCheckpointState>(columnIDs, columns, pageAllocator, mm,
+            compact);
+    }
+
     template<typename T>
     const T& cast() const {
         return common::ku_dynamic_cast<const T&>(*this);
@@ -213,6 +222,8 @@ public:
 protected:
     static constexpr auto INVALID_CHUNKED_GROUP_IDX = UINT32_MAX;
     static constexpr auto INVALID_START_ROW_IDX = UINT64_MAX;
+    // Node groups with at least this fraction of deleted rows are rewritten when compacted.
+    static constexpr double MIN_DELETED_RATIO_TO_COMPACT = 0.1;
 
 protected:
     void checkpointDataTypesNoLock(const NodeGroupCheckpointState& state);
@@ -228,6 +239,9 @@ private:
         const common::UniqLock& lock, const NodeGroupCheckpointState& state) const;
     std::unique_ptr<ChunkedNodeGroup> checkpointInMemAndOnDisk(MemoryManager& memoryManager,
         const common::UniqLock& lock, NodeGroupCheckpointState& state) const;
+    std::unique_ptr<ChunkedNodeGroup> checkpointCompacted(MemoryManager& memoryManager,
+        const common::UniqLock& lock, const NodeGroupCheckpointState& state,
+        const VersionInfo& checkpointedVersionInfo) const;
     std::unique_ptr<VersionInfo> checkpointVersionInfo(const common::UniqLock& lock,
         const transaction::Transaction* transaction) const;
 
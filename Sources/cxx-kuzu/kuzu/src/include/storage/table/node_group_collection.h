@@ -1,16 +1,24 @@
 #pragma once
 
+#include <mutex>
+
 #include "storage/stats/table_stats.h"
 #include "storage/table/group_collection.h"
 #include "storage/table/node_group.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
 namespace storage {
 class MemoryManager;
 
+// The node groups of a collection deserialized from the database file are kept serialized until
+// they are first accessed, so that opening a database doesn't build the metadata of every column
+// chunk of every table up front. The number of rows and the stats are deserialized eagerly.
 class NodeGroupCollection {
 public:
     NodeGroupCollection(MemoryManager& mm, const std::vector<common::LogicalType>& types,
@@ -35,18 +43,22 @@ public:
 
     common::row_idx_t getNumTotalRows() const;
     common::node_group_idx_t getNumNodeGroups() const {
+        loadNodeGroupsIfNeeded();
         const auto lock = nodeGroups.lock();
         return nodeGroups.getNumGroups(lock);
     }
     common::node_group_idx_t getNumNodeGroupsNoLock() const {
+        loadNodeGroupsIfNeeded();
         return nodeGroups.getNumGroupsNoLock();
     }
     NodeGroup* getNodeGroupNoLock(const common::node_group_idx_t groupIdx) const {
+        loadNodeGroupsIfNeeded();
         KU_ASSERT(nodeGroups.getGroupNoLock(groupIdx)->getNodeGroupIdx() == groupIdx);
         return nodeGroups.getGroupNoLock(groupIdx);
     }
     NodeGroup* getNodeGroup(const common::node_group_idx_t groupIdx,
         bool mayOutOfBound = false) const {
+        loadNodeGroupsIfNeeded();
         const auto lock = nodeGroups.lock();
         if (mayOutOfBound && groupIdx >= nodeGroups.getNumGroups(lock)) {
             return nullptr;
@@ -59,6 +71,7 @@ public:
 
     void setNodeGroup(const common::node_group_idx_t nodeGroupIdx,
         std::unique_ptr<NodeGroup> group) {
+        loadNodeGroupsIfNeeded();
         const auto lock = nodeGroups.lock();
         nodeGroups.replaceGroup(lock, nodeGroupIdx, std::move(group));
     }
@@ -66,6 +79,7 @@ public:
     void rollbackInsert(common::row_idx_t numRows_, bool updateNumRows = true);
 
     void clear() {
+        loadNodeGroupsIfNeeded();
         const auto lock = nodeGroups.lock();
         nodeGroups.clear(lock);
     }
@@ -76,7 +90,9 @@ public:
 
     uint64_t getEstimatedMemoryUsage() const;
 
-    void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Node groups are checkpointed in parallel on the task scheduler of the context if given.
+    void checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state);
     void reclaimStorage(PageAllocator& pageAllocator) const;
 
     TableStats getStats() const {
@@ -96,6 +112,19 @@ public:
         auto lock = nodeGroups.lock();
         this->stats.merge(columnIDs, stats);
     }
+    void recordDeletionsInStats(common::row_idx_t numRows) {
+        auto lock = nodeGroups.lock();
+        stats.recordDeletions(numRows);
+    }
+    void recordUpdatesInStats(common::row_idx_t numRows) {
+        auto lock = nodeGroups.lock();
+        stats.recordUpdates(numRows);
+    }
+    void refreshStats(TableStats refreshed, const TableStats& statsAtScanStart,
+        int64_t refreshTime) {
+        auto lock = nodeGroups.lock();
+        stats.refresh(std::move(refreshed), statsAtScanStart, refreshTime);
+    }
 
     void serialize(common::Serializer& ser);
     void deserialize(common::Deserializer& deSer, MemoryManager& memoryManager);
@@ -108,6 +137,12 @@ public:
 private:
     void pushInsertInfo(const transaction::Transaction* transaction, const NodeGroup* nodeGroup,
         common::row_idx_t numRows);
+    void loadNodeGroupsIfNeeded() const {
+        if (serializedNodeGroupsPending.load(std::memory_order_acquire)) {
+            loadNodeGroups();
+        }
+    }
+    void loadNodeGroups() const;
 
 private:
     MemoryManager& mm;
@@ -115,10 +150,15 @@ private:
     // Num rows in the collection regardless of deletions.
     std::atomic<common::row_idx_t> numTotalRows;
     std::vector<common::LogicalType> types;
-    GroupCollection<NodeGroup> nodeGroups;
+    // Mutable so that the node groups can be deserialized on first access from const methods.
+    mutable GroupCollection<NodeGroup> nodeGroups;
     ResidencyState residency;
     TableStats stats;
     const VersionRecordHandler* versionRecordHandler;
+    mutable std::mutex loadMtx;
+    mutable std::atomic<bool> serializedNodeGroupsPending;
+    mutable std::unique_ptr<uint8_t[]> serializedNodeGroups;
+    mutable uint64_t serializedNodeGroupsSize;
 };
 
 } // namespace storage
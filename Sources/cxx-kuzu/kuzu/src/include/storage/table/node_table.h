@@ -2,6 +2,7 @@
 
 #include "common/types/types.h"
 #include "storage/index/hash_index.h"
+#include "storage/stats/column_histogram.h"
 #include "storage/table/node_group_collection.h"
 #include "storage/table/table.h"
 
@@ -72,6 +73,8 @@ struct KUZU_API NodeTableUpdateState : TableUpdateState {
 struct KUZU_API NodeTableDeleteState : TableDeleteState {
     common::ValueVector& nodeIDVector;
     common::ValueVector& pkVector;
+    // Initialized by the first deletion, and reused by later ones through the same state.
+    std::vector<std::unique_ptr<Index::DeleteState>> indexDeleteStates;
 
     explicit NodeTableDeleteState(common::ValueVector& nodeIDVector, common::ValueVector& pkVector)
         : nodeIDVector{nodeIDVector}, pkVector{pkVector} {}
@@ -100,6 +103,8 @@ public:
         common::row_idx_t numRows, common::transaction_t commitTS) const override;
     void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const override;
+    void commitDelete(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
+        common::row_idx_t numRows, common::transaction_t commitTS) const override;
 
 private:
     NodeTable* table;
@@ -144,6 +149,10 @@ public:
 
     bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result) const;
+    // Looks up the keys at the given positions of the vector, setting results[i] to the offset of
+    // the key at positions[i], or to INVALID_OFFSET if there is no such node.
+    void lookupPKs(const transaction::Transaction* transaction, common::ValueVector* keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results) const;
 
     void addIndex(std::unique_ptr<Index> index);
     void dropIndex(const std::string& name);
@@ -178,6 +187,11 @@ public:
         PageAllocator& pageAllocator) override;
     void rollbackCheckpoint() override;
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    // Node groups with many deleted rows are rewritten by the next checkpoint. Set by VACUUM.
+    void compactOnNextCheckpoint() {
+        compactOnCheckpoint.store(true, std::memory_order_relaxed);
+        setHasChanges();
+    }
 
     void rollbackPKIndexInsert(main::ClientContext* context, common::row_idx_t startRow,
         common::row_idx_t numRows_, common::node_group_idx_t nodeGroupIdx_);
@@ -203,6 +217,28 @@ public:
     void mergeStats(const std::vector<common::column_id_t>& columnIDs, const TableStats& stats) {
         nodeGroups->mergeStats(columnIDs, stats);
     }
+    // Deletions are removed from the stats once they are committed.
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void recordDeletionsInStats(common::row_idx_t numRows) {
+        nodeGroups->recordDeletionsInStats(numRows);
+    }
+    // The stats of committed rows only, which CALL analyze() refreshes from a scan of them.
+    TableStats getCommittedStats() const { return nodeGroups->getStats(); }
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void refreshStats(TableStats refreshed, const TableStats& statsAtScanStart,
+        int64_t refreshTime) {
+        nodeGroups->refreshStats(std::move(refreshed), statsAtScanStart, refreshTime);
+    }
+
+    // Histograms are collected by CALL analyze() and kept in memory only.
+    std::shared_ptr<const TableHistograms> getHistograms() const {
+        std::unique_lock lck{histogramsMtx};
+        return histograms;
+    }
+    void setHistograms(std::shared_ptr<const TableHistograms> newHistograms) {
+        std::unique_lock lck{histogramsMtx};
+        histograms = std::move(newHistograms);
+    }
 
     void serialize(common::Serializer& serializer) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
@@ -224,6 +260,9 @@ private:
     common::column_id_t pkColumnID;
     std::vector<IndexHolder> indexes;
     NodeTableVersionRecordHandler versionRecordHandler;
+    std::atomic<bool> compactOnCheckpoint;
+    mutable std::mutex histogramsMtx;
+    std::shared_ptr<const TableHistograms> histograms;
 };
 
 } // namespace storage
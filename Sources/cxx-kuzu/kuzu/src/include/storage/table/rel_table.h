@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
+#include <optional>
 #include <shared_mutex>
 
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "storage/stats/degree_stats.h"
+#include "storage/table/rel_table_csr_cache.h"
 #include "storage/table/rel_table_data.h"
+#include "storage/table/rel_table_reverse_index.h"
 #include "storage/table/table.h"
 
 namespace kuzu {
@@ -93,6 +98,13 @@ struct LocalRelTableScanState final : RelTableScanState {
     }
 };
 
+// Caches the committed degrees of the bound nodes of the node group read last by
+// RelTable::getDegree, so that bound nodes are best looked up in the order of their offsets.
+struct RelTableDegreeState {
+    common::node_group_idx_t nodeGroupIdx = common::INVALID_NODE_GROUP_IDX;
+    std::vector<common::length_t> committedDegrees;
+};
+
 struct KUZU_API RelTableInsertState : TableInsertState {
     common::ValueVector& srcNodeIDVector;
     common::ValueVector& dstNodeIDVector;
@@ -170,6 +182,12 @@ public:
     void detachDelete(transaction::Transaction* transaction, RelTableDeleteState* deleteState);
     bool checkIfNodeHasRels(transaction::Transaction* transaction,
         common::RelDataDirection direction, common::ValueVector* srcNodeIDVector) const;
+    // Returns the number of rels of the bound node in the direction which are visible to the
+    // transaction, including local ones. The rels are counted from CSR list lengths and row
+    // indices without scanning any rel column.
+    common::length_t getDegree(transaction::Transaction* transaction,
+        common::RelDataDirection direction, common::offset_t boundOffset,
+        RelTableDegreeState& state) const;
     void throwIfNodeHasRels(transaction::Transaction* transaction,
         common::RelDataDirection direction, common::ValueVector* srcNodeIDVector,
         const rel_multiplicity_constraint_throw_func_t& throwFunc) const;
@@ -222,11 +240,59 @@ public:
     std::vector<common::RelDataDirection> getStorageDirections() const;
     common::table_id_t getRelGroupID() const { return relGroupID; }
 
+    // Returns the in-memory adjacency of the given direction at the snapshot read by the
+    // transaction of the client, building it if the cached one is outdated. Returns nullptr if the
+    // transaction cannot read from a cache.
+    std::shared_ptr<const RelTableCSRCache> getOrBuildCSRCache(main::ClientContext& context,
+        common::RelDataDirection direction, common::offset_t numBoundNodes);
+    // Called on every change of the adjacency of the table: commits of inserted rels, deletions
+    // and COPY.
+    void invalidateCSRCaches();
+
+    // Degree stats are collected by CALL analyze() and serialized with the table at the next
+    // checkpoint.
+    std::shared_ptr<const DegreeStats> getDegreeStats(common::RelDataDirection direction) const {
+        std::unique_lock lck{degreeStatsMtx};
+        return degreeStats[common::RelDirectionUtils::relDirectionToKeyIdx(direction)];
+    }
+    void setDegreeStats(common::RelDataDirection direction,
+        std::shared_ptr<const DegreeStats> newDegreeStats) {
+        std::unique_lock lck{degreeStatsMtx};
+        degreeStats[common::RelDirectionUtils::relDirectionToKeyIdx(direction)] =
+            std::move(newDegreeStats);
+        degreeStatsChanged.store(true, std::memory_order_release);
+    }
+
+    // The reverse index of a table stored in the forward direction only is opt-in and kept in
+    // memory. Inserted rels are added to it on commit. Deletions of committed rels and COPY drop
+    // it, as does an overlay of inserted rels grown beyond a quarter of the indexed rels, and the
+    // planner schedules a new build when it finds no index to use.
+    void enableReverseIndex();
+    void dropReverseIndex();
+    bool isReverseIndexEnabled() const;
+    bool isBuildingReverseIndex() const;
+    // Returns the installed index, or nullptr.
+    std::shared_ptr<const RelTableReverseIndex> getReverseIndex() const;
+    // Returns the installed index if the transaction can read from it, or nullptr.
+    std::shared_ptr<const RelTableReverseIndex> getReverseIndex(
+        const transaction::Transaction* transaction) const;
+    // Claims the build of the index, returning the epoch to pass to finishReverseIndexBuild, or
+    // nullopt if the index is disabled, installed or being built.
+    std::optional<uint64_t> startReverseIndexBuild();
+    // Installs an index built by the transaction of the client if no change it may miss happened
+    // since the build was claimed, and returns whether it did. A null index gives the build up.
+    bool finishReverseIndexBuild(main::ClientContext& context,
+        std::unique_ptr<RelTableReverseIndex> index, uint64_t epoch);
+    void invalidateReverseIndex();
+
     void serialize(common::Serializer& ser) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
         common::Deserializer& deSer) override;
 
 private:
+    void commitToReverseIndex(const transaction::Transaction* transaction,
+        LocalRelTable& localRelTable);
+
     static void prepareCommitForNodeGroup(const transaction::Transaction* transaction,
         const std::vector<common::column_id_t>& columnIDs, const NodeGroup& localNodeGroup,
         CSRNodeGroup& csrNodeGroup, common::offset_t boundOffsetInGroup,
@@ -255,6 +321,21 @@ private:
     std::mutex relOffsetMtx;
     common::offset_t nextRelOffset;
     std::vector<std::unique_ptr<RelTableData>> directedRelData;
+    std::mutex csrCacheMtx;
+    // A cache stays valid for later snapshots until the table changes. It is kept with the version
+    // of the table it was built at, which every change of the adjacency advances.
+    std::array<std::shared_ptr<const RelTableCSRCache>, 2> csrCaches;
+    std::array<uint64_t, 2> csrCacheVersions{};
+    std::atomic<uint64_t> csrCacheVersion{0};
+    mutable std::mutex degreeStatsMtx;
+    std::array<std::shared_ptr<const DegreeStats>, 2> degreeStats;
+    std::atomic<bool> degreeStatsChanged{false};
+    mutable std::mutex reverseIndexMtx;
+    bool reverseIndexEnabled;
+    bool reverseIndexBuilding;
+    std::shared_ptr<RelTableReverseIndex> reverseIndex;
+    // Advanced by every change to the table which an index being built may miss.
+    uint64_t reverseIndexEpoch;
 
     // Protects concurrent access to table operations
     // Read operations use shared_lock (multiple readers allowed)
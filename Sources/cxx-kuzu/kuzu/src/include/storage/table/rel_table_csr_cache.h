@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "common/enums/rel_direction.h"
+#include "common/types/types.h"
+#include "storage/buffer_manager/mm_allocator.h"
+
+namespace kuzu {
+namespace common {
+class ValueVector;
+} // namespace common
+namespace transaction {
+class Transaction;
+} // namespace transaction
+namespace storage {
+class MemoryManager;
+class RelTable;
+
+// Read-only in-memory copy of the adjacency of one direction of a rel table, used to speed up
+// repeated traversals (recursive joins and graph algorithms) of hot rel tables.
+// The neighbours of each bound node are sorted and delta encoded as varints; offsets[i] is the
+// byte offset where the neighbours of bound node i start. Only neighbour node IDs are kept, so
+// scans that need rel properties or predicates read from the table instead.
+// A cache is a snapshot of the committed data visible to the transaction that built it, and the
+// table decides which later transactions can read it (see RelTable::getOrBuildCSRCache). Its
+// memory is allocated through the memory manager.
+class RelTableCSRCache {
+public:
+    static std::unique_ptr<RelTableCSRCache> build(transaction::Transaction* transaction,
+        RelTable& table, common::RelDataDirection direction, MemoryManager& memoryManager,
+        common::offset_t numBoundNodes);
+    // Builds a cache from the neighbours that getNbrs appends for each bound node, for adjacency
+    // that is filtered by more than the table scan, e.g. by the rel predicate of a projected graph.
+    static std::unique_ptr<RelTableCSRCache> build(common::transaction_t snapshotTS,
+        common::table_id_t nbrTableID, MemoryManager& memoryManager, common::offset_t numBoundNodes,
+        const std::function<void(common::offset_t, std::vector<common::offset_t>&)>& getNbrs);
+    // Returns a copy of the cache in which bound node i is bound node boundNewToOld[i] of the cache
+    // and the neighbours are renumbered by nbrOldToNew.
+    static std::unique_ptr<RelTableCSRCache> relabel(const RelTableCSRCache& cache,
+        std::span<const common::offset_t> boundNewToOld,
+        std::span<const common::offset_t> nbrOldToNew);
+
+    common::transaction_t getSnapshotTS() const { return snapshotTS; }
+
+    uint64_t getMemoryUsage() const {
+        return offsets.capacity() * sizeof(uint64_t) + nbrs.capacity();
+    }
+
+    class Cursor {
+        friend class RelTableCSRCache;
+
+    public:
+        Cursor() : data{nullptr}, end{nullptr}, prevOffset{0} {}
+
+        bool hasMore() const { return data != end; }
+        // Decodes up to DEFAULT_VECTOR_CAPACITY neighbours into dstVector starting at position 0
+        // and returns their number.
+        common::sel_t next(common::ValueVector& dstVector);
+
+    private:
+        Cursor(const uint8_t* data, const uint8_t* end, common::table_id_t nbrTableID)
+            : data{data}, end{end}, prevOffset{0}, nbrTableID{nbrTableID} {}
+
+        const uint8_t* data;
+        const uint8_t* end;
+        common::offset_t prevOffset;
+        common::table_id_t nbrTableID = common::INVALID_TABLE_ID;
+    };
+
+    Cursor getNbrs(common::offset_t boundOffset) const;
+    uint64_t getNumNbrs(common::offset_t boundOffset) const;
+    // Appends the neighbours of the bound node that are in this cache but not in the other one to
+    // added, and the ones only in the other one to removed.
+    void diffNbrs(const RelTableCSRCache& other, common::offset_t boundOffset,
+        std::vector<common::offset_t>& added, std::vector<common::offset_t>& removed) const;
+
+private:
+    RelTableCSRCache(common::transaction_t snapshotTS, common::table_id_t nbrTableID,
+        MemoryManager* memoryManager)
+        : snapshotTS{snapshotTS}, nbrTableID{nbrTableID}, memoryManager{memoryManager},
+          offsets{MmAllocator<uint64_t>(memoryManager)}, nbrs{MmAllocator<uint8_t>(memoryManager)} {}
+
+    void appendNbrs(std::vector<common::offset_t>& nbrOffsets);
+    std::span<const uint8_t> getEncodedNbrs(common::offset_t boundOffset) const;
+    void decodeNbrs(common::offset_t boundOffset, std::vector<common::offset_t>& nbrOffsets) const;
+
+private:
+    common::transaction_t snapshotTS;
+    common::table_id_t nbrTableID;
+    MemoryManager* memoryManager;
+    std::vector<uint64_t, MmAllocator<uint64_t>> offsets;
+    std::vector<uint8_t, MmAllocator<uint8_t>> nbrs;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+namespace transaction {
+class Transaction;
+} // namespace transaction
+namespace storage {
+class RelTable;
+
+// In-memory backward adjacency of a rel table stored in the forward direction only, so that rels
+// can be traversed from their destination nodes without storing the BWD CSR on disk. For each
+// destination node, the index keeps the source node and rel offsets of its rels, sorted by source.
+//
+// The index is built from the forward adjacency visible to a transaction in two parallel passes:
+// the rels of the forward node groups are radix partitioned on the node group of their destination
+// node, and each partition is sorted into a CSR over its destination nodes. Rels committed later
+// are added to an overlay with their commit timestamp, so a reader only sees the rels committed
+// before it started. See RelTable for when the index is dropped and built again.
+class RelTableReverseIndex {
+public:
+    struct Rel {
+        common::offset_t srcOffset;
+        common::offset_t relOffset;
+    };
+
+    // Builds the index from the rels visible to the transaction of the client, with up to
+    // numThreads workers of the task scheduler. Only indexes built by read-only transactions can
+    // be installed, as those of write transactions include their uncommitted rels.
+    static std::unique_ptr<RelTableReverseIndex> build(main::ClientContext& context,
+        RelTable& table, uint64_t numThreads);
+    // Builds the index of the table in the background, unless it is disabled or being built
+    // already. Cached plans are invalidated once the index is installed, so that queries planned
+    // afterwards traverse the table backward.
+    static void scheduleBuild(main::ClientContext& context, RelTable& table);
+
+    common::transaction_t getSnapshotTS() const { return snapshotTS; }
+    bool canBeReadBy(const transaction::Transaction* transaction) const;
+
+    // The rels of the destination node in the snapshot the index was built from.
+    std::span<const Rel> getRels(common::offset_t dstOffset) const;
+    // Appends the rels of the destination node that were committed after the snapshot and before
+    // startTS.
+    void getInsertedRels(common::offset_t dstOffset, common::transaction_t startTS,
+        std::vector<Rel>& rels) const;
+    void insertRel(common::offset_t dstOffset, Rel rel, common::transaction_t commitTS);
+
+    uint64_t getNumRels() const { return numRels; }
+    uint64_t getNumInsertedRels() const;
+    uint64_t getMemoryUsage() const;
+
+private:
+    explicit RelTableReverseIndex(common::transaction_t snapshotTS)
+        : snapshotTS{snapshotTS}, numRels{0}, numInsertedRels{0} {}
+
+    // The destination nodes of a node group. Rels of dstOffsets in the node group start at
+    // offsets[dstOffset % NODE_GROUP_SIZE].
+    struct Partition {
+        std::vector<uint64_t> offsets;
+        std::vector<Rel> rels;
+    };
+
+    struct InsertedRel {
+        Rel rel;
+        common::transaction_t commitTS;
+    };
+
+    struct Builder;
+
+private:
+    common::transaction_t snapshotTS;
+    std::vector<Partition> partitions;
+    uint64_t numRels;
+    mutable std::shared_mutex insertedRelsMtx;
+    std::unordered_map<common::offset_t, std::vector<InsertedRel>> insertedRels;
+    uint64_t numInsertedRels;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -59,6 +59,7 @@ public:
 
     void finalize() override;
 
+    std::vector<VectorZoneMap> computeVectorZoneMaps() const override;
     void flush(PageAllocator& pageAllocator) override;
     uint64_t getSizeOnDisk() const override;
     uint64_t getMinimumSizeOnDisk() const override;
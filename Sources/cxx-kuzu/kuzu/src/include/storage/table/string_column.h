@@ -29,6 +29,11 @@ public:
     const DictionaryColumn& getDictionary() const { return dictionary; }
     const Column* getIndexColumn() const { return indexColumn.get(); }
 
+    // Evaluates string comparisons once per distinct dictionary entry of the scanned rows instead
+    // of once per row, and filters the rows by their dictionary index.
+    void select(const ChunkState& state, common::offset_t offsetInChunk, common::length_t length,
+        const ColumnPredicateSet& predicates, common::SelectionVector& selVector) const override;
+
     static SegmentState& getChildState(SegmentState& state, ChildStateIndex child);
     static const SegmentState& getChildState(const SegmentState& state, ChildStateIndex child);
 
@@ -53,6 +58,11 @@ private:
     bool canCheckpointInPlace(const SegmentState& state,
         const ColumnCheckpointState& checkpointState) const override;
 
+    void selectInSegment(const SegmentState& state, common::offset_t offsetInSegment,
+        common::length_t length, const ColumnPredicateSet& predicates,
+        common::ValueVector& nullVector, common::offset_t offsetInResult,
+        std::vector<uint8_t>& isSelected) const;
+
     bool canIndexCommitInPlace(const SegmentState& state, uint64_t numStrings,
         common::offset_t maxOffset) const;
 
@@ -37,6 +37,9 @@ struct KUZU_API TableScanState {
     std::unique_ptr<NodeGroupScanState> nodeGroupScanState;
 
     std::vector<ColumnPredicateSet> columnPredicateSets;
+    // If set, the pages of on-disk column chunks are prefetched when a chunked group is
+    // initialized for scanning. Only worth it for sequential scans.
+    bool prefetchPages = false;
 
     TableScanState(common::ValueVector* nodeIDVector,
         std::vector<common::ValueVector*> outputVectors,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <bitset>
 #include <shared_mutex>
 
 #include "column_chunk_data.h"
@@ -23,6 +24,8 @@ struct VectorUpdateInfo {
     common::transaction_t version;
     std::array<common::sel_t, common::DEFAULT_VECTOR_CAPACITY> rowsInVector;
     common::sel_t numRowsUpdated;
+    // Rows in rowsInVector, so that checking whether a row is updated does not scan them.
+    std::bitset<common::DEFAULT_VECTOR_CAPACITY> rowMask;
     // Older versions.
     std::unique_ptr<VectorUpdateInfo> prev;
     // Newer versions.
@@ -45,6 +48,12 @@ struct VectorUpdateInfo {
     VectorUpdateInfo* getPrev() const { return prev.get(); }
     void setNext(VectorUpdateInfo* next_) { this->next = next_; }
     VectorUpdateInfo* getNext() const { return next; }
+
+    bool hasRow(common::sel_t rowInVector) const { return rowMask[rowInVector]; }
+    void appendRow(common::sel_t rowInVector) {
+        rowsInVector[numRowsUpdated++] = rowInVector;
+        rowMask[rowInVector] = true;
+    }
 };
 
 struct UpdateNode {
@@ -97,6 +106,11 @@ public:
 
     void commit(common::idx_t vectorIdx, VectorUpdateInfo* info, common::transaction_t commitTS);
     void rollback(common::idx_t vectorIdx, common::transaction_t version);
+    // Merges the committed versions of the vector that are visible to every active transaction,
+    // i.e. whose commit timestamps are not greater than minActiveStartTS, into the newest of them.
+    void vacuum(common::idx_t vectorIdx, common::transaction_t minActiveStartTS);
+    // Length of the version chain of the vector, including uncommitted versions.
+    uint64_t getNumVersions(common::idx_t vectorIdx) const;
 
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction) const;
 
@@ -23,6 +23,8 @@ public:
 
     virtual void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const;
+    virtual void commitDelete(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
+        common::row_idx_t numRows, common::transaction_t commitTS) const;
 };
 
 } // namespace storage
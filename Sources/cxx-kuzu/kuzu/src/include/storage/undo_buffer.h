@@ -92,6 +92,8 @@ public:
 
     void commit(common::transaction_t commitTS) const;
     void rollback(main::ClientContext* context) const;
+    // Collapses the version chains of the vectors updated by the committed transaction.
+    void vacuumUpdates(common::transaction_t minActiveStartTS) const;
 
 private:
     uint8_t* createUndoRecord(uint64_t size);
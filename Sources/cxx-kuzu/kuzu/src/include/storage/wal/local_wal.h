@@ -56,6 +56,8 @@ private:
     std::mutex mtx;
     std::shared_ptr<common::InMemFileWriter> inMemWriter;
     common::Serializer serializer;
+    // Offset in inMemWriter at which each record ends, so that the WAL can batch whole records.
+    std::vector<uint64_t> recordEndOffsets;
 };
 
 } // namespace storage
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+
 #include "storage/wal/wal_record.h"
 
 namespace kuzu {
@@ -10,13 +13,26 @@ class VirtualFileSystem;
 
 namespace storage {
 class LocalWAL;
+struct WALFrame;
 class WAL {
 public:
+    // Local WALs of at least this size are written as zstd-compressed batches of records.
+    static constexpr uint64_t MIN_SIZE_TO_COMPRESS = 64 * 1024;
+    // Records are batched until a batch reaches this uncompressed size.
+    static constexpr uint64_t COMPRESSED_FRAME_SIZE = 256 * 1024;
+
     WAL(const std::string& dbPath, bool readOnly, bool enableChecksums,
         common::VirtualFileSystem* vfs);
     ~WAL();
 
-    void logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context);
+    // Appends the local WAL of a committing transaction to the WAL without syncing it, and returns
+    // the sequence number to pass to waitForCommitDurable(), or 0 if nothing was logged.
+    uint64_t logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context);
+    // Group commit: blocks until the WAL is synced up to (and including) the given commit. The
+    // first waiting committer becomes the leader and syncs the WAL once for all commits appended
+    // so far, optionally waiting up to maxDelayInMicros first so that more commits can join; the
+    // other committers wait for the leader.
+    void waitForCommitDurable(uint64_t commitSeq, uint64_t maxDelayInMicros);
     void logAndFlushCheckpoint(main::ClientContext* context);
 
     // Clear any buffer in the WAL writer. Also truncate the WAL file to 0 bytes.
@@ -25,12 +41,29 @@ public:
     void reset();
 
     uint64_t getFileSize();
+    // Writes the buffered commits to the WAL file without syncing it, and returns the size of the
+    // file, which is 0 if there is none.
+    uint64_t flushAndGetFileSize(main::ClientContext& context);
+    const std::string& getPath() const { return walPath; }
+
+    // Number of commits logged and of syncs done by group commit; their ratio is the average
+    // number of commits per fsync.
+    uint64_t getNumCommits() const { return numCommits.load(std::memory_order_relaxed); }
+    uint64_t getNumSyncs() const { return numSyncs.load(std::memory_order_relaxed); }
+
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+    // Makes the syncs of group commit fail, to test how failed commits are handled.
+    void setFailSyncs(bool value) { failSyncs.store(value); }
+    bool getFailSyncs() const { return failSyncs.load(); }
+#endif
 
     static WAL* Get(const main::ClientContext& context);
 
 private:
+    void waitForInFlightSyncNoLock(std::unique_lock<std::mutex>& lck);
     void initWriter(main::ClientContext* context);
     void addNewWALRecordNoLock(const WALRecord& walRecord);
+    void writeFramesNoLock(const std::vector<WALFrame>& frames);
     void flushAndSyncNoLock();
     void writeHeader(main::ClientContext& context);
 
@@ -47,6 +80,18 @@ private:
     // writing COMMIT/CHECKPOINT records
     std::unique_ptr<common::Serializer> serializer;
     bool enableChecksums;
+
+    // Group commit state, protected by mtx. The leader syncs the file without holding mtx so that
+    // other transactions can keep appending commits meanwhile.
+    std::condition_variable syncCV;
+    uint64_t lastCommitSeq = 0;
+    uint64_t lastDurableCommitSeq = 0;
+    bool syncInProgress = false;
+    std::atomic<uint64_t> numCommits = 0;
+    std::atomic<uint64_t> numSyncs = 0;
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+    std::atomic<bool> failSyncs = false;
+#endif
 };
 
 } // namespace storage
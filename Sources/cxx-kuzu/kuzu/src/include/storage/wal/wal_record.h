@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #include "binder/ddl/bound_alter_info.h"
 #include "catalog/catalog_entry/catalog_entry.h"
@@ -9,6 +10,7 @@
 #include "common/enums/table_type.h"
 #include "common/types/uuid.h"
 #include "common/vector/value_vector.h"
+#include "storage/storage_version_info.h"
 
 namespace kuzu {
 namespace common {
@@ -23,6 +25,7 @@ enum class WALRecordType : uint8_t {
                         // accidentally read from an empty buffer.
     BEGIN_TRANSACTION_RECORD = 1,
     COMMIT_RECORD = 2,
+    COMPRESSED_RECORDS_RECORD = 3,
 
     COPY_TABLE_RECORD = 13,
     CREATE_CATALOG_ENTRY_RECORD = 14,
@@ -44,6 +47,11 @@ enum class WALRecordType : uint8_t {
 struct WALHeader {
     common::ku_uuid_t databaseID;
     bool enableChecksums;
+    // The storage version of the build that wrote the WAL. WALs written before it was added to the
+    // header fail this check, as does any WAL whose records may be laid out differently.
+    storage_version_t storageVersion;
+    // The checkpoint of the database that the records of the WAL apply on top of.
+    common::ku_uuid_t checkpointID;
 };
 
 struct WALRecord {
@@ -89,6 +97,27 @@ struct CheckpointRecord final : WALRecord {
     static std::unique_ptr<CheckpointRecord> deserialize(common::Deserializer& deserializer);
 };
 
+// A batch of consecutive records of a transaction, serialized as in the local WAL (i.e. with
+// per-record checksums if enabled) and compressed with zstd.
+struct CompressedRecordsRecord final : WALRecord {
+    bool hasChecksums = false;
+    uint64_t uncompressedSize = 0;
+    // Set when serializing.
+    std::span<const uint8_t> compressedData;
+    // Set when deserializing.
+    std::vector<std::unique_ptr<WALRecord>> records;
+
+    CompressedRecordsRecord() : WALRecord{WALRecordType::COMPRESSED_RECORDS_RECORD} {}
+    CompressedRecordsRecord(bool hasChecksums, uint64_t uncompressedSize,
+        std::span<const uint8_t> compressedData)
+        : WALRecord{WALRecordType::COMPRESSED_RECORDS_RECORD}, hasChecksums{hasChecksums},
+          uncompressedSize{uncompressedSize}, compressedData{compressedData} {}
+
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<CompressedRecordsRecord> deserialize(
+        common::Deserializer& deserializer, const main::ClientContext& clientContext);
+};
+
 struct CreateCatalogEntryRecord final : WALRecord {
     catalog::CatalogEntry* catalogEntry;
     std::unique_ptr<catalog::CatalogEntry> ownedCatalogEntry;
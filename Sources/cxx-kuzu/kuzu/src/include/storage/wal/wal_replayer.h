@@ -12,7 +12,14 @@ class WALReplayer {
 public:
     explicit WALReplayer(main::ClientContext& clientContext);
 
-    void replay(bool throwOnWalReplayFailure, bool enableChecksums) const;
+    // Recovers the database from its WAL, and returns the size of the WAL that was replayed, which
+    // is 0 if the database was fully checkpointed.
+    uint64_t replay(bool throwOnWalReplayFailure, bool enableChecksums) const;
+    // Replays the commits of a WAL shipped from another copy of the database, which must apply on
+    // top of the same checkpoint as this database, from the given offset of the shipped WAL on
+    // (from its first record if the offset is 0). The offset is advanced past each commit replayed.
+    void replayShippedWAL(const std::string& shippedWALPath, uint64_t& replayedOffset,
+        bool enableChecksums) const;
 
 private:
     struct WALReplayInfo {
@@ -103,6 +103,7 @@ public:
     int64_t getCurrentTS() const { return currentTS; }
 
     void setForceCheckpoint() { forceCheckpoint = true; }
+    bool hasUncommittedCatalogChanges() const { return hasCatalogChanges; }
     bool shouldAppendToUndoBuffer() const {
         // Only write transactions and recovery transactions should append to the undo buffer.
         return isWriteTransaction() || isRecovery();
@@ -115,9 +116,15 @@ public:
 
     bool shouldForceCheckpoint() const;
 
-    void commit(storage::WAL* wal);
+    // Returns the WAL commit sequence number the committer must wait on for durability (see
+    // WAL::waitForCommitDurable), or 0 if nothing was logged.
+    uint64_t commit(storage::WAL* wal);
     void rollback(storage::WAL* wal);
+    // Drops the versions of the rows updated by this committed transaction that no longer matter
+    // to any transaction starting at or after minActiveStartTS.
+    void vacuumUpdates(common::transaction_t minActiveStartTS) const;
 
+    main::ClientContext* getClientContext() const { return clientContext; }
     storage::LocalStorage* getLocalStorage() const { return localStorage.get(); }
     LocalCacheManager& getLocalCacheManager() { return localCacheManager; }
     bool isUnCommitted(common::table_id_t tableID, common::offset_t nodeOffset) const;
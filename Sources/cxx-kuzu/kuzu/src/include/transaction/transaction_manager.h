@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 
@@ -35,7 +38,8 @@ class TransactionManager {
 public:
     // Timestamp starts from 1. 0 is reserved for the dummy system transaction.
     explicit TransactionManager(storage::WAL& wal)
-        : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1} {
+        : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1},
+          lastAppliedTimestamp{1} {
         initCheckpointerFunc = initCheckpointer;
     }
 
@@ -46,9 +50,33 @@ public:
 
     void checkpoint(main::ClientContext& clientContext);
 
+    // Prevents checkpoints until unpinCheckpoint() is called, so that the database file stays as
+    // of the last checkpoint, e.g. while it is backed up. The snapshot function runs while no
+    // transaction can commit. Commits skip the auto checkpoints they would trigger meanwhile,
+    // commits that must checkpoint (e.g. COPY) wait until it is unpinned, and explicit checkpoints
+    // fail.
+    void pinCheckpoint(const std::function<void()>& snapshotFunc);
+    void unpinCheckpoint();
+
+    // Timestamp of the latest durable commit, which new transactions start from.
+    common::transaction_t getLastCommitTS() const { return lastTimestamp.load(); }
+    // Whether a commit failed to be made durable. The database must then be reopened, and no
+    // transaction can start anymore.
+    bool isInvalidated() const { return invalidated.load(); }
+    // Whether a write or recovery transaction is active. Doesn't wait for a commit or checkpoint
+    // in progress, and returns true instead.
+    bool mayHaveActiveWriteTransaction();
+
     static TransactionManager* Get(const main::ClientContext& context);
 
 private:
+    // Read-only transactions start and end without taking mtxForSerializingPublicFunctionCalls.
+    Transaction* beginReadOnlyTransaction(main::ClientContext& clientContext);
+    void clearReadOnlyTransaction(common::transaction_t transactionID);
+    // Smallest start timestamp among active transactions other than the given one, or the latest
+    // commit timestamp if there are none. Must be called with mtxForSerializingPublicFunctionCalls.
+    common::transaction_t getMinActiveStartTSNoLock(common::transaction_t excludedTransactionID);
+
     bool hasNoActiveTransactions() const;
     void checkpointNoLock(main::ClientContext& clientContext);
 
@@ -63,12 +91,48 @@ private:
     }
 
     void clearTransactionNoLock(common::transaction_t transactionID);
+    // Moves a committed write transaction to committingTransactions.
+    void startCommittingNoLock(common::transaction_t transactionID);
+    // Removes a transaction from committingTransactions, and publishes the commits which no
+    // earlier commit still waits for.
+    void finishCommittingNoLock(common::transaction_t transactionID);
+    void checkNotInvalidated() const;
 
 private:
+    struct ReadOnlyTransactionShard {
+        std::mutex mtx;
+        std::vector<std::unique_ptr<Transaction>> transactions;
+    };
+    static constexpr uint64_t NUM_READ_ONLY_TRANSACTION_SHARDS = 16;
+
     storage::WAL& wal;
+    // Write and recovery transactions.
     std::vector<std::unique_ptr<Transaction>> activeTransactions;
-    common::transaction_t lastTransactionID;
-    common::transaction_t lastTimestamp;
+    // Write transactions which are committed, but whose commit is not durable yet. They are kept
+    // until it is, so that their commits stay invisible to new read-only transactions until then.
+    // New write transactions start after them instead.
+    std::vector<std::unique_ptr<Transaction>> committingTransactions;
+    // Read-only transactions, sharded by transaction ID so that they rarely contend.
+    std::array<ReadOnlyTransactionShard, NUM_READ_ONLY_TRANSACTION_SHARDS> readOnlyTransactions;
+    std::atomic<uint64_t> numActiveReadOnlyTransactions = 0;
+    // Set while new read-only transactions must wait, i.e. while checkpointing. Other
+    // transactions are held back by mtxForSerializingPublicFunctionCalls.
+    std::atomic<bool> stopNewTransactions = false;
+    // Number of callers of pinCheckpoint() that have not unpinned it yet. Only changed and read
+    // with mtxForSerializingPublicFunctionCalls.
+    uint64_t numCheckpointPins = 0;
+    // Notified when the last pin is released.
+    std::condition_variable checkpointUnpinnedCV;
+    std::atomic<common::transaction_t> lastTransactionID;
+    // Timestamp of the latest commit visible to new transactions. It is only advanced once the
+    // commit is applied and durable, so that transactions taking it as their start timestamp see
+    // all of the commit or none of it, and never a commit which may be lost.
+    std::atomic<common::transaction_t> lastTimestamp;
+    // Timestamp of the latest commit applied, which commits take their timestamps after. Only
+    // changed and read with mtxForSerializingPublicFunctionCalls.
+    common::transaction_t lastAppliedTimestamp;
+    // Set once a commit failed to be made durable.
+    std::atomic<bool> invalidated = false;
     // This mutex is used to ensure thread safety and letting only one public function to be called
     // at any time except the stopNewTransactionsAndWaitUntilAllReadTransactionsLeave
     // function, which needs to let calls to coming and rollback.
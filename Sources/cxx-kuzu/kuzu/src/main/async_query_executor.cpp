@@ -0,0 +1,79 @@
+#include "main/async_query_executor.h"
+
+#include <algorithm>
+
+namespace kuzu {
+namespace main {
+
+#ifndef __SINGLE_THREADED__
+AsyncQueryExecutor::AsyncQueryExecutor(uint64_t numThreads)
+    : numThreads{std::max<uint64_t>(numThreads, 1)}, stopped{false} {}
+
+AsyncQueryExecutor::~AsyncQueryExecutor() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+    }
+    cv.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void AsyncQueryExecutor::submit(const void* key, std::function<void()> job) {
+    {
+        std::unique_lock lck{mtx};
+        jobs.push_back(Job{key, std::move(job)});
+        if (threads.size() < numThreads) {
+            threads.emplace_back([this]() { runWorkerThread(); });
+        }
+    }
+    cv.notify_one();
+}
+
+void AsyncQueryExecutor::runWorkerThread() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lck{mtx};
+            auto it = jobs.end();
+            cv.wait(lck, [&]() {
+                it = std::find_if(jobs.begin(), jobs.end(),
+                    [&](const Job& job) { return !isKeyRunningNoLock(job.key); });
+                return it != jobs.end() || (stopped && jobs.empty());
+            });
+            // Queries submitted before the executor is stopped are still run, so that none of
+            // them is left without a result.
+            if (it == jobs.end()) {
+                return;
+            }
+            job = std::move(*it);
+            jobs.erase(it);
+            if (job.key != nullptr) {
+                runningKeys.insert(job.key);
+            }
+        }
+        job.run();
+        if (job.key != nullptr) {
+            {
+                std::unique_lock lck{mtx};
+                runningKeys.erase(job.key);
+            }
+            // The next job of the key may be waiting for a thread.
+            cv.notify_all();
+        }
+    }
+}
+#else
+// Without threads, queries are run on the thread submitting them.
+AsyncQueryExecutor::AsyncQueryExecutor(uint64_t /*numThreads*/) {}
+
+AsyncQueryExecutor::~AsyncQueryExecutor() = default;
+
+void AsyncQueryExecutor::submit(const void* /*key*/, std::function<void()> job) {
+    job();
+}
+#endif
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,49 @@
+#include "main/async_query_result.h"
+
+#include "main/client_context.h"
+#include "main/connection.h"
+
+namespace kuzu {
+namespace main {
+
+bool AsyncQueryResult::isDone() {
+    std::unique_lock lck{mtx};
+    return done;
+}
+
+void AsyncQueryResult::wait() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [this]() { return done; });
+}
+
+std::unique_ptr<QueryResult> AsyncQueryResult::getResult() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [this]() { return done; });
+    return std::move(result);
+}
+
+void AsyncQueryResult::interrupt() {
+    std::unique_lock lck{mtx};
+    interrupted = true;
+    if (started && !done) {
+        connection->clientContext->interruptQuery(queryID);
+    }
+}
+
+bool AsyncQueryResult::start() {
+    std::unique_lock lck{mtx};
+    started = true;
+    return !interrupted;
+}
+
+void AsyncQueryResult::finish(std::unique_ptr<QueryResult> queryResult) {
+    {
+        std::unique_lock lck{mtx};
+        result = std::move(queryResult);
+        done = true;
+    }
+    cv.notify_all();
+}
+
+} // namespace main
+} // namespace kuzu
@@ -1,8 +1,10 @@
 #include "main/client_context.h"
 
 #include "binder/binder.h"
+#include "catalog/catalog.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
+#include "common/exception/reoptimization.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
@@ -15,14 +17,21 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/query_result/materialized_query_result.h"
+#include "main/query_result_cache.h"
+#include "main/workload_recorder.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/planner.h"
+#include "main/query_result/streaming_query_result.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "processor/result/result_stream.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
@@ -43,23 +52,38 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace main {
 
-ActiveQuery::ActiveQuery() : interrupted{false} {}
+ActiveQuery::ActiveQuery()
+    : interrupted{false}, queryID{INVALID_QUERY_ID}, interruptedQueryID{INVALID_QUERY_ID} {}
 
 void ActiveQuery::reset() {
     interrupted = false;
+    queryID = INVALID_QUERY_ID;
     timer = Timer();
 }
 
-ClientContext::ClientContext(Database* database) : localDatabase{database} {
+static uint64_t getNextClientID() {
+    static std::atomic<uint64_t> nextClientID{0};
+    return nextClientID.fetch_add(1, std::memory_order_relaxed);
+}
+
+ClientContext::ClientContext(Database* database)
+    : clientID{getNextClientID()}, localDatabase{database} {
     transactionContext = std::make_unique<TransactionContext>(*this);
     randomEngine = std::make_unique<RandomEngine>();
     remoteDatabase = nullptr;
     graphEntrySet = std::make_unique<graph::GraphEntrySet>();
+    initClientConfig();
+    progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
+    warningContext = std::make_unique<WarningContext>(&clientConfig);
+}
+
+void ClientContext::initClientConfig() {
+    clientConfig = ClientConfig{};
     clientConfig.homeDirectory = getUserHomeDir();
     clientConfig.fileSearchPath = "";
     clientConfig.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
     clientConfig.enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
-    clientConfig.numThreads = database->dbConfig.maxNumThreads;
+    clientConfig.numThreads = localDatabase->dbConfig.maxNumThreads;
     clientConfig.timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     clientConfig.varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
     clientConfig.enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
@@ -69,11 +93,27 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
-    progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
-    warningContext = std::make_unique<WarningContext>(&clientConfig);
+}
+
+void ClientContext::resetForReuse() {
+    lock_t lck{mtx};
+    closeActiveStreamNoLock();
+    transactionContext->rollback();
+    initClientConfig();
+    progressBar->toggleProgressBarPrinting(clientConfig.enableProgressBar);
+    warningContext->clearPopulatedWarnings();
+    extensionOptionValues.clear();
+    cachedPreparedStatementManager.clear();
+    // Cached plans may have been bound under the settings of the previous user.
+    queryPlanCache.clear();
+    graphEntrySet = std::make_unique<graph::GraphEntrySet>();
+    remoteDatabase = nullptr;
+    useInternalCatalogEntry_ = false;
+    resetActiveQuery();
 }
 
 ClientContext::~ClientContext() {
+    closeActiveStreamNoLock();
     if (preventTransactionRollbackOnDestruction) {
         return;
     }
@@ -265,6 +305,7 @@ void ClientContext::cleanUp() {
 std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_view query,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     std::unique_lock lck{mtx};
+    closeActiveStreamNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -284,6 +325,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_
     }
     auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
         true /*shouldCommitNewTransaction*/, std::move(inputParamsTmp));
+    cachedStatement->query = std::string{query};
     preparedStatement->cachedPreparedStatementName =
         cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
     useInternalCatalogEntry_ = false;
@@ -311,9 +353,92 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
     // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    closeActiveStreamNoLock();
+    auto recorder = localDatabase->getWorkloadRecorder();
+    if (!recorder->isEnabled() || !preparedStatement->isSuccess()) [[likely]] {
+        return executeWithParamsNoLock(preparedStatement, inputParams, queryID,
+            true /* canStreamResult */);
+    }
+    const auto startInMicros = recorder->getTimeInMicros();
+    auto result = executeWithParamsNoLock(preparedStatement, inputParams, queryID,
+        true /* canStreamResult */);
+    auto name = preparedStatement->getName();
+    if (cachedPreparedStatementManager.containsStatement(name)) {
+        auto& statementQuery = cachedPreparedStatementManager.getCachedStatement(name)->query;
+        recorder->recordQuery(*this, statementQuery, &preparedStatement->parameterMap,
+            startInMicros, result->isSuccess());
+    }
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeMany(PreparedStatement* preparedStatement,
+    const std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>& paramSets) {
+    lock_t lck{mtx};
+    closeActiveStreamNoLock();
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
+    if (preparedStatement->getStatementType() == StatementType::TRANSACTION) {
+        return QueryResult::getQueryResultWithError(
+            "Connection Exception: Cannot execute a transaction statement with multiple parameter "
+            "sets.");
+    }
+    if (paramSets.empty()) {
+        return QueryResult::getQueryResultWithError(
+            "Connection Exception: No parameter set is given.");
+    }
+    // All executions run in a single transaction, so that they are committed, and their WAL
+    // records synced, once. Without an active transaction, a manual one is started, which the
+    // executions don't commit.
+    const auto commitTransaction = !transactionContext->hasActiveTransaction();
+    try {
+        if (commitTransaction) {
+            if (preparedStatement->isReadOnly()) {
+                transactionContext->beginReadTransaction();
+            } else {
+                validateTransaction(false /* readOnly */, false /* requireTransaction */);
+                transactionContext->beginWriteTransaction();
+            }
+        }
+    } catch (std::exception& e) {
+        return QueryResult::getQueryResultWithError(e.what());
+    }
+    std::unique_ptr<QueryResult> result;
+    for (auto& params : paramSets) {
+        result = executeWithParamsNoLock(preparedStatement, params, std::nullopt /* queryID */,
+            false /* canStreamResult */);
+        if (!result->isSuccess()) {
+            // Errors raised before executing, e.g. when binding the parameters, leave the
+            // transaction started here open.
+            if (commitTransaction && transactionContext->hasActiveTransaction()) {
+                transactionContext->rollback();
+            }
+            return result;
+        }
+    }
+    if (commitTransaction) {
+        try {
+            transactionContext->commit();
+        } catch (CheckpointException& e) {
+            transactionContext->clearTransaction();
+            return QueryResult::getQueryResultWithError(e.what());
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            return QueryResult::getQueryResultWithError(e.what());
+        }
+    }
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeWithParamsNoLock(
+    PreparedStatement* preparedStatement,
+    const std::unordered_map<std::string, std::unique_ptr<Value>>& inputParams,
+    std::optional<uint64_t> queryID, bool canStreamResult) {
+    if (!preparedStatement->isSuccess()) {
+        return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
+    }
+    // The text of a prepared statement is not kept.
+    activeQuery.query.clear();
     try {
         bindParametersNoLock(*preparedStatement, inputParams);
     } catch (std::exception& e) {
@@ -328,22 +453,162 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
+    // Only the statements prepared from their text can be looked up in the query result cache.
+    const auto useQueryResultCache =
+        !cachedStatement->query.empty() && canUseQueryResultCache({} /* config */);
+    std::string resultCacheKey;
+    if (useQueryResultCache) {
+        resultCacheKey = QueryResultCache::getKey(cachedStatement->query, clientConfig,
+            preparedStatement->parameterMap);
+        auto cachedResult = getCachedQueryResultNoLock(resultCacheKey);
+        if (cachedResult != nullptr) {
+            return cachedResult;
+        }
+    }
+    auto catalog = catalog::Catalog::Get(*this);
+    auto catalogChangeEpoch = catalog->getChangeEpoch();
     // rebind
     auto [newPreparedStatement, newCachedStatement] =
         prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
             preparedStatement->parameterMap);
     useInternalCatalogEntry_ = false;
-    return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    auto plan = std::make_shared<CachedQueryPlan>(std::move(newPreparedStatement),
+        std::move(newCachedStatement), catalog, catalogChangeEpoch);
+    if (useQueryResultCache &&
+        QueryResultCache::canCache(*plan->preparedStatement, *plan->cachedStatement)) {
+        return executeAndCacheResultNoLock(resultCacheKey, *plan, queryID, {} /* config */);
+    }
+    return executeNoLock(plan->preparedStatement.get(), plan->cachedStatement.get(), queryID,
+        {} /* config */, canStreamResult ? plan : nullptr);
 }
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
     lock_t lck{mtx};
-    return queryNoLock(query, queryID, config);
+    closeActiveStreamNoLock();
+    auto recorder = localDatabase->getWorkloadRecorder();
+    if (!recorder->isEnabled()) [[likely]] {
+        return queryNoLock(query, queryID, config);
+    }
+    const auto startInMicros = recorder->getTimeInMicros();
+    auto result = queryNoLock(query, queryID, config);
+    recorder->recordQuery(*this, std::string{query}, nullptr /* parameters */, startInMicros,
+        result->isSuccess());
+    return result;
+}
+
+bool ClientContext::canUseQueryPlanCache() const {
+    if (clientConfig.queryPlanCacheSize == 0) {
+        return false;
+    }
+    // The catalog change epoch doesn't include the uncommitted changes of the active transaction.
+    return !transactionContext->hasActiveTransaction() ||
+           !transactionContext->getActiveTransaction()->hasUncommittedCatalogChanges();
+}
+
+bool ClientContext::canUseQueryResultCache(QueryConfig config) const {
+    // The results of queries run in a manual transaction may include its uncommitted changes.
+    return getDBConfig()->queryResultCacheSize > 0 &&
+           config.resultType == QueryResultType::FTABLE &&
+           !transactionContext->hasActiveTransaction() && !hasDefaultDatabase() &&
+           !useInternalCatalogEntry();
+}
+
+std::unique_ptr<QueryResult> ClientContext::getCachedQueryResultNoLock(const std::string& key) {
+    auto lookupTimer = TimeMetric(true /* enable */);
+    lookupTimer.start();
+    auto catalog = catalog::Catalog::Get(*this);
+    auto cachedResult = localDatabase->getQueryResultCache()->getResult(key, catalog,
+        catalog->getChangeEpoch(), TransactionManager::Get(*this)->getLastCommitTS());
+    lookupTimer.stop();
+    if (cachedResult == nullptr) {
+        return nullptr;
+    }
+    // The table is shared with the cache, and only read by the result.
+    auto result = std::make_unique<MaterializedQueryResult>(cachedResult->columnNames,
+        LogicalType::copy(cachedResult->columnTypes), cachedResult->table);
+    PreparedSummary preparedSummary;
+    preparedSummary.statementType = StatementType::QUERY;
+    preparedSummary.compilingTime = lookupTimer.getElapsedTimeMS();
+    auto summary = std::make_unique<QuerySummary>(preparedSummary);
+    summary->setExecutionTime(0);
+    result->setQuerySummary(std::move(summary));
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeAndCacheResultNoLock(const std::string& key,
+    CachedQueryPlan& plan, std::optional<uint64_t> queryID, QueryConfig config) {
+    auto transactionManager = TransactionManager::Get(*this);
+    const auto dataVersion = transactionManager->getLastCommitTS();
+    auto result = executeNoLock(plan.preparedStatement.get(), plan.cachedStatement.get(), queryID,
+        config);
+    // The transaction of the query started from the last commit before it started, which is the
+    // one read before only if nothing was committed meanwhile.
+    if (!result->isSuccess() || result->getType() != QueryResultType::FTABLE ||
+        transactionManager->getLastCommitTS() != dataVersion) {
+        return result;
+    }
+    auto cachedResult = std::make_shared<CachedQueryResult>(
+        result->constCast<MaterializedQueryResult>().shareFactorizedTable(),
+        result->getColumnNames(), result->getColumnDataTypes(), plan.catalog,
+        plan.catalogChangeEpoch, dataVersion);
+    localDatabase->getQueryResultCache()->addResult(key, std::move(cachedResult),
+        getDBConfig()->queryResultCacheSize);
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeCachedPlanNoLock(
+    std::shared_ptr<CachedQueryPlan> plan, double lookupTime, std::optional<uint64_t> queryID,
+    QueryConfig config, const std::string* resultCacheKey) {
+    auto preparedStatement = plan->preparedStatement.get();
+    try {
+        validateTransaction(preparedStatement->isReadOnly(),
+            plan->cachedStatement->parsedStatement->requireTransaction());
+    } catch (std::exception& exception) {
+        return QueryResult::getQueryResultWithError(exception.what());
+    }
+    preparedStatement->preparedSummary.compilingTime = lookupTime;
+    preparedStatement->preparedSummary.planningTime = 0;
+    auto cachedStatement = plan->cachedStatement.get();
+    std::unique_ptr<QueryResult> queryResult;
+    if (resultCacheKey != nullptr &&
+        QueryResultCache::canCache(*preparedStatement, *cachedStatement)) {
+        queryResult = executeAndCacheResultNoLock(*resultCacheKey, *plan, queryID, config);
+    } else {
+        queryResult =
+            executeNoLock(preparedStatement, cachedStatement, queryID, config, std::move(plan));
+    }
+    useInternalCatalogEntry_ = false;
+    return queryResult;
 }
 
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    activeQuery.query = std::string{query};
+    const auto useQueryResultCache = canUseQueryResultCache(config);
+    std::string resultCacheKey;
+    if (useQueryResultCache) {
+        resultCacheKey =
+            QueryResultCache::getKey(activeQuery.query, clientConfig, {} /* parameters */);
+        auto cachedResult = getCachedQueryResultNoLock(resultCacheKey);
+        if (cachedResult != nullptr) {
+            return cachedResult;
+        }
+    }
+    auto useQueryPlanCache = canUseQueryPlanCache();
+    // The epoch is read before binding, so that a plan bound while the catalog changes is dropped.
+    auto catalog = catalog::Catalog::Get(*this);
+    auto catalogChangeEpoch = catalog->getChangeEpoch();
+    if (useQueryPlanCache) {
+        auto lookupTimer = TimeMetric(true /* enable */);
+        lookupTimer.start();
+        auto plan = queryPlanCache.getPlan(std::string{query}, catalog, catalogChangeEpoch);
+        lookupTimer.stop();
+        if (plan != nullptr) {
+            return executeCachedPlanNoLock(std::move(plan), lookupTimer.getElapsedTimeMS(),
+                queryID, config, useQueryResultCache ? &resultCacheKey : nullptr);
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -356,8 +621,25 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
-        auto currentQueryResult =
-            executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+        // The plan is shared with the cache, which may evict it while the query is executed.
+        auto plan = std::make_shared<CachedQueryPlan>(std::move(preparedStatement),
+            std::move(cachedStatement), catalog, catalogChangeEpoch);
+        if (useQueryPlanCache && parsedStatements.size() == 1 &&
+            QueryPlanCache::canCache(*plan->preparedStatement, *plan->cachedStatement)) {
+            queryPlanCache.addPlan(std::string{query}, plan, clientConfig.queryPlanCacheSize);
+        }
+        // Only the result of a single statement can be streamed or cached, as the result of each
+        // statement must be complete before the next statement is executed.
+        std::unique_ptr<QueryResult> currentQueryResult;
+        if (useQueryResultCache && parsedStatements.size() == 1 &&
+            QueryResultCache::canCache(*plan->preparedStatement, *plan->cachedStatement)) {
+            currentQueryResult =
+                executeAndCacheResultNoLock(resultCacheKey, *plan, queryID, config);
+        } else {
+            currentQueryResult = executeNoLock(plan->preparedStatement.get(),
+                plan->cachedStatement.get(), queryID, config,
+                parsedStatements.size() == 1 ? plan : nullptr);
+        }
         if (!currentQueryResult->isSuccess()) {
             if (!lastResult) {
                 queryResult = std::move(currentQueryResult);
@@ -466,10 +748,17 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 const auto boundStatement = binder.bind(*parsedStatement);
                 preparedStatement->unknownParameters = expressionBinder->getUnknownParameters();
                 preparedStatement->parameterMap = expressionBinder->getKnownParameters();
+                cachedStatement->isDeterministic =
+                    !expressionBinder->hasNondeterministicFunction();
                 cachedStatement->columns = boundStatement->getStatementResult()->getColumns();
+                auto planningTimer = TimeMetric(true /* enable */);
+                planningTimer.start();
                 auto planner = Planner(this);
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
+                planningTimer.stop();
+                preparedStatement->preparedSummary.planningTime =
+                    planningTimer.getElapsedTimeMS();
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
             },
             preparedStatement->isReadOnly(),
@@ -488,7 +777,7 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
 
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
-    QueryConfig queryConfig) {
+    QueryConfig queryConfig, std::shared_ptr<CachedQueryPlan> plan) {
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
@@ -497,6 +786,10 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     this->startTimer();
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
+    // The transaction of a streamed query is committed by the streaming thread, once the query
+    // has finished.
+    const auto streamResult =
+        plan != nullptr && canStreamResult(*preparedStatement, *cachedStatement, queryConfig);
     std::unique_ptr<QueryResult> result;
     try {
         bool isTransactionStatement =
@@ -504,16 +797,43 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
         TransactionHelper::runFuncInTransaction(
             *transactionContext,
             [&]() -> void {
-                const auto profiler = std::make_unique<Profiler>();
+                auto profiler = std::make_unique<Profiler>();
                 profiler->enabled = cachedStatement->logicalPlan->isProfile();
                 if (!queryID) {
                     queryID = localDatabase->getNextQueryID();
                 }
-                const auto executionContext =
+                activeQuery.queryID = *queryID;
+                auto executionContext =
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                // Options are set without a limit, so that a limit too low for any query can
+                // still be raised.
+                const auto memoryLimit =
+                    preparedStatement->getStatementType() == StatementType::STANDALONE_CALL ?
+                        0 :
+                        clientConfig.queryMemoryLimit;
+                executionContext->memoryTracker =
+                    std::make_shared<storage::QueryMemoryTracker>(memoryLimit);
+                executionContext->compilingTimeMS =
+                    preparedStatement->preparedSummary.compilingTime;
+                executionContext->parameters = &preparedStatement->parameterMap;
                 auto mapper = PlanMapper(executionContext.get());
-                const auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
+                auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
                     cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig);
+                if (streamResult) {
+                    auto root = physicalPlan->lastOperator.get();
+                    if (root->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR &&
+                        root->ptrCast<ResultCollector>()->canStreamResult()) {
+                        result = startStreamingNoLock(std::move(profiler),
+                            std::move(executionContext), std::move(physicalPlan), plan);
+                        return;
+                    }
+                    result = localDatabase->queryProcessor->execute(physicalPlan.get(),
+                        executionContext.get());
+                    if (transactionContext->isAutoTransaction()) {
+                        transactionContext->commit();
+                    }
+                    return;
+                }
                 if (isTransactionStatement) {
                     result = localDatabase->queryProcessor->execute(physicalPlan.get(),
                         executionContext.get());
@@ -522,19 +842,31 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                         // Note: We always force checkpoint for COPY_FROM statement.
                         Transaction::Get(*this)->setForceCheckpoint();
                     }
-                    result = localDatabase->queryProcessor->execute(physicalPlan.get(),
-                        executionContext.get());
+                    result = executeAdaptivelyNoLock(preparedStatement, cachedStatement,
+                        physicalPlan.get(), executionContext.get(), queryConfig);
                 }
             },
             preparedStatement->isReadOnly(), isTransactionStatement,
-            TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
-                !isTransactionStatement /*shouldCommitAutoTransaction*/));
+            streamResult ? TransactionHelper::TransactionCommitAction::NOT_COMMIT :
+                           TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
+                               !isTransactionStatement /*shouldCommitAutoTransaction*/));
     } catch (std::exception& e) {
         useInternalCatalogEntry_ = false;
         return handleFailedExecution(queryID, e);
     }
-    const auto memoryManager = storage::MemoryManager::Get(*this);
-    memoryManager->getBufferManager()->getSpillerOrSkip([](auto& spiller) { spiller.clearFile(); });
+    if (result->getType() == QueryResultType::STREAMING) {
+        // The execution time of a streamed query is the time until its first chunk is available.
+        const auto errorMessage = activeStream->waitForFirstChunk();
+        if (!errorMessage.empty()) {
+            // A query that fails before streaming any tuple fails like one that isn't streamed.
+            closeActiveStreamNoLock();
+            return QueryResult::getQueryResultWithError(errorMessage);
+        }
+    } else {
+        const auto memoryManager = storage::MemoryManager::Get(*this);
+        memoryManager->getBufferManager()->getSpillerOrSkip(
+            [](auto& spiller) { spiller.clearFile(); });
+    }
     executingTimer.stop();
     result->setColumnNames(cachedStatement->getColumnNames());
     result->setColumnTypes(cachedStatement->getColumnTypes());
@@ -544,6 +876,103 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return result;
 }
 
+bool ClientContext::canStreamResult(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement, QueryConfig config) const {
+    return clientConfig.streamingResultBuffer > 0 &&
+           config.resultType == QueryResultType::FTABLE &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           preparedStatement.isReadOnly() && !cachedStatement.logicalPlan->isProfile() &&
+           !cachedStatement.useInternalCatalogEntry;
+}
+
+bool ClientContext::canReoptimize(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+    return clientConfig.adaptiveReoptimizationThreshold > 0 &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           preparedStatement.isReadOnly() && !cachedStatement.logicalPlan->isProfile();
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeAdaptivelyNoLock(
+    PreparedStatement* preparedStatement, CachedPreparedStatement* cachedStatement,
+    PhysicalPlan* physicalPlan, ExecutionContext* executionContext, QueryConfig config) {
+    executionContext->canReoptimize = canReoptimize(*preparedStatement, *cachedStatement);
+    try {
+        return localDatabase->queryProcessor->execute(physicalPlan, executionContext);
+    } catch (ReoptimizationException& e) {
+        progressBar->endProgress(executionContext->queryID);
+        // The scheduler interrupts the query when a task of it throws.
+        activeQuery.interrupted = false;
+        executionContext->canReoptimize = false;
+        numReoptimizedExecutions++;
+        // The query is re-planned in the same transaction, so it sees the same data. The
+        // cardinalities observed by earlier re-plans of the statement are kept, so that its plan
+        // converges instead of alternating between subgraphs estimated wrong.
+        observedCardinalities = cachedStatement->observedCardinalities;
+        observedCardinalities.insert_or_assign(e.getSubgraphKey(), e.getObservedCardinality());
+        auto [replannedStatement, replannedCachedStatement] =
+            prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
+                preparedStatement->parameterMap);
+        if (!replannedStatement->isSuccess()) {
+            observedCardinalities.clear();
+            throw RuntimeException(replannedStatement->errMsg);
+        }
+        // The re-planned statement replaces the cached one, so that later executions of the
+        // query, e.g. through the query plan cache, start from it.
+        cachedStatement->logicalPlan = std::move(replannedCachedStatement->logicalPlan);
+        cachedStatement->columns = std::move(replannedCachedStatement->columns);
+        cachedStatement->observedCardinalities = std::move(observedCardinalities);
+        observedCardinalities.clear();
+        auto mapper = PlanMapper(executionContext);
+        auto replannedPhysicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
+            cachedStatement->columns, config.resultType, config.arrowConfig);
+        return localDatabase->queryProcessor->execute(replannedPhysicalPlan.get(),
+            executionContext);
+    }
+}
+
+std::unique_ptr<QueryResult> ClientContext::startStreamingNoLock(
+    std::unique_ptr<Profiler> profiler, std::unique_ptr<ExecutionContext> executionContext,
+    std::unique_ptr<PhysicalPlan> physicalPlan, std::shared_ptr<CachedQueryPlan> plan) {
+    KU_ASSERT(!streamingThread.joinable());
+    auto stream = std::make_shared<ResultStream>(clientConfig.streamingResultBuffer);
+    stream->setCancelCallback([this]() { interrupt(); });
+    physicalPlan->lastOperator->ptrCast<ResultCollector>()->getSharedState()->setStream(stream);
+    activeStream = stream;
+    streamingThread = std::thread([this, stream, profiler = std::move(profiler),
+                                      executionContext = std::move(executionContext),
+                                      physicalPlan = std::move(physicalPlan),
+                                      plan = std::move(plan)]() {
+        std::string errorMessage;
+        try {
+            localDatabase->queryProcessor->execute(physicalPlan.get(), executionContext.get());
+            if (transactionContext->isAutoTransaction()) {
+                transactionContext->commit();
+            }
+        } catch (CheckpointException& e) {
+            transactionContext->clearTransaction();
+            errorMessage = e.what();
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            progressBar->endProgress(executionContext->queryID);
+            errorMessage = e.what();
+        }
+        const auto memoryManager = storage::MemoryManager::Get(*this);
+        memoryManager->getBufferManager()->getSpillerOrSkip(
+            [](auto& spiller) { spiller.clearFile(); });
+        stream->finish(std::move(errorMessage));
+    });
+    return std::make_unique<StreamingQueryResult>(std::move(stream));
+}
+
+void ClientContext::closeActiveStreamNoLock() {
+    if (!streamingThread.joinable()) {
+        return;
+    }
+    activeStream->cancel();
+    streamingThread.join();
+    activeStream.reset();
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     const auto memoryManager = storage::MemoryManager::Get(*this);
@@ -2,7 +2,11 @@
 
 #include <utility>
 
+#include "common/exception/interrupt.h"
+#include "common/finally_wrapper.h"
 #include "common/random_engine.h"
+#include "function/table/arrow_stream_scan.h"
+#include "main/async_query_executor.h"
 
 using namespace kuzu::parser;
 using namespace kuzu::binder;
@@ -19,6 +23,22 @@ Connection::Connection(Database* database) {
     this->database = database;
     this->dbLifeCycleManager = database->dbLifeCycleManager;
     clientContext = std::make_unique<ClientContext>(database);
+    clientContext->addScanReplace(function::ScanReplacement(
+        [](const std::string&) { return std::vector<function::scan_replace_handle_t>{}; },
+        [this](std::span<function::scan_replace_handle_t> handles)
+            -> std::unique_ptr<function::ScanReplacementData> {
+            KU_ASSERT(handles.size() == 1);
+            {
+                std::unique_lock lck{arrowStreamsMtx};
+                if (!arrowStreams.contains(handles[0])) {
+                    return nullptr;
+                }
+            }
+            auto data = std::make_unique<function::ScanReplacementData>();
+            data->func = function::ArrowStreamScanFunction::getFunction();
+            data->bindInput.addLiteralParam(Value::createValue(handles[0]));
+            return data;
+        }));
 }
 
 Connection::~Connection() {
@@ -53,6 +73,32 @@ std::unique_ptr<QueryResult> Connection::query(std::string_view queryStatement)
     return queryResult;
 }
 
+std::shared_ptr<AsyncQueryResult> Connection::queryAsync(std::string_view queryStatement,
+    std::function<void()> onDone) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto asyncResult = std::make_shared<AsyncQueryResult>(this, database->getNextQueryID());
+    // The queries of the connection are keyed by it, so that they don't hold threads of the
+    // executor while waiting for each other.
+    database->getAsyncQueryExecutor()->submit(this,
+        [this, queryStatement = std::string(queryStatement), asyncResult, onDone]() {
+            std::unique_ptr<QueryResult> queryResult;
+            if (!asyncResult->start()) {
+                queryResult = QueryResult::getQueryResultWithError(InterruptException().what());
+            } else {
+                try {
+                    queryResult = queryWithID(queryStatement, asyncResult->queryID);
+                } catch (std::exception& e) {
+                    queryResult = QueryResult::getQueryResultWithError(e.what());
+                }
+            }
+            asyncResult->finish(std::move(queryResult));
+            if (onDone) {
+                onDone();
+            }
+        });
+    return asyncResult;
+}
+
 std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, int64_t chunkSize) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
     auto queryResult = clientContext->query(query, std::nullopt,
@@ -69,11 +115,37 @@ std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryState
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::copyFromArrowStream(std::string_view tableName,
+    ArrowArrayStream* stream) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto handle = reinterpret_cast<function::scan_replace_handle_t>(stream);
+    {
+        std::unique_lock lck{arrowStreamsMtx};
+        arrowStreams.insert(handle);
+    }
+    FinallyWrapper streamRemover{[&]() {
+        std::unique_lock lck{arrowStreamsMtx};
+        arrowStreams.erase(handle);
+    }};
+    std::unordered_map<std::string, std::unique_ptr<Value>> params;
+    params.emplace("stream", std::make_unique<Value>(Value::createValue(handle)));
+    auto preparedStatement = clientContext->prepareWithParams(
+        stringFormat("COPY `{}` FROM $stream", std::string(tableName)), std::move(params));
+    auto queryResult = clientContext->executeWithParams(preparedStatement.get(), {});
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 void Connection::interrupt() {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
     clientContext->interrupt();
 }
 
+common::QueryProgress Connection::getQueryProgress() {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    return common::ProgressBar::Get(*clientContext)->getQueryProgress();
+}
+
 void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
     clientContext->setQueryTimeOut(timeoutInMS);
@@ -87,6 +159,14 @@ std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* pr
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::executeMany(PreparedStatement* preparedStatement,
+    const std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>& paramSets) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto queryResult = clientContext->executeMany(preparedStatement, paramSets);
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParamsWithID(
     PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams, uint64_t queryID) {
@@ -0,0 +1,54 @@
+#include "main/connection_pool.h"
+
+#include "common/exception/runtime.h"
+#include "main/connection.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace main {
+
+ConnectionPool::ConnectionPool(Database* database) : database{database} {}
+
+ConnectionPool::~ConnectionPool() = default;
+
+std::unique_ptr<Connection> ConnectionPool::acquire() {
+    {
+        std::unique_lock lck{mtx};
+        if (!idleConnections.empty()) {
+            auto connection = std::move(idleConnections.back());
+            idleConnections.pop_back();
+            return connection;
+        }
+    }
+    return std::make_unique<Connection>(database);
+}
+
+void ConnectionPool::release(std::unique_ptr<Connection> connection) {
+    if (connection == nullptr) {
+        return;
+    }
+    if (connection->getClientContext()->getDatabase() != database) {
+        throw RuntimeException("Cannot release a connection to a different database.");
+    }
+    // The connection is reset outside the lock, as resetting waits for its streamed query and
+    // rolls back its transaction.
+    try {
+        connection->getClientContext()->resetForReuse();
+    } catch (std::exception&) {
+        // A connection that can't be reset isn't reused.
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (idleConnections.size() < database->getConfig().connectionPoolSize) {
+        idleConnections.push_back(std::move(connection));
+    }
+}
+
+uint64_t ConnectionPool::getNumIdleConnections() {
+    std::unique_lock lck{mtx};
+    return idleConnections.size();
+}
+
+} // namespace main
+} // namespace kuzu
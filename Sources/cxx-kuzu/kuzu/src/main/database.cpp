@@ -5,8 +5,15 @@
 #include "extension/mapper_extension.h"
 #include "extension/planner_extension.h"
 #include "extension/transformer_extension.h"
+#include "main/async_query_executor.h"
 #include "main/client_context.h"
+#include "main/connection.h"
+#include "main/connection_pool.h"
 #include "main/database_manager.h"
+#include "main/query_result_cache.h"
+#include "main/query_stats.h"
+#include "main/workload_recorder.h"
+#include "parser/parser.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 #if defined(_WIN32)
@@ -17,6 +24,7 @@
 
 #include "common/exception/exception.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/tracer.h"
 #include "main/db_config.h"
 #include "processor/processor.h"
 #include "storage/storage_extension.h"
@@ -34,7 +42,8 @@ namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
     bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold,
-    bool forceCheckpointOnClose, bool throwOnWalReplayFailure, bool enableChecksums
+    bool forceCheckpointOnClose, bool throwOnWalReplayFailure, bool enableChecksums, bool directIO,
+    bool enableHugePages, bool warmUpBufferPool, bool enableTwoQueueEviction
 #if defined(__APPLE__)
     ,
     uint32_t threadQos
@@ -43,7 +52,9 @@ SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, boo
     : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly{readOnly},
       autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold},
       forceCheckpointOnClose{forceCheckpointOnClose},
-      throwOnWalReplayFailure(throwOnWalReplayFailure), enableChecksums(enableChecksums) {
+      throwOnWalReplayFailure(throwOnWalReplayFailure), enableChecksums(enableChecksums),
+      directIO{directIO}, enableHugePages{enableHugePages}, warmUpBufferPool{warmUpBufferPool},
+      enableTwoQueueEviction{enableTwoQueueEviction} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
@@ -95,7 +106,9 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig,
 std::unique_ptr<BufferManager> Database::initBufferManager(const Database& db) {
     return std::make_unique<BufferManager>(db.databasePath,
         StorageUtils::getTmpFilePath(db.databasePath), db.dbConfig.bufferPoolSize,
-        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly);
+        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly, db.dbConfig.enableHugePages,
+        db.dbConfig.enableTwoQueueEviction ? EvictionPolicy::TWO_QUEUE :
+                                             EvictionPolicy::SECOND_CHANCE);
 }
 
 void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFunc) {
@@ -128,6 +141,12 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
 
     extensionManager = std::make_unique<extension::ExtensionManager>();
     dbLifeCycleManager = std::make_shared<DatabaseLifeCycleManager>();
+    connectionPool = std::make_unique<ConnectionPool>(this);
+    queryStatsLog = std::make_unique<QueryStatsLog>();
+    slowQueryLog = std::make_unique<SlowQueryLog>();
+    workloadRecorder = std::make_unique<WorkloadRecorder>();
+    queryResultCache = std::make_unique<QueryResultCache>();
+    parser::Parser::warmUp();
     if (clientContext.isInMemory()) {
         storageManager->initDataFileHandle(vfs.get(), &clientContext);
         extensionManager->autoLoadLinkedExtensions(&clientContext);
@@ -135,18 +154,54 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     }
     StorageManager::recover(clientContext, dbConfig.throwOnWalReplayFailure,
         dbConfig.enableChecksums);
+    if (dbConfig.warmUpBufferPool) {
+        bufferManager->startWarmUp(*storageManager->getDataFH(),
+            StorageUtils::getHotPagesFilePath(databasePath), *queryProcessor->getTaskScheduler());
+    }
 }
 
 Database::~Database() {
+    // The warm-up tasks read pages with the workers of the query processor.
+    bufferManager->stopWarmUp();
+    // Wait for the queries submitted through Connection::queryAsync before closing the database.
+    asyncQueryExecutor.reset();
+    // Idle connections hold client contexts, which must go before the components they refer to.
+    connectionPool.reset();
     if (!dbConfig.readOnly && dbConfig.forceCheckpointOnClose) {
         try {
             ClientContext clientContext(this);
+            storageManager->runIndexMaintenance(clientContext);
             transactionManager->checkpoint(clientContext);
         } catch (...) {} // NOLINT
+    } else if (!dbConfig.readOnly && dbConfig.warmUpBufferPool &&
+               !DBConfig::isDBPathInMemory(databasePath)) {
+        // Checkpoints save the manifest themselves.
+        bufferManager->saveHotPageManifest(*storageManager->getDataFH(),
+            StorageUtils::getHotPagesFilePath(databasePath));
     }
+    common::Tracer::Get().stop(vfs.get());
+    workloadRecorder->stop();
+    // The file systems outlive the memory manager.
+    vfs->releaseMemory();
     dbLifeCycleManager->isDatabaseClosed = true;
 }
 
+AsyncQueryExecutor* Database::getAsyncQueryExecutor() {
+    std::unique_lock lck{asyncQueryExecutorMtx};
+    if (asyncQueryExecutor == nullptr) {
+        asyncQueryExecutor = std::make_unique<AsyncQueryExecutor>(dbConfig.maxNumThreads);
+    }
+    return asyncQueryExecutor.get();
+}
+
+std::unique_ptr<Connection> Database::acquireConnection() {
+    return connectionPool->acquire();
+}
+
+void Database::releaseConnection(std::unique_ptr<Connection> connection) {
+    connectionPool->release(std::move(connection));
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
 void Database::registerFileSystem(std::unique_ptr<FileSystem> fs) {
     vfs->registerFileSystem(std::move(fs));
@@ -22,17 +22,38 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskSetting),
-    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting)};
+    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting),
+    GET_CONFIGURATION(SchedulingClassSetting), GET_CONFIGURATION(EvictionPolicySetting),
+    GET_CONFIGURATION(WALGroupCommitDelaySetting),
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+    GET_CONFIGURATION(DebugFailWALSyncSetting),
+#endif
+    GET_CONFIGURATION(CSRCacheRelTablesSetting),
+    GET_CONFIGURATION(PKBloomFilterSetting), GET_CONFIGURATION(ProjectedGraphMemoryLimitSetting),
+    GET_CONFIGURATION(CopyMemoryBudgetSetting), GET_CONFIGURATION(QueryMemoryLimitSetting),
+    GET_CONFIGURATION(QueryPlanCacheSizeSetting), GET_CONFIGURATION(StreamingResultBufferSetting),
+    GET_CONFIGURATION(ConnectionPoolSizeSetting),
+    GET_CONFIGURATION(AdaptiveReoptimizationThresholdSetting),
+    GET_CONFIGURATION(JoinOrderPlanningBudgetSetting),
+    GET_CONFIGURATION(JoinOrderGreedyThresholdSetting), GET_CONFIGURATION(ProfileFormatSetting),
+    GET_CONFIGURATION(TraceFileSetting), GET_CONFIGURATION(SlowQueryThresholdSetting),
+    GET_CONFIGURATION(QueryStatsMaxQueryLengthSetting),
+    GET_CONFIGURATION(WorkloadRecordFileSetting), GET_CONFIGURATION(QueryResultCacheSizeSetting),
+    GET_CONFIGURATION(PipelineTuplesPerThreadSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
       autoCheckpoint{systemConfig.autoCheckpoint},
-      checkpointThreshold{systemConfig.checkpointThreshold},
+      checkpointThreshold{systemConfig.checkpointThreshold}, walGroupCommitDelayInMicros{0},
       forceCheckpointOnClose{systemConfig.forceCheckpointOnClose},
       throwOnWalReplayFailure(systemConfig.throwOnWalReplayFailure),
-      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true} {
+      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true},
+      enablePKBloomFilter{false}, connectionPoolSize{DEFAULT_CONNECTION_POOL_SIZE},
+      directIO{systemConfig.directIO}, enableHugePages{systemConfig.enableHugePages},
+      warmUpBufferPool{systemConfig.warmUpBufferPool},
+      enableTwoQueueEviction{systemConfig.enableTwoQueueEviction}, queryResultCacheSize{0} {
 #if defined(__APPLE__)
     this->threadQos = systemConfig.threadQos;
 #endif
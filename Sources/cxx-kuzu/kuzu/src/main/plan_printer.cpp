@@ -1,5 +1,7 @@
 #include "main/plan_printer.h"
 
+#include <algorithm>
+#include <map>
 #include <sstream>
 
 #include "json.hpp"
@@ -394,6 +396,81 @@ std::ostringstream PlanPrinter::printPlanToOstream(const PhysicalPlan* physicalP
     return OpProfileTree(physicalPlan->lastOperator.get(), *profiler).printPlanToOstream();
 }
 
+static void collectOperators(const PhysicalOperator* op,
+    std::unordered_map<physical_op_id, const PhysicalOperator*>& operators) {
+    operators.insert({op->getOperatorID(), op});
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectOperators(op->getChild(i), operators);
+    }
+}
+
+// Tasks grouped by the sink of their pipeline, with pipelines ordered by their first task.
+static std::vector<std::pair<physical_op_id, std::vector<PipelineTaskSpan>>> groupTasksByPipeline(
+    const Profiler& profiler) {
+    std::vector<std::pair<physical_op_id, std::vector<PipelineTaskSpan>>> result;
+    std::unordered_map<physical_op_id, uint64_t> pipelineIndices;
+    auto tasks = profiler.pipelineTasks;
+    std::sort(tasks.begin(), tasks.end(),
+        [](const auto& a, const auto& b) { return a.startMS < b.startMS; });
+    for (auto& task : tasks) {
+        auto [it, inserted] = pipelineIndices.emplace(task.sinkID, result.size());
+        if (inserted) {
+            result.emplace_back(task.sinkID, std::vector<PipelineTaskSpan>{});
+        }
+        result[it->second].second.push_back(task);
+    }
+    return result;
+}
+
+nlohmann::json PlanPrinter::printProfileToJson(const PhysicalPlan* physicalPlan,
+    Profiler* profiler) {
+    std::unordered_map<physical_op_id, const PhysicalOperator*> operators;
+    collectOperators(physicalPlan->lastOperator.get(), operators);
+    auto pipelines = nlohmann::json::array();
+    for (auto& [sinkID, tasks] : groupTasksByPipeline(*profiler)) {
+        auto pipeline = nlohmann::json();
+        pipeline["SinkID"] = sinkID;
+        if (operators.contains(sinkID)) {
+            pipeline["Sink"] = getOperatorName(operators.at(sinkID));
+        }
+        auto taskSpans = nlohmann::json::array();
+        for (auto& task : tasks) {
+            taskSpans.push_back(
+                {{"Thread", task.threadIdx}, {"StartMS", task.startMS}, {"EndMS", task.endMS}});
+        }
+        pipeline["Tasks"] = std::move(taskSpans);
+        pipelines.push_back(std::move(pipeline));
+    }
+    auto json = nlohmann::json();
+    json["Plan"] = printPlanToJson(physicalPlan, profiler);
+    json["Pipelines"] = std::move(pipelines);
+    return json;
+}
+
+std::ostringstream PlanPrinter::printPipelinesToOstream(const PhysicalPlan* physicalPlan,
+    Profiler* profiler) {
+    std::unordered_map<physical_op_id, const PhysicalOperator*> operators;
+    collectOperators(physicalPlan->lastOperator.get(), operators);
+    std::ostringstream oss;
+    oss << "Pipelines\n";
+    for (auto& [sinkID, tasks] : groupTasksByPipeline(*profiler)) {
+        auto startMS = tasks.front().startMS;
+        auto endMS = tasks.front().endMS;
+        std::map<uint64_t, double> timePerThread;
+        for (auto& task : tasks) {
+            endMS = std::max(endMS, task.endMS);
+            timePerThread[task.threadIdx] += task.endMS - task.startMS;
+        }
+        oss << (operators.contains(sinkID) ? getOperatorName(operators.at(sinkID)) : "UNKNOWN")
+            << " #" << sinkID << ": " << startMS << "ms - " << endMS << "ms";
+        for (auto& [threadIdx, timeMS] : timePerThread) {
+            oss << ", thread " << threadIdx << " " << timeMS << "ms";
+        }
+        oss << "\n";
+    }
+    return oss;
+}
+
 nlohmann::json PlanPrinter::printPlanToJson(const LogicalPlan* logicalPlan) {
     return toJson(logicalPlan->getLastOperator().get());
 }
@@ -425,6 +502,8 @@ nlohmann::json PlanPrinter::toJson(const PhysicalOperator* physicalOperator, Pro
         for (auto& [key, val] : physicalOperator->getProfilerKeyValAttributes(profiler_)) {
             json[key] = val;
         }
+        json["NumOutputTuplesPerThread"] = physicalOperator->getNumOutputTuplesPerThread(profiler_);
+        json["NumBatchesPerThread"] = physicalOperator->getNumBatchesPerThread(profiler_);
     }
     for (auto i = 0u; i < physicalOperator->getNumChildren(); ++i) {
         json["Child" + std::to_string(i)] = toJson(physicalOperator->getChild(i), profiler_);
@@ -25,5 +25,10 @@ CachedPreparedStatement* CachedPreparedStatementManager::getCachedStatement(
     return statementMap.at(name).get();
 }
 
+void CachedPreparedStatementManager::clear() {
+    std::unique_lock lck{mtx};
+    statementMap.clear();
+}
+
 } // namespace main
 } // namespace kuzu
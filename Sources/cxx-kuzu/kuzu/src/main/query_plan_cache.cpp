@@ -0,0 +1,95 @@
+#include "main/query_plan_cache.h"
+
+#include "main/prepared_statement.h"
+#include "parser/statement.h"
+#include "planner/operator/logical_plan.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace main {
+
+CachedQueryPlan::CachedQueryPlan(std::unique_ptr<PreparedStatement> preparedStatement,
+    std::unique_ptr<CachedPreparedStatement> cachedStatement, const catalog::Catalog* catalog,
+    uint64_t catalogChangeEpoch)
+    : preparedStatement{std::move(preparedStatement)},
+      cachedStatement{std::move(cachedStatement)}, catalog{catalog},
+      catalogChangeEpoch{catalogChangeEpoch} {}
+
+CachedQueryPlan::~CachedQueryPlan() = default;
+
+QueryPlanCache::QueryPlanCache() : numHits{0}, numMisses{0} {}
+
+QueryPlanCache::~QueryPlanCache() = default;
+
+std::shared_ptr<CachedQueryPlan> QueryPlanCache::getPlan(const std::string& query,
+    const catalog::Catalog* catalog, uint64_t catalogChangeEpoch) {
+    auto it = plans.find(query);
+    if (it == plans.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    auto& plan = it->second->second;
+    if (plan->catalog != catalog || plan->catalogChangeEpoch != catalogChangeEpoch) {
+        lruList.erase(it->second);
+        plans.erase(it);
+        numMisses++;
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, it->second);
+    numHits++;
+    return lruList.front().second;
+}
+
+void QueryPlanCache::addPlan(const std::string& query, std::shared_ptr<CachedQueryPlan> plan,
+    uint64_t capacity) {
+    auto it = plans.find(query);
+    if (it != plans.end()) {
+        lruList.erase(it->second);
+        plans.erase(it);
+    }
+    lruList.emplace_front(query, std::move(plan));
+    plans.emplace(query, lruList.begin());
+    while (plans.size() > capacity) {
+        plans.erase(lruList.back().first);
+        lruList.pop_back();
+    }
+}
+
+void QueryPlanCache::clear() {
+    plans.clear();
+    lruList.clear();
+}
+
+static bool canMapRepeatedly(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    // Mapping a recursive extend adds its semi mask targets to the logical plan.
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    // Table functions may compute their output when they are bound, e.g. SHOW_TABLES.
+    case LogicalOperatorType::TABLE_FUNCTION_CALL:
+        return false;
+    default:
+        break;
+    }
+    for (auto& child : op.getChildren()) {
+        if (!canMapRepeatedly(*child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QueryPlanCache::canCache(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) {
+    if (!preparedStatement.isSuccess() || !preparedStatement.isReadOnly() ||
+        preparedStatement.getStatementType() != StatementType::QUERY ||
+        !preparedStatement.getUnknownParameters().empty() || !cachedStatement.isDeterministic ||
+        cachedStatement.useInternalCatalogEntry || cachedStatement.parsedStatement->isInternal()) {
+        return false;
+    }
+    return canMapRepeatedly(cachedStatement.logicalPlan->getLastOperatorRef());
+}
+
+} // namespace main
+} // namespace kuzu
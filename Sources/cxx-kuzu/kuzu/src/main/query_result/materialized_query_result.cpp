@@ -1,8 +1,12 @@
 #include "main/query_result/materialized_query_result.h"
 
+#include <numeric>
+
 #include "common/arrow/arrow_row_batch.h"
 #include "common/exception/runtime.h"
+#include "common/system_config.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/factorized_tuple.h"
 #include "processor/result/flat_tuple.h"
 
 using namespace kuzu::common;
@@ -61,6 +65,25 @@ void MaterializedQueryResult::resetIterator() {
     checkDatabaseClosedOrThrow();
     validateQuerySucceed();
     iterator->resetState();
+    nextFactorizedTupleIdx = 0;
+}
+
+bool MaterializedQueryResult::hasNextFactorizedTuple() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    return nextFactorizedTupleIdx < table->getNumTuples();
+}
+
+std::shared_ptr<FactorizedTuple> MaterializedQueryResult::getNextFactorizedTuple() {
+    if (!hasNextFactorizedTuple()) {
+        throw RuntimeException("No more factorized tuples in QueryResult, Please check "
+                               "hasNextFactorizedTuple() before calling getNextFactorizedTuple().");
+    }
+    if (factorizedTuple == nullptr) {
+        factorizedTuple = std::make_shared<FactorizedTuple>(columnTypes);
+    }
+    factorizedTuple->read(*table, nextFactorizedTupleIdx++);
+    return factorizedTuple;
 }
 
 std::string MaterializedQueryResult::toString() const {
@@ -94,6 +117,11 @@ std::unique_ptr<ArrowArray> MaterializedQueryResult::getNextArrowChunk(int64_t c
     checkDatabaseClosedOrThrow();
     auto rowBatch =
         std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    if (!table->hasUnflatCol()) {
+        // Tuples of a flat table are scanned into vectors and appended a column at a time.
+        fillArrowRowBatchFromFlatTable(*rowBatch, chunkSize);
+        return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+    }
     auto rowBatchSize = 0u;
     while (rowBatchSize < chunkSize) {
         if (!iterator->hasNext()) {
@@ -106,5 +134,36 @@ std::unique_ptr<ArrowArray> MaterializedQueryResult::getNextArrowChunk(int64_t c
     return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
 }
 
+void MaterializedQueryResult::fillArrowRowBatchFromFlatTable(ArrowRowBatch& rowBatch,
+    int64_t chunkSize) {
+    if (!iterator->hasNext()) {
+        return;
+    }
+    auto state = std::make_shared<DataChunkState>();
+    state->setToUnflat();
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    std::vector<ValueVector*> vectorPtrs;
+    for (auto& type : columnTypes) {
+        vectors.push_back(
+            std::make_unique<ValueVector>(type.copy(), table->getMemoryManager(), state));
+        vectorPtrs.push_back(vectors.back().get());
+    }
+    std::vector<std::vector<sel_t>> positions(vectors.size(),
+        std::vector<sel_t>(DEFAULT_VECTOR_CAPACITY));
+    for (auto& vectorPositions : positions) {
+        std::iota(vectorPositions.begin(), vectorPositions.end(), 0);
+    }
+    auto tupleIdx = iterator->getNextTupleIdx();
+    auto numTuplesLeft = std::min(table->getNumTuples() - tupleIdx, (uint64_t)chunkSize);
+    while (numTuplesLeft > 0) {
+        auto numTuplesToScan = std::min(numTuplesLeft, DEFAULT_VECTOR_CAPACITY);
+        table->scan(vectorPtrs, tupleIdx, numTuplesToScan);
+        rowBatch.append(vectorPtrs, positions, numTuplesToScan);
+        tupleIdx += numTuplesToScan;
+        numTuplesLeft -= numTuplesToScan;
+    }
+    iterator->setNextTupleIdx(tupleIdx);
+}
+
 } // namespace main
 } // namespace kuzu
@@ -0,0 +1,141 @@
+#include "main/query_result/streaming_query_result.h"
+
+#include "common/arrow/arrow_row_batch.h"
+#include "common/exception/runtime.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/flat_tuple.h"
+#include "processor/result/result_stream.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+StreamingQueryResult::StreamingQueryResult(std::shared_ptr<ResultStream> stream)
+    : QueryResult{type_}, stream{std::move(stream)} {}
+
+StreamingQueryResult::~StreamingQueryResult() {
+    // Stop the query if not all of its tuples have been read.
+    stream->cancel();
+    auto preventDestruction = dbLifeCycleManager && dbLifeCycleManager->isDatabaseClosed;
+    iterator.reset();
+    if (table) {
+        table->setPreventDestruction(preventDestruction);
+    }
+    for (auto& readAheadTable : readAheadTables) {
+        readAheadTable->setPreventDestruction(preventDestruction);
+    }
+    stream->clear(preventDestruction);
+}
+
+uint64_t StreamingQueryResult::getNumTuples() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    while (auto readAheadTable = popChunk()) {
+        readAheadTables.push_back(std::move(readAheadTable));
+    }
+    return numPoppedTuples;
+}
+
+std::unique_ptr<FactorizedTable> StreamingQueryResult::popChunk() const {
+    if (endOfStream) {
+        return nullptr;
+    }
+    std::unique_ptr<FactorizedTable> chunk;
+    try {
+        chunk = stream->pop();
+    } catch (RuntimeException& e) {
+        success = false;
+        errMsg = e.what();
+    }
+    if (chunk == nullptr) {
+        endOfStream = true;
+        return nullptr;
+    }
+    numPoppedTuples += chunk->getTotalNumFlatTuples();
+    return chunk;
+}
+
+bool StreamingQueryResult::fetchChunk() const {
+    while (iterator == nullptr || !iterator->hasNext()) {
+        iterator.reset();
+        if (!readAheadTables.empty()) {
+            table = std::move(readAheadTables.front());
+            readAheadTables.pop_front();
+        } else {
+            table = popChunk();
+        }
+        if (table == nullptr) {
+            return false;
+        }
+        iterator = std::make_unique<FactorizedTableIterator>(*table);
+    }
+    return true;
+}
+
+bool StreamingQueryResult::hasNext() const {
+    checkDatabaseClosedOrThrow();
+    return fetchChunk();
+}
+
+std::shared_ptr<FlatTuple> StreamingQueryResult::getNext() {
+    if (!hasNext()) {
+        if (!isSuccess()) {
+            throw RuntimeException(errMsg);
+        }
+        throw RuntimeException(
+            "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
+    }
+    iterator->getNext(*tuple);
+    return tuple;
+}
+
+void StreamingQueryResult::resetIterator() {
+    throw RuntimeException("The iterator of a streaming query result cannot be reset.");
+}
+
+std::string StreamingQueryResult::toString() const {
+    checkDatabaseClosedOrThrow();
+    if (!isSuccess()) {
+        return errMsg;
+    }
+    std::string result;
+    // The header is followed by the tuples that haven't been read yet.
+    for (auto i = 0u; i < columnNames.size(); ++i) {
+        if (i != 0) {
+            result += "|";
+        }
+        result += columnNames[i];
+    }
+    result += "\n";
+    auto tuple_ = FlatTuple(this->columnTypes);
+    while (fetchChunk()) {
+        iterator->getNext(tuple_);
+        result += tuple_.toString();
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNextArrowChunk() {
+    return hasNext();
+}
+
+std::unique_ptr<ArrowArray> StreamingQueryResult::getNextArrowChunk(int64_t chunkSize) {
+    checkDatabaseClosedOrThrow();
+    auto rowBatch =
+        std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    auto rowBatchSize = 0u;
+    while (rowBatchSize < chunkSize) {
+        if (!hasNext()) {
+            break;
+        }
+        (void)iterator->getNext(*tuple);
+        rowBatch->append(*tuple);
+        rowBatchSize++;
+    }
+    return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+}
+
+} // namespace main
+} // namespace kuzu
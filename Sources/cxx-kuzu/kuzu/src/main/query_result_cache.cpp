@@ -0,0 +1,162 @@
+#include "main/query_result_cache.h"
+
+#include <algorithm>
+
+#include "common/types/value/value.h"
+#include "main/client_config.h"
+#include "main/prepared_statement.h"
+#include "parser/statement.h"
+#include "planner/operator/logical_plan.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace main {
+
+CachedQueryResult::CachedQueryResult(std::shared_ptr<processor::FactorizedTable> table,
+    std::vector<std::string> columnNames, std::vector<LogicalType> columnTypes,
+    const catalog::Catalog* catalog, uint64_t catalogChangeEpoch, transaction_t dataVersion)
+    : table{std::move(table)}, columnNames{std::move(columnNames)},
+      columnTypes{std::move(columnTypes)}, catalog{catalog},
+      catalogChangeEpoch{catalogChangeEpoch}, dataVersion{dataVersion},
+      memoryUsage{this->table->getMemoryUsage()} {}
+
+CachedQueryResult::~CachedQueryResult() = default;
+
+QueryResultCache::QueryResultCache() : memoryUsage{0}, numHits{0}, numMisses{0} {}
+
+QueryResultCache::~QueryResultCache() = default;
+
+std::shared_ptr<CachedQueryResult> QueryResultCache::getResult(const std::string& key,
+    const catalog::Catalog* catalog, uint64_t catalogChangeEpoch, transaction_t dataVersion) {
+    std::unique_lock lck{mtx};
+    auto it = results.find(key);
+    if (it == results.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    auto& result = it->second->second;
+    if (result->catalog != catalog || result->catalogChangeEpoch != catalogChangeEpoch ||
+        result->dataVersion != dataVersion) {
+        removeNoLock(it->second);
+        numMisses++;
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, it->second);
+    numHits++;
+    return lruList.front().second;
+}
+
+void QueryResultCache::addResult(const std::string& key, std::shared_ptr<CachedQueryResult> result,
+    uint64_t capacity) {
+    std::unique_lock lck{mtx};
+    auto it = results.find(key);
+    if (it != results.end()) {
+        removeNoLock(it->second);
+    }
+    if (result->memoryUsage > capacity) {
+        return;
+    }
+    memoryUsage += result->memoryUsage;
+    lruList.emplace_front(key, std::move(result));
+    results.emplace(key, lruList.begin());
+    evictNoLock(capacity);
+}
+
+void QueryResultCache::evict(uint64_t capacity) {
+    std::unique_lock lck{mtx};
+    evictNoLock(capacity);
+}
+
+void QueryResultCache::clear() {
+    std::unique_lock lck{mtx};
+    results.clear();
+    lruList.clear();
+    memoryUsage = 0;
+}
+
+uint64_t QueryResultCache::getNumResults() const {
+    std::unique_lock lck{mtx};
+    return results.size();
+}
+
+uint64_t QueryResultCache::getMemoryUsage() const {
+    std::unique_lock lck{mtx};
+    return memoryUsage;
+}
+
+uint64_t QueryResultCache::getNumHits() const {
+    std::unique_lock lck{mtx};
+    return numHits;
+}
+
+uint64_t QueryResultCache::getNumMisses() const {
+    std::unique_lock lck{mtx};
+    return numMisses;
+}
+
+void QueryResultCache::removeNoLock(lru_list_t::iterator it) {
+    memoryUsage -= it->second->memoryUsage;
+    results.erase(it->first);
+    lruList.erase(it);
+}
+
+void QueryResultCache::evictNoLock(uint64_t capacity) {
+    while (memoryUsage > capacity) {
+        removeNoLock(std::prev(lruList.end()));
+    }
+}
+
+static bool hasTableFunctionCall(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::TABLE_FUNCTION_CALL) {
+        return true;
+    }
+    for (auto& child : op.getChildren()) {
+        if (hasTableFunctionCall(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool QueryResultCache::canCache(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) {
+    if (!preparedStatement.isSuccess() || !preparedStatement.isReadOnly() ||
+        preparedStatement.getStatementType() != StatementType::QUERY ||
+        !preparedStatement.getUnknownParameters().empty() || !cachedStatement.isDeterministic ||
+        cachedStatement.useInternalCatalogEntry || cachedStatement.parsedStatement->isInternal() ||
+        cachedStatement.logicalPlan->isProfile()) {
+        return false;
+    }
+    return !hasTableFunctionCall(cachedStatement.logicalPlan->getLastOperatorRef());
+}
+
+std::string QueryResultCache::getKey(const std::string& query, const ClientConfig& clientConfig,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters) {
+    // The settings and parameters are appended after a NUL, which the text of a query doesn't
+    // contain.
+    auto key = query;
+    key += '\0' + std::to_string(clientConfig.varLengthMaxDepth) + '\0' +
+           std::to_string(static_cast<uint8_t>(clientConfig.recursivePatternSemantic)) + '\0' +
+           std::to_string(clientConfig.disableMapKeyCheck);
+    std::vector<std::string> names;
+    names.reserve(parameters.size());
+    for (auto& [name, _] : parameters) {
+        names.push_back(name);
+    }
+    std::sort(names.begin(), names.end());
+    for (auto& name : names) {
+        auto& value = *parameters.at(name);
+        key += '\0' + name + '\0' + value.getDataType().toString() + '\0';
+        if (!value.isNull()) {
+            // Only non-null values are prefixed, so that a null and an empty string differ.
+            key += '=' + value.toString();
+        }
+    }
+    return key;
+}
+
+} // namespace main
+} // namespace kuzu
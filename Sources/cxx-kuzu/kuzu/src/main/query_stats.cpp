@@ -0,0 +1,33 @@
+#include "main/query_stats.h"
+
+namespace kuzu {
+namespace main {
+
+void QueryStatsLog::addQuery(QueryStats stats) {
+    std::unique_lock lck{mtx};
+    if (queries.size() == CAPACITY) {
+        queries.pop_front();
+    }
+    queries.push_back(std::move(stats));
+}
+
+std::vector<QueryStats> QueryStatsLog::getQueries() const {
+    std::unique_lock lck{mtx};
+    return {queries.begin(), queries.end()};
+}
+
+void SlowQueryLog::addQuery(SlowQuery query) {
+    std::unique_lock lck{mtx};
+    if (queries.size() == CAPACITY) {
+        queries.pop_front();
+    }
+    queries.push_back(std::move(query));
+}
+
+std::vector<SlowQuery> SlowQueryLog::getQueries() const {
+    std::unique_lock lck{mtx};
+    return {queries.begin(), queries.end()};
+}
+
+} // namespace main
+} // namespace kuzu
@@ -11,6 +11,10 @@ double QuerySummary::getCompilingTime() const {
     return preparedSummary.compilingTime;
 }
 
+double QuerySummary::getPlanningTime() const {
+    return preparedSummary.planningTime;
+}
+
 double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
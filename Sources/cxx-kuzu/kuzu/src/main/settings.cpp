@@ -1,12 +1,19 @@
 #include "main/settings.h"
 
 #include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
 #include "common/task_system/progress_bar.h"
+#include "common/tracer.h"
 #include "main/client_context.h"
+#include "main/database.h"
 #include "main/db_config.h"
+#include "main/query_result_cache.h"
+#include "main/workload_recorder.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
+#include "storage/wal/wal.h"
 
 namespace kuzu {
 namespace main {
@@ -159,6 +166,33 @@ common::Value CheckpointThresholdSetting::getSetting(const ClientContext* contex
     return common::Value(context->getDBConfig()->checkpointThreshold);
 }
 
+void WALGroupCommitDelaySetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto delay = parameter.getValue<int64_t>();
+    if (delay < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, delay));
+    }
+    context->getDBConfigUnsafe()->walGroupCommitDelayInMicros = delay;
+}
+
+common::Value WALGroupCommitDelaySetting::getSetting(const ClientContext* context) {
+    return common::Value(
+        static_cast<int64_t>(context->getDBConfig()->walGroupCommitDelayInMicros));
+}
+
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+void DebugFailWALSyncSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    storage::WAL::Get(*context)->setFailSyncs(parameter.getValue<bool>());
+}
+
+common::Value DebugFailWALSyncSetting::getSetting(const ClientContext* context) {
+    return common::Value(storage::WAL::Get(*context)->getFailSyncs());
+}
+#endif
+
 void AutoCheckpointSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getDBConfigUnsafe()->autoCheckpoint = parameter.getValue<bool>();
@@ -223,5 +257,295 @@ common::Value SpillToDiskSetting::getSetting(const ClientContext* context) {
     return common::Value::createValue(context->getDBConfig()->enableSpillingToDisk);
 }
 
+void EvictionPolicySetting::setContext(ClientContext*, const common::Value&) {
+    // The eviction policy belongs to the database's buffer manager, which is shared by every
+    // connection, so it can only be chosen when the database is opened.
+    throw common::RuntimeException(common::stringFormat(
+        "{} cannot be changed at runtime. Set enableTwoQueueEviction in the SystemConfig when "
+        "opening the database.",
+        name));
+}
+
+common::Value EvictionPolicySetting::getSetting(const ClientContext* context) {
+    const auto policy =
+        storage::MemoryManager::Get(*context)->getBufferManager()->getEvictionPolicy();
+    return common::Value::createValue(
+        policy == storage::EvictionPolicy::TWO_QUEUE ? "TWO_QUEUE" : "SECOND_CHANCE");
+}
+
+void SchedulingClassSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto input = parameter.getValue<std::string>();
+    context->getClientConfigUnsafe()->schedulingClass =
+        common::SchedulingClassUtils::fromString(input);
+}
+
+common::Value SchedulingClassSetting::getSetting(const ClientContext* context) {
+    const auto result =
+        common::SchedulingClassUtils::toString(context->getClientConfig()->schedulingClass);
+    return common::Value::createValue(result);
+}
+
+void CSRCacheRelTablesSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->csrCacheRelTables = parameter.getValue<std::string>();
+}
+
+common::Value CSRCacheRelTablesSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->csrCacheRelTables);
+}
+
+void ProjectedGraphMemoryLimitSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto memoryLimit = parameter.getValue<int64_t>();
+    if (memoryLimit < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, memoryLimit));
+    }
+    context->getClientConfigUnsafe()->projectedGraphMemoryLimit = memoryLimit;
+}
+
+common::Value ProjectedGraphMemoryLimitSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->projectedGraphMemoryLimit);
+}
+
+void CopyMemoryBudgetSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto memoryBudget = parameter.getValue<int64_t>();
+    if (memoryBudget < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, memoryBudget));
+    }
+    context->getClientConfigUnsafe()->copyMemoryBudget = memoryBudget;
+}
+
+common::Value CopyMemoryBudgetSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->copyMemoryBudget);
+}
+
+void QueryMemoryLimitSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto memoryLimit = parameter.getValue<int64_t>();
+    if (memoryLimit < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, memoryLimit));
+    }
+    context->getClientConfigUnsafe()->queryMemoryLimit = memoryLimit;
+}
+
+common::Value QueryMemoryLimitSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->queryMemoryLimit);
+}
+
+void QueryPlanCacheSizeSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto cacheSize = parameter.getValue<int64_t>();
+    if (cacheSize < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, cacheSize));
+    }
+    context->getClientConfigUnsafe()->queryPlanCacheSize = cacheSize;
+}
+
+common::Value QueryPlanCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->queryPlanCacheSize);
+}
+
+void StreamingResultBufferSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto bufferSize = parameter.getValue<int64_t>();
+    if (bufferSize < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, bufferSize));
+    }
+    context->getClientConfigUnsafe()->streamingResultBuffer = bufferSize;
+}
+
+common::Value StreamingResultBufferSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->streamingResultBuffer);
+}
+
+void AdaptiveReoptimizationThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto threshold = parameter.getValue<int64_t>();
+    if (threshold < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, threshold));
+    }
+    context->getClientConfigUnsafe()->adaptiveReoptimizationThreshold = threshold;
+}
+
+common::Value AdaptiveReoptimizationThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->adaptiveReoptimizationThreshold);
+}
+
+void JoinOrderPlanningBudgetSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto budget = parameter.getValue<int64_t>();
+    if (budget < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, budget));
+    }
+    context->getClientConfigUnsafe()->joinOrderPlanningBudget = budget;
+}
+
+common::Value JoinOrderPlanningBudgetSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->joinOrderPlanningBudget);
+}
+
+void JoinOrderGreedyThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto threshold = parameter.getValue<int64_t>();
+    if (threshold < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, threshold));
+    }
+    context->getClientConfigUnsafe()->joinOrderGreedyThreshold = threshold;
+}
+
+common::Value JoinOrderGreedyThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->joinOrderGreedyThreshold);
+}
+
+void ProfileFormatSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto input = common::StringUtils::getUpper(parameter.getValue<std::string>());
+    if (input != "TEXT" && input != "JSON") {
+        throw common::RuntimeException(
+            common::stringFormat("Cannot parse {} as a profile format. Supported inputs are "
+                                 "[TEXT, JSON]",
+                input));
+    }
+    context->getClientConfigUnsafe()->profileInJson = input == "JSON";
+}
+
+common::Value ProfileFormatSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->profileInJson ? "JSON" : "TEXT");
+}
+
+void TraceFileSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto path = parameter.getValue<std::string>();
+    if (path.empty()) {
+        common::Tracer::Get().stop();
+    } else {
+        common::Tracer::Get().start(path, context);
+    }
+}
+
+common::Value TraceFileSetting::getSetting(const ClientContext* /*context*/) {
+    return common::Value::createValue(common::Tracer::Get().getFilePath());
+}
+
+void SlowQueryThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto threshold = parameter.getValue<int64_t>();
+    if (threshold < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, threshold));
+    }
+    context->getClientConfigUnsafe()->slowQueryThresholdInMS = threshold;
+}
+
+common::Value SlowQueryThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->slowQueryThresholdInMS);
+}
+
+void QueryStatsMaxQueryLengthSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto maxQueryLength = parameter.getValue<int64_t>();
+    if (maxQueryLength < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, maxQueryLength));
+    }
+    context->getClientConfigUnsafe()->queryStatsMaxQueryLength = maxQueryLength;
+}
+
+common::Value QueryStatsMaxQueryLengthSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->queryStatsMaxQueryLength);
+}
+
+void WorkloadRecordFileSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto path = parameter.getValue<std::string>();
+    auto recorder = context->getDatabase()->getWorkloadRecorder();
+    if (path.empty()) {
+        recorder->stop();
+    } else {
+        recorder->start(path, context);
+    }
+}
+
+common::Value WorkloadRecordFileSetting::getSetting(const ClientContext* context) {
+    auto recorder = context->getDatabase()->getWorkloadRecorder();
+    return common::Value::createValue(recorder->getFilePath());
+}
+
+void ConnectionPoolSizeSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto poolSize = parameter.getValue<int64_t>();
+    if (poolSize < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, poolSize));
+    }
+    context->getDBConfigUnsafe()->connectionPoolSize = poolSize;
+}
+
+common::Value ConnectionPoolSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(static_cast<int64_t>(context->getDBConfig()->connectionPoolSize));
+}
+
+void PKBloomFilterSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->enablePKBloomFilter = parameter.getValue<bool>();
+}
+
+common::Value PKBloomFilterSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->enablePKBloomFilter);
+}
+
+void PipelineTuplesPerThreadSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto numTuples = parameter.getValue<int64_t>();
+    if (numTuples < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, numTuples));
+    }
+    context->getClientConfigUnsafe()->pipelineTuplesPerThread = numTuples;
+}
+
+common::Value PipelineTuplesPerThreadSetting::getSetting(const ClientContext* context) {
+    return common::Value(
+        static_cast<int64_t>(context->getClientConfig()->pipelineTuplesPerThread));
+}
+
+void QueryResultCacheSizeSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto cacheSize = parameter.getValue<int64_t>();
+    if (cacheSize < 0) {
+        throw common::RuntimeException(
+            common::stringFormat("{} must be non-negative. Got {}.", name, cacheSize));
+    }
+    context->getDBConfigUnsafe()->queryResultCacheSize = cacheSize;
+    context->getDatabase()->getQueryResultCache()->evict(cacheSize);
+}
+
+common::Value QueryResultCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(static_cast<int64_t>(context->getDBConfig()->queryResultCacheSize));
+}
+
 } // namespace main
 } // namespace kuzu
@@ -0,0 +1,84 @@
+#include "main/workload_recorder.h"
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/types/value/value.h"
+#include "json.hpp"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace main {
+
+void WorkloadRecorder::start(const std::string& path, ClientContext* context) {
+    std::unique_lock lck{mtx};
+    stopNoLock();
+    fileInfo = VirtualFileSystem::GetUnsafe(*context)->openFile(path,
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS), context);
+    filePath = path;
+    fileOffset = 0;
+    startTime = std::chrono::steady_clock::now();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void WorkloadRecorder::stop() {
+    std::unique_lock lck{mtx};
+    stopNoLock();
+}
+
+void WorkloadRecorder::stopNoLock() {
+    if (fileInfo == nullptr) {
+        return;
+    }
+    enabled.store(false, std::memory_order_relaxed);
+    fileInfo->syncFile();
+    fileInfo.reset();
+    filePath.clear();
+}
+
+std::string WorkloadRecorder::getFilePath() {
+    std::unique_lock lck{mtx};
+    return filePath;
+}
+
+uint64_t WorkloadRecorder::getTimeInMicros() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime)
+        .count();
+}
+
+void WorkloadRecorder::recordQuery(const ClientContext& context, const std::string& query,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>* parameters,
+    uint64_t startInMicros, bool success) {
+    const auto endInMicros = getTimeInMicros();
+    auto record = nlohmann::json();
+    record["connection"] = context.getClientID();
+    record["start_us"] = startInMicros;
+    record["duration_us"] = endInMicros - startInMicros;
+    record["query"] = query;
+    auto recordedParameters = nlohmann::json::object();
+    if (parameters != nullptr) {
+        for (auto& [name, value] : *parameters) {
+            auto parameter = nlohmann::json();
+            parameter["type"] = value->getDataType().toString();
+            parameter["value"] =
+                value->isNull() ? nlohmann::json() : nlohmann::json(value->toString());
+            recordedParameters[name] = std::move(parameter);
+        }
+    }
+    record["parameters"] = std::move(recordedParameters);
+    record["success"] = success;
+    // Invalid UTF-8 in the query or in string parameters is replaced rather than failing the query.
+    const auto line =
+        record.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace) + "\n";
+    std::unique_lock lck{mtx};
+    // Recording may have stopped since the query started.
+    if (fileInfo == nullptr) {
+        return;
+    }
+    fileInfo->writeFile(reinterpret_cast<const uint8_t*>(line.data()), line.size(), fileOffset);
+    fileOffset += line.size();
+}
+
+} // namespace main
+} // namespace kuzu
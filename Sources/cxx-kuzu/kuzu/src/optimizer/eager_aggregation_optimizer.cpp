@@ -0,0 +1,205 @@
+#include "optimizer/eager_aggregation_optimizer.h"
+
+#include <algorithm>
+
+#include "binder/expression/aggregate_function_expression.h"
+#include "function/aggregate/count_star.h"
+#include "function/aggregate/sum.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void EagerAggregationOptimizer::rewrite(LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void EagerAggregationOptimizer::visitOperator(LogicalOperator* op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+    visitOperatorSwitch(op);
+}
+
+static bool isCountStar(const Expression& expression) {
+    return expression.constCast<AggregateFunctionExpression>().getFunction().name ==
+           CountStarFunction::name;
+}
+
+// Whether the result of the aggregate does not change if its input tuples are duplicated.
+static bool isDuplicateInsensitive(const Expression& expression) {
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    auto& name = aggregate.getFunction().name;
+    return aggregate.isDistinct() || name == AggregateMinFunction::name ||
+           name == AggregateMaxFunction::name;
+}
+
+static bool isInScope(const expression_vector& expressions, const Schema& schema) {
+    for (auto& expression : expressions) {
+        if (!schema.isExpressionInScope(*expression)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool containsExpression(const expression_vector& expressions, const Expression& expression) {
+    return std::any_of(expressions.begin(), expressions.end(),
+        [&](const auto& other) { return *other == expression; });
+}
+
+// Whether no two output tuples of op share the same values of keys, in which case grouping them by
+// keys would not reduce them. This holds for a node scan whose node ID is among the keys, or an
+// aggregation by a subset of the keys, followed by operators that don't duplicate tuples.
+static bool hasUniqueKeys(const LogicalOperator& op, const expression_vector& keys) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE:
+        return containsExpression(keys, *op.constCast<LogicalScanNodeTable>().getNodeID());
+    case LogicalOperatorType::AGGREGATE: {
+        auto& aggregate = op.constCast<LogicalAggregate>();
+        auto aggregateKeys = aggregate.getAllKeys();
+        return std::all_of(aggregateKeys.begin(), aggregateKeys.end(),
+            [&](const auto& key) { return containsExpression(keys, *key); });
+    }
+    case LogicalOperatorType::ACCUMULATE:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::LIMIT:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::SEMI_MASKER:
+        return hasUniqueKeys(*op.getChild(0), keys);
+    default:
+        return false;
+    }
+}
+
+void EagerAggregationOptimizer::visitAggregate(LogicalOperator* op) {
+    auto& aggregate = op->cast<LogicalAggregate>();
+    // Without keys, COUNT(*) over no tuple is 0 while the sum of no partial count is NULL.
+    if (!aggregate.hasKeys() || !aggregate.getDependentKeys().empty()) {
+        return;
+    }
+    // Expressions which must be available on the side that is not pre-aggregated.
+    auto keptExpressions = aggregate.getKeys();
+    auto hasCountStar = false;
+    for (auto& expression : aggregate.getAggregates()) {
+        if (expression->expressionType != ExpressionType::AGGREGATE_FUNCTION) {
+            return;
+        }
+        if (isCountStar(*expression)) {
+            hasCountStar = true;
+        } else if (isDuplicateInsensitive(*expression)) {
+            for (auto& child : expression->getChildren()) {
+                keptExpressions.push_back(child);
+            }
+        } else {
+            return;
+        }
+    }
+    if (!hasCountStar) {
+        return;
+    }
+    std::vector<LogicalProjection*> projections;
+    auto child = aggregate.getChild(0).get();
+    while (child->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        auto& projection = child->cast<LogicalProjection>();
+        auto expressions = projection.getExpressionsToProject();
+        keptExpressions.insert(keptExpressions.end(), expressions.begin(), expressions.end());
+        projections.push_back(&projection);
+        child = child->getChild(0).get();
+    }
+    if (child->getOperatorType() != LogicalOperatorType::HASH_JOIN) {
+        return;
+    }
+    auto& hashJoin = child->cast<LogicalHashJoin>();
+    auto sipInfo = hashJoin.getSIPInfo();
+    // A semi mask would make the pipelines of both sides depend on each other, which the
+    // pre-aggregation pipeline does not account for.
+    if (hashJoin.getJoinType() != JoinType::INNER ||
+        sipInfo.position == SemiMaskPosition::ON_BUILD ||
+        sipInfo.position == SemiMaskPosition::ON_PROBE ||
+        sipInfo.dependency != SIPDependency::NONE || sipInfo.direction != SIPDirection::NONE) {
+        return;
+    }
+    // Pre-aggregate the larger side among those from which none of the kept expressions come.
+    std::optional<uint32_t> sideToAggregate;
+    for (auto side = 0u; side < 2; ++side) {
+        auto cardinality = hashJoin.getChild(side)->getCardinality();
+        auto otherSide = hashJoin.getChild(1 - side);
+        if (!isInScope(keptExpressions, *otherSide->getSchema()) ||
+            cardinality <= otherSide->getCardinality()) {
+            continue;
+        }
+        if (!sideToAggregate.has_value() ||
+            cardinality > hashJoin.getChild(*sideToAggregate)->getCardinality()) {
+            sideToAggregate = side;
+        }
+    }
+    if (!sideToAggregate.has_value()) {
+        return;
+    }
+    auto side = *sideToAggregate;
+    expression_vector partialKeys;
+    for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+        auto key = side == 0 ? probeKey : buildKey;
+        if (!containsExpression(partialKeys, *key)) {
+            partialKeys.push_back(key);
+        }
+    }
+    // Counting tuples whose join keys are unique only adds an aggregation.
+    if (hasUniqueKeys(*hashJoin.getChild(side), partialKeys)) {
+        return;
+    }
+    expression_vector aggregates = aggregate.getAggregates();
+    auto countStarIt = std::find_if(aggregates.begin(), aggregates.end(),
+        [](const auto& expression) { return isCountStar(*expression); });
+    auto& countStar = (*countStarIt)->constCast<AggregateFunctionExpression>();
+    std::shared_ptr<Expression> partialCount = std::make_shared<AggregateFunctionExpression>(
+        countStar.getFunction().copy(), std::make_unique<FunctionBindData>(LogicalType::INT64()),
+        expression_vector{}, (*countStarIt)->getUniqueName() + "_partial");
+    auto aggregatedSide = hashJoin.getChild(side);
+    auto partialAggregate = std::make_shared<LogicalAggregate>(partialKeys, expression_vector{},
+        expression_vector{partialCount}, aggregatedSide,
+        std::min(aggregatedSide->getCardinality(), hashJoin.getChild(1 - side)->getCardinality()));
+    partialAggregate->computeFlatSchema();
+    hashJoin.setChild(side, std::move(partialAggregate));
+    hashJoin.computeFlatSchema();
+    // COUNT(*) becomes the sum of the partial counts. The sum keeps the name and the type of the
+    // count so that operators above still find it.
+    for (auto& expression : aggregates) {
+        if (!isCountStar(*expression)) {
+            continue;
+        }
+        auto sumFunction = AggregateFunctionUtils::getAggFunc<SumFunction<int64_t, int64_t>>(
+            AggregateSumFunction::name, LogicalTypeID::INT64, LogicalTypeID::INT64,
+            false /* isDistinct */);
+        std::shared_ptr<Expression> sum = std::make_shared<AggregateFunctionExpression>(
+            sumFunction->copy(), std::make_unique<FunctionBindData>(LogicalType::INT64()),
+            expression_vector{partialCount}, expression->getUniqueName());
+        if (expression->hasAlias()) {
+            sum->setAlias(expression->getAlias());
+        }
+        expression = std::move(sum);
+    }
+    for (auto it = projections.rbegin(); it != projections.rend(); ++it) {
+        auto expressions = (*it)->getExpressionsToProject();
+        expressions.push_back(partialCount);
+        (*it)->setExpressionsToProject(expressions);
+        (*it)->computeFlatSchema();
+    }
+    aggregate.setAggregates(std::move(aggregates));
+    aggregate.computeFlatSchema();
+}
+
+} // namespace optimizer
+} // namespace kuzu
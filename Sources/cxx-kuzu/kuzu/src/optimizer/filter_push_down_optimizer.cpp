@@ -3,13 +3,22 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "main/client_context.h"
+#include "planner/join_order/cardinality_estimator.h"
 #include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_cross_product.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_table_function_call.h"
+#include "planner/operator/scan/logical_lookup_node_table.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/index/sorted_index.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -75,6 +84,49 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitFilterReplace(
     return visitOperator(filter.getChild(0));
 }
 
+static bool isNumericKey(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Picks an inequality between a probe and a build expression of the same numeric type, which the
+// cross product can use to skip build tuples.
+static std::optional<CrossProductInequality> getCrossProductInequality(
+    const expression_vector& predicates, const Schema& probeSchema, const Schema& buildSchema) {
+    for (auto& predicate : predicates) {
+        const auto type = predicate->expressionType;
+        if (!ExpressionTypeUtil::isComparison(type) || type == ExpressionType::NOT_EQUALS) {
+            continue;
+        }
+        auto left = predicate->getChild(0);
+        auto right = predicate->getChild(1);
+        if (left->getDataType() != right->getDataType() || !isNumericKey(left->getDataType())) {
+            continue;
+        }
+        if (probeSchema.isExpressionInScope(*left) && buildSchema.isExpressionInScope(*right)) {
+            return CrossProductInequality{left, right, type};
+        }
+        if (probeSchema.isExpressionInScope(*right) && buildSchema.isExpressionInScope(*left)) {
+            return CrossProductInequality{right, left,
+                ExpressionTypeUtil::reverseComparisonDirection(type)};
+        }
+    }
+    return std::nullopt;
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto remainingPSet = PredicateSet();
@@ -119,6 +171,15 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
         }
     }
     if (joinConditions.empty()) { // Nothing to push down. Terminate.
+        auto& crossProduct = op->cast<LogicalCrossProduct>();
+        if (crossProduct.getAccumulateType() == AccumulateType::REGULAR &&
+            !crossProduct.hasMark()) {
+            auto inequality = getCrossProductInequality(remainingPSet.nonEqualityPredicates,
+                *probeSchema, *buildSchema);
+            if (inequality.has_value()) {
+                crossProduct.setInequality(std::move(*inequality));
+            }
+        }
         return finishPushDown(op);
     }
     auto hashJoin = std::make_shared<LogicalHashJoin>(joinConditions, JoinType::INNER,
@@ -204,7 +265,162 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
-    return finishPushDown(op);
+    if (scan.getScanType() == LogicalScanNodeTableType::SCAN && tableIDs.size() == 1) {
+        tryRewriteSortedIndexScan(scan);
+    }
+    if (scan.getScanType() != LogicalScanNodeTableType::SCAN) {
+        return finishPushDown(op);
+    }
+    auto lateProperties = popLateMaterializedProperties(scan);
+    if (lateProperties.empty()) {
+        return finishPushDown(op);
+    }
+    if (context->getClientConfig()->enableZoneMap) {
+        scan.setPropertyPredicates(
+            getColumnPredicateSets(scan.getProperties(), predicateSet.getAllPredicates()));
+    }
+    scan.computeFlatSchema();
+    auto lookup = std::make_shared<LogicalLookupNodeTable>(nodeID, tableIDs,
+        std::move(lateProperties), finishPushDown(op));
+    lookup->computeFlatSchema();
+    return lookup;
+}
+
+// A comparison of a property of the scanned node with a constant, with the property on the left.
+struct PropertyComparison {
+    ExpressionType comparisonType;
+    std::string propertyName;
+    std::shared_ptr<Expression> constant;
+};
+
+static std::optional<PropertyComparison> getPropertyComparison(const Expression& predicate,
+    const Expression& nodeID) {
+    auto comparisonType = predicate.expressionType;
+    switch (comparisonType) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        break;
+    default:
+        return std::nullopt;
+    }
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    if (left->expressionType != ExpressionType::PROPERTY) {
+        std::swap(left, right);
+        comparisonType = ExpressionTypeUtil::reverseComparisonDirection(comparisonType);
+    }
+    if (left->expressionType != ExpressionType::PROPERTY || !isConstantExpression(right)) {
+        return std::nullopt;
+    }
+    auto& property = left->constCast<PropertyExpression>();
+    if (property.getVariableName() != nodeID.constCast<PropertyExpression>().getVariableName() ||
+        property.getDataType() != right->getDataType()) {
+        return std::nullopt;
+    }
+    return PropertyComparison{comparisonType, property.getPropertyName(), right};
+}
+
+void FilterPushDownOptimizer::tryRewriteSortedIndexScan(LogicalScanNodeTable& scan) {
+    const auto tableID = scan.getTableIDs()[0];
+    auto catalog = catalog::Catalog::Get(*context);
+    auto transaction = transaction::Transaction::Get(*context);
+    std::unordered_map<property_id_t, std::string> indexNames;
+    for (auto& indexEntry : catalog->getIndexEntries(transaction, tableID)) {
+        if (indexEntry->getIndexType() == SortedIndex::TYPE_NAME && indexEntry->isLoaded()) {
+            indexNames.emplace(indexEntry->getPropertyIDs()[0], indexEntry->getIndexName());
+        }
+    }
+    if (indexNames.empty() || predicateSet.isEmpty()) {
+        return;
+    }
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+    auto estimator = CardinalityEstimator(context);
+    estimator.init(*scan.getNodeID(), scan.getTableIDs());
+    const auto numNodes = std::max<cardinality_t>(scan.getCardinality(), 1);
+    struct Bounds {
+        std::shared_ptr<Expression> lower;
+        std::shared_ptr<Expression> upper;
+        double selectivity = 1.0;
+    };
+    std::unordered_map<property_id_t, Bounds> boundsPerProperty;
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        auto comparison = getPropertyComparison(*predicate, *scan.getNodeID());
+        if (!comparison.has_value() || !tableEntry->containsProperty(comparison->propertyName)) {
+            continue;
+        }
+        const auto propertyID = tableEntry->getPropertyID(comparison->propertyName);
+        if (!indexNames.contains(propertyID)) {
+            continue;
+        }
+        // Only one bound is kept on each side, since constants are not compared while planning.
+        auto& bounds = boundsPerProperty[propertyID];
+        const bool isLower = comparison->comparisonType != ExpressionType::LESS_THAN &&
+                             comparison->comparisonType != ExpressionType::LESS_THAN_EQUALS;
+        const bool isUpper = comparison->comparisonType != ExpressionType::GREATER_THAN &&
+                             comparison->comparisonType != ExpressionType::GREATER_THAN_EQUALS;
+        if ((isLower && bounds.lower != nullptr) || (isUpper && bounds.upper != nullptr)) {
+            continue;
+        }
+        if (isLower) {
+            bounds.lower = comparison->constant;
+        }
+        if (isUpper) {
+            bounds.upper = comparison->constant;
+        }
+        bounds.selectivity *=
+            static_cast<double>(estimator.estimateFilter(scan, *predicate)) / numNodes;
+    }
+    const std::pair<const property_id_t, Bounds>* best = nullptr;
+    for (auto& entry : boundsPerProperty) {
+        if (best == nullptr || entry.second.selectivity < best->second.selectivity) {
+            best = &entry;
+        }
+    }
+    if (best == nullptr || best->second.selectivity > PlannerKnobs::SORTED_INDEX_SCAN_SELECTIVITY) {
+        return;
+    }
+    scan.setScanType(LogicalScanNodeTableType::SORTED_INDEX_SCAN);
+    scan.setExtraInfo(std::make_unique<SortedIndexScanInfo>(indexNames.at(best->first),
+        best->second.lower, best->second.upper));
+    scan.computeFlatSchema();
+}
+
+expression_vector FilterPushDownOptimizer::popLateMaterializedProperties(
+    LogicalScanNodeTable& scan) {
+    auto tableIDs = scan.getTableIDs();
+    if (tableIDs.size() != 1 || predicateSet.isEmpty()) {
+        return expression_vector{};
+    }
+    auto estimator = CardinalityEstimator(context);
+    estimator.init(*scan.getNodeID(), tableIDs);
+    const auto numNodes = std::max<cardinality_t>(scan.getCardinality(), 1);
+    auto selectivity = 1.0;
+    expression_set propertiesInUse;
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        selectivity *= static_cast<double>(estimator.estimateFilter(scan, *predicate)) / numNodes;
+        auto collector = PropertyExprCollector();
+        collector.visit(predicate);
+        for (auto& property : collector.getPropertyExprs()) {
+            propertiesInUse.insert(property);
+        }
+    }
+    if (selectivity > PlannerKnobs::LATE_MATERIALIZATION_SELECTIVITY) {
+        return expression_vector{};
+    }
+    expression_vector propertiesToScan;
+    expression_vector propertiesToLookup;
+    for (auto& property : scan.getProperties()) {
+        if (propertiesInUse.contains(property)) {
+            propertiesToScan.push_back(property);
+        } else {
+            propertiesToLookup.push_back(property);
+        }
+    }
+    scan.setProperties(std::move(propertiesToScan));
+    return propertiesToLookup;
 }
 
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitTableFunctionCallReplace(
@@ -0,0 +1,127 @@
+#include "optimizer/late_materialization_optimizer.h"
+
+#include "binder/expression_visitor.h"
+#include "common/constants.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_lookup_node_table.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void LateMaterializationOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> LateMaterializationOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+static void collectProperties(const std::shared_ptr<Expression>& expression,
+    expression_set& properties) {
+    auto collector = PropertyExprCollector();
+    collector.visit(expression);
+    for (auto& property : collector.getPropertyExprs()) {
+        properties.insert(property);
+    }
+}
+
+// Returns the operators from the root of the build side down to its node table scan, or an empty
+// vector if the build side is not a scan below filters and lookups.
+static std::vector<LogicalOperator*> getBuildChain(LogicalOperator* op,
+    expression_set& propertiesInUse) {
+    std::vector<LogicalOperator*> chain;
+    while (true) {
+        chain.push_back(op);
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::FILTER: {
+            collectProperties(op->constCast<LogicalFilter>().getPredicate(), propertiesInUse);
+        } break;
+        case LogicalOperatorType::LOOKUP_NODE_TABLE:
+            break;
+        case LogicalOperatorType::SCAN_NODE_TABLE: {
+            auto& scan = op->constCast<LogicalScanNodeTable>();
+            if (scan.getScanType() != LogicalScanNodeTableType::SCAN ||
+                scan.getTableIDs().size() != 1) {
+                return {};
+            }
+            return chain;
+        }
+        default:
+            return {};
+        }
+        op = op->getChild(0).get();
+    }
+}
+
+std::shared_ptr<LogicalOperator> LateMaterializationOptimizer::visitHashJoinReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& hashJoin = op->cast<LogicalHashJoin>();
+    if (hashJoin.getJoinType() != JoinType::INNER) {
+        return op;
+    }
+    auto build = hashJoin.getChild(1);
+    const auto numBuildTuples = std::max<cardinality_t>(build->getCardinality(), 1);
+    if (static_cast<double>(hashJoin.getCardinality()) / numBuildTuples >
+        PlannerKnobs::HASH_JOIN_LATE_MATERIALIZATION_SELECTIVITY) {
+        return op;
+    }
+    expression_set propertiesInUse;
+    for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+        collectProperties(buildKey, propertiesInUse);
+    }
+    auto buildChain = getBuildChain(build.get(), propertiesInUse);
+    if (buildChain.empty()) {
+        return op;
+    }
+    auto& scan = buildChain.back()->cast<LogicalScanNodeTable>();
+    // Properties are looked up by the node IDs in the output of the join.
+    hashJoin.computeFlatSchema();
+    if (!hashJoin.getSchema()->isExpressionInScope(*scan.getNodeID())) {
+        return op;
+    }
+    // Property predicates are aligned with the properties of the scan.
+    auto properties = scan.getProperties();
+    auto predicates = copyVector(scan.getPropertyPredicates());
+    expression_vector propertiesToScan;
+    std::vector<storage::ColumnPredicateSet> predicatesToScan;
+    expression_vector propertiesToLookup;
+    for (auto i = 0u; i < properties.size(); i++) {
+        const auto hasPredicates = i < predicates.size() && !predicates[i].isEmpty();
+        if (properties[i]->getDataType().getPhysicalType() != PhysicalTypeID::STRING ||
+            hasPredicates || propertiesInUse.contains(properties[i])) {
+            propertiesToScan.push_back(properties[i]);
+            if (i < predicates.size()) {
+                predicatesToScan.push_back(std::move(predicates[i]));
+            }
+        } else {
+            propertiesToLookup.push_back(properties[i]);
+        }
+    }
+    if (propertiesToLookup.empty()) {
+        return op;
+    }
+    scan.setProperties(std::move(propertiesToScan));
+    scan.setPropertyPredicates(std::move(predicatesToScan));
+    for (auto it = buildChain.rbegin(); it != buildChain.rend(); ++it) {
+        (*it)->computeFlatSchema();
+    }
+    hashJoin.computeFlatSchema();
+    return std::make_shared<LogicalLookupNodeTable>(scan.getNodeID(), scan.getTableIDs(),
+        std::move(propertiesToLookup), op);
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -6,6 +6,7 @@
 #include "planner/operator/logical_distinct.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_limit.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -69,6 +70,15 @@ void LimitPushDownOptimizer::visitOperator(planner::LogicalOperator* op) {
         }
         return;
     }
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        if (limitNumber == INVALID_LIMIT && skipNumber == 0) {
+            return;
+        }
+        disablePrefetch(op);
+        return;
+    }
     case LogicalOperatorType::UNION_ALL: {
         for (auto i = 0u; i < op->getNumChildren(); ++i) {
             auto optimizer = LimitPushDownOptimizer();
@@ -81,5 +91,24 @@ void LimitPushDownOptimizer::visitOperator(planner::LogicalOperator* op) {
     }
 }
 
+void LimitPushDownOptimizer::disablePrefetch(LogicalOperator* op) {
+    // The limit cannot be pushed past filters, but a scan below them still stops as soon as enough
+    // tuples pass, so reading its pages ahead is mostly wasted.
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::PROJECTION: {
+        disablePrefetch(op->getChild(0).get());
+        return;
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        op->cast<LogicalScanNodeTable>().setPrefetchPages(false);
+        return;
+    }
+    default:
+        return;
+    }
+}
+
 } // namespace optimizer
 } // namespace kuzu
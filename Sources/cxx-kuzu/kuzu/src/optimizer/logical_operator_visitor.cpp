@@ -52,6 +52,9 @@ void LogicalOperatorVisitor::visitOperatorSwitch(LogicalOperator* op) {
     case LogicalOperatorType::LIMIT: {
         visitLimit(op);
     } break;
+    case LogicalOperatorType::LOOKUP_NODE_TABLE: {
+        visitLookupNodeTable(op);
+    } break;
     case LogicalOperatorType::MERGE: {
         visitMerge(op);
     } break;
@@ -141,6 +144,9 @@ std::shared_ptr<LogicalOperator> LogicalOperatorVisitor::visitOperatorReplaceSwi
     case LogicalOperatorType::LIMIT: {
         return visitLimitReplace(op);
     }
+    case LogicalOperatorType::LOOKUP_NODE_TABLE: {
+        return visitLookupNodeTableReplace(op);
+    }
     case LogicalOperatorType::MERGE: {
         return visitMergeReplace(op);
     }
@@ -5,13 +5,17 @@
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/cardinality_updater.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
+#include "optimizer/eager_aggregation_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
+#include "optimizer/late_materialization_optimizer.h"
 #include "optimizer/limit_push_down_optimizer.h"
 #include "optimizer/projection_push_down_optimizer.h"
+#include "optimizer/rel_degree_optimizer.h"
 #include "optimizer/remove_factorization_rewriter.h"
 #include "optimizer/remove_unnecessary_join_optimizer.h"
 #include "optimizer/schema_populator.h"
+#include "optimizer/shared_subplan_optimizer.h"
 #include "optimizer/top_k_optimizer.h"
 #include "planner/operator/logical_explain.h"
 #include "transaction/transaction.h"
@@ -42,6 +46,11 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto limitPushDownOptimizer = LimitPushDownOptimizer();
         limitPushDownOptimizer.rewrite(plan);
 
+        // LateMaterializationOptimizer should be applied after ProjectionPushDownOptimizer, which
+        // removes the properties that are not used from scans.
+        auto lateMaterializationOptimizer = LateMaterializationOptimizer();
+        lateMaterializationOptimizer.rewrite(plan);
+
         if (context->getClientConfig()->enableSemiMask) {
             // HashJoinSIPOptimizer should be applied after optimizers that manipulate hash join.
             auto hashJoinSIPOptimizer = HashJoinSIPOptimizer();
@@ -51,6 +60,23 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto topKOptimizer = TopKOptimizer();
         topKOptimizer.rewrite(plan);
 
+        // EagerAggregationOptimizer should be applied after HashJoinSIPOptimizer, which does not
+        // expect aggregates below joins, and before AggKeyDependencyOptimizer resolves the keys.
+        auto eagerAggregationOptimizer = EagerAggregationOptimizer();
+        eagerAggregationOptimizer.rewrite(plan);
+
+        // RelDegreeOptimizer should be applied after ProjectionPushDownOptimizer, which tells
+        // extends whether their neighbours are used, and after EagerAggregationOptimizer so that
+        // partial counts below joins are read from degrees too.
+        auto relDegreeOptimizer = RelDegreeOptimizer();
+        relDegreeOptimizer.rewrite(plan);
+
+        // SharedSubplanOptimizer should be applied after HashJoinSIPOptimizer so that semi masks
+        // are not shared, and before FactorizationRewriter which flattens the shared sub-plans.
+        auto sharedSubplanOptimizer =
+            SharedSubplanOptimizer(cardinalityEstimator, transaction::Transaction::Get(*context));
+        sharedSubplanOptimizer.rewrite(plan);
+
         auto factorizationRewriter = FactorizationRewriter();
         factorizationRewriter.rewrite(plan);
 
@@ -20,6 +20,7 @@
 #include "planner/operator/persistent/logical_insert.h"
 #include "planner/operator/persistent/logical_merge.h"
 #include "planner/operator/persistent/logical_set.h"
+#include "planner/operator/scan/logical_lookup_node_table.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -100,6 +101,11 @@ void ProjectionPushDownOptimizer::visitNodeLabelFilter(LogicalOperator* op) {
     collectExpressionsInUse(filter.getNodeID());
 }
 
+void ProjectionPushDownOptimizer::visitLookupNodeTable(LogicalOperator* op) {
+    auto& lookup = op->constCast<LogicalLookupNodeTable>();
+    collectExpressionsInUse(lookup.getNodeID());
+}
+
 void ProjectionPushDownOptimizer::visitHashJoin(LogicalOperator* op) {
     auto& hashJoin = op->constCast<LogicalHashJoin>();
     for (auto& [probeJoinKey, buildJoinKey] : hashJoin.getJoinConditions()) {
@@ -0,0 +1,141 @@
+#include "optimizer/rel_degree_optimizer.h"
+
+#include "binder/expression/aggregate_function_expression.h"
+#include "binder/expression/variable_expression.h"
+#include "common/utils.h"
+#include "function/aggregate/count_star.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/extend/logical_rel_degree.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void RelDegreeOptimizer::rewrite(LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void RelDegreeOptimizer::visitOperator(LogicalOperator* op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+    visitOperatorSwitch(op);
+}
+
+static bool isCountStar(const Expression& expression) {
+    return expression.constCast<AggregateFunctionExpression>().getFunction().name ==
+           CountStarFunction::name;
+}
+
+// Whether the result of the aggregate does not change if duplicates of its input tuples are
+// removed.
+static bool isDuplicateInsensitive(const Expression& expression) {
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    auto& name = aggregate.getFunction().name;
+    return aggregate.isDistinct() || name == AggregateMinFunction::name ||
+           name == AggregateMaxFunction::name;
+}
+
+static bool isInScope(const expression_vector& expressions, const Schema& schema) {
+    for (auto& expression : expressions) {
+        if (!schema.isExpressionInScope(*expression)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whether the extend is only needed to count the rels of each bound node, which can be read from a
+// single CSR. Extends served by a reverse index have no CSR to count from.
+static bool canCountFromCSR(const LogicalExtend& extend) {
+    auto rel = extend.getRel();
+    return !rel->isMultiLabeled() && !extend.getBoundNode()->isMultiLabeled() &&
+           extend.getDirection() != ExtendDirection::BOTH && !rel->hasDirectionExpr() &&
+           containsValue(rel->getExtendDirections(), extend.getDirection()) &&
+           !extend.shouldScanNbrID() && extend.getProperties().empty() &&
+           extend.getPropertyPredicates().empty();
+}
+
+void RelDegreeOptimizer::visitAggregate(LogicalOperator* op) {
+    auto& aggregate = op->cast<LogicalAggregate>();
+    // Expressions which must be available below the extend.
+    auto keptExpressions = aggregate.getAllKeys();
+    auto hasCountStar = false;
+    for (auto& expression : aggregate.getAggregates()) {
+        if (expression->expressionType != ExpressionType::AGGREGATE_FUNCTION) {
+            return;
+        }
+        if (isCountStar(*expression)) {
+            hasCountStar = true;
+        } else if (isDuplicateInsensitive(*expression)) {
+            for (auto& child : expression->getChildren()) {
+                keptExpressions.push_back(child);
+            }
+        } else {
+            return;
+        }
+    }
+    if (!hasCountStar) {
+        return;
+    }
+    std::vector<LogicalProjection*> projections;
+    auto parent = op;
+    auto child = aggregate.getChild(0).get();
+    while (child->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        auto& projection = child->cast<LogicalProjection>();
+        auto expressions = projection.getExpressionsToProject();
+        keptExpressions.insert(keptExpressions.end(), expressions.begin(), expressions.end());
+        projections.push_back(&projection);
+        parent = child;
+        child = child->getChild(0).get();
+    }
+    if (child->getOperatorType() != LogicalOperatorType::EXTEND) {
+        return;
+    }
+    auto& extend = child->cast<LogicalExtend>();
+    if (!canCountFromCSR(extend) || !isInScope(keptExpressions, *extend.getChild(0)->getSchema())) {
+        return;
+    }
+    auto rel = extend.getRel();
+    std::shared_ptr<Expression> degree = std::make_shared<VariableExpression>(LogicalType::INT64(),
+        rel->getUniqueName() + "_degree", rel->getVariableName() + "_degree");
+    auto relDegree = std::make_shared<LogicalRelDegree>(extend.getBoundNode(), extend.getNbrNode(),
+        rel, extend.getDirection(), degree, extend.getChild(0),
+        extend.getChild(0)->getCardinality());
+    relDegree->computeFlatSchema();
+    parent->setChild(0, std::move(relDegree));
+    // COUNT(*) becomes the sum of the degrees. The sum keeps the name and the type of the count so
+    // that operators above still find it.
+    auto aggregates = aggregate.getAggregates();
+    for (auto& expression : aggregates) {
+        if (!isCountStar(*expression)) {
+            continue;
+        }
+        std::shared_ptr<Expression> sum = std::make_shared<AggregateFunctionExpression>(
+            CountStarFromCountsFunction::getFunction(),
+            std::make_unique<FunctionBindData>(LogicalType::INT64()), expression_vector{degree},
+            expression->getUniqueName());
+        if (expression->hasAlias()) {
+            sum->setAlias(expression->getAlias());
+        }
+        expression = std::move(sum);
+    }
+    for (auto it = projections.rbegin(); it != projections.rend(); ++it) {
+        auto expressions = (*it)->getExpressionsToProject();
+        expressions.push_back(degree);
+        (*it)->setExpressionsToProject(expressions);
+        (*it)->computeFlatSchema();
+    }
+    aggregate.setAggregates(std::move(aggregates));
+    aggregate.computeFlatSchema();
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,227 @@
+#include "optimizer/shared_subplan_optimizer.h"
+
+#include <algorithm>
+
+#include "binder/expression/node_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "binder/expression_visitor.h"
+#include "common/enums/accumulate_type.h"
+#include "optimizer/cardinality_updater.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/scan/logical_shared_scan.h"
+#include "planner/operator/sip/logical_semi_masker.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void SharedSubplanOptimizer::rewrite(LogicalPlan* plan) {
+    // Cardinalities set during planning are stale after the preceding rewrites.
+    auto cardinalityUpdater = CardinalityUpdater(cardinalityEstimator, transaction);
+    cardinalityUpdater.rewrite(plan);
+    auto root = plan->getLastOperator().get();
+    collectSemiMaskTargets(root);
+    for (auto i = 0u; i < root->getNumChildren(); ++i) {
+        visitChild(root, i, root->getOperatorType() == LogicalOperatorType::LIMIT);
+    }
+    std::unordered_map<std::string, std::vector<const Subplan*>> signatureToOccurrences;
+    std::vector<std::string> signatures;
+    for (auto& subplan : subplans) {
+        if (!subplan.hasJoin) {
+            continue;
+        }
+        if (!signatureToOccurrences.contains(subplan.signature)) {
+            signatures.push_back(subplan.signature);
+        }
+        signatureToOccurrences[subplan.signature].push_back(&subplan);
+    }
+    // Share the largest sub-plans first. Sub-plans within a shared one are not shared again.
+    std::stable_sort(signatures.begin(), signatures.end(), [&](const auto& a, const auto& b) {
+        return signatureToOccurrences.at(a)[0]->numOperators >
+               signatureToOccurrences.at(b)[0]->numOperators;
+    });
+    for (auto& signature : signatures) {
+        std::vector<const Subplan*> occurrences;
+        for (auto subplan : signatureToOccurrences.at(signature)) {
+            if (!replacedOps.contains(subplan->op.get())) {
+                occurrences.push_back(subplan);
+            }
+        }
+        if (occurrences.size() > 1 && isCheaperToShare(occurrences)) {
+            share(occurrences);
+        }
+    }
+}
+
+void SharedSubplanOptimizer::collectSemiMaskTargets(const LogicalOperator* op) {
+    if (op->getOperatorType() == LogicalOperatorType::SEMI_MASKER) {
+        for (auto target : op->constCast<LogicalSemiMasker>().getTargetOperators()) {
+            semiMaskTargets.insert(target);
+        }
+    }
+    for (auto& child : op->getChildren()) {
+        collectSemiMaskTargets(child.get());
+    }
+}
+
+std::optional<uint64_t> SharedSubplanOptimizer::visitChild(LogicalOperator* parent,
+    uint32_t childIdx, bool belowLimit) {
+    auto op = parent->getChild(childIdx);
+    belowLimit |= op->getOperatorType() == LogicalOperatorType::LIMIT;
+    // bottom-up traversal
+    std::vector<std::optional<uint64_t>> childSubplans;
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        childSubplans.push_back(visitChild(op.get(), i, belowLimit));
+    }
+    op->computeFlatSchema();
+    auto signature = getSignature(*op);
+    if (!signature.has_value() || belowLimit) {
+        return std::nullopt;
+    }
+    Subplan subplan{op, parent, childIdx, *signature + "(", 1 /* numOperators */,
+        op->getOperatorType() == LogicalOperatorType::EXTEND ||
+            op->getOperatorType() == LogicalOperatorType::HASH_JOIN,
+        static_cast<double>(op->getCardinality())};
+    for (auto& childSubplan : childSubplans) {
+        if (!childSubplan.has_value()) {
+            return std::nullopt;
+        }
+        auto& child = subplans[*childSubplan];
+        subplan.signature += child.signature + ",";
+        subplan.numOperators += child.numOperators;
+        subplan.hasJoin |= child.hasJoin;
+        subplan.cost += child.cost;
+    }
+    subplan.signature += ")";
+    // Expressions of the sub-plan are matched between occurrences by their names, which must not
+    // be ambiguous, e.g. because of several anonymous nodes.
+    std::unordered_set<std::string> names;
+    for (auto& expression : op->getSchema()->getExpressionsInScope()) {
+        if (!names.insert(expression->toString()).second) {
+            return std::nullopt;
+        }
+    }
+    subplans.push_back(std::move(subplan));
+    return subplans.size() - 1;
+}
+
+static std::string getPredicatesSignature(
+    const std::vector<storage::ColumnPredicateSet>& predicates) {
+    std::string result;
+    for (auto& predicate : predicates) {
+        result += predicate.toString() + ";";
+    }
+    return result;
+}
+
+static std::string getTableIDsSignature(const std::vector<table_id_t>& tableIDs) {
+    std::string result;
+    for (auto tableID : tableIDs) {
+        result += std::to_string(tableID) + ";";
+    }
+    return result;
+}
+
+std::optional<std::string> SharedSubplanOptimizer::getSignature(const LogicalOperator& op) const {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op.constCast<LogicalScanNodeTable>();
+        if (scan.getScanType() != LogicalScanNodeTableType::SCAN ||
+            scan.getExtraInfo() != nullptr || semiMaskTargets.contains(&op)) {
+            return std::nullopt;
+        }
+        return "SCAN " + getTableIDsSignature(scan.getTableIDs()) + scan.getNodeID()->toString() +
+               " " + ExpressionUtil::toString(scan.getProperties()) + " " +
+               getPredicatesSignature(scan.getPropertyPredicates());
+    }
+    case LogicalOperatorType::EXTEND: {
+        auto& extend = op.constCast<LogicalExtend>();
+        auto rel = extend.getRel();
+        return "EXTEND " + getTableIDsSignature(rel->getTableIDs()) +
+               getTableIDsSignature(extend.getNbrNode()->getTableIDs()) +
+               extend.getBoundNode()->toString() + " " + extend.getNbrNode()->toString() + " " +
+               (rel->hasAlias() ? rel->toString() : "") + " " +
+               std::to_string(static_cast<uint8_t>(extend.getDirection())) +
+               std::to_string(extend.extendFromSourceNode()) +
+               std::to_string(extend.shouldScanNbrID()) + " " +
+               ExpressionUtil::toString(extend.getProperties()) + " " +
+               getPredicatesSignature(extend.getPropertyPredicates());
+    }
+    case LogicalOperatorType::FILTER: {
+        auto predicate = op.constCast<LogicalFilter>().getPredicate();
+        auto collector = SubqueryExprCollector();
+        collector.visit(predicate);
+        // Evaluating a random predicate once for all occurrences would change the result.
+        if (collector.hasSubquery() || ExpressionVisitor::isRandom(*predicate)) {
+            return std::nullopt;
+        }
+        return "FILTER " + predicate->toString();
+    }
+    case LogicalOperatorType::HASH_JOIN: {
+        auto& hashJoin = op.constCast<LogicalHashJoin>();
+        if (hashJoin.getJoinType() != JoinType::INNER ||
+            hashJoin.getSIPInfo().position != SemiMaskPosition::NONE) {
+            return std::nullopt;
+        }
+        std::string result = "HASH_JOIN ";
+        for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+            result += probeKey->toString() + "=" + buildKey->toString() + ";";
+        }
+        return result;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+bool SharedSubplanOptimizer::isCheaperToShare(const std::vector<const Subplan*>& occurrences) {
+    // Sharing computes the sub-plan once, writes its flat result and scans it from every
+    // occurrence, instead of computing the sub-plan for every occurrence.
+    auto numOccurrences = static_cast<double>(occurrences.size());
+    auto numMaterializedTuples = static_cast<double>(occurrences[0]->op->getCardinality());
+    auto costWithSharing = occurrences[0]->cost + (numOccurrences + 1) * numMaterializedTuples;
+    auto costWithoutSharing = numOccurrences * occurrences[0]->cost;
+    return costWithSharing < costWithoutSharing;
+}
+
+void SharedSubplanOptimizer::share(const std::vector<const Subplan*>& occurrences) {
+    auto owner = occurrences[0]->op;
+    auto materializedExpressions = owner->getSchema()->getExpressionsInScope();
+    // All payloads are flattened so that the table can be scanned in batches by every consumer.
+    auto accumulate = std::make_shared<LogicalAccumulate>(AccumulateType::REGULAR,
+        materializedExpressions, nullptr /* mark */, owner);
+    accumulate->computeFlatSchema();
+    for (auto i = 0u; i < occurrences.size(); ++i) {
+        auto& occurrence = *occurrences[i];
+        std::unordered_map<std::string, std::shared_ptr<Expression>> nameToExpression;
+        for (auto& expression : occurrence.op->getSchema()->getExpressionsInScope()) {
+            nameToExpression.insert({expression->toString(), expression});
+        }
+        expression_vector expressions;
+        for (auto& expression : materializedExpressions) {
+            KU_ASSERT(nameToExpression.contains(expression->toString()));
+            expressions.push_back(nameToExpression.at(expression->toString()));
+        }
+        collectReplacedOps(occurrence.op.get());
+        auto sharedScan = std::make_shared<LogicalSharedScan>(std::move(expressions),
+            materializedExpressions, accumulate, i == 0 /* ownsAccumulate */);
+        sharedScan->computeFlatSchema();
+        occurrence.parent->setChild(occurrence.childIdx, std::move(sharedScan));
+    }
+}
+
+void SharedSubplanOptimizer::collectReplacedOps(const LogicalOperator* op) {
+    replacedOps.insert(op);
+    for (auto& child : op->getChildren()) {
+        collectReplacedOps(child.get());
+    }
+}
+
+} // namespace optimizer
+} // namespace kuzu
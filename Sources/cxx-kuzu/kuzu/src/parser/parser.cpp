@@ -1,5 +1,7 @@
 #include "parser/parser.h"
 
+#include <mutex>
+
 // ANTLR4 generates code with unused parameters.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -42,13 +44,55 @@ std::vector<std::shared_ptr<Statement>> Parser::parseQuery(std::string_view quer
     tokens.fill();
 
     auto kuzuCypherParser = KuzuCypherParser(&tokens);
+    // Parse with SLL prediction first, which is much cheaper than full LL prediction and succeeds
+    // for almost all queries. The parse bails out on the first error, and the query is parsed
+    // again with LL prediction, which either succeeds or reports the error.
     kuzuCypherParser.removeErrorListeners();
-    kuzuCypherParser.addErrorListener(&parserErrorListener);
-    kuzuCypherParser.setErrorHandler(std::make_shared<ParserErrorStrategy>());
+    kuzuCypherParser.setErrorHandler(std::make_shared<BailErrorStrategy>());
+    kuzuCypherParser.getInterpreter<atn::ParserATNSimulator>()->setPredictionMode(
+        atn::PredictionMode::SLL);
+    CypherParser::Ku_StatementsContext* statements = nullptr;
+    try {
+        statements = kuzuCypherParser.ku_Statements();
+    } catch (std::exception&) { // NOLINT(bugprone-empty-catch): The query is parsed again with
+                                // LL prediction below.
+    }
+    if (statements == nullptr) {
+        tokens.seek(0);
+        kuzuCypherParser.reset();
+        kuzuCypherParser.addErrorListener(&parserErrorListener);
+        kuzuCypherParser.setErrorHandler(std::make_shared<ParserErrorStrategy>());
+        kuzuCypherParser.getInterpreter<atn::ParserATNSimulator>()->setPredictionMode(
+            atn::PredictionMode::LL);
+        statements = kuzuCypherParser.ku_Statements();
+    }
 
-    Transformer transformer(*kuzuCypherParser.ku_Statements(), std::move(transformerExtensions));
+    Transformer transformer(*statements, std::move(transformerExtensions));
     return transformer.transform();
 }
 
+void Parser::warmUp() {
+    static std::once_flag warmUpFlag;
+    std::call_once(warmUpFlag, []() {
+        static constexpr const char* queries[] = {
+            "MATCH (a:A)-[e:E]->(b:B) WHERE a.id = 0 AND b.x <> 'x' RETURN a.id, count(*) AS c "
+            "ORDER BY c DESC LIMIT 10;",
+            "MATCH (a:A {id: $id}) OPTIONAL MATCH (a)-[:E*1..2]-(b) WITH a, collect(b) AS l "
+            "RETURN a, size(l);",
+            "MATCH (a:A) WHERE a.id IN [1, 2] SET a.x = a.x + 1 RETURN a;",
+            "CREATE (a:A {id: 1, x: 'x'});",
+            "MERGE (a:A {id: 1}) ON CREATE SET a.x = 'x';",
+            "UNWIND [1, 2] AS i MATCH (a:A)-[e]->(b) WHERE a.id = i DELETE e;",
+        };
+        for (auto query : queries) {
+            try {
+                parseQuery(query);
+            } catch (std::exception&) { // NOLINT(bugprone-empty-catch): The DFA is populated
+                                        // even if the transformation fails.
+            }
+        }
+    });
+}
+
 } // namespace parser
 } // namespace kuzu
@@ -1,5 +1,6 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
@@ -35,17 +36,26 @@ void CardinalityEstimator::init(const QueryGraph& queryGraph) {
 }
 
 void CardinalityEstimator::init(const NodeExpression& node) {
-    auto key = node.getInternalID()->getUniqueName();
+    init(*node.getInternalID(), node.getTableIDs());
+}
+
+void CardinalityEstimator::init(const Expression& nodeID, const std::vector<table_id_t>& tableIDs) {
+    auto key = nodeID.getUniqueName();
     cardinality_t numNodes = 0u;
     auto storageManager = storage::StorageManager::Get(*context);
     auto transaction = transaction::Transaction::Get(*context);
-    for (auto tableID : node.getTableIDs()) {
-        auto stats =
-            storageManager->getTable(tableID)->cast<storage::NodeTable>().getStats(transaction);
+    for (auto tableID : tableIDs) {
+        auto& table = storageManager->getTable(tableID)->cast<storage::NodeTable>();
+        auto stats = table.getStats(transaction);
         numNodes += stats.getTableCard();
         if (!nodeTableStats.contains(tableID)) {
             nodeTableStats.insert({tableID, std::move(stats)});
         }
+        if (!nodeTableHistograms.contains(tableID)) {
+            if (auto histograms = table.getHistograms()) {
+                nodeTableHistograms.insert({tableID, std::move(histograms)});
+            }
+        }
     }
     if (!nodeIDName2dom.contains(key)) {
         nodeIDName2dom.insert({key, numNodes});
@@ -171,8 +181,105 @@ static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext*
     return {};
 }
 
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+// Estimates the selectivity of a comparison between a single labelled property and a literal from
+// the histogram of the property, if its table has been analyzed.
+std::optional<double> CardinalityEstimator::getHistogramSelectivity(
+    const Expression& predicate) const {
+    auto type = predicate.expressionType;
+    if (type != ExpressionType::EQUALS && type != ExpressionType::GREATER_THAN &&
+        type != ExpressionType::GREATER_THAN_EQUALS && type != ExpressionType::LESS_THAN &&
+        type != ExpressionType::LESS_THAN_EQUALS) {
+        return {};
+    }
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (property->expressionType == ExpressionType::LITERAL) {
+        std::swap(property, literal);
+        type = flipComparison(type);
+    }
+    if (literal->expressionType != ExpressionType::LITERAL ||
+        !isSingleLabelledProperty(*property)) {
+        return {};
+    }
+    // Numeric keys are only comparable to numeric keys, and string keys to string keys.
+    if ((literal->dataType.getPhysicalType() == PhysicalTypeID::STRING) !=
+        (property->dataType.getPhysicalType() == PhysicalTypeID::STRING)) {
+        return {};
+    }
+    auto& propertyExpr = property->constCast<PropertyExpression>();
+    auto tableID = propertyExpr.getSingleTableID();
+    if (!nodeTableHistograms.contains(tableID) || !propertyExpr.hasProperty(tableID)) {
+        return {};
+    }
+    auto entry = catalog::Catalog::Get(*context)->getTableCatalogEntry(
+        Transaction::Get(*context), tableID);
+    auto histogram = nodeTableHistograms.at(tableID)->getColumnHistogram(
+        entry->getPropertyID(propertyExpr.getPropertyName()));
+    auto key = storage::ColumnHistogram::getKey(literal->constCast<LiteralExpression>().value);
+    if (histogram == nullptr || !key.has_value()) {
+        return {};
+    }
+    double selectivity = 0;
+    switch (type) {
+    case ExpressionType::EQUALS: {
+        selectivity = histogram->getEqualSelectivity(*key);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        selectivity = histogram->getRangeSelectivity(key, false, std::nullopt, false);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        selectivity = histogram->getRangeSelectivity(key, true, std::nullopt, false);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        selectivity = histogram->getRangeSelectivity(std::nullopt, false, key, false);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        selectivity = histogram->getRangeSelectivity(std::nullopt, false, key, true);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    // The histogram only describes the rows of the table when it was analyzed. Rows inserted since
+    // then, e.g. with keys beyond the last bucket, get the default selectivity.
+    const auto numRowsAnalyzed = nodeTableHistograms.at(tableID)->numRowsAnalyzed;
+    const auto numRows = nodeTableStats.at(tableID).getTableCard();
+    if (numRows > numRowsAnalyzed) {
+        const auto analyzedFraction = static_cast<double>(numRowsAnalyzed) / numRows;
+        const auto defaultSelectivity = type == ExpressionType::EQUALS ?
+                                            PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY :
+                                            PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+        selectivity =
+            selectivity * analyzedFraction + defaultSelectivity * (1 - analyzedFraction);
+    }
+    return selectivity;
+}
+
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
+    const auto isPrimaryKeyEquality =
+        predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)));
+    if (predicate.getNumChildren() == 2 && !isPrimaryKeyEquality) {
+        const auto selectivity = getHistogramSelectivity(predicate);
+        if (selectivity.has_value()) {
+            return atLeastOne(childPlan.getCardinality() * selectivity.value());
+        }
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
         if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
             return 1;
@@ -243,5 +350,40 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     }
 }
 
+std::optional<double> CardinalityEstimator::getJoinedNodeDegree(const RelExpression& rel,
+    const NodeExpression& boundNode, const Transaction* transaction) const {
+    if (rel.getRelType() != QueryRelType::NON_RECURSIVE) {
+        return std::nullopt;
+    }
+    std::vector<RelDataDirection> directions;
+    if (rel.getDirectionType() == RelDirectionType::BOTH) {
+        directions = {RelDataDirection::FWD, RelDataDirection::BWD};
+    } else if (rel.getSrcNodeName() == boundNode.getUniqueName()) {
+        directions = {RelDataDirection::FWD};
+    } else {
+        directions = {RelDataDirection::BWD};
+    }
+    // The skew of the tables is weighted by their number of rels, and the maximum degrees bound
+    // the result.
+    auto storageManager = storage::StorageManager::Get(*context);
+    double weightedSkew = 0, numRels = 0, maxDegree = 0;
+    for (auto tableID : rel.getInnerRelTableIDs()) {
+        auto& table = storageManager->getTable(tableID)->cast<storage::RelTable>();
+        const auto numTableRels = static_cast<double>(table.getNumTotalRows(transaction));
+        for (auto direction : directions) {
+            auto degreeStats = table.getDegreeStats(direction);
+            if (!degreeStats) {
+                return std::nullopt;
+            }
+            weightedSkew += numTableRels * degreeStats->skew;
+            numRels += numTableRels;
+            maxDegree += degreeStats->maxDegree;
+        }
+    }
+    const auto avgDegree = getExtensionRate(rel, boundNode, transaction);
+    auto degree = numRels > 0 ? avgDegree * weightedSkew / numRels : avgDegree;
+    return std::min(degree, std::max(maxDegree, avgDegree));
+}
+
 } // namespace planner
 } // namespace kuzu
@@ -1,5 +1,7 @@
 #include "planner/join_order/cost_model.h"
 
+#include <algorithm>
+
 #include "common/constants.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/logical_hash_join.h"
@@ -40,15 +42,32 @@ uint64_t CostModel::computeMarkJoinCost(const binder::expression_vector& joinNod
 }
 
 uint64_t CostModel::computeIntersectCost(const LogicalPlan& probePlan,
-    const std::vector<LogicalPlan>& buildPlans) {
+    const std::vector<LogicalPlan>& buildPlans, const std::vector<double>& buildDegrees) {
+    KU_ASSERT(buildDegrees.empty() || buildPlans.size() == buildDegrees.size());
     uint64_t cost = 0ul;
     cost += probePlan.getCost();
-    // TODO(Xiyang): think of how to calculate intersect cost such that it will be picked in worst
-    // case.
-    cost += probePlan.getCardinality();
+    if (buildDegrees.empty()) {
+        // TODO(Xiyang): think of how to calculate intersect cost such that it will be picked in
+        // worst case.
+        cost += probePlan.getCardinality();
+        for (auto& buildPlan : buildPlans) {
+            KU_ASSERT(buildPlan.getCardinality() >= 1);
+            cost += buildPlan.getCost();
+        }
+        return cost;
+    }
+    // Each probe tuple merges one adjacency list of every build side, so the work per probe tuple
+    // grows with the degrees of the bound nodes, and with their skew.
+    auto listLengths = 0.0;
+    for (auto degree : buildDegrees) {
+        listLengths += degree;
+    }
+    cost += static_cast<uint64_t>(probePlan.getCardinality() * std::max(listLengths, 1.0));
     for (auto& buildPlan : buildPlans) {
         KU_ASSERT(buildPlan.getCardinality() >= 1);
         cost += buildPlan.getCost();
+        // The build sides are materialized into hash tables, as the build side of a hash join.
+        cost += PlannerKnobs::BUILD_PENALTY * buildPlan.getCardinality();
     }
     return cost;
 }
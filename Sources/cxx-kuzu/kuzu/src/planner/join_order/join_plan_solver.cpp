@@ -128,6 +128,7 @@ LogicalPlan JoinPlanSolver::solveMultiwayJoinTreeNode(const JoinTreeNode& treeNo
     auto probePlan = solveTreeNode(*treeNode.children[0], &treeNode);
     std::vector<LogicalPlan> buildPlans;
     expression_vector boundNodeIDs;
+    std::vector<std::shared_ptr<RelExpression>> rels;
     for (auto i = 1u; i < treeNode.children.size(); ++i) {
         auto child = treeNode.children[i];
         KU_ASSERT(child->type == TreeNodeType::REL_SCAN);
@@ -136,10 +137,11 @@ LogicalPlan JoinPlanSolver::solveMultiwayJoinTreeNode(const JoinTreeNode& treeNo
         auto boundNode = *rel->getSrcNode() == joinNode ? rel->getDstNode() : rel->getSrcNode();
         buildPlans.push_back(solveTreeNode(*child, &treeNode).copy());
         boundNodeIDs.push_back(boundNode->constCast<NodeExpression>().getInternalID());
+        rels.push_back(std::move(rel));
     }
     auto plan = LogicalPlan();
     // TODO(Xiyang): provide an interface to append operator to resultPlan.
-    planner->appendIntersect(joinNode.getInternalID(), boundNodeIDs, probePlan, buildPlans);
+    planner->appendIntersect(joinNode.getInternalID(), boundNodeIDs, rels, probePlan, buildPlans);
     plan.setLastOperator(probePlan.getLastOperator());
     planner->appendFilters(extraInfo.predicates, plan);
     return plan;
@@ -1,5 +1,7 @@
 #include "planner/join_order_enumerator_context.h"
 
+#include <algorithm>
+
 using namespace kuzu::binder;
 
 namespace kuzu {
@@ -16,6 +18,39 @@ void JoinOrderEnumeratorContext::init(const QueryGraph* queryGraph_,
     // Restart from level 1 for new query part so that we get hashJoin based plans
     // that uses subplans coming from previous query part.See example in planRelIndexJoin().
     currentLevel = 1;
+    numPlans = 0;
+}
+
+void JoinOrderEnumeratorContext::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
+    numPlans++;
+    if (observedCardinalities != nullptr && !observedCardinalities->empty()) {
+        auto it = observedCardinalities->find(getSubgraphKey(subqueryGraph));
+        if (it != observedCardinalities->end()) {
+            plan.getLastOperator()->setCardinality(it->second);
+        }
+    }
+    subPlansTable->addPlan(subqueryGraph, std::move(plan));
+}
+
+std::string JoinOrderEnumeratorContext::getSubgraphKey(const SubqueryGraph& subqueryGraph) {
+    std::vector<std::string> names;
+    for (auto i = 0u; i < subqueryGraph.queryGraph.getNumQueryNodes(); ++i) {
+        if (subqueryGraph.queryNodesSelector[i]) {
+            names.push_back(subqueryGraph.queryGraph.getQueryNode(i)->getUniqueName());
+        }
+    }
+    for (auto i = 0u; i < subqueryGraph.queryGraph.getNumQueryRels(); ++i) {
+        if (subqueryGraph.queryRelsSelector[i]) {
+            names.push_back(subqueryGraph.queryGraph.getQueryRel(i)->getUniqueName());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    std::string key;
+    for (auto& name : names) {
+        key += name;
+        key += ',';
+    }
+    return key;
 }
 
 SubqueryGraph JoinOrderEnumeratorContext::getFullyMatchedSubqueryGraph() const {
@@ -0,0 +1,18 @@
+#include "planner/operator/extend/logical_rel_degree.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalRelDegree::computeFactorizedSchema() {
+    copyChildSchema(0);
+    // Degrees are aligned with the bound nodes, which are filtered in place.
+    schema->insertToGroupAndScope(degree, schema->getGroupPos(*boundNode->getInternalID()));
+}
+
+void LogicalRelDegree::computeFlatSchema() {
+    copyChildSchema(0);
+    schema->insertToGroupAndScope(degree, 0);
+}
+
+} // namespace planner
+} // namespace kuzu
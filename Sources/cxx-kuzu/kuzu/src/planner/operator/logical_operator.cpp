@@ -70,6 +70,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "INSERT";
     case LogicalOperatorType::LIMIT:
         return "LIMIT";
+    case LogicalOperatorType::LOOKUP_NODE_TABLE:
+        return "LOOKUP_NODE_TABLE";
     case LogicalOperatorType::MERGE:
         return "MERGE";
     case LogicalOperatorType::MULTIPLICITY_REDUCER:
@@ -88,12 +90,16 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "PROJECTION";
     case LogicalOperatorType::RECURSIVE_EXTEND:
         return "RECURSIVE_EXTEND";
+    case LogicalOperatorType::REL_DEGREE:
+        return "REL_DEGREE";
     case LogicalOperatorType::SCAN_NODE_TABLE:
         return "SCAN_NODE_TABLE";
     case LogicalOperatorType::SEMI_MASKER:
         return "SEMI_MASKER";
     case LogicalOperatorType::SET_PROPERTY:
         return "SET_PROPERTY";
+    case LogicalOperatorType::SHARED_SCAN:
+        return "SHARED_SCAN";
     case LogicalOperatorType::STANDALONE_CALL:
         return "STANDALONE_CALL";
     case LogicalOperatorType::TABLE_FUNCTION_CALL:
@@ -90,6 +90,8 @@ void LogicalPlanUtil::encodeScanNodeTable(LogicalOperator* logicalOperator,
     auto& scan = logicalOperator->constCast<LogicalScanNodeTable>();
     if (scan.getScanType() == LogicalScanNodeTableType::PRIMARY_KEY_SCAN) {
         encodeString += "IndexScan";
+    } else if (scan.getScanType() == LogicalScanNodeTableType::SORTED_INDEX_SCAN) {
+        encodeString += "SortedIndexScan";
     } else {
         encodeString += "S";
     }
@@ -0,0 +1,23 @@
+#include "planner/operator/scan/logical_lookup_node_table.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalLookupNodeTable::computeFactorizedSchema() {
+    copyChildSchema(0);
+    // Properties are aligned with the node IDs they are looked up for.
+    const auto groupPos = schema->getGroupPos(*nodeID);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, groupPos);
+    }
+}
+
+void LogicalLookupNodeTable::computeFlatSchema() {
+    copyChildSchema(0);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, 0);
+    }
+}
+
+} // namespace planner
+} // namespace kuzu
@@ -6,7 +6,8 @@ namespace planner {
 LogicalScanNodeTable::LogicalScanNodeTable(const LogicalScanNodeTable& other)
     : LogicalOperator{type_}, scanType{other.scanType}, nodeID{other.nodeID},
       nodeTableIDs{other.nodeTableIDs}, properties{other.properties},
-      propertyPredicates{copyVector(other.propertyPredicates)} {
+      propertyPredicates{copyVector(other.propertyPredicates)},
+      prefetchPages{other.prefetchPages} {
     if (other.extraInfo != nullptr) {
         setExtraInfo(other.extraInfo->copy());
     }
@@ -0,0 +1,15 @@
+#include "planner/operator/scan/logical_shared_scan.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalSharedScan::computeSchema() {
+    createEmptySchema();
+    schema->createGroup();
+    for (auto& expression : expressions) {
+        schema->insertToGroupAndScope(expression, 0);
+    }
+}
+
+} // namespace planner
+} // namespace kuzu
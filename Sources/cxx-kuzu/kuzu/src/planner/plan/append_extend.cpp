@@ -1,6 +1,7 @@
 #include <utility>
 
 #include "catalog/catalog.h"
+#include "binder/expression/property_expression.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/enums/join_type.h"
 #include "planner/join_order/cost_model.h"
@@ -10,6 +11,8 @@
 #include "planner/operator/logical_node_label_filter.h"
 #include "planner/operator/logical_path_property_probe.h"
 #include "planner/planner.h"
+#include "storage/storage_manager.h"
+#include "storage/table/rel_table.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::common;
@@ -67,6 +70,35 @@ static std::unordered_set<table_id_t> getNbrNodeTableIDSet(const RelExpression&
     return result;
 }
 
+std::vector<ExtendDirection> Planner::getExtendDirections(const RelExpression& rel) const {
+    auto directions = rel.getExtendDirections();
+    // The reverse index only keeps the source node and the ID of the rels of a single table, and
+    // only committed rels, so that write transactions scan the table forward.
+    if (directions != std::vector{ExtendDirection::FWD} ||
+        rel.getRelType() != QueryRelType::NON_RECURSIVE ||
+        rel.getDirectionType() != RelDirectionType::SINGLE || rel.isMultiLabeled() ||
+        rel.getDstNode()->isMultiLabeled() || !Transaction::Get(*clientContext)->isReadOnly()) {
+        return directions;
+    }
+    for (auto& property : getProperties(rel)) {
+        if (!property->constCast<PropertyExpression>().isInternalID()) {
+            return directions;
+        }
+    }
+    auto& relTable = storage::StorageManager::Get(*clientContext)
+                         ->getTable(rel.getInnerRelTableIDs()[0])
+                         ->cast<storage::RelTable>();
+    if (!relTable.isReverseIndexEnabled()) {
+        return directions;
+    }
+    if (relTable.getReverseIndex(Transaction::Get(*clientContext)) == nullptr) {
+        storage::RelTableReverseIndex::scheduleBuild(*clientContext, relTable);
+        return directions;
+    }
+    directions.push_back(ExtendDirection::BWD);
+    return directions;
+}
+
 void Planner::appendNonRecursiveExtend(const std::shared_ptr<NodeExpression>& boundNode,
     const std::shared_ptr<NodeExpression>& nbrNode, const std::shared_ptr<RelExpression>& rel,
     ExtendDirection direction, bool extendFromSource, const expression_vector& properties,
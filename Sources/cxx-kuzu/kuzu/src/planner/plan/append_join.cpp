@@ -2,6 +2,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
 #include "planner/planner.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::common;
 using namespace kuzu::binder;
@@ -87,8 +88,9 @@ void Planner::appendMarkJoin(const std::vector<expression_pair>& joinConditions,
 }
 
 void Planner::appendIntersect(const std::shared_ptr<Expression>& intersectNodeID,
-    expression_vector& boundNodeIDs, LogicalPlan& probePlan, std::vector<LogicalPlan>& buildPlans) {
-    KU_ASSERT(boundNodeIDs.size() == buildPlans.size());
+    expression_vector& boundNodeIDs, const std::vector<std::shared_ptr<RelExpression>>& rels,
+    LogicalPlan& probePlan, std::vector<LogicalPlan>& buildPlans) {
+    KU_ASSERT(boundNodeIDs.size() == buildPlans.size() && rels.size() == buildPlans.size());
     std::vector<std::shared_ptr<LogicalOperator>> buildChildren;
     expression_vector keyNodeIDs;
     for (auto i = 0u; i < buildPlans.size(); ++i) {
@@ -115,7 +117,24 @@ void Planner::appendIntersect(const std::shared_ptr<Expression>& intersectNodeID
     }
     intersect->setCardinality(cardinalityEstimator.estimateIntersect(boundNodeIDs,
         probePlan.getLastOperatorRef(), buildOps));
-    probePlan.setCost(CostModel::computeIntersectCost(probePlan, buildPlans));
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    // The adjacency list lengths are only costed if every rel table has been analyzed, so that
+    // plans don't change without degree stats.
+    std::vector<double> buildDegrees;
+    for (auto i = 0u; i < rels.size(); ++i) {
+        auto& rel = *rels[i];
+        auto& boundNode = rel.getSrcNode()->getInternalID()->getUniqueName() ==
+                                  boundNodeIDs[i]->getUniqueName() ?
+                              *rel.getSrcNode() :
+                              *rel.getDstNode();
+        auto degree = cardinalityEstimator.getJoinedNodeDegree(rel, boundNode, transaction);
+        if (!degree.has_value()) {
+            buildDegrees.clear();
+            break;
+        }
+        buildDegrees.push_back(*degree);
+    }
+    probePlan.setCost(CostModel::computeIntersectCost(probePlan, buildPlans, buildDegrees));
     probePlan.setLastOperator(std::move(intersect));
 }
 
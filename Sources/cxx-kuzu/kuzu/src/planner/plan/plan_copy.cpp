@@ -80,6 +80,20 @@ LogicalPlan Planner::planCopyNodeFrom(const BoundCopyFromInfo* info) {
     default:
         KU_UNREACHABLE;
     }
+    if (info->extraInfo != nullptr) {
+        // Nodes are inserted in the order of the sorted keys, so node groups hold ranges of them.
+        auto& clusterKeys = info->extraInfo->constCast<ExtraBoundCopyNodeInfo>().clusterKeys;
+        auto expressionsToProject = plan.getSchema()->getExpressionsInScope();
+        for (auto& key : clusterKeys) {
+            if (!plan.getSchema()->isExpressionInScope(*key)) {
+                expressionsToProject.push_back(key);
+            }
+        }
+        if (expressionsToProject.size() > plan.getSchema()->getExpressionsInScope().size()) {
+            appendProjection(expressionsToProject, plan);
+        }
+        appendOrderBy(clusterKeys, std::vector<bool>(clusterKeys.size(), true /*isAsc*/), plan);
+    }
     appendCopyFrom(*info, plan);
     return plan;
 }
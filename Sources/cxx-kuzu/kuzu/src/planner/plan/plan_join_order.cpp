@@ -4,9 +4,11 @@
 #include "common/enums/join_type.h"
 #include "common/enums/rel_direction.h"
 #include "common/utils.h"
+#include "main/client_context.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -133,8 +135,32 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
     }
     planBaseTableScans(info);
     context.currentLevel++;
-    while (context.currentLevel < context.maxLevel) {
-        planLevel(context.currentLevel++);
+    auto clientConfig = clientContext->getClientConfig();
+    auto greedyThreshold = clientConfig->joinOrderGreedyThreshold;
+    auto planningBudget = clientConfig->joinOrderPlanningBudget;
+    auto firstGreedyLevel = context.maxLevel;
+    if (greedyThreshold != 0 && queryGraph.getNumQueryNodes() >= greedyThreshold) {
+        firstGreedyLevel = context.currentLevel;
+    } else {
+        while (context.currentLevel < context.maxLevel) {
+            // Once the budget is spent, the remaining levels are planned from the cheapest subgraph
+            // of the last complete level.
+            if (planningBudget != 0 && context.numPlans >= planningBudget) {
+                firstGreedyLevel = context.currentLevel;
+                break;
+            }
+            planLevel(context.currentLevel++);
+        }
+    }
+    if (firstGreedyLevel < context.maxLevel) {
+        planLevelsGreedily(firstGreedyLevel - 1);
+        if (!context.containPlans(context.getFullyMatchedSubqueryGraph())) {
+            // Greedy extensions may all be pruned, in which case we fall back to extending every
+            // subgraph by a single rel, whose effort is bounded by the subgraph caps of each level.
+            for (auto level = firstGreedyLevel; level < context.maxLevel; ++level) {
+                planLevelApproximately(level);
+            }
+        }
     }
 
     auto& plans = context.getPlans(context.getFullyMatchedSubqueryGraph());
@@ -289,7 +315,7 @@ void Planner::planRelScan(uint32_t relPos) {
     newSubgraph.addQueryRel(relPos);
     const auto predicates = getNewlyMatchedExprs(context.getEmptySubqueryGraph(), newSubgraph,
         context.getWhereExpressions());
-    for (const auto direction : rel->getExtendDirections()) {
+    for (const auto direction : getExtendDirections(*rel)) {
         auto plan = LogicalPlan();
         auto [boundNode, nbrNode] = getBoundAndNbrNodes(*rel, direction);
         const auto extendDirection = getExtendDirection(*rel, *boundNode);
@@ -418,7 +444,7 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         // stop if the rel pattern's supported rel directions don't contain the current direction
         const auto extendDirection = getExtendDirection(*rel, *boundNode);
         if (extendDirection != ExtendDirection::BOTH &&
-            !containsValue(rel->getExtendDirections(), extendDirection)) {
+            !containsValue(getExtendDirections(*rel), extendDirection)) {
             return;
         }
 
@@ -459,11 +485,12 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& relPlan : relPlans) {
             rightPlansCopy.push_back(relPlan.copy());
         }
-        appendIntersect(intersectNode->getInternalID(), boundNodeIDs, leftPlanCopy, rightPlansCopy);
+        appendIntersect(intersectNode->getInternalID(), boundNodeIDs, rels, leftPlanCopy,
+            rightPlansCopy);
         for (auto& predicate : predicates) {
             appendFilter(predicate, leftPlanCopy);
         }
-        context.subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        context.addPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -511,6 +538,82 @@ void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
     }
 }
 
+static bool isCheaper(const LogicalPlan& plan, const LogicalPlan& other) {
+    if (plan.getCost() != other.getCost()) {
+        return plan.getCost() < other.getCost();
+    }
+    return plan.getCardinality() < other.getCardinality();
+}
+
+static const LogicalPlan& getCheapestPlan(const std::vector<LogicalPlan>& plans) {
+    KU_ASSERT(!plans.empty());
+    auto bestIdx = 0u;
+    for (auto i = 1u; i < plans.size(); ++i) {
+        if (isCheaper(plans[i], plans[bestIdx])) {
+            bestIdx = i;
+        }
+    }
+    return plans[bestIdx];
+}
+
+// Greedy operator ordering: instead of keeping every subgraph of a level, only the cheapest one of
+// the largest subgraphs planned by the previous step is extended, by each of its neighbours and by
+// worst case optimal joins on each node it can intersect. So the number of planned joins grows
+// quadratically rather than exponentially with the size of the query graph.
+void Planner::planLevelsGreedily(uint32_t level) {
+    auto queryGraph = context.getQueryGraph();
+    auto subgraphs = context.subPlansTable->getSubqueryGraphs(level);
+    // Every step extends the subgraph by at least one rel, so there are at most maxLevel steps.
+    for (auto step = 0u; step < context.maxLevel && !subgraphs.empty(); ++step) {
+        auto bestIdx = 0u;
+        for (auto i = 1u; i < subgraphs.size(); ++i) {
+            auto& best = subgraphs[bestIdx];
+            auto numVariables = subgraphs[i].getTotalNumVariables();
+            if (numVariables > best.getTotalNumVariables() ||
+                (numVariables == best.getTotalNumVariables() &&
+                    isCheaper(getCheapestPlan(context.getPlans(subgraphs[i])),
+                        getCheapestPlan(context.getPlans(best))))) {
+                bestIdx = i;
+            }
+        }
+        auto subgraph = subgraphs[bestIdx];
+        std::vector<SubqueryGraph> newSubgraphs;
+        for (auto& nbrSubgraph : subgraph.getNbrSubgraphs(1)) {
+            if (!context.containPlans(nbrSubgraph)) {
+                continue;
+            }
+            auto joinNodePositions = subgraph.getConnectedNodePos(nbrSubgraph);
+            auto joinNodes = queryGraph->getQueryNodes(joinNodePositions);
+            if (needPruneImplicitJoins(nbrSubgraph, subgraph, joinNodes.size())) {
+                continue;
+            }
+            if (!tryPlanINLJoin(subgraph, nbrSubgraph, joinNodes)) {
+                planInnerHashJoin(subgraph, nbrSubgraph, joinNodes, true /* flipPlan */);
+            }
+            auto newSubgraph = subgraph;
+            newSubgraph.addSubqueryGraph(nbrSubgraph);
+            if (context.containPlans(newSubgraph)) {
+                newSubgraphs.push_back(std::move(newSubgraph));
+            }
+        }
+        for (auto& [intersectNodePos, rels] : populateIntersectRelCandidates(*queryGraph, subgraph)) {
+            if (rels.size() < 2) { // wcoj requires at least 2 rels
+                continue;
+            }
+            planWCOJoin(subgraph, rels, queryGraph->getQueryNode(intersectNodePos));
+            auto newSubgraph = subgraph;
+            for (auto& rel : rels) {
+                newSubgraph.addQueryRel(queryGraph->getQueryRelIdx(rel->getUniqueName()));
+            }
+            if (context.containPlans(newSubgraph)) {
+                newSubgraphs.push_back(std::move(newSubgraph));
+            }
+        }
+        subgraphs = std::move(newSubgraphs);
+    }
+    context.currentLevel = context.maxLevel;
+}
+
 bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
     if (joinNodes.size() > 1) {
@@ -535,7 +638,7 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
         boundNode->getUniqueName() == rel->getSrcNodeName() ? rel->getDstNode() : rel->getSrcNode();
     auto extendDirection = getExtendDirection(*rel, *boundNode);
     if (extendDirection != common::ExtendDirection::BOTH &&
-        !common::containsValue(rel->getExtendDirections(), extendDirection)) {
+        !common::containsValue(getExtendDirections(*rel), extendDirection)) {
         return false;
     }
     auto newSubgraph = subgraph;
@@ -572,6 +675,9 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, leftPlanProbeCopy, rightPlanBuildCopy,
                     leftPlanProbeCopy);
+                leftPlanProbeCopy.getLastOperator()->cast<LogicalHashJoin>().setBuildSubgraph(
+                    JoinOrderEnumeratorContext::getSubgraphKey(otherSubgraph),
+                    rightPlan.getCardinality());
                 appendFilters(predicates, leftPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
@@ -582,6 +688,8 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanProbeCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, rightPlanProbeCopy, leftPlanBuildCopy,
                     rightPlanProbeCopy);
+                rightPlanProbeCopy.getLastOperator()->cast<LogicalHashJoin>().setBuildSubgraph(
+                    JoinOrderEnumeratorContext::getSubgraphKey(subgraph), leftPlan.getCardinality());
                 appendFilters(predicates, rightPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
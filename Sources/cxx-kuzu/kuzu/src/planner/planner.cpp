@@ -56,7 +56,9 @@ void PropertyExprCollection::clear() {
 
 Planner::Planner(main::ClientContext* clientContext)
     : clientContext{clientContext}, cardinalityEstimator{clientContext}, context{},
-      plannerExtensions{clientContext->getDatabase()->getPlannerExtensions()} {}
+      plannerExtensions{clientContext->getDatabase()->getPlannerExtensions()} {
+    context.observedCardinalities = &clientContext->getObservedCardinalities();
+}
 
 LogicalPlan Planner::planStatement(const BoundStatement& statement) {
     switch (statement.getStatementType()) {
@@ -1,5 +1,7 @@
 #include "processor/expression_mapper.h"
 
+#include <algorithm>
+
 #include "binder/expression/case_expression.h"
 #include "binder/expression/expression_util.h"
 #include "binder/expression/lambda_expression.h"
@@ -7,16 +9,19 @@
 #include "binder/expression/node_expression.h"
 #include "binder/expression/parameter_expression.h"
 #include "binder/expression/rel_expression.h"
+#include "binder/expression/scalar_function_expression.h"
 #include "binder/expression_visitor.h" // IWYU pragma: keep (used in assert)
 #include "common/exception/not_implemented.h"
 #include "common/string_format.h"
 #include "expression_evaluator/case_evaluator.h"
 #include "expression_evaluator/function_evaluator.h"
+#include "expression_evaluator/fused_evaluator.h"
 #include "expression_evaluator/lambda_evaluator.h"
 #include "expression_evaluator/literal_evaluator.h"
 #include "expression_evaluator/path_evaluator.h"
 #include "expression_evaluator/pattern_evaluator.h"
 #include "expression_evaluator/reference_evaluator.h"
+#include "function/arithmetic/vector_arithmetic_functions.h"
 #include "planner/operator/schema.h"
 
 using namespace kuzu::binder;
@@ -69,6 +74,9 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getEvaluator(
     } else if (expressionType == ExpressionType::CASE_ELSE) {
         return getCaseEvaluator(std::move(expression));
     } else if (canEvaluateAsFunction(expressionType)) {
+        if (auto fusedEvaluator = getFusedEvaluator(expression)) {
+            return fusedEvaluator;
+        }
         return getFunctionEvaluator(std::move(expression));
     } else if (parentEvaluator != nullptr) {
         return getLambdaParamEvaluator(std::move(expression));
@@ -161,6 +169,82 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFunctionEvaluator(
         std::move(childrenEvaluators));
 }
 
+static std::optional<FusedOperator> getFusedOperator(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::EQUALS:
+        return FusedOperator::EQUALS;
+    case ExpressionType::NOT_EQUALS:
+        return FusedOperator::NOT_EQUALS;
+    case ExpressionType::GREATER_THAN:
+        return FusedOperator::GREATER_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return FusedOperator::GREATER_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return FusedOperator::LESS_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return FusedOperator::LESS_THAN_EQUALS;
+    case ExpressionType::FUNCTION: {
+        auto& name = expression.constCast<ScalarFunctionExpression>().getFunction().name;
+        if (name == function::AddFunction::name) {
+            return FusedOperator::ADD;
+        } else if (name == function::SubtractFunction::name) {
+            return FusedOperator::SUBTRACT;
+        } else if (name == function::MultiplyFunction::name) {
+            return FusedOperator::MULTIPLY;
+        }
+        return std::nullopt;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+static std::optional<Value> getConstantValue(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+        return expression.constCast<LiteralExpression>().getValue();
+    case ExpressionType::PARAMETER:
+        return expression.constCast<ParameterExpression>().getValue();
+    default:
+        return std::nullopt;
+    }
+}
+
+std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFusedEvaluator(
+    std::shared_ptr<Expression> expression) const {
+    KU_ASSERT(schema != nullptr);
+    std::vector<FusedStep> steps;
+    auto current = expression;
+    // Walk down from the root to the only non-constant input, collecting one step per operation.
+    while (!schema->isExpressionInScope(*current)) {
+        auto op = getFusedOperator(*current);
+        if (!op.has_value() || current->getNumChildren() != 2) {
+            return nullptr;
+        }
+        auto isConstantLeft = getConstantValue(*current->getChild(0)).has_value();
+        auto constant = getConstantValue(*current->getChild(isConstantLeft ? 0 : 1));
+        auto operand = current->getChild(isConstantLeft ? 1 : 0);
+        if (!constant.has_value() || constant->isNull() ||
+            constant->getDataType() != operand->dataType ||
+            !FusedExpressionEvaluator::isSupportedType(operand->dataType)) {
+            return nullptr;
+        }
+        FusedStep step{*op, std::move(*constant), isConstantLeft};
+        // Only the root may be a comparison since the other steps must keep the input type.
+        if (step.isComparison() ? !steps.empty() : current->dataType != operand->dataType) {
+            return nullptr;
+        }
+        steps.push_back(std::move(step));
+        current = operand;
+    }
+    if (steps.empty()) {
+        return nullptr;
+    }
+    std::reverse(steps.begin(), steps.end());
+    return std::make_unique<FusedExpressionEvaluator>(std::move(expression),
+        getReferenceEvaluator(current), std::move(steps));
+}
+
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getNodeEvaluator(
     std::shared_ptr<Expression> expression) {
     auto node = expression->constPtrCast<NodeExpression>();
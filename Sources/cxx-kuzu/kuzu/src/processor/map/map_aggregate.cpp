@@ -1,6 +1,8 @@
 #include "binder/expression/aggregate_function_expression.h"
 #include "common/copy_constructors.h"
 #include "common/types/types.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
 #include "planner/operator/logical_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
@@ -8,6 +10,8 @@
 #include "processor/operator/aggregate/simple_aggregate_scan.h"
 #include "processor/plan_mapper.h"
 #include "processor/result/result_set_descriptor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -200,6 +204,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expressi
     auto sharedState =
         std::make_shared<HashAggregateSharedState>(clientContext, std::move(aggregateInfo),
             aggFunctions, aggregateInputInfos, std::move(keyTypes), std::move(payloadTypes));
+    if (clientContext->getDBConfig()->enableSpillingToDisk) {
+        auto bufferManager = storage::MemoryManager::Get(*clientContext)->getBufferManager();
+        bufferManager->getSpillerOrSkip([&](storage::Spiller& spiller) {
+            sharedState->enableSpilling(spiller, bufferManager->getMemoryLimit() / 2);
+        });
+    }
     auto printInfo = std::make_unique<HashAggregatePrintInfo>(allKeys, aggregates);
     auto aggregate = make_unique<HashAggregate>(sharedState, std::move(aggFunctions),
         std::move(aggregateInputInfos), std::move(prevOperator), getOperatorID(),
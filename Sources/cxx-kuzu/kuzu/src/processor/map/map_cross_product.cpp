@@ -1,8 +1,10 @@
+#include "binder/expression/expression_util.h"
 #include "common/system_config.h"
 #include "planner/operator/logical_cross_product.h"
 #include "processor/operator/cross_product.h"
 #include "processor/plan_mapper.h"
 
+using namespace kuzu::binder;
 using namespace kuzu::common;
 using namespace kuzu::planner;
 
@@ -32,10 +34,22 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapCrossProduct(
         outVecPos.emplace_back(outSchema->getExpressionPos(*expression));
         colIndicesToScan.push_back(i);
     }
-    auto info = CrossProductInfo(std::move(outVecPos), std::move(colIndicesToScan));
     auto table = resultCollector->getResultFTable();
+    auto probeKeyPos = DataPos::getInvalidPos();
+    std::shared_ptr<CrossProductSortedBuild> sortedBuild;
+    if (const auto& inequality = logicalCrossProduct.getInequality(); inequality.has_value()) {
+        auto buildKeyColIdx = ExpressionUtil::find(inequality->buildKey.get(), expressions);
+        KU_ASSERT(buildKeyColIdx != INVALID_IDX);
+        if (table->getTableSchema()->getColumn(buildKeyColIdx)->isFlat()) {
+            probeKeyPos = DataPos(outSchema->getExpressionPos(*inequality->probeKey));
+            sortedBuild = std::make_shared<CrossProductSortedBuild>(buildKeyColIdx,
+                inequality->buildKey->getDataType().getPhysicalType(),
+                inequality->comparisonType);
+        }
+    }
+    auto info = CrossProductInfo(std::move(outVecPos), std::move(colIndicesToScan), probeKeyPos);
     auto maxMorselSize = table->hasUnflatCol() ? 1 : DEFAULT_VECTOR_CAPACITY;
-    auto localState = CrossProductLocalState(table, maxMorselSize);
+    auto localState = CrossProductLocalState(table, maxMorselSize, std::move(sortedBuild));
     auto printInfo = std::make_unique<OPPrintInfo>();
     auto crossProduct = std::make_unique<CrossProduct>(std::move(info), std::move(localState),
         std::move(probeSidePrevOperator), getOperatorID(), std::move(printInfo));
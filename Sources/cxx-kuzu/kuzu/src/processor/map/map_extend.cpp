@@ -2,10 +2,12 @@
 #include "binder/expression/property_expression.h"
 #include "binder/expression_binder.h"
 #include "common/enums/extend_direction_util.h"
+#include "common/utils.h"
 #include "main/client_context.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "processor/operator/scan/scan_multi_rel_tables.h"
 #include "processor/operator/scan/scan_rel_table.h"
+#include "processor/operator/scan/scan_rel_table_reverse.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
 
@@ -148,6 +150,14 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapExtend(const LogicalOperator* l
         auto relDataDirection = ExtendDirectionUtil::getRelDataDirection(extendDirection);
         auto entryInfo = entry->getSingleRelEntryInfo();
         auto relTable = storageManager->getTable(entryInfo.oid)->ptrCast<RelTable>();
+        if (!containsValue(relTable->getStorageDirections(), relDataDirection)) {
+            // The planner only extends a rel table in a direction it does not store through its
+            // reverse index.
+            KU_ASSERT(relDataDirection == RelDataDirection::BWD);
+            return std::make_unique<ScanRelTableReverse>(std::move(scanInfo), relTable,
+                std::make_shared<ScanRelTableReverseSharedState>(), std::move(prevOperator),
+                getOperatorID(), printInfo->copy());
+        }
         auto scanRelInfo =
             getRelTableScanInfo(*entry, relDataDirection, relTable, extend->shouldScanNbrID(),
                 extend->getProperties(), extend->getPropertyPredicates(), clientContext);
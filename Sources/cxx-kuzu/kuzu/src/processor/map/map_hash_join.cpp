@@ -1,8 +1,13 @@
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
 #include "planner/operator/logical_hash_join.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "processor/result/factorized_table_util.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
@@ -59,6 +64,50 @@ HashJoinBuildInfo PlanMapper::createHashBuildInfo(const Schema& buildSideSchema,
         std::move(tableSchema));
 }
 
+ScanNodeTable* PlanMapper::getRuntimeFilterScan(PhysicalOperator* op) {
+    while (true) {
+        switch (op->getOperatorType()) {
+        case PhysicalOperatorType::FILTER:
+        case PhysicalOperatorType::FLATTEN:
+        case PhysicalOperatorType::PROJECTION:
+        case PhysicalOperatorType::HASH_JOIN_PROBE: {
+            op = op->getChild(0);
+        } break;
+        case PhysicalOperatorType::SCAN_NODE_TABLE: {
+            return op->ptrCast<ScanNodeTable>();
+        }
+        default:
+            return nullptr;
+        }
+    }
+}
+
+static void mapRuntimeFilter(const LogicalHashJoin& hashJoin, HashJoinSharedState& sharedState,
+    PhysicalOperator* probeSidePrevOperator, main::ClientContext* clientContext) {
+    auto joinConditions = hashJoin.getJoinConditions();
+    if (!clientContext->getClientConfig()->enableSemiMask ||
+        hashJoin.getJoinType() != JoinType::INNER || joinConditions.size() != 1 ||
+        hashJoin.getSIPInfo().direction == SIPDirection::PROBE_TO_BUILD) {
+        return;
+    }
+    auto& [probeKey, buildKey] = joinConditions[0];
+    if (probeKey->expressionType != ExpressionType::PROPERTY ||
+        probeKey->getDataType() != buildKey->getDataType() ||
+        !storage::RuntimeFilter::isSupported(probeKey->getDataType())) {
+        return;
+    }
+    auto keyPos = DataPos(hashJoin.getSchema()->getExpressionPos(*probeKey));
+    auto scan = PlanMapper::getRuntimeFilterScan(probeSidePrevOperator);
+    if (scan == nullptr) {
+        return;
+    }
+    auto filter =
+        std::make_shared<storage::JoinKeyFilter>(probeKey->getDataType().getPhysicalType());
+    if (scan->addRuntimeFilter(keyPos, probeKey->toString(), filter)) {
+        sharedState.setRuntimeFilter(std::move(filter));
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator* logicalOperator) {
     auto hashJoin = logicalOperator->constPtrCast<LogicalHashJoin>();
     auto outSchema = hashJoin->getSchema();
@@ -84,10 +133,22 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
+    buildInfo.subgraphKey = hashJoin->getBuildSubgraphKey();
+    buildInfo.estimatedNumTuples = hashJoin->getEstimatedBuildCardinality();
     auto globalHashTable =
         std::make_unique<JoinHashTable>(*storage::MemoryManager::Get(*clientContext),
             LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    if (clientContext->getDBConfig()->enableSpillingToDisk) {
+        auto memoryManager = storage::MemoryManager::Get(*clientContext);
+        auto bufferManager = memoryManager->getBufferManager();
+        // Leave the other half of the buffer pool to the rest of the query.
+        bufferManager->getSpillerOrSkip([&](storage::Spiller& spiller) {
+            sharedState->enableSpilling(*memoryManager, spiller,
+                bufferManager->getMemoryLimit() / 2, LogicalType::copy(buildKeyTypes));
+        });
+    }
+    mapRuntimeFilter(*hashJoin, *sharedState, probeSidePrevOperator.get(), clientContext);
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild = std::make_unique<HashJoinBuild>(PhysicalOperatorType::HASH_JOIN_BUILD,
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
@@ -110,6 +171,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    if (sharedState->isSpillingEnabled()) {
+        auto probeSchema = hashJoin->getChild(0)->getSchema();
+        auto probeSideExpressions = probeSchema->getExpressionsInScope();
+        for (auto& expression : probeSideExpressions) {
+            probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+        }
+        probeDataInfo.probeSideTableSchema =
+            FactorizedTableUtils::createFTableSchema(probeSideExpressions, *probeSchema);
+    }
     auto probePrintInfo = std::make_unique<HashJoinProbePrintInfo>(probeKeys);
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
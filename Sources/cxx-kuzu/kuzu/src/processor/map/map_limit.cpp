@@ -40,8 +40,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLimit(const LogicalOperator* lo
         auto limitNum = ExpressionUtil::evaluateAsSkipLimit(*limitExpr);
         auto printInfo = std::make_unique<LimitPrintInfo>(limitNum);
         lastOperator = make_unique<Limit>(limitNum, std::make_shared<std::atomic_uint64_t>(0),
-            dataChunkToSelectPos, groupsPotToLimit, std::move(lastOperator), getOperatorID(),
-            printInfo->copy());
+            std::make_shared<std::atomic_bool>(false), dataChunkToSelectPos, groupsPotToLimit,
+            std::move(lastOperator), getOperatorID(), printInfo->copy());
     }
     return lastOperator;
 }
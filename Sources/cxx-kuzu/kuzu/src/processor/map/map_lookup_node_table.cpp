@@ -0,0 +1,51 @@
+#include "binder/expression/property_expression.h"
+#include "planner/operator/scan/logical_lookup_node_table.h"
+#include "processor/operator/scan/lookup_node_table.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapLookupNodeTable(
+    const LogicalOperator* logicalOperator) {
+    auto& lookup = logicalOperator->constCast<LogicalLookupNodeTable>();
+    auto catalog = catalog::Catalog::Get(*clientContext);
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    const auto outSchema = lookup.getSchema();
+    auto prevOperator = mapOperator(lookup.getChild(0).get());
+    std::vector<DataPos> outVectorsPos;
+    for (auto& expression : lookup.getProperties()) {
+        outVectorsPos.emplace_back(getDataPos(*expression, *outSchema));
+    }
+    auto scanInfo = ScanOpInfo(getDataPos(*lookup.getNodeID(), *outSchema), outVectorsPos);
+    // Lookups are only planned over a single table, whose columns have the types of the properties.
+    KU_ASSERT(lookup.getTableIDs().size() == 1);
+    const auto tableID = lookup.getTableIDs()[0];
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+    auto table = storage::StorageManager::Get(*clientContext)->getTable(tableID);
+    auto tableInfo = ScanNodeTableInfo(table, {} /* columnPredicates */);
+    for (auto& expression : lookup.getProperties()) {
+        auto& property = expression->constCast<PropertyExpression>();
+        if (property.hasProperty(tableID)) {
+            auto propertyName = property.getPropertyName();
+            auto& columnType = tableEntry->getProperty(propertyName).getType();
+            tableInfo.addColumnInfo(tableEntry->getColumnID(propertyName),
+                ColumnCaster(columnType.copy()));
+        } else {
+            tableInfo.addColumnInfo(INVALID_COLUMN_ID, ColumnCaster(LogicalType::ANY()));
+        }
+    }
+    auto alias = lookup.getNodeID()->constCast<PropertyExpression>().getRawVariableName();
+    auto printInfo = std::make_unique<ScanNodeTablePrintInfo>(
+        std::vector<std::string>{tableEntry->getName()}, alias, lookup.getProperties());
+    return std::make_unique<LookupNodeTable>(std::move(scanInfo), std::move(tableInfo),
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
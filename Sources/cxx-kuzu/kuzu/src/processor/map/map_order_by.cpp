@@ -1,13 +1,18 @@
 #include "binder/expression/expression_util.h"
 #include "common/exception/message.h"
 #include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
 #include "planner/operator/logical_order_by.h"
 #include "processor/operator/order_by/order_by.h"
 #include "processor/operator/order_by/order_by_merge.h"
 #include "processor/operator/order_by/order_by_scan.h"
 #include "processor/operator/order_by/top_k.h"
 #include "processor/operator/order_by/top_k_scanner.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -16,6 +21,30 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+// Pushes the threshold of the first key down to the scan producing it, possibly below joins on its
+// probe side, so that chunks and tuples which cannot make it into the top k are skipped there.
+static void mapTopKFilter(const LogicalOrderBy& orderBy, TopKSharedState& sharedState,
+    PhysicalOperator* prevOperator, main::ClientContext* clientContext) {
+    if (!clientContext->getClientConfig()->enableSemiMask) {
+        return;
+    }
+    auto key = orderBy.getExpressionsToOrderBy()[0];
+    if (key->expressionType != ExpressionType::PROPERTY ||
+        !storage::RuntimeFilter::isSupported(key->getDataType())) {
+        return;
+    }
+    auto scan = PlanMapper::getRuntimeFilterScan(prevOperator);
+    if (scan == nullptr) {
+        return;
+    }
+    auto keyPos = DataPos(orderBy.getChild(0)->getSchema()->getExpressionPos(*key));
+    auto filter = std::make_shared<storage::TopKFilter>(key->getDataType().getPhysicalType(),
+        orderBy.getIsAscOrders()[0]);
+    if (scan->addRuntimeFilter(keyPos, key->toString(), filter)) {
+        sharedState.setFilter(std::move(filter));
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator* logicalOperator) {
     auto& logicalOrderBy = logicalOperator->constCast<LogicalOrderBy>();
     auto outSchema = logicalOrderBy.getSchema();
@@ -78,6 +107,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
             skipNum = ExpressionUtil::evaluateAsSkipLimit(*skipExpr);
         }
         auto topKSharedState = std::make_shared<TopKSharedState>();
+        mapTopKFilter(logicalOrderBy, *topKSharedState, prevOperator.get(), clientContext);
         auto printInfo =
             std::make_unique<TopKPrintInfo>(keyExpressions, payloadExpressions, skipNum, limitNum);
         auto topK = make_unique<TopK>(std::move(orderByDataInfo), topKSharedState, skipNum,
@@ -89,6 +119,14 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
         return scan;
     }
     auto orderBySharedState = std::make_shared<SortSharedState>();
+    if (clientContext->getDBConfig()->enableSpillingToDisk) {
+        auto memoryManager = storage::MemoryManager::Get(*clientContext);
+        auto bufferManager = memoryManager->getBufferManager();
+        bufferManager->getSpillerOrSkip([&](storage::Spiller& spiller) {
+            orderBySharedState->enableSpilling(spiller, *memoryManager,
+                bufferManager->getMemoryLimit() / 2);
+        });
+    }
     auto printInfo = std::make_unique<OrderByPrintInfo>(keyExpressions, payloadExpressions);
     auto orderBy = make_unique<OrderBy>(std::move(orderByDataInfo), orderBySharedState,
         std::move(prevOperator), getOperatorID(), printInfo->copy());
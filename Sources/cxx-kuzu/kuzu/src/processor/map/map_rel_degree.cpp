@@ -0,0 +1,40 @@
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/enums/extend_direction_util.h"
+#include "planner/operator/extend/logical_rel_degree.h"
+#include "processor/operator/scan/rel_degree.h"
+#include "processor/operator/scan/scan_rel_table.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapRelDegree(const LogicalOperator* logicalOperator) {
+    auto& relDegree = logicalOperator->constCast<LogicalRelDegree>();
+    auto outSchema = relDegree.getSchema();
+    auto boundNode = relDegree.getBoundNode();
+    auto rel = relDegree.getRel();
+    auto prevOperator = mapOperator(relDegree.getChild(0).get());
+    KU_ASSERT(rel->getNumEntries() == 1);
+    auto entry = rel->getEntry(0)->ptrCast<RelGroupCatalogEntry>();
+    auto relTable = StorageManager::Get(*clientContext)
+                        ->getTable(entry->getSingleRelEntryInfo().oid)
+                        ->ptrCast<RelTable>();
+    auto info = RelDegreeInfo(relTable,
+        ExtendDirectionUtil::getRelDataDirection(relDegree.getDirection()),
+        getDataPos(*boundNode->getInternalID(), *outSchema),
+        getDataPos(*relDegree.getDegree(), *outSchema));
+    auto printInfo = std::make_unique<ScanRelTablePrintInfo>(
+        std::vector<std::string>{entry->getName()}, binder::expression_vector{}, boundNode, rel,
+        relDegree.getNbrNode(), relDegree.getDirection(), rel->getVariableName());
+    return std::make_unique<RelDegree>(std::move(info), std::move(prevOperator), getOperatorID(),
+        std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
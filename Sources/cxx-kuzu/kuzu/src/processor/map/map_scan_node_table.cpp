@@ -6,7 +6,9 @@
 #include "processor/expression_mapper.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
+#include "processor/operator/scan/sorted_index_scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/index/sorted_index.h"
 #include "storage/storage_manager.h"
 
 using namespace kuzu::binder;
@@ -72,8 +74,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         auto printInfo =
             std::make_unique<ScanNodeTablePrintInfo>(tableNames, alias, scan.getProperties());
         auto progressSharedState = std::make_shared<ScanNodeTableProgressSharedState>();
-        return std::make_unique<ScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
-            std::move(sharedStates), getOperatorID(), std::move(printInfo), progressSharedState);
+        auto scanNodeTable = std::make_unique<ScanNodeTable>(std::move(scanInfo),
+            std::move(tableInfos), std::move(sharedStates), getOperatorID(), std::move(printInfo),
+            progressSharedState);
+        scanNodeTable->setPrefetchPages(scan.getPrefetchPages());
+        return scanNodeTable;
     }
     case LogicalScanNodeTableType::PRIMARY_KEY_SCAN: {
         auto& primaryKeyScanInfo = scan.getExtraInfo()->constCast<PrimaryKeyScanInfo>();
@@ -85,6 +90,32 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
     }
+    case LogicalScanNodeTableType::SORTED_INDEX_SCAN: {
+        auto& sortedIndexScanInfo = scan.getExtraInfo()->constCast<SortedIndexScanInfo>();
+        KU_ASSERT(tableInfos.size() == 1);
+        auto& table = tableInfos[0].table->cast<storage::NodeTable>();
+        auto index = table.getIndex(sortedIndexScanInfo.indexName);
+        KU_ASSERT(index.has_value());
+        auto exprMapper = ExpressionMapper(outSchema);
+        std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator, upperBoundEvaluator;
+        std::string bounds = "[";
+        if (sortedIndexScanInfo.lowerBound != nullptr) {
+            lowerBoundEvaluator = exprMapper.getEvaluator(sortedIndexScanInfo.lowerBound);
+            bounds += sortedIndexScanInfo.lowerBound->toString();
+        }
+        bounds += ", ";
+        if (sortedIndexScanInfo.upperBound != nullptr) {
+            upperBoundEvaluator = exprMapper.getEvaluator(sortedIndexScanInfo.upperBound);
+            bounds += sortedIndexScanInfo.upperBound->toString();
+        }
+        bounds += "]";
+        auto printInfo = std::make_unique<SortedIndexScanPrintInfo>(tableNames[0], alias,
+            sortedIndexScanInfo.indexName, std::move(bounds), scan.getProperties());
+        return std::make_unique<SortedIndexScanNodeTable>(std::move(scanInfo),
+            std::move(tableInfos[0]), &index.value()->cast<storage::SortedIndex>(),
+            std::move(lowerBoundEvaluator), std::move(upperBoundEvaluator), getOperatorID(),
+            std::move(printInfo));
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -0,0 +1,42 @@
+#include "common/system_config.h"
+#include "planner/operator/scan/logical_shared_scan.h"
+#include "processor/operator/result_collector.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::binder;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapSharedScan(
+    const LogicalOperator* logicalOperator) {
+    auto& sharedScan = logicalOperator->constCast<LogicalSharedScan>();
+    auto accumulate = sharedScan.getAccumulate();
+    auto materializedExpressions = accumulate->getPayloads();
+    if (!sharedTables.contains(accumulate)) {
+        auto child = accumulate->getChild(0);
+        auto prevOperator = mapOperator(child.get());
+        auto resultCollector = createResultCollector(accumulate->getAccumulateType(),
+            materializedExpressions, child->getSchema(), std::move(prevOperator));
+        sharedTables.insert({accumulate, resultCollector->getResultFTable()});
+        sharedTableCollectors.push_back(std::move(resultCollector));
+    }
+    expression_map<ft_col_idx_t> materializedExpressionToColIdx;
+    for (auto i = 0u; i < materializedExpressions.size(); ++i) {
+        materializedExpressionToColIdx.insert({materializedExpressions[i], i});
+    }
+    std::vector<ft_col_idx_t> colIndicesToScan;
+    for (auto& expression : sharedScan.getMaterializedExpressions()) {
+        KU_ASSERT(materializedExpressionToColIdx.contains(expression));
+        colIndicesToScan.push_back(materializedExpressionToColIdx.at(expression));
+    }
+    auto table = sharedTables.at(accumulate);
+    KU_ASSERT(!table->hasUnflatCol());
+    return createFTableScan(sharedScan.getExpressions(), colIndicesToScan,
+        sharedScan.getSchema(), table, DEFAULT_VECTOR_CAPACITY /* maxMorselSize */);
+}
+
+} // namespace processor
+} // namespace kuzu
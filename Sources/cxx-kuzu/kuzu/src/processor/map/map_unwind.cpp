@@ -14,7 +14,6 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapUnwind(const LogicalOperator* l
     auto& unwind = logicalOperator->constCast<LogicalUnwind>();
     auto outSchema = unwind.getSchema();
     auto inSchema = unwind.getChild(0)->getSchema();
-    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto dataPos = DataPos(outSchema->getExpressionPos(*unwind.getOutExpr()));
     auto exprMapper = ExpressionMapper(inSchema);
     auto evaluator = exprMapper.getEvaluator(unwind.getInExpr());
@@ -23,6 +22,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapUnwind(const LogicalOperator* l
         idPos = getDataPos(*unwind.getIDExpr(), *outSchema);
     }
     auto printInfo = std::make_unique<UnwindPrintInfo>(unwind.getInExpr(), unwind.getOutExpr());
+    // Without input tuples, the list is split into morsels scanned by all threads.
+    if (unwind.getChild(0)->getOperatorType() == LogicalOperatorType::DUMMY_SCAN) {
+        return std::make_unique<Unwind>(dataPos, idPos, std::move(evaluator),
+            std::make_shared<UnwindSharedState>(), getOperatorID(), std::move(printInfo));
+    }
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     return std::make_unique<Unwind>(dataPos, idPos, std::move(evaluator), std::move(prevOperator),
         getOperatorID(), std::move(printInfo));
 }
@@ -34,6 +34,10 @@ std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* log
                 logicalPlan->getSchema(), std::move(root));
         }
     }
+    for (auto& collector : sharedTableCollectors) {
+        root->addChild(std::move(collector));
+    }
+    sharedTableCollectors.clear();
     auto physicalPlan = std::make_unique<PhysicalPlan>(std::move(root));
     if (logicalPlan->isProfile()) {
         physicalPlan->lastOperator->ptrCast<Profile>()->setPhysicalPlan(physicalPlan.get());
@@ -137,6 +141,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     case LogicalOperatorType::LIMIT: {
         physicalOperator = mapLimit(logicalOperator);
     } break;
+    case LogicalOperatorType::LOOKUP_NODE_TABLE: {
+        physicalOperator = mapLookupNodeTable(logicalOperator);
+    } break;
     case LogicalOperatorType::MERGE: {
         physicalOperator = mapMerge(logicalOperator);
     } break;
@@ -164,6 +171,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     case LogicalOperatorType::RECURSIVE_EXTEND: {
         physicalOperator = mapRecursiveExtend(logicalOperator);
     } break;
+    case LogicalOperatorType::REL_DEGREE: {
+        physicalOperator = mapRelDegree(logicalOperator);
+    } break;
     case LogicalOperatorType::SCAN_NODE_TABLE: {
         physicalOperator = mapScanNodeTable(logicalOperator);
     } break;
@@ -173,6 +183,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     case LogicalOperatorType::SET_PROPERTY: {
         physicalOperator = mapSetProperty(logicalOperator);
     } break;
+    case LogicalOperatorType::SHARED_SCAN: {
+        physicalOperator = mapSharedScan(logicalOperator);
+    } break;
     case LogicalOperatorType::STANDALONE_CALL: {
         physicalOperator = mapStandaloneCall(logicalOperator);
     } break;
@@ -200,6 +213,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     if (!logicalOpToPhysicalOpMap.contains(logicalOperator)) {
         logicalOpToPhysicalOpMap.insert({logicalOperator, physicalOperator.get()});
     }
+    if (physicalOperator != nullptr && !physicalOperator->getEstimatedCardinality().has_value()) {
+        physicalOperator->setEstimatedCardinality(logicalOperator->getCardinality());
+    }
     return physicalOperator;
 }
 
@@ -12,6 +12,7 @@
 #include "common/types/types.h"
 #include "common/utils.h"
 #include "common/vector/value_vector.h"
+#include "function/aggregate/count.h"
 #include "processor/operator/aggregate/aggregate_input.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/factorized_table_schema.h"
@@ -213,6 +214,7 @@ void AggregateHashTable::initializeHashTable(uint64_t numEntriesToAllocate) {
 
 void AggregateHashTable::initializeTmpVectors() {
     hashSlotsToUpdateAggState = std::make_unique<HashSlot*[]>(DEFAULT_VECTOR_CAPACITY);
+    entriesToUpdateAggState = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
     tmpValueIdxes = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
     entryIdxesToInitialize = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
     mayMatchIdxes = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
@@ -502,6 +504,11 @@ void AggregateHashTable::increaseHashSlotIdxes(uint64_t numNoMatches) {
 
 void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& keyVectors,
     const std::vector<ValueVector*>& dependentKeyVectors, const DataChunkState* leadingState) {
+    if (directLookupEnabled) {
+        if (findEntriesByOffsets(keyVectors, dependentKeyVectors)) {
+            return;
+        }
+    }
     initTmpHashSlotsAndIdxes();
     auto numEntriesToFindHashSlots = leadingState->getSelSize();
     KU_ASSERT(getNumEntries() + numEntriesToFindHashSlots < maxNumHashSlots);
@@ -529,6 +536,92 @@ void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& keyVecto
         numEntriesToFindHashSlots = numNoMatches;
         memcpy(tmpValueIdxes.get(), noMatchIdxes.get(), numNoMatches * sizeof(uint64_t));
     }
+    if (directLookupEnabled) {
+        registerEntriesByOffsets(*keyVectors[0]);
+    }
+}
+
+void AggregateHashTable::enableDirectLookup() {
+    if (keyTypes.size() != 1 || keyTypes[0].getLogicalTypeID() != LogicalTypeID::INTERNAL_ID) {
+        return;
+    }
+    directLookupEnabled = true;
+    directLookupSlots = std::make_unique<HashSlot[]>(DEFAULT_VECTOR_CAPACITY);
+}
+
+bool AggregateHashTable::findEntriesByOffsets(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& dependentKeyVectors) {
+    auto& keyVector = *keyVectors[0];
+    auto& selVector = hashVector->state->getSelVector();
+    offset_t maxOffset = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        if (keyVector.isNull(pos)) {
+            return false;
+        }
+        auto nodeID = keyVector.getValue<internalID_t>(pos);
+        if (directLookupTableID == INVALID_TABLE_ID) {
+            directLookupTableID = nodeID.tableID;
+        }
+        if (!canLookupByOffset(nodeID)) {
+            return false;
+        }
+        maxOffset = std::max(maxOffset, nodeID.offset);
+    }
+    if (numDirectLookupOffsets <= maxOffset) {
+        reserveDirectLookupOffsets(std::min<offset_t>(MAX_NUM_DIRECT_LOOKUP_OFFSETS,
+            std::max<offset_t>(maxOffset + 1, 2 * numDirectLookupOffsets)));
+    }
+    uint64_t numFTEntriesToInitialize = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        auto offset = keyVector.getValue<internalID_t>(pos).offset;
+        auto hash = hashVector->getValue<hash_t>(pos);
+        auto& entry = getEntryOfOffset(offset);
+        if (entry == nullptr) {
+            entry = factorizedTable->appendEmptyTuple();
+            fillHashSlot(hash, entry);
+            directLookupOffsets.push_back(offset);
+            entryIdxesToInitialize[numFTEntriesToInitialize++] = pos;
+        }
+        directLookupSlots[pos] = HashSlot(hash, entry);
+        hashSlotsToUpdateAggState[pos] = &directLookupSlots[pos];
+    }
+    initializeFTEntries(keyVectors, dependentKeyVectors, numFTEntriesToInitialize);
+    return true;
+}
+
+void AggregateHashTable::registerEntriesByOffsets(const ValueVector& keyVector) {
+    hashVector->state->getSelVector().forEach([&](auto pos) {
+        if (keyVector.isNull(pos)) {
+            return;
+        }
+        auto nodeID = keyVector.getValue<internalID_t>(pos);
+        if (!canLookupByOffset(nodeID)) {
+            return;
+        }
+        if (numDirectLookupOffsets <= nodeID.offset) {
+            reserveDirectLookupOffsets(std::min<offset_t>(MAX_NUM_DIRECT_LOOKUP_OFFSETS,
+                std::max<offset_t>(nodeID.offset + 1, 2 * numDirectLookupOffsets)));
+        }
+        auto& entry = getEntryOfOffset(nodeID.offset);
+        if (entry == nullptr) {
+            entry = hashSlotsToUpdateAggState[pos]->getEntry();
+            directLookupOffsets.push_back(nodeID.offset);
+        }
+    });
+}
+
+void AggregateHashTable::reserveDirectLookupOffsets(offset_t numOffsets) {
+    KU_ASSERT(numOffsets > numDirectLookupOffsets);
+    auto buffer = memoryManager->allocateBuffer(true /* initializeToZero */,
+        numOffsets * sizeof(uint8_t*));
+    if (offsetToEntry) {
+        memcpy(buffer->getData(), offsetToEntry->getData(),
+            numDirectLookupOffsets * sizeof(uint8_t*));
+    }
+    offsetToEntry = std::move(buffer);
+    numDirectLookupOffsets = numOffsets;
 }
 
 void AggregateHashTable::findHashSlots(const FactorizedTable& srcTable, uint64_t startOffset,
@@ -601,6 +694,11 @@ void AggregateHashTable::updateAggState(const std::vector<ValueVector*>& keyVect
 void AggregateHashTable::updateAggStates(const std::vector<ValueVector*>& keyVectors,
     const std::vector<AggregateInput>& aggregateInputs, uint64_t resultSetMultiplicity,
     const DataChunkState* leadingState) {
+    if (!leadingState->isFlat()) {
+        leadingState->getSelVector().forEach([&](auto pos) {
+            entriesToUpdateAggState[pos] = hashSlotsToUpdateAggState[pos]->getEntry();
+        });
+    }
     auto aggregateStateOffset = aggStateColOffsetInFT;
     for (auto i = 0u; i < aggregateFunctions.size(); i++) {
         if (!aggregateFunctions[i].isDistinct) {
@@ -628,7 +726,8 @@ void AggregateHashTable::fillEntryWithInitialNullAggregateState(FactorizedTable&
     }
 }
 
-void AggregateHashTable::fillHashSlot(hash_t hash, uint8_t* groupByKeysAndAggregateStateBuffer) {
+HashSlot* AggregateHashTable::fillHashSlot(hash_t hash,
+    uint8_t* groupByKeysAndAggregateStateBuffer) {
     auto slotIdx = getSlotIdxForHash(hash);
     auto hashSlot = getHashSlot(slotIdx);
     while (true) {
@@ -640,6 +739,7 @@ void AggregateHashTable::fillHashSlot(hash_t hash, uint8_t* groupByKeysAndAggreg
         break;
     }
     *hashSlot = HashSlot(hash, groupByKeysAndAggregateStateBuffer);
+    return hashSlot;
 }
 
 void AggregateHashTable::addDataBlocksIfNecessary(uint64_t maxNumHashSlots) {
@@ -713,6 +813,11 @@ void AggregateHashTable::updateFlatKeyUnFlatAggVectorState(
 
 void AggregateHashTable::updateBothUnFlatSameDCAggVectorState(AggregateFunction& aggregateFunction,
     ValueVector* aggVector, uint64_t multiplicity, uint32_t aggStateOffset) {
+    if (aggregateFunction.hasUpdateGroupsFunc()) {
+        aggregateFunction.updateGroupsState(entriesToUpdateAggState.get(), aggStateOffset,
+            aggVector, multiplicity, factorizedTable->getInMemOverflowBuffer());
+        return;
+    }
     aggVector->forEachNonNull([&](auto pos) {
         aggregateFunction.updatePosState(hashSlotsToUpdateAggState[pos]->getEntry() +
                                              aggStateOffset,
@@ -720,9 +825,32 @@ void AggregateHashTable::updateBothUnFlatSameDCAggVectorState(AggregateFunction&
     });
 }
 
+// Whether combining a state into others leaves it unchanged, so that it can be combined into the
+// states of many groups.
+static bool canCombineRepeatedly(const AggregateFunction& aggregateFunction) {
+    const auto& name = aggregateFunction.name;
+    return name == CountFunction::name || name == AggregateSumFunction::name ||
+           name == AggregateAvgFunction::name || name == AggregateMinFunction::name ||
+           name == AggregateMaxFunction::name;
+}
+
 void AggregateHashTable::updateBothUnFlatDifferentDCAggVectorState(
     const DataChunkState& unFlatKeyState, AggregateFunction& aggregateFunction,
     ValueVector* aggVector, uint64_t multiplicity, uint32_t aggStateOffset) {
+    // Every group of the key chunk pairs with all the values of the aggregate chunk, so the values
+    // are aggregated once and combined into each group instead of being aggregated for each group.
+    if (unFlatKeyState.getSelVector().getSelSize() > 1 && canCombineRepeatedly(aggregateFunction)) {
+        auto valuesState = aggregateFunction.createInitialNullAggregateState();
+        auto valuesStatePtr = reinterpret_cast<uint8_t*>(valuesState.get());
+        aggregateFunction.updateAllState(valuesStatePtr, aggVector, multiplicity,
+            factorizedTable->getInMemOverflowBuffer());
+        unFlatKeyState.getSelVector().forEach([&](auto pos) {
+            aggregateFunction.combineState(
+                hashSlotsToUpdateAggState[pos]->getEntry() + aggStateOffset, valuesStatePtr,
+                factorizedTable->getInMemOverflowBuffer());
+        });
+        return;
+    }
     unFlatKeyState.getSelVector().forEach([&](auto pos) {
         aggregateFunction.updateAllState(hashSlotsToUpdateAggState[pos]->getEntry() +
                                              aggStateOffset,
@@ -871,6 +999,10 @@ void PartitioningAggregateHashTable::mergeIfFull(uint64_t tuplesToAdd, bool merg
 
 void AggregateHashTable::clear() {
     factorizedTable->clear();
+    for (auto offset : directLookupOffsets) {
+        getEntryOfOffset(offset) = nullptr;
+    }
+    directLookupOffsets.clear();
     // Clear hash table
     for (auto& block : hashSlotsBlocks) {
         block->resetToZero();
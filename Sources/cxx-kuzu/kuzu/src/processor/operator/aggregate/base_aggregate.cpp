@@ -1,7 +1,10 @@
 #include "processor/operator/aggregate/base_aggregate.h"
 
+#include <thread>
+
 #include "main/client_context.h"
 #include "processor/operator/aggregate/aggregate_hash_table.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::function;
 
@@ -68,7 +71,7 @@ void BaseAggregateSharedState::HashTableQueue::appendTuple(std::span<uint8_t> tu
                 // TODO(bmwinger): if the queuedTuples has at least a certain size (benchmark to see
                 // if there's a benefit to waiting for multiple blocks) then cycle through the queue
                 // and flush any blocks which have been fully written
-                queuedTuples.push(block);
+                queueFullBlock(block);
             } else {
                 // If the block was replaced by another thread, discard the block we created and try
                 // again with the block allocated by the other thread
@@ -78,6 +81,31 @@ void BaseAggregateSharedState::HashTableQueue::appendTuple(std::span<uint8_t> tu
     }
 }
 
+void BaseAggregateSharedState::HashTableQueue::queueFullBlock(TupleBlock* block) {
+    if (spillState == nullptr) {
+        queuedTuples.push(block);
+        return;
+    }
+    const auto numBytes = getNumBytesPerBlock(*block);
+    if (spillState->numBytesInMemory.fetch_add(numBytes) + numBytes <= spillState->memoryBudget) {
+        queuedTuples.push(block);
+        return;
+    }
+    spillState->numBytesInMemory -= numBytes;
+    // Other threads may still be copying tuples into the slots they reserved in the block.
+    while (block->numTuplesWritten < numTuplesPerBlock) {
+        std::this_thread::yield();
+    }
+    // The block is a single data block, so its tuples are contiguous.
+    auto filePosition = spillState->spiller.spillToDisk(
+        std::span<const uint8_t>(block->table.getTuple(0), numBytes));
+    {
+        std::unique_lock lck{spillMtx};
+        spilledBlockPositions.push_back(filePosition);
+    }
+    delete block;
+}
+
 void BaseAggregateSharedState::HashTableQueue::mergeInto(AggregateHashTable& hashTable) {
     TupleBlock* partitionToMerge = nullptr;
     auto headBlock = this->headBlock.load();
@@ -85,9 +113,26 @@ void BaseAggregateSharedState::HashTableQueue::mergeInto(AggregateHashTable& has
     while (queuedTuples.pop(partitionToMerge)) {
         KU_ASSERT(
             partitionToMerge->numTuplesWritten == partitionToMerge->table.getNumTuplesPerBlock());
+        if (spillState != nullptr) {
+            spillState->numBytesInMemory -= getNumBytesPerBlock(*partitionToMerge);
+        }
         hashTable.merge(std::move(partitionToMerge->table));
         delete partitionToMerge;
     }
+    std::vector<uint64_t> filePositions;
+    {
+        std::unique_lock lck{spillMtx};
+        filePositions = std::move(spilledBlockPositions);
+        spilledBlockPositions.clear();
+    }
+    for (auto filePosition : filePositions) {
+        auto block = std::make_unique<TupleBlock>(headBlock->table.getMemoryManager(),
+            headBlock->table.getTableSchema()->copy());
+        spillState->spiller.loadFromDisk(
+            std::span<uint8_t>(block->table.getTuple(0), getNumBytesPerBlock(*block)),
+            filePosition);
+        hashTable.merge(std::move(block->table));
+    }
     if (headBlock->numTuplesWritten > 0) {
         headBlock->table.resize(headBlock->numTuplesWritten);
         hashTable.merge(std::move(headBlock->table));
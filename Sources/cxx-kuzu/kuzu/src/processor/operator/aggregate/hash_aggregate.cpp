@@ -69,9 +69,8 @@ HashAggregateSharedState::HashAggregateSharedState(main::ClientContext* context,
     partition.queue = std::make_unique<HashTableQueue>(MemoryManager::Get(*context),
         this->aggInfo.tableSchema.copy());
 
-    // Always create a hash table for the first partition. Any other partitions which are non-empty
-    // when finalizing will create an empty copy of this table
-    partition.hashTable = std::make_unique<AggregateHashTable>(*MemoryManager::Get(*context),
+    // The partitions create an empty copy of this table when they're finalized
+    emptyHashTable = std::make_unique<AggregateHashTable>(*MemoryManager::Get(*context),
         std::move(keyTypes), std::move(payloadTypes), aggregateFunctions, distinctAggregateKeyTypes,
         0, this->aggInfo.tableSchema.copy());
     for (size_t functionIdx = 0; functionIdx < aggregateFunctions.size(); functionIdx++) {
@@ -127,9 +126,9 @@ std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
     }
     // FactorizedTable::lookup resets the ValueVector and writes to the beginning,
     // so we can't support scanning from multiple partitions at once
-    auto [table, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto [partitionIdx, partitionStartOffset] = getPartitionForOffset(startOffset);
     auto range = std::min(std::min(DEFAULT_VECTOR_CAPACITY, numTuples - startOffset),
-        table->getNumTuples() + tableStartOffset - startOffset);
+        globalPartitions[partitionIdx].numGroups + partitionStartOffset - startOffset);
     currentOffset += range;
     return std::make_pair(startOffset, startOffset + range);
 }
@@ -137,18 +136,27 @@ std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
 uint64_t HashAggregateSharedState::getNumTuples() const {
     uint64_t numTuples = 0;
     for (auto& partition : globalPartitions) {
-        numTuples += partition.hashTable->getNumEntries();
+        numTuples += partition.numGroups;
     }
     return numTuples;
 }
 
+void HashAggregateSharedState::enableSpilling(Spiller& spiller, uint64_t memoryBudget) {
+    queueSpillState = std::make_unique<QueueSpillState>(spiller, memoryBudget);
+    for (auto& partition : globalPartitions) {
+        partition.queue->enableSpilling(queueSpillState.get());
+        for (auto& queue : partition.distinctTableQueues) {
+            if (queue) {
+                queue->enableSpilling(queueSpillState.get());
+            }
+        }
+    }
+}
+
 void HashAggregateSharedState::finalizePartitions() {
     BaseAggregateSharedState::finalizePartitions(globalPartitions, [&](auto& partition) {
-        if (!partition.hashTable) {
-            // We always initialize the hash table in the first partition
-            partition.hashTable = std::make_unique<AggregateHashTable>(
-                globalPartitions[0].hashTable->createEmptyCopy());
-        }
+        partition.hashTable =
+            std::make_unique<AggregateHashTable>(emptyHashTable->createEmptyCopy());
         // TODO(bmwinger): ideally these can be merged into a single function.
         // The distinct tables need to be merged first so that they exist when the other table
         // updates the agg states when it merges
@@ -162,25 +170,28 @@ void HashAggregateSharedState::finalizePartitions() {
         partition.hashTable->mergeDistinctAggregateInfo();
 
         partition.hashTable->finalizeAggregateStates();
+        // Only the groups are scanned, so the hash slots and distinct tables are freed right away.
+        partition.numGroups = partition.hashTable->getNumEntries();
+        partition.groups = partition.hashTable->releaseFactorizedTable();
+        partition.hashTable.reset();
     });
 }
 
-std::tuple<const FactorizedTable*, offset_t> HashAggregateSharedState::getPartitionForOffset(
+std::tuple<idx_t, offset_t> HashAggregateSharedState::getPartitionForOffset(
     offset_t offset) const {
-    auto factorizedTableStartOffset = 0;
-    auto partitionIdx = 0;
-    const auto* table = globalPartitions[partitionIdx].hashTable->getFactorizedTable();
-    while (factorizedTableStartOffset + table->getNumTuples() <= offset) {
-        factorizedTableStartOffset += table->getNumTuples();
-        table = globalPartitions[++partitionIdx].hashTable->getFactorizedTable();
+    offset_t partitionStartOffset = 0;
+    idx_t partitionIdx = 0;
+    while (partitionStartOffset + globalPartitions[partitionIdx].numGroups <= offset) {
+        partitionStartOffset += globalPartitions[partitionIdx++].numGroups;
     }
-    return std::make_tuple(table, factorizedTableStartOffset);
+    return std::make_tuple(partitionIdx, partitionStartOffset);
 }
 
 void HashAggregateSharedState::scan(std::span<uint8_t*> entries,
     std::vector<common::ValueVector*>& keyVectors, offset_t startOffset, offset_t numTuplesToScan,
     std::vector<uint32_t>& columnIndices) {
-    auto [table, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto [partitionIdx, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto* table = globalPartitions[partitionIdx].groups.get();
     // Due to the way FactorizedTable::lookup works, it's necessary to read one partition
     // at a time.
     KU_ASSERT(startOffset - tableStartOffset + numTuplesToScan <= table->getNumTuples());
@@ -192,6 +203,16 @@ void HashAggregateSharedState::scan(std::span<uint8_t*> entries,
     KU_ASSERT(true);
 }
 
+void HashAggregateSharedState::releaseScannedRange(offset_t startOffset,
+    uint64_t numRowsScanned) {
+    auto& partition = globalPartitions[std::get<0>(getPartitionForOffset(startOffset))];
+    // The groups are copied into the output vectors, so nothing refers to them once scanned.
+    if (partition.numGroupsScanned.fetch_add(numRowsScanned) + numRowsScanned ==
+        partition.numGroups) {
+        partition.groups.reset();
+    }
+}
+
 void HashAggregateSharedState::assertFinalized() const {
     RUNTIME_CHECK(for (const auto& partition
                        : globalPartitions) {
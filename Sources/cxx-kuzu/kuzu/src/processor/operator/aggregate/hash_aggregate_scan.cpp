@@ -34,6 +34,7 @@ bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
             offset += aggState->getStateSize();
         }
     }
+    sharedState->releaseScannedRange(startOffset, numRowsToScan);
     metrics->numOutputTuple.increase(numRowsToScan);
     return true;
 }
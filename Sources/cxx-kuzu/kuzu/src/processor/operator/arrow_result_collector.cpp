@@ -19,13 +19,9 @@ bool ArrowResultCollectorLocalState::advance() {
     return false;
 }
 
-void ArrowResultCollectorLocalState::fillTuple() {
-    KU_ASSERT(tuple->len() == vectors.size());
+void ArrowResultCollectorLocalState::fillPositions(uint64_t tupleIdx) {
     for (auto i = 0u; i < vectors.size(); ++i) {
-        auto vector = vectors[i];
-        auto pos = vector->state->getSelVector()[vectorsSelPos[i]];
-        auto data = vector->getData() + pos * vector->getNumBytesPerValue();
-        tuple->getValue(i)->copyFromColLayout(data, vector);
+        positions[i][tupleIdx] = vectors[i]->state->getSelVector()[vectorsSelPos[i]];
     }
 }
 
@@ -63,15 +59,18 @@ void ArrowResultCollector::executeInternal(ExecutionContext* context) {
     sharedState->merge(localState.arrays);
 }
 
+// The positions of the tuples are collected first, so that each column is appended to the row
+// batch at once.
 bool ArrowResultCollector::fillRowBatch(ArrowRowBatch& rowBatch) {
-    while (rowBatch.size() < info.chunkSize) {
-        localState.fillTuple();
-        rowBatch.append(*localState.tuple);
-        if (!localState.advance()) {
-            return false;
-        }
+    const auto numTuplesToFill = static_cast<uint64_t>(info.chunkSize - rowBatch.size());
+    uint64_t numTuples = 0;
+    auto hasMoreTuples = true;
+    while (numTuples < numTuplesToFill && hasMoreTuples) {
+        localState.fillPositions(numTuples++);
+        hasMoreTuples = localState.advance();
     }
-    return true;
+    rowBatch.append(localState.vectors, localState.positions, numTuples);
+    return hasMoreTuples;
 }
 
 void ArrowResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
@@ -91,7 +90,8 @@ void ArrowResultCollector::initLocalStateInternal(ResultSet* resultSet, Executio
         localState.vectors.push_back(resultSet->getValueVector(pos).get());
         localState.vectorsSelPos.push_back(localState.chunkCursors[idxMap.at(pos.dataChunkPos)]);
     }
-    localState.tuple = std::make_unique<FlatTuple>(info.columnTypes);
+    localState.positions.resize(localState.vectors.size(),
+        std::vector<sel_t>(static_cast<uint64_t>(info.chunkSize)));
 }
 
 std::unique_ptr<main::QueryResult> ArrowResultCollector::getQueryResult() const {
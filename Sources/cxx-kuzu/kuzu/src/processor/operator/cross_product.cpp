@@ -1,14 +1,115 @@
 #include "processor/operator/cross_product.h"
 
+#include <cmath>
+
 #include "common/metric.h"
+#include "common/type_utils.h"
+
+using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
+static double readKey(PhysicalTypeID keyType, const uint8_t* value) {
+    return TypeUtils::visit(
+        keyType,
+        [&]<NumericTypes T>(T) {
+            T result;
+            memcpy(&result, value, sizeof(T));
+            return static_cast<double>(result);
+        },
+        [](auto) -> double { KU_UNREACHABLE; });
+}
+
+void CrossProductSortedBuild::init(const FactorizedTable& table) {
+    std::unique_lock lck{mtx};
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+    const auto colOffset = table.getTableSchema()->getColOffset(keyColIdx);
+    const auto nullMapOffset = table.getTableSchema()->getNullMapOffset();
+    std::vector<std::pair<double, uint8_t*>> sortedTuples;
+    sortedTuples.reserve(table.getNumTuples());
+    for (auto i = 0u; i < table.getNumTuples(); i++) {
+        auto tuple = table.getTuple(i);
+        if (table.isNonOverflowColNull(tuple + nullMapOffset, keyColIdx)) {
+            // A null key satisfies no inequality.
+            continue;
+        }
+        auto key = readKey(keyType, tuple + colOffset);
+        if (std::isnan(key)) {
+            canSkipTuples = false;
+            break;
+        }
+        sortedTuples.emplace_back(key, tuple);
+    }
+    if (!canSkipTuples) {
+        tuples.reserve(table.getNumTuples());
+        for (auto i = 0u; i < table.getNumTuples(); i++) {
+            tuples.push_back(table.getTuple(i));
+        }
+        return;
+    }
+    std::sort(sortedTuples.begin(), sortedTuples.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+    keys.reserve(sortedTuples.size());
+    tuples.reserve(sortedTuples.size());
+    for (auto& [key, tuple] : sortedTuples) {
+        keys.push_back(key);
+        tuples.push_back(tuple);
+    }
+}
+
+std::pair<uint64_t, uint64_t> CrossProductSortedBuild::getRange(
+    const ValueVector& probeKeyVector) const {
+    if (!canSkipTuples) {
+        return {0, tuples.size()};
+    }
+    auto minKey = std::numeric_limits<double>::infinity();
+    auto maxKey = -std::numeric_limits<double>::infinity();
+    auto& selVector = probeKeyVector.state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (probeKeyVector.isNull(pos)) {
+            continue;
+        }
+        auto key = readKey(keyType,
+            probeKeyVector.getData() + pos * probeKeyVector.getNumBytesPerValue());
+        if (std::isnan(key)) {
+            return {0, tuples.size()};
+        }
+        minKey = std::min(minKey, key);
+        maxKey = std::max(maxKey, key);
+    }
+    if (minKey > maxKey) {
+        // All probe keys are null.
+        return {0, 0};
+    }
+    switch (comparisonType) {
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS: {
+        // probe < build holds for some probe key only if build >= min(probe).
+        const auto start = std::lower_bound(keys.begin(), keys.end(), minKey) - keys.begin();
+        return {start, tuples.size()};
+    }
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        const auto end = std::upper_bound(keys.begin(), keys.end(), maxKey) - keys.begin();
+        return {0, end};
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 void CrossProduct::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* /*context*/) {
     for (auto& pos : info.outVecPos) {
         vectorsToScan.push_back(resultSet->getValueVector(pos).get());
     }
+    if (info.probeKeyPos.isValid()) {
+        probeKeyVector = resultSet->getValueVector(info.probeKeyPos).get();
+    }
     localState.init();
 }
 
@@ -19,16 +120,29 @@ bool CrossProduct::getNextTuplesInternal(ExecutionContext* context) {
     if (table->getNumTuples() == 0) {
         return false;
     }
-    if (localState.startIdx == table->getNumTuples()) { // no more to scan from right
+    auto sortedBuild = localState.sortedBuild.get();
+    while (localState.startIdx == localState.endIdx) { // no more to scan from right
         if (!children[0]->getNextTuple(context)) {      // fetch a new left tuple
             return false;
         }
-        localState.startIdx = 0; // reset right table scanning for a new left tuple
+        // reset right table scanning for a new left tuple
+        if (sortedBuild != nullptr) {
+            std::tie(localState.startIdx, localState.endIdx) =
+                sortedBuild->getRange(*probeKeyVector);
+        } else {
+            localState.startIdx = 0;
+            localState.endIdx = table->getNumTuples();
+        }
     }
     // scan from right table if there is tuple left
     auto numTuplesToScan =
-        std::min(localState.maxMorselSize, table->getNumTuples() - localState.startIdx);
-    table->scan(vectorsToScan, localState.startIdx, numTuplesToScan, info.colIndicesToScan);
+        std::min(localState.maxMorselSize, localState.endIdx - localState.startIdx);
+    if (sortedBuild != nullptr) {
+        table->lookup(vectorsToScan, info.colIndicesToScan, sortedBuild->getTuples(),
+            localState.startIdx, numTuplesToScan);
+    } else {
+        table->scan(vectorsToScan, localState.startIdx, numTuplesToScan, info.colIndicesToScan);
+    }
     localState.startIdx += numTuplesToScan;
     metrics->numOutputTuple.increase(numTuplesToScan);
     return true;
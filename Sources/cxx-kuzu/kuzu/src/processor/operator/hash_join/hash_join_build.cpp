@@ -1,7 +1,12 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/reoptimization.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/utils.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "processor/processor_task.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::common;
@@ -20,13 +25,104 @@ std::string HashJoinBuildPrintInfo::toString() const {
     return result;
 }
 
+void HashJoinSharedState::enableSpilling(MemoryManager& memoryManager, Spiller& spiller,
+    uint64_t memoryBudget, logical_type_vec_t keyTypes) {
+    spillInfo = std::make_unique<SpillInfo>(
+        SpillInfo{memoryManager, spiller, memoryBudget, std::move(keyTypes)});
+}
+
 void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     std::unique_lock lck(mtx);
+    numBuildTuples += localHashTable.getNumEntries();
+    if (partitions) {
+        partitions->append(localHashTable, *hashTable);
+        return;
+    }
     hashTable->merge(localHashTable);
+    if (spillInfo && hashTable->getNumTupleBlocks() * TEMP_PAGE_SIZE > spillInfo->memoryBudget) {
+        partitions = std::make_unique<HashJoinPartitions>(spillInfo->memoryManager,
+            spillInfo->spiller, spillInfo->memoryBudget, LogicalType::copy(spillInfo->keyTypes),
+            hashTable->getTableSchema()->copy());
+        partitions->append(*hashTable, *hashTable);
+    }
+}
+
+// Runs func for every morsel index in [0, numMorsels), each exactly once, on all threads working on
+// the task.
+class HashJoinFinalizeTask final : public Task {
+public:
+    HashJoinFinalizeTask(uint64_t maxNumThreads, uint64_t numMorsels,
+        std::function<void(idx_t)> func)
+        : Task{maxNumThreads}, numMorsels{numMorsels}, nextMorselIdx{0}, func{std::move(func)} {}
+
+    void run() override {
+        auto memoryScope = ProcessorTask::trackMemory(pipelineMemoryScope);
+        for (auto morselIdx = nextMorselIdx++; morselIdx < numMorsels;
+             morselIdx = nextMorselIdx++) {
+            func(morselIdx);
+        }
+    }
+
+private:
+    uint64_t numMorsels;
+    std::atomic<idx_t> nextMorselIdx;
+    std::function<void(idx_t)> func;
+    // Scope of the hash join build pipeline creating the task.
+    const storage::MemoryTrackerScope* pipelineMemoryScope =
+        storage::MemoryTrackerScope::getCurrent();
+};
+
+static void runMorselsInParallel(ExecutionContext* context, uint64_t numMorsels,
+    std::function<void(idx_t)> func) {
+    const auto numThreads =
+        std::min<uint64_t>(context->clientContext->getClientConfig()->numThreads, numMorsels);
+    if (numThreads <= 1) {
+        for (auto morselIdx = 0u; morselIdx < numMorsels; morselIdx++) {
+            func(morselIdx);
+        }
+        return;
+    }
+    auto task = std::make_shared<HashJoinFinalizeTask>(numThreads, numMorsels, std::move(func));
+    // The sink is finalized by a worker thread, which is blocked while waiting for the task. Start
+    // a new worker in its place (see GDSUtils).
+    TaskScheduler::Get(*context->clientContext)
+        ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
+}
+
+void HashJoinSharedState::finalize(ExecutionContext* context) {
+    if (runtimeFilter) {
+        runtimeFilter->finalize();
+    }
+    if (partitions) {
+        auto hashTables = partitions->finalize();
+        runMorselsInParallel(context, hashTables.size(), [&](idx_t partitionIdx) {
+            auto partitionHashTable = hashTables[partitionIdx];
+            partitionHashTable->allocateHashSlots(partitionHashTable->getNumEntries());
+            partitionHashTable->buildHashSlots();
+        });
+        return;
+    }
+    auto numTuples = hashTable->getNumEntries();
+    hashTable->allocateHashSlots(numTuples);
+    if (numTuples < MIN_NUM_TUPLES_FOR_PARALLEL_FINALIZE) {
+        hashTable->buildHashSlots();
+        return;
+    }
+    const auto numBlocks = hashTable->getNumTupleBlocks();
+    const auto numMorsels = ceilDiv(numBlocks, NUM_TUPLE_BLOCKS_PER_FINALIZE_MORSEL);
+    std::vector<JoinHashTable::slot_partitioned_tuples_t> partitionedTuples(numMorsels);
+    runMorselsInParallel(context, numMorsels, [&](idx_t morselIdx) {
+        const auto startBlockIdx = morselIdx * NUM_TUPLE_BLOCKS_PER_FINALIZE_MORSEL;
+        const auto endBlockIdx =
+            std::min(startBlockIdx + NUM_TUPLE_BLOCKS_PER_FINALIZE_MORSEL, numBlocks);
+        hashTable->partitionTuplesBySlot(startBlockIdx, endBlockIdx, partitionedTuples[morselIdx]);
+    });
+    runMorselsInParallel(context, JoinHashTable::NUM_SLOT_PARTITIONS, [&](idx_t slotPartitionIdx) {
+        hashTable->buildHashSlots(slotPartitionIdx, partitionedTuples);
+    });
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
-    std::vector<LogicalType> keyTypes;
     for (auto i = 0u; i < info.keysPos.size(); ++i) {
         auto vector = resultSet->getValueVector(info.keysPos[i]).get();
         keyTypes.push_back(vector->dataType.copy());
@@ -41,8 +137,13 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto& pos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(pos).get());
     }
-    hashTable = std::make_unique<JoinHashTable>(*MemoryManager::Get(*context->clientContext),
-        std::move(keyTypes), info.tableSchema.copy());
+    hashTable = createLocalHashTable(context);
+}
+
+std::unique_ptr<JoinHashTable> HashJoinBuild::createLocalHashTable(
+    ExecutionContext* context) const {
+    return std::make_unique<JoinHashTable>(*MemoryManager::Get(*context->clientContext),
+        LogicalType::copy(keyTypes), info.tableSchema.copy());
 }
 
 void HashJoinBuild::setKeyState(common::DataChunkState* state) {
@@ -53,20 +154,45 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
-    auto numTuples = sharedState->getHashTable()->getNumEntries();
-    sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+void HashJoinBuild::checkCardinalityEstimate(const ExecutionContext* context) const {
+    if (!context->canReoptimize || info.subgraphKey.empty()) {
+        return;
+    }
+    const auto threshold =
+        context->clientContext->getClientConfig()->adaptiveReoptimizationThreshold;
+    const auto numTuples = sharedState->getNumBuildTuples();
+    if (threshold == 0 || numTuples < MIN_NUM_TUPLES_FOR_REOPTIMIZATION) {
+        return;
+    }
+    if (numTuples / threshold > info.estimatedNumTuples) {
+        throw ReoptimizationException(info.subgraphKey, numTuples);
+    }
+}
+
+void HashJoinBuild::finalizeInternal(ExecutionContext* context) {
+    // Checked before the hash slots are built, as the work is thrown away if the query is
+    // re-planned.
+    checkCardinalityEstimate(context);
+    sharedState->finalize(context);
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
     // Append thread-local tuples
+    auto runtimeFilter = sharedState->getRuntimeFilter();
     while (children[0]->getNextTuple(context)) {
         uint64_t numAppended = 0u;
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             numAppended += appendVectors();
         }
+        if (runtimeFilter) {
+            runtimeFilter->insert(*keyVectors[0]);
+        }
         metrics->numOutputTuple.increase(numAppended);
+        if (sharedState->isSpillingEnabled() &&
+            hashTable->getNumTupleBlocks() >= NUM_TUPLE_BLOCKS_PER_MERGE) {
+            sharedState->mergeLocalHashTable(*hashTable);
+            hashTable = createLocalHashTable(context);
+        }
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
@@ -0,0 +1,162 @@
+#include "processor/operator/hash_join/hash_join_partitions.h"
+
+#include "common/assert.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+uint64_t HashJoinPartitions::Partition::getNumTuples() const {
+    uint64_t numTuples = hashTable->getNumEntries();
+    for (auto& block : spilledBlocks) {
+        numTuples += block.numTuples;
+    }
+    return numTuples;
+}
+
+HashJoinPartitions::HashJoinPartitions(MemoryManager& memoryManager, Spiller& spiller,
+    uint64_t memoryBudget, logical_type_vec_t keyTypes, FactorizedTableSchema tableSchema)
+    : memoryManager{memoryManager}, spiller{spiller}, memoryBudget{memoryBudget},
+      keyTypes{std::move(keyTypes)}, tableSchema{std::move(tableSchema)} {
+    partitions.reserve(NUM_PARTITIONS);
+    for (auto i = 0u; i < NUM_PARTITIONS; i++) {
+        partitions.emplace_back(createHashTable());
+    }
+}
+
+std::unique_ptr<JoinHashTable> HashJoinPartitions::createHashTable() const {
+    return std::make_unique<JoinHashTable>(memoryManager, LogicalType::copy(keyTypes),
+        tableSchema.copy());
+}
+
+void HashJoinPartitions::append(JoinHashTable& hashTable, JoinHashTable& overflowTable) {
+    hashTable.partitionTuples(
+        [&](hash_t hash) -> JoinHashTable& {
+            return *partitions[getPartitionIdx(hash)].hashTable;
+        },
+        overflowTable);
+    std::unique_lock lck{mtx};
+    while (getMemoryUsageNoLock() > memoryBudget) {
+        auto largest = std::max_element(partitions.begin(), partitions.end(),
+            [](const Partition& a, const Partition& b) {
+                return a.hashTable->getNumTupleBlocks() < b.hashTable->getNumTupleBlocks();
+            });
+        spillNoLock(*largest);
+    }
+}
+
+std::vector<JoinHashTable*> HashJoinPartitions::finalize() {
+    std::unique_lock lck{mtx};
+    std::vector<JoinHashTable*> residentHashTables;
+    for (auto& partition : partitions) {
+        if (partition.isSpilled()) {
+            spillNoLock(partition);
+            partition.resident = false;
+        } else {
+            residentHashTables.push_back(partition.hashTable.get());
+            partition.resident = true;
+        }
+    }
+    return residentHashTables;
+}
+
+JoinHashTable* HashJoinPartitions::tryPin(idx_t partitionIdx) {
+    std::unique_lock lck{mtx};
+    auto& partition = partitions[partitionIdx];
+    if (!partition.resident) {
+        return nullptr;
+    }
+    partition.numPins++;
+    return partition.hashTable.get();
+}
+
+JoinHashTable* HashJoinPartitions::pin(idx_t partitionIdx) {
+    std::unique_lock lck{mtx};
+    auto& partition = partitions[partitionIdx];
+    loadCV.wait(lck, [&] { return !partition.loading; });
+    if (!partition.resident) {
+        partition.loading = true;
+        evictNoLock(partition.spilledBlocks.size() * TEMP_PAGE_SIZE);
+        lck.unlock();
+        std::unique_ptr<JoinHashTable> hashTable;
+        try {
+            hashTable = load(partition);
+        } catch (...) {
+            lck.lock();
+            partition.loading = false;
+            loadCV.notify_all();
+            throw;
+        }
+        lck.lock();
+        partition.hashTable = std::move(hashTable);
+        partition.resident = true;
+        partition.loading = false;
+        loadCV.notify_all();
+    }
+    partition.numPins++;
+    return partition.hashTable.get();
+}
+
+void HashJoinPartitions::unpin(idx_t partitionIdx) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(partitions[partitionIdx].numPins > 0);
+    partitions[partitionIdx].numPins--;
+}
+
+uint64_t HashJoinPartitions::getNumSpilledPartitions() const {
+    std::unique_lock lck{mtx};
+    return std::count_if(partitions.begin(), partitions.end(),
+        [](const Partition& partition) { return partition.isSpilled(); });
+}
+
+uint64_t HashJoinPartitions::getMemoryUsageNoLock() const {
+    uint64_t numBlocks = 0;
+    for (auto& partition : partitions) {
+        numBlocks += partition.hashTable->getNumTupleBlocks();
+    }
+    return numBlocks * TEMP_PAGE_SIZE;
+}
+
+void HashJoinPartitions::spillNoLock(Partition& partition) {
+    for (auto& block : partition.hashTable->releaseTupleBlocks()) {
+        auto filePosition = spiller.spillToDisk(block->getSizedData());
+        partition.spilledBlocks.push_back(
+            SpilledTupleBlock{filePosition, block->numTuples, block->freeSize});
+    }
+}
+
+std::unique_ptr<JoinHashTable> HashJoinPartitions::load(const Partition& partition) const {
+    auto hashTable = createHashTable();
+    for (auto& spilledBlock : partition.spilledBlocks) {
+        auto block = std::make_unique<DataBlock>(&memoryManager, TEMP_PAGE_SIZE);
+        spiller.loadFromDisk(block->getSizedData(), spilledBlock.filePosition);
+        block->numTuples = spilledBlock.numTuples;
+        block->freeSize = spilledBlock.freeSize;
+        hashTable->appendTupleBlock(std::move(block));
+    }
+    // Tuple addresses changed, so the hash slots and the prev pointers chaining the tuples of
+    // each slot have to be rebuilt.
+    hashTable->allocateHashSlots(hashTable->getNumEntries());
+    hashTable->buildHashSlots();
+    return hashTable;
+}
+
+void HashJoinPartitions::evictNoLock(uint64_t numBytesNeeded) {
+    for (auto& partition : partitions) {
+        if (getMemoryUsageNoLock() + numBytesNeeded <= memoryBudget) {
+            return;
+        }
+        if (partition.resident && partition.isSpilled() && partition.numPins == 0 &&
+            !partition.loading) {
+            partition.hashTable = createHashTable();
+            partition.resident = false;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,8 @@
 #include "processor/operator/hash_join/hash_join_probe.h"
 
+#include <algorithm>
+#include <bitset>
+
 #include "binder/expression/expression_util.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -35,7 +38,11 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     columnIdxsToReadFrom.resize(probeDataInfo.getNumPayloads());
     iota(columnIdxsToReadFrom.begin(), columnIdxsToReadFrom.end(),
         probeDataInfo.keysDataPos.size());
+    for (auto& dataPos : probeDataInfo.probeSideDataPos) {
+        probeSideVectors.push_back(resultSet->getValueVector(dataPos).get());
+    }
     auto mm = storage::MemoryManager::Get(*context->clientContext);
+    memoryManager = mm;
     hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
     if (keyVectors.size() > 1) {
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
@@ -48,16 +55,23 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         return true;
     }
     if (probeState->probedTuples[0] == nullptr) { // No more matched tuples on the chain.
-        // We still need to save and restore for flat input because we are discarding NULL join keys
-        // which changes the selected position.
-        // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
-        restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
-            return false;
+        if (sharedState->getPartitions() != nullptr) {
+            if (!getNextPartitionedProbeInput(context)) {
+                return false;
+            }
+        } else {
+            // We still need to save and restore for flat input because we are discarding NULL join
+            // keys which changes the selected position.
+            // TODO(Guodong): we have potential bugs here because all keys' states should be
+            // restored.
+            restoreSelVector(*keyVectors[0]->state);
+            if (!children[0]->getNextTuple(context)) {
+                return false;
+            }
+            saveSelVector(*keyVectors[0]->state);
+            sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec,
+                tmpHashVector.get(), probeState->probedTuples.get());
         }
-        saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
-            probeState->probedTuples.get());
     }
     auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
         probeState->probedTuples.get(), probeState->matchedTuples.get());
@@ -69,13 +83,19 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
 bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
-    restoreSelVector(*keyVector->state);
-    if (!children[0]->getNextTuple(context)) {
-        return false;
+    if (sharedState->getPartitions() != nullptr) {
+        if (!getNextPartitionedProbeInput(context)) {
+            return false;
+        }
+    } else {
+        restoreSelVector(*keyVector->state);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(*keyVector->state);
+        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec,
+            tmpHashVector.get(), probeState->probedTuples.get());
     }
-    saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
-        probeState->probedTuples.get());
     auto numMatchedTuples =
         sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector);
@@ -84,6 +104,149 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     return true;
 }
 
+bool HashJoinProbe::getNextPartitionedProbeInput(ExecutionContext* context) {
+    while (!probeInputExhausted) {
+        restoreSelVector(*keyVectors[0]->state);
+        unpinPartitions();
+        if (!children[0]->getNextTuple(context)) {
+            probeInputExhausted = true;
+            break;
+        }
+        saveSelVector(*keyVectors[0]->state);
+        if (probeResidentPartitions()) {
+            return true;
+        }
+    }
+    return probeNextBufferedTuple();
+}
+
+bool HashJoinProbe::probeResidentPartitions() {
+    if (!sharedState->getHashTable()->computeProbeHashes(keyVectors, *hashVector, hashSelVec,
+            tmpHashVector.get())) {
+        // NULL keys don't match anything.
+        probeState->probedTuples[0] = nullptr;
+        return true;
+    }
+    residentKeys.clear();
+    spilledKeys.clear();
+    auto& selVector = keyVectors[0]->state->getSelVectorUnsafe();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto hash = hashVector->getValue<hash_t>(hashSelVec[i]);
+        auto partitionIdx = HashJoinPartitions::getPartitionIdx(hash);
+        auto partition = tryPinPartition(partitionIdx);
+        if (partition == nullptr) {
+            spilledKeys.push_back(SpilledProbeKey{selVector[i], partitionIdx});
+        } else {
+            residentKeys.push_back(ResidentProbeKey{selVector[i],
+                partition->getNumEntries() > 0 ? partition->getTupleForHash(hash) : nullptr});
+        }
+    }
+    if (flatProbe) {
+        if (!spilledKeys.empty()) {
+            bufferProbeTuple(spilledKeys[0].partitionIdx);
+            return false;
+        }
+        probeState->probedTuples[0] = residentKeys.empty() ? nullptr : residentKeys[0].probedTuple;
+        return true;
+    }
+    // The keys of an unFlat input are buffered with the rest of the tuple once per partition,
+    // selecting only the keys of that partition.
+    auto buffer = selVector.getMutableBuffer();
+    std::bitset<HashJoinPartitions::NUM_PARTITIONS> isBuffered;
+    for (auto& key : spilledKeys) {
+        if (isBuffered[key.partitionIdx]) {
+            continue;
+        }
+        isBuffered[key.partitionIdx] = true;
+        sel_t numSelectedKeys = 0;
+        for (auto& other : spilledKeys) {
+            if (other.partitionIdx == key.partitionIdx) {
+                buffer[numSelectedKeys++] = other.pos;
+            }
+        }
+        selVector.setToFiltered(numSelectedKeys);
+        bufferProbeTuple(key.partitionIdx);
+    }
+    for (auto i = 0u; i < residentKeys.size(); i++) {
+        buffer[i] = residentKeys[i].pos;
+        probeState->probedTuples[i] = residentKeys[i].probedTuple;
+    }
+    selVector.setToFiltered(residentKeys.size());
+    return !residentKeys.empty();
+}
+
+void HashJoinProbe::bufferProbeTuple(idx_t partitionIdx) {
+    auto& table = bufferedProbeTuples[partitionIdx];
+    if (table == nullptr) {
+        table = std::make_unique<FactorizedTable>(memoryManager,
+            probeDataInfo.probeSideTableSchema.copy());
+    }
+    table->append(probeSideVectors);
+}
+
+bool HashJoinProbe::probeNextBufferedTuple() {
+    while (bufferedPartitionIdx == INVALID_IDX ||
+           nextBufferedTupleIdx == bufferedProbeTuples[bufferedPartitionIdx]->getNumTuples()) {
+        if (bufferedPartitionIdx != INVALID_IDX) {
+            bufferedProbeTuples[bufferedPartitionIdx].reset();
+            unpinPartitions();
+        }
+        auto next = std::find_if(bufferedProbeTuples.begin(), bufferedProbeTuples.end(),
+            [](const auto& table) { return table != nullptr; });
+        if (next == bufferedProbeTuples.end()) {
+            return false;
+        }
+        bufferedPartitionIdx = next - bufferedProbeTuples.begin();
+        nextBufferedTupleIdx = 0;
+    }
+    auto partition = pinPartition(bufferedPartitionIdx);
+    // The probe input is exhausted, so its vectors can be overwritten with the buffered tuple.
+    // Unflat columns are scanned into unfiltered vectors.
+    keyVectors[0]->state->setSelVector(currentSelVector);
+    for (auto vector : probeSideVectors) {
+        auto& selVector = vector->state->getSelVectorUnsafe();
+        if (!vector->state->isFlat()) {
+            selVector.setToUnfiltered();
+        } else if (selVector.getSelSize() != 1) {
+            selVector.setToUnfiltered(1);
+        }
+    }
+    bufferedProbeTuples[bufferedPartitionIdx]->scan(probeSideVectors, nextBufferedTupleIdx++,
+        1 /* numTuplesToScan */);
+    // NULL keys were discarded before the tuple was buffered.
+    sharedState->getHashTable()->computeProbeHashes(keyVectors, *hashVector, hashSelVec,
+        tmpHashVector.get());
+    for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
+        auto hash = hashVector->getValue<hash_t>(hashSelVec[i]);
+        probeState->probedTuples[i] =
+            partition->getNumEntries() > 0 ? partition->getTupleForHash(hash) : nullptr;
+    }
+    return true;
+}
+
+JoinHashTable* HashJoinProbe::pinPartition(idx_t partitionIdx) {
+    if (pinnedPartitions[partitionIdx] == nullptr) {
+        pinnedPartitions[partitionIdx] = sharedState->getPartitions()->pin(partitionIdx);
+    }
+    return pinnedPartitions[partitionIdx];
+}
+
+JoinHashTable* HashJoinProbe::tryPinPartition(idx_t partitionIdx) {
+    if (pinnedPartitions[partitionIdx] == nullptr) {
+        pinnedPartitions[partitionIdx] = sharedState->getPartitions()->tryPin(partitionIdx);
+    }
+    return pinnedPartitions[partitionIdx];
+}
+
+void HashJoinProbe::unpinPartitions() {
+    for (auto i = 0u; i < pinnedPartitions.size(); i++) {
+        if (pinnedPartitions[i] != nullptr) {
+            sharedState->getPartitions()->unpin(i);
+            pinnedPartitions[i] = nullptr;
+        }
+    }
+}
+
 uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
     if (probeState->matchedSelVector.getSelSize() == 0) {
         return 0;
@@ -21,6 +21,14 @@ JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t ke
     factorizedTable = std::make_unique<FactorizedTable>(&memoryManager, std::move(tableSchema));
 }
 
+static void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
 static bool discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
     bool hasNonNullKeys = true;
     for (auto& vector : vectors) {
@@ -111,29 +119,61 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
         hashSlotsBlocks.emplace_back(std::make_unique<DataBlock>(memoryManager, HASH_BLOCK_SIZE));
     }
+    while (hashSlotTagsBlocks.size() < numBlocksNeeded) {
+        hashSlotTagsBlocks.emplace_back(std::make_unique<DataBlock>(memoryManager,
+            numSlotsPerBlock * sizeof(slot_tag_t)));
+    }
+}
+
+void JoinHashTable::insertTuple(uint8_t* tuple) const {
+    auto lastSlotEntryInHT = insertEntry(tuple);
+    auto prevPtr = getPrevTuple(tuple);
+    memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
+        sizeof(uint8_t*));
 }
 
 void JoinHashTable::buildHashSlots() {
     for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
-            auto lastSlotEntryInHT = insertEntry(tuple);
-            auto prevPtr = getPrevTuple(tuple);
-            memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
-                sizeof(uint8_t*));
+            insertTuple(tuple);
             tuple += getTableSchema()->getNumBytesPerTuple();
         }
     }
 }
 
-void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
-    SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
-    KU_ASSERT(keyVectors.size() == keyTypes.size());
-    if (getNumEntries() == 0) {
-        return;
+void JoinHashTable::partitionTuplesBySlot(uint64_t startBlockIdx, uint64_t endBlockIdx,
+    slot_partitioned_tuples_t& partitionedTuples) {
+    const auto numBytesPerTuple = getTableSchema()->getNumBytesPerTuple();
+    const auto hashColOffset = getHashValueColOffset();
+    auto& tupleBlocks = factorizedTable->getTupleDataBlocks();
+    KU_ASSERT(startBlockIdx <= endBlockIdx && endBlockIdx <= tupleBlocks.size());
+    for (auto blockIdx = startBlockIdx; blockIdx < endBlockIdx; blockIdx++) {
+        uint8_t* tuple = tupleBlocks[blockIdx]->getData();
+        for (auto i = 0u; i < tupleBlocks[blockIdx]->numTuples; i++) {
+            auto slotIdx = getSlotIdxForHash(*(hash_t*)(tuple + hashColOffset));
+            partitionedTuples[getSlotPartitionIdx(slotIdx)].push_back(tuple);
+            tuple += numBytesPerTuple;
+        }
     }
+}
+
+void JoinHashTable::buildHashSlots(uint64_t slotPartitionIdx,
+    std::span<const slot_partitioned_tuples_t> partitionedTuples) {
+    KU_ASSERT(slotPartitionIdx < NUM_SLOT_PARTITIONS);
+    // Tuples are inserted in the same order as buildHashSlots, so the chains are identical.
+    for (auto& tuples : partitionedTuples) {
+        for (auto tuple : tuples[slotPartitionIdx]) {
+            insertTuple(tuple);
+        }
+    }
+}
+
+bool JoinHashTable::computeProbeHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector& hashVector, SelectionVector& hashSelVec, ValueVector* tmpHashResultVector) {
+    KU_ASSERT(keyVectors.size() == keyTypes.size());
     if (!discardNullFromKeys(keyVectors)) {
-        return;
+        return false;
     }
     hashSelVec.setSelSize(keyVectors[0]->state->getSelVector().getSelSize());
     VectorHashFunction::computeHash(*keyVectors[0], keyVectors[0]->state->getSelVector(),
@@ -145,9 +185,42 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         VectorHashFunction::combineHash(hashVector, hashSelVec, *tmpHashResultVector, hashSelVec,
             hashVector, hashSelVec);
     }
-    for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
-        KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
+    return true;
+}
+
+void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
+    SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
+    if (getNumEntries() == 0) {
+        return;
+    }
+    if (!computeProbeHashes(keyVectors, hashVector, hashSelVec, tmpHashResultVector)) {
+        return;
+    }
+    // The lookups of different keys are independent, so each step is issued for the whole batch
+    // before its results are used. This overlaps the cache misses on the directory, the slots and
+    // the chain heads instead of waiting on them one key at a time.
+    const auto numKeys = hashSelVec.getSelSize();
+    KU_ASSERT(numKeys <= DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < numKeys; i++) {
+        prefetch(getSlotTag(getSlotIdxForHash(hashVector.getValue<hash_t>(hashSelVec[i]))));
+    }
+    // The slot of every key whose tag matches is kept in probedTuples until it is read.
+    for (auto i = 0u; i < numKeys; i++) {
+        const auto hash = hashVector.getValue<hash_t>(hashSelVec[i]);
+        const auto slotIdx = getSlotIdxForHash(hash);
+        if (*getSlotTag(slotIdx) & getTagForHash(hash)) {
+            auto slot = getHashSlot(slotIdx);
+            prefetch(slot);
+            probedTuples[i] = reinterpret_cast<uint8_t*>(slot);
+        } else {
+            probedTuples[i] = nullptr;
+        }
+    }
+    for (auto i = 0u; i < numKeys; i++) {
+        if (probedTuples[i] != nullptr) {
+            probedTuples[i] = *reinterpret_cast<uint8_t**>(probedTuples[i]);
+            prefetch(probedTuples[i]);
+        }
     }
 }
 
@@ -186,14 +259,48 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
     return numMatchedTuples;
 }
 
+void JoinHashTable::partitionTuples(
+    const std::function<JoinHashTable&(hash_t)>& partitionFunc, JoinHashTable& overflowTable) {
+    const auto numBytesPerTuple = getTableSchema()->getNumBytesPerTuple();
+    const auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        const uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto& partition = partitionFunc(*(hash_t*)(tuple + hashColOffset));
+            memcpy(partition.factorizedTable->appendEmptyTuple(), tuple, numBytesPerTuple);
+            tuple += numBytesPerTuple;
+        }
+    }
+    if (&overflowTable != this) {
+        auto& overflowFTable = *overflowTable.factorizedTable;
+        overflowFTable.mergeMayContainNulls(*factorizedTable);
+        overflowFTable.unFlatTupleBlockCollection->append(
+            std::move(factorizedTable->unFlatTupleBlockCollection));
+        factorizedTable->unFlatTupleBlockCollection = std::make_unique<DataBlockCollection>();
+        overflowFTable.inMemOverflowBuffer->merge(*factorizedTable->inMemOverflowBuffer);
+    }
+    releaseTupleBlocks();
+}
+
+std::vector<std::unique_ptr<DataBlock>> JoinHashTable::releaseTupleBlocks() {
+    factorizedTable->numTuples = 0;
+    return factorizedTable->flatTupleBlockCollection->releaseBlocks();
+}
+
+void JoinHashTable::appendTupleBlock(std::unique_ptr<DataBlock> block) {
+    factorizedTable->numTuples += block->numTuples;
+    factorizedTable->flatTupleBlockCollection->append(std::move(block));
+}
+
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
     auto hash = *(hash_t*)(tuple + getHashValueColOffset());
     auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    return getHashSlot(slotIdx);
 }
 
 uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
+    auto hash = *(hash_t*)(tuple + getHashValueColOffset());
+    *getSlotTag(getSlotIdxForHash(hash)) |= getTagForHash(hash);
     auto slot = findHashSlot(tuple);
     auto prevPtr = *slot;
     *slot = tuple;
@@ -89,7 +89,22 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                 lookupPos[i] = (keyVector->state->getSelVector()[i]);
             }
 
+            // look up all the non-null keys as a batch, but report errors in the order of the keys
+            std::vector<sel_t> nonNullPos;
+            if constexpr (hasNoNullsGuarantee) {
+                nonNullPos = lookupPos;
+            } else {
+                for (auto pos : lookupPos) {
+                    if (!keyVector->isNull(pos)) {
+                        nonNullPos.push_back(pos);
+                    }
+                }
+            }
+            std::vector<offset_t> lookupOffsets(nonNullPos.size());
+            info.nodeTable->lookupPKs(transaction, keyVector, nonNullPos, lookupOffsets);
+
             OffsetVectorManager resultManager{resultVector, errorHandler};
+            auto nonNullIdx = 0u;
             for (auto i = 0u; i < numKeys; i++) {
                 auto pos = lookupPos[i];
                 if constexpr (!hasNoNullsGuarantee) {
@@ -97,8 +112,8 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                         continue;
                     }
                 }
-                offset_t lookupOffset = 0;
-                if (!info.nodeTable->lookupPK(transaction, keyVector, pos, lookupOffset)) {
+                auto lookupOffset = lookupOffsets[nonNullIdx++];
+                if (lookupOffset == INVALID_OFFSET) {
                     TypeUtils::visit(keyVector->dataType, [&]<typename type>(type) {
                         errorHandler->handleError(
                             ExceptionMessage::nonExistentPKException(
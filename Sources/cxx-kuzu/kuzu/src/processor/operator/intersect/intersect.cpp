@@ -69,6 +69,33 @@ void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVect
     auto rightPositionBuffer = rSelVector.getMutableBuffer();
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
+    const auto rightSize = rSelVector.getSelSize();
+    if (rightSize >= GALLOPING_SIZE_RATIO * lSelVector.getSelSize()) {
+        for (; leftPosition < lSelVector.getSelSize() && rightPosition < rightSize;
+             leftPosition++) {
+            auto leftNodeID = leftNodeIDs[leftPosition];
+            // Doubles the step until it passes the left value, then binary searches the last step.
+            sel_t step = 1;
+            while (rightPosition + step < rightSize &&
+                   rightNodeIDs[rightPosition + step] < leftNodeID) {
+                step *= 2;
+            }
+            const auto searchEnd = std::min<uint64_t>(rightPosition + step + 1, rightSize);
+            rightPosition = std::lower_bound(rightNodeIDs + rightPosition + step / 2,
+                                rightNodeIDs + searchEnd, leftNodeID) -
+                            rightNodeIDs;
+            if (rightPosition < rightSize && rightNodeIDs[rightPosition] == leftNodeID) {
+                leftPositionBuffer[outputValuePosition] = leftPosition;
+                rightPositionBuffer[outputValuePosition] = rightPosition;
+                leftNodeIDs[outputValuePosition] = leftNodeID;
+                rightPosition++;
+                outputValuePosition++;
+            }
+        }
+        lSelVector.setToFiltered(outputValuePosition);
+        rSelVector.setToFiltered(outputValuePosition);
+        return;
+    }
     while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
         auto leftNodeID = leftNodeIDs[leftPosition];
         auto rightNodeID = rightNodeIDs[rightPosition];
@@ -9,13 +9,29 @@ std::string LimitPrintInfo::toString() const {
     return "Limit: " + std::to_string(limitNum);
 }
 
+void Limit::initLocalStateInternal(ResultSet* /*resultSet*/, ExecutionContext* /*context*/) {
+    // The source of the pipeline is reached through the first child of each operator.
+    auto source = children[0].get();
+    while (!source->isSource()) {
+        source = source->getChild(0);
+    }
+    source->setStopSignal(limitReached.get());
+}
+
 bool Limit::getNextTuplesInternal(ExecutionContext* context) {
+    // end of execution due to limit has been reached by any thread
+    if (limitReached->load(std::memory_order_relaxed)) {
+        return false;
+    }
     // end of execution due to no more input
     if (!children[0]->getNextTuple(context)) {
         return false;
     }
     auto numTupleAvailable = resultSet->getNumTuples(dataChunksPosInScope);
     auto numTupleProcessedBefore = counter->fetch_add(numTupleAvailable);
+    if (numTupleProcessedBefore + numTupleAvailable >= limitNumber) {
+        limitReached->store(true, std::memory_order_relaxed);
+    }
     if (numTupleProcessedBefore + numTupleAvailable > limitNumber) {
         int64_t numTupleToProcessInCurrentResultSet = limitNumber - numTupleProcessedBefore;
         // end of execution due to limit has reached
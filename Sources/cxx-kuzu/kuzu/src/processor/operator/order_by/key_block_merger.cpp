@@ -1,6 +1,7 @@
 #include "processor/operator/order_by/key_block_merger.h"
 
 #include "common/system_config.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::processor;
@@ -30,6 +31,31 @@ MergedKeyBlocks::MergedKeyBlocks(uint32_t numBytesPerTuple, std::shared_ptr<Data
     keyBlocks.emplace_back(std::move(keyBlock));
 }
 
+MergedKeyBlocks::MergedKeyBlocks(uint32_t numBytesPerTuple, uint64_t numTuples,
+    std::vector<uint64_t> spilledBlockPositions, MemoryManager* memoryManager, Spiller* spiller)
+    : numBytesPerTuple{numBytesPerTuple},
+      numTuplesPerBlock{(uint32_t)(DATA_BLOCK_SIZE / numBytesPerTuple)}, numTuples{numTuples},
+      keyBlocks(spilledBlockPositions.size()), endTupleOffset{numTuplesPerBlock * numBytesPerTuple},
+      memoryManager{memoryManager}, spiller{spiller},
+      spilledBlockPositions{std::move(spilledBlockPositions)} {}
+
+void MergedKeyBlocks::spill(Spiller& spiller_, MemoryManager& memoryManager_) {
+    KU_ASSERT(!isSpilled());
+    for (auto& keyBlock : keyBlocks) {
+        spilledBlockPositions.push_back(spiller_.spillToDisk(keyBlock->getSizedData()));
+        keyBlock.reset();
+    }
+    spiller = &spiller_;
+    memoryManager = &memoryManager_;
+}
+
+void MergedKeyBlocks::loadKeyBlock(uint32_t idx) const {
+    KU_ASSERT(isSpilled());
+    auto keyBlock = std::make_shared<DataBlock>(memoryManager, DATA_BLOCK_SIZE);
+    spiller->loadFromDisk(keyBlock->getSizedData(), spilledBlockPositions[idx]);
+    keyBlocks[idx] = std::move(keyBlock);
+}
+
 uint8_t* MergedKeyBlocks::getBlockEndTuplePtr(uint32_t blockIdx, uint64_t endTupleIdx,
     uint32_t endTupleBlockIdx) const {
     KU_ASSERT(blockIdx < keyBlocks.size());
@@ -57,6 +83,7 @@ BlockPtrInfo::BlockPtrInfo(uint64_t startTupleIdx, uint64_t endTupleIdx, MergedK
 
 void BlockPtrInfo::updateTuplePtrIfNecessary() {
     if (curTuplePtr == curBlockEndTuplePtr) {
+        keyBlocks->releaseKeyBlock(curBlockIdx);
         curBlockIdx++;
         if (curBlockIdx <= endBlockIdx) {
             curTuplePtr = keyBlocks->getKeyBlockBuffer(curBlockIdx);
@@ -66,75 +93,44 @@ void BlockPtrInfo::updateTuplePtrIfNecessary() {
     }
 }
 
-uint64_t KeyBlockMergeTask::findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) const {
-    // Find a tuple in the right memory block such that:
-    // 1. The value of the current tuple is smaller than the value in leftEndTuple.
-    // 2. Either the value of next tuple is larger than the value in leftEndTuple or
-    // the current tuple is the last tuple in the right memory block.
-    int64_t startIdx = rightKeyBlockNextIdx;
-    int64_t endIdx = rightKeyBlock->getNumTuples() - 1;
-
-    while (startIdx <= endIdx) {
-        uint64_t curTupleIdx = (startIdx + endIdx) / 2;
-        uint8_t* curTuplePtr = rightKeyBlock->getTuple(curTupleIdx);
-
-        if (keyBlockMerger.compareTuplePtr(leftEndTuplePtr, curTuplePtr)) {
-            if (curTupleIdx == rightKeyBlock->getNumTuples() - 1 ||
-                !keyBlockMerger.compareTuplePtr(leftEndTuplePtr,
-                    rightKeyBlock->getTuple(curTupleIdx + 1))) {
-                // If the current tuple is the last tuple or the value of next tuple is larger than
-                // the value of leftEndTuple, return the curTupleIdx.
-                return curTupleIdx;
-            } else {
-                startIdx = curTupleIdx + 1;
-            }
+uint64_t KeyBlockMergeTask::findLeftSplitIdx(uint64_t numMergedTuples) const {
+    // Ties are merged from the left key block first, so the split takes i left tuples and
+    // numMergedTuples - i right tuples for the smallest i such that the i-th left tuple is larger
+    // than the last right tuple taken.
+    const auto numLeftTuples = leftKeyBlock->getNumTuples();
+    const auto numRightTuples = rightKeyBlock->getNumTuples();
+    auto startIdx =
+        std::max(leftKeyBlockNextIdx, numMergedTuples - std::min(numMergedTuples, numRightTuples));
+    auto endIdx = std::min(numMergedTuples - rightKeyBlockNextIdx, numLeftTuples);
+    while (startIdx < endIdx) {
+        const auto leftIdx = (startIdx + endIdx) / 2;
+        const auto rightIdx = numMergedTuples - leftIdx;
+        if (rightIdx > 0 && !keyBlockMerger.compareTuplePtr(leftKeyBlock->getTuple(leftIdx),
+                                rightKeyBlock->getTuple(rightIdx - 1))) {
+            startIdx = leftIdx + 1;
         } else {
-            endIdx = curTupleIdx - 1;
+            endIdx = leftIdx;
         }
     }
-    // If such tuple doesn't exist, return -1.
-    return -1;
+    return startIdx;
 }
 
 std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTask::getMorsel() {
-    // We grab a batch of tuples from the left memory block, then do a binary search on the
-    // right memory block to find the range of tuples to merge.
+    // Each morsel merges the next batch of tuples of the result, split between the left and right
+    // key blocks where the merge path crosses the diagonal at the end of the batch, so morsels
+    // are evenly sized however the values of both key blocks interleave.
     activeMorsels++;
-    if (rightKeyBlockNextIdx >= rightKeyBlock->getNumTuples()) {
-        // If there is no more tuples left in the right key block,
-        // just append all tuples in the left key block to the result key block.
-        auto keyBlockMergeMorsel =
-            std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples(),
-                rightKeyBlock->getNumTuples(), rightKeyBlock->getNumTuples());
-        leftKeyBlockNextIdx = leftKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    }
-
-    auto leftKeyBlockStartIdx = leftKeyBlockNextIdx;
-    leftKeyBlockNextIdx += batch_size;
-
-    if (leftKeyBlockNextIdx >= leftKeyBlock->getNumTuples()) {
-        // This is the last batch of tuples in the left key block to merge, so just merge it with
-        // remaining tuples of the right key block.
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightKeyBlock->getNumTuples());
-        rightKeyBlockNextIdx = rightKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    } else {
-        // Conduct a binary search to find the ending index in the right memory block.
-        auto leftEndIdxPtr = leftKeyBlock->getTuple(leftKeyBlockNextIdx - 1);
-        auto rightEndIdx = findRightKeyBlockIdx(leftEndIdxPtr);
-
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightEndIdx == (uint64_t)-1 ? rightKeyBlockNextIdx : ++rightEndIdx);
-
-        if (rightEndIdx != (uint64_t)-1) {
-            rightKeyBlockNextIdx = rightEndIdx;
-        }
-        return keyBlockMergeMorsel;
-    }
+    const auto numTuples = leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples();
+    const auto numMergedTuples =
+        std::min<uint64_t>(leftKeyBlockNextIdx + rightKeyBlockNextIdx + batch_size, numTuples);
+    const auto leftEndIdx = numMergedTuples == numTuples ? leftKeyBlock->getNumTuples() :
+                                                           findLeftSplitIdx(numMergedTuples);
+    const auto rightEndIdx = numMergedTuples - leftEndIdx;
+    auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx,
+        leftEndIdx, rightKeyBlockNextIdx, rightEndIdx);
+    leftKeyBlockNextIdx = leftEndIdx;
+    rightKeyBlockNextIdx = rightEndIdx;
+    return keyBlockMergeMorsel;
 }
 
 void KeyBlockMerger::mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) const {
@@ -180,6 +176,58 @@ void KeyBlockMerger::mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) co
     copyRemainingBlockDataToResult(leftBlockPtrInfo, resultBlockPtrInfo);
 }
 
+std::shared_ptr<MergedKeyBlocks> KeyBlockMerger::mergeRunsToDisk(
+    const std::vector<std::shared_ptr<MergedKeyBlocks>>& runs, MemoryManager& memoryManager,
+    Spiller& spiller) const {
+    struct RunCursor {
+        MergedKeyBlocks* run;
+        uint64_t tupleIdx;
+        uint8_t* tuplePtr;
+    };
+    // The priority queue keeps the smallest tuple on top.
+    auto compareCursors = [this](const RunCursor& left, const RunCursor& right) {
+        return compareTuplePtr(left.tuplePtr, right.tuplePtr);
+    };
+    std::priority_queue<RunCursor, std::vector<RunCursor>, decltype(compareCursors)> cursors{
+        compareCursors};
+    uint64_t numTuples = 0;
+    for (auto& run : runs) {
+        if (run->getNumTuples() > 0) {
+            cursors.push(RunCursor{run.get(), 0, run->getTuple(0)});
+            numTuples += run->getNumTuples();
+        }
+    }
+    auto resultBlock = std::make_unique<DataBlock>(&memoryManager, DATA_BLOCK_SIZE);
+    const auto numTuplesPerBlock = DATA_BLOCK_SIZE / numBytesPerTuple;
+    std::vector<uint64_t> resultBlockPositions;
+    uint64_t numTuplesInResultBlock = 0;
+    while (!cursors.empty()) {
+        auto cursor = cursors.top();
+        cursors.pop();
+        memcpy(resultBlock->getData() + numTuplesInResultBlock * numBytesPerTuple,
+            cursor.tuplePtr, numBytesPerTuple);
+        if (++numTuplesInResultBlock == numTuplesPerBlock) {
+            resultBlockPositions.push_back(spiller.spillToDisk(resultBlock->getSizedData()));
+            numTuplesInResultBlock = 0;
+        }
+        const auto runNumTuplesPerBlock = cursor.run->getNumTuplesPerBlock();
+        cursor.tupleIdx++;
+        if (cursor.tupleIdx % runNumTuplesPerBlock == 0 ||
+            cursor.tupleIdx == cursor.run->getNumTuples()) {
+            cursor.run->releaseKeyBlock((cursor.tupleIdx - 1) / runNumTuplesPerBlock);
+        }
+        if (cursor.tupleIdx < cursor.run->getNumTuples()) {
+            cursor.tuplePtr = cursor.run->getTuple(cursor.tupleIdx);
+            cursors.push(cursor);
+        }
+    }
+    if (numTuplesInResultBlock > 0) {
+        resultBlockPositions.push_back(spiller.spillToDisk(resultBlock->getSizedData()));
+    }
+    return std::make_shared<MergedKeyBlocks>(numBytesPerTuple, numTuples,
+        std::move(resultBlockPositions), &memoryManager, &spiller);
+}
+
 // This function returns true if the value in the leftTuplePtr is larger than the value in the
 // rightTuplePtr.
 bool KeyBlockMerger::compareTuplePtrWithStringCol(uint8_t* leftTuplePtr,
@@ -311,6 +359,27 @@ void KeyBlockMergeTaskDispatcher::doneMorsel(std::unique_ptr<KeyBlockMergeMorsel
     }
 }
 
+std::vector<std::shared_ptr<MergedKeyBlocks>> KeyBlockMergeTaskDispatcher::getRunsToMerge() {
+    std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
+    KU_ASSERT(spiller != nullptr);
+    std::vector<std::shared_ptr<MergedKeyBlocks>> runs;
+    if (sortedKeyBlocks->size() <= 1) {
+        return runs;
+    }
+    while (!sortedKeyBlocks->empty() && runs.size() < MAX_NUM_RUNS_PER_EXTERNAL_MERGE) {
+        runs.push_back(sortedKeyBlocks->front());
+        sortedKeyBlocks->pop();
+    }
+    numActiveExternalMerges++;
+    return runs;
+}
+
+void KeyBlockMergeTaskDispatcher::doneMergingRuns(std::shared_ptr<MergedKeyBlocks> mergedRun) {
+    std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
+    numActiveExternalMerges--;
+    sortedKeyBlocks->emplace(std::move(mergedRun));
+}
+
 void KeyBlockMergeTaskDispatcher::init(MemoryManager* memoryManager,
     std::queue<std::shared_ptr<MergedKeyBlocks>>* sortedKeyBlocks,
     std::vector<FactorizedTable*> factorizedTables, std::vector<StrKeyColInfo>& strKeyColsInfo,
@@ -18,8 +18,19 @@ void OrderByMerge::initLocalStateInternal(ResultSet* /*resultSet*/, ExecutionCon
         sharedState->getStrKeyColInfo(), sharedState->getNumBytesPerTuple());
 }
 
-void OrderByMerge::executeInternal(ExecutionContext* /*context*/) {
+void OrderByMerge::executeInternal(ExecutionContext* context) {
     while (!sharedDispatcher->isDoneMerge()) {
+        if (auto spiller = sharedDispatcher->getExternalMergeSpiller()) {
+            auto runs = sharedDispatcher->getRunsToMerge();
+            if (runs.empty()) {
+                std::this_thread::sleep_for(
+                    std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+                continue;
+            }
+            sharedDispatcher->doneMergingRuns(localMerger->mergeRunsToDisk(runs,
+                *storage::MemoryManager::Get(*context->clientContext), *spiller));
+            continue;
+        }
         auto keyBlockMergeMorsel = sharedDispatcher->getMorsel();
         if (keyBlockMergeMorsel == nullptr) {
             std::this_thread::sleep_for(
@@ -36,6 +47,9 @@ void OrderByMerge::initGlobalStateInternal(ExecutionContext* context) {
     sharedDispatcher->init(storage::MemoryManager::Get(*context->clientContext),
         sharedState->getSortedKeyBlocks(), sharedState->getPayloadTables(),
         sharedState->getStrKeyColInfo(), sharedState->getNumBytesPerTuple());
+    if (auto spiller = sharedState->getSpillerIfSpilled()) {
+        sharedDispatcher->enableExternalMerge(*spiller);
+    }
 }
 
 } // namespace processor
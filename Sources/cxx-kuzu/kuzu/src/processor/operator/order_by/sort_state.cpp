@@ -4,6 +4,7 @@
 
 #include "common/constants.h"
 #include "common/system_config.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 
@@ -26,6 +27,11 @@ void SortSharedState::init(const OrderByDataInfo& orderByDataInfo) {
     numBytesPerTuple = encodedKeyBlockColOffset + OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX;
 }
 
+void SortSharedState::enableSpilling(storage::Spiller& spiller,
+    storage::MemoryManager& memoryManager, uint64_t memoryBudget) {
+    spillInfo = std::make_unique<SpillInfo>(spiller, memoryManager, memoryBudget);
+}
+
 std::pair<uint64_t, FactorizedTable*> SortSharedState::getLocalPayloadTable(
     storage::MemoryManager& memoryManager, const FactorizedTableSchema& payloadTableSchema) {
     std::unique_lock lck{mtx};
@@ -38,6 +44,15 @@ std::pair<uint64_t, FactorizedTable*> SortSharedState::getLocalPayloadTable(
 
 void SortSharedState::appendLocalSortedKeyBlock(
     const std::shared_ptr<MergedKeyBlocks>& mergedDataBlocks) {
+    if (spillInfo != nullptr) {
+        const auto numBytes = mergedDataBlocks->getNumKeyBlocks() * TEMP_PAGE_SIZE;
+        if (spillInfo->numBytesInMemory.fetch_add(numBytes) + numBytes >
+            spillInfo->memoryBudget) {
+            spillInfo->numBytesInMemory -= numBytes;
+            mergedDataBlocks->spill(spillInfo->spiller, spillInfo->memoryManager);
+            spillInfo->hasSpilled = true;
+        }
+    }
     std::unique_lock lck{mtx};
     sortedKeyBlocks->emplace(mergedDataBlocks);
 }
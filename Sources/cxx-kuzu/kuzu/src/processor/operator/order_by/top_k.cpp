@@ -61,11 +61,12 @@ void TopKSortState::finalize() {
 }
 
 void TopKBuffer::init(storage::MemoryManager* memoryManager_, uint64_t skipNumber,
-    uint64_t limitNumber) {
+    uint64_t limitNumber, std::shared_ptr<storage::TopKFilter> filter_) {
     this->memoryManager = memoryManager_;
     sortState->init(*orderByDataInfo, memoryManager_);
     this->skip = skipNumber;
     this->limit = limitNumber;
+    this->filter = std::move(filter_);
     initVectors();
     initCompareFuncs();
 }
@@ -190,6 +191,9 @@ void TopKBuffer::setBoundaryValue() {
         boundaryVec->copyFromVectorData(dstData, srcVector, srcData);
         hasBoundaryValue = true;
     }
+    if (filter != nullptr) {
+        filter->update(*boundaryVecs[0], boundaryVecs[0]->state->getSelVector()[0]);
+    }
 }
 
 bool TopKBuffer::compareBoundaryValue(const std::vector<common::ValueVector*>& keyVectors) {
@@ -246,9 +250,9 @@ void TopKBuffer::appendSelState(common::SelectionVector* selVector,
 
 void TopKLocalState::init(const OrderByDataInfo& orderByDataInfo,
     storage::MemoryManager* memoryManager, ResultSet& /*resultSet*/, uint64_t skipNumber,
-    uint64_t limitNumber) {
+    uint64_t limitNumber, std::shared_ptr<storage::TopKFilter> filter) {
     buffer = std::make_unique<TopKBuffer>(orderByDataInfo);
-    buffer->init(memoryManager, skipNumber, limitNumber);
+    buffer->init(memoryManager, skipNumber, limitNumber, std::move(filter));
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
@@ -261,7 +265,7 @@ void TopKLocalState::append(const std::vector<common::ValueVector*>& keyVectors,
 void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     localState = TopKLocalState();
     localState.init(info, storage::MemoryManager::Get(*context->clientContext), *resultSet,
-        skipNumber, limitNumber);
+        skipNumber, limitNumber, sharedState->getFilter());
     for (auto& dataPos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(dataPos).get());
     }
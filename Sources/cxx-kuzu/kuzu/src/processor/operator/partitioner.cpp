@@ -1,7 +1,9 @@
 #include "processor/operator/partitioner.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
@@ -94,6 +96,7 @@ void Partitioner::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*
     localState = std::make_unique<PartitionerLocalState>();
     initializePartitioningStates(dataInfo.columnTypes, localState->partitioningBuffers,
         sharedState->numPartitions, info.infos.size());
+    localState->memoryBudget = context->clientContext->getClientConfig()->copyMemoryBudget;
     for (const auto& evaluator : dataInfo.columnEvaluators) {
         evaluator->init(*resultSet, context->clientContext);
     }
@@ -128,6 +131,7 @@ void Partitioner::initializePartitioningStates(const logical_type_vec_t& columnT
 
 void Partitioner::executeInternal(ExecutionContext* context) {
     const auto relOffsetVector = resultSet->getValueVector(info.relOffsetDataPos);
+    auto memoryManager = MemoryManager::Get(*context->clientContext);
     while (children[0]->getNextTuple(context)) {
         KU_ASSERT(dataInfo.columnEvaluators.size() >= 1);
         const auto numRels = relOffsetVector->state->getSelVector().getSelSize();
@@ -143,8 +147,10 @@ void Partitioner::executeInternal(ExecutionContext* context) {
             partitionIdxes->state = keyVector->state;
             partitionInfo.partitionerFunc(keyVector.get(), partitionIdxes.get());
             auto chunkToCopyFrom = constructDataChunk(keyVector->state);
-            copyDataToPartitions(*MemoryManager::Get(*context->clientContext), partitioningIdx,
-                chunkToCopyFrom);
+            copyDataToPartitions(*memoryManager, partitioningIdx, chunkToCopyFrom);
+        }
+        if (localState->memoryBudget > 0) {
+            memoryManager->getBufferManager()->spillUnusedChunks(localState->memoryBudget);
         }
     }
     sharedState->merge(localState->partitioningBuffers);
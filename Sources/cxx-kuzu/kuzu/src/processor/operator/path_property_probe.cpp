@@ -59,10 +59,17 @@ static void copyInternalID(ValueVector* srcVector, ValueVector* dstIDVector,
     ValueVector* dstLabelVector,
     const std::unordered_map<common::table_id_t, std::string>& tableIDToName) {
     auto srcDataVector = ListVector::getDataVector(srcVector);
+    // Paths mostly go through the nodes and rels of a few tables.
+    auto prevTableID = INVALID_TABLE_ID;
+    const std::string* label = nullptr;
     for (auto i = 0u; i < ListVector::getDataVectorSize(srcVector); ++i) {
         auto id = srcDataVector->getValue<internalID_t>(i);
         dstIDVector->setValue(i, id);
-        StringVector::addString(dstLabelVector, i, tableIDToName.at(id.tableID));
+        if (id.tableID != prevTableID) {
+            prevTableID = id.tableID;
+            label = &tableIDToName.at(id.tableID);
+        }
+        StringVector::addString(dstLabelVector, i, *label);
     }
 }
 
@@ -288,18 +295,35 @@ bool PathPropertyProbe::getNextTuplesInternal(ExecutionContext* context) {
 
 void PathPropertyProbe::probe(kuzu::processor::JoinHashTable* hashTable, uint64_t sizeProbed,
     uint64_t sizeToProbe, ValueVector* idVector, const std::vector<ValueVector*>& propertyVectors,
-    const std::vector<ft_col_idx_t>& colIndicesToScan) const {
+    const std::vector<ft_col_idx_t>& colIndicesToScan) {
+    // Paths share many of their nodes and rels, e.g. all paths from a source start at the same
+    // node, so each distinct ID of the batch is only probed once.
+    localState.firstPosOfIDs.clear();
+    for (auto i = 0u; i < sizeToProbe; ++i) {
+        auto id = idVector->getValue<internalID_t>(sizeProbed + i);
+        localState.firstPositions[i] = localState.firstPosOfIDs.emplace(id, i).first->second;
+    }
     // Hash
     for (auto i = 0u; i < sizeToProbe; ++i) {
+        if (localState.firstPositions[i] != i) {
+            continue;
+        }
         function::Hash::operation(idVector->getValue<internalID_t>(sizeProbed + i),
             localState.hashes[i]);
     }
     // Probe hash
     for (auto i = 0u; i < sizeToProbe; ++i) {
+        if (localState.firstPositions[i] != i) {
+            continue;
+        }
         localState.probedTuples[i] = hashTable->getTupleForHash(localState.hashes[i]);
     }
     // Match value
     for (auto i = 0u; i < sizeToProbe; ++i) {
+        if (localState.firstPositions[i] != i) {
+            localState.matchedTuples[i] = localState.matchedTuples[localState.firstPositions[i]];
+            continue;
+        }
         while (localState.probedTuples[i]) {
             auto currentTuple = localState.probedTuples[i];
             if (*(internalID_t*)currentTuple == idVector->getValue<internalID_t>(sizeProbed + i)) {
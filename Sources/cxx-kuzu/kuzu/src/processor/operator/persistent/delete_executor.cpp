@@ -19,8 +19,9 @@ void NodeDeleteInfo::init(const ResultSet& resultSet) {
     nodeIDVector = resultSet.getValueVector(nodeIDPos).get();
 }
 
-void NodeTableDeleteInfo::init(const ResultSet& resultSet) {
+void NodeTableDeleteInfo::init(const ResultSet& resultSet, ValueVector& nodeIDVector) {
     pkVector = resultSet.getValueVector(pkPos).get();
+    deleteState = std::make_unique<NodeTableDeleteState>(nodeIDVector, *pkVector);
 }
 
 static void throwDeleteNodeWithConnectedEdgesError(const std::string& tableName,
@@ -68,15 +69,13 @@ void NodeDeleteExecutor::init(ResultSet* resultSet, ExecutionContext*) {
 
 void SingleLabelNodeDeleteExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
     NodeDeleteExecutor::init(resultSet, context);
-    tableInfo.init(*resultSet);
+    tableInfo.init(*resultSet, *info.nodeIDVector);
 }
 
 void SingleLabelNodeDeleteExecutor::delete_(ExecutionContext* context) {
     KU_ASSERT(tableInfo.pkVector->state == info.nodeIDVector->state);
-    auto deleteState =
-        std::make_unique<NodeTableDeleteState>(*info.nodeIDVector, *tableInfo.pkVector);
     auto transaction = Transaction::Get(*context->clientContext);
-    if (!tableInfo.table->delete_(transaction, *deleteState)) {
+    if (!tableInfo.table->delete_(transaction, *tableInfo.deleteState)) {
         return;
     }
     switch (info.deleteType) {
@@ -94,7 +93,7 @@ void SingleLabelNodeDeleteExecutor::delete_(ExecutionContext* context) {
 void MultiLabelNodeDeleteExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
     NodeDeleteExecutor::init(resultSet, context);
     for (auto& [_, tableInfo] : tableInfos) {
-        tableInfo.init(*resultSet);
+        tableInfo.init(*resultSet, *info.nodeIDVector);
     }
 }
 
@@ -107,10 +106,8 @@ void MultiLabelNodeDeleteExecutor::delete_(ExecutionContext* context) {
     }
     const auto nodeID = info.nodeIDVector->getValue<internalID_t>(pos);
     const auto& tableInfo = tableInfos.at(nodeID.tableID);
-    auto deleteState =
-        std::make_unique<NodeTableDeleteState>(*info.nodeIDVector, *tableInfo.pkVector);
     auto transaction = Transaction::Get(*context->clientContext);
-    if (!tableInfo.table->delete_(transaction, *deleteState)) {
+    if (!tableInfo.table->delete_(transaction, *tableInfo.deleteState)) {
         return;
     }
     switch (info.deleteType) {
@@ -133,11 +130,11 @@ void RelDeleteInfo::init(const ResultSet& resultSet) {
 
 void RelDeleteExecutor::init(ResultSet* resultSet, ExecutionContext*) {
     info.init(*resultSet);
+    deleteState = std::make_unique<RelTableDeleteState>(*info.srcNodeIDVector,
+        *info.dstNodeIDVector, *info.relIDVector);
 }
 
 void SingleLabelRelDeleteExecutor::delete_(ExecutionContext* context) {
-    auto deleteState = std::make_unique<RelTableDeleteState>(*info.srcNodeIDVector,
-        *info.dstNodeIDVector, *info.relIDVector);
     table->delete_(Transaction::Get(*context->clientContext), *deleteState);
 }
 
@@ -148,8 +145,6 @@ void MultiLabelRelDeleteExecutor::delete_(ExecutionContext* context) {
     const auto relID = info.relIDVector->getValue<internalID_t>(pos);
     KU_ASSERT(tableIDToTableMap.contains(relID.tableID));
     auto table = tableIDToTableMap.at(relID.tableID);
-    auto deleteState = std::make_unique<RelTableDeleteState>(*info.srcNodeIDVector,
-        *info.dstNodeIDVector, *info.relIDVector);
     table->delete_(Transaction::Get(*context->clientContext), *deleteState);
 }
 
@@ -98,10 +98,12 @@ nodeID_t NodeInsertExecutor::insert(main::ClientContext* context) {
     if (checkConflict(transaction)) {
         return info.getNodeID();
     }
-    auto insertState = std::make_unique<storage::NodeTableInsertState>(*info.nodeIDVector,
-        *tableInfo.pkVector, tableInfo.columnDataVectors);
-    tableInfo.table->initInsertState(context, *insertState);
-    tableInfo.table->insert(transaction, *insertState);
+    if (!tableInfo.insertState) {
+        tableInfo.insertState = std::make_unique<storage::NodeTableInsertState>(
+            *info.nodeIDVector, *tableInfo.pkVector, tableInfo.columnDataVectors);
+        tableInfo.table->initInsertState(context, *tableInfo.insertState);
+    }
+    tableInfo.table->insert(transaction, *tableInfo.insertState);
     writeColumnVectors(info.columnVectors, tableInfo.columnDataVectors);
     return info.getNodeID();
 }
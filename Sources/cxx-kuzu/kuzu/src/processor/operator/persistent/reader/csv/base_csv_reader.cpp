@@ -315,14 +315,14 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
         // this state parses the remainder of a non-quoted value until we reach a delimiter or
         // newline
         do {
-            for (; position < bufferSize; position++) {
+            position = findNextOf(buffer.get(), position, bufferSize, option.delimiter, '\n', '\r');
+            if (position < bufferSize) {
                 if (buffer[position] == option.delimiter) {
                     // delimiter: end the value and add it to the chunk
                     goto add_value;
-                } else if (isNewLine(buffer[position])) {
-                    // newline: add row
-                    goto add_row;
                 }
+                // newline: add row
+                goto add_row;
             }
         } while (readBuffer(&start));
 
@@ -390,6 +390,11 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
         position++;
         do {
             for (; position < bufferSize; position++) {
+                position = findNextOf(buffer.get(), position, bufferSize, option.quoteChar,
+                    option.escapeChar, '\n', '\r');
+                if (position == bufferSize) {
+                    break;
+                }
                 if (driver.driverType == DriverType::SNIFF_CSV_DIALECT) {
                     auto& sniffDriver = reinterpret_cast<SniffCSVDialectDriver&>(driver);
                     sniffDriver.setEverQuoted();
@@ -10,9 +10,12 @@
 #include <io.h>
 #endif
 
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
 #include "common/string_format.h"
 #include "common/system_message.h"
 #include "function/table/table_function.h"
+#include "main/client_context.h"
 #include "processor/operator/persistent/reader/csv/driver.h"
 
 using namespace kuzu::common;
@@ -21,10 +24,66 @@ using namespace kuzu::function;
 namespace kuzu {
 namespace processor {
 
+static constexpr csv_quote_transition_t IDENTITY_QUOTE_TRANSITION = {CSVQuoteState::VALUE_START,
+    CSVQuoteState::UNQUOTED, CSVQuoteState::QUOTED, CSVQuoteState::ESCAPED,
+    CSVQuoteState::UNQUOTED_AFTER_QUOTE, CSVQuoteState::SKIP_LINE};
+
+void CSVBlockStartStates::setTransition(block_idx_t blockIdx,
+    const csv_quote_transition_t& transition) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(blockIdx >= nextBlockIdx);
+    transitions.emplace(blockIdx, transition);
+    auto resolvedAny = false;
+    while (transitions.contains(nextBlockIdx)) {
+        startStates.emplace(nextBlockIdx, nextBlockStartState);
+        nextBlockStartState =
+            transitions.at(nextBlockIdx)[static_cast<uint8_t>(nextBlockStartState)];
+        transitions.erase(nextBlockIdx);
+        nextBlockIdx++;
+        resolvedAny = true;
+    }
+    if (resolvedAny) {
+        lck.unlock();
+        cv.notify_all();
+    }
+}
+
+void CSVBlockStartStates::abort() {
+    {
+        std::unique_lock lck{mtx};
+        aborted = true;
+    }
+    cv.notify_all();
+}
+
+CSVQuoteState CSVBlockStartStates::getStartState(block_idx_t blockIdx,
+    const main::ClientContext& context) {
+    // Interrupts aren't notified, so they are checked periodically.
+    static constexpr auto INTERRUPT_CHECK_INTERVAL = std::chrono::milliseconds(10);
+    std::unique_lock lck{mtx};
+    while (!cv.wait_for(lck, INTERRUPT_CHECK_INTERVAL,
+        [&] { return aborted || startStates.contains(blockIdx); })) {
+        if (context.interrupted()) {
+            throw InterruptException{};
+        }
+    }
+    if (!startStates.contains(blockIdx)) {
+        throw RuntimeException(
+            stringFormat("Could not find the start of block {}, since the scan of a block before "
+                         "it failed.",
+                blockIdx));
+    }
+    auto startState = startStates.at(blockIdx);
+    startStates.erase(blockIdx);
+    return startState;
+}
+
 ParallelCSVReader::ParallelCSVReader(const std::string& filePath, idx_t fileIdx, CSVOption option,
-    CSVColumnInfo columnInfo, main::ClientContext* context, LocalFileErrorHandler* errorHandler)
+    CSVColumnInfo columnInfo, main::ClientContext* context, LocalFileErrorHandler* errorHandler,
+    CSVBlockStartStates* blockStartStates)
     : BaseCSVReader{filePath, fileIdx, std::move(option), std::move(columnInfo), context,
-          errorHandler} {}
+          errorHandler},
+      blockStartStates{blockStartStates} {}
 
 bool ParallelCSVReader::hasMoreToRead() const {
     // If we haven't started the first block yet or are done our block, get the next block.
@@ -34,7 +93,21 @@ bool ParallelCSVReader::hasMoreToRead() const {
 uint64_t ParallelCSVReader::parseBlock(block_idx_t blockIdx, DataChunk& resultChunk) {
     currentBlockIdx = blockIdx;
     resetNumRowsInCurrentBlock();
-    seekToBlockStart();
+    auto startState = CSVQuoteState::VALUE_START;
+    if (blockStartStates != nullptr) {
+        try {
+            readBlockStart();
+            blockStartStates->setTransition(blockIdx, computeBlockTransition());
+        } catch (...) {
+            // The threads parsing the blocks after this one would wait for its transition forever.
+            blockStartStates->abort();
+            throw;
+        }
+        startState = blockStartStates->getStartState(blockIdx, *context);
+    } else {
+        readBlockStart();
+    }
+    seekToBlockStart(startState);
     if (blockIdx == 0) {
         readBOM();
         if (option.hasHeader) {
@@ -63,7 +136,83 @@ uint64_t ParallelCSVReader::continueBlock(DataChunk& resultChunk) {
     return numRowsParsed;
 }
 
-void ParallelCSVReader::seekToBlockStart() {
+CSVQuoteState ParallelCSVReader::getNextState(CSVQuoteState state, char c) {
+    // This follows the states of BaseCSVReader::parseCSV.
+    switch (state) {
+    case CSVQuoteState::VALUE_START: {
+        if (c == option.quoteChar) {
+            return CSVQuoteState::QUOTED;
+        }
+        [[fallthrough]];
+    }
+    case CSVQuoteState::UNQUOTED: {
+        return c == option.delimiter || isNewLine(c) ? CSVQuoteState::VALUE_START :
+                                                       CSVQuoteState::UNQUOTED;
+    }
+    case CSVQuoteState::QUOTED: {
+        if (c == option.quoteChar) {
+            return CSVQuoteState::UNQUOTED_AFTER_QUOTE;
+        }
+        return c == option.escapeChar ? CSVQuoteState::ESCAPED : CSVQuoteState::QUOTED;
+    }
+    case CSVQuoteState::ESCAPED: {
+        return c == option.quoteChar || c == option.escapeChar ? CSVQuoteState::QUOTED :
+                                                                 CSVQuoteState::SKIP_LINE;
+    }
+    case CSVQuoteState::UNQUOTED_AFTER_QUOTE: {
+        if (c == option.quoteChar &&
+            (!option.escapeChar || option.escapeChar == option.quoteChar)) {
+            return CSVQuoteState::QUOTED;
+        }
+        if (c == option.delimiter || c == CopyConstants::DEFAULT_CSV_LIST_END_CHAR ||
+            isNewLine(c)) {
+            return CSVQuoteState::VALUE_START;
+        }
+        return CSVQuoteState::SKIP_LINE;
+    }
+    case CSVQuoteState::SKIP_LINE: {
+        return isNewLine(c) ? CSVQuoteState::VALUE_START : CSVQuoteState::SKIP_LINE;
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+csv_quote_transition_t ParallelCSVReader::computeBlockTransition() {
+    auto transition = IDENTITY_QUOTE_TRANSITION;
+    // The buffer normally spans the block already, but reads can return fewer bytes.
+    uint64_t bufferStart = 0;
+    while (bufferSize < CopyConstants::PARALLEL_BLOCK_SIZE && readBuffer(&bufferStart)) {}
+    position = 0;
+    const uint64_t blockSize = std::min<uint64_t>(CopyConstants::PARALLEL_BLOCK_SIZE, bufferSize);
+    const auto* blockBuffer = buffer.get();
+    uint64_t blockPosition = 0;
+    if (currentBlockIdx == 0 && blockSize >= 3 && blockBuffer[0] == '\xEF' &&
+        blockBuffer[1] == '\xBB' && blockBuffer[2] == '\xBF') {
+        blockPosition = 3;
+    }
+    while (blockPosition < blockSize) {
+        const auto next = findNextOf(blockBuffer, blockPosition, blockSize,
+            option.quoteChar, option.escapeChar, option.delimiter, '\n', '\r',
+            CopyConstants::DEFAULT_CSV_LIST_END_CHAR);
+        if (next > blockPosition) {
+            // A run of other characters has the same effect as a single one of them.
+            for (auto& state : transition) {
+                state = getNextState(state, blockBuffer[blockPosition]);
+            }
+        }
+        if (next == blockSize) {
+            break;
+        }
+        for (auto& state : transition) {
+            state = getNextState(state, blockBuffer[next]);
+        }
+        blockPosition = next + 1;
+    }
+    return transition;
+}
+
+void ParallelCSVReader::readBlockStart() {
     // Seek to the proper location in the file.
     if (fileInfo->seek(currentBlockIdx * CopyConstants::PARALLEL_BLOCK_SIZE, SEEK_SET) == -1) {
         // LCOV_EXCL_START
@@ -73,23 +222,28 @@ void ParallelCSVReader::seekToBlockStart() {
         // LCOV_EXCL_STOP
     }
     osFileOffset = currentBlockIdx * CopyConstants::PARALLEL_BLOCK_SIZE;
-
-    if (currentBlockIdx == 0) {
-        // First block doesn't search for a newline.
-        return;
-    }
-
-    // Reset the buffer.
     position = 0;
     bufferSize = 0;
     buffer.reset();
-    if (!readBuffer(nullptr)) {
+    readBuffer(nullptr);
+}
+
+void ParallelCSVReader::seekToBlockStart(CSVQuoteState startState) {
+    if (currentBlockIdx == 0 || bufferSize == 0) {
+        // First block doesn't search for a newline, and blocks past the end of the file have none.
         return;
     }
 
-    // Find the start of the next line.
+    // Find the start of the next row, which follows the first newline that isn't quoted.
+    auto state = startState;
     do {
         for (; position < bufferSize; position++) {
+            const auto quoted =
+                state == CSVQuoteState::QUOTED || state == CSVQuoteState::ESCAPED;
+            state = getNextState(state, buffer[position]);
+            if (quoted) {
+                continue;
+            }
             if (buffer[position] == '\r') {
                 position++;
                 if (!maybeReadBuffer(nullptr)) {
@@ -108,10 +262,7 @@ void ParallelCSVReader::seekToBlockStart() {
 }
 
 bool ParallelCSVReader::handleQuotedNewline() {
-    lineContext.setEndOfLine(getFileOffset());
-    handleCopyException("Quoted newlines are not supported in parallel CSV reader."
-                        " Please specify PARALLEL=FALSE in the options.");
-    return false;
+    return true;
 }
 
 bool ParallelCSVReader::finishedBlock() const {
@@ -127,6 +278,7 @@ ParallelCSVScanSharedState::ParallelCSVScanSharedState(FileScanInfo fileScanInfo
     errorHandlers.reserve(this->fileScanInfo.getNumFiles());
     for (idx_t i = 0; i < this->fileScanInfo.getNumFiles(); ++i) {
         errorHandlers.emplace_back(i, &mtx);
+        blockStartStates.push_back(std::make_unique<CSVBlockStartStates>());
     }
     populateErrorFunc = constructPopulateFunc();
     for (auto& errorHandler : errorHandlers) {
@@ -185,13 +337,20 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
         }
         if (fileIdx != localState->fileIdx) {
             localState->fileIdx = fileIdx;
-            localState->errorHandler =
-                std::make_unique<LocalFileErrorHandler>(&sharedState->errorHandlers[fileIdx],
-                    sharedState->csvOption.ignoreErrors, sharedState->context, true);
-            localState->reader =
-                std::make_unique<ParallelCSVReader>(sharedState->fileScanInfo.filePaths[fileIdx],
-                    fileIdx, sharedState->csvOption.copy(), sharedState->columnInfo.copy(),
-                    sharedState->context, localState->errorHandler.get());
+            try {
+                localState->errorHandler =
+                    std::make_unique<LocalFileErrorHandler>(&sharedState->errorHandlers[fileIdx],
+                        sharedState->csvOption.ignoreErrors, sharedState->context, true);
+                localState->reader = std::make_unique<ParallelCSVReader>(
+                    sharedState->fileScanInfo.filePaths[fileIdx], fileIdx,
+                    sharedState->csvOption.copy(), sharedState->columnInfo.copy(),
+                    sharedState->context, localState->errorHandler.get(),
+                    sharedState->blockStartStates[fileIdx].get());
+            } catch (...) {
+                // The claimed block won't be parsed, so its transition is never set.
+                sharedState->blockStartStates[fileIdx]->abort();
+                throw;
+            }
         }
         auto numRowsRead = localState->reader->parseBlock(blockIdx, outputChunk);
 
@@ -279,7 +438,8 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(
     for (idx_t i = 0; i < sharedState->fileScanInfo.getNumFiles(); ++i) {
         auto filePath = sharedState->fileScanInfo.filePaths[i];
         auto reader = std::make_unique<ParallelCSVReader>(filePath, i, csvOption.copy(),
-            columnInfo.copy(), bindData->context, nullptr);
+            columnInfo.copy(), bindData->context, nullptr /* errorHandler */,
+            nullptr /* blockStartStates */);
         sharedState->totalSize += reader->getFileSize();
     }
 
@@ -0,0 +1,104 @@
+#include "processor/operator/persistent/reader/hive_partitioning.h"
+
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+
+#include <string_view>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+static constexpr std::string_view DIRECTORY_SEPARATORS = "/\\";
+
+static int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// Decodes the %XX escapes of a path component. Malformed escapes are kept as they are.
+static std::string urlDecode(std::string_view component) {
+    std::string result;
+    result.reserve(component.size());
+    for (auto i = 0u; i < component.size(); i++) {
+        if (component[i] == '%' && i + 2 < component.size()) {
+            auto high = hexDigitValue(component[i + 1]);
+            auto low = hexDigitValue(component[i + 2]);
+            if (high >= 0 && low >= 0) {
+                result.push_back(static_cast<char>(high * 16 + low));
+                i += 2;
+                continue;
+            }
+        }
+        result.push_back(component[i]);
+    }
+    return result;
+}
+
+std::vector<HivePartitioning::Partition> HivePartitioning::getPartitions(
+    const std::string& filePath) {
+    std::vector<Partition> partitions;
+    // The last component of the path is the file name, which is never a partition.
+    auto end = filePath.find_last_of(DIRECTORY_SEPARATORS);
+    if (end == std::string::npos) {
+        return partitions;
+    }
+    uint64_t start = 0;
+    while (start < end) {
+        auto componentEnd = filePath.find_first_of(DIRECTORY_SEPARATORS, start);
+        auto component = std::string_view(filePath).substr(start, componentEnd - start);
+        auto separator = component.find('=');
+        if (separator != std::string_view::npos && separator > 0) {
+            auto value = component.substr(separator + 1);
+            partitions.push_back(Partition{urlDecode(component.substr(0, separator)),
+                value == DEFAULT_PARTITION_NAME ? std::nullopt :
+                                                  std::make_optional(urlDecode(value))});
+        }
+        start = componentEnd + 1;
+    }
+    return partitions;
+}
+
+std::vector<std::string> HivePartitioning::getPartitionKeys(
+    const std::vector<std::string>& filePaths) {
+    std::vector<std::string> keys;
+    for (auto i = 0u; i < filePaths.size(); i++) {
+        auto partitions = getPartitions(filePaths[i]);
+        if (i == 0) {
+            for (auto& partition : partitions) {
+                keys.push_back(std::move(partition.key));
+            }
+            continue;
+        }
+        auto sameKeys = partitions.size() == keys.size();
+        for (auto j = 0u; sameKeys && j < partitions.size(); j++) {
+            sameKeys = partitions[j].key == keys[j];
+        }
+        if (!sameKeys) {
+            throw BinderException(stringFormat(
+                "File {} is not partitioned by the same keys as {}.", filePaths[i], filePaths[0]));
+        }
+    }
+    return keys;
+}
+
+std::vector<std::optional<std::string>> HivePartitioning::getPartitionValues(
+    const std::string& filePath) {
+    std::vector<std::optional<std::string>> values;
+    for (auto& partition : getPartitions(filePath)) {
+        values.push_back(std::move(partition.value));
+    }
+    return values;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -123,8 +123,13 @@ uint64_t ColumnReader::read(uint64_t numValues, parquet_filter_t& filter, uint8_
     auto toRead = numValues;
 
     while (toRead > 0) {
-        while (pageRowsAvailable == 0) {
-            prepareRead(filter);
+        while (pageRowsAvailable == 0 && toRead > 0) {
+            auto numSkipped = prepareRead(filter, resultOffset, toRead, defineOut, resultOut);
+            resultOffset += numSkipped;
+            toRead -= numSkipped;
+        }
+        if (toRead == 0) {
+            break;
         }
 
         KU_ASSERT(block);
@@ -269,13 +274,47 @@ std::unique_ptr<ColumnReader> ColumnReader::createReader(ParquetReader& reader,
     }
 }
 
-void ColumnReader::prepareRead(parquet_filter_t& /*filter*/) {
+static uint64_t getNumDataPageValues(const kuzu_parquet::format::PageHeader& pageHdr) {
+    if (pageHdr.type == PageType::DATA_PAGE && pageHdr.__isset.data_page_header) {
+        return pageHdr.data_page_header.num_values;
+    }
+    if (pageHdr.type == PageType::DATA_PAGE_V2 && pageHdr.__isset.data_page_header_v2) {
+        return pageHdr.data_page_header_v2.num_values;
+    }
+    return 0;
+}
+
+uint64_t ColumnReader::prepareRead(parquet_filter_t& filter, uint64_t resultOffset,
+    uint64_t numValuesToRead, uint8_t* defineOut, common::ValueVector* resultOut) {
     dictDecoder.reset();
     defineDecoder.reset();
     block.reset();
     kuzu_parquet::format::PageHeader pageHdr;
     pageHdr.read(protocol);
 
+    // Values of repeated columns are not rows, so only pages of flat columns are skipped.
+    auto numPageValues = getNumDataPageValues(pageHdr);
+    if (!hasRepeats() && numPageValues > 0 && numPageValues <= numValuesToRead) {
+        auto anySelected = false;
+        for (auto i = resultOffset; i < resultOffset + numPageValues; i++) {
+            if (filter[i]) {
+                anySelected = true;
+                break;
+            }
+        }
+        if (!anySelected) {
+            auto& trans = reinterpret_cast<ThriftFileTransport&>(*protocol->getTransport());
+            trans.SetLocation(trans.GetLocation() + pageHdr.compressed_page_size);
+            if (hasDefines()) {
+                memset(defineOut + resultOffset, 0, numPageValues);
+            }
+            for (auto i = resultOffset; i < resultOffset + numPageValues; i++) {
+                resultOut->setNull(i, true);
+            }
+            return numPageValues;
+        }
+    }
+
     switch (pageHdr.type) {
     case PageType::DATA_PAGE_V2:
         preparePageV2(pageHdr);
@@ -293,6 +332,7 @@ void ColumnReader::prepareRead(parquet_filter_t& /*filter*/) {
         break; // ignore INDEX page type and any other custom extensions
     }
     resetPage();
+    return 0;
 }
 
 void ColumnReader::allocateBlock(uint64_t size) {
@@ -1,6 +1,7 @@
 #include "processor/operator/persistent/reader/parquet/parquet_reader.h"
 
 #include "binder/binder.h"
+#include "common/type_utils.h"
 #include "common/exception/binder.h"
 #include "common/exception/copy.h"
 #include "common/file_system/virtual_file_system.h"
@@ -8,12 +9,15 @@
 #include "function/table/bind_data.h"
 #include "function/table/bind_input.h"
 #include "function/table/table_function.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "processor/operator/persistent/reader/hive_partitioning.h"
 #include "processor/operator/persistent/reader/parquet/list_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/struct_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/thrift_tools.h"
 #include "processor/operator/persistent/reader/reader_bind_utils.h"
 #include "processor/warning_context.h"
+#include "storage/table/column_chunk_stats.h"
 
 using namespace kuzu_parquet::format;
 
@@ -27,6 +31,7 @@ ParquetReader::ParquetReader(std::string filePath, std::vector<bool> columnSkips
     main::ClientContext* context)
     : filePath{std::move(filePath)}, columnSkips(std::move(columnSkips)), context{context} {
     initMetadata();
+    initColumnChunkIdxs();
 }
 
 void ParquetReader::initializeScan(ParquetReaderScanState& state,
@@ -47,10 +52,39 @@ void ParquetReader::initializeScan(ParquetReaderScanState& state,
     state.repeatBuf.resize(DEFAULT_VECTOR_CAPACITY);
 }
 
+// Whether the value can pass the predicates. The value is checked as the zone map of a chunk
+// holding only this value, and strings are also checked by the predicates evaluating strings.
+static bool canPassColumnPredicates(const storage::ColumnPredicateSet& predicates,
+    const ValueVector& vector, uint32_t pos) {
+    if (vector.isNull(pos)) {
+        auto stats = storage::MergedColumnChunkStats(storage::ColumnChunkStats{},
+            false /* guaranteedNoNulls */, true /* guaranteedAllNulls */);
+        return predicates.checkZoneMap(stats) != ZoneMapCheckResult::SKIP_SCAN;
+    }
+    auto stats = storage::MergedColumnChunkStats(storage::ColumnChunkStats{},
+        true /* guaranteedNoNulls */, false /* guaranteedAllNulls */);
+    auto isString = false;
+    TypeUtils::visit(
+        vector.dataType.getPhysicalType(),
+        [&]<storage::StorageValueType T>(T) {
+            auto value = storage::StorageValue(vector.getValue<T>(pos));
+            stats.stats.min = value;
+            stats.stats.max = value;
+        },
+        [&](ku_string_t) { isString = true; }, [](auto) {});
+    if (predicates.checkZoneMap(stats) == ZoneMapCheckResult::SKIP_SCAN) {
+        return false;
+    }
+    return !isString || !predicates.canEvaluateStrings() ||
+           predicates.evaluateStrings(vector.getValue<ku_string_t>(pos).getAsStringView());
+}
+
 bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& result) {
     if (state.finished) {
         return false;
     }
+    // The result can have columns after the ones of the file, which are set by the scan function.
+    const auto numColumnsToRead = std::min<uint32_t>(result.getNumValueVectors(), getNumColumns());
 
     // see if we have to switch to the next row group in the parquet file
     if (state.currentGroup < 0 || (int64_t)state.groupOffset >= getGroup(state).num_rows) {
@@ -67,7 +101,7 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
         }
 
         uint64_t toScanCompressedBytes = 0;
-        for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
+        for (auto colIdx = 0u; colIdx < numColumnsToRead; colIdx++) {
             prepareRowGroupBuffer(state, colIdx);
 
             auto fileColIdx = colIdx;
@@ -102,7 +136,7 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
                 }
             } else {
                 // Prefetch column-wise.
-                for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
+                for (auto colIdx = 0u; colIdx < numColumnsToRead; colIdx++) {
                     auto fileColIdx = colIdx;
                     auto rootReader = ku_dynamic_cast<StructColumnReader*>(state.rootReader.get());
 
@@ -142,10 +176,7 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
     auto repeatPtr = (uint8_t*)state.repeatBuf.ptr;
 
     auto rootReader = ku_dynamic_cast<StructColumnReader*>(state.rootReader.get());
-    for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
-        if (!columnSkips.empty() && columnSkips[colIdx]) {
-            continue;
-        }
+    auto readColumn = [&](uint32_t colIdx) {
         auto fileColIdx = colIdx;
         auto& resultVector = result.getValueVectorMutable(colIdx);
         auto childReader = rootReader->getChildReader(fileColIdx);
@@ -158,12 +189,53 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
                     fileColIdx, result.state->getSelVector().getSelSize(), rowsRead));
         }
         // LCOV_EXCL_STOP
+        if (filterMask.count() == thisOutputChunkRows) {
+            return;
+        }
+        // Rows that can't pass the predicates are filtered out later, but their values are not
+        // decoded, so they are set to null to be safe to evaluate.
+        for (auto i = 0u; i < thisOutputChunkRows; i++) {
+            if (!filterMask[i]) {
+                resultVector.setNull(i, true);
+            }
+        }
+    };
+    // Late materialization: columns with predicates are read first to find the rows that can pass
+    // them, and the other columns only decode these rows and skip pages without any of them.
+    for (auto colIdx = 0u; colIdx < numColumnsToRead; colIdx++) {
+        if ((!columnSkips.empty() && columnSkips[colIdx]) || !hasColumnPredicate(state, colIdx)) {
+            continue;
+        }
+        readColumn(colIdx);
+        auto& resultVector = result.getValueVector(colIdx);
+        for (auto i = 0u; i < thisOutputChunkRows; i++) {
+            if (filterMask[i] &&
+                !canPassColumnPredicates((*state.columnPredicates)[colIdx], resultVector, i)) {
+                filterMask.set(i, false);
+            }
+        }
+    }
+    for (auto colIdx = 0u; colIdx < numColumnsToRead; colIdx++) {
+        if ((!columnSkips.empty() && columnSkips[colIdx]) || hasColumnPredicate(state, colIdx)) {
+            continue;
+        }
+        readColumn(colIdx);
+    }
+    if (filterMask.none()) {
+        // No row can pass the predicates, so move on to the next rows.
+        result.state->getSelVectorUnsafe().setSelSize(0);
     }
 
     state.groupOffset += thisOutputChunkRows;
     return true;
 }
 
+bool ParquetReader::hasColumnPredicate(const ParquetReaderScanState& state,
+    uint32_t colIdx) const {
+    return state.columnPredicates != nullptr && colIdx < state.columnPredicates->size() &&
+           !(*state.columnPredicates)[colIdx].isEmpty();
+}
+
 void ParquetReader::scan(processor::ParquetReaderScanState& state, DataChunk& result) {
     while (scanInternal(state, result)) {
         if (result.state->getSelVector().getSelSize() > 0) {
@@ -217,6 +289,143 @@ void ParquetReader::initMetadata() {
     metadata->read(proto.get());
 }
 
+// Returns the number of leaves of the schema element, which is the number of its column chunks, and
+// moves schemaIdx past its descendants.
+static uint64_t skipSchemaElement(const std::vector<SchemaElement>& schema, uint64_t& schemaIdx) {
+    KU_ASSERT(schemaIdx < schema.size());
+    auto& sEle = schema[schemaIdx++];
+    if (!sEle.__isset.num_children || sEle.num_children == 0) {
+        return 1;
+    }
+    uint64_t numLeaves = 0;
+    for (auto i = 0; i < sEle.num_children; ++i) {
+        numLeaves += skipSchemaElement(schema, schemaIdx);
+    }
+    return numLeaves;
+}
+
+void ParquetReader::initColumnChunkIdxs() {
+    if (metadata->schema.empty()) {
+        return;
+    }
+    uint64_t schemaIdx = 1;
+    idx_t columnChunkIdx = 0;
+    for (auto i = 0; i < metadata->schema[0].num_children; ++i) {
+        auto& sEle = metadata->schema[schemaIdx];
+        auto isLeaf = !sEle.__isset.num_children || sEle.num_children == 0;
+        auto isRepeated = sEle.__isset.repetition_type &&
+                          sEle.repetition_type == FieldRepetitionType::REPEATED;
+        columnChunkIdxs.push_back(isLeaf && !isRepeated ? columnChunkIdx : INVALID_IDX);
+        columnSchemaIdxs.push_back(schemaIdx);
+        columnChunkIdx += skipSchemaElement(metadata->schema, schemaIdx);
+    }
+}
+
+template<typename T>
+static std::optional<T> readPlainValue(const std::string& data) {
+    if (data.size() != sizeof(T)) {
+        return std::nullopt;
+    }
+    T value;
+    memcpy(&value, data.data(), sizeof(T));
+    return value;
+}
+
+template<typename PARQUET_T, typename STORAGE_T = PARQUET_T>
+static std::optional<storage::StorageValue> readStatsValue(const std::string& data,
+    STORAGE_T scale = 1) {
+    auto value = readPlainValue<PARQUET_T>(data);
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    return storage::StorageValue(static_cast<STORAGE_T>(*value) * scale);
+}
+
+// Decodes a min or max statistic in the physical type of the column as read by kuzu. Only types
+// whose plain encoding orders the same as kuzu are decoded. Floating point statistics are left out
+// since they don't account for NaNs.
+static std::optional<storage::StorageValue> readStatsValue(const SchemaElement& sEle,
+    const LogicalType& type, const std::string& data) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::DATE:
+        return readStatsValue<int32_t, int64_t>(data);
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::SERIAL:
+        return readStatsValue<int64_t>(data);
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+        return readStatsValue<uint32_t, uint64_t>(data);
+    case LogicalTypeID::UINT64:
+        return readStatsValue<uint64_t>(data);
+    case LogicalTypeID::TIMESTAMP: {
+        if (sEle.type != Type::INT64) {
+            return std::nullopt;
+        }
+        auto isMillis =
+            sEle.__isset.logicalType && sEle.logicalType.__isset.TIMESTAMP ?
+                sEle.logicalType.TIMESTAMP.unit.__isset.MILLIS :
+                sEle.__isset.converted_type &&
+                    sEle.converted_type == ConvertedType::TIMESTAMP_MILLIS;
+        auto isMicros =
+            sEle.__isset.logicalType && sEle.logicalType.__isset.TIMESTAMP ?
+                sEle.logicalType.TIMESTAMP.unit.__isset.MICROS :
+                sEle.__isset.converted_type &&
+                    sEle.converted_type == ConvertedType::TIMESTAMP_MICROS;
+        if (isMillis) {
+            return readStatsValue<int64_t>(data, Interval::MICROS_PER_MSEC);
+        }
+        if (isMicros) {
+            return readStatsValue<int64_t>(data);
+        }
+        return std::nullopt;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+static std::optional<storage::MergedColumnChunkStats> getColumnChunkStats(
+    const SchemaElement& sEle, const LogicalType& type, const ColumnChunk& columnChunk) {
+    if (!columnChunk.__isset.meta_data || !columnChunk.meta_data.__isset.statistics) {
+        return std::nullopt;
+    }
+    auto& statistics = columnChunk.meta_data.statistics;
+    auto stats = storage::ColumnChunkStats{};
+    // The deprecated min and max fields are left out, since they are ordered as signed values
+    // regardless of the logical type.
+    if (statistics.__isset.min_value && statistics.__isset.max_value) {
+        stats.min = readStatsValue(sEle, type, statistics.min_value);
+        stats.max = readStatsValue(sEle, type, statistics.max_value);
+    }
+    auto hasNullCount = statistics.__isset.null_count;
+    return storage::MergedColumnChunkStats(stats, hasNullCount && statistics.null_count == 0,
+        hasNullCount && statistics.null_count == columnChunk.meta_data.num_values);
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<storage::ColumnPredicateSet>& columnPredicates) const {
+    KU_ASSERT(groupIdx < metadata->row_groups.size());
+    auto& group = metadata->row_groups[groupIdx];
+    for (auto i = 0u; i < columnPredicates.size() && i < columnChunkIdxs.size(); ++i) {
+        if (columnPredicates[i].isEmpty() || columnChunkIdxs[i] == INVALID_IDX ||
+            columnChunkIdxs[i] >= group.columns.size()) {
+            continue;
+        }
+        auto& sEle = metadata->schema[columnSchemaIdxs[i]];
+        auto stats =
+            getColumnChunkStats(sEle, deriveLogicalType(sEle), group.columns[columnChunkIdxs[i]]);
+        if (stats.has_value() &&
+            columnPredicates[i].checkZoneMap(*stats) == ZoneMapCheckResult::SKIP_SCAN) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<ColumnReader> ParquetReader::createReaderRecursive(uint64_t depth,
     uint64_t maxDefine, uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx) {
     KU_ASSERT(nextSchemaIdx < metadata->schema.size());
@@ -582,18 +791,29 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
 }
 
 ParquetScanSharedState::ParquetScanSharedState(FileScanInfo fileScanInfo, uint64_t numRows,
-    main::ClientContext* context, std::vector<bool> columnSkips)
+    main::ClientContext* context, std::vector<bool> columnSkips,
+    std::vector<storage::ColumnPredicateSet> columnPredicates,
+    std::vector<std::vector<std::optional<std::string>>> partitionValues)
     : ScanFileWithProgressSharedState{std::move(fileScanInfo), numRows, context},
-      columnSkips{columnSkips} {
-    readers.push_back(std::make_unique<ParquetReader>(this->fileScanInfo.filePaths[fileIdx],
-        columnSkips, context));
+      columnSkips{columnSkips}, columnPredicates{std::move(columnPredicates)},
+      partitionValues{std::move(partitionValues)} {
     totalRowsGroups = 0;
+    numBlocksReadByFiles = 0;
+    if (this->fileScanInfo.getNumFiles() == 0) {
+        return;
+    }
+    // The files pruned by their partition values are already removed from the file scan info, so
+    // the row count and the progress only cover the files that are scanned.
+    this->numRows = 0;
     for (auto i = fileIdx.load(); i < this->fileScanInfo.getNumFiles(); i++) {
         auto reader =
             std::make_unique<ParquetReader>(this->fileScanInfo.filePaths[i], columnSkips, context);
         totalRowsGroups += reader->getNumRowsGroups();
+        this->numRows += reader->getMetadata()->num_rows;
+        if (i == fileIdx) {
+            readers.push_back(std::move(reader));
+        }
     }
-    numBlocksReadByFiles = 0;
 }
 
 static bool parquetSharedStateNext(ParquetScanLocalState& localState,
@@ -604,7 +824,14 @@ static bool parquetSharedStateNext(ParquetScanLocalState& localState,
             return false;
         }
         if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
+            if (sharedState.readers[sharedState.fileIdx]->canSkipRowGroup(sharedState.blockIdx,
+                    sharedState.columnPredicates)) {
+                sharedState.blockIdx++;
+                continue;
+            }
             localState.reader = sharedState.readers[sharedState.fileIdx].get();
+            localState.fileIdx = sharedState.fileIdx;
+            localState.state->columnPredicates = &sharedState.columnPredicates;
             localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
                 VirtualFileSystem::GetUnsafe(*sharedState.context));
             sharedState.blockIdx++;
@@ -625,6 +852,27 @@ static bool parquetSharedStateNext(ParquetScanLocalState& localState,
     }
 }
 
+static void setPartitionColumns(const ParquetScanSharedState& sharedState,
+    const ParquetScanLocalState& localState, DataChunk& outputChunk) {
+    if (sharedState.partitionValues.empty()) {
+        return;
+    }
+    const auto& values = sharedState.partitionValues[localState.fileIdx];
+    const auto startColumnIdx = outputChunk.getNumValueVectors() - values.size();
+    const auto& selVector = outputChunk.state->getSelVector();
+    for (auto i = 0u; i < values.size(); i++) {
+        auto& vector = outputChunk.getValueVectorMutable(startColumnIdx + i);
+        for (auto j = 0u; j < selVector.getSelSize(); j++) {
+            if (!values[i].has_value()) {
+                vector.setNull(selVector[j], true);
+                continue;
+            }
+            vector.setNull(selVector[j], false);
+            StringVector::addString(&vector, selVector[j], *values[i]);
+        }
+    }
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     auto& outputChunk = output.dataChunk;
     if (input.localState == nullptr) {
@@ -635,6 +883,7 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
     do {
         parquetScanLocalState->reader->scan(*parquetScanLocalState->state, outputChunk);
         if (outputChunk.state->getSelVector().getSelSize() > 0) {
+            setPartitionColumns(*parquetScanSharedState, *parquetScanLocalState, outputChunk);
             return outputChunk.state->getSelVector().getSelSize();
         }
         if (!parquetSharedStateNext(*parquetScanLocalState, *parquetScanSharedState)) {
@@ -684,13 +933,31 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     const TableFuncBindInput* input) {
     auto scanInput = ku_dynamic_cast<ExtraScanTableFuncBindInput*>(input->extraInput.get());
     const auto& options = scanInput->fileScanInfo.options;
-    if (options.size() > 1 ||
-        (options.size() == 1 && !options.contains(CopyConstants::IGNORE_ERRORS_OPTION_NAME))) {
-        throw BinderException{"Copy from Parquet cannot have options other than IGNORE_ERRORS."};
+    for (auto& [name, value] : options) {
+        if (name != CopyConstants::IGNORE_ERRORS_OPTION_NAME &&
+            name != HivePartitioning::OPTION_NAME) {
+            throw BinderException{"Copy from Parquet cannot have options other than "
+                                  "IGNORE_ERRORS and HIVE_PARTITIONING."};
+        }
+        if (value.getDataType().getLogicalTypeID() != LogicalTypeID::BOOL) {
+            throw BinderException{stringFormat("The {} option must be a boolean.", name)};
+        }
     }
     std::vector<std::string> detectedColumnNames;
     std::vector<LogicalType> detectedColumnTypes;
     bindColumns(scanInput, detectedColumnNames, detectedColumnTypes, context);
+    if (scanInput->fileScanInfo.getOption(HivePartitioning::OPTION_NAME, false)) {
+        // The partition columns are strings which follow the columns of the files.
+        for (auto& key : HivePartitioning::getPartitionKeys(scanInput->fileScanInfo.filePaths)) {
+            if (std::find(detectedColumnNames.begin(), detectedColumnNames.end(), key) !=
+                detectedColumnNames.end()) {
+                throw BinderException{stringFormat(
+                    "Partition column {} has the same name as a column of the files.", key)};
+            }
+            detectedColumnNames.push_back(key);
+            detectedColumnTypes.push_back(LogicalType::STRING());
+        }
+    }
     if (!scanInput->expectedColumnNames.empty()) {
         ReaderBindUtils::validateNumColumns(scanInput->expectedColumnNames.size(),
             detectedColumnNames.size());
@@ -709,8 +976,41 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
 static std::unique_ptr<TableFuncSharedState> initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<ScanFileBindData>();
-    return std::make_unique<ParquetScanSharedState>(bindData->fileScanInfo.copy(),
-        bindData->numRows, bindData->context, bindData->getColumnSkips());
+    std::vector<storage::ColumnPredicateSet> columnPredicates;
+    if (bindData->context->getClientConfig()->enableZoneMap) {
+        columnPredicates = copyVector(bindData->getColumnPredicates());
+    }
+    auto fileScanInfo = bindData->fileScanInfo.copy();
+    std::vector<std::vector<std::optional<std::string>>> partitionValues;
+    if (fileScanInfo.getOption(HivePartitioning::OPTION_NAME, false)) {
+        // Files whose partition values can't pass the predicates on the partition columns are
+        // pruned before any of them is opened.
+        const auto& allPredicates = bindData->getColumnPredicates();
+        std::vector<std::string> filePaths;
+        for (auto& filePath : fileScanInfo.filePaths) {
+            auto values = HivePartitioning::getPartitionValues(filePath);
+            const auto startColumnIdx = bindData->columns.size() - values.size();
+            auto canPass = true;
+            for (auto i = 0u; canPass && i < values.size(); i++) {
+                const auto columnIdx = startColumnIdx + i;
+                if (columnIdx >= allPredicates.size() ||
+                    !allPredicates[columnIdx].canEvaluateStrings()) {
+                    continue;
+                }
+                // Comparisons with a null partition value are never true.
+                canPass = values[i].has_value() &&
+                          allPredicates[columnIdx].evaluateStrings(*values[i]);
+            }
+            if (canPass) {
+                filePaths.push_back(filePath);
+                partitionValues.push_back(std::move(values));
+            }
+        }
+        fileScanInfo.filePaths = std::move(filePaths);
+    }
+    return std::make_unique<ParquetScanSharedState>(std::move(fileScanInfo), bindData->numRows,
+        bindData->context, bindData->getColumnSkips(), std::move(columnPredicates),
+        std::move(partitionValues));
 }
 
 static std::unique_ptr<TableFuncLocalState> initLocalState(
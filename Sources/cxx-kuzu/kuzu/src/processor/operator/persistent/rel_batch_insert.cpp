@@ -261,6 +261,8 @@ void RelBatchInsert::finalizeInternal(ExecutionContext* context) {
     }
     sharedState->numRows.store(0);
     sharedState->table->cast<RelTable>().setHasChanges();
+    sharedState->table->cast<RelTable>().invalidateReverseIndex();
+    sharedState->table->cast<RelTable>().invalidateCSRCaches();
     partitionerSharedState->resetState(relInfo->partitioningIdx);
 }
 
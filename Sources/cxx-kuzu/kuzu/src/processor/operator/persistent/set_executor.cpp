@@ -16,6 +16,15 @@ void NodeSetInfo::init(const ResultSet& resultSet, main::ClientContext* context)
     columnDataVector = evaluator->resultVector.get();
 }
 
+void NodeTableSetInfo::init(const NodeSetInfo& info, main::ClientContext* context) {
+    if (columnID == INVALID_COLUMN_ID) {
+        return;
+    }
+    updateState = std::make_unique<storage::NodeTableUpdateState>(columnID, *info.nodeIDVector,
+        *info.columnDataVector);
+    table->initUpdateState(context, *updateState);
+}
+
 void NodeSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
     info.init(*resultSet, context->clientContext);
 }
@@ -42,6 +51,11 @@ static void writeColumnUpdateResult(ValueVector* idVector, ValueVector* columnVe
     columnVector->copyFromVectorData(columnSelVector[0], dataVector, dataSelVector[0]);
 }
 
+void SingleLabelNodeSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
+    NodeSetExecutor::init(resultSet, context);
+    tableInfo.init(info, context->clientContext);
+}
+
 void SingleLabelNodeSetExecutor::set(ExecutionContext* context) {
     if (tableInfo.columnID == INVALID_COLUMN_ID) {
         // Not a valid column. Set projected column to null.
@@ -51,15 +65,20 @@ void SingleLabelNodeSetExecutor::set(ExecutionContext* context) {
         return;
     }
     info.evaluator->evaluate();
-    auto updateState = std::make_unique<storage::NodeTableUpdateState>(tableInfo.columnID,
-        *info.nodeIDVector, *info.columnDataVector);
-    tableInfo.table->initUpdateState(context->clientContext, *updateState);
-    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext), *updateState);
+    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext),
+        *tableInfo.updateState);
     if (info.columnVectorPos.isValid()) {
         writeColumnUpdateResult(info.nodeIDVector, info.columnVector, info.columnDataVector);
     }
 }
 
+void MultiLabelNodeSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
+    NodeSetExecutor::init(resultSet, context);
+    for (auto& [_, tableInfo] : tableInfos) {
+        tableInfo.init(info, context->clientContext);
+    }
+}
+
 void MultiLabelNodeSetExecutor::set(ExecutionContext* context) {
     info.evaluator->evaluate();
     auto& nodeIDSelVector = info.nodeIDVector->state->getSelVector();
@@ -73,10 +92,8 @@ void MultiLabelNodeSetExecutor::set(ExecutionContext* context) {
         return;
     }
     auto& tableInfo = tableInfos.at(nodeID.tableID);
-    auto updateState = std::make_unique<storage::NodeTableUpdateState>(tableInfo.columnID,
-        *info.nodeIDVector, *info.columnDataVector);
-    tableInfo.table->initUpdateState(context->clientContext, *updateState);
-    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext), *updateState);
+    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext),
+        *tableInfo.updateState);
     if (info.columnVectorPos.isValid()) {
         writeColumnUpdateResult(info.nodeIDVector, info.columnVector, info.columnDataVector);
     }
@@ -93,6 +110,14 @@ void RelSetInfo::init(const ResultSet& resultSet, main::ClientContext* context)
     columnDataVector = evaluator->resultVector.get();
 }
 
+void RelTableSetInfo::init(const RelSetInfo& info) {
+    if (columnID == INVALID_COLUMN_ID) {
+        return;
+    }
+    updateState = std::make_unique<storage::RelTableUpdateState>(columnID, *info.srcNodeIDVector,
+        *info.dstNodeIDVector, *info.relIDVector, *info.columnDataVector);
+}
+
 void RelSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
     info.init(*resultSet, context->clientContext);
 }
@@ -101,6 +126,11 @@ void RelSetExecutor::setRelID(nodeID_t relID) const {
     info.relIDVector->setValue(info.relIDVector->state->getSelVector()[0], relID);
 }
 
+void SingleLabelRelSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
+    RelSetExecutor::init(resultSet, context);
+    tableInfo.init(info);
+}
+
 void SingleLabelRelSetExecutor::set(ExecutionContext* context) {
     if (tableInfo.columnID == INVALID_COLUMN_ID) {
         if (info.columnVectorPos.isValid()) {
@@ -109,14 +139,20 @@ void SingleLabelRelSetExecutor::set(ExecutionContext* context) {
         return;
     }
     info.evaluator->evaluate();
-    auto updateState = std::make_unique<storage::RelTableUpdateState>(tableInfo.columnID,
-        *info.srcNodeIDVector, *info.dstNodeIDVector, *info.relIDVector, *info.columnDataVector);
-    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext), *updateState);
+    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext),
+        *tableInfo.updateState);
     if (info.columnVectorPos.isValid()) {
         writeColumnUpdateResult(info.relIDVector, info.columnVector, info.columnDataVector);
     }
 }
 
+void MultiLabelRelSetExecutor::init(ResultSet* resultSet, ExecutionContext* context) {
+    RelSetExecutor::init(resultSet, context);
+    for (auto& [_, tableInfo] : tableInfos) {
+        tableInfo.init(info);
+    }
+}
+
 void MultiLabelRelSetExecutor::set(ExecutionContext* context) {
     info.evaluator->evaluate();
     auto& idSelVector = info.relIDVector->state->getSelVector();
@@ -129,9 +165,8 @@ void MultiLabelRelSetExecutor::set(ExecutionContext* context) {
         return;
     }
     auto& tableInfo = tableInfos.at(relID.tableID);
-    auto updateState = std::make_unique<storage::RelTableUpdateState>(tableInfo.columnID,
-        *info.srcNodeIDVector, *info.dstNodeIDVector, *info.relIDVector, *info.columnDataVector);
-    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext), *updateState);
+    tableInfo.table->update(transaction::Transaction::Get(*context->clientContext),
+        *tableInfo.updateState);
     if (info.columnVectorPos.isValid()) {
         writeColumnUpdateResult(info.relIDVector, info.columnVector, info.columnDataVector);
     }
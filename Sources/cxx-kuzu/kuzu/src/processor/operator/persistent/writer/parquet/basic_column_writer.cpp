@@ -116,22 +116,27 @@ void BasicColumnWriter::write(ColumnWriterState& writerState, common::ValueVecto
     }
 }
 
-void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+void BasicColumnWriter::finalizePages(ColumnWriterState& writerState) {
     auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
-    auto& columnChunk = state.rowGroup.columns[state.colIdx];
-
     // Flush the last page (if any remains).
     flushPage(state);
+    // Compress the dictionary, which becomes the first page of the column chunk.
+    if (hasDictionary(state)) {
+        flushDictionary(state, state.statsState.get());
+    }
+}
+
+void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+    auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
+    auto& columnChunk = state.rowGroup.columns[state.colIdx];
 
     auto startOffset = writer.getOffset();
     auto pageOffset = startOffset;
-    // Flush the dictionary.
     if (hasDictionary(state)) {
         columnChunk.meta_data.statistics.distinct_count = dictionarySize(state);
         columnChunk.meta_data.statistics.__isset.distinct_count = true;
         columnChunk.meta_data.dictionary_page_offset = pageOffset;
         columnChunk.meta_data.__isset.dictionary_page_offset = true;
-        flushDictionary(state, state.statsState.get());
         pageOffset += state.writeInfo[0].compressedSize;
     }
 
@@ -100,6 +100,11 @@ void ListColumnWriter::write(ColumnWriterState& writerState, common::ValueVector
         common::ListVector::getDataVectorSize(vector));
 }
 
+void ListColumnWriter::finalizePages(ColumnWriterState& writerState) {
+    auto& state = reinterpret_cast<ListColumnWriterState&>(writerState);
+    childWriter->finalizePages(*state.childState);
+}
+
 void ListColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
     auto& state = reinterpret_cast<ListColumnWriterState&>(writerState);
     childWriter->finalizeWrite(*state.childState);
@@ -253,6 +253,10 @@ void ParquetWriter::prepareRowGroup(FactorizedTable& ft, PreparedRowGroup& resul
         }
     }
 
+    for (auto i = 0u; i < columnWriters.size(); i++) {
+        columnWriters[i]->finalizePages(*writerStates[i]);
+    }
+
     for (auto& write_state : writerStates) {
         states.push_back(std::move(write_state));
     }
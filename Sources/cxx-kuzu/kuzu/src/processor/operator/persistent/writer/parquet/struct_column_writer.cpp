@@ -87,6 +87,13 @@ void StructColumnWriter::write(ColumnWriterState& state_p, ValueVector* vector,
     }
 }
 
+void StructColumnWriter::finalizePages(ColumnWriterState& state_p) {
+    auto& state = reinterpret_cast<StructColumnWriterState&>(state_p);
+    for (auto child_idx = 0u; child_idx < childWriters.size(); child_idx++) {
+        childWriters[child_idx]->finalizePages(*state.childStates[child_idx]);
+    }
+}
+
 void StructColumnWriter::finalizeWrite(ColumnWriterState& state_p) {
     auto& state = reinterpret_cast<StructColumnWriterState&>(state_p);
     for (auto child_idx = 0u; child_idx < childWriters.size(); child_idx++) {
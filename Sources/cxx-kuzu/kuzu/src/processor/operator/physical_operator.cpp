@@ -1,8 +1,11 @@
 #include "processor/operator/physical_operator.h"
 
+#include <algorithm>
+
 #include "common/exception/interrupt.h"
 #include "common/exception/runtime.h"
 #include "common/task_system/progress_bar.h"
+#include "common/tracer.h"
 #include "main/client_context.h"
 #include "processor/execution_context.h"
 
@@ -75,6 +78,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "LIMIT";
     case PhysicalOperatorType::LOAD_EXTENSION:
         return "LOAD_EXTENSION";
+    case PhysicalOperatorType::LOOKUP_NODE_TABLE:
+        return "LOOKUP_NODE_TABLE";
     case PhysicalOperatorType::MERGE:
         return "MERGE";
     case PhysicalOperatorType::MULTIPLICITY_REDUCER:
@@ -91,6 +96,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "PROFILE";
     case PhysicalOperatorType::RECURSIVE_EXTEND:
         return "RECURSIVE_EXTEND";
+    case PhysicalOperatorType::REL_DEGREE:
+        return "REL_DEGREE";
     case PhysicalOperatorType::RESULT_COLLECTOR:
         return "RESULT_COLLECTOR";
     case PhysicalOperatorType::SCAN_NODE_TABLE:
@@ -103,6 +110,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "SET_PROPERTY";
     case PhysicalOperatorType::SKIP:
         return "SKIP";
+    case PhysicalOperatorType::SORTED_INDEX_SCAN_NODE_TABLE:
+        return "SORTED_INDEX_SCAN_NODE_TABLE";
     case PhysicalOperatorType::STANDALONE_CALL:
         return "STANDALONE_CALL";
     case PhysicalOperatorType::TABLE_FUNCTION_CALL:
@@ -199,6 +208,14 @@ bool PhysicalOperator::getNextTuple(ExecutionContext* context) {
         }
     }
 #endif
+    if (stopSignal != nullptr && stopSignal->load(std::memory_order_relaxed)) {
+        return false;
+    }
+    // Each batch pulled from a source is traced as the dispatch of a morsel of the pipeline.
+    std::optional<TraceScope> traceScope;
+    if (isSource() && Tracer::Get().isEnabled()) [[unlikely]] {
+        traceScope.emplace("morsel", PhysicalOperatorUtils::operatorToString(this));
+    }
     metrics->executionTime.start();
     auto result = getNextTuplesInternal(context);
     ProgressBar::Get(*context->clientContext)
@@ -225,18 +242,30 @@ double PhysicalOperator::getExecutionTime(Profiler& profiler) const {
     if (!isSource()) {
         executionTime -= profiler.sumAllTimeMetricsWithKey(children[0]->getTimeMetricKey());
     }
-    return executionTime;
+    // Sampled times of an operator and of its child are extrapolated independently.
+    return std::max(executionTime, 0.0);
 }
 
 uint64_t PhysicalOperator::getNumOutputTuples(Profiler& profiler) const {
     return profiler.sumAllNumericMetricsWithKey(getNumTupleMetricKey());
 }
 
+std::vector<uint64_t> PhysicalOperator::getNumOutputTuplesPerThread(Profiler& profiler) const {
+    return profiler.getAllNumericMetricsWithKey(getNumTupleMetricKey());
+}
+
+std::vector<uint64_t> PhysicalOperator::getNumBatchesPerThread(Profiler& profiler) const {
+    return profiler.getAllNumStartsWithKey(getTimeMetricKey());
+}
+
 std::unordered_map<std::string, std::string> PhysicalOperator::getProfilerKeyValAttributes(
     Profiler& profiler) const {
     std::unordered_map<std::string, std::string> result;
     result.insert({"ExecutionTime", std::to_string(getExecutionTime(profiler))});
     result.insert({"NumOutputTuples", std::to_string(getNumOutputTuples(profiler))});
+    if (estimatedCardinality.has_value()) {
+        result.insert({"EstimatedCardinality", std::to_string(*estimatedCardinality)});
+    }
     return result;
 }
 
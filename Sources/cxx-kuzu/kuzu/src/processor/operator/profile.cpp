@@ -1,5 +1,7 @@
 #include "processor/operator/profile.h"
 
+#include "json.hpp"
+#include "main/client_context.h"
 #include "main/plan_printer.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -10,8 +12,15 @@ namespace kuzu {
 namespace processor {
 
 void Profile::executeInternal(ExecutionContext* context) {
-    const auto planInString =
-        main::PlanPrinter::printPlanToOstream(info.physicalPlan, context->profiler).str();
+    std::string planInString;
+    if (context->clientContext->getClientConfig()->profileInJson) {
+        planInString =
+            main::PlanPrinter::printProfileToJson(info.physicalPlan, context->profiler).dump(4);
+    } else {
+        planInString =
+            main::PlanPrinter::printPlanToOstream(info.physicalPlan, context->profiler).str() +
+            main::PlanPrinter::printPipelinesToOstream(info.physicalPlan, context->profiler).str();
+    }
     appendMessage(planInString, storage::MemoryManager::Get(*context->clientContext));
 }
 
@@ -37,14 +37,11 @@ bool Projection::getNextTuplesInternal(ExecutionContext* context) {
         resultSet->multiplicity *=
             resultSet->getNumTuplesWithoutMultiplicity(info.discardedChunkIndices);
     }
-    // The if statement is added to avoid the cost of calculating numTuples when metric is disabled.
-    if (metrics->numOutputTuple.enabled) [[unlikely]] {
-        if (info.activeChunkIndices.empty()) {
-            // In COUNT(*) case we are projecting away everything and only track multiplicity
-            metrics->numOutputTuple.increase(resultSet->multiplicity);
-        } else {
-            metrics->numOutputTuple.increase(resultSet->getNumTuples(info.activeChunkIndices));
-        }
+    if (info.activeChunkIndices.empty()) {
+        // In COUNT(*) case we are projecting away everything and only track multiplicity
+        metrics->numOutputTuple.increase(resultSet->multiplicity);
+    } else {
+        metrics->numOutputTuple.increase(resultSet->getNumTuples(info.activeChunkIndices));
     }
     return true;
 }
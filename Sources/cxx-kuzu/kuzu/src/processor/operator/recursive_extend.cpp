@@ -83,6 +83,38 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+// Returns the destination of single pair queries, i.e., if the output node mask has a single node,
+// so that shortest paths can be searched from both ends. Path node predicates are only checked when
+// writing paths from the source, so they also rule out searching backward.
+static nodeID_t getSingleDstNodeID(const RecursiveExtendSharedState& sharedState) {
+    auto outputNodeMask = sharedState.getOutputNodeMaskMap();
+    if (outputNodeMask == nullptr || sharedState.getPathNodeMaskMap() != nullptr ||
+        outputNodeMask->getNumMaskedNode() != 1) {
+        return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    }
+    auto result = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    for (auto& [tableID, mask] : outputNodeMask->getMasks()) {
+        if (!mask->isEnabled()) {
+            return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+        }
+        if (mask->getNumMaskedNodes() == 1) {
+            for (auto offset : mask->range(0, mask->getMaxOffset())) {
+                result = nodeID_t{offset, tableID};
+            }
+        }
+    }
+    return result;
+}
+
+// Sources are searched together with multi-source BFS if there are enough of them to fill a batch.
+// Path node predicates are checked when writing paths, so they rule out multi-source BFS.
+static bool canRunMultiSourceBFS(const RJAlgorithm& function,
+    const RecursiveExtendSharedState& sharedState, nodeID_t dstNodeID, offset_t totalNumNodes) {
+    return function.canRunMultiSourceBFS() && dstNodeID.offset == INVALID_OFFSET &&
+           sharedState.getPathNodeMaskMap() == nullptr &&
+           totalNumNodes >= RJAlgorithm::MULTI_SOURCE_BFS_MAX_NUM_SOURCES;
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
@@ -105,7 +137,21 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         propertyNames.push_back(
             bindData.weightPropertyExpr->ptrCast<PropertyExpression>()->getPropertyName());
     }
+    auto dstNodeID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    if (function->canSearchBidirectionally()) {
+        dstNodeID = getSingleDstNodeID(*sharedState);
+    }
+    auto useMultiSourceBFS =
+        canRunMultiSourceBFS(*function, *sharedState, dstNodeID, totalNumNodes);
+    std::vector<nodeID_t> sourceBatch;
     offset_t completedNumNodes = 0;
+    auto runSourceBatch = [&]() {
+        function->runMultiSourceBFS(context, bindData, sharedState.get(), sourceBatch);
+        completedNumNodes += sourceBatch.size();
+        progressBar->updateProgress(context->queryID,
+            getRJProgress(totalNumNodes, completedNumNodes));
+        sourceBatch.clear();
+    };
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
     for (auto& tableID : graph->getNodeTableIDs()) {
         // Input node table IDs could be different from graph node table IDs, e.g.
@@ -115,14 +161,28 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         if (!inputNodeTableIDSet.contains(tableID)) {
             continue;
         }
-        auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
+        auto calcFunc = [tableID, propertyNames, graph, context, dstNodeID, this](
+                            offset_t offset) {
             auto clientContext = context->clientContext;
             auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
             computeState->initSource(sourceNodeID);
-            GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
-                bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
-                propertyNames);
+            if (dstNodeID.offset != INVALID_OFFSET && dstNodeID != sourceNodeID) {
+                auto bwdComputeState =
+                    function->getComputeState(context, bindData, sharedState.get());
+                bwdComputeState->initSource(dstNodeID);
+                auto meetNodeID = GDSUtils::runBidirectionalSPEdgeCompute(context, *computeState,
+                    *bwdComputeState, graph, bindData.extendDirection, bindData.upperBound,
+                    propertyNames);
+                if (meetNodeID.offset != INVALID_OFFSET) {
+                    function->joinBidirectionalSearch(*computeState, *bwdComputeState, meetNodeID,
+                        dstNodeID);
+                }
+            } else {
+                GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
+                    bindData.extendDirection, bindData.upperBound,
+                    sharedState->getOutputNodeMaskMap(), propertyNames);
+            }
             auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
                 sharedState.get());
             auto vertexCompute = std::make_unique<RJVertexCompute>(
@@ -131,28 +191,39 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
             GDSUtils::runVertexCompute(context, computeState->frontierPair->getState(), graph,
                 *vertexCompute);
         };
+        // Returns false once the limit is reached.
+        auto processSource = [&](offset_t offset) {
+            if (useMultiSourceBFS) {
+                sourceBatch.push_back(nodeID_t{offset, tableID});
+                if (sourceBatch.size() == RJAlgorithm::MULTI_SOURCE_BFS_MAX_NUM_SOURCES) {
+                    runSourceBatch();
+                }
+            } else {
+                calcFunc(offset);
+                progressBar->updateProgress(context->queryID,
+                    getRJProgress(totalNumNodes, completedNumNodes++));
+            }
+            return !sharedState->exceedLimit();
+        };
         auto maxOffset = graph->getMaxOffset(transaction, tableID);
         if (inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled()) {
             for (const auto& offset :
                 inputNodeMaskMap->getOffsetMask(tableID)->range(0, maxOffset)) {
-                calcFunc(offset);
-                progressBar->updateProgress(context->queryID,
-                    getRJProgress(totalNumNodes, completedNumNodes++));
-                if (sharedState->exceedLimit()) {
+                if (!processSource(offset)) {
                     break;
                 }
             }
         } else {
             for (auto offset = 0u; offset < maxOffset; ++offset) {
-                calcFunc(offset);
-                progressBar->updateProgress(context->queryID,
-                    getRJProgress(totalNumNodes, completedNumNodes++));
-                if (sharedState->exceedLimit()) {
+                if (!processSource(offset)) {
                     break;
                 }
             }
         }
     }
+    if (!sourceBatch.empty() && !sharedState->exceedLimit()) {
+        runSourceBatch();
+    }
     sharedState->factorizedTablePool.mergeLocalTables();
 }
 
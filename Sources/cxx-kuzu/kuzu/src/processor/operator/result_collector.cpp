@@ -44,6 +44,10 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    if (auto stream = sharedState->getStream()) {
+        executeStreamingInternal(context, *stream);
+        return;
+    }
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
@@ -57,6 +61,25 @@ void ResultCollector::executeInternal(ExecutionContext* context) {
     }
 }
 
+void ResultCollector::executeStreamingInternal(ExecutionContext* context, ResultStream& stream) {
+    auto memoryManager = MemoryManager::Get(*context->clientContext);
+    while (children[0]->getNextTuple(context)) {
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            localTable->append(payloadAndMarkVectors);
+        }
+        if (localTable->getTotalNumFlatTuples() >= DEFAULT_VECTOR_CAPACITY) {
+            metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+            stream.push(std::move(localTable));
+            localTable = std::make_unique<FactorizedTable>(memoryManager, info.tableSchema.copy());
+        }
+    }
+    if (!localTable->isEmpty()) {
+        metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+        stream.push(std::move(localTable));
+        localTable = std::make_unique<FactorizedTable>(memoryManager, info.tableSchema.copy());
+    }
+}
+
 void ResultCollector::finalizeInternal(ExecutionContext* context) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -0,0 +1,37 @@
+#include "processor/operator/scan/lookup_node_table.h"
+
+#include "processor/execution_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void LookupNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
+    scanState = std::make_unique<NodeTableScanState>(nodeIDVector, outVectors, nodeIDVector->state);
+    tableInfo.initScanState(*scanState, outVectors, context->clientContext);
+}
+
+bool LookupNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    const auto transaction = transaction::Transaction::Get(*context->clientContext);
+    // Unlike a scan, the selection of the input must be kept.
+    for (auto& vector : outVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    // Nodes in the input have been scanned by the same transaction, so all of them are found.
+    [[maybe_unused]] const auto found =
+        tableInfo.table->cast<NodeTable>().lookupMultiple(transaction, *scanState);
+    KU_ASSERT(found);
+    tableInfo.castColumns();
+    metrics->numOutputTuple.increase(scanState->nodeIDVector->state->getSelVector().getSelSize());
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
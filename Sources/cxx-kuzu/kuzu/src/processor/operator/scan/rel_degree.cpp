@@ -0,0 +1,48 @@
+#include "processor/operator/scan/rel_degree.h"
+
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void RelDegree::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* /*context*/) {
+    boundNodeIDVector = resultSet->getValueVector(info.boundNodeIDPos).get();
+    degreeVector = resultSet->getValueVector(info.degreePos).get();
+    // Committed degrees are cached per execution since they depend on the transaction.
+    degreeState = storage::RelTableDegreeState{};
+}
+
+bool RelDegree::getNextTuplesInternal(ExecutionContext* context) {
+    const auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto& state = *boundNodeIDVector->state;
+    sel_t numSelectedValues = 0;
+    do {
+        restoreSelVector(state);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(state);
+        numSelectedValues = 0;
+        auto buffer = state.getSelVectorUnsafe().getMutableBuffer();
+        for (auto i = 0u; i < state.getSelVector().getSelSize(); ++i) {
+            const auto pos = state.getSelVector()[i];
+            const auto boundOffset = boundNodeIDVector->getValue<nodeID_t>(pos).offset;
+            const auto degree =
+                info.table->getDegree(transaction, info.direction, boundOffset, degreeState);
+            degreeVector->setValue<int64_t>(pos, static_cast<int64_t>(degree));
+            degreeVector->setNull(pos, false);
+            buffer[numSelectedValues] = pos;
+            numSelectedValues += degree > 0;
+        }
+        state.getSelVectorUnsafe().setToFiltered();
+    } while (numSelectedValues == 0);
+    state.getSelVectorUnsafe().setSelSize(numSelectedValues);
+    metrics->numOutputTuple.increase(numSelectedValues);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,8 @@
 #include "processor/operator/scan/scan_node_table.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/numa_utils.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_storage.h"
@@ -31,11 +33,18 @@ std::string ScanNodeTablePrintInfo::toString() const {
 }
 
 void ScanNodeTableSharedState::initialize(const transaction::Transaction* transaction,
-    NodeTable* table, ScanNodeTableProgressSharedState& progressSharedState) {
+    NodeTable* table, uint64_t numThreads, ScanNodeTableProgressSharedState& progressSharedState) {
     this->table = table;
-    this->currentCommittedGroupIdx = 0;
+    this->numThreads = numThreads;
+    const auto numNUMANodes = NumaUtils::getNumNodes();
+    this->nextCommittedGroupIdxPerNUMANode.resize(numNUMANodes);
+    for (auto node = 0u; node < numNUMANodes; node++) {
+        this->nextCommittedGroupIdxPerNUMANode[node] = node;
+    }
     this->currentUnCommittedGroupIdx = 0;
     this->numCommittedNodeGroups = table->getNumCommittedNodeGroups();
+    this->numDispatchedCommittedGroups = 0;
+    this->splitGroupIdx = INVALID_NODE_GROUP_IDX;
     if (transaction->isWriteTransaction()) {
         if (const auto localTable =
                 transaction->getLocalStorage()->getLocalTable(this->table->getTableID())) {
@@ -46,13 +55,50 @@ void ScanNodeTableSharedState::initialize(const transaction::Transaction* transa
     progressSharedState.numGroups += numCommittedNodeGroups;
 }
 
+node_group_idx_t ScanNodeTableSharedState::getNextCommittedGroupIdx() {
+    const auto numNUMANodes = nextCommittedGroupIdxPerNUMANode.size();
+    const auto localNode = numNUMANodes > 1 ? NumaUtils::getCurrentNode() % numNUMANodes : 0;
+    for (auto i = 0u; i < numNUMANodes; i++) {
+        auto& nextGroupIdx = nextCommittedGroupIdxPerNUMANode[(localNode + i) % numNUMANodes];
+        if (nextGroupIdx < numCommittedNodeGroups) {
+            const auto groupIdx = nextGroupIdx;
+            nextGroupIdx += numNUMANodes;
+            return groupIdx;
+        }
+    }
+    return INVALID_NODE_GROUP_IDX;
+}
+
 void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState,
-    ScanNodeTableProgressSharedState& progressSharedState) {
+    ScanNodeTableMorsel& morsel, ScanNodeTableProgressSharedState& progressSharedState) {
     std::unique_lock lck{mtx};
-    if (currentCommittedGroupIdx < numCommittedNodeGroups) {
-        scanState.nodeGroupIdx = currentCommittedGroupIdx++;
+    morsel = ScanNodeTableMorsel{};
+    if (splitGroupIdx != INVALID_NODE_GROUP_IDX) {
+        scanState.nodeGroupIdx = splitGroupIdx;
+        scanState.source = TableScanSource::COMMITTED;
+        morsel.isRange = true;
+        morsel.startRow = nextRowInSplitGroup;
+        morsel.endRow = std::min(nextRowInSplitGroup + RANGE_MORSEL_NUM_ROWS, numRowsInSplitGroup);
+        nextRowInSplitGroup = morsel.endRow;
+        if (nextRowInSplitGroup >= numRowsInSplitGroup) {
+            splitGroupIdx = INVALID_NODE_GROUP_IDX;
+        }
+        return;
+    }
+    if (const auto groupIdx = getNextCommittedGroupIdx(); groupIdx != INVALID_NODE_GROUP_IDX) {
+        scanState.nodeGroupIdx = groupIdx;
         progressSharedState.numGroupsScanned++;
         scanState.source = TableScanSource::COMMITTED;
+        const auto numGroupsLeft = numCommittedNodeGroups - numDispatchedCommittedGroups++;
+        const auto numRows = table->getNumTuplesInNodeGroup(groupIdx);
+        if (numGroupsLeft < numThreads && numRows > RANGE_MORSEL_NUM_ROWS) {
+            morsel.isRange = true;
+            morsel.startRow = 0;
+            morsel.endRow = RANGE_MORSEL_NUM_ROWS;
+            splitGroupIdx = groupIdx;
+            nextRowInSplitGroup = morsel.endRow;
+            numRowsInSplitGroup = numRows;
+        }
         return;
     }
     if (currentUnCommittedGroupIdx < numUnCommittedNodeGroups) {
@@ -72,6 +118,19 @@ table_id_map_t<SemiMask*> ScanNodeTable::getSemiMasks() const {
     return result;
 }
 
+bool ScanNodeTable::addRuntimeFilter(const DataPos& pos, const std::string& columnName,
+    const std::shared_ptr<RuntimeFilter>& filter) {
+    auto it = std::find(opInfo.outVectorsPos.begin(), opInfo.outVectorsPos.end(), pos);
+    if (it == opInfo.outVectorsPos.end()) {
+        return false;
+    }
+    const auto columnIdx = it - opInfo.outVectorsPos.begin();
+    for (auto& tableInfo : tableInfos) {
+        tableInfo.addRuntimeFilter(columnIdx, columnName, filter);
+    }
+    return true;
+}
+
 void ScanNodeTableInfo::initScanState(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, main::ClientContext* context) {
     auto transaction = transaction::Transaction::Get(*context);
@@ -83,6 +142,8 @@ void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     ScanTable::initLocalStateInternal(resultSet, context);
     auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
     scanState = std::make_unique<NodeTableScanState>(nodeIDVector, outVectors, nodeIDVector->state);
+    numMorsels = context->profiler->registerNumericMetric(getNumMorselsMetricKey());
+    numRangeMorsels = context->profiler->registerNumericMetric(getNumRangeMorselsMetricKey());
     currentTableIdx = 0;
     initCurrentTable(context);
 }
@@ -91,30 +152,57 @@ void ScanNodeTable::initCurrentTable(ExecutionContext* context) {
     auto& currentInfo = tableInfos[currentTableIdx];
     currentInfo.initScanState(*scanState, outVectors, context->clientContext);
     scanState->semiMask = sharedStates[currentTableIdx]->getSemiMask();
+    // Scans filtered by an enabled semi mask don't prefetch either. That is checked in
+    // NodeGroup::initializeScanState, as masks are enabled at runtime.
+    scanState->prefetchPages = prefetchPages;
 }
 
 void ScanNodeTable::initGlobalStateInternal(ExecutionContext* context) {
     KU_ASSERT(sharedStates.size() == tableInfos.size());
+    const auto numThreads = context->clientContext->getMaxNumThreadForExec();
     for (auto i = 0u; i < tableInfos.size(); i++) {
         sharedStates[i]->initialize(transaction::Transaction::Get(*context->clientContext),
-            tableInfos[i].table->ptrCast<NodeTable>(), *progressSharedState);
+            tableInfos[i].table->ptrCast<NodeTable>(), numThreads, *progressSharedState);
     }
 }
 
+bool ScanNodeTable::scanMorsel(transaction::Transaction* transaction) {
+    if (!morsel.isRange) {
+        return tableInfos[currentTableIdx].table->scan(transaction, *scanState);
+    }
+    if (nextRowInMorsel >= morsel.endRow) {
+        return false;
+    }
+    scanState->resetOutVectors();
+    const auto startOffset =
+        StorageUtils::getStartOffsetOfNodeGroup(scanState->nodeGroupIdx) + nextRowInMorsel;
+    const auto numRowsToScan =
+        std::min<row_idx_t>(morsel.endRow - nextRowInMorsel, DEFAULT_VECTOR_CAPACITY);
+    const auto result = scanState->scanNext(transaction, startOffset, numRowsToScan);
+    if (result == NODE_GROUP_SCAN_EMPTY_RESULT) {
+        return false;
+    }
+    nextRowInMorsel += result.numRows;
+    return true;
+}
+
 bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     const auto transaction = transaction::Transaction::Get(*context->clientContext);
     while (currentTableIdx < tableInfos.size()) {
         auto& info = tableInfos[currentTableIdx];
-        while (info.table->scan(transaction, *scanState)) {
+        while (scanMorsel(transaction)) {
+            if (scanState->outState->getSelVector().getSelSize() > 0) {
+                info.castColumns();
+                info.applyRuntimeFilters(outVectors, scanState->outState->getSelVectorUnsafe());
+            }
             const auto outputSize = scanState->outState->getSelVector().getSelSize();
             if (outputSize > 0) {
-                info.castColumns();
                 scanState->outState->setToUnflat();
                 metrics->numOutputTuple.increase(outputSize);
                 return true;
             }
         }
-        sharedStates[currentTableIdx]->nextMorsel(*scanState, *progressSharedState);
+        sharedStates[currentTableIdx]->nextMorsel(*scanState, morsel, *progressSharedState);
         if (scanState->source == TableScanSource::NONE) {
             currentTableIdx++;
             if (currentTableIdx < tableInfos.size()) {
@@ -122,6 +210,11 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
             }
         } else {
             info.table->initScanState(transaction, *scanState);
+            nextRowInMorsel = morsel.startRow;
+            numMorsels->incrementByOne();
+            if (morsel.isRange) {
+                numRangeMorsels->incrementByOne();
+            }
         }
     }
     return false;
@@ -138,5 +231,15 @@ double ScanNodeTable::getProgress(ExecutionContext* /*context*/) const {
            progressSharedState->numGroups;
 }
 
+std::unordered_map<std::string, std::string> ScanNodeTable::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"NumMorsels",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getNumMorselsMetricKey()))});
+    result.insert({"NumRangeMorsels",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getNumRangeMorselsMetricKey()))});
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -0,0 +1,96 @@
+#include "processor/operator/scan/scan_rel_table_reverse.h"
+
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void ScanRelTableReverse::initGlobalStateInternal(ExecutionContext* context) {
+    auto clientContext = context->clientContext;
+    sharedState->index = table->getReverseIndex(transaction::Transaction::Get(*clientContext));
+    if (sharedState->index != nullptr) {
+        return;
+    }
+    RelTableReverseIndex::scheduleBuild(*clientContext, *table);
+    sharedState->index = RelTableReverseIndex::build(*clientContext, *table, 1 /* numThreads */);
+}
+
+void ScanRelTableReverse::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    boundNodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
+    cachedBoundNodeSelVector.setSelSize(0);
+    currBoundNodeIdx = 0;
+    rels = {};
+    insertedRels.clear();
+    nextRelIdx = 0;
+}
+
+void ScanRelTableReverse::initBoundNode(transaction_t startTS) {
+    const auto pos = cachedBoundNodeSelVector[currBoundNodeIdx++];
+    auto& state = *boundNodeIDVector->state;
+    state.setToFlat();
+    state.getSelVectorUnsafe().setToFiltered(1);
+    state.getSelVectorUnsafe()[0] = pos;
+    const auto dstOffset = boundNodeIDVector->getValue<nodeID_t>(pos).offset;
+    rels = sharedState->index->getRels(dstOffset);
+    insertedRels.clear();
+    sharedState->index->getInsertedRels(dstOffset, startTS, insertedRels);
+    nextRelIdx = 0;
+}
+
+bool ScanRelTableReverse::scanRels() {
+    const auto numRels = rels.size() + insertedRels.size();
+    if (nextRelIdx >= numRels) {
+        return false;
+    }
+    const auto numRelsToOutput =
+        std::min<uint64_t>(numRels - nextRelIdx, DEFAULT_VECTOR_CAPACITY);
+    const auto srcTableID = table->getFromNodeTableID();
+    const auto relTableID = table->getTableID();
+    for (auto i = 0u; i < numRelsToOutput; i++) {
+        const auto relIdx = nextRelIdx + i;
+        const auto& rel =
+            relIdx < rels.size() ? rels[relIdx] : insertedRels[relIdx - rels.size()];
+        outVectors[0]->setValue<nodeID_t>(i, nodeID_t{rel.srcOffset, srcTableID});
+        for (auto j = 1u; j < outVectors.size(); j++) {
+            outVectors[j]->setValue<internalID_t>(i, internalID_t{rel.relOffset, relTableID});
+        }
+    }
+    outVectors[0]->state->getSelVectorUnsafe().setToUnfiltered(numRelsToOutput);
+    nextRelIdx += numRelsToOutput;
+    return true;
+}
+
+bool ScanRelTableReverse::getNextTuplesInternal(ExecutionContext* context) {
+    const auto startTS = transaction::Transaction::Get(*context->clientContext)->getStartTS();
+    while (true) {
+        if (scanRels()) {
+            metrics->numOutputTuple.increase(outVectors[0]->state->getSelVector().getSelSize());
+            return true;
+        }
+        if (currBoundNodeIdx < cachedBoundNodeSelVector.getSelSize()) {
+            initBoundNode(startTS);
+            continue;
+        }
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        auto& selVector = boundNodeIDVector->state->getSelVectorUnsafe();
+        if (selVector.isUnfiltered()) {
+            cachedBoundNodeSelVector.setToUnfiltered();
+        } else {
+            cachedBoundNodeSelVector.setToFiltered();
+            memcpy(cachedBoundNodeSelVector.getMutableBuffer().data(),
+                selVector.getMutableBuffer().data(), selVector.getSelSize() * sizeof(sel_t));
+        }
+        cachedBoundNodeSelVector.setSelSize(selVector.getSelSize());
+        currBoundNodeIdx = 0;
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -30,6 +30,29 @@ void ScanTableInfo::castColumns() {
     }
 }
 
+void ScanTableInfo::addRuntimeFilter(idx_t columnIdx, const std::string& columnName,
+    std::shared_ptr<RuntimeFilter> filter) {
+    KU_ASSERT(columnIdx < columnIDs.size());
+    // Zone maps hold the stats of the column type, so they cannot be checked if the column is
+    // casted. The scanned values are checked after casting.
+    if (!columnCasters[columnIdx].hasCast()) {
+        columnPredicates.resize(columnIDs.size());
+        columnPredicates[columnIdx].addPredicate(
+            std::make_unique<ColumnRuntimeFilterPredicate>(columnName, filter));
+    }
+    runtimeFilters.emplace_back(columnIdx, std::move(filter));
+}
+
+void ScanTableInfo::applyRuntimeFilters(const std::vector<ValueVector*>& outVectors,
+    SelectionVector& selVector) const {
+    for (auto& [columnIdx, filter] : runtimeFilters) {
+        if (selVector.getSelSize() == 0) {
+            return;
+        }
+        filter->select(*outVectors[columnIdx], selVector);
+    }
+}
+
 void ScanTableInfo::addColumnInfo(column_id_t columnID, ColumnCaster caster) {
     if (caster.hasCast()) {
         hasColumnCaster = true;
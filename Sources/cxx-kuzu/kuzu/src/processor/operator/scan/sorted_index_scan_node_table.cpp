@@ -0,0 +1,108 @@
+#include "processor/operator/scan/sorted_index_scan_node_table.h"
+
+#include "binder/expression/expression_util.h"
+#include "processor/execution_context.h"
+#include "storage/index/sorted_index.h"
+#include "storage/local_storage/local_node_table.h"
+#include "storage/local_storage/local_storage.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::string SortedIndexScanPrintInfo::toString() const {
+    std::string result = "Table: ";
+    result += tableName;
+    if (!alias.empty()) {
+        result += ",Alias: ";
+        result += alias;
+    }
+    result += ",Index: ";
+    result += indexName;
+    result += ",Bounds: ";
+    result += bounds;
+    result += ",Properties: ";
+    result += binder::ExpressionUtil::toString(properties);
+    return result;
+}
+
+void SortedIndexScanNodeTable::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
+    scanState = std::make_unique<NodeTableScanState>(nodeIDVector, outVectors, nodeIDVector->state);
+    tableInfo.initScanState(*scanState, outVectors, context->clientContext);
+    if (lowerBoundEvaluator) {
+        lowerBoundEvaluator->init(*resultSet, context->clientContext);
+    }
+    if (upperBoundEvaluator) {
+        upperBoundEvaluator->init(*resultSet, context->clientContext);
+    }
+}
+
+// Returns false if the bound is null, in which case the comparison it comes from is never true.
+static bool evaluateBound(evaluator::ExpressionEvaluator* evaluator,
+    std::optional<histogram_key_t>& key) {
+    if (evaluator == nullptr) {
+        return true;
+    }
+    evaluator->evaluate();
+    const auto& vector = *evaluator->resultVector;
+    KU_ASSERT(vector.state->getSelVector().getSelSize() == 1);
+    key = ColumnHistogram::getKey(vector, vector.state->getSelVector()[0]);
+    return key.has_value();
+}
+
+void SortedIndexScanNodeTable::lookUpOffsets(transaction::Transaction* transaction) {
+    std::optional<histogram_key_t> lowerBound, upperBound;
+    if (!evaluateBound(lowerBoundEvaluator.get(), lowerBound) ||
+        !evaluateBound(upperBoundEvaluator.get(), upperBound)) {
+        return;
+    }
+    offsets = index->lookup(transaction, lowerBound, upperBound);
+    const auto tableID = tableInfo.table->getTableID();
+    if (const auto localStorage = transaction->getLocalStorage()) {
+        if (const auto localTable = localStorage->getLocalTable(tableID)) {
+            auto& localNodeTable = localTable->cast<LocalNodeTable>();
+            for (auto rowIdx = 0u; rowIdx < localNodeTable.getNumTotalRows(); rowIdx++) {
+                const auto offset = transaction->getUncommittedOffset(tableID, rowIdx);
+                if (localNodeTable.isVisible(transaction, offset)) {
+                    offsets.push_back(offset);
+                }
+            }
+        }
+    }
+}
+
+bool SortedIndexScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    const auto transaction = transaction::Transaction::Get(*context->clientContext);
+    if (!lookedUp) {
+        lookUpOffsets(transaction);
+        lookedUp = true;
+    }
+    if (cursor >= offsets.size()) {
+        return false;
+    }
+    const auto numNodes = std::min<idx_t>(DEFAULT_VECTOR_CAPACITY, offsets.size() - cursor);
+    const auto tableID = tableInfo.table->getTableID();
+    scanState->nodeIDVector->state->getSelVectorUnsafe().setToUnfiltered(numNodes);
+    for (auto i = 0u; i < numNodes; i++) {
+        scanState->nodeIDVector->setValue<nodeID_t>(i, nodeID_t{offsets[cursor + i], tableID});
+    }
+    cursor += numNodes;
+    for (auto& vector : outVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    // The index only returns nodes visible to the transaction, so all of them are found.
+    [[maybe_unused]] const auto found =
+        tableInfo.table->cast<NodeTable>().lookupMultiple(transaction, *scanState);
+    KU_ASSERT(found);
+    tableInfo.castColumns();
+    metrics->numOutputTuple.increase(numNodes);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,7 +1,10 @@
 #include "processor/operator/semi_masker.h"
 
+#include "common/bitset_mask.h"
 #include "common/constants.h"
 #include "common/roaring_mask.h"
+#include "common/sorted_mask.h"
+#include "common/system_config.h"
 #include "processor/execution_context.h"
 
 using namespace kuzu::common;
@@ -15,7 +18,7 @@ SemiMaskerLocalState* SemiMaskerSharedState::appendLocalState() {
     bool isSingle = masksPerTable.size() == 1;
     for (const auto& [tableID, vector] : masksPerTable) {
         auto& mask = vector.front();
-        auto newOne = SemiMaskUtil::createMask(mask->getMaxOffset());
+        auto newOne = SemiMaskUtil::createRoaringMask(mask->getMaxOffset());
         if (isSingle) {
             localInfo->singleTableRef = newOne.get();
         }
@@ -26,9 +29,41 @@ SemiMaskerLocalState* SemiMaskerSharedState::appendLocalState() {
     return localInfos[localInfos.size() - 1].get();
 }
 
+// Masks with at most this many nodes are kept as sorted lists of offsets.
+static constexpr uint64_t MAX_NUM_NODES_IN_SORTED_MASK = DEFAULT_VECTOR_CAPACITY;
+// Masks with at least one node out of this many are kept as bitsets. From this density on,
+// roaring bitmaps store most of their containers as bitmaps anyway.
+static constexpr uint64_t MAX_NUM_OFFSETS_PER_NODE_IN_BITSET_MASK = 16;
+
+template<typename ROARING, typename ROARING_MASK>
+static std::shared_ptr<SemiMask> createMergedMask(offset_t maxOffset,
+    std::shared_ptr<ROARING> roaring) {
+    const auto numNodes = roaring->cardinality();
+    if (numNodes <= MAX_NUM_NODES_IN_SORTED_MASK) {
+        offset_vec_t offsets;
+        offsets.reserve(numNodes);
+        for (auto offset : *roaring) {
+            offsets.push_back(offset);
+        }
+        return std::make_shared<SortedSemiMask>(maxOffset, std::move(offsets));
+    }
+    if (numNodes * MAX_NUM_OFFSETS_PER_NODE_IN_BITSET_MASK >= maxOffset) {
+        auto mask = std::make_shared<BitsetSemiMask>(maxOffset);
+        for (auto offset : *roaring) {
+            mask->mask(offset);
+        }
+        return mask;
+    }
+    auto mask = std::make_shared<ROARING_MASK>(maxOffset);
+    mask->roaring = std::move(roaring);
+    return mask;
+}
+
 void SemiMaskerSharedState::mergeToGlobal() {
     for (const auto& [tableID, globalVector] : masksPerTable) {
-        if (globalVector.front()->getMaxOffset() > std::numeric_limits<uint32_t>::max()) {
+        const auto maxOffset = globalVector.front()->getMaxOffset();
+        std::shared_ptr<SemiMask> mergedMask;
+        if (maxOffset > std::numeric_limits<uint32_t>::max()) {
             std::vector<roaring::Roaring64Map*> masks;
             for (const auto& localInfo : localInfos) {
                 const auto& mask = localInfo->localMasksPerTable.at(tableID);
@@ -37,13 +72,11 @@ void SemiMaskerSharedState::mergeToGlobal() {
                     masks.push_back(mask64->roaring.get());
                 }
             }
-            auto mergedMask = std::make_shared<roaring::Roaring64Map>(
+            auto merged = std::make_shared<roaring::Roaring64Map>(
                 roaring::Roaring64Map::fastunion(masks.size(),
                     const_cast<const roaring::Roaring64Map**>(masks.data())));
-            for (const auto& item : globalVector) {
-                auto mask64 = static_cast<Roaring64BitmapSemiMask*>(item);
-                mask64->roaring = mergedMask;
-            }
+            mergedMask = createMergedMask<roaring::Roaring64Map, Roaring64BitmapSemiMask>(
+                maxOffset, std::move(merged));
         } else {
             std::vector<roaring::Roaring*> masks;
             for (const auto& localInfo : localInfos) {
@@ -53,12 +86,13 @@ void SemiMaskerSharedState::mergeToGlobal() {
                     masks.push_back(mask32->roaring.get());
                 }
             }
-            auto mergedMask = std::make_shared<roaring::Roaring>(roaring::Roaring::fastunion(
+            auto merged = std::make_shared<roaring::Roaring>(roaring::Roaring::fastunion(
                 masks.size(), const_cast<const roaring::Roaring**>(masks.data())));
-            for (const auto& item : globalVector) {
-                auto mask32 = static_cast<Roaring32BitmapSemiMask*>(item);
-                mask32->roaring = mergedMask;
-            }
+            mergedMask = createMergedMask<roaring::Roaring, Roaring32BitmapSemiMask>(maxOffset,
+                std::move(merged));
+        }
+        for (const auto& item : globalVector) {
+            static_cast<AdaptiveSemiMask*>(item)->setImpl(mergedMask);
         }
     }
 }
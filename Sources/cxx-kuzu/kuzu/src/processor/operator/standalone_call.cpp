@@ -31,6 +31,8 @@ bool StandaloneCall::getNextTuplesInternal(ExecutionContext* context) {
             standaloneCallInfo.optionValue);
         break;
     }
+    // Options can change how queries are bound and planned.
+    context->clientContext->getQueryPlanCache().clear();
     metrics->numOutputTuple.incrementByOne();
     return true;
 }
@@ -2,6 +2,7 @@
 
 #include "common/exception/transaction_manager.h"
 #include "processor/execution_context.h"
+#include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
 #include "transaction/transaction_manager.h"
 
@@ -39,6 +40,7 @@ bool Transaction::getNextTuplesInternal(ExecutionContext* context) {
         transactionContext->rollback();
     } break;
     case TransactionAction::CHECKPOINT: {
+        storage::StorageManager::Get(*clientContext)->runIndexMaintenance(*clientContext);
         TransactionManager::Get(*clientContext)->checkpoint(*clientContext);
     } break;
     default: {
@@ -17,12 +17,36 @@ std::string UnwindPrintInfo::toString() const {
     return result;
 }
 
+void Unwind::initGlobalStateInternal(ExecutionContext* /*context*/) {
+    if (sharedState != nullptr) {
+        sharedState->listVector = nullptr;
+        sharedState->nextIdx = 0;
+    }
+}
+
 void Unwind::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     expressionEvaluator->init(*resultSet, context->clientContext);
     outValueVector = resultSet->getValueVector(outDataPos);
     if (idPos.isValid()) {
         idVector = resultSet->getValueVector(idPos).get();
     }
+    listVector = expressionEvaluator->resultVector.get();
+    if (sharedState == nullptr) {
+        return;
+    }
+    // The first thread evaluates the list, which the other threads read without copying it.
+    std::unique_lock lck{sharedState->mtx};
+    if (sharedState->listVector == nullptr) {
+        expressionEvaluator->evaluate();
+        const auto& resultVector = expressionEvaluator->resultVector;
+        const auto pos = resultVector->state->getSelVector()[0];
+        sharedState->listEntry = resultVector->isNull(pos) ?
+                                     list_entry_t{0, 0} :
+                                     resultVector->getValue<list_entry_t>(pos);
+        sharedState->listVector = resultVector;
+    }
+    listVector = sharedState->listVector.get();
+    listEntry = sharedState->listEntry;
 }
 
 bool Unwind::hasMoreToRead() const {
@@ -30,7 +54,7 @@ bool Unwind::hasMoreToRead() const {
 }
 
 void Unwind::copyTuplesToOutVector(uint64_t startPos, uint64_t endPos) const {
-    auto listDataVector = ListVector::getDataVector(expressionEvaluator->resultVector.get());
+    auto listDataVector = ListVector::getDataVector(listVector);
     auto listPos = listEntry.offset + startPos;
     for (auto i = 0u; i < endPos - startPos; i++) {
         outValueVector->copyFromVectorData(i, listDataVector, listPos++);
@@ -45,7 +69,22 @@ void Unwind::copyTuplesToOutVector(uint64_t startPos, uint64_t endPos) const {
     }
 }
 
+bool Unwind::getNextTuplesFromSharedList() {
+    const auto startPos = sharedState->nextIdx.fetch_add(DEFAULT_VECTOR_CAPACITY);
+    if (startPos >= listEntry.size) {
+        return false;
+    }
+    const auto endPos = std::min<uint64_t>(startPos + DEFAULT_VECTOR_CAPACITY, listEntry.size);
+    copyTuplesToOutVector(startPos, endPos);
+    outValueVector->state->initOriginalAndSelectedSize(endPos - startPos);
+    metrics->numOutputTuple.increase(endPos - startPos);
+    return true;
+}
+
 bool Unwind::getNextTuplesInternal(ExecutionContext* context) {
+    if (sharedState != nullptr) {
+        return getNextTuplesFromSharedList();
+    }
     if (hasMoreToRead()) {
         auto totalElementsCopy =
             std::min(DEFAULT_VECTOR_CAPACITY, (uint64_t)listEntry.size - startIndex);
@@ -75,5 +114,12 @@ bool Unwind::getNextTuplesInternal(ExecutionContext* context) {
     return true;
 }
 
+double Unwind::getProgress(ExecutionContext* /*context*/) const {
+    if (sharedState == nullptr || listEntry.size == 0) {
+        return 0.0;
+    }
+    return std::min(1.0, static_cast<double>(sharedState->nextIdx) / listEntry.size);
+}
+
 } // namespace processor
 } // namespace kuzu
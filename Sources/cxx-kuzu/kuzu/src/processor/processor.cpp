@@ -1,10 +1,20 @@
 #include "processor/processor.h"
 
+#include <algorithm>
+
 #include "common/task_system/progress_bar.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/plan_printer.h"
 #include "main/query_result.h"
+#include "main/query_stats.h"
 #include "processor/operator/sink.h"
 #include "processor/physical_plan.h"
 #include "processor/processor_task.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -22,6 +32,14 @@ QueryProcessor::QueryProcessor(uint64_t numThreads) {
 }
 #endif
 
+static FileIOStatsSnapshot getTotalIOStats(const main::ClientContext& context) {
+    FileIOStatsSnapshot total;
+    for (auto& stats : MemoryManager::Get(context)->getBufferManager()->getIOStats()) {
+        total.merge(stats);
+    }
+    return total;
+}
+
 std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physicalPlan,
     ExecutionContext* context) {
     auto lastOperator = physicalPlan->lastOperator.get();
@@ -30,18 +48,107 @@ std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physica
     // prevOperator in the same pipeline, and decompose build and its prevOperator into another
     // one.
     auto sink = lastOperator->ptrCast<Sink>();
+    // Read before executing, as the query of the client context may change once a streamed result
+    // starts being consumed.
+    auto query = context->clientContext->getActiveQueryString();
     auto task = std::make_shared<ProcessorTask>(sink, context);
     for (auto i = (int64_t)sink->getNumChildren() - 1; i >= 0; --i) {
         decomposePlanIntoTask(sink->getChild(i), task.get(), context);
     }
     initTask(task.get());
+    const auto slowQueryThreshold =
+        context->clientContext->getClientConfig()->slowQueryThresholdInMS;
+    std::optional<FileIOStatsSnapshot> ioStatsBeforeQuery;
+    if (slowQueryThreshold > 0) {
+        ioStatsBeforeQuery = getTotalIOStats(*context->clientContext);
+    }
     auto progressBar = ProgressBar::Get(*context->clientContext);
     progressBar->startProgress(context->queryID);
+    auto timer = TimeMetric(true /* enable */);
+    timer.start();
     taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    timer.stop();
     progressBar->endProgress(context->queryID);
+    const auto executionTimeMS = timer.getElapsedTimeMS();
+    if (ioStatsBeforeQuery.has_value() &&
+        context->compilingTimeMS + executionTimeMS >= slowQueryThreshold) {
+        auto ioStats = getTotalIOStats(*context->clientContext);
+        ioStats.subtract(*ioStatsBeforeQuery);
+        recordSlowQuery(*physicalPlan, *context, query, executionTimeMS, std::move(ioStats));
+    }
+    recordQueryStats(*physicalPlan, *context, std::move(query), executionTimeMS);
     return sink->getQueryResult();
 }
 
+static void collectOperatorStats(PhysicalOperator* op, const ExecutionContext& context,
+    std::vector<main::OperatorStats>& stats) {
+    auto peakMemory = context.memoryTracker == nullptr ?
+                          0 :
+                          context.memoryTracker->getOperatorPeakMemory(op->getOperatorID());
+    stats.push_back({PhysicalOperatorUtils::operatorToString(op),
+        op->getNumOutputTuples(*context.profiler), op->getExecutionTime(*context.profiler),
+        peakMemory});
+    for (auto i = 0u; i < op->getNumChildren(); i++) {
+        collectOperatorStats(op->getChild(i), context, stats);
+    }
+}
+
+// The statistics of recent queries are kept for all connections of the database, so only a prefix
+// of the text of long queries is kept. The prefix is cut at a UTF-8 character boundary.
+static std::string truncateQuery(std::string query, uint64_t maxLength) {
+    if (query.size() <= maxLength) {
+        return query;
+    }
+    auto length = maxLength;
+    while (length > 0 && (static_cast<uint8_t>(query[length]) & 0xC0) == 0x80) {
+        length--;
+    }
+    query.resize(length);
+    if (length > 0) {
+        query += "...";
+    }
+    query.shrink_to_fit();
+    return query;
+}
+
+void QueryProcessor::recordQueryStats(PhysicalPlan& physicalPlan, ExecutionContext& context,
+    std::string query, double executionTimeMS) {
+    auto peakMemory =
+        context.memoryTracker == nullptr ? 0 : context.memoryTracker->getPeakMemory();
+    const auto maxQueryLength =
+        context.clientContext->getClientConfig()->queryStatsMaxQueryLength;
+    main::QueryStats stats{context.queryID, truncateQuery(std::move(query), maxQueryLength),
+        executionTimeMS, peakMemory, {}};
+    collectOperatorStats(physicalPlan.lastOperator.get(), context, stats.operators);
+    context.clientContext->getDatabase()->getQueryStatsLog()->addQuery(std::move(stats));
+}
+
+static std::string getRedactedParameters(const ExecutionContext& context) {
+    if (context.parameters == nullptr) {
+        return "";
+    }
+    std::vector<std::string> parameters;
+    for (auto& [name, value] : *context.parameters) {
+        parameters.push_back("$" + name + ": " + value->getDataType().toString());
+    }
+    std::sort(parameters.begin(), parameters.end());
+    std::string result;
+    for (auto& parameter : parameters) {
+        result += result.empty() ? parameter : ", " + parameter;
+    }
+    return result;
+}
+
+void QueryProcessor::recordSlowQuery(PhysicalPlan& physicalPlan, ExecutionContext& context,
+    std::string query, double executionTimeMS, FileIOStatsSnapshot ioStats) {
+    auto peakMemory =
+        context.memoryTracker == nullptr ? 0 : context.memoryTracker->getPeakMemory();
+    auto plan = main::PlanPrinter::printPlanToOstream(&physicalPlan, context.profiler).str();
+    main::SlowQuery slowQuery{context.queryID, std::move(query), getRedactedParameters(context),
+        context.compilingTimeMS, executionTimeMS, peakMemory, std::move(ioStats), std::move(plan)};
+    context.clientContext->getDatabase()->getSlowQueryLog()->addQuery(std::move(slowQuery));
+}
+
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     ExecutionContext* context) {
     if (op->isSource()) {
@@ -49,10 +156,20 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     }
     if (op->isSink()) {
         auto childTask = std::make_unique<ProcessorTask>(ku_dynamic_cast<Sink*>(op), context);
-        for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
-            decomposePlanIntoTask(op->getChild(i), childTask.get(), context);
+        if (isExportDatabaseSink(*op, *context)) {
+            decomposeExportDatabaseIntoTask(op, childTask.get(), context);
+        } else {
+            for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
+                decomposePlanIntoTask(op->getChild(i), childTask.get(), context);
+            }
         }
         task->addChildTask(std::move(childTask));
+    } else if (canExecuteChildrenConcurrently(*op, *context)) {
+        auto group = std::make_unique<TaskGroup>();
+        for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
+            decomposePlanIntoTask(op->getChild(i), group.get(), context);
+        }
+        task->addChildTask(std::move(group));
     } else {
         // Schedule the right most side (e.g., build side of the hash join) first.
         for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
@@ -61,7 +178,92 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     }
 }
 
+bool QueryProcessor::canExecuteChildrenConcurrently(const PhysicalOperator& op,
+    const ExecutionContext& context) {
+    // The branches of a union are materialized independently of each other. Other pipelines, e.g.
+    // hash join builds, may depend on each other through semi masks. Updates keep their order.
+    return op.getOperatorType() == PhysicalOperatorType::UNION_ALL_SCAN &&
+           op.getNumChildren() > 1 &&
+           transaction::Transaction::Get(*context.clientContext)->isReadOnly();
+}
+
+bool QueryProcessor::isExportDatabaseSink(const PhysicalOperator& op,
+    const ExecutionContext& context) {
+    // The first child is the ExportDB operator, and every other child exports one table.
+    return op.getOperatorType() == PhysicalOperatorType::DUMMY_SIMPLE_SINK &&
+           op.getNumChildren() > 2 &&
+           op.getChild(0)->getOperatorType() == PhysicalOperatorType::EXPORT_DATABASE &&
+           transaction::Transaction::Get(*context.clientContext)->isReadOnly();
+}
+
+void QueryProcessor::decomposeExportDatabaseIntoTask(PhysicalOperator* op, Task* task,
+    ExecutionContext* context) {
+    // Each table is exported into a file of its own, so the tables are exported concurrently.
+    // Tables that cannot use every worker on their own (e.g. the parquet writer is single-threaded)
+    // then share the workers instead of waiting for each other. The tables are spread over at most
+    // one lane per thread, whose tables are exported one after another, which bounds the number of
+    // files written at the same time and the memory of their writers.
+    const auto numTables = op->getNumChildren() - 1;
+    const auto numLanes = std::max<uint64_t>(1,
+        std::min<uint64_t>(numTables, context->clientContext->getMaxNumThreadForExec()));
+    auto group = std::make_unique<TaskGroup>();
+    for (auto i = 0u; i < numTables; ++i) {
+        // The tasks added to the first task of a lane are its dependencies, which are scheduled one
+        // after another before it.
+        auto lane = i < numLanes ? group.get() : group->children[i % numLanes].get();
+        decomposePlanIntoTask(op->getChild(i + 1), lane, context);
+    }
+    task->addChildTask(std::move(group));
+    // ExportDB writes the copy statements, which depend on the exported files, so it runs last.
+    decomposePlanIntoTask(op->getChild(0), task, context);
+}
+
+// Returns the largest number of tuples estimated to be output by an operator of the pipeline, if
+// the pipeline scans a node table. The estimates of other sources, e.g. of files, are not reliable.
+static std::optional<cardinality_t> estimatePipelineCardinality(const PhysicalOperator& sink) {
+    std::optional<cardinality_t> cardinality;
+    auto op = &sink;
+    while (true) {
+        if (auto estimate = op->getEstimatedCardinality(); estimate.has_value()) {
+            cardinality = std::max(cardinality.value_or(0), *estimate);
+        }
+        if (op->isSource()) {
+            break;
+        }
+        op = op->getChild(0);
+    }
+    if (op->getOperatorType() != PhysicalOperatorType::SCAN_NODE_TABLE) {
+        return std::nullopt;
+    }
+    return cardinality;
+}
+
+static void limitParallelism(ProcessorTask& task, const Sink& sink,
+    const ExecutionContext& context) {
+    const auto numTuplesPerThread =
+        context.clientContext->getClientConfig()->pipelineTuplesPerThread;
+    if (numTuplesPerThread == 0) {
+        return;
+    }
+    auto cardinality = estimatePipelineCardinality(sink);
+    if (!cardinality.has_value()) {
+        return;
+    }
+    const auto numThreads = (*cardinality + numTuplesPerThread - 1) / numTuplesPerThread;
+    if (numThreads <= 1) {
+        task.setInlineTask();
+    } else {
+        task.limitMaxNumThreads(numThreads);
+    }
+}
+
 void QueryProcessor::initTask(Task* task) {
+    if (task->isGroup()) {
+        for (auto& child : task->children) {
+            initTask(child.get());
+        }
+        return;
+    }
     auto processorTask = ku_dynamic_cast<ProcessorTask*>(task);
     PhysicalOperator* op = processorTask->sink;
     while (!op->isSource()) {
@@ -73,6 +275,7 @@ void QueryProcessor::initTask(Task* task) {
     if (!op->isParallel()) {
         task->setSingleThreadedTask();
     }
+    limitParallelism(*processorTask, *processorTask->sink, *processorTask->executionContext);
     for (auto& child : task->children) {
         initTask(child.get());
     }
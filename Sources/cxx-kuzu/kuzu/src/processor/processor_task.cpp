@@ -1,10 +1,14 @@
 #include "processor/processor_task.h"
 
+#include <optional>
+
 #include "common/task_system/progress_bar.h"
+#include "common/tracer.h"
 #include "main/client_context.h"
 #include "main/settings.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
 
 using namespace kuzu::common;
 
@@ -16,7 +20,26 @@ ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
                .getValue<uint64_t>()},
       sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
 
+std::optional<storage::MemoryTrackerScope> ProcessorTask::trackMemory(const Sink& sink,
+    const ExecutionContext& context) {
+    if (context.memoryTracker == nullptr) {
+        return std::nullopt;
+    }
+    return std::make_optional<storage::MemoryTrackerScope>(context.memoryTracker,
+        sink.getOperatorID());
+}
+
+std::optional<storage::MemoryTrackerScope> ProcessorTask::trackMemory(
+    const storage::MemoryTrackerScope* pipelineScope) {
+    if (pipelineScope == nullptr) {
+        return std::nullopt;
+    }
+    return std::make_optional<storage::MemoryTrackerScope>(pipelineScope->getTracker(),
+        pipelineScope->getOperatorUsage());
+}
+
 void ProcessorTask::run() {
+    auto memoryScope = trackMemory(*sink, *executionContext);
     // We need the lock when cloning because multiple threads can be accessing to clone,
     // which is not thread safe
     lock_t lck{taskMtx};
@@ -28,10 +51,21 @@ void ProcessorTask::run() {
     lck.unlock();
     auto resultSet =
         sink->getResultSet(storage::MemoryManager::Get(*executionContext->clientContext));
+    auto profiler = executionContext->profiler;
+    const auto startTime = profiler->enabled ? profiler->getElapsedTimeMS() : 0;
     taskRoot->ptrCast<Sink>()->execute(resultSet.get(), executionContext);
+    if (profiler->enabled) {
+        profiler->recordPipelineTask(sink->getOperatorID(), startTime,
+            profiler->getElapsedTimeMS());
+    }
 }
 
 void ProcessorTask::finalize() {
+    auto memoryScope = trackMemory(*sink, *executionContext);
+    std::optional<TraceScope> traceScope;
+    if (Tracer::Get().isEnabled()) [[unlikely]] {
+        traceScope.emplace("pipeline", "FINALIZE " + getName());
+    }
     ProgressBar::Get(*executionContext->clientContext)->finishPipeline(executionContext->queryID);
     sink->finalize(executionContext);
 }
@@ -40,5 +74,10 @@ bool ProcessorTask::terminate() {
     return sink->terminate();
 }
 
+std::string ProcessorTask::getName() const {
+    return PhysicalOperatorUtils::operatorToString(sink) + " #" +
+           std::to_string(sink->getOperatorID());
+}
+
 } // namespace processor
 } // namespace kuzu
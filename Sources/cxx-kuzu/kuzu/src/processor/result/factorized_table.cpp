@@ -54,6 +54,14 @@ void DataBlock::copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxTo
     blockToCopyInto->freeSize -= (numTuplesToCopy * numBytesPerTuple);
 }
 
+uint64_t DataBlockCollection::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->getSizedData().size();
+    }
+    return memoryUsage;
+}
+
 void DataBlockCollection::merge(DataBlockCollection& other) {
     if (blocks.empty()) {
         append(std::move(other.blocks));
@@ -265,6 +273,14 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     return totalNumFlatTuples;
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    if (tableSchema.isEmpty()) {
+        return 0;
+    }
+    return flatTupleBlockCollection->getMemoryUsage() +
+           unFlatTupleBlockCollection->getMemoryUsage() + inMemOverflowBuffer->getMemoryUsage();
+}
+
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     std::unordered_map<uint32_t, bool> calculatedGroups;
     uint64_t numFlatTuples = 1;
@@ -424,10 +440,96 @@ void FactorizedTable::copyFlatVectorToFlatColumn(const ValueVector& vector,
     }
 }
 
+// Values of fixed size are copied between vectors and tuples with loads and stores of their width,
+// instead of going through copyToRowData and copyFromRowData for each value.
+template<uint32_t NUM_BYTES>
+struct FixedSizeValue {
+    uint8_t bytes[NUM_BYTES];
+};
+
+static uint32_t getFixedSizeNumBytes(const ValueVector& vector) {
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::STRUCT:
+    case PhysicalTypeID::ARRAY:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::STRING:
+        return 0;
+    default:
+        return LogicalTypeUtils::getRowLayoutSize(vector.dataType);
+    }
+}
+
+template<typename T>
+struct ScatterValues {
+    static void copy(const uint8_t* srcData, const SelectionVector& selVector, uint64_t startPos,
+        uint64_t numValues, uint8_t* dstTuple, uint32_t numBytesPerTuple) {
+        auto srcValues = reinterpret_cast<const T*>(srcData);
+        if (selVector.isUnfiltered()) {
+            for (auto i = 0u; i < numValues; i++) {
+                memcpy(dstTuple, &srcValues[startPos + i], sizeof(T));
+                dstTuple += numBytesPerTuple;
+            }
+        } else {
+            for (auto i = 0u; i < numValues; i++) {
+                memcpy(dstTuple, &srcValues[selVector[startPos + i]], sizeof(T));
+                dstTuple += numBytesPerTuple;
+            }
+        }
+    }
+};
+
+template<typename T>
+struct GatherValues {
+    static void copy(uint8_t** tuples, ft_col_offset_t colOffset, uint64_t numValues,
+        const SelectionVector& selVector, uint8_t* dstData) {
+        auto dstValues = reinterpret_cast<T*>(dstData);
+        if (selVector.isUnfiltered()) {
+            for (auto i = 0u; i < numValues; i++) {
+                memcpy(&dstValues[i], tuples[i] + colOffset, sizeof(T));
+            }
+        } else {
+            for (auto i = 0u; i < numValues; i++) {
+                memcpy(&dstValues[selVector[i]], tuples[i] + colOffset, sizeof(T));
+            }
+        }
+    }
+};
+
+// Returns false if values of the given size are not copied by a specialized loop.
+template<template<typename> class OP, typename... ARGS>
+static bool copyFixedSizeValues(uint32_t numBytes, ARGS&&... args) {
+    switch (numBytes) {
+    case 1: {
+        OP<uint8_t>::copy(std::forward<ARGS>(args)...);
+    } break;
+    case 2: {
+        OP<uint16_t>::copy(std::forward<ARGS>(args)...);
+    } break;
+    case 4: {
+        OP<uint32_t>::copy(std::forward<ARGS>(args)...);
+    } break;
+    case 8: {
+        OP<uint64_t>::copy(std::forward<ARGS>(args)...);
+    } break;
+    case 16: {
+        OP<FixedSizeValue<16>>::copy(std::forward<ARGS>(args)...);
+    } break;
+    default:
+        return false;
+    }
+    return true;
+}
+
 void FactorizedTable::copyUnflatVectorToFlatColumn(const ValueVector& vector,
     const BlockAppendingInfo& blockAppendInfo, uint64_t numAppendedTuples, ft_col_idx_t colIdx) {
     auto byteOffsetOfColumnInTuple = tableSchema.getColOffset(colIdx);
     auto dstTuple = blockAppendInfo.data;
+    if (vector.hasNoNullsGuarantee() &&
+        copyFixedSizeValues<ScatterValues>(getFixedSizeNumBytes(vector), vector.getData(),
+            vector.state->getSelVector(), numAppendedTuples, blockAppendInfo.numTuplesToAppend,
+            dstTuple + byteOffsetOfColumnInTuple, tableSchema.getNumBytesPerTuple())) {
+        return;
+    }
     if (vector.state->getSelVector().isUnfiltered()) {
         if (vector.hasNoNullsGuarantee()) {
             for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
@@ -624,6 +726,11 @@ void FactorizedTable::readFlatColToUnflatVector(uint8_t** tuplesToRead, ft_col_i
     vector.state->getSelVectorUnsafe().setSelSize(numTuplesToRead);
     if (hasNoNullGuarantee(colIdx)) {
         vector.setAllNonNull();
+        if (copyFixedSizeValues<GatherValues>(getFixedSizeNumBytes(vector), tuplesToRead,
+                tableSchema.getColOffset(colIdx), numTuplesToRead, vector.state->getSelVector(),
+                vector.getData())) {
+            return;
+        }
         for (auto i = 0u; i < numTuplesToRead; i++) {
             auto positionInVectorToWrite = vector.state->getSelVector()[i];
             auto srcData = tuplesToRead[i] + tableSchema.getColOffset(colIdx);
@@ -0,0 +1,103 @@
+#include "processor/result/factorized_tuple.h"
+
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+FactorizedTuple::FactorizedTuple(const std::vector<LogicalType>& types)
+    : types{LogicalType::copy(types)}, values(types.size()) {}
+
+idx_t FactorizedTuple::getNumColumns() const {
+    return types.size();
+}
+
+idx_t FactorizedTuple::getNumGroups() const {
+    return numRowsPerGroup.size();
+}
+
+static void checkOutOfRange(const char* name, idx_t idx, idx_t size) {
+    if (idx >= size) {
+        throw RuntimeException(
+            stringFormat("Index {} is out of range. Number of {}s: {}.", idx, name, size));
+    }
+}
+
+idx_t FactorizedTuple::getGroupIdx(idx_t colIdx) const {
+    checkOutOfRange("column", colIdx, getNumColumns());
+    return groupIdxes[colIdx];
+}
+
+uint64_t FactorizedTuple::getNumRows(idx_t groupIdx) const {
+    checkOutOfRange("group", groupIdx, getNumGroups());
+    return numRowsPerGroup[groupIdx];
+}
+
+uint64_t FactorizedTuple::getNumFlatTuples() const {
+    uint64_t numFlatTuples = 1;
+    for (auto numRows : numRowsPerGroup) {
+        numFlatTuples *= numRows;
+    }
+    return numFlatTuples;
+}
+
+Value* FactorizedTuple::getValue(idx_t colIdx, idx_t rowIdx) {
+    checkOutOfRange("column", colIdx, getNumColumns());
+    checkOutOfRange("row", rowIdx, numRowsPerGroup[groupIdxes[colIdx]]);
+    return &values[colIdx][rowIdx];
+}
+
+void FactorizedTuple::read(const FactorizedTable& table, ft_tuple_idx_t tupleIdx) {
+    auto tableSchema = table.getTableSchema();
+    KU_ASSERT(tableSchema->getNumColumns() >= types.size());
+    if (groupIdxes.empty()) {
+        // Groups are numbered in the order of their first columns.
+        std::unordered_map<idx_t, idx_t> groupIdxOfDataChunk;
+        for (auto i = 0u; i < types.size(); i++) {
+            auto groupID = tableSchema->getColumn(i)->getGroupID();
+            auto [it, inserted] = groupIdxOfDataChunk.emplace(groupID, groupIdxOfDataChunk.size());
+            groupIdxes.push_back(it->second);
+        }
+        numRowsPerGroup.resize(groupIdxOfDataChunk.size());
+    }
+    auto tuple = table.getTuple(tupleIdx);
+    for (auto i = 0u; i < types.size(); i++) {
+        auto column = tableSchema->getColumn(i);
+        auto& columnValues = values[i];
+        auto colBuffer = tuple + tableSchema->getColOffset(i);
+        if (column->isFlat()) {
+            numRowsPerGroup[groupIdxes[i]] = 1;
+            if (columnValues.empty()) {
+                columnValues.push_back(Value::createDefaultValue(types[i]));
+            }
+            auto isNull = table.isNonOverflowColNull(tuple + tableSchema->getNullMapOffset(), i);
+            columnValues[0].setNull(isNull);
+            if (!isNull) {
+                columnValues[0].copyFromRowLayout(colBuffer);
+            }
+            continue;
+        }
+        auto overflowValue = (overflow_value_t*)colBuffer;
+        auto numRows = overflowValue->numElements;
+        numRowsPerGroup[groupIdxes[i]] = numRows;
+        while (columnValues.size() < numRows) {
+            columnValues.push_back(Value::createDefaultValue(types[i]));
+        }
+        auto rowSize = LogicalTypeUtils::getRowLayoutSize(types[i]);
+        auto nullBuffer = overflowValue->value + rowSize * numRows;
+        for (auto row = 0u; row < numRows; row++) {
+            auto isNull = table.isOverflowColNull(nullBuffer, row, i);
+            columnValues[row].setNull(isNull);
+            if (!isNull) {
+                columnValues[row].copyFromRowLayout(overflowValue->value + rowSize * row);
+            }
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
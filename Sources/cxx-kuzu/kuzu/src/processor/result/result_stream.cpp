@@ -0,0 +1,84 @@
+#include "processor/result/result_stream.h"
+
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void ResultStream::push(std::unique_ptr<FactorizedTable> table) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [this]() { return cancelled || numBufferedTuples < capacity; });
+    if (cancelled) {
+        throw InterruptException();
+    }
+    numBufferedTuples += table->getTotalNumFlatTuples();
+    tables.push_back(std::move(table));
+    cv.notify_all();
+}
+
+void ResultStream::finish(std::string errorMessage_) {
+    {
+        std::unique_lock lck{mtx};
+        finished = true;
+        errorMessage = std::move(errorMessage_);
+        cancelCallback = nullptr;
+    }
+    cv.notify_all();
+}
+
+void ResultStream::cancel() {
+    {
+        std::unique_lock lck{mtx};
+        // The chunks of a finished stream can still be read.
+        if (finished) {
+            return;
+        }
+        cancelled = true;
+        if (cancelCallback) {
+            cancelCallback();
+        }
+    }
+    cv.notify_all();
+}
+
+std::unique_ptr<FactorizedTable> ResultStream::pop() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [this]() { return cancelled || finished || !tables.empty(); });
+    if (cancelled) {
+        throw RuntimeException("The query result has been closed, because another query has been "
+                               "executed on the connection.");
+    }
+    if (tables.empty()) {
+        if (!errorMessage.empty()) {
+            throw RuntimeException(errorMessage);
+        }
+        return nullptr;
+    }
+    auto table = std::move(tables.front());
+    tables.pop_front();
+    numBufferedTuples -= table->getTotalNumFlatTuples();
+    cv.notify_all();
+    return table;
+}
+
+std::string ResultStream::waitForFirstChunk() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [this]() { return cancelled || finished || !tables.empty(); });
+    return tables.empty() ? errorMessage : "";
+}
+
+void ResultStream::clear(bool preventDestruction) {
+    std::unique_lock lck{mtx};
+    for (auto& table : tables) {
+        table->setPreventDestruction(preventDestruction);
+    }
+    tables.clear();
+    numBufferedTuples = 0;
+    cv.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
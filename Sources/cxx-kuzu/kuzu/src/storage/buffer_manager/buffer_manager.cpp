@@ -12,8 +12,12 @@
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/local_file_system.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/numa_utils.h"
+#include "common/tracer.h"
 #include "common/types/types.h"
+#include "common/utils.h"
 #include "main/db_config.h"
+#include "storage/buffer_manager/buffer_pool_warm_up.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/file_handle.h"
 #include "storage/table/column_chunk_data.h"
@@ -64,13 +68,22 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 }
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
-    : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / KUZU_PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly,
+    bool enableHugePages [[maybe_unused]], EvictionPolicy evictionPolicy)
+    : bufferPoolSize{bufferPoolSize},
+      probationQueue{bufferPoolSize / KUZU_PAGE_SIZE / PROBATION_QUEUE_CAPACITY_RATIO},
+      evictionPolicy{evictionPolicy},
+      usedMemory{probationQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
     verifySizeParams(bufferPoolSize, maxDBSize);
+    const auto numNUMANodes = NumaUtils::getNumNodes();
+    const auto queueCapacity = ceilDiv<uint64_t>(bufferPoolSize / KUZU_PAGE_SIZE, numNUMANodes);
+    for (auto node = 0u; node < numNUMANodes; node++) {
+        evictionQueues.push_back(std::make_unique<EvictionQueue>(queueCapacity));
+        usedMemory += evictionQueues.back()->getCapacity() * sizeof(EvictionCandidate);
+    }
 #if !BM_MALLOC
-    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize);
+    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize, enableHugePages);
+    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize, enableHugePages);
 #endif
 
     // TODO(bmwinger): It may be better to spill to disk in a different location for remote file
@@ -113,20 +126,28 @@ void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize
 uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
     PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
+    fileHandle.getIOStats().add(FileIOCounter::PINS);
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
         case PageState::EVICTED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                std::optional<TraceScope> traceScope;
+                if (Tracer::Get().isEnabled()) [[unlikely]] {
+                    auto fileInfo = fileHandle.getFileInfo();
+                    traceScope.emplace("buffer_manager",
+                        fileInfo == nullptr ? "PIN_MISS" : "PIN_MISS " + fileInfo->path);
+                }
                 if (!claimAFrame(fileHandle, pageIdx, pageReadPolicy)) {
                     pageState->resetToEvicted();
                     throw BufferManagerException("Unable to allocate memory! The buffer pool is "
                                                  "full and no memory could be freed!");
                 }
-                if (!evictionQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
+                if (!insertEvictionCandidate(fileHandle, pageIdx, pageReadPolicy)) {
                     throw BufferManagerException(
                         "Eviction queue is full! This should be impossible.");
                 }
+                fileHandle.getIOStats().add(FileIOCounter::MISSES);
 #if BM_MALLOC
                 KU_ASSERT(pageState->getPage());
                 return pageState->getPage();
@@ -138,6 +159,11 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
         case PageState::UNLOCKED:
         case PageState::MARKED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                fileHandle.getIOStats().add(FileIOCounter::HITS);
+                if (pageReadPolicy != PageReadPolicy::READ_PAGE_ONCE &&
+                    !PageState::isReferenced(currStateAndVersion)) {
+                    pageState->setReferenced();
+                }
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -216,23 +242,35 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // A page cached by the pin below is already counted as an access by the pin.
+    auto isAccessCounted = false;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
         case PageState::UNLOCKED: {
             if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                     fileHandle.getPageSizeClass(), pageState)) {
+                fileHandle.getIOStats().add(FileIOCounter::OPTIMISTIC_READ_RETRIES);
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (!isAccessCounted) {
+                    fileHandle.getIOStats().add(FileIOCounter::HITS);
+                    // Re-reads by a scan don't count, as a scan reads each page several times.
+                    if (pageReadPolicy != PageReadPolicy::READ_PAGE_ONCE &&
+                        !PageState::isReferenced(currStateAndVersion)) {
+                        pageState->trySetReferenced(currStateAndVersion);
+                    }
+                }
                 return;
             }
+            fileHandle.getIOStats().add(FileIOCounter::OPTIMISTIC_READ_RETRIES);
         } break;
         case PageState::MARKED: {
             // If the page is marked, we try to switch to unlocked.
@@ -240,8 +278,9 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
             continue;
         }
         case PageState::EVICTED: {
-            pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
+            pin(fileHandle, pageIdx, pageReadPolicy);
             unpin(fileHandle, pageIdx);
+            isAccessCounted = true;
         } break;
         default: {
             // When locked, continue the spinning.
@@ -251,13 +290,285 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     }
 }
 
+void BufferManager::prefetch(FileHandle& fileHandle, const PageRange& pageRange) {
+    if (fileHandle.isInMemoryMode() || fileHandle.getFileInfo() == nullptr ||
+        pageRange.startPageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    const auto numPages = fileHandle.getNumPages();
+    if (pageRange.startPageIdx >= numPages) {
+        return;
+    }
+    const auto endPageIdx =
+        std::min<page_idx_t>(pageRange.startPageIdx + pageRange.numPages, numPages);
+    const auto pageSize = fileHandle.getPageSize();
+    auto runStartPageIdx = INVALID_PAGE_IDX;
+    for (auto pageIdx = pageRange.startPageIdx; pageIdx <= endPageIdx; pageIdx++) {
+        const bool needsRead = pageIdx < endPageIdx &&
+                               fileHandle.getPageState(pageIdx)->getState() == PageState::EVICTED;
+        if (needsRead) {
+            if (runStartPageIdx == INVALID_PAGE_IDX) {
+                runStartPageIdx = pageIdx;
+            }
+        } else if (runStartPageIdx != INVALID_PAGE_IDX) {
+#if !BM_MALLOC
+            if (fileHandle.isDirectIO()) {
+                // Pages read ahead by a scan are likely read only once.
+                readAhead(fileHandle, runStartPageIdx, pageIdx, PageReadPolicy::READ_PAGE_ONCE);
+                runStartPageIdx = INVALID_PAGE_IDX;
+                continue;
+            }
+#endif
+            fileHandle.getFileInfo()->prefetch(runStartPageIdx * pageSize,
+                (pageIdx - runStartPageIdx) * pageSize);
+            runStartPageIdx = INVALID_PAGE_IDX;
+        }
+    }
+}
+
+void BufferManager::readAhead(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t endPageIdx, PageReadPolicy pageReadPolicy) {
+    const auto pageSize = fileHandle.getPageSize();
+    std::vector<page_idx_t> pagesToRead;
+    std::vector<FileReadRequest> requests;
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        auto pageState = fileHandle.getPageState(pageIdx);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        // Pages pinned by others in the meantime are skipped.
+        if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+            !pageState->tryLock(currStateAndVersion)) {
+            continue;
+        }
+        if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+            pageState->resetToEvicted();
+            break;
+        }
+        pagesToRead.push_back(pageIdx);
+        requests.push_back({getFrame(fileHandle, pageIdx), pageSize, pageIdx * pageSize});
+    }
+    if (pagesToRead.empty()) {
+        return;
+    }
+    fileHandle.getFileInfo()->readFiles(requests);
+    fileHandle.getIOStats().add(FileIOCounter::BYTES_READ, pagesToRead.size() * pageSize);
+    for (auto pageIdx : pagesToRead) {
+        if (!insertEvictionCandidate(fileHandle, pageIdx, pageReadPolicy)) {
+            throw BufferManagerException("Eviction queue is full! This should be impossible.");
+        }
+        unpin(fileHandle, pageIdx);
+    }
+}
+
+bool BufferManager::warmUpPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t endPageIdx, PageReadPolicy pageReadPolicy) {
+    const auto pageSize = fileHandle.getPageSize();
+    const auto memoryLimit = bufferPoolSize.load();
+    const auto freeMemory = memoryLimit - std::min<uint64_t>(usedMemory, memoryLimit);
+    // Pages that are already cached don't use more memory, but the free memory is only a snapshot
+    // anyway since queries claim frames concurrently.
+    const auto numPagesToRead =
+        std::min<uint64_t>(endPageIdx - startPageIdx, freeMemory / pageSize);
+    if (numPagesToRead > 0) {
+        readAhead(fileHandle, startPageIdx, startPageIdx + numPagesToRead, pageReadPolicy);
+    }
+    return startPageIdx + numPagesToRead == endPageIdx;
+}
+
+void BufferManager::saveHotPageManifest(FileHandle& fileHandle, const std::string& path) {
+    if (fileHandle.isInMemoryMode() || fileHandle.getFileInfo() == nullptr) {
+        return;
+    }
+    const auto numPages = fileHandle.getNumPages();
+    std::vector<bool> isProbationary(numPages, false);
+    probationQueue.forEachCandidate([&](const EvictionCandidate& candidate) {
+        if (candidate.fileIdx == fileHandle.getFileIndex() && candidate.pageIdx < numPages) {
+            isProbationary[candidate.pageIdx] = true;
+        }
+    });
+    // Runs of read again pages, other main queue pages and probationary pages, in that order.
+    std::array<std::vector<PageRange>, 3> tierRuns;
+    for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+        const auto state = fileHandle.getPageState(pageIdx)->getState();
+        if (state == PageState::EVICTED) {
+            continue;
+        }
+        auto& runs = tierRuns[isProbationary[pageIdx] ? 2 : state == PageState::MARKED ? 1 : 0];
+        if (!runs.empty() && runs.back().startPageIdx + runs.back().numPages == pageIdx) {
+            runs.back().numPages++;
+        } else {
+            runs.emplace_back(pageIdx, 1);
+        }
+    }
+    HotPageManifest manifest;
+    for (auto& runs : tierRuns) {
+        manifest.runs.insert(manifest.runs.end(), runs.begin(), runs.end());
+    }
+    manifest.numMainRuns = tierRuns[0].size() + tierRuns[1].size();
+    manifest.save(*vfs, path);
+}
+
+void BufferManager::startWarmUp(FileHandle& fileHandle, const std::string& path,
+    TaskScheduler& taskScheduler) {
+    stopWarmUp();
+    if (fileHandle.isInMemoryMode() || fileHandle.getFileInfo() == nullptr) {
+        return;
+    }
+    auto manifest = HotPageManifest::load(*vfs, path);
+    if (!manifest) {
+        return;
+    }
+    // The file may have been replaced since the manifest was saved, so runs past its end are
+    // dropped.
+    const auto numPages = fileHandle.getNumPages();
+    HotPageManifest validManifest;
+    for (auto i = 0u; i < manifest->runs.size(); i++) {
+        const auto& run = manifest->runs[i];
+        if (run.startPageIdx >= numPages || run.numPages == 0) {
+            continue;
+        }
+        validManifest.runs.emplace_back(run.startPageIdx,
+            std::min(run.numPages, numPages - run.startPageIdx));
+        if (i < manifest->numMainRuns) {
+            validManifest.numMainRuns++;
+        }
+    }
+    warmUp = std::make_shared<BufferPoolWarmUp>(*this, fileHandle, taskScheduler,
+        std::move(validManifest));
+    warmUp->start();
+}
+
+void BufferManager::stopWarmUp() {
+    if (warmUp) {
+        warmUp->stop();
+        warmUp.reset();
+    }
+}
+
+std::vector<FileIOStatsSnapshot> BufferManager::getIOStats() const {
+    std::vector<FileIOStatsSnapshot> result;
+    for (auto& fileHandle : fileHandles) {
+        auto stats = fileHandle->getIOStats().snapshot();
+        if (auto fileInfo = fileHandle->getFileInfo()) {
+            stats.filePath = fileInfo->path;
+        }
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
 void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
 }
 
+bool BufferManager::insertEvictionCandidate(FileHandle& fileHandle, page_idx_t pageIdx,
+    PageReadPolicy pageReadPolicy) {
+    // Falls back to the main queue if the probationary queue is full.
+    if (pageReadPolicy == PageReadPolicy::READ_PAGE_ONCE &&
+        evictionPolicy == EvictionPolicy::TWO_QUEUE &&
+        probationQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
+        return true;
+    }
+    return insertIntoEvictionQueues(EvictionCandidate{fileHandle.getFileIndex(), pageIdx});
+}
+
+bool BufferManager::insertIntoEvictionQueues(const EvictionCandidate& candidate) {
+    if (evictionQueues.size() == 1) {
+        return evictionQueues[0]->insert(candidate);
+    }
+    // A node may cache more than its share of the buffer pool, in which case its partition is full
+    // and the candidate goes to another node's partition.
+    const auto localNode = NumaUtils::getCurrentNode() % evictionQueues.size();
+    for (auto i = 0u; i < evictionQueues.size(); i++) {
+        if (evictionQueues[(localNode + i) % evictionQueues.size()]->insert(candidate)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Evicts up to 64 pages from the probationary queue and returns the space reclaimed. Probationary
+// pages get no second chance: pages that were re-referenced since they were cached are promoted to
+// the main queue, and all other pages are marked and evicted right away.
+uint64_t BufferManager::evictProbationaryPages() {
+    std::array<std::atomic<EvictionCandidate>*, EvictionQueue::BATCH_SIZE> evictionCandidates{};
+    size_t evictablePages = 0;
+    uint64_t claimedMemory = 0;
+    auto startCursor = probationQueue.getEvictionCursor();
+    while (evictablePages == 0 && probationQueue.getSize() > 0 &&
+           probationQueue.getEvictionCursor() - startCursor < probationQueue.getCapacity()) {
+        for (auto& candidate : probationQueue.next()) {
+            auto evictionCandidate = candidate.load();
+            if (evictionCandidate == EvictionQueue::EMPTY) {
+                continue;
+            }
+            KU_ASSERT(evictionCandidate.fileIdx < fileHandles.size());
+            auto* pageState =
+                fileHandles[evictionCandidate.fileIdx]->getPageState(evictionCandidate.pageIdx);
+            auto pageStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::isReferenced(pageStateAndVersion)) {
+                tryPromoteProbationaryPage(candidate);
+            } else if (evictionCandidate.isEvictable(pageStateAndVersion) ||
+                       (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion) &&
+                           pageState->tryMark(pageStateAndVersion))) {
+                evictionCandidates[evictablePages++] = &candidate;
+            }
+        }
+    }
+    for (size_t i = 0; i < evictablePages; i++) {
+        claimedMemory += tryEvictPage(probationQueue, *evictionCandidates[i]);
+    }
+    return claimedMemory;
+}
+
+void BufferManager::tryPromoteProbationaryPage(std::atomic<EvictionCandidate>& _candidate) {
+    auto candidate = _candidate.load();
+    if (candidate == EvictionQueue::EMPTY) {
+        return;
+    }
+    auto& pageState = *fileHandles[candidate.fileIdx]->getPageState(candidate.pageIdx);
+    auto currStateAndVersion = pageState.getStateAndVersion();
+    // Locking the page keeps other threads from evicting or promoting it while the candidate moves
+    // between queues.
+    const auto state = PageState::getState(currStateAndVersion);
+    if ((state != PageState::UNLOCKED && state != PageState::MARKED) ||
+        !pageState.tryLock(currStateAndVersion)) {
+        return;
+    }
+    if (_candidate.load() == candidate) {
+        pageState.clearReferenced();
+        probationQueue.clear(_candidate);
+        if (!insertIntoEvictionQueues(candidate)) {
+            throw BufferManagerException("Eviction queue is full! This should be impossible.");
+        }
+    }
+    pageState.unlockUnchanged();
+}
+
 // evicts up to 64 pages and returns the space reclaimed
 uint64_t BufferManager::evictPages() {
+    if (probationQueue.getSize() > 0) {
+        auto claimedMemory = evictProbationaryPages();
+        if (claimedMemory > 0) {
+            return claimedMemory;
+        }
+    }
+    if (evictionQueues.size() == 1) {
+        return evictPagesFromQueue(*evictionQueues[0]);
+    }
+    // Only fall back to the partitions of other NUMA nodes if the local one has nothing to evict.
+    const auto localNode = NumaUtils::getCurrentNode() % evictionQueues.size();
+    uint64_t claimedMemory = 0;
+    for (auto i = 0u; claimedMemory == 0 && i < evictionQueues.size(); i++) {
+        auto& queue = *evictionQueues[(localNode + i) % evictionQueues.size()];
+        if (queue.getSize() > 0) {
+            claimedMemory = evictPagesFromQueue(queue);
+        }
+    }
+    return claimedMemory;
+}
+
+uint64_t BufferManager::evictPagesFromQueue(EvictionQueue& queue) {
     std::array<std::atomic<EvictionCandidate>*, EvictionQueue::BATCH_SIZE> evictionCandidates{};
     size_t evictablePages = 0;
     uint64_t claimedMemory = 0;
@@ -268,10 +579,10 @@ uint64_t BufferManager::evictPages() {
     // are found, will evict the first batch.
     // Using the eviction queue's cursor means that we fail after the same number of total attempts,
     // regardless of how many threads are trying to evict.
-    auto startCursor = evictionQueue.getEvictionCursor();
-    auto failureLimit = evictionQueue.getCapacity() * 2;
-    while (evictablePages == 0 && evictionQueue.getEvictionCursor() - startCursor < failureLimit) {
-        for (auto& candidate : evictionQueue.next()) {
+    auto startCursor = queue.getEvictionCursor();
+    auto failureLimit = queue.getCapacity() * 2;
+    while (evictablePages == 0 && queue.getEvictionCursor() - startCursor < failureLimit) {
+        for (auto& candidate : queue.next()) {
             auto evictionCandidate = candidate.load();
             if (evictionCandidate == EvictionQueue::EMPTY) {
                 continue;
@@ -281,8 +592,10 @@ uint64_t BufferManager::evictPages() {
                 fileHandles[evictionCandidate.fileIdx]->getPageState(evictionCandidate.pageIdx);
             auto pageStateAndVersion = pageState->getStateAndVersion();
             if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
-                if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-                    pageState->tryMark(pageStateAndVersion);
+                if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion) &&
+                    pageState->tryMark(pageStateAndVersion)) {
+                    fileHandles[evictionCandidate.fileIdx]->getIOStats().add(
+                        FileIOCounter::SECOND_CHANCES);
                 }
                 continue;
             }
@@ -291,15 +604,16 @@ uint64_t BufferManager::evictPages() {
     }
 
     for (size_t i = 0; i < evictablePages; i++) {
-        claimedMemory += tryEvictPage(*evictionCandidates[i]);
+        claimedMemory += tryEvictPage(queue, *evictionCandidates[i]);
     }
     return claimedMemory;
 }
 
-void BufferManager::removeEvictedCandidates() {
-    auto startCursor = evictionQueue.getEvictionCursor();
-    while (evictionQueue.getEvictionCursor() - startCursor < evictionQueue.getCapacity()) {
-        for (auto& candidate : evictionQueue.next()) {
+static void removeEvictedCandidatesFromQueue(EvictionQueue& queue,
+    const std::vector<std::unique_ptr<FileHandle>>& fileHandles) {
+    auto startCursor = queue.getEvictionCursor();
+    while (queue.getEvictionCursor() - startCursor < queue.getCapacity()) {
+        for (auto& candidate : queue.next()) {
             auto evictionCandidate = candidate.load();
             if (evictionCandidate == EvictionQueue::EMPTY) {
                 continue;
@@ -309,12 +623,19 @@ void BufferManager::removeEvictedCandidates() {
                 fileHandles[evictionCandidate.fileIdx]->getPageState(evictionCandidate.pageIdx);
             auto pageStateAndVersion = pageState->getStateAndVersion();
             if (PageState::getState(pageStateAndVersion) == PageState::EVICTED) {
-                evictionQueue.clear(candidate);
+                queue.clear(candidate);
             }
         }
     }
 }
 
+void BufferManager::removeEvictedCandidates() {
+    for (auto& queue : evictionQueues) {
+        removeEvictedCandidatesFromQueue(*queue, fileHandles);
+    }
+    removeEvictedCandidatesFromQueue(probationQueue, fileHandles);
+}
+
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
@@ -400,7 +721,24 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
     return true;
 }
 
-uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate) {
+void BufferManager::spillUnusedChunks(uint64_t memoryBudget) {
+    if (!spiller) {
+        return;
+    }
+    while (spiller->getUnusedChunksMemory() > memoryBudget) {
+        auto [memoryFreed, nowEvictableMemory] = spiller->claimNextGroup();
+        if (memoryFreed == 0 && nowEvictableMemory == 0) {
+            // Other threads claimed the remaining groups, or spilling them doesn't free anything,
+            // so looping again wouldn't make progress.
+            break;
+        }
+        freeUsedMemory(memoryFreed);
+        nonEvictableMemory -= memoryFreed + nowEvictableMemory;
+    }
+}
+
+uint64_t BufferManager::tryEvictPage(EvictionQueue& queue,
+    std::atomic<EvictionCandidate>& _candidate) {
     auto candidate = _candidate.load();
     // Page must have been evicted by another thread already
     if (candidate.pageIdx == INVALID_PAGE_IDX) {
@@ -437,7 +775,8 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     auto numBytesFreed = fileHandle.getPageSize();
     releaseFrameForPage(fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
-    evictionQueue.clear(_candidate);
+    queue.clear(_candidate);
+    fileHandle.getIOStats().add(FileIOCounter::EVICTIONS);
     return numBytesFreed;
 }
 
@@ -447,11 +786,11 @@ void BufferManager::cachePageIntoFrame(FileHandle& fileHandle, page_idx_t pageId
     pageState->clearDirty();
 #if BM_MALLOC
     pageState->allocatePage(fileHandle.getPageSize());
-    if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+    if (pageReadPolicy != PageReadPolicy::DONT_READ_PAGE) {
         fileHandle.readPageFromDisk(pageState->getPage(), pageIdx);
     }
 #else
-    if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+    if (pageReadPolicy != PageReadPolicy::DONT_READ_PAGE) {
         fileHandle.readPageFromDisk(getFrame(fileHandle, pageIdx), pageIdx);
     }
 #endif
@@ -510,7 +849,9 @@ void BufferManager::resetSpiller(std::string spillPath) {
     }
 }
 
-BufferManager::~BufferManager() = default;
+BufferManager::~BufferManager() {
+    stopWarmUp();
+}
 
 } // namespace storage
 } // namespace kuzu
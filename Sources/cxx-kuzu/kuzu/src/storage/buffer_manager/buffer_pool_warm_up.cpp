@@ -0,0 +1,164 @@
+#include "storage/buffer_manager/buffer_pool_warm_up.h"
+
+#include <cstring>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/task_system/task.h"
+#include "common/task_system/task_scheduler.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+static void appendValue(std::vector<uint8_t>& buffer, T value) {
+    const auto offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template<typename T>
+static bool readValue(std::span<const uint8_t> buffer, uint64_t& offset, T& value) {
+    if (buffer.size() - offset < sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+std::vector<uint8_t> HotPageManifest::serialize() const {
+    std::vector<uint8_t> buffer;
+    buffer.reserve(3 * sizeof(uint64_t) + runs.size() * 2 * sizeof(page_idx_t));
+    appendValue(buffer, MAGIC);
+    appendValue<uint64_t>(buffer, runs.size());
+    appendValue(buffer, numMainRuns);
+    for (auto& run : runs) {
+        appendValue(buffer, run.startPageIdx);
+        appendValue(buffer, run.numPages);
+    }
+    return buffer;
+}
+
+std::optional<HotPageManifest> HotPageManifest::deserialize(std::span<const uint8_t> buffer) {
+    uint64_t offset = 0;
+    uint64_t magic = 0;
+    uint64_t numRuns = 0;
+    HotPageManifest manifest;
+    if (!readValue(buffer, offset, magic) || magic != MAGIC ||
+        !readValue(buffer, offset, numRuns) || !readValue(buffer, offset, manifest.numMainRuns) ||
+        manifest.numMainRuns > numRuns || (buffer.size() - offset) % (2 * sizeof(page_idx_t)) != 0 ||
+        (buffer.size() - offset) / (2 * sizeof(page_idx_t)) != numRuns) {
+        return std::nullopt;
+    }
+    manifest.runs.resize(numRuns);
+    for (auto& run : manifest.runs) {
+        readValue(buffer, offset, run.startPageIdx);
+        readValue(buffer, offset, run.numPages);
+    }
+    return manifest;
+}
+
+void HotPageManifest::save(VirtualFileSystem& vfs, const std::string& path) const {
+    try {
+        const auto buffer = serialize();
+        auto fileInfo = vfs.openFile(path,
+            FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS));
+        // A torn write is rejected when the manifest is loaded, so the file isn't synced.
+        fileInfo->writeFile(buffer.data(), buffer.size(), 0 /* offset */);
+    } catch (...) {} // NOLINT: A missing manifest only means that there is nothing to warm up.
+}
+
+std::optional<HotPageManifest> HotPageManifest::load(VirtualFileSystem& vfs,
+    const std::string& path) {
+    try {
+        if (!vfs.fileOrPathExists(path)) {
+            return std::nullopt;
+        }
+        auto fileInfo = vfs.openFile(path, FileOpenFlags(FileFlags::READ_ONLY));
+        std::vector<uint8_t> buffer(fileInfo->getFileSize());
+        fileInfo->readFromFile(buffer.data(), buffer.size(), 0 /* position */);
+        return deserialize(buffer);
+    } catch (...) { // NOLINT: A corrupted manifest is ignored.
+        return std::nullopt;
+    }
+}
+
+namespace {
+
+class BufferPoolWarmUpTask final : public Task {
+public:
+    explicit BufferPoolWarmUpTask(std::shared_ptr<BufferPoolWarmUp> warmUp)
+        : Task{1 /* maxNumThreads */}, warmUp{std::move(warmUp)} {}
+
+    void run() override { warmUp->readNextChunk(); }
+
+    std::string getName() const override { return "BUFFER_POOL_WARM_UP"; }
+
+private:
+    std::shared_ptr<BufferPoolWarmUp> warmUp;
+};
+
+} // namespace
+
+void BufferPoolWarmUp::start() {
+    std::unique_lock lck{mtx};
+    if (!stopped && !manifest.runs.empty()) {
+        scheduleNextChunkNoLock();
+    }
+}
+
+void BufferPoolWarmUp::readNextChunk() {
+    std::unique_lock lck{mtx};
+    if (stopped || nextRunIdx >= manifest.runs.size()) {
+        return;
+    }
+    reading = true;
+    const auto run = manifest.runs[nextRunIdx];
+    const auto startPageIdx = run.startPageIdx + nextPageInRun;
+    const auto numPages = std::min(run.numPages - nextPageInRun, CHUNK_NUM_PAGES);
+    const auto pageReadPolicy = nextRunIdx < manifest.numMainRuns ? PageReadPolicy::READ_PAGE :
+                                                                    PageReadPolicy::READ_PAGE_ONCE;
+    lck.unlock();
+    bool hasFreeMemory = false;
+    try {
+        hasFreeMemory = bufferManager.warmUpPages(fileHandle, startPageIdx,
+            startPageIdx + numPages, pageReadPolicy);
+    } catch (...) {} // NOLINT: Warming up is best effort, the pages are read again when pinned.
+    lck.lock();
+    reading = false;
+    nextPageInRun += numPages;
+    if (nextPageInRun == run.numPages) {
+        nextRunIdx++;
+        nextPageInRun = 0;
+    }
+    if (!hasFreeMemory) {
+        stopped = true;
+    } else if (!stopped && nextRunIdx < manifest.runs.size()) {
+        scheduleNextChunkNoLock();
+    }
+    cv.notify_all();
+}
+
+void BufferPoolWarmUp::stop() {
+    std::unique_lock lck{mtx};
+    stopped = true;
+    cv.wait(lck, [&] { return !reading; });
+}
+
+void BufferPoolWarmUp::scheduleNextChunkNoLock() {
+#ifndef __SINGLE_THREADED__
+    // Each chunk is a separate task, so the worker that reads it is free to pick up the tasks of
+    // queries before the next chunk.
+    taskScheduler.scheduleBackgroundTask(
+        std::make_shared<BufferPoolWarmUpTask>(shared_from_this()));
+#else
+    // There are no worker threads to warm up the buffer pool in the background.
+    stopped = true;
+#endif
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -8,6 +8,8 @@
 #include "main/client_context.h"
 #include "main/database.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/query_memory_tracker.h"
+#include "storage/buffer_manager/slab_allocator.h"
 #include "storage/file_handle.h"
 
 using namespace kuzu::common;
@@ -22,12 +24,21 @@ MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr && !evicted) {
         mm->freeBlock(pageIdx, buffer);
         mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        releaseFromTracker();
         buffer = std::span<uint8_t>();
     }
 }
 
+void MemoryBuffer::releaseFromTracker() {
+    if (tracker != nullptr) {
+        tracker->free(buffer.size(), operatorUsage);
+    }
+}
+
 SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
     mm->freeBlock(pageIdx, buffer);
+    // The spilled memory no longer counts towards the limit of the query.
+    releaseFromTracker();
     // reinterpret_cast isn't allowed here, but we shouldn't leave the invalid pointer and
     // still want to store the size
     buffer = std::span(static_cast<uint8_t*>(nullptr), buffer.size());
@@ -43,21 +54,23 @@ SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
 void MemoryBuffer::prepareLoadFromDisk() {
     KU_ASSERT(buffer.data() == nullptr && evicted);
     buffer = mm->mallocBuffer(false, buffer.size());
+    if (tracker != nullptr) {
+        tracker->allocate(buffer.size(), operatorUsage, false /* enforceLimit */);
+    }
     evicted = false;
 }
 
 MemoryManager::MemoryManager(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
     pageSize = TEMP_PAGE_SIZE;
     fh = bm->getFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE, vfs, nullptr);
+    slabAllocator = std::make_unique<SlabAllocator>(*this);
 }
 
+MemoryManager::~MemoryManager() = default;
+
 std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t size) {
-    if (!bm->reserve(size)) {
-        throw BufferManagerException(
-            "Unable to allocate memory! The buffer pool is full and no memory could be freed!");
-    }
+    reserveUnmanagedMemory(size);
     void* buffer = nullptr;
-    bm->nonEvictableMemory += size;
     if (initializeToZero) {
         buffer = calloc(size, 1);
     } else {
@@ -66,7 +79,57 @@ std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t s
     return std::span(static_cast<uint8_t*>(buffer), size);
 }
 
+uint8_t* MemoryManager::allocate(uint64_t size) {
+    if (SlabAllocator::isSmall(size)) {
+        return slabAllocator->allocate(size);
+    }
+    return mallocBuffer(false /* initializeToZero */, size).data();
+}
+
+void MemoryManager::deallocate(uint8_t* buffer, uint64_t size) {
+    if (SlabAllocator::isSmall(size)) {
+        slabAllocator->free(buffer, size);
+        return;
+    }
+    std::free(buffer);
+    releaseUnmanagedMemory(size);
+}
+
+void MemoryManager::reserveUnmanagedMemory(uint64_t size) {
+    if (!bm->reserve(size)) {
+        throw BufferManagerException(
+            "Unable to allocate memory! The buffer pool is full and no memory could be freed!");
+    }
+    bm->nonEvictableMemory += size;
+}
+
+void MemoryManager::releaseUnmanagedMemory(uint64_t size) {
+    bm->freeUsedMemory(size);
+    bm->nonEvictableMemory -= size;
+}
+
 std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZero, uint64_t size) {
+    auto scope = MemoryTrackerScope::getCurrent();
+    if (scope == nullptr) {
+        return allocateBufferUntracked(initializeToZero, size);
+    }
+    // Charged before the allocation, so that a query over its limit does not take memory from the
+    // buffer pool first.
+    scope->getTracker()->allocate(size, scope->getOperatorUsage());
+    std::unique_ptr<MemoryBuffer> memoryBuffer;
+    try {
+        memoryBuffer = allocateBufferUntracked(initializeToZero, size);
+    } catch (...) {
+        scope->getTracker()->free(size, scope->getOperatorUsage());
+        throw;
+    }
+    memoryBuffer->tracker = scope->getTracker();
+    memoryBuffer->operatorUsage = scope->getOperatorUsage();
+    return memoryBuffer;
+}
+
+std::unique_ptr<MemoryBuffer> MemoryManager::allocateBufferUntracked(bool initializeToZero,
+    uint64_t size) {
     if (size != TEMP_PAGE_SIZE) [[unlikely]] {
         auto buffer = mallocBuffer(initializeToZero, size);
         return std::make_unique<MemoryBuffer>(this, INVALID_PAGE_IDX, buffer.data(), size);
@@ -99,8 +162,7 @@ void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
 
 void MemoryManager::updateUsedMemoryForFreedBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
     if (pageIdx == INVALID_PAGE_IDX) {
-        bm->freeUsedMemory(buffer.size());
-        bm->nonEvictableMemory -= buffer.size();
+        releaseUnmanagedMemory(buffer.size());
     } else {
         std::unique_lock<std::mutex> lock(allocatorLock);
         freePages.push(pageIdx);
@@ -0,0 +1,81 @@
+#include "storage/buffer_manager/query_memory_tracker.h"
+
+#include "common/exception/buffer_manager.h"
+#include "common/string_format.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static void updatePeak(std::atomic<uint64_t>& peak, uint64_t value) {
+    auto currentPeak = peak.load(std::memory_order_relaxed);
+    while (value > currentPeak &&
+           !peak.compare_exchange_weak(currentPeak, value, std::memory_order_relaxed)) {}
+}
+
+void QueryMemoryTracker::allocate(uint64_t size, OperatorMemoryUsage* operatorUsage,
+    bool enforceLimit) {
+    const auto used = usedMemory.fetch_add(size, std::memory_order_relaxed) + size;
+    if (enforceLimit && memoryLimit != 0 && used > memoryLimit) {
+        usedMemory.fetch_sub(size, std::memory_order_relaxed);
+        throw BufferManagerException(stringFormat(
+            "The query exceeded its memory limit of {} bytes. The limit can be changed with the "
+            "query_memory_limit option.",
+            memoryLimit));
+    }
+    updatePeak(peakMemory, used);
+    if (operatorUsage != nullptr) {
+        const auto operatorUsed =
+            operatorUsage->usedMemory.fetch_add(size, std::memory_order_relaxed) + size;
+        updatePeak(operatorUsage->peakMemory, operatorUsed);
+    }
+}
+
+void QueryMemoryTracker::free(uint64_t size, OperatorMemoryUsage* operatorUsage) {
+    usedMemory.fetch_sub(size, std::memory_order_relaxed);
+    if (operatorUsage != nullptr) {
+        operatorUsage->usedMemory.fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+OperatorMemoryUsage* QueryMemoryTracker::getOperatorUsage(uint32_t operatorID) {
+    std::unique_lock lck{mtx};
+    auto& usage = operatorUsages[operatorID];
+    if (usage == nullptr) {
+        usage = std::make_unique<OperatorMemoryUsage>();
+    }
+    return usage.get();
+}
+
+uint64_t QueryMemoryTracker::getOperatorPeakMemory(uint32_t operatorID) const {
+    std::unique_lock lck{mtx};
+    auto it = operatorUsages.find(operatorID);
+    return it == operatorUsages.end() ? 0 : it->second->peakMemory.load(std::memory_order_relaxed);
+}
+
+static thread_local const MemoryTrackerScope* currentScope = nullptr;
+
+MemoryTrackerScope::MemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker,
+    uint32_t operatorID)
+    : tracker{std::move(tracker)}, operatorUsage{this->tracker->getOperatorUsage(operatorID)},
+      previous{currentScope} {
+    currentScope = this;
+}
+
+MemoryTrackerScope::MemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> tracker,
+    OperatorMemoryUsage* operatorUsage)
+    : tracker{std::move(tracker)}, operatorUsage{operatorUsage}, previous{currentScope} {
+    currentScope = this;
+}
+
+MemoryTrackerScope::~MemoryTrackerScope() {
+    currentScope = previous;
+}
+
+const MemoryTrackerScope* MemoryTrackerScope::getCurrent() {
+    return currentScope;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,163 @@
+#include "storage/buffer_manager/slab_allocator.h"
+
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <new>
+
+#include "common/assert.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace kuzu {
+namespace storage {
+
+static uint8_t* allocateAligned(uint64_t size) {
+#if defined(_WIN32)
+    return static_cast<uint8_t*>(_aligned_malloc(size, size));
+#else
+    return static_cast<uint8_t*>(std::aligned_alloc(size, size));
+#endif
+}
+
+static void freeAligned(uint8_t* buffer) {
+#if defined(_WIN32)
+    _aligned_free(buffer);
+#else
+    std::free(buffer);
+#endif
+}
+
+SlabAllocator::~SlabAllocator() {
+    // Slabs which still hold blocks are left to their owners; the others are released.
+    for (auto& shard : shards) {
+        for (auto i = 0u; i < NUM_SIZE_CLASSES; i++) {
+            while (shard.slabsWithFreeBlocks[i] != nullptr) {
+                auto slab = shard.slabsWithFreeBlocks[i];
+                removeSlab(shard.slabsWithFreeBlocks[i], slab);
+                if (slab->numLiveBlocks == 0) {
+                    releaseSlab(slab);
+                }
+            }
+            if (shard.emptySlabs[i] != nullptr) {
+                releaseSlab(shard.emptySlabs[i]);
+            }
+        }
+    }
+}
+
+uint8_t* SlabAllocator::allocate(uint64_t size) {
+    KU_ASSERT(isSmall(size));
+    const auto sizeClassIdx = getSizeClassIdx(size);
+    auto& shard = getShard();
+    std::unique_lock lck{shard.mtx};
+    auto& slabs = shard.slabsWithFreeBlocks[sizeClassIdx];
+    if (slabs == nullptr) {
+        auto slab = shard.emptySlabs[sizeClassIdx];
+        if (slab != nullptr) {
+            shard.emptySlabs[sizeClassIdx] = nullptr;
+        } else {
+            slab = allocateSlab(shard, sizeClassIdx);
+        }
+        pushSlab(slabs, slab);
+    }
+    auto slab = slabs;
+    uint8_t* block = nullptr;
+    if (slab->freeBlocks != nullptr) {
+        block = slab->freeBlocks;
+        slab->freeBlocks = *reinterpret_cast<uint8_t**>(block);
+    } else {
+        block = reinterpret_cast<uint8_t*>(slab) + SLAB_HEADER_SIZE +
+                slab->numCarvedBlocks * getBlockSize(sizeClassIdx);
+        slab->numCarvedBlocks++;
+    }
+    slab->numLiveBlocks++;
+    if (slab->numLiveBlocks == getNumBlocksPerSlab(sizeClassIdx)) {
+        removeSlab(slabs, slab);
+    }
+    return block;
+}
+
+void SlabAllocator::free(uint8_t* block, uint64_t size) {
+    KU_ASSERT(isSmall(size));
+    auto slab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(block) & ~(SLAB_SIZE - 1));
+    KU_ASSERT(slab->sizeClassIdx == getSizeClassIdx(size));
+    auto& shard = *slab->shard;
+    std::unique_lock lck{shard.mtx};
+    const auto sizeClassIdx = slab->sizeClassIdx;
+    auto& slabs = shard.slabsWithFreeBlocks[sizeClassIdx];
+    if (slab->numLiveBlocks == getNumBlocksPerSlab(sizeClassIdx)) {
+        pushSlab(slabs, slab);
+    }
+    *reinterpret_cast<uint8_t**>(block) = slab->freeBlocks;
+    slab->freeBlocks = block;
+    slab->numLiveBlocks--;
+    if (slab->numLiveBlocks > 0) {
+        return;
+    }
+    removeSlab(slabs, slab);
+    if (shard.emptySlabs[sizeClassIdx] == nullptr) {
+        slab->freeBlocks = nullptr;
+        slab->numCarvedBlocks = 0;
+        shard.emptySlabs[sizeClassIdx] = slab;
+    } else {
+        releaseSlab(slab);
+    }
+}
+
+uint64_t SlabAllocator::getSizeClassIdx(uint64_t size) {
+    return std::bit_width(std::max(size, MIN_BLOCK_SIZE) - 1) -
+           std::bit_width(MIN_BLOCK_SIZE - 1);
+}
+
+SlabAllocator::Shard& SlabAllocator::getShard() {
+    static std::atomic<uint64_t> nextShardIdx{0};
+    thread_local const uint64_t shardIdx =
+        nextShardIdx.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return shards[shardIdx];
+}
+
+SlabAllocator::Slab* SlabAllocator::allocateSlab(Shard& shard, uint64_t sizeClassIdx) {
+    mm.reserveUnmanagedMemory(SLAB_SIZE);
+    auto buffer = allocateAligned(SLAB_SIZE);
+    if (buffer == nullptr) {
+        mm.releaseUnmanagedMemory(SLAB_SIZE);
+        throw std::bad_alloc();
+    }
+    return new (buffer) Slab(&shard, sizeClassIdx);
+}
+
+void SlabAllocator::releaseSlab(Slab* slab) {
+    slab->~Slab();
+    freeAligned(reinterpret_cast<uint8_t*>(slab));
+    mm.releaseUnmanagedMemory(SLAB_SIZE);
+}
+
+void SlabAllocator::pushSlab(Slab*& head, Slab* slab) {
+    slab->prev = nullptr;
+    slab->next = head;
+    if (head != nullptr) {
+        head->prev = slab;
+    }
+    head = slab;
+}
+
+void SlabAllocator::removeSlab(Slab*& head, Slab* slab) {
+    if (slab->prev != nullptr) {
+        slab->prev->next = slab->next;
+    } else {
+        KU_ASSERT(head == slab);
+        head = slab->next;
+    }
+    if (slab->next != nullptr) {
+        slab->next->prev = slab->prev;
+    }
+    slab->prev = nullptr;
+    slab->next = nullptr;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -17,7 +17,8 @@ namespace storage {
 
 Spiller::Spiller(std::string tmpFilePath, BufferManager& bufferManager,
     common::VirtualFileSystem* vfs)
-    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs}, dataFH{nullptr} {
+    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs},
+      unusedChunksMemory{0}, dataFH{nullptr} {
     // Clear the file if it already existed (e.g. from a previous run which
     // failed to clean up).
     vfs->removeFileIfExists(this->tmpFilePath);
@@ -46,13 +47,16 @@ FileHandle* Spiller::getDataFH() const {
 
 void Spiller::addUnusedChunk(InMemChunkedNodeGroup* nodeGroup) {
     std::unique_lock lock(partitionerGroupsMtx);
-    fullPartitionerGroups.insert(nodeGroup);
+    if (fullPartitionerGroups.insert(nodeGroup).second) {
+        unusedChunksMemory += nodeGroup->getEstimatedMemoryUsage();
+    }
 }
 
 void Spiller::clearUnusedChunk(InMemChunkedNodeGroup* nodeGroup) {
     std::unique_lock lock(partitionerGroupsMtx);
     auto entry = fullPartitionerGroups.find(nodeGroup);
     if (entry != fullPartitionerGroups.end()) {
+        unusedChunksMemory -= nodeGroup->getEstimatedMemoryUsage();
         fullPartitionerGroups.erase(entry);
     }
 }
@@ -87,6 +91,21 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
     }
 }
 
+uint64_t Spiller::spillToDisk(std::span<const uint8_t> buffer) const {
+    auto dataFH = getOrCreateDataFH();
+    auto pageSize = dataFH->getPageSize();
+    auto numPages = (buffer.size_bytes() + pageSize - 1) / pageSize;
+    auto startPage = dataFH->addNewPages(numPages);
+    dataFH->writePagesToFile(buffer.data(), buffer.size_bytes(), startPage);
+    return startPage * pageSize;
+}
+
+void Spiller::loadFromDisk(std::span<uint8_t> buffer, uint64_t filePosition) const {
+    auto dataFH = getDataFH();
+    KU_ASSERT(dataFH);
+    dataFH->getFileInfo()->readFromFile(buffer.data(), buffer.size(), filePosition);
+}
+
 SpillResult Spiller::claimNextGroup() {
     InMemChunkedNodeGroup* groupToFlush = nullptr;
     {
@@ -94,6 +113,7 @@ SpillResult Spiller::claimNextGroup() {
         if (!fullPartitionerGroups.empty()) {
             auto groupToFlushEntry = fullPartitionerGroups.begin();
             groupToFlush = *groupToFlushEntry;
+            unusedChunksMemory -= groupToFlush->getEstimatedMemoryUsage();
             fullPartitionerGroups.erase(groupToFlushEntry);
         }
     }
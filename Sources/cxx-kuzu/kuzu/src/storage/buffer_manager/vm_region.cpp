@@ -19,7 +19,38 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFrameGroups{0} {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// Maps size bytes starting at a huge page boundary, by mapping one more huge page and unmapping
+// the unaligned head and tail.
+static uint8_t* mmapHugePageAligned(uint64_t size) {
+    const auto mappedSize = size + HUGE_PAGE_SIZE;
+    auto mapped = static_cast<uint8_t*>(mmap(NULL, mappedSize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
+    if (mapped == MAP_FAILED) {
+        return mapped;
+    }
+    const auto address = reinterpret_cast<uintptr_t>(mapped);
+    const auto alignedAddress = (address + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    auto region = reinterpret_cast<uint8_t*>(alignedAddress);
+    if (region > mapped) {
+        munmap(mapped, region - mapped);
+    }
+    const auto tailSize = mapped + mappedSize - (region + size);
+    if (tailSize > 0) {
+        munmap(region + size, tailSize);
+    }
+    // Transparent huge pages may be disabled system-wide, in which case the region simply keeps
+    // using regular pages.
+    madvise(region, size, MADV_HUGEPAGE);
+    return region;
+}
+#endif
+
+VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+    bool useHugePages [[maybe_unused]])
+    : numFrameGroups{0} {
     if (maxRegionSize > static_cast<std::size_t>(-1)) {
         throw BufferManagerException("maxRegionSize is beyond the max available mmap region size.");
     }
@@ -36,8 +67,16 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
 #else
     // Create a private anonymous mapping. The mapping is not shared with other processes and not
     // backed by any file, and its content are initialized to zero.
-    region = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize(), PROT_READ | PROT_WRITE,
-        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
+    region = static_cast<uint8_t*>(MAP_FAILED);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (useHugePages) {
+        region = mmapHugePageAligned(getMaxRegionSize());
+    }
+#endif
+    if (region == MAP_FAILED) {
+        region = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize(), PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
+    }
     if (region == MAP_FAILED) {
         throw BufferManagerException(
             "Mmap for size " + std::to_string(getMaxRegionSize()) + " failed.");
@@ -66,6 +105,8 @@ void VMRegion::releaseFrame(frame_idx_t frameIdx) const {
     }
 
 #else
+    // With huge pages, this splits the huge page holding the frame. The kernel merges the pages
+    // back in the background once they are faulted in again.
     int error = madvise(getFrame(frameIdx), frameSize, MADV_DONTNEED);
     if (error != 0) {
         // LCOV_EXCL_START
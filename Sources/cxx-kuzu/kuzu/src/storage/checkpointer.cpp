@@ -3,9 +3,11 @@
 #include "catalog/catalog.h"
 #include "common/file_system/file_system.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/random_engine.h"
 #include "common/serializer/buffered_file.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/in_mem_file_writer.h"
+#include "common/tracer.h"
 #include "extension/extension_manager.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
@@ -13,6 +15,7 @@
 #include "storage/database_header.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
 #include "storage/wal/local_wal.h"
 
 namespace kuzu {
@@ -31,7 +34,7 @@ PageRange Checkpointer::serializeCatalog(const catalog::Catalog& catalog,
     common::Serializer catalogSerializer(catalogWriter);
     catalog.serialize(catalogSerializer);
     auto pageAllocator = storageManager.getDataFH()->getPageManager();
-    return catalogWriter->flush(*pageAllocator, storageManager.getShadowFile());
+    return catalogWriter->flush(*pageAllocator);
 }
 
 PageRange Checkpointer::serializeMetadata(const catalog::Catalog& catalog,
@@ -57,11 +60,20 @@ PageRange Checkpointer::serializeMetadata(const catalog::Catalog& catalog,
         metadataWriter->getNumPagesToFlush() + pagesForPageManager);
     pageManager.serialize(metadataSerializer);
 
-    metadataWriter->flush(allocatedPages, pageAllocator->getDataFH(),
-        storageManager.getShadowFile());
+    metadataWriter->flush(allocatedPages, pageAllocator->getDataFH());
     return allocatedPages;
 }
 
+// Traces the phase of the checkpoint run by the function.
+template<typename FUNC>
+static auto traceCheckpointPhase(const char* phase, FUNC&& func) {
+    std::optional<common::TraceScope> traceScope;
+    if (common::Tracer::Get().isEnabled()) [[unlikely]] {
+        traceScope.emplace("checkpoint", phase);
+    }
+    return func();
+}
+
 void Checkpointer::writeCheckpoint() {
     if (isInMemory) {
         return;
@@ -71,22 +83,33 @@ void Checkpointer::writeCheckpoint() {
         *StorageManager::Get(clientContext)->getOrInitDatabaseHeader(clientContext);
     // Checkpoint storage. Note that we first checkpoint storage before serializing the catalog, as
     // checkpointing storage may overwrite columnIDs in the catalog.
-    bool hasStorageChanges = checkpointStorage();
-    serializeCatalogAndMetadata(databaseHeader, hasStorageChanges);
-    writeDatabaseHeader(databaseHeader);
-    logCheckpointAndApplyShadowPages();
+    bool hasStorageChanges =
+        traceCheckpointPhase("CHECKPOINT_STORAGE", [&] { return checkpointStorage(); });
+    traceCheckpointPhase("SERIALIZE_CATALOG_AND_METADATA",
+        [&] { serializeCatalogAndMetadata(databaseHeader, hasStorageChanges); });
+    // The WAL written after this checkpoint no longer applies on top of the previous one.
+    databaseHeader.checkpointID =
+        common::UUID::generateRandomUUID(common::RandomEngine::Get(clientContext));
+    traceCheckpointPhase("WRITE_DATABASE_HEADER", [&] { writeDatabaseHeader(databaseHeader); });
+    traceCheckpointPhase("APPLY_SHADOW_PAGES", [&] { logCheckpointAndApplyShadowPages(); });
 
     // This function will evict all pages that were freed during this checkpoint
     // It must be called before we remove all evicted candidates from the BM
     // Or else the evicted pages may end up appearing multiple times in the eviction queue
     auto storageManager = StorageManager::Get(clientContext);
-    storageManager->finalizeCheckpoint();
+    traceCheckpointPhase("FINALIZE_CHECKPOINT", [&] { storageManager->finalizeCheckpoint(); });
     // When a page is freed by the FSM, it evicts it from the BM. However, if the page is freed,
     // then reused over and over, it can be appended to the eviction queue multiple times. To
     // prevent multiple entries of the same page from existing in the eviction queue, at the end of
     // each checkpoint we remove any already-evicted pages.
     auto bufferManager = MemoryManager::Get(clientContext)->getBufferManager();
     bufferManager->removeEvictedCandidates();
+    // Checkpoints run periodically, so the pages cached in frames are recorded here to warm up the
+    // buffer pool with them when the database is opened again.
+    if (clientContext.getDBConfig()->warmUpBufferPool) {
+        bufferManager->saveHotPageManifest(*storageManager->getDataFH(),
+            StorageUtils::getHotPagesFilePath(clientContext.getDatabasePath()));
+    }
 
     catalog::Catalog::Get(clientContext)->resetVersion();
     auto* dataFH = storageManager->getDataFH();
@@ -149,6 +172,10 @@ void Checkpointer::logCheckpointAndApplyShadowPages() {
     auto& shadowFile = storageManager->getShadowFile();
     // Flush the shadow file.
     shadowFile.flushAll(clientContext);
+    // Pages of new page ranges (column chunks, catalog, metadata) are written directly to the data
+    // file rather than shadowed, so they must be durable before the checkpoint record makes the new
+    // database header reachable through the shadow file.
+    storageManager->getDataFH()->getFileInfo()->syncFile();
     auto wal = WAL::Get(clientContext);
     // Log the checkpoint to the WAL and flush WAL. This indicates that all shadow pages and
     // files (snapshots of catalog and metadata) have been written to disk. The part that is not
@@ -190,6 +217,12 @@ bool Checkpointer::canAutoCheckpoint(const main::ClientContext& clientContext,
     return expectedSize > clientContext.getDBConfig()->checkpointThreshold;
 }
 
+bool Checkpointer::mustAutoCheckpoint(const main::ClientContext& clientContext) {
+    const auto threshold = clientContext.getDBConfig()->checkpointThreshold;
+    return WAL::Get(clientContext)->getFileSize() >
+           threshold * common::MAX_DEFERRED_CHECKPOINT_THRESHOLD_FACTOR;
+}
+
 void Checkpointer::readCheckpoint() {
     auto storageManager = StorageManager::Get(clientContext);
     storageManager->initDataFileHandle(common::VirtualFileSystem::GetUnsafe(clientContext),
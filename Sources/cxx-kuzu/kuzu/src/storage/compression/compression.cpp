@@ -108,6 +108,34 @@ std::unique_ptr<ExtraMetadata> ALPMetadata::copy() {
     return std::make_unique<ALPMetadata>(*this);
 }
 
+void DeltaMetadata::serialize(common::Serializer& serializer) const {
+    serializer.write(minDelta);
+    serializer.write(bitWidth);
+}
+
+DeltaMetadata DeltaMetadata::deserialize(common::Deserializer& deserializer) {
+    DeltaMetadata ret;
+    deserializer.deserializeValue(ret.minDelta);
+    deserializer.deserializeValue(ret.bitWidth);
+    return ret;
+}
+
+std::unique_ptr<ExtraMetadata> DeltaMetadata::copy() {
+    return std::make_unique<DeltaMetadata>(*this);
+}
+
+void FSSTMetadata::serialize(common::Serializer& serializer) const {
+    symbolTable.serialize(serializer);
+}
+
+FSSTMetadata FSSTMetadata::deserialize(common::Deserializer& deserializer) {
+    return FSSTMetadata(FSSTSymbolTable::deserialize(deserializer));
+}
+
+std::unique_ptr<ExtraMetadata> FSSTMetadata::copy() {
+    return std::make_unique<FSSTMetadata>(*this);
+}
+
 CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     CompressionType compression, const alp::state& state, StorageValue minEncoded,
     StorageValue maxEncoded, common::PhysicalTypeID physicalType)
@@ -154,6 +182,10 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::DELTA_BITPACKING) {
+        deltaMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +207,11 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::DELTA_BITPACKING) {
+        ret.extraMetadata =
+            std::make_unique<DeltaMetadata>(DeltaMetadata::deserialize(deserializer));
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata = std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -192,7 +229,9 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::FSST: {
         return false;
     }
     default: {
@@ -281,6 +320,14 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
                 return false;
             });
     }
+    case CompressionType::DELTA_BITPACKING: {
+        // Changing any value changes the deltas of the values following it
+        return false;
+    }
+    case CompressionType::FSST: {
+        // New strings have to be encoded with the symbol table, which is only done on flush
+        return false;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -297,7 +344,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -347,6 +395,19 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            dataType,
+            [&](internalID_t) { return DeltaBitpacking<uint64_t>::numValues(pageSize, *this); },
+            [&]<DeltaBitpackingType T>(
+                T) { return DeltaBitpacking<T>::numValues(pageSize, *this); },
+            [&](auto) -> uint64_t {
+                throw common::StorageException(
+                    "Attempted to read from a column chunk which uses delta bitpacking but does "
+                    "not have a supported integer physical type: " +
+                    PhysicalTypeUtils::toString(dataType));
+            });
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
@@ -463,12 +524,18 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
             [](auto) -> uint8_t { KU_UNREACHABLE; });
         return stringFormat("INTEGER_BITPACKING[{}]", bitWidth);
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return stringFormat("DELTA_BITPACKING[{}]", deltaMetadata()->bitWidth);
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::FSST: {
+        return "FSST";
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -740,6 +807,12 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if constexpr (DeltaBitpackingType<T>) {
+        if (metadata.compression == CompressionType::DELTA_BITPACKING) {
+            return DeltaBitpacking<T>().compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+                dstBufferSize, metadata);
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -833,6 +906,37 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
     }
 }
 
+template<IntegerBitpackingType T>
+void IntegerBitpacking<T>::selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues, const BitpackInfo<T>& info,
+    T packedMin, T packedMax) const {
+    auto srcCursor = getChunkStart(srcBuffer, srcOffset, info.bitWidth);
+    const auto bytesPerChunk = CHUNK_SIZE / 8 * info.bitWidth;
+    auto posInChunk = srcOffset % CHUNK_SIZE;
+    U chunk[CHUNK_SIZE] = {};
+    for (uint64_t i = 0; i < numValues;) {
+        const auto numValuesInChunk = std::min(CHUNK_SIZE - posInChunk, numValues - i);
+        if (numValuesInChunk == CHUNK_SIZE) {
+            fastunpack(srcCursor, chunk, info.bitWidth);
+        } else {
+            for (auto j = 0u; j < numValuesInChunk; j++) {
+                BitpackingUtils<U>::unpackSingle(srcCursor, &chunk[j], info.bitWidth,
+                    posInChunk + j);
+            }
+        }
+        if (info.hasNegative && info.bitWidth > 0) {
+            SignExtend<T, U, CHUNK_SIZE>(reinterpret_cast<uint8_t*>(chunk), info.bitWidth);
+        }
+        for (auto j = 0u; j < numValuesInChunk; j++) {
+            const auto value = static_cast<T>(chunk[j]);
+            dstBuffer[dstOffset + i + j] = value >= packedMin && value <= packedMax;
+        }
+        i += numValuesInChunk;
+        srcCursor += bytesPerChunk;
+        posInChunk = 0;
+    }
+}
+
 template class IntegerBitpacking<int8_t>;
 template class IntegerBitpacking<int16_t>;
 template class IntegerBitpacking<int32_t>;
@@ -843,6 +947,121 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<DeltaBitpackingType T>
+DeltaMetadata DeltaBitpacking<T>::getDeltaInfo(std::span<const T> values) {
+    using S = numeric_utils::MakeSignedT<U>;
+    const auto* data = reinterpret_cast<const U*>(values.data());
+    // Deltas are computed with wrapping arithmetic, so they can always be reversed even if the
+    // difference between two values doesn't fit in T.
+    // The first value of each block is stored as-is and doesn't have a delta.
+    std::optional<S> minDelta;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (i % CHUNK_SIZE != 0) {
+            const auto delta = static_cast<S>(static_cast<U>(data[i] - data[i - 1]));
+            if (!minDelta || delta < *minDelta) {
+                minDelta = delta;
+            }
+        }
+    }
+    if (!minDelta) {
+        return DeltaMetadata();
+    }
+    const auto offset = static_cast<U>(*minDelta);
+    uint8_t bitWidth = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (i % CHUNK_SIZE != 0) {
+            const auto packed = static_cast<U>(data[i] - data[i - 1] - offset);
+            bitWidth = std::max(bitWidth, static_cast<uint8_t>(numeric_utils::bitWidth(packed)));
+        }
+    }
+    return DeltaMetadata(offset, bitWidth);
+}
+
+template<DeltaBitpackingType T>
+void DeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t /*srcOffset*/, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/,
+    offset_t /*numValues*/, const CompressionMetadata& /*metadata*/,
+    const NullMask* /*nullMask*/) const {
+    // Delta encoded chunks can never be updated in place, so they are always rewritten instead
+    KU_UNREACHABLE;
+}
+
+template<DeltaBitpackingType T>
+uint64_t DeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    const auto& info = *metadata.deltaMetadata();
+    const auto minDelta = static_cast<U>(info.minDelta);
+    const auto bytesPerBlock = getNumBytesPerBlock(info.bitWidth);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    KU_ASSERT(dstBufferSize >= bytesPerBlock);
+    const auto* src = reinterpret_cast<const U*>(srcBuffer);
+    auto* dstCursor = dstBuffer;
+    U tmp[CHUNK_SIZE];
+    for (uint64_t i = 0; i < numValuesToCompress; i += CHUNK_SIZE) {
+        const auto numValuesInBlock = std::min(CHUNK_SIZE, numValuesToCompress - i);
+        memcpy(dstCursor, src + i, sizeof(U));
+        tmp[0] = 0;
+        for (auto j = 1u; j < numValuesInBlock; j++) {
+            tmp[j] = static_cast<U>(src[i + j] - src[i + j - 1] - minDelta);
+        }
+        // The last block of the chunk may be partial; pad it so that fastpack can be used
+        std::fill(tmp + numValuesInBlock, tmp + CHUNK_SIZE, U{0});
+        fastpack(tmp, dstCursor + sizeof(U), info.bitWidth);
+        dstCursor += bytesPerBlock;
+    }
+    srcBuffer += numValuesToCompress * sizeof(U);
+    return dstCursor - dstBuffer;
+}
+
+template<DeltaBitpackingType T>
+void DeltaBitpacking<T>::decompressBlock(const uint8_t* block, U* dst,
+    const DeltaMetadata& metadata) const {
+    const auto minDelta = static_cast<U>(metadata.minDelta);
+    fastunpack(block + sizeof(U), dst, metadata.bitWidth);
+    memcpy(dst, block, sizeof(U));
+    for (auto i = 1u; i < CHUNK_SIZE; i++) {
+        dst[i] = static_cast<U>(dst[i - 1] + dst[i] + minDelta);
+    }
+}
+
+template<DeltaBitpackingType T>
+void DeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    const auto& info = *metadata.deltaMetadata();
+    const auto bytesPerBlock = getNumBytesPerBlock(info.bitWidth);
+    const auto* srcCursor = srcBuffer + srcOffset / CHUNK_SIZE * bytesPerBlock;
+    auto posInBlock = srcOffset % CHUNK_SIZE;
+    auto* dst = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    U tmp[CHUNK_SIZE];
+    while (numValues > 0) {
+        const auto numValuesToCopy = std::min(CHUNK_SIZE - posInBlock, numValues);
+        if (numValuesToCopy == CHUNK_SIZE) {
+            // Full blocks can be decoded directly into the destination
+            decompressBlock(srcCursor, dst, info);
+        } else {
+            decompressBlock(srcCursor, tmp, info);
+            memcpy(dst, tmp + posInBlock, numValuesToCopy * sizeof(U));
+        }
+        dst += numValuesToCopy;
+        numValues -= numValuesToCopy;
+        srcCursor += bytesPerBlock;
+        posInBlock = 0;
+    }
+}
+
+template class DeltaBitpacking<int8_t>;
+template class DeltaBitpacking<int16_t>;
+template class DeltaBitpacking<int32_t>;
+template class DeltaBitpacking<int64_t>;
+template class DeltaBitpacking<uint8_t>;
+template class DeltaBitpacking<uint16_t>;
+template class DeltaBitpacking<uint32_t>;
+template class DeltaBitpacking<uint64_t>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -887,6 +1106,7 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -950,6 +1170,22 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            physicalType,
+            [&](internalID_t) {
+                DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+            },
+            [&]<DeltaBitpackingType T>(T) {
+                DeltaBitpacking<T>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+            },
+            [&](auto) {
+                throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                              PhysicalTypeUtils::toString(physicalType));
+            });
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -966,6 +1202,7 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1029,6 +1266,22 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            physicalType,
+            [&](internalID_t) {
+                DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    result, startPosInResult, numValuesToRead, metadata);
+            },
+            [&]<DeltaBitpackingType T>(T) {
+                DeltaBitpacking<T>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    result, startPosInResult, numValuesToRead, metadata);
+            },
+            [&](auto) {
+                throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                              PhysicalTypeUtils::toString(physicalType));
+            });
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
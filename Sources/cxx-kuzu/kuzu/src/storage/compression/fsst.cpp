@@ -0,0 +1,177 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace storage {
+
+// Symbols are extended by concatenating adjacent symbols in each round, so MAX_SYMBOL_LENGTH is
+// reached after log2(MAX_SYMBOL_LENGTH) rounds; the extra rounds refine the choice of symbols.
+static constexpr uint32_t NUM_BUILD_ROUNDS = 5;
+// During the build, codes at or above this value stand for single escaped bytes.
+static constexpr uint32_t ESCAPED_BYTE_CODE_BASE = 256;
+static constexpr uint32_t NUM_BUILD_CODES = ESCAPED_BYTE_CODE_BASE + 256;
+
+void FSSTSymbolTable::addSymbol(std::string_view symbol) {
+    KU_ASSERT(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH);
+    KU_ASSERT(symbols.size() < MAX_NUM_SYMBOLS);
+    Symbol result{0, static_cast<uint8_t>(symbol.size())};
+    std::memcpy(&result.value, symbol.data(), symbol.size());
+    const auto code = static_cast<uint8_t>(symbols.size());
+    symbols.push_back(result);
+    auto& codes = codesByFirstByte[static_cast<uint8_t>(symbol[0])];
+    codes.push_back(code);
+    std::stable_sort(codes.begin(), codes.end(),
+        [&](uint8_t a, uint8_t b) { return symbols[a].length > symbols[b].length; });
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(const uint8_t* data, uint64_t length) const {
+    for (auto code : codesByFirstByte[data[0]]) {
+        const auto& symbol = symbols[code];
+        if (symbol.length <= length && std::memcmp(&symbol.value, data, symbol.length) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(std::span<const std::string_view> sample) {
+    FSSTSymbolTable table;
+    std::vector<uint32_t> singleCounts(NUM_BUILD_CODES);
+    std::vector<uint32_t> pairCounts(NUM_BUILD_CODES * NUM_BUILD_CODES);
+    for (auto round = 0u; round < NUM_BUILD_ROUNDS; round++) {
+        std::fill(singleCounts.begin(), singleCounts.end(), 0);
+        std::fill(pairCounts.begin(), pairCounts.end(), 0);
+        // Encode the sample with the current table, counting how often each code occurs alone and
+        // directly followed by each other code.
+        for (auto& value : sample) {
+            auto data = reinterpret_cast<const uint8_t*>(value.data());
+            uint64_t pos = 0;
+            uint32_t prevCode = NUM_BUILD_CODES;
+            while (pos < value.size()) {
+                uint32_t code = table.findLongestSymbol(data + pos, value.size() - pos);
+                if (code == ESCAPE_CODE) {
+                    code = ESCAPED_BYTE_CODE_BASE + data[pos];
+                    pos++;
+                } else {
+                    pos += table.symbols[code].length;
+                }
+                singleCounts[code]++;
+                if (prevCode != NUM_BUILD_CODES) {
+                    pairCounts[prevCode * NUM_BUILD_CODES + code]++;
+                }
+                prevCode = code;
+            }
+        }
+        auto getSymbol = [&](uint32_t code) {
+            if (code >= ESCAPED_BYTE_CODE_BASE) {
+                return std::string(1, static_cast<char>(code - ESCAPED_BYTE_CODE_BASE));
+            }
+            return std::string(table.symbols[code].get());
+        };
+        // The gain of a candidate is the number of input bytes it would cover.
+        std::unordered_map<std::string, uint64_t> gains;
+        for (auto code = 0u; code < NUM_BUILD_CODES; code++) {
+            if (singleCounts[code] == 0) {
+                continue;
+            }
+            auto symbol = getSymbol(code);
+            gains[symbol] += static_cast<uint64_t>(singleCounts[code]) * symbol.size();
+            for (auto nextCode = 0u; nextCode < NUM_BUILD_CODES; nextCode++) {
+                const auto count = pairCounts[code * NUM_BUILD_CODES + nextCode];
+                if (count == 0) {
+                    continue;
+                }
+                auto concatenated = symbol + getSymbol(nextCode);
+                if (concatenated.size() > MAX_SYMBOL_LENGTH) {
+                    concatenated.resize(MAX_SYMBOL_LENGTH);
+                }
+                gains[concatenated] += static_cast<uint64_t>(count) * concatenated.size();
+            }
+        }
+        std::vector<std::pair<std::string, uint64_t>> candidates(gains.begin(), gains.end());
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        table = FSSTSymbolTable();
+        for (auto i = 0u; i < std::min<uint64_t>(candidates.size(), MAX_NUM_SYMBOLS); i++) {
+            table.addSymbol(candidates[i].first);
+        }
+    }
+    return table;
+}
+
+void FSSTSymbolTable::encode(std::string_view value, std::vector<uint8_t>& result) const {
+    auto data = reinterpret_cast<const uint8_t*>(value.data());
+    uint64_t pos = 0;
+    while (pos < value.size()) {
+        const auto code = findLongestSymbol(data + pos, value.size() - pos);
+        result.push_back(code);
+        if (code == ESCAPE_CODE) {
+            result.push_back(data[pos]);
+            pos++;
+        } else {
+            pos += symbols[code].length;
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getDecodedLength(const uint8_t* data, uint64_t length) const {
+    uint64_t decodedLength = 0;
+    for (uint64_t pos = 0; pos < length; pos++) {
+        if (data[pos] == ESCAPE_CODE) {
+            pos++;
+            decodedLength++;
+        } else {
+            KU_ASSERT(data[pos] < symbols.size());
+            decodedLength += symbols[data[pos]].length;
+        }
+    }
+    return decodedLength;
+}
+
+uint64_t FSSTSymbolTable::decode(const uint8_t* data, uint64_t length, uint8_t* result) const {
+    const auto start = result;
+    for (uint64_t pos = 0; pos < length; pos++) {
+        if (data[pos] == ESCAPE_CODE) {
+            *result++ = data[++pos];
+        } else {
+            const auto& symbol = symbols[data[pos]];
+            std::memcpy(result, &symbol.value, symbol.length);
+            result += symbol.length;
+        }
+    }
+    return result - start;
+}
+
+void FSSTSymbolTable::serialize(common::Serializer& serializer) const {
+    serializer.write<uint8_t>(symbols.size());
+    for (auto& symbol : symbols) {
+        serializer.write(symbol.length);
+        serializer.write(reinterpret_cast<const uint8_t*>(&symbol.value), symbol.length);
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(common::Deserializer& deserializer) {
+    FSSTSymbolTable table;
+    uint8_t numSymbols = 0;
+    deserializer.deserializeValue(numSymbols);
+    for (auto i = 0u; i < numSymbols; i++) {
+        uint8_t length = 0;
+        deserializer.deserializeValue(length);
+        char symbol[MAX_SYMBOL_LENGTH];
+        deserializer.read(reinterpret_cast<uint8_t*>(symbol), length);
+        table.addSymbol(std::string_view(symbol, length));
+    }
+    return table;
+}
+
+} // namespace storage
+} // namespace kuzu
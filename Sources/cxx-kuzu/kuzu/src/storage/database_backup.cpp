@@ -0,0 +1,196 @@
+#include "storage/database_backup.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+#include "common/file_system/virtual_file_system.h"
+#include "main/client_context.h"
+#include "storage/file_handle.h"
+#include "storage/page_manager.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/wal/wal.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+namespace {
+
+// Sleeps whenever the copy gets ahead of the given rate.
+class BackupThrottle {
+public:
+    explicit BackupThrottle(uint64_t maxBytesPerSecond)
+        : maxBytesPerSecond{maxBytesPerSecond}, start{std::chrono::steady_clock::now()} {}
+
+    void addBytes(uint64_t numBytes) {
+        if (maxBytesPerSecond == 0) {
+            return;
+        }
+        numBytesCopied += numBytes;
+        const auto expectedElapsed = std::chrono::duration<double>(
+            static_cast<double>(numBytesCopied) / static_cast<double>(maxBytesPerSecond));
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        if (expectedElapsed > elapsed) {
+            std::this_thread::sleep_for(expectedElapsed - elapsed);
+        }
+    }
+
+private:
+    uint64_t maxBytesPerSecond;
+    std::chrono::steady_clock::time_point start;
+    uint64_t numBytesCopied = 0;
+};
+
+struct BackupSnapshot {
+    page_idx_t numPages = 0;
+    std::vector<PageRange> freeEntries;
+    uint64_t walSize = 0;
+};
+
+} // namespace
+
+static void copyFileRange(main::ClientContext& context, FileInfo& source, FileInfo& destination,
+    uint64_t startOffset, uint64_t endOffset, std::vector<uint8_t>& buffer,
+    BackupThrottle& throttle) {
+    for (auto offset = startOffset; offset < endOffset; offset += buffer.size()) {
+        if (context.interrupted()) {
+            throw InterruptException{};
+        }
+        const auto numBytes = std::min<uint64_t>(buffer.size(), endOffset - offset);
+        source.readFromFile(buffer.data(), numBytes, offset);
+        destination.writeFile(buffer.data(), numBytes, offset);
+        throttle.addBytes(numBytes);
+    }
+}
+
+BackupStats DatabaseBackup::backup(main::ClientContext& context,
+    const std::string& destinationPath, uint64_t maxBytesPerSecond) {
+    if (context.isInMemory()) {
+        throw RuntimeException("Cannot back up an in-memory database.");
+    }
+    auto vfs = VirtualFileSystem::GetUnsafe(context);
+    const auto destinationWALPath = StorageUtils::getWALFilePath(destinationPath);
+    if (vfs->fileOrPathExists(destinationPath, &context) ||
+        vfs->fileOrPathExists(destinationWALPath, &context)) {
+        throw RuntimeException(
+            stringFormat("Cannot back up the database to {}, which already exists.",
+                destinationPath));
+    }
+    auto storageManager = StorageManager::Get(context);
+    auto& dataFH = *storageManager->getDataFH();
+    const auto pageSize = dataFH.getPageSize();
+    auto transactionManager = transaction::TransactionManager::Get(context);
+    BackupSnapshot snapshot;
+    // No transaction commits while the snapshot is taken, so the WAL ends with a whole commit, and
+    // the free entries are those of the last checkpoint plus the pages freed by rolled back
+    // transactions, none of which the copied WAL refers to.
+    transactionManager->pinCheckpoint([&] {
+        // Pages allocated by uncommitted transactions may not have been written yet.
+        snapshot.numPages = std::min<page_idx_t>(dataFH.getNumPages(),
+            dataFH.getFileInfo()->getFileSize() / pageSize);
+        snapshot.freeEntries = dataFH.getPageManager()->getSortedFreeEntries();
+        snapshot.walSize = storageManager->getWAL().flushAndGetFileSize(context);
+    });
+    BackupStats stats;
+    try {
+        BackupThrottle throttle{maxBytesPerSecond};
+        std::vector<uint8_t> buffer(COPY_BATCH_NUM_PAGES * pageSize);
+        auto destination = vfs->openFile(destinationPath,
+            FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS), &context);
+        // Copies the pages before each free entry, and skips the entry.
+        page_idx_t nextPageIdx = 0;
+        auto copyPagesUntil = [&](page_idx_t endPageIdx) {
+            if (nextPageIdx < endPageIdx) {
+                copyFileRange(context, *dataFH.getFileInfo(), *destination,
+                    nextPageIdx * pageSize, endPageIdx * pageSize, buffer, throttle);
+                stats.numPagesCopied += endPageIdx - nextPageIdx;
+                nextPageIdx = endPageIdx;
+            }
+        };
+        for (auto& entry : snapshot.freeEntries) {
+            if (entry.startPageIdx >= snapshot.numPages) {
+                break;
+            }
+            copyPagesUntil(entry.startPageIdx);
+            nextPageIdx = std::max(nextPageIdx, entry.startPageIdx);
+            const auto entryEndPageIdx =
+                std::min<page_idx_t>(entry.startPageIdx + entry.numPages, snapshot.numPages);
+            if (entryEndPageIdx > nextPageIdx) {
+                stats.numFreePagesSkipped += entryEndPageIdx - nextPageIdx;
+                nextPageIdx = entryEndPageIdx;
+            }
+        }
+        copyPagesUntil(snapshot.numPages);
+        // Trailing free pages are skipped as well, but the copy keeps the size of the file.
+        if (destination->getFileSize() < snapshot.numPages * pageSize) {
+            destination->truncate(snapshot.numPages * pageSize);
+        }
+        destination->syncFile();
+        if (snapshot.walSize > 0) {
+            auto wal = vfs->openFile(storageManager->getWAL().getPath(),
+                FileOpenFlags(FileFlags::READ_ONLY), &context);
+            auto destinationWAL = vfs->openFile(destinationWALPath,
+                FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS), &context);
+            copyFileRange(context, *wal, *destinationWAL, 0, snapshot.walSize, buffer, throttle);
+            destinationWAL->syncFile();
+            stats.numWALBytesCopied = snapshot.walSize;
+        }
+    } catch (...) {
+        transactionManager->unpinCheckpoint();
+        throw;
+    }
+    transactionManager->unpinCheckpoint();
+    return stats;
+}
+
+uint64_t DatabaseBackup::shipWAL(main::ClientContext& context,
+    const std::string& destinationPath) {
+    if (context.isInMemory()) {
+        throw RuntimeException("Cannot ship the WAL of an in-memory database.");
+    }
+    auto vfs = VirtualFileSystem::GetUnsafe(context);
+    auto& wal = StorageManager::Get(context)->getWAL();
+    auto transactionManager = transaction::TransactionManager::Get(context);
+    uint64_t walSize = 0;
+    // The WAL is only truncated by checkpoints, which are skipped until it is shipped.
+    transactionManager->pinCheckpoint([&] { walSize = wal.flushAndGetFileSize(context); });
+    uint64_t numBytesCopied = 0;
+    try {
+        if (walSize > 0) {
+            auto source =
+                vfs->openFile(wal.getPath(), FileOpenFlags(FileFlags::READ_ONLY), &context);
+            auto destination = vfs->openFile(destinationPath,
+                FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS), &context);
+            auto startOffset = destination->getFileSize();
+            const auto prefixSize = std::min({startOffset, walSize, WAL_PREFIX_SIZE});
+            std::vector<uint8_t> sourcePrefix(prefixSize), destinationPrefix(prefixSize);
+            source->readFromFile(sourcePrefix.data(), prefixSize, 0 /* position */);
+            destination->readFromFile(destinationPrefix.data(), prefixSize, 0 /* position */);
+            if (startOffset > walSize || sourcePrefix != destinationPrefix) {
+                // The destination holds the WAL of an earlier checkpoint.
+                destination->truncate(0);
+                startOffset = 0;
+            }
+            BackupThrottle throttle{0 /* maxBytesPerSecond */};
+            std::vector<uint8_t> buffer(COPY_BATCH_NUM_PAGES * KUZU_PAGE_SIZE);
+            copyFileRange(context, *source, *destination, startOffset, walSize, buffer,
+                throttle);
+            destination->syncFile();
+            numBytesCopied = walSize - startOffset;
+        }
+    } catch (...) {
+        transactionManager->unpinCheckpoint();
+        throw;
+    }
+    transactionManager->unpinCheckpoint();
+    return numBytesCopied;
+}
+
+} // namespace storage
+} // namespace kuzu
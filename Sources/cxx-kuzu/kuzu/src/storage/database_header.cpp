@@ -75,13 +75,15 @@ void DatabaseHeader::serialize(common::Serializer& ser) const {
     ser.serializeValue(metadataPageRange.numPages);
     ser.writeDebuggingInfo("databaseID");
     ser.serializeValue(databaseID.value);
+    ser.writeDebuggingInfo("checkpointID");
+    ser.serializeValue(checkpointID.value);
 }
 
 DatabaseHeader DatabaseHeader::deserialize(common::Deserializer& deSer) {
     validateMagicBytes(deSer);
     validateStorageVersion(deSer);
     PageRange catalogPageRange{}, metaPageRange{};
-    common::ku_uuid_t databaseID{};
+    common::ku_uuid_t databaseID{}, checkpointID{};
     std::string key;
     deSer.validateDebuggingInfo(key, "catalog");
     deSer.deserializeValue(catalogPageRange.startPageIdx);
@@ -91,12 +93,15 @@ DatabaseHeader DatabaseHeader::deserialize(common::Deserializer& deSer) {
     deSer.deserializeValue(metaPageRange.numPages);
     deSer.validateDebuggingInfo(key, "databaseID");
     deSer.deserializeValue(databaseID.value);
-    return {catalogPageRange, metaPageRange, databaseID};
+    deSer.validateDebuggingInfo(key, "checkpointID");
+    deSer.deserializeValue(checkpointID.value);
+    return {catalogPageRange, metaPageRange, databaseID, checkpointID};
 }
 
 DatabaseHeader DatabaseHeader::createInitialHeader(common::RandomEngine* randomEngine) {
     // We generate a random UUID to act as the database ID
-    return DatabaseHeader{{}, {}, common::UUID::generateRandomUUID(randomEngine)};
+    return DatabaseHeader{{}, {}, common::UUID::generateRandomUUID(randomEngine),
+        common::UUID::generateRandomUUID(randomEngine)};
 }
 
 std::optional<DatabaseHeader> DatabaseHeader::readDatabaseHeader(common::FileInfo& dataFileInfo) {
@@ -102,6 +102,54 @@ void DiskArrayInternal::get(uint64_t idx, const Transaction* transaction,
     }
 }
 
+void DiskArrayInternal::get(std::span<const uint64_t> idxs, const Transaction* transaction,
+    std::span<std::byte> vals) {
+    if (idxs.empty()) {
+        return;
+    }
+    std::shared_lock sLck{diskArraySharedMtx};
+    const auto elementSize = vals.size() / idxs.size();
+    // The elements on each page form a group, which starts at groupStartIdxs[i] in idxs.
+    std::vector<uint32_t> groupStartIdxs;
+    std::vector<page_idx_t> apPageIdxs;
+    for (auto i = 0u; i < idxs.size(); i++) {
+        KU_ASSERT(checkOutOfBoundAccess(transaction->getType(), idxs[i]));
+        KU_ASSERT(i == 0 || idxs[i - 1] <= idxs[i]);
+        const auto apIdx = getAPIdxAndOffsetInAP(storageInfo, idxs[i]).pageIdx;
+        if (i == 0 || apIdx != getAPIdxAndOffsetInAP(storageInfo, idxs[i - 1]).pageIdx) {
+            groupStartIdxs.push_back(i);
+            apPageIdxs.push_back(getAPPageIdxNoLock(apIdx, transaction->getType()));
+        }
+    }
+    groupStartIdxs.push_back(idxs.size());
+    // Runs of consecutive pages are prefetched together, so that pages which aren't in the buffer
+    // pool are read in the background while the earlier ones are being read.
+    auto runStart = 0u;
+    for (auto i = 1u; apPageIdxs.size() > 1 && i <= apPageIdxs.size(); i++) {
+        if (i == apPageIdxs.size() || apPageIdxs[i] != apPageIdxs[i - 1] + 1) {
+            fileHandle.prefetchPages(PageRange{apPageIdxs[runStart], i - runStart});
+            runStart = i;
+        }
+    }
+    for (auto group = 0u; group < apPageIdxs.size(); group++) {
+        auto readElements = [&](const uint8_t* frame) -> void {
+            for (auto i = groupStartIdxs[group]; i < groupStartIdxs[group + 1]; i++) {
+                memcpy(vals.data() + i * elementSize,
+                    frame + getAPIdxAndOffsetInAP(storageInfo, idxs[i]).elemPosInPage,
+                    elementSize);
+            }
+        };
+        const auto apPageIdx = apPageIdxs[group];
+        if (transaction->getType() != TransactionType::CHECKPOINT || !hasTransactionalUpdates ||
+            apPageIdx > lastPageOnDisk ||
+            !shadowFile->hasShadowPage(fileHandle.getFileIndex(), apPageIdx)) {
+            fileHandle.optimisticReadPage(apPageIdx, readElements);
+        } else {
+            ShadowUtils::readShadowVersionOfPage(fileHandle, apPageIdx, *shadowFile, readElements);
+        }
+    }
+}
+
 void DiskArrayInternal::updatePage(uint64_t pageIdx, bool isNewPage,
     std::function<void(uint8_t*)> updateOp) {
     // Pages which are new to this transaction are written directly to the file
@@ -1,5 +1,6 @@
 #include "storage/file_handle.h"
 
+#include <chrono>
 #include <cmath>
 
 #include "common/file_system/virtual_file_system.h"
@@ -28,6 +29,10 @@ FileHandle::FileHandle(const std::string& path, uint8_t fhFlags, BufferManager*
     }
 }
 
+FileHandle::~FileHandle() {
+    unmapFile();
+}
+
 void FileHandle::constructPersistentFileHandle(const std::string& path, VirtualFileSystem* vfs,
     main::ClientContext* context) {
     FileOpenFlags openFlags{0};
@@ -40,6 +45,9 @@ void FileHandle::constructPersistentFileHandle(const std::string& path, VirtualF
             ((createFileIfNotExists()) ? FileFlags::CREATE_IF_NOT_EXISTS : 0x00000000);
         openFlags.lockType = isLockRequired() ? FileLockType::WRITE_LOCK : FileLockType::NO_LOCK;
     }
+    if (isDirectIO()) {
+        openFlags.flags |= FileFlags::DIRECT_IO;
+    }
     fileInfo = vfs->openFile(path, openFlags, context);
     const auto fileLength = fileInfo->getFileSize();
     numPages = ceil(static_cast<double>(fileLength) / static_cast<double>(getPageSize()));
@@ -47,6 +55,19 @@ void FileHandle::constructPersistentFileHandle(const std::string& path, VirtualF
     while (pageCapacity < numPages) {
         pageCapacity += StorageConstants::PAGE_GROUP_SIZE;
     }
+    // Only whole pages are mapped, so that reading any page stays within the mapping.
+    if (isReadOnlyFile() && shouldMapReadOnly() && fileLength % getPageSize() == 0) {
+        mappedData = fileInfo->mapReadOnly(fileLength);
+        mappedSize = mappedData == nullptr ? 0 : fileLength;
+    }
+}
+
+void FileHandle::unmapFile() {
+    if (mappedData != nullptr) {
+        fileInfo->unmap(mappedData, mappedSize);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
 }
 
 void FileHandle::constructTmpFileHandle(const std::string& path) {
@@ -92,25 +113,37 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
         // Already pinned.
         return bm->getFrame(*this, pageIdx);
     }
+    if (isMemoryMapped()) {
+        return getMappedPage(pageIdx);
+    }
     return bm->pin(*this, pageIdx, readPolicy);
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageReadPolicy readPolicy) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
+    } else if (isMemoryMapped()) {
+        readOp(getMappedPage(pageIdx));
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, readPolicy);
     }
 }
 
 void FileHandle::unpinPage(page_idx_t pageIdx) {
+    if (isMemoryMapped()) {
+        return;
+    }
     bm->unpin(*this, pageIdx);
 }
 
+void FileHandle::prefetchPages(const PageRange& pageRange) {
+    bm->prefetch(*this, pageRange);
+}
+
 void FileHandle::resetToZeroPagesAndPageCapacity() {
     removePageIdxAndTruncateIfNecessary(0 /* pageIdx */);
     if (isInMemoryMode()) {
@@ -124,6 +157,9 @@ void FileHandle::resetToZeroPagesAndPageCapacity() {
 
 uint8_t* FileHandle::getFrame(page_idx_t pageIdx) {
     KU_ASSERT(pageIdx < numPages);
+    if (isMemoryMapped()) {
+        return getMappedPage(pageIdx);
+    }
     return bm->getFrame(*this, pageIdx);
 }
 
@@ -148,15 +184,56 @@ void FileHandle::removePageFromFrameIfNecessary(page_idx_t pageIdx) {
 }
 
 void FileHandle::flushAllDirtyPagesInFrames() {
+    if (isInMemoryMode()) {
+        return;
+    }
+    // Dirty pages are written in batches so that file systems which can submit several writes at
+    // once (e.g. io_uring) need a single system call per batch.
+    static constexpr uint64_t FLUSH_BATCH_SIZE = 64;
+    std::vector<FileWriteRequest> requests;
+    std::vector<page_idx_t> pagesInBatch;
+    requests.reserve(FLUSH_BATCH_SIZE);
+    pagesInBatch.reserve(FLUSH_BATCH_SIZE);
+    const auto flushBatch = [&]() {
+        fileInfo->writeFiles(requests);
+        ioStats.add(FileIOCounter::BYTES_WRITTEN, requests.size() * getPageSize());
+        for (auto pageIdx : pagesInBatch) {
+            getPageState(pageIdx)->clearDirtyWithoutLock();
+        }
+        requests.clear();
+        pagesInBatch.clear();
+    };
     for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
-        flushPageIfDirtyWithoutLock(pageIdx);
+        if (!getPageState(pageIdx)->isDirty()) {
+            continue;
+        }
+        requests.push_back({getFrame(pageIdx), getPageSize(), pageIdx * getPageSize()});
+        pagesInBatch.push_back(pageIdx);
+        if (requests.size() == FLUSH_BATCH_SIZE) {
+            flushBatch();
+        }
+    }
+    if (!requests.empty()) {
+        flushBatch();
     }
 }
 
+void FileHandle::readPageFromDisk(uint8_t* frame, page_idx_t pageIdx) const {
+    KU_ASSERT(!isInMemoryMode());
+    KU_ASSERT(pageIdx < numPages);
+    const auto start = std::chrono::steady_clock::now();
+    fileInfo->readFromFile(frame, getPageSize(), pageIdx * getPageSize());
+    ioStats.recordReadLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start)
+                                  .count());
+    ioStats.add(FileIOCounter::BYTES_READ, getPageSize());
+}
+
 void FileHandle::flushPageIfDirtyWithoutLock(page_idx_t pageIdx) {
     auto pageState = getPageState(pageIdx);
     if (!isInMemoryMode() && pageState->isDirty()) {
         fileInfo->writeFile(getFrame(pageIdx), getPageSize(), pageIdx * getPageSize());
+        ioStats.add(FileIOCounter::BYTES_WRITTEN, getPageSize());
         pageState->clearDirtyWithoutLock();
     }
 }
@@ -170,6 +247,7 @@ void FileHandle::writePagesToFile(const uint8_t* buffer, uint64_t size, page_idx
         }
     } else {
         fileInfo->writeFile(buffer, size, startPageIdx * getPageSize());
+        ioStats.add(FileIOCounter::BYTES_WRITTEN, size);
     }
 }
 
@@ -0,0 +1,392 @@
+#include "storage/index/aggregate_view.h"
+
+#include <algorithm>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/data_chunk/data_chunk.h"
+#include "common/exception/binder.h"
+#include "common/exception/overflow.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "function/arithmetic/add.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/local_storage/local_node_table.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+std::string AggregateViewFuncUtils::toString(AggregateViewFunc func) {
+    switch (func) {
+    case AggregateViewFunc::COUNT:
+        return "COUNT";
+    case AggregateViewFunc::SUM:
+        return "SUM";
+    case AggregateViewFunc::MIN:
+        return "MIN";
+    case AggregateViewFunc::MAX:
+        return "MAX";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+AggregateViewFunc AggregateViewFuncUtils::fromString(const std::string& name) {
+    const auto upperName = StringUtils::getUpper(name);
+    for (auto func : {AggregateViewFunc::COUNT, AggregateViewFunc::SUM, AggregateViewFunc::MIN,
+             AggregateViewFunc::MAX}) {
+        if (upperName == toString(func)) {
+            return func;
+        }
+    }
+    throw BinderException{stringFormat(
+        "Unsupported aggregate function {} for an aggregate view. Supported functions are COUNT, "
+        "SUM, MIN and MAX.",
+        name)};
+}
+
+std::shared_ptr<BufferWriter> AggregateViewAuxInfo::serialize() const {
+    auto bufferWriter = std::make_shared<BufferWriter>();
+    auto serializer = Serializer(bufferWriter);
+    serializer.write(func);
+    return bufferWriter;
+}
+
+std::unique_ptr<AggregateViewAuxInfo> AggregateViewAuxInfo::deserialize(
+    std::unique_ptr<BufferReader> reader) {
+    Deserializer deserializer{std::move(reader)};
+    auto func = AggregateViewFunc::COUNT;
+    deserializer.deserializeValue(func);
+    return std::make_unique<AggregateViewAuxInfo>(func);
+}
+
+std::string AggregateViewAuxInfo::toCypher(const catalog::IndexCatalogEntry& indexEntry,
+    const catalog::ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<catalog::IndexToCypherInfo>();
+    auto catalog = catalog::Catalog::Get(*indexToCypherInfo.context);
+    auto transaction = Transaction::Get(*indexToCypherInfo.context);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, indexEntry.getTableID());
+    const auto propertyIDs = indexEntry.getPropertyIDs();
+    const auto groupPropertyName = tableEntry->getProperty(propertyIDs[0]).getName();
+    const auto valuePropertyName =
+        propertyIDs.size() > 1 ? tableEntry->getProperty(propertyIDs[1]).getName() : "*";
+    return stringFormat("CALL CREATE_AGGREGATE_VIEW('{}', '{}', '{}', '{}', '{}');",
+        tableEntry->getName(), indexEntry.getIndexName(), groupPropertyName,
+        AggregateViewFuncUtils::toString(func), valuePropertyName);
+}
+
+std::shared_ptr<BufferWriter> AggregateViewStorageInfo::serialize() const {
+    auto bufferWriter = std::make_shared<BufferWriter>();
+    auto serializer = Serializer(bufferWriter);
+    serializer.write(func);
+    return bufferWriter;
+}
+
+static bool isFloatingPoint(const LogicalType& dataType) {
+    return dataType.getLogicalTypeID() == LogicalTypeID::FLOAT ||
+           dataType.getLogicalTypeID() == LogicalTypeID::DOUBLE;
+}
+
+static int64_t getIntValue(const ValueVector& vector, uint32_t pos) {
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT8:
+        return vector.getValue<int8_t>(pos);
+    case PhysicalTypeID::INT16:
+        return vector.getValue<int16_t>(pos);
+    case PhysicalTypeID::INT32:
+        return vector.getValue<int32_t>(pos);
+    case PhysicalTypeID::INT64:
+        return vector.getValue<int64_t>(pos);
+    case PhysicalTypeID::UINT8:
+        return vector.getValue<uint8_t>(pos);
+    case PhysicalTypeID::UINT16:
+        return vector.getValue<uint16_t>(pos);
+    case PhysicalTypeID::UINT32:
+        return vector.getValue<uint32_t>(pos);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+static double getDoubleValue(const ValueVector& vector, uint32_t pos) {
+    return vector.dataType.getLogicalTypeID() == LogicalTypeID::FLOAT ?
+               vector.getValue<float>(pos) :
+               vector.getValue<double>(pos);
+}
+
+AggregateView::AggregateView(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+    NodeTable& nodeTable)
+    : Index{std::move(indexInfo), std::move(storageInfo)}, nodeTable{nodeTable},
+      func{this->storageInfo->constCast<AggregateViewStorageInfo>().func}, valid{false},
+      version{0}, epoch{0} {}
+
+bool AggregateView::isSupportedGroupType(const LogicalType& dataType) {
+    return !LogicalTypeUtils::isNested(dataType);
+}
+
+bool AggregateView::isSupportedValueType(const LogicalType& dataType) {
+    switch (dataType.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+LogicalType AggregateView::getResultType(AggregateViewFunc func, const LogicalType* valueType) {
+    if (func == AggregateViewFunc::COUNT || !isFloatingPoint(*valueType)) {
+        return LogicalType::INT64();
+    }
+    return LogicalType::DOUBLE();
+}
+
+std::vector<AggregateView::Group> AggregateView::getGroups(main::ClientContext* context) {
+    const auto transaction = Transaction::Get(*context);
+    uint64_t startEpoch = 0;
+    std::vector<Group> result;
+    {
+        std::unique_lock lck{mtx};
+        if (transaction->isReadOnly() && valid && version <= transaction->getStartTS()) {
+            result.reserve(groups.size());
+            for (auto& [_, group] : groups) {
+                result.push_back(group);
+            }
+            return result;
+        }
+        startEpoch = epoch;
+    }
+    auto computedGroups = computeGroups(transaction, MemoryManager::Get(*context));
+    result.reserve(computedGroups.size());
+    for (auto& [_, group] : computedGroups) {
+        result.push_back(group);
+    }
+    // The groups of a snapshot are kept if it is the latest one, and no write transaction may have
+    // changed the table without committing yet. Changes made since the epoch was read bump it.
+    const auto transactionManager = TransactionManager::Get(*context);
+    if (transaction->isReadOnly() &&
+        transaction->getStartTS() == transactionManager->getLastCommitTS() &&
+        !transactionManager->mayHaveActiveWriteTransaction()) {
+        std::unique_lock lck{mtx};
+        if (!valid && epoch == startEpoch) {
+            groups = std::move(computedGroups);
+            version = transaction->getStartTS();
+            valid = true;
+        }
+    }
+    return result;
+}
+
+void AggregateView::writeResult(const Group& group, AggregateViewFunc func, bool hasValueColumn,
+    ValueVector& vector, uint32_t pos) {
+    if (func == AggregateViewFunc::COUNT) {
+        vector.setNull(pos, false);
+        vector.setValue<int64_t>(pos, hasValueColumn ? group.numValues : group.numNodes);
+        return;
+    }
+    if (group.numValues == 0) {
+        vector.setNull(pos, true);
+        return;
+    }
+    vector.setNull(pos, false);
+    if (vector.dataType.getLogicalTypeID() == LogicalTypeID::DOUBLE) {
+        vector.setValue<double>(pos, group.doubleValue);
+    } else {
+        vector.setValue<int64_t>(pos, group.intValue);
+    }
+}
+
+void AggregateView::commitInsert(Transaction* transaction, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, InsertState&) {
+    KU_ASSERT(indexVectors.size() == indexInfo.columnIDs.size());
+    std::unique_lock lck{mtx};
+    epoch++;
+    if (!valid) {
+        return;
+    }
+    try {
+        nodeIDVector.state->getSelVector().forEach([&](auto pos) {
+            addNode(groups, *indexVectors[0], hasValueColumn() ? indexVectors[1] : nullptr, pos);
+        });
+    } catch (const OverflowException&) {
+        // The sum is left to the next reader, which reports the overflow.
+        invalidateNoLock();
+        return;
+    }
+    version = transaction->getCommitTS();
+}
+
+void AggregateView::update(Transaction* transaction, const ValueVector& nodeIDVector,
+    ValueVector&, UpdateState&) {
+    KU_ASSERT(nodeIDVector.state->isFlat());
+    const auto nodeIDPos = nodeIDVector.state->getSelVector()[0];
+    if (nodeIDVector.isNull(nodeIDPos)) {
+        return;
+    }
+    // Uncommitted nodes are added to the groups with their final values when they are committed.
+    if (transaction->isUnCommitted(indexInfo.tableID,
+            nodeIDVector.getValue<nodeID_t>(nodeIDPos).offset)) {
+        return;
+    }
+    // The update may still be rolled back, but the old values would have to be scanned either way.
+    std::unique_lock lck{mtx};
+    invalidateNoLock();
+}
+
+void AggregateView::delete_(Transaction* transaction, const ValueVector& nodeIDVector,
+    DeleteState&) {
+    bool deletesCommittedNode = false;
+    nodeIDVector.state->getSelVector().forEach([&](auto pos) {
+        if (!nodeIDVector.isNull(pos) &&
+            !transaction->isUnCommitted(indexInfo.tableID,
+                nodeIDVector.getValue<nodeID_t>(pos).offset)) {
+            deletesCommittedNode = true;
+        }
+    });
+    if (deletesCommittedNode) {
+        std::unique_lock lck{mtx};
+        invalidateNoLock();
+    }
+}
+
+void AggregateView::finalize(main::ClientContext*) {
+    std::unique_lock lck{mtx};
+    invalidateNoLock();
+}
+
+std::unique_ptr<Index> AggregateView::load(main::ClientContext* context,
+    StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+    // The catalog entry may not be in the catalog of the context when the table belongs to an
+    // attached database.
+    auto catalog = catalog::Catalog::Get(*context);
+    if (catalog->containsIndex(&DUMMY_CHECKPOINT_TRANSACTION, indexInfo.tableID, indexInfo.name)) {
+        auto indexEntry =
+            catalog->getIndex(&DUMMY_CHECKPOINT_TRANSACTION, indexInfo.tableID, indexInfo.name);
+        if (!indexEntry->isLoaded()) {
+            indexEntry->setAuxInfo(
+                AggregateViewAuxInfo::deserialize(indexEntry->getAuxBufferReader()));
+        }
+    }
+    Deserializer deserializer{
+        std::make_unique<BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size())};
+    auto func = AggregateViewFunc::COUNT;
+    deserializer.deserializeValue(func);
+    auto& nodeTable = storageManager->getTable(indexInfo.tableID)->cast<NodeTable>();
+    // The groups are computed by the first reader.
+    return std::make_unique<AggregateView>(std::move(indexInfo),
+        std::make_unique<AggregateViewStorageInfo>(func), nodeTable);
+}
+
+AggregateView::group_map_t AggregateView::computeGroups(Transaction* transaction,
+    MemoryManager* memoryManager) const {
+    const auto& columnIDs = indexInfo.columnIDs;
+    auto state = std::make_shared<DataChunkState>();
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID(), memoryManager, state);
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    std::vector<ValueVector*> vectorPtrs;
+    for (const auto columnID : columnIDs) {
+        vectors.push_back(std::make_unique<ValueVector>(
+            nodeTable.getColumn(columnID).getDataType().copy(), memoryManager, state));
+        vectorPtrs.push_back(vectors.back().get());
+    }
+    const auto valueVector = hasValueColumn() ? vectorPtrs[1] : nullptr;
+    group_map_t result;
+    NodeTableScanState scanState{&nodeIDVector, vectorPtrs, state};
+    scanState.setToTable(transaction, &nodeTable, columnIDs, {});
+    auto scanNodeGroup = [&](TableScanSource source, node_group_idx_t nodeGroupIdx) {
+        scanState.source = source;
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        nodeTable.initScanState(transaction, scanState);
+        while (nodeTable.scan(transaction, scanState)) {
+            scanState.outState->getSelVector().forEach(
+                [&](auto pos) { addNode(result, *vectorPtrs[0], valueVector, pos); });
+        }
+    };
+    for (auto i = 0u; i < nodeTable.getNumCommittedNodeGroups(); i++) {
+        scanNodeGroup(TableScanSource::COMMITTED, i);
+    }
+    if (const auto localStorage = transaction->getLocalStorage()) {
+        if (const auto localTable = localStorage->getLocalTable(indexInfo.tableID)) {
+            const auto numLocalNodeGroups = localTable->cast<LocalNodeTable>().getNumNodeGroups();
+            for (auto i = 0u; i < numLocalNodeGroups; i++) {
+                scanNodeGroup(TableScanSource::UNCOMMITTED, i);
+            }
+        }
+    }
+    return result;
+}
+
+void AggregateView::addNode(group_map_t& groups, const ValueVector& groupVector,
+    const ValueVector* valueVector, uint32_t pos) const {
+    auto key = groupVector.getAsValue(pos);
+    auto& group = groups.try_emplace(*key, *key).first->second;
+    group.numNodes++;
+    if (valueVector == nullptr || valueVector->isNull(pos)) {
+        return;
+    }
+    group.numValues++;
+    if (func == AggregateViewFunc::COUNT) {
+        return;
+    }
+    if (isFloatingPoint(valueVector->dataType)) {
+        const auto value = getDoubleValue(*valueVector, pos);
+        switch (func) {
+        case AggregateViewFunc::SUM:
+            group.doubleValue += value;
+            break;
+        case AggregateViewFunc::MIN:
+            group.doubleValue = group.numValues == 1 ? value : std::min(group.doubleValue, value);
+            break;
+        case AggregateViewFunc::MAX:
+            group.doubleValue = group.numValues == 1 ? value : std::max(group.doubleValue, value);
+            break;
+        default:
+            KU_UNREACHABLE;
+        }
+        return;
+    }
+    auto value = getIntValue(*valueVector, pos);
+    switch (func) {
+    case AggregateViewFunc::SUM:
+        function::Add::operation(group.intValue, value, group.intValue);
+        break;
+    case AggregateViewFunc::MIN:
+        group.intValue = group.numValues == 1 ? value : std::min(group.intValue, value);
+        break;
+    case AggregateViewFunc::MAX:
+        group.intValue = group.numValues == 1 ? value : std::max(group.intValue, value);
+        break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void AggregateView::invalidateNoLock() {
+    valid = false;
+    groups.clear();
+    epoch++;
+}
+
+} // namespace storage
+} // namespace kuzu
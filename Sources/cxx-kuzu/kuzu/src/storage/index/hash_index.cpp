@@ -1,14 +1,18 @@
 #include "storage/index/hash_index.h"
 
+#include <array>
 #include <bitset>
 
 #include "common/assert.h"
 #include "common/exception/message.h"
+#include "common/serializer/buffered_file.h"
 #include "common/serializer/deserializer.h"
+#include "common/serializer/in_mem_file_writer.h"
 #include "common/types/int128_t.h"
 #include "common/types/ku_string.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
+#include "main/db_config.h"
 #include "storage/disk_array.h"
 #include "storage/disk_array_collection.h"
 #include "storage/file_handle.h"
@@ -58,6 +62,10 @@ void HashIndex<T>::deleteFromPersistentIndex(const Transaction* transaction, Key
             updateSlot(transaction, iter.slotInfo, iter.slot);
             header.numEntries--;
         }
+        if (iter.slotInfo.slotType == SlotType::PRIMARY &&
+            !iter.slot.mayHaveOverflowFingerprint(fingerprint)) {
+            return;
+        }
     } while (nextChainedSlot(transaction, iter));
 }
 
@@ -132,6 +140,40 @@ void HashIndex<T>::reclaimStorage(PageAllocator& pageAllocator) {
     oSlots->reclaimStorage(pageAllocator);
 }
 
+template<typename T>
+bool HashIndex<T>::checkpointBloomFilter(bool enabled) {
+    if (!enabled) {
+        const bool hadBloomFilter = bloomFilter != nullptr;
+        bloomFilter.reset();
+        return hadBloomFilter;
+    }
+    // Keys merged during the checkpoint were already added to the filter, so it only needs to be
+    // rebuilt once it holds more keys than it was sized for.
+    if (bloomFilter && indexHeaderForWriteTrx.numEntries <= bloomFilter->getCapacity()) {
+        return false;
+    }
+    rebuildBloomFilter(&DUMMY_CHECKPOINT_TRANSACTION);
+    return true;
+}
+
+template<typename T>
+void HashIndex<T>::rebuildBloomFilter(const Transaction* transaction) {
+    // Leave room for the index to double in size before the filter has to be rebuilt again
+    auto filter = std::make_unique<HashIndexBloomFilter>(indexHeaderForWriteTrx.numEntries * 2);
+    for (auto* slots : {pSlots.get(), oSlots.get()}) {
+        const auto numSlots = slots->getNumElements(transaction->getType());
+        for (slot_id_t slotId = 0; slotId < numSlots; slotId++) {
+            const auto slot = slots->get(slotId, transaction);
+            for (auto entryPos = 0u; entryPos < PERSISTENT_SLOT_CAPACITY; entryPos++) {
+                if (slot.header.isEntryValid(entryPos)) {
+                    filter->insert(hashStored(transaction, slot.entries[entryPos].key));
+                }
+            }
+        }
+    }
+    bloomFilter = std::move(filter);
+}
+
 template<typename T>
 void HashIndex<T>::splitSlots(PageAllocator& pageAllocator, const Transaction* transaction,
     HashIndexHeader& header, slot_id_t numSlotsToSplit) {
@@ -152,6 +194,8 @@ void HashIndex<T>::splitSlots(PageAllocator& pageAllocator, const Transaction* t
 
     for (slot_id_t i = 0; i < numSlotsToSplit; i++) {
         auto* newSlot = &*newSlotIterator.pushBack(pageAllocator, transaction, OnDiskSlotType());
+        auto* newPrimarySlot = newSlot;
+        newPrimarySlot->initOverflowFingerprints();
         entry_pos_t newEntryPos = 0;
         OnDiskSlotType* originalSlot = &*originalSlotIterator.seek(header.nextSplitSlotId);
         do {
@@ -174,8 +218,13 @@ void HashIndex<T>::splitSlots(PageAllocator& pageAllocator, const Transaction* t
                 if (newSlotId != header.nextSplitSlotId) {
                     KU_ASSERT(newSlotId == newSlotIterator.idx());
                     newSlot->entries[newEntryPos] = originalSlot->entries[originalEntryPos];
-                    newSlot->header.setEntryValid(newEntryPos,
-                        originalSlot->header.fingerprints[originalEntryPos]);
+                    const auto fingerprint = originalSlot->header.fingerprints[originalEntryPos];
+                    newSlot->header.setEntryValid(newEntryPos, fingerprint);
+                    if (newSlot != newPrimarySlot) {
+                        newPrimarySlot->addOverflowFingerprint(fingerprint);
+                    }
+                    // The entries left in the chain of the original slot keep their fingerprints
+                    // in its mask.
                     originalSlot->header.setEntryInvalid(originalEntryPos);
                     newEntryPos++;
                 }
@@ -189,6 +238,73 @@ void HashIndex<T>::splitSlots(PageAllocator& pageAllocator, const Transaction* t
     }
 }
 
+template<typename T>
+void HashIndex<T>::lookupBatchInPersistentIndex(const Transaction* transaction,
+    std::span<const Key> keys, std::vector<uint32_t> keyIdxs, std::span<offset_t> results,
+    const visible_func& isVisible) {
+    auto& header = transaction->getType() == TransactionType::CHECKPOINT ?
+                       this->indexHeaderForWriteTrx :
+                       this->indexHeaderForReadTrx;
+    if (header.numEntries == 0 || keyIdxs.empty()) {
+        return;
+    }
+    struct SlotLookup {
+        slot_id_t slotId;
+        uint32_t keyIdx;
+        uint8_t fingerprint;
+    };
+    std::vector<SlotLookup> lookups;
+    lookups.reserve(keyIdxs.size());
+    for (auto keyIdx : keyIdxs) {
+        auto hashValue = HashIndexUtils::hash(keys[keyIdx]);
+        if (bloomFilter && !bloomFilter->mayContain(hashValue)) {
+            continue;
+        }
+        lookups.push_back(SlotLookup{HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
+            keyIdx, HashIndexUtils::getFingerprintForHash(hashValue)});
+    }
+    auto slotType = SlotType::PRIMARY;
+    std::vector<uint64_t> slotIds;
+    std::vector<OnDiskSlotType> slots;
+    while (!lookups.empty()) {
+        std::ranges::sort(lookups, {}, &SlotLookup::slotId);
+        slotIds.clear();
+        for (auto& lookup : lookups) {
+            if (slotIds.empty() || slotIds.back() != lookup.slotId) {
+                slotIds.push_back(lookup.slotId);
+            }
+        }
+        slots.resize(slotIds.size());
+        auto& slotArray = slotType == SlotType::PRIMARY ? pSlots : oSlots;
+        slotArray->get(slotIds, transaction, slots);
+        auto slotIdx = 0u;
+        auto numRemaining = 0u;
+        for (auto i = 0u; i < lookups.size(); i++) {
+            const auto lookup = lookups[i];
+            if (slotIds[slotIdx] != lookup.slotId) {
+                slotIdx++;
+            }
+            const auto& slot = slots[slotIdx];
+            auto entryPos = findMatchedEntryInSlot(transaction, slot, keys[lookup.keyIdx],
+                lookup.fingerprint, isVisible);
+            if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                results[lookup.keyIdx] = slot.entries[entryPos].value;
+                continue;
+            }
+            if (slotType == SlotType::PRIMARY &&
+                !slot.mayHaveOverflowFingerprint(lookup.fingerprint)) {
+                continue;
+            }
+            if (slot.header.nextOvfSlotId != SlotHeader::INVALID_OVERFLOW_SLOT_ID) {
+                lookups[numRemaining++] =
+                    SlotLookup{slot.header.nextOvfSlotId, lookup.keyIdx, lookup.fingerprint};
+            }
+        }
+        lookups.resize(numRemaining);
+        slotType = SlotType::OVF;
+    }
+}
+
 template<typename T>
 std::vector<std::pair<SlotInfo, typename HashIndex<T>::OnDiskSlotType>>
 HashIndex<T>::getChainedSlots(const Transaction* transaction, slot_id_t pSlotId) {
@@ -249,6 +365,9 @@ void HashIndex<T>::sortEntries(const Transaction* transaction,
             const auto hash = hashStored(transaction, entry->key);
             const auto primarySlot =
                 HashIndexUtils::getPrimarySlotIdForHash(indexHeaderForWriteTrx, hash);
+            if (bloomFilter) {
+                bloomFilter->insert(hash);
+            }
             entries.push_back(HashIndexEntryView{primarySlot,
                 slotToMerge.slot->header.fingerprints[entryPos], entry});
         }
@@ -358,6 +477,12 @@ size_t HashIndex<T>::mergeSlot(PageAllocator& pageAllocator, const Transaction*
     OnDiskSlotType* diskSlot = &*diskSlotIterator.seek(diskSlotId);
     KU_ASSERT(diskSlot->header.nextOvfSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID ||
               diskOverflowSlotIterator.size() > diskSlot->header.nextOvfSlotId);
+    // The primary slot stays pinned by its iterator while overflow slots are added.
+    OnDiskSlotType* primarySlot = diskSlot;
+    if (primarySlot->header.nextOvfSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID &&
+        !primarySlot->hasOverflowFingerprints()) {
+        primarySlot->initOverflowFingerprints();
+    }
     // Merge slot from local storage to an existing slot.
     size_t merged = 0;
     for (auto it = std::rbegin(slotToMerge); it != std::rend(slotToMerge); ++it) {
@@ -398,6 +523,9 @@ size_t HashIndex<T>::mergeSlot(PageAllocator& pageAllocator, const Transaction*
             diskSlot->entries[diskEntryPos] = *it->entry;
         }
         diskSlot->header.setEntryValid(diskEntryPos, it->fingerprint);
+        if (diskSlot != primarySlot) {
+            primarySlot->addOverflowFingerprint(it->fingerprint);
+        }
         KU_ASSERT([&]() {
             const auto& key = it->entry->key;
             const auto hash = hashStored(transaction, key);
@@ -461,7 +589,13 @@ std::unique_ptr<IndexStorageInfo> PrimaryKeyIndexStorageInfo::deserialize(
     Deserializer deSer(std::move(reader));
     deSer.deserializeValue(firstHeaderPage);
     deSer.deserializeValue(overflowHeaderPage);
-    return std::make_unique<PrimaryKeyIndexStorageInfo>(firstHeaderPage, overflowHeaderPage);
+    auto storageInfo =
+        std::make_unique<PrimaryKeyIndexStorageInfo>(firstHeaderPage, overflowHeaderPage);
+    if (!deSer.finished()) {
+        deSer.deserializeValue(storageInfo->bloomFilterPages.startPageIdx);
+        deSer.deserializeValue(storageInfo->bloomFilterPages.numPages);
+    }
+    return storageInfo;
 }
 
 std::unique_ptr<PrimaryKeyIndex> PrimaryKeyIndex::createNewIndex(IndexInfo indexInfo,
@@ -475,8 +609,10 @@ std::unique_ptr<PrimaryKeyIndex> PrimaryKeyIndex::createNewIndex(IndexInfo index
 PrimaryKeyIndex::PrimaryKeyIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
     bool inMemMode, MemoryManager& memoryManager, PageAllocator& pageAllocator,
     ShadowFile* shadowFile)
-    : Index{std::move(indexInfo), std::move(storageInfo)}, shadowFile{*shadowFile} {
+    : Index{std::move(indexInfo), std::move(storageInfo)}, shadowFile{*shadowFile},
+      inMemMode{inMemMode} {
     auto& hashIndexStorageInfo = this->storageInfo->cast<PrimaryKeyIndexStorageInfo>();
+    bloomFilterPagesForReadTrx = hashIndexStorageInfo.bloomFilterPages;
     if (hashIndexStorageInfo.firstHeaderPage == INVALID_PAGE_IDX) {
         KU_ASSERT(hashIndexStorageInfo.overflowHeaderPage == INVALID_PAGE_IDX);
         hashIndexHeadersForReadTrx.resize(NUM_HASH_INDEXES);
@@ -510,6 +646,57 @@ PrimaryKeyIndex::PrimaryKeyIndex(IndexInfo indexInfo, std::unique_ptr<IndexStora
             true /*bypassShadowing*/);
     }
     initOverflowAndSubIndices(inMemMode, memoryManager, pageAllocator, hashIndexStorageInfo);
+    readBloomFilters(pageAllocator);
+}
+
+void PrimaryKeyIndex::readBloomFilters(PageAllocator& pageAllocator) {
+    const auto& bloomFilterPages =
+        storageInfo->cast<PrimaryKeyIndexStorageInfo>().bloomFilterPages;
+    if (inMemMode || bloomFilterPages.startPageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    auto reader = std::make_unique<BufferedFileReader>(*pageAllocator.getDataFH()->getFileInfo());
+    reader->resetReadOffset(bloomFilterPages.startPageIdx * KUZU_PAGE_SIZE);
+    Deserializer deSer(std::move(reader));
+    for (auto& hashIndex : hashIndices) {
+        bool hasBloomFilter = false;
+        deSer.deserializeValue(hasBloomFilter);
+        if (hasBloomFilter) {
+            hashIndex->setBloomFilter(HashIndexBloomFilter::deserialize(deSer));
+        }
+    }
+}
+
+void PrimaryKeyIndex::checkpointBloomFilters(main::ClientContext* context,
+    PageAllocator& pageAllocator, bool indexChanged) {
+    const auto enabled = context->getDBConfig()->enablePKBloomFilter;
+    bool bloomFiltersChanged = false;
+    for (auto& hashIndex : hashIndices) {
+        bloomFiltersChanged = hashIndex->checkpointBloomFilter(enabled) || bloomFiltersChanged;
+    }
+    // The persisted filters must cover every key in the persisted index, so they are rewritten
+    // whenever the index changes.
+    if (inMemMode || !(bloomFiltersChanged || (enabled && indexChanged))) {
+        return;
+    }
+    auto& hashIndexStorageInfo = storageInfo->cast<PrimaryKeyIndexStorageInfo>();
+    if (hashIndexStorageInfo.bloomFilterPages.startPageIdx != INVALID_PAGE_IDX) {
+        pageAllocator.freePageRange(hashIndexStorageInfo.bloomFilterPages);
+        hashIndexStorageInfo.bloomFilterPages = PageRange();
+    }
+    if (!enabled) {
+        return;
+    }
+    auto writer = std::make_shared<InMemFileWriter>(*MemoryManager::Get(*context));
+    Serializer serializer(writer);
+    for (auto& hashIndex : hashIndices) {
+        const auto* bloomFilter = hashIndex->getBloomFilter();
+        serializer.write<bool>(bloomFilter != nullptr);
+        if (bloomFilter) {
+            bloomFilter->serialize(serializer);
+        }
+    }
+    hashIndexStorageInfo.bloomFilterPages = writer->flush(pageAllocator);
 }
 
 void PrimaryKeyIndex::initOverflowAndSubIndices(bool inMemMode, MemoryManager& mm,
@@ -557,6 +744,47 @@ bool PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector, uin
     return retVal;
 }
 
+void PrimaryKeyIndex::lookup(const Transaction* trx, const ValueVector& keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results, const visible_func& isVisible) {
+    KU_ASSERT(positions.size() == results.size());
+    KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
+    TypeUtils::visit(
+        indexInfo.keyDataTypes[0],
+        [&]<IndexHashable T>(T) {
+            using hash_index_t = HashIndex<HashIndexType<T>>;
+            std::vector<typename hash_index_t::Key> keys;
+            keys.reserve(positions.size());
+            std::array<std::vector<uint32_t>, NUM_HASH_INDEXES> idxsPerIndex;
+            for (auto i = 0u; i < positions.size(); i++) {
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    keys.push_back(keyVector.getValue<ku_string_t>(positions[i]).getAsStringView());
+                } else {
+                    keys.push_back(keyVector.getValue<T>(positions[i]));
+                }
+                idxsPerIndex[HashIndexUtils::getHashIndexPosition(keys.back())].push_back(i);
+            }
+            std::vector<typename hash_index_t::Key> indexKeys;
+            std::vector<offset_t> indexResults;
+            for (auto indexPos = 0u; indexPos < NUM_HASH_INDEXES; indexPos++) {
+                const auto& idxs = idxsPerIndex[indexPos];
+                if (idxs.empty()) {
+                    continue;
+                }
+                indexKeys.clear();
+                for (auto idx : idxs) {
+                    indexKeys.push_back(keys[idx]);
+                }
+                indexResults.resize(idxs.size());
+                getTypedHashIndexByPos<HashIndexType<T>>(indexPos)->lookupBatchInternal(trx,
+                    indexKeys, indexResults, isVisible);
+                for (auto i = 0u; i < idxs.size(); i++) {
+                    results[idxs[i]] = indexResults[i];
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 void PrimaryKeyIndex::commitInsert(Transaction* transaction, const ValueVector& nodeIDVector,
     const std::vector<ValueVector*>& indexVectors, Index::InsertState& insertState) {
     KU_ASSERT(indexVectors.size() == 1);
@@ -623,6 +851,7 @@ void PrimaryKeyIndex::checkpointInMemory() {
     if (overflowFile) {
         overflowFile->checkpointInMemory();
     }
+    bloomFilterPagesForReadTrx = storageInfo->cast<PrimaryKeyIndexStorageInfo>().bloomFilterPages;
 }
 
 void PrimaryKeyIndex::writeHeaders(PageAllocator& pageAllocator) const {
@@ -658,6 +887,8 @@ void PrimaryKeyIndex::rollbackCheckpoint() {
     if (overflowFile) {
         overflowFile->rollbackInMemory();
     }
+    // Filters in memory may hold keys which were not checkpointed, which is harmless
+    storageInfo->cast<PrimaryKeyIndexStorageInfo>().bloomFilterPages = bloomFilterPagesForReadTrx;
 }
 
 static void updateOverflowHeaderPageIfNeeded(IndexStorageInfo* storageInfo,
@@ -668,7 +899,8 @@ static void updateOverflowHeaderPageIfNeeded(IndexStorageInfo* storageInfo,
     }
 }
 
-void PrimaryKeyIndex::checkpoint(main::ClientContext*, storage::PageAllocator& pageAllocator) {
+void PrimaryKeyIndex::checkpoint(main::ClientContext* context,
+    storage::PageAllocator& pageAllocator) {
     bool indexChanged = false;
     for (auto i = 0u; i < NUM_HASH_INDEXES; i++) {
         if (hashIndices[i]->checkpoint(pageAllocator)) {
@@ -683,6 +915,7 @@ void PrimaryKeyIndex::checkpoint(main::ClientContext*, storage::PageAllocator& p
         overflowFile->checkpoint(pageAllocator);
         updateOverflowHeaderPageIfNeeded(storageInfo.get(), overflowFile.get());
     }
+    checkpointBloomFilters(context, pageAllocator, indexChanged);
     // Make sure that changes which bypassed the WAL are written.
     // There is no other mechanism for enforcing that they are flushed
     // and they will be dropped when the file handle is destroyed.
@@ -713,6 +946,11 @@ void PrimaryKeyIndex::reclaimStorage(PageAllocator& pageAllocator) const {
     if (overflowFile) {
         overflowFile->reclaimStorage(pageAllocator);
     }
+    const auto& bloomFilterPages =
+        storageInfo->cast<PrimaryKeyIndexStorageInfo>().bloomFilterPages;
+    if (bloomFilterPages.startPageIdx != INVALID_PAGE_IDX) {
+        pageAllocator.freePageRange(bloomFilterPages);
+    }
     const auto firstHeaderPage = getFirstHeaderPage();
     if (firstHeaderPage != INVALID_PAGE_IDX) {
         pageAllocator.freePageRange({getFirstHeaderPage(), NUM_HEADER_PAGES});
@@ -0,0 +1,41 @@
+#include "storage/index/hash_index_bloom_filter.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+HashIndexBloomFilter::HashIndexBloomFilter(uint64_t capacity)
+    : capacity{std::max(capacity, MIN_CAPACITY)} {
+    words.resize(std::bit_ceil((this->capacity * BITS_PER_KEY + 63) / 64));
+}
+
+void HashIndexBloomFilter::serialize(Serializer& serializer) const {
+    serializer.write<uint64_t>(capacity);
+    serializer.write<uint64_t>(words.size());
+    serializer.write(reinterpret_cast<const uint8_t*>(words.data()),
+        words.size() * sizeof(uint64_t));
+}
+
+std::unique_ptr<HashIndexBloomFilter> HashIndexBloomFilter::deserialize(
+    Deserializer& deserializer) {
+    uint64_t capacity = 0;
+    uint64_t numWords = 0;
+    deserializer.deserializeValue(capacity);
+    deserializer.deserializeValue(numWords);
+    KU_ASSERT(std::has_single_bit(numWords));
+    std::vector<uint64_t> words(numWords);
+    deserializer.read(reinterpret_cast<uint8_t*>(words.data()), numWords * sizeof(uint64_t));
+    return std::unique_ptr<HashIndexBloomFilter>(
+        new HashIndexBloomFilter(capacity, std::move(words)));
+}
+
+} // namespace storage
+} // namespace kuzu
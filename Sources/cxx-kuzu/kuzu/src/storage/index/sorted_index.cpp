@@ -0,0 +1,229 @@
+#include "storage/index/sorted_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/data_chunk/data_chunk.h"
+#include "common/string_format.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+std::string SortedIndexAuxInfo::toCypher(const catalog::IndexCatalogEntry& indexEntry,
+    const catalog::ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<catalog::IndexToCypherInfo>();
+    auto catalog = catalog::Catalog::Get(*indexToCypherInfo.context);
+    auto transaction = Transaction::Get(*indexToCypherInfo.context);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, indexEntry.getTableID());
+    auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
+    return stringFormat("CALL CREATE_SORTED_INDEX('{}', '{}', '{}');", tableEntry->getName(),
+        indexEntry.getIndexName(), propertyName);
+}
+
+static bool isNaN(const histogram_key_t& key) {
+    return std::holds_alternative<double>(key) && std::isnan(std::get<double>(key));
+}
+
+SortedIndex::SortedIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+    NodeTable& nodeTable)
+    : Index{std::move(indexInfo), std::move(storageInfo)}, nodeTable{nodeTable},
+      numStaleEntries{0} {}
+
+void SortedIndex::build(Transaction* transaction, MemoryManager* memoryManager) {
+    std::vector<entry_t> result;
+    scanColumn(transaction, memoryManager, result);
+    std::ranges::sort(result);
+    std::unique_lock lck{mtx};
+    entries = std::move(result);
+    pendingEntries.clear();
+    numStaleEntries = 0;
+}
+
+std::vector<offset_t> SortedIndex::lookup(const Transaction* transaction,
+    const std::optional<histogram_key_t>& lower, const std::optional<histogram_key_t>& upper) {
+    if ((lower.has_value() && isNaN(*lower)) || (upper.has_value() && isNaN(*upper))) {
+        return {};
+    }
+    if (lower.has_value() && upper.has_value() && *upper < *lower) {
+        return {};
+    }
+    std::vector<offset_t> result;
+    {
+        std::unique_lock lck{mtx};
+        auto begin = lower.has_value() ?
+                         std::ranges::lower_bound(entries, *lower, {}, &entry_t::first) :
+                         entries.begin();
+        auto end = upper.has_value() ?
+                       std::ranges::upper_bound(entries, *upper, {}, &entry_t::first) :
+                       entries.end();
+        for (auto it = begin; it < end; ++it) {
+            result.push_back(it->second);
+        }
+        auto pendingIt = lower.has_value() ? pendingEntries.lower_bound(entry_t{*lower, 0}) :
+                                             pendingEntries.begin();
+        for (; pendingIt != pendingEntries.end(); ++pendingIt) {
+            if (upper.has_value() && *upper < pendingIt->first) {
+                break;
+            }
+            result.push_back(pendingIt->second);
+        }
+    }
+    std::ranges::sort(result);
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    // Offsets of updated or deleted nodes may still be in the index, and nodes committed after the
+    // transaction started are not visible to it.
+    const auto endOffset =
+        StorageUtils::getStartOffsetOfNodeGroup(nodeTable.getNumCommittedNodeGroups());
+    std::erase_if(result, [&](offset_t offset) {
+        return offset >= endOffset || !nodeTable.isVisible(transaction, offset);
+    });
+    return result;
+}
+
+void SortedIndex::commitInsert(Transaction*, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, InsertState&) {
+    KU_ASSERT(indexVectors.size() == 1);
+    std::unique_lock lck{mtx};
+    nodeIDVector.state->getSelVector().forEach([&](auto pos) {
+        addEntry(*indexVectors[0], pos, nodeIDVector.getValue<nodeID_t>(pos).offset);
+    });
+    mergePendingEntriesIfNeeded();
+}
+
+void SortedIndex::update(Transaction* transaction, const ValueVector& nodeIDVector,
+    ValueVector& propertyVector, UpdateState&) {
+    KU_ASSERT(nodeIDVector.state->isFlat() && propertyVector.state->isFlat());
+    const auto nodeIDPos = nodeIDVector.state->getSelVector()[0];
+    if (nodeIDVector.isNull(nodeIDPos)) {
+        return;
+    }
+    const auto offset = nodeIDVector.getValue<nodeID_t>(nodeIDPos).offset;
+    // Uncommitted nodes are indexed with their final values when they are committed.
+    if (transaction->isUnCommitted(indexInfo.tableID, offset)) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    addEntry(propertyVector, propertyVector.state->getSelVector()[0], offset);
+    numStaleEntries++;
+    mergePendingEntriesIfNeeded();
+}
+
+void SortedIndex::delete_(Transaction* transaction, const ValueVector& nodeIDVector,
+    DeleteState&) {
+    std::unique_lock lck{mtx};
+    nodeIDVector.state->getSelVector().forEach([&](auto pos) {
+        if (!nodeIDVector.isNull(pos) &&
+            !transaction->isUnCommitted(indexInfo.tableID,
+                nodeIDVector.getValue<nodeID_t>(pos).offset)) {
+            numStaleEntries++;
+        }
+    });
+}
+
+void SortedIndex::checkpoint(main::ClientContext* context, PageAllocator&) {
+    {
+        std::unique_lock lck{mtx};
+        if (numStaleEntries * 4 <= entries.size() + pendingEntries.size()) {
+            mergePendingEntries();
+            return;
+        }
+    }
+    // Rebuilding drops the entries left behind by updates and deletions.
+    build(&DUMMY_CHECKPOINT_TRANSACTION, MemoryManager::Get(*context));
+}
+
+void SortedIndex::finalize(main::ClientContext* context) {
+    std::vector<entry_t> result;
+    scanColumn(Transaction::Get(*context), MemoryManager::Get(*context), result);
+    std::unique_lock lck{mtx};
+    result.insert(result.end(), entries.begin(), entries.end());
+    result.insert(result.end(), pendingEntries.begin(), pendingEntries.end());
+    std::ranges::sort(result);
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    entries = std::move(result);
+    pendingEntries.clear();
+}
+
+std::unique_ptr<Index> SortedIndex::load(main::ClientContext* context,
+    StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t>) {
+    // The index is built in memory, so the catalog entry has nothing to deserialize. It may not be
+    // in the catalog of the context when the table belongs to an attached database.
+    auto catalog = catalog::Catalog::Get(*context);
+    if (catalog->containsIndex(&DUMMY_CHECKPOINT_TRANSACTION, indexInfo.tableID, indexInfo.name)) {
+        auto indexEntry =
+            catalog->getIndex(&DUMMY_CHECKPOINT_TRANSACTION, indexInfo.tableID, indexInfo.name);
+        if (!indexEntry->isLoaded()) {
+            indexEntry->setAuxInfo(std::make_unique<SortedIndexAuxInfo>());
+        }
+    }
+    auto& nodeTable = storageManager->getTable(indexInfo.tableID)->cast<NodeTable>();
+    auto index = std::make_unique<SortedIndex>(std::move(indexInfo),
+        std::make_unique<IndexStorageInfo>(), nodeTable);
+    index->build(&DUMMY_CHECKPOINT_TRANSACTION, MemoryManager::Get(*context));
+    return index;
+}
+
+void SortedIndex::scanColumn(Transaction* transaction, MemoryManager* memoryManager,
+    std::vector<entry_t>& result) const {
+    const auto columnID = indexInfo.columnIDs[0];
+    auto state = std::make_shared<DataChunkState>();
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID(), memoryManager, state);
+    ValueVector keyVector(nodeTable.getColumn(columnID).getDataType().copy(), memoryManager,
+        state);
+    NodeTableScanState scanState{&nodeIDVector, {&keyVector}, state};
+    scanState.source = TableScanSource::COMMITTED;
+    scanState.setToTable(transaction, &nodeTable, {columnID}, {});
+    for (auto i = 0u; i < nodeTable.getNumCommittedNodeGroups(); i++) {
+        scanState.nodeGroupIdx = i;
+        nodeTable.initScanState(transaction, scanState);
+        while (nodeTable.scan(transaction, scanState)) {
+            scanState.outState->getSelVector().forEach([&](auto pos) {
+                auto key = ColumnHistogram::getKey(keyVector, pos);
+                if (key.has_value() && !isNaN(*key)) {
+                    result.emplace_back(std::move(*key),
+                        nodeIDVector.getValue<nodeID_t>(pos).offset);
+                }
+            });
+        }
+    }
+}
+
+void SortedIndex::addEntry(const ValueVector& keyVector, uint32_t pos, offset_t offset) {
+    auto key = ColumnHistogram::getKey(keyVector, pos);
+    if (key.has_value() && !isNaN(*key)) {
+        pendingEntries.emplace(std::move(*key), offset);
+    }
+}
+
+void SortedIndex::mergePendingEntries() {
+    if (pendingEntries.empty()) {
+        return;
+    }
+    std::vector<entry_t> merged;
+    merged.reserve(entries.size() + pendingEntries.size());
+    std::ranges::merge(entries, pendingEntries, std::back_inserter(merged));
+    merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+    entries = std::move(merged);
+    pendingEntries.clear();
+}
+
+void SortedIndex::mergePendingEntriesIfNeeded() {
+    if (pendingEntries.size() >=
+        std::max<uint64_t>(MIN_NUM_PENDING_ENTRIES_TO_MERGE, entries.size() / 8)) {
+        mergePendingEntries();
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -177,6 +177,16 @@ bool LocalRelTable::checkIfNodeHasRels(ValueVector* srcNodeIDVector,
     return (directedIndex.contains(nodeOffset) && !directedIndex.at(nodeOffset).empty());
 }
 
+row_idx_t LocalRelTable::getNumRels(offset_t nodeOffset, RelDataDirection direction) const {
+    std::shared_lock lock(mutex);
+    if (!directedIndices.contains(direction)) {
+        return 0;
+    }
+    const auto& directedIndex = directedIndices.at(direction).index;
+    const auto it = directedIndex.find(nodeOffset);
+    return it == directedIndex.end() ? 0 : it->second.size();
+}
+
 void LocalRelTable::initializeScan(TableScanState& state) {
     auto& relScanState = state.cast<RelTableScanState>();
     KU_ASSERT(relScanState.source == TableScanSource::UNCOMMITTED);
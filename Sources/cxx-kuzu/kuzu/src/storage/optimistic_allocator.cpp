@@ -15,7 +15,9 @@ PageRange OptimisticAllocator::allocatePageRange(common::page_idx_t numPages) {
 }
 
 void OptimisticAllocator::freePageRange(PageRange block) {
-    pageManager.freePageRange(block);
+    if (block.numPages > 0) {
+        pagesToFreeOnCommit.push_back(block);
+    }
 }
 
 void OptimisticAllocator::rollback() {
@@ -23,9 +25,14 @@ void OptimisticAllocator::rollback() {
         pageManager.freeImmediatelyRewritablePageRange(pageManager.getDataFH(), entry);
     }
     optimisticallyAllocatedPages.clear();
+    pagesToFreeOnCommit.clear();
 }
 
 void OptimisticAllocator::commit() {
+    for (const auto& entry : pagesToFreeOnCommit) {
+        pageManager.freePageRange(entry);
+    }
     optimisticallyAllocatedPages.clear();
+    pagesToFreeOnCommit.clear();
 }
 } // namespace kuzu::storage
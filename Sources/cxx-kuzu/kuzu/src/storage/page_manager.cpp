@@ -1,5 +1,7 @@
 #include "storage/page_manager.h"
 
+#include <algorithm>
+
 #include "common/uniq_lock.h"
 #include "storage/file_handle.h"
 #include "storage/storage_manager.h"
@@ -55,6 +57,23 @@ void PageManager::finalizeCheckpoint() {
     freeSpaceManager->finalizeCheckpoint(fileHandle);
 }
 
+common::page_idx_t PageManager::getNumFreePages() const {
+    common::page_idx_t numFreePages = 0;
+    for (const auto& entry : getFreeEntries(0, getNumFreeEntries())) {
+        numFreePages += entry.numPages;
+    }
+    return numFreePages;
+}
+
+std::vector<PageRange> PageManager::getSortedFreeEntries() {
+    common::UniqLock lck{mtx};
+    auto entries = freeSpaceManager->getEntries(0, freeSpaceManager->getNumEntries());
+    std::sort(entries.begin(), entries.end(), [](const PageRange& a, const PageRange& b) {
+        return a.startPageIdx < b.startPageIdx;
+    });
+    return entries;
+}
+
 void PageManager::clearEvictedBMEntriesIfNeeded(BufferManager* bufferManager) {
     freeSpaceManager->clearEvictedBufferManagerEntriesIfNeeded(bufferManager);
 }
@@ -1,5 +1,7 @@
 #include "storage/predicate/column_predicate.h"
 
+#include <algorithm>
+
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/scalar_function_expression.h"
 #include "storage/predicate/constant_predicate.h"
@@ -20,6 +22,33 @@ ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const MergedColumnChunkStats
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+bool ColumnPredicateSet::canEvaluateStrings() const {
+    return std::any_of(predicates.begin(), predicates.end(),
+        [](const auto& predicate) { return predicate->canEvaluateString(); });
+}
+
+bool ColumnPredicateSet::evaluateStrings(std::string_view value) const {
+    for (auto& predicate : predicates) {
+        if (predicate->canEvaluateString() && !predicate->evaluateString(value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnPredicateSet::canEvaluateIntegers(const LogicalType& type) const {
+    return std::any_of(predicates.begin(), predicates.end(),
+        [&](const auto& predicate) { return predicate->canEvaluateIntegers(type); });
+}
+
+void ColumnPredicateSet::narrowIntegerRange(const LogicalType& type, IntegerRange& range) const {
+    for (auto& predicate : predicates) {
+        if (predicate->canEvaluateIntegers(type)) {
+            predicate->narrowIntegerRange(range);
+        }
+    }
+}
+
 std::string ColumnPredicateSet::toString() const {
     if (predicates.empty()) {
         return {};
@@ -58,19 +87,42 @@ static bool columnMatchesExprChild(const Expression& column, const Expression& e
     return (expr.getNumChildren() > 0 && column == *expr.getChild(0));
 }
 
+// Statistics are kept in the type of the column, so a predicate on a casted column can only be
+// checked against them if the cast keeps the representation of values in StorageValue.
+static bool isStatsPreservingCast(const LogicalType& columnType, const LogicalType& castType) {
+    if (columnType.getLogicalTypeID() == castType.getLogicalTypeID()) {
+        return true;
+    }
+    auto isInt64Representable = [](LogicalTypeID typeID) {
+        return LogicalTypeUtils::isIntegral(typeID) && typeID != LogicalTypeID::INT128;
+    };
+    if (isInt64Representable(columnType.getLogicalTypeID()) &&
+        isInt64Representable(castType.getLogicalTypeID())) {
+        return LogicalTypeUtils::isUnsigned(columnType) == LogicalTypeUtils::isUnsigned(castType);
+    }
+    return LogicalTypeUtils::isFloatingPoint(columnType.getLogicalTypeID()) &&
+           LogicalTypeUtils::isFloatingPoint(castType.getLogicalTypeID());
+}
+
+static bool columnMatchesColumnRef(const Expression& column, const Expression& columnRef) {
+    if (column == columnRef) {
+        return true;
+    }
+    return columnMatchesExprChild(column, columnRef) &&
+           isStatsPreservingCast(column.getDataType(), columnRef.getDataType());
+}
+
 static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const Expression& column,
     const Expression& predicate) {
     if (isColumnRefConstantPair(*predicate.getChild(0), *predicate.getChild(1))) {
-        if (column != *predicate.getChild(0) &&
-            !columnMatchesExprChild(column, *predicate.getChild(0))) {
+        if (!columnMatchesColumnRef(column, *predicate.getChild(0))) {
             return nullptr;
         }
         auto value = predicate.getChild(1)->constCast<LiteralExpression>().getValue();
         return std::make_unique<ColumnConstantPredicate>(column.toString(),
             predicate.expressionType, value);
     } else if (isColumnRefConstantPair(*predicate.getChild(1), *predicate.getChild(0))) {
-        if (column != *predicate.getChild(1) &&
-            !columnMatchesExprChild(column, *predicate.getChild(1))) {
+        if (!columnMatchesColumnRef(column, *predicate.getChild(1))) {
             return nullptr;
         }
         auto value = predicate.getChild(0)->constCast<LiteralExpression>().getValue();
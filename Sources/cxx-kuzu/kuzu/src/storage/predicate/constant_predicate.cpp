@@ -65,15 +65,135 @@ ZoneMapCheckResult checkZoneMapSwitch(const MergedColumnChunkStats& mergedStats,
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+// Strings are only compared with the prefixes kept in vector zone maps, which can't tell apart
+// strings with the same prefix, so an inequality never skips.
+static ZoneMapCheckResult checkStringZoneMap(const MergedColumnChunkStats& mergedStats,
+    ExpressionType expressionType, const std::string& constant) {
+    if (!mergedStats.minStringPrefix.has_value() || !mergedStats.maxStringPrefix.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    const auto prefix = StringPrefix::get(constant);
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        if (prefix < *mergedStats.minStringPrefix || prefix > *mergedStats.maxStringPrefix) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        if (prefix > *mergedStats.maxStringPrefix) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS: {
+        if (prefix < *mergedStats.minStringPrefix) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    default:
+        break;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
 ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
     const MergedColumnChunkStats& stats) const {
     auto physicalType = value.getDataType().getPhysicalType();
+    if (canEvaluateString()) {
+        return checkStringZoneMap(stats, expressionType, value.strVal);
+    }
     return TypeUtils::visit(
         physicalType,
         [&]<StorageValueType T>(T) { return checkZoneMapSwitch<T>(stats, expressionType, value); },
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
+bool ColumnConstantPredicate::canEvaluateString() const {
+    return value.getDataType().getLogicalTypeID() == LogicalTypeID::STRING && !value.isNull() &&
+           ExpressionTypeUtil::isComparison(expressionType);
+}
+
+bool ColumnConstantPredicate::evaluateString(std::string_view val) const {
+    const auto& constant = value.strVal;
+    switch (expressionType) {
+    case ExpressionType::EQUALS:
+        return val == constant;
+    case ExpressionType::NOT_EQUALS:
+        return val != constant;
+    case ExpressionType::GREATER_THAN:
+        return val > constant;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return val >= constant;
+    case ExpressionType::LESS_THAN:
+        return val < constant;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return val <= constant;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool ColumnConstantPredicate::canEvaluateIntegers(const LogicalType& type) const {
+    // The constant has to have the type of the column, so that it compares with the stored values
+    // the same way as the column does.
+    if (value.isNull() || value.getDataType() != type) {
+        return false;
+    }
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+        break;
+    default:
+        return false;
+    }
+    switch (expressionType) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ColumnConstantPredicate::narrowIntegerRange(IntegerRange& range) const {
+    const auto constant = TypeUtils::visit(
+        value.getDataType().getPhysicalType(),
+        [&]<std::integral T>
+            requires(!std::same_as<T, bool>)
+        (T) { return int128_t(value.getValue<T>()); },
+        [](auto) -> int128_t { KU_UNREACHABLE; });
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        range.min = std::max(range.min, constant);
+        range.max = std::min(range.max, constant);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        range.min = std::max(range.min, constant + 1);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        range.min = std::max(range.min, constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        range.max = std::min(range.max, constant - 1);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        range.max = std::min(range.max, constant);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 std::string ColumnConstantPredicate::toString() {
     std::string valStr;
     if (value.getDataType().getPhysicalType() == PhysicalTypeID::STRING ||
@@ -0,0 +1,218 @@
+#include "storage/predicate/runtime_filter.h"
+
+#include "common/data_chunk/sel_vector.h"
+#include "common/type_utils.h"
+#include "common/vector/value_vector.h"
+#include "function/hash/hash_functions.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+JoinKeyFilter::JoinKeyFilter(PhysicalTypeID keyType)
+    : keyType{keyType}, blocks{std::make_unique<std::atomic<uint64_t>[]>(NUM_BLOCKS)}, numKeys{0},
+      useBloomFilter{false}, finalized{false} {}
+
+bool RuntimeFilter::isSupported(const LogicalType& keyType) {
+    const auto physicalType = keyType.getPhysicalType();
+    if (physicalType == PhysicalTypeID::BOOL) {
+        return false;
+    }
+    return TypeUtils::visit(physicalType, []<typename T>(T) { return StorageValueType<T>; });
+}
+
+uint64_t JoinKeyFilter::getBlockMask(hash_t hash) {
+    uint64_t mask = 0;
+    // The low bits of the hash pick the block.
+    hash >>= 14;
+    for (auto i = 0u; i < NUM_BITS_PER_KEY; i++) {
+        mask |= (uint64_t)1 << (hash & 63);
+        hash >>= 6;
+    }
+    return mask;
+}
+
+template<typename T>
+void JoinKeyFilter::insertInternal(const ValueVector& keyVector) {
+    auto& selVector = keyVector.state->getSelVector();
+    std::optional<T> min, max;
+    uint64_t numInserted = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (keyVector.isNull(pos)) {
+            continue;
+        }
+        const auto key = keyVector.getValue<T>(pos);
+        if (!min.has_value() || key < *min) {
+            min = key;
+        }
+        if (!max.has_value() || key > *max) {
+            max = key;
+        }
+        hash_t hash = 0;
+        function::Hash::operation<T>(key, hash);
+        blocks[getBlockIdx(hash)].fetch_or(getBlockMask(hash), std::memory_order_relaxed);
+        numInserted++;
+    }
+    if (numInserted == 0) {
+        return;
+    }
+    numKeys += numInserted;
+    std::unique_lock lck{mtx};
+    keyRange.update(StorageValue(*min), StorageValue(*max), keyType);
+}
+
+void JoinKeyFilter::insert(const ValueVector& keyVector) {
+    KU_ASSERT(!finalized && keyVector.dataType.getPhysicalType() == keyType);
+    TypeUtils::visit(
+        keyType, [&]<StorageValueType T>(T) { insertInternal<T>(keyVector); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+void JoinKeyFilter::finalize() {
+    useBloomFilter = numKeys <= MAX_NUM_KEYS_FOR_BLOOM_FILTER;
+    finalized = true;
+}
+
+ZoneMapCheckResult JoinKeyFilter::checkZoneMap(const MergedColumnChunkStats& stats) const {
+    if (!finalized) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    if (numKeys == 0 || stats.guaranteedAllNulls) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    // The stats are empty if the chunk is casted from a non-storage value type.
+    if (stats.stats.min.has_value() && stats.stats.max.has_value()) {
+        if (keyRange.min->gt(*stats.stats.max, keyType) ||
+            stats.stats.min->gt(*keyRange.max, keyType)) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+template<typename T>
+bool JoinKeyFilter::mayContain(T key) const {
+    if (key < keyRange.min->get<T>() || key > keyRange.max->get<T>()) {
+        return false;
+    }
+    if (!useBloomFilter) {
+        return true;
+    }
+    hash_t hash = 0;
+    function::Hash::operation<T>(key, hash);
+    const auto mask = getBlockMask(hash);
+    return (blocks[getBlockIdx(hash)].load(std::memory_order_relaxed) & mask) == mask;
+}
+
+template<typename T>
+void JoinKeyFilter::selectInternal(const ValueVector& keyVector, SelectionVector& selVector) const {
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (!keyVector.isNull(pos) && mayContain<T>(keyVector.getValue<T>(pos))) {
+            buffer[numSelected++] = pos;
+        }
+    }
+    if (numSelected != selVector.getSelSize()) {
+        selVector.setToFiltered(numSelected);
+    }
+}
+
+void JoinKeyFilter::select(const ValueVector& keyVector, SelectionVector& selVector) const {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    if (!finalized) {
+        return;
+    }
+    if (numKeys == 0) {
+        selVector.setToFiltered(0);
+        return;
+    }
+    TypeUtils::visit(
+        keyType, [&]<StorageValueType T>(T) { selectInternal<T>(keyVector, selVector); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+std::string JoinKeyFilter::toString(const std::string& columnName) const {
+    return stringFormat("{} IN JOIN KEYS", columnName);
+}
+
+void TopKFilter::update(const ValueVector& vector, sel_t pos) {
+    KU_ASSERT(vector.dataType.getPhysicalType() == keyType);
+    if (vector.isNull(pos)) {
+        return;
+    }
+    StorageValue value;
+    TypeUtils::visit(
+        keyType, [&]<StorageValueType T>(T) { value = StorageValue(vector.getValue<T>(pos)); },
+        [](auto) { KU_UNREACHABLE; });
+    std::unique_lock lck{mtx};
+    if (!hasThreshold || isBeyond(threshold, value)) {
+        threshold = value;
+        hasThreshold = true;
+    }
+}
+
+std::optional<StorageValue> TopKFilter::getThreshold() const {
+    if (!hasThreshold) {
+        return std::nullopt;
+    }
+    std::unique_lock lck{mtx};
+    return threshold;
+}
+
+ZoneMapCheckResult TopKFilter::checkZoneMap(const MergedColumnChunkStats& stats) const {
+    const auto currentThreshold = getThreshold();
+    if (!currentThreshold.has_value() || !stats.guaranteedNoNulls) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    // The first key of the chunk in the order.
+    const auto& first = isAscOrder ? stats.stats.min : stats.stats.max;
+    if (first.has_value() && isBeyond(*first, *currentThreshold)) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+template<typename T>
+void TopKFilter::selectInternal(const ValueVector& keyVector, SelectionVector& selVector,
+    T currentThreshold) const {
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (keyVector.isNull(pos)) {
+            buffer[numSelected++] = pos;
+            continue;
+        }
+        const auto key = keyVector.getValue<T>(pos);
+        if (isAscOrder ? !(key > currentThreshold) : !(key < currentThreshold)) {
+            buffer[numSelected++] = pos;
+        }
+    }
+    if (numSelected != selVector.getSelSize()) {
+        selVector.setToFiltered(numSelected);
+    }
+}
+
+void TopKFilter::select(const ValueVector& keyVector, SelectionVector& selVector) const {
+    KU_ASSERT(keyVector.dataType.getPhysicalType() == keyType);
+    const auto currentThreshold = getThreshold();
+    if (!currentThreshold.has_value()) {
+        return;
+    }
+    TypeUtils::visit(
+        keyType,
+        [&]<StorageValueType T>(
+            T) { selectInternal<T>(keyVector, selVector, currentThreshold->get<T>()); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+std::string TopKFilter::toString(const std::string& columnName) const {
+    return stringFormat("{} WITHIN TOP K", columnName);
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -40,7 +40,8 @@ ShadowFile::ShadowFile(BufferManager& bm, VirtualFileSystem* vfs, const std::str
 }
 
 void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         shadowPagesMap.at(originalFile).erase(originalPage);
         if (shadowPagesMap.at(originalFile).empty()) {
             shadowPagesMap.erase(originalFile);
@@ -49,7 +50,8 @@ void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPag
 }
 
 page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         return shadowPagesMap[originalFile][originalPage];
     }
     const auto shadowPageIdx = getOrCreateShadowingFH()->addNewPage();
@@ -59,7 +61,8 @@ page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t
 }
 
 page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
-    KU_ASSERT(hasShadowPage(originalFile, originalPage));
+    std::unique_lock lck{mtx};
+    KU_ASSERT(hasShadowPageNoLock(originalFile, originalPage));
     return shadowPagesMap.at(originalFile).at(originalPage);
 }
 
@@ -0,0 +1,217 @@
+#include "storage/stats/column_histogram.h"
+
+#include <algorithm>
+
+#include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+bool ColumnHistogram::isSupported(const LogicalType& dataType) {
+    switch (dataType.getPhysicalType()) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::optional<histogram_key_t> ColumnHistogram::getKey(const ValueVector& vector, uint32_t pos) {
+    if (vector.isNull(pos)) {
+        return std::nullopt;
+    }
+    switch (vector.dataType.getPhysicalType()) {
+    case PhysicalTypeID::BOOL:
+        return static_cast<double>(vector.getValue<bool>(pos));
+    case PhysicalTypeID::INT8:
+        return static_cast<double>(vector.getValue<int8_t>(pos));
+    case PhysicalTypeID::INT16:
+        return static_cast<double>(vector.getValue<int16_t>(pos));
+    case PhysicalTypeID::INT32:
+        return static_cast<double>(vector.getValue<int32_t>(pos));
+    case PhysicalTypeID::INT64:
+        return static_cast<double>(vector.getValue<int64_t>(pos));
+    case PhysicalTypeID::UINT8:
+        return static_cast<double>(vector.getValue<uint8_t>(pos));
+    case PhysicalTypeID::UINT16:
+        return static_cast<double>(vector.getValue<uint16_t>(pos));
+    case PhysicalTypeID::UINT32:
+        return static_cast<double>(vector.getValue<uint32_t>(pos));
+    case PhysicalTypeID::UINT64:
+        return static_cast<double>(vector.getValue<uint64_t>(pos));
+    case PhysicalTypeID::FLOAT:
+        return static_cast<double>(vector.getValue<float>(pos));
+    case PhysicalTypeID::DOUBLE:
+        return vector.getValue<double>(pos);
+    case PhysicalTypeID::STRING:
+        return vector.getValue<ku_string_t>(pos).getAsString();
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<histogram_key_t> ColumnHistogram::getKey(const Value& value) {
+    if (value.isNull()) {
+        return std::nullopt;
+    }
+    switch (value.getDataType().getPhysicalType()) {
+    case PhysicalTypeID::BOOL:
+        return static_cast<double>(value.getValue<bool>());
+    case PhysicalTypeID::INT8:
+        return static_cast<double>(value.getValue<int8_t>());
+    case PhysicalTypeID::INT16:
+        return static_cast<double>(value.getValue<int16_t>());
+    case PhysicalTypeID::INT32:
+        return static_cast<double>(value.getValue<int32_t>());
+    case PhysicalTypeID::INT64:
+        return static_cast<double>(value.getValue<int64_t>());
+    case PhysicalTypeID::UINT8:
+        return static_cast<double>(value.getValue<uint8_t>());
+    case PhysicalTypeID::UINT16:
+        return static_cast<double>(value.getValue<uint16_t>());
+    case PhysicalTypeID::UINT32:
+        return static_cast<double>(value.getValue<uint32_t>());
+    case PhysicalTypeID::UINT64:
+        return static_cast<double>(value.getValue<uint64_t>());
+    case PhysicalTypeID::FLOAT:
+        return static_cast<double>(value.getValue<float>());
+    case PhysicalTypeID::DOUBLE:
+        return value.getValue<double>();
+    case PhysicalTypeID::STRING:
+        return value.getValue<std::string>();
+    default:
+        return std::nullopt;
+    }
+}
+
+ColumnHistogram ColumnHistogram::build(std::vector<histogram_key_t> sample,
+    cardinality_t numSampledRows, cardinality_t numDistinctValues) {
+    ColumnHistogram histogram;
+    if (sample.empty() || numSampledRows == 0) {
+        return histogram;
+    }
+    std::sort(sample.begin(), sample.end());
+    std::vector<std::pair<size_t, uint64_t>> runs; // start position, length
+    for (auto i = 0u; i < sample.size(); i++) {
+        if (runs.empty() || sample[i] != sample[runs.back().first]) {
+            runs.emplace_back(i, 0);
+        }
+        runs.back().second++;
+    }
+    // As in most systems, a value is only treated as common if it is sampled more than once and
+    // noticeably more often than the average value.
+    const auto avgRunLength = static_cast<double>(sample.size()) / runs.size();
+    std::vector<std::pair<size_t, uint64_t>> commonRuns;
+    for (auto& run : runs) {
+        if (run.second > 1 && run.second > 1.25 * avgRunLength) {
+            commonRuns.push_back(run);
+        }
+    }
+    std::sort(commonRuns.begin(), commonRuns.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; });
+    if (commonRuns.size() > MAX_NUM_MOST_COMMON_VALUES) {
+        commonRuns.resize(MAX_NUM_MOST_COMMON_VALUES);
+    }
+    std::sort(commonRuns.begin(), commonRuns.end());
+    std::vector<histogram_key_t> otherValues;
+    otherValues.reserve(sample.size());
+    auto commonIdx = 0u;
+    for (auto& run : runs) {
+        if (commonIdx < commonRuns.size() && commonRuns[commonIdx].first == run.first) {
+            histogram.mostCommonValues.emplace_back(sample[run.first],
+                static_cast<double>(run.second) / numSampledRows);
+            commonIdx++;
+            continue;
+        }
+        for (auto i = 0u; i < run.second; i++) {
+            otherValues.push_back(std::move(sample[run.first + i]));
+        }
+    }
+    histogram.histogramFraction = static_cast<double>(otherValues.size()) / numSampledRows;
+    // Values missed by the sample are accounted for by the distinct count of the whole column.
+    const auto numSampledOtherDistinct = runs.size() - histogram.mostCommonValues.size();
+    const auto numOtherDistinct =
+        numDistinctValues > histogram.mostCommonValues.size() ?
+            numDistinctValues - histogram.mostCommonValues.size() :
+            0;
+    histogram.numHistogramDistinctValues =
+        std::max<cardinality_t>(numSampledOtherDistinct, numOtherDistinct);
+    if (!otherValues.empty()) {
+        const auto numBuckets = std::min<uint64_t>(NUM_BUCKETS, otherValues.size());
+        for (auto i = 0u; i <= numBuckets; i++) {
+            auto pos = std::min<uint64_t>(i * otherValues.size() / numBuckets,
+                otherValues.size() - 1);
+            histogram.bucketBounds.push_back(otherValues[pos]);
+        }
+    }
+    return histogram;
+}
+
+double ColumnHistogram::getEqualSelectivity(const histogram_key_t& key) const {
+    auto it = std::lower_bound(mostCommonValues.begin(), mostCommonValues.end(), key,
+        [](const auto& entry, const auto& k) { return entry.first < k; });
+    if (it != mostCommonValues.end() && it->first == key) {
+        return it->second;
+    }
+    if (bucketBounds.empty() || key < bucketBounds.front() || bucketBounds.back() < key) {
+        return 0;
+    }
+    return histogramFraction / std::max<cardinality_t>(numHistogramDistinctValues, 1);
+}
+
+double ColumnHistogram::getHistogramFractionBelow(const histogram_key_t& key) const {
+    if (bucketBounds.empty() || !(bucketBounds.front() < key)) {
+        return 0;
+    }
+    if (!(key < bucketBounds.back())) {
+        return 1;
+    }
+    // bucketBounds[bucketIdx] < key <= bucketBounds[bucketIdx + 1].
+    const auto bucketIdx =
+        std::lower_bound(bucketBounds.begin(), bucketBounds.end(), key) - bucketBounds.begin() - 1;
+    const auto& lower = bucketBounds[bucketIdx];
+    const auto& upper = bucketBounds[bucketIdx + 1];
+    auto fractionInBucket = 0.5;
+    if (std::holds_alternative<double>(key)) {
+        auto width = std::get<double>(upper) - std::get<double>(lower);
+        if (width > 0) {
+            fractionInBucket = (std::get<double>(key) - std::get<double>(lower)) / width;
+        }
+    }
+    return (bucketIdx + fractionInBucket) / (bucketBounds.size() - 1);
+}
+
+double ColumnHistogram::getRangeSelectivity(const std::optional<histogram_key_t>& lower,
+    bool lowerInclusive, const std::optional<histogram_key_t>& upper, bool upperInclusive) const {
+    auto selectivity = 0.0;
+    for (auto& [value, frequency] : mostCommonValues) {
+        auto aboveLower = !lower || (lowerInclusive ? !(value < *lower) : *lower < value);
+        auto belowUpper = !upper || (upperInclusive ? !(*upper < value) : value < *upper);
+        if (aboveLower && belowUpper) {
+            selectivity += frequency;
+        }
+    }
+    auto fractionBelowLower = lower ? getHistogramFractionBelow(*lower) : 0.0;
+    auto fractionBelowUpper = upper ? getHistogramFractionBelow(*upper) : 1.0;
+    if (fractionBelowUpper > fractionBelowLower) {
+        selectivity += histogramFraction * (fractionBelowUpper - fractionBelowLower);
+    }
+    return std::min(selectivity, 1.0);
+}
+
+} // namespace storage
+} // namespace kuzu
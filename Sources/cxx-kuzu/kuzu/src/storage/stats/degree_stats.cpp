@@ -0,0 +1,31 @@
+#include "storage/stats/degree_stats.h"
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace storage {
+
+void DegreeStats::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("avg_degree");
+    serializer.write(avgDegree);
+    serializer.writeDebuggingInfo("max_degree");
+    serializer.write(maxDegree);
+    serializer.writeDebuggingInfo("skew");
+    serializer.write(skew);
+}
+
+DegreeStats DegreeStats::deserialize(common::Deserializer& deserializer) {
+    std::string info;
+    DegreeStats result;
+    deserializer.validateDebuggingInfo(info, "avg_degree");
+    deserializer.deserializeValue<double>(result.avgDegree);
+    deserializer.validateDebuggingInfo(info, "max_degree");
+    deserializer.deserializeValue<common::cardinality_t>(result.maxDegree);
+    deserializer.validateDebuggingInfo(info, "skew");
+    deserializer.deserializeValue<double>(result.skew);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
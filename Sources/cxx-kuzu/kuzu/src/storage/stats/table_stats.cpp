@@ -12,7 +12,9 @@ TableStats::TableStats(std::span<const common::LogicalType> dataTypes) : cardina
     }
 }
 
-TableStats::TableStats(const TableStats& other) : cardinality{other.cardinality} {
+TableStats::TableStats(const TableStats& other)
+    : cardinality{other.cardinality}, numChangesSinceRefresh{other.numChangesSinceRefresh},
+      lastRefreshTime{other.lastRefreshTime} {
     columnStats.reserve(other.columnStats.size());
     for (auto i = 0u; i < other.columnStats.size(); ++i) {
         columnStats.emplace_back(other.columnStats[i].copy());
@@ -44,11 +46,35 @@ void TableStats::update(const std::vector<common::column_id_t>& columnIDs,
     incrementCardinality(numValues);
 }
 
+void TableStats::refresh(TableStats refreshed, const TableStats& statsAtScanStart,
+    int64_t refreshTime) {
+    const auto numRowsChangedDuringScan = cardinality >= statsAtScanStart.cardinality ?
+                                              cardinality - statsAtScanStart.cardinality :
+                                              statsAtScanStart.cardinality - cardinality;
+    const auto numChangesDuringScan =
+        numChangesSinceRefresh - std::min(numChangesSinceRefresh,
+                                     statsAtScanStart.numChangesSinceRefresh);
+    cardinality = refreshed.cardinality + cardinality >= statsAtScanStart.cardinality ?
+                      refreshed.cardinality + cardinality - statsAtScanStart.cardinality :
+                      0;
+    // Columns added during the scan keep their stats.
+    KU_ASSERT(refreshed.columnStats.size() <= columnStats.size());
+    for (auto i = 0u; i < refreshed.columnStats.size(); i++) {
+        columnStats[i] = std::move(refreshed.columnStats[i]);
+    }
+    numChangesSinceRefresh = numChangesDuringScan + numRowsChangedDuringScan;
+    lastRefreshTime = refreshTime;
+}
+
 void TableStats::serialize(common::Serializer& serializer) const {
     serializer.writeDebuggingInfo("cardinality");
     serializer.write(cardinality);
     serializer.writeDebuggingInfo("column_stats");
     serializer.serializeVector(columnStats);
+    serializer.writeDebuggingInfo("num_changes_since_refresh");
+    serializer.write(numChangesSinceRefresh);
+    serializer.writeDebuggingInfo("last_refresh_time");
+    serializer.write(lastRefreshTime);
 }
 
 TableStats TableStats::deserialize(common::Deserializer& deserializer) {
@@ -57,6 +83,10 @@ TableStats TableStats::deserialize(common::Deserializer& deserializer) {
     deserializer.deserializeValue<common::cardinality_t>(cardinality);
     deserializer.validateDebuggingInfo(info, "column_stats");
     deserializer.deserializeVector(columnStats);
+    deserializer.validateDebuggingInfo(info, "num_changes_since_refresh");
+    deserializer.deserializeValue<common::row_idx_t>(numChangesSinceRefresh);
+    deserializer.validateDebuggingInfo(info, "last_refresh_time");
+    deserializer.deserializeValue<int64_t>(lastRefreshTime);
     return *this;
 }
 
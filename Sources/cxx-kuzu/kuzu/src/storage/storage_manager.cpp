@@ -2,6 +2,7 @@
 
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/transaction_manager.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
 #include "common/serializer/in_mem_file_writer.h"
@@ -12,10 +13,14 @@
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/checkpointer.h"
+#include "storage/index/aggregate_view.h"
+#include "storage/index/sorted_index.h"
+#include "storage/storage_utils.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
 #include "storage/wal/wal_replayer.h"
 #include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
@@ -33,6 +38,8 @@ StorageManager::StorageManager(const std::string& databasePath, bool readOnly, b
         std::make_unique<ShadowFile>(*memoryManager.getBufferManager(), vfs, this->databasePath);
     inMemory = main::DBConfig::isDBPathInMemory(databasePath);
     registerIndexType(PrimaryKeyIndex::getIndexType());
+    registerIndexType(SortedIndex::getIndexType());
+    registerIndexType(AggregateView::getIndexType());
 }
 
 StorageManager::~StorageManager() = default;
@@ -45,6 +52,15 @@ void StorageManager::initDataFileHandle(VirtualFileSystem* vfs, main::ClientCont
         auto flag = readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
                                FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS;
         flag |= FileHandle::O_LOCKED_PERSISTENT_FILE;
+        // A read-only database without a WAL or shadow file is fully checkpointed, so nothing is
+        // ever written to its data file, which can then be read straight from a memory mapping.
+        if (readOnly &&
+            !vfs->fileOrPathExists(StorageUtils::getWALFilePath(databasePath), context) &&
+            !vfs->fileOrPathExists(StorageUtils::getShadowFilePath(databasePath), context)) {
+            flag |= FileHandle::mapReadOnlyMask;
+        } else if (context->getDBConfig()->directIO) {
+            flag |= FileHandle::directIOMask;
+        }
         dataFH = memoryManager.getBufferManager()->getFileHandle(databasePath, flag, vfs, context);
         if (dataFH->getNumPages() == 0) {
             if (!readOnly) {
@@ -73,7 +89,23 @@ Table* StorageManager::getTable(table_id_t tableID) {
 void StorageManager::recover(main::ClientContext& clientContext, bool throwOnWalReplayFailure,
     bool enableChecksums) {
     const auto walReplayer = std::make_unique<WALReplayer>(clientContext);
-    walReplayer->replay(throwOnWalReplayFailure, enableChecksums);
+    const auto replayedWALSize = walReplayer->replay(throwOnWalReplayFailure, enableChecksums);
+    Get(clientContext)->shippedWALReplayedOffset = replayedWALSize;
+}
+
+void StorageManager::replayShippedWAL(main::ClientContext& context,
+    const std::string& shippedWALPath) {
+    if (!readOnly) {
+        throw RuntimeException(
+            "A shipped WAL can only be replayed by a database opened in read-only mode.");
+    }
+    std::unique_lock lck{shippedWALMtx};
+    // The commits are replayed by their own recovery transactions, while the queries of the
+    // other connections keep reading the snapshots they started from.
+    main::ClientContext replayContext(context.getDatabase());
+    WALReplayer(replayContext)
+        .replayShippedWAL(shippedWALPath, shippedWALReplayedOffset,
+            context.getDBConfig()->enableChecksums);
 }
 
 void StorageManager::createNodeTable(NodeTableCatalogEntry* entry) {
@@ -155,6 +187,47 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
     }
 }
 
+void StorageManager::runIndexMaintenance(main::ClientContext& context) {
+    std::vector<Index*> indexesToMaintain;
+    {
+        std::lock_guard lck{mtx};
+        for (auto& [_, table] : tables) {
+            if (table->getTableType() != TableType::NODE) {
+                continue;
+            }
+            for (auto& indexHolder : table->cast<NodeTable>().getIndexes()) {
+                if (indexHolder.isLoaded() && indexHolder.getIndex()->needsMaintenance()) {
+                    indexesToMaintain.push_back(indexHolder.getIndex());
+                }
+            }
+        }
+    }
+    if (indexesToMaintain.empty()) {
+        return;
+    }
+    auto transactionContext = TransactionContext::Get(context);
+    try {
+        transactionContext->beginAutoTransaction(false /* readOnlyStatement */);
+    } catch (TransactionManagerException&) {
+        return;
+    }
+    try {
+        for (const auto index : indexesToMaintain) {
+            index->runMaintenance(&context);
+        }
+        transactionContext->commit();
+    } catch (...) {
+        transactionContext->rollback();
+        for (const auto index : indexesToMaintain) {
+            index->rollbackMaintenance();
+        }
+        throw;
+    }
+    for (const auto index : indexesToMaintain) {
+        index->commitMaintenance();
+    }
+}
+
 bool StorageManager::checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
     bool hasChanges = false;
     const auto catalog = Catalog::Get(*context);
@@ -265,7 +265,8 @@ void InMemChunkedNodeGroup::write(const InMemChunkedNodeGroup& data, column_id_t
 }
 
 static ZoneMapCheckResult getZoneMapResult(const TableScanState& scanState,
-    const std::vector<std::unique_ptr<ColumnChunk>>& chunks) {
+    const std::vector<std::unique_ptr<ColumnChunk>>& chunks, offset_t rowIdxInGroup,
+    length_t numRowsToScan) {
     if (!scanState.columnPredicateSets.empty()) {
         for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
             const auto columnID = scanState.columnIDs[i];
@@ -284,17 +285,53 @@ static ZoneMapCheckResult getZoneMapResult(const TableScanState& scanState,
             if (columnZoneMapResult == ZoneMapCheckResult::SKIP_SCAN) {
                 return ZoneMapCheckResult::SKIP_SCAN;
             }
+            // Zone maps of the vectors being scanned are narrower than the one of the chunk.
+            if (!scanState.columnPredicateSets[i].isEmpty()) {
+                const auto vectorStats =
+                    chunks[columnID]->getMergedVectorStats(rowIdxInGroup, numRowsToScan);
+                if (vectorStats.has_value() &&
+                    scanState.columnPredicateSets[i].checkZoneMap(*vectorStats) ==
+                        ZoneMapCheckResult::SKIP_SCAN) {
+                    return ZoneMapCheckResult::SKIP_SCAN;
+                }
+            }
         }
     }
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+// Filters the rows to scan by the predicates which the columns can evaluate on their encoded data
+// (e.g. string comparisons on dictionary entries), before any column is scanned.
+static void selectByColumnPredicates(const TableScanState& scanState,
+    const NodeGroupScanState& nodeGroupScanState,
+    const std::vector<std::unique_ptr<ColumnChunk>>& chunks, offset_t rowIdxInGroup,
+    length_t numRowsToScan, SelectionVector& selVector) {
+    for (auto i = 0u; i < scanState.columnPredicateSets.size(); i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID ||
+            scanState.columnPredicateSets[i].isEmpty()) {
+            continue;
+        }
+        chunks[columnID]->select(nodeGroupScanState.chunkStates[i],
+            scanState.columnPredicateSets[i], selVector, rowIdxInGroup, numRowsToScan);
+        if (selVector.getSelSize() == 0) {
+            return;
+        }
+    }
+}
+
+bool ChunkedNodeGroup::canSkipScan(const TableScanState& scanState, offset_t rowIdxInGroup,
+    length_t numRowsToScan) const {
+    return getZoneMapResult(scanState, chunks, rowIdxInGroup, numRowsToScan) ==
+           ZoneMapCheckResult::SKIP_SCAN;
+}
+
 void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState& scanState,
     const NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
     length_t numRowsToScan) const {
     KU_ASSERT(rowIdxInGroup + numRowsToScan <= numRows);
     auto& anchorSelVector = scanState.outState->getSelVectorUnsafe();
-    if (getZoneMapResult(scanState, chunks) == ZoneMapCheckResult::SKIP_SCAN) {
+    if (canSkipScan(scanState, rowIdxInGroup, numRowsToScan)) {
         anchorSelVector.setToFiltered(0);
         return;
     }
@@ -305,6 +342,10 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
     } else {
         anchorSelVector.setToUnfiltered(numRowsToScan);
     }
+    if (anchorSelVector.getSelSize() > 0) {
+        selectByColumnPredicates(scanState, nodeGroupScanState, chunks, rowIdxInGroup,
+            numRowsToScan, anchorSelVector);
+    }
 
     if (anchorSelVector.getSelSize() > 0) {
         for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
@@ -604,6 +645,14 @@ InMemChunkedNodeGroup::InMemChunkedNodeGroup(std::vector<std::unique_ptr<ColumnC
     }
 }
 
+uint64_t InMemChunkedNodeGroup::getEstimatedMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (const auto& chunk : chunks) {
+        memoryUsage += chunk->getEstimatedMemoryUsage();
+    }
+    return memoryUsage;
+}
+
 void InMemChunkedNodeGroup::setUnused(const MemoryManager& mm) {
     dataInUse = false;
     mm.getBufferManager()->getSpillerOrSkip([&](auto& spiller) { spiller.addUnusedChunk(this); });
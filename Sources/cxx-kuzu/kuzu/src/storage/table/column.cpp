@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 #include "common/assert.h"
 #include "common/data_chunk/sel_vector.h"
 #include "common/null_mask.h"
 #include "common/system_config.h"
+#include "common/type_utils.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -15,6 +17,7 @@
 #include "storage/file_handle.h"
 #include "storage/page_allocator.h"
 #include "storage/page_manager.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk.h"
 #include "storage/table/column_chunk_data.h"
@@ -144,6 +147,20 @@ void Column::populateExtraChunkState(SegmentState& state) const {
     }
 }
 
+void Column::prefetch(const SegmentState& state) const {
+    if (state.metadata.getNumPages() > 0) {
+        dataFH->prefetchPages(state.metadata.pageRange);
+    }
+    if (state.nullState && state.nullState->column) {
+        state.nullState->column->prefetch(*state.nullState);
+    }
+    for (auto& childState : state.childrenStates) {
+        if (childState.column) {
+            childState.column->prefetch(childState);
+        }
+    }
+}
+
 std::unique_ptr<ColumnChunkData> Column::flushChunkData(const ColumnChunkData& chunkData,
     PageAllocator& pageAllocator) {
     switch (chunkData.getDataType().getPhysicalType()) {
@@ -183,7 +200,9 @@ ColumnChunkMetadata Column::flushData(const ColumnChunkData& chunkData,
     KU_ASSERT(chunkData.sanityCheck());
     const auto preScanMetadata = chunkData.getMetadataToFlush();
     auto allocatedBlock = pageAllocator.allocatePageRange(preScanMetadata.getNumPages());
-    return chunkData.flushBuffer(pageAllocator, allocatedBlock, preScanMetadata);
+    auto metadata = chunkData.flushBuffer(pageAllocator, allocatedBlock, preScanMetadata);
+    metadata.vectorZoneMaps = chunkData.computeVectorZoneMaps();
+    return metadata;
 }
 
 void Column::scan(const ChunkState& state, offset_t startOffsetInChunk, offset_t length,
@@ -290,6 +309,80 @@ void Column::scanSegment(const SegmentState& state, offset_t startOffsetInSegmen
         readToPageFunc);
 }
 
+// Evaluates the range on the values of a segment in their compressed domain. A constant segment
+// is selected or not as a whole, and so is a bitpacked one if its min and max tell. Otherwise the
+// range is translated into the frame of reference of the bitpacked values, which are compared
+// without being decompressed. The values of segments compressed otherwise are kept and left to
+// the filter.
+template<typename T>
+static void selectIntegersInSegment(ColumnReadWriter& columnReadWriter, const SegmentState& state,
+    offset_t offsetInSegment, length_t length, IntegerRange range, uint8_t* isSelected) {
+    const auto& compMeta = state.metadata.compMeta;
+    switch (compMeta.compression) {
+    case CompressionType::CONSTANT: {
+        std::fill_n(isSelected, length, range.contains(compMeta.min.get<T>()));
+    } break;
+    case CompressionType::INTEGER_BITPACKING: {
+        const auto min = int128_t(compMeta.min.get<T>());
+        const auto max = int128_t(compMeta.max.get<T>());
+        range.min = std::max(range.min, min);
+        range.max = std::min(range.max, max);
+        if (range.isEmpty() || (range.min == min && range.max == max)) {
+            std::fill_n(isSelected, length, !range.isEmpty());
+            break;
+        }
+        const auto info = IntegerBitpacking<T>::getPackingInfo(compMeta);
+        const auto packedMin = Int128_t::Cast<T>(range.min - int128_t(info.offset));
+        const auto packedMax = Int128_t::Cast<T>(range.max - int128_t(info.offset));
+        columnReadWriter.readCompressedValuesToPage(state, isSelected, 0 /* startOffsetInResult */,
+            offsetInSegment, length,
+            [&](uint8_t* frame, PageCursor& pageCursor, uint8_t* result, uint32_t offsetInResult,
+                uint64_t numValues, const CompressionMetadata&) {
+                IntegerBitpacking<T>().selectFromPage(frame, pageCursor.elemPosInPage, result,
+                    offsetInResult, numValues, info, packedMin, packedMax);
+            });
+    } break;
+    default: {
+        std::fill_n(isSelected, length, true);
+    }
+    }
+}
+
+void Column::select(const ChunkState& state, offset_t offsetInChunk, length_t length,
+    const ColumnPredicateSet& predicates, SelectionVector& selVector) const {
+    if (!predicates.canEvaluateIntegers(dataType)) {
+        return;
+    }
+    KU_ASSERT(length <= DEFAULT_VECTOR_CAPACITY);
+    std::vector<uint8_t> isSelected(length, false);
+    TypeUtils::visit(
+        dataType.getPhysicalType(),
+        [&]<std::integral T>
+            requires(!std::same_as<T, bool>)
+        (T) {
+            IntegerRange range{std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+            predicates.narrowIntegerRange(dataType, range);
+            if (range.isEmpty()) {
+                return;
+            }
+            state.rangeSegments(offsetInChunk, length,
+                [&](auto& segmentState, auto offsetInSegment, auto lengthInSegment,
+                    auto dstOffset) {
+                    selectIntegersInSegment<T>(*columnReadWriter, segmentState, offsetInSegment,
+                        lengthInSegment, range, isSelected.data() + dstOffset);
+                });
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += isSelected[pos];
+    }
+    selVector.setToFiltered(numSelected);
+}
+
 void Column::lookupValue(const ChunkState& state, offset_t nodeOffset, ValueVector* resultVector,
     uint32_t posInVector) const {
     auto [segmentState, offsetInSegment] = state.findSegment(nodeOffset);
@@ -325,8 +418,10 @@ void Column::lookupInternal(const SegmentState& state, offset_t offsetInSegment,
            metadata.getNumDataPages(dataType.getPhysicalType());
 }
 
-void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t maxIndex,
-    const std::optional<StorageValue>& min, const std::optional<StorageValue>& max) const {
+void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t startIndex,
+    offset_t maxIndex, const std::optional<StorageValue>& min,
+    const std::optional<StorageValue>& max) const {
+    metadata.invalidateVectorZoneMaps(startIndex, maxIndex);
     if (maxIndex >= metadata.numValues) {
         metadata.numValues = maxIndex + 1;
         KU_ASSERT(sanityCheckForWrites(metadata, dataType));
@@ -363,8 +458,8 @@ void Column::writeSegment(ColumnChunkData& persistentChunk, SegmentState& state,
         dataType.getPhysicalType() != common::PhysicalTypeID::ALP_EXCEPTION_FLOAT) {
         auto [minWritten, maxWritten] =
             getMinMaxStorageValue(data, srcOffset, numValues, dataType.getPhysicalType());
-        updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment + numValues - 1,
-            minWritten, maxWritten);
+        updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment,
+            dstOffsetInSegment + numValues - 1, minWritten, maxWritten);
     }
 }
 
@@ -395,7 +490,7 @@ offset_t Column::appendValues(ColumnChunkData& persistentChunk, SegmentState& st
 
     auto [minWritten, maxWritten] = getMinMaxStorageValue(data, 0 /*offset*/, numValues,
         dataType.getPhysicalType(), nullChunkData);
-    updateStatistics(metadata, startOffset + numValues - 1, minWritten, maxWritten);
+    updateStatistics(metadata, startOffset, startOffset + numValues - 1, minWritten, maxWritten);
     return startOffset;
 }
 
@@ -86,6 +86,14 @@ void ColumnChunk::scan(const Transaction* transaction, const ChunkState& state,
     updateInfo.scan(transaction, output, offsetInChunk, length);
 }
 
+void ColumnChunk::select(const ChunkState& state, const ColumnPredicateSet& predicates,
+    SelectionVector& selVector, offset_t offsetInChunk, length_t length) const {
+    if (getResidencyState() != ResidencyState::ON_DISK || hasUpdates()) {
+        return;
+    }
+    state.column->select(state, offsetInChunk, length, predicates, selVector);
+}
+
 template<ResidencyState SCAN_RESIDENCY_STATE>
 void ColumnChunk::scanCommitted(const Transaction* transaction, ChunkState& chunkState,
     ColumnChunkData& output, row_idx_t startRow, row_idx_t numRows) const {
@@ -108,9 +116,9 @@ void ColumnChunk::scanCommitted(const Transaction* transaction, ChunkState& chun
         if (SCAN_RESIDENCY_STATE == residencyState) {
             rangeSegments(startRow, numRows,
                 [&](auto& segment, auto offsetInSegment, auto lengthInSegment, auto dstOffset) {
-                    output.append(segment.get(), startRow, lengthInSegment);
+                    output.append(segment.get(), offsetInSegment, lengthInSegment);
                     updateInfo.scanCommitted(transaction, output, numValuesBeforeScan + dstOffset,
-                        offsetInSegment, lengthInSegment);
+                        startRow + dstOffset, lengthInSegment);
                 });
         }
     } break;
@@ -174,6 +182,33 @@ MergedColumnChunkStats ColumnChunk::getMergedColumnChunkStats() const {
     return baseStats;
 }
 
+std::optional<MergedColumnChunkStats> ColumnChunk::getMergedVectorStats(offset_t startRow,
+    length_t numRows) const {
+    KU_ASSERT(!updateInfo.isSet());
+    std::optional<MergedColumnChunkStats> result;
+    const auto endRow = startRow + numRows;
+    offset_t segmentStartRow = 0;
+    for (auto& segment : data) {
+        const auto segmentEndRow = segmentStartRow + segment->getNumValues();
+        if (segmentStartRow < endRow && startRow < segmentEndRow) {
+            const auto startInSegment = std::max(startRow, segmentStartRow) - segmentStartRow;
+            const auto endInSegment = std::min(endRow, segmentEndRow) - segmentStartRow;
+            auto segmentStats =
+                segment->getMergedVectorStats(startInSegment, endInSegment - startInSegment);
+            if (!segmentStats.has_value()) {
+                return std::nullopt;
+            }
+            if (result.has_value()) {
+                result->merge(*segmentStats, segment->getDataType().getPhysicalType());
+            } else {
+                result = std::move(segmentStats);
+            }
+        }
+        segmentStartRow = segmentEndRow;
+    }
+    return result;
+}
+
 void ColumnChunk::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("enable_compression");
     serializer.write<bool>(enableCompression);
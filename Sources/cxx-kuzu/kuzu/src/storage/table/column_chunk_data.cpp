@@ -221,6 +221,36 @@ MergedColumnChunkStats ColumnChunkData::getMergedColumnChunkStats() const {
         nullData && nullData->haveAllNullsGuaranteed()};
 }
 
+std::optional<MergedColumnChunkStats> ColumnChunkData::getMergedVectorStats(offset_t startRow,
+    length_t numRows) const {
+    KU_ASSERT(numRows > 0);
+    if (residencyState != ResidencyState::ON_DISK || metadata.vectorZoneMaps.empty()) {
+        return std::nullopt;
+    }
+    const auto physicalType = getDataType().getPhysicalType();
+    auto result = MergedColumnChunkStats{ColumnChunkStats{}, true, true};
+    const auto endVectorIdx = (startRow + numRows - 1) / DEFAULT_VECTOR_CAPACITY;
+    for (auto i = startRow / DEFAULT_VECTOR_CAPACITY; i <= endVectorIdx; i++) {
+        if (i >= metadata.vectorZoneMaps.size() || !metadata.vectorZoneMaps[i].isValid()) {
+            return std::nullopt;
+        }
+        const auto& zoneMap = metadata.vectorZoneMaps[i];
+        auto vectorStats = MergedColumnChunkStats{ColumnChunkStats{}, zoneMap.numNulls == 0,
+            zoneMap.numNulls == zoneMap.numValues};
+        if (!vectorStats.guaranteedAllNulls) {
+            if (physicalType == PhysicalTypeID::STRING) {
+                vectorStats.minStringPrefix = zoneMap.min.unsignedInt;
+                vectorStats.maxStringPrefix = zoneMap.max.unsignedInt;
+            } else {
+                vectorStats.stats.min = zoneMap.min;
+                vectorStats.stats.max = zoneMap.max;
+            }
+        }
+        result.merge(vectorStats, physicalType);
+    }
+    return result;
+}
+
 void ColumnChunkData::updateStats(const ValueVector* vector, const SelectionView& selView) {
     if (selView.isUnfiltered()) {
         updateInMemoryStats(inMemoryStats, *vector);
@@ -289,6 +319,29 @@ ColumnChunkMetadata ColumnChunkData::getMetadataToFlush() const {
     return getMetadataFunction(buffer->getBuffer(), numValues, minValue, maxValue);
 }
 
+std::vector<VectorZoneMap> ColumnChunkData::computeVectorZoneMaps() const {
+    const auto physicalType = dataType.getPhysicalType();
+    // Chunks of a single vector are already skipped by the zone map of the whole chunk.
+    if (numValues <= DEFAULT_VECTOR_CAPACITY || physicalType == PhysicalTypeID::BOOL ||
+        !TypeUtils::visit(physicalType, []<typename T>(T) { return StorageValueType<T>; })) {
+        return {};
+    }
+    std::vector<VectorZoneMap> zoneMaps;
+    for (offset_t startRow = 0; startRow < numValues; startRow += DEFAULT_VECTOR_CAPACITY) {
+        const auto numRows = std::min(DEFAULT_VECTOR_CAPACITY, numValues - startRow);
+        auto [min, max] = getMinMaxStorageValue(*this, startRow, numRows, physicalType);
+        uint32_t numNulls = 0;
+        if (nullData) {
+            for (auto row = startRow; row < startRow + numRows; row++) {
+                numNulls += nullData->isNull(row);
+            }
+        }
+        zoneMaps.push_back(VectorZoneMap{min.value_or(StorageValue{}),
+            max.value_or(StorageValue{}), static_cast<uint32_t>(numRows), numNulls});
+    }
+    return zoneMaps;
+}
+
 void ColumnChunkData::append(ValueVector* vector, const SelectionView& selView) {
     KU_ASSERT(vector->dataType.getPhysicalType() == dataType.getPhysicalType());
     copyVectorToBuffer(vector, numValues, selView);
@@ -314,7 +367,8 @@ void ColumnChunkData::append(const ColumnChunkData* other, offset_t startPosInOt
 void ColumnChunkData::flush(PageAllocator& pageAllocator) {
     const auto preScanMetadata = getMetadataToFlush();
     auto allocatedEntry = pageAllocator.allocatePageRange(preScanMetadata.getNumPages());
-    const auto flushedMetadata = flushBuffer(pageAllocator, allocatedEntry, preScanMetadata);
+    auto flushedMetadata = flushBuffer(pageAllocator, allocatedEntry, preScanMetadata);
+    flushedMetadata.vectorZoneMaps = computeVectorZoneMaps();
     setToOnDisk(flushedMetadata);
     if (nullData) {
         nullData->flush(pageAllocator);
@@ -68,11 +68,28 @@ ColumnChunkMetadata booleanGetMetadata(uint64_t numValues, StorageValue min, Sto
         CompressionMetadata(min, max, CompressionType::BOOLEAN_BITPACKING));
 }
 
+void VectorZoneMap::serialize(Serializer& serializer) const {
+    serializer.write(min);
+    serializer.write(max);
+    serializer.write(numValues);
+    serializer.write(numNulls);
+}
+
+VectorZoneMap VectorZoneMap::deserialize(Deserializer& deserializer) {
+    VectorZoneMap ret{};
+    deserializer.deserializeValue(ret.min);
+    deserializer.deserializeValue(ret.max);
+    deserializer.deserializeValue(ret.numValues);
+    deserializer.deserializeValue(ret.numNulls);
+    return ret;
+}
+
 void ColumnChunkMetadata::serialize(common::Serializer& serializer) const {
     serializer.write(pageRange.startPageIdx);
     serializer.write(pageRange.numPages);
     serializer.write(numValues);
     compMeta.serialize(serializer);
+    serializer.serializeVector(vectorZoneMaps);
 }
 
 ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deserializer) {
@@ -81,10 +98,19 @@ ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deser
     deserializer.deserializeValue(ret.pageRange.numPages);
     deserializer.deserializeValue(ret.numValues);
     ret.compMeta = decltype(ret.compMeta)::deserialize(deserializer);
+    deserializer.deserializeVector(ret.vectorZoneMaps);
 
     return ret;
 }
 
+void ColumnChunkMetadata::invalidateVectorZoneMaps(offset_t startRow, offset_t endRow) {
+    const auto endVectorIdx =
+        std::min<uint64_t>(endRow / DEFAULT_VECTOR_CAPACITY + 1, vectorZoneMaps.size());
+    for (auto i = startRow / DEFAULT_VECTOR_CAPACITY; i < endVectorIdx; i++) {
+        vectorZoneMaps[i].invalidate();
+    }
+}
+
 page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     switch (compMeta.compression) {
     case CompressionType::ALP: {
@@ -100,7 +126,31 @@ page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     }
 }
 
-ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /*buffer*/,
+namespace {
+// Delta encoding stores one uncompressed value per block, so it rarely pays off for tiny chunks
+constexpr uint64_t DELTA_BITPACKING_MIN_NUM_VALUES = 64;
+
+// Switches to delta encoding if it fits more values in a page than the current compression.
+// Sorted or nearly sorted values (e.g. CSR offsets and internal IDs in insertion order) usually
+// have small deltas even when their range is large.
+template<DeltaBitpackingType T>
+void tryDeltaBitpacking(std::span<const uint8_t> buffer, uint64_t numValues,
+    PhysicalTypeID physicalType, CompressionMetadata& compMeta) {
+    if (numValues < DELTA_BITPACKING_MIN_NUM_VALUES || buffer.size() < numValues * sizeof(T)) {
+        return;
+    }
+    auto deltaMeta = CompressionMetadata(compMeta.min, compMeta.max,
+        CompressionType::DELTA_BITPACKING);
+    deltaMeta.extraMetadata = std::make_unique<DeltaMetadata>(DeltaBitpacking<T>::getDeltaInfo(
+        std::span<const T>(reinterpret_cast<const T*>(buffer.data()), numValues)));
+    if (deltaMeta.numValues(KUZU_PAGE_SIZE, physicalType) >
+        compMeta.numValues(KUZU_PAGE_SIZE, physicalType)) {
+        compMeta = std::move(deltaMeta);
+    }
+}
+} // namespace
+
+ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> buffer,
     uint64_t numValues, StorageValue min, StorageValue max) {
     // For supported types, min and max may be null if all values are null
     // Compression is supported in this case
@@ -116,6 +166,13 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
                 if (IntegerBitpacking<T>::getPackingInfo(compMeta).bitWidth >= sizeof(T) * 8) {
                     compMeta = CompressionMetadata(min, max, CompressionType::UNCOMPRESSED);
                 }
+                if constexpr (DeltaBitpackingType<T>) {
+                    tryDeltaBitpacking<T>(buffer, numValues, dataType.getPhysicalType(), compMeta);
+                }
+            },
+            [&](internalID_t) {
+                tryDeltaBitpacking<uint64_t>(buffer, numValues, dataType.getPhysicalType(),
+                    compMeta);
             },
             [&](auto) {});
     }
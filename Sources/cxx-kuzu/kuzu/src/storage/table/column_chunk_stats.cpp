@@ -54,6 +54,14 @@ void ColumnChunkStats::reset() {
 void MergedColumnChunkStats::merge(const MergedColumnChunkStats& o,
     common::PhysicalTypeID dataType) {
     stats.update(o.stats.min, o.stats.max, dataType);
+    if (o.minStringPrefix.has_value() &&
+        (!minStringPrefix.has_value() || *o.minStringPrefix < *minStringPrefix)) {
+        minStringPrefix = o.minStringPrefix;
+    }
+    if (o.maxStringPrefix.has_value() &&
+        (!maxStringPrefix.has_value() || *o.maxStringPrefix > *maxStringPrefix)) {
+        maxStringPrefix = o.maxStringPrefix;
+    }
     guaranteedNoNulls = guaranteedNoNulls && o.guaranteedNoNulls;
     guaranteedAllNulls = guaranteedAllNulls && o.guaranteedAllNulls;
 }
@@ -191,7 +191,7 @@ public:
                     readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
                         numValuesToScanInPage, chunkMeta.compMeta);
                 };
-                readFromPage(pageCursor.pageIdx, std::cref(readFromPageFunc));
+                readFromPage(pageCursor.pageIdx, std::cref(readFromPageFunc), state.readPolicy);
             }
             numValuesScanned += numValuesToScanInPage;
             pageCursor.nextPage();
@@ -418,13 +418,13 @@ ColumnReadWriter::ColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile)
     : dataFH(dataFH), shadowFile(shadowFile) {}
 
 void ColumnReadWriter::readFromPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readFunc) const {
+    const std::function<void(uint8_t*)>& readFunc, PageReadPolicy readPolicy) const {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
         return readFunc(nullptr);
     }
-    dataFH->optimisticReadPage(pageIdx, readFunc);
+    dataFH->optimisticReadPage(pageIdx, readFunc, readPolicy);
 }
 
 void ColumnReadWriter::updatePageWithCursor(PageCursor cursor,
@@ -342,7 +342,10 @@ void CSRNodeGroup::appendChunkedCSRGroup(const Transaction* transaction,
     }
     for (auto i = 0u; i < csrHeader.offset->getNumValues(); i++) {
         const auto length = csrHeader.length->getValue<length_t>(i);
-        updateCSRIndex(i, startRow, length);
+        // Most bound nodes get no new rels when appending to a populated table.
+        if (length > 0) {
+            updateCSRIndex(i, startRow, length);
+        }
         startRow += length;
     }
 }
@@ -388,10 +391,16 @@ void CSRNodeGroup::updateCSRIndex(offset_t boundNodeOffsetInGroup, row_idx_t sta
         }
     } else {
         nodeCSRIndex.isSequential = false;
+        // Rows are appended to the end of the node group, so they usually come after all rows of
+        // the node already.
+        const auto needSort =
+            !nodeCSRIndex.rowIndices.empty() && nodeCSRIndex.rowIndices.back() > startRow;
         for (auto j = 0u; j < length; j++) {
             nodeCSRIndex.rowIndices.push_back(startRow + j);
         }
-        std::sort(nodeCSRIndex.rowIndices.begin(), nodeCSRIndex.rowIndices.end());
+        if (needSort) {
+            std::sort(nodeCSRIndex.rowIndices.begin(), nodeCSRIndex.rowIndices.end());
+        }
     }
 }
 
@@ -439,6 +448,50 @@ bool CSRNodeGroup::delete_(const Transaction* transaction, CSRNodeGroupScanSourc
     }
 }
 
+void CSRNodeGroup::countRels(const Transaction* transaction, const Column* csrOffsetColumn,
+    const Column* csrLengthColumn, std::vector<length_t>& degrees) const {
+    degrees.clear();
+    if (persistentChunkGroup) {
+        ChunkState offsetState, lengthState;
+        const auto& csrHeader = persistentChunkGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
+        csrHeader.offset->initializeScanState(offsetState, csrOffsetColumn);
+        csrHeader.length->initializeScanState(lengthState, csrLengthColumn);
+        InMemChunkedCSRHeader header(mm, false /* enableCompression */,
+            StorageConfig::NODE_GROUP_SIZE);
+        header.setNumValues(0);
+        csrHeader.offset->scanCommitted<ResidencyState::ON_DISK>(transaction, offsetState,
+            *header.offset);
+        csrHeader.length->scanCommitted<ResidencyState::ON_DISK>(transaction, lengthState,
+            *header.length);
+        degrees.resize(header.length->getNumValues());
+        for (auto i = 0u; i < degrees.size(); i++) {
+            const auto length = header.getCSRLength(i);
+            if (!persistentChunkGroup->hasVersionInfo()) {
+                degrees[i] = length;
+                continue;
+            }
+            // Rels inserted by batch insert are only visible once committed and deleted rels stay
+            // in the list until the next checkpoint.
+            const auto startRow = header.getStartCSROffset(i);
+            for (auto row = startRow; row < startRow + length; row++) {
+                degrees[i] += persistentChunkGroup->isInserted(transaction, row) &&
+                              !persistentChunkGroup->isDeleted(transaction, row);
+            }
+        }
+    }
+    if (csrIndex) {
+        const auto numBoundNodes = csrIndex->getMaxOffsetWithRels() + 1;
+        if (degrees.size() < numBoundNodes) {
+            degrees.resize(numBoundNodes);
+        }
+        for (auto i = 0u; i < numBoundNodes; i++) {
+            for (const auto row : csrIndex->indices[i].getRows()) {
+                degrees[i] += row != INVALID_ROW_IDX && isVisible(transaction, row);
+            }
+        }
+    }
+}
+
 void CSRNodeGroup::addColumn(TableAddColumnState& addColumnState, PageAllocator* pageAllocator,
     ColumnStats* newColumnStats) {
     if (persistentChunkGroup) {
@@ -634,31 +687,45 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
         if (!region.hasPersistentDeletions) {
             newChunk->append(oldChunkWithUpdates.get(), oldStartRow, oldCSRLength);
         } else {
-            // TODO(Guodong): Optimize the for loop away by appending in batch
-            for (auto i = 0u; i < oldCSRLength; i++) {
-                const auto csrOffsetInPersistentChunk = oldStartRow + i + leftCSROffset;
-                if (persistentChunkGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION,
-                        csrOffsetInPersistentChunk)) {
+            // Append runs of rows that are not deleted at once.
+            auto runStart = 0u;
+            for (auto i = 0u; i <= oldCSRLength; i++) {
+                if (i < oldCSRLength && !persistentChunkGroup->isDeleted(
+                                            &DUMMY_CHECKPOINT_TRANSACTION,
+                                            oldStartRow + i + leftCSROffset)) {
                     continue;
                 }
-                newChunk->append(oldChunkWithUpdates.get(), oldStartRow + i, 1);
+                if (i > runStart) {
+                    newChunk->append(oldChunkWithUpdates.get(), oldStartRow + runStart,
+                        i - runStart);
+                }
+                runStart = i + 1;
             }
         }
-        // Merge in-memory insertions into the new chunk.
+        // Merge in-memory insertions into the new chunk. Rels appended together are mostly
+        // consecutive rows, so they are scanned in runs within each chunked group.
         if (csrIndex) {
             auto rows = csrIndex->indices[nodeOffset].getRows();
-            // TODO(Guodong): Optimize here. if no deletions and has sequential rows, scan in
-            // range.
-            for (const auto row : rows) {
-                if (row == INVALID_ROW_IDX) {
+            auto i = 0u;
+            while (i < rows.size()) {
+                if (rows[i] == INVALID_ROW_IDX) {
+                    i++;
                     continue;
                 }
-                auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(row,
+                auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(rows[i],
                     StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+                auto numRowsInRun = 1u;
+                while (i + numRowsInRun < rows.size() &&
+                       rows[i + numRowsInRun] == rows[i] + numRowsInRun &&
+                       rowInChunk + numRowsInRun < StorageConfig::CHUNKED_NODE_GROUP_CAPACITY) {
+                    numRowsInRun++;
+                }
                 const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
                 KU_ASSERT(!chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk));
                 chunkedGroup->getColumnChunk(columnID).scanCommitted<ResidencyState::IN_MEMORY>(
-                    &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *newChunk, rowInChunk, 1);
+                    &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *newChunk, rowInChunk,
+                    numRowsInRun);
+                i += numRowsInRun;
             }
         }
         // Fill gaps if any.
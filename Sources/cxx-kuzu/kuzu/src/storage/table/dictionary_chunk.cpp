@@ -1,8 +1,11 @@
 #include "storage/table/dictionary_chunk.h"
 
+#include <algorithm>
+
 #include "common/constants.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "storage/compression/compression.h"
 #include "storage/enums/residency_state.h"
 #include <bit>
 
@@ -21,6 +24,13 @@ namespace storage {
 // space for updates.
 static constexpr uint64_t INITIAL_OFFSET_CHUNK_CAPACITY = 3;
 
+// Smaller string data is not worth building a symbol table for.
+static constexpr uint64_t MIN_FSST_DATA_SIZE = 4096;
+// Approximate number of bytes of strings sampled to build the FSST symbol table.
+static constexpr uint64_t FSST_SAMPLE_SIZE = 16384;
+// FSST encoded string data is only used if its size is at most this percentage of the original.
+static constexpr uint64_t MAX_FSST_SIZE_PERCENTAGE = 80;
+
 DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enableCompression,
     ResidencyState residencyState)
     : enableCompression{enableCompression},
@@ -100,9 +110,66 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
     return stringDataChunk->getEstimatedMemoryUsage() + offsetChunk->getEstimatedMemoryUsage();
 }
 
+std::optional<DictionaryChunk::FSSTEncodedData> DictionaryChunk::encodeWithFSST() const {
+    const auto dataSize = stringDataChunk->getNumValues();
+    const auto numStrings = offsetChunk->getNumValues();
+    if (!enableCompression || stringDataChunk->getResidencyState() != ResidencyState::IN_MEMORY ||
+        dataSize < MIN_FSST_DATA_SIZE) {
+        return std::nullopt;
+    }
+    std::vector<std::string_view> sample;
+    const auto sampleStride = std::max<uint64_t>(1, dataSize / FSST_SAMPLE_SIZE);
+    for (auto i = 0u; i < numStrings; i += sampleStride) {
+        sample.push_back(getString(i));
+    }
+    auto symbolTable = FSSTSymbolTable::build(sample);
+    std::vector<uint8_t> encodedData;
+    encodedData.reserve(dataSize);
+    std::vector<string_offset_t> encodedOffsets(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        encodedOffsets[i] = encodedData.size();
+        symbolTable.encode(getString(i), encodedData);
+    }
+    if (encodedData.size() * 100 > dataSize * MAX_FSST_SIZE_PERCENTAGE) {
+        return std::nullopt;
+    }
+    auto& mm = stringDataChunk->getMemoryManager();
+    FSSTEncodedData result{
+        ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT8(),
+            false /*enableCompression*/, encodedData.size(), ResidencyState::IN_MEMORY,
+            false /*hasNullData*/),
+        ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT64(), enableCompression,
+            numStrings, ResidencyState::IN_MEMORY, false /*hasNullData*/),
+        std::move(symbolTable)};
+    memcpy(result.stringDataChunk->getData(), encodedData.data(), encodedData.size());
+    result.stringDataChunk->setNumValues(encodedData.size());
+    for (auto i = 0u; i < numStrings; i++) {
+        result.offsetChunk->setValue<string_offset_t>(encodedOffsets[i], i);
+    }
+    return result;
+}
+
+void DictionaryChunk::setFSSTMetadata(ColumnChunkData& stringDataChunk,
+    const FSSTSymbolTable& symbolTable) {
+    auto& compMeta = stringDataChunk.getMetadata().compMeta;
+    KU_ASSERT(compMeta.compression == CompressionType::UNCOMPRESSED);
+    compMeta.compression = CompressionType::FSST;
+    compMeta.extraMetadata = std::make_unique<FSSTMetadata>(symbolTable);
+}
+
 void DictionaryChunk::flush(PageAllocator& pageAllocator) {
+    auto encoded = encodeWithFSST();
+    if (encoded) {
+        // The index table hashes the strings in the chunks being replaced
+        indexTable.clear();
+        stringDataChunk = std::move(encoded->stringDataChunk);
+        offsetChunk = std::move(encoded->offsetChunk);
+    }
     stringDataChunk->flush(pageAllocator);
     offsetChunk->flush(pageAllocator);
+    if (encoded) {
+        setFSSTMetadata(*stringDataChunk, encoded->symbolTable);
+    }
 }
 
 void DictionaryChunk::serialize(Serializer& serializer) const {
@@ -34,7 +34,19 @@ DictionaryColumn::DictionaryColumn(const std::string& name, FileHandle* dataFH,
         shadowFile, enableCompression, false /*requireNullColumn*/);
 }
 
+static bool isFSSTEncoded(const SegmentState& dataState) {
+    return dataState.metadata.compMeta.compression == CompressionType::FSST;
+}
+
+static const FSSTSymbolTable& getSymbolTable(const SegmentState& dataState) {
+    return dataState.metadata.compMeta.fsstMetadata()->symbolTable;
+}
+
 void DictionaryColumn::scan(const SegmentState& state, DictionaryChunk& dictChunk) const {
+    if (isFSSTEncoded(StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA))) {
+        scanFSSTEncoded(state, dictChunk);
+        return;
+    }
     auto offsetChunk = dictChunk.getOffsetChunk();
     auto stringDataChunk = dictChunk.getStringDataChunk();
     auto initialDictSize = offsetChunk->getNumValues();
@@ -68,6 +80,49 @@ void DictionaryColumn::scan(const SegmentState& state, DictionaryChunk& dictChun
     }
 }
 
+// Dictionary chunks in memory are never encoded, so every string is decoded and the offsets are
+// rebuilt for the decoded data.
+void DictionaryColumn::scanFSSTEncoded(const SegmentState& state,
+    DictionaryChunk& dictChunk) const {
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    auto& offsetState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET);
+    const auto numStrings = offsetState.metadata.numValues;
+    if (numStrings == 0) {
+        return;
+    }
+    const auto& symbolTable = getSymbolTable(dataState);
+    std::vector<uint8_t> encodedData;
+    scanEncodedValue(dataState, 0, dataState.metadata.numValues, encodedData);
+    std::vector<string_offset_t> offsets(numStrings + 1);
+    scanOffsets(offsetState, offsets.data(), 0, numStrings, encodedData.size());
+
+    auto offsetChunk = dictChunk.getOffsetChunk();
+    auto stringDataChunk = dictChunk.getStringDataChunk();
+    if (offsetChunk->getNumValues() + numStrings > offsetChunk->getCapacity()) {
+        offsetChunk->resize(std::bit_ceil(offsetChunk->getNumValues() + numStrings));
+    }
+    const auto decodedSize = symbolTable.getDecodedLength(encodedData.data(), encodedData.size());
+    if (stringDataChunk->getNumValues() + decodedSize > stringDataChunk->getCapacity()) {
+        stringDataChunk->resize(std::bit_ceil(stringDataChunk->getNumValues() + decodedSize));
+    }
+    for (auto i = 0u; i < numStrings; i++) {
+        KU_ASSERT(offsets[i + 1] >= offsets[i]);
+        const auto dataSize = stringDataChunk->getNumValues();
+        offsetChunk->setValue<string_offset_t>(dataSize, offsetChunk->getNumValues());
+        const auto length = symbolTable.decode(encodedData.data() + offsets[i],
+            offsets[i + 1] - offsets[i], stringDataChunk->getData<uint8_t>() + dataSize);
+        stringDataChunk->setNumValues(dataSize + length);
+    }
+}
+
+void DictionaryColumn::scanEncodedValue(const SegmentState& dataState, uint64_t startOffset,
+    uint64_t length, std::vector<uint8_t>& buffer) const {
+    buffer.resize(length);
+    if (length > 0) {
+        dataColumn->scanSegment(dataState, startOffset, length, buffer.data());
+    }
+}
+
 template<typename Result>
 void DictionaryColumn::scan(const SegmentState& offsetState, const SegmentState& dataState,
     std::vector<std::pair<string_index_t, uint64_t>>& offsetsToScan, Result* result,
@@ -170,6 +225,18 @@ void DictionaryColumn::scanOffsets(const SegmentState& state,
 
 void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOffset,
     uint64_t length, ValueVector* resultVector, uint64_t offsetInVector) const {
+    if (isFSSTEncoded(dataState)) {
+        std::vector<uint8_t> encodedValue;
+        scanEncodedValue(dataState, startOffset, length, encodedValue);
+        const auto& symbolTable = getSymbolTable(dataState);
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable.getDecodedLength(encodedValue.data(), encodedValue.size()));
+        symbolTable.decode(encodedValue.data(), encodedValue.size(), (uint8_t*)kuString.getData());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString = StringVector::reserveString(resultVector, offsetInVector, length);
     dataColumn->scanSegment(dataState, startOffset, length, (uint8_t*)kuString.getData());
@@ -184,6 +251,12 @@ void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOf
     auto& stringDataChunk = *result->getDictionaryChunk().getStringDataChunk();
     auto& offsetChunk = *result->getDictionaryChunk().getOffsetChunk();
     auto& indexChunk = *result->getIndexColumnChunk();
+    std::vector<uint8_t> encodedValue;
+    if (isFSSTEncoded(dataState)) {
+        scanEncodedValue(dataState, startOffset, length, encodedValue);
+        length = getSymbolTable(dataState).getDecodedLength(encodedValue.data(),
+            encodedValue.size());
+    }
     if (stringDataChunk.getCapacity() < stringDataChunk.getNumValues() + length) {
         stringDataChunk.resize(std::bit_ceil(stringDataChunk.getNumValues() + length));
     }
@@ -193,8 +266,13 @@ void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOf
     if (offsetInResult >= indexChunk.getCapacity()) {
         indexChunk.resize(std::bit_ceil(offsetInResult + 1));
     }
-    dataColumn->scanSegment(dataState, startOffset, length,
-        stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    if (isFSSTEncoded(dataState)) {
+        getSymbolTable(dataState).decode(encodedValue.data(), encodedValue.size(),
+            stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    } else {
+        dataColumn->scanSegment(dataState, startOffset, length,
+            stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    }
     indexChunk.setValue<string_index_t>(offsetChunk.getNumValues(), offsetInResult);
     offsetChunk.setValue<string_offset_t>(stringDataChunk.getNumValues(),
         offsetChunk.getNumValues());
@@ -219,6 +297,10 @@ bool DictionaryColumn::canCommitInPlace(const SegmentState& state, uint64_t numN
 
 bool DictionaryColumn::canDataCommitInPlace(const SegmentState& dataState,
     uint64_t totalStringLengthToAdd) {
+    // Strings appended in place are not encoded, so FSST encoded data is re-encoded out of place
+    if (isFSSTEncoded(dataState)) {
+        return false;
+    }
     // Make sure there is sufficient space in the data chunk (not currently compressed)
     auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate > dataState.metadata.getNumPages() * KUZU_PAGE_SIZE) {
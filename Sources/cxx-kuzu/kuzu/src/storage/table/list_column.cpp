@@ -106,6 +106,11 @@ void ListColumn::scanSegment(const SegmentState& state, offset_t startOffsetInCh
         nullColumn->scanSegment(*state.nullState, startOffsetInChunk, numValuesToScan, resultVector,
             offsetInResult);
     }
+    if (const auto arraySize = getFixedArraySize(state)) {
+        scanFixedSizeArrays(state, startOffsetInChunk, numValuesToScan, resultVector,
+            offsetInResult, *arraySize);
+        return;
+    }
     auto listOffsetSizeInfo = getListOffsetSizeInfo(state, startOffsetInChunk, numValuesToScan);
     if (!resultVector->state || resultVector->state->getSelVector().isUnfiltered()) {
         scanUnfiltered(state, resultVector, numValuesToScan, listOffsetSizeInfo, offsetInResult);
@@ -174,8 +179,10 @@ void ListColumn::scanSegment(const SegmentState& state, ColumnChunkData* resultC
 void ListColumn::lookupInternal(const SegmentState& state, offset_t nodeOffset,
     ValueVector* resultVector, uint32_t posInVector) const {
     auto [nodeGroupIdx, offsetInChunk] = StorageUtils::getNodeGroupIdxAndOffsetInChunk(nodeOffset);
-    const auto listEndOffset = readOffset(state, offsetInChunk);
-    const auto size = readSize(state, offsetInChunk);
+    const auto arraySize = getFixedArraySize(state);
+    const auto size = arraySize ? *arraySize : readSize(state, offsetInChunk);
+    const auto listEndOffset =
+        arraySize ? (offsetInChunk + 1) * *arraySize : readOffset(state, offsetInChunk);
     const auto listStartOffset = listEndOffset - size;
     auto dataVector = ListVector::getDataVector(resultVector);
     auto currentListDataSize = ListVector::getDataVectorSize(resultVector);
@@ -263,6 +270,69 @@ void ListColumn::scanFiltered(const SegmentState& state, offset_t startOffsetInS
     }
 }
 
+std::optional<list_size_t> ListColumn::getFixedArraySize(const SegmentState& state) const {
+    if (dataType.getLogicalTypeID() != LogicalTypeID::ARRAY) {
+        return std::nullopt;
+    }
+    const auto arraySize = ArrayType::getNumElements(dataType);
+    const auto numValues = state.metadata.numValues;
+    // Null arrays have a size of 0.
+    const auto& sizeMetadata = state.childrenStates[SIZE_COLUMN_CHILD_READ_STATE_IDX].metadata;
+    if (numValues == 0 || sizeMetadata.compMeta.min.get<list_size_t>() != arraySize ||
+        sizeMetadata.compMeta.max.get<list_size_t>() != arraySize) {
+        return std::nullopt;
+    }
+    // The data of updated arrays is appended to the end of the data column, and the data column is
+    // only rewritten in row order, so the arrays are stored in row order if there is no other data.
+    const auto& dataMetadata = state.childrenStates[DATA_COLUMN_CHILD_READ_STATE_IDX].metadata;
+    if (dataMetadata.numValues != numValues * arraySize) {
+        return std::nullopt;
+    }
+    return arraySize;
+}
+
+void ListColumn::scanFixedSizeArrays(const SegmentState& state, offset_t startOffsetInSegment,
+    row_idx_t numValuesToScan, ValueVector* resultVector, offset_t offsetInResult,
+    list_size_t arraySize) const {
+    auto dataVector = ListVector::getDataVector(resultVector);
+    auto& dataState = state.childrenStates[DATA_COLUMN_CHILD_READ_STATE_IDX];
+    auto offsetInDataVector = ListVector::getDataVectorSize(resultVector);
+    numValuesToScan = std::min(numValuesToScan, state.metadata.numValues - startOffsetInSegment);
+    if (!resultVector->state || resultVector->state->getSelVector().isUnfiltered()) {
+        for (auto i = 0u; i < numValuesToScan; i++) {
+            resultVector->setValue(offsetInResult + i,
+                list_entry_t{offsetInDataVector + i * arraySize, arraySize});
+        }
+        ListVector::resizeDataVector(resultVector,
+            offsetInDataVector + numValuesToScan * arraySize);
+        dataColumn->scanSegment(dataState, startOffsetInSegment * arraySize,
+            numValuesToScan * arraySize, dataVector, offsetInDataVector);
+        return;
+    }
+    const auto& selVector = resultVector->state->getSelVector();
+    auto numSelected = 0u;
+    for (sel_t i = 0; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        if (pos >= offsetInResult && pos - offsetInResult < numValuesToScan) {
+            numSelected++;
+        }
+    }
+    ListVector::resizeDataVector(resultVector, offsetInDataVector + numSelected * arraySize);
+    for (sel_t i = 0; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        if (pos < offsetInResult || pos - offsetInResult >= numValuesToScan) {
+            continue;
+        }
+        resultVector->setValue(pos, list_entry_t{offsetInDataVector, arraySize});
+        if (!resultVector->isNull(pos)) {
+            dataColumn->scanSegment(dataState,
+                (startOffsetInSegment + pos - offsetInResult) * arraySize, arraySize, dataVector,
+                offsetInDataVector);
+        }
+        offsetInDataVector += arraySize;
+    }
+}
+
 offset_t ListColumn::readOffset(const SegmentState& state, offset_t offsetInNodeGroup) const {
     offset_t ret = INVALID_OFFSET;
     const auto& offsetState = state.childrenStates[OFFSET_COLUMN_CHILD_READ_STATE_IDX];
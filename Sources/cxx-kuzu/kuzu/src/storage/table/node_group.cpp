@@ -1,6 +1,7 @@
 #include "storage/table/node_group.h"
 
 #include "common/assert.h"
+#include "common/data_chunk/data_chunk.h"
 #include "common/types/types.h"
 #include "common/uniq_lock.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -159,6 +160,9 @@ static void initializeScanStateForChunkedGroup(const TableScanState& state,
         return;
     }
     auto& nodeGroupScanState = *state.nodeGroupScanState;
+    // Reading ahead whole chunks only pays off if most of the rows are going to be scanned.
+    const bool prefetch =
+        state.prefetchPages && (state.semiMask == nullptr || !state.semiMask->isEnabled());
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
         KU_ASSERT(i < state.columnIDs.size());
         KU_ASSERT(i < nodeGroupScanState.chunkStates.size());
@@ -169,6 +173,20 @@ static void initializeScanStateForChunkedGroup(const TableScanState& state,
         auto& chunk = chunkedGroup->getColumnChunk(columnID);
         auto& chunkState = nodeGroupScanState.chunkStates[i];
         chunk.initializeScanState(chunkState, state.columns[i]);
+        offset_t segmentStartRow = 0;
+        for (auto& segmentState : chunkState.segmentStates) {
+            // Pages read by sequential scans are unlikely to be read again soon, so they are
+            // cached as probationary pages (see EvictionPolicy::TWO_QUEUE).
+            segmentState.setReadPolicy(
+                prefetch ? PageReadPolicy::READ_PAGE_ONCE : PageReadPolicy::READ_PAGE);
+            // Rows ruled out by the zone maps are never read by the scan, so neither are the
+            // pages of the segment.
+            const auto numRowsInSegment = segmentState.metadata.numValues;
+            if (prefetch && !chunkedGroup->canSkipScan(state, segmentStartRow, numRowsInSegment)) {
+                segmentState.column->prefetch(segmentState);
+            }
+            segmentStartRow += numRowsInSegment;
+        }
     }
 }
 
@@ -254,10 +272,12 @@ NodeGroupScanResult NodeGroup::scan(Transaction* transaction, TableScanState& st
     bool enableSemiMask =
         state.source == TableScanSource::COMMITTED && state.semiMask && state.semiMask->isEnabled();
     if (enableSemiMask) {
+        state.nodeGroupScanState->nextRowToScan = startOffsetInGroup;
         applySemiMaskFilter(state, numRowsToScan, state.outState->getSelVectorUnsafe());
         if (state.outState->getSelVector().getSelSize() == 0) {
+            // The rows are skipped, so they still count as scanned for the caller to move on.
             state.nodeGroupScanState->nextRowToScan += numRowsToScan;
-            return NodeGroupScanResult{state.nodeGroupScanState->nextRowToScan, 0};
+            return NodeGroupScanResult{startOffsetInGroup, numRowsToScan};
         }
     }
     if (state.outputVectors.size() == 0) {
@@ -278,6 +298,7 @@ NodeGroupScanResult NodeGroup::scanInternal(const UniqLock& lock, Transaction* t
     if (startOffsetInGroup < startRowIdxInGroup) {
         numRowsToScan = std::min(numRowsToScan, startRowIdxInGroup - startOffsetInGroup);
         // If the scan starts before the first row in the group, skip the deleted part and return.
+        state.outState->getSelVectorUnsafe().setToFiltered(0);
         return NodeGroupScanResult{startOffsetInGroup, numRowsToScan};
     }
 
@@ -422,14 +443,19 @@ void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointStat
     // Re-populate version info here first.
     auto checkpointedVersionInfo = checkpointVersionInfo(lock, &DUMMY_CHECKPOINT_TRANSACTION);
     std::unique_ptr<ChunkedNodeGroup> checkpointedChunkedGroup;
-    if (checkpointedVersionInfo->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0, numRows) ==
-        numRows - firstGroup->getStartRowIdx()) {
+    const auto numDeletions =
+        checkpointedVersionInfo->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0, numRows);
+    if (numDeletions == numRows - firstGroup->getStartRowIdx()) {
         reclaimStorage(state.pageAllocator, lock);
         checkpointedChunkedGroup =
             ChunkedNodeGroup::flushEmpty(memoryManager, dataTypes, enableCompression,
                 StorageConfig::CHUNKED_NODE_GROUP_CAPACITY, numRows, state.pageAllocator);
     } else {
-        if (hasPersistentData) {
+        if (state.compact && numDeletions > 0 &&
+            static_cast<double>(numDeletions) >= MIN_DELETED_RATIO_TO_COMPACT * numRows) {
+            checkpointedChunkedGroup =
+                checkpointCompacted(memoryManager, lock, state, *checkpointedVersionInfo);
+        } else if (hasPersistentData) {
             checkpointedChunkedGroup = checkpointInMemAndOnDisk(memoryManager, lock, state);
         } else {
             checkpointedChunkedGroup = checkpointInMemOnly(memoryManager, lock, state);
@@ -513,6 +539,69 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemOnly(MemoryManager&
     return insertChunkedGroup->flush(&DUMMY_CHECKPOINT_TRANSACTION, state.pageAllocator);
 }
 
+// Rewrites the node group out of place with the values of deleted rows replaced by nulls, so that
+// their strings and lists are dropped and the remaining values are compressed again. Nodes keep
+// their offsets, and the old pages are returned to the free space manager.
+std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointCompacted(MemoryManager& memoryManager,
+    const UniqLock& lock, const NodeGroupCheckpointState& state,
+    const VersionInfo& checkpointedVersionInfo) const {
+    std::vector<const Column*> columnPtrs;
+    std::vector<LogicalType> columnTypes;
+    columnPtrs.reserve(state.columns.size());
+    for (auto* column : state.columns) {
+        columnPtrs.push_back(column);
+        columnTypes.push_back(column->getDataType().copy());
+    }
+    const auto hasPersistentData =
+        chunkedGroups.getFirstGroup(lock)->getResidencyState() == ResidencyState::ON_DISK;
+    std::unique_ptr<InMemChunkedNodeGroup> committedGroup;
+    if (hasPersistentData) {
+        committedGroup = scanAllInsertedAndVersions<ResidencyState::ON_DISK>(memoryManager, lock,
+            state.columnIDs, columnPtrs);
+        if (chunkedGroups.getNumGroups(lock) > 1) {
+            const auto insertChunkedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(
+                memoryManager, lock, state.columnIDs, columnPtrs);
+            const auto numInsertedRows = insertChunkedGroup->getNumRows();
+            committedGroup->resizeChunks(committedGroup->getNumRows() + numInsertedRows);
+            committedGroup->append(*insertChunkedGroup, 0, numInsertedRows);
+        }
+    } else {
+        committedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(memoryManager, lock,
+            state.columnIDs, columnPtrs);
+    }
+    const auto numCommittedRows = committedGroup->getNumRows();
+    DataChunk nullChunk{static_cast<uint32_t>(columnTypes.size())};
+    std::vector<ValueVector*> nullVectors;
+    for (auto i = 0u; i < columnTypes.size(); i++) {
+        auto nullVector = std::make_shared<ValueVector>(columnTypes[i].copy(), &memoryManager);
+        nullVector->setAllNull();
+        nullChunk.insert(i, nullVector);
+        nullVectors.push_back(nullVector.get());
+    }
+    nullChunk.state->getSelVectorUnsafe().setSelSize(DEFAULT_VECTOR_CAPACITY);
+    auto compactedGroup = std::make_unique<InMemChunkedNodeGroup>(memoryManager, columnTypes,
+        enableCompression, numCommittedRows, 0 /*startRowIdx*/);
+    row_idx_t row = 0;
+    while (row < numCommittedRows) {
+        const auto deleted = checkpointedVersionInfo.isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, row);
+        auto endRow = row + 1;
+        while (endRow < numCommittedRows &&
+               (!deleted || endRow - row < DEFAULT_VECTOR_CAPACITY) &&
+               checkpointedVersionInfo.isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, endRow) ==
+                   deleted) {
+            endRow++;
+        }
+        if (deleted) {
+            compactedGroup->append(nullVectors, 0, endRow - row);
+        } else {
+            compactedGroup->append(*committedGroup, row, endRow - row);
+        }
+        row = endRow;
+    }
+    reclaimStorage(state.pageAllocator, lock);
+    return compactedGroup->flush(&DUMMY_CHECKPOINT_TRANSACTION, state.pageAllocator);
+}
+
 std::unique_ptr<VersionInfo> NodeGroup::checkpointVersionInfo(const UniqLock& lock,
     const Transaction* transaction) const {
     auto checkpointVersionInfo = std::make_unique<VersionInfo>();
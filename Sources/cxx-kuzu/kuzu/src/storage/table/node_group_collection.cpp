@@ -1,6 +1,11 @@
 #include "storage/table/node_group_collection.h"
 
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/task_system/task_scheduler.h"
 #include "common/vector/value_vector.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/csr_node_group.h"
 #include "storage/table/table.h"
@@ -17,7 +22,8 @@ NodeGroupCollection::NodeGroupCollection(MemoryManager& mm, const std::vector<Lo
     const VersionRecordHandler* versionRecordHandler)
     : mm{mm}, enableCompression{enableCompression}, numTotalRows{0},
       types{LogicalType::copy(types)}, residency{residency}, stats{std::span{types}},
-      versionRecordHandler(versionRecordHandler) {
+      versionRecordHandler(versionRecordHandler), serializedNodeGroupsPending{false},
+      serializedNodeGroupsSize{0} {
     const auto lock = nodeGroups.lock();
     for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
         numTotalRows += nodeGroup->getNumRows();
@@ -31,6 +37,7 @@ void NodeGroupCollection::append(const Transaction* transaction,
     for (auto i = 1u; i < vectors.size(); i++) {
         KU_ASSERT(vectors[i]->state->getSelVector().getSelSize() == numRowsToAppend);
     }
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
     if (nodeGroups.isEmpty(lock)) {
         auto newGroup =
@@ -59,6 +66,7 @@ void NodeGroupCollection::append(const Transaction* transaction,
 
 void NodeGroupCollection::append(const Transaction* transaction,
     const std::vector<column_id_t>& columnIDs, const NodeGroupCollection& other) {
+    other.loadNodeGroupsIfNeeded();
     const auto otherLock = other.nodeGroups.lock();
     for (auto& nodeGroup : other.nodeGroups.getAllGroups(otherLock)) {
         append(transaction, columnIDs, *nodeGroup);
@@ -69,6 +77,7 @@ void NodeGroupCollection::append(const Transaction* transaction,
 void NodeGroupCollection::append(const Transaction* transaction,
     const std::vector<column_id_t>& columnIDs, const NodeGroup& nodeGroup) {
     KU_ASSERT(nodeGroup.getDataTypes().size() == columnIDs.size());
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
     if (nodeGroups.isEmpty(lock)) {
         auto newGroup =
@@ -110,6 +119,7 @@ std::pair<offset_t, offset_t> NodeGroupCollection::appendToLastNodeGroupAndFlush
     offset_t startOffset = 0;
     offset_t numToAppend = 0;
     bool directFlushWhenAppend = false;
+    loadNodeGroupsIfNeeded();
     {
         const auto lock = nodeGroups.lock();
         startOffset = numTotalRows;
@@ -162,6 +172,7 @@ row_idx_t NodeGroupCollection::getNumTotalRows() const {
 
 NodeGroup* NodeGroupCollection::getOrCreateNodeGroup(const Transaction* transaction,
     node_group_idx_t groupIdx, NodeGroupDataFormat format) {
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
     while (groupIdx >= nodeGroups.getNumGroups(lock)) {
         const auto currentGroupIdx = nodeGroups.getNumGroups(lock);
@@ -181,6 +192,7 @@ NodeGroup* NodeGroupCollection::getOrCreateNodeGroup(const Transaction* transact
 void NodeGroupCollection::addColumn(TableAddColumnState& addColumnState,
     PageAllocator* pageAllocator) {
     KU_ASSERT((pageAllocator == nullptr) == (residency == ResidencyState::IN_MEMORY));
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
     auto& newColumnStats = stats.addNewColumn(addColumnState.propertyDefinition.getType());
     for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
@@ -191,6 +203,10 @@ void NodeGroupCollection::addColumn(TableAddColumnState& addColumnState,
 
 uint64_t NodeGroupCollection::getEstimatedMemoryUsage() const {
     auto estimatedMemUsage = 0u;
+    // Node groups which are still serialized have no in-memory data.
+    if (serializedNodeGroupsPending.load(std::memory_order_acquire)) {
+        return estimatedMemUsage;
+    }
     const auto lock = nodeGroups.lock();
     for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
         estimatedMemUsage += nodeGroup->getEstimatedMemoryUsage();
@@ -198,13 +214,61 @@ uint64_t NodeGroupCollection::getEstimatedMemoryUsage() const {
     return estimatedMemUsage;
 }
 
+// Each worker checkpoints node groups one at a time with its own copy of the checkpoint state.
+// Node groups own disjoint pages, so they only share the page allocator and the shadow file.
+class NodeGroupCheckpointTask final : public common::Task {
+public:
+    NodeGroupCheckpointTask(uint64_t maxNumThreads, const std::vector<NodeGroup*>& nodeGroups,
+        MemoryManager& memoryManager, const NodeGroupCheckpointState& state)
+        : Task{maxNumThreads}, nodeGroups{nodeGroups}, memoryManager{memoryManager},
+          state{state}, nextNodeGroupIdx{0} {}
+
+    void run() override {
+        const auto localState = state.copy();
+        while (true) {
+            const auto idx = nextNodeGroupIdx.fetch_add(1);
+            if (idx >= nodeGroups.size()) {
+                return;
+            }
+            nodeGroups[idx]->checkpoint(memoryManager, *localState);
+        }
+    }
+
+    std::optional<common::SchedulingClass> getSchedulingClass() const override {
+        return common::SchedulingClass::BACKGROUND;
+    }
+
+private:
+    const std::vector<NodeGroup*>& nodeGroups;
+    MemoryManager& memoryManager;
+    const NodeGroupCheckpointState& state;
+    std::atomic<idx_t> nextNodeGroupIdx;
+};
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
+void NodeGroupCollection::checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(residency == ResidencyState::ON_DISK);
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
+    std::vector<NodeGroup*> groupsToCheckpoint;
     for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->checkpoint(memoryManager, state);
+        groupsToCheckpoint.push_back(nodeGroup.get());
+    }
+    const auto numThreads =
+        context ? std::min<uint64_t>(context->getMaxNumThreadForExec(), groupsToCheckpoint.size()) :
+                  1;
+    if (numThreads > 1) {
+        auto task = std::make_shared<NodeGroupCheckpointTask>(numThreads, groupsToCheckpoint,
+            memoryManager, state);
+        processor::ExecutionContext executionContext{nullptr /* profiler */, context,
+            0 /* queryID */};
+        common::TaskScheduler::Get(*context)->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
+    } else {
+        for (const auto nodeGroup : groupsToCheckpoint) {
+            nodeGroup->checkpoint(memoryManager, state);
+        }
     }
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -214,6 +278,7 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
 }
 
 void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
     for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
         nodeGroup->reclaimStorage(pageAllocator);
@@ -221,6 +286,7 @@ void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
 }
 
 void NodeGroupCollection::rollbackInsert(row_idx_t numRows_, bool updateNumRows) {
+    loadNodeGroupsIfNeeded();
     const auto lock = nodeGroups.lock();
 
     // remove any empty trailing node groups after the rollback
@@ -252,24 +318,67 @@ void NodeGroupCollection::pushInsertInfo(const Transaction* transaction,
 }
 
 void NodeGroupCollection::serialize(Serializer& ser) {
-    ser.writeDebuggingInfo("node_groups");
-    nodeGroups.serializeGroups(ser);
+    // The node groups are prefixed with the number of rows in them and with their size, so that
+    // they can be skipped when deserialized.
+    std::unique_lock lck{loadMtx};
+    if (serializedNodeGroupsPending.load(std::memory_order_acquire)) {
+        // Node groups which were never accessed haven't changed since they were deserialized.
+        ser.writeDebuggingInfo("num_total_rows");
+        ser.write<row_idx_t>(numTotalRows);
+        ser.writeDebuggingInfo("node_groups");
+        ser.write<uint64_t>(serializedNodeGroupsSize);
+        ser.write(serializedNodeGroups.get(), serializedNodeGroupsSize);
+    } else {
+        const auto bufferWriter = std::make_shared<BufferWriter>();
+        Serializer groupsSer{bufferWriter};
+        nodeGroups.serializeGroups(groupsSer);
+        row_idx_t numRows = 0;
+        const auto lock = nodeGroups.lock();
+        for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+            numRows += nodeGroup->getNumRows();
+        }
+        ser.writeDebuggingInfo("num_total_rows");
+        ser.write<row_idx_t>(numRows);
+        ser.writeDebuggingInfo("node_groups");
+        ser.write<uint64_t>(bufferWriter->getSize());
+        ser.write(bufferWriter->getBlobData(), bufferWriter->getSize());
+    }
     ser.writeDebuggingInfo("stats");
     stats.serialize(ser);
 }
 
-void NodeGroupCollection::deserialize(Deserializer& deSer, MemoryManager& memoryManager) {
+void NodeGroupCollection::deserialize(Deserializer& deSer, MemoryManager&) {
     std::string key;
-    deSer.validateDebuggingInfo(key, "node_groups");
     KU_ASSERT(residency == ResidencyState::ON_DISK);
-    nodeGroups.deserializeGroups(memoryManager, deSer, types);
+    deSer.validateDebuggingInfo(key, "num_total_rows");
+    row_idx_t numRows = 0;
+    deSer.deserializeValue<row_idx_t>(numRows);
+    numTotalRows = numRows;
+    deSer.validateDebuggingInfo(key, "node_groups");
+    uint64_t size = 0;
+    deSer.deserializeValue<uint64_t>(size);
+    {
+        std::unique_lock lck{loadMtx};
+        serializedNodeGroups = std::make_unique<uint8_t[]>(size);
+        serializedNodeGroupsSize = size;
+        deSer.read(serializedNodeGroups.get(), size);
+        serializedNodeGroupsPending.store(true, std::memory_order_release);
+    }
     deSer.validateDebuggingInfo(key, "stats");
     stats.deserialize(deSer);
-    numTotalRows = 0;
-    const auto lock = nodeGroups.lock();
-    for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        numTotalRows += nodeGroup->getNumRows();
+}
+
+void NodeGroupCollection::loadNodeGroups() const {
+    std::unique_lock lck{loadMtx};
+    if (!serializedNodeGroupsPending.load(std::memory_order_relaxed)) {
+        return;
     }
+    Deserializer groupsDeSer{
+        std::make_unique<BufferReader>(serializedNodeGroups.get(), serializedNodeGroupsSize)};
+    nodeGroups.deserializeGroups(mm, groupsDeSer, types);
+    serializedNodeGroups.reset();
+    serializedNodeGroupsSize = 0;
+    serializedNodeGroupsPending.store(false, std::memory_order_release);
 }
 
 } // namespace storage
@@ -46,6 +46,12 @@ void NodeTableVersionRecordHandler::rollbackInsert(main::ClientContext* context,
     }
 }
 
+void NodeTableVersionRecordHandler::commitDelete(node_group_idx_t nodeGroupIdx, row_idx_t startRow,
+    row_idx_t numRows, transaction_t commitTS) const {
+    VersionRecordHandler::commitDelete(nodeGroupIdx, startRow, numRows, commitTS);
+    table->recordDeletionsInStats(numRows);
+}
+
 NodeGroupScanResult NodeTableScanState::scanNext(Transaction* transaction, offset_t startOffset,
     offset_t numNodes) {
     KU_ASSERT(columns.size() == outputVectors.size());
@@ -223,7 +229,7 @@ NodeTable::NodeTable(const StorageManager* storageManager,
     const NodeTableCatalogEntry* nodeTableEntry, MemoryManager* mm)
     : Table{nodeTableEntry, storageManager, mm},
       pkColumnID{nodeTableEntry->getColumnID(nodeTableEntry->getPrimaryKeyName())},
-      versionRecordHandler(this) {
+      versionRecordHandler(this), compactOnCheckpoint{false} {
     auto* dataFH = storageManager->getDataFH();
     auto& pageAllocator = *dataFH->getPageManager();
     const auto maxColumnID = nodeTableEntry->getMaxColumnID();
@@ -410,7 +416,7 @@ void NodeTable::initInsertState(main::ClientContext* context, TableInsertState&
         auto& indexHolder = indexes[i];
         const auto index = indexHolder.getIndex();
         nodeInsertState.indexInsertStates[i] =
-            index->initInsertState(context, [&](offset_t offset) {
+            index->initInsertState(context, [this, context](offset_t offset) {
                 return isVisible(transaction::Transaction::Get(*context), offset);
             });
     }
@@ -457,9 +463,10 @@ void NodeTable::initUpdateState(main::ClientContext* context, TableUpdateState&
             continue;
         }
         nodeUpdateState.indexUpdateState[i] =
-            index->initUpdateState(context, nodeUpdateState.columnID, [&](offset_t offset) {
-                return isVisible(transaction::Transaction::Get(*context), offset);
-            });
+            index->initUpdateState(context, nodeUpdateState.columnID,
+                [this, context](offset_t offset) {
+                    return isVisible(transaction::Transaction::Get(*context), offset);
+                });
     }
 }
 
@@ -497,6 +504,8 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        // Counted when written rather than committed, since the stats are only an estimate.
+        nodeGroups->recordUpdatesInStats(1);
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -508,7 +517,7 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
 }
 
 bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState) {
-    const auto& nodeDeleteState = ku_dynamic_cast<NodeTableDeleteState&>(deleteState);
+    auto& nodeDeleteState = ku_dynamic_cast<NodeTableDeleteState&>(deleteState);
     KU_ASSERT(nodeDeleteState.nodeIDVector.state->getSelVector().getSelSize() == 1);
     const auto pos = nodeDeleteState.nodeIDVector.state->getSelVector()[0];
     if (nodeDeleteState.nodeIDVector.isNull(pos)) {
@@ -516,10 +525,16 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
     }
     bool isDeleted = false;
     const auto nodeOffset = nodeDeleteState.nodeIDVector.readNodeOffset(pos);
-    for (auto& index : indexes) {
-        auto indexDeleteState = index.getIndex()->initDeleteState(transaction, memoryManager,
-            getVisibleFunc(transaction));
-        index.getIndex()->delete_(transaction, nodeDeleteState.nodeIDVector, *indexDeleteState);
+    if (nodeDeleteState.indexDeleteStates.size() != indexes.size()) {
+        nodeDeleteState.indexDeleteStates.clear();
+        for (auto& index : indexes) {
+            nodeDeleteState.indexDeleteStates.push_back(index.getIndex()->initDeleteState(
+                transaction, memoryManager, getVisibleFunc(transaction)));
+        }
+    }
+    for (auto i = 0u; i < indexes.size(); i++) {
+        indexes[i].getIndex()->delete_(transaction, nodeDeleteState.nodeIDVector,
+            *nodeDeleteState.indexDeleteStates[i]);
     }
 
     if (transaction->isUnCommitted(tableID, nodeOffset)) {
@@ -623,6 +638,14 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
     }
 
     // 3. Scan index columns for newly inserted tuples.
+    // Uniqueness is checked against the latest committed state rather than the snapshot of the
+    // transaction, which misses keys committed by concurrent write transactions after it started.
+    // Commits are serialized, so every other committed transaction has a timestamp below ours.
+    const auto latestCommitted =
+        transaction->getCommitTS() == INVALID_TRANSACTION ?
+            Transaction{transaction->getType(), transaction->getID(), transaction->getStartTS()} :
+            Transaction{transaction->getType(), transaction->getID(),
+                transaction->getCommitTS() - 1};
     for (auto& index : indexes) {
         if (!index.needCommitInsert()) {
             continue;
@@ -633,7 +656,7 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
                 ", because it is not loaded. Please load the extension for the index first.");
         }
         UncommittedIndexInserter indexInserter{startNodeOffset, this, index.getIndex(),
-            getVisibleFunc(transaction)};
+            getVisibleFunc(&latestCommitted)};
         // We need to scan from local storage here because some tuples in local node groups might
         // have been deleted.
         scanIndexColumns(context, indexInserter, localNodeTable.getNodeGroups());
@@ -668,12 +691,14 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
         }
 
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator,
-            memoryManager};
-        nodeGroups->checkpoint(*memoryManager, state);
+            memoryManager, compactOnCheckpoint.load(std::memory_order_relaxed)};
+        nodeGroups->checkpoint(context, *memoryManager, state);
         for (auto& index : indexes) {
             index.checkpoint(context, pageAllocator);
         }
         tableEntry->vacuumColumnIDs(0 /*nextColumnID*/);
+        // Only cleared once the checkpoint succeeded, so that a failed one is compacted again.
+        compactOnCheckpoint.store(false, std::memory_order_relaxed);
         hasChanges.store(false, std::memory_order_release);
     }
     return ret;
@@ -701,7 +726,9 @@ void NodeTable::rollbackCheckpoint() {
 
 void NodeTable::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
-    getPKIndex()->reclaimStorage(pageAllocator);
+    for (auto& index : indexes) {
+        index.reclaimStorage(pageAllocator);
+    }
 }
 
 TableStats NodeTable::getStats(const Transaction* transaction) const {
@@ -741,6 +768,35 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
 }
 
+void NodeTable::lookupPKs(const Transaction* transaction, ValueVector* keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results) const {
+    KU_ASSERT(positions.size() == results.size());
+    std::vector<sel_t> persistentPositions;
+    std::vector<uint32_t> persistentIdxs;
+    const LocalNodeTable* localTable = nullptr;
+    if (transaction->getLocalStorage()) {
+        if (const auto table = transaction->getLocalStorage()->getLocalTable(tableID)) {
+            localTable = &table->cast<LocalNodeTable>();
+        }
+    }
+    for (auto i = 0u; i < positions.size(); i++) {
+        if (localTable && localTable->lookupPK(transaction, keyVector, positions[i], results[i])) {
+            continue;
+        }
+        persistentPositions.push_back(positions[i]);
+        persistentIdxs.push_back(i);
+    }
+    if (persistentPositions.empty()) {
+        return;
+    }
+    std::vector<offset_t> persistentResults(persistentPositions.size());
+    getPKIndex()->lookup(transaction, *keyVector, persistentPositions, persistentResults,
+        [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
+    for (auto i = 0u; i < persistentIdxs.size(); i++) {
+        results[persistentIdxs[i]] = persistentResults[i];
+    }
+}
+
 void NodeTable::scanIndexColumns(main::ClientContext* context, IndexScanHelper& scanHelper,
     const NodeGroupCollection& nodeGroups_) const {
     auto dataChunk = constructDataChunkForColumns(scanHelper.index->getIndexInfo().columnIDs);
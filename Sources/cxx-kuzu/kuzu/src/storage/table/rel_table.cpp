@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/buffer_manager.h"
 #include "common/exception/message.h"
 #include "common/exception/runtime.h"
 #include "common/types/types.h"
@@ -17,6 +18,7 @@
 #include "storage/table/rel_table_data.h"
 #include "storage/wal/local_wal.h"
 #include "transaction/transaction.h"
+#include "transaction/transaction_manager.h"
 #include <ranges>
 
 using namespace kuzu::catalog;
@@ -135,7 +137,8 @@ void RelTableScanState::setNodeIDVectorToFlat(sel_t selPos) const {
 RelTable::RelTable(RelGroupCatalogEntry* relGroupEntry, table_id_t fromTableID,
     table_id_t toTableID, const StorageManager* storageManager, MemoryManager* memoryManager)
     : Table{relGroupEntry, storageManager, memoryManager}, fromNodeTableID{fromTableID},
-      toNodeTableID{toTableID}, nextRelOffset{0} {
+      toNodeTableID{toTableID}, nextRelOffset{0}, reverseIndexEnabled{false},
+      reverseIndexBuilding{false}, reverseIndexEpoch{0} {
     auto relEntryInfo = relGroupEntry->getRelEntryInfo(fromNodeTableID, toNodeTableID);
     tableID = relEntryInfo->oid;
     relGroupID = relGroupEntry->getTableID();
@@ -172,6 +175,124 @@ bool RelTable::scanInternal(Transaction* transaction, TableScanState& scanState)
     return scanState.scanNext(transaction);
 }
 
+std::shared_ptr<const RelTableCSRCache> RelTable::getOrBuildCSRCache(
+    main::ClientContext& context, RelDataDirection direction, offset_t numBoundNodes) {
+    const auto transaction = Transaction::Get(context);
+    if (!transaction->isReadOnly()) {
+        return nullptr;
+    }
+    const auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+    {
+        std::unique_lock lck{csrCacheMtx};
+        if (csrCaches[idx] != nullptr && csrCacheVersions[idx] == csrCacheVersion.load() &&
+            csrCaches[idx]->getSnapshotTS() <= transaction->getStartTS()) {
+            return csrCaches[idx];
+        }
+    }
+    // The cache is built without holding the lock, so that scans of a valid cache aren't blocked.
+    const auto version = csrCacheVersion.load();
+    std::shared_ptr<const RelTableCSRCache> cache;
+    try {
+        cache = RelTableCSRCache::build(transaction, *this, direction, *memoryManager,
+            numBoundNodes);
+    } catch (const BufferManagerException&) {
+        // The cache only speeds up scans, which read from the table when there is no memory for
+        // it.
+        return nullptr;
+    }
+    // The cache is kept for later snapshots if it is built from the latest one and no write
+    // transaction may have changed the table without committing yet. Changes after the version
+    // was read advance it.
+    const auto transactionManager = TransactionManager::Get(context);
+    if (transaction->getStartTS() == transactionManager->getLastCommitTS() &&
+        !transactionManager->mayHaveActiveWriteTransaction()) {
+        std::unique_lock lck{csrCacheMtx};
+        if (csrCaches[idx] == nullptr ||
+            csrCaches[idx]->getSnapshotTS() <= cache->getSnapshotTS()) {
+            csrCaches[idx] = cache;
+            csrCacheVersions[idx] = version;
+        }
+    }
+    return cache;
+}
+
+void RelTable::invalidateCSRCaches() {
+    csrCacheVersion++;
+}
+
+void RelTable::enableReverseIndex() {
+    std::unique_lock lck{reverseIndexMtx};
+    reverseIndexEnabled = true;
+}
+
+void RelTable::dropReverseIndex() {
+    std::unique_lock lck{reverseIndexMtx};
+    reverseIndexEnabled = false;
+    reverseIndex.reset();
+    reverseIndexEpoch++;
+}
+
+bool RelTable::isReverseIndexEnabled() const {
+    std::unique_lock lck{reverseIndexMtx};
+    return reverseIndexEnabled;
+}
+
+bool RelTable::isBuildingReverseIndex() const {
+    std::unique_lock lck{reverseIndexMtx};
+    return reverseIndexBuilding;
+}
+
+std::shared_ptr<const RelTableReverseIndex> RelTable::getReverseIndex() const {
+    std::unique_lock lck{reverseIndexMtx};
+    return reverseIndex;
+}
+
+std::shared_ptr<const RelTableReverseIndex> RelTable::getReverseIndex(
+    const Transaction* transaction) const {
+    std::unique_lock lck{reverseIndexMtx};
+    if (reverseIndex == nullptr || !reverseIndex->canBeReadBy(transaction)) {
+        return nullptr;
+    }
+    return reverseIndex;
+}
+
+std::optional<uint64_t> RelTable::startReverseIndexBuild() {
+    std::unique_lock lck{reverseIndexMtx};
+    if (!reverseIndexEnabled || reverseIndexBuilding || reverseIndex != nullptr) {
+        return std::nullopt;
+    }
+    reverseIndexBuilding = true;
+    return reverseIndexEpoch;
+}
+
+bool RelTable::finishReverseIndexBuild(main::ClientContext& context,
+    std::unique_ptr<RelTableReverseIndex> index, uint64_t epoch) {
+    std::unique_lock lck{reverseIndexMtx};
+    reverseIndexBuilding = false;
+    if (index == nullptr || !reverseIndexEnabled || epoch != reverseIndexEpoch) {
+        return false;
+    }
+    // The index is installed if it is built from the latest snapshot, and no write transaction may
+    // have deleted rels without committing yet. Commits and deletions after the epoch was read
+    // advance it.
+    const auto transactionManager = TransactionManager::Get(context);
+    if (index->getSnapshotTS() != transactionManager->getLastCommitTS() ||
+        transactionManager->mayHaveActiveWriteTransaction()) {
+        return false;
+    }
+    reverseIndex = std::move(index);
+    return true;
+}
+
+void RelTable::invalidateReverseIndex() {
+    std::unique_lock lck{reverseIndexMtx};
+    if (!reverseIndexEnabled) {
+        return;
+    }
+    reverseIndex.reset();
+    reverseIndexEpoch++;
+}
+
 bool RelTable::scanInternalUnsafe(Transaction* transaction, TableScanState& scanState) {
     // NOTE: tableMutex must be held by caller (for use inside detachDelete, etc.)
     return scanState.scanNext(transaction);
@@ -311,6 +432,10 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
                 break;
             }
         }
+        if (isDeleted) {
+            invalidateReverseIndex();
+            invalidateCSRCaches();
+        }
     }
 
     if (isDeleted) {
@@ -382,6 +507,8 @@ void RelTable::detachDelete(Transaction* transaction, RelTableDeleteState* delet
         auto& wal = transaction->getLocalWAL();
         wal.logRelDetachDelete(tableID, direction, &deleteState->srcNodeIDVector);
     }
+    invalidateReverseIndex();
+    invalidateCSRCaches();
     hasChanges.store(true, std::memory_order_release);
 }
 
@@ -413,6 +540,32 @@ bool RelTable::checkIfNodeHasRels(Transaction* transaction, RelDataDirection dir
     return getDirectedTableData(direction)->checkIfNodeHasRels(transaction, srcNodeIDVector);
 }
 
+length_t RelTable::getDegree(Transaction* transaction, RelDataDirection direction,
+    offset_t boundOffset, RelTableDegreeState& state) const {
+    length_t degree = 0;
+    if (auto localTable = transaction->getLocalStorage()->getLocalTable(tableID)) {
+        degree += localTable->cast<LocalRelTable>().getNumRels(boundOffset, direction);
+    }
+    const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundOffset);
+    if (state.nodeGroupIdx != nodeGroupIdx) {
+        std::shared_lock<std::shared_mutex> lock(tableMutex);
+        state.nodeGroupIdx = nodeGroupIdx;
+        state.committedDegrees.clear();
+        const auto tableData = getDirectedTableData(direction);
+        if (nodeGroupIdx < tableData->getNumNodeGroups()) {
+            tableData->getNodeGroup(nodeGroupIdx)
+                ->cast<CSRNodeGroup>()
+                .countRels(transaction, tableData->getCSROffsetColumn(),
+                    tableData->getCSRLengthColumn(), state.committedDegrees);
+        }
+    }
+    const auto offsetInGroup = boundOffset % StorageConfig::NODE_GROUP_SIZE;
+    if (offsetInGroup < state.committedDegrees.size()) {
+        degree += state.committedDegrees[offsetInGroup];
+    }
+    return degree;
+}
+
 void RelTable::throwIfNodeHasRels(Transaction* transaction, RelDataDirection direction,
     ValueVector* srcNodeIDVector, const rel_multiplicity_constraint_throw_func_t& throwFunc) const {
     const auto nodeIDPos = srcNodeIDVector->state->getSelVector()[0];
@@ -526,8 +679,12 @@ void RelTable::commit(main::ClientContext* context, TableCatalogEntry* tableEntr
     // Acquire tableMutex for persistent operations (Level 2 AFTER Level 5 from LocalStorage::commit)
     std::unique_lock<std::shared_mutex> lock(tableMutex);
 
+    invalidateCSRCaches();
     // Update relID in local storage.
     updateRelOffsets(localRelTable);
+    if (directedRelData.size() == 1) {
+        commitToReverseIndex(transaction::Transaction::Get(*context), localRelTable);
+    }
     // For both forward and backward directions, re-org local storage into compact CSR node groups.
     auto& localNodeGroup = localRelTable.getLocalNodeGroup();
     // Scan from local node group and write to WAL.
@@ -564,6 +721,38 @@ void RelTable::commit(main::ClientContext* context, TableCatalogEntry* tableEntr
     localRelTable.clear(*MemoryManager::Get(*context));
 }
 
+// Inserted rels are kept apart from the indexed rels until there are more than a quarter of them.
+static constexpr uint64_t MIN_NUM_INSERTED_RELS_TO_REBUILD_REVERSE_INDEX = 65536;
+
+void RelTable::commitToReverseIndex(const Transaction* transaction,
+    LocalRelTable& localRelTable) {
+    std::unique_lock lck{reverseIndexMtx};
+    if (!reverseIndexEnabled) {
+        return;
+    }
+    reverseIndexEpoch++;
+    if (reverseIndex == nullptr) {
+        return;
+    }
+    const auto& localNodeGroup = localRelTable.getLocalNodeGroup();
+    for (auto& [srcOffset, rowIndices] : localRelTable.getCSRIndex(RelDataDirection::FWD)) {
+        for (const auto row : rowIndices) {
+            auto [chunkedGroupIdx, rowInChunkedGroup] =
+                StorageUtils::getQuotientRemainder(row, StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+            const auto chunkedGroup = localNodeGroup.getChunkedNodeGroup(chunkedGroupIdx);
+            const auto dstOffset = chunkedGroup->getColumnChunk(LOCAL_NBR_NODE_ID_COLUMN_ID)
+                                       .getValue<offset_t>(rowInChunkedGroup);
+            const auto relOffset = chunkedGroup->getColumnChunk(LOCAL_REL_ID_COLUMN_ID)
+                                       .getValue<offset_t>(rowInChunkedGroup);
+            reverseIndex->insertRel(dstOffset, {srcOffset, relOffset}, transaction->getCommitTS());
+        }
+    }
+    if (reverseIndex->getNumInsertedRels() >
+        std::max(reverseIndex->getNumRels() / 4, MIN_NUM_INSERTED_RELS_TO_REBUILD_REVERSE_INDEX)) {
+        reverseIndex.reset();
+    }
+}
+
 void RelTable::reclaimStorage(PageAllocator& pageAllocator) const {
     for (auto& relData : directedRelData) {
         relData->reclaimStorage(pageAllocator);
@@ -614,9 +803,11 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction,
     }
 }
 
-bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
+bool RelTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tableEntry,
     PageAllocator& pageAllocator) {
     bool ret = hasChanges.load(std::memory_order_acquire);
+    // New degree stats only need the table to be serialized again.
+    const bool statsChanged = degreeStatsChanged.load(std::memory_order_acquire);
     if (ret) {
         // Deleted columns are vacuumed and not checkpointed or serialized.
         std::vector<column_id_t> columnIDs;
@@ -625,11 +816,14 @@ bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
         for (auto& directedRelData : directedRelData) {
-            directedRelData->checkpoint(columnIDs, pageAllocator);
+            directedRelData->checkpoint(context, columnIDs, pageAllocator);
         }
         hasChanges.store(false, std::memory_order_release);
     }
-    return ret;
+    if (statsChanged) {
+        degreeStatsChanged.store(false, std::memory_order_release);
+    }
+    return ret || statsChanged;
 }
 
 row_idx_t RelTable::getNumTotalRows(const Transaction* transaction) {
@@ -646,6 +840,13 @@ void RelTable::serialize(Serializer& ser) const {
     for (auto& directedRelData : directedRelData) {
         directedRelData->serialize(ser);
     }
+    ser.writeDebuggingInfo("degree_stats");
+    for (auto& stats : degreeStats) {
+        ser.write<bool>(stats != nullptr);
+        if (stats) {
+            stats->serialize(ser);
+        }
+    }
 }
 
 void RelTable::deserialize(main::ClientContext*, StorageManager*, Deserializer& deSer) {
@@ -655,6 +856,14 @@ void RelTable::deserialize(main::ClientContext*, StorageManager*, Deserializer&
     for (auto i = 0u; i < directedRelData.size(); i++) {
         directedRelData[i]->deserialize(deSer, *memoryManager);
     }
+    deSer.validateDebuggingInfo(key, "degree_stats");
+    for (auto& stats : degreeStats) {
+        bool hasStats = false;
+        deSer.deserializeValue<bool>(hasStats);
+        if (hasStats) {
+            stats = std::make_shared<const DegreeStats>(DegreeStats::deserialize(deSer));
+        }
+    }
 }
 
 } // namespace storage
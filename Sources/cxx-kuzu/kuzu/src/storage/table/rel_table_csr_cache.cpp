@@ -0,0 +1,181 @@
+#include "storage/table/rel_table_csr_cache.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/vector/value_vector.h"
+#include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+static void writeVarint(std::vector<uint8_t, MmAllocator<uint8_t>>& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+static uint64_t readVarint(const uint8_t*& data) {
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    while (*data & 0x80) {
+        value |= static_cast<uint64_t>(*data++ & 0x7f) << shift;
+        shift += 7;
+    }
+    value |= static_cast<uint64_t>(*data++) << shift;
+    return value;
+}
+
+std::unique_ptr<RelTableCSRCache> RelTableCSRCache::build(Transaction* transaction,
+    RelTable& table, RelDataDirection direction, MemoryManager& memoryManager,
+    offset_t numBoundNodes) {
+    KU_ASSERT(transaction->isReadOnly());
+    const auto boundTableID = direction == RelDataDirection::FWD ? table.getFromNodeTableID() :
+                                                                   table.getToNodeTableID();
+    const auto nbrTableID = RelDirectionUtils::getNbrTableID(direction,
+        table.getFromNodeTableID(), table.getToNodeTableID());
+    auto cache = std::unique_ptr<RelTableCSRCache>(
+        new RelTableCSRCache(transaction->getStartTS(), nbrTableID, &memoryManager));
+    ValueVector boundNodeIDVector(LogicalType::INTERNAL_ID(), &memoryManager,
+        DataChunkState::getSingleValueDataChunkState());
+    auto outState = std::make_shared<DataChunkState>();
+    ValueVector nbrNodeIDVector(LogicalType::INTERNAL_ID(), &memoryManager, outState);
+    RelTableScanState scanState(memoryManager, &boundNodeIDVector, {&nbrNodeIDVector}, outState);
+    scanState.setToTable(transaction, &table, {NBR_ID_COLUMN_ID}, {}, direction);
+    cache->offsets.reserve(numBoundNodes + 1);
+    std::vector<offset_t> nbrOffsets;
+    for (auto boundOffset = 0u; boundOffset < numBoundNodes; boundOffset++) {
+        boundNodeIDVector.setValue<nodeID_t>(0, nodeID_t{boundOffset, boundTableID});
+        outState->getSelVectorUnsafe().setSelSize(0);
+        table.initScanState(transaction, scanState);
+        nbrOffsets.clear();
+        while (table.scan(transaction, scanState)) {
+            auto& selVector = outState->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                nbrOffsets.push_back(nbrNodeIDVector.getValue<nodeID_t>(selVector[i]).offset);
+            }
+        }
+        cache->appendNbrs(nbrOffsets);
+    }
+    cache->offsets.push_back(cache->nbrs.size());
+    cache->nbrs.shrink_to_fit();
+    return cache;
+}
+
+std::unique_ptr<RelTableCSRCache> RelTableCSRCache::build(transaction_t snapshotTS,
+    table_id_t nbrTableID, MemoryManager& memoryManager, offset_t numBoundNodes,
+    const std::function<void(offset_t, std::vector<offset_t>&)>& getNbrs) {
+    auto cache = std::unique_ptr<RelTableCSRCache>(
+        new RelTableCSRCache(snapshotTS, nbrTableID, &memoryManager));
+    cache->offsets.reserve(numBoundNodes + 1);
+    std::vector<offset_t> nbrOffsets;
+    for (auto boundOffset = 0u; boundOffset < numBoundNodes; boundOffset++) {
+        nbrOffsets.clear();
+        getNbrs(boundOffset, nbrOffsets);
+        cache->appendNbrs(nbrOffsets);
+    }
+    cache->offsets.push_back(cache->nbrs.size());
+    cache->nbrs.shrink_to_fit();
+    return cache;
+}
+
+std::unique_ptr<RelTableCSRCache> RelTableCSRCache::relabel(const RelTableCSRCache& cache,
+    std::span<const offset_t> boundNewToOld, std::span<const offset_t> nbrOldToNew) {
+    auto result = std::unique_ptr<RelTableCSRCache>(
+        new RelTableCSRCache(cache.snapshotTS, cache.nbrTableID, cache.memoryManager));
+    result->offsets.reserve(boundNewToOld.size() + 1);
+    result->nbrs.reserve(cache.nbrs.size());
+    std::vector<offset_t> nbrOffsets;
+    for (auto oldBoundOffset : boundNewToOld) {
+        nbrOffsets.clear();
+        cache.decodeNbrs(oldBoundOffset, nbrOffsets);
+        for (auto& nbrOffset : nbrOffsets) {
+            KU_ASSERT(nbrOffset < nbrOldToNew.size());
+            nbrOffset = nbrOldToNew[nbrOffset];
+        }
+        result->appendNbrs(nbrOffsets);
+    }
+    result->offsets.push_back(result->nbrs.size());
+    result->nbrs.shrink_to_fit();
+    return result;
+}
+
+void RelTableCSRCache::appendNbrs(std::vector<offset_t>& nbrOffsets) {
+    offsets.push_back(nbrs.size());
+    std::sort(nbrOffsets.begin(), nbrOffsets.end());
+    offset_t prevOffset = 0;
+    for (auto offset : nbrOffsets) {
+        writeVarint(nbrs, offset - prevOffset);
+        prevOffset = offset;
+    }
+}
+
+RelTableCSRCache::Cursor RelTableCSRCache::getNbrs(offset_t boundOffset) const {
+    if (boundOffset + 1 >= offsets.size()) {
+        return Cursor{};
+    }
+    return Cursor{nbrs.data() + offsets[boundOffset], nbrs.data() + offsets[boundOffset + 1],
+        nbrTableID};
+}
+
+std::span<const uint8_t> RelTableCSRCache::getEncodedNbrs(offset_t boundOffset) const {
+    if (boundOffset + 1 >= offsets.size()) {
+        return {};
+    }
+    return std::span{nbrs.data() + offsets[boundOffset],
+        offsets[boundOffset + 1] - offsets[boundOffset]};
+}
+
+void RelTableCSRCache::decodeNbrs(offset_t boundOffset, std::vector<offset_t>& nbrOffsets) const {
+    auto encodedNbrs = getEncodedNbrs(boundOffset);
+    auto data = encodedNbrs.data();
+    offset_t nbrOffset = 0;
+    while (data != encodedNbrs.data() + encodedNbrs.size()) {
+        nbrOffset += readVarint(data);
+        nbrOffsets.push_back(nbrOffset);
+    }
+}
+
+void RelTableCSRCache::diffNbrs(const RelTableCSRCache& other, offset_t boundOffset,
+    std::vector<offset_t>& added, std::vector<offset_t>& removed) const {
+    auto encodedNbrs = getEncodedNbrs(boundOffset);
+    auto otherEncodedNbrs = other.getEncodedNbrs(boundOffset);
+    // Neighbours are sorted, so equal lists have equal encodings.
+    if (std::equal(encodedNbrs.begin(), encodedNbrs.end(), otherEncodedNbrs.begin(),
+            otherEncodedNbrs.end())) {
+        return;
+    }
+    std::vector<offset_t> nbrOffsets, otherNbrOffsets;
+    decodeNbrs(boundOffset, nbrOffsets);
+    other.decodeNbrs(boundOffset, otherNbrOffsets);
+    std::set_difference(nbrOffsets.begin(), nbrOffsets.end(), otherNbrOffsets.begin(),
+        otherNbrOffsets.end(), std::back_inserter(added));
+    std::set_difference(otherNbrOffsets.begin(), otherNbrOffsets.end(), nbrOffsets.begin(),
+        nbrOffsets.end(), std::back_inserter(removed));
+}
+
+uint64_t RelTableCSRCache::getNumNbrs(offset_t boundOffset) const {
+    auto encodedNbrs = getEncodedNbrs(boundOffset);
+    // Every varint ends with the only byte of it that has the high bit unset.
+    return std::count_if(encodedNbrs.begin(), encodedNbrs.end(),
+        [](uint8_t byte) { return !(byte & 0x80); });
+}
+
+sel_t RelTableCSRCache::Cursor::next(ValueVector& dstVector) {
+    sel_t numNbrs = 0;
+    while (data != end && numNbrs < DEFAULT_VECTOR_CAPACITY) {
+        prevOffset += readVarint(data);
+        dstVector.setValue<nodeID_t>(numNbrs++, nodeID_t{prevOffset, nbrTableID});
+    }
+    return numNbrs;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,298 @@
+#include "storage/table/rel_table_reverse_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "catalog/catalog.h"
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/exception/interrupt.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/vector/value_vector.h"
+#include "main/async_query_executor.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+class ReverseIndexBuildTask final : public Task {
+public:
+    ReverseIndexBuildTask(uint64_t maxNumThreads, std::function<void()> work)
+        : Task{maxNumThreads}, work{std::move(work)} {}
+
+    void run() override { work(); }
+
+    std::string getName() const override { return "REVERSE_INDEX_BUILD"; }
+
+private:
+    std::function<void()> work;
+};
+
+// Runs work on numThreads workers of the task scheduler, each taking units of work until none is
+// left, or on the calling thread alone.
+static void runWorkers(ClientContext& context, uint64_t numThreads,
+    const std::function<void()>& work) {
+    if (numThreads <= 1) {
+        work();
+        return;
+    }
+    auto task = std::make_shared<ReverseIndexBuildTask>(numThreads, work);
+    processor::ExecutionContext executionContext{nullptr /* profiler */, &context,
+        0 /* queryID */};
+    TaskScheduler::Get(context)->scheduleTaskAndWaitOrError(task, &executionContext,
+        true /* launchNewWorkerThread */);
+}
+
+struct RelTableReverseIndex::Builder {
+    struct Entry {
+        offset_t dstOffset;
+        Rel rel;
+
+        bool operator<(const Entry& other) const {
+            if (dstOffset != other.dstOffset) {
+                return dstOffset < other.dstOffset;
+            }
+            if (rel.srcOffset != other.rel.srcOffset) {
+                return rel.srcOffset < other.rel.srcOffset;
+            }
+            return rel.relOffset < other.rel.relOffset;
+        }
+    };
+
+    ClientContext& context;
+    RelTable& table;
+    RelTableReverseIndex& index;
+    Transaction* transaction;
+    table_id_t srcTableID;
+    offset_t numSrcNodes;
+    node_group_idx_t numSrcNodeGroups;
+    std::atomic<node_group_idx_t> nextSrcNodeGroupIdx;
+    std::mutex mtx;
+    // The rels of each partition, in one run per worker which found rels of the partition.
+    std::vector<std::vector<std::vector<Entry>>> runs;
+    std::atomic<idx_t> nextPartitionIdx;
+
+    Builder(ClientContext& context, RelTable& table, RelTableReverseIndex& index)
+        : context{context}, table{table}, index{index},
+          transaction{Transaction::Get(context)}, srcTableID{table.getFromNodeTableID()},
+          nextSrcNodeGroupIdx{0}, nextPartitionIdx{0} {
+        numSrcNodes =
+            StorageManager::Get(context)->getTable(srcTableID)->getNumTotalRows(transaction);
+        numSrcNodeGroups = (numSrcNodes + StorageConfig::NODE_GROUP_SIZE - 1) /
+                           StorageConfig::NODE_GROUP_SIZE;
+    }
+
+    // Scans the forward rels of node groups of source nodes, and partitions them on the node group
+    // of their destination node.
+    void partitionRels() {
+        auto& memoryManager = *MemoryManager::Get(context);
+        ValueVector srcNodeIDVector(LogicalType::INTERNAL_ID(), &memoryManager,
+            DataChunkState::getSingleValueDataChunkState());
+        auto outState = std::make_shared<DataChunkState>();
+        ValueVector dstNodeIDVector(LogicalType::INTERNAL_ID(), &memoryManager, outState);
+        ValueVector relIDVector(LogicalType::INTERNAL_ID(), &memoryManager, outState);
+        RelTableScanState scanState(memoryManager, &srcNodeIDVector,
+            {&dstNodeIDVector, &relIDVector}, outState);
+        scanState.setToTable(transaction, &table, {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID}, {},
+            RelDataDirection::FWD);
+        std::vector<std::vector<Entry>> localRuns;
+        while (true) {
+            const auto nodeGroupIdx = nextSrcNodeGroupIdx.fetch_add(1);
+            if (nodeGroupIdx >= numSrcNodeGroups) {
+                break;
+            }
+            if (context.interrupted()) {
+                throw InterruptException{};
+            }
+            const auto startOffset = nodeGroupIdx * StorageConfig::NODE_GROUP_SIZE;
+            const auto endOffset =
+                std::min<offset_t>(startOffset + StorageConfig::NODE_GROUP_SIZE, numSrcNodes);
+            for (auto srcOffset = startOffset; srcOffset < endOffset; srcOffset++) {
+                srcNodeIDVector.setValue<nodeID_t>(0, nodeID_t{srcOffset, srcTableID});
+                outState->getSelVectorUnsafe().setSelSize(0);
+                table.initScanState(transaction, scanState);
+                while (table.scan(transaction, scanState)) {
+                    auto& selVector = outState->getSelVector();
+                    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                        const auto dstOffset =
+                            dstNodeIDVector.getValue<nodeID_t>(selVector[i]).offset;
+                        const auto relOffset =
+                            relIDVector.getValue<internalID_t>(selVector[i]).offset;
+                        const auto partitionIdx = StorageUtils::getNodeGroupIdx(dstOffset);
+                        if (partitionIdx >= localRuns.size()) {
+                            localRuns.resize(partitionIdx + 1);
+                        }
+                        localRuns[partitionIdx].push_back({dstOffset, {srcOffset, relOffset}});
+                    }
+                }
+            }
+        }
+        std::unique_lock lck{mtx};
+        if (localRuns.size() > runs.size()) {
+            runs.resize(localRuns.size());
+        }
+        for (auto i = 0u; i < localRuns.size(); i++) {
+            if (!localRuns[i].empty()) {
+                runs[i].push_back(std::move(localRuns[i]));
+            }
+        }
+    }
+
+    // Sorts the runs of partitions into the CSR of their destination nodes.
+    void buildPartitions() {
+        std::vector<Entry> entries;
+        while (true) {
+            const auto partitionIdx = nextPartitionIdx.fetch_add(1);
+            if (partitionIdx >= runs.size()) {
+                return;
+            }
+            if (context.interrupted()) {
+                throw InterruptException{};
+            }
+            entries.clear();
+            for (auto& run : runs[partitionIdx]) {
+                entries.insert(entries.end(), run.begin(), run.end());
+                run = std::vector<Entry>{};
+            }
+            if (entries.empty()) {
+                continue;
+            }
+            std::sort(entries.begin(), entries.end());
+            const auto startOffset = partitionIdx * StorageConfig::NODE_GROUP_SIZE;
+            auto& partition = index.partitions[partitionIdx];
+            partition.offsets.assign(entries.back().dstOffset - startOffset + 2, 0);
+            partition.rels.reserve(entries.size());
+            for (auto& entry : entries) {
+                partition.offsets[entry.dstOffset - startOffset + 1]++;
+                partition.rels.push_back(entry.rel);
+            }
+            for (auto i = 1u; i < partition.offsets.size(); i++) {
+                partition.offsets[i] += partition.offsets[i - 1];
+            }
+        }
+    }
+};
+
+std::unique_ptr<RelTableReverseIndex> RelTableReverseIndex::build(ClientContext& context,
+    RelTable& table, uint64_t numThreads) {
+    const auto transaction = Transaction::Get(context);
+    auto index =
+        std::unique_ptr<RelTableReverseIndex>(new RelTableReverseIndex(transaction->getStartTS()));
+    Builder builder{context, table, *index};
+    runWorkers(context, std::min<uint64_t>(numThreads, builder.numSrcNodeGroups),
+        [&builder]() { builder.partitionRels(); });
+    index->partitions.resize(builder.runs.size());
+    runWorkers(context, std::min<uint64_t>(numThreads, builder.runs.size()),
+        [&builder]() { builder.buildPartitions(); });
+    for (auto& partition : index->partitions) {
+        index->numRels += partition.rels.size();
+    }
+    return index;
+}
+
+void RelTableReverseIndex::scheduleBuild(ClientContext& context, RelTable& table) {
+    const auto epoch = table.startReverseIndexBuild();
+    if (!epoch.has_value()) {
+        return;
+    }
+    const auto database = context.getDatabase();
+    const auto tableID = table.getTableID();
+    database->getAsyncQueryExecutor()->submit(nullptr /* key */,
+        [database, tableID, epoch = *epoch]() {
+            ClientContext buildContext(database);
+            buildContext.getClientConfigUnsafe()->schedulingClass = SchedulingClass::BACKGROUND;
+            const auto transactionContext = TransactionContext::Get(buildContext);
+            RelTable* relTable = nullptr;
+            try {
+                transactionContext->beginReadTransaction();
+                // Tables are only removed by checkpoints, which wait for active transactions.
+                relTable =
+                    &StorageManager::Get(buildContext)->getTable(tableID)->cast<RelTable>();
+                auto index = build(buildContext, *relTable, buildContext.getMaxNumThreadForExec());
+                const auto installed =
+                    relTable->finishReverseIndexBuild(buildContext, std::move(index), epoch);
+                transactionContext->commit();
+                if (installed) {
+                    catalog::Catalog::Get(buildContext)->invalidateCachedPlans();
+                }
+            } catch (std::exception&) {
+                if (relTable != nullptr) {
+                    relTable->finishReverseIndexBuild(buildContext, nullptr, epoch);
+                }
+                transactionContext->rollback();
+            }
+        });
+}
+
+bool RelTableReverseIndex::canBeReadBy(const Transaction* transaction) const {
+    return transaction->isReadOnly() && snapshotTS <= transaction->getStartTS();
+}
+
+std::span<const RelTableReverseIndex::Rel> RelTableReverseIndex::getRels(
+    offset_t dstOffset) const {
+    const auto partitionIdx = StorageUtils::getNodeGroupIdx(dstOffset);
+    if (partitionIdx >= partitions.size()) {
+        return {};
+    }
+    auto& partition = partitions[partitionIdx];
+    const auto offsetInPartition = dstOffset - partitionIdx * StorageConfig::NODE_GROUP_SIZE;
+    if (offsetInPartition + 1 >= partition.offsets.size()) {
+        return {};
+    }
+    const auto startIdx = partition.offsets[offsetInPartition];
+    return {partition.rels.data() + startIdx, partition.offsets[offsetInPartition + 1] - startIdx};
+}
+
+void RelTableReverseIndex::getInsertedRels(offset_t dstOffset, transaction_t startTS,
+    std::vector<Rel>& rels) const {
+    std::shared_lock lck{insertedRelsMtx};
+    if (!insertedRels.contains(dstOffset)) {
+        return;
+    }
+    for (auto& insertedRel : insertedRels.at(dstOffset)) {
+        if (insertedRel.commitTS <= startTS) {
+            rels.push_back(insertedRel.rel);
+        }
+    }
+}
+
+void RelTableReverseIndex::insertRel(offset_t dstOffset, Rel rel, transaction_t commitTS) {
+    KU_ASSERT(commitTS > snapshotTS);
+    std::unique_lock lck{insertedRelsMtx};
+    insertedRels[dstOffset].push_back({rel, commitTS});
+    numInsertedRels++;
+}
+
+uint64_t RelTableReverseIndex::getNumInsertedRels() const {
+    std::shared_lock lck{insertedRelsMtx};
+    return numInsertedRels;
+}
+
+uint64_t RelTableReverseIndex::getMemoryUsage() const {
+    uint64_t memoryUsage = partitions.capacity() * sizeof(Partition);
+    for (auto& partition : partitions) {
+        memoryUsage += partition.offsets.capacity() * sizeof(uint64_t) +
+                       partition.rels.capacity() * sizeof(Rel);
+    }
+    std::shared_lock lck{insertedRelsMtx};
+    for (auto& [_, rels] : insertedRels) {
+        memoryUsage += sizeof(offset_t) + rels.capacity() * sizeof(InsertedRel);
+    }
+    return memoryUsage;
+}
+
+} // namespace storage
+} // namespace kuzu
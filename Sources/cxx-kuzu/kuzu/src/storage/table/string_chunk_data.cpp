@@ -249,6 +249,29 @@ void StringChunkData::finalize() {
     dictionaryChunk = std::move(newDictionaryChunk);
 }
 
+std::vector<VectorZoneMap> StringChunkData::computeVectorZoneMaps() const {
+    if (numValues <= DEFAULT_VECTOR_CAPACITY) {
+        return {};
+    }
+    std::vector<VectorZoneMap> zoneMaps;
+    for (offset_t startRow = 0; startRow < numValues; startRow += DEFAULT_VECTOR_CAPACITY) {
+        const auto numRows = std::min(DEFAULT_VECTOR_CAPACITY, numValues - startRow);
+        auto zoneMap = VectorZoneMap{StorageValue{UINT64_MAX}, StorageValue{uint64_t{0}},
+            static_cast<uint32_t>(numRows), 0 /*numNulls*/};
+        for (auto row = startRow; row < startRow + numRows; row++) {
+            if (nullData->isNull(row)) {
+                zoneMap.numNulls++;
+                continue;
+            }
+            const auto prefix = StringPrefix::get(getValue<std::string_view>(row));
+            zoneMap.min.unsignedInt = std::min(zoneMap.min.unsignedInt, prefix);
+            zoneMap.max.unsignedInt = std::max(zoneMap.max.unsignedInt, prefix);
+        }
+        zoneMaps.push_back(zoneMap);
+    }
+    return zoneMaps;
+}
+
 void StringChunkData::flush(PageAllocator& pageAllocator) {
     ColumnChunkData::flush(pageAllocator);
     indexColumnChunk->flush(pageAllocator);
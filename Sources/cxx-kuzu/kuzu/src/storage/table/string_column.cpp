@@ -5,12 +5,14 @@
 
 #include "common/assert.h"
 #include "common/cast.h"
+#include "common/data_chunk/data_chunk_state.h"
 #include "common/null_mask.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
 #include "storage/page_allocator.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column.h"
 #include "storage/table/column_chunk.h"
@@ -56,10 +58,15 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), pageAllocator));
     auto& dictChunk = stringChunk.getDictionaryChunk();
-    flushedStringData.getDictionaryChunk().setOffsetChunk(
-        Column::flushChunkData(*dictChunk.getOffsetChunk(), pageAllocator));
-    flushedStringData.getDictionaryChunk().setStringDataChunk(
-        Column::flushChunkData(*dictChunk.getStringDataChunk(), pageAllocator));
+    auto encoded = dictChunk.encodeWithFSST();
+    flushedStringData.getDictionaryChunk().setOffsetChunk(Column::flushChunkData(
+        encoded ? *encoded->offsetChunk : *dictChunk.getOffsetChunk(), pageAllocator));
+    auto flushedStringDataChunk = Column::flushChunkData(
+        encoded ? *encoded->stringDataChunk : *dictChunk.getStringDataChunk(), pageAllocator);
+    if (encoded) {
+        DictionaryChunk::setFSSTMetadata(*flushedStringDataChunk, encoded->symbolTable);
+    }
+    flushedStringData.getDictionaryChunk().setStringDataChunk(std::move(flushedStringDataChunk));
     return flushedChunkData;
 }
 
@@ -76,6 +83,74 @@ void StringColumn::lookupInternal(const SegmentState& state, offset_t nodeOffset
         getChildState(state, ChildStateIndex::INDEX).metadata);
 }
 
+void StringColumn::select(const ChunkState& state, offset_t offsetInChunk, length_t length,
+    const ColumnPredicateSet& predicates, SelectionVector& selVector) const {
+    // Other types stored as strings (e.g. BLOB) do not compare the same way as their bytes.
+    if (dataType.getLogicalTypeID() != LogicalTypeID::STRING || !predicates.canEvaluateStrings()) {
+        return;
+    }
+    KU_ASSERT(length <= DEFAULT_VECTOR_CAPACITY);
+    auto nullState = std::make_shared<DataChunkState>();
+    nullState->getSelVectorUnsafe().setToUnfiltered(length);
+    ValueVector nullVector(LogicalType::BOOL(), mm, nullState);
+    std::vector<uint8_t> isSelected(length, false);
+    state.rangeSegments(offsetInChunk, length,
+        [&](auto& segmentState, auto offsetInSegment, auto lengthInSegment, auto dstOffset) {
+            selectInSegment(segmentState, offsetInSegment, lengthInSegment, predicates, nullVector,
+                dstOffset, isSelected);
+        });
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += isSelected[pos];
+    }
+    selVector.setToFiltered(numSelected);
+}
+
+void StringColumn::selectInSegment(const SegmentState& state, offset_t offsetInSegment,
+    length_t length, const ColumnPredicateSet& predicates, ValueVector& nullVector,
+    offset_t offsetInResult, std::vector<uint8_t>& isSelected) const {
+    nullColumn->scanSegment(*state.nullState, offsetInSegment, length, &nullVector,
+        offsetInResult);
+    std::vector<string_index_t> indices(length);
+    indexColumn->scanSegment(getChildState(state, ChildStateIndex::INDEX), offsetInSegment, length,
+        reinterpret_cast<uint8_t*>(indices.data()));
+    // Map each distinct index to the position its string is scanned to, so that every string is
+    // read and evaluated once.
+    std::unordered_map<string_index_t, uint64_t> indexMap;
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
+    std::vector<uint64_t> dictPositions(length);
+    for (auto i = 0u; i < length; i++) {
+        if (nullVector.isNull(offsetInResult + i)) {
+            continue;
+        }
+        auto [entry, inserted] = indexMap.try_emplace(indices[i], offsetsToScan.size());
+        if (inserted) {
+            offsetsToScan.emplace_back(indices[i], offsetsToScan.size());
+        }
+        dictPositions[i] = entry->second;
+    }
+    if (offsetsToScan.empty()) {
+        return;
+    }
+    const auto numDistinctValues = offsetsToScan.size();
+    ValueVector dictVector(LogicalType::STRING(), mm);
+    dictionary.scan(getChildState(state, ChildStateIndex::OFFSET),
+        getChildState(state, ChildStateIndex::DATA), offsetsToScan, &dictVector,
+        getChildState(state, ChildStateIndex::INDEX).metadata);
+    std::vector<uint8_t> dictResults(numDistinctValues);
+    for (auto i = 0u; i < numDistinctValues; i++) {
+        dictResults[i] =
+            predicates.evaluateStrings(dictVector.getValue<ku_string_t>(i).getAsStringView());
+    }
+    for (auto i = 0u; i < length; i++) {
+        isSelected[offsetInResult + i] =
+            !nullVector.isNull(offsetInResult + i) && dictResults[dictPositions[i]];
+    }
+}
+
 void StringColumn::writeSegment(ColumnChunkData& persistentChunk, SegmentState& state,
     offset_t dstOffsetInSegment, const ColumnChunkData& data, offset_t srcOffset,
     length_t numValues) const {
@@ -103,10 +178,10 @@ void StringColumn::writeSegment(ColumnChunkData& persistentChunk, SegmentState&
     auto [min, max] = std::minmax_element(indices.begin(), indices.end());
     auto minWritten = StorageValue(*min);
     auto maxWritten = StorageValue(*max);
-    updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment + numValues - 1, minWritten,
-        maxWritten);
-    indexColumn->updateStatistics(stringPersistentChunk.getIndexColumnChunk()->getMetadata(),
+    updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment,
         dstOffsetInSegment + numValues - 1, minWritten, maxWritten);
+    indexColumn->updateStatistics(stringPersistentChunk.getIndexColumnChunk()->getMetadata(),
+        dstOffsetInSegment, dstOffsetInSegment + numValues - 1, minWritten, maxWritten);
 }
 
 std::vector<std::unique_ptr<ColumnChunkData>> StringColumn::checkpointSegment(
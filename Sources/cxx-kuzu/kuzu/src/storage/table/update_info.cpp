@@ -29,14 +29,11 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
             // Same transaction, we can update the existing vector info.
             KU_ASSERT(current->version >= Transaction::START_TRANSACTION_ID);
             vecUpdateInfo = current;
-        } else if (current->version > transaction->getStartTS()) {
-            // Potentially there can be conflicts. `current` can be uncommitted transaction (version
-            // is transaction ID) or committed transaction started after this transaction.
-            for (auto i = 0u; i < current->numRowsUpdated; i++) {
-                if (current->rowsInVector[i] == rowIdxInVector) {
-                    throw RuntimeException("Write-write conflict of updating the same row.");
-                }
-            }
+        } else if (current->version > transaction->getStartTS() &&
+                   current->hasRow(rowIdxInVector)) {
+            // `current` can be uncommitted transaction (version is transaction ID) or committed
+            // transaction started after this transaction.
+            throw RuntimeException("Write-write conflict of updating the same row.");
         }
         current = current->prev.get();
     }
@@ -55,10 +52,12 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
     KU_ASSERT(vecUpdateInfo);
     // Check if the row is already updated in this transaction.
     idx_t idxInUpdateData = INVALID_IDX;
-    for (auto i = 0u; i < vecUpdateInfo->numRowsUpdated; i++) {
-        if (vecUpdateInfo->rowsInVector[i] == rowIdxInVector) {
-            idxInUpdateData = i;
-            break;
+    if (vecUpdateInfo->hasRow(rowIdxInVector)) {
+        for (auto i = 0u; i < vecUpdateInfo->numRowsUpdated; i++) {
+            if (vecUpdateInfo->rowsInVector[i] == rowIdxInVector) {
+                idxInUpdateData = i;
+                break;
+            }
         }
     }
     if (idxInUpdateData != INVALID_IDX) {
@@ -66,9 +65,9 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
         vecUpdateInfo->data->write(&values, values.state->getSelVector()[0], idxInUpdateData);
     } else {
         // Append new value and update `rowsInVector`.
-        vecUpdateInfo->rowsInVector[vecUpdateInfo->numRowsUpdated] = rowIdxInVector;
         vecUpdateInfo->data->write(&values, values.state->getSelVector()[0],
-            vecUpdateInfo->numRowsUpdated++);
+            vecUpdateInfo->numRowsUpdated);
+        vecUpdateInfo->appendRow(rowIdxInVector);
     }
     return *vecUpdateInfo;
 }
@@ -200,6 +199,96 @@ void UpdateInfo::rollback(idx_t vectorIdx, transaction_t version) {
     }
 }
 
+void UpdateInfo::vacuum(idx_t vectorIdx, transaction_t minActiveStartTS) {
+    UpdateNode* header = nullptr;
+    {
+        std::shared_lock lock{mtx};
+        if (vectorIdx >= updates.size()) {
+            return;
+        }
+        header = updates[vectorIdx].get();
+    }
+    std::unique_lock chainLock{header->mtx};
+    // Versions of the same row appear in the chain in commit order, because updating a row that
+    // has an uncommitted or newer version is a write-write conflict. A row of a version visible to
+    // every transaction is thus never read if a newer such version has it. Otherwise, it can be
+    // moved into the newest such version unless a newer version not yet visible to every
+    // transaction has the row.
+    std::bitset<DEFAULT_VECTOR_CAPACITY> rowsInNewerVisibleVersions;
+    std::bitset<DEFAULT_VECTOR_CAPACITY> rowsInNewerOtherVersions;
+    VectorUpdateInfo* newestVisible = nullptr;
+    auto current = header->info.get();
+    while (current) {
+        const auto prev = current->getPrev();
+        const auto isVisibleToAll = current->version < Transaction::START_TRANSACTION_ID &&
+                                    current->version <= minActiveStartTS;
+        if (!isVisibleToAll) {
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                rowsInNewerOtherVersions[current->rowsInVector[i]] = true;
+            }
+            current = prev;
+            continue;
+        }
+        if (!newestVisible) {
+            newestVisible = current;
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                rowsInNewerVisibleVersions[current->rowsInVector[i]] = true;
+            }
+            current = prev;
+            continue;
+        }
+        auto canRemove = true;
+        for (auto i = 0u; i < current->numRowsUpdated; i++) {
+            const auto row = current->rowsInVector[i];
+            if (!rowsInNewerVisibleVersions[row] && rowsInNewerOtherVersions[row]) {
+                canRemove = false;
+                break;
+            }
+        }
+        if (canRemove) {
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                const auto row = current->rowsInVector[i];
+                if (rowsInNewerVisibleVersions[row]) {
+                    continue;
+                }
+                newestVisible->data->write(current->data.get(), i, newestVisible->numRowsUpdated,
+                    1 /* numValues */);
+                newestVisible->appendRow(row);
+                rowsInNewerVisibleVersions[row] = true;
+            }
+            // `current` is never the head of the chain, as newestVisible is newer.
+            KU_ASSERT(current->next);
+            auto prevVersion = current->movePrev();
+            if (prevVersion) {
+                prevVersion->next = current->next;
+            }
+            current->next->setPrev(std::move(prevVersion));
+        } else {
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                rowsInNewerVisibleVersions[current->rowsInVector[i]] = true;
+            }
+        }
+        current = prev;
+    }
+}
+
+uint64_t UpdateInfo::getNumVersions(idx_t vectorIdx) const {
+    const UpdateNode* header = nullptr;
+    {
+        std::shared_lock lock{mtx};
+        if (vectorIdx >= updates.size()) {
+            return 0;
+        }
+        header = updates[vectorIdx].get();
+    }
+    std::shared_lock chainLock{header->mtx};
+    uint64_t numVersions = 0;
+    for (auto current = header->info.get(); current; current = current->getPrev()) {
+        numVersions++;
+    }
+    return numVersions;
+}
+
 row_idx_t UpdateInfo::getNumUpdatedRows(const Transaction* transaction) const {
     std::unordered_set<row_idx_t> updatedRows;
     for (auto vectorIdx = 0u; vectorIdx < updates.size(); vectorIdx++) {
@@ -230,6 +319,12 @@ UpdateNode& UpdateInfo::getUpdateNode(idx_t vectorIdx) {
 }
 
 UpdateNode& UpdateInfo::getOrCreateUpdateNode(idx_t vectorIdx) {
+    {
+        std::shared_lock lock{mtx};
+        if (vectorIdx < updates.size()) {
+            return *updates[vectorIdx];
+        }
+    }
     std::unique_lock lock{mtx};
     if (vectorIdx >= updates.size()) {
         updates.resize(vectorIdx + 1);
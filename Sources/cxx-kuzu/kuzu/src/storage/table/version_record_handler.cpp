@@ -12,4 +12,10 @@ void VersionRecordHandler::rollbackInsert(main::ClientContext* context,
         transaction::Transaction::Get(*context)->getCommitTS());
 }
 
+void VersionRecordHandler::commitDelete(common::node_group_idx_t nodeGroupIdx,
+    common::row_idx_t startRow, common::row_idx_t numRows, common::transaction_t commitTS) const {
+    applyFuncToChunkedGroups(&ChunkedNodeGroup::commitDelete, nodeGroupIdx, startRow, numRows,
+        commitTS);
+}
+
 } // namespace kuzu::storage
@@ -175,6 +175,17 @@ void UndoBuffer::rollback(ClientContext* context) const {
     });
 }
 
+void UndoBuffer::vacuumUpdates(transaction_t minActiveStartTS) const {
+    UndoBufferIterator iterator{*this};
+    iterator.iterate([&](UndoRecordType entryType, uint8_t const* entry) {
+        if (entryType != UndoRecordType::UPDATE_INFO) {
+            return;
+        }
+        auto& undoRecord = *reinterpret_cast<VectorUpdateRecord const*>(entry);
+        undoRecord.updateInfo->vacuum(undoRecord.vectorIdx, minActiveStartTS);
+    });
+}
+
 void UndoBuffer::commitRecord(UndoRecordType recordType, const uint8_t* record,
     transaction_t commitTS) {
     switch (recordType) {
@@ -212,8 +223,8 @@ void UndoBuffer::commitVersionInfo(UndoRecordType recordType, const uint8_t* rec
             undoRecord.nodeGroupIdx, undoRecord.startRow, undoRecord.numRows, commitTS);
     } break;
     case UndoRecordType::DELETE_INFO: {
-        undoRecord.versionRecordHandler->applyFuncToChunkedGroups(&ChunkedNodeGroup::commitDelete,
-            undoRecord.nodeGroupIdx, undoRecord.startRow, undoRecord.numRows, commitTS);
+        undoRecord.versionRecordHandler->commitDelete(undoRecord.nodeGroupIdx, undoRecord.startRow,
+            undoRecord.numRows, commitTS);
     } break;
     default: {
         KU_UNREACHABLE;
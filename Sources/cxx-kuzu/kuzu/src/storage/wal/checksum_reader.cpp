@@ -13,7 +13,12 @@ static constexpr uint64_t INITIAL_BUFFER_SIZE = common::KUZU_PAGE_SIZE;
 
 ChecksumReader::ChecksumReader(common::FileInfo& fileInfo, MemoryManager& memoryManager,
     std::string_view checksumMismatchMessage)
-    : deserializer(std::make_unique<common::BufferedFileReader>(fileInfo)),
+    : ChecksumReader(std::make_unique<common::BufferedFileReader>(fileInfo), memoryManager,
+          checksumMismatchMessage) {}
+
+ChecksumReader::ChecksumReader(std::unique_ptr<common::Reader> reader,
+    MemoryManager& memoryManager, std::string_view checksumMismatchMessage)
+    : deserializer(std::move(reader)),
       entryBuffer(memoryManager.allocateBuffer(false, INITIAL_BUFFER_SIZE)),
       checksumMismatchMessage(checksumMismatchMessage) {}
 
@@ -93,6 +93,7 @@ void LocalWAL::logLoadExtension(std::string path) {
 void LocalWAL::clear() {
     std::unique_lock lck{mtx};
     serializer.getWriter()->clear();
+    recordEndOffsets.clear();
 }
 
 uint64_t LocalWAL::getSize() {
@@ -107,6 +108,7 @@ void LocalWAL::addNewWALRecord(const WALRecord& walRecord) {
     serializer.getWriter()->onObjectBegin();
     walRecord.serialize(serializer);
     serializer.getWriter()->onObjectEnd();
+    recordEndOffsets.push_back(inMemWriter->getSize());
 }
 
 } // namespace storage
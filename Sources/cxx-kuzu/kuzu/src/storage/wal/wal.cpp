@@ -1,5 +1,9 @@
 #include "storage/wal/wal.h"
 
+#include <chrono>
+#include <thread>
+
+#include "common/exception/io.h"
 #include "common/file_system/file_info.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
@@ -7,11 +11,13 @@
 #include "main/client_context.h"
 #include "main/database.h"
 #include "main/db_config.h"
+#include "storage/database_header.h"
 #include "storage/file_db_id_utils.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/wal/checksum_writer.h"
 #include "storage/wal/local_wal.h"
+#include "zstd.h"
 
 using namespace kuzu::common;
 
@@ -25,33 +31,131 @@ WAL::WAL(const std::string& dbPath, bool readOnly, bool enableChecksums, Virtual
 
 WAL::~WAL() {}
 
-void WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
+// A batch of whole records of a local WAL. The batch is written compressed unless compression does
+// not make it smaller, in which case its records are written as they are.
+struct WALFrame {
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> compressedData;
+
+    bool isCompressed() const { return !compressedData.empty(); }
+};
+
+static std::vector<WALFrame> compressIntoFrames(const InMemFileWriter& inMemWriter,
+    const std::vector<uint64_t>& recordEndOffsets) {
+    std::vector<WALFrame> frames;
+    uint64_t frameStart = 0;
+    for (auto i = 0u; i < recordEndOffsets.size(); i++) {
+        const auto frameEnd = recordEndOffsets[i];
+        if (frameEnd - frameStart < WAL::COMPRESSED_FRAME_SIZE &&
+            i + 1 < recordEndOffsets.size()) {
+            continue;
+        }
+        WALFrame frame;
+        frame.data.resize(frameEnd - frameStart);
+        inMemWriter.copyTo(frameStart, frame.data.size(), frame.data.data());
+        frame.compressedData.resize(kuzu_zstd::ZSTD_compressBound(frame.data.size()));
+        const auto compressedSize = kuzu_zstd::ZSTD_compress(frame.compressedData.data(),
+            frame.compressedData.size(), frame.data.data(), frame.data.size(), 1 /* level */);
+        if (kuzu_zstd::ZSTD_isError(compressedSize) || compressedSize >= frame.data.size()) {
+            frame.compressedData.clear();
+        } else {
+            frame.compressedData.resize(compressedSize);
+        }
+        frames.push_back(std::move(frame));
+        frameStart = frameEnd;
+    }
+    return frames;
+}
+
+uint64_t WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
     KU_ASSERT(!readOnly);
     if (inMemory || localWAL.getSize() == 0) {
-        return; // No need to log empty WAL.
+        return 0; // No need to log empty WAL.
+    }
+    // Large transactions are compressed before taking the lock so that concurrent commits are not
+    // serialized behind the compression.
+    std::vector<WALFrame> frames;
+    if (localWAL.getSize() >= MIN_SIZE_TO_COMPRESS) {
+        frames = compressIntoFrames(*localWAL.inMemWriter, localWAL.recordEndOffsets);
     }
     std::unique_lock lck{mtx};
     initWriter(context);
-    localWAL.inMemWriter->flush(*serializer->getWriter());
-    flushAndSyncNoLock();
+    if (frames.empty()) {
+        localWAL.inMemWriter->flush(*serializer->getWriter());
+    } else {
+        writeFramesNoLock(frames);
+    }
+    numCommits.fetch_add(1, std::memory_order_relaxed);
+    return ++lastCommitSeq;
+}
+
+void WAL::waitForCommitDurable(uint64_t commitSeq, uint64_t maxDelayInMicros) {
+    if (commitSeq == 0) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    while (lastDurableCommitSeq < commitSeq) {
+        if (syncInProgress) {
+            syncCV.wait(lck);
+            continue;
+        }
+        syncInProgress = true;
+        if (maxDelayInMicros > 0) {
+            lck.unlock();
+            std::this_thread::sleep_for(std::chrono::microseconds(maxDelayInMicros));
+            lck.lock();
+        }
+        const auto syncedCommitSeq = lastCommitSeq;
+        std::exception_ptr exception = nullptr;
+        try {
+            serializer->getWriter()->flush();
+            lck.unlock();
+#if defined(KUZU_RUNTIME_CHECKS) || !defined(NDEBUG)
+            if (failSyncs.load()) {
+                throw IOException("Failed to sync the WAL file.");
+            }
+#endif
+            serializer->getWriter()->sync();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        if (!lck.owns_lock()) {
+            lck.lock();
+        }
+        syncInProgress = false;
+        if (!exception) {
+            lastDurableCommitSeq = std::max(lastDurableCommitSeq, syncedCommitSeq);
+            numSyncs.fetch_add(1, std::memory_order_relaxed);
+        }
+        syncCV.notify_all();
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
 }
 
 void WAL::logAndFlushCheckpoint(main::ClientContext* context) {
     std::unique_lock lck{mtx};
+    waitForInFlightSyncNoLock(lck);
     initWriter(context);
     CheckpointRecord walRecord;
     addNewWALRecordNoLock(walRecord);
     flushAndSyncNoLock();
+    // The sync above also made all commits appended so far durable.
+    lastDurableCommitSeq = lastCommitSeq;
+    syncCV.notify_all();
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): semantically non-const function.
 void WAL::clear() {
     std::unique_lock lck{mtx};
+    waitForInFlightSyncNoLock(lck);
     serializer->getWriter()->clear();
 }
 
 void WAL::reset() {
     std::unique_lock lck{mtx};
+    waitForInFlightSyncNoLock(lck);
     fileInfo.reset();
     serializer.reset();
     vfs->removeFileIfExists(walPath);
@@ -63,16 +167,40 @@ void WAL::flushAndSyncNoLock() {
     serializer->getWriter()->sync();
 }
 
+void WAL::waitForInFlightSyncNoLock(std::unique_lock<std::mutex>& lck) {
+    syncCV.wait(lck, [this] { return !syncInProgress; });
+}
+
 uint64_t WAL::getFileSize() {
     std::unique_lock lck{mtx};
     return serializer->getWriter()->getSize();
 }
 
+uint64_t WAL::flushAndGetFileSize(main::ClientContext& context) {
+    if (inMemory) {
+        return 0;
+    }
+    std::unique_lock lck{mtx};
+    waitForInFlightSyncNoLock(lck);
+    if (serializer) {
+        serializer->getWriter()->flush();
+        return fileInfo->getFileSize();
+    }
+    // The writer is only created by the first commit after the database is opened, but a WAL
+    // replayed when opening it is kept until the next checkpoint.
+    if (!vfs->fileOrPathExists(walPath, &context)) {
+        return 0;
+    }
+    return vfs->openFile(walPath, FileOpenFlags(FileFlags::READ_ONLY), &context)->getFileSize();
+}
+
 void WAL::writeHeader(main::ClientContext& context) {
     serializer->getWriter()->onObjectBegin();
     FileDBIDUtils::writeDatabaseID(*serializer,
         StorageManager::Get(context)->getOrInitDatabaseID(context));
     serializer->write(enableChecksums);
+    serializer->write(StorageVersionInfo::getStorageVersion());
+    serializer->write(StorageManager::Get(context)->getOrInitDatabaseHeader(context)->checkpointID);
     serializer->getWriter()->onObjectEnd();
 }
 
@@ -113,6 +241,17 @@ void WAL::addNewWALRecordNoLock(const WALRecord& walRecord) {
     serializer->getWriter()->onObjectEnd();
 }
 
+void WAL::writeFramesNoLock(const std::vector<WALFrame>& frames) {
+    for (auto& frame : frames) {
+        if (frame.isCompressed()) {
+            addNewWALRecordNoLock(CompressedRecordsRecord{enableChecksums, frame.data.size(),
+                std::span{frame.compressedData}});
+        } else {
+            serializer->getWriter()->write(frame.data.data(), frame.data.size());
+        }
+    }
+}
+
 WAL* WAL::Get(const main::ClientContext& context) {
     KU_ASSERT(context.getDatabase() && context.getDatabase()->getStorageManager());
     return &context.getDatabase()->getStorageManager()->getWAL();
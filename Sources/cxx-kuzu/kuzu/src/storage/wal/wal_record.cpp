@@ -1,11 +1,15 @@
 #include "storage/wal/wal_record.h"
 
+#include <cstring>
+
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "common/exception/runtime.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/wal/checksum_reader.h"
+#include "zstd.h"
 
 using namespace kuzu::common;
 using namespace kuzu::binder;
@@ -33,6 +37,9 @@ std::unique_ptr<WALRecord> WALRecord::deserialize(Deserializer& deserializer,
     case WALRecordType::COMMIT_RECORD: {
         walRecord = CommitRecord::deserialize(deserializer);
     } break;
+    case WALRecordType::COMPRESSED_RECORDS_RECORD: {
+        walRecord = CompressedRecordsRecord::deserialize(deserializer, clientContext);
+    } break;
     case WALRecordType::CREATE_CATALOG_ENTRY_RECORD: {
         walRecord = CreateCatalogEntryRecord::deserialize(deserializer);
     } break;
@@ -108,6 +115,78 @@ std::unique_ptr<CheckpointRecord> CheckpointRecord::deserialize(Deserializer&) {
     return std::make_unique<CheckpointRecord>();
 }
 
+void CompressedRecordsRecord::serialize(Serializer& serializer) const {
+    WALRecord::serialize(serializer);
+    serializer.writeDebuggingInfo("has_checksums");
+    serializer.write<bool>(hasChecksums);
+    serializer.writeDebuggingInfo("uncompressed_size");
+    serializer.write<uint64_t>(uncompressedSize);
+    serializer.writeDebuggingInfo("compressed_size");
+    serializer.write<uint64_t>(compressedData.size());
+    serializer.write(compressedData.data(), compressedData.size());
+}
+
+namespace {
+
+class DecompressedRecordsReader final : public Reader {
+public:
+    DecompressedRecordsReader(std::unique_ptr<uint8_t[]> data, uint64_t size)
+        : data{std::move(data)}, size{size}, offset{0} {}
+
+    void read(uint8_t* output, uint64_t numBytes) override {
+        if (offset + numBytes > size) {
+            throw RuntimeException("Corrupted wal file. Read beyond the compressed records.");
+        }
+        memcpy(output, data.get() + offset, numBytes);
+        offset += numBytes;
+    }
+    bool finished() override { return offset >= size; }
+
+private:
+    std::unique_ptr<uint8_t[]> data;
+    uint64_t size;
+    uint64_t offset;
+};
+
+} // namespace
+
+std::unique_ptr<CompressedRecordsRecord> CompressedRecordsRecord::deserialize(
+    Deserializer& deserializer, const main::ClientContext& clientContext) {
+    std::string key;
+    auto retVal = std::make_unique<CompressedRecordsRecord>();
+    deserializer.validateDebuggingInfo(key, "has_checksums");
+    deserializer.deserializeValue(retVal->hasChecksums);
+    deserializer.validateDebuggingInfo(key, "uncompressed_size");
+    deserializer.deserializeValue(retVal->uncompressedSize);
+    deserializer.validateDebuggingInfo(key, "compressed_size");
+    uint64_t compressedSize = 0;
+    deserializer.deserializeValue(compressedSize);
+    if (compressedSize > kuzu_zstd::ZSTD_compressBound(retVal->uncompressedSize)) {
+        throw RuntimeException("Corrupted wal file. Invalid size of compressed records.");
+    }
+    const auto compressed = std::make_unique<uint8_t[]>(compressedSize);
+    deserializer.read(compressed.get(), compressedSize);
+    auto decompressed = std::make_unique<uint8_t[]>(retVal->uncompressedSize);
+    const auto decompressedSize = kuzu_zstd::ZSTD_decompress(decompressed.get(),
+        retVal->uncompressedSize, compressed.get(), compressedSize);
+    if (kuzu_zstd::ZSTD_isError(decompressedSize) ||
+        decompressedSize != retVal->uncompressedSize) {
+        throw RuntimeException("Corrupted wal file. Failed to decompress WAL records.");
+    }
+    std::unique_ptr<Reader> reader = std::make_unique<DecompressedRecordsReader>(
+        std::move(decompressed), retVal->uncompressedSize);
+    if (retVal->hasChecksums) {
+        reader = std::make_unique<ChecksumReader>(std::move(reader),
+            *MemoryManager::Get(clientContext),
+            "Checksum verification failed, the WAL file is corrupted.");
+    }
+    Deserializer recordsDeserializer{std::move(reader)};
+    while (!recordsDeserializer.finished()) {
+        retVal->records.push_back(WALRecord::deserialize(recordsDeserializer, clientContext));
+    }
+    return retVal;
+}
+
 void CreateCatalogEntryRecord::serialize(Serializer& serializer) const {
     WALRecord::serialize(serializer);
     catalogEntry->serialize(serializer);
@@ -1,14 +1,21 @@
 #include "storage/wal/wal_replayer.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_entry/type_catalog_entry.h"
+#include "common/copy_constructors.h"
 #include "common/file_system/file_info.h"
 #include "common/file_system/file_system.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
+#include "common/task_system/progress_bar.h"
 #include "extension/extension_manager.h"
 #include "main/client_context.h"
 #include "processor/expression_mapper.h"
@@ -48,21 +55,36 @@ static WALHeader readWALHeader(Deserializer& deserializer) {
     uint8_t enableChecksumsBytes = 0;
     deserializer.deserializeValue(enableChecksumsBytes);
     header.enableChecksums = enableChecksumsBytes != 0;
+    deserializer.deserializeValue(header.storageVersion);
+    deserializer.deserializeValue(header.checkpointID);
 
     return header;
 }
 
 static Deserializer initDeserializer(FileInfo& fileInfo, main::ClientContext& clientContext,
-    bool enableChecksums) {
+    bool enableChecksums, uint64_t startOffset = 0) {
+    auto reader = std::make_unique<BufferedFileReader>(fileInfo);
+    reader->resetReadOffset(startOffset);
     if (enableChecksums) {
-        return Deserializer{std::make_unique<ChecksumReader>(fileInfo,
+        return Deserializer{std::make_unique<ChecksumReader>(std::move(reader),
             *MemoryManager::Get(clientContext), checksumMismatchMessage)};
     } else {
-        return Deserializer{std::make_unique<BufferedFileReader>(fileInfo)};
+        return Deserializer{std::move(reader)};
     }
 }
 
+static bool isStorageVersionMismatch(const WALHeader& header) {
+    return header.storageVersion != StorageVersionInfo::getStorageVersion();
+}
+
 static void checkWALHeader(const WALHeader& header, bool enableChecksums) {
+    if (isStorageVersionMismatch(header)) {
+        throw RuntimeException(
+            stringFormat("Trying to replay a WAL file written by a different version. WAL file "
+                         "version: {}, Current build storage version: {}. Please open the "
+                         "database with the version that wrote it and checkpoint it first.",
+                header.storageVersion, StorageVersionInfo::getStorageVersion()));
+    }
     if (enableChecksums != header.enableChecksums) {
         throw RuntimeException(stringFormat(
             "The database you are trying to open was serialized with enableChecksums={} but you "
@@ -81,7 +103,99 @@ static uint64_t getReadOffset(Deserializer& deSer, bool enableChecksums) {
     }
 }
 
-void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) const {
+static bool isCommitRecord(const WALRecord& walRecord) {
+    switch (walRecord.type) {
+    case WALRecordType::COMMIT_RECORD:
+        return true;
+    case WALRecordType::COMPRESSED_RECORDS_RECORD: {
+        auto& records = walRecord.constCast<CompressedRecordsRecord>().records;
+        return std::any_of(records.begin(), records.end(),
+            [](const auto& record) { return record->type == WALRecordType::COMMIT_RECORD; });
+    }
+    default:
+        return false;
+    }
+}
+
+// Deserializes WAL records on a background thread and hands them over, in order, to the replaying
+// thread, so that reading and decoding the WAL overlaps with applying the records. Records have to
+// be applied serially: they all go through the single recovery transaction, and node offsets are
+// assigned in insertion order.
+class WALRecordReader {
+public:
+    static constexpr uint64_t MAX_NUM_BUFFERED_RECORDS = 64;
+
+    WALRecordReader(Deserializer& deserializer, main::ClientContext& clientContext,
+        bool enableChecksums, uint64_t endOffset)
+        : thread{[this, &deserializer, &clientContext, enableChecksums, endOffset] {
+              readRecords(deserializer, clientContext, enableChecksums, endOffset);
+          }} {}
+
+    ~WALRecordReader() {
+        {
+            std::unique_lock lck{mtx};
+            stopped = true;
+        }
+        cv.notify_all();
+        thread.join();
+    }
+
+    DELETE_COPY_AND_MOVE(WALRecordReader);
+
+    // Returns the next record and the WAL offset it ends at, or nullptr once all records are read.
+    std::pair<std::unique_ptr<WALRecord>, uint64_t> next() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return !records.empty() || finished || exception; });
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        if (records.empty()) {
+            return {nullptr, 0};
+        }
+        auto record = std::move(records.front());
+        records.pop_front();
+        lck.unlock();
+        cv.notify_all();
+        return record;
+    }
+
+private:
+    void readRecords(Deserializer& deserializer, main::ClientContext& clientContext,
+        bool enableChecksums, uint64_t endOffset) {
+        try {
+            while (getReadOffset(deserializer, enableChecksums) < endOffset) {
+                KU_ASSERT(!deserializer.finished());
+                auto walRecord = WALRecord::deserialize(deserializer, clientContext);
+                auto offset = getReadOffset(deserializer, enableChecksums);
+                std::unique_lock lck{mtx};
+                cv.wait(lck, [&] { return records.size() < MAX_NUM_BUFFERED_RECORDS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                records.emplace_back(std::move(walRecord), offset);
+                lck.unlock();
+                cv.notify_all();
+            }
+            std::unique_lock lck{mtx};
+            finished = true;
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        cv.notify_all();
+    }
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::pair<std::unique_ptr<WALRecord>, uint64_t>> records;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr exception = nullptr;
+    std::thread thread;
+};
+
+uint64_t WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) const {
     auto vfs = VirtualFileSystem::GetUnsafe(clientContext);
     Checkpointer checkpointer(clientContext);
     // First, check if the WAL file exists. If it does not, we can safely remove the shadow file.
@@ -89,7 +203,7 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
         removeFileIfExists(shadowFilePath);
         // Read the checkpointed data from the disk.
         checkpointer.readCheckpoint();
-        return;
+        return 0;
     }
     // If the WAL file exists, we need to replay it.
     auto fileInfo = openWALFile();
@@ -98,7 +212,7 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
         removeWALAndShadowFiles();
         // Read the checkpointed data from the disk.
         checkpointer.readCheckpoint();
-        return;
+        return 0;
     }
     // A previous unclean exit may have left non-durable contents in the WAL, so before we start
     // replaying the WAL records, make a best-effort attempt at ensuring the WAL is fully durable.
@@ -116,6 +230,7 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
             removeWALAndShadowFiles();
             // Re-read checkpointed data from disk again as now the shadow file is applied.
             checkpointer.readCheckpoint();
+            return 0;
         } else {
             // There is no checkpoint record, so we should remove the shadow file if it exists.
             removeFileIfExists(shadowFilePath);
@@ -134,14 +249,29 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
                 deserializer.getReader()->onObjectEnd();
             }
 
-            while (getReadOffset(deserializer, enableChecksums) < offsetDeserialized) {
-                KU_ASSERT(!deserializer.finished());
-                auto walRecord = WALRecord::deserialize(deserializer, clientContext);
-                replayWALRecord(*walRecord);
+            auto progressBar = ProgressBar::Get(clientContext);
+            // Recovery runs before any query, so there is no query ID to report progress for.
+            constexpr uint64_t recoveryQueryID = INVALID_QUERY_ID;
+            progressBar->addPipeline();
+            progressBar->startProgress(recoveryQueryID);
+            {
+                WALRecordReader reader{deserializer, clientContext, enableChecksums,
+                    offsetDeserialized};
+                while (true) {
+                    auto [walRecord, offset] = reader.next();
+                    if (!walRecord) {
+                        break;
+                    }
+                    replayWALRecord(*walRecord);
+                    progressBar->updateProgress(recoveryQueryID,
+                        static_cast<double>(offset) / static_cast<double>(offsetDeserialized));
+                }
             }
+            progressBar->endProgress(recoveryQueryID);
             // After replaying all the records, we should truncate the WAL file to the last
             // COMMIT/CHECKPOINT record.
             truncateWALFile(*fileInfo, offsetDeserialized);
+            return offsetDeserialized;
         }
     } catch (const std::exception&) {
         auto transactionContext = TransactionContext::Get(clientContext);
@@ -156,16 +286,92 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
     }
 }
 
+void WALReplayer::replayShippedWAL(const std::string& shippedWALPath, uint64_t& replayedOffset,
+    bool enableChecksums) const {
+    auto vfs = VirtualFileSystem::GetUnsafe(clientContext);
+    if (!vfs->fileOrPathExists(shippedWALPath, &clientContext)) {
+        throw RuntimeException(
+            stringFormat("Cannot replay the WAL at {}, which does not exist.", shippedWALPath));
+    }
+    auto fileInfo =
+        vfs->openFile(shippedWALPath, FileOpenFlags(FileFlags::READ_ONLY), &clientContext);
+    if (fileInfo->getFileSize() == 0) {
+        return;
+    }
+    Deserializer headerDeserializer = initDeserializer(*fileInfo, clientContext, enableChecksums);
+    headerDeserializer.getReader()->onObjectBegin();
+    const auto walHeader = readWALHeader(headerDeserializer);
+    checkWALHeader(walHeader, enableChecksums);
+    headerDeserializer.getReader()->onObjectEnd();
+    const auto* databaseHeader =
+        StorageManager::Get(clientContext)->getOrInitDatabaseHeader(clientContext);
+    if (walHeader.databaseID.value != databaseHeader->databaseID.value ||
+        walHeader.checkpointID.value != databaseHeader->checkpointID.value) {
+        throw RuntimeException(stringFormat(
+            "The WAL at {} does not apply on top of the last checkpoint of this database. If it "
+            "was shipped from the database this one was backed up from, that database has "
+            "checkpointed since, and this one has to be backed up from it again.",
+            shippedWALPath));
+    }
+    const auto startOffset =
+        replayedOffset > 0 ? replayedOffset : getReadOffset(headerDeserializer, enableChecksums);
+    // The shipped WAL may end with a commit that is still being shipped, so only the commits that
+    // were completely shipped are replayed. If the WAL was shipped while its database was
+    // checkpointing, the records that follow the checkpoint record do not belong to it.
+    uint64_t endOffset = startOffset;
+    try {
+        Deserializer deserializer =
+            initDeserializer(*fileInfo, clientContext, enableChecksums, startOffset);
+        while (!deserializer.finished()) {
+            auto walRecord = WALRecord::deserialize(deserializer, clientContext);
+            if (walRecord->type == WALRecordType::CHECKPOINT_RECORD) {
+                break;
+            }
+            if (isCommitRecord(*walRecord)) {
+                endOffset = getReadOffset(deserializer, enableChecksums);
+            }
+        }
+    } catch (...) {} // NOLINT: A partially shipped commit is replayed once it is fully shipped.
+    if (endOffset == startOffset) {
+        return;
+    }
+    Deserializer deserializer =
+        initDeserializer(*fileInfo, clientContext, enableChecksums, startOffset);
+    try {
+        WALRecordReader reader{deserializer, clientContext, enableChecksums, endOffset};
+        while (true) {
+            auto [walRecord, offset] = reader.next();
+            if (!walRecord) {
+                break;
+            }
+            replayWALRecord(*walRecord);
+            // The offset advances one commit at a time, so that a commit that fails to replay is
+            // the first one replayed by the next attempt.
+            if (isCommitRecord(*walRecord)) {
+                replayedOffset = offset;
+            }
+        }
+    } catch (const std::exception&) {
+        auto transactionContext = TransactionContext::Get(clientContext);
+        if (transactionContext->hasActiveTransaction()) {
+            transactionContext->rollback();
+        }
+        throw;
+    }
+}
+
 WALReplayer::WALReplayInfo WALReplayer::dryReplay(FileInfo& fileInfo, bool throwOnWalReplayFailure,
     bool enableChecksums) const {
     uint64_t offsetDeserialized = 0;
     bool isLastRecordCheckpoint = false;
+    bool storageVersionMismatch = false;
     try {
         Deserializer deserializer = initDeserializer(fileInfo, clientContext, enableChecksums);
 
         // Skip the databaseID here, we'll verify it when we actually replay
         deserializer.getReader()->onObjectBegin();
         const auto walHeader = readWALHeader(deserializer);
+        storageVersionMismatch = isStorageVersionMismatch(walHeader);
         checkWALHeader(walHeader, enableChecksums);
         deserializer.getReader()->onObjectEnd();
 
@@ -181,19 +387,19 @@ WALReplayer::WALReplayInfo WALReplayer::dryReplay(FileInfo& fileInfo, bool throw
                 finishedDeserializing = true;
                 offsetDeserialized = getReadOffset(deserializer, enableChecksums);
             } break;
-            case WALRecordType::COMMIT_RECORD: {
-                // Update the offset to the end of the last commit record.
-                offsetDeserialized = getReadOffset(deserializer, enableChecksums);
-            } break;
             default: {
-                // DO NOTHING.
+                if (isCommitRecord(*walRecord)) {
+                    // Update the offset to the end of the last commit record.
+                    offsetDeserialized = getReadOffset(deserializer, enableChecksums);
+                }
             }
             }
         }
     } catch (...) {
         // If we hit an exception while deserializing, we assume that the WAL file is (partially)
-        // corrupted. This should only happen for records of the last transaction recorded.
-        if (throwOnWalReplayFailure) {
+        // corrupted. This should only happen for records of the last transaction recorded. A WAL
+        // written by another version is not corrupted, and dropping its records would lose them.
+        if (throwOnWalReplayFailure || storageVersionMismatch) {
             throw;
         }
     }
@@ -208,6 +414,11 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) const {
     case WALRecordType::COMMIT_RECORD: {
         TransactionContext::Get(clientContext)->commit();
     } break;
+    case WALRecordType::COMPRESSED_RECORDS_RECORD: {
+        for (auto& record : walRecord.cast<CompressedRecordsRecord>().records) {
+            replayWALRecord(*record);
+        }
+    } break;
     case WALRecordType::CREATE_CATALOG_ENTRY_RECORD: {
         replayCreateCatalogEntryRecord(walRecord);
     } break;
@@ -60,19 +60,21 @@ bool Transaction::shouldForceCheckpoint() const {
     return !clientContext->isInMemory() && forceCheckpoint;
 }
 
-void Transaction::commit(storage::WAL* wal) {
+uint64_t Transaction::commit(storage::WAL* wal) {
     localStorage->commit();
     undoBuffer->commit(commitTS);
+    uint64_t walCommitSeq = 0;
     if (shouldLogToWAL()) {
         KU_ASSERT(localWAL && wal);
         localWAL->logCommit();
-        wal->logCommittedWAL(*localWAL, clientContext);
+        walCommitSeq = wal->logCommittedWAL(*localWAL, clientContext);
         localWAL->clear();
     }
     if (hasCatalogChanges) {
         Catalog::Get(*clientContext)->incrementVersion();
         hasCatalogChanges = false;
     }
+    return walCommitSeq;
 }
 
 void Transaction::rollback(storage::WAL*) {
@@ -84,6 +86,10 @@ void Transaction::rollback(storage::WAL*) {
     hasCatalogChanges = false;
 }
 
+void Transaction::vacuumUpdates(common::transaction_t minActiveStartTS) const {
+    undoBuffer->vacuumUpdates(minActiveStartTS);
+}
+
 bool Transaction::isUnCommitted(common::table_id_t tableID, common::offset_t nodeOffset) const {
     return localStorage && localStorage->getLocalTable(tableID) &&
            nodeOffset >= getMinUncommittedNodeOffset(tableID);
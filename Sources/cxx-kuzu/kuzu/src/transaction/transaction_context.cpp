@@ -56,7 +56,14 @@ void TransactionContext::commit() {
     if (!hasActiveTransaction()) {
         return;
     }
-    clientContext.getDatabase()->getTransactionManager()->commit(clientContext, activeTransaction);
+    try {
+        clientContext.getDatabase()->getTransactionManager()->commit(clientContext,
+            activeTransaction);
+    } catch (DatabaseInvalidatedException&) {
+        // The commit is applied but not durable, so the transaction can't be rolled back.
+        clearTransaction();
+        throw;
+    }
     clearTransaction();
 }
 
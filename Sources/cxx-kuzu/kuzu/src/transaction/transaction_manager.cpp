@@ -4,6 +4,7 @@
 
 #include "common/exception/checkpoint.h"
 #include "common/exception/transaction_manager.h"
+#include "common/string_format.h"
 #include "main/attached_database.h"
 #include "main/client_context.h"
 #include "main/database.h"
@@ -19,17 +20,15 @@ namespace transaction {
 
 Transaction* TransactionManager::beginTransaction(main::ClientContext& clientContext,
     TransactionType type) {
+    if (type == TransactionType::READ_ONLY) {
+        return beginReadOnlyTransaction(clientContext);
+    }
     // We acquire the lock for starting new transactions. In case this cannot be acquired, this
     // ensures calls to other public functions are not restricted.
     std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    checkNotInvalidated();
     std::unique_lock newTransactionLck{mtxForStartingNewTransactions};
     switch (type) {
-    case TransactionType::READ_ONLY: {
-        auto transaction =
-            std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp);
-        activeTransactions.push_back(std::move(transaction));
-        return activeTransactions.back().get();
-    }
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
         if (!clientContext.getDBConfig()->enableMultiWrites && hasActiveWriteTransactionNoLock()) {
@@ -37,8 +36,12 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
                 "Cannot start a new write transaction in the system. "
                 "Only one write transaction at a time is allowed in the system.");
         }
-        auto transaction =
-            std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp);
+        // Write transactions start after the commits waiting to be durable, so that the next
+        // writer does not wait for their sync and its commit can share it. This is safe as its
+        // own commit is appended to the WAL after theirs, so it is never durable before them, and
+        // their failing to sync invalidates the database.
+        auto transaction = std::make_unique<Transaction>(clientContext, type, ++lastTransactionID,
+            lastAppliedTimestamp);
         if (transaction->shouldLogToWAL()) {
             transaction->getLocalWAL().logBeginTransaction();
         }
@@ -53,23 +56,117 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
     }
 }
 
+Transaction* TransactionManager::beginReadOnlyTransaction(main::ClientContext& clientContext) {
+    // Registering before checking the flag pairs with the checkpoint setting the flag before
+    // counting active transactions: either the checkpoint waits for this transaction, or this
+    // transaction waits for the checkpoint.
+    checkNotInvalidated();
+    while (true) {
+        numActiveReadOnlyTransactions.fetch_add(1);
+        if (!stopNewTransactions.load()) {
+            break;
+        }
+        numActiveReadOnlyTransactions.fetch_sub(1);
+        std::unique_lock waitLck{mtxForStartingNewTransactions};
+    }
+    const auto transactionID = lastTransactionID.fetch_add(1) + 1;
+    auto& shard = readOnlyTransactions[transactionID % NUM_READ_ONLY_TRANSACTION_SHARDS];
+    // The start timestamp is taken under the shard lock, so that getMinActiveStartTSNoLock()
+    // either sees this transaction or runs before it takes its start timestamp.
+    std::unique_lock shardLck{shard.mtx};
+    shard.transactions.push_back(std::make_unique<Transaction>(clientContext,
+        TransactionType::READ_ONLY, transactionID, lastTimestamp.load()));
+    return shard.transactions.back().get();
+}
+
+void TransactionManager::clearReadOnlyTransaction(transaction_t transactionID) {
+    auto& shard = readOnlyTransactions[transactionID % NUM_READ_ONLY_TRANSACTION_SHARDS];
+    {
+        std::unique_lock shardLck{shard.mtx};
+        KU_ASSERT(std::ranges::any_of(shard.transactions,
+            [transactionID](const auto& transaction) {
+                return transaction->getID() == transactionID;
+            }));
+        std::erase_if(shard.transactions, [transactionID](const auto& transaction) {
+            return transaction->getID() == transactionID;
+        });
+    }
+    numActiveReadOnlyTransactions.fetch_sub(1);
+}
+
 void TransactionManager::commit(main::ClientContext& clientContext, Transaction* transaction) {
+    if (transaction->isReadOnly()) {
+        clientContext.cleanUp();
+        clearReadOnlyTransaction(transaction->getID());
+        return;
+    }
     std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
     clientContext.cleanUp();
     switch (transaction->getType()) {
-    case TransactionType::READ_ONLY: {
-        clearTransactionNoLock(transaction->getID());
-    } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
-        lastTimestamp++;
-        transaction->commitTS = lastTimestamp;
-        transaction->commit(&wal);
-        auto shouldCheckpoint = transaction->shouldForceCheckpoint() ||
-                                Checkpointer::canAutoCheckpoint(clientContext, *transaction);
-        clearTransactionNoLock(transaction->getID());
+        // Commits that must checkpoint cannot leave their changes in the WAL while the database
+        // file is pinned, so they wait for the pins to be released before committing.
+        if (transaction->shouldForceCheckpoint()) {
+            checkpointUnpinnedCV.wait(lck,
+                [this] { return numCheckpointPins == 0 || invalidated.load(); });
+        }
+        transaction->commitTS = ++lastAppliedTimestamp;
+        const auto walCommitSeq = transaction->commit(&wal);
+        // Versions made obsolete by this commit are dropped right away, as nothing reclaims them
+        // before the next checkpoint otherwise. New transactions do not see the commit until it is
+        // durable, so the versions they read are kept.
+        transaction->vacuumUpdates(getMinActiveStartTSNoLock(transaction->getID()));
+        const auto shouldForceCheckpoint = transaction->shouldForceCheckpoint();
+        const auto shouldAutoCheckpoint =
+            Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        startCommittingNoLock(transaction->getID());
+        // Checkpointing has to wait for all other transactions to leave, and nothing can start or
+        // commit meanwhile. Auto checkpoints are therefore deferred to a later commit while other
+        // transactions are active, instead of stalling the system (or timing out on transactions
+        // blocked on this lock to commit), unless the WAL has grown past the hard limit.
+        // Skipped auto checkpoints are made up for by a later one, once nothing pins the database
+        // file. Forced checkpoints only find it pinned once the database is invalidated.
+        const auto shouldCheckpoint =
+            numCheckpointPins == 0 &&
+            (shouldForceCheckpoint ||
+                (shouldAutoCheckpoint && (hasNoActiveTransactions() ||
+                                             Checkpointer::mustAutoCheckpoint(clientContext))));
+        // A failed checkpoint leaves the commit in the WAL, so it is still made durable first.
+        std::exception_ptr checkpointException = nullptr;
         if (shouldCheckpoint) {
-            checkpointNoLock(clientContext);
+            try {
+                checkpointNoLock(clientContext);
+            } catch (CheckpointException&) {
+                checkpointException = std::current_exception();
+            }
+        }
+        // Waiting outside of the lock lets the transactions committing meanwhile share the WAL
+        // sync.
+        lck.unlock();
+        std::string syncError;
+        try {
+            wal.waitForCommitDurable(walCommitSeq,
+                clientContext.getDBConfig()->walGroupCommitDelayInMicros);
+        } catch (std::exception& e) {
+            syncError = e.what();
+        }
+        lck.lock();
+        // Once a sync failed, the WAL may have lost any commit after the last successful sync,
+        // including those whose later sync seemed to succeed. The commit can neither be made
+        // visible nor rolled back, as its changes are applied already, so the database is
+        // invalidated instead.
+        if (!syncError.empty() || invalidated.load()) {
+            invalidated.store(true);
+            finishCommittingNoLock(transaction->getID());
+            throw DatabaseInvalidatedException(stringFormat(
+                "Failed to make the commit durable{}. The database is invalidated and must be "
+                "reopened.",
+                syncError.empty() ? "" : ": " + syncError));
+        }
+        finishCommittingNoLock(transaction->getID());
+        if (checkpointException) {
+            std::rethrow_exception(checkpointException);
         }
     } break;
         // LCOV_EXCL_START
@@ -84,12 +181,14 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
 // destructed when a transaction throws an exception, while we need to roll back the active
 // transaction still.
 void TransactionManager::rollback(main::ClientContext& clientContext, Transaction* transaction) {
+    if (transaction->isReadOnly()) {
+        clientContext.cleanUp();
+        clearReadOnlyTransaction(transaction->getID());
+        return;
+    }
     std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
     clientContext.cleanUp();
     switch (transaction->getType()) {
-    case TransactionType::READ_ONLY: {
-        clearTransactionNoLock(transaction->getID());
-    } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
         transaction->rollback(&wal);
@@ -106,9 +205,28 @@ void TransactionManager::checkpoint(main::ClientContext& clientContext) {
     if (clientContext.isInMemory()) {
         return;
     }
+    checkNotInvalidated();
+    if (numCheckpointPins > 0) {
+        throw CheckpointException{
+            TransactionManagerException{"Cannot checkpoint while a backup is in progress."}};
+    }
     checkpointNoLock(clientContext);
 }
 
+void TransactionManager::pinCheckpoint(const std::function<void()>& snapshotFunc) {
+    UniqLock lck{mtxForSerializingPublicFunctionCalls};
+    snapshotFunc();
+    numCheckpointPins++;
+}
+
+void TransactionManager::unpinCheckpoint() {
+    UniqLock lck{mtxForSerializingPublicFunctionCalls};
+    KU_ASSERT(numCheckpointPins > 0);
+    if (--numCheckpointPins == 0) {
+        checkpointUnpinnedCV.notify_all();
+    }
+}
+
 TransactionManager* TransactionManager::Get(const main::ClientContext& context) {
     if (context.getAttachedDatabase() != nullptr) {
         context.getAttachedDatabase()->getTransactionManager();
@@ -118,6 +236,7 @@ TransactionManager* TransactionManager::Get(const main::ClientContext& context)
 
 UniqLock TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave() {
     UniqLock startTransactionLock{mtxForStartingNewTransactions};
+    stopNewTransactions.store(true);
     uint64_t numTimesWaited = 0;
     while (true) {
         if (hasNoActiveTransactions()) {
@@ -126,6 +245,7 @@ UniqLock TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave
         numTimesWaited++;
         if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
             checkpointWaitTimeoutInMicros) {
+            stopNewTransactions.store(false);
             throw TransactionManagerException(
                 "Timeout waiting for active transactions to leave the system before "
                 "checkpointing. If you have an open transaction, please close it and try "
@@ -137,8 +257,30 @@ UniqLock TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave
     return startTransactionLock;
 }
 
+transaction_t TransactionManager::getMinActiveStartTSNoLock(
+    transaction_t excludedTransactionID) {
+    auto minStartTS = lastTimestamp.load();
+    for (auto& transaction : activeTransactions) {
+        if (transaction->getID() != excludedTransactionID) {
+            minStartTS = std::min(minStartTS, transaction->getStartTS());
+        }
+    }
+    for (auto& shard : readOnlyTransactions) {
+        std::unique_lock shardLck{shard.mtx};
+        for (auto& transaction : shard.transactions) {
+            minStartTS = std::min(minStartTS, transaction->getStartTS());
+        }
+    }
+    return minStartTS;
+}
+
 bool TransactionManager::hasNoActiveTransactions() const {
-    return activeTransactions.empty();
+    return activeTransactions.empty() && numActiveReadOnlyTransactions.load() == 0;
+}
+
+bool TransactionManager::mayHaveActiveWriteTransaction() {
+    std::unique_lock lck{mtxForSerializingPublicFunctionCalls, std::try_to_lock};
+    return !lck.owns_lock() || !activeTransactions.empty();
 }
 
 bool TransactionManager::hasActiveWriteTransactionNoLock() const {
@@ -156,6 +298,37 @@ void TransactionManager::clearTransactionNoLock(transaction_t transactionID) {
     });
 }
 
+void TransactionManager::startCommittingNoLock(transaction_t transactionID) {
+    const auto it = std::ranges::find_if(activeTransactions,
+        [transactionID](const auto& transaction) { return transaction->getID() == transactionID; });
+    KU_ASSERT(it != activeTransactions.end());
+    committingTransactions.push_back(std::move(*it));
+    activeTransactions.erase(it);
+}
+
+void TransactionManager::finishCommittingNoLock(transaction_t transactionID) {
+    std::erase_if(committingTransactions, [transactionID](const auto& transaction) {
+        return transaction->getID() == transactionID;
+    });
+    // Syncs make all commits appended before them durable, but the transactions of the earlier
+    // commits may not have published them yet. Commits are only published once every earlier
+    // commit is durable, so that the published commits never have a gap.
+    auto timestampToPublish = lastAppliedTimestamp;
+    for (auto& transaction : committingTransactions) {
+        timestampToPublish = std::min(timestampToPublish, transaction->getCommitTS() - 1);
+    }
+    if (!invalidated.load() && timestampToPublish > lastTimestamp.load()) {
+        lastTimestamp.store(timestampToPublish);
+    }
+}
+
+void TransactionManager::checkNotInvalidated() const {
+    if (invalidated.load()) {
+        throw DatabaseInvalidatedException("The database is invalidated because a commit failed "
+                                           "to be made durable, and must be reopened.");
+    }
+}
+
 std::unique_ptr<Checkpointer> TransactionManager::initCheckpointer(
     main::ClientContext& clientContext) {
     return std::make_unique<Checkpointer>(clientContext);
@@ -169,18 +342,23 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // will only return results or error after all threads working on the tasks of a
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
+    UniqLock lockForStartingTransaction;
     try {
-        auto lockForStartingTransaction = stopNewTransactionsAndWaitUntilAllTransactionsLeave();
+        lockForStartingTransaction = stopNewTransactionsAndWaitUntilAllTransactionsLeave();
     } catch (std::exception& e) {
         throw CheckpointException{e};
     }
+    // Read-only transactions do not take mtxForSerializingPublicFunctionCalls, so they are held
+    // back until the checkpoint is done.
     auto checkpointer = initCheckpointerFunc(clientContext);
     try {
         checkpointer->writeCheckpoint();
     } catch (std::exception& e) {
         checkpointer->rollback();
+        stopNewTransactions.store(false);
         throw CheckpointException{e};
     }
+    stopNewTransactions.store(false);
 }
 
 } // namespace transaction
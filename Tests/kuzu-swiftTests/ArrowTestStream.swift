@@ -0,0 +1,195 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+import Foundation
+
+// Mirrors of the structs of the Arrow C data and stream interfaces, which the C API is not
+// exposed to the tests with.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+
+internal struct TestArrowSchema {
+    var format: UnsafePointer<CChar>?
+    var name: UnsafePointer<CChar>?
+    var metadata: UnsafePointer<CChar>?
+    var flags: Int64
+    var nChildren: Int64
+    var children: UnsafeMutablePointer<UnsafeMutablePointer<TestArrowSchema>?>?
+    var dictionary: UnsafeMutablePointer<TestArrowSchema>?
+    var release: (@convention(c) (UnsafeMutablePointer<TestArrowSchema>?) -> Void)?
+    var privateData: UnsafeMutableRawPointer?
+}
+
+internal struct TestArrowArray {
+    var length: Int64
+    var nullCount: Int64
+    var offset: Int64
+    var nBuffers: Int64
+    var nChildren: Int64
+    var buffers: UnsafeMutablePointer<UnsafeRawPointer?>?
+    var children: UnsafeMutablePointer<UnsafeMutablePointer<TestArrowArray>?>?
+    var dictionary: UnsafeMutablePointer<TestArrowArray>?
+    var release: (@convention(c) (UnsafeMutablePointer<TestArrowArray>?) -> Void)?
+    var privateData: UnsafeMutableRawPointer?
+}
+
+internal struct TestArrowArrayStream {
+    var getSchema:
+        (@convention(c) (
+            UnsafeMutablePointer<TestArrowArrayStream>?, UnsafeMutablePointer<TestArrowSchema>?
+        ) -> Int32)?
+    var getNext:
+        (@convention(c) (
+            UnsafeMutablePointer<TestArrowArrayStream>?, UnsafeMutablePointer<TestArrowArray>?
+        ) -> Int32)?
+    var getLastError:
+        (@convention(c) (UnsafeMutablePointer<TestArrowArrayStream>?) -> UnsafePointer<CChar>?)?
+    var release: (@convention(c) (UnsafeMutablePointer<TestArrowArrayStream>?) -> Void)?
+    var privateData: UnsafeMutableRawPointer?
+}
+
+/// An Arrow C stream of (id INT64, name STRING) record batches, used to test copying from Arrow
+/// streams without an Arrow library. The buffers of all exported schemas and arrays are owned by
+/// the producer and freed when it is deinitialized, so their release callbacks only mark them as
+/// released.
+internal final class ArrowTestStream {
+    private let batches: [[(id: Int64, name: String?)]]
+    private var nextBatch = 0
+    private var allocations: [UnsafeMutableRawPointer] = []
+    let stream: UnsafeMutablePointer<TestArrowArrayStream>
+
+    init(batches: [[(id: Int64, name: String?)]]) {
+        self.batches = batches
+        stream = UnsafeMutablePointer<TestArrowArrayStream>.allocate(capacity: 1)
+        stream.initialize(
+            to: TestArrowArrayStream(
+                getSchema: { stream, out in
+                    ArrowTestStream.producer(stream).exportSchema(out!)
+                    return 0
+                },
+                getNext: { stream, out in
+                    ArrowTestStream.producer(stream).exportNextBatch(out!)
+                    return 0
+                },
+                getLastError: { _ in nil },
+                release: { stream in stream!.pointee.release = nil },
+                privateData: nil
+            ))
+        stream.pointee.privateData = Unmanaged.passUnretained(self).toOpaque()
+    }
+
+    deinit {
+        for allocation in allocations {
+            allocation.deallocate()
+        }
+        stream.deallocate()
+    }
+
+    /// Whether the consumer has released the stream.
+    var isReleased: Bool { stream.pointee.release == nil }
+
+    private static func producer(_ stream: UnsafeMutablePointer<TestArrowArrayStream>?)
+        -> ArrowTestStream
+    {
+        return Unmanaged<ArrowTestStream>.fromOpaque(stream!.pointee.privateData!)
+            .takeUnretainedValue()
+    }
+
+    private func allocate<T>(_ type: T.Type, count: Int) -> UnsafeMutablePointer<T> {
+        let pointer = UnsafeMutablePointer<T>.allocate(capacity: max(count, 1))
+        allocations.append(UnsafeMutableRawPointer(pointer))
+        return pointer
+    }
+
+    private func makeCString(_ string: String) -> UnsafePointer<CChar> {
+        let utf8 = Array(string.utf8CString)
+        let pointer = allocate(CChar.self, count: utf8.count)
+        pointer.initialize(from: utf8, count: utf8.count)
+        return UnsafePointer(pointer)
+    }
+
+    private func makeSchema(format: String, name: String, flags: Int64)
+        -> UnsafeMutablePointer<TestArrowSchema>
+    {
+        let schema = allocate(TestArrowSchema.self, count: 1)
+        schema.initialize(
+            to: TestArrowSchema(
+                format: makeCString(format), name: makeCString(name), metadata: nil,
+                flags: flags, nChildren: 0, children: nil, dictionary: nil,
+                release: { schema in schema!.pointee.release = nil }, privateData: nil))
+        return schema
+    }
+
+    private func makeArray(
+        length: Int, nullCount: Int, buffers: [UnsafeRawPointer?],
+        children: [UnsafeMutablePointer<TestArrowArray>] = []
+    ) -> UnsafeMutablePointer<TestArrowArray> {
+        let bufferList = allocate(UnsafeRawPointer?.self, count: buffers.count)
+        bufferList.initialize(from: buffers, count: buffers.count)
+        let childList = allocate(UnsafeMutablePointer<TestArrowArray>?.self, count: children.count)
+        childList.initialize(from: children, count: children.count)
+        let array = allocate(TestArrowArray.self, count: 1)
+        array.initialize(
+            to: TestArrowArray(
+                length: Int64(length), nullCount: Int64(nullCount), offset: 0,
+                nBuffers: Int64(buffers.count), nChildren: Int64(children.count),
+                buffers: bufferList, children: childList, dictionary: nil,
+                release: { array in array!.pointee.release = nil }, privateData: nil))
+        return array
+    }
+
+    private func exportSchema(_ out: UnsafeMutablePointer<TestArrowSchema>) {
+        // The name column is nullable (ARROW_FLAG_NULLABLE).
+        let children = allocate(UnsafeMutablePointer<TestArrowSchema>?.self, count: 2)
+        children[0] = makeSchema(format: "l", name: "id", flags: 0)
+        children[1] = makeSchema(format: "u", name: "name", flags: 2)
+        out.pointee = makeSchema(format: "+s", name: "", flags: 0).pointee
+        out.pointee.nChildren = 2
+        out.pointee.children = children
+    }
+
+    private func exportNextBatch(_ out: UnsafeMutablePointer<TestArrowArray>) {
+        guard nextBatch < batches.count else {
+            // A released array marks the end of the stream.
+            out.pointee = TestArrowArray(
+                length: 0, nullCount: 0, offset: 0, nBuffers: 0, nChildren: 0, buffers: nil,
+                children: nil, dictionary: nil, release: nil, privateData: nil)
+            return
+        }
+        let rows = batches[nextBatch]
+        nextBatch += 1
+        let ids = allocate(Int64.self, count: rows.count)
+        let validity = allocate(UInt8.self, count: (rows.count + 7) / 8)
+        validity.initialize(repeating: 0, count: (rows.count + 7) / 8)
+        let offsets = allocate(Int32.self, count: rows.count + 1)
+        var data: [UInt8] = []
+        var nullCount = 0
+        offsets[0] = 0
+        for (i, row) in rows.enumerated() {
+            ids[i] = row.id
+            if let name = row.name {
+                validity[i / 8] |= UInt8(1 << (i % 8))
+                data.append(contentsOf: name.utf8)
+            } else {
+                nullCount += 1
+            }
+            offsets[i + 1] = Int32(data.count)
+        }
+        let bytes = allocate(UInt8.self, count: data.count)
+        bytes.initialize(from: data, count: data.count)
+        let idArray = makeArray(
+            length: rows.count, nullCount: 0, buffers: [nil, UnsafeRawPointer(ids)])
+        let nameArray = makeArray(
+            length: rows.count, nullCount: nullCount, buffers: [
+                UnsafeRawPointer(validity), UnsafeRawPointer(offsets), UnsafeRawPointer(bytes),
+            ])
+        out.pointee =
+            makeArray(
+                length: rows.count, nullCount: 0, buffers: [nil],
+                children: [idArray, nameArray]
+            ).pointee
+    }
+}
@@ -28,6 +28,561 @@ final class ConnectionTests: XCTestCase {
         _ = try Connection(db)
     }
 
+    func testPooledConnectionIsReset() throws {
+        do {
+            let conn = try Connection(pooledFrom: db)
+            conn.setMaxNumThreadForExec(3)
+            _ = try conn.query("BEGIN TRANSACTION;")
+        }
+        let conn = try Connection(pooledFrom: db)
+        XCTAssertEqual(conn.getMaxNumThreadForExec(), 4)
+        let result = try conn.query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;")
+        XCTAssertTrue(result.hasNext())
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! String, "Alice")
+    }
+
+    func testAnalyze() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id));")
+        // 900 of the 1000 rows have v = 0.
+        _ = try conn.query(
+            "UNWIND range(0, 999) AS i CREATE (:T {id: i, v: CASE WHEN i < 900 THEN 0 ELSE i END});"
+        )
+        func estimatesAndCount(_ alias: String) throws -> ([Int], Int64) {
+            let query = "MATCH (t:T) WHERE t.v = 0 RETURN COUNT(*) AS \(alias);"
+            let plan = try conn.query("EXPLAIN LOGICAL " + query).getNext()!.getValue(0) as! String
+            let estimates = plan.components(separatedBy: "Cardinality: ").dropFirst().map {
+                Int($0.prefix { $0.isNumber })!
+            }
+            return (estimates, try conn.query(query).getNext()!.getValue(0) as! Int64)
+        }
+        // Without a histogram, v = 0 is assumed to match 1 row in 101 distinct values.
+        var (estimates, count) = try estimatesAndCount("before")
+        XCTAssertEqual(count, 900)
+        XCTAssertFalse(estimates.contains { (850...950).contains($0) })
+        _ = try conn.query("CALL analyze('T');")
+        (estimates, count) = try estimatesAndCount("analyzed")
+        XCTAssertEqual(count, 900)
+        XCTAssertTrue(estimates.contains { (850...950).contains($0) })
+        // The 1000 rows inserted after the analysis are not assumed to follow the histogram.
+        _ = try conn.query("UNWIND range(1000, 1999) AS i CREATE (:T {id: i, v: 1});")
+        (estimates, count) = try estimatesAndCount("inserted")
+        XCTAssertEqual(count, 900)
+        XCTAssertTrue(estimates.contains { (850...950).contains($0) })
+        XCTAssertFalse(estimates.contains { (1700...1900).contains($0) })
+    }
+
+    func testAnalyzeInvalidatesCachedPlans() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:T {id: i, v: i % 10});")
+        func hitsAndMisses() throws -> (UInt64, UInt64) {
+            let tuple = try conn.query(
+                "CALL query_plan_cache_info() RETURN num_hits, num_misses;"
+            ).getNext()!
+            return (try tuple.getValue(0) as! UInt64, try tuple.getValue(1) as! UInt64)
+        }
+        let query = "MATCH (t:T) WHERE t.v = 0 RETURN COUNT(*);"
+        _ = try conn.query(query)
+        _ = try conn.query(query)
+        let (hits, misses) = try hitsAndMisses()
+        // Plans cached by every connection are dropped, not only those of the analyzing one.
+        _ = try Connection(db).query("CALL analyze('T');")
+        let result = try conn.query(query)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 100)
+        // The query misses, and so does the uncacheable call to query_plan_cache_info.
+        let (newHits, newMisses) = try hitsAndMisses()
+        XCTAssertEqual(newHits, hits)
+        XCTAssertEqual(newMisses, misses + 2)
+        _ = try conn.query(query)
+        XCTAssertEqual(try hitsAndMisses().0, hits + 1)
+    }
+
+    func testAnalyzeRelTable() throws {
+        let pattern = "MATCH (a:V)-[:E]->(b:V)-[:E]->(c:V), (a)-[:E]->(c) "
+        func countAndPlan(_ conn: Connection, _ alias: String) throws -> (Int64, String) {
+            let query = pattern + "RETURN COUNT(*) AS \(alias);"
+            let count = try conn.query(query).getNext()!.getValue(0) as! Int64
+            let plan = try conn.query("EXPLAIN LOGICAL " + query).getNext()!.getValue(0) as! String
+            return (count, plan)
+        }
+        var expected: Int64 = 0
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE V(id INT64, PRIMARY KEY(id));")
+            _ = try conn.query("CREATE REL TABLE E(FROM V TO V);")
+            _ = try conn.query("UNWIND range(0, 99) AS i CREATE (:V {id: i});")
+            _ = try conn.query(
+                "MATCH (a:V), (b:V) WHERE (b.id - a.id + 100) % 100 BETWEEN 1 AND 20 "
+                    + "CREATE (a)-[:E]->(b);")
+            // Without degree stats, intersections keep their old cost and close the triangle.
+            let (count, defaultPlan) = try countAndPlan(conn, "before")
+            expected = count
+            XCTAssertTrue(defaultPlan.contains("INTERSECT"))
+            // Every probe tuple of an intersection merges two lists of 20 rels, which costs more
+            // than extending and joining on the closing rel.
+            _ = try conn.query("CALL analyze('E');")
+            let (analyzedCount, analyzedPlan) = try countAndPlan(conn, "analyzed")
+            XCTAssertEqual(analyzedCount, expected)
+            XCTAssertFalse(analyzedPlan.contains("INTERSECT"))
+        }
+        // The stats are persisted with the table.
+        db = nil
+        db = try Database(path)
+        let (reopenedCount, reopenedPlan) = try countAndPlan(try Connection(db), "reopened")
+        XCTAssertEqual(reopenedCount, expected)
+        XCTAssertFalse(reopenedPlan.contains("INTERSECT"))
+    }
+
+    func testAdaptiveReoptimizationThreshold() throws {
+        let conn = try Connection(db)
+        func numReoptimizedExecutions() throws -> UInt64 {
+            let result = try conn.query(
+                "CALL query_plan_cache_info() RETURN num_reoptimized_executions;")
+            return try result.getNext()!.getValue(0) as! UInt64
+        }
+        _ = try conn.query("CREATE NODE TABLE P(id INT64 PRIMARY KEY, v INT64);")
+        _ = try conn.query("CREATE REL TABLE K(FROM P TO P);")
+        _ = try conn.query("UNWIND range(0, 199) AS i CREATE (:P {id: i, v: 1});")
+        _ = try conn.query(
+            "UNWIND range(0, 199) AS i UNWIND range(1, 100) AS j "
+                + "MATCH (a:P {id: i}), (b:P {id: (i + j) % 200}) CREATE (a)-[:K]->(b);")
+        // Each side of the join on b is estimated at a tenth of its 20000 tuples, as the filters
+        // are assumed to be selective.
+        let query =
+            "MATCH (a:P)-[:K]->(b:P)<-[:K]-(c:P) WHERE a.v > 0 AND c.v > 0 RETURN COUNT(*);"
+        _ = try conn.query("CALL adaptive_reoptimization_threshold=0;")
+        XCTAssertEqual(try conn.query(query).getNext()!.getValue(0) as! Int64, 2_000_000)
+        XCTAssertEqual(try numReoptimizedExecutions(), 0)
+
+        _ = try conn.query("CALL adaptive_reoptimization_threshold=1;")
+        XCTAssertEqual(try conn.query(query).getNext()!.getValue(0) as! Int64, 2_000_000)
+        XCTAssertGreaterThanOrEqual(try numReoptimizedExecutions(), 1)
+        // The re-planned statement is cached with the cardinalities it observed, so the query
+        // stops being re-planned once each misestimated subgraph has been observed.
+        for _ in 0..<4 {
+            XCTAssertEqual(try conn.query(query).getNext()!.getValue(0) as! Int64, 2_000_000)
+        }
+        let numReoptimized = try numReoptimizedExecutions()
+        XCTAssertLessThan(numReoptimized, 5)
+        XCTAssertEqual(try conn.query(query).getNext()!.getValue(0) as! Int64, 2_000_000)
+        XCTAssertEqual(try numReoptimizedExecutions(), numReoptimized)
+        XCTAssertThrowsError(try conn.query("CALL adaptive_reoptimization_threshold=-1;"))
+    }
+
+    func testGreedyJoinOrder() throws {
+        let conn = try Connection(db)
+        let pattern =
+            "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person), (a)-[:knows]->(c) "
+        let expected = try conn.query(pattern + "RETURN COUNT(*);").getNext()!.getValue(0) as! Int64
+        func logicalPlan(_ query: String) throws -> String {
+            return try conn.query("EXPLAIN LOGICAL " + query).getNext()!.getValue(0) as! String
+        }
+        // Query graphs of this size are enumerated exhaustively by default.
+        let exhaustivePlan = try logicalPlan(pattern + "RETURN COUNT(*);")
+        _ = try conn.query("CALL join_order_greedy_threshold=2;")
+        let greedy = try conn.query(pattern + "RETURN COUNT(*) AS greedy;").getNext()!
+        XCTAssertEqual(try greedy.getValue(0) as! Int64, expected)
+        // Greedy ordering intersects the two rels closing the triangle.
+        XCTAssertTrue(try logicalPlan(pattern + "RETURN COUNT(*);").contains("INTERSECT"))
+        _ = try conn.query("CALL join_order_greedy_threshold=0;")
+        // The budget counts enumerated plans, so the same plan is chosen regardless of the load.
+        _ = try conn.query("CALL join_order_planning_budget=1;")
+        let budgeted = try conn.query(pattern + "RETURN COUNT(*) AS budgeted;").getNext()!
+        XCTAssertEqual(try budgeted.getValue(0) as! Int64, expected)
+        let budgetedPlan = try logicalPlan(pattern + "RETURN COUNT(*);")
+        XCTAssertEqual(try logicalPlan(pattern + "RETURN COUNT(*);"), budgetedPlan)
+        _ = try conn.query("CALL join_order_planning_budget=0;")
+        let unlimited = try conn.query(pattern + "RETURN COUNT(*) AS unlimited;").getNext()!
+        XCTAssertEqual(try unlimited.getValue(0) as! Int64, expected)
+        XCTAssertEqual(try logicalPlan(pattern + "RETURN COUNT(*);"), exhaustivePlan)
+        XCTAssertThrowsError(try conn.query("CALL join_order_planning_budget=-1;"))
+    }
+
+    func testWeightedShortestPathHopBound() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Stop(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE REL TABLE Hop(FROM Stop TO Stop, w DOUBLE);")
+        _ = try conn.query("UNWIND range(0, 40) AS i CREATE (:Stop {id: i});")
+        _ = try conn.query(
+            "MATCH (a:Stop), (b:Stop) WHERE b.id = a.id + 1 CREATE (a)-[:Hop {w: 1.0}]->(b);")
+        _ = try conn.query(
+            "MATCH (a:Stop {id: 0}), (b:Stop {id: 20}) CREATE (a)-[:Hop {w: 100.0}]->(b);")
+        func shortest(_ bound: String) throws -> (Double, Int64)? {
+            let result = try conn.query(
+                "MATCH (a:Stop {id: 0})-[e:Hop* WSHORTEST(w)\(bound)]->(b:Stop {id: 40}) "
+                    + "RETURN cost(e), length(e);")
+            guard let tuple = try result.getNext() else {
+                return nil
+            }
+            return (try tuple.getValue(0) as! Double, try tuple.getValue(1) as! Int64)
+        }
+        // The default bound of 30 hops only admits the path over the expensive shortcut.
+        let bounded = try shortest("")
+        XCTAssertEqual(bounded?.0, 120)
+        XCTAssertEqual(bounded?.1, 21)
+        _ = try conn.query("CALL var_length_extend_max_depth=40;")
+        // Explicit bounds below the max depth are kept.
+        XCTAssertNil(try shortest(" 1..20"))
+        let explicit = try shortest(" 1..30")
+        XCTAssertEqual(explicit?.0, 120)
+        // Bounds no simple path exceeds find the cheapest path.
+        let unbounded = try shortest("")
+        XCTAssertEqual(unbounded?.0, 40)
+        XCTAssertEqual(unbounded?.1, 40)
+        // An explicit bound equal to the max depth is kept too.
+        _ = try conn.query("CALL var_length_extend_max_depth=20;")
+        XCTAssertNil(try shortest(" 1..20"))
+    }
+
+    func testFusedExpression() throws {
+        let conn = try Connection(db)
+        let expected = try conn.query("MATCH (a:person) WHERE a.age > 30 RETURN COUNT(*);")
+            .getNext()!.getValue(0) as! Int64
+        let filtered = try conn.query(
+            "MATCH (a:person) WHERE 100 - a.age * 2 < 40 RETURN COUNT(*);"
+        ).getNext()!
+        XCTAssertEqual(try filtered.getValue(0) as! Int64, expected)
+        let result = try conn.query(
+            "MATCH (a:person) WHERE a.ID = 0 RETURN a.age, (a.age + 1) * 2 - 3;"
+        )
+        let tuple = try result.getNext()!
+        let age = try tuple.getValue(0) as! Int64
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, (age + 1) * 2 - 3)
+    }
+
+    func testParameterizedComparison() throws {
+        let conn = try Connection(db)
+        let stmt = try conn.prepare("MATCH (a:person) WHERE a.age > $age RETURN COUNT(*);")
+        for age: Int64 in [20, 40] {
+            let expected = try conn.query(
+                "MATCH (a:person) WHERE a.age > \(age) RETURN COUNT(*);"
+            ).getNext()!.getValue(0) as! Int64
+            #if os(Linux)
+                let result = try conn.execute(stmt, ["age": KuzuInt64Wrapper(value: age)])
+            #else
+                let result = try conn.execute(stmt, ["age": age])
+            #endif
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, expected)
+        }
+    }
+
+    func testRegexpLiteralPattern() throws {
+        let conn = try Connection(db)
+        let expected = try conn.query(
+            "MATCH (a:person) WHERE a.fName CONTAINS 'a' RETURN COUNT(*);"
+        ).getNext()!.getValue(0) as! Int64
+        let matches = try conn.query(
+            "MATCH (a:person) WHERE regexp_matches(a.fName, 'a') RETURN COUNT(*);"
+        ).getNext()!
+        XCTAssertEqual(try matches.getValue(0) as! Int64, expected)
+        let fullMatches = try conn.query(
+            "MATCH (a:person) WHERE a.fName =~ '.*a.*' RETURN COUNT(*);"
+        ).getNext()!
+        XCTAssertEqual(try fullMatches.getValue(0) as! Int64, expected)
+        let exactMatches = try conn.query(
+            "MATCH (a:person) WHERE a.fName =~ 'Alice' RETURN COUNT(*);"
+        ).getNext()!
+        XCTAssertEqual(try exactMatches.getValue(0) as! Int64, 1)
+    }
+
+    func testArrayDistanceAgainstConstant() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            """
+            UNWIND [[1.0, 2.0], [3.0, 4.0], NULL] AS v
+            RETURN array_inner_product(CAST(v AS DOUBLE[2]), CAST([1.0, 1.0] AS DOUBLE[2])),
+                array_squared_distance(CAST([1.0, 1.0] AS DOUBLE[2]), CAST(v AS DOUBLE[2]));
+            """
+        )
+        var rows: [(Double?, Double?)] = []
+        while let tuple = try result.getNext() {
+            rows.append((try tuple.getValue(0) as? Double, try tuple.getValue(1) as? Double))
+        }
+        XCTAssertEqual(rows.count, 3)
+        XCTAssertEqual(rows[0].0, 3.0)
+        XCTAssertEqual(rows[0].1, 1.0)
+        XCTAssertEqual(rows[1].0, 7.0)
+        XCTAssertEqual(rows[1].1, 13.0)
+        XCTAssertNil(rows[2].0)
+        XCTAssertNil(rows[2].1)
+    }
+
+    func testLongStringProjection() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "UNWIND range(1, 10000) AS i WITH concat('a long string value #', to_string(i)) AS s "
+                + "WHERE ends_with(s, '0') RETURN COUNT(*), MAX(size(s));"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 26)
+    }
+
+    func testSelectiveFilterLookup() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY, code INT64, name STRING);")
+        _ = try conn.query(
+            "UNWIND range(0, 999) AS i CREATE (:Item {id: i, code: i % 500, "
+                + "name: concat('item', to_string(i))});"
+        )
+        let result = try conn.query(
+            "MATCH (i:Item) WHERE i.code = 42 RETURN i.id, i.name ORDER BY i.id;"
+        )
+        var rows: [(Int64, String)] = []
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            rows.append((try tuple.getValue(0) as! Int64, try tuple.getValue(1) as! String))
+        }
+        XCTAssertEqual(rows.map { $0.0 }, [42, 542])
+        XCTAssertEqual(rows.map { $0.1 }, ["item42", "item542"])
+    }
+
+    func testGroupByNullableKeys() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "UNWIND range(1, 3000) AS i WITH CASE WHEN i % 10 = 0 THEN NULL ELSE i % 3 END AS k "
+                + "RETURN k, COUNT(*);"
+        )
+        var counts: [Int64?: Int64] = [:]
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            counts[try tuple.getValue(0) as? Int64] = try tuple.getValue(1) as? Int64
+        }
+        XCTAssertEqual(counts, [0: 900, 1: 900, 2: 900, nil: 300])
+    }
+
+    func testGroupedAggregates() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "UNWIND range(1, 5000) AS i "
+                + "WITH i % 4 AS k, CASE WHEN i % 5 = 0 THEN NULL ELSE i END AS v "
+                + "RETURN k, CAST(SUM(v) AS INT64), MIN(v), MAX(v), COUNT(v) ORDER BY k;"
+        )
+        var rows: [[Int64]] = []
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            rows.append(try (0..<5).map { try tuple.getValue(UInt64($0)) as! Int64 })
+        }
+        XCTAssertEqual(rows.count, 4)
+        XCTAssertEqual(rows[0], [0, 2_500_000, 4, 4996, 1000])
+        XCTAssertEqual(rows[1], [1, 2_500_000, 1, 4997, 1000])
+    }
+
+    func testGroupByNode() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Points(FROM Item TO Item);")
+        _ = try conn.query("UNWIND range(0, 2999) AS i CREATE (:Item {id: i});")
+        _ = try conn.query(
+            "UNWIND range(0, 2999) AS i MATCH (a:Item {id: i}), (b:Item {id: i % 100}) "
+                + "CREATE (a)-[:Points]->(b);"
+        )
+        let result = try conn.query(
+            "MATCH (a:Item)-[:Points]->(b:Item) WITH b, SUM(a.id) AS s, COUNT(a.id) AS c "
+                + "RETURN b.id, CAST(s AS INT64), c ORDER BY b.id;"
+        )
+        var numRows: Int64 = 0
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            let id = try tuple.getValue(0) as! Int64
+            XCTAssertEqual(id, numRows)
+            XCTAssertEqual(try tuple.getValue(1) as! Int64, 30 * id + 43500)
+            XCTAssertEqual(try tuple.getValue(2) as! Int64, 30)
+            numRows += 1
+        }
+        XCTAssertEqual(numRows, 100)
+    }
+
+    func testComparisonFilterWithNulls() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "UNWIND [1, NULL, 3, NULL, 5, 2] AS x WITH x WHERE x > 2 RETURN COUNT(*);"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 2)
+    }
+
+    func testSharedSubplan() throws {
+        let conn = try Connection(db)
+        let pattern = "MATCH (a:person)-[:knows]->(b:person) WHERE a.age > 20 "
+        let expected =
+            try conn.query(pattern + "RETURN COUNT(*);").getNext()!.getValue(0) as! Int64
+        let result = try conn.query(
+            pattern + "RETURN a.fName, b.fName UNION ALL " + pattern + "RETURN a.fName, b.fName;"
+        )
+        var numTuples: Int64 = 0
+        while result.hasNext() {
+            _ = try result.getNext()
+            numTuples += 1
+        }
+        XCTAssertEqual(numTuples, 2 * expected)
+        func logicalPlan(_ query: String) throws -> String {
+            return try conn.query("EXPLAIN LOGICAL " + query).getNext()!.getValue(0) as! String
+        }
+        let union = pattern + "RETURN a.fName, b.fName UNION ALL " + pattern
+        XCTAssertTrue(try logicalPlan(union + "RETURN a.fName, b.fName;").contains("SHARED_SCAN"))
+        // Materializing an unfiltered extend costs more than extending twice.
+        let unfiltered = "MATCH (a:person)-[:knows]->(b:person) "
+        XCTAssertFalse(
+            try logicalPlan(
+                unfiltered + "RETURN a.fName, b.fName UNION ALL " + unfiltered
+                    + "RETURN a.fName, b.fName;"
+            ).contains("SHARED_SCAN"))
+        // A branch with a LIMIT stops computing its sub-plan early, so it is not shared.
+        let limited = pattern + "RETURN a.fName, b.fName LIMIT 1 UNION ALL " + pattern
+            + "RETURN a.fName, b.fName LIMIT 1;"
+        XCTAssertFalse(try logicalPlan(limited).contains("SHARED_SCAN"))
+        let limitedResult = try conn.query(limited)
+        numTuples = 0
+        while limitedResult.hasNext() {
+            _ = try limitedResult.getNext()
+            numTuples += 1
+        }
+        XCTAssertEqual(numTuples, min(2, 2 * expected))
+    }
+
+    func testUnionBranchesRunConcurrently() throws {
+        let conn = try Connection(db)
+        func sortedIDs(_ query: String) throws -> [Int64] {
+            let result = try conn.query(query)
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids.sorted()
+        }
+        // The branches have dependencies of their own, e.g. hash join builds and aggregations.
+        let branches = [
+            "MATCH (a:person) RETURN a.ID AS id",
+            "MATCH (m:moviesSerial) RETURN m.ID AS id",
+            "MATCH (a:person)-[:knows]->(b:person), (b)-[:knows]->(c:person) RETURN a.ID + 100 AS id",
+            "MATCH (a:person) WITH a.gender AS g, COUNT(*) AS n RETURN n AS id",
+        ]
+        var expected: [Int64] = []
+        for branch in branches {
+            expected += try sortedIDs(branch + ";")
+        }
+        expected.sort()
+        let union = branches.joined(separator: " UNION ALL ") + ";"
+        XCTAssertEqual(try sortedIDs(union), expected)
+        // With fewer workers than branches, the branches share the workers.
+        conn.setMaxNumThreadForExec(1)
+        XCTAssertEqual(try sortedIDs(union), expected)
+        conn.setMaxNumThreadForExec(0)
+
+        // The error of a failing branch is reported rather than the interrupts of the others.
+        XCTAssertThrowsError(
+            try conn.query(
+                branches[2] + " UNION ALL MATCH (a:person) RETURN a.ID / (a.ID - a.ID) AS id;")
+        ) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("Divide by zero"))
+        }
+        XCTAssertEqual(try sortedIDs(union), expected)
+
+        // Each branch runs in a single pipeline on a single thread. The spans of their tasks
+        // recorded by PROFILE overlap only if the branches ran at the same time.
+        // The ranges differ so that the branches are not computed once and shared.
+        func serialBranch(_ start: Int) -> String {
+            return "UNWIND range(\(start), 3000000) AS i WITH i WHERE i = 7 RETURN i AS id"
+        }
+        let profile = try conn.query(
+            "PROFILE " + serialBranch(1) + " UNION ALL " + serialBranch(2) + ";"
+        ).getNext()!.getValue(0) as! String
+        let json = try JSONSerialization.jsonObject(with: Data(profile.utf8)) as! [String: Any]
+        let spans = (json["Pipelines"] as! [[String: Any]]).map { pipeline in
+            let tasks = pipeline["Tasks"] as! [[String: Any]]
+            return (
+                tasks.map { ($0["StartMS"] as! NSNumber).doubleValue }.min()!,
+                tasks.map { ($0["EndMS"] as! NSNumber).doubleValue }.max()!
+            )
+        }
+        var numOverlaps = 0
+        for i in 0..<spans.count {
+            for j in (i + 1)..<spans.count
+            where spans[i].0 < spans[j].1 && spans[j].0 < spans[i].1 {
+                numOverlaps += 1
+            }
+        }
+        XCTAssertGreaterThan(numOverlaps, 0)
+    }
+
+    func testTopKThroughJoin() throws {
+        let conn = try Connection(db)
+        let query =
+            "MATCH (a:person)-[:knows]->(b:person) RETURN a.age, b.fName ORDER BY a.age DESC"
+        var expected: [Int64] = []
+        let fullResult = try conn.query(query + ";")
+        while fullResult.hasNext() && expected.count < 3 {
+            expected.append(try fullResult.getNext()!.getValue(0) as! Int64)
+        }
+        var ages: [Int64] = []
+        let result = try conn.query(query + " LIMIT 3;")
+        while result.hasNext() {
+            ages.append(try result.getNext()!.getValue(0) as! Int64)
+        }
+        XCTAssertEqual(ages, expected)
+    }
+
+    func testEagerAggregation() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE V(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE NODE TABLE W(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE REL TABLE F(FROM V TO W);")
+        _ = try conn.query("UNWIND range(0, 1999) AS i CREATE (:V {id: i});")
+        _ = try conn.query("UNWIND range(0, 9) AS i CREATE (:W {id: i});")
+        // Half of the V nodes have a rel to a W node, and every W node has 100 rels.
+        _ = try conn.query(
+            "MATCH (a:V), (w:W) WHERE a.id < 1000 AND a.id % 10 = w.id CREATE (a)-[:F]->(w);")
+        // Semi masks disable the rewrite, and hints fix the sides of the hash join.
+        _ = try conn.query("CALL enable_semi_mask=false;")
+        func numAggregates(_ query: String) throws -> Int {
+            let plan = try conn.query("EXPLAIN LOGICAL " + query).getNext()!.getValue(0) as! String
+            return plan.components(separatedBy: "AGGREGATE").count - 1
+        }
+        func countsPerW(_ query: String) throws -> [Int64: Int64] {
+            let result = try conn.query(query)
+            var counts: [Int64: Int64] = [:]
+            while result.hasNext() {
+                let tuple = try result.getNext()!
+                counts[try tuple.getValue(0) as! Int64] = try tuple.getValue(1) as! Int64
+            }
+            return counts
+        }
+        let expected = Dictionary(uniqueKeysWithValues: (0..<10).map { (Int64($0), Int64(100)) })
+        // The rels are counted per W node before being joined with the W nodes.
+        let aggregated = "MATCH (a:V)-[e:F]->(w:W) HINT (a JOIN e) JOIN w RETURN w.id, COUNT(*);"
+        XCTAssertEqual(try numAggregates(aggregated), 2)
+        XCTAssertEqual(try countsPerW(aggregated), expected)
+        // The larger side scans the V nodes it is joined on, so there is nothing to pre-aggregate.
+        let unique = "MATCH (a:V)-[e:F]->(w:W) HINT a JOIN (e JOIN w) RETURN w.id, COUNT(*);"
+        XCTAssertEqual(try numAggregates(unique), 1)
+        XCTAssertEqual(try countsPerW(unique), expected)
+    }
+
+    func testCountFromRelDegrees() throws {
+        let conn = try Connection(db)
+        let pattern = "MATCH (a:person)-[:knows]->(b:person) "
+        func getCounts(_ returnClause: String) throws -> [Int64] {
+            let result = try conn.query(pattern + returnClause)
+            var counts: [Int64] = []
+            while result.hasNext() {
+                counts.append(try result.getNext()!.getValue(1) as! Int64)
+            }
+            return counts
+        }
+        let countQuery = "RETURN a.ID, COUNT(*) ORDER BY a.ID;"
+        let scanQuery = "RETURN a.ID, COUNT(b.ID) ORDER BY a.ID;"
+        XCTAssertEqual(try getCounts(countQuery), try getCounts(scanQuery))
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query(
+            "MATCH (a:person), (b:person) WHERE a.ID = 0 AND b.ID = 2 CREATE (a)-[:knows]->(b);"
+        )
+        XCTAssertEqual(try getCounts(countQuery), try getCounts(scanQuery))
+        _ = try conn.query("ROLLBACK;")
+    }
+
     func testGetMaxNumThreads() throws {
         let conn = try Connection(db)
         XCTAssertEqual(conn.getMaxNumThreadForExec(), 4)  // Default value
@@ -39,6 +594,45 @@ final class ConnectionTests: XCTestCase {
         XCTAssertEqual(conn.getMaxNumThreadForExec(), 3)
     }
 
+    func testQueryAsync() async throws {
+        let conn = try Connection(db)
+        let result = try await conn.queryAsync(
+            "MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;"
+        )
+        XCTAssertTrue(result.hasNext())
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! String, "Alice")
+    }
+
+    func testQueryAsyncError() async throws {
+        let conn = try Connection(db)
+        do {
+            _ = try await conn.queryAsync("MATCH (a:unknown) RETURN a;")
+            XCTFail("Expected query to fail")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("unknown"))
+        }
+    }
+
+    func testConcurrentQueryAsync() async throws {
+        let connections = try (0..<8).map { _ in try Connection(db) }
+        let counts = try await withThrowingTaskGroup(of: Int64.self) { group in
+            for i in 0..<64 {
+                let conn = connections[i % connections.count]
+                group.addTask {
+                    let result = try await conn.queryAsync("MATCH (a:person) RETURN COUNT(*);")
+                    return try result.getNext()!.getValue(0) as! Int64
+                }
+            }
+            var counts: [Int64] = []
+            for try await count in group {
+                counts.append(count)
+            }
+            return counts
+        }
+        XCTAssertEqual(counts, Array(repeating: 8, count: 64))
+    }
+
     // TODO: fix this test on other platforms
     #if os(macOS)
         func testInterrupt() async throws {
@@ -67,6 +661,44 @@ final class ConnectionTests: XCTestCase {
         }
     #endif
 
+    #if os(macOS)
+        func testQueryAsyncOfBusyConnectionDoesNotStarveOthers() async throws {
+            // The executor of async queries gets 2 threads.
+            db = nil
+            db = try Database(path, SystemConfig(maxNumThreads: 2))
+            let busyConn = try Connection(db)
+            let otherConn = try Connection(db)
+            let largeQuery =
+                "UNWIND RANGE(1,100000) AS x UNWIND RANGE(1, 100000) AS y RETURN COUNT(x + y);"
+            let largeTask = Task { try await busyConn.queryAsync(largeQuery) }
+            try await Task.sleep(nanoseconds: 1000_000_000)
+            // Queued behind the large query of its connection, without taking the other thread.
+            let queuedTask = Task {
+                try await busyConn.queryAsync("RETURN 2;").getNext()!.getValue(0) as! Int64
+            }
+            try await Task.sleep(nanoseconds: 200_000_000)
+            // The large query is interrupted eventually, so that the test fails instead of hanging.
+            let watchdog = Task {
+                try await Task.sleep(nanoseconds: 10_000_000_000)
+                largeTask.cancel()
+            }
+            let start = Date()
+            let result = try await otherConn.queryAsync("RETURN 1;")
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1)
+            XCTAssertLessThan(Date().timeIntervalSince(start), 10)
+            watchdog.cancel()
+            // Interrupting the large query leaves the query queued after it on the connection.
+            largeTask.cancel()
+            do {
+                _ = try await largeTask.value
+                XCTFail("Expected query to be interrupted")
+            } catch let error as KuzuError {
+                XCTAssertEqual(error.message, "Interrupted.")
+            }
+            XCTAssertEqual(try await queuedTask.value, 2)
+        }
+    #endif
+
     func testSetTimeout() throws {
         let conn = try Connection(db)
         conn.setQueryTimeout(100)
@@ -140,21 +772,2036 @@ final class ConnectionTests: XCTestCase {
         XCTAssertEqual(values[0] as! Int64, 1)
     }
 
-    func testExecuteError() throws {
+    func testReplayWALOfManySmallCommits() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CALL force_checkpoint_on_close=false;")
+            _ = try conn.query("CREATE NODE TABLE walNode(id INT64, v INT64, PRIMARY KEY(id));")
+            _ = try conn.query("CREATE REL TABLE walLink(FROM walNode TO walNode, w INT64);")
+            // Far more records than the replayer decodes ahead of the records it applies.
+            for i in 0..<300 {
+                _ = try conn.query("CREATE (:walNode {id: \(i), v: \(i)});")
+                if i > 0 {
+                    _ = try conn.query(
+                        "MATCH (a:walNode), (b:walNode) WHERE a.id = \(i - 1) AND b.id = \(i) "
+                            + "CREATE (a)-[:walLink {w: \(i)}]->(b);"
+                    )
+                }
+                if i % 3 == 0 {
+                    _ = try conn.query("MATCH (a:walNode) WHERE a.id = \(i) SET a.v = -\(i);")
+                }
+            }
+            _ = try conn.query("MATCH (a:walNode) WHERE a.id >= 290 DETACH DELETE a;")
+            _ = try conn.query("BEGIN TRANSACTION;")
+            _ = try conn.query("CREATE (:walNode {id: 1000, v: 1000});")
+            _ = try conn.query("ROLLBACK;")
+        }
+        db = nil
+        db = try Database(path)
         let conn = try Connection(db)
-        let stmt = try conn.prepare("RETURN $a;")
+        var result = try conn.query("MATCH (a:walNode) RETURN count(*), sum(a.v);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 290)
+        let expectedSum = (0..<290).reduce(Int64(0)) { $0 + Int64($1 % 3 == 0 ? -$1 : $1) }
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, expectedSum)
+        result = try conn.query("MATCH ()-[l:walLink]->() RETURN count(*), sum(l.w);")
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 289)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 289 * 290 / 2)
+    }
 
+    func testPrefetchedScansAfterReopen() throws {
         do {
-            #if os(Linux)
-                _ = try conn.execute(stmt, ["b": KuzuInt64Wrapper(value: 1)])
-            #else
-                _ = try conn.execute(stmt, ["b": Int64(1)])
-            #endif
-            XCTFail("Expected error")
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Sample(id INT64 PRIMARY KEY, v INT64, s STRING);")
+            // Spans several node groups, each with segments of every column to prefetch.
+            _ = try conn.query(
+                "UNWIND range(0, 299999) AS i CREATE (:Sample {id: i, v: i * 2, "
+                    + "s: CAST(i % 100 AS STRING)});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        db = nil
+        // A small buffer pool keeps evicting prefetched pages while the scans run.
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 32 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        func value(_ query: String) throws -> Int64 {
+            return try conn.query(query).getNext()!.getValue(0) as! Int64
+        }
+        for _ in 0..<2 {
+            XCTAssertEqual(try value("MATCH (s:Sample) RETURN sum(s.v);"), 299999 * 300000)
+            XCTAssertEqual(try value("MATCH (s:Sample) WHERE s.s = '42' RETURN count(*);"), 3000)
+        }
+        // The zone maps rule out every segment but the last one, which is still scanned.
+        XCTAssertEqual(
+            try value("MATCH (s:Sample) WHERE s.id >= 299990 RETURN sum(s.v);"),
+            (299990...299999).reduce(Int64(0)) { $0 + Int64($1) * 2 })
+        XCTAssertEqual(try value("MATCH (s:Sample) WHERE s.v < 0 RETURN count(*);"), 0)
+        // Scans below a LIMIT stop early and don't prefetch.
+        let result = try conn.query("MATCH (s:Sample) WHERE s.s = '42' RETURN s.id LIMIT 5;")
+        var numTuples = 0
+        while result.hasNext() {
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64 % 100, 42)
+            numTuples += 1
+        }
+        XCTAssertEqual(numTuples, 5)
+        XCTAssertEqual(try value("MATCH (s:Sample) RETURN s.v SKIP 10 LIMIT 1;") % 2, 0)
+    }
+
+    func testBatchedPageFlushesAfterReopen() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Account(id STRING PRIMARY KEY, balance INT64);")
+            _ = try conn.query(
+                "UNWIND range(0, 99999) AS i "
+                    + "CREATE (:Account {id: concat('acc', CAST(i AS STRING)), balance: i});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+            // Dirties the shadow pages of every column page and many hash index slots at once, which
+            // the next checkpoint writes back in batches.
+            _ = try conn.query("MATCH (a:Account) SET a.balance = a.balance + 1;")
+            _ = try conn.query(
+                "UNWIND range(100000, 149999) AS i "
+                    + "CREATE (:Account {id: concat('acc', CAST(i AS STRING)), balance: i + 1});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        db = nil
+        db = try Database(path)
+        let conn = try Connection(db)
+        let result = try conn.query("MATCH (a:Account) RETURN count(*), sum(a.balance);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 150000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 150000 * 150001 / 2)
+        for id in [0, 4242, 99999, 100000, 149999] {
+            let result = try conn.query(
+                "MATCH (a:Account) WHERE a.id = 'acc\(id)' RETURN a.balance;"
+            )
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, Int64(id + 1))
+        }
+    }
+
+    func testExecuteMany() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id STRING PRIMARY KEY);")
+        let stmt = try conn.prepare("CREATE (:Item {id: $id});")
+        let parameterSets: [[String: String?]] = (0..<100).map { ["id": "item\($0)"] }
+        _ = try conn.executeMany(stmt, parameterSets)
+        let result = try conn.query("MATCH (i:Item) RETURN COUNT(*);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 100)
+    }
+
+    func testExecuteManyError() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id STRING PRIMARY KEY);")
+        let stmt = try conn.prepare("CREATE (:Item {id: $id});")
+        do {
+            _ = try conn.executeMany(stmt, [["id": "a"], ["id": "a"]])
+            XCTFail("Expected the duplicated primary key to fail")
         } catch let error as KuzuError {
-            XCTAssertTrue(error.message.contains("Parameter a not found"))
-        } catch {
-            XCTFail("Unexpected error type")
+            XCTAssertTrue(error.message.contains("duplicated primary key"))
+        }
+        // The first execution is rolled back with the failed one.
+        let result = try conn.query("MATCH (i:Item) RETURN COUNT(*);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 0)
+    }
+
+    func testExecuteManyBindErrorRollsBack() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id STRING PRIMARY KEY);")
+        let stmt = try conn.prepare("CREATE (:Item {id: $id});")
+        // The second parameter set fails to bind, before it is executed.
+        let parameterSets: [[String: Any?]] = [["id": "a"], ["id": [Int64(1), Int64(2)]]]
+        XCTAssertThrowsError(try conn.executeMany(stmt, parameterSets))
+        // The transaction started for the executions is rolled back, so that neither this
+        // connection nor others are blocked by it.
+        let otherConn = try Connection(db)
+        _ = try otherConn.query("CREATE (:Item {id: 'b'});")
+        _ = try conn.query("CREATE (:Item {id: 'c'});")
+        let result = try conn.query("MATCH (i:Item) RETURN i.id ORDER BY i.id;")
+        var ids: [String] = []
+        while result.hasNext() {
+            ids.append(try result.getNext()!.getValue(0) as! String)
+        }
+        XCTAssertEqual(ids, ["b", "c"])
+    }
+
+    func testConcurrentWritersDuplicatedPrimaryKey() throws {
+        let conn1 = try Connection(db)
+        let conn2 = try Connection(db)
+        _ = try conn1.query("CALL debug_enable_multi_writes=true;")
+        _ = try conn1.query("CREATE NODE TABLE Item(id STRING PRIMARY KEY);")
+        _ = try conn1.query("BEGIN TRANSACTION;")
+        _ = try conn2.query("BEGIN TRANSACTION;")
+        _ = try conn1.query("CREATE (:Item {id: 'a'});")
+        _ = try conn2.query("CREATE (:Item {id: 'a'}), (:Item {id: 'b'});")
+        _ = try conn1.query("COMMIT;")
+        do {
+            _ = try conn2.query("COMMIT;")
+            XCTFail("Expected the key committed by the other writer to conflict")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("duplicated primary key"))
+        }
+        let result = try conn1.query("MATCH (i:Item) RETURN COUNT(*);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1)
+    }
+
+    func testRepeatedUpdatesKeepSnapshot() throws {
+        let writer = try Connection(db)
+        let reader = try Connection(db)
+        let middleReader = try Connection(db)
+        _ = try writer.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY, value INT64);")
+        _ = try writer.query("UNWIND range(0, 9) AS i CREATE (:Item {id: i, value: 0});")
+        let functions = try writer.query("CALL show_functions() RETURN name;")
+        var hasDebugFunction = false
+        while functions.hasNext() {
+            let name = try functions.getNext()!.getValue(0) as! String
+            hasDebugFunction = hasDebugFunction || name == "DEBUG_UPDATE_VERSIONS"
+        }
+        // The number of versions of the single vector of the value column. The function is only
+        // built with runtime checks enabled.
+        func numVersions() throws -> Int64? {
+            guard hasDebugFunction else {
+                return nil
+            }
+            let result = try writer.query(
+                "CALL debug_update_versions('Item') WHERE column_name = 'value' "
+                    + "RETURN num_versions;")
+            guard result.hasNext() else {
+                return 0
+            }
+            return try result.getNext()!.getValue(0) as? Int64
+        }
+        func setValues(_ rounds: ClosedRange<Int>) throws {
+            for round in rounds {
+                _ = try writer.query(
+                    "MATCH (i:Item) WHERE i.id % 2 = \(round % 2) SET i.value = \(round);")
+            }
+        }
+        let sumQuery = "MATCH (i:Item) RETURN CAST(SUM(i.value) AS INT64);"
+
+        // The reader pins the versions of every round, so none of them can be merged.
+        _ = try reader.query("BEGIN TRANSACTION READ ONLY;")
+        try setValues(1...20)
+        if let numVersions = try numVersions() {
+            XCTAssertEqual(numVersions, 20)
+        }
+        var result = try reader.query(sumQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 0)
+        _ = try reader.query("COMMIT;")
+
+        // Once the reader is gone, each commit merges the versions every transaction sees into
+        // the newest of them. Only the version of the last commit stays apart, as it is not
+        // durable yet while the commit vacuums.
+        try setValues(21...40)
+        if let numVersions = try numVersions() {
+            XCTAssertEqual(numVersions, 2)
+        }
+        result = try reader.query(sumQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 5 * 40 + 5 * 39)
+
+        // A reader starting in the middle pins the version it sees. The older versions are merged
+        // into it, and the newer ones are kept for the writer.
+        _ = try middleReader.query("BEGIN TRANSACTION READ ONLY;")
+        try setValues(41...50)
+        if let numVersions = try numVersions() {
+            XCTAssertEqual(numVersions, 1 + 10)
+        }
+        result = try middleReader.query(sumQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 5 * 40 + 5 * 39)
+        _ = try middleReader.query("COMMIT;")
+        try setValues(51...51)
+        if let numVersions = try numVersions() {
+            XCTAssertEqual(numVersions, 2)
+        }
+        result = try reader.query(sumQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 5 * 50 + 5 * 51)
+    }
+
+    func testSetAndDeleteManyNodes() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY, score INT64);")
+        _ = try conn.query("UNWIND range(0, 4999) AS i CREATE (:Item {id: i, score: i});")
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query("MATCH (i:Item) SET i.score = i.score + 1;")
+        _ = try conn.query("MATCH (i:Item) WHERE i.id % 2 = 0 SET i.score = i.score + 1;")
+        _ = try conn.query("COMMIT;")
+        _ = try conn.query("MATCH (i:Item) WHERE i.id >= 4000 DELETE i;")
+        let result = try conn.query(
+            "MATCH (i:Item) RETURN COUNT(*), CAST(SUM(i.score - i.id) AS INT64);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 4000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 4000 + 2000)
+    }
+
+    func testMergeManyKeys() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY, hits INT64);")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i, hits: 1});")
+        _ = try conn.query(
+            """
+            UNWIND range(500, 2499) AS i
+            MERGE (n:Item {id: i % 1500})
+            ON MATCH SET n.hits = n.hits + 1
+            ON CREATE SET n.hits = 1;
+            """)
+        let result = try conn.query("MATCH (i:Item) RETURN COUNT(*), CAST(SUM(i.hits) AS INT64);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1500)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 1000 + 2000)
+    }
+
+    func testCopyRelsIntoPopulatedTable() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Links(FROM Item TO Item);")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i});")
+        _ = try conn.query(
+            "COPY Links FROM (UNWIND range(0, 999) AS i RETURN i, (i + 1) % 1000);")
+        _ = try conn.query(
+            "COPY Links FROM (UNWIND range(0, 999) AS i WITH i WHERE i % 10 = 0 RETURN i, (i + 2) % 1000);")
+        var result = try conn.query("MATCH ()-[l:Links]->() RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1100)
+        result = try conn.query("MATCH (a:Item {id: 10})-[:Links]->(b) RETURN b.id ORDER BY b.id;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 11)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 12)
+        XCTAssertFalse(result.hasNext())
+    }
+
+    func testCheckpointRelsInsertedInSmallBatches() throws {
+        let conn = try Connection(db)
+        _ = try conn.query(
+            "CREATE NODE TABLE Account(id INT64 PRIMARY KEY);")
+        _ = try conn.query(
+            "CREATE REL TABLE Transfer(FROM Account TO Account, amount INT64);")
+        _ = try conn.query("UNWIND range(0, 99) AS i CREATE (:Account {id: i});")
+        _ = try conn.query(
+            "MATCH (a:Account), (b:Account) WHERE b.id = (a.id + 1) % 100 CREATE (a)-[:Transfer {amount: a.id}]->(b);")
+        _ = try conn.query("CHECKPOINT;")
+        for batch in 0..<5 {
+            _ = try conn.query(
+                "MATCH (a:Account), (b:Account) WHERE b.id = (a.id + 2) % 100 AND a.id % 5 = \(batch) CREATE (a)-[:Transfer {amount: 1000 + a.id}]->(b);")
+        }
+        _ = try conn.query("MATCH (:Account)-[t:Transfer]->(:Account) WHERE t.amount % 10 = 3 DELETE t;")
+        _ = try conn.query("CHECKPOINT;")
+        var result = try conn.query("MATCH ()-[t:Transfer]->() RETURN COUNT(*), CAST(SUM(t.amount) AS INT64);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(tuple.getValue(0) as! Int64, 180)
+        XCTAssertEqual(tuple.getValue(1) as! Int64, 98940)
+        result = try conn.query(
+            "MATCH (:Account {id: 7})-[t:Transfer]->(b) RETURN b.id, t.amount ORDER BY b.id;")
+        tuple = try result.getNext()!
+        XCTAssertEqual(tuple.getValue(0) as! Int64, 8)
+        XCTAssertEqual(tuple.getValue(1) as! Int64, 7)
+        tuple = try result.getNext()!
+        XCTAssertEqual(tuple.getValue(0) as! Int64, 9)
+        XCTAssertEqual(tuple.getValue(1) as! Int64, 1007)
+        XCTAssertFalse(result.hasNext())
+    }
+
+    func testCheckpointManyNodeGroups() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Cell(id INT64 PRIMARY KEY, v INT64);")
+        _ = try conn.query("CREATE REL TABLE Next(FROM Cell TO Cell, w INT64);")
+        _ = try conn.query("UNWIND range(0, 299999) AS i CREATE (:Cell {id: i, v: i % 7});")
+        _ = try conn.query(
+            "COPY Next FROM (UNWIND range(0, 299998) AS i RETURN i, i + 1, i % 3);")
+        _ = try conn.query("CHECKPOINT;")
+        _ = try conn.query("MATCH (c:Cell) WHERE c.id % 1000 = 0 SET c.v = 100;")
+        _ = try conn.query("MATCH (a:Cell)-[n:Next]->() WHERE a.id % 1000 = 1 DELETE n;")
+        _ = try conn.query("CHECKPOINT;")
+        var result = try conn.query(
+            "MATCH (c:Cell) WHERE c.v = 100 RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 300)
+        result = try conn.query("MATCH ()-[n:Next]->() RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 299999 - 300)
+        result = try conn.query(
+            "MATCH (:Cell {id: 262143})-[n:Next]->(b) RETURN b.id, n.w;")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(tuple.getValue(0) as! Int64, 262144)
+        XCTAssertEqual(tuple.getValue(1) as! Int64, 0)
+    }
+
+    func testReplayCompressedWALOfLargeTransaction() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CALL force_checkpoint_on_close=false;")
+            _ = try conn.query(
+                "CREATE NODE TABLE walItem(id INT64, label STRING, PRIMARY KEY(id));"
+            )
+            _ = try conn.query(
+                "UNWIND range(1, 50000) AS i "
+                    + "CREATE (:walItem {id: i, label: 'item-' + CAST(i AS STRING)});"
+            )
+            _ = try conn.query("CREATE (:walItem {id: 0, label: 'small commit'});")
+        }
+        db = nil
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 256 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "MATCH (a:walItem) RETURN COUNT(*), CAST(SUM(a.id) AS INT64);"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 50001)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 1_250_025_000)
+        let label = try conn.query("MATCH (a:walItem) WHERE a.id = 4321 RETURN a.label;")
+        XCTAssertEqual(try label.getNext()!.getValue(0) as! String, "item-4321")
+    }
+
+    func testReopenAfterRepeatedCheckpoints() throws {
+        do {
+            let conn = try Connection(db)
+            for i in 0..<5 {
+                _ = try conn.query(
+                    "CREATE NODE TABLE ckpt\(i)(id INT64, PRIMARY KEY(id));"
+                )
+                _ = try conn.query(
+                    "UNWIND range(1, \(1000 * (i + 1))) AS j CREATE (:ckpt\(i) {id: j});"
+                )
+                _ = try conn.query("CHECKPOINT;")
+            }
+            _ = try conn.query("DROP TABLE ckpt0;")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        db = nil
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 256 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        for i in 1..<5 {
+            let result = try conn.query("MATCH (a:ckpt\(i)) RETURN COUNT(*);")
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, Int64(1000 * (i + 1)))
+        }
+        XCTAssertThrowsError(try conn.query("MATCH (a:ckpt0) RETURN COUNT(*);"))
+    }
+
+    func testQueryStats() throws {
+        let conn = try Connection(db)
+        let query = "MATCH (a:person) WHERE a.age > 30 RETURN a.fName;"
+        let expected = try conn.query(query)
+        var numRows: Int64 = 0
+        while expected.hasNext() {
+            _ = try expected.getNext()
+            numRows += 1
+        }
+        let result = try conn.query(
+            "CALL query_stats() WHERE query = '\(query)' "
+                + "AND operator STARTS WITH 'RESULT_COLLECTOR' "
+                + "RETURN CAST(num_output_tuples AS INT64), query_time_ms >= 0;"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, numRows)
+        XCTAssertTrue(try tuple.getValue(1) as! Bool)
+        XCTAssertFalse(result.hasNext())
+    }
+
+    func testQueryStatsTruncatesQueries() throws {
+        let conn = try Connection(db)
+        let query = "RETURN 'é', '\(String(repeating: "a", count: 1000))';"
+        func lastQueryText() throws -> String {
+            let result = try conn.query(
+                "CALL query_stats() RETURN query ORDER BY query_id DESC LIMIT 1;"
+            )
+            return try result.getNext()!.getValue(0) as! String
+        }
+
+        // The query is cut before the second byte of 'é'.
+        _ = try conn.query("CALL query_stats_max_query_length=9;")
+        _ = try conn.query(query)
+        XCTAssertEqual(try lastQueryText(), "RETURN '...")
+        _ = try conn.query("CALL query_stats_max_query_length=0;")
+        _ = try conn.query(query)
+        XCTAssertEqual(try lastQueryText(), "")
+    }
+
+    func testIOStats() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("MATCH (a:person) RETURN COUNT(a.fName);")
+        let result = try conn.query(
+            "CALL io_stats() RETURN SUM(num_hits + num_misses) > 0, "
+                + "MIN(size(read_latency_histogram)), MAX(size(read_latency_histogram));"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertTrue(try tuple.getValue(0) as! Bool)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 20)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, 20)
+    }
+
+    func testQueryMemoryLimit() throws {
+        let conn = try Connection(db)
+        let query = "MATCH (a:person) RETURN a.fName, COUNT(*);"
+        _ = try conn.query("CALL query_memory_limit=1;")
+        do {
+            _ = try conn.query(query)
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("memory limit"))
+        }
+        _ = try conn.query("CALL query_memory_limit=0;")
+        _ = try conn.query(query)
+        let result = try conn.query(
+            "CALL query_stats() WHERE query = '\(query)' "
+                + "RETURN query_peak_memory > 0, MAX(operator_peak_memory) > 0;"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertTrue(try tuple.getValue(0) as! Bool)
+        XCTAssertTrue(try tuple.getValue(1) as! Bool)
+    }
+
+    func testSpilledHashJoinPartitionsProbeSide() throws {
+        db = nil
+        // Hash join builds may use half of the buffer pool before their partitions are spilled.
+        let systemConfig = SystemConfig(bufferPoolSize: 32 * 1024 * 1024, maxNumThreads: 2)
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        let n: Int64 = 500_000
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Link(FROM Item TO Item);")
+        _ = try conn.query("COPY Item FROM (UNWIND range(0, \(n - 1)) AS i RETURN i);")
+        // Every item has exactly one incoming and one outgoing link.
+        _ = try conn.query(
+            "COPY Link FROM (UNWIND range(0, \(n - 1)) AS i RETURN i, (i * 7) % \(n));")
+        // Unflat probe keys, only part of which are in partitions kept in memory.
+        var result = try conn.query(
+            "MATCH (a:Item)-[e:Link]->(b:Item) HINT a JOIN (e JOIN b) "
+                + "RETURN COUNT(*), CAST(SUM(a.id) AS INT64), CAST(SUM(b.id) AS INT64);"
+        )
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, n)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, n * (n - 1) / 2)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, n * (n - 1) / 2)
+        // Flat probe keys of a left join, which must keep the unmatched tuples.
+        result = try conn.query(
+            "MATCH (a:Item) OPTIONAL MATCH (a)<-[:Link]-(c:Item) WHERE c.id % 2 = 0 "
+                + "RETURN COUNT(*), COUNT(c), CAST(SUM(a.id) AS INT64);"
+        )
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, n)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, n / 2)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, n * (n - 1) / 2)
+    }
+
+    func testSpilledHashAggregatePartitions() throws {
+        db = nil
+        let systemConfig = SystemConfig(bufferPoolSize: 32 * 1024 * 1024, maxNumThreads: 4)
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        let n: Int64 = 2_000_000
+        let m: Int64 = 200_000
+        // The groups of each partition are freed once they've all been scanned, while the string
+        // keys and aggregates must still be read from the partitions which haven't been.
+        for _ in 0..<2 {
+            let result = try conn.query(
+                "UNWIND range(0, \(n - 1)) AS i "
+                    + "WITH i % \(m) AS k, CAST(i % \(m) AS STRING) AS s, COUNT(*) AS c, "
+                    + "MAX(CAST(i AS STRING)) AS maxI "
+                    + "WHERE s = CAST(k AS STRING) AND maxI <> '' "
+                    + "RETURN COUNT(*), CAST(SUM(c) AS INT64), CAST(SUM(k) AS INT64);"
+            )
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, m)
+            XCTAssertEqual(try tuple.getValue(1) as! Int64, n)
+            XCTAssertEqual(try tuple.getValue(2) as! Int64, m * (m - 1) / 2)
+        }
+    }
+
+    func testParallelCSVWithQuotedNewlines() throws {
+        db = nil
+        db = try Database(path, SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        let csvPath = NSTemporaryDirectory() + "kuzu_swift_test_csv_" + UUID().uuidString + ".csv"
+        defer { try? FileManager.default.removeItem(atPath: csvPath) }
+        // Rows span many blocks, and quoted newlines fall at arbitrary offsets of the blocks.
+        let n = 20000
+        var rows = ""
+        for i in 0..<n {
+            rows += "\(i),\"row \(i)\nsays \"\"\(String(repeating: ",", count: i % 7))\"\"\"\n"
+        }
+        try rows.write(toFile: csvPath, atomically: true, encoding: .utf8)
+        let load =
+            "LOAD WITH HEADERS (id INT64, note STRING) FROM '\(csvPath)' (parallel=true) "
+        let result = try conn.query(
+            load + "WHERE note STARTS WITH 'row ' + CAST(id AS STRING) + '\nsays' "
+                + "RETURN COUNT(*), CAST(SUM(id) AS INT64);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, Int64(n))
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, Int64(n * (n - 1) / 2))
+        // A quote left open fails the scan instead of leaving threads waiting for its block.
+        try (rows + "\(n),\"unterminated\n" + rows).write(
+            toFile: csvPath, atomically: true, encoding: .utf8)
+        XCTAssertThrowsError(try conn.query(load + "RETURN COUNT(*);"))
+    }
+
+    func testJSONScanValidatesSkippedFields() throws {
+        let conn = try Connection(db)
+        let jsonPath = NSTemporaryDirectory() + "kuzu_swift_test_scan_" + UUID().uuidString + ".json"
+        defer { try? FileManager.default.removeItem(atPath: jsonPath) }
+        func countRows(_ records: String) throws -> Int64 {
+            try records.write(toFile: jsonPath, atomically: true, encoding: .utf8)
+            // Columns and format are given so that no record is parsed whole to detect them.
+            let result = try conn.query(
+                "LOAD WITH HEADERS (a INT64) FROM '\(jsonPath)' (format='unstructured') "
+                    + "RETURN COUNT(a);")
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        // Only "a" is a column, so "b" is skipped without being parsed.
+        XCTAssertEqual(
+            try countRows(
+                "{\"a\": 1, \"b\": {\"x\": [1, -2.5e3, null, true, false, \"}\"]}}\n"
+                    + "{\"a\": 2, \"b\": 0.5}\n"),
+            2)
+        for malformed in ["tru", "nul", "01", "1.", "-", "1e", "[1, fals]", "{\"x\": 1x}"] {
+            XCTAssertThrowsError(
+                try countRows("{\"a\": 1, \"b\": 2}\n{\"a\": 1, \"b\": \(malformed)}\n"),
+                malformed)
+        }
+    }
+
+    func testHivePartitionedParquet() throws {
+        let conn = try Connection(db)
+        let dir = NSTemporaryDirectory() + "kuzu_swift_test_hive_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dir) }
+        // Partition values are URL-encoded, and the default partition holds null values.
+        var files: [String] = []
+        let partitions = [("e%2Fu", "1", 10), ("__HIVE_DEFAULT_PARTITION__", "2", 5), ("us", "3", 3)]
+        for (region, day, n) in partitions {
+            let partitionDir = dir + "/region=" + region + "/day=" + day
+            try FileManager.default.createDirectory(
+                atPath: partitionDir, withIntermediateDirectories: true)
+            let file = partitionDir + "/data.parquet"
+            _ = try conn.query("COPY (UNWIND range(1, \(n)) AS x RETURN x) TO '\(file)';")
+            files.append("'\(file)'")
+        }
+        let load = "LOAD FROM [\(files.joined(separator: ", "))] (HIVE_PARTITIONING=true) "
+        let result = try conn.query(load + "RETURN region, day, COUNT(*) ORDER BY day;")
+        var rows: [(String?, String?, Int64)] = []
+        while let tuple = try result.getNext() {
+            rows.append(
+                (
+                    try tuple.getValue(0) as? String, try tuple.getValue(1) as? String,
+                    try tuple.getValue(2) as! Int64
+                ))
+        }
+        XCTAssertEqual(rows.count, 3)
+        XCTAssertEqual(rows[0].0, "e/u")
+        XCTAssertNil(rows[1].0)
+        XCTAssertEqual(rows[2].0, "us")
+        XCTAssertEqual(rows.map { $0.1 }, ["1", "2", "3"])
+        XCTAssertEqual(rows.map { $0.2 }, [10, 5, 3])
+        func count(_ predicate: String) throws -> Int64 {
+            let result = try conn.query(load + "WHERE " + predicate + " RETURN COUNT(*);")
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        // Files are pruned by the decoded values, and null values pass no comparison.
+        XCTAssertEqual(try count("region = 'e/u'"), 10)
+        XCTAssertEqual(try count("region <> 'us'"), 10)
+        XCTAssertEqual(try count("region IS NULL"), 5)
+        XCTAssertEqual(try count("day = '3'"), 3)
+    }
+
+    func testProfileJSON() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CALL profile_format='json';")
+        let result = try conn.query("PROFILE MATCH (a:person) RETURN COUNT(*);")
+        let output = try result.getNext()!.getValue(0) as! String
+        let json = try JSONSerialization.jsonObject(with: Data(output.utf8)) as! [String: Any]
+        let plan = json["Plan"] as! [String: Any]
+        XCTAssertNotNil(plan["EstimatedCardinality"])
+        XCTAssertNotNil(plan["NumOutputTuplesPerThread"])
+        XCTAssertFalse((json["Pipelines"] as! [Any]).isEmpty)
+        _ = try conn.query("CALL profile_format='text';")
+        let textResult = try conn.query("PROFILE MATCH (a:person) RETURN COUNT(*);")
+        let text = try textResult.getNext()!.getValue(0) as! String
+        XCTAssertTrue(text.contains("EstimatedCardinality"))
+        XCTAssertTrue(text.contains("Pipelines"))
+    }
+
+    func testTraceFile() throws {
+        let conn = try Connection(db)
+        let tracePath = NSTemporaryDirectory() + "kuzu_swift_test_trace_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: tracePath) }
+        _ = try conn.query("CALL trace_file='\(tracePath)';")
+        _ = try conn.query("MATCH (a:person) RETURN COUNT(*);")
+        _ = try conn.query("CALL trace_file='';")
+        let data = try Data(contentsOf: URL(fileURLWithPath: tracePath))
+        let json = try JSONSerialization.jsonObject(with: data) as! [String: Any]
+        let events = json["traceEvents"] as! [[String: Any]]
+        XCTAssertTrue(events.contains { $0["cat"] as? String == "task" })
+        XCTAssertTrue(events.contains { $0["cat"] as? String == "morsel" })
+    }
+
+    func testSlowQueries() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CALL slow_query_threshold_ms=1000000;")
+        _ = try conn.query("MATCH (a:person) RETURN COUNT(*);")
+        let emptyResult = try conn.query(
+            "CALL slow_queries() WHERE query CONTAINS 'a.age > $age' RETURN COUNT(*);")
+        XCTAssertEqual(try emptyResult.getNext()!.getValue(0) as! Int64, 0)
+        _ = try conn.query("CALL slow_query_threshold_ms=1;")
+        let stmt = try conn.prepare("MATCH (a:person) WHERE a.age > $age RETURN COUNT(*);")
+        #if os(Linux)
+            _ = try conn.execute(stmt, ["age": KuzuInt64Wrapper(value: 0)])
+        #else
+            _ = try conn.execute(stmt, ["age": Int64(0)])
+        #endif
+        _ = try conn.query("CALL slow_query_threshold_ms=0;")
+        let result = try conn.query(
+            "CALL slow_queries() WHERE query CONTAINS 'a.age > $age' "
+                + "RETURN parameters, num_pins >= 0, plan;"
+        )
+        guard let tuple = try result.getNext() else {
+            // The query may have run faster than the threshold.
+            return
+        }
+        XCTAssertEqual(try tuple.getValue(0) as! String, "$age: INT64")
+        XCTAssertTrue(try tuple.getValue(1) as! Bool)
+        XCTAssertTrue((try tuple.getValue(2) as! String).contains("NumOutputTuples"))
+    }
+
+    func testQueryProgress() throws {
+        let conn = try Connection(db)
+        XCTAssertFalse(try conn.getQueryProgress().isRunning)
+        _ = try conn.query("MATCH (a:person) RETURN COUNT(*);")
+        let progress = try conn.getQueryProgress()
+        XCTAssertFalse(progress.isRunning)
+        XCTAssertNil(progress.estimatedRemainingTimeMS)
+    }
+
+    func testStorageSummary() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "CALL storage_summary('person') WHERE column_name = 'age' "
+                + "RETURN SUM(chunk_fraction), SUM(num_values) = 8, MIN(free_space_fragmentation);"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Double, 1.0, accuracy: 1e-9)
+        XCTAssertTrue(try tuple.getValue(1) as! Bool)
+        XCTAssertGreaterThanOrEqual(try tuple.getValue(2) as! Double, 0)
+        XCTAssertThrowsError(try conn.query("CALL storage_summary('nonexistent') RETURN *;"))
+    }
+
+    func testWorkloadRecordFile() throws {
+        let conn = try Connection(db)
+        let workloadPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_workload_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: workloadPath) }
+        _ = try conn.query("CALL workload_record_file='\(workloadPath)';")
+        _ = try conn.query("MATCH (a:person) RETURN COUNT(*);")
+        let stmt = try conn.prepare("MATCH (a:person) WHERE a.age > $age RETURN COUNT(*);")
+        #if os(Linux)
+            _ = try conn.execute(stmt, ["age": KuzuInt64Wrapper(value: 30)])
+        #else
+            _ = try conn.execute(stmt, ["age": Int64(30)])
+        #endif
+        _ = try conn.query("CALL workload_record_file='';")
+        let lines = try String(contentsOfFile: workloadPath, encoding: .utf8)
+            .split(separator: "\n")
+        XCTAssertEqual(lines.count, 2)
+        let records = try lines.map {
+            try JSONSerialization.jsonObject(with: Data($0.utf8)) as! [String: Any]
+        }
+        XCTAssertEqual(records[0]["query"] as? String, "MATCH (a:person) RETURN COUNT(*);")
+        XCTAssertEqual(records[0]["connection"] as? Int, records[1]["connection"] as? Int)
+        XCTAssertEqual(records[1]["success"] as? Bool, true)
+        let parameters = records[1]["parameters"] as! [String: [String: Any]]
+        XCTAssertEqual(parameters["age"]?["type"] as? String, "INT64")
+        XCTAssertEqual(parameters["age"]?["value"] as? String, "30")
+    }
+
+    func testPrimaryKeyLookupsAfterCheckpoints() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Account(id STRING PRIMARY KEY, v INT64);")
+        // Each batch is merged into the persistent index on checkpoint, which splits slots and
+        // extends the overflow chains of the slots which are not split yet.
+        for batch in 0..<3 {
+            _ = try conn.query(
+                "UNWIND range(\(batch * 7000), \(batch * 7000 + 6999)) AS i "
+                    + "CREATE (:Account {id: concat('key', to_string(i)), v: i});")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        _ = try conn.query("MATCH (k:Account) WHERE k.v % 3 = 0 DELETE k;")
+        let result = try conn.query(
+            "UNWIND range(0, 21999) AS i MATCH (k:Account {id: concat('key', to_string(i))}) "
+                + "WHERE k.v = i RETURN COUNT(*);"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 14000)
+        XCTAssertThrowsError(try conn.query("CREATE (:Account {id: 'key1', v: 1});"))
+        _ = try conn.query("CREATE (:Account {id: 'key3', v: 3});")
+    }
+
+    func testSortedIndex() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64 PRIMARY KEY, code INT64);")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i, code: i % 500});")
+        _ = try conn.query("CALL create_sorted_index('Item', 'code_index', 'code');")
+        func ids(_ predicate: String) throws -> [Int64] {
+            let result = try conn.query(
+                "MATCH (i:Item) WHERE \(predicate) RETURN i.id ORDER BY i.id;"
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        XCTAssertEqual(try ids("i.code = 42"), [42, 542])
+        XCTAssertEqual(try ids("i.code >= 10 AND i.code < 12"), [10, 11, 510, 511])
+        _ = try conn.query("CREATE (:Item {id: 1000, code: 42});")
+        XCTAssertEqual(try ids("i.code = 42"), [42, 542, 1000])
+        _ = try conn.query("MATCH (i:Item) WHERE i.id = 42 SET i.code = 7;")
+        XCTAssertEqual(try ids("i.code = 42"), [542, 1000])
+        XCTAssertEqual(try ids("i.code = 7"), [7, 42, 507])
+        _ = try conn.query("MATCH (i:Item) WHERE i.id = 542 DELETE i;")
+        XCTAssertEqual(try ids("i.code = 42"), [1000])
+        _ = try conn.query("CALL drop_sorted_index('Item', 'code_index');")
+        XCTAssertEqual(try ids("i.code = 42"), [1000])
+        XCTAssertThrowsError(try conn.query("CALL drop_sorted_index('Item', 'code_index');"))
+    }
+
+    func testVectorZoneMaps() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Reading(id INT64 PRIMARY KEY, tag STRING);")
+        _ = try conn.query(
+            "UNWIND range(0, 9999) AS i "
+                + "CREATE (:Reading {id: i, tag: concat('tag', lpad(CAST(i AS STRING), 5, '0'))});"
+        )
+        _ = try conn.query("CHECKPOINT;")
+        func count(_ predicate: String) throws -> Int64 {
+            let result = try conn.query(
+                "MATCH (r:Reading) WHERE \(predicate) RETURN count(*);"
+            )
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        XCTAssertEqual(try count("r.id >= 5000 AND r.id < 5010"), 10)
+        XCTAssertEqual(try count("r.tag = 'tag04242'"), 1)
+        XCTAssertEqual(try count("r.tag >= 'tag09990'"), 10)
+        XCTAssertEqual(try count("r.tag < 'tag00010'"), 10)
+        // Rows updated in place must still be found after the zone maps were computed.
+        _ = try conn.query("MATCH (r:Reading) WHERE r.id = 10 SET r.tag = 'untagged';")
+        _ = try conn.query("CHECKPOINT;")
+        XCTAssertEqual(try count("r.tag = 'untagged'"), 1)
+        XCTAssertEqual(try count("r.tag > 'tag99999'"), 1)
+    }
+
+    func testVectorZoneMapsAfterReopen() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Reading(id INT64 PRIMARY KEY, tag STRING);")
+            _ = try conn.query(
+                "UNWIND range(0, 9999) AS i CREATE (:Reading {id: i, "
+                    + "tag: concat('tag', lpad(CAST(i AS STRING), 5, '0'))});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+            _ = try conn.query("MATCH (r:Reading) WHERE r.id = 10 SET r.tag = 'untagged';")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        db = nil
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 256 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        func count(_ predicate: String) throws -> Int64 {
+            let result = try conn.query(
+                "MATCH (r:Reading) WHERE \(predicate) RETURN count(*);"
+            )
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        XCTAssertEqual(try count("r.id >= 5000 AND r.id < 5010"), 10)
+        XCTAssertEqual(try count("r.tag = 'tag04242'"), 1)
+        XCTAssertEqual(try count("r.tag >= 'tag09990'"), 10)
+        XCTAssertEqual(try count("r.tag = 'untagged'"), 1)
+        XCTAssertEqual(try count("r.tag = 'tag00010'"), 0)
+    }
+
+    func testCopyClusterBy() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Event(id INT64 PRIMARY KEY, ts INT64, kind STRING);")
+        _ = try conn.query(
+            "COPY Event FROM (UNWIND range(0, 9999) AS i RETURN i, (i * 7919) % 10000, "
+                + "CAST(i % 3 AS STRING)) (CLUSTER_BY='kind, ts');"
+        )
+        let count = try conn.query("MATCH (e:Event) WHERE e.ts < 100 RETURN count(*);")
+        XCTAssertEqual(try count.getNext()!.getValue(0) as! Int64, 100)
+        let lookup = try conn.query("MATCH (e:Event) WHERE e.id = 1234 RETURN e.ts;")
+        XCTAssertEqual(try lookup.getNext()!.getValue(0) as! Int64, (1234 * 7919) % 10000)
+        XCTAssertThrowsError(
+            try conn.query("COPY Event FROM (RETURN 10000, 0, 'a') (CLUSTER_BY='missing');")
+        )
+    }
+
+    func testCopyRelBatchedPKLookup() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Account(name STRING PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Transfer(FROM Account TO Account);")
+        _ = try conn.query(
+            "COPY Account FROM (UNWIND range(0, 4999) AS i RETURN 'acc' + CAST(i AS STRING));"
+        )
+        _ = try conn.query(
+            "COPY Transfer FROM (UNWIND range(0, 4999) AS i RETURN 'acc' + CAST(i AS STRING), "
+                + "'acc' + CAST((i * 31) % 5000 AS STRING));"
+        )
+        let count = try conn.query(
+            "MATCH (a:Account)-[:Transfer]->(b:Account) WHERE b.name = 'acc31' RETURN a.name;"
+        )
+        XCTAssertEqual(try count.getNext()!.getValue(0) as! String, "acc1")
+        XCTAssertThrowsError(
+            try conn.query("COPY Transfer FROM (RETURN 'acc1', 'missing');")
+        )
+    }
+
+    func testFixedSizeArrayScan() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Vec(id INT64 PRIMARY KEY, v DOUBLE[3]);")
+        _ = try conn.query(
+            "COPY Vec FROM (UNWIND range(0, 2999) AS i RETURN i, "
+                + "CAST([i, i + 0.5, i * 2] AS DOUBLE[3]));"
+        )
+        _ = try conn.query("CHECKPOINT;")
+        let sum = try conn.query("MATCH (n:Vec) RETURN sum(n.v[3]);")
+        XCTAssertEqual(try sum.getNext()!.getValue(0) as! Double, 2999.0 * 3000.0)
+        let row = try conn.query("MATCH (n:Vec) WHERE n.id = 1234 RETURN n.v[2];")
+        XCTAssertEqual(try row.getNext()!.getValue(0) as! Double, 1234.5)
+        _ = try conn.query("MATCH (n:Vec) WHERE n.id = 7 SET n.v = CAST([0, 0, 0] AS DOUBLE[3]);")
+        _ = try conn.query("CHECKPOINT;")
+        let updated = try conn.query("MATCH (n:Vec) WHERE n.id >= 6 AND n.id <= 8 RETURN n.v[3];")
+        var values: [Double] = []
+        while let tuple = try updated.getNext() {
+            values.append(try tuple.getValue(0) as! Double)
+        }
+        XCTAssertEqual(values.sorted(), [0.0, 12.0, 16.0])
+    }
+
+    func testPathsSharingNodes() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Stop(id INT64 PRIMARY KEY, name STRING);")
+        _ = try conn.query("CREATE REL TABLE Link(FROM Stop TO Stop, cost INT64);")
+        _ = try conn.query("UNWIND range(0, 9) AS i CREATE (:Stop {id: i, name: 's' + string(i)});")
+        _ = try conn.query(
+            "MATCH (a:Stop), (b:Stop) WHERE b.id = a.id + 1 OR b.id = a.id + 2 "
+                + "CREATE (a)-[:Link {cost: a.id + b.id}]->(b);"
+        )
+        let result = try conn.query(
+            "MATCH p = (a:Stop {id: 0})-[:Link*1..4]->(b:Stop) RETURN p, length(p);"
+        )
+        var numPaths = 0
+        while let tuple = try result.getNext() {
+            let path = try tuple.getValue(0) as! KuzuRecursiveRelationship
+            let length = try tuple.getValue(1) as! Int64
+            XCTAssertEqual(path.nodes.count, Int(length) + 1)
+            XCTAssertEqual(path.relationships.count, Int(length))
+            XCTAssertEqual(path.nodes[0].properties["name"] as! String, "s0")
+            for (i, rel) in path.relationships.enumerated() {
+                let src = path.nodes[i].properties["id"] as! Int64
+                let dst = path.nodes[i + 1].properties["id"] as! Int64
+                XCTAssertEqual(rel.properties["cost"] as! Int64, src + dst)
+            }
+            numPaths += 1
+        }
+        // Paths of length 1 to 4 with steps of 1 or 2.
+        XCTAssertEqual(numPaths, 2 + 4 + 8 + 16)
+    }
+
+    func testFactorizedTuples() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Hub(id INT64 PRIMARY KEY, name STRING);")
+        _ = try conn.query("CREATE REL TABLE Spoke(FROM Hub TO Hub);")
+        _ = try conn.query(
+            "UNWIND range(0, 100) AS i CREATE (:Hub {id: i, name: 'h' + string(i)});"
+        )
+        _ = try conn.query(
+            "MATCH (a:Hub), (b:Hub) WHERE a.id < 2 AND b.id >= 2 AND b.id % 2 = a.id "
+                + "CREATE (a)-[:Spoke]->(b);"
+        )
+        let result = try conn.query("MATCH (a:Hub)-[:Spoke]->(b:Hub) RETURN a.name, b.id;")
+        var pairs: [String] = []
+        while let tuple = try result.getNextFactorized() {
+            var numFlatTuples: UInt64 = 1
+            for group in UInt64(0)..<tuple.getGroupCount() {
+                numFlatTuples *= try tuple.getRowCount(group)
+            }
+            let names = try tuple.getColumnValues(0).map { $0 as! String }
+            let ids = try tuple.getColumnValues(1).map { $0 as! Int64 }
+            if try tuple.getGroupIndex(0) == tuple.getGroupIndex(1) {
+                XCTAssertEqual(UInt64(ids.count), numFlatTuples)
+                pairs += zip(names, ids).map { "\($0.0)-\($0.1)" }
+            } else {
+                XCTAssertEqual(UInt64(names.count * ids.count), numFlatTuples)
+                for name in names {
+                    pairs += ids.map { "\(name)-\($0)" }
+                }
+            }
+        }
+        // Reading factorized tuples doesn't move the flat tuple iterator.
+        XCTAssertTrue(result.hasNext())
+        var expected: [String] = []
+        for id in 2...100 {
+            expected.append("h\(id % 2)-\(id)")
+        }
+        XCTAssertEqual(pairs.sorted(), expected.sorted())
+        result.resetIterator()
+        XCTAssertNotNil(try result.getNextFactorized())
+    }
+
+    func testUnwindLargeListParam() throws {
+        let conn = try Connection(db)
+        let listParam: [Any] = (0..<10000).map { "item\($0)" }
+        let stmt = try conn.prepare(
+            "UNWIND $list AS s WITH s WHERE s <> 'item0' RETURN COUNT(*), COUNT(DISTINCT s);"
+        )
+        let result = try conn.execute(stmt, ["list": listParam])
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 9999)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 9999)
+    }
+
+    func testLimitStopsParallelSource() throws {
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "UNWIND range(1, 1000000) AS i WITH i WHERE i % 2 = 0 RETURN i LIMIT 5;"
+        )
+        var numTuples = 0
+        while let tuple = try result.getNext() {
+            XCTAssertEqual(try tuple.getValue(0) as! Int64 % 2, 0)
+            numTuples += 1
+        }
+        XCTAssertEqual(numTuples, 5)
+    }
+
+    func testArrowStreamRoundTrip() throws {
+        let conn = try Connection(db)
+        for table in ["Src", "Dst"] {
+            _ = try conn.query(
+                "CREATE NODE TABLE \(table)(id INT64 PRIMARY KEY, name STRING, score DOUBLE);"
+            )
+        }
+        _ = try conn.query(
+            "UNWIND range(0, 4999) AS i CREATE (:Src {id: i, name: CASE WHEN i % 7 = 0 "
+                + "THEN NULL ELSE 'n' + string(i) END, score: i / 2.0});"
+        )
+        let result = try conn.query("MATCH (s:Src) RETURN s.id, s.name, s.score;")
+        // An ArrowArrayStream holds four callbacks and the private data pointer.
+        let stream = UnsafeMutableRawPointer.allocate(
+            byteCount: 5 * MemoryLayout<UnsafeRawPointer>.size,
+            alignment: MemoryLayout<UnsafeRawPointer>.alignment
+        )
+        defer { stream.deallocate() }
+        try result.exportArrowStream(chunkSize: 1000, stream)
+        _ = try conn.copyFromArrowStream("Dst", stream)
+        releaseArrowStream(stream)
+        let check = try conn.query(
+            "MATCH (s:Src), (d:Dst) WHERE s.id = d.id AND s.score = d.score AND "
+                + "((s.name IS NULL AND d.name IS NULL) OR s.name = d.name) RETURN COUNT(*);"
+        )
+        XCTAssertEqual(try check.getNext()!.getValue(0) as! Int64, 5000)
+    }
+
+    func testSequenceNextValBatches() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE SEQUENCE seq START 10 INCREMENT 3 MAXVALUE 30010;")
+        let result = try conn.query(
+            "UNWIND range(1, 10000) AS i WITH nextval('seq') AS v "
+                + "RETURN COUNT(DISTINCT v), MIN(v), MAX(v), SUM(v % 3);"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 10000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 10)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, 30007)
+        XCTAssertEqual(try tuple.getValue(3) as! Int64, 10000)
+        // Running out of values doesn't consume the values left in the sequence.
+        XCTAssertThrowsError(try conn.query("UNWIND range(1, 2) AS i RETURN nextval('seq');"))
+        let next = try conn.query("RETURN nextval('seq');")
+        XCTAssertEqual(try next.getNext()!.getValue(0) as! Int64, 30010)
+    }
+
+    func testStatsAfterDeletions() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE churn(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(1, 100) AS i CREATE (:churn {id: i});")
+        _ = try conn.query("MATCH (x:churn) WHERE x.id > 40 DELETE x;")
+        let query =
+            "CALL stats_info('churn') RETURN cardinality, changes_since_refresh, "
+            + "last_refreshed IS NULL, id_distinct_count;"
+        var tuple = try conn.query(query).getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 40)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 60)
+        XCTAssertTrue(try tuple.getValue(2) as! Bool)
+        XCTAssertLessThanOrEqual(try tuple.getValue(3) as! Int64, 40)
+        _ = try conn.query("CALL analyze('churn');")
+        tuple = try conn.query(query).getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 40)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 0)
+        XCTAssertFalse(try tuple.getValue(2) as! Bool)
+    }
+
+    func testManyTablesCatalogLookups() throws {
+        let conn = try Connection(db)
+        for i in 0..<200 {
+            _ = try conn.query("CREATE NODE TABLE tenant\(i)(id INT64, PRIMARY KEY(id));")
+        }
+        _ = try conn.query("CREATE REL TABLE tenantLink(FROM tenant0 TO tenant199);")
+        _ = try conn.query("CREATE (:tenant0 {id: 1})-[:tenantLink]->(:tenant199 {id: 2});")
+        _ = try conn.query("ALTER TABLE tenant199 RENAME TO tenantLast;")
+        _ = try conn.query("DROP TABLE tenant5;")
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query("CREATE NODE TABLE tenantRolledBack(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("ROLLBACK;")
+        // Rel tables look their node tables up by ID.
+        let result = try conn.query(
+            "MATCH (a:tenant0)-[:tenantLink]->(b) RETURN label(a), label(b), b.id;")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! String, "tenant0")
+        XCTAssertEqual(try tuple.getValue(1) as! String, "tenantLast")
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, 2)
+        let union = try conn.query("MATCH (x:tenant0:tenantLast:tenant100) RETURN count(*);")
+        XCTAssertEqual(try union.getNext()!.getValue(0) as! Int64, 2)
+        XCTAssertThrowsError(try conn.query("MATCH (x:tenant5) RETURN x;"))
+        XCTAssertThrowsError(try conn.query("MATCH (x:tenant199) RETURN x;"))
+        XCTAssertThrowsError(try conn.query("MATCH (x:tenantRolledBack) RETURN x;"))
+    }
+
+    func testBitpackedColumnFilters() throws {
+        let conn = try Connection(db)
+        _ = try conn.query(
+            "CREATE NODE TABLE Sample(id INT64 PRIMARY KEY, score INT64, debt INT64, "
+                + "kind INT64, level INT64);"
+        )
+        _ = try conn.query(
+            "COPY Sample FROM (UNWIND range(0, 9999) AS i RETURN i, 1000000 + i % 1000, "
+                + "-1 - i % 50, 7, CASE WHEN i % 10 = 0 THEN NULL ELSE i % 4 END);"
+        )
+        _ = try conn.query("CHECKPOINT;")
+        func count(_ predicate: String) throws -> Int64 {
+            let result = try conn.query(
+                "MATCH (s:Sample) WHERE \(predicate) RETURN count(*);"
+            )
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        XCTAssertEqual(try count("s.score = 1000042"), 10)
+        XCTAssertEqual(try count("s.score > 1000989 AND s.score <= 1000999"), 100)
+        XCTAssertEqual(try count("s.score < 1000000"), 0)
+        XCTAssertEqual(try count("s.score >= 1000000"), 10000)
+        XCTAssertEqual(try count("s.debt = -50"), 200)
+        XCTAssertEqual(try count("s.debt >= -2"), 400)
+        XCTAssertEqual(try count("s.kind = 7"), 10000)
+        XCTAssertEqual(try count("s.kind <> 7"), 0)
+        XCTAssertEqual(try count("s.kind > 7"), 0)
+        XCTAssertEqual(try count("s.level = 0"), 2000)
+        XCTAssertEqual(try count("s.level < 2"), 4500)
+        XCTAssertEqual(try count("s.id > 9990 AND s.score > 1000995"), 4)
+        // Values updated since the checkpoint must still be found.
+        _ = try conn.query("MATCH (s:Sample) WHERE s.id = 3 SET s.score = 5, s.kind = 8;")
+        XCTAssertEqual(try count("s.score = 5"), 1)
+        XCTAssertEqual(try count("s.kind = 8"), 1)
+        _ = try conn.query("CHECKPOINT;")
+        XCTAssertEqual(try count("s.score = 5"), 1)
+        XCTAssertEqual(try count("s.kind = 7"), 9999)
+    }
+
+    func testTriangleCountOverHubNode() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Peer(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Follows(FROM Peer TO Peer);")
+        _ = try conn.query("COPY Peer FROM (UNWIND range(0, 1999) AS i RETURN i);")
+        // Peer 0 follows every other peer, which each follow the next one.
+        _ = try conn.query(
+            "COPY Follows FROM (UNWIND range(1, 1999) AS i RETURN 0, i);"
+        )
+        _ = try conn.query(
+            "COPY Follows FROM (UNWIND range(1, 1998) AS i RETURN i, i + 1);"
+        )
+        let result = try conn.query(
+            "MATCH (a:Peer)-[:Follows]->(b:Peer)-[:Follows]->(c:Peer), (a)-[:Follows]->(c) "
+                + "RETURN count(*);"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1998)
+        let fromPeer = try conn.query(
+            "MATCH (a:Peer)-[:Follows]->(b:Peer)-[:Follows]->(c:Peer), (a)-[:Follows]->(c) "
+                + "WHERE b.id = 1000 RETURN c.id;"
+        )
+        XCTAssertEqual(try fromPeer.getNext()!.getValue(0) as! Int64, 1001)
+    }
+
+    func testOrderByMergesSkewedRuns() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Score(id INT64 PRIMARY KEY, v INT64);")
+        // Most values are the same, so consecutive runs interleave unevenly while merged.
+        _ = try conn.query(
+            "COPY Score FROM (UNWIND range(0, 199999) AS i "
+                + "RETURN i, CASE WHEN i % 10 = 0 THEN (i * 7919) % 200000 ELSE 100000 END);"
+        )
+        let result = try conn.query("MATCH (s:Score) RETURN s.v, s.id ORDER BY s.v, s.id;")
+        var numTuples = 0
+        var previous: (Int64, Int64)? = nil
+        while let tuple = try result.getNext() {
+            let current = (try tuple.getValue(0) as! Int64, try tuple.getValue(1) as! Int64)
+            if let previous {
+                XCTAssertTrue(previous < current)
+            }
+            previous = current
+            numTuples += 1
+        }
+        XCTAssertEqual(numTuples, 200000)
+    }
+
+    func testQueryResultCache() throws {
+        let conn = try Connection(db)
+        let other = try Connection(db)
+        _ = try conn.query("CALL query_result_cache_size=\(64 * 1024 * 1024);")
+        let query = "MATCH (a:person) RETURN a.ID ORDER BY a.ID;"
+        func ids(_ result: QueryResult) throws -> [Int64] {
+            var ids: [Int64] = []
+            while let tuple = try result.getNext() {
+                ids.append(try tuple.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        let expected = try ids(conn.query(query))
+        // Cached results are shared by the connections, and read independently.
+        let first = try conn.query(query)
+        let second = try other.query(query)
+        XCTAssertEqual(try ids(first), expected)
+        XCTAssertEqual(try ids(second), expected)
+        _ = try other.query("CREATE (:person {ID: 1000, fName: 'New'});")
+        XCTAssertEqual(try ids(conn.query(query)), expected + [1000])
+        let stmt = try conn.prepare("MATCH (a:person) WHERE a.ID < $id RETURN count(*);")
+        for id: Int64 in [3, 1000, 3, 1001] {
+            #if os(Linux)
+                let result = try conn.execute(stmt, ["id": KuzuInt64Wrapper(value: id)])
+            #else
+                let result = try conn.execute(stmt, ["id": id])
+            #endif
+            let expectedCount = expected.filter { $0 < id }.count + (id > 1000 ? 1 : 0)
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, Int64(expectedCount))
+        }
+        // Queries calling non-deterministic functions are executed every time.
+        let random = "RETURN rand();"
+        XCTAssertNotEqual(
+            try conn.query(random).getNext()!.getValue(0) as! Double,
+            try conn.query(random).getNext()!.getValue(0) as! Double
+        )
+        // Uncommitted changes are seen by the queries of their transaction.
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query("MATCH (a:person) WHERE a.ID = 1000 DELETE a;")
+        XCTAssertEqual(try ids(conn.query(query)), expected)
+        _ = try conn.query("ROLLBACK;")
+        XCTAssertEqual(try ids(conn.query(query)), expected + [1000])
+    }
+
+    func testAggregateView() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Sale(id INT64 PRIMARY KEY, shop STRING, amount INT64);")
+        _ = try conn.query(
+            "UNWIND range(0, 99) AS i "
+                + "CREATE (:Sale {id: i, shop: concat('shop', CAST(i % 3 AS STRING)), amount: i});"
+        )
+        _ = try conn.query("CALL create_aggregate_view('Sale', 'sales', 'shop', 'COUNT', '*');")
+        _ = try conn.query("CALL create_aggregate_view('Sale', 'revenue', 'shop', 'SUM', 'amount');")
+        func groups(_ view: String) throws -> [String: Int64] {
+            let result = try conn.query("CALL aggregate_view('Sale', '\(view)') RETURN *;")
+            var groups: [String: Int64] = [:]
+            while let tuple = try result.getNext() {
+                groups[try tuple.getValue(0) as! String] = try tuple.getValue(1) as? Int64
+            }
+            return groups
+        }
+        func expected(_ aggregate: String) throws -> [String: Int64] {
+            let result = try conn.query("MATCH (s:Sale) RETURN s.shop, \(aggregate);")
+            var groups: [String: Int64] = [:]
+            while let tuple = try result.getNext() {
+                groups[try tuple.getValue(0) as! String] = try tuple.getValue(1) as? Int64
+            }
+            return groups
+        }
+        XCTAssertEqual(try groups("sales"), ["shop0": 34, "shop1": 33, "shop2": 33])
+        XCTAssertEqual(try groups("revenue"), try expected("CAST(sum(s.amount) AS INT64)"))
+        // Inserts are applied to the groups, while updates and deletions recompute them.
+        _ = try conn.query("CREATE (:Sale {id: 100, shop: 'shop3', amount: 5});")
+        XCTAssertEqual(try groups("sales"), try expected("count(*)"))
+        XCTAssertEqual(try groups("revenue"), try expected("CAST(sum(s.amount) AS INT64)"))
+        _ = try conn.query("MATCH (s:Sale) WHERE s.id < 10 SET s.amount = s.amount * 10;")
+        _ = try conn.query("MATCH (s:Sale) WHERE s.id = 1 DELETE s;")
+        XCTAssertEqual(try groups("sales"), try expected("count(*)"))
+        XCTAssertEqual(try groups("revenue"), try expected("CAST(sum(s.amount) AS INT64)"))
+        XCTAssertThrowsError(
+            try conn.query("CALL create_aggregate_view('Sale', 'bad', 'shop', 'SUM', '*');")
+        )
+        _ = try conn.query("CALL drop_aggregate_view('Sale', 'sales');")
+        XCTAssertThrowsError(try conn.query("CALL aggregate_view('Sale', 'sales') RETURN *;"))
+    }
+
+    func testPipelineTuplesPerThread() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CALL threads=4;")
+        let query = "MATCH (a:person)-[:knows]->(b:person) RETURN COUNT(*);"
+        let expected = try conn.query(query).getNext()!.getValue(0) as! Int64
+        // Pipelines fan out to every thread, run on the thread of the query, and ignore estimates.
+        for numTuples in [1, 1_000_000, 0] {
+            _ = try conn.query("CALL pipeline_tuples_per_thread=\(numTuples);")
+            let tuple = try conn.query(query).getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, expected)
+        }
+        _ = try conn.query("CALL pipeline_tuples_per_thread=1000000;")
+        // Errors of pipelines run on the thread of the query are reported as usual.
+        XCTAssertThrowsError(try conn.query("MATCH (a:person) RETURN CAST(a.fName AS INT64);"))
+        XCTAssertThrowsError(try conn.query("CALL pipeline_tuples_per_thread=-1;"))
+    }
+
+    func testReverseIndex() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Account(id INT64 PRIMARY KEY);")
+        _ = try conn.query(
+            "CREATE REL TABLE Pays(FROM Account TO Account) WITH (storage_direction = 'fwd');")
+        _ = try conn.query("UNWIND range(0, 99) AS i CREATE (:Account {id: i});")
+        _ = try conn.query(
+            "MATCH (a:Account), (b:Account) WHERE b.id = (a.id * 7 + 3) % 100 "
+                + "OR b.id = (a.id + 1) % 100 CREATE (a)-[:Pays]->(b);"
+        )
+        func payers(_ id: Int) throws -> [Int64] {
+            let result = try conn.query(
+                "MATCH (a:Account)-[:Pays]->(b:Account) WHERE b.id = \(id) "
+                    + "RETURN a.id ORDER BY a.id;"
+            )
+            var ids: [Int64] = []
+            while let tuple = try result.getNext() {
+                ids.append(try tuple.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        func state() throws -> String {
+            let result = try conn.query("CALL reverse_index_info('Pays') RETURN state;")
+            return try result.getNext()!.getValue(0) as! String
+        }
+        XCTAssertEqual(try state(), "DISABLED")
+        XCTAssertEqual(try payers(10), [1, 9])
+        _ = try conn.query("CALL create_reverse_index('Pays');")
+        // The index is built in the background, and again by queries once a change dropped it.
+        var attempts = 0
+        while try state() != "READY" && attempts < 200 {
+            XCTAssertEqual(try payers(10), [1, 9])
+            Thread.sleep(forTimeInterval: 0.01)
+            attempts += 1
+        }
+        XCTAssertEqual(try state(), "READY")
+        XCTAssertEqual(try payers(10), [1, 9])
+        XCTAssertEqual(try payers(0), [99])
+        // Committed inserts are added to the index, and deletions drop it.
+        _ = try conn.query(
+            "MATCH (a:Account), (b:Account) WHERE a.id = 50 AND b.id = 10 CREATE (a)-[:Pays]->(b);")
+        XCTAssertEqual(try state(), "READY")
+        XCTAssertEqual(try payers(10), [1, 9, 50])
+        // Write transactions see their own rels.
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query(
+            "MATCH (a:Account), (b:Account) WHERE a.id = 60 AND b.id = 10 CREATE (a)-[:Pays]->(b);")
+        XCTAssertEqual(try payers(10), [1, 9, 50, 60])
+        _ = try conn.query("ROLLBACK;")
+        _ = try conn.query("MATCH (a:Account)-[r:Pays]->(b:Account) WHERE a.id = 9 DELETE r;")
+        XCTAssertEqual(try payers(10), [1, 50])
+        XCTAssertThrowsError(try conn.query("CALL create_reverse_index('Account');"))
+        _ = try conn.query("CALL drop_reverse_index('Pays');")
+        XCTAssertEqual(try state(), "DISABLED")
+        XCTAssertEqual(try payers(10), [1, 50])
+    }
+
+    func testCSRCacheFollowsTableChanges() throws {
+        let conn = try Connection(db)
+        let uncached = try Connection(db)
+        let reader = try Connection(db)
+        _ = try conn.query("CALL csr_cache_rel_tables='knows';")
+        _ = try reader.query("CALL csr_cache_rel_tables='knows';")
+        let query = "MATCH (a:person)-[:knows*1..2]->(b:person) WHERE a.ID = 0 RETURN COUNT(*);"
+        func count(_ connection: Connection) throws -> Int64 {
+            return try connection.query(query).getNext()!.getValue(0) as! Int64
+        }
+        let initial = try count(uncached)
+        // The cache built by the first query is read by the next ones.
+        XCTAssertEqual(try count(conn), initial)
+        XCTAssertEqual(try count(conn), initial)
+        _ = try reader.query("BEGIN TRANSACTION READ ONLY;")
+        XCTAssertEqual(try count(reader), initial)
+        _ = try conn.query(
+            "MATCH (a:person {ID: 0}), (b:person {ID: 7}) CREATE (a)-[:knows]->(b);")
+        let inserted = try count(uncached)
+        XCTAssertGreaterThan(inserted, initial)
+        XCTAssertEqual(try count(conn), inserted)
+        // A cache of the new snapshot isn't read by a transaction that started before the insert.
+        XCTAssertEqual(try count(reader), initial)
+        _ = try reader.query("COMMIT;")
+        XCTAssertEqual(try count(reader), inserted)
+        _ = try conn.query("MATCH (:person {ID: 0})-[e:knows]->(:person {ID: 7}) DELETE e;")
+        XCTAssertEqual(try count(conn), initial)
+        XCTAssertEqual(try count(reader), initial)
+    }
+
+    func testTwoQueueEvictionIsChosenWhenOpeningTheDatabase() throws {
+        func policy(_ connection: Connection) throws -> String {
+            return try connection.query("CALL current_setting('eviction_policy') RETURN *;")
+                .getNext()!.getValue(0) as! String
+        }
+        do {
+            let conn = try Connection(db)
+            XCTAssertEqual(try policy(conn), "SECOND_CHANCE")
+            XCTAssertThrowsError(try conn.query("CALL eviction_policy='TWO_QUEUE';"))
+            _ = try conn.query("CREATE NODE TABLE Scanned(id INT64, payload STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 200000) AS i CREATE (:Scanned {id: i, payload: repeat('x', 100)});"
+            )
+        }
+        db = nil
+        db = try Database(
+            path,
+            SystemConfig(
+                bufferPoolSize: 16 * 1024 * 1024, maxNumThreads: 4,
+                enableTwoQueueEviction: true))
+        let conn = try Connection(db)
+        let other = try Connection(db)
+        XCTAssertEqual(try policy(conn), "TWO_QUEUE")
+        XCTAssertEqual(try policy(other), "TWO_QUEUE")
+        // Scans larger than the buffer pool cycle their pages through the probationary queue while
+        // the pages read again are kept.
+        for _ in 0..<3 {
+            let tuple = try conn.query(
+                "MATCH (s:Scanned) WHERE s.payload <> '' RETURN COUNT(*), CAST(SUM(s.id) AS INT64);"
+            ).getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, 200000)
+            XCTAssertEqual(try tuple.getValue(1) as! Int64, 20_000_100_000)
+            let name = try other.query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;")
+                .getNext()!.getValue(0) as! String
+            XCTAssertEqual(name, "Alice")
+        }
+    }
+
+    func testFailedWALSyncInvalidatesDatabase() throws {
+        let conn = try Connection(db)
+        // The setting is only built with runtime checks enabled.
+        let hasSetting =
+            (try? conn.query("CALL current_setting('debug_fail_wal_sync') RETURN *;")) != nil
+        try XCTSkipUnless(hasSetting, "debug_fail_wal_sync is not available in this build")
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE (:Item {id: 1});")
+        _ = try conn.query("CALL debug_fail_wal_sync=true;")
+        XCTAssertThrowsError(try conn.query("CREATE (:Item {id: 2});")) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("durable"))
+        }
+        // The failed commit is neither visible nor rolled back, and nothing can run anymore.
+        XCTAssertThrowsError(try conn.query("MATCH (i:Item) RETURN COUNT(*);")) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("invalidated"))
+        }
+        let otherConn = try Connection(db)
+        XCTAssertThrowsError(try otherConn.query("RETURN 1;"))
+        XCTAssertThrowsError(try conn.query("BEGIN TRANSACTION;"))
+    }
+
+    func testDeltaBitpackingAfterReopen() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE delta(id INT64, seq INT64, PRIMARY KEY(id));"
+            )
+            _ = try conn.query("CREATE REL TABLE deltaNext(FROM delta TO delta);")
+            _ = try conn.query(
+                "UNWIND range(1, 5000) AS i CREATE (:delta {id: i, seq: i * 1000});"
+            )
+            _ = try conn.query(
+                """
+                MATCH (a:delta), (b:delta) WHERE b.id = a.id + 1
+                CREATE (a)-[:deltaNext]->(b);
+                """
+            )
+            _ = try conn.query("CHECKPOINT;")
+            let result = try conn.query(
+                "CALL storage_info('delta') RETURN column_name, compression;"
+            )
+            var numDeltaChunks = 0
+            while result.hasNext() {
+                let tuple = try result.getNext()!
+                let compression = try tuple.getValue(1) as! String
+                if compression.hasPrefix("DELTA_BITPACKING") {
+                    numDeltaChunks += 1
+                }
+            }
+            XCTAssertGreaterThan(numDeltaChunks, 0)
+        }
+        db = nil
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 256 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        var result = try conn.query("MATCH (a:delta) RETURN COUNT(*), SUM(a.seq);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 5000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 1000 * 5000 * 5001 / 2)
+        result = try conn.query("MATCH (a:delta) WHERE a.id = 4321 RETURN a.seq;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 4_321_000)
+        result = try conn.query(
+            "MATCH (a:delta)-[:deltaNext]->(b:delta) WHERE a.id = 2500 RETURN b.seq;"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 2_501_000)
+        result = try conn.query("MATCH ()-[e:deltaNext]->() RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 4999)
+    }
+
+    func testFSSTStringsAfterReopen() throws {
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE fsst(id INT64, url STRING, PRIMARY KEY(id));"
+            )
+            _ = try conn.query(
+                """
+                UNWIND range(1, 5000) AS i CREATE (:fsst {id: i,
+                url: 'https://example.com/users/profile/settings/' + CAST(i, 'STRING')});
+                """
+            )
+            _ = try conn.query("CHECKPOINT;")
+            let result = try conn.query("CALL storage_info('fsst') RETURN compression;")
+            var numFSSTChunks = 0
+            while result.hasNext() {
+                if try result.getNext()!.getValue(0) as! String == "FSST" {
+                    numFSSTChunks += 1
+                }
+            }
+            XCTAssertGreaterThan(numFSSTChunks, 0)
+        }
+        db = nil
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 256 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        db = try Database(path, systemConfig)
+        let conn = try Connection(db)
+        var result = try conn.query("MATCH (a:fsst) WHERE a.id = 4321 RETURN a.url;")
+        XCTAssertEqual(
+            try result.getNext()!.getValue(0) as! String,
+            "https://example.com/users/profile/settings/4321"
+        )
+        result = try conn.query(
+            "MATCH (a:fsst) WHERE a.url ENDS WITH '/settings/17' RETURN COUNT(*);"
+        )
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1)
+        result = try conn.query(
+            """
+            MATCH (a:fsst) WHERE a.url = 'https://example.com/users/profile/settings/' +
+            CAST(a.id, 'STRING') RETURN COUNT(*);
+            """
+        )
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 5000)
+    }
+
+    func testExecuteError() throws {
+        let conn = try Connection(db)
+        let stmt = try conn.prepare("RETURN $a;")
+
+        do {
+            #if os(Linux)
+                _ = try conn.execute(stmt, ["b": KuzuInt64Wrapper(value: 1)])
+            #else
+                _ = try conn.execute(stmt, ["b": Int64(1)])
+            #endif
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("Parameter a not found"))
+        } catch {
+            XCTFail("Unexpected error type")
+        }
+    }
+
+    func testPKBloomFilter() throws {
+        // Lookups of persisted keys are never filtered out, and missing keys are not found.
+        func checkLookups(_ conn: Connection, numItems: Int64) throws {
+            var result = try conn.query(
+                "UNWIND range(0, 1999) AS i MATCH (b:BloomItem {id: i}) RETURN COUNT(*);"
+            )
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, numItems)
+            result = try conn.query(
+                "UNWIND range(0, 1999) AS i MATCH (b:BloomName {name: 'n' + string(i)}) "
+                    + "RETURN COUNT(*);"
+            )
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1000)
+            XCTAssertThrowsError(try conn.query("CREATE (:BloomItem {id: 1998, v: 0});"))
+            XCTAssertThrowsError(try conn.query("CREATE (:BloomName {name: 'n999'});"))
+        }
+        do {
+            let conn = try Connection(db)
+            _ = try conn.query("CALL pk_bloom_filter=true;")
+            _ = try conn.query("CREATE NODE TABLE BloomItem(id INT64 PRIMARY KEY, v INT64);")
+            _ = try conn.query("CREATE NODE TABLE BloomName(name STRING PRIMARY KEY);")
+            _ = try conn.query(
+                "UNWIND range(0, 9999) AS i CREATE (:BloomItem {id: i * 2, v: i});")
+            _ = try conn.query(
+                "UNWIND range(0, 999) AS i CREATE (:BloomName {name: 'n' + string(i)});")
+            _ = try conn.query("CHECKPOINT;")
+            try checkLookups(conn, numItems: 1000)
+
+            _ = try conn.query("MERGE (b:BloomItem {id: 1}) ON CREATE SET b.v = -1;")
+            _ = try conn.query("MERGE (b:BloomItem {id: 2}) ON MATCH SET b.v = 1;")
+            var result = try conn.query(
+                "MATCH (b:BloomItem) WHERE b.id < 3 RETURN b.id, b.v ORDER BY b.id;"
+            )
+            for expected: [Int64] in [[0, 0], [1, -1], [2, 1]] {
+                let tuple = try result.getNext()!
+                XCTAssertEqual(try tuple.getValue(0) as! Int64, expected[0])
+                XCTAssertEqual(try tuple.getValue(1) as! Int64, expected[1])
+            }
+            XCTAssertFalse(result.hasNext())
+
+            // Outgrowing the filters rebuilds them at checkpoint.
+            _ = try conn.query(
+                "UNWIND range(1, 19999) AS i WITH i WHERE i % 2 = 1 AND i > 1 "
+                    + "CREATE (:BloomItem {id: i, v: 0});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+            try checkLookups(conn, numItems: 2000)
+        }
+
+        // The filters are persisted with the index.
+        db = nil
+        db = try Database(
+            path,
+            SystemConfig(
+                bufferPoolSize: 256 * 1024 * 1024, maxNumThreads: 4, enableCompression: true,
+                readOnly: false, autoCheckpoint: true, checkpointThreshold: UInt64.max))
+        let conn = try Connection(db)
+        _ = try conn.query("CALL pk_bloom_filter=true;")
+        try checkLookups(conn, numItems: 2000)
+
+        // Disabling the setting drops the filters.
+        _ = try conn.query("CALL pk_bloom_filter=false;")
+        _ = try conn.query("CREATE (:BloomItem {id: 100001, v: 0});")
+        _ = try conn.query("CHECKPOINT;")
+        try checkLookups(conn, numItems: 2000)
+        let result = try conn.query("MATCH (b:BloomItem) RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 20001)
+    }
+
+    /// Creates `numNodes` BfsNode nodes, each with `degree` BfsEdge rels to pseudo-random nodes,
+    /// and returns the out-neighbors of each node, with one entry per rel.
+    private func createBFSGraph(_ conn: Connection, numNodes: Int, degree: Int) throws -> [[Int]] {
+        _ = try conn.query("CREATE NODE TABLE BfsNode(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE BfsEdge(FROM BfsNode TO BfsNode);")
+        _ = try conn.query("UNWIND range(0, \(numNodes - 1)) AS i CREATE (:BfsNode {id: i});")
+        _ = try conn.query(
+            "COPY BfsEdge FROM (UNWIND range(0, \(numNodes - 1)) AS i "
+                + "UNWIND range(0, \(degree - 1)) AS j "
+                + "RETURN i, (i * 37 + j * 101 + i * j * 13) % \(numNodes));"
+        )
+        var adjacency = [[Int]](repeating: [], count: numNodes)
+        for i in 0..<numNodes {
+            for j in 0..<degree {
+                adjacency[i].append((i * 37 + j * 101 + i * j * 13) % numNodes)
+            }
+        }
+        return adjacency
+    }
+
+    /// Returns the neighbors of each node when rels are followed in both directions.
+    private func undirectedBFSAdjacency(_ adjacency: [[Int]]) -> [[Int]] {
+        var undirected = adjacency
+        for (src, dsts) in adjacency.enumerated() {
+            for dst in dsts {
+                undirected[dst].append(src)
+            }
+        }
+        return undirected
+    }
+
+    /// Returns the length and the number of shortest paths from `source` to each node it reaches,
+    /// passing only through nodes for which `isInGraph` holds.
+    private func expectedShortestPaths(
+        _ adjacency: [[Int]], from source: Int, isInGraph: (Int) -> Bool = { _ in true }
+    ) -> [Int: (length: Int, count: Int)] {
+        var paths = [source: (length: 0, count: 1)]
+        var frontier = [source]
+        var length = 0
+        while !frontier.isEmpty {
+            length += 1
+            var next: [Int] = []
+            for node in frontier {
+                for nbr in adjacency[node] where isInGraph(nbr) {
+                    if let path = paths[nbr] {
+                        if path.length == length {
+                            paths[nbr]!.count += paths[node]!.count
+                        }
+                    } else {
+                        paths[nbr] = (length, paths[node]!.count)
+                        next.append(nbr)
+                    }
+                }
+            }
+            frontier = next
+        }
+        paths[source] = nil
+        return paths
+    }
+
+    func testShortestPathsWithDirectionOptimizingBFS() throws {
+        let conn = try Connection(db)
+        // Frontiers of a low diameter graph soon cover most nodes, so the middle iterations pull.
+        let adjacency = try createBFSGraph(conn, numNodes: 2000, degree: 6)
+        for (arrow, graph) in [("->", adjacency), ("-", undirectedBFSAdjacency(adjacency))] {
+            var expected = expectedShortestPaths(graph, from: 0)
+            var result = try conn.query(
+                "MATCH (a:BfsNode {id: 0})-[e:BfsEdge* SHORTEST 1..30]\(arrow)(b:BfsNode) "
+                    + "WHERE b.id <> 0 RETURN b.id, length(e);"
+            )
+            var numRows = 0
+            while let tuple = try result.getNext() {
+                let id = Int(try tuple.getValue(0) as! Int64)
+                XCTAssertEqual(Int(try tuple.getValue(1) as! Int64), expected[id]?.length, arrow)
+                numRows += 1
+            }
+            XCTAssertEqual(numRows, expected.count, arrow)
+
+            result = try conn.query(
+                "MATCH (a:BfsNode {id: 0})-[e:BfsEdge* ALL SHORTEST 1..30]\(arrow)(b:BfsNode) "
+                    + "WHERE b.id <> 0 RETURN b.id, length(e), COUNT(*);"
+            )
+            numRows = 0
+            while let tuple = try result.getNext() {
+                let id = Int(try tuple.getValue(0) as! Int64)
+                XCTAssertEqual(Int(try tuple.getValue(1) as! Int64), expected[id]?.length, arrow)
+                XCTAssertEqual(Int(try tuple.getValue(2) as! Int64), expected[id]?.count, arrow)
+                numRows += 1
+            }
+            XCTAssertEqual(numRows, expected.count, arrow)
+
+            // Nodes pulled into the frontier must pass the path node predicate.
+            expected = expectedShortestPaths(graph, from: 0, isInGraph: { $0 % 7 != 3 })
+            result = try conn.query(
+                "MATCH (a:BfsNode {id: 0})-[e:BfsEdge* SHORTEST 1..30 (r, n | WHERE n.id % 7 <> 3)]"
+                    + "\(arrow)(b:BfsNode) WHERE b.id <> 0 AND b.id % 7 <> 3 "
+                    + "RETURN b.id, length(e);"
+            )
+            numRows = 0
+            while let tuple = try result.getNext() {
+                let id = Int(try tuple.getValue(0) as! Int64)
+                XCTAssertEqual(Int(try tuple.getValue(1) as! Int64), expected[id]?.length, arrow)
+                numRows += 1
+            }
+            XCTAssertEqual(numRows, expected.count, arrow)
+        }
+    }
+
+    func testSinglePairShortestPathsFromBothEnds() throws {
+        let conn = try Connection(db)
+        let adjacency = try createBFSGraph(conn, numNodes: 2000, degree: 3)
+        // A node without rels is unreachable.
+        _ = try conn.query("CREATE (:BfsNode {id: 2000});")
+        for (arrow, graph) in [("->", adjacency), ("-", undirectedBFSAdjacency(adjacency))] {
+            for (src, dst) in [(0, 1999), (17, 1234), (1500, 3), (42, 43), (5, 2000)] {
+                let shortest = expectedShortestPaths(graph, from: src)[dst]
+                func match(_ bounds: String) -> String {
+                    return "MATCH (a:BfsNode {id: \(src)})-[e:BfsEdge* \(bounds)]\(arrow)"
+                        + "(b:BfsNode {id: \(dst)}) "
+                }
+                var result = try conn.query(
+                    match("SHORTEST 1..30")
+                        + "RETURN length(e), properties(nodes(e), 'id');"
+                )
+                guard let expected = shortest else {
+                    XCTAssertFalse(result.hasNext(), "\(src) \(arrow) \(dst)")
+                    continue
+                }
+                let tuple = try result.getNext()!
+                XCTAssertFalse(result.hasNext())
+                XCTAssertEqual(Int(try tuple.getValue(0) as! Int64), expected.length)
+                // The nodes of the path must be joined by existing rels.
+                var path = (try tuple.getValue(1) as! [Any]).map { Int($0 as! Int64) }
+                if path.first != src {
+                    path.insert(src, at: 0)
+                }
+                if path.last != dst {
+                    path.append(dst)
+                }
+                XCTAssertEqual(path.count, expected.length + 1)
+                for (from, to) in zip(path, path.dropFirst()) {
+                    XCTAssertTrue(graph[from].contains(to), "\(path)")
+                }
+
+                result = try conn.query(
+                    match("ALL SHORTEST 1..30") + "RETURN COUNT(*), MIN(length(e));"
+                )
+                let counts = try result.getNext()!
+                XCTAssertEqual(Int(try counts.getValue(0) as! Int64), expected.count)
+                XCTAssertEqual(Int(try counts.getValue(1) as! Int64), expected.length)
+
+                // Pairs further apart than the upper bound are not matched.
+                if expected.length > 1 {
+                    result = try conn.query(
+                        match("SHORTEST 1..\(expected.length - 1)")
+                            + "RETURN length(e);"
+                    )
+                    XCTAssertFalse(result.hasNext(), "\(src) \(arrow) \(dst)")
+                }
+            }
+        }
+    }
+
+    func testShortestPathsFromManySources() throws {
+        let conn = try Connection(db)
+        let adjacency = try createBFSGraph(conn, numNodes: 2000, degree: 3)
+        // 150 sources run as two full batches of 64 sources and a partial one.
+        for (arrow, graph) in [("->", adjacency), ("-", undirectedBFSAdjacency(adjacency))] {
+            for upperBound in [3, 30] {
+                var expected: [Int: [Int: (length: Int, count: Int)]] = [:]
+                for src in 0..<150 {
+                    expected[src] = expectedShortestPaths(graph, from: src).filter {
+                        $0.value.length <= upperBound
+                    }
+                }
+                let match =
+                    "MATCH (a:BfsNode)-[e:BfsEdge* SHORTEST 1..\(upperBound)]\(arrow)(b:BfsNode) "
+                    + "WHERE a.id < 150 AND b.id <> a.id "
+                var result = try conn.query(
+                    match + "RETURN a.id, COUNT(*), SUM(length(e)), MAX(length(e));"
+                )
+                var numSources = 0
+                while let tuple = try result.getNext() {
+                    let lengths = expected[Int(try tuple.getValue(0) as! Int64)]!.values.map {
+                        $0.length
+                    }
+                    XCTAssertEqual(Int(try tuple.getValue(1) as! Int64), lengths.count)
+                    XCTAssertEqual(Int(try tuple.getValue(2) as! Int64), lengths.reduce(0, +))
+                    XCTAssertEqual(Int(try tuple.getValue(3) as! Int64), lengths.max())
+                    numSources += 1
+                }
+                XCTAssertEqual(numSources, expected.values.filter { !$0.isEmpty }.count)
+
+                result = try conn.query(
+                    match + "AND b.id % 50 = 0 RETURN a.id, b.id, length(e);"
+                )
+                var numRows = 0
+                while let tuple = try result.getNext() {
+                    let src = Int(try tuple.getValue(0) as! Int64)
+                    let dst = Int(try tuple.getValue(1) as! Int64)
+                    XCTAssertEqual(
+                        Int(try tuple.getValue(2) as! Int64), expected[src]![dst]?.length,
+                        "\(src) \(arrow) \(dst)")
+                    numRows += 1
+                }
+                XCTAssertEqual(
+                    numRows,
+                    expected.values.map { $0.keys.filter { $0 % 50 == 0 }.count }.reduce(0, +))
+            }
+        }
+    }
+
+    func testCopyFromArrowStream() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE ArrowItem(id INT64 PRIMARY KEY, name STRING);")
+        // Batches longer than a vector are cut into several morsels.
+        let batches: [[(id: Int64, name: String?)]] = [
+            (0..<3000).map { (Int64($0), $0 % 5 == 0 ? nil : "item\($0)") },
+            [],
+            (3000..<3500).map { (Int64($0), "item\($0)") },
+        ]
+        let arrowStream = ArrowTestStream(batches: batches)
+        _ = try conn.copyFromArrowStream("ArrowItem", UnsafeMutableRawPointer(arrowStream.stream))
+        XCTAssertFalse(arrowStream.isReleased)
+        let tuple = try conn.query(
+            "MATCH (i:ArrowItem) RETURN COUNT(*), SUM(i.id), COUNT(i.name), "
+                + "COUNT(CASE WHEN i.name = 'item' + string(i.id) THEN 1 END);"
+        ).getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 3500)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 3499 * 3500 / 2)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, 2900)
+        XCTAssertEqual(try tuple.getValue(3) as! Int64, 2900)
+        let nulls = try conn.query(
+            "MATCH (i:ArrowItem) WHERE i.name IS NULL AND i.id % 5 <> 0 RETURN COUNT(*);"
+        )
+        XCTAssertEqual(try nulls.getNext()!.getValue(0) as! Int64, 0)
+
+        // Copying a duplicated primary key fails like COPY FROM does.
+        let duplicate = ArrowTestStream(batches: [[(id: 7, name: "dup")]])
+        XCTAssertThrowsError(
+            try conn.copyFromArrowStream("ArrowItem", UnsafeMutableRawPointer(duplicate.stream)))
+        XCTAssertThrowsError(
+            try conn.copyFromArrowStream("Missing", UnsafeMutableRawPointer(duplicate.stream)))
+    }
+
+    func testCopyMemoryBudget() throws {
+        let conn = try Connection(db)
+        XCTAssertThrowsError(try conn.query("CALL copy_memory_budget=-1;"))
+        _ = try conn.query("CREATE NODE TABLE Station(id INT64 PRIMARY KEY);")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Station {id: i});")
+        let copy =
+            "FROM (UNWIND range(0, 299999) AS i RETURN i % 1000, (i * 7 + 3) % 1000, i);"
+        _ = try conn.query("CREATE REL TABLE Route(FROM Station TO Station, seq INT64);")
+        _ = try conn.query("COPY Route " + copy)
+        // A budget of a single byte spills every full node group while partitioning.
+        _ = try conn.query("CALL copy_memory_budget=1;")
+        _ = try conn.query("CREATE REL TABLE BudgetRoute(FROM Station TO Station, seq INT64);")
+        _ = try conn.query("COPY BudgetRoute " + copy)
+        _ = try conn.query("CALL copy_memory_budget=0;")
+        var expectedSum: Int64 = 0
+        for i in 0..<Int64(300000) {
+            expectedSum += (i % 1000) * 1000 + (i * 7 + 3) % 1000
+        }
+        for rel in ["Route", "BudgetRoute"] {
+            var result = try conn.query(
+                "MATCH (a:Station)-[r:\(rel)]->(b:Station) "
+                    + "RETURN COUNT(*), SUM(r.seq), SUM(a.id * 1000 + b.id);"
+            )
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, 300000, rel)
+            XCTAssertEqual(try tuple.getValue(1) as! Int64, 299999 * 300000 / 2, rel)
+            XCTAssertEqual(try tuple.getValue(2) as! Int64, expectedSum, rel)
+            result = try conn.query(
+                "MATCH (a:Station {id: 123})-[r:\(rel)]->(b:Station) "
+                    + "WHERE r.seq % 1000 <> 123 OR b.id <> (r.seq * 7 + 3) % 1000 RETURN COUNT(*);"
+            )
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 0, rel)
+        }
+    }
+
+    func testQueryPlanCacheSkipsNonDeterministicQueries() throws {
+        let conn = try Connection(db)
+        func numPlans() throws -> UInt64 {
+            let result = try conn.query("CALL query_plan_cache_info() RETURN num_plans;")
+            return try result.getNext()!.getValue(0) as! UInt64
+        }
+        // Calls without arguments are folded into literals when the query is bound, so a cached
+        // plan would return the values of its first execution.
+        let query = "RETURN current_timestamp(), rand();"
+        let first = try conn.query(query).getNext()!
+        Thread.sleep(forTimeInterval: 0.01)
+        let second = try conn.query(query).getNext()!
+        XCTAssertNotEqual(try first.getValue(0) as! Date, try second.getValue(0) as! Date)
+        XCTAssertNotEqual(try first.getValue(1) as! Double, try second.getValue(1) as! Double)
+        XCTAssertEqual(try numPlans(), 0)
+        _ = try conn.query("RETURN 1 + 1;")
+        XCTAssertEqual(try numPlans(), 1)
+    }
+
+    func testCrossProductInequalityMatchesUnoptimizedPlan() throws {
+        let conn = try Connection(db)
+        for table in ["ProbeSide", "BuildSide"] {
+            _ = try conn.query(
+                "CREATE NODE TABLE \(table)(id INT64 PRIMARY KEY, i INT64, s INT32, d DOUBLE, "
+                    + "f DOUBLE);"
+            )
+        }
+        // INT64 keys above 2^53 are not exact as doubles, d holds NaNs and every column has nulls.
+        func insert(_ table: String, numRows: Int, seed: Int) throws {
+            _ = try conn.query(
+                """
+                UNWIND range(0, \(numRows - 1)) AS k
+                WITH k, (k * \(seed)) % 1000 - 500 AS v
+                CREATE (:\(table) {
+                    id: k,
+                    i: CASE WHEN k % 50 = 0 THEN NULL
+                        WHEN k % 7 = 0 THEN 9007199254740992 + k % 5
+                        WHEN k % 11 = 0 THEN -9007199254740993 - k % 3 ELSE v END,
+                    s: CASE WHEN k % 40 = 0 THEN NULL ELSE CAST(v AS INT32) END,
+                    d: CASE WHEN k % 30 = 0 THEN NULL WHEN k % 97 = 0 THEN 0.0 / 0.0
+                        ELSE v / 4.0 END,
+                    f: CASE WHEN k % 30 = 1 THEN NULL ELSE v / 4.0 END
+                });
+                """
+            )
+        }
+        try insert("ProbeSide", numRows: 2000, seed: 7919)
+        try insert("BuildSide", numRows: 500, seed: 104729)
+        let comparisons = [
+            ("a.i", "b.i"), ("b.i", "a.i"), ("a.f", "b.f"), ("a.d", "b.d"), ("a.d", "b.f"),
+            ("a.s", "b.s"), ("a.s", "b.i"), ("a.i", "b.f"), ("a.i", "b.s"),
+        ]
+        func run(_ query: String, optimized: Bool) throws -> [Int64] {
+            _ = try conn.query("CALL enable_plan_optimizer=\(optimized);")
+            let tuple = try conn.query(query).getNext()!
+            return [try tuple.getValue(0) as! Int64, try tuple.getValue(1) as? Int64 ?? 0]
+        }
+        for (left, right) in comparisons {
+            for op in ["<", "<=", ">", ">="] {
+                let query =
+                    "MATCH (a:ProbeSide), (b:BuildSide) WHERE \(left) \(op) \(right) "
+                    + "RETURN COUNT(*), SUM(a.id * 1000 + b.id);"
+                XCTAssertEqual(
+                    try run(query, optimized: true), try run(query, optimized: false), query)
+            }
+        }
+        // The values next to 2^53 differ by less than the precision of doubles.
+        let query =
+            "MATCH (a:ProbeSide), (b:BuildSide) WHERE a.i > 9007199254740992 AND a.i < b.i "
+            + "RETURN COUNT(*), SUM(a.id * 1000 + b.id);"
+        XCTAssertEqual(try run(query, optimized: true), try run(query, optimized: false))
+        XCTAssertGreaterThan(try run(query, optimized: true)[0], 0)
+    }
+
+    func testSlabAllocatorFreesBlocksOnOtherThreads() throws {
+        let conn = try Connection(db)
+        let functions = try conn.query("CALL show_functions() RETURN name;")
+        var hasDebugFunction = false
+        while functions.hasNext() {
+            let name = try functions.getNext()!.getValue(0) as! String
+            hasDebugFunction = hasDebugFunction || name == "DEBUG_SLAB_ALLOCATOR"
+        }
+        // The function is only built with runtime checks enabled.
+        try XCTSkipUnless(hasDebugFunction, "DEBUG_SLAB_ALLOCATOR is not available in this build")
+        XCTAssertThrowsError(try conn.query("CALL debug_slab_allocator(0) RETURN *;"))
+
+        let numBlocks: UInt64 = 2000
+        // 16, 32, ..., 2048 bytes.
+        let blockSizes: [UInt64] = (0..<8).map { 16 << $0 }
+        // Each shard keeps one empty slab of 64KB per size class.
+        let maxRetained: UInt64 = 8 * 16 * 64 * 1024
+        for _ in 0..<5 {
+            let result = try conn.query(
+                "CALL debug_slab_allocator(\(numBlocks)) RETURN mem_usage_before, "
+                    + "mem_usage_allocated, mem_usage_freed, num_corrupted_blocks;")
+            let tuple = try result.getNext()!
+            let before = try tuple.getValue(0) as! UInt64
+            let allocated = try tuple.getValue(1) as! UInt64
+            let freed = try tuple.getValue(2) as! UInt64
+            XCTAssertEqual(try tuple.getValue(3) as! UInt64, 0)
+            XCTAssertGreaterThanOrEqual(allocated - before, blockSizes.reduce(0, +) * numBlocks)
+            XCTAssertLessThan(freed, allocated)
+            // Slabs emptied by the freeing thread are released, so repeated calls don't grow
+            // the memory usage.
+            XCTAssertLessThanOrEqual(freed, before + maxRetained)
         }
     }
 }
@@ -62,6 +62,477 @@ final class DatabaseTests: XCTestCase {
         XCTAssertFalse(result.hasNext())
     }
 
+    func testAutoCheckpointDeferredWhileTransactionsAreActive() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer {
+            for path in [dbPath, dbPath + ".wal"] {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        func walSize() -> UInt64 {
+            return (try? FileManager.default.attributesOfItem(atPath: dbPath + ".wal")[.size]
+                as? UInt64) ?? 0
+        }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+        _ = try conn.query("CHECKPOINT;")
+        _ = try conn.query(
+            "UNWIND range(1, 1000) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+        // The next commits cross the threshold, but stay far below the size at which an auto
+        // checkpoint can no longer be deferred.
+        _ = try conn.query("CALL checkpoint_threshold=\(walSize());")
+
+        let reader = try Connection(db)
+        _ = try reader.query("BEGIN TRANSACTION READ ONLY;")
+        var result = try reader.query("MATCH (x:item) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1000)
+        let start = Date()
+        _ = try conn.query("CREATE (:item {id: 1001, name: 'deferred'});")
+        // The commit neither waited for the reader to leave nor checkpointed.
+        XCTAssertLessThan(Date().timeIntervalSince(start), 5)
+        XCTAssertGreaterThan(walSize(), 0)
+        result = try reader.query("MATCH (x:item) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1000)
+        _ = try reader.query("COMMIT;")
+
+        // The first commit that finds the system idle checkpoints.
+        _ = try conn.query("CREATE (:item {id: 1002, name: 'checkpointed'});")
+        XCTAssertEqual(walSize(), 0)
+        result = try conn.query("MATCH (x:item) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1002)
+    }
+
+    func testOpenCheckpointedDatabaseReadOnly() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 5000) AS i "
+                    + "CREATE (:item {id: i, name: 'item' + CAST(i AS STRING)});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let systemConfig = SystemConfig(readOnly: true)
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        let count = try conn.query("MATCH (i:item) RETURN count(*);")
+        XCTAssertEqual(try count.getNext()!.getValue(0) as! Int64, 5000)
+        let lookup = try conn.query("MATCH (i:item) WHERE i.id = 4321 RETURN i.name;")
+        XCTAssertEqual(try lookup.getNext()!.getValue(0) as! String, "item4321")
+        XCTAssertThrowsError(try conn.query("CREATE (:item {id: 0, name: 'x'});"))
+    }
+
+    func testReopenDatabaseWithUnaccessedTables() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE a(id INT64, PRIMARY KEY(id));")
+            _ = try conn.query("CREATE NODE TABLE b(id INT64, PRIMARY KEY(id));")
+            _ = try conn.query("CREATE REL TABLE r(FROM a TO b);")
+            _ = try conn.query("UNWIND range(1, 3000) AS i CREATE (:a {id: i}), (:b {id: i});")
+            _ = try conn.query(
+                "MATCH (x:a), (y:b) WHERE x.id = y.id CREATE (x)-[:r]->(y);")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        // Only table a is accessed, so tables b and r are checkpointed again as they were read.
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE (:a {id: 3001});")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        let numA = try conn.query("MATCH (x:a) RETURN count(*);")
+        XCTAssertEqual(try numA.getNext()!.getValue(0) as! Int64, 3001)
+        let numR = try conn.query("MATCH (:a)-[:r]->(y:b) WHERE y.id > 1000 RETURN count(*);")
+        XCTAssertEqual(try numR.getNext()!.getValue(0) as! Int64, 2000)
+    }
+
+    func testVacuumRewritesSparseNodeGroups() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        func getNumUsedPages() throws -> Int {
+            let result = try conn.query("CALL file_info() RETURN num_pages - num_free_pages;")
+            return Int(try result.getNext()!.getValue(0) as! UInt64)
+        }
+        _ = try conn.query("CREATE NODE TABLE doc(id INT64, body STRING, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE REL TABLE cites(FROM doc TO doc);")
+        _ = try conn.query(
+            "UNWIND range(1, 5000) AS i "
+                + "CREATE (:doc {id: i, body: 'body' + CAST(i AS STRING) + repeat('x', 200)});"
+        )
+        _ = try conn.query(
+            "MATCH (a:doc), (b:doc) WHERE b.id = a.id + 1 CREATE (a)-[:cites]->(b);")
+        _ = try conn.query("CHECKPOINT;")
+        _ = try conn.query("MATCH (d:doc) WHERE d.id % 5 <> 0 DETACH DELETE d;")
+        _ = try conn.query("CHECKPOINT;")
+        let numUsedPagesBefore = try getNumUsedPages()
+        _ = try conn.query("CALL vacuum('doc');")
+        _ = try conn.query("CALL vacuum('cites');")
+        XCTAssertLessThan(try getNumUsedPages(), numUsedPagesBefore)
+        let count = try conn.query("MATCH (d:doc) RETURN count(*);")
+        XCTAssertEqual(try count.getNext()!.getValue(0) as! Int64, 1000)
+        let lookup = try conn.query("MATCH (d:doc) WHERE d.id = 4321 RETURN count(*);")
+        XCTAssertEqual(try lookup.getNext()!.getValue(0) as! Int64, 0)
+        let body = try conn.query("MATCH (d:doc) WHERE d.id = 4320 RETURN d.body;")
+        XCTAssertEqual(
+            try body.getNext()!.getValue(0) as! String,
+            "body4320" + String(repeating: "x", count: 200))
+        _ = try conn.query("CREATE (:doc {id: 4321, body: 'new'});")
+        let inserted = try conn.query("MATCH (d:doc) WHERE d.id = 4321 RETURN d.body;")
+        XCTAssertEqual(try inserted.getNext()!.getValue(0) as! String, "new")
+    }
+
+    func testDirectIO() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        // A small buffer pool makes pages get evicted and read back from the file.
+        let systemConfig = SystemConfig(bufferPoolSize: 16 * 1024 * 1024, directIO: true)
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 200000) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "MATCH (x:item) WHERE x.name ENDS WITH '7' RETURN count(*), max(x.id);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 20000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 199997)
+        let lookup = try conn.query("MATCH (x:item) WHERE x.id = 123456 RETURN x.name;")
+        XCTAssertEqual(try lookup.getNext()!.getValue(0) as! String, "item123456")
+    }
+
+    func testHugePages() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let systemConfig = SystemConfig(bufferPoolSize: 64 * 1024 * 1024, enableHugePages: true)
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+        _ = try conn.query(
+            "UNWIND range(1, 100000) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+        let result = try conn.query(
+            "MATCH (x:item) WHERE x.name ENDS WITH '3' RETURN count(*), max(x.id);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 10000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 99993)
+    }
+
+    func testWarmUpBufferPool() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        let hotPagesPath = dbPath + ".hot_pages"
+        defer {
+            try? FileManager.default.removeItem(atPath: dbPath)
+            try? FileManager.default.removeItem(atPath: hotPagesPath)
+        }
+        let systemConfig = SystemConfig(bufferPoolSize: 64 * 1024 * 1024, warmUpBufferPool: true)
+        let query = "MATCH (x:item) WHERE x.name ENDS WITH '7' RETURN count(*), max(x.id);"
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 100000) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+            _ = try conn.query(query)
+        }
+        XCTAssertTrue(FileManager.default.fileExists(atPath: hotPagesPath))
+        // The query runs while the pages are read back in the background.
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        let result = try conn.query(query)
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 10000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 99997)
+    }
+
+    func testExportAndImportDatabaseWithManyTables() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        let exportPath = NSTemporaryDirectory() + "kuzu_swift_test_export_" + UUID().uuidString
+        let importPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer {
+            try? FileManager.default.removeItem(atPath: dbPath)
+            try? FileManager.default.removeItem(atPath: exportPath)
+            try? FileManager.default.removeItem(atPath: importPath)
+        }
+        let numTables = 6
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            for t in 0..<numTables {
+                _ = try conn.query(
+                    "CREATE NODE TABLE item\(t)(id INT64, name STRING, PRIMARY KEY(id));")
+                _ = try conn.query(
+                    "UNWIND range(1, \(1000 * (t + 1))) AS i "
+                        + "CREATE (:item\(t) {id: i, name: 'item' + string(i)});")
+            }
+            _ = try conn.query("CREATE REL TABLE link(FROM item0 TO item1);")
+            _ = try conn.query(
+                "MATCH (a:item0), (b:item1) WHERE b.id = a.id * 2 CREATE (a)-[:link]->(b);")
+            _ = try conn.query("EXPORT DATABASE '\(exportPath)';")
+        }
+        let db = try Database(importPath)
+        let conn = try Connection(db)
+        _ = try conn.query("IMPORT DATABASE '\(exportPath)';")
+        for t in 0..<numTables {
+            let result = try conn.query("MATCH (x:item\(t)) RETURN count(*), max(x.name);")
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, Int64(1000 * (t + 1)))
+            XCTAssertEqual(try tuple.getValue(1) as! String, "item999")
+        }
+        let result = try conn.query("MATCH (:item0)-[:link]->(b:item1) RETURN count(*), max(b.id);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 2000)
+    }
+
+    func testBackupWhileOpen() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        let backupPath = NSTemporaryDirectory() + "kuzu_swift_test_backup_" + UUID().uuidString
+        defer {
+            for path in [dbPath, dbPath + ".wal", backupPath, backupPath + ".wal"] {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE item(id INT64, name STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 10000) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+            _ = try conn.query("CHECKPOINT;")
+            // These rows are only in the WAL when the backup is taken.
+            _ = try conn.query(
+                "UNWIND range(10001, 10100) AS i CREATE (:item {id: i, name: 'item' + string(i)});")
+            _ = try conn.query("CALL backup('\(backupPath)', max_bytes_per_second := 1000000000);")
+            // Writes after the backup are not in the copy.
+            _ = try conn.query("CREATE (:item {id: 20000, name: 'late'});")
+            XCTAssertThrowsError(try conn.query("CALL backup('\(backupPath)');"))
+        }
+        let db = try Database(backupPath)
+        let conn = try Connection(db)
+        let result = try conn.query("MATCH (x:item) RETURN count(*), max(x.id);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 10100)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 10100)
+    }
+
+    func testForcedCheckpointWaitsForBackup() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        let backupPath = NSTemporaryDirectory() + "kuzu_swift_test_backup_" + UUID().uuidString
+        defer {
+            for path in [dbPath, dbPath + ".wal", backupPath, backupPath + ".wal"] {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(1, 20000) AS i CREATE (:item {id: i, vec: [i, i, i, i]});")
+            _ = try conn.query("CHECKPOINT;")
+
+            let lock = NSLock()
+            var backupFinished = false
+            let backupDone = expectation(description: "backup")
+            DispatchQueue.global().async {
+                let backupConn = try! Connection(db)
+                // Throttled, so that the backup pins the database file for a while.
+                _ = try! backupConn.query(
+                    "CALL backup('\(backupPath)', max_bytes_per_second := 500000);")
+                lock.lock()
+                backupFinished = true
+                lock.unlock()
+                backupDone.fulfill()
+            }
+            Thread.sleep(forTimeInterval: 0.2)
+            // Creating a DiskANN index forces a checkpoint, so its commit waits for the backup.
+            _ = try conn.query("CALL CREATE_DISKANN_INDEX('item', 'vec_index', 'vec');")
+            lock.lock()
+            XCTAssertTrue(backupFinished)
+            lock.unlock()
+            wait(for: [backupDone], timeout: 60)
+            let walSize =
+                (try? FileManager.default.attributesOfItem(atPath: dbPath + ".wal")[.size]
+                    as? UInt64) ?? 0
+            XCTAssertEqual(walSize, 0)
+        }
+        let db = try Database(backupPath)
+        let conn = try Connection(db)
+        let result = try conn.query("MATCH (x:item) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 20000)
+    }
+
+    func testReplayShippedWAL() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        let replicaPath = NSTemporaryDirectory() + "kuzu_swift_test_replica_" + UUID().uuidString
+        let shippedWALPath = NSTemporaryDirectory() + "kuzu_swift_test_wal_" + UUID().uuidString
+        defer {
+            let paths = [dbPath, dbPath + ".wal", replicaPath, replicaPath + ".wal", shippedWALPath]
+            for path in paths {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE item(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(1, 100) AS i CREATE (:item {id: i});")
+        _ = try conn.query("CALL backup('\(replicaPath)');")
+        _ = try conn.query("UNWIND range(101, 200) AS i CREATE (:item {id: i});")
+        _ = try conn.query("CALL ship_wal('\(shippedWALPath)');")
+
+        let replicaDB = try Database(replicaPath, SystemConfig(readOnly: true))
+        let replicaConn = try Connection(replicaDB)
+        func countItems() throws -> Int64 {
+            let result = try replicaConn.query("MATCH (x:item) RETURN count(*);")
+            return try result.getNext()!.getValue(0) as! Int64
+        }
+        XCTAssertEqual(try countItems(), 100)
+        _ = try replicaConn.query("CALL replay_wal('\(shippedWALPath)');")
+        XCTAssertEqual(try countItems(), 200)
+        // Only the commits shipped since the last replay are replayed.
+        _ = try conn.query("MATCH (x:item) WHERE x.id <= 50 DELETE x;")
+        _ = try conn.query("CALL ship_wal('\(shippedWALPath)');")
+        _ = try replicaConn.query("CALL replay_wal('\(shippedWALPath)');")
+        _ = try replicaConn.query("CALL replay_wal('\(shippedWALPath)');")
+        XCTAssertEqual(try countItems(), 150)
+        // The WAL shipped after a checkpoint no longer applies to the replica.
+        _ = try conn.query("CHECKPOINT;")
+        _ = try conn.query("CREATE (:item {id: 1000});")
+        _ = try conn.query("CALL ship_wal('\(shippedWALPath)');")
+        XCTAssertThrowsError(try replicaConn.query("CALL replay_wal('\(shippedWALPath)');"))
+        XCTAssertEqual(try countItems(), 150)
+        XCTAssertThrowsError(try conn.query("CALL replay_wal('\(shippedWALPath)');"))
+    }
+
+    func testQueryAttachedDatabases() throws {
+        var shardPaths: [String] = []
+        defer {
+            for path in shardPaths {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        for shard in 0..<2 {
+            let dbPath =
+                NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+            shardPaths.append(dbPath)
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE User(id INT64 PRIMARY KEY, country STRING);")
+            _ = try conn.query(
+                "UNWIND range(0, 9) AS i CREATE (:User {id: i * 2 + \(shard), "
+                    + "country: CASE WHEN i < 4 THEN 'NL' ELSE 'DE' END});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let db = try Database()
+        let conn = try Connection(db)
+        for (i, path) in shardPaths.enumerated() {
+            _ = try conn.query("ATTACH '\(path)' AS shard\(i) (dbtype kuzu);")
+        }
+        // Partial aggregates of the shards are merged by the calling query.
+        let counts = try conn.query(
+            "CALL query_attached('shard0, shard1', "
+                + "'MATCH (u:User) RETURN u.country AS country, count(*) AS num') "
+                + "RETURN country, CAST(sum(num) AS INT64) ORDER BY country;"
+        )
+        var tuple = try counts.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! String, "DE")
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 12)
+        tuple = try counts.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! String, "NL")
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 8)
+        XCTAssertFalse(counts.hasNext())
+        let top = try conn.query(
+            "CALL query_attached('shard0,shard1', "
+                + "'MATCH (u:User) RETURN u.id AS id ORDER BY id DESC LIMIT 3') "
+                + "RETURN id ORDER BY id DESC LIMIT 3;"
+        )
+        var ids: [Int64] = []
+        while let row = try top.getNext() {
+            ids.append(try row.getValue(0) as! Int64)
+        }
+        XCTAssertEqual(ids, [19, 18, 17])
+        XCTAssertThrowsError(
+            try conn.query("CALL query_attached('shard0,missing', 'RETURN 1') RETURN *;")
+        )
+    }
+
+    func testReopenDatabaseWithMultipleNodeGroupsAfterCheckpoint() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        // 300000 rows span three node groups, each of which is written with its size in front.
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE a(id INT64, val INT64, PRIMARY KEY(id));")
+            _ = try conn.query("UNWIND range(1, 300000) AS i CREATE (:a {id: i, val: i % 7});")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("MATCH (x:a) WHERE x.id > 250000 DELETE x;")
+            _ = try conn.query("MATCH (x:a) WHERE x.id = 150000 SET x.val = 100;")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        let numA = try conn.query("MATCH (x:a) RETURN count(*), sum(x.val);")
+        let tuple = try numA.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 250000)
+        let expectedSum = (1...250000).reduce(Int64(0)) { $0 + Int64($1 % 7) } - 150000 % 7 + 100
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, expectedSum)
+        let lookup = try conn.query("MATCH (x:a) WHERE x.id = 150000 RETURN x.val;")
+        XCTAssertEqual(try lookup.getNext()!.getValue(0) as! Int64, 100)
+    }
+
+    func testOpenDatabaseWithOlderStorageVersion() throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE a(id INT64, PRIMARY KEY(id));")
+            _ = try conn.query("CHECKPOINT;")
+        }
+        // The storage version follows the magic bytes at the start of the database header.
+        let handle = try XCTUnwrap(FileHandle(forUpdatingAtPath: dbPath))
+        var olderVersion = (Database.storageVersion - 1).littleEndian
+        handle.seek(toFileOffset: 4)
+        handle.write(Data(bytes: &olderVersion, count: MemoryLayout<UInt64>.size))
+        handle.closeFile()
+        XCTAssertThrowsError(try Database(dbPath)) { error in
+            XCTAssertTrue(
+                (error as! KuzuError).message.contains("different version"),
+                (error as! KuzuError).message
+            )
+        }
+    }
+
     func testGetVersion() {
         let version = Database.version
         XCTAssertNotEqual(version, "")
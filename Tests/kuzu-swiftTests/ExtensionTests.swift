@@ -68,5 +68,1291 @@ final class ExtensionTests: XCTestCase {
             ["I"], ["D"], ["B", "C", "A"], ["G", "F", "H", "E"],
         ]
         XCTAssertEqual(normalize(groundTruth), normalize(rows))
+
+        // The rel predicate is applied once, when the snapshot is materialized.
+        _ = try conn.query(
+            "CALL project_graph('Filtered', ['Node'], {'Edge': 'r.id < 3'}, materialize := true);"
+        )
+        let filteredGroundTruth: [[String]] = [
+            ["A", "B", "C"], ["D"], ["E", "F"], ["G"], ["H"], ["I"],
+        ]
+        for _ in 0..<2 {
+            let filteredResult = try conn.query(
+                "CALL weakly_connected_components('Filtered') RETURN group_id, collect(node.id);"
+            )
+            var filteredRows: [[String]] = []
+            for row in filteredResult {
+                filteredRows.append(try row.getValue(1) as! [String])
+            }
+            XCTAssertEqual(normalize(filteredGroundTruth), normalize(filteredRows))
+        }
+    }
+
+    func testStemmersReusedAcrossThreads() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Word(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(0, 29999) AS i CREATE (:Word {id: i});")
+        // Every worker stems with its own stemmer of each algorithm, both for per-row and constant
+        // stemmers.
+        let result = try conn.query(
+            """
+            MATCH (w:Word)
+            WITH w.id % 3 AS k
+            WITH k, ['running', 'häuser', 'Connections'][k + 1] AS word,
+                ['english', 'german', 'none'][k + 1] AS stemmer
+            RETURN k, stem(word, stemmer), stem('connections', 'porter'), count(*)
+            ORDER BY k;
+            """
+        )
+        for (k, stem) in ["run", "haus", "Connections"].enumerated() {
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, Int64(k))
+            XCTAssertEqual(try tuple.getValue(1) as! String, stem)
+            XCTAssertEqual(try tuple.getValue(2) as! String, "connect")
+            XCTAssertEqual(try tuple.getValue(3) as! Int64, 10000)
+        }
+        XCTAssertFalse(result.hasNext())
+    }
+
+    func testFTSQueriesNormalizedWithReusedStemmers() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Doc(id INT64, content STRING, PRIMARY KEY(id));")
+        let docs = [
+            // ASCII text longer than eight bytes is lowercased in place.
+            "A SIMPLE Example Of Running Connections",
+            // Other text is lowercased as UTF-8.
+            "Les ÉLÈVES des écoles",
+            "simple simple",
+            "Das Haus",
+        ]
+        for (id, content) in docs.enumerated() {
+            _ = try conn.query("CREATE (:Doc {id: \(id), content: '\(content)'});")
+        }
+        _ = try conn.query("CALL CREATE_FTS_INDEX('Doc', 'english_index', ['content']);")
+        _ = try conn.query(
+            "CALL CREATE_FTS_INDEX('Doc', 'german_index', ['content'], stemmer := 'german');")
+        // Inserted docs are normalized with the ignore pattern compiled by the index.
+        _ = try conn.query("CREATE (:Doc {id: 4, content: 'Simple, SIMPLE; häuser!'});")
+        func search(_ conn: Connection, _ index: String, _ query: String) throws -> [Int64] {
+            let result = try conn.query(
+                "CALL QUERY_FTS_INDEX('Doc', '\(index)', '\(query)') RETURN node.id ORDER BY node.id;"
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        let expectedIDs: [(index: String, query: String, ids: [Int64])] = [
+            // 'simple' is a term like any other, not a word removed from docs and queries.
+            ("english_index", "simple", [0, 2, 4]),
+            ("english_index", "RUNNING connection", [0]),
+            ("english_index", "ÉLÈVES", [1]),
+            ("english_index", "élèves", [1]),
+            ("english_index", "häuser", [4]),
+            ("german_index", "häuser", [3, 4]),
+            ("german_index", "HAUS", [3, 4]),
+        ]
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: 4) { _ in
+            do {
+                let conn = try Connection(db)
+                for _ in 0..<10 {
+                    for (index, query, ids) in expectedIDs {
+                        let foundIDs = try search(conn, index, query)
+                        if foundIDs != ids {
+                            lock.lock()
+                            failures.append("\(index) '\(query)' found \(foundIDs)")
+                            lock.unlock()
+                        }
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("Search failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+    }
+
+    func testFTSPhraseAndProximityQueries() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_fts_phrase_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        func search(_ conn: Connection, _ query: String, _ options: String = "") throws -> [Int64] {
+            let result = try conn.query(
+                """
+                CALL QUERY_FTS_INDEX('Doc', 'doc_index', '\(query)'\(options))
+                RETURN node.id ORDER BY node.id;
+                """
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        func assertPhraseMatches(_ conn: Connection, _ foxIDs: [Int64]) throws {
+            XCTAssertEqual(try search(conn, "quick brown"), [0, 1, 2, 3, 4] + foxIDs.dropFirst())
+            XCTAssertEqual(try search(conn, "quick brown", ", phrase := true"), foxIDs)
+            // Slop allows extra positions between the terms, but not a different order.
+            XCTAssertEqual(
+                try search(conn, "quick brown", ", phrase := true, slop := 1"),
+                [0, 2, 4] + foxIDs.dropFirst())
+            XCTAssertEqual(try search(conn, "brown quick", ", phrase := true, slop := 5"), [1])
+            XCTAssertEqual(
+                try search(conn, "quick brown fox", ", phrase := true, slop := 1"),
+                [0, 2] + foxIDs.dropFirst())
+            // Removed stop words still take a position, which any term may fill.
+            XCTAssertEqual(try search(conn, "quick and brown", ", phrase := true"), [2, 4])
+        }
+
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE Doc(id INT64, title STRING, content STRING, PRIMARY KEY(id));")
+            let docs = [
+                ("", "the quick brown fox jumps"),
+                ("", "brown quick fox"),
+                ("", "quick red brown fox"),
+                // Phrases don't span properties.
+                ("quick notes", "brown fox"),
+                ("", "quick and brown"),
+            ]
+            for (id, (title, content)) in docs.enumerated() {
+                _ = try conn.query(
+                    "CREATE (:Doc {id: \(id), title: '\(title)', content: '\(content)'});")
+            }
+            _ = try conn.query(
+                "CALL CREATE_FTS_INDEX('Doc', 'doc_index', ['title', 'content'], positions := true);"
+            )
+            try assertPhraseMatches(conn, [0])
+            // The positions of inserted docs are recorded too.
+            _ = try conn.query("CREATE (:Doc {id: 5, title: '', content: 'Quick Brown foxes'});")
+            try assertPhraseMatches(conn, [0, 5])
+        }
+
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        try assertPhraseMatches(conn, [0, 5])
+        _ = try conn.query("CALL CREATE_FTS_INDEX('Doc', 'plain_index', ['content']);")
+        XCTAssertThrowsError(
+            try conn.query(
+                """
+                CALL QUERY_FTS_INDEX('Doc', 'plain_index', 'quick brown', phrase := true)
+                RETURN node.id;
+                """
+            )
+        ) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("positions := true"))
+        }
+    }
+
+    /// Loads an extension that is not linked into this package, or skips the test if the extension
+    /// isn't installed.
+    private func loadExtension(_ name: String, _ conn: Connection) throws {
+        do {
+            _ = try conn.query("LOAD EXTENSION \(name);")
+        } catch {
+            throw XCTSkip("The \(name) extension is not installed: \(error)")
+        }
+    }
+
+    func testCreateEmbeddingBatchesRequests() throws {
+        let server = try MockEmbeddingServer()
+        defer { server.stop() }
+        let db = try Database(":memory:")
+        let conn = try Connection(db)
+        try loadExtension("llm", conn)
+        let result = try conn.query(
+            """
+            UNWIND range(1, 500) AS i
+            WITH i, CASE WHEN i % 10 = 0 THEN NULL ELSE 'text ' + CAST(i AS STRING) END AS text
+            RETURN i, CREATE_EMBEDDING(text, 'ollama', 'nomic-embed-text', '\(server.endpoint)')
+            ORDER BY i;
+            """
+        )
+        var numRows = 0
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            let i = try tuple.getValue(0) as! Int64
+            let embedding = try tuple.getFloatArray(at: 1)
+            if i % 10 == 0 {
+                XCTAssertNil(embedding)
+            } else {
+                XCTAssertEqual(embedding, [Float("text \(i)".count), 1])
+            }
+            numRows += 1
+        }
+        XCTAssertEqual(numRows, 500)
+        // Null texts are not sent, and the others are sent in batches of at most 64 texts.
+        let counts = server.getCounts()
+        XCTAssertEqual(counts.texts, 450)
+        XCTAssertGreaterThanOrEqual(counts.requests, 8)
+        XCTAssertLessThan(counts.requests, 450)
+    }
+
+    func testCreateEmbeddingCache() throws {
+        let server = try MockEmbeddingServer()
+        defer { server.stop() }
+        let dbPath = NSTemporaryDirectory() + "kuzu_embedding_cache_test_" + UUID().uuidString
+        defer {
+            for path in [dbPath, dbPath + ".wal", dbPath + ".embedding_cache"] {
+                try? FileManager.default.removeItem(atPath: path)
+            }
+        }
+        func embed(_ conn: Connection, _ numTexts: Int) throws -> [[Float]] {
+            let result = try conn.query(
+                """
+                UNWIND range(1, \(numTexts)) AS i
+                RETURN CREATE_EMBEDDING('text ' + CAST(i AS STRING), 'ollama', 'nomic-embed-text',
+                    '\(server.endpoint)')
+                ORDER BY i;
+                """
+            )
+            var embeddings: [[Float]] = []
+            while result.hasNext() {
+                embeddings.append(try result.getNext()!.getFloatArray(at: 0)!)
+            }
+            return embeddings
+        }
+        let expected = (1...100).map { [Float("text \($0)".count), 1] }
+
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            try loadExtension("llm", conn)
+            XCTAssertEqual(try embed(conn, 100), expected)
+            XCTAssertEqual(server.getCounts().texts, 100)
+            // Only the texts that aren't cached yet are sent.
+            XCTAssertEqual(try embed(conn, 150).prefix(100).map { $0 }, expected)
+            XCTAssertEqual(server.getCounts().texts, 150)
+        }
+        // The cache outlives the database instance, and its entries are appended to a side file.
+        let cacheFileSize =
+            (try? FileManager.default.attributesOfItem(atPath: dbPath + ".embedding_cache")[.size]
+                as? UInt64) ?? 0
+        XCTAssertGreaterThan(cacheFileSize, 0)
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        try loadExtension("llm", conn)
+        XCTAssertEqual(try embed(conn, 100), expected)
+        XCTAssertEqual(server.getCounts().texts, 150)
+        _ = try conn.query("CALL llm_embedding_cache_size=0;")
+        XCTAssertEqual(try embed(conn, 100), expected)
+        XCTAssertEqual(server.getCounts().texts, 250)
+    }
+
+    /// Attaches Dataset/sqlite/items.sqlite as `lite`. Its table item holds 100 rows, where row k has
+    /// the rowid k * 10007 - 50000 as id, the name NULL if k % 7 == 0, "n<k>" if k is even and
+    /// "a much longer name <k>" otherwise, and the score NULL if k % 5 == 0 and k otherwise. The
+    /// view positive_item holds the rows with a non-negative id.
+    private func attachSQLiteItems(_ conn: Connection) throws {
+        try loadExtension("sqlite", conn)
+        _ = try conn.query("ATTACH '\(sqliteDatasetPath("items.sqlite"))' AS lite (dbtype sqlite);")
+    }
+
+    private func sqliteDatasetPath(_ name: String) -> String {
+        return Bundle.module.url(forResource: "Dataset", withExtension: nil)!
+            .appendingPathComponent("sqlite/\(name)").standardized.path
+    }
+
+    func testAttachedSQLiteScanSplitIntoRowidRanges() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        try attachSQLiteItems(conn)
+        func row(_ query: String) throws -> [Int64] {
+            return try conn.query(query).getNext()!.getAsArray().map { $0 as! Int64 }
+        }
+        let ks = Array(0..<100)
+        let scores = ks.filter { $0 % 5 != 0 }
+        // The rowids span about 8 ranges of 122880 rowids, read by several workers.
+        XCTAssertEqual(
+            try row("LOAD FROM lite.item RETURN count(*), count(name), sum(score), min(id), max(id);"),
+            [
+                100, Int64(ks.filter { $0 % 7 != 0 }.count), Int64(scores.reduce(0, +)), -50000,
+                99 * 10007 - 50000,
+            ])
+        // Pushed down predicates apply to every range.
+        let high = scores.filter { $0 > 50 }
+        XCTAssertEqual(
+            try row("LOAD FROM lite.item WHERE score > 50 RETURN count(*), sum(id);"),
+            [Int64(high.count), Int64(high.reduce(0) { $0 + $1 * 10007 - 50000 })])
+        // Views have no rowid and are read by a single query.
+        let positive = ks.filter { $0 * 10007 - 50000 >= 0 }
+        XCTAssertEqual(
+            try row("LOAD FROM lite.positive_item RETURN count(*), sum(score);"),
+            [Int64(positive.count), Int64(positive.filter { $0 % 5 != 0 }.reduce(0, +))])
+    }
+
+    func testAttachedSQLiteNullsAndStrings() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        try attachSQLiteItems(conn)
+        let result = try conn.query("LOAD FROM lite.item RETURN id, name, score ORDER BY id;")
+        var k = 0
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as? Int64, Int64(k * 10007 - 50000))
+            // Names are both inlined and longer than the inline prefix of a string.
+            let name = k % 7 == 0 ? nil : (k % 2 == 0 ? "n\(k)" : "a much longer name \(k)")
+            XCTAssertEqual(try tuple.getValue(1) as? String, name)
+            XCTAssertEqual(try tuple.getValue(2) as? Int64, k % 5 == 0 ? nil : Int64(k))
+            k += 1
+        }
+        XCTAssertEqual(k, 100)
+        // A column without nulls in a chunk.
+        let counts = try conn.query(
+            "LOAD FROM lite.item WHERE score IS NOT NULL RETURN count(*), count(score);"
+        ).getNext()!
+        XCTAssertEqual(try counts.getValue(0) as! Int64, 80)
+        XCTAssertEqual(try counts.getValue(1) as! Int64, 80)
+    }
+
+    func testAttachedDBResultCache() throws {
+        let path =
+            NSTemporaryDirectory() + "kuzu_sqlite_cache_test_" + UUID().uuidString + ".sqlite"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        // Dataset/sqlite/items_updated.sqlite holds the first 50 rows of items.sqlite, with 1000
+        // added to their scores.
+        func replaceItems(with name: String) throws {
+            try? FileManager.default.removeItem(atPath: path)
+            try FileManager.default.copyItem(atPath: sqliteDatasetPath(name), toPath: path)
+        }
+        try replaceItems(with: "items.sqlite")
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        try loadExtension("sqlite", conn)
+        _ = try conn.query("ATTACH '\(path)' AS lite (dbtype sqlite);")
+        func row(_ query: String) throws -> [Int64] {
+            return try conn.query(query).getNext()!.getAsArray().map { $0 as! Int64 }
+        }
+        let scan = "LOAD FROM lite.item RETURN count(*), sum(score);"
+        let filteredScan = "LOAD FROM lite.item WHERE score > 60 RETURN count(*);"
+
+        // The cache is disabled by default, so every scan reads the current rows.
+        XCTAssertEqual(try row(scan), [100, 4000])
+        try replaceItems(with: "items_updated.sqlite")
+        XCTAssertEqual(try row(scan), [50, 41000])
+
+        _ = try conn.query("CALL attached_db_result_cache_ttl=3600;")
+        XCTAssertEqual(try row(scan), [50, 41000])
+        try replaceItems(with: "items.sqlite")
+        // Identical queries reuse the cached rows, while other queries read the current rows.
+        XCTAssertEqual(try row(scan), [50, 41000])
+        XCTAssertEqual(try row(filteredScan), [32])
+        try replaceItems(with: "items_updated.sqlite")
+        XCTAssertEqual(try row(filteredScan), [32])
+
+        _ = try conn.query("CALL clear_attached_db_cache();")
+        // Rows larger than the cache are not cached.
+        _ = try conn.query("CALL attached_db_result_cache_size=0;")
+        XCTAssertEqual(try row(scan), [50, 41000])
+        XCTAssertEqual(try row(filteredScan), [40])
+        try replaceItems(with: "items.sqlite")
+        XCTAssertEqual(try row(scan), [100, 4000])
+        XCTAssertEqual(try row(filteredScan), [32])
+    }
+
+    func testDeltaScansShareDuckDBInstance() throws {
+        let tablePath = NSTemporaryDirectory() + "kuzu_delta_test_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: tablePath) }
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        try loadExtension("delta", conn)
+        // A delta table whose log adds a single parquet file.
+        try FileManager.default.createDirectory(
+            atPath: tablePath + "/_delta_log", withIntermediateDirectories: true)
+        let dataPath = tablePath + "/part-0.parquet"
+        _ = try conn.query(
+            "COPY (UNWIND range(1, 1000) AS i RETURN i AS id, 'n' + CAST(i AS STRING) AS name) "
+                + "TO '\(dataPath)';"
+        )
+        let dataSize = try FileManager.default.attributesOfItem(atPath: dataPath)[.size] as! UInt64
+        let noOptions: [String: String] = [:]
+        let fields: [[String: Any]] = [
+            ["name": "id", "type": "long", "nullable": true, "metadata": noOptions],
+            ["name": "name", "type": "string", "nullable": true, "metadata": noOptions],
+        ]
+        let schema: [String: Any] = ["type": "struct", "fields": fields]
+        let protocolAction: [String: Any] = ["minReaderVersion": 1, "minWriterVersion": 2]
+        let format: [String: Any] = ["provider": "parquet", "options": noOptions]
+        let metaDataAction: [String: Any] = [
+            "id": UUID().uuidString.lowercased(),
+            "format": format,
+            "schemaString": String(
+                decoding: try JSONSerialization.data(withJSONObject: schema), as: UTF8.self),
+            "partitionColumns": [String](),
+            "configuration": noOptions,
+            "createdTime": 0,
+        ]
+        let addAction: [String: Any] = [
+            "path": "part-0.parquet", "partitionValues": noOptions, "size": Int(dataSize),
+            "modificationTime": 0, "dataChange": true,
+        ]
+        let actions: [[String: Any]] = [
+            ["protocol": protocolAction], ["metaData": metaDataAction], ["add": addAction],
+        ]
+        let log = try actions.map {
+            String(decoding: try JSONSerialization.data(withJSONObject: $0), as: UTF8.self)
+        }.joined(separator: "\n")
+        try log.write(
+            toFile: tablePath + "/_delta_log/00000000000000000000.json", atomically: true,
+            encoding: .utf8)
+
+        let scan = "LOAD FROM '\(tablePath)' (file_format='delta')"
+        let query = scan + " RETURN count(*), sum(id), max(name);"
+        let result: QueryResult
+        do {
+            result = try conn.query(query)
+        } catch let error as KuzuError where error.message.lowercased().contains("install") {
+            throw XCTSkip("DuckDB's delta extension can't be installed: \(error)")
+        }
+        // Later scans reuse the DuckDB instance with its extensions loaded.
+        for tuple in [try result.getNext()!, try conn.query(query).getNext()!] {
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, 1000)
+            XCTAssertEqual(try tuple.getValue(1) as! Int64, 500500)
+            XCTAssertEqual(try tuple.getValue(2) as! String, "n999")
+        }
+        // Concurrent scans run on their own connections to the shared instance.
+        let lock = NSLock()
+        var counts: [Int64] = []
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: 4) { worker in
+            do {
+                let conn = try Connection(db)
+                let result = try conn.query(scan + " WHERE id > \(worker * 100) RETURN count(*);")
+                let count = try result.getNext()!.getValue(0) as! Int64
+                lock.lock()
+                counts.append(count + Int64(worker * 100))
+                lock.unlock()
+            } catch {
+                lock.lock()
+                failures.append("Scan \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+        XCTAssertEqual(counts, [1000, 1000, 1000, 1000])
+    }
+
+    func testJSONFunctionsOnCachedDocuments() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Event(id INT64 PRIMARY KEY, payload JSON, path STRING);")
+        // The documents take several MB, more than the parsed documents kept by each thread.
+        _ = try conn.query(
+            """
+            UNWIND range(0, 2999) AS i
+            CREATE (:Event {id: i,
+                payload: to_json({user: {id: i, name: 'user' + CAST(i AS STRING)},
+                    tags: ['a', 'b', CAST(i % 7 AS STRING)], pad: repeat('x', 2000)}),
+                path: CASE WHEN i % 2 = 0 THEN 'user/id' ELSE '$.tags.2' END});
+            """
+        )
+        // Several functions on the same document share one parse, and constant paths are split
+        // once while per-row paths are split for each row.
+        let result = try conn.query(
+            """
+            MATCH (e:Event)
+            RETURN e.id,
+                CAST(json_extract(e.payload, '$.user.id') AS STRING),
+                CAST(json_extract(e.payload, 'user/name') AS STRING),
+                CAST(json_array_length(json_extract(e.payload, 'tags')) AS INT64),
+                size(json_keys(e.payload)),
+                CAST(json_extract(e.payload, e.path) AS STRING),
+                json_contains(e.payload, '{"user": {"id": 42}}')
+            ORDER BY e.id;
+            """
+        )
+        var i: Int64 = 0
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, i)
+            XCTAssertEqual(try tuple.getValue(1) as! String, "\(i)")
+            XCTAssertEqual(try tuple.getValue(2) as! String, "\"user\(i)\"")
+            XCTAssertEqual(try tuple.getValue(3) as! Int64, 3)
+            XCTAssertEqual(try tuple.getValue(4) as! Int64, 3)
+            XCTAssertEqual(
+                try tuple.getValue(5) as! String, i % 2 == 0 ? "\(i)" : "\"\(i % 7)\"")
+            XCTAssertEqual(try tuple.getValue(6) as! Bool, i == 42)
+            i += 1
+        }
+        XCTAssertEqual(i, 3000)
+    }
+
+    func testNeo4jMigrateExportsIdRangesConcurrently() throws {
+        // Person ids span three ranges of 1M ids, and the KNOWS rel with id i * 100000 links the
+        // i-th and (i + 1)-th persons with since = i, so both labels are exported to three files.
+        let personIDs = Array(0..<10) + Array(1_000_000..<1_000_010) + Array(2_500_000..<2_500_005)
+        let lock = NSLock()
+        var numExports = 0
+        var numRunningExports = 0
+        var maxRunningExports = 0
+        func rows(_ values: [Any]) -> Data {
+            let data: [[String: Any]] = values.map { ["row": $0] }
+            let response: [String: Any] = ["results": [["data": data]], "errors": [Any]()]
+            return try! JSONSerialization.data(withJSONObject: response)
+        }
+        // Answers the statements sent by NEO4J_MIGRATE, and writes the CSV file an export asks for
+        // the way apoc.export.csv.query would.
+        func export(_ statement: String) -> Data {
+            lock.lock()
+            numExports += 1
+            numRunningExports += 1
+            maxRunningExports = max(maxRunningExports, numRunningExports)
+            lock.unlock()
+            defer {
+                lock.lock()
+                numRunningExports -= 1
+                lock.unlock()
+            }
+            // Gives the other exports time to start.
+            Thread.sleep(forTimeInterval: 0.2)
+            let startID = Int(
+                statement.components(separatedBy: ">= ")[1].components(separatedBy: " ")[0])!
+            let file = statement.components(separatedBy: "\"")[1]
+            let inRange = { (id: Int) in id >= startID && id < startID + 1_000_000 }
+            var lines: [String]
+            if statement.contains("_start") {
+                lines = ["_start,_end,since"]
+                for i in 0..<(personIDs.count - 1) where inRange(i * 100_000) {
+                    lines.append("\(personIDs[i]),\(personIDs[i + 1]),\(i)")
+                }
+            } else {
+                lines = ["_id,age,name"]
+                for id in personIDs where inRange(id) {
+                    lines.append("\(id),\(id % 100),p\(id)")
+                }
+            }
+            try! (lines.joined(separator: "\n") + "\n").write(
+                toFile: file, atomically: true, encoding: .utf8)
+            return rows([[file, lines.count - 1] as [Any]])
+        }
+        let server = try MockHTTPServer { _, body in
+            let payload = try! JSONSerialization.jsonObject(with: body) as! [String: Any]
+            let statements = payload["statements"] as! [[String: Any]]
+            let statement = statements[0]["statement"] as! String
+            if statement.hasPrefix("CALL apoc.export.csv.query") {
+                return export(statement)
+            } else if statement == "CALL db.labels();" {
+                return rows([["Person"]])
+            } else if statement == "CALL db.relationshipTypes();" {
+                return rows([["KNOWS"]])
+            } else if statement.contains("nodeTypeProperties") {
+                return rows([["name", ["String"]] as [Any], ["age", ["Long"]] as [Any]])
+            } else if statement.contains("relTypeProperties") {
+                return rows([["since", ["Long"]] as [Any]])
+            } else if statement.hasPrefix("MATCH (a)-[:KNOWS]->(b)") {
+                return rows([[["Person"], ["Person"]]])
+            } else if statement.contains("UNWIND keys(e)") {
+                return rows([["since"]])
+            } else if statement.hasPrefix("MATCH (p:`Person`) RETURN min") {
+                return rows([[personIDs.first!, personIDs.last!]])
+            } else if statement.hasPrefix("MATCH (a:`Person`)-[e:`KNOWS`]->(b:`Person`) RETURN min")
+            {
+                return rows([[0, (personIDs.count - 2) * 100_000]])
+            } else if statement == "RETURN 1" {
+                return rows([[1]])
+            }
+            // Persons have a single label.
+            return rows([])
+        }
+        defer {
+            server.stop()
+            for i in 0..<3 {
+                try? FileManager.default.removeItem(atPath: "/tmp/Person_\(i).csv")
+                try? FileManager.default.removeItem(atPath: "/tmp/Person_KNOWS_Person_\(i).csv")
+            }
+        }
+        let db = try Database(":memory:")
+        let conn = try Connection(db)
+        try loadExtension("neo4j", conn)
+        _ = try conn.query("CALL neo4j_migrate_concurrency=4;")
+        _ = try conn.query(
+            "CALL NEO4J_MIGRATE('\(server.url)', 'neo4j', 'password', ['Person'], ['KNOWS']);")
+        XCTAssertEqual(numExports, 6)
+        XCTAssertGreaterThan(maxRunningExports, 1)
+
+        var result = try conn.query(
+            "MATCH (p:Person) RETURN count(*), CAST(sum(p.age) AS INT64), min(p.name);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 25)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 100)
+        XCTAssertEqual(try tuple.getValue(2) as! String, "p0")
+        result = try conn.query(
+            """
+            MATCH (a:Person)-[e:KNOWS]->(b:Person)
+            RETURN count(*), CAST(sum(e.since) AS INT64),
+                count(CASE WHEN e.since = 9 THEN b._id_ END),
+                min(CASE WHEN e.since = 9 THEN b._id_ END);
+            """
+        )
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 24)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 276)
+        XCTAssertEqual(try tuple.getValue(2) as! Int64, 1)
+        XCTAssertEqual(try tuple.getValue(3) as! Int64, 1_000_000)
+    }
+
+    func testTriangleCount() throws {
+        let db = try Kuzu.Database(":memory:")
+        let conn = try Kuzu.Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Node(id STRING PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Edge(FROM Node TO Node);")
+        // A triangle A-B-C with D hanging off C. The reverse and the duplicate edges are ignored.
+        _ = try conn.query(
+            """
+            CREATE (a:Node {id: 'A'}), (b:Node {id: 'B'}), (c:Node {id: 'C'}), (d:Node {id: 'D'}),
+                   (a)-[:Edge]->(b), (b)-[:Edge]->(c), (c)-[:Edge]->(a), (a)-[:Edge]->(c),
+                   (c)-[:Edge]->(d), (c)-[:Edge]->(d)
+            """
+        )
+        _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge']);")
+        func values(_ function: String, _ column: String) throws -> [String: Double] {
+            let result = try conn.query(
+                "CALL \(function)('Graph') RETURN node.id, \(column);"
+            )
+            var values: [String: Double] = [:]
+            for row in result {
+                let value = try row.getValue(1)
+                values[try row.getValue(0) as! String] =
+                    (value as? Double) ?? Double(value as! Int64)
+            }
+            return values
+        }
+
+        XCTAssertEqual(
+            try values("triangle_count", "triangle_count"),
+            ["A": 1, "B": 1, "C": 1, "D": 0]
+        )
+        let coefficients = try values(
+            "local_clustering_coefficient", "local_clustering_coefficient"
+        )
+        XCTAssertEqual(coefficients["A"]!, 1, accuracy: 1e-9)
+        XCTAssertEqual(coefficients["B"]!, 1, accuracy: 1e-9)
+        XCTAssertEqual(coefficients["C"]!, 1.0 / 3, accuracy: 1e-9)
+        XCTAssertEqual(coefficients["D"]!, 0, accuracy: 1e-9)
+
+        _ = try conn.query("CREATE NODE TABLE Other(id STRING PRIMARY KEY);")
+        _ = try conn.query("CALL project_graph('Two', ['Node', 'Other'], ['Edge']);")
+        for function in ["triangle_count", "local_clustering_coefficient"] {
+            XCTAssertThrowsError(try conn.query("CALL \(function)('Two') RETURN node.id;")) {
+                error in
+                XCTAssertTrue(
+                    (error as! KuzuError).message.contains(
+                        "only supports operations on one node table"
+                    )
+                )
+            }
+        }
+    }
+
+    func testCentrality() throws {
+        let db = try Kuzu.Database(":memory:")
+        let conn = try Kuzu.Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Node(id STRING PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Edge(FROM Node TO Node);")
+        // A triangle A-B-C with D hanging off C. The reverse and the duplicate edges are ignored.
+        _ = try conn.query(
+            """
+            CREATE (a:Node {id: 'A'}), (b:Node {id: 'B'}), (c:Node {id: 'C'}), (d:Node {id: 'D'}),
+                   (a)-[:Edge]->(b), (b)-[:Edge]->(c), (c)-[:Edge]->(a), (a)-[:Edge]->(c),
+                   (c)-[:Edge]->(d), (c)-[:Edge]->(d)
+            """
+        )
+        _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge']);")
+        func values(_ function: String, _ column: String) throws -> [String: Double] {
+            let result = try conn.query(
+                "CALL \(function)('Graph') RETURN node.id, \(column);"
+            )
+            var values: [String: Double] = [:]
+            for row in result {
+                let value = try row.getValue(1)
+                values[try row.getValue(0) as! String] =
+                    (value as? Double) ?? Double(value as! Int64)
+            }
+            return values
+        }
+
+        // Only C is on the shortest paths between other nodes: A-D and B-D.
+        let betweenness = try values("betweenness_centrality", "betweenness_centrality")
+        XCTAssertEqual(betweenness["A"]!, 0, accuracy: 1e-9)
+        XCTAssertEqual(betweenness["B"]!, 0, accuracy: 1e-9)
+        XCTAssertEqual(betweenness["C"]!, 2, accuracy: 1e-9)
+        XCTAssertEqual(betweenness["D"]!, 0, accuracy: 1e-9)
+        let closeness = try values("closeness_centrality", "closeness_centrality")
+        XCTAssertEqual(closeness["A"]!, 2.5, accuracy: 1e-9)
+        XCTAssertEqual(closeness["B"]!, 2.5, accuracy: 1e-9)
+        XCTAssertEqual(closeness["C"]!, 3, accuracy: 1e-9)
+        XCTAssertEqual(closeness["D"]!, 2, accuracy: 1e-9)
+
+        // Sampling every node is exact.
+        let sampled = try conn.query(
+            """
+            CALL closeness_centrality('Graph', samplesize := 4, seed := 7)
+            RETURN node.id, closeness_centrality ORDER BY node.id;
+            """
+        )
+        var sampledCloseness: [Double] = []
+        for row in sampled {
+            sampledCloseness.append(try row.getValue(1) as! Double)
+        }
+        XCTAssertEqual(sampledCloseness, [2.5, 2.5, 3, 2])
+
+        _ = try conn.query("CREATE NODE TABLE Other(id STRING PRIMARY KEY);")
+        _ = try conn.query("CALL project_graph('Two', ['Node', 'Other'], ['Edge']);")
+        for function in ["betweenness_centrality", "closeness_centrality"] {
+            XCTAssertThrowsError(try conn.query("CALL \(function)('Two') RETURN node.id;")) {
+                error in
+                XCTAssertTrue(
+                    (error as! KuzuError).message.contains(
+                        "only supports operations on one node table"
+                    )
+                )
+            }
+        }
+    }
+
+    func testMaterializedGraphOverMemoryLimitFails() throws {
+        let db = try Kuzu.Database(":memory:")
+        let conn = try Kuzu.Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Node(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Edge(FROM Node TO Node);")
+        _ = try conn.query(
+            "UNWIND range(0, 99) AS i CREATE (:Node {id: i})-[:Edge]->(:Node {id: i + 100});"
+        )
+        _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge'], materialize := true);")
+        let wcc = "CALL weakly_connected_components('Graph') RETURN COUNT(DISTINCT group_id);"
+        XCTAssertEqual(try conn.query(wcc).getNext()!.getValue(0) as! Int64, 100)
+
+        // The snapshot rebuilt after the change no longer fits.
+        _ = try conn.query("CALL projected_graph_memory_limit=1;")
+        _ = try conn.query("MATCH (a:Node {id: 0}), (b:Node {id: 1}) CREATE (a)-[:Edge]->(b);")
+        for _ in 0..<2 {
+            XCTAssertThrowsError(try conn.query(wcc)) { error in
+                XCTAssertTrue(
+                    (error as! KuzuError).message.contains("exceeds projected_graph_memory_limit")
+                )
+            }
+        }
+
+        _ = try conn.query("CALL projected_graph_memory_limit=1073741824;")
+        XCTAssertEqual(try conn.query(wcc).getNext()!.getValue(0) as! Int64, 99)
+    }
+
+    func testDiskANNIndexLivesInDataFile() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_diskann_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let directory = (dbPath as NSString).deletingLastPathComponent
+        let dbName = (dbPath as NSString).lastPathComponent
+        func sidecarFiles() throws -> [String] {
+            return try FileManager.default.contentsOfDirectory(atPath: directory)
+                .filter { $0.hasPrefix(dbName) && $0.hasSuffix(".diskann") }
+        }
+        func nearestIDs(_ conn: Connection) throws -> [Int64] {
+            let result = try conn.query(
+                """
+                CALL QUERY_VECTOR_INDEX('Item', 'vec_index', [10.2, 10.2, 10.2, 10.2], 3)
+                RETURN node.id ORDER BY distance;
+                """
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(0, 199) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});"
+            )
+            _ = try conn.query("CALL CREATE_DISKANN_INDEX('Item', 'vec_index', 'vec', metric := 'l2');")
+            XCTAssertEqual(try nearestIDs(conn), [10, 11, 9])
+            XCTAssertEqual(try sidecarFiles(), [])
+
+            // The error names the actual table and property.
+            XCTAssertThrowsError(
+                try conn.query("MATCH (i:Item) WHERE i.id = 0 SET i.vec = [1, 1, 1, 1];")
+            ) { error in
+                XCTAssertTrue(
+                    (error as! KuzuError).message.contains(
+                        "Cannot set property vec in table Item")
+                )
+            }
+
+            // Dropping and recreating the index under the same name keeps searches correct.
+            _ = try conn.query("CALL DROP_VECTOR_INDEX('Item', 'vec_index');")
+            _ = try conn.query("CALL CREATE_DISKANN_INDEX('Item', 'vec_index', 'vec', metric := 'l2');")
+            XCTAssertEqual(try nearestIDs(conn), [10, 11, 9])
+        }
+
+        // The index is reloaded from the data file.
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        XCTAssertEqual(try nearestIDs(conn), [10, 11, 9])
+        XCTAssertEqual(try sidecarFiles(), [])
+    }
+
+    func testSQ8QuantizedVectorIndex() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_sq8_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        func nearestIDs(_ conn: Connection, _ value: Double, rerank: Bool = true) throws -> [Int64] {
+            let result = try conn.query(
+                """
+                CALL QUERY_VECTOR_INDEX('Item', 'vec_index', [\(value), \(value), \(value), \(value)], 3,
+                    rerank := \(rerank)) RETURN node.id ORDER BY distance;
+                """
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        XCTAssertThrowsError(
+            try conn.query(
+                "CALL CREATE_VECTOR_INDEX('Item', 'bad_index', 'vec', quantization := 'pq');")
+        )
+        _ = try conn.query(
+            "CALL CREATE_VECTOR_INDEX('Item', 'vec_index', 'vec', metric := 'l2', quantization := 'sq8');"
+        )
+
+        // The first queries build the codes while the others score on full-precision embeddings.
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: 4) { worker in
+            do {
+                let conn = try Connection(db)
+                for i in 0..<20 {
+                    let value = Double(100 + worker * 200 + i)
+                    let ids = try nearestIDs(conn, value + 0.2)
+                    if ids != [Int64(value), Int64(value) + 1, Int64(value) - 1] {
+                        lock.lock()
+                        failures.append("Query for \(value) returned \(ids)")
+                        lock.unlock()
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("Worker \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+        // Without re-ranking, results are ordered by the distances to the decoded codes.
+        XCTAssertTrue(try nearestIDs(conn, 500.2, rerank: false).contains(500))
+
+        // Nodes inserted after the codes were built get codes when they are committed.
+        _ = try conn.query(
+            "UNWIND range(1000, 1099) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        _ = try conn.query("CHECKPOINT;")
+        XCTAssertEqual(try nearestIDs(conn, 1050.2), [1050, 1051, 1049])
+        XCTAssertEqual(try nearestIDs(conn, 10.2), [10, 11, 9])
+    }
+
+    func testHNSWDeletesConsolidatedAtCheckpoint() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_hnsw_delete_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        func nearestIDs(_ conn: Connection, _ value: Double) throws -> [Int64] {
+            let result = try conn.query(
+                """
+                CALL QUERY_VECTOR_INDEX('Item', 'vec_index', [\(value), \(value), \(value), \(value)], 3)
+                    RETURN node.id ORDER BY distance;
+                """
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(0, 999) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+            _ = try conn.query(
+                "CALL CREATE_VECTOR_INDEX('Item', 'vec_index', 'vec', metric := 'l2');")
+            _ = try conn.query("CHECKPOINT;")
+
+            // Deletions that are rolled back are not consolidated.
+            _ = try conn.query("BEGIN TRANSACTION;")
+            _ = try conn.query("MATCH (i:Item) WHERE i.id < 100 DELETE i;")
+            _ = try conn.query("ROLLBACK;")
+            _ = try conn.query("CHECKPOINT;")
+            XCTAssertEqual(try nearestIDs(conn, 50.2), [50, 51, 49])
+
+            // Deleting past the consolidation threshold leaves the layers to the next checkpoint.
+            _ = try conn.query("MATCH (i:Item) WHERE i.id < 100 OR i.id % 10 = 5 DELETE i;")
+            XCTAssertEqual(try nearestIDs(conn, 50.2), [100, 101, 102])
+            XCTAssertEqual(try nearestIDs(conn, 505.2), [506, 504, 507])
+            _ = try conn.query("CHECKPOINT;")
+            XCTAssertEqual(try nearestIDs(conn, 50.2), [100, 101, 102])
+            XCTAssertEqual(try nearestIDs(conn, 505.2), [506, 504, 507])
+        }
+        // The consolidated layers and entry points are persisted, and stay usable for inserts.
+        let db = try Database(dbPath)
+        let conn = try Connection(db)
+        XCTAssertEqual(try nearestIDs(conn, 50.2), [100, 101, 102])
+        _ = try conn.query("UNWIND range(0, 49) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        XCTAssertEqual(try nearestIDs(conn, 20.2), [20, 21, 19])
+        XCTAssertEqual(try nearestIDs(conn, 505.2), [506, 504, 507])
+    }
+
+    func testFTSPostingListsAcrossCheckpoints() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_fts_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        func content(_ i: Int) -> String {
+            var words = ["common"]
+            if i % 3 == 0 { words.append("fizz fizz") }
+            if i % 5 == 0 { words.append("buzz") }
+            // Large gaps between doc offsets make the PFOR blocks store exceptions.
+            if i % 97 == 0 { words.append("rare") }
+            return words.joined(separator: " ")
+        }
+        func createDocs(_ conn: Connection, _ ids: Range<Int>) throws {
+            for i in ids {
+                _ = try conn.query("CREATE (:Doc {id: \(i), content: '\(content(i))'});")
+            }
+        }
+        func search(_ conn: Connection, _ index: String, _ query: String) throws -> [Int64: Double] {
+            let result = try conn.query(
+                "CALL QUERY_FTS_INDEX('Doc', '\(index)', '\(query)') RETURN node.id, score;"
+            )
+            var scores: [Int64: Double] = [:]
+            while result.hasNext() {
+                let tuple = try result.getNext()!
+                scores[try tuple.getValue(0) as! Int64] = try tuple.getValue(1) as? Double
+            }
+            return scores
+        }
+        // The lists persisted and rewritten at checkpoints must score like an index freshly built
+        // over the same docs.
+        func assertMatchesFreshIndex(_ conn: Connection, numDocs: Int) throws {
+            _ = try conn.query("CALL CREATE_FTS_INDEX('Doc', 'fresh_index', ['content']);")
+            for query in ["common", "fizz", "buzz", "rare"] {
+                let scores = try search(conn, "doc_index", query)
+                let expectedScores = try search(conn, "fresh_index", query)
+                XCTAssertEqual(scores.keys.sorted(), expectedScores.keys.sorted(), query)
+                for (id, score) in expectedScores {
+                    XCTAssertEqual(scores[id]!, score, accuracy: 1e-9, query)
+                }
+            }
+            XCTAssertEqual(try search(conn, "doc_index", "common").count, numDocs)
+            _ = try conn.query("CALL DROP_FTS_INDEX('Doc', 'fresh_index');")
+        }
+
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Doc(id INT64, content STRING, PRIMARY KEY(id));")
+            try createDocs(conn, 0..<500)
+            _ = try conn.query("CALL CREATE_FTS_INDEX('Doc', 'doc_index', ['content']);")
+            try assertMatchesFreshIndex(conn, numDocs: 500)
+        }
+
+        var numDocs = 500
+        for round in 0..<4 {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            // The lists are reloaded from the data file.
+            try assertMatchesFreshIndex(conn, numDocs: numDocs)
+            // Only the lists of the modified terms are rebuilt at the checkpoint.
+            try createDocs(conn, numDocs..<(numDocs + 50))
+            _ = try conn.query("MATCH (d:Doc) WHERE d.id = \(round * 3) DELETE d;")
+            _ = try conn.query("CREATE (:Doc {id: \(round * 3), content: 'common'});")
+            numDocs += 50
+            try assertMatchesFreshIndex(conn, numDocs: numDocs)
+            _ = try conn.query("CHECKPOINT;")
+            try assertMatchesFreshIndex(conn, numDocs: numDocs)
+        }
+    }
+
+    func testQueryVectorIndexBatch() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        _ = try conn.query("CALL CREATE_VECTOR_INDEX('Item', 'vec_index', 'vec', metric := 'l2');")
+        // The queries of a batch are searched in parallel, and each keeps its own results.
+        let values = (0..<64).map { Double($0 * 15 + 20) + 0.2 }
+        let queries = values.map { "[\($0), \($0), \($0), \($0)]" }.joined(separator: ", ")
+        let result = try conn.query(
+            """
+            CALL QUERY_VECTOR_INDEX_BATCH('Item', 'vec_index', [\(queries)], 3)
+            RETURN query_idx, node.id ORDER BY query_idx, distance;
+            """
+        )
+        var ids = [[Int64]](repeating: [], count: values.count)
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            ids[Int(try tuple.getValue(0) as! Int64)].append(try tuple.getValue(1) as! Int64)
+        }
+        for (queryIdx, value) in values.enumerated() {
+            let id = Int64(value)
+            XCTAssertEqual(ids[queryIdx], [id, id + 1, id - 1], "query \(queryIdx)")
+        }
+        // A batch of one query matches QUERY_VECTOR_INDEX.
+        let single = try conn.query(
+            """
+            CALL QUERY_VECTOR_INDEX('Item', 'vec_index', [500.2, 500.2, 500.2, 500.2], 3)
+            RETURN node.id, distance ORDER BY distance;
+            """
+        )
+        let batch = try conn.query(
+            """
+            CALL QUERY_VECTOR_INDEX_BATCH('Item', 'vec_index', [[500.2, 500.2, 500.2, 500.2]], 3)
+            RETURN node.id, distance ORDER BY distance;
+            """
+        )
+        for _ in 0..<3 {
+            let expected = try single.getNext()!
+            let tuple = try batch.getNext()!
+            XCTAssertEqual(try tuple.getValue(0) as! Int64, try expected.getValue(0) as! Int64)
+            XCTAssertEqual(
+                try tuple.getValue(1) as! Double, try expected.getValue(1) as! Double,
+                accuracy: 1e-6)
+        }
+        XCTAssertFalse(batch.hasNext())
+        XCTAssertThrowsError(
+            try conn.query(
+                """
+                CALL QUERY_VECTOR_INDEX_BATCH('Item', 'vec_index', [[1.0, 1.0, 1.0, 1.0]], 0)
+                RETURN node.id;
+                """
+            ))
+    }
+
+    func testVectorSearchWithFilterNodes() throws {
+        let db = try Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64, vec FLOAT[4], PRIMARY KEY(id));")
+        _ = try conn.query("UNWIND range(0, 999) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        _ = try conn.query("CALL CREATE_VECTOR_INDEX('Item', 'vec_index', 'vec', metric := 'l2');")
+        // Nodes inserted after the index was built are searched by brute force.
+        _ = try conn.query(
+            "UNWIND range(1000, 1009) AS i CREATE (:Item {id: i, vec: [i, i, i, i]});")
+        // The filter nodes are given by their internal IDs, e.g. the result of a preceding match.
+        let filteredIDs: [Int64] = [10, 300, 301, 700, 999, 1003]
+        let idResult = try conn.query(
+            "MATCH (i:Item) WHERE i.id IN \(filteredIDs) RETURN id(i) ORDER BY i.id;")
+        var internalIDs: [String] = []
+        while idResult.hasNext() {
+            let id = try idResult.getNext()!.getValue(0) as! KuzuInternalId
+            internalIDs.append("internal_id(\(id.tableId), \(id.offset))")
+        }
+        XCTAssertEqual(internalIDs.count, filteredIDs.count)
+        let filterNodes = "[" + internalIDs.joined(separator: ", ") + "]"
+        func search(_ value: Double, _ options: String) throws -> [Int64] {
+            let result = try conn.query(
+                """
+                CALL QUERY_VECTOR_INDEX('Item', 'vec_index', [\(value), \(value), \(value), \(value)], 3,
+                    filter_nodes := \(filterNodes)\(options))
+                RETURN node.id ORDER BY distance;
+                """
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+
+        // Graph searches only return filter nodes.
+        for value in [305.2, 1005.2, 5.2] {
+            let ids = try search(value, "")
+            XCTAssertTrue(Set(ids).isSubset(of: filteredIDs), "\(ids)")
+        }
+        // Masks below the brute-force selectivity are scanned, which returns the exact top k.
+        let bruteForce = ", brute_force_search_up_sel := 0.5"
+        XCTAssertEqual(try search(305.2, bruteForce), [301, 300, 10])
+        XCTAssertEqual(try search(1005.2, bruteForce), [1003, 999, 700])
+        XCTAssertEqual(try search(5.2, bruteForce), [10, 300, 301])
+
+        let batch = try conn.query(
+            """
+            CALL QUERY_VECTOR_INDEX_BATCH('Item', 'vec_index',
+                [[305.2, 305.2, 305.2, 305.2], [5.2, 5.2, 5.2, 5.2]], 2,
+                filter_nodes := \(filterNodes)\(bruteForce))
+            RETURN query_idx, node.id ORDER BY query_idx, distance;
+            """
+        )
+        var batchIDs: [[Int64]] = [[], []]
+        while batch.hasNext() {
+            let tuple = try batch.getNext()!
+            batchIDs[Int(try tuple.getValue(0) as! Int64)].append(try tuple.getValue(1) as! Int64)
+        }
+        XCTAssertEqual(batchIDs, [[301, 300], [10, 300]])
+    }
+
+    func testFTSTopKWithMaxScore() throws {
+        let db = try Database(":memory:")
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Doc(id INT64 PRIMARY KEY, content STRING);")
+        func content(_ i: Int) -> String {
+            var words = ["delta"]
+            words += Array(repeating: "alpha", count: i % 4)
+            if i % 7 == 0 { words += Array(repeating: "beta", count: i % 3 + 1) }
+            if i % 11 == 0 { words.append("gamma") }
+            if i % 50 == 0 { words += Array(repeating: "omega", count: 5) }
+            return words.joined(separator: " ")
+        }
+        for i in 0..<300 {
+            _ = try conn.query("CREATE (:Doc {id: \(i), content: '\(content(i))'});")
+        }
+        _ = try conn.query("CALL CREATE_FTS_INDEX('Doc', 'doc_index', ['content']);")
+        func search(_ query: String, _ options: String) throws -> [Int64: Double] {
+            let result = try conn.query(
+                "CALL QUERY_FTS_INDEX('Doc', 'doc_index', '\(query)'\(options)) "
+                    + "RETURN node.id, score;"
+            )
+            var scores: [Int64: Double] = [:]
+            while result.hasNext() {
+                let tuple = try result.getNext()!
+                scores[try tuple.getValue(0) as! Int64] = try tuple.getValue(1) as? Double
+            }
+            return scores
+        }
+        // The pruned top k docs must have the k best scores of the full evaluation.
+        func assertTopKMatchesFullQuery() throws {
+            for query in ["alpha beta gamma omega", "delta omega", "beta gamma", "alpha"] {
+                let allScores = try search(query, "")
+                let bestScores = allScores.values.sorted(by: >)
+                for k in [1, 3, 10, 1000] {
+                    let topScores = try search(query, ", top := \(k)")
+                    XCTAssertEqual(topScores.count, min(k, allScores.count), query)
+                    for (id, score) in topScores {
+                        XCTAssertEqual(score, allScores[id]!, accuracy: 1e-9, query)
+                    }
+                    for (score, expected) in zip(topScores.values.sorted(by: >), bestScores) {
+                        XCTAssertEqual(score, expected, accuracy: 1e-9, query)
+                    }
+                }
+            }
+        }
+        try assertTopKMatchesFullQuery()
+        // Docs inserted after the index is built raise the max impacts of their terms.
+        let gammaContent = String(repeating: "gamma ", count: 20) + "beta"
+        for i in 300..<310 {
+            _ = try conn.query("CREATE (:Doc {id: \(i), content: '\(gammaContent)'});")
+        }
+        _ = try conn.query("MATCH (d:Doc) WHERE d.id % 50 = 0 DELETE d;")
+        try assertTopKMatchesFullQuery()
+        XCTAssertEqual(Set(try search("gamma", ", top := 10").keys), Set(Int64(300)..<310))
+    }
+
+    func testIncrementalPageRankAndWCC() throws {
+        let db = try Kuzu.Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Kuzu.Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Node(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Edge(FROM Node TO Node);")
+        _ = try conn.query("UNWIND range(0, 19) AS i CREATE (:Node {id: i});")
+        // Node 0 is a hub, and nodes 10 to 19 form pairs.
+        _ = try conn.query(
+            """
+            MATCH (a:Node), (b:Node)
+            WHERE (a.id = 0 AND b.id > 0 AND b.id < 10)
+                OR (a.id >= 10 AND a.id % 2 = 0 AND b.id = a.id + 1)
+            CREATE (a)-[:Edge]->(b);
+            """
+        )
+        _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge'], materialize := true);")
+        func ranks(_ options: String = "") throws -> [Int64: Double] {
+            var ranks: [Int64: Double] = [:]
+            for row in try conn.query("CALL page_rank('Graph'\(options)) RETURN node.id, rank;") {
+                ranks[try row.getValue(0) as! Int64] = try row.getValue(1) as? Double
+            }
+            return ranks
+        }
+        func components(_ options: String = "") throws -> [[Int64]] {
+            var components: [[Int64]] = []
+            for row in try conn.query(
+                "CALL wcc('Graph'\(options)) RETURN group_id, collect(node.id);")
+            {
+                components.append((try row.getValue(1) as! [Int64]).sorted())
+            }
+            return components.sorted { $0.lexicographicallyPrecedes($1) }
+        }
+        func assertRanksEqual(_ ranks: [Int64: Double], _ expected: [Int64: Double]) {
+            XCTAssertEqual(ranks.keys.sorted(), expected.keys.sorted())
+            for (id, rank) in expected {
+                XCTAssertEqual(ranks[id]!, rank, accuracy: 1e-4, "node \(id)")
+            }
+        }
+
+        let fullRanks = try ranks()
+        assertRanksEqual(try ranks(", incremental := true"), fullRanks)
+        // Without further iterations, the ranks are the initial ones: uniform ranks, far from the
+        // result, or the cached ranks of the previous incremental call.
+        let initialRanks = try ranks(", maxIterations := 1")
+        XCTAssertGreaterThan(abs(initialRanks[0]! - fullRanks[0]!), 1e-3)
+        assertRanksEqual(try ranks(", incremental := true, maxIterations := 1"), fullRanks)
+        XCTAssertEqual(try components(", incremental := true"), try components())
+
+        // Added rels merge components of the cached result.
+        _ = try conn.query("MATCH (a:Node {id: 9}), (b:Node {id: 10}) CREATE (a)-[:Edge]->(b);")
+        var expected = try components()
+        XCTAssertEqual(expected.count, 5)
+        XCTAssertEqual(try components(", incremental := true"), expected)
+        assertRanksEqual(try ranks(", incremental := true"), try ranks())
+        // Removed rels fall back to a full computation.
+        _ = try conn.query("MATCH (:Node {id: 0})-[e:Edge]->(:Node {id: 5}) DELETE e;")
+        expected = try components()
+        XCTAssertEqual(expected.count, 6)
+        XCTAssertEqual(try components(", incremental := true"), expected)
+        assertRanksEqual(try ranks(", incremental := true"), try ranks())
+    }
+
+    func testLeiden() throws {
+        let db = try Kuzu.Database(":memory:", SystemConfig(maxNumThreads: 4))
+        let conn = try Kuzu.Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Node(id STRING PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Edge(FROM Node TO Node);")
+        // Two 4-cliques A-D and E-H joined by the edge D-E, and the separate pair I-J.
+        _ = try conn.query(
+            "UNWIND ['A','B','C','D','E','F','G','H','I','J'] AS id CREATE (:Node {id: id});")
+        _ = try conn.query(
+            """
+            UNWIND [['A','B'],['A','C'],['A','D'],['B','C'],['B','D'],['C','D'],
+                    ['E','F'],['E','G'],['E','H'],['F','G'],['F','H'],['G','H'],
+                    ['D','E'],['I','J']] AS pair
+            MATCH (a:Node {id: pair[1]}), (b:Node {id: pair[2]})
+            CREATE (a)-[:Edge]->(b);
+            """
+        )
+        _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge']);")
+        // Refinement merges greedily, so the communities are the same on every run.
+        for options in ["", ", maxIterations := 20, maxPhases := 5"] {
+            let result = try conn.query(
+                "CALL leiden('Graph'\(options)) RETURN leiden_id, collect(node.id);")
+            var communities: [[String]] = []
+            for row in result {
+                communities.append((try row.getValue(1) as! [String]).sorted())
+            }
+            XCTAssertEqual(
+                communities.sorted { $0.lexicographicallyPrecedes($1) },
+                [["A", "B", "C", "D"], ["E", "F", "G", "H"], ["I", "J"]])
+        }
+
+        _ = try conn.query("CREATE NODE TABLE Other(id STRING PRIMARY KEY);")
+        _ = try conn.query("CALL project_graph('Two', ['Node', 'Other'], ['Edge']);")
+        XCTAssertThrowsError(try conn.query("CALL leiden('Two') RETURN node.id;")) { error in
+            XCTAssertTrue(
+                (error as! KuzuError).message.contains("only supports operations on one node table"))
+        }
     }
 }
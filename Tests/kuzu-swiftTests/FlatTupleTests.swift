@@ -77,4 +77,79 @@ final class FlatTupleTests: XCTestCase {
         let value3 = try tuple.getValue(2)
         XCTAssertEqual(value3 as! Int64, 35)
     }
+
+    func testGetTyped() throws {
+        let query =
+            "MATCH (a:person) RETURN a.fName, a.age, a.isStudent, a.eyeSight, a.height, a.grades, "
+            + "a.ID + 1000 ORDER BY a.fName LIMIT 1;"
+        let result = try conn.query(query)
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.get(String.self, at: 0), "Alice")
+        XCTAssertEqual(try tuple.get(Int64.self, at: 1), 35)
+        XCTAssertEqual(try tuple.get(Int.self, at: 1), 35)
+        XCTAssertEqual(try tuple.get(UInt8.self, at: 1), 35)
+        XCTAssertEqual(try tuple.get(Bool.self, at: 2), true)
+        XCTAssertEqual(try tuple.get(Double.self, at: 3), 5.0)
+        XCTAssertEqual(try tuple.get(Float.self, at: 4)!, 1.731, accuracy: 0.0001)
+        XCTAssertEqual(try tuple.get([Int64].self, at: 5), [96, 54, 86, 92])
+        XCTAssertThrowsError(try tuple.get(Int8.self, at: 6))
+        XCTAssertThrowsError(try tuple.get(String.self, at: 1))
+        XCTAssertThrowsError(try tuple.get([Float].self, at: 5))
+    }
+
+    func testGetFloatArrayAndBlob() throws {
+        let query =
+            "MATCH (a:person)-[e:meets]->(b:person) WHERE a.ID = 0 RETURN e.location, e.data, "
+            + "CAST(NULL AS FLOAT[2]);"
+        let result = try conn.query(query)
+        let tuple = try result.getNext()!
+        let location = try tuple.getFloatArray(at: 0)!
+        XCTAssertEqual(location.count, 2)
+        XCTAssertEqual(location[0], 7.82, accuracy: 0.0001)
+        XCTAssertEqual(location[1], 3.54, accuracy: 0.0001)
+        XCTAssertEqual(try tuple.get(Data.self, at: 1), Data([0xAA, 0xBB, 0xCC, 0xDD]))
+        XCTAssertNil(try tuple.getFloatArray(at: 2))
+        XCTAssertThrowsError(try tuple.get([Double].self, at: 0))
+    }
+
+    func testDecode() throws {
+        struct Person: Decodable {
+            let name: String
+            let age: Int
+            let height: Float
+            let grades: [Int64]
+            let birthdate: Date
+            let nickname: String?
+        }
+        let query =
+            "MATCH (a:person) RETURN a.fName AS name, a.age AS age, a.height AS height, "
+            + "a.grades AS grades, a.birthdate AS birthdate, CAST(NULL AS STRING) AS nickname "
+            + "ORDER BY a.fName LIMIT 2;"
+        let result = try conn.query(query)
+        var people: [Person] = []
+        while let tuple = try result.getNext() {
+            people.append(try tuple.decode(Person.self))
+        }
+        XCTAssertEqual(people.count, 2)
+        XCTAssertEqual(people[0].name, "Alice")
+        XCTAssertEqual(people[0].age, 35)
+        XCTAssertEqual(people[0].grades, [96, 54, 86, 92])
+        XCTAssertEqual(people[0].birthdate, Date(timeIntervalSince1970: -2_208_988_800))
+        XCTAssertNil(people[0].nickname)
+        XCTAssertEqual(people[1].name, "Bob")
+
+        let singleResult = try conn.query("RETURN CAST(8 AS INT64);")
+        XCTAssertEqual(try singleResult.getNext()!.decode(Int64.self), 8)
+
+        struct Missing: Decodable {
+            let missing: Int64
+        }
+        let missingResult = try conn.query("MATCH (a:person) RETURN a.age LIMIT 1;")
+        XCTAssertThrowsError(try missingResult.getNext()!.decode(Missing.self)) { error in
+            guard case DecodingError.keyNotFound = error else {
+                XCTFail("Unexpected error \(error)")
+                return
+            }
+        }
+    }
 }
@@ -0,0 +1,180 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+
+import Foundation
+
+#if canImport(Glibc)
+    import Glibc
+#elseif canImport(Darwin)
+    import Darwin
+#endif
+
+/// A minimal HTTP server listening on 127.0.0.1, used to test extensions that call remote services
+/// without the real service. Each request is answered with status 200 and the JSON body returned by
+/// the handler for its path and body. Clients may keep their connections alive and send requests
+/// on several connections at once, so the handler must be thread safe.
+internal final class MockHTTPServer {
+    private let listenFD: Int32
+    private let handler: (_ path: String, _ body: Data) -> Data
+    let port: UInt16
+
+    var url: String { "http://127.0.0.1:\(port)" }
+
+    init(handler: @escaping (_ path: String, _ body: Data) -> Data) throws {
+        #if canImport(Glibc)
+            let fd = socket(AF_INET, Int32(SOCK_STREAM.rawValue), 0)
+        #else
+            let fd = socket(AF_INET, SOCK_STREAM, 0)
+        #endif
+        guard fd >= 0 else {
+            throw POSIXError(.EIO)
+        }
+        var addr = sockaddr_in()
+        #if canImport(Darwin)
+            addr.sin_len = UInt8(MemoryLayout<sockaddr_in>.size)
+        #endif
+        addr.sin_family = sa_family_t(AF_INET)
+        // Port 0 lets the OS pick a free port.
+        addr.sin_port = 0
+        addr.sin_addr.s_addr = inet_addr("127.0.0.1")
+        var addrLen = socklen_t(MemoryLayout<sockaddr_in>.size)
+        let bound = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                bind(fd, $0, addrLen) == 0 && getsockname(fd, $0, &addrLen) == 0
+            }
+        }
+        guard bound, listen(fd, 16) == 0 else {
+            close(fd)
+            throw POSIXError(.EADDRNOTAVAIL)
+        }
+        listenFD = fd
+        self.handler = handler
+        port = UInt16(bigEndian: addr.sin_port)
+        Thread.detachNewThread { [self] in acceptConnections() }
+    }
+
+    func stop() {
+        shutdown(listenFD, Int32(SHUT_RDWR))
+        close(listenFD)
+    }
+
+    private func acceptConnections() {
+        while true {
+            let clientFD = accept(listenFD, nil, nil)
+            if clientFD < 0 {
+                return
+            }
+            #if canImport(Darwin)
+                var noSigPipe: Int32 = 1
+                _ = setsockopt(
+                    clientFD, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe,
+                    socklen_t(MemoryLayout<Int32>.size))
+            #endif
+            Thread.detachNewThread { [self] in serve(clientFD) }
+        }
+    }
+
+    private func serve(_ clientFD: Int32) {
+        defer { close(clientFD) }
+        var buffer = Data()
+        var chunk = [UInt8](repeating: 0, count: 64 * 1024)
+        let headerEnd = Data("\r\n\r\n".utf8)
+        while true {
+            // Reads the headers and then the body of the next request.
+            var path = ""
+            var bodyStart: Int?
+            var contentLength = 0
+            while bodyStart == nil || buffer.count < bodyStart! + contentLength {
+                if bodyStart == nil, let range = buffer.range(of: headerEnd) {
+                    bodyStart = range.upperBound
+                    let headers = String(decoding: buffer[..<range.lowerBound], as: UTF8.self)
+                        .components(separatedBy: "\r\n")
+                    // The request line is "<method> <path> HTTP/1.1".
+                    let requestLine = headers[0].split(separator: " ")
+                    path = requestLine.count > 1 ? String(requestLine[1]) : ""
+                    for line in headers where line.lowercased().hasPrefix("content-length:") {
+                        let value = line.dropFirst("content-length:".count)
+                        contentLength = Int(value.trimmingCharacters(in: .whitespaces)) ?? 0
+                    }
+                    continue
+                }
+                let numRead = recv(clientFD, &chunk, chunk.count, 0)
+                if numRead <= 0 {
+                    return
+                }
+                buffer.append(contentsOf: chunk[0..<numRead])
+            }
+            let body = Data(buffer[bodyStart!..<(bodyStart! + contentLength)])
+            buffer = Data(buffer[(bodyStart! + contentLength)...])
+            let response = handler(path, body)
+            var message = Data(
+                ("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                    + "Content-Length: \(response.count)\r\n\r\n").utf8)
+            message.append(response)
+            if !sendMessage(clientFD, message) {
+                return
+            }
+        }
+    }
+
+    private func sendMessage(_ clientFD: Int32, _ message: Data) -> Bool {
+        #if canImport(Glibc)
+            let flags = Int32(MSG_NOSIGNAL)
+        #else
+            let flags: Int32 = 0
+        #endif
+        return message.withUnsafeBytes { bytes in
+            var offset = 0
+            while offset < bytes.count {
+                let numSent = send(
+                    clientFD, bytes.baseAddress! + offset, bytes.count - offset, flags)
+                if numSent <= 0 {
+                    return false
+                }
+                offset += numSent
+            }
+            return true
+        }
+    }
+}
+
+/// An Ollama compatible embedding server, used to test CREATE_EMBEDDING without a real provider.
+/// Each text of a POST /api/embed request is embedded as [length of the text, 1], and the requests
+/// and texts received are counted.
+internal final class MockEmbeddingServer {
+    private let lock = NSLock()
+    private var numRequests = 0
+    private var numTexts = 0
+    private var server: MockHTTPServer!
+
+    var endpoint: String { server.url }
+
+    init() throws {
+        server = try MockHTTPServer { [unowned self] _, body in
+            let payload = try? JSONSerialization.jsonObject(with: body) as? [String: Any]
+            let texts = payload?["input"] as? [String] ?? []
+            lock.lock()
+            numRequests += 1
+            numTexts += texts.count
+            lock.unlock()
+            return try! JSONSerialization.data(withJSONObject: [
+                "embeddings": texts.map { [Double($0.count), 1.0] }
+            ])
+        }
+    }
+
+    /// Returns the number of requests and texts received so far.
+    func getCounts() -> (requests: Int, texts: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        return (numRequests, numTexts)
+    }
+
+    func stop() {
+        server.stop()
+    }
+}
@@ -131,10 +131,122 @@ final class QueryResultTests: XCTestCase {
         XCTAssertGreaterThan(result.getCompilingTime(), 0)
     }
 
+    func testQueryResultGetPlanningTime() throws {
+        let result = try conn.query(
+            "MATCH (a:person)-[:knows]->(b:person) WHERE a.ID = 0 RETURN b.fName;"
+        )
+        XCTAssertGreaterThan(result.getPlanningTime(), 0)
+        XCTAssertLessThanOrEqual(result.getPlanningTime(), result.getCompilingTime())
+    }
+
     func testQueryResultGetExecutionTime() throws {
         let result = try conn.query(
             "MATCH (a:person) WHERE a.ID = 0 RETURN a.fName, a.age, a.isStudent, a.isWorker;"
         )
         XCTAssertGreaterThan(result.getExecutionTime(), 0)
     }
+
+    func testStreamingQueryResult() throws {
+        _ = try conn.query("CALL streaming_result_buffer=1;")
+        let result = try conn.query("MATCH (a:person) RETURN a.ID ORDER BY a.ID;")
+        var ids: [Int64] = []
+        while result.hasNext() {
+            let tuple = try result.getNext()!
+            ids.append(try tuple.getValue(0) as! Int64)
+        }
+        XCTAssertEqual(ids, [0, 2, 3, 5, 7, 8, 9, 10])
+    }
+
+    func testStreamingQueryResultGetNumberOfRows() throws {
+        _ = try conn.query("CALL streaming_result_buffer=1;")
+        let result = try conn.query("MATCH (a:person) RETURN a.ID;")
+        XCTAssertEqual(result.getRowCount(), 8)
+        var numRows = 0
+        while result.hasNext() {
+            _ = try result.getNext()
+            numRows += 1
+        }
+        XCTAssertEqual(numRows, 8)
+    }
+
+    func testStreamingQueryResultFailure() throws {
+        _ = try conn.query("CALL streaming_result_buffer=1;")
+        XCTAssertThrowsError(try conn.query("MATCH (a:person) RETURN a.ID / (a.ID - a.ID);")) {
+            error in
+            XCTAssertTrue((error as! KuzuError).message.contains("Divide by zero"))
+        }
+        // The connection can run queries after the failed one.
+        let result = try conn.query("MATCH (a:person) RETURN COUNT(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 8)
+    }
+
+    func testQueryResultNextBatch() throws {
+        let result = try conn.query(
+            "MATCH (a:person) RETURN a.ID, a.fName, a.isStudent, a.age ORDER BY a.ID;"
+        )
+        var ids: [Int64] = []
+        var names: [String?] = []
+        var numBatches = 0
+        while let batch = try result.nextBatch(maxRowCount: 3) {
+            numBatches += 1
+            XCTAssertEqual(batch.getColumnCount(), 4)
+            XCTAssertLessThanOrEqual(batch.getRowCount(), 3)
+            let idColumn = try batch.getColumn(0)
+            let nameColumn = try batch.getColumn(1)
+            ids.append(contentsOf: try idColumn.getValues(Int64.self))
+            for i in 0..<nameColumn.count {
+                names.append(try nameColumn.getString(i))
+            }
+            XCTAssertThrowsError(try idColumn.getValues(Int32.self))
+            XCTAssertThrowsError(try nameColumn.getBool(0))
+        }
+        XCTAssertEqual(numBatches, 3)
+        XCTAssertEqual(ids, [0, 2, 3, 5, 7, 8, 9, 10])
+        XCTAssertEqual(names[0], "Alice")
+        XCTAssertEqual(names[1], "Bob")
+        XCTAssertFalse(result.hasNext())
+        XCTAssertNil(try result.nextBatch())
+    }
+
+    func testQueryResultNextBatchNullsAndBools() throws {
+        let result = try conn.query(
+            "UNWIND [1, NULL, 3] AS x RETURN x, x > 1;"
+        )
+        let batch = try result.nextBatch()!
+        XCTAssertEqual(batch.getRowCount(), 3)
+        let valueColumn = try batch.getColumn(0)
+        let boolColumn = try batch.getColumn(1)
+        XCTAssertFalse(valueColumn.isNull(0))
+        XCTAssertTrue(valueColumn.isNull(1))
+        XCTAssertEqual(try valueColumn.getValues(Int64.self)[2], 3)
+        XCTAssertEqual(try boolColumn.getBool(0), false)
+        XCTAssertNil(try boolColumn.getBool(1))
+        XCTAssertEqual(try boolColumn.getBool(2), true)
+    }
+
+    func testQueryResultNextBatchInt128() throws {
+        let result = try conn.query(
+            """
+            UNWIND [CAST('-1', 'INT128'), NULL, CAST('18446744073709551616', 'INT128'),
+                    CAST('-12345678901234567890123456789', 'INT128')] AS x RETURN x;
+            """
+        )
+        let column = try result.nextBatch()!.getColumn(0)
+        XCTAssertEqual(try column.getInt128(0), Decimal(-1))
+        XCTAssertNil(try column.getInt128(1))
+        XCTAssertEqual(try column.getInt128(2), Decimal(string: "18446744073709551616"))
+        XCTAssertEqual(
+            try column.getInt128(3),
+            Decimal(string: "-12345678901234567890123456789")
+        )
+        XCTAssertThrowsError(try column.getValues(Int64.self))
+    }
+
+    func testQueryResultNextBatchUnsupportedColumn() throws {
+        let result = try conn.query("MATCH (a:person) RETURN a, a.ID;")
+        let batch = try result.nextBatch()!
+        XCTAssertThrowsError(try batch.getColumn(0))
+        XCTAssertNoThrow(try batch.getColumn(1))
+        XCTAssertThrowsError(try batch.getColumn(2))
+    }
 }
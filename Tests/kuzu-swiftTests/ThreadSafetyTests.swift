@@ -464,4 +464,277 @@ final class ThreadSafetyTests: XCTestCase {
         // Cleanup
         deleteTestDatabaseDirectory(dbPath)
     }
+
+    /// Test for work stealing: parallel queries from more connections than workers are spread over
+    /// the workers' queues, and every query finishes with correct results while failing queries
+    /// remove their tasks from the queues they were pushed to
+    func testConcurrentParallelQueriesShareWorkerQueues() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_work_stealing_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let db = try Database(dbPath, SystemConfig(maxNumThreads: 4))
+        let setupConn = try Connection(db)
+        _ = try setupConn.query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));")
+        _ = try setupConn.query("UNWIND range(0, 99999) AS i CREATE (:Item {id: i});")
+
+        let numConnections = 8
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: numConnections) { worker in
+            do {
+                let conn = try Connection(db)
+                for _ in 0..<10 {
+                    if worker == 0 {
+                        // Fails on one row in the middle of the scan.
+                        XCTAssertThrowsError(
+                            try conn.query("MATCH (i:Item) RETURN sum(i.id % (i.id - 50000));"))
+                        continue
+                    }
+                    let result = try conn.query("MATCH (i:Item) RETURN sum(i.id);")
+                    let sum = try result.getNext()!.getValue(0) as! Int64
+                    if sum != Int64(99999 * 100000 / 2) {
+                        lock.lock()
+                        failures.append("Connection \(worker) returned \(sum)")
+                        lock.unlock()
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("Connection \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+
+        let result = try setupConn.query("MATCH (i:Item) WHERE i.id % 2 = 0 RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 50000)
+    }
+
+    /// Test for NUMA aware scans: concurrent parallel scans over a table larger than the buffer pool
+    /// take every node group exactly once, and pages evicted by one worker's eviction queue
+    /// partition can be cached again by the others
+    func testConcurrentScansLargerThanBufferPool() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_numa_scan_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let numRows = 600000
+        do {
+            let db = try Database(dbPath)
+            let conn = try Connection(db)
+            _ = try conn.query("CREATE NODE TABLE Item(id INT64, name STRING, PRIMARY KEY(id));")
+            _ = try conn.query(
+                "UNWIND range(0, \(numRows - 1)) AS i "
+                    + "CREATE (:Item {id: i, name: concat('item-', CAST(i AS STRING))});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        let db = try Database(
+            dbPath, SystemConfig(bufferPoolSize: 8 * 1024 * 1024, maxNumThreads: 4))
+
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: 4) { worker in
+            do {
+                let conn = try Connection(db)
+                for _ in 0..<3 {
+                    let result = try conn.query(
+                        "MATCH (i:Item) RETURN count(*), sum(i.id), count(DISTINCT size(i.name));")
+                    let tuple = try result.getNext()!
+                    let count = try tuple.getValue(0) as! Int64
+                    let sum = try tuple.getValue(1) as! Int64
+                    // Names are 'item-0' to 'item-599999', 6 to 11 characters long.
+                    let numSizes = try tuple.getValue(2) as! Int64
+                    if count != Int64(numRows) || sum != Int64((numRows - 1) * numRows / 2)
+                        || numSizes != 6
+                    {
+                        lock.lock()
+                        failures.append("Connection \(worker) returned (\(count), \(sum), \(numSizes))")
+                        lock.unlock()
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("Connection \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+    }
+
+    /// Test for group commit: a writer starts while earlier commits wait for their WAL sync, so
+    /// that concurrent commits share syncs instead of syncing one at a time
+    func testConcurrentWritersShareWALSyncs() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_group_commit_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let db = try Database(dbPath)
+        let setupConn = try Connection(db)
+        _ = try setupConn.query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));")
+        // The sync leader waits a little for other commits to join its sync.
+        _ = try setupConn.query("CALL wal_group_commit_delay=2000;")
+        func walInfo() throws -> (commits: UInt64, syncs: UInt64) {
+            let tuple = try setupConn.query("CALL WAL_INFO() RETURN *;").getNext()!
+            return (try tuple.getValue(0) as! UInt64, try tuple.getValue(1) as! UInt64)
+        }
+        let before = try walInfo()
+
+        let numWriters = 4
+        let numCommitsPerWriter = 25
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: numWriters) { worker in
+            do {
+                let conn = try Connection(db)
+                var i = 0
+                while i < numCommitsPerWriter {
+                    do {
+                        _ = try conn.query("CREATE (:Item {id: \(worker * 1000 + i)});")
+                        i += 1
+                    } catch let error as KuzuError
+                        where error.message.contains("Only one write transaction")
+                    {
+                        // Another writer is still running its transaction.
+                        continue
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("Writer \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+
+        let result = try setupConn.query("MATCH (i:Item) RETURN count(*);")
+        XCTAssertEqual(
+            try result.getNext()!.getValue(0) as! Int64, Int64(numWriters * numCommitsPerWriter))
+        let after = try walInfo()
+        let numCommits = after.commits - before.commits
+        let numSyncs = after.syncs - before.syncs
+        XCTAssertGreaterThanOrEqual(numCommits, UInt64(numWriters * numCommitsPerWriter))
+        XCTAssertLessThan(numSyncs, numCommits)
+    }
+
+    /// Test for scheduling classes: batch and background queries running alongside interactive
+    /// ones never get more workers than the quotas of their classes, even once their tasks have
+    /// waited long enough to be picked up ahead of other classes
+    func testSchedulingClassWorkerQuotas() throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_scheduling_class_test_" + UUID().uuidString
+        defer { deleteTestDatabaseDirectory(dbPath) }
+        let db = try Database(dbPath, SystemConfig(maxNumThreads: 8))
+        let setupConn = try Connection(db)
+        _ = try setupConn.query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));")
+        _ = try setupConn.query("UNWIND range(0, 499999) AS i CREATE (:Item {id: i});")
+
+        let result = try setupConn.query("CALL current_setting('scheduling_class') RETURN *;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "INTERACTIVE")
+        XCTAssertThrowsError(try setupConn.query("CALL scheduling_class='urgent';"))
+
+        typealias ClassStats = (quota: UInt64, active: UInt64, maxActive: UInt64)
+        func schedulerInfo() throws -> [String: ClassStats] {
+            let result = try setupConn.query("CALL scheduler_info() RETURN *;")
+            var info: [String: ClassStats] = [:]
+            while result.hasNext() {
+                let tuple = try result.getNext()!
+                info[try tuple.getValue(0) as! String] = (
+                    try tuple.getValue(1) as! UInt64, try tuple.getValue(2) as! UInt64,
+                    try tuple.getValue(3) as! UInt64
+                )
+            }
+            return info
+        }
+        // With 8 workers, BATCH tasks leave a quarter of them free and BACKGROUND tasks use at
+        // most a quarter of them.
+        let before = try schedulerInfo()
+        XCTAssertEqual(before["INTERACTIVE"]?.quota, 8)
+        XCTAssertEqual(before["BATCH"]?.quota, 6)
+        XCTAssertEqual(before["BACKGROUND"]?.quota, 2)
+
+        // More connections of each class than workers, so that tasks queue up and age.
+        let classes = ["background", "batch", "interactive"]
+        let numConnsPerClass = 6
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: classes.count * numConnsPerClass) { worker in
+            let schedulingClass = classes[worker % classes.count]
+            do {
+                let conn = try Connection(db)
+                _ = try conn.query("CALL scheduling_class='\(schedulingClass)';")
+                for _ in 0..<5 {
+                    let result = try conn.query("MATCH (i:Item) RETURN sum(i.id);")
+                    let sum = try result.getNext()!.getValue(0) as! Int64
+                    if sum != Int64(499999 * 500000 / 2) {
+                        lock.lock()
+                        failures.append("\(schedulingClass) query returned \(sum)")
+                        lock.unlock()
+                    }
+                }
+            } catch {
+                lock.lock()
+                failures.append("\(schedulingClass) connection failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+
+        let after = try schedulerInfo()
+        for name in ["INTERACTIVE", "BATCH", "BACKGROUND"] {
+            let stats = try XCTUnwrap(after[name])
+            XCTAssertGreaterThan(stats.maxActive, 0, name)
+            XCTAssertLessThanOrEqual(stats.maxActive, stats.quota, name)
+        }
+        XCTAssertEqual(after["BATCH"]?.active, 0)
+    }
+
+    /// Test for read-only queries running alongside commits and checkpoints
+    /// Read-only transactions begin and commit without the transaction manager's global lock,
+    /// so every reader must still see each commit either entirely or not at all
+    func testConcurrentReadersWithCommitsAndCheckpoints() async throws {
+        let dbPath = NSTemporaryDirectory() + "kuzu_concurrent_readers_test_" + UUID().uuidString
+        let db = try Database(dbPath)
+        let setupConn = try Connection(db)
+        _ = try setupConn.query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));")
+
+        let numBatches = 20
+        let batchSize = 50
+        let lock = NSLock()
+        var failures: [String] = []
+        DispatchQueue.concurrentPerform(iterations: 5) { worker in
+            do {
+                let conn = try Connection(db)
+                if worker == 0 {
+                    for batch in 0..<numBatches {
+                        let start = batch * batchSize
+                        _ = try conn.query(
+                            "UNWIND range(\(start), \(start + batchSize - 1)) AS i CREATE (:Item {id: i});"
+                        )
+                        if batch % 5 == 4 {
+                            _ = try conn.query("CHECKPOINT;")
+                        }
+                    }
+                    return
+                }
+                var lastCount: Int64 = 0
+                for _ in 0..<100 {
+                    let result = try conn.query("MATCH (i:Item) RETURN count(*);")
+                    let count = try result.getNext()!.getValue(0) as! Int64
+                    if count % Int64(batchSize) != 0 || count < lastCount {
+                        lock.lock()
+                        failures.append("Reader \(worker) saw \(count) after \(lastCount)")
+                        lock.unlock()
+                    }
+                    lastCount = count
+                }
+            } catch {
+                lock.lock()
+                failures.append("Worker \(worker) failed: \(error)")
+                lock.unlock()
+            }
+        }
+        XCTAssertEqual(failures, [])
+
+        let result = try setupConn.query("MATCH (i:Item) RETURN count(*);")
+        let count = try result.getNext()!.getValue(0) as! Int64
+        XCTAssertEqual(count, Int64(numBatches * batchSize))
+
+        // Cleanup
+        deleteTestDatabaseDirectory(dbPath)
+    }
 }